@@ -0,0 +1,2208 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast_boost
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__48703320;
+extern StructInfo __struct_info__dd194b1c;
+extern StructInfo __struct_info__c9d26a46;
+extern StructInfo __struct_info__22c33332;
+extern StructInfo __struct_info__8c142b59;
+extern StructInfo __struct_info__713aafe3;
+extern StructInfo __struct_info__102fc31;
+extern StructInfo __struct_info__7b81962f;
+extern StructInfo __struct_info__4d24e047;
+extern StructInfo __struct_info__fd84a243;
+extern StructInfo __struct_info__7cf9187b;
+extern StructInfo __struct_info__142c88df;
+extern StructInfo __struct_info__2e1fb8cc;
+extern StructInfo __struct_info__5478d544;
+extern StructInfo __struct_info__6d01e87b;
+extern TypeInfo __type_info__57b510b2;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__aea00813;
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__2c29f04d;
+extern TypeInfo __type_info__a703f317;
+extern TypeInfo __type_info__47dfa545;
+extern TypeInfo __type_info__b6282f69;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__dcfff1ff;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__a0eb0f08;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__53c08386;
+extern TypeInfo __type_info__f955b4ec;
+extern TypeInfo __type_info__4e52e6ae;
+extern TypeInfo __type_info__8891fc55;
+extern TypeInfo __type_info__baa44de8;
+extern TypeInfo __type_info__9a94a3c7;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__8ce26751;
+extern TypeInfo __type_info__b9a2b501;
+extern TypeInfo __type_info__2d8fb614;
+extern TypeInfo __type_info__b38eb5b3;
+extern TypeInfo __type_info__a07921bf;
+extern TypeInfo __type_info__6e24d8c9;
+extern TypeInfo __type_info__cb9836a1;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__3494694f;
+extern TypeInfo __type_info__a80e24ba;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__8fd2ec2e;
+extern TypeInfo __type_info__a6c45d85;
+extern TypeInfo __type_info__b365c4dd;
+extern TypeInfo __type_info__7fa6728;
+extern TypeInfo __type_info__bf2d884b;
+extern TypeInfo __type_info__3d22364;
+extern TypeInfo __type_info__9750d32;
+extern TypeInfo __type_info__7482134c;
+extern TypeInfo __type_info__1daca05d;
+extern TypeInfo __type_info__b049b391;
+extern TypeInfo __type_info__c1bd2f4c;
+extern TypeInfo __type_info__ca846bdd;
+extern TypeInfo __type_info__79323f61;
+extern TypeInfo __type_info__f2cdf1a0;
+extern TypeInfo __type_info__8c0d0a29;
+extern TypeInfo __type_info__be386f7a;
+extern VarInfo __var_info__77df9a66;
+extern VarInfo __var_info__6aad9d64;
+extern VarInfo __var_info__f9bc7965;
+extern VarInfo __var_info__a02fd513;
+extern VarInfo __var_info__c571b58f;
+extern VarInfo __var_info__57e53bec;
+extern VarInfo __var_info__6b329e8b;
+extern VarInfo __var_info__511e23ce;
+extern VarInfo __var_info__7c2d3e11;
+extern VarInfo __var_info__52044e11;
+extern VarInfo __var_info__d2609a4e;
+extern VarInfo __var_info__16a94dea;
+extern VarInfo __var_info__3460fe1f;
+extern VarInfo __var_info__2ffa1ee0;
+extern VarInfo __var_info__a43d6ff2;
+extern VarInfo __var_info__d57e4fe4;
+extern VarInfo __var_info__4bcb951b;
+extern VarInfo __var_info__1f78c3bf;
+extern VarInfo __var_info__159c68d2;
+extern VarInfo __var_info__60d46062;
+extern VarInfo __var_info__f6145cb7;
+extern VarInfo __var_info__f00830bc;
+extern VarInfo __var_info__2b7f5817;
+extern VarInfo __var_info__bbdb4673;
+extern VarInfo __var_info__33d89d7e;
+extern VarInfo __var_info__a81b30fd;
+extern VarInfo __var_info__bf105019;
+extern VarInfo __var_info__b3114889;
+extern VarInfo __var_info__a4959c04;
+extern VarInfo __var_info__9531e073;
+extern VarInfo __var_info__39fe00b7;
+extern VarInfo __var_info__499e311a;
+extern VarInfo __var_info__45ad7657;
+extern VarInfo __var_info__6d57afde;
+extern VarInfo __var_info__cb901576;
+extern VarInfo __var_info__ca0e35c3;
+extern VarInfo __var_info__a77ea33c;
+extern VarInfo __var_info__602c8e49;
+extern VarInfo __var_info__86d294dc;
+extern VarInfo __var_info__1659989c;
+extern VarInfo __var_info__3d570b1b;
+extern VarInfo __var_info__1b5c47e2;
+extern VarInfo __var_info__8b673409;
+extern VarInfo __var_info__f179f1bf;
+extern VarInfo __var_info__f4603919;
+extern VarInfo __var_info__363b811a;
+extern VarInfo __var_info__436e3a45;
+extern VarInfo __var_info__3989b8f3;
+extern VarInfo __var_info__c44af8e7;
+extern VarInfo __var_info__1c223b0;
+extern VarInfo __var_info__b502e8e4;
+extern VarInfo __var_info__69d14413;
+extern VarInfo __var_info__8d0e6828;
+extern VarInfo __var_info__398b718a;
+extern VarInfo __var_info__e2c16af4;
+extern VarInfo __var_info__e700fb87;
+extern VarInfo __var_info__b2847daf;
+extern VarInfo __var_info__505bcf7f;
+extern VarInfo __var_info__7b225b17;
+extern VarInfo __var_info__c726bba6;
+extern VarInfo __var_info__e66a0596;
+extern VarInfo __var_info__4c663710;
+extern VarInfo __var_info__13af6b34;
+extern VarInfo __var_info__76a80546;
+extern VarInfo __var_info__43b9e565;
+extern VarInfo __var_info__44b6a0fd;
+extern VarInfo __var_info__4cb99b2c;
+extern VarInfo __var_info__cf642f18;
+extern VarInfo __var_info__755f9a83;
+extern VarInfo __var_info__b82f2817;
+extern VarInfo __var_info__d9124691;
+extern VarInfo __var_info__28e3bb56;
+extern VarInfo __var_info__6197a9c8;
+extern VarInfo __var_info__3f72b0d7;
+extern VarInfo __var_info__97d8818a;
+extern VarInfo __var_info__f4ff6d4;
+extern VarInfo __var_info__57b2361f;
+extern VarInfo __var_info__a0753bb2;
+extern VarInfo __var_info__5707734;
+extern VarInfo __var_info__efedf9da;
+extern VarInfo __var_info__ddae6cf;
+extern VarInfo __var_info__cf2022a;
+extern VarInfo __var_info__ed3d60ef;
+extern VarInfo __var_info__99cd789b;
+extern VarInfo __var_info__8f6dbdea;
+extern VarInfo __var_info__e61c1fde;
+extern VarInfo __var_info__79d250af;
+extern VarInfo __var_info__55fdf176;
+extern VarInfo __var_info__9b50411a;
+extern VarInfo __var_info__70fbc23b;
+extern VarInfo __var_info__d69970b7;
+extern FuncInfo __func_info__13ce5ebc;
+
+VarInfo __struct_info__48703320_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x70fbc23b, "__rtti", 0 };
+TypeInfo * __type_info__4c663710_arg_types_var_1215312672[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__48703320_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c663710_arg_types_var_1215312672, nullptr, 1, 0, nullptr, 28, 0x4c663710, "__finalize", 8 };
+TypeInfo * __type_info__1c223b0_arg_types_var_1215312672[3] = { &__type_info__a80e24ba, &__type_info__f955b4ec, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1c223b0_arg_types_var_1215312672, nullptr, 3, 0, nullptr, 28, 0x1c223b0, "transform", 12 };
+TypeInfo * __type_info__6197a9c8_arg_types_var_1215312672[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__6197a9c8_arg_types_var_1215312672, nullptr, 5, 0, nullptr, 28, 0x6197a9c8, "apply", 16 };
+TypeInfo * __type_info__3989b8f3_arg_types_var_1215312672[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3989b8f3_arg_types_var_1215312672, nullptr, 6, 0, nullptr, 28, 0x3989b8f3, "finish", 20 };
+VarInfo * __struct_info__48703320_fields[5] =  { &__struct_info__48703320_field_0, &__struct_info__48703320_field_1, &__struct_info__48703320_field_2, &__struct_info__48703320_field_3, &__struct_info__48703320_field_4 };
+StructInfo __struct_info__48703320 = {"AstFunctionAnnotation", __struct_info__48703320_fields, 5, 24, -1, nullptr, 0x48703320 };
+VarInfo __struct_info__dd194b1c_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xddae6cf, "__rtti", 0 };
+TypeInfo * __type_info__e2c16af4_arg_types_var_3709422364[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__dd194b1c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e2c16af4_arg_types_var_3709422364, nullptr, 1, 0, nullptr, 28, 0xe2c16af4, "__finalize", 8 };
+TypeInfo * __type_info__d57e4fe4_arg_types_var_3709422364[3] = { &__type_info__a80e24ba, &__type_info__f955b4ec, &__type_info__8ce26751 };
+VarInfo __struct_info__dd194b1c_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d57e4fe4_arg_types_var_3709422364, nullptr, 3, 0, nullptr, 28, 0xd57e4fe4, "transform", 12 };
+TypeInfo * __type_info__86d294dc_arg_types_var_3709422364[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__dd194b1c_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__86d294dc_arg_types_var_3709422364, nullptr, 5, 0, nullptr, 28, 0x86d294dc, "apply", 16 };
+TypeInfo * __type_info__c44af8e7_arg_types_var_3709422364[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__dd194b1c_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__c44af8e7_arg_types_var_3709422364, nullptr, 6, 0, nullptr, 28, 0xc44af8e7, "finish", 20 };
+VarInfo * __struct_info__dd194b1c_fields[5] =  { &__struct_info__dd194b1c_field_0, &__struct_info__dd194b1c_field_1, &__struct_info__dd194b1c_field_2, &__struct_info__dd194b1c_field_3, &__struct_info__dd194b1c_field_4 };
+StructInfo __struct_info__dd194b1c = {"TagFunctionAnnotation", __struct_info__dd194b1c_fields, 5, 24, -1, nullptr, 0xdd194b1c };
+VarInfo __struct_info__c9d26a46_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf9bc7965, "__rtti", 0 };
+TypeInfo * __type_info__1b5c47e2_arg_types_var_3386010182[1] = { &__type_info__baa44de8 };
+VarInfo __struct_info__c9d26a46_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1b5c47e2_arg_types_var_3386010182, nullptr, 1, 0, nullptr, 28, 0x1b5c47e2, "__finalize", 8 };
+TypeInfo * __type_info__b2847daf_arg_types_var_3386010182[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8c0d0a29 };
+VarInfo __struct_info__c9d26a46_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b2847daf_arg_types_var_3386010182, nullptr, 4, 0, nullptr, 28, 0xb2847daf, "visitExprIsVariant", 12 };
+TypeInfo * __type_info__e700fb87_arg_types_var_3386010182[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__b9a2b501 };
+VarInfo __struct_info__c9d26a46_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e700fb87_arg_types_var_3386010182, nullptr, 4, 0, nullptr, 28, 0xe700fb87, "visitExprAsVariant", 16 };
+TypeInfo * __type_info__f4ff6d4_arg_types_var_3386010182[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8fd2ec2e };
+VarInfo __struct_info__c9d26a46_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f4ff6d4_arg_types_var_3386010182, nullptr, 4, 0, nullptr, 28, 0xf4ff6d4, "visitExprSafeAsVariant", 20 };
+VarInfo * __struct_info__c9d26a46_fields[5] =  { &__struct_info__c9d26a46_field_0, &__struct_info__c9d26a46_field_1, &__struct_info__c9d26a46_field_2, &__struct_info__c9d26a46_field_3, &__struct_info__c9d26a46_field_4 };
+StructInfo __struct_info__c9d26a46 = {"AstVariantMacro", __struct_info__c9d26a46_fields, 5, 24, -1, nullptr, 0xc9d26a46 };
+VarInfo __struct_info__22c33332_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xbf105019, "__rtti", 0 };
+TypeInfo * __type_info__77df9a66_arg_types_var_583217970[1] = { &__type_info__baa44de8 };
+VarInfo __struct_info__22c33332_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__77df9a66_arg_types_var_583217970, nullptr, 1, 0, nullptr, 28, 0x77df9a66, "__finalize", 8 };
+TypeInfo * __type_info__755f9a83_arg_types_var_583217970[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8c0d0a29 };
+VarInfo __struct_info__22c33332_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__755f9a83_arg_types_var_583217970, nullptr, 4, 0, nullptr, 28, 0x755f9a83, "visitExprIsVariant", 12 };
+TypeInfo * __type_info__99cd789b_arg_types_var_583217970[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__b9a2b501 };
+VarInfo __struct_info__22c33332_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__99cd789b_arg_types_var_583217970, nullptr, 4, 0, nullptr, 28, 0x99cd789b, "visitExprAsVariant", 16 };
+TypeInfo * __type_info__8d0e6828_arg_types_var_583217970[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8fd2ec2e };
+VarInfo __struct_info__22c33332_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8d0e6828_arg_types_var_583217970, nullptr, 4, 0, nullptr, 28, 0x8d0e6828, "visitExprSafeAsVariant", 20 };
+VarInfo * __struct_info__22c33332_fields[5] =  { &__struct_info__22c33332_field_0, &__struct_info__22c33332_field_1, &__struct_info__22c33332_field_2, &__struct_info__22c33332_field_3, &__struct_info__22c33332_field_4 };
+StructInfo __struct_info__22c33332 = {"BetterRttiVisitor", __struct_info__22c33332_fields, 5, 24, -1, nullptr, 0x22c33332 };
+VarInfo __struct_info__8c142b59_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa77ea33c, "__rtti", 0 };
+TypeInfo * __type_info__7b225b17_arg_types_var_2350132057[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__8c142b59_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7b225b17_arg_types_var_2350132057, nullptr, 1, 0, nullptr, 28, 0x7b225b17, "__finalize", 8 };
+TypeInfo * __type_info__d9124691_arg_types_var_2350132057[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__8c142b59_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__d9124691_arg_types_var_2350132057, nullptr, 5, 0, nullptr, 28, 0xd9124691, "apply", 12 };
+TypeInfo * __type_info__cf642f18_arg_types_var_2350132057[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__8c142b59_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cf642f18_arg_types_var_2350132057, nullptr, 5, 0, nullptr, 28, 0xcf642f18, "finish", 16 };
+VarInfo __struct_info__8c142b59_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x57e53bec, "annotation_function_call", 24 };
+VarInfo __struct_info__8c142b59_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x1659989c, "name", 32 };
+TypeInfo * __type_info__7c2d3e11_arg_types_var_2350132057[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__8c142b59_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7c2d3e11_arg_types_var_2350132057, nullptr, 3, 0, nullptr, 28, 0x7c2d3e11, "setup_call", 40 };
+VarInfo * __struct_info__8c142b59_fields[7] =  { &__struct_info__8c142b59_field_0, &__struct_info__8c142b59_field_1, &__struct_info__8c142b59_field_2, &__struct_info__8c142b59_field_3, &__struct_info__8c142b59_field_4, &__struct_info__8c142b59_field_5, &__struct_info__8c142b59_field_6 };
+StructInfo __struct_info__8c142b59 = {"SetupFunctionAnnotatoin", __struct_info__8c142b59_fields, 7, 48, -1, nullptr, 0x8c142b59 };
+VarInfo __struct_info__713aafe3_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x159c68d2, "__rtti", 0 };
+TypeInfo * __type_info__43b9e565_arg_types_var_1899671523[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__713aafe3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43b9e565_arg_types_var_1899671523, nullptr, 1, 0, nullptr, 28, 0x43b9e565, "__finalize", 8 };
+TypeInfo * __type_info__1f78c3bf_arg_types_var_1899671523[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__713aafe3_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1f78c3bf_arg_types_var_1899671523, nullptr, 5, 0, nullptr, 28, 0x1f78c3bf, "apply", 12 };
+TypeInfo * __type_info__cb901576_arg_types_var_1899671523[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__713aafe3_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cb901576_arg_types_var_1899671523, nullptr, 5, 0, nullptr, 28, 0xcb901576, "finish", 16 };
+VarInfo * __struct_info__713aafe3_fields[4] =  { &__struct_info__713aafe3_field_0, &__struct_info__713aafe3_field_1, &__struct_info__713aafe3_field_2, &__struct_info__713aafe3_field_3 };
+StructInfo __struct_info__713aafe3 = {"AstStructureAnnotation", __struct_info__713aafe3_fields, 4, 24, -1, nullptr, 0x713aafe3 };
+VarInfo __struct_info__102fc31_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x13af6b34, "__rtti", 0 };
+TypeInfo * __type_info__79d250af_arg_types_var_16972849[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__102fc31_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__79d250af_arg_types_var_16972849, nullptr, 1, 0, nullptr, 28, 0x79d250af, "__finalize", 8 };
+TypeInfo * __type_info__8b673409_arg_types_var_16972849[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__102fc31_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__8b673409_arg_types_var_16972849, nullptr, 5, 0, nullptr, 28, 0x8b673409, "apply", 12 };
+TypeInfo * __type_info__2ffa1ee0_arg_types_var_16972849[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__102fc31_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__2ffa1ee0_arg_types_var_16972849, nullptr, 5, 0, nullptr, 28, 0x2ffa1ee0, "finish", 16 };
+VarInfo __struct_info__102fc31_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x5707734, "annotation_function_call", 24 };
+VarInfo __struct_info__102fc31_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x6aad9d64, "name", 32 };
+TypeInfo * __type_info__b3114889_arg_types_var_16972849[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__102fc31_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b3114889_arg_types_var_16972849, nullptr, 3, 0, nullptr, 28, 0xb3114889, "setup_call", 40 };
+VarInfo * __struct_info__102fc31_fields[7] =  { &__struct_info__102fc31_field_0, &__struct_info__102fc31_field_1, &__struct_info__102fc31_field_2, &__struct_info__102fc31_field_3, &__struct_info__102fc31_field_4, &__struct_info__102fc31_field_5, &__struct_info__102fc31_field_6 };
+StructInfo __struct_info__102fc31 = {"SetupReaderMacro", __struct_info__102fc31_fields, 7, 48, -1, nullptr, 0x102fc31 };
+VarInfo __struct_info__7b81962f_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x55fdf176, "__rtti", 0 };
+TypeInfo * __type_info__f4603919_arg_types_var_2072090159[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__7b81962f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f4603919_arg_types_var_2072090159, nullptr, 1, 0, nullptr, 28, 0xf4603919, "__finalize", 8 };
+TypeInfo * __type_info__ca0e35c3_arg_types_var_2072090159[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__7b81962f_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__ca0e35c3_arg_types_var_2072090159, nullptr, 5, 0, nullptr, 28, 0xca0e35c3, "apply", 12 };
+TypeInfo * __type_info__cf2022a_arg_types_var_2072090159[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__7b81962f_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cf2022a_arg_types_var_2072090159, nullptr, 5, 0, nullptr, 28, 0xcf2022a, "finish", 16 };
+VarInfo * __struct_info__7b81962f_fields[4] =  { &__struct_info__7b81962f_field_0, &__struct_info__7b81962f_field_1, &__struct_info__7b81962f_field_2, &__struct_info__7b81962f_field_3 };
+StructInfo __struct_info__7b81962f = {"TagStructureAnnotation", __struct_info__7b81962f_fields, 4, 24, -1, nullptr, 0x7b81962f };
+VarInfo __struct_info__4d24e047_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd2609a4e, "__rtti", 0 };
+TypeInfo * __type_info__52044e11_arg_types_var_1294262343[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__4d24e047_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__52044e11_arg_types_var_1294262343, nullptr, 1, 0, nullptr, 28, 0x52044e11, "__finalize", 8 };
+TypeInfo * __type_info__3d570b1b_arg_types_var_1294262343[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__4d24e047_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3d570b1b_arg_types_var_1294262343, nullptr, 5, 0, nullptr, 28, 0x3d570b1b, "apply", 12 };
+TypeInfo * __type_info__a43d6ff2_arg_types_var_1294262343[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__4d24e047_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__a43d6ff2_arg_types_var_1294262343, nullptr, 5, 0, nullptr, 28, 0xa43d6ff2, "finish", 16 };
+VarInfo __struct_info__4d24e047_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0xe66a0596, "annotation_function_call", 24 };
+VarInfo __struct_info__4d24e047_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x76a80546, "name", 32 };
+TypeInfo * __type_info__4bcb951b_arg_types_var_1294262343[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__4d24e047_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4bcb951b_arg_types_var_1294262343, nullptr, 3, 0, nullptr, 28, 0x4bcb951b, "setup_call", 40 };
+VarInfo __struct_info__4d24e047_field_7 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x9531e073, "tag", 48 };
+VarInfo * __struct_info__4d24e047_fields[8] =  { &__struct_info__4d24e047_field_0, &__struct_info__4d24e047_field_1, &__struct_info__4d24e047_field_2, &__struct_info__4d24e047_field_3, &__struct_info__4d24e047_field_4, &__struct_info__4d24e047_field_5, &__struct_info__4d24e047_field_6, &__struct_info__4d24e047_field_7 };
+StructInfo __struct_info__4d24e047 = {"TagFunctionMacro", __struct_info__4d24e047_fields, 8, 56, -1, nullptr, 0x4d24e047 };
+VarInfo __struct_info__fd84a243_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa0753bb2, "__rtti", 0 };
+TypeInfo * __type_info__436e3a45_arg_types_var_4253327939[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__fd84a243_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__436e3a45_arg_types_var_4253327939, nullptr, 1, 0, nullptr, 28, 0x436e3a45, "__finalize", 8 };
+TypeInfo * __type_info__ed3d60ef_arg_types_var_4253327939[3] = { &__type_info__a80e24ba, &__type_info__f955b4ec, &__type_info__8ce26751 };
+VarInfo __struct_info__fd84a243_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ed3d60ef_arg_types_var_4253327939, nullptr, 3, 0, nullptr, 28, 0xed3d60ef, "transform", 12 };
+TypeInfo * __type_info__3460fe1f_arg_types_var_4253327939[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__fd84a243_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3460fe1f_arg_types_var_4253327939, nullptr, 5, 0, nullptr, 28, 0x3460fe1f, "apply", 16 };
+TypeInfo * __type_info__28e3bb56_arg_types_var_4253327939[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__fd84a243_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__28e3bb56_arg_types_var_4253327939, nullptr, 6, 0, nullptr, 28, 0x28e3bb56, "finish", 20 };
+VarInfo * __struct_info__fd84a243_fields[5] =  { &__struct_info__fd84a243_field_0, &__struct_info__fd84a243_field_1, &__struct_info__fd84a243_field_2, &__struct_info__fd84a243_field_3, &__struct_info__fd84a243_field_4 };
+StructInfo __struct_info__fd84a243 = {"MacroMacro", __struct_info__fd84a243_fields, 5, 24, -1, nullptr, 0xfd84a243 };
+VarInfo __struct_info__7cf9187b_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x16a94dea, "__rtti", 0 };
+TypeInfo * __type_info__a81b30fd_arg_types_var_2096699515[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__7cf9187b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a81b30fd_arg_types_var_2096699515, nullptr, 1, 0, nullptr, 28, 0xa81b30fd, "__finalize", 8 };
+TypeInfo * __type_info__2b7f5817_arg_types_var_2096699515[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__7cf9187b_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__2b7f5817_arg_types_var_2096699515, nullptr, 5, 0, nullptr, 28, 0x2b7f5817, "apply", 12 };
+TypeInfo * __type_info__6d57afde_arg_types_var_2096699515[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__7cf9187b_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__6d57afde_arg_types_var_2096699515, nullptr, 5, 0, nullptr, 28, 0x6d57afde, "finish", 16 };
+VarInfo __struct_info__7cf9187b_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x9b50411a, "annotation_function_call", 24 };
+VarInfo __struct_info__7cf9187b_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x97d8818a, "name", 32 };
+TypeInfo * __type_info__39fe00b7_arg_types_var_2096699515[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__7cf9187b_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__39fe00b7_arg_types_var_2096699515, nullptr, 3, 0, nullptr, 28, 0x39fe00b7, "setup_call", 40 };
+VarInfo * __struct_info__7cf9187b_fields[7] =  { &__struct_info__7cf9187b_field_0, &__struct_info__7cf9187b_field_1, &__struct_info__7cf9187b_field_2, &__struct_info__7cf9187b_field_3, &__struct_info__7cf9187b_field_4, &__struct_info__7cf9187b_field_5, &__struct_info__7cf9187b_field_6 };
+StructInfo __struct_info__7cf9187b = {"SetupAnyAnnotation", __struct_info__7cf9187b_fields, 7, 48, -1, nullptr, 0x7cf9187b };
+VarInfo __struct_info__142c88df_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc726bba6, "__rtti", 0 };
+TypeInfo * __type_info__602c8e49_arg_types_var_338462943[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__142c88df_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__602c8e49_arg_types_var_338462943, nullptr, 1, 0, nullptr, 28, 0x602c8e49, "__finalize", 8 };
+TypeInfo * __type_info__a02fd513_arg_types_var_338462943[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__142c88df_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__a02fd513_arg_types_var_338462943, nullptr, 5, 0, nullptr, 28, 0xa02fd513, "apply", 12 };
+TypeInfo * __type_info__efedf9da_arg_types_var_338462943[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__142c88df_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__efedf9da_arg_types_var_338462943, nullptr, 5, 0, nullptr, 28, 0xefedf9da, "finish", 16 };
+VarInfo __struct_info__142c88df_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x33d89d7e, "annotation_function_call", 24 };
+VarInfo __struct_info__142c88df_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x511e23ce, "name", 32 };
+TypeInfo * __type_info__bbdb4673_arg_types_var_338462943[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__142c88df_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bbdb4673_arg_types_var_338462943, nullptr, 3, 0, nullptr, 28, 0xbbdb4673, "setup_call", 40 };
+VarInfo * __struct_info__142c88df_fields[7] =  { &__struct_info__142c88df_field_0, &__struct_info__142c88df_field_1, &__struct_info__142c88df_field_2, &__struct_info__142c88df_field_3, &__struct_info__142c88df_field_4, &__struct_info__142c88df_field_5, &__struct_info__142c88df_field_6 };
+StructInfo __struct_info__142c88df = {"SetupVariantMacro", __struct_info__142c88df_fields, 7, 48, -1, nullptr, 0x142c88df };
+VarInfo __struct_info__2e1fb8cc_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x505bcf7f, "__rtti", 0 };
+TypeInfo * __type_info__b502e8e4_arg_types_var_773830860[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__2e1fb8cc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b502e8e4_arg_types_var_773830860, nullptr, 1, 0, nullptr, 28, 0xb502e8e4, "__finalize", 8 };
+TypeInfo * __type_info__4cb99b2c_arg_types_var_773830860[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__2e1fb8cc_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__4cb99b2c_arg_types_var_773830860, nullptr, 5, 0, nullptr, 28, 0x4cb99b2c, "apply", 12 };
+TypeInfo * __type_info__3f72b0d7_arg_types_var_773830860[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__2e1fb8cc_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3f72b0d7_arg_types_var_773830860, nullptr, 5, 0, nullptr, 28, 0x3f72b0d7, "finish", 16 };
+VarInfo __struct_info__2e1fb8cc_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0xc571b58f, "annotation_function_call", 24 };
+VarInfo __struct_info__2e1fb8cc_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x6b329e8b, "name", 32 };
+TypeInfo * __type_info__60d46062_arg_types_var_773830860[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__2e1fb8cc_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__60d46062_arg_types_var_773830860, nullptr, 3, 0, nullptr, 28, 0x60d46062, "setup_call", 40 };
+VarInfo * __struct_info__2e1fb8cc_fields[7] =  { &__struct_info__2e1fb8cc_field_0, &__struct_info__2e1fb8cc_field_1, &__struct_info__2e1fb8cc_field_2, &__struct_info__2e1fb8cc_field_3, &__struct_info__2e1fb8cc_field_4, &__struct_info__2e1fb8cc_field_5, &__struct_info__2e1fb8cc_field_6 };
+StructInfo __struct_info__2e1fb8cc = {"SetupCallMacro", __struct_info__2e1fb8cc_fields, 7, 48, -1, nullptr, 0x2e1fb8cc };
+VarInfo __struct_info__5478d544_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x45ad7657, "__rtti", 0 };
+TypeInfo * __type_info__f00830bc_arg_types_var_1417205060[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__5478d544_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f00830bc_arg_types_var_1417205060, nullptr, 1, 0, nullptr, 28, 0xf00830bc, "__finalize", 8 };
+TypeInfo * __type_info__a4959c04_arg_types_var_1417205060[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__5478d544_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__a4959c04_arg_types_var_1417205060, nullptr, 5, 0, nullptr, 28, 0xa4959c04, "apply", 12 };
+TypeInfo * __type_info__f179f1bf_arg_types_var_1417205060[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__5478d544_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__f179f1bf_arg_types_var_1417205060, nullptr, 5, 0, nullptr, 28, 0xf179f1bf, "finish", 16 };
+VarInfo __struct_info__5478d544_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0xf6145cb7, "annotation_function_call", 24 };
+VarInfo __struct_info__5478d544_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x69d14413, "name", 32 };
+TypeInfo * __type_info__363b811a_arg_types_var_1417205060[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__5478d544_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__363b811a_arg_types_var_1417205060, nullptr, 3, 0, nullptr, 28, 0x363b811a, "setup_call", 40 };
+VarInfo * __struct_info__5478d544_fields[7] =  { &__struct_info__5478d544_field_0, &__struct_info__5478d544_field_1, &__struct_info__5478d544_field_2, &__struct_info__5478d544_field_3, &__struct_info__5478d544_field_4, &__struct_info__5478d544_field_5, &__struct_info__5478d544_field_6 };
+StructInfo __struct_info__5478d544 = {"SetupInferMacro", __struct_info__5478d544_fields, 7, 48, -1, nullptr, 0x5478d544 };
+VarInfo __struct_info__6d01e87b_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8f6dbdea, "__rtti", 0 };
+TypeInfo * __type_info__44b6a0fd_arg_types_var_1828841595[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__6d01e87b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__44b6a0fd_arg_types_var_1828841595, nullptr, 1, 0, nullptr, 28, 0x44b6a0fd, "__finalize", 8 };
+TypeInfo * __type_info__b82f2817_arg_types_var_1828841595[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__6d01e87b_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__b82f2817_arg_types_var_1828841595, nullptr, 5, 0, nullptr, 28, 0xb82f2817, "apply", 12 };
+TypeInfo * __type_info__e61c1fde_arg_types_var_1828841595[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__6d01e87b_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__e61c1fde_arg_types_var_1828841595, nullptr, 5, 0, nullptr, 28, 0xe61c1fde, "finish", 16 };
+VarInfo __struct_info__6d01e87b_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x499e311a, "annotation_function_call", 24 };
+VarInfo __struct_info__6d01e87b_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x398b718a, "name", 32 };
+TypeInfo * __type_info__d69970b7_arg_types_var_1828841595[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__6d01e87b_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d69970b7_arg_types_var_1828841595, nullptr, 3, 0, nullptr, 28, 0xd69970b7, "setup_call", 40 };
+VarInfo * __struct_info__6d01e87b_fields[7] =  { &__struct_info__6d01e87b_field_0, &__struct_info__6d01e87b_field_1, &__struct_info__6d01e87b_field_2, &__struct_info__6d01e87b_field_3, &__struct_info__6d01e87b_field_4, &__struct_info__6d01e87b_field_5, &__struct_info__6d01e87b_field_6 };
+StructInfo __struct_info__6d01e87b = {"SetupStructureMacro", __struct_info__6d01e87b_fields, 7, 48, -1, nullptr, 0x6d01e87b };
+VarInfo __func_info__13ce5ebc_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x57b2361f, "func", 0 };
+VarInfo * __func_info__13ce5ebc_fields[1] =  { &__func_info__13ce5ebc_field_0 };
+FuncInfo __func_info__13ce5ebc = {"invoke block<(func:smart_ptr<ast::Function>):void> const", "", __func_info__13ce5ebc_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x13ce5ebc, 0x0 };
+TypeInfo __type_info__57b510b2 = { Type::tStructure, &__struct_info__5478d544, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x57b510b2 };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__aea00813 = { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xaea00813 };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__2c29f04d = { Type::anyArgument, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x2c29f04d };
+TypeInfo __type_info__a703f317 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 258, 0xa703f317 };
+TypeInfo __type_info__47dfa545 = { Type::tStructure, &__struct_info__142c88df, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x47dfa545 };
+TypeInfo __type_info__b6282f69 = { Type::tStructure, &__struct_info__fd84a243, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb6282f69 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__dcfff1ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xdcfff1ff };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__a0eb0f08 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa0eb0f08 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__53c08386 = { Type::tStructure, &__struct_info__2e1fb8cc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x53c08386 };
+TypeInfo __type_info__f955b4ec = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be386f7a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xf955b4ec };
+TypeInfo __type_info__4e52e6ae = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Structure"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4e52e6ae };
+TypeInfo __type_info__8891fc55 = { Type::tStructure, &__struct_info__713aafe3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x8891fc55 };
+TypeInfo __type_info__baa44de8 = { Type::tStructure, &__struct_info__c9d26a46, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xbaa44de8 };
+TypeInfo __type_info__9a94a3c7 = { Type::tStructure, &__struct_info__8c142b59, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x9a94a3c7 };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__8ce26751 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8ce26751 };
+TypeInfo __type_info__b9a2b501 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b38eb5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9a2b501 };
+TypeInfo __type_info__2d8fb614 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x2d8fb614 };
+TypeInfo __type_info__b38eb5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb38eb5b3 };
+TypeInfo __type_info__a07921bf = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::AnnotationArgumentList"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xa07921bf };
+TypeInfo __type_info__6e24d8c9 = { Type::tStructure, &__struct_info__4d24e047, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x6e24d8c9 };
+TypeInfo __type_info__cb9836a1 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xcb9836a1 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__3494694f = { Type::tStructure, &__struct_info__102fc31, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x3494694f };
+TypeInfo __type_info__a80e24ba = { Type::tStructure, &__struct_info__48703320, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xa80e24ba };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__8fd2ec2e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f2cdf1a0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fd2ec2e };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+TypeInfo __type_info__b365c4dd = { Type::tStructure, &__struct_info__7b81962f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb365c4dd };
+TypeInfo __type_info__7fa6728 = { Type::tStructure, &__struct_info__22c33332, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x7fa6728 };
+TypeInfo __type_info__bf2d884b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbf2d884b };
+TypeInfo __type_info__3d22364 = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x3d22364 };
+TypeInfo __type_info__9750d32 = { Type::tStructure, &__struct_info__dd194b1c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x9750d32 };
+TypeInfo * __type_info__7482134c_arg_types[9] = { &__type_info__c894953d, &__type_info__95e97e5e, &__type_info__cb9836a1, &__type_info__3d22364, &__type_info__aea00813, &__type_info__a6c45d85, &__type_info__a0eb0f08, &__type_info__17c16538, &__type_info__2c29f04d };
+const char * __type_info__7482134c_arg_names[9] = { "tBool", "tInt", "tUInt", "tInt64", "tUInt64", "tFloat", "tDouble", "tString", "nothing" };
+TypeInfo __type_info__7482134c = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__7482134c_arg_types, (char **)__type_info__7482134c_arg_names, 9, 0, nullptr, 6, 0x7482134c };
+TypeInfo __type_info__1daca05d = { Type::tStructure, &__struct_info__7cf9187b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x1daca05d };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+TypeInfo __type_info__c1bd2f4c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ModuleGroup"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc1bd2f4c };
+TypeInfo __type_info__ca846bdd = { Type::tStructure, &__struct_info__6d01e87b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0xca846bdd };
+TypeInfo __type_info__79323f61 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Function"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x79323f61 };
+TypeInfo __type_info__f2cdf1a0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf2cdf1a0 };
+TypeInfo __type_info__8c0d0a29 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bf2d884b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8c0d0a29 };
+TypeInfo __type_info__be386f7a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbe386f7a };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_1[3] = { &__type_info__e8c29053, &__type_info__3ffbf730, &__type_info__7482134c };
+TypeInfo * __tinfo_2[4] = { &__type_info__e8c29053, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_4[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_5[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_6[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_7[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_8[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_9[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_10[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_11[1] = { &__type_info__3ffbf730 };
+TypeInfo * __tinfo_12[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_13[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+namespace ast {
+
+struct AstFunctionAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstFunctionAnnotation,smart_ptr_raw<ExprCall>,das::string)) transform;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AstFunctionAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==20,"structure field offset mismatch with DAS");
+}
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+namespace ast {
+
+struct AstStructureAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AstStructureAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,finish)==16,"structure field offset mismatch with DAS");
+}
+namespace ast {
+
+struct AstVariantMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstVariantMacro)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(AstVariantMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprIsVariant)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprAsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprSafeAsVariant)==20,"structure field offset mismatch with DAS");
+}
+// unused structure AstVisitor
+namespace ast_boost {
+
+struct MacroMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstFunctionAnnotation,smart_ptr_raw<ExprCall>,das::string)) transform;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(MacroMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(MacroMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,finish)==20,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagFunctionAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstFunctionAnnotation,smart_ptr_raw<ExprCall>,das::string)) transform;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(TagFunctionAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,finish)==20,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagStructureAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(TagStructureAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,finish)==16,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupAnyAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,struct ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupAnyAnnotation)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupFunctionAnnotatoin {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,struct ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupFunctionAnnotatoin)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupReaderMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,struct ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupReaderMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupVariantMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,struct ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupVariantMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupCallMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,struct ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupCallMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupStructureMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,struct ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupStructureMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupInferMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,struct ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupInferMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagFunctionMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,struct ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+	char * tag;
+};
+static_assert(sizeof(TagFunctionMacro)==56,"structure size mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,setup_call)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,tag)==48,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct BetterRttiVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstVariantMacro)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(BetterRttiVisitor)==24,"structure size mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprIsVariant)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprAsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprSafeAsVariant)==20,"structure field offset mismatch with DAS");
+}
+
+inline struct ast_boost::BetterRttiVisitor BetterRttiVisitor_43a800514ebc3901 ( Context * __context__ );
+inline void _FuncBetterRttiVisitor_0x27___finalize_8fbf6eed44433a63 ( Context * __context__, struct ast_boost::BetterRttiVisitor & __self_rename_at_261 );
+inline smart_ptr_raw<Expression> _FuncBetterRttiVisitor_0x60_visitExprIsVariant_c1146ef06505d2d0 ( Context * __context__, struct ast_boost::BetterRttiVisitor & __self_rename_at_262, smart_ptr_raw<Program> const  __prog_rename_at_262, Module * const  __mod_rename_at_262, smart_ptr_raw<ExprIsVariant> const  __expr_rename_at_262 );
+inline struct ast_boost::MacroMacro MacroMacro_fb2a4f39105ca505 ( Context * __context__ );
+inline void _FuncMacroMacro_0x27___finalize_5893bef35b89221f ( Context * __context__, struct ast_boost::MacroMacro & __self_rename_at_79 );
+inline bool _FuncMacroMacro_0x60_apply_8768a9be3443b9df ( Context * __context__, struct ast_boost::MacroMacro & __self_rename_at_80, smart_ptr_raw<Function> __func_rename_at_80, ModuleGroup & __group_rename_at_80, AnnotationArgumentList const  & __args_rename_at_80, das::string & __errors_rename_at_80 );
+inline bool _FuncSetupAnyAnnotation_0x60_apply_2fe75f3f01c0c452 ( Context * __context__, struct ast_boost::SetupAnyAnnotation & __self_rename_at_209, smart_ptr_raw<Structure> __st_rename_at_209, ModuleGroup & __group_rename_at_209, AnnotationArgumentList const  & __args_rename_at_209, das::string & __errors_rename_at_209 );
+inline void _FuncSetupAnyAnnotation_0x60_setup_call_8eaf665bd176c1ad ( Context * __context__, struct ast_boost::SetupAnyAnnotation & __self_rename_at_207, smart_ptr_raw<Structure> __st_rename_at_207, smart_ptr_raw<ExprCall> __cll_rename_at_207 );
+inline struct ast_boost::SetupCallMacro SetupCallMacro_8f1d72a938a7426f ( Context * __context__ );
+inline void _FuncSetupCallMacro_0x27___finalize_2a4680adddc49563 ( Context * __context__, struct ast_boost::SetupCallMacro & __self_rename_at_235 );
+inline struct ast_boost::SetupFunctionAnnotatoin SetupFunctionAnnotatoin_dc86c63a66feead2 ( Context * __context__ );
+inline void _FuncSetupFunctionAnnotatoin_0x27___finalize_36429344cbd76129 ( Context * __context__, struct ast_boost::SetupFunctionAnnotatoin & __self_rename_at_226 );
+inline struct ast_boost::SetupInferMacro SetupInferMacro_cb0fc2fadfd89103 ( Context * __context__ );
+inline void _FuncSetupInferMacro_0x27___finalize_6a72e0c28c729ddf ( Context * __context__, struct ast_boost::SetupInferMacro & __self_rename_at_241 );
+inline struct ast_boost::SetupReaderMacro SetupReaderMacro_7ce127a3f0f68d46 ( Context * __context__ );
+inline void _FuncSetupReaderMacro_0x27___finalize_dbbebee5997c4d37 ( Context * __context__, struct ast_boost::SetupReaderMacro & __self_rename_at_229 );
+inline struct ast_boost::SetupStructureMacro SetupStructureMacro_66fbf3d86127c8c1 ( Context * __context__ );
+inline void _FuncSetupStructureMacro_0x27___finalize_5f11c4a69a57676d ( Context * __context__, struct ast_boost::SetupStructureMacro & __self_rename_at_238 );
+inline struct ast_boost::SetupVariantMacro SetupVariantMacro_d398499799a61270 ( Context * __context__ );
+inline void _FuncSetupVariantMacro_0x27___finalize_951875bdcf538d5 ( Context * __context__, struct ast_boost::SetupVariantMacro & __self_rename_at_232 );
+inline struct ast_boost::TagFunctionAnnotation TagFunctionAnnotation_c8afeab054eec80d ( Context * __context__ );
+inline void _FuncTagFunctionAnnotation_0x27___finalize_be243eed87306007 ( Context * __context__, struct ast_boost::TagFunctionAnnotation & __self_rename_at_90 );
+inline bool _FuncTagFunctionAnnotation_0x60_apply_831d892a28bfa169 ( Context * __context__, struct ast_boost::TagFunctionAnnotation & __self_rename_at_91, smart_ptr_raw<Function> __func_rename_at_91, ModuleGroup & __group_rename_at_91, AnnotationArgumentList const  & __args_rename_at_91, das::string & __errors_rename_at_91 );
+inline struct ast_boost::TagFunctionMacro TagFunctionMacro_51f5d0c9e4f6426d ( Context * __context__ );
+inline void _FuncTagFunctionMacro_0x27___finalize_825dbbe27e243913 ( Context * __context__, struct ast_boost::TagFunctionMacro & __self_rename_at_244 );
+inline bool _FuncTagFunctionMacro_0x60_apply_dea4df200f3fb5b0 ( Context * __context__, struct ast_boost::TagFunctionMacro & __self_rename_at_250, smart_ptr_raw<Structure> __st_rename_at_250, ModuleGroup & __group_rename_at_250, AnnotationArgumentList const  & __args_rename_at_250, das::string & __errors_rename_at_250 );
+inline void _FuncTagFunctionMacro_0x60_setup_call_461d4ee0a6be8659 ( Context * __context__, struct ast_boost::TagFunctionMacro & __self_rename_at_247, smart_ptr_raw<Structure> __st_rename_at_247, smart_ptr_raw<ExprCall> __cll_rename_at_247 );
+inline struct ast_boost::TagStructureAnnotation TagStructureAnnotation_4b3c108e3e55ce30 ( Context * __context__ );
+inline void _FuncTagStructureAnnotation_0x27___finalize_8e605accd8e095b ( Context * __context__, struct ast_boost::TagStructureAnnotation & __self_rename_at_100 );
+inline bool _FuncTagStructureAnnotation_0x60_apply_a2336767c0c0b1cb ( Context * __context__, struct ast_boost::TagStructureAnnotation & __self_rename_at_101, smart_ptr_raw<Structure> __str_rename_at_101, ModuleGroup & __group_rename_at_101, AnnotationArgumentList const  & __args_rename_at_101, das::string & __errors_rename_at_101 );
+inline void apply_tag_annotation_defdf759f8201948 ( Context * __context__, char * const  __tag_rename_at_132, smart_ptr_raw<FunctionAnnotation> const  __ann_rename_at_132 );
+inline void _Funcast_0x60_add_new_function_annotation_cf523e7e76e00096 ( Context * __context__, char * const  __name_rename_at_497, struct ast_boost::MacroMacro * const  __someClassPtr_rename_at_497 );
+inline void _Funcast_0x60_add_new_function_annotation_d5617b03b1a4ac8e ( Context * __context__, char * const  __name_rename_at_497, struct ast_boost::TagFunctionAnnotation * const  __someClassPtr_rename_at_497 );
+inline void _Funcast_0x60_add_new_structure_annotation_f06b4439ae42129e ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupCallMacro * const  __someClassPtr_rename_at_503 );
+inline void _Funcast_0x60_add_new_structure_annotation_4706833bf75c0674 ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupFunctionAnnotatoin * const  __someClassPtr_rename_at_503 );
+inline void _Funcast_0x60_add_new_structure_annotation_6e6624c5849b86c4 ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupInferMacro * const  __someClassPtr_rename_at_503 );
+inline void _Funcast_0x60_add_new_structure_annotation_cf25ae0cd4e579ec ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupReaderMacro * const  __someClassPtr_rename_at_503 );
+inline void _Funcast_0x60_add_new_structure_annotation_d0d465637b6c881c ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupStructureMacro * const  __someClassPtr_rename_at_503 );
+inline void _Funcast_0x60_add_new_structure_annotation_343bf718246b02cc ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupVariantMacro * const  __someClassPtr_rename_at_503 );
+inline void _Funcast_0x60_add_new_structure_annotation_9bde045483f7e624 ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::TagFunctionMacro * const  __someClassPtr_rename_at_503 );
+inline void _Funcast_0x60_add_new_structure_annotation_6a05b75ea76a0444 ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::TagStructureAnnotation * const  __someClassPtr_rename_at_503 );
+inline void _Funcast_0x60_add_new_variant_macro_5d0e57796a52acbe ( Context * __context__, char * const  __name_rename_at_509, struct ast_boost::BetterRttiVisitor * const  __someClassPtr_rename_at_509 );
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_178b2214b0971652 ( Context * __context__, char * const  __name_rename_at_439, struct ast_boost::MacroMacro * const  __someClassPtr_rename_at_439 );
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_cbf559e9d8aaa49c ( Context * __context__, char * const  __name_rename_at_439, struct ast_boost::TagFunctionAnnotation * const  __someClassPtr_rename_at_439 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_7bf08e445ef74fb7 ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupCallMacro * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_5394f25399b410a3 ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupFunctionAnnotatoin * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_80ddaee29146c05 ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupInferMacro * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_b8777b33e9554cbb ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupReaderMacro * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_fb66f29d4086977f ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupStructureMacro * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_b5dd9bbe349cd2cb ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupVariantMacro * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_4aefda9ee1bddc93 ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::TagFunctionMacro * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_bd697be2b120f5b3 ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::TagStructureAnnotation * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<VariantMacro> _Funcast_0x60_make_variant_macro_33be8663053d6cb2 ( Context * __context__, char * const  __name_rename_at_489, struct ast_boost::BetterRttiVisitor * const  __someClassPtr_rename_at_489 );
+inline ExprBlock * _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903 ( Context * __context__, smart_ptr_raw<ExprBlock> const  __src_rename_at_701 );
+inline Structure * _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9 ( Context * __context__, smart_ptr_raw<Structure> const  __src_rename_at_701 );
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> & __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void clone_71815e7f31cbba07 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_186, smart_ptr_raw<ExprBlock> const  __src_rename_at_186 );
+inline char * const  describe_d96fc4bea3cd282 ( Context * __context__, AnnotationArgumentList const  & __list_rename_at_11 );
+inline char * describe_8f4b681e7ab7d244 ( Context * __context__, AnnotationDeclaration const  & __ann_rename_at_15 );
+inline char * const  describe_562242e81f0cb8da ( Context * __context__, AnnotationList const  & __list_rename_at_22 );
+inline void finalize_e39f6bf3901fe65e ( Context * __context__, struct ast_boost::BetterRttiVisitor & ____this_rename_at_261 );
+inline void finalize_1e05286024ffc9 ( Context * __context__, struct ast_boost::MacroMacro & ____this_rename_at_79 );
+inline void finalize_7741f20af8b390dc ( Context * __context__, struct ast_boost::SetupCallMacro & ____this_rename_at_235 );
+inline void finalize_d2d8d932b76c8507 ( Context * __context__, struct ast_boost::SetupFunctionAnnotatoin & ____this_rename_at_226 );
+inline void finalize_549b36d594098850 ( Context * __context__, struct ast_boost::SetupInferMacro & ____this_rename_at_241 );
+inline void finalize_7fe48452de3177af ( Context * __context__, struct ast_boost::SetupReaderMacro & ____this_rename_at_229 );
+inline void finalize_408cec3a0eef18bd ( Context * __context__, struct ast_boost::SetupStructureMacro & ____this_rename_at_238 );
+inline void finalize_85331723c3a41f85 ( Context * __context__, struct ast_boost::SetupVariantMacro & ____this_rename_at_232 );
+inline void finalize_5c3a9a623f3d9b38 ( Context * __context__, struct ast_boost::TagFunctionAnnotation & ____this_rename_at_90 );
+inline void finalize_34eecdde29f42869 ( Context * __context__, struct ast_boost::TagFunctionMacro & ____this_rename_at_244 );
+inline void finalize_3bd74c4615c1a065 ( Context * __context__, struct ast_boost::TagStructureAnnotation & ____this_rename_at_100 );
+inline TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> find_arg_48901e2fdfb01868 ( Context * __context__, char * const  __argn_rename_at_125, AnnotationArgumentList const  & __args_rename_at_125 );
+inline smart_ptr_raw<Function> find_unique_function_51f7514a784b90af ( Context * __context__, Module * const  __mod_rename_at_151, char * const  __name_rename_at_151 );
+inline smart_ptr_raw<Function> find_unique_generic_486a44e62e317dc7 ( Context * __context__, Module * const  __mod_rename_at_162, char * const  __name_rename_at_162 );
+inline void for_each_tag_function_156ad29b9fdef8c4 ( Context * __context__, Module * const  __mod_rename_at_110, char * const  __tag_rename_at_110, Block DAS_COMMENT((void,smart_ptr_raw<Function>)) const  & __blk_rename_at_110 );
+inline bool isExpression_33f1bf6f8c2e2753 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __t_rename_at_41, bool __top_rename_at_41 );
+inline TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _Funcrtti_0x60_RttiValue_nothing_c4cebcf8f2cab65d ( Context * __context__ );
+inline StructInfo const  * _Funcrtti_0x60_class_info_5c40c94f9433cf45 ( Context * __context__, struct ast_boost::BetterRttiVisitor const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_43b39f928a0c2cb4 ( Context * __context__, struct ast_boost::MacroMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_f7c42c96e955aecf ( Context * __context__, struct ast_boost::SetupCallMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_dfe6289f24a05dee ( Context * __context__, struct ast_boost::SetupFunctionAnnotatoin const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_fe0e1a3100a0e8cb ( Context * __context__, struct ast_boost::SetupInferMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_95f7c99d727943e ( Context * __context__, struct ast_boost::SetupReaderMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_82fb4b7363897b80 ( Context * __context__, struct ast_boost::SetupStructureMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_641c26f0b6e81a28 ( Context * __context__, struct ast_boost::SetupVariantMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_50ea2355bcfbadc3 ( Context * __context__, struct ast_boost::TagFunctionAnnotation const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_a06301811adbc864 ( Context * __context__, struct ast_boost::TagFunctionMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_937fa16735a67b08 ( Context * __context__, struct ast_boost::TagStructureAnnotation const  & __cl_rename_at_88 );
+inline void setup_c734ccfdf563909 ( Context * __context__ );
+inline ExprBlock * setup_macro_c01015f62fd7b19b ( Context * __context__, char * const  __name_rename_at_173, LineInfo const  & __at_rename_at_173 );
+inline char * const  _Funcstrings_boost_0x60_join_7a2ff2ee78269e80 ( Context * __context__, TArray<char *> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	setup_c734ccfdf563909(__context__);
+}
+
+inline struct ast_boost::BetterRttiVisitor BetterRttiVisitor_43a800514ebc3901 ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::BetterRttiVisitor {
+		struct ast_boost::BetterRttiVisitor __mks_261;
+		das_zero(__mks_261);
+		das_copy((__mks_261.__rtti),(((void *)(&__type_info__7fa6728))));
+		das_copy((__mks_261.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstVariantMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::BetterRttiVisitor'__finalize BetterRttiVisitor*/ 1965574790u)))));
+		das_copy((__mks_261.visitExprIsVariant),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::BetterRttiVisitor`visitExprIsVariant BetterRttiVisitor #smart_ptr##handle#Program#const #ptr##handle#Module#const #smart_ptr##handle#ExprIsVariant#const*/ 659042436u)))));
+		return __mks_261;
+	})());
+}
+
+inline void _FuncBetterRttiVisitor_0x27___finalize_8fbf6eed44433a63 ( Context * __context__, struct ast_boost::BetterRttiVisitor &  __self_rename_at_261 )
+{
+	finalize_e39f6bf3901fe65e(__context__,das_arg<struct ast_boost::BetterRttiVisitor>::pass(__self_rename_at_261));
+}
+
+inline smart_ptr_raw<Expression> _FuncBetterRttiVisitor_0x60_visitExprIsVariant_c1146ef06505d2d0 ( Context * __context__, struct ast_boost::BetterRttiVisitor &  __self_rename_at_262, smart_ptr_raw<Program> const  __prog_rename_at_262, Module * const  __mod_rename_at_262, smart_ptr_raw<ExprIsVariant> const  __expr_rename_at_262 ) { das_stack_prologue __prologue(__context__,320,"BetterRttiVisitor`visitExprIsVariant " DAS_FILE_LINE);
+{
+	if ( isExpression_33f1bf6f8c2e2753(__context__,__expr_rename_at_262->value /*value*/->type /*_type*/,true) )
+	{
+		smart_ptr_raw<ExprField> __vdr_rename_at_264; das_zero(__vdr_rename_at_264); das_move(__vdr_rename_at_264, das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_264) {
+			das_copy((__mks_264.at /*at*/),(__expr_rename_at_262->at /*at*/));
+			das_move((__mks_264.value /*value*/),(clone_expression(__expr_rename_at_262->value /*value*/)));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_264.name /*name*/),((char *) "__rtti"));
+			}		}))));
+		smart_ptr_raw<ExprConstString> __cna_rename_at_265; das_zero(__cna_rename_at_265); das_move(__cna_rename_at_265, das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_265) {
+			das_copy((__mks_265.at /*at*/),(__expr_rename_at_262->at /*at*/));
+			{
+				das_clone(__mks_265.text /*value*/,__expr_rename_at_262->name /*name*/);
+			}		}))));
+		smart_ptr_raw<ExprOp2> __veq_rename_at_266; das_zero(__veq_rename_at_266); das_move(__veq_rename_at_266, das_ascend_handle<true,smart_ptr_raw<ExprOp2>>::make(__context__,nullptr,(([&](ExprOp2 & __mks_266) {
+			das_copy((__mks_266.at /*at*/),(__expr_rename_at_262->at /*at*/));
+			das_move((__mks_266.left /*left*/),(__vdr_rename_at_264));
+			das_move((__mks_266.right /*right*/),(__cna_rename_at_265));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_266.op /*op*/),((char *) "=="));
+			}		}))));
+		return __veq_rename_at_266;
+	} else {
+		return nullptr;
+	};
+}}
+
+inline struct ast_boost::MacroMacro MacroMacro_fb2a4f39105ca505 ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::MacroMacro {
+		struct ast_boost::MacroMacro __mks_79;
+		das_zero(__mks_79);
+		das_copy((__mks_79.__rtti),(((void *)(&__type_info__b6282f69))));
+		das_copy((__mks_79.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::MacroMacro'__finalize MacroMacro*/ 875541486u)))));
+		das_copy((__mks_79.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::MacroMacro`apply MacroMacro #smart_ptr##handle#Function #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 2627544722u)))));
+		return __mks_79;
+	})());
+}
+
+inline void _FuncMacroMacro_0x27___finalize_5893bef35b89221f ( Context * __context__, struct ast_boost::MacroMacro &  __self_rename_at_79 )
+{
+	finalize_1e05286024ffc9(__context__,das_arg<struct ast_boost::MacroMacro>::pass(__self_rename_at_79));
+}
+
+inline bool _FuncMacroMacro_0x60_apply_8768a9be3443b9df ( Context * __context__, struct ast_boost::MacroMacro &  __self_rename_at_80, smart_ptr_raw<Function> __func_rename_at_80, ModuleGroup &  __group_rename_at_80, AnnotationArgumentList const  &  __args_rename_at_80, das::string &  __errors_rename_at_80 ) { das_stack_prologue __prologue(__context__,192,"MacroMacro`apply " DAS_FILE_LINE);
+{
+	compileProgram(__context__)->flags /*flags*/ |= 0x20u;
+	__func_rename_at_80->flags /*flags*/ |= 0x100u;
+	smart_ptr_raw<ExprBlock> __blk_rename_at_83; das_zero(__blk_rename_at_83); das_move(__blk_rename_at_83, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_83) {
+		das_copy((__mks_83.at /*at*/),(__func_rename_at_80->at /*at*/));
+	}))));
+	smart_ptr_raw<ExprCall> __ifm_rename_at_84; das_zero(__ifm_rename_at_84); das_move(__ifm_rename_at_84, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_84) {
+		das_copy((__mks_84.at /*at*/),(__func_rename_at_80->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_84.name /*name*/),((char *) "is_compiling_macros"));
+		}	}))));
+	smart_ptr_raw<ExprIfThenElse> __ife_rename_at_85; das_zero(__ife_rename_at_85); das_move(__ife_rename_at_85, das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_85) {
+		das_copy((__mks_85.at /*at*/),(__func_rename_at_80->at /*at*/));
+		das_move((__mks_85.cond /*cond*/),(__ifm_rename_at_84));
+		das_move((__mks_85.if_true /*if_true*/),(__func_rename_at_80->body /*body*/));
+	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_83->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__ife_rename_at_85));
+	das_move(__func_rename_at_80->body /*body*/,__blk_rename_at_83);
+	return true;
+}}
+
+inline bool _FuncSetupAnyAnnotation_0x60_apply_2fe75f3f01c0c452 ( Context * __context__, struct ast_boost::SetupAnyAnnotation &  __self_rename_at_209, smart_ptr_raw<Structure> __st_rename_at_209, ModuleGroup &  __group_rename_at_209, AnnotationArgumentList const  &  __args_rename_at_209, das::string &  __errors_rename_at_209 ) { das_stack_prologue __prologue(__context__,224,"SetupAnyAnnotation`apply " DAS_FILE_LINE);
+{
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __argName_rename_at_210 = (TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>)das_alias<RttiValue>::from(find_arg_48901e2fdfb01868(__context__,((char *) "name"),__args_rename_at_209));
+	if ( das_get_variant_field<vec4f,16,8>::is(__argName_rename_at_210) )
+	{
+		das_copy(__self_rename_at_209.name,das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<das::string &>::from(__st_rename_at_209->name /*name*/))));
+	} else if ( !das_get_variant_field<char *,16,7>::is(__argName_rename_at_210) )
+	{
+		builtin_throw(((char *) "name must be string"),__context__);
+	} else {
+		das_copy(__self_rename_at_209.name,das_get_variant_field<char *,16,7>::as(__argName_rename_at_210,__context__));
+	};
+	ExprBlock * __blk_rename_at_217; das_zero(__blk_rename_at_217); das_move(__blk_rename_at_217, setup_macro_c01015f62fd7b19b(__context__,((char *) "__setup_macros"),das_arg<LineInfo>::pass(__st_rename_at_209->at /*at*/)));
+	smart_ptr_raw<ExprCall> __cll_rename_at_218; das_zero(__cll_rename_at_218); das_move(__cll_rename_at_218, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_218) {
+		das_copy((__mks_218.at /*at*/),(__st_rename_at_209->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_218.name /*name*/),__self_rename_at_209.annotation_function_call);
+		}	}))));
+	das_invoke_function<void>::invoke<struct ast_boost::SetupAnyAnnotation &,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>>(__context__,__self_rename_at_209.setup_call,das_arg<struct ast_boost::SetupAnyAnnotation>::pass(__self_rename_at_209),__st_rename_at_209,__cll_rename_at_218);
+	smart_ptr_raw<ExprNew> __nee_rename_at_220; das_zero(__nee_rename_at_220); das_move(__nee_rename_at_220, das_ascend_handle<true,smart_ptr_raw<ExprNew>>::make(__context__,nullptr,(([&](ExprNew & __mks_220) {
+		das_copy((__mks_220.at /*at*/),(__st_rename_at_209->at /*at*/));
+		das_copy((__mks_220.initializer /*initializer*/),(true));
+	}))));
+	das_move(__nee_rename_at_220->typeexpr /*typeexpr*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_221) {
+		das_copy((__mks_221.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tStructure));
+		das_copy((__mks_221.structType /*structType*/),(_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9(__context__,__st_rename_at_209)));
+	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_218->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression> const >::pass(__nee_rename_at_220));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_217->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__cll_rename_at_218));
+	return true;
+}}
+
+inline void _FuncSetupAnyAnnotation_0x60_setup_call_8eaf665bd176c1ad ( Context * __context__, struct ast_boost::SetupAnyAnnotation &  __self_rename_at_207, smart_ptr_raw<Structure> __st_rename_at_207, smart_ptr_raw<ExprCall> __cll_rename_at_207 ) { das_stack_prologue __prologue(__context__,112,"SetupAnyAnnotation`setup_call " DAS_FILE_LINE);
+{
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_207->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_208) {
+		das_copy((__mks_208.at /*at*/),(__st_rename_at_207->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_208.text /*value*/),__self_rename_at_207.name);
+		}	})))));
+}}
+
+inline struct ast_boost::SetupCallMacro SetupCallMacro_8f1d72a938a7426f ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::SetupCallMacro {
+		struct ast_boost::SetupCallMacro __mks_235;
+		das_zero(__mks_235);
+		das_copy((__mks_235.__rtti),(((void *)(&__type_info__53c08386))));
+		das_copy((__mks_235.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupCallMacro'__finalize SetupCallMacro*/ 3551581034u)))));
+		das_copy((__mks_235.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_235.annotation_function_call),(((char *) "add_new_call_macro")));
+		das_copy((__mks_235.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_235;
+	})());
+}
+
+inline void _FuncSetupCallMacro_0x27___finalize_2a4680adddc49563 ( Context * __context__, struct ast_boost::SetupCallMacro &  __self_rename_at_235 )
+{
+	finalize_7741f20af8b390dc(__context__,das_arg<struct ast_boost::SetupCallMacro>::pass(__self_rename_at_235));
+}
+
+inline struct ast_boost::SetupFunctionAnnotatoin SetupFunctionAnnotatoin_dc86c63a66feead2 ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::SetupFunctionAnnotatoin {
+		struct ast_boost::SetupFunctionAnnotatoin __mks_226;
+		das_zero(__mks_226);
+		das_copy((__mks_226.__rtti),(((void *)(&__type_info__9a94a3c7))));
+		das_copy((__mks_226.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupFunctionAnnotatoin'__finalize SetupFunctionAnnotatoin*/ 3051488728u)))));
+		das_copy((__mks_226.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_226.annotation_function_call),(((char *) "add_new_function_annotation")));
+		das_copy((__mks_226.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_226;
+	})());
+}
+
+inline void _FuncSetupFunctionAnnotatoin_0x27___finalize_36429344cbd76129 ( Context * __context__, struct ast_boost::SetupFunctionAnnotatoin &  __self_rename_at_226 )
+{
+	finalize_d2d8d932b76c8507(__context__,das_arg<struct ast_boost::SetupFunctionAnnotatoin>::pass(__self_rename_at_226));
+}
+
+inline struct ast_boost::SetupInferMacro SetupInferMacro_cb0fc2fadfd89103 ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::SetupInferMacro {
+		struct ast_boost::SetupInferMacro __mks_241;
+		das_zero(__mks_241);
+		das_copy((__mks_241.__rtti),(((void *)(&__type_info__57b510b2))));
+		das_copy((__mks_241.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupInferMacro'__finalize SetupInferMacro*/ 2805165730u)))));
+		das_copy((__mks_241.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_241.annotation_function_call),(((char *) "add_new_infer_macro")));
+		das_copy((__mks_241.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_241;
+	})());
+}
+
+inline void _FuncSetupInferMacro_0x27___finalize_6a72e0c28c729ddf ( Context * __context__, struct ast_boost::SetupInferMacro &  __self_rename_at_241 )
+{
+	finalize_549b36d594098850(__context__,das_arg<struct ast_boost::SetupInferMacro>::pass(__self_rename_at_241));
+}
+
+inline struct ast_boost::SetupReaderMacro SetupReaderMacro_7ce127a3f0f68d46 ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::SetupReaderMacro {
+		struct ast_boost::SetupReaderMacro __mks_229;
+		das_zero(__mks_229);
+		das_copy((__mks_229.__rtti),(((void *)(&__type_info__3494694f))));
+		das_copy((__mks_229.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupReaderMacro'__finalize SetupReaderMacro*/ 4009431518u)))));
+		das_copy((__mks_229.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_229.annotation_function_call),(((char *) "add_new_reader_macro")));
+		das_copy((__mks_229.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_229;
+	})());
+}
+
+inline void _FuncSetupReaderMacro_0x27___finalize_dbbebee5997c4d37 ( Context * __context__, struct ast_boost::SetupReaderMacro &  __self_rename_at_229 )
+{
+	finalize_7fe48452de3177af(__context__,das_arg<struct ast_boost::SetupReaderMacro>::pass(__self_rename_at_229));
+}
+
+inline struct ast_boost::SetupStructureMacro SetupStructureMacro_66fbf3d86127c8c1 ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::SetupStructureMacro {
+		struct ast_boost::SetupStructureMacro __mks_238;
+		das_zero(__mks_238);
+		das_copy((__mks_238.__rtti),(((void *)(&__type_info__ca846bdd))));
+		das_copy((__mks_238.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupStructureMacro'__finalize SetupStructureMacro*/ 4247392904u)))));
+		das_copy((__mks_238.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_238.annotation_function_call),(((char *) "add_new_structure_annotation")));
+		das_copy((__mks_238.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_238;
+	})());
+}
+
+inline void _FuncSetupStructureMacro_0x27___finalize_5f11c4a69a57676d ( Context * __context__, struct ast_boost::SetupStructureMacro &  __self_rename_at_238 )
+{
+	finalize_408cec3a0eef18bd(__context__,das_arg<struct ast_boost::SetupStructureMacro>::pass(__self_rename_at_238));
+}
+
+inline struct ast_boost::SetupVariantMacro SetupVariantMacro_d398499799a61270 ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::SetupVariantMacro {
+		struct ast_boost::SetupVariantMacro __mks_232;
+		das_zero(__mks_232);
+		das_copy((__mks_232.__rtti),(((void *)(&__type_info__47dfa545))));
+		das_copy((__mks_232.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupVariantMacro'__finalize SetupVariantMacro*/ 3331394372u)))));
+		das_copy((__mks_232.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_232.annotation_function_call),(((char *) "add_new_variant_macro")));
+		das_copy((__mks_232.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_232;
+	})());
+}
+
+inline void _FuncSetupVariantMacro_0x27___finalize_951875bdcf538d5 ( Context * __context__, struct ast_boost::SetupVariantMacro &  __self_rename_at_232 )
+{
+	finalize_85331723c3a41f85(__context__,das_arg<struct ast_boost::SetupVariantMacro>::pass(__self_rename_at_232));
+}
+
+inline struct ast_boost::TagFunctionAnnotation TagFunctionAnnotation_c8afeab054eec80d ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::TagFunctionAnnotation {
+		struct ast_boost::TagFunctionAnnotation __mks_90;
+		das_zero(__mks_90);
+		das_copy((__mks_90.__rtti),(((void *)(&__type_info__9750d32))));
+		das_copy((__mks_90.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagFunctionAnnotation'__finalize TagFunctionAnnotation*/ 573253282u)))));
+		das_copy((__mks_90.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagFunctionAnnotation`apply TagFunctionAnnotation #smart_ptr##handle#Function #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3543694566u)))));
+		return __mks_90;
+	})());
+}
+
+inline void _FuncTagFunctionAnnotation_0x27___finalize_be243eed87306007 ( Context * __context__, struct ast_boost::TagFunctionAnnotation &  __self_rename_at_90 )
+{
+	finalize_5c3a9a623f3d9b38(__context__,das_arg<struct ast_boost::TagFunctionAnnotation>::pass(__self_rename_at_90));
+}
+
+inline bool _FuncTagFunctionAnnotation_0x60_apply_831d892a28bfa169 ( Context * __context__, struct ast_boost::TagFunctionAnnotation &  __self_rename_at_91, smart_ptr_raw<Function> __func_rename_at_91, ModuleGroup &  __group_rename_at_91, AnnotationArgumentList const  &  __args_rename_at_91, das::string &  __errors_rename_at_91 )
+{
+	{
+		bool __need_loop_92 = true;
+		// arg : rtti::AnnotationArgument const&
+		das_iterator<AnnotationArgumentList const > __arg_iterator(__args_rename_at_91);
+		AnnotationArgument const  * __arg_rename_at_92;
+		__need_loop_92 = __arg_iterator.first(__context__,(__arg_rename_at_92)) && __need_loop_92;
+		for ( ; __need_loop_92 ; __need_loop_92 = __arg_iterator.next(__context__,(__arg_rename_at_92)) )
+		{
+			TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __val_rename_at_93 = (TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>)das_alias<RttiValue>::from(rtti_builtin_argument_value((*__arg_rename_at_92),__context__));
+			if ( !das_get_variant_field<bool,16,0>::is(__val_rename_at_93) )
+			{
+				set_das_string(das_arg<das::string>::pass(__errors_rename_at_91),((char *) "tag_function annotation expects only tag names"));
+				return false;
+			};
+		}
+		__arg_iterator.close(__context__,(__arg_rename_at_92));
+	};
+	__func_rename_at_91->flags /*flags*/ |= 0x80u;
+	return true;
+}
+
+inline struct ast_boost::TagFunctionMacro TagFunctionMacro_51f5d0c9e4f6426d ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::TagFunctionMacro {
+		struct ast_boost::TagFunctionMacro __mks_244;
+		das_zero(__mks_244);
+		das_copy((__mks_244.__rtti),(((void *)(&__type_info__6e24d8c9))));
+		das_copy((__mks_244.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagFunctionMacro'__finalize TagFunctionMacro*/ 1859051822u)))));
+		das_copy((__mks_244.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagFunctionMacro`apply TagFunctionMacro #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 793789613u)))));
+		das_copy((__mks_244.annotation_function_call),(((char *) "setup_tag_annotation")));
+		das_copy((__mks_244.setup_call),(das_cast<Func DAS_COMMENT((void,struct ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagFunctionMacro`setup_call TagFunctionMacro #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 103453331u)))));
+		return __mks_244;
+	})());
+}
+
+inline void _FuncTagFunctionMacro_0x27___finalize_825dbbe27e243913 ( Context * __context__, struct ast_boost::TagFunctionMacro &  __self_rename_at_244 )
+{
+	finalize_34eecdde29f42869(__context__,das_arg<struct ast_boost::TagFunctionMacro>::pass(__self_rename_at_244));
+}
+
+inline bool _FuncTagFunctionMacro_0x60_apply_dea4df200f3fb5b0 ( Context * __context__, struct ast_boost::TagFunctionMacro &  __self_rename_at_250, smart_ptr_raw<Structure> __st_rename_at_250, ModuleGroup &  __group_rename_at_250, AnnotationArgumentList const  &  __args_rename_at_250, das::string &  __errors_rename_at_250 )
+{
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __argTag_rename_at_251 = (TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>)das_alias<RttiValue>::from(find_arg_48901e2fdfb01868(__context__,((char *) "tag"),__args_rename_at_250));
+	if ( das_get_variant_field<vec4f,16,8>::is(__argTag_rename_at_251) )
+	{
+		builtin_throw(((char *) "missing tag argument"),__context__);
+	} else if ( !das_get_variant_field<char *,16,7>::is(__argTag_rename_at_251) )
+	{
+		builtin_throw(((char *) "tag must be string"),__context__);
+	};
+	das_copy(__self_rename_at_250.tag,das_get_variant_field<char *,16,7>::as(__argTag_rename_at_251,__context__));
+	return _FuncSetupAnyAnnotation_0x60_apply_2fe75f3f01c0c452(__context__,das_arg<struct ast_boost::SetupAnyAnnotation>::pass(das_cast<struct ast_boost::SetupAnyAnnotation>::cast(__self_rename_at_250)),__st_rename_at_250,das_arg<ModuleGroup>::pass(__group_rename_at_250),__args_rename_at_250,das_arg<das::string>::pass(__errors_rename_at_250));
+}
+
+inline void _FuncTagFunctionMacro_0x60_setup_call_461d4ee0a6be8659 ( Context * __context__, struct ast_boost::TagFunctionMacro &  __self_rename_at_247, smart_ptr_raw<Structure> __st_rename_at_247, smart_ptr_raw<ExprCall> __cll_rename_at_247 ) { das_stack_prologue __prologue(__context__,192,"TagFunctionMacro`setup_call " DAS_FILE_LINE);
+{
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_247->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_248) {
+		das_copy((__mks_248.at /*at*/),(__st_rename_at_247->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_248.text /*value*/),__self_rename_at_247.name);
+		}	})))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_247->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_249) {
+		das_copy((__mks_249.at /*at*/),(__st_rename_at_247->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_249.text /*value*/),__self_rename_at_247.tag);
+		}	})))));
+}}
+
+inline struct ast_boost::TagStructureAnnotation TagStructureAnnotation_4b3c108e3e55ce30 ( Context * __context__ )
+{
+	return (([&]() -> struct ast_boost::TagStructureAnnotation {
+		struct ast_boost::TagStructureAnnotation __mks_100;
+		das_zero(__mks_100);
+		das_copy((__mks_100.__rtti),(((void *)(&__type_info__b365c4dd))));
+		das_copy((__mks_100.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagStructureAnnotation'__finalize TagStructureAnnotation*/ 3613324266u)))));
+		das_copy((__mks_100.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagStructureAnnotation`apply TagStructureAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3369750713u)))));
+		return __mks_100;
+	})());
+}
+
+inline void _FuncTagStructureAnnotation_0x27___finalize_8e605accd8e095b ( Context * __context__, struct ast_boost::TagStructureAnnotation &  __self_rename_at_100 )
+{
+	finalize_3bd74c4615c1a065(__context__,das_arg<struct ast_boost::TagStructureAnnotation>::pass(__self_rename_at_100));
+}
+
+inline bool _FuncTagStructureAnnotation_0x60_apply_a2336767c0c0b1cb ( Context * __context__, struct ast_boost::TagStructureAnnotation &  __self_rename_at_101, smart_ptr_raw<Structure> __str_rename_at_101, ModuleGroup &  __group_rename_at_101, AnnotationArgumentList const  &  __args_rename_at_101, das::string &  __errors_rename_at_101 )
+{
+	{
+		bool __need_loop_102 = true;
+		// arg : rtti::AnnotationArgument const&
+		das_iterator<AnnotationArgumentList const > __arg_iterator(__args_rename_at_101);
+		AnnotationArgument const  * __arg_rename_at_102;
+		__need_loop_102 = __arg_iterator.first(__context__,(__arg_rename_at_102)) && __need_loop_102;
+		for ( ; __need_loop_102 ; __need_loop_102 = __arg_iterator.next(__context__,(__arg_rename_at_102)) )
+		{
+			TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __val_rename_at_103 = (TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>)das_alias<RttiValue>::from(rtti_builtin_argument_value((*__arg_rename_at_102),__context__));
+			if ( !das_get_variant_field<bool,16,0>::is(__val_rename_at_103) )
+			{
+				set_das_string(das_arg<das::string>::pass(__errors_rename_at_101),((char *) "tag_structure annotation expects only tag names"));
+				return false;
+			};
+		}
+		__arg_iterator.close(__context__,(__arg_rename_at_102));
+	};
+	return true;
+}
+
+inline void apply_tag_annotation_defdf759f8201948 ( Context * __context__, char * const  __tag_rename_at_132, smart_ptr_raw<FunctionAnnotation> const  __ann_rename_at_132 ) { das_stack_prologue __prologue(__context__,96,"apply_tag_annotation " DAS_FILE_LINE);
+{
+	for_each_tag_function_156ad29b9fdef8c4(__context__,thisModule(__context__,nullptr),__tag_rename_at_132,das_make_block<void,smart_ptr_raw<Function>>(__context__,80,0,&__func_info__13ce5ebc,[&](smart_ptr_raw<Function> __func_rename_at_133)->void{
+		addFunctionFunctionAnnotation(__func_rename_at_133,__ann_rename_at_132,__context__);
+	}));
+}}
+
+inline void _Funcast_0x60_add_new_function_annotation_cf523e7e76e00096 ( Context * __context__, char * const  __name_rename_at_497, struct ast_boost::MacroMacro * const  __someClassPtr_rename_at_497 )
+{
+	smart_ptr_raw<FunctionAnnotation> __ann_rename_at_498; das_zero(__ann_rename_at_498); das_move(__ann_rename_at_498, _Funcast_0x60_make_function_annotation_178b2214b0971652(__context__,__name_rename_at_497,__someClassPtr_rename_at_497));
+	addModuleFunctionAnnotation(thisModule(__context__,nullptr),__ann_rename_at_498,__context__);
+	das_delete_handle<smart_ptr_raw<FunctionAnnotation>>::clear(__context__,__ann_rename_at_498);
+}
+
+inline void _Funcast_0x60_add_new_function_annotation_d5617b03b1a4ac8e ( Context * __context__, char * const  __name_rename_at_497, struct ast_boost::TagFunctionAnnotation * const  __someClassPtr_rename_at_497 )
+{
+	smart_ptr_raw<FunctionAnnotation> __ann_rename_at_498; das_zero(__ann_rename_at_498); das_move(__ann_rename_at_498, _Funcast_0x60_make_function_annotation_cbf559e9d8aaa49c(__context__,__name_rename_at_497,__someClassPtr_rename_at_497));
+	addModuleFunctionAnnotation(thisModule(__context__,nullptr),__ann_rename_at_498,__context__);
+	das_delete_handle<smart_ptr_raw<FunctionAnnotation>>::clear(__context__,__ann_rename_at_498);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_f06b4439ae42129e ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupCallMacro * const  __someClassPtr_rename_at_503 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_504; das_zero(__ann_rename_at_504); das_move(__ann_rename_at_504, _Funcast_0x60_make_structure_annotation_7bf08e445ef74fb7(__context__,__name_rename_at_503,__someClassPtr_rename_at_503));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_504,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_504);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_4706833bf75c0674 ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupFunctionAnnotatoin * const  __someClassPtr_rename_at_503 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_504; das_zero(__ann_rename_at_504); das_move(__ann_rename_at_504, _Funcast_0x60_make_structure_annotation_5394f25399b410a3(__context__,__name_rename_at_503,__someClassPtr_rename_at_503));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_504,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_504);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_6e6624c5849b86c4 ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupInferMacro * const  __someClassPtr_rename_at_503 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_504; das_zero(__ann_rename_at_504); das_move(__ann_rename_at_504, _Funcast_0x60_make_structure_annotation_80ddaee29146c05(__context__,__name_rename_at_503,__someClassPtr_rename_at_503));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_504,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_504);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_cf25ae0cd4e579ec ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupReaderMacro * const  __someClassPtr_rename_at_503 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_504; das_zero(__ann_rename_at_504); das_move(__ann_rename_at_504, _Funcast_0x60_make_structure_annotation_b8777b33e9554cbb(__context__,__name_rename_at_503,__someClassPtr_rename_at_503));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_504,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_504);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_d0d465637b6c881c ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupStructureMacro * const  __someClassPtr_rename_at_503 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_504; das_zero(__ann_rename_at_504); das_move(__ann_rename_at_504, _Funcast_0x60_make_structure_annotation_fb66f29d4086977f(__context__,__name_rename_at_503,__someClassPtr_rename_at_503));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_504,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_504);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_343bf718246b02cc ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::SetupVariantMacro * const  __someClassPtr_rename_at_503 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_504; das_zero(__ann_rename_at_504); das_move(__ann_rename_at_504, _Funcast_0x60_make_structure_annotation_b5dd9bbe349cd2cb(__context__,__name_rename_at_503,__someClassPtr_rename_at_503));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_504,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_504);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_9bde045483f7e624 ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::TagFunctionMacro * const  __someClassPtr_rename_at_503 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_504; das_zero(__ann_rename_at_504); das_move(__ann_rename_at_504, _Funcast_0x60_make_structure_annotation_4aefda9ee1bddc93(__context__,__name_rename_at_503,__someClassPtr_rename_at_503));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_504,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_504);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_6a05b75ea76a0444 ( Context * __context__, char * const  __name_rename_at_503, struct ast_boost::TagStructureAnnotation * const  __someClassPtr_rename_at_503 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_504; das_zero(__ann_rename_at_504); das_move(__ann_rename_at_504, _Funcast_0x60_make_structure_annotation_bd697be2b120f5b3(__context__,__name_rename_at_503,__someClassPtr_rename_at_503));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_504,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_504);
+}
+
+inline void _Funcast_0x60_add_new_variant_macro_5d0e57796a52acbe ( Context * __context__, char * const  __name_rename_at_509, struct ast_boost::BetterRttiVisitor * const  __someClassPtr_rename_at_509 )
+{
+	smart_ptr_raw<VariantMacro> __ann_rename_at_510; das_zero(__ann_rename_at_510); das_move(__ann_rename_at_510, _Funcast_0x60_make_variant_macro_33be8663053d6cb2(__context__,__name_rename_at_509,__someClassPtr_rename_at_509));
+	addModuleVariantMacro(thisModule(__context__,nullptr),__ann_rename_at_510,__context__);
+	das_delete_handle<smart_ptr_raw<VariantMacro>>::clear(__context__,__ann_rename_at_510);
+}
+
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_178b2214b0971652 ( Context * __context__, char * const  __name_rename_at_439, struct ast_boost::MacroMacro * const  __someClassPtr_rename_at_439 )
+{
+	StructInfo const  * __classInfo_rename_at_441 = (StructInfo const  *)_Funcrtti_0x60_class_info_43b39f928a0c2cb4(__context__,das_deref(__context__,__someClassPtr_rename_at_439));
+	return makeFunctionAnnotation(__name_rename_at_439,__someClassPtr_rename_at_439,__classInfo_rename_at_441,__context__);
+}
+
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_cbf559e9d8aaa49c ( Context * __context__, char * const  __name_rename_at_439, struct ast_boost::TagFunctionAnnotation * const  __someClassPtr_rename_at_439 )
+{
+	StructInfo const  * __classInfo_rename_at_441 = (StructInfo const  *)_Funcrtti_0x60_class_info_50ea2355bcfbadc3(__context__,das_deref(__context__,__someClassPtr_rename_at_439));
+	return makeFunctionAnnotation(__name_rename_at_439,__someClassPtr_rename_at_439,__classInfo_rename_at_441,__context__);
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_7bf08e445ef74fb7 ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupCallMacro * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = (StructInfo const  *)_Funcrtti_0x60_class_info_f7c42c96e955aecf(__context__,das_deref(__context__,__someClassPtr_rename_at_447));
+	return makeStructureAnnotation(__name_rename_at_447,__someClassPtr_rename_at_447,__classInfo_rename_at_449,__context__);
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_5394f25399b410a3 ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupFunctionAnnotatoin * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = (StructInfo const  *)_Funcrtti_0x60_class_info_dfe6289f24a05dee(__context__,das_deref(__context__,__someClassPtr_rename_at_447));
+	return makeStructureAnnotation(__name_rename_at_447,__someClassPtr_rename_at_447,__classInfo_rename_at_449,__context__);
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_80ddaee29146c05 ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupInferMacro * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = (StructInfo const  *)_Funcrtti_0x60_class_info_fe0e1a3100a0e8cb(__context__,das_deref(__context__,__someClassPtr_rename_at_447));
+	return makeStructureAnnotation(__name_rename_at_447,__someClassPtr_rename_at_447,__classInfo_rename_at_449,__context__);
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_b8777b33e9554cbb ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupReaderMacro * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = (StructInfo const  *)_Funcrtti_0x60_class_info_95f7c99d727943e(__context__,das_deref(__context__,__someClassPtr_rename_at_447));
+	return makeStructureAnnotation(__name_rename_at_447,__someClassPtr_rename_at_447,__classInfo_rename_at_449,__context__);
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_fb66f29d4086977f ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupStructureMacro * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = (StructInfo const  *)_Funcrtti_0x60_class_info_82fb4b7363897b80(__context__,das_deref(__context__,__someClassPtr_rename_at_447));
+	return makeStructureAnnotation(__name_rename_at_447,__someClassPtr_rename_at_447,__classInfo_rename_at_449,__context__);
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_b5dd9bbe349cd2cb ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::SetupVariantMacro * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = (StructInfo const  *)_Funcrtti_0x60_class_info_641c26f0b6e81a28(__context__,das_deref(__context__,__someClassPtr_rename_at_447));
+	return makeStructureAnnotation(__name_rename_at_447,__someClassPtr_rename_at_447,__classInfo_rename_at_449,__context__);
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_4aefda9ee1bddc93 ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::TagFunctionMacro * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = (StructInfo const  *)_Funcrtti_0x60_class_info_a06301811adbc864(__context__,das_deref(__context__,__someClassPtr_rename_at_447));
+	return makeStructureAnnotation(__name_rename_at_447,__someClassPtr_rename_at_447,__classInfo_rename_at_449,__context__);
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_bd697be2b120f5b3 ( Context * __context__, char * const  __name_rename_at_447, struct ast_boost::TagStructureAnnotation * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = (StructInfo const  *)_Funcrtti_0x60_class_info_937fa16735a67b08(__context__,das_deref(__context__,__someClassPtr_rename_at_447));
+	return makeStructureAnnotation(__name_rename_at_447,__someClassPtr_rename_at_447,__classInfo_rename_at_449,__context__);
+}
+
+inline smart_ptr_raw<VariantMacro> _Funcast_0x60_make_variant_macro_33be8663053d6cb2 ( Context * __context__, char * const  __name_rename_at_489, struct ast_boost::BetterRttiVisitor * const  __someClassPtr_rename_at_489 )
+{
+	StructInfo const  * __classInfo_rename_at_491 = (StructInfo const  *)_Funcrtti_0x60_class_info_5c40c94f9433cf45(__context__,das_deref(__context__,__someClassPtr_rename_at_489));
+	return makeVariantMacro(__name_rename_at_489,__someClassPtr_rename_at_489,__classInfo_rename_at_491,__context__);
+}
+
+inline ExprBlock * _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903 ( Context * __context__, smart_ptr_raw<ExprBlock> const  __src_rename_at_701 )
+{
+	return das_cast<ExprBlock *>::cast(__src_rename_at_701);
+}
+
+inline Structure * _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9 ( Context * __context__, smart_ptr_raw<Structure> const  __src_rename_at_701 )
+{
+	return das_cast<Structure *>::cast(__src_rename_at_701);
+}
+
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> &  __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<char *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void clone_71815e7f31cbba07 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_186, smart_ptr_raw<ExprBlock> const  __src_rename_at_186 )
+{
+	builtin_smart_ptr_clone(__dest_rename_at_186,__src_rename_at_186);
+}
+
+inline char * const  describe_d96fc4bea3cd282 ( Context * __context__, AnnotationArgumentList const  &  __list_rename_at_11 )
+{
+	return _Funcstrings_boost_0x60_join_7a2ff2ee78269e80(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+		TArray<char *> ____acomp_12_rename_at_12; das_zero(____acomp_12_rename_at_12);
+		{
+			bool __need_loop_12 = true;
+			// arg : rtti::AnnotationArgument const&
+			das_iterator<AnnotationArgumentList const > __arg_iterator(__list_rename_at_11);
+			AnnotationArgument const  * __arg_rename_at_12;
+			__need_loop_12 = __arg_iterator.first(__context__,(__arg_rename_at_12)) && __need_loop_12;
+			for ( ; __need_loop_12 ; __need_loop_12 = __arg_iterator.next(__context__,(__arg_rename_at_12)) )
+			{
+				TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _temp_make_local_12_240;
+				_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass(____acomp_12_rename_at_12),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<das::string const  &>::from((*__arg_rename_at_12).name /*name*/), cast<char * const >::from(((char *) "=")), cast<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> &>::from((_temp_make_local_12_240 = (das_alias<RttiValue>::from(rtti_builtin_argument_value((*__arg_rename_at_12),__context__))))))),-1);
+			}
+			__arg_iterator.close(__context__,(__arg_rename_at_12));
+		};
+		return /* <- */ ____acomp_12_rename_at_12;
+	})),((char *) ","));
+}
+
+inline char * describe_8f4b681e7ab7d244 ( Context * __context__, AnnotationDeclaration const  &  __ann_rename_at_15 )
+{
+	return (__ann_rename_at_15.arguments /*arguments*/.size() /*length*/ != 0) ? (das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_2, cast<das::string const  &>::from(__ann_rename_at_15.annotation /*annotation*/->name /*name*/), cast<char * const >::from(((char *) "(")), cast<char * const >::from(describe_d96fc4bea3cd282(__context__,__ann_rename_at_15.arguments /*arguments*/)), cast<char * const >::from(((char *) ")"))))) : (das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_3, cast<das::string const  &>::from(__ann_rename_at_15.annotation /*annotation*/->name /*name*/))));
+}
+
+inline char * const  describe_562242e81f0cb8da ( Context * __context__, AnnotationList const  &  __list_rename_at_22 )
+{
+	return _Funcstrings_boost_0x60_join_7a2ff2ee78269e80(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+		TArray<char *> ____acomp_23_rename_at_23; das_zero(____acomp_23_rename_at_23);
+		{
+			bool __need_loop_23 = true;
+			// arg : smart_ptr<rtti::AnnotationDeclaration> const&
+			das_iterator<AnnotationList const > __arg_iterator(__list_rename_at_22);
+			smart_ptr<AnnotationDeclaration> const  * __arg_rename_at_23;
+			__need_loop_23 = __arg_iterator.first(__context__,(__arg_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __arg_iterator.next(__context__,(__arg_rename_at_23)) )
+			{
+				_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass(____acomp_23_rename_at_23),describe_8f4b681e7ab7d244(__context__,das_deref(__context__,(*__arg_rename_at_23))),-1);
+			}
+			__arg_iterator.close(__context__,(__arg_rename_at_23));
+		};
+		return /* <- */ ____acomp_23_rename_at_23;
+	})),((char *) ","));
+}
+
+inline void finalize_e39f6bf3901fe65e ( Context * __context__, struct ast_boost::BetterRttiVisitor &  ____this_rename_at_261 )
+{
+	memset(&(____this_rename_at_261), 0, 24);
+}
+
+inline void finalize_1e05286024ffc9 ( Context * __context__, struct ast_boost::MacroMacro &  ____this_rename_at_79 )
+{
+	memset(&(____this_rename_at_79), 0, 24);
+}
+
+inline void finalize_7741f20af8b390dc ( Context * __context__, struct ast_boost::SetupCallMacro &  ____this_rename_at_235 )
+{
+	memset(&(____this_rename_at_235), 0, 48);
+}
+
+inline void finalize_d2d8d932b76c8507 ( Context * __context__, struct ast_boost::SetupFunctionAnnotatoin &  ____this_rename_at_226 )
+{
+	memset(&(____this_rename_at_226), 0, 48);
+}
+
+inline void finalize_549b36d594098850 ( Context * __context__, struct ast_boost::SetupInferMacro &  ____this_rename_at_241 )
+{
+	memset(&(____this_rename_at_241), 0, 48);
+}
+
+inline void finalize_7fe48452de3177af ( Context * __context__, struct ast_boost::SetupReaderMacro &  ____this_rename_at_229 )
+{
+	memset(&(____this_rename_at_229), 0, 48);
+}
+
+inline void finalize_408cec3a0eef18bd ( Context * __context__, struct ast_boost::SetupStructureMacro &  ____this_rename_at_238 )
+{
+	memset(&(____this_rename_at_238), 0, 48);
+}
+
+inline void finalize_85331723c3a41f85 ( Context * __context__, struct ast_boost::SetupVariantMacro &  ____this_rename_at_232 )
+{
+	memset(&(____this_rename_at_232), 0, 48);
+}
+
+inline void finalize_5c3a9a623f3d9b38 ( Context * __context__, struct ast_boost::TagFunctionAnnotation &  ____this_rename_at_90 )
+{
+	memset(&(____this_rename_at_90), 0, 24);
+}
+
+inline void finalize_34eecdde29f42869 ( Context * __context__, struct ast_boost::TagFunctionMacro &  ____this_rename_at_244 )
+{
+	memset(&(____this_rename_at_244), 0, 56);
+}
+
+inline void finalize_3bd74c4615c1a065 ( Context * __context__, struct ast_boost::TagStructureAnnotation &  ____this_rename_at_100 )
+{
+	memset(&(____this_rename_at_100), 0, 24);
+}
+
+inline TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> find_arg_48901e2fdfb01868 ( Context * __context__, char * const  __argn_rename_at_125, AnnotationArgumentList const  &  __args_rename_at_125 )
+{
+	{
+		bool __need_loop_126 = true;
+		// a : rtti::AnnotationArgument const&
+		das_iterator<AnnotationArgumentList const > __a_iterator(__args_rename_at_125);
+		AnnotationArgument const  * __a_rename_at_126;
+		__need_loop_126 = __a_iterator.first(__context__,(__a_rename_at_126)) && __need_loop_126;
+		for ( ; __need_loop_126 ; __need_loop_126 = __a_iterator.next(__context__,(__a_rename_at_126)) )
+		{
+			if ( SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_4, cast<das::string const  &>::from((*__a_rename_at_126).name /*name*/)))),cast<char *>::from(__argn_rename_at_125),*__context__) )
+			{
+				return das_alias<RttiValue>::from(rtti_builtin_argument_value((*__a_rename_at_126),__context__));
+			};
+		}
+		__a_iterator.close(__context__,(__a_rename_at_126));
+	};
+	return _Funcrtti_0x60_RttiValue_nothing_c4cebcf8f2cab65d(__context__);
+}
+
+inline smart_ptr_raw<Function> find_unique_function_51f7514a784b90af ( Context * __context__, Module * const  __mod_rename_at_151, char * const  __name_rename_at_151 ) { das_stack_prologue __prologue(__context__,128,"find_unique_function " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __res_rename_at_152; das_zero(__res_rename_at_152);
+	int32_t __count_rename_at_153 = 0;
+	forEachFunction(__mod_rename_at_151,__name_rename_at_151,das_make_block<void,smart_ptr<Function>>(__context__,112,0,&__func_info__13ce5ebc,[&](smart_ptr<Function> __func_rename_at_154)->void{
+		das_move(__res_rename_at_152,__func_rename_at_154);
+		__count_rename_at_153++;
+	}),__context__,nullptr);
+	if ( __count_rename_at_153 > 1 )
+	{
+		builtin_throw(((char *) "more than one function encountered"),__context__);
+	};
+	return __res_rename_at_152;
+}}
+
+inline smart_ptr_raw<Function> find_unique_generic_486a44e62e317dc7 ( Context * __context__, Module * const  __mod_rename_at_162, char * const  __name_rename_at_162 ) { das_stack_prologue __prologue(__context__,128,"find_unique_generic " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __res_rename_at_163; das_zero(__res_rename_at_163);
+	int32_t __count_rename_at_164 = 0;
+	forEachGenericFunction(__mod_rename_at_162,__name_rename_at_162,das_make_block<void,smart_ptr<Function>>(__context__,112,0,&__func_info__13ce5ebc,[&](smart_ptr<Function> __func_rename_at_165)->void{
+		das_move(__res_rename_at_163,__func_rename_at_165);
+		__count_rename_at_164++;
+	}),__context__,nullptr);
+	if ( __count_rename_at_164 > 1 )
+	{
+		builtin_throw(((char *) "more than one generic function encountered"),__context__);
+	};
+	return __res_rename_at_163;
+}}
+
+inline void for_each_tag_function_156ad29b9fdef8c4 ( Context * __context__, Module * const  __mod_rename_at_110, char * const  __tag_rename_at_110, Block DAS_COMMENT((void,smart_ptr_raw<Function>)) const  &  __blk_rename_at_110 ) { das_stack_prologue __prologue(__context__,352,"for_each_tag_function " DAS_FILE_LINE);
+{
+	forEachFunction(__mod_rename_at_110,((char *) ""),das_make_block<void,smart_ptr<Function>>(__context__,80,0,&__func_info__13ce5ebc,[&](smart_ptr<Function> __func_rename_at_111)->void{
+		{
+			bool __need_loop_112 = true;
+			// ann : smart_ptr<rtti::AnnotationDeclaration>&
+			das_iterator<AnnotationList> __ann_iterator(__func_rename_at_111->annotations /*annotations*/);
+			smart_ptr<AnnotationDeclaration> * __ann_rename_at_112;
+			__need_loop_112 = __ann_iterator.first(__context__,(__ann_rename_at_112)) && __need_loop_112;
+			for ( ; __need_loop_112 ; __need_loop_112 = __ann_iterator.next(__context__,(__ann_rename_at_112)) )
+			{
+				if ( SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_5, cast<das::string &>::from((*__ann_rename_at_112)->annotation /*annotation*/->name /*name*/)))),cast<char *>::from(((char *) "tag_function")),*__context__) )
+				{
+					{
+						bool __need_loop_114 = true;
+						// t : rtti::AnnotationArgument&
+						das_iterator<AnnotationArgumentList> __t_iterator((*__ann_rename_at_112)->arguments /*arguments*/);
+						AnnotationArgument * __t_rename_at_114;
+						__need_loop_114 = __t_iterator.first(__context__,(__t_rename_at_114)) && __need_loop_114;
+						for ( ; __need_loop_114 ; __need_loop_114 = __t_iterator.next(__context__,(__t_rename_at_114)) )
+						{
+							if ( SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_6, cast<das::string &>::from((*__t_rename_at_114).name /*name*/)))),cast<char *>::from(__tag_rename_at_110),*__context__) )
+							{
+								das_invoke<void>::invoke<smart_ptr<Function>>(__context__,__blk_rename_at_110,__func_rename_at_111);
+							};
+						}
+						__t_iterator.close(__context__,(__t_rename_at_114));
+					};
+				};
+			}
+			__ann_iterator.close(__context__,(__ann_rename_at_112));
+		};
+	}),__context__,nullptr);
+	forEachGenericFunction(__mod_rename_at_110,((char *) ""),das_make_block<void,smart_ptr<Function>>(__context__,240,0,&__func_info__13ce5ebc,[&](smart_ptr<Function> __func_rename_at_117)->void{
+		{
+			bool __need_loop_118 = true;
+			// ann : smart_ptr<rtti::AnnotationDeclaration>&
+			das_iterator<AnnotationList> __ann_iterator(__func_rename_at_117->annotations /*annotations*/);
+			smart_ptr<AnnotationDeclaration> * __ann_rename_at_118;
+			__need_loop_118 = __ann_iterator.first(__context__,(__ann_rename_at_118)) && __need_loop_118;
+			for ( ; __need_loop_118 ; __need_loop_118 = __ann_iterator.next(__context__,(__ann_rename_at_118)) )
+			{
+				if ( SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_7, cast<das::string &>::from((*__ann_rename_at_118)->annotation /*annotation*/->name /*name*/)))),cast<char *>::from(((char *) "tag_function")),*__context__) )
+				{
+					{
+						bool __need_loop_120 = true;
+						// t : rtti::AnnotationArgument&
+						das_iterator<AnnotationArgumentList> __t_iterator((*__ann_rename_at_118)->arguments /*arguments*/);
+						AnnotationArgument * __t_rename_at_120;
+						__need_loop_120 = __t_iterator.first(__context__,(__t_rename_at_120)) && __need_loop_120;
+						for ( ; __need_loop_120 ; __need_loop_120 = __t_iterator.next(__context__,(__t_rename_at_120)) )
+						{
+							if ( SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<das::string &>::from((*__t_rename_at_120).name /*name*/)))),cast<char *>::from(__tag_rename_at_110),*__context__) )
+							{
+								das_invoke<void>::invoke<smart_ptr<Function>>(__context__,__blk_rename_at_110,__func_rename_at_117);
+							};
+						}
+						__t_iterator.close(__context__,(__t_rename_at_120));
+					};
+				};
+			}
+			__ann_iterator.close(__context__,(__ann_rename_at_118));
+		};
+	}),__context__,nullptr);
+}}
+
+inline bool isExpression_33f1bf6f8c2e2753 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __t_rename_at_41, bool __top_rename_at_41 )
+{
+	if ( equ_sptr_ptr(__t_rename_at_41,nullptr) )
+	{
+		return false;
+	} else if ( __t_rename_at_41->dim /*dim*/.size() /*length*/ != 0 )
+	{
+		return false;
+	} else if ( __t_rename_at_41->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tHandle )
+	{
+		return (SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_9, cast<das::string const  &>::from(__t_rename_at_41->annotation /*annotation*/->module /*_module*/->name /*name*/)))),cast<char *>::from(((char *) "ast")),*__context__)) ? (builtin_string_startswith(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_10, cast<das::string const  &>::from(__t_rename_at_41->annotation /*annotation*/->name /*name*/))),((char *) "Expr"),__context__)) : (false);
+	} else return ((__t_rename_at_41->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tPointer) && __top_rename_at_41) ? (isExpression_33f1bf6f8c2e2753(__context__,__t_rename_at_41->firstType /*firstType*/,false)) : (false);
+}
+
+inline TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _Funcrtti_0x60_RttiValue_nothing_c4cebcf8f2cab65d ( Context * __context__ )
+{
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __t_rename_at_104; das_zero(__t_rename_at_104);
+	set_variant_index(das_arg<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::pass(das_alias<RttiValue>::from(__t_rename_at_104)),8);
+	return das_alias<RttiValue>::from(__t_rename_at_104);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_5c40c94f9433cf45 ( Context * __context__, struct ast_boost::BetterRttiVisitor const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_43b39f928a0c2cb4 ( Context * __context__, struct ast_boost::MacroMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_f7c42c96e955aecf ( Context * __context__, struct ast_boost::SetupCallMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_dfe6289f24a05dee ( Context * __context__, struct ast_boost::SetupFunctionAnnotatoin const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_fe0e1a3100a0e8cb ( Context * __context__, struct ast_boost::SetupInferMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_95f7c99d727943e ( Context * __context__, struct ast_boost::SetupReaderMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_82fb4b7363897b80 ( Context * __context__, struct ast_boost::SetupStructureMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_641c26f0b6e81a28 ( Context * __context__, struct ast_boost::SetupVariantMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_50ea2355bcfbadc3 ( Context * __context__, struct ast_boost::TagFunctionAnnotation const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_a06301811adbc864 ( Context * __context__, struct ast_boost::TagFunctionMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_937fa16735a67b08 ( Context * __context__, struct ast_boost::TagStructureAnnotation const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline void setup_c734ccfdf563909 ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "ast_boost"),__context__) )
+	{
+		_Funcast_0x60_add_new_function_annotation_cf523e7e76e00096(__context__,((char *) "macro"),das_new<struct ast_boost::MacroMacro>::make_and_init(__context__,[&]() { return MacroMacro_fb2a4f39105ca505(__context__); }));
+		_Funcast_0x60_add_new_function_annotation_d5617b03b1a4ac8e(__context__,((char *) "tag_function"),das_new<struct ast_boost::TagFunctionAnnotation>::make_and_init(__context__,[&]() { return TagFunctionAnnotation_c8afeab054eec80d(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_4706833bf75c0674(__context__,((char *) "function_macro"),das_new<struct ast_boost::SetupFunctionAnnotatoin>::make_and_init(__context__,[&]() { return SetupFunctionAnnotatoin_dc86c63a66feead2(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_cf25ae0cd4e579ec(__context__,((char *) "reader_macro"),das_new<struct ast_boost::SetupReaderMacro>::make_and_init(__context__,[&]() { return SetupReaderMacro_7ce127a3f0f68d46(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_f06b4439ae42129e(__context__,((char *) "call_macro"),das_new<struct ast_boost::SetupCallMacro>::make_and_init(__context__,[&]() { return SetupCallMacro_8f1d72a938a7426f(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_d0d465637b6c881c(__context__,((char *) "structure_macro"),das_new<struct ast_boost::SetupStructureMacro>::make_and_init(__context__,[&]() { return SetupStructureMacro_66fbf3d86127c8c1(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_6e6624c5849b86c4(__context__,((char *) "infer_macro"),das_new<struct ast_boost::SetupInferMacro>::make_and_init(__context__,[&]() { return SetupInferMacro_cb0fc2fadfd89103(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_343bf718246b02cc(__context__,((char *) "variant_macro"),das_new<struct ast_boost::SetupVariantMacro>::make_and_init(__context__,[&]() { return SetupVariantMacro_d398499799a61270(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_6a05b75ea76a0444(__context__,((char *) "tag_structure"),das_new<struct ast_boost::TagStructureAnnotation>::make_and_init(__context__,[&]() { return TagStructureAnnotation_4b3c108e3e55ce30(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_9bde045483f7e624(__context__,((char *) "tag_function_macro"),das_new<struct ast_boost::TagFunctionMacro>::make_and_init(__context__,[&]() { return TagFunctionMacro_51f5d0c9e4f6426d(__context__); }));
+		_Funcast_0x60_add_new_variant_macro_5d0e57796a52acbe(__context__,((char *) "better_rtti_in_expr"),das_new<struct ast_boost::BetterRttiVisitor>::make_and_init(__context__,[&]() { return BetterRttiVisitor_43a800514ebc3901(__context__); }));
+	};
+}
+
+inline ExprBlock * setup_macro_c01015f62fd7b19b ( Context * __context__, char * const  __name_rename_at_173, LineInfo const  &  __at_rename_at_173 ) { das_stack_prologue __prologue(__context__,528,"setup_macro " DAS_FILE_LINE);
+{
+	compileProgram(__context__)->flags /*flags*/ |= 0x20u;
+	smart_ptr_raw<Function> __fn_rename_at_175; das_zero(__fn_rename_at_175); das_move(__fn_rename_at_175, find_unique_function_51f7514a784b90af(__context__,compileModule(__context__),__name_rename_at_173));
+	if ( equ_sptr_ptr(__fn_rename_at_175,nullptr) )
+	{
+		das_move(__fn_rename_at_175,das_ascend_handle<true,smart_ptr_raw<Function>>::make(__context__,nullptr,(([&](Function & __mks_177) {
+			das_copy((__mks_177.at /*at*/),(__at_rename_at_173));
+			das_copy((__mks_177.atDecl /*atDecl*/),(__at_rename_at_173));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_177.name /*name*/),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_11, cast<char * const >::from(__name_rename_at_173))));
+			}		}))));
+		__fn_rename_at_175->flags /*flags*/ |= 0x200000u;
+		__fn_rename_at_175->flags /*flags*/ |= 0x100u;
+		das_move(__fn_rename_at_175->result /*result*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_180) {
+			das_copy((__mks_180.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tVoid));
+		}))));
+		smart_ptr_raw<ExprBlock> __blk_rename_at_181; das_zero(__blk_rename_at_181); das_move(__blk_rename_at_181, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_181) {
+			das_copy((__mks_181.at /*at*/),(__at_rename_at_173));
+		}))));
+		smart_ptr_raw<ExprBlock> __iblk_rename_at_182; das_zero(__iblk_rename_at_182); das_move(__iblk_rename_at_182, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_182) {
+			das_copy((__mks_182.at /*at*/),(__at_rename_at_173));
+		}))));
+		smart_ptr_raw<ExprCall> __ifm_rename_at_183; das_zero(__ifm_rename_at_183); das_move(__ifm_rename_at_183, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_183) {
+			das_copy((__mks_183.at /*at*/),(__at_rename_at_173));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_183.name /*name*/),((char *) "is_compiling_macros_in_module"));
+			}		}))));
+		smart_ptr_raw<ExprConstString> __ifmn_rename_at_184; das_zero(__ifmn_rename_at_184); das_move(__ifmn_rename_at_184, das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_184) {
+			das_copy((__mks_184.at /*at*/),(__at_rename_at_173));
+			{
+				das_clone(__mks_184.text /*value*/,compileModule(__context__)->name /*name*/);
+			}		}))));
+		das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__ifm_rename_at_183->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression> const >::pass(__ifmn_rename_at_184));
+		smart_ptr_raw<ExprIfThenElse> __ife_rename_at_186; das_zero(__ife_rename_at_186); das_move(__ife_rename_at_186, das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_186) {
+			das_copy((__mks_186.at /*at*/),(__at_rename_at_173));
+			das_move((__mks_186.cond /*cond*/),(__ifm_rename_at_183));
+			{
+				clone_71815e7f31cbba07(__context__,__mks_186.if_true /*if_true*/,__iblk_rename_at_182);
+			}		}))));
+		das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_181->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__ife_rename_at_186));
+		das_move(__fn_rename_at_175->body /*body*/,__blk_rename_at_181);
+		if ( !addModuleFunction(compileModule(__context__),__fn_rename_at_175,__context__) )
+		{
+			builtin_throw(((char *) "can't setup"),__context__);
+		};
+		return _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903(__context__,__iblk_rename_at_182);
+	} else {
+		if ( SimPolicy<char *>::NotEqu(cast<char *>::from(__fn_rename_at_175->body /*body*/->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprBlock")),*__context__) )
+		{
+			builtin_throw(((char *) "expecting func.ExprBlock"),__context__);
+		};
+		ExprBlock * __blk_rename_at_196 = das_cast<ExprBlock *>::cast(__fn_rename_at_175->body /*body*/);
+		if ( (__blk_rename_at_196->list /*list*/.size() /*length*/ != 1) || (SimPolicy<char *>::NotEqu(cast<char *>::from(das_index<das::vector<smart_ptr<Expression>>>::at(__blk_rename_at_196->list /*list*/,0,__context__)->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprIfThenElse")),*__context__)) )
+		{
+			builtin_throw(((char *) "expecting is_compiling_macros"),__context__);
+		};
+		ExprIfThenElse * __ife_rename_at_199 = das_cast<ExprIfThenElse *>::cast(das_index<das::vector<smart_ptr<Expression>>>::at(__blk_rename_at_196->list /*list*/,0,__context__));
+		if ( SimPolicy<char *>::NotEqu(cast<char *>::from(__ife_rename_at_199->if_true /*if_true*/->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprBlock")),*__context__) )
+		{
+			builtin_throw(((char *) "expecting ife.if_true.ExprBlock"),__context__);
+		};
+		return das_cast<ExprBlock *>::cast(__ife_rename_at_199->if_true /*if_true*/);
+	};
+}}
+
+inline char * const  _Funcstrings_boost_0x60_join_7a2ff2ee78269e80 ( Context * __context__, TArray<char *> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : string const&
+			das_iterator<TArray<char *> const > __elem_iterator(__it_rename_at_16);
+			char * const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_12,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_13,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__))));
+	return __st_rename_at_21;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// BetterRttiVisitor_43a800514ebc3901
+		aotLib[0x913ae23f0c13eb26] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::BetterRttiVisitor (*) ( Context * __context__ ),&BetterRttiVisitor_43a800514ebc3901>>();
+	};
+		// _FuncBetterRttiVisitor_0x27___finalize_8fbf6eed44433a63
+		aotLib[0x18e4fd63f5179626] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::BetterRttiVisitor &  ),&_FuncBetterRttiVisitor_0x27___finalize_8fbf6eed44433a63>>();
+	};
+		// _FuncBetterRttiVisitor_0x60_visitExprIsVariant_c1146ef06505d2d0
+		aotLib[0xaf3c2a61ad420fa7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct ast_boost::BetterRttiVisitor & , smart_ptr_raw<Program> const  , Module * const  , smart_ptr_raw<ExprIsVariant> const   ),&_FuncBetterRttiVisitor_0x60_visitExprIsVariant_c1146ef06505d2d0>>();
+	};
+		// MacroMacro_fb2a4f39105ca505
+		aotLib[0x1aa8d9d0ea6a6ef4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::MacroMacro (*) ( Context * __context__ ),&MacroMacro_fb2a4f39105ca505>>();
+	};
+		// _FuncMacroMacro_0x27___finalize_5893bef35b89221f
+		aotLib[0xae185d5bfee4b114] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::MacroMacro &  ),&_FuncMacroMacro_0x27___finalize_5893bef35b89221f>>();
+	};
+		// _FuncMacroMacro_0x60_apply_8768a9be3443b9df
+		aotLib[0xd8865fa0a1e98f39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct ast_boost::MacroMacro & , smart_ptr_raw<Function> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncMacroMacro_0x60_apply_8768a9be3443b9df>>();
+	};
+		// _FuncSetupAnyAnnotation_0x60_apply_2fe75f3f01c0c452
+		aotLib[0x836e5182fa748e97] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct ast_boost::SetupAnyAnnotation & , smart_ptr_raw<Structure> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncSetupAnyAnnotation_0x60_apply_2fe75f3f01c0c452>>();
+	};
+		// _FuncSetupAnyAnnotation_0x60_setup_call_8eaf665bd176c1ad
+		aotLib[0xe0edbd54604746dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupAnyAnnotation & , smart_ptr_raw<Structure> , smart_ptr_raw<ExprCall>  ),&_FuncSetupAnyAnnotation_0x60_setup_call_8eaf665bd176c1ad>>();
+	};
+		// SetupCallMacro_8f1d72a938a7426f
+		aotLib[0x2b302d9acb323a58] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::SetupCallMacro (*) ( Context * __context__ ),&SetupCallMacro_8f1d72a938a7426f>>();
+	};
+		// _FuncSetupCallMacro_0x27___finalize_2a4680adddc49563
+		aotLib[0x20c0cca9cc62b96e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupCallMacro &  ),&_FuncSetupCallMacro_0x27___finalize_2a4680adddc49563>>();
+	};
+		// SetupFunctionAnnotatoin_dc86c63a66feead2
+		aotLib[0x5edfdc419bfa0a52] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::SetupFunctionAnnotatoin (*) ( Context * __context__ ),&SetupFunctionAnnotatoin_dc86c63a66feead2>>();
+	};
+		// _FuncSetupFunctionAnnotatoin_0x27___finalize_36429344cbd76129
+		aotLib[0x5b62666affa56a67] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupFunctionAnnotatoin &  ),&_FuncSetupFunctionAnnotatoin_0x27___finalize_36429344cbd76129>>();
+	};
+		// SetupInferMacro_cb0fc2fadfd89103
+		aotLib[0x7a54283779335dd4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::SetupInferMacro (*) ( Context * __context__ ),&SetupInferMacro_cb0fc2fadfd89103>>();
+	};
+		// _FuncSetupInferMacro_0x27___finalize_6a72e0c28c729ddf
+		aotLib[0x8bf1514c4a64556c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupInferMacro &  ),&_FuncSetupInferMacro_0x27___finalize_6a72e0c28c729ddf>>();
+	};
+		// SetupReaderMacro_7ce127a3f0f68d46
+		aotLib[0x4a614cd096955b0c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::SetupReaderMacro (*) ( Context * __context__ ),&SetupReaderMacro_7ce127a3f0f68d46>>();
+	};
+		// _FuncSetupReaderMacro_0x27___finalize_dbbebee5997c4d37
+		aotLib[0x8cba5b8fc351b3f3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupReaderMacro &  ),&_FuncSetupReaderMacro_0x27___finalize_dbbebee5997c4d37>>();
+	};
+		// SetupStructureMacro_66fbf3d86127c8c1
+		aotLib[0xa848dbaffc9a6e98] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::SetupStructureMacro (*) ( Context * __context__ ),&SetupStructureMacro_66fbf3d86127c8c1>>();
+	};
+		// _FuncSetupStructureMacro_0x27___finalize_5f11c4a69a57676d
+		aotLib[0x1c917c1f76e6418f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupStructureMacro &  ),&_FuncSetupStructureMacro_0x27___finalize_5f11c4a69a57676d>>();
+	};
+		// SetupVariantMacro_d398499799a61270
+		aotLib[0x8556ceb948d13492] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::SetupVariantMacro (*) ( Context * __context__ ),&SetupVariantMacro_d398499799a61270>>();
+	};
+		// _FuncSetupVariantMacro_0x27___finalize_951875bdcf538d5
+		aotLib[0x3473559554ab1ed2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupVariantMacro &  ),&_FuncSetupVariantMacro_0x27___finalize_951875bdcf538d5>>();
+	};
+		// TagFunctionAnnotation_c8afeab054eec80d
+		aotLib[0x5ce976e39c6231f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::TagFunctionAnnotation (*) ( Context * __context__ ),&TagFunctionAnnotation_c8afeab054eec80d>>();
+	};
+		// _FuncTagFunctionAnnotation_0x27___finalize_be243eed87306007
+		aotLib[0x6e3122855106f7b2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::TagFunctionAnnotation &  ),&_FuncTagFunctionAnnotation_0x27___finalize_be243eed87306007>>();
+	};
+		// _FuncTagFunctionAnnotation_0x60_apply_831d892a28bfa169
+		aotLib[0xd1a6efcda3a2a2bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct ast_boost::TagFunctionAnnotation & , smart_ptr_raw<Function> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncTagFunctionAnnotation_0x60_apply_831d892a28bfa169>>();
+	};
+		// TagFunctionMacro_51f5d0c9e4f6426d
+		aotLib[0x52c1bcebb50f328d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::TagFunctionMacro (*) ( Context * __context__ ),&TagFunctionMacro_51f5d0c9e4f6426d>>();
+	};
+		// _FuncTagFunctionMacro_0x27___finalize_825dbbe27e243913
+		aotLib[0xac33709cd1730e2c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::TagFunctionMacro &  ),&_FuncTagFunctionMacro_0x27___finalize_825dbbe27e243913>>();
+	};
+		// _FuncTagFunctionMacro_0x60_apply_dea4df200f3fb5b0
+		aotLib[0xfd6d2649b9e1d7ee] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct ast_boost::TagFunctionMacro & , smart_ptr_raw<Structure> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncTagFunctionMacro_0x60_apply_dea4df200f3fb5b0>>();
+	};
+		// _FuncTagFunctionMacro_0x60_setup_call_461d4ee0a6be8659
+		aotLib[0xe91a73cf34dce6ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::TagFunctionMacro & , smart_ptr_raw<Structure> , smart_ptr_raw<ExprCall>  ),&_FuncTagFunctionMacro_0x60_setup_call_461d4ee0a6be8659>>();
+	};
+		// TagStructureAnnotation_4b3c108e3e55ce30
+		aotLib[0x9c007300c9238ccd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct ast_boost::TagStructureAnnotation (*) ( Context * __context__ ),&TagStructureAnnotation_4b3c108e3e55ce30>>();
+	};
+		// _FuncTagStructureAnnotation_0x27___finalize_8e605accd8e095b
+		aotLib[0x5dbb386daebd172a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::TagStructureAnnotation &  ),&_FuncTagStructureAnnotation_0x27___finalize_8e605accd8e095b>>();
+	};
+		// _FuncTagStructureAnnotation_0x60_apply_a2336767c0c0b1cb
+		aotLib[0xe077b49e6c11cd3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct ast_boost::TagStructureAnnotation & , smart_ptr_raw<Structure> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncTagStructureAnnotation_0x60_apply_a2336767c0c0b1cb>>();
+	};
+		// apply_tag_annotation_defdf759f8201948
+		aotLib[0x6a94b4d5ceadd85e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , smart_ptr_raw<FunctionAnnotation> const   ),&apply_tag_annotation_defdf759f8201948>>();
+	};
+		// _Funcast_0x60_add_new_function_annotation_cf523e7e76e00096
+		aotLib[0xceaa22f95a559361] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::MacroMacro * const   ),&_Funcast_0x60_add_new_function_annotation_cf523e7e76e00096>>();
+	};
+		// _Funcast_0x60_add_new_function_annotation_d5617b03b1a4ac8e
+		aotLib[0xd94950e6dfb729c8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::TagFunctionAnnotation * const   ),&_Funcast_0x60_add_new_function_annotation_d5617b03b1a4ac8e>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_f06b4439ae42129e
+		aotLib[0x9066bc4f127edf5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::SetupCallMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_f06b4439ae42129e>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_4706833bf75c0674
+		aotLib[0xda90bf2910deb608] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::SetupFunctionAnnotatoin * const   ),&_Funcast_0x60_add_new_structure_annotation_4706833bf75c0674>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_6e6624c5849b86c4
+		aotLib[0x27b6ca3351dbe782] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::SetupInferMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_6e6624c5849b86c4>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_cf25ae0cd4e579ec
+		aotLib[0x17d0e8a10acc6684] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::SetupReaderMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_cf25ae0cd4e579ec>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_d0d465637b6c881c
+		aotLib[0x49a8023f0984a643] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::SetupStructureMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_d0d465637b6c881c>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_343bf718246b02cc
+		aotLib[0x6824970adf1cfdff] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::SetupVariantMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_343bf718246b02cc>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_9bde045483f7e624
+		aotLib[0x29a3c9b134f27f79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::TagFunctionMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_9bde045483f7e624>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_6a05b75ea76a0444
+		aotLib[0xc1859cb2b6aaadd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::TagStructureAnnotation * const   ),&_Funcast_0x60_add_new_structure_annotation_6a05b75ea76a0444>>();
+	};
+		// _Funcast_0x60_add_new_variant_macro_5d0e57796a52acbe
+		aotLib[0x70eac75b95955014] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct ast_boost::BetterRttiVisitor * const   ),&_Funcast_0x60_add_new_variant_macro_5d0e57796a52acbe>>();
+	};
+		// _Funcast_0x60_make_function_annotation_178b2214b0971652
+		aotLib[0xb23c5e83a9230cb6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<FunctionAnnotation> (*) ( Context * __context__, char * const  , struct ast_boost::MacroMacro * const   ),&_Funcast_0x60_make_function_annotation_178b2214b0971652>>();
+	};
+		// _Funcast_0x60_make_function_annotation_cbf559e9d8aaa49c
+		aotLib[0xcc73ec829d95f690] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<FunctionAnnotation> (*) ( Context * __context__, char * const  , struct ast_boost::TagFunctionAnnotation * const   ),&_Funcast_0x60_make_function_annotation_cbf559e9d8aaa49c>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_7bf08e445ef74fb7
+		aotLib[0xdc7b0fb04e78c1d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , struct ast_boost::SetupCallMacro * const   ),&_Funcast_0x60_make_structure_annotation_7bf08e445ef74fb7>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_5394f25399b410a3
+		aotLib[0x90ed9505d1a427d4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , struct ast_boost::SetupFunctionAnnotatoin * const   ),&_Funcast_0x60_make_structure_annotation_5394f25399b410a3>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_80ddaee29146c05
+		aotLib[0xc6ab0a0d2f0a941] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , struct ast_boost::SetupInferMacro * const   ),&_Funcast_0x60_make_structure_annotation_80ddaee29146c05>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_b8777b33e9554cbb
+		aotLib[0xa140081238d1607c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , struct ast_boost::SetupReaderMacro * const   ),&_Funcast_0x60_make_structure_annotation_b8777b33e9554cbb>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_fb66f29d4086977f
+		aotLib[0x56d6acd24904e733] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , struct ast_boost::SetupStructureMacro * const   ),&_Funcast_0x60_make_structure_annotation_fb66f29d4086977f>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_b5dd9bbe349cd2cb
+		aotLib[0xb182bfa85e6b50e7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , struct ast_boost::SetupVariantMacro * const   ),&_Funcast_0x60_make_structure_annotation_b5dd9bbe349cd2cb>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_4aefda9ee1bddc93
+		aotLib[0x8bae2127172881] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , struct ast_boost::TagFunctionMacro * const   ),&_Funcast_0x60_make_structure_annotation_4aefda9ee1bddc93>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_bd697be2b120f5b3
+		aotLib[0x87632a607f8bbf4b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , struct ast_boost::TagStructureAnnotation * const   ),&_Funcast_0x60_make_structure_annotation_bd697be2b120f5b3>>();
+	};
+		// _Funcast_0x60_make_variant_macro_33be8663053d6cb2
+		aotLib[0xabf83e939792336e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<VariantMacro> (*) ( Context * __context__, char * const  , struct ast_boost::BetterRttiVisitor * const   ),&_Funcast_0x60_make_variant_macro_33be8663053d6cb2>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903
+		aotLib[0x190096f99e2fb7f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<ExprBlock * (*) ( Context * __context__, smart_ptr_raw<ExprBlock> const   ),&_Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9
+		aotLib[0x9295bc7cb9b31c25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Structure * (*) ( Context * __context__, smart_ptr_raw<Structure> const   ),&_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9>>();
+	};
+		// _Funcbuiltin_0x60_push_dbe8c61ce24eace2
+		aotLib[0xe7e1aae867aed505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_dbe8c61ce24eace2>>();
+	};
+		// clone_71815e7f31cbba07
+		aotLib[0xc7eba0e24975c38d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr<Expression> & , smart_ptr_raw<ExprBlock> const   ),&clone_71815e7f31cbba07>>();
+	};
+		// describe_d96fc4bea3cd282
+		aotLib[0x13a388cc57e7c3e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, AnnotationArgumentList const  &  ),&describe_d96fc4bea3cd282>>();
+	};
+		// describe_8f4b681e7ab7d244
+		aotLib[0x1272848620cd1b25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, AnnotationDeclaration const  &  ),&describe_8f4b681e7ab7d244>>();
+	};
+		// describe_562242e81f0cb8da
+		aotLib[0xce251634613ce452] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, AnnotationList const  &  ),&describe_562242e81f0cb8da>>();
+	};
+		// finalize_e39f6bf3901fe65e
+		aotLib[0x3ace01a3076fbb79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::BetterRttiVisitor &  ),&finalize_e39f6bf3901fe65e>>();
+	};
+		// finalize_1e05286024ffc9
+		aotLib[0xca8bc021e6e207c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::MacroMacro &  ),&finalize_1e05286024ffc9>>();
+	};
+		// finalize_7741f20af8b390dc
+		aotLib[0x7e1b4285fe95fbb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupCallMacro &  ),&finalize_7741f20af8b390dc>>();
+	};
+		// finalize_d2d8d932b76c8507
+		aotLib[0xc129b0ec211a8021] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupFunctionAnnotatoin &  ),&finalize_d2d8d932b76c8507>>();
+	};
+		// finalize_549b36d594098850
+		aotLib[0xbb85c09e6a8f9ec9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupInferMacro &  ),&finalize_549b36d594098850>>();
+	};
+		// finalize_7fe48452de3177af
+		aotLib[0x1c52c8e16949747d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupReaderMacro &  ),&finalize_7fe48452de3177af>>();
+	};
+		// finalize_408cec3a0eef18bd
+		aotLib[0x642e7ba60baf0f75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupStructureMacro &  ),&finalize_408cec3a0eef18bd>>();
+	};
+		// finalize_85331723c3a41f85
+		aotLib[0x5b5a12fafa33b8b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::SetupVariantMacro &  ),&finalize_85331723c3a41f85>>();
+	};
+		// finalize_5c3a9a623f3d9b38
+		aotLib[0xe8a2161690589e01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::TagFunctionAnnotation &  ),&finalize_5c3a9a623f3d9b38>>();
+	};
+		// finalize_34eecdde29f42869
+		aotLib[0xaebc577076ceb195] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::TagFunctionMacro &  ),&finalize_34eecdde29f42869>>();
+	};
+		// finalize_3bd74c4615c1a065
+		aotLib[0x1d722c2222214bd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ast_boost::TagStructureAnnotation &  ),&finalize_3bd74c4615c1a065>>();
+	};
+		// find_arg_48901e2fdfb01868
+		aotLib[0xe264f0b204e78e70] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> (*) ( Context * __context__, char * const  , AnnotationArgumentList const  &  ),&find_arg_48901e2fdfb01868>>();
+	};
+		// find_unique_function_51f7514a784b90af
+		aotLib[0xe1c18ca6fc5d2bc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Function> (*) ( Context * __context__, Module * const  , char * const   ),&find_unique_function_51f7514a784b90af>>();
+	};
+		// find_unique_generic_486a44e62e317dc7
+		aotLib[0xcf33f4188a6a3719] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Function> (*) ( Context * __context__, Module * const  , char * const   ),&find_unique_generic_486a44e62e317dc7>>();
+	};
+		// for_each_tag_function_156ad29b9fdef8c4
+		aotLib[0x16dd8fee08e4b6cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Module * const  , char * const  , Block DAS_COMMENT((void,smart_ptr_raw<Function>)) const  &  ),&for_each_tag_function_156ad29b9fdef8c4>>();
+	};
+		// isExpression_33f1bf6f8c2e2753
+		aotLib[0x70c13f2c810ac739] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<TypeDecl> const  , bool  ),&isExpression_33f1bf6f8c2e2753>>();
+	};
+		// _Funcrtti_0x60_RttiValue_nothing_c4cebcf8f2cab65d
+		aotLib[0x7ee8ac03c0f1a9f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> (*) ( Context * __context__ ),&_Funcrtti_0x60_RttiValue_nothing_c4cebcf8f2cab65d>>();
+	};
+		// _Funcrtti_0x60_class_info_5c40c94f9433cf45
+		aotLib[0x330aba1afb431271] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::BetterRttiVisitor const  &  ),&_Funcrtti_0x60_class_info_5c40c94f9433cf45>>();
+	};
+		// _Funcrtti_0x60_class_info_43b39f928a0c2cb4
+		aotLib[0xfdfa0ea29e77a3b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::MacroMacro const  &  ),&_Funcrtti_0x60_class_info_43b39f928a0c2cb4>>();
+	};
+		// _Funcrtti_0x60_class_info_f7c42c96e955aecf
+		aotLib[0x8575d4d2c41ef25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::SetupCallMacro const  &  ),&_Funcrtti_0x60_class_info_f7c42c96e955aecf>>();
+	};
+		// _Funcrtti_0x60_class_info_dfe6289f24a05dee
+		aotLib[0x11f534593986b101] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::SetupFunctionAnnotatoin const  &  ),&_Funcrtti_0x60_class_info_dfe6289f24a05dee>>();
+	};
+		// _Funcrtti_0x60_class_info_fe0e1a3100a0e8cb
+		aotLib[0x51ce2536d5a17765] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::SetupInferMacro const  &  ),&_Funcrtti_0x60_class_info_fe0e1a3100a0e8cb>>();
+	};
+		// _Funcrtti_0x60_class_info_95f7c99d727943e
+		aotLib[0x4082389db4104fa1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::SetupReaderMacro const  &  ),&_Funcrtti_0x60_class_info_95f7c99d727943e>>();
+	};
+		// _Funcrtti_0x60_class_info_82fb4b7363897b80
+		aotLib[0xd181b1662439afc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::SetupStructureMacro const  &  ),&_Funcrtti_0x60_class_info_82fb4b7363897b80>>();
+	};
+		// _Funcrtti_0x60_class_info_641c26f0b6e81a28
+		aotLib[0xab09a277393fdba5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::SetupVariantMacro const  &  ),&_Funcrtti_0x60_class_info_641c26f0b6e81a28>>();
+	};
+		// _Funcrtti_0x60_class_info_50ea2355bcfbadc3
+		aotLib[0x1fa71dbbb07ab499] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::TagFunctionAnnotation const  &  ),&_Funcrtti_0x60_class_info_50ea2355bcfbadc3>>();
+	};
+		// _Funcrtti_0x60_class_info_a06301811adbc864
+		aotLib[0xed19fe7e8604b7b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::TagFunctionMacro const  &  ),&_Funcrtti_0x60_class_info_a06301811adbc864>>();
+	};
+		// _Funcrtti_0x60_class_info_937fa16735a67b08
+		aotLib[0xa50e2787b7fe6cbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct ast_boost::TagStructureAnnotation const  &  ),&_Funcrtti_0x60_class_info_937fa16735a67b08>>();
+	};
+		// setup_c734ccfdf563909
+		aotLib[0x9778304edc58af20] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&setup_c734ccfdf563909>>();
+	};
+		// setup_macro_c01015f62fd7b19b
+		aotLib[0xc0f144c059094c79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<ExprBlock * (*) ( Context * __context__, char * const  , LineInfo const  &  ),&setup_macro_c01015f62fd7b19b>>();
+	};
+		// _Funcstrings_boost_0x60_join_7a2ff2ee78269e80
+		aotLib[0x45ed9715bedb8659] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<char *> const  & , char * const   ),&_Funcstrings_boost_0x60_join_7a2ff2ee78269e80>>();
+	};
+		// [[ init script ]]
+		aotLib[0x957891530d26671f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,841 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require fuse
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__cee1348f;
+extern StructInfo __struct_info__57c5ebdb;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__239b2fad;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__ea8083b1;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__dc67f84;
+extern TypeInfo __type_info__c9679a50;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__76972586;
+extern TypeInfo __type_info__b049b391;
+extern VarInfo __var_info__f9f91c79;
+extern VarInfo __var_info__ef3b6ed6;
+extern VarInfo __var_info__7683a54a;
+extern VarInfo __var_info__c241d6c4;
+extern VarInfo __var_info__ba3be25d;
+extern VarInfo __var_info__4c94cd40;
+
+VarInfo __struct_info__cee1348f_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xef3b6ed6, "__rtti", 0 };
+TypeInfo * __type_info__f9f91c79_arg_types_var_3470865551[1] = { &__type_info__ea8083b1 };
+VarInfo __struct_info__cee1348f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f9f91c79_arg_types_var_3470865551, nullptr, 1, 0, nullptr, 28, 0xf9f91c79, "__finalize", 8 };
+TypeInfo * __type_info__c241d6c4_arg_types_var_3470865551[4] = { &__type_info__ea8083b1, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__c9679a50 };
+VarInfo __struct_info__cee1348f_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c241d6c4_arg_types_var_3470865551, nullptr, 4, 0, nullptr, 28, 0xc241d6c4, "visit", 12 };
+VarInfo * __struct_info__cee1348f_fields[3] =  { &__struct_info__cee1348f_field_0, &__struct_info__cee1348f_field_1, &__struct_info__cee1348f_field_2 };
+StructInfo __struct_info__cee1348f = {"FuseMacro", __struct_info__cee1348f_fields, 3, 16, -1, nullptr, 0xcee1348f };
+VarInfo __struct_info__57c5ebdb_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7683a54a, "__rtti", 0 };
+TypeInfo * __type_info__ba3be25d_arg_types_var_1472588763[1] = { &__type_info__ea8083b1 };
+VarInfo __struct_info__57c5ebdb_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ba3be25d_arg_types_var_1472588763, nullptr, 1, 0, nullptr, 28, 0xba3be25d, "__finalize", 8 };
+TypeInfo * __type_info__4c94cd40_arg_types_var_1472588763[4] = { &__type_info__ea8083b1, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__c9679a50 };
+VarInfo __struct_info__57c5ebdb_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4c94cd40_arg_types_var_1472588763, nullptr, 4, 0, nullptr, 28, 0x4c94cd40, "visit", 12 };
+VarInfo * __struct_info__57c5ebdb_fields[3] =  { &__struct_info__57c5ebdb_field_0, &__struct_info__57c5ebdb_field_1, &__struct_info__57c5ebdb_field_2 };
+StructInfo __struct_info__57c5ebdb = {"AstCallMacro", __struct_info__57c5ebdb_fields, 3, 16, -1, nullptr, 0x57c5ebdb };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__239b2fad = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x239b2fad };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__ea8083b1 = { Type::tStructure, &__struct_info__57c5ebdb, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xea8083b1 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__dc67f84 = { Type::tStructure, &__struct_info__cee1348f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xdc67f84 };
+TypeInfo __type_info__c9679a50 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76972586, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc9679a50 };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__76972586 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCallMacro"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76972586 };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+
+TypeInfo * __tinfo_0[6] = { &__type_info__3ffbf730, &__type_info__239b2fad, &__type_info__3ffbf730, &__type_info__239b2fad, &__type_info__3ffbf730, &__type_info__95e97e5e };
+TypeInfo * __tinfo_1[2] = { &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_3[2] = { &__type_info__3ffbf730, &__type_info__95e97e5e };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+namespace ast {
+
+struct AstCallMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstCallMacro)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+};
+static_assert(sizeof(AstCallMacro)==16,"structure size mismatch with DAS");
+static_assert(offsetof(AstCallMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstCallMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstCallMacro,visit)==12,"structure field offset mismatch with DAS");
+}
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace fuse {
+
+struct FuseMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstCallMacro)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+};
+static_assert(sizeof(FuseMacro)==16,"structure size mismatch with DAS");
+static_assert(offsetof(FuseMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(FuseMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(FuseMacro,visit)==12,"structure field offset mismatch with DAS");
+}
+
+inline struct fuse::FuseMacro FuseMacro_1c9dfe8ba85d3344 ( Context * __context__ );
+inline void _FuncFuseMacro_0x27___finalize_204cc7c287e30475 ( Context * __context__, struct fuse::FuseMacro & __self_rename_at_123 );
+inline smart_ptr_raw<Expression> _FuncFuseMacro_0x60_visit_fb08c771808ec7b4 ( Context * __context__, struct fuse::FuseMacro & __self_rename_at_124, smart_ptr_raw<Program> const  __prog_rename_at_124, Module * const  __mod_rename_at_124, smart_ptr_raw<ExprCallMacro> __expr_rename_at_124 );
+inline void __setup_macros_974b156c1a54025b ( Context * __context__ );
+inline smart_ptr_raw<TypeDecl> argument_type_2a96a9dd201fa7a1 ( Context * __context__, ExprCall * const  __call_rename_at_100, int32_t __index_rename_at_100 );
+inline ExprCall * as_call_to_571e741e329202c2 ( Context * __context__, Expression * const  __expr_rename_at_39, char * const  __modName_rename_at_39, char * const  __funcName_rename_at_39, int32_t __nargs_rename_at_39 );
+inline ExprCall * as_fusable_source_fe98ae3a584f29b6 ( Context * __context__, Expression * const  __expr_rename_at_54 );
+inline void _Funcast_0x60_add_new_call_macro_c44a56d633ae7a2e ( Context * __context__, char * const  __name_rename_at_521, struct fuse::FuseMacro * const  __someClassPtr_rename_at_521 );
+inline smart_ptr_raw<CallMacro> _Funcast_0x60_make_call_macro_8013b8fd29ac4e7 ( Context * __context__, char * const  __name_rename_at_473, struct fuse::FuseMacro * const  __someClassPtr_rename_at_473 );
+inline smart_ptr_raw<TypeDecl> auto_type_cb64a887d10ca5a ( Context * __context__ );
+inline ExprBlock * _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903 ( Context * __context__, smart_ptr_raw<ExprBlock> const  __src_rename_at_701 );
+inline Expression * _Funcbuiltin_0x60_get_ptr_98dd15e167848d85 ( Context * __context__, smart_ptr<Expression> const  __src_rename_at_701 );
+inline TypeDecl * _Funcbuiltin_0x60_get_ptr_1d506cf3da127565 ( Context * __context__, smart_ptr<TypeDecl> const  __src_rename_at_701 );
+inline void _Funcbuiltin_0x60_push_6d59097164ce32b8 ( Context * __context__, TArray<ExprCall *> & __Arr_rename_at_40, ExprCall * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void finalize_5737f04367848459 ( Context * __context__, struct fuse::FuseMacro & ____this_rename_at_123 );
+inline Function * generic_origin_5a03d0fef4da5bb2 ( Context * __context__, Function * const  __func_rename_at_33 );
+inline smart_ptr_raw<Expression> make_const_bool_c459999a5f4d0050 ( Context * __context__, bool __value_rename_at_81, LineInfo const  & __at_rename_at_81 );
+inline smart_ptr_raw<Expression> make_invoke_44253379c54fa6a8 ( Context * __context__, char * const  __fnName_rename_at_70, char * const  __argName_rename_at_70, LineInfo const  & __at_rename_at_70 );
+inline smart_ptr_raw<Expression> make_local_52a6d174f872d5b6 ( Context * __context__, char * const  __name_rename_at_93, smart_ptr_raw<TypeDecl> __typ_rename_at_93, LineInfo const  & __at_rename_at_93 );
+inline smart_ptr_raw<Expression> make_local_3ed3549f24019503 ( Context * __context__, char * const  __name_rename_at_85, smart_ptr_raw<TypeDecl> __typ_rename_at_85, smart_ptr_raw<Expression> __init_rename_at_85, LineInfo const  & __at_rename_at_85 );
+inline smart_ptr_raw<Expression> make_return_d6f9ebf77f00a9bd ( Context * __context__, smart_ptr_raw<Expression> __value_rename_at_77, LineInfo const  & __at_rename_at_77 );
+inline smart_ptr_raw<Expression> make_var_a6a6672e3646a9d ( Context * __context__, char * const  __name_rename_at_66, LineInfo const  & __at_rename_at_66 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_bd498ca8a1435ae4 ( Context * __context__, struct fuse::FuseMacro const  & __cl_rename_at_88 );
+inline smart_ptr_raw<TypeDecl> value_type_a11dd57e6c271bd9 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __typ_rename_at_108 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0>(__context__) = 0;/*fuseCounter*/
+	__setup_macros_974b156c1a54025b(__context__);
+}
+
+inline struct fuse::FuseMacro FuseMacro_1c9dfe8ba85d3344 ( Context * __context__ )
+{
+	return (([&]() -> struct fuse::FuseMacro {
+		struct fuse::FuseMacro __mks_123;
+		das_copy((__mks_123.__rtti),(((void *)(&__type_info__dc67f84))));
+		das_copy((__mks_123.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstCallMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@fuse::FuseMacro'__finalize FuseMacro*/ 3255243129u)))));
+		das_copy((__mks_123.visit),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@fuse::FuseMacro`visit FuseMacro #smart_ptr##handle#Program#const #ptr##handle#Module#const #smart_ptr##handle#ExprCallMacro*/ 1022330390u)))));
+		return __mks_123;
+	})());
+}
+
+inline void _FuncFuseMacro_0x27___finalize_204cc7c287e30475 ( Context * __context__, struct fuse::FuseMacro &  __self_rename_at_123 )
+{
+	finalize_5737f04367848459(__context__,das_arg<struct fuse::FuseMacro>::pass(__self_rename_at_123));
+}
+
+inline smart_ptr_raw<Expression> _FuncFuseMacro_0x60_visit_fb08c771808ec7b4 ( Context * __context__, struct fuse::FuseMacro &  __self_rename_at_124, smart_ptr_raw<Program> const  __prog_rename_at_124, Module * const  __mod_rename_at_124, smart_ptr_raw<ExprCallMacro> __expr_rename_at_124 ) { das_stack_prologue __prologue(__context__,2080,"FuseMacro`visit " DAS_FILE_LINE);
+{
+	if ( __expr_rename_at_124->arguments /*arguments*/.size() /*length*/ != 1 )
+	{
+		ast_error(__prog_rename_at_124,das_arg<LineInfo>::pass(__expr_rename_at_124->at /*at*/),((char *) "expecting fuse(pipeline)"));
+		return nullptr;
+	} else {
+		if ( (equ_sptr_ptr(das_index<das::vector<smart_ptr<Expression>>>::at(__expr_rename_at_124->arguments /*arguments*/,0,__context__)->type /*_type*/,nullptr)) || das_index<das::vector<smart_ptr<Expression>>>::at(__expr_rename_at_124->arguments /*arguments*/,0,__context__)->type /*_type*/->isAuto() /*isAuto*/ )
+		{
+			return nullptr;
+		} else {
+			TDim<char *,5> _temp_make_local_134_80;
+			Expression * __pipe_rename_at_130 = (Expression *)_Funcbuiltin_0x60_get_ptr_98dd15e167848d85(__context__,das_index<das::vector<smart_ptr<Expression>>>::at(__expr_rename_at_124->arguments /*arguments*/,0,__context__));
+			char * __sink_rename_at_132 = (char *)(((char *) ""));
+			ExprCall * __sinkCall_rename_at_133 = 0;
+			{
+				bool __need_loop_134 = true;
+				// name : string&
+				das_iterator<TDim<char *,5>> __name_iterator((([&]() -> TDim<char *,5>& {
+					_temp_make_local_134_80(0,__context__) = ((char *) "reduce");
+					_temp_make_local_134_80(1,__context__) = ((char *) "sum");
+					_temp_make_local_134_80(2,__context__) = ((char *) "any");
+					_temp_make_local_134_80(3,__context__) = ((char *) "all");
+					_temp_make_local_134_80(4,__context__) = ((char *) "to_array");
+					return _temp_make_local_134_80;
+				})()));
+				char * * __name_rename_at_134;
+				__need_loop_134 = __name_iterator.first(__context__,(__name_rename_at_134)) && __need_loop_134;
+				for ( ; __need_loop_134 ; __need_loop_134 = __name_iterator.next(__context__,(__name_rename_at_134)) )
+				{
+					das_copy(__sinkCall_rename_at_133,as_call_to_571e741e329202c2(__context__,__pipe_rename_at_130,(SimPolicy<char *>::Equ(cast<char *>::from((*__name_rename_at_134)),cast<char *>::from(((char *) "to_array")),*__context__)) ? (((char *) "$")) : (((char *) "functional")),(*__name_rename_at_134),(SimPolicy<char *>::Equ(cast<char *>::from((*__name_rename_at_134)),cast<char *>::from(((char *) "reduce")),*__context__)) ? (2) : (1)));
+					if ( __sinkCall_rename_at_133 != nullptr )
+					{
+						das_copy(__sink_rename_at_132,(*__name_rename_at_134));
+						break;
+					};
+				}
+				__name_iterator.close(__context__,(__name_rename_at_134));
+			};
+			if ( __sinkCall_rename_at_133 == nullptr )
+			{
+				return clone_expression(das_index<das::vector<smart_ptr<Expression>>>::at(__expr_rename_at_124->arguments /*arguments*/,0,__context__));
+			} else {
+				TArray<ExprCall *> __stages_rename_at_142; das_zero(__stages_rename_at_142);
+				ExprCall * __srcCall_rename_at_143 = as_fusable_source_fe98ae3a584f29b6(__context__,_Funcbuiltin_0x60_get_ptr_98dd15e167848d85(__context__,das_index<das::vector<smart_ptr<Expression>>>::at(__sinkCall_rename_at_133->arguments /*arguments*/,0,__context__)));
+				Expression * __cur_expr_rename_at_144 = _Funcbuiltin_0x60_get_ptr_98dd15e167848d85(__context__,das_index<das::vector<smart_ptr<Expression>>>::at(__sinkCall_rename_at_133->arguments /*arguments*/,0,__context__));
+				while ( __srcCall_rename_at_143 == nullptr )
+				{
+					ExprCall * __stage_rename_at_146 = as_call_to_571e741e329202c2(__context__,__cur_expr_rename_at_144,((char *) "functional"),((char *) "filter"),2);
+					if ( __stage_rename_at_146 == nullptr )
+					{
+						das_copy(__stage_rename_at_146,as_call_to_571e741e329202c2(__context__,__cur_expr_rename_at_144,((char *) "functional"),((char *) "map"),2));
+					};
+					if ( __stage_rename_at_146 == nullptr )
+					{
+						return clone_expression(das_index<das::vector<smart_ptr<Expression>>>::at(__expr_rename_at_124->arguments /*arguments*/,0,__context__));
+					} else {
+						_Funcbuiltin_0x60_push_6d59097164ce32b8(__context__,das_arg<TArray<ExprCall *>>::pass(__stages_rename_at_142),__stage_rename_at_146,-1);
+						das_copy(__cur_expr_rename_at_144,_Funcbuiltin_0x60_get_ptr_98dd15e167848d85(__context__,das_index<das::vector<smart_ptr<Expression>>>::at(__stage_rename_at_146->arguments /*arguments*/,0,__context__)));
+						das_copy(__srcCall_rename_at_143,as_fusable_source_fe98ae3a584f29b6(__context__,__cur_expr_rename_at_144));
+					};
+				};
+				LineInfo __at_rename_at_154 = (LineInfo)__expr_rename_at_124->at /*at*/;
+				char * __fnName_rename_at_155 = (char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<6>(__tinfo_0, cast<char * const >::from(((char *) "`fuse`")), cast<uint32_t>::from(__at_rename_at_154.line /*line*/), cast<char * const >::from(((char *) "`")), cast<uint32_t>::from(__at_rename_at_154.column /*column*/), cast<char * const >::from(((char *) "`")), cast<int32_t>::from(das_global<int32_t,0>(__context__) /*fuseCounter*/++))));
+				smart_ptr_raw<Function> __fn_rename_at_156; das_zero(__fn_rename_at_156); das_move(__fn_rename_at_156, das_ascend_handle<true,smart_ptr_raw<Function>>::make(__context__,nullptr,(([&](Function & __mks_156) {
+					das_copy((__mks_156.at /*at*/),(__at_rename_at_154));
+					das_copy((__mks_156.atDecl /*atDecl*/),(__at_rename_at_154));
+					{
+						set_das_string(das_arg<das::string>::pass(__mks_156.name /*name*/),__fnName_rename_at_155);
+					}				}))));
+				__fn_rename_at_156->flags /*flags*/ |= 0x200000u;
+				__fn_rename_at_156->flags /*flags*/ |= 0x400000u;
+				smart_ptr_raw<TypeDecl> __rtype_rename_at_159; das_zero(__rtype_rename_at_159); das_move(__rtype_rename_at_159, value_type_a11dd57e6c271bd9(__context__,das_index<das::vector<smart_ptr<Expression>>>::at(__expr_rename_at_124->arguments /*arguments*/,0,__context__)->type /*_type*/));
+				das_move(__fn_rename_at_156->result /*result*/,__rtype_rename_at_159);
+				smart_ptr_raw<ExprCall> __call_rename_at_161; das_zero(__call_rename_at_161); das_move(__call_rename_at_161, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_161) {
+					das_copy((__mks_161.at /*at*/),(__at_rename_at_154));
+					{
+						set_das_string(das_arg<das::string>::pass(__mks_161.name /*name*/),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "_::")), cast<char * const >::from(__fnName_rename_at_155))));
+					}				}))));
+				das_vector_push_value(das_arg<das::vector<smart_ptr<Variable>>>::pass(__fn_rename_at_156->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_163) {
+					das_copy((__mks_163.at /*at*/),(__at_rename_at_154));
+					das_move((__mks_163.type /*_type*/),(argument_type_2a96a9dd201fa7a1(__context__,__srcCall_rename_at_143,0)));
+					{
+						set_das_string(das_arg<das::string>::pass(__mks_163.name /*name*/),((char *) "__src"));
+					}				}))));
+				das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_161->arguments /*arguments*/),clone_expression(das_index<das::vector<smart_ptr<Expression>>>::at(__srcCall_rename_at_143->arguments /*arguments*/,0,__context__)));
+				smart_ptr_raw<ExprBlock> __body_rename_at_165; das_zero(__body_rename_at_165); das_move(__body_rename_at_165, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_165) {
+					das_copy((__mks_165.at /*at*/),(__at_rename_at_154));
+				}))));
+				smart_ptr_raw<ExprFor> __loop_rename_at_166; das_zero(__loop_rename_at_166); das_move(__loop_rename_at_166, das_ascend_handle<true,smart_ptr_raw<ExprFor>>::make(__context__,nullptr,(([&](ExprFor & __mks_166) {
+					das_copy((__mks_166.at /*at*/),(__at_rename_at_154));
+					das_copy((__mks_166.visibility /*visibility*/),(__at_rename_at_154));
+				}))));
+				das_vector_resize(das_arg<das::vector<das::string>>::pass(__loop_rename_at_166->iterators /*iterators*/),1);
+				set_das_string(das_arg<das::string>::pass(das_index<das::vector<das::string>>::at(__loop_rename_at_166->iterators /*iterators*/,0,__context__)),((char *) "__x0"));
+				das_vector_push(das_arg<das::vector<LineInfo>>::pass(__loop_rename_at_166->iteratorsAt /*iteratorsAt*/),__at_rename_at_154);
+				das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__loop_rename_at_166->sources /*sources*/),make_var_a6a6672e3646a9d(__context__,((char *) "__src"),__at_rename_at_154));
+				smart_ptr_raw<ExprBlock> __loopBody_rename_at_171; das_zero(__loopBody_rename_at_171); das_move(__loopBody_rename_at_171, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_171) {
+					das_copy((__mks_171.at /*at*/),(__at_rename_at_154));
+				}))));
+				ExprBlock * __cur_rename_at_172 = _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903(__context__,__loopBody_rename_at_171);
+				char * __value_rename_at_173 = (char *)(((char *) "__x0"));
+				{
+					bool __need_loop_175 = true;
+					// i : int const
+					das_iterator<range> __i_iterator(range(0,builtin_array_size(das_arg<TArray<ExprCall *>>::pass(__stages_rename_at_142))));
+					int32_t __i_rename_at_175;
+					__need_loop_175 = __i_iterator.first(__context__,(__i_rename_at_175)) && __need_loop_175;
+					for ( ; __need_loop_175 ; __need_loop_175 = __i_iterator.next(__context__,(__i_rename_at_175)) )
+					{
+						ExprCall * __stage_rename_at_176 = (ExprCall *)__stages_rename_at_142(((builtin_array_size(das_arg<TArray<ExprCall *>>::pass(__stages_rename_at_142)) - __i_rename_at_175) - 1),__context__);
+						char * __argName_rename_at_177 = (char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char *) "__fn")), cast<int32_t>::from(__i_rename_at_175))));
+						das_vector_push_value(das_arg<das::vector<smart_ptr<Variable>>>::pass(__fn_rename_at_156->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_178) {
+							das_copy((__mks_178.at /*at*/),(__at_rename_at_154));
+							das_move((__mks_178.type /*_type*/),(argument_type_2a96a9dd201fa7a1(__context__,__stage_rename_at_176,1)));
+							{
+								set_das_string(das_arg<das::string>::pass(__mks_178.name /*name*/),__argName_rename_at_177);
+							}						}))));
+						das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_161->arguments /*arguments*/),clone_expression(das_index<das::vector<smart_ptr<Expression>> const >::at(__stage_rename_at_176->arguments /*arguments*/,1,__context__)));
+						if ( as_call_to_571e741e329202c2(__context__,das_reinterpret<Expression * const >::pass(__stage_rename_at_176),((char *) "functional"),((char *) "filter"),2) != nullptr )
+						{
+							smart_ptr_raw<ExprBlock> __inner_rename_at_181; das_zero(__inner_rename_at_181); das_move(__inner_rename_at_181, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_181) {
+								das_copy((__mks_181.at /*at*/),(__at_rename_at_154));
+							}))));
+							ExprBlock * __innerPtr_rename_at_182 = (ExprBlock *)_Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903(__context__,__inner_rename_at_181);
+							smart_ptr_raw<ExprIfThenElse> __ife_rename_at_183; das_zero(__ife_rename_at_183); das_move(__ife_rename_at_183, das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_183) {
+								das_copy((__mks_183.at /*at*/),(__at_rename_at_154));
+								das_move((__mks_183.cond /*cond*/),(make_invoke_44253379c54fa6a8(__context__,__argName_rename_at_177,__value_rename_at_173,__at_rename_at_154)));
+								das_move((__mks_183.if_true /*if_true*/),(__inner_rename_at_181));
+							}))));
+							das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cur_rename_at_172->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__ife_rename_at_183));
+							das_copy(__cur_rename_at_172,__innerPtr_rename_at_182);
+						} else {
+							char * __nextValue_rename_at_187 = (char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<char * const >::from(((char *) "__x")), cast<int32_t>::from((__i_rename_at_175 + 1)))));
+							das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cur_rename_at_172->list /*list*/),make_local_3ed3549f24019503(__context__,__nextValue_rename_at_187,auto_type_cb64a887d10ca5a(__context__),make_invoke_44253379c54fa6a8(__context__,__argName_rename_at_177,__value_rename_at_173,__at_rename_at_154),__at_rename_at_154));
+							das_copy(__value_rename_at_173,__nextValue_rename_at_187);
+						};
+					}
+					__i_iterator.close(__context__,(__i_rename_at_175));
+				};
+				if ( SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "reduce")),*__context__) )
+				{
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Variable>>>::pass(__fn_rename_at_156->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_192) {
+						das_copy((__mks_192.at /*at*/),(__at_rename_at_154));
+						das_move((__mks_192.type /*_type*/),(argument_type_2a96a9dd201fa7a1(__context__,__sinkCall_rename_at_133,1)));
+						{
+							set_das_string(das_arg<das::string>::pass(__mks_192.name /*name*/),((char *) "__fnr"));
+						}					}))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_161->arguments /*arguments*/),clone_expression(das_index<das::vector<smart_ptr<Expression>>>::at(__sinkCall_rename_at_133->arguments /*arguments*/,1,__context__)));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__body_rename_at_165->list /*list*/),make_local_52a6d174f872d5b6(__context__,((char *) "__acc"),value_type_a11dd57e6c271bd9(__context__,das_index<das::vector<smart_ptr<Expression>>>::at(__expr_rename_at_124->arguments /*arguments*/,0,__context__)->type /*_type*/),__at_rename_at_154));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__body_rename_at_165->list /*list*/),make_local_52a6d174f872d5b6(__context__,((char *) "__started"),das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_195) {
+						das_copy((__mks_195.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tBool));
+					}))),__at_rename_at_154));
+					smart_ptr_raw<ExprBlock> __firstBlk_rename_at_196; das_zero(__firstBlk_rename_at_196); das_move(__firstBlk_rename_at_196, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_196) {
+						das_copy((__mks_196.at /*at*/),(__at_rename_at_154));
+					}))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__firstBlk_rename_at_196->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprCopy>>::make(__context__,nullptr,(([&](ExprCopy & __mks_197) {
+						das_copy((__mks_197.at /*at*/),(__at_rename_at_154));
+						das_move((__mks_197.left /*left*/),(make_var_a6a6672e3646a9d(__context__,((char *) "__started"),__at_rename_at_154)));
+						das_move((__mks_197.right /*right*/),(make_const_bool_c459999a5f4d0050(__context__,true,__at_rename_at_154)));
+						{
+							set_das_string(das_arg<das::string>::pass(__mks_197.op /*op*/),((char *) "="));
+						}					})))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__firstBlk_rename_at_196->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprCopy>>::make(__context__,nullptr,(([&](ExprCopy & __mks_198) {
+						das_copy((__mks_198.at /*at*/),(__at_rename_at_154));
+						das_move((__mks_198.left /*left*/),(make_var_a6a6672e3646a9d(__context__,((char *) "__acc"),__at_rename_at_154)));
+						das_move((__mks_198.right /*right*/),(make_var_a6a6672e3646a9d(__context__,__value_rename_at_173,__at_rename_at_154)));
+						{
+							set_das_string(das_arg<das::string>::pass(__mks_198.op /*op*/),((char *) "="));
+						}					})))));
+					smart_ptr_raw<ExprInvoke> __inv_rename_at_199; das_zero(__inv_rename_at_199); das_move(__inv_rename_at_199, das_ascend_handle<true,smart_ptr_raw<ExprInvoke>>::make(__context__,nullptr,(([&](ExprInvoke & __mks_199) {
+						das_copy((__mks_199.at /*at*/),(__at_rename_at_154));
+						{
+							set_das_string(das_arg<das::string>::pass(__mks_199.name /*name*/),((char *) "invoke"));
+						}					}))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__inv_rename_at_199->arguments /*arguments*/),make_var_a6a6672e3646a9d(__context__,((char *) "__fnr"),__at_rename_at_154));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__inv_rename_at_199->arguments /*arguments*/),make_var_a6a6672e3646a9d(__context__,((char *) "__acc"),__at_rename_at_154));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__inv_rename_at_199->arguments /*arguments*/),make_var_a6a6672e3646a9d(__context__,__value_rename_at_173,__at_rename_at_154));
+					smart_ptr_raw<ExprBlock> __restBlk_rename_at_203; das_zero(__restBlk_rename_at_203); das_move(__restBlk_rename_at_203, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_203) {
+						das_copy((__mks_203.at /*at*/),(__at_rename_at_154));
+					}))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__restBlk_rename_at_203->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprCopy>>::make(__context__,nullptr,(([&](ExprCopy & __mks_204) {
+						das_copy((__mks_204.at /*at*/),(__at_rename_at_154));
+						das_move((__mks_204.left /*left*/),(make_var_a6a6672e3646a9d(__context__,((char *) "__acc"),__at_rename_at_154)));
+						das_move((__mks_204.right /*right*/),(__inv_rename_at_199));
+						{
+							set_das_string(das_arg<das::string>::pass(__mks_204.op /*op*/),((char *) "="));
+						}					})))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cur_rename_at_172->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_205) {
+						das_copy((__mks_205.at /*at*/),(__at_rename_at_154));
+						das_move((__mks_205.cond /*cond*/),(make_var_a6a6672e3646a9d(__context__,((char *) "__started"),__at_rename_at_154)));
+						das_move((__mks_205.if_true /*if_true*/),(__restBlk_rename_at_203));
+						das_move((__mks_205.if_false /*if_false*/),(__firstBlk_rename_at_196));
+					})))));
+				} else if ( SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "sum")),*__context__) )
+				{
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__body_rename_at_165->list /*list*/),make_local_52a6d174f872d5b6(__context__,((char *) "__acc"),value_type_a11dd57e6c271bd9(__context__,das_index<das::vector<smart_ptr<Expression>>>::at(__expr_rename_at_124->arguments /*arguments*/,0,__context__)->type /*_type*/),__at_rename_at_154));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cur_rename_at_172->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprOp2>>::make(__context__,nullptr,(([&](ExprOp2 & __mks_208) {
+						das_copy((__mks_208.at /*at*/),(__at_rename_at_154));
+						das_move((__mks_208.left /*left*/),(make_var_a6a6672e3646a9d(__context__,((char *) "__acc"),__at_rename_at_154)));
+						das_move((__mks_208.right /*right*/),(make_var_a6a6672e3646a9d(__context__,__value_rename_at_173,__at_rename_at_154)));
+						{
+							set_das_string(das_arg<das::string>::pass(__mks_208.op /*op*/),((char *) "+="));
+						}					})))));
+				} else if ( (SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "any")),*__context__)) || (SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "all")),*__context__)) )
+				{
+					smart_ptr_raw<Expression> __cond_rename_at_210; das_zero(__cond_rename_at_210); das_move(__cond_rename_at_210, make_var_a6a6672e3646a9d(__context__,__value_rename_at_173,__at_rename_at_154));
+					if ( SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "all")),*__context__) )
+					{
+						das_move(__cond_rename_at_210,das_ascend_handle<true,smart_ptr_raw<ExprOp1>>::make(__context__,nullptr,(([&](ExprOp1 & __mks_212) {
+							das_copy((__mks_212.at /*at*/),(__at_rename_at_154));
+							das_move((__mks_212.subexpr /*subexpr*/),(__cond_rename_at_210));
+							{
+								set_das_string(das_arg<das::string>::pass(__mks_212.op /*op*/),((char *) "!"));
+							}						}))));
+					};
+					smart_ptr_raw<ExprBlock> __retBlk_rename_at_213; das_zero(__retBlk_rename_at_213); das_move(__retBlk_rename_at_213, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_213) {
+						das_copy((__mks_213.at /*at*/),(__at_rename_at_154));
+					}))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__retBlk_rename_at_213->list /*list*/),make_return_d6f9ebf77f00a9bd(__context__,make_const_bool_c459999a5f4d0050(__context__,SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "any")),*__context__),__at_rename_at_154),__at_rename_at_154));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cur_rename_at_172->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_215) {
+						das_copy((__mks_215.at /*at*/),(__at_rename_at_154));
+						das_move((__mks_215.cond /*cond*/),(__cond_rename_at_210));
+						das_move((__mks_215.if_true /*if_true*/),(__retBlk_rename_at_213));
+					})))));
+				} else if ( SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "to_array")),*__context__) )
+				{
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__body_rename_at_165->list /*list*/),make_local_52a6d174f872d5b6(__context__,((char *) "__acc"),value_type_a11dd57e6c271bd9(__context__,das_index<das::vector<smart_ptr<Expression>>>::at(__expr_rename_at_124->arguments /*arguments*/,0,__context__)->type /*_type*/),__at_rename_at_154));
+					smart_ptr_raw<ExprCall> __pcall_rename_at_218; das_zero(__pcall_rename_at_218); das_move(__pcall_rename_at_218, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_218) {
+						das_copy((__mks_218.at /*at*/),(__at_rename_at_154));
+						{
+							set_das_string(das_arg<das::string>::pass(__mks_218.name /*name*/),((char *) "push_clone"));
+						}					}))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__pcall_rename_at_218->arguments /*arguments*/),make_var_a6a6672e3646a9d(__context__,((char *) "__acc"),__at_rename_at_154));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__pcall_rename_at_218->arguments /*arguments*/),make_var_a6a6672e3646a9d(__context__,__value_rename_at_173,__at_rename_at_154));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cur_rename_at_172->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__pcall_rename_at_218));
+				};
+				das_move(__loop_rename_at_166->body /*body*/,__loopBody_rename_at_171);
+				das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__body_rename_at_165->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__loop_rename_at_166));
+				if ( SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "reduce")),*__context__) )
+				{
+					smart_ptr_raw<ExprBlock> __panicBlk_rename_at_226; das_zero(__panicBlk_rename_at_226); das_move(__panicBlk_rename_at_226, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_226) {
+						das_copy((__mks_226.at /*at*/),(__at_rename_at_154));
+					}))));
+					smart_ptr_raw<ExprCall> __pcall_rename_at_227; das_zero(__pcall_rename_at_227); das_move(__pcall_rename_at_227, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_227) {
+						das_copy((__mks_227.at /*at*/),(__at_rename_at_154));
+						{
+							set_das_string(das_arg<das::string>::pass(__mks_227.name /*name*/),((char *) "panic"));
+						}					}))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__pcall_rename_at_227->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_228) {
+						das_copy((__mks_228.at /*at*/),(__at_rename_at_154));
+						{
+							set_das_string(das_arg<das::string>::pass(__mks_228.text /*value*/),((char *) "can't reduce empty sequence"));
+						}					})))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__panicBlk_rename_at_226->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__pcall_rename_at_227));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__body_rename_at_165->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_230) {
+						das_copy((__mks_230.at /*at*/),(__at_rename_at_154));
+						das_move((__mks_230.cond /*cond*/),(das_ascend_handle<true,smart_ptr_raw<ExprOp1>>::make(__context__,nullptr,(([&](ExprOp1 & __mks_230) {
+							das_copy((__mks_230.at /*at*/),(__at_rename_at_154));
+							das_move((__mks_230.subexpr /*subexpr*/),(make_var_a6a6672e3646a9d(__context__,((char *) "__started"),__at_rename_at_154)));
+							{
+								set_das_string(das_arg<das::string>::pass(__mks_230.op /*op*/),((char *) "!"));
+							}						})))));
+						das_move((__mks_230.if_true /*if_true*/),(__panicBlk_rename_at_226));
+					})))));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__body_rename_at_165->list /*list*/),make_return_d6f9ebf77f00a9bd(__context__,make_var_a6a6672e3646a9d(__context__,((char *) "__acc"),__at_rename_at_154),__at_rename_at_154));
+				} else if ( SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "sum")),*__context__) )
+				{
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__body_rename_at_165->list /*list*/),make_return_d6f9ebf77f00a9bd(__context__,make_var_a6a6672e3646a9d(__context__,((char *) "__acc"),__at_rename_at_154),__at_rename_at_154));
+				} else if ( (SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "any")),*__context__)) || (SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "all")),*__context__)) )
+				{
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__body_rename_at_165->list /*list*/),make_return_d6f9ebf77f00a9bd(__context__,make_const_bool_c459999a5f4d0050(__context__,SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "all")),*__context__),__at_rename_at_154),__at_rename_at_154));
+				} else if ( SimPolicy<char *>::Equ(cast<char *>::from(__sink_rename_at_132),cast<char *>::from(((char *) "to_array")),*__context__) )
+				{
+					smart_ptr_raw<ExprReturn> __ret_rename_at_237; das_zero(__ret_rename_at_237); das_move(__ret_rename_at_237, das_ascend_handle<true,smart_ptr_raw<ExprReturn>>::make(__context__,nullptr,(([&](ExprReturn & __mks_237) {
+						das_copy((__mks_237.at /*at*/),(__at_rename_at_154));
+						das_move((__mks_237.subexpr /*subexpr*/),(make_var_a6a6672e3646a9d(__context__,((char *) "__acc"),__at_rename_at_154)));
+					}))));
+					__ret_rename_at_237->returnFlags /*returnFlags*/ |= 0x1u;
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__body_rename_at_165->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__ret_rename_at_237));
+				};
+				das_move(__fn_rename_at_156->body /*body*/,__body_rename_at_165);
+				addModuleFunction(compileModule(__context__),__fn_rename_at_156,__context__);
+				return /* <- */ __call_rename_at_161;
+			};
+		};
+	};
+}}
+
+inline void __setup_macros_974b156c1a54025b ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "fuse"),__context__) )
+	{
+		_Funcast_0x60_add_new_call_macro_c44a56d633ae7a2e(__context__,((char *) "fuse"),das_new<struct fuse::FuseMacro>::make_and_init(__context__,[&]() { return FuseMacro_1c9dfe8ba85d3344(__context__); }));
+	};
+}
+
+inline smart_ptr_raw<TypeDecl> argument_type_2a96a9dd201fa7a1 ( Context * __context__, ExprCall * const  __call_rename_at_100, int32_t __index_rename_at_100 )
+{
+	smart_ptr<TypeDecl> __typ_rename_at_101; das_zero(__typ_rename_at_101); das_move(__typ_rename_at_101, clone_type(das_index<das::vector<smart_ptr<Variable>> const >::at(__call_rename_at_100->func /*func*/->arguments /*arguments*/,__index_rename_at_100,__context__)->type /*_type*/));
+	__typ_rename_at_101->flags /*flags*/ &= 0xfffffffeu;
+	__typ_rename_at_101->flags /*flags*/ &= 0xfffffffbu;
+	__typ_rename_at_101->flags /*flags*/ |= 0x2u;
+	return /* <- */ __typ_rename_at_101;
+}
+
+inline ExprCall * as_call_to_571e741e329202c2 ( Context * __context__, Expression * const  __expr_rename_at_39, char * const  __modName_rename_at_39, char * const  __funcName_rename_at_39, int32_t __nargs_rename_at_39 )
+{
+	if ( (__expr_rename_at_39 == nullptr) || !((SimPolicy<char *>::Equ(cast<char *>::from(__expr_rename_at_39->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprCall")),*__context__))) )
+	{
+		return nullptr;
+	} else {
+		ExprCall * __call_rename_at_43 = (ExprCall *)das_cast<ExprCall *>::cast(__expr_rename_at_39);
+		if ( __call_rename_at_43->arguments /*arguments*/.size() /*length*/ != __nargs_rename_at_39 )
+		{
+			return nullptr;
+		} else {
+			Function * __func_rename_at_46 = (Function *)generic_origin_5a03d0fef4da5bb2(__context__,__call_rename_at_43->func /*func*/);
+			return ((__func_rename_at_46 == nullptr) || (__func_rename_at_46->module /*_module*/ == nullptr)) ? (nullptr) : ((((SimPolicy<char *>::NotEqu(cast<char *>::from(((char *)(to_das_string(__func_rename_at_46->name /*name*/,__context__)))),cast<char *>::from(__funcName_rename_at_39),*__context__)) || (SimPolicy<char *>::NotEqu(cast<char *>::from(((char *)(to_das_string(__func_rename_at_46->module /*_module*/->name /*name*/,__context__)))),cast<char *>::from(__modName_rename_at_39),*__context__))) ? (nullptr) : (__call_rename_at_43)));
+		};
+	};
+}
+
+inline ExprCall * as_fusable_source_fe98ae3a584f29b6 ( Context * __context__, Expression * const  __expr_rename_at_54 )
+{
+	ExprCall * __call_rename_at_55 = (ExprCall *)as_call_to_571e741e329202c2(__context__,__expr_rename_at_54,((char *) "$"),((char *) "each"),1);
+	if ( __call_rename_at_55 == nullptr )
+	{
+		return nullptr;
+	} else {
+		TypeDecl * __stype_rename_at_58 = (TypeDecl *)_Funcbuiltin_0x60_get_ptr_1d506cf3da127565(__context__,das_index<das::vector<smart_ptr<Expression>> const >::at(__call_rename_at_55->arguments /*arguments*/,0,__context__)->type /*_type*/);
+		return (__stype_rename_at_58 == nullptr) ? (nullptr) : (((((__stype_rename_at_58->dim /*dim*/.size() /*length*/ != 0) || (__stype_rename_at_58->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tArray)) || (__stype_rename_at_58->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tRange)) ? (__call_rename_at_55) : (nullptr)));
+	};
+}
+
+inline void _Funcast_0x60_add_new_call_macro_c44a56d633ae7a2e ( Context * __context__, char * const  __name_rename_at_521, struct fuse::FuseMacro * const  __someClassPtr_rename_at_521 )
+{
+	smart_ptr_raw<CallMacro> __ann_rename_at_522; das_zero(__ann_rename_at_522); das_move(__ann_rename_at_522, _Funcast_0x60_make_call_macro_8013b8fd29ac4e7(__context__,__name_rename_at_521,__someClassPtr_rename_at_521));
+	addModuleCallMacro(thisModule(__context__,nullptr),__ann_rename_at_522,__context__);
+	das_delete_handle<smart_ptr_raw<CallMacro>>::clear(__context__,__ann_rename_at_522);
+}
+
+inline smart_ptr_raw<CallMacro> _Funcast_0x60_make_call_macro_8013b8fd29ac4e7 ( Context * __context__, char * const  __name_rename_at_473, struct fuse::FuseMacro * const  __someClassPtr_rename_at_473 )
+{
+	StructInfo const  * __classInfo_rename_at_475 = (StructInfo const  *)_Funcrtti_0x60_class_info_bd498ca8a1435ae4(__context__,das_deref(__context__,__someClassPtr_rename_at_473));
+	return makeCallMacro(__name_rename_at_473,__someClassPtr_rename_at_473,__classInfo_rename_at_475,__context__);
+}
+
+inline smart_ptr_raw<TypeDecl> auto_type_cb64a887d10ca5a ( Context * __context__ )
+{
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_117) {
+		das_copy((__mks_117.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::autoinfer));
+	})));
+}
+
+inline ExprBlock * _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903 ( Context * __context__, smart_ptr_raw<ExprBlock> const  __src_rename_at_701 )
+{
+	return das_cast<ExprBlock *>::cast(__src_rename_at_701);
+}
+
+inline Expression * _Funcbuiltin_0x60_get_ptr_98dd15e167848d85 ( Context * __context__, smart_ptr<Expression> const  __src_rename_at_701 )
+{
+	return das_cast<Expression *>::cast(__src_rename_at_701);
+}
+
+inline TypeDecl * _Funcbuiltin_0x60_get_ptr_1d506cf3da127565 ( Context * __context__, smart_ptr<TypeDecl> const  __src_rename_at_701 )
+{
+	return das_cast<TypeDecl *>::cast(__src_rename_at_701);
+}
+
+inline void _Funcbuiltin_0x60_push_6d59097164ce32b8 ( Context * __context__, TArray<ExprCall *> &  __Arr_rename_at_40, ExprCall * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<ExprCall *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void finalize_5737f04367848459 ( Context * __context__, struct fuse::FuseMacro &  ____this_rename_at_123 )
+{
+	memset(&(____this_rename_at_123), 0, 16);
+}
+
+inline Function * generic_origin_5a03d0fef4da5bb2 ( Context * __context__, Function * const  __func_rename_at_33 )
+{
+	return (__func_rename_at_33 == nullptr) ? (nullptr) : (((__func_rename_at_33->fromGeneric /*fromGeneric*/ != nullptr) ? (__func_rename_at_33->fromGeneric /*fromGeneric*/) : (__func_rename_at_33)));
+}
+
+inline smart_ptr_raw<Expression> make_const_bool_c459999a5f4d0050 ( Context * __context__, bool __value_rename_at_81, LineInfo const  &  __at_rename_at_81 )
+{
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<ExprConstBool>>::make(__context__,nullptr,(([&](ExprConstBool & __mks_82) {
+		das_copy((__mks_82.at /*at*/),(__at_rename_at_81));
+		das_copy((__mks_82.cvalue<bool>() /*value*/),(__value_rename_at_81));
+	})));
+}
+
+inline smart_ptr_raw<Expression> make_invoke_44253379c54fa6a8 ( Context * __context__, char * const  __fnName_rename_at_70, char * const  __argName_rename_at_70, LineInfo const  &  __at_rename_at_70 ) { das_stack_prologue __prologue(__context__,128,"make_invoke " DAS_FILE_LINE);
+{
+	smart_ptr_raw<ExprInvoke> __inv_rename_at_71; das_zero(__inv_rename_at_71); das_move(__inv_rename_at_71, das_ascend_handle<true,smart_ptr_raw<ExprInvoke>>::make(__context__,nullptr,(([&](ExprInvoke & __mks_71) {
+		das_copy((__mks_71.at /*at*/),(__at_rename_at_70));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_71.name /*name*/),((char *) "invoke"));
+		}	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__inv_rename_at_71->arguments /*arguments*/),make_var_a6a6672e3646a9d(__context__,__fnName_rename_at_70,__at_rename_at_70));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__inv_rename_at_71->arguments /*arguments*/),make_var_a6a6672e3646a9d(__context__,__argName_rename_at_70,__at_rename_at_70));
+	return /* <- */ __inv_rename_at_71;
+}}
+
+inline smart_ptr_raw<Expression> make_local_52a6d174f872d5b6 ( Context * __context__, char * const  __name_rename_at_93, smart_ptr_raw<TypeDecl> __typ_rename_at_93, LineInfo const  &  __at_rename_at_93 ) { das_stack_prologue __prologue(__context__,160,"make_local " DAS_FILE_LINE);
+{
+	smart_ptr_raw<ExprLet> __vlet_rename_at_94; das_zero(__vlet_rename_at_94); das_move(__vlet_rename_at_94, das_ascend_handle<true,smart_ptr_raw<ExprLet>>::make(__context__,nullptr,(([&](ExprLet & __mks_94) {
+		das_copy((__mks_94.at /*at*/),(__at_rename_at_93));
+		das_copy((__mks_94.atInit /*atInit*/),(__at_rename_at_93));
+	}))));
+	smart_ptr_raw<Variable> __v_rename_at_95; das_zero(__v_rename_at_95); das_move(__v_rename_at_95, das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_95) {
+		das_copy((__mks_95.at /*at*/),(__at_rename_at_93));
+		das_move((__mks_95.type /*_type*/),(__typ_rename_at_93));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_95.name /*name*/),__name_rename_at_93);
+		}	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Variable>>>::pass(__vlet_rename_at_94->variables /*variables*/),__v_rename_at_95);
+	return /* <- */ __vlet_rename_at_94;
+}}
+
+inline smart_ptr_raw<Expression> make_local_3ed3549f24019503 ( Context * __context__, char * const  __name_rename_at_85, smart_ptr_raw<TypeDecl> __typ_rename_at_85, smart_ptr_raw<Expression> __init_rename_at_85, LineInfo const  &  __at_rename_at_85 ) { das_stack_prologue __prologue(__context__,160,"make_local " DAS_FILE_LINE);
+{
+	smart_ptr_raw<ExprLet> __vlet_rename_at_86; das_zero(__vlet_rename_at_86); das_move(__vlet_rename_at_86, das_ascend_handle<true,smart_ptr_raw<ExprLet>>::make(__context__,nullptr,(([&](ExprLet & __mks_86) {
+		das_copy((__mks_86.at /*at*/),(__at_rename_at_85));
+		das_copy((__mks_86.atInit /*atInit*/),(__at_rename_at_85));
+	}))));
+	smart_ptr_raw<Variable> __v_rename_at_87; das_zero(__v_rename_at_87); das_move(__v_rename_at_87, das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_87) {
+		das_copy((__mks_87.at /*at*/),(__at_rename_at_85));
+		das_move((__mks_87.type /*_type*/),(__typ_rename_at_85));
+		das_move((__mks_87.init /*init*/),(__init_rename_at_85));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_87.name /*name*/),__name_rename_at_85);
+		}	}))));
+	__v_rename_at_87->flags /*flags*/ |= 0x1u;
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Variable>>>::pass(__vlet_rename_at_86->variables /*variables*/),__v_rename_at_87);
+	return /* <- */ __vlet_rename_at_86;
+}}
+
+inline smart_ptr_raw<Expression> make_return_d6f9ebf77f00a9bd ( Context * __context__, smart_ptr_raw<Expression> __value_rename_at_77, LineInfo const  &  __at_rename_at_77 )
+{
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<ExprReturn>>::make(__context__,nullptr,(([&](ExprReturn & __mks_78) {
+		das_copy((__mks_78.at /*at*/),(__at_rename_at_77));
+		das_move((__mks_78.subexpr /*subexpr*/),(__value_rename_at_77));
+	})));
+}
+
+inline smart_ptr_raw<Expression> make_var_a6a6672e3646a9d ( Context * __context__, char * const  __name_rename_at_66, LineInfo const  &  __at_rename_at_66 ) { das_stack_prologue __prologue(__context__,112,"make_var " DAS_FILE_LINE);
+{
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_67) {
+		das_copy((__mks_67.at /*at*/),(__at_rename_at_66));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_67.name /*name*/),__name_rename_at_66);
+		}	})));
+}}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_bd498ca8a1435ae4 ( Context * __context__, struct fuse::FuseMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline smart_ptr_raw<TypeDecl> value_type_a11dd57e6c271bd9 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __typ_rename_at_108 )
+{
+	smart_ptr<TypeDecl> __vtyp_rename_at_109; das_zero(__vtyp_rename_at_109); das_move(__vtyp_rename_at_109, clone_type(__typ_rename_at_108));
+	__vtyp_rename_at_109->flags /*flags*/ &= 0xfffffffeu;
+	__vtyp_rename_at_109->flags /*flags*/ &= 0xfffffffdu;
+	__vtyp_rename_at_109->flags /*flags*/ &= 0xfffffffbu;
+	return /* <- */ __vtyp_rename_at_109;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// FuseMacro_1c9dfe8ba85d3344
+		aotLib[0x43f787442d0e83ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct fuse::FuseMacro (*) ( Context * __context__ ),&FuseMacro_1c9dfe8ba85d3344>>();
+	};
+		// _FuncFuseMacro_0x27___finalize_204cc7c287e30475
+		aotLib[0x28392dc801670228] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct fuse::FuseMacro &  ),&_FuncFuseMacro_0x27___finalize_204cc7c287e30475>>();
+	};
+		// _FuncFuseMacro_0x60_visit_fb08c771808ec7b4
+		aotLib[0x474798b35b2f657d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct fuse::FuseMacro & , smart_ptr_raw<Program> const  , Module * const  , smart_ptr_raw<ExprCallMacro>  ),&_FuncFuseMacro_0x60_visit_fb08c771808ec7b4>>();
+	};
+		// __setup_macros_974b156c1a54025b
+		aotLib[0xb8614b28f0ecfe3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_974b156c1a54025b>>();
+	};
+		// argument_type_2a96a9dd201fa7a1
+		aotLib[0xedddf56c35576735] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TypeDecl> (*) ( Context * __context__, ExprCall * const  , int32_t  ),&argument_type_2a96a9dd201fa7a1>>();
+	};
+		// as_call_to_571e741e329202c2
+		aotLib[0x120743fe4d97afeb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<ExprCall * (*) ( Context * __context__, Expression * const  , char * const  , char * const  , int32_t  ),&as_call_to_571e741e329202c2>>();
+	};
+		// as_fusable_source_fe98ae3a584f29b6
+		aotLib[0x182538a89affef58] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<ExprCall * (*) ( Context * __context__, Expression * const   ),&as_fusable_source_fe98ae3a584f29b6>>();
+	};
+		// _Funcast_0x60_add_new_call_macro_c44a56d633ae7a2e
+		aotLib[0xea3b856a64366245] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct fuse::FuseMacro * const   ),&_Funcast_0x60_add_new_call_macro_c44a56d633ae7a2e>>();
+	};
+		// _Funcast_0x60_make_call_macro_8013b8fd29ac4e7
+		aotLib[0x609d8a8a5b017f0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<CallMacro> (*) ( Context * __context__, char * const  , struct fuse::FuseMacro * const   ),&_Funcast_0x60_make_call_macro_8013b8fd29ac4e7>>();
+	};
+		// auto_type_cb64a887d10ca5a
+		aotLib[0x84987eee8719552d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TypeDecl> (*) ( Context * __context__ ),&auto_type_cb64a887d10ca5a>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903
+		aotLib[0x190096f99e2fb7f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<ExprBlock * (*) ( Context * __context__, smart_ptr_raw<ExprBlock> const   ),&_Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_98dd15e167848d85
+		aotLib[0xfbfa2e866537498d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Expression * (*) ( Context * __context__, smart_ptr<Expression> const   ),&_Funcbuiltin_0x60_get_ptr_98dd15e167848d85>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_1d506cf3da127565
+		aotLib[0x4781158f1af7dcc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TypeDecl * (*) ( Context * __context__, smart_ptr<TypeDecl> const   ),&_Funcbuiltin_0x60_get_ptr_1d506cf3da127565>>();
+	};
+		// _Funcbuiltin_0x60_push_6d59097164ce32b8
+		aotLib[0x28d5a7f4ef848585] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<ExprCall *> & , ExprCall * const  , int32_t  ),&_Funcbuiltin_0x60_push_6d59097164ce32b8>>();
+	};
+		// finalize_5737f04367848459
+		aotLib[0x1ca108bab1551f85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct fuse::FuseMacro &  ),&finalize_5737f04367848459>>();
+	};
+		// generic_origin_5a03d0fef4da5bb2
+		aotLib[0xdd365db7e1cd769] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Function * (*) ( Context * __context__, Function * const   ),&generic_origin_5a03d0fef4da5bb2>>();
+	};
+		// make_const_bool_c459999a5f4d0050
+		aotLib[0x1481e6d3ec0e8265] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, bool , LineInfo const  &  ),&make_const_bool_c459999a5f4d0050>>();
+	};
+		// make_invoke_44253379c54fa6a8
+		aotLib[0xa727e76df7a71d33] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, char * const  , char * const  , LineInfo const  &  ),&make_invoke_44253379c54fa6a8>>();
+	};
+		// make_local_52a6d174f872d5b6
+		aotLib[0x730eaae52d3ec0dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, char * const  , smart_ptr_raw<TypeDecl> , LineInfo const  &  ),&make_local_52a6d174f872d5b6>>();
+	};
+		// make_local_3ed3549f24019503
+		aotLib[0x21bd7ef28a679979] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, char * const  , smart_ptr_raw<TypeDecl> , smart_ptr_raw<Expression> , LineInfo const  &  ),&make_local_3ed3549f24019503>>();
+	};
+		// make_return_d6f9ebf77f00a9bd
+		aotLib[0x698b559bb861bde1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, smart_ptr_raw<Expression> , LineInfo const  &  ),&make_return_d6f9ebf77f00a9bd>>();
+	};
+		// make_var_a6a6672e3646a9d
+		aotLib[0x6e55604f271d34e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, char * const  , LineInfo const  &  ),&make_var_a6a6672e3646a9d>>();
+	};
+		// _Funcrtti_0x60_class_info_bd498ca8a1435ae4
+		aotLib[0x19e9d22f645717e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct fuse::FuseMacro const  &  ),&_Funcrtti_0x60_class_info_bd498ca8a1435ae4>>();
+	};
+		// value_type_a11dd57e6c271bd9
+		aotLib[0x66d25f014e837fe5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TypeDecl> (*) ( Context * __context__, smart_ptr_raw<TypeDecl> const   ),&value_type_a11dd57e6c271bd9>>();
+	};
+		// [[ init script ]]
+		aotLib[0xbabeafa2ccc1e40a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1087 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require json
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__7dc9a8ce;
+extern StructInfo __struct_info__e3eb1776;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__e9ce9840;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__51dae110;
+extern TypeInfo __type_info__a0eb0f08;
+extern TypeInfo __type_info__199df2db;
+extern TypeInfo __type_info__7eca6aee;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__f55aa340;
+extern TypeInfo __type_info__91fcf360;
+extern TypeInfo __type_info__43f27e46;
+extern TypeInfo __type_info__84d9665d;
+extern TypeInfo __type_info__d9a3b228;
+extern TypeInfo __type_info__dca4ff17;
+extern TypeInfo __type_info__26ddbf28;
+extern TypeInfo __type_info__43c3f490;
+extern VarInfo __var_info__3254020f;
+extern VarInfo __var_info__2efd8643;
+extern VarInfo __var_info__84b636d4;
+extern VarInfo __var_info__bc989412;
+extern VarInfo __var_info__769cad3d;
+extern VarInfo __var_info__8218e600;
+extern VarInfo __var_info__12a4ab47;
+extern VarInfo __var_info__63c29275;
+extern VarInfo __var_info__f322a3a3;
+extern VarInfo __var_info__26f46599;
+
+TypeInfo * __type_info__f322a3a3_arg_types_var_2110367950[6] = { &__type_info__7eca6aee, &__type_info__84d9665d, &__type_info__17c16538, &__type_info__a0eb0f08, &__type_info__c894953d, &__type_info__dca4ff17 };
+const char * __type_info__f322a3a3_arg_names_var_2110367950[6] = { "_object", "_array", "_string", "_number", "_bool", "_null" };
+VarInfo __struct_info__7dc9a8ce_field_0 =  { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__f322a3a3_arg_types_var_2110367950, (char **)__type_info__f322a3a3_arg_names_var_2110367950, 6, 0, nullptr, 2, 0xf322a3a3, "value", 0 };
+VarInfo * __struct_info__7dc9a8ce_fields[1] =  { &__struct_info__7dc9a8ce_field_0 };
+StructInfo __struct_info__7dc9a8ce = {"JsonValue", __struct_info__7dc9a8ce_fields, 1, 56, -1, nullptr, 0x7dc9a8ce };
+TypeInfo * __type_info__2efd8643_arg_types_var_3823834998[2] = { &__type_info__26ddbf28, &__type_info__43f27e46 };
+VarInfo __struct_info__e3eb1776_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__2efd8643_arg_types_var_3823834998, nullptr, 2, 0, nullptr, 28, 0x2efd8643, "__lambda", 0 };
+TypeInfo * __type_info__bc989412_arg_types_var_3823834998[1] = { &__type_info__43c3f490 };
+VarInfo __struct_info__e3eb1776_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bc989412_arg_types_var_3823834998, nullptr, 1, 0, nullptr, 28, 0xbc989412, "__finalize", 4 };
+VarInfo __struct_info__e3eb1776_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x26f46599, "__yield", 8 };
+VarInfo __struct_info__e3eb1776_field_3 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x84b636d4, "stext", 16 };
+VarInfo __struct_info__e3eb1776_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x769cad3d, "tin", 24 };
+VarInfo __struct_info__e3eb1776_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x12a4ab47, "ahead", 32 };
+VarInfo __struct_info__e3eb1776_field_6 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x63c29275, "str", 40 };
+VarInfo __struct_info__e3eb1776_field_7 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x3254020f, "__num_rename_at_115", 64 };
+VarInfo __struct_info__e3eb1776_field_8 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x8218e600, "__name_rename_at_124", 72 };
+VarInfo * __struct_info__e3eb1776_fields[9] =  { &__struct_info__e3eb1776_field_0, &__struct_info__e3eb1776_field_1, &__struct_info__e3eb1776_field_2, &__struct_info__e3eb1776_field_3, &__struct_info__e3eb1776_field_4, &__struct_info__e3eb1776_field_5, &__struct_info__e3eb1776_field_6, &__struct_info__e3eb1776_field_7, &__struct_info__e3eb1776_field_8 };
+StructInfo __struct_info__e3eb1776 = {"_lambda_json_68_8_1", __struct_info__e3eb1776_fields, 9, 80, -1, nullptr, 0xe3eb1776 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x13667ab1 };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__e9ce9840 = { Type::tStructure, &__struct_info__7dc9a8ce, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe9ce9840 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo * __type_info__51dae110_arg_types[6] = { &__type_info__17c16538, &__type_info__a0eb0f08, &__type_info__c894953d, &__type_info__dca4ff17, &__type_info__95e97e5e, &__type_info__17c16538 };
+const char * __type_info__51dae110_arg_names[6] = { "_string", "_number", "_bool", "_null", "_symbol", "_error" };
+TypeInfo __type_info__51dae110 = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__51dae110_arg_types, (char **)__type_info__51dae110_arg_names, 6, 0, nullptr, 262, 0x51dae110 };
+TypeInfo __type_info__a0eb0f08 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa0eb0f08 };
+TypeInfo __type_info__199df2db = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x199df2db };
+TypeInfo __type_info__7eca6aee = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__17c16538, &__type_info__d9a3b228, nullptr, nullptr, 0, 0, nullptr, 2, 0x7eca6aee };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__f55aa340 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xf55aa340 };
+TypeInfo __type_info__91fcf360 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e9ce9840, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x91fcf360 };
+TypeInfo * __type_info__43f27e46_arg_types[6] = { &__type_info__17c16538, &__type_info__a0eb0f08, &__type_info__c894953d, &__type_info__dca4ff17, &__type_info__95e97e5e, &__type_info__17c16538 };
+const char * __type_info__43f27e46_arg_names[6] = { "_string", "_number", "_bool", "_null", "_symbol", "_error" };
+TypeInfo __type_info__43f27e46 = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__43f27e46_arg_types, (char **)__type_info__43f27e46_arg_names, 6, 0, nullptr, 6, 0x43f27e46 };
+TypeInfo __type_info__84d9665d = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__d9a3b228, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x84d9665d };
+TypeInfo __type_info__d9a3b228 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e9ce9840, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd9a3b228 };
+TypeInfo __type_info__dca4ff17 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xdca4ff17 };
+TypeInfo __type_info__26ddbf28 = { Type::tStructure, &__struct_info__e3eb1776, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x26ddbf28 };
+TypeInfo __type_info__43c3f490 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__26ddbf28, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x43c3f490 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_1[4] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__95e97e5e };
+TypeInfo * __tinfo_2[3] = { &__type_info__3ffbf730, &__type_info__43f27e46, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[6] = { &__type_info__3ffbf730, &__type_info__43f27e46, &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_4[4] = { &__type_info__3ffbf730, &__type_info__43f27e46, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_5[4] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_6[2] = { &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_7[4] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_8[4] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_9[1] = { &__type_info__51dae110 };
+TypeInfo * __tinfo_10[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_11[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_12[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_13[2] = { &__type_info__f7fba288, &__type_info__f55aa340 };
+TypeInfo * __tinfo_14[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_15[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_16[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_17[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_18[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_19[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_20[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_21[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_22[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_23[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_24[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_25[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_26[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_27[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_28[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_29[2] = { &__type_info__3ffbf730, &__type_info__91fcf360 };
+namespace json {
+
+struct JsonValue {
+	TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> value;
+};
+static_assert(sizeof(JsonValue)==56,"structure size mismatch with DAS");
+static_assert(offsetof(JsonValue,value)==0,"structure field offset mismatch with DAS");
+}
+namespace json {
+
+struct _lambda_json_68_8_1 {
+	Func DAS_COMMENT((bool,struct json::_lambda_json_68_8_1,TVariant<16,char *,double,bool,void *,int32_t,char *>)) __lambda;
+	Func DAS_COMMENT((void,struct json::_lambda_json_68_8_1 *)) __finalize;
+	int32_t __yield;
+	char * stext;
+	Sequence DAS_COMMENT((int32_t)) tin;
+	int32_t ahead;
+	TArray<uint8_t> str;
+	char * __num_rename_at_115;
+	char * __name_rename_at_124;
+};
+static_assert(sizeof(_lambda_json_68_8_1)==80,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_json_68_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_68_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_68_8_1,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_68_8_1,stext)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_68_8_1,tin)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_68_8_1,ahead)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_68_8_1,str)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_68_8_1,__num_rename_at_115)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_68_8_1,__name_rename_at_124)==72,"structure field offset mismatch with DAS");
+}
+
+inline struct json::JsonValue * JV_1bd1533d077539f5 ( Context * __context__, TArray<struct json::JsonValue *> & __v_rename_at_52 );
+inline struct json::JsonValue * JV_87a6e48448fb8a26 ( Context * __context__, void * const  __v_rename_at_43 );
+inline struct json::JsonValue * JV_7acb934dc0bb083f ( Context * __context__, TTable<char *,struct json::JsonValue *> & __v_rename_at_48 );
+inline struct json::JsonValue * JV_e6bb56ded5795e0f ( Context * __context__, bool __v_rename_at_39 );
+inline struct json::JsonValue * JV_6d9038db36a7e729 ( Context * __context__, double __v_rename_at_35 );
+inline struct json::JsonValue * JV_1689f68d6126776a ( Context * __context__, char * const  __v_rename_at_31 );
+inline void _Func_lambda_json_68_8_1_0x60_finazlier_8a468fd20060d838 ( Context * __context__, struct json::_lambda_json_68_8_1 * ____this_rename_at_68 );
+inline bool _Func_lambda_json_68_8_1_0x60_function_7d279d8cc3e53221 ( Context * __context__, struct json::_lambda_json_68_8_1 & ____this_rename_at_68, TVariant<16,char *,double,bool,void *,int32_t,char *> & ___yield_68_rename_at_68 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _lexer_a11dd07734379e03 ( Context * __context__, char * __stext_rename_at_66 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _Funcbuiltin_0x60_each_a48785efffc6d2c1 ( Context * __context__, Lambda DAS_COMMENT((bool,TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  __lam_rename_at_358 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_3bd22e87ecbdcf79 ( Context * __context__, char * const  __str_rename_at_339 );
+inline void _Funcbuiltin_0x60_finalize_7f972184337f6d1a ( Context * __context__, TArray<uint8_t> & __a_rename_at_285 );
+inline bool _Funcbuiltin_0x60_key_exists_cf25dd2b3c15ad2 ( Context * __context__, TTable<char *,struct json::JsonValue *> const  & __Tab_rename_at_183, char * const  __at_rename_at_183 );
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_98634c9938f02164 ( Context * __context__, TTable<char *,struct json::JsonValue *> const  & __a_rename_at_262 );
+inline bool _Funcbuiltin_0x60_next_111e5cd76980442a ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  & __it_rename_at_317, TVariant<16,char *,double,bool,void *,int32_t,char *> & __value_rename_at_317 );
+inline bool _Funcbuiltin_0x60_next_6a3c01874ce3fb9a ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_317, int32_t & __value_rename_at_317 );
+inline void _Funcbuiltin_0x60_push_2d6f6dfd3be4b074 ( Context * __context__, TArray<struct json::JsonValue *> & __Arr_rename_at_40, struct json::JsonValue * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_6f903bf56272d4e7 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_40, uint8_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline Sequence DAS_COMMENT((struct json::JsonValue * const  &)) _Funcbuiltin_0x60_values_b9b57686fce4f7f2 ( Context * __context__, TTable<char *,struct json::JsonValue *> const  & __a_rename_at_267 );
+inline bool expect_symbol_ac8a476e07de4192 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & __itv_rename_at_156, TVariant<16,char *,double,bool,void *,int32_t,char *> & __ahead_rename_at_156, int32_t __sym_rename_at_156, char * & __error_rename_at_156 );
+inline bool expect_token_16a77edcf4fe8f9f ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & __itv_rename_at_145, TVariant<16,char *,double,bool,void *,int32_t,char *> & __ahead_rename_at_145, int32_t __vindex_rename_at_145, char * & __error_rename_at_145 );
+inline void finalize_866c8989814fc71a ( Context * __context__, struct json::_lambda_json_68_8_1 & ____this_rename_at_68 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_1b6a42e4fd4f19da ( Context * __context__, TArray<uint8_t> const  & __text_rename_at_61 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_d53a265dae84c9c4 ( Context * __context__, char * const  __text_rename_at_56 );
+inline struct json::JsonValue * parse_value_163d2ed847ff74b7 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & __itv_rename_at_170, char * & __error_rename_at_170 );
+inline struct json::JsonValue * read_json_a9053849881165a9 ( Context * __context__, TArray<uint8_t> const  & __text_rename_at_254, char * & __error_rename_at_254 );
+inline struct json::JsonValue * read_json_82a8bbdc763ffa95 ( Context * __context__, char * const  __text_rename_at_247, char * & __error_rename_at_247 );
+inline char * write_json_6a56a768556e92eb ( Context * __context__, struct json::JsonValue * const  __val_rename_at_316 );
+inline void write_value_dfc1d0230610221b ( Context * __context__, StringBuilderWriter & __writer_rename_at_261, struct json::JsonValue * const  __jsv_rename_at_261, int32_t __depth_rename_at_261 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline struct json::JsonValue * JV_1bd1533d077539f5 ( Context * __context__, TArray<struct json::JsonValue *> &  __v_rename_at_52 )
+{
+	return das_ascend<struct json::JsonValue,struct json::JsonValue>::make(__context__,nullptr,(([&]() -> struct json::JsonValue {
+		struct json::JsonValue __mks_53;
+		das_zero(__mks_53);
+		das_move((__mks_53.value),((([&]() -> TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> __mkv_53;
+			das_get_variant_field<TArray<struct json::JsonValue *>,8,1>::set(__mkv_53) = __v_rename_at_52;
+			return __mkv_53;
+		})())));
+		return __mks_53;
+	})()));
+}
+
+inline struct json::JsonValue * JV_87a6e48448fb8a26 ( Context * __context__, void * const  __v_rename_at_43 )
+{
+	DAS_ASSERTF((__v_rename_at_43 == nullptr),(((char *) "only null allowed")));
+	return das_ascend<struct json::JsonValue,struct json::JsonValue>::make(__context__,nullptr,(([&]() -> struct json::JsonValue {
+		struct json::JsonValue __mks_45;
+		das_zero(__mks_45);
+		das_move((__mks_45.value),((([&]() -> TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> __mkv_45;
+			das_get_variant_field<void *,8,5>::set(__mkv_45) = __v_rename_at_43;
+			return __mkv_45;
+		})())));
+		return __mks_45;
+	})()));
+}
+
+inline struct json::JsonValue * JV_7acb934dc0bb083f ( Context * __context__, TTable<char *,struct json::JsonValue *> &  __v_rename_at_48 )
+{
+	return das_ascend<struct json::JsonValue,struct json::JsonValue>::make(__context__,nullptr,(([&]() -> struct json::JsonValue {
+		struct json::JsonValue __mks_49;
+		das_zero(__mks_49);
+		das_move((__mks_49.value),((([&]() -> TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> __mkv_49;
+			das_get_variant_field<TTable<char *,struct json::JsonValue *>,8,0>::set(__mkv_49) = __v_rename_at_48;
+			return __mkv_49;
+		})())));
+		return __mks_49;
+	})()));
+}
+
+inline struct json::JsonValue * JV_e6bb56ded5795e0f ( Context * __context__, bool __v_rename_at_39 )
+{
+	return das_ascend<struct json::JsonValue,struct json::JsonValue>::make(__context__,nullptr,(([&]() -> struct json::JsonValue {
+		struct json::JsonValue __mks_40;
+		das_zero(__mks_40);
+		das_move((__mks_40.value),((([&]() -> TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> __mkv_40;
+			das_get_variant_field<bool,8,4>::set(__mkv_40) = __v_rename_at_39;
+			return __mkv_40;
+		})())));
+		return __mks_40;
+	})()));
+}
+
+inline struct json::JsonValue * JV_6d9038db36a7e729 ( Context * __context__, double __v_rename_at_35 )
+{
+	return das_ascend<struct json::JsonValue,struct json::JsonValue>::make(__context__,nullptr,(([&]() -> struct json::JsonValue {
+		struct json::JsonValue __mks_36;
+		das_zero(__mks_36);
+		das_move((__mks_36.value),((([&]() -> TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> __mkv_36;
+			das_get_variant_field<double,8,3>::set(__mkv_36) = __v_rename_at_35;
+			return __mkv_36;
+		})())));
+		return __mks_36;
+	})()));
+}
+
+inline struct json::JsonValue * JV_1689f68d6126776a ( Context * __context__, char * const  __v_rename_at_31 )
+{
+	return das_ascend<struct json::JsonValue,struct json::JsonValue>::make(__context__,nullptr,(([&]() -> struct json::JsonValue {
+		struct json::JsonValue __mks_32;
+		das_zero(__mks_32);
+		das_move((__mks_32.value),((([&]() -> TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,struct json::JsonValue *>,TArray<struct json::JsonValue *>,char *,double,bool,void *> __mkv_32;
+			das_get_variant_field<char *,8,2>::set(__mkv_32) = __v_rename_at_31;
+			return __mkv_32;
+		})())));
+		return __mks_32;
+	})()));
+}
+
+inline void _Func_lambda_json_68_8_1_0x60_finazlier_8a468fd20060d838 ( Context * __context__, struct json::_lambda_json_68_8_1 * ____this_rename_at_68 )
+{
+	delete_string(das_deref(__context__,____this_rename_at_68).stext,__context__);
+	finalize_866c8989814fc71a(__context__,das_arg<struct json::_lambda_json_68_8_1>::pass(das_deref(__context__,____this_rename_at_68)));
+	das_delete_lambda_struct<struct json::_lambda_json_68_8_1 *>::clear(__context__,____this_rename_at_68);
+}
+
+inline bool _Func_lambda_json_68_8_1_0x60_function_7d279d8cc3e53221 ( Context * __context__, struct json::_lambda_json_68_8_1 &  ____this_rename_at_68, TVariant<16,char *,double,bool,void *,int32_t,char *> &  ___yield_68_rename_at_68 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_70_32;
+	switch (____this_rename_at_68.__yield) {
+	case 0: goto label_0;
+	case 32: goto label_32;
+	case 1: goto label_1;
+	case 30: goto label_30;
+	case 7: goto label_7;
+	case 3: goto label_3;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	case 6: goto label_6;
+	case 8: goto label_8;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 11: goto label_11;
+	case 28: goto label_28;
+	case 12: goto label_12;
+	case 26: goto label_26;
+	case 13: goto label_13;
+	case 21: goto label_21;
+	case 14: goto label_14;
+	case 19: goto label_19;
+	case 15: goto label_15;
+	case 17: goto label_17;
+	case 16: goto label_16;
+	case 18: goto label_18;
+	case 20: goto label_20;
+	case 22: goto label_22;
+	case 24: goto label_24;
+	case 23: goto label_23;
+	case 25: goto label_25;
+	case 27: goto label_27;
+	case 29: goto label_29;
+	case 31: goto label_31;
+	case 33: goto label_33;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_68.tin), 0, 8);
+	das_move(____this_rename_at_68.tin,(_temp_make_local_70_32 = (_Funcbuiltin_0x60_each_3bd22e87ecbdcf79(__context__,____this_rename_at_68.stext))));
+	das_copy(____this_rename_at_68.ahead,32);
+	memset(&(____this_rename_at_68.str), 0, 24);
+	label_32:;;
+	if ( !!(builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin))) )
+	{
+		goto label_33;
+	};
+	while ( is_white_space(____this_rename_at_68.ahead) && _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin),____this_rename_at_68.ahead) )
+	{
+	};
+	if ( builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin)) )
+	{
+		return false;
+	};
+	if ( !((((((____this_rename_at_68.ahead == 91) || (____this_rename_at_68.ahead == 93)) || (____this_rename_at_68.ahead == 123)) || (____this_rename_at_68.ahead == 125)) || (____this_rename_at_68.ahead == 58)) || (____this_rename_at_68.ahead == 44)) )
+	{
+		goto label_30;
+	};
+	das_copy(___yield_68_rename_at_68,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_79;
+		das_get_variant_field<int32_t,8,4>::set(__mkv_79) = ____this_rename_at_68.ahead;
+		return __mkv_79;
+	})()));
+	das_copy(____this_rename_at_68.__yield,1);
+	return true;
+	label_1:;;
+	_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin),____this_rename_at_68.ahead);
+	goto label_31;
+	label_30:;;
+	if ( !(____this_rename_at_68.ahead == 34) )
+	{
+		goto label_28;
+	};
+	label_7:;;
+	if ( !(_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin),____this_rename_at_68.ahead) && (____this_rename_at_68.ahead != 34)) )
+	{
+		goto label_8;
+	};
+	if ( !(____this_rename_at_68.ahead == 92) )
+	{
+		goto label_5;
+	};
+	if ( !_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin),____this_rename_at_68.ahead) )
+	{
+		goto label_3;
+	};
+	if ( ____this_rename_at_68.ahead == 98 )
+	{
+		das_copy(____this_rename_at_68.ahead,8);
+	} else if ( ____this_rename_at_68.ahead == 102 )
+	{
+		das_copy(____this_rename_at_68.ahead,12);
+	} else if ( ____this_rename_at_68.ahead == 110 )
+	{
+		das_copy(____this_rename_at_68.ahead,10);
+	} else if ( ____this_rename_at_68.ahead == 114 )
+	{
+		das_copy(____this_rename_at_68.ahead,13);
+	} else if ( ____this_rename_at_68.ahead == 116 )
+	{
+		das_copy(____this_rename_at_68.ahead,9);
+	};
+	_Funcbuiltin_0x60_push_6f903bf56272d4e7(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),uint8_t(____this_rename_at_68.ahead),-1);
+	goto label_4;
+	label_3:;;
+	das_copy(___yield_68_rename_at_68,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_97;
+		das_get_variant_field<char *,8,5>::set(__mkv_97) = ((char *) "string escape sequence exceeds text");
+		return __mkv_97;
+	})()));
+	das_copy(____this_rename_at_68.__yield,2);
+	return true;
+	label_2:;;
+	return false;
+	label_4:;;
+	goto label_6;
+	label_5:;;
+	_Funcbuiltin_0x60_push_6f903bf56272d4e7(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),uint8_t(____this_rename_at_68.ahead),-1);
+	label_6:;;
+	goto label_7;
+	label_8:;;
+	if ( !builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin)) )
+	{
+		goto label_10;
+	};
+	das_copy(___yield_68_rename_at_68,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_102;
+		das_get_variant_field<char *,8,5>::set(__mkv_102) = ((char *) "string exceeds text");
+		return __mkv_102;
+	})()));
+	das_copy(____this_rename_at_68.__yield,9);
+	return true;
+	label_9:;;
+	return false;
+	label_10:;;
+	das_copy(___yield_68_rename_at_68,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_104;
+		das_get_variant_field<char *,8,0>::set(__mkv_104) = ((char *)(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),__context__)));
+		return __mkv_104;
+	})()));
+	das_copy(____this_rename_at_68.__yield,11);
+	return true;
+	label_11:;;
+	builtin_array_clear(das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),__context__);
+	_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin),____this_rename_at_68.ahead);
+	goto label_29;
+	label_28:;;
+	if ( !(((____this_rename_at_68.ahead == 43) || (____this_rename_at_68.ahead == 45)) || is_number(____this_rename_at_68.ahead)) )
+	{
+		goto label_26;
+	};
+	_Funcbuiltin_0x60_push_6f903bf56272d4e7(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),uint8_t(____this_rename_at_68.ahead),-1);
+	while ( _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin),____this_rename_at_68.ahead) && is_number(____this_rename_at_68.ahead) )
+	{
+		_Funcbuiltin_0x60_push_6f903bf56272d4e7(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),uint8_t(____this_rename_at_68.ahead),-1);
+	};
+	if ( !(builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin))) && (____this_rename_at_68.ahead == 46) )
+	{
+		_Funcbuiltin_0x60_push_6f903bf56272d4e7(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),uint8_t(____this_rename_at_68.ahead),-1);
+		while ( _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin),____this_rename_at_68.ahead) && is_number(____this_rename_at_68.ahead) )
+		{
+			_Funcbuiltin_0x60_push_6f903bf56272d4e7(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),uint8_t(____this_rename_at_68.ahead),-1);
+		};
+	};
+	das_copy(____this_rename_at_68.__num_rename_at_115,((char *)(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),__context__))));
+	das_copy(___yield_68_rename_at_68,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_116;
+		das_get_variant_field<double,8,1>::set(__mkv_116) = string_to_double(____this_rename_at_68.__num_rename_at_115,__context__);
+		return __mkv_116;
+	})()));
+	das_copy(____this_rename_at_68.__yield,12);
+	return true;
+	label_12:;;
+	builtin_array_clear(das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),__context__);
+	delete_string(____this_rename_at_68.__num_rename_at_115,__context__);
+	goto label_27;
+	label_26:;;
+	if ( !is_alpha(____this_rename_at_68.ahead) )
+	{
+		goto label_24;
+	};
+	_Funcbuiltin_0x60_push_6f903bf56272d4e7(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),uint8_t(____this_rename_at_68.ahead),-1);
+	while ( _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin),____this_rename_at_68.ahead) && is_alpha(____this_rename_at_68.ahead) )
+	{
+		_Funcbuiltin_0x60_push_6f903bf56272d4e7(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),uint8_t(____this_rename_at_68.ahead),-1);
+	};
+	das_copy(____this_rename_at_68.__name_rename_at_124,((char *)(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),__context__))));
+	if ( !(SimPolicy<char *>::Equ(cast<char *>::from(____this_rename_at_68.__name_rename_at_124),cast<char *>::from(((char *) "true")),*__context__)) )
+	{
+		goto label_21;
+	};
+	das_copy(___yield_68_rename_at_68,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_126;
+		das_get_variant_field<bool,8,2>::set(__mkv_126) = true;
+		return __mkv_126;
+	})()));
+	das_copy(____this_rename_at_68.__yield,13);
+	return true;
+	label_13:;;
+	goto label_22;
+	label_21:;;
+	if ( !(SimPolicy<char *>::Equ(cast<char *>::from(____this_rename_at_68.__name_rename_at_124),cast<char *>::from(((char *) "false")),*__context__)) )
+	{
+		goto label_19;
+	};
+	das_copy(___yield_68_rename_at_68,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_128;
+		das_get_variant_field<bool,8,2>::set(__mkv_128) = false;
+		return __mkv_128;
+	})()));
+	das_copy(____this_rename_at_68.__yield,14);
+	return true;
+	label_14:;;
+	goto label_20;
+	label_19:;;
+	if ( !(SimPolicy<char *>::Equ(cast<char *>::from(____this_rename_at_68.__name_rename_at_124),cast<char *>::from(((char *) "null")),*__context__)) )
+	{
+		goto label_17;
+	};
+	das_copy(___yield_68_rename_at_68,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_130;
+		das_get_variant_field<void *,8,3>::set(__mkv_130) = nullptr;
+		return __mkv_130;
+	})()));
+	das_copy(____this_rename_at_68.__yield,15);
+	return true;
+	label_15:;;
+	goto label_18;
+	label_17:;;
+	das_copy(___yield_68_rename_at_68,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_132;
+		das_get_variant_field<char *,8,5>::set(__mkv_132) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "invalid name ")), cast<char *>::from(____this_rename_at_68.__name_rename_at_124)));
+		return __mkv_132;
+	})()));
+	das_copy(____this_rename_at_68.__yield,16);
+	return true;
+	label_16:;;
+	return false;
+	label_18:;;
+	label_20:;;
+	label_22:;;
+	delete_string(____this_rename_at_68.__name_rename_at_124,__context__);
+	builtin_array_clear(das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str),__context__);
+	goto label_25;
+	label_24:;;
+	das_copy(___yield_68_rename_at_68,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_138;
+		das_get_variant_field<char *,8,5>::set(__mkv_138) = das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_1, cast<char * const >::from(((char *) "invalid character `")), cast<char *>::from(((char *)(to_string_char(____this_rename_at_68.ahead,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(____this_rename_at_68.ahead)));
+		return __mkv_138;
+	})()));
+	das_copy(____this_rename_at_68.__yield,23);
+	return true;
+	label_23:;;
+	return false;
+	label_25:;;
+	label_27:;;
+	label_29:;;
+	label_31:;;
+	goto label_32;
+	label_33:;;
+	return false;
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _lexer_a11dd07734379e03 ( Context * __context__, char * __stext_rename_at_66 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_a48785efffc6d2c1(__context__,das_ascend<bool,struct json::_lambda_json_68_8_1>::make(__context__,&__type_info__26ddbf28,(([&]() -> struct json::_lambda_json_68_8_1 {
+		struct json::_lambda_json_68_8_1 __mks_67;
+		das_zero(__mks_67);
+		das_copy((__mks_67.__lambda),(Func(__context__->fnIdxByMangledName(/*@json::_lambda_json_68_8_1`function _lambda_json_68_8_1 #variant#string#double#bool##ptr#void#int#string#`_string#`_number#`_bool#`_null#`_symbol#`_error*/ 2017067818u))));
+		das_copy((__mks_67.__finalize),(Func(__context__->fnIdxByMangledName(/*@json::_lambda_json_68_8_1`finazlier #ptr#_lambda_json_68_8_1#explicit*/ 2985460220u))));
+		das_copy((__mks_67.stext),(__stext_rename_at_66));
+		return __mks_67;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _Funcbuiltin_0x60_each_a48785efffc6d2c1 ( Context * __context__, Lambda DAS_COMMENT((bool,TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_3bd22e87ecbdcf79 ( Context * __context__, char * const  __str_rename_at_339 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_340; das_zero(__it_rename_at_340);
+	builtin_make_string_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_340),__str_rename_at_339,__context__);
+	return /* <- */ __it_rename_at_340;
+}
+
+inline void _Funcbuiltin_0x60_finalize_7f972184337f6d1a ( Context * __context__, TArray<uint8_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<uint8_t>>::pass(__a_rename_at_285),1,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_cf25dd2b3c15ad2 ( Context * __context__, TTable<char *,struct json::JsonValue *> const  &  __Tab_rename_at_183, char * const  __at_rename_at_183 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_183,__at_rename_at_183);
+}
+
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_98634c9938f02164 ( Context * __context__, TTable<char *,struct json::JsonValue *> const  &  __a_rename_at_262 )
+{
+	Sequence DAS_COMMENT((char * *)) __it_rename_at_263; das_zero(__it_rename_at_263);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((char * const ))>::pass(__it_rename_at_263),__a_rename_at_262,8,__context__);
+	return /* <- */ __it_rename_at_263;
+}
+
+inline bool _Funcbuiltin_0x60_next_111e5cd76980442a ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  &  __it_rename_at_317, TVariant<16,char *,double,bool,void *,int32_t,char *> &  __value_rename_at_317 )
+{
+	return builtin_iterator_iterate(__it_rename_at_317,das_ref(__context__,__value_rename_at_317),__context__);
+}
+
+inline bool _Funcbuiltin_0x60_next_6a3c01874ce3fb9a ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_317, int32_t & __value_rename_at_317 )
+{
+	return builtin_iterator_iterate(__it_rename_at_317,das_ref(__context__,__value_rename_at_317),__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_2d6f6dfd3be4b074 ( Context * __context__, TArray<struct json::JsonValue *> &  __Arr_rename_at_40, struct json::JsonValue * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<struct json::JsonValue *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_6f903bf56272d4e7 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_40, uint8_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,1,__context__),__context__),__value_rename_at_40);
+}
+
+inline Sequence DAS_COMMENT((struct json::JsonValue * const  &)) _Funcbuiltin_0x60_values_b9b57686fce4f7f2 ( Context * __context__, TTable<char *,struct json::JsonValue *> const  &  __a_rename_at_267 )
+{
+	Sequence DAS_COMMENT((struct json::JsonValue * *)) __it_rename_at_268; das_zero(__it_rename_at_268);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((struct json::JsonValue * const ))>::pass(__it_rename_at_268),__a_rename_at_267,8,__context__);
+	return /* <- */ __it_rename_at_268;
+}
+
+inline bool expect_symbol_ac8a476e07de4192 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) &  __itv_rename_at_156, TVariant<16,char *,double,bool,void *,int32_t,char *> &  __ahead_rename_at_156, int32_t __sym_rename_at_156, char * & __error_rename_at_156 )
+{
+	if ( !_Funcbuiltin_0x60_next_111e5cd76980442a(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_156),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_156)) )
+	{
+		das_copy(__error_rename_at_156,((char *) "unexected eos"));
+		return false;
+	} else if ( !das_get_variant_field<int32_t,8,4>::is(__ahead_rename_at_156) )
+	{
+		das_copy(__error_rename_at_156,das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_2, cast<char * const >::from(((char *) "unexpected ")), cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_156), cast<char * const >::from(((char *) ", expecting symbol")))));
+		return false;
+	} else if ( !(das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_156,__context__) == __sym_rename_at_156) )
+	{
+		das_copy(__error_rename_at_156,das_string_builder(__context__,SimNode_AotInterop<6>(__tinfo_3, cast<char * const >::from(((char *) "unexpected ")), cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_156), cast<char * const >::from(((char *) ", expecting symbol `")), cast<char *>::from(((char *)(to_string_char(__sym_rename_at_156,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sym_rename_at_156))));
+		return true;
+	} else {
+		return true;
+	};
+}
+
+inline bool expect_token_16a77edcf4fe8f9f ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) &  __itv_rename_at_145, TVariant<16,char *,double,bool,void *,int32_t,char *> &  __ahead_rename_at_145, int32_t __vindex_rename_at_145, char * & __error_rename_at_145 )
+{
+	if ( !_Funcbuiltin_0x60_next_111e5cd76980442a(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_145),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_145)) )
+	{
+		das_copy(__error_rename_at_145,((char *) "unexected eos"));
+		return false;
+	} else if ( variant_index(das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_145)) != __vindex_rename_at_145 )
+	{
+		das_copy(__error_rename_at_145,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_4, cast<char * const >::from(((char *) "unexpected ")), cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_145), cast<char * const >::from(((char *) ", expecting variant ")), cast<int32_t>::from(__vindex_rename_at_145))));
+		return false;
+	} else {
+		return true;
+	};
+}
+
+inline void finalize_866c8989814fc71a ( Context * __context__, struct json::_lambda_json_68_8_1 &  ____this_rename_at_68 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_68.tin),__context__);
+	_Funcbuiltin_0x60_finalize_7f972184337f6d1a(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_68.str));
+	memset(&(____this_rename_at_68), 0, 80);
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_1b6a42e4fd4f19da ( Context * __context__, TArray<uint8_t> const  &  __text_rename_at_61 )
+{
+	char * __stext_rename_at_62 = (char *)(((char *)(builtin_string_from_array(__text_rename_at_61,__context__))));
+	return /* <- */ _lexer_a11dd07734379e03(__context__,__stext_rename_at_62);
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_d53a265dae84c9c4 ( Context * __context__, char * const  __text_rename_at_56 )
+{
+	char * __stext_rename_at_57 = (char *)(((char *)(builtin_string_clone(__text_rename_at_56,__context__))));
+	return /* <- */ _lexer_a11dd07734379e03(__context__,__stext_rename_at_57);
+}
+
+inline struct json::JsonValue * parse_value_163d2ed847ff74b7 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) &  __itv_rename_at_170, char * & __error_rename_at_170 )
+{
+	TVariant<16,char *,double,bool,void *,int32_t,char *> __ahead_rename_at_171; das_zero(__ahead_rename_at_171);
+	if ( !_Funcbuiltin_0x60_next_111e5cd76980442a(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_171)) )
+	{
+		return nullptr;
+	} else {
+		if ( das_get_variant_field<int32_t,8,4>::is(__ahead_rename_at_171) )
+		{
+			int32_t __sym_rename_at_175 = (int32_t)das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_171,__context__);
+			if ( __sym_rename_at_175 == 93 )
+			{
+				das_copy(__error_rename_at_170,((char *) "unexpected ]"));
+				return nullptr;
+			} else {
+				if ( __sym_rename_at_175 == 91 )
+				{
+					TArray<struct json::JsonValue *> __arr_rename_at_180; das_zero(__arr_rename_at_180);
+					while ( !builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170)) )
+					{
+						struct json::JsonValue * __value_rename_at_182 = parse_value_163d2ed847ff74b7(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170),__error_rename_at_170);
+						if ( __value_rename_at_182 == nullptr )
+						{
+							if ( (SimPolicy<char *>::Equ(cast<char *>::from(__error_rename_at_170),cast<char *>::from(((char *) "unexpected ]")),*__context__)) && (builtin_array_size(das_arg<TArray<struct json::JsonValue *>>::pass(__arr_rename_at_180)) == 0) )
+							{
+								das_copy(__error_rename_at_170,((char *) ""));
+								return JV_1bd1533d077539f5(__context__,das_arg<TArray<struct json::JsonValue *>>::pass(__arr_rename_at_180));
+							} else {
+								return nullptr;
+							};
+						};
+						_Funcbuiltin_0x60_push_2d6f6dfd3be4b074(__context__,das_arg<TArray<struct json::JsonValue *>>::pass(__arr_rename_at_180),__value_rename_at_182,-1);
+						if ( !expect_token_16a77edcf4fe8f9f(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_171),4,__error_rename_at_170) )
+						{
+							return nullptr;
+						} else {
+							int32_t __sepsym_rename_at_191 = (int32_t)das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_171,__context__);
+							if ( __sepsym_rename_at_191 == 93 )
+							{
+								break;
+							} else if ( __sepsym_rename_at_191 != 44 )
+							{
+								das_copy(__error_rename_at_170,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_5, cast<char * const >::from(((char *) "unsepected array seaprator symbol `")), cast<char *>::from(((char *)(to_string_char(__sepsym_rename_at_191,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sepsym_rename_at_191))));
+								return nullptr;
+							};
+						};
+					};
+					if ( builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170)) )
+					{
+						das_copy(__error_rename_at_170,((char *) "unexpected eos"));
+						return nullptr;
+					} else {
+						return JV_1bd1533d077539f5(__context__,das_arg<TArray<struct json::JsonValue *>>::pass(__arr_rename_at_180));
+					};
+				} else if ( __sym_rename_at_175 == 123 )
+				{
+					TTable<char *,struct json::JsonValue *> __tab_rename_at_202; das_zero(__tab_rename_at_202);
+					while ( !builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170)) )
+					{
+						if ( !expect_token_16a77edcf4fe8f9f(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_171),0,__error_rename_at_170) )
+						{
+							if ( (das_get_variant_field<int32_t,8,4>::is(__ahead_rename_at_171) && (das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_171,__context__) == 125)) && (builtin_table_size(das_arg<TTable<char *,struct json::JsonValue *>>::pass(__tab_rename_at_202)) == 0) )
+							{
+								das_copy(__error_rename_at_170,((char *) ""));
+								return JV_7acb934dc0bb083f(__context__,das_arg<TTable<char *,struct json::JsonValue *>>::pass(__tab_rename_at_202));
+							} else {
+								return nullptr;
+							};
+						};
+						char * __key_rename_at_209 = (char *)(das_get_variant_field<char *,8,0>::as(__ahead_rename_at_171,__context__));
+						if ( !expect_symbol_ac8a476e07de4192(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_171),58,__error_rename_at_170) )
+						{
+							return nullptr;
+						} else {
+							struct json::JsonValue * __value_rename_at_212 = parse_value_163d2ed847ff74b7(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170),__error_rename_at_170);
+							if ( __value_rename_at_212 == nullptr )
+							{
+								return nullptr;
+							} else {
+								if ( _Funcbuiltin_0x60_key_exists_cf25dd2b3c15ad2(__context__,das_arg<TTable<char *,struct json::JsonValue *>>::pass(__tab_rename_at_202),__key_rename_at_209) )
+								{
+									das_copy(__error_rename_at_170,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_6, cast<char * const >::from(((char *) "duplicate key ")), cast<char *>::from(__key_rename_at_209))));
+									return nullptr;
+								} else {
+									das_copy(__tab_rename_at_202(__key_rename_at_209,__context__),__value_rename_at_212);
+									if ( !expect_token_16a77edcf4fe8f9f(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_171),4,__error_rename_at_170) )
+									{
+										return nullptr;
+									} else {
+										int32_t __sepsym_rename_at_221 = (int32_t)das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_171,__context__);
+										if ( __sepsym_rename_at_221 == 125 )
+										{
+											break;
+										} else if ( __sepsym_rename_at_221 != 44 )
+										{
+											das_copy(__error_rename_at_170,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_7, cast<char * const >::from(((char *) "unsepected object seaprator symbol `")), cast<char *>::from(((char *)(to_string_char(__sepsym_rename_at_221,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sepsym_rename_at_221))));
+											return nullptr;
+										};
+									};
+								};
+							};
+						};
+					};
+					if ( builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_170)) )
+					{
+						das_copy(__error_rename_at_170,((char *) "unexpected eos"));
+						return nullptr;
+					} else {
+						return JV_7acb934dc0bb083f(__context__,das_arg<TTable<char *,struct json::JsonValue *>>::pass(__tab_rename_at_202));
+					};
+				} else {
+					das_copy(__error_rename_at_170,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_8, cast<char * const >::from(((char *) "unexpected symbol `")), cast<char *>::from(((char *)(to_string_char(__sym_rename_at_175,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sym_rename_at_175))));
+					return nullptr;
+				};
+			};
+		} else if ( das_get_variant_field<char *,8,0>::is(__ahead_rename_at_171) )
+		{
+			return JV_1689f68d6126776a(__context__,das_get_variant_field<char *,8,0>::as(__ahead_rename_at_171,__context__));
+		} else if ( das_get_variant_field<double,8,1>::is(__ahead_rename_at_171) )
+		{
+			return JV_6d9038db36a7e729(__context__,das_get_variant_field<double,8,1>::as(__ahead_rename_at_171,__context__));
+		} else if ( das_get_variant_field<bool,8,2>::is(__ahead_rename_at_171) )
+		{
+			return JV_e6bb56ded5795e0f(__context__,das_get_variant_field<bool,8,2>::as(__ahead_rename_at_171,__context__));
+		} else if ( das_get_variant_field<void *,8,3>::is(__ahead_rename_at_171) )
+		{
+			return JV_87a6e48448fb8a26(__context__,nullptr);
+		} else {
+			das_copy(__error_rename_at_170,das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_9, cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_171))));
+			return nullptr;
+		};
+	};
+}
+
+inline struct json::JsonValue * read_json_a9053849881165a9 ( Context * __context__, TArray<uint8_t> const  &  __text_rename_at_254, char * & __error_rename_at_254 )
+{
+	Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) __lex_rename_at_255; das_zero(__lex_rename_at_255); das_move(__lex_rename_at_255, lexer_1b6a42e4fd4f19da(__context__,__text_rename_at_254));
+	struct json::JsonValue * __res_rename_at_256 = (struct json::JsonValue *)parse_value_163d2ed847ff74b7(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_255),__error_rename_at_254);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_255),__context__);
+	return __res_rename_at_256;
+}
+
+inline struct json::JsonValue * read_json_82a8bbdc763ffa95 ( Context * __context__, char * const  __text_rename_at_247, char * & __error_rename_at_247 )
+{
+	Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) __lex_rename_at_248; das_zero(__lex_rename_at_248); das_move(__lex_rename_at_248, lexer_d53a265dae84c9c4(__context__,__text_rename_at_247));
+	struct json::JsonValue * __res_rename_at_249 = (struct json::JsonValue *)parse_value_163d2ed847ff74b7(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_248),__error_rename_at_247);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_248),__context__);
+	return __res_rename_at_249;
+}
+
+inline char * write_json_6a56a768556e92eb ( Context * __context__, struct json::JsonValue * const  __val_rename_at_316 )
+{
+	char * __st_rename_at_317 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_317)->void{
+		write_value_dfc1d0230610221b(__context__,das_arg<StringBuilderWriter>::pass(__writer_rename_at_317),__val_rename_at_316,0);
+	},__context__))));
+	return __st_rename_at_317;
+}
+
+inline void write_value_dfc1d0230610221b ( Context * __context__, StringBuilderWriter &  __writer_rename_at_261, struct json::JsonValue * const  __jsv_rename_at_261, int32_t __depth_rename_at_261 )
+{
+	if ( __jsv_rename_at_261 == nullptr )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_10,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "null"))));
+	} else if ( das_get_variant_field<char *,8,2>::is(__jsv_rename_at_261->value) )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_11,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "\""))));
+		write_escape_string(das_arg<StringBuilderWriter>::pass(__writer_rename_at_261),das_get_variant_field<char *,8,2>::as(__jsv_rename_at_261->value,__context__));
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_12,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "\""))));
+	} else if ( das_get_variant_field<double,8,3>::is(__jsv_rename_at_261->value) )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_13,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<double>::from(das_get_variant_field<double,8,3>::as(__jsv_rename_at_261->value,__context__))));
+	} else if ( das_get_variant_field<TArray<struct json::JsonValue *>,8,1>::is(__jsv_rename_at_261->value) )
+	{
+		if ( builtin_array_size(das_get_variant_field<TArray<struct json::JsonValue *>,8,1>::as(__jsv_rename_at_261->value,__context__)) == 0 )
+		{
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_14,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "[]"))));
+		} else {
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_15,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "[\n"))));
+			bool __first_rename_at_275 = true;
+			{
+				bool __need_loop_276 = true;
+				// elem : json::JsonValue? const&
+				das_iterator<TArray<struct json::JsonValue *> const > __elem_iterator(das_get_variant_field<TArray<struct json::JsonValue *>,8,1>::as(__jsv_rename_at_261->value,__context__));
+				struct json::JsonValue * const  * __elem_rename_at_276;
+				__need_loop_276 = __elem_iterator.first(__context__,(__elem_rename_at_276)) && __need_loop_276;
+				for ( ; __need_loop_276 ; __need_loop_276 = __elem_iterator.next(__context__,(__elem_rename_at_276)) )
+				{
+					if ( __first_rename_at_275 )
+					{
+						das_copy(__first_rename_at_275,false);
+					} else {
+						das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_16,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) ",\n"))));
+					};
+					write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_261),9,__depth_rename_at_261 + 1);
+					write_value_dfc1d0230610221b(__context__,das_arg<StringBuilderWriter>::pass(__writer_rename_at_261),(*__elem_rename_at_276),__depth_rename_at_261 + 1);
+				}
+				__elem_iterator.close(__context__,(__elem_rename_at_276));
+			};
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_17,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "\n"))));
+			write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_261),9,__depth_rename_at_261);
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_18,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "]"))));
+		};
+	} else if ( das_get_variant_field<TTable<char *,struct json::JsonValue *>,8,0>::is(__jsv_rename_at_261->value) )
+	{
+		if ( builtin_table_size(das_get_variant_field<TTable<char *,struct json::JsonValue *>,8,0>::as(__jsv_rename_at_261->value,__context__)) == 0 )
+		{
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_19,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "{}"))));
+		} else {
+			Sequence DAS_COMMENT((char * *)) _temp_make_local_292_80;
+			Sequence DAS_COMMENT((struct json::JsonValue * *)) _temp_make_local_292_96;
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_20,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "{\n"))));
+			bool __first_rename_at_291 = true;
+			{
+				bool __need_loop_292 = true;
+				// elemK : string const&
+				das_iterator<Sequence DAS_COMMENT((char * const ))> __elemK_iterator((_temp_make_local_292_80 = (_Funcbuiltin_0x60_keys_98634c9938f02164(__context__,das_get_variant_field<TTable<char *,struct json::JsonValue *>,8,0>::as(__jsv_rename_at_261->value,__context__)))));
+				char * const  * __elemK_rename_at_292;
+				__need_loop_292 = __elemK_iterator.first(__context__,(__elemK_rename_at_292)) && __need_loop_292;
+				// elemV : json::JsonValue? const&
+				das_iterator<Sequence DAS_COMMENT((struct json::JsonValue * const ))> __elemV_iterator((_temp_make_local_292_96 = (_Funcbuiltin_0x60_values_b9b57686fce4f7f2(__context__,das_get_variant_field<TTable<char *,struct json::JsonValue *>,8,0>::as(__jsv_rename_at_261->value,__context__)))));
+				struct json::JsonValue * const  * __elemV_rename_at_292;
+				__need_loop_292 = __elemV_iterator.first(__context__,(__elemV_rename_at_292)) && __need_loop_292;
+				for ( ; __need_loop_292 ; __need_loop_292 = __elemK_iterator.next(__context__,(__elemK_rename_at_292)) && __elemV_iterator.next(__context__,(__elemV_rename_at_292)) )
+				{
+					if ( __first_rename_at_291 )
+					{
+						das_copy(__first_rename_at_291,false);
+					} else {
+						das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_21,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) ",\n"))));
+					};
+					write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_261),9,__depth_rename_at_261 + 1);
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_22,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "\""))));
+					write_escape_string(das_arg<StringBuilderWriter>::pass(__writer_rename_at_261),(*__elemK_rename_at_292));
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_23,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "\" : "))));
+					write_value_dfc1d0230610221b(__context__,das_arg<StringBuilderWriter>::pass(__writer_rename_at_261),(*__elemV_rename_at_292),__depth_rename_at_261 + 1);
+				}
+				__elemK_iterator.close(__context__,(__elemK_rename_at_292));
+				__elemV_iterator.close(__context__,(__elemV_rename_at_292));
+			};
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_24,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "\n"))));
+			write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_261),9,__depth_rename_at_261);
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_25,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "}"))));
+		};
+	} else if ( das_get_variant_field<bool,8,4>::is(__jsv_rename_at_261->value) )
+	{
+		if ( das_get_variant_field<bool,8,4>::as(__jsv_rename_at_261->value,__context__) )
+		{
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_26,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "true"))));
+		} else {
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_27,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "false"))));
+		};
+	} else if ( das_get_variant_field<void *,8,5>::is(__jsv_rename_at_261->value) )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_28,cast<StringBuilderWriter &>::from(__writer_rename_at_261),cast<char * const >::from(((char *) "null"))));
+	} else {
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_29, cast<char * const >::from(((char *) "unexpected ")), cast<struct json::JsonValue * const >::from(__jsv_rename_at_261))),__context__);
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// JV_1bd1533d077539f5
+		aotLib[0xf976dc473831e74d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct json::JsonValue * (*) ( Context * __context__, TArray<struct json::JsonValue *> &  ),&JV_1bd1533d077539f5>>();
+	};
+		// JV_87a6e48448fb8a26
+		aotLib[0x8f38630b00ad7065] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct json::JsonValue * (*) ( Context * __context__, void * const   ),&JV_87a6e48448fb8a26>>();
+	};
+		// JV_7acb934dc0bb083f
+		aotLib[0x28d0dcc1846b6289] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct json::JsonValue * (*) ( Context * __context__, TTable<char *,struct json::JsonValue *> &  ),&JV_7acb934dc0bb083f>>();
+	};
+		// JV_e6bb56ded5795e0f
+		aotLib[0x661f1c417239d8b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct json::JsonValue * (*) ( Context * __context__, bool  ),&JV_e6bb56ded5795e0f>>();
+	};
+		// JV_6d9038db36a7e729
+		aotLib[0x7b9d300c7b475345] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct json::JsonValue * (*) ( Context * __context__, double  ),&JV_6d9038db36a7e729>>();
+	};
+		// JV_1689f68d6126776a
+		aotLib[0x74247dcf029840e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct json::JsonValue * (*) ( Context * __context__, char * const   ),&JV_1689f68d6126776a>>();
+	};
+		// _Func_lambda_json_68_8_1_0x60_finazlier_8a468fd20060d838
+		aotLib[0x23b0862016bc2dbc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct json::_lambda_json_68_8_1 *  ),&_Func_lambda_json_68_8_1_0x60_finazlier_8a468fd20060d838>>();
+	};
+		// _Func_lambda_json_68_8_1_0x60_function_7d279d8cc3e53221
+		aotLib[0x1abce0d23885e68a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct json::_lambda_json_68_8_1 & , TVariant<16,char *,double,bool,void *,int32_t,char *> &  ),&_Func_lambda_json_68_8_1_0x60_function_7d279d8cc3e53221>>();
+	};
+		// _lexer_a11dd07734379e03
+		aotLib[0x45e46812c4eda687] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, char *  ),&_lexer_a11dd07734379e03>>();
+	};
+		// _Funcbuiltin_0x60_each_a48785efffc6d2c1
+		aotLib[0xfb391bd3cd78b8ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TVariant<16,char *,double,bool,void *,int32_t,char *>)) const   ),&_Funcbuiltin_0x60_each_a48785efffc6d2c1>>();
+	};
+		// _Funcbuiltin_0x60_each_3bd22e87ecbdcf79
+		aotLib[0x4c2de9cff1fb15e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, char * const   ),&_Funcbuiltin_0x60_each_3bd22e87ecbdcf79>>();
+	};
+		// _Funcbuiltin_0x60_finalize_7f972184337f6d1a
+		aotLib[0x561a74dd5f0a18cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> &  ),&_Funcbuiltin_0x60_finalize_7f972184337f6d1a>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_cf25dd2b3c15ad2
+		aotLib[0x21fa5177d5105c25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,struct json::JsonValue *> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_cf25dd2b3c15ad2>>();
+	};
+		// _Funcbuiltin_0x60_keys_98634c9938f02164
+		aotLib[0x8ef32e892760fe51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char * const  &)) (*) ( Context * __context__, TTable<char *,struct json::JsonValue *> const  &  ),&_Funcbuiltin_0x60_keys_98634c9938f02164>>();
+	};
+		// _Funcbuiltin_0x60_next_111e5cd76980442a
+		aotLib[0x827000f583a69705] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  & , TVariant<16,char *,double,bool,void *,int32_t,char *> &  ),&_Funcbuiltin_0x60_next_111e5cd76980442a>>();
+	};
+		// _Funcbuiltin_0x60_next_6a3c01874ce3fb9a
+		aotLib[0x858cb271b8b30095] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , int32_t &  ),&_Funcbuiltin_0x60_next_6a3c01874ce3fb9a>>();
+	};
+		// _Funcbuiltin_0x60_push_2d6f6dfd3be4b074
+		aotLib[0xb136a0fb79e3849] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct json::JsonValue *> & , struct json::JsonValue * const  , int32_t  ),&_Funcbuiltin_0x60_push_2d6f6dfd3be4b074>>();
+	};
+		// _Funcbuiltin_0x60_push_6f903bf56272d4e7
+		aotLib[0x4ba69093003e2a9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , uint8_t , int32_t  ),&_Funcbuiltin_0x60_push_6f903bf56272d4e7>>();
+	};
+		// _Funcbuiltin_0x60_values_b9b57686fce4f7f2
+		aotLib[0xb449eafa37ae11cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((struct json::JsonValue * const  &)) (*) ( Context * __context__, TTable<char *,struct json::JsonValue *> const  &  ),&_Funcbuiltin_0x60_values_b9b57686fce4f7f2>>();
+	};
+		// expect_symbol_ac8a476e07de4192
+		aotLib[0x988351874f270392] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & , TVariant<16,char *,double,bool,void *,int32_t,char *> & , int32_t , char * &  ),&expect_symbol_ac8a476e07de4192>>();
+	};
+		// expect_token_16a77edcf4fe8f9f
+		aotLib[0x98d18f862147eeda] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & , TVariant<16,char *,double,bool,void *,int32_t,char *> & , int32_t , char * &  ),&expect_token_16a77edcf4fe8f9f>>();
+	};
+		// finalize_866c8989814fc71a
+		aotLib[0x3b9a59ce2919740b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct json::_lambda_json_68_8_1 &  ),&finalize_866c8989814fc71a>>();
+	};
+		// lexer_1b6a42e4fd4f19da
+		aotLib[0xd9d4bd7774bf5390] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, TArray<uint8_t> const  &  ),&lexer_1b6a42e4fd4f19da>>();
+	};
+		// lexer_d53a265dae84c9c4
+		aotLib[0xa133ad298e48b4e0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, char * const   ),&lexer_d53a265dae84c9c4>>();
+	};
+		// parse_value_163d2ed847ff74b7
+		aotLib[0x5be2a9d9e0f7e5e8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct json::JsonValue * (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & , char * &  ),&parse_value_163d2ed847ff74b7>>();
+	};
+		// read_json_a9053849881165a9
+		aotLib[0x3273123b4fdeeb3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct json::JsonValue * (*) ( Context * __context__, TArray<uint8_t> const  & , char * &  ),&read_json_a9053849881165a9>>();
+	};
+		// read_json_82a8bbdc763ffa95
+		aotLib[0x9fda0a8c677a26fa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct json::JsonValue * (*) ( Context * __context__, char * const  , char * &  ),&read_json_82a8bbdc763ffa95>>();
+	};
+		// write_json_6a56a768556e92eb
+		aotLib[0x9e0fb6c901f7d929] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, struct json::JsonValue * const   ),&write_json_6a56a768556e92eb>>();
+	};
+		// write_value_dfc1d0230610221b
+		aotLib[0xa33ec3d8f0153581] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, StringBuilderWriter & , struct json::JsonValue * const  , int32_t  ),&write_value_dfc1d0230610221b>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1863 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require regex
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__54d21be3;
+extern StructInfo __struct_info__814eb49d;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__23a62413;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__def08656;
+extern TypeInfo __type_info__fadc0cd2;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__199df2db;
+extern TypeInfo __type_info__90ba8218;
+extern TypeInfo __type_info__da4cf41c;
+extern TypeInfo __type_info__2fb08994;
+extern TypeInfo __type_info__79ec5fa3;
+extern TypeInfo __type_info__e7c33a17;
+extern VarInfo __var_info__683ffa2;
+extern VarInfo __var_info__8a9e2bc;
+extern VarInfo __var_info__622d762c;
+extern VarInfo __var_info__6ad39c4c;
+extern VarInfo __var_info__1b349211;
+extern VarInfo __var_info__85d2e124;
+extern VarInfo __var_info__edd95571;
+extern VarInfo __var_info__cc2d9212;
+extern VarInfo __var_info__886e4e7c;
+extern VarInfo __var_info__7e8b348f;
+extern VarInfo __var_info__d18c8a71;
+extern VarInfo __var_info__fb508c6e;
+extern VarInfo __var_info__c896daa2;
+extern VarInfo __var_info__fb0c5243;
+extern VarInfo __var_info__b9ead212;
+extern VarInfo __var_info__85e1ebae;
+extern VarInfo __var_info__8469f83e;
+extern VarInfo __var_info__63115269;
+extern VarInfo __var_info__af513868;
+extern VarInfo __var_info__85ce63f6;
+extern FuncInfo __func_info__d2e1683e;
+extern EnumInfo __enum_info__8d516ad4;
+
+EnumValueInfo __enum_info__8d516ad4_value_0 = { "Char", 0 };
+EnumValueInfo __enum_info__8d516ad4_value_1 = { "Set", 1 };
+EnumValueInfo __enum_info__8d516ad4_value_2 = { "Any", 2 };
+EnumValueInfo __enum_info__8d516ad4_value_3 = { "Eos", 3 };
+EnumValueInfo __enum_info__8d516ad4_value_4 = { "Group", 4 };
+EnumValueInfo __enum_info__8d516ad4_value_5 = { "Plus", 5 };
+EnumValueInfo __enum_info__8d516ad4_value_6 = { "Star", 6 };
+EnumValueInfo __enum_info__8d516ad4_value_7 = { "Question", 7 };
+EnumValueInfo __enum_info__8d516ad4_value_8 = { "Concat", 8 };
+EnumValueInfo __enum_info__8d516ad4_value_9 = { "Union", 9 };
+EnumValueInfo * __enum_info__8d516ad4_values [] = { &__enum_info__8d516ad4_value_0, &__enum_info__8d516ad4_value_1, &__enum_info__8d516ad4_value_2, &__enum_info__8d516ad4_value_3, &__enum_info__8d516ad4_value_4, &__enum_info__8d516ad4_value_5, &__enum_info__8d516ad4_value_6, &__enum_info__8d516ad4_value_7, &__enum_info__8d516ad4_value_8, &__enum_info__8d516ad4_value_9 };
+EnumInfo __enum_info__8d516ad4 = { "ReOp", __enum_info__8d516ad4_values, 10, 0x8d516ad4 };
+VarInfo __struct_info__54d21be3_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xedd95571, "root", 0 };
+VarInfo __struct_info__54d21be3_field_1 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb9ead212, "match", 8 };
+VarInfo __struct_info__54d21be3_field_2 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__def08656, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x63115269, "groups", 16 };
+uint32_t __type_info__622d762c_dim_var_1423055843[1] = { 8 };
+VarInfo __struct_info__54d21be3_field_3 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__622d762c_dim_var_1423055843, 2078, 0x622d762c, "earlyOut", 40 };
+VarInfo __struct_info__54d21be3_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x8a9e2bc, "canEarlyOut", 72 };
+VarInfo * __struct_info__54d21be3_fields[5] =  { &__struct_info__54d21be3_field_0, &__struct_info__54d21be3_field_1, &__struct_info__54d21be3_field_2, &__struct_info__54d21be3_field_3, &__struct_info__54d21be3_field_4 };
+StructInfo __struct_info__54d21be3 = {"Regex", __struct_info__54d21be3_fields, 5, 80, -1, nullptr, 0x54d21be3 };
+VarInfo __struct_info__814eb49d_field_0 =  { Type::tEnumeration, nullptr, &__enum_info__8d516ad4, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x85d2e124, "op", 0 };
+VarInfo __struct_info__814eb49d_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x85ce63f6, "id", 4 };
+TypeInfo * __type_info__fb508c6e_arg_types_var_2169418909[3] = { &__type_info__90ba8218, &__type_info__2fb08994, &__type_info__79ec5fa3 };
+VarInfo __struct_info__814eb49d_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__23a62413, nullptr, (TypeInfo **)__type_info__fb508c6e_arg_types_var_2169418909, nullptr, 3, 0, nullptr, 28, 0xfb508c6e, "fun2", 8 };
+VarInfo __struct_info__814eb49d_field_3 =  { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x85e1ebae, "at", 12 };
+VarInfo __struct_info__814eb49d_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x6ad39c4c, "text", 24 };
+VarInfo __struct_info__814eb49d_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xfb0c5243, "textLen", 32 };
+VarInfo __struct_info__814eb49d_field_6 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__2fb08994, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8469f83e, "all", 40 };
+VarInfo __struct_info__814eb49d_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x683ffa2, "left", 64 };
+VarInfo __struct_info__814eb49d_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7e8b348f, "right", 72 };
+VarInfo __struct_info__814eb49d_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x886e4e7c, "subexpr", 80 };
+VarInfo __struct_info__814eb49d_field_10 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xcc2d9212, "next", 88 };
+uint32_t __type_info__af513868_dim_var_2169418909[1] = { 8 };
+VarInfo __struct_info__814eb49d_field_11 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__af513868_dim_var_2169418909, 2078, 0xaf513868, "cset", 96 };
+VarInfo __struct_info__814eb49d_field_12 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd18c8a71, "index", 128 };
+VarInfo __struct_info__814eb49d_field_13 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1b349211, "tail", 136 };
+VarInfo * __struct_info__814eb49d_fields[14] =  { &__struct_info__814eb49d_field_0, &__struct_info__814eb49d_field_1, &__struct_info__814eb49d_field_2, &__struct_info__814eb49d_field_3, &__struct_info__814eb49d_field_4, &__struct_info__814eb49d_field_5, &__struct_info__814eb49d_field_6, &__struct_info__814eb49d_field_7, &__struct_info__814eb49d_field_8, &__struct_info__814eb49d_field_9, &__struct_info__814eb49d_field_10, &__struct_info__814eb49d_field_11, &__struct_info__814eb49d_field_12, &__struct_info__814eb49d_field_13 };
+StructInfo __struct_info__814eb49d = {"ReNode", __struct_info__814eb49d_fields, 14, 144, -1, nullptr, 0x814eb49d };
+VarInfo __func_info__d2e1683e_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc896daa2, "node", 0 };
+VarInfo * __func_info__d2e1683e_fields[1] =  { &__func_info__d2e1683e_field_0 };
+FuncInfo __func_info__d2e1683e = {"invoke block<(node:regex::ReNode?):void> const", "", __func_info__d2e1683e_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xd2e1683e, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__23a62413 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x23a62413 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo * __type_info__def08656_arg_types[2] = { &__type_info__fadc0cd2, &__type_info__17c16538 };
+TypeInfo __type_info__def08656 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__def08656_arg_types, nullptr, 2, 0, nullptr, 6, 0xdef08656 };
+TypeInfo __type_info__fadc0cd2 = { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xfadc0cd2 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__199df2db = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x199df2db };
+TypeInfo __type_info__90ba8218 = { Type::tStructure, &__struct_info__54d21be3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x90ba8218 };
+TypeInfo __type_info__da4cf41c = { Type::tStructure, &__struct_info__814eb49d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xda4cf41c };
+TypeInfo __type_info__2fb08994 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2fb08994 };
+TypeInfo __type_info__79ec5fa3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x79ec5fa3 };
+TypeInfo __type_info__e7c33a17 = { Type::tEnumeration, nullptr, &__enum_info__8d516ad4, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe7c33a17 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_1[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_2[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[2] = { &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_4[2] = { &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_5[3] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_6[1] = { &__type_info__17c16538 };
+TypeInfo * __tinfo_7[2] = { &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_8[1] = { &__type_info__17c16538 };
+TypeInfo * __tinfo_9[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_10[2] = { &__type_info__3ffbf730, &__type_info__e7c33a17 };
+TypeInfo * __tinfo_11[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_12[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+namespace regex {
+
+enum class ReOp : int32_t {
+	Char = int32_t(0),
+	Set = int32_t(1),
+	Any = int32_t(2),
+	Eos = int32_t(3),
+	Group = int32_t(4),
+	Plus = int32_t(5),
+	Star = int32_t(6),
+	Question = int32_t(7),
+	Concat = int32_t(8),
+	Union = int32_t(9),
+};
+}
+}
+template <> struct cast< regex::ReOp > : cast_enum < regex::ReOp > {};
+namespace {
+namespace regex {
+
+struct ReNode {
+	DAS_COMMENT(enum) regex::ReOp op;
+	int32_t id;
+	Func DAS_COMMENT((uint8_t *,struct regex::Regex,struct regex::ReNode *,uint8_t * const )) fun2;
+	range at;
+	char * text;
+	int32_t textLen;
+	TArray<struct regex::ReNode *> all;
+	struct regex::ReNode * left;
+	struct regex::ReNode * right;
+	struct regex::ReNode * subexpr;
+	struct regex::ReNode * next;
+	TDim<uint32_t,8> cset;
+	int32_t index;
+	uint8_t * tail;
+};
+static_assert(sizeof(ReNode)==144,"structure size mismatch with DAS");
+static_assert(offsetof(ReNode,op)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,id)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,fun2)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,at)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,text)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,textLen)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,all)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,left)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,right)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,subexpr)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,next)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,cset)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,index)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,tail)==136,"structure field offset mismatch with DAS");
+}
+namespace regex {
+
+struct Regex {
+	struct regex::ReNode * root;
+	uint8_t * match;
+	TArray<TTuple<16,range,char *>> groups;
+	TDim<uint32_t,8> earlyOut;
+	bool canEarlyOut;
+};
+static_assert(sizeof(Regex)==80,"structure size mismatch with DAS");
+static_assert(offsetof(Regex,root)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,match)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,groups)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,earlyOut)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,canEarlyOut)==72,"structure field offset mismatch with DAS");
+}
+
+inline int32_t at_c9bade5ff7edd57d ( Context * __context__, char * const  __expr_rename_at_101, int32_t __offset_rename_at_101 );
+inline void _Funcbuiltin_0x60_finalize_dd8c5cab6f6afc46 ( Context * __context__, TArray<struct regex::ReNode *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_3fdf4fc723ad236a ( Context * __context__, TArray<struct regex::ReNode *> & __Arr_rename_at_40, struct regex::ReNode * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_40551da8a4209c68 ( Context * __context__, TArray<TTuple<16,range,char *>> & __Arr_rename_at_40, TTuple<16,range,char *> const  & __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_resize_13e4a05653768251 ( Context * __context__, TArray<struct regex::ReNode *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<struct regex::ReNode *> _Funcbuiltin_0x60_to_array_move_55ba84047fc802d6 ( Context * __context__, TDim<struct regex::ReNode *,2> & __a_rename_at_398 );
+inline void debug_re_7cf48f46d0970cb7 ( Context * __context__, struct regex::ReNode * const  __node_rename_at_854, int32_t __tab_rename_at_854 );
+inline void debug_set_9e4757c00b2a92ec ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_845 );
+inline bool eos_77a77ef5845fccf8 ( Context * __context__, char * const  __expr_rename_at_97, int32_t __offset_rename_at_97 );
+inline void finalize_b321625d5d1ae328 ( Context * __context__, struct regex::ReNode * & ____this_rename_at_302 );
+inline void finalize_99d8b8a6e8d8847f ( Context * __context__, TVariant<16,struct regex::ReNode *,void *> & ____this_rename_at_302 );
+inline void finalize_4b5b3ac4f531983c ( Context * __context__, struct regex::ReNode & ____this_rename_at_22 );
+inline bool is_meta_character_9e5a1eca7384b1f ( Context * __context__, int32_t __ch_rename_at_173 );
+inline bool is_set_character_77a3c75117a26e66 ( Context * __context__, int32_t __ch_rename_at_177 );
+inline bool is_set_empty_ccd4b091eb82a1dd ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_124 );
+inline bool is_valid_13f013884e52501b ( Context * __context__, struct regex::Regex & __re_rename_at_748 );
+inline TVariant<16,struct regex::ReNode *,void *> maybe_9a67bfcd21418f2b ( Context * __context__, struct regex::ReNode * const  __value_rename_at_92 );
+inline struct regex::ReNode * mk_concat_9566cb5dde2eb2a8 ( Context * __context__, struct regex::ReNode * __left_rename_at_330, struct regex::ReNode * __right_rename_at_330 );
+inline struct regex::ReNode * mk_union_8b47f400ee527052 ( Context * __context__, struct regex::ReNode * __left_rename_at_353, struct regex::ReNode * __right_rename_at_353 );
+inline TVariant<16,struct regex::ReNode *,void *> nada_e26047260042fc86 ( Context * __context__ );
+inline int32_t next_ed40d1d5d47c8ce0 ( Context * __context__, TVariant<16,struct regex::ReNode *,void *> const  & __re_rename_at_117 );
+inline TVariant<16,struct regex::ReNode *,void *> re_any_a9b85795201936a3 ( Context * __context__, char * const  __expr_rename_at_272, int32_t __offset_rename_at_272 );
+inline void re_assign_groups_9ac5348360243c9a ( Context * __context__, struct regex::Regex & __re_rename_at_458 );
+inline void re_assign_match_functions_b3e7e37087621da7 ( Context * __context__, struct regex::Regex & __re_rename_at_471 );
+inline void re_assign_next_3cbb830952003b86 ( Context * __context__, struct regex::Regex & __re_rename_at_444 );
+inline TVariant<16,struct regex::ReNode *,void *> re_basic_c3370642f80cb146 ( Context * __context__, char * const  __expr_rename_at_404, int32_t __offset_rename_at_404 );
+inline TVariant<16,struct regex::ReNode *,void *> re_char_cc7fcf1004fb0a5b ( Context * __context__, char * const  __expr_rename_at_182, int32_t __offset_rename_at_182 );
+inline bool re_early_out_c0e6ee8919572965 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_708, struct regex::ReNode * const  __node_rename_at_708 );
+inline TVariant<16,struct regex::ReNode *,void *> re_elementary_ea025bf992c116ee ( Context * __context__, char * const  __expr_rename_at_308, int32_t __offset_rename_at_308 );
+inline TVariant<16,struct regex::ReNode *,void *> re_eos_2da6bc306bcf43b0 ( Context * __context__, char * const  __expr_rename_at_282, int32_t __offset_rename_at_282 );
+inline TVariant<16,struct regex::ReNode *,void *> re_group_48dd14ed9a44d9f3 ( Context * __context__, char * const  __expr_rename_at_292, int32_t __offset_rename_at_292 );
+inline uint8_t * re_match2_any_e94ab3d7d8964629 ( Context * __context__, struct regex::Regex & __regex_rename_at_561, struct regex::ReNode * __node_rename_at_561, uint8_t * const  __str_rename_at_561 );
+inline uint8_t * re_match2_char_db8d3f11c0c117b9 ( Context * __context__, struct regex::Regex & __regex_rename_at_520, struct regex::ReNode * __node_rename_at_520, uint8_t * const  __str_rename_at_520 );
+inline uint8_t * re_match2_concat_51a6261aee4576ab ( Context * __context__, struct regex::Regex & __regex_rename_at_576, struct regex::ReNode * __node_rename_at_576, uint8_t * const  __str_rename_at_576 );
+inline uint8_t * re_match2_eos_95cec9bf71f3f1d8 ( Context * __context__, struct regex::Regex & __regex_rename_at_587, struct regex::ReNode * __node_rename_at_587, uint8_t * const  __str_rename_at_587 );
+inline uint8_t * re_match2_group_2a22c466440843aa ( Context * __context__, struct regex::Regex & __regex_rename_at_694, struct regex::ReNode * __node_rename_at_694, uint8_t * const  __str_rename_at_694 );
+inline uint8_t * re_match2_plus_1e1614cdc46c85c5 ( Context * __context__, struct regex::Regex & __regex_rename_at_615, struct regex::ReNode * __node_rename_at_615, uint8_t * const  __str_rename_at_615 );
+inline uint8_t * re_match2_plus_set_986819b30ab98f26 ( Context * __context__, struct regex::Regex & __regex_rename_at_640, struct regex::ReNode * __node_rename_at_640, uint8_t * const  __str_rename_at_640 );
+inline uint8_t * re_match2_question_4066686cd132b881 ( Context * __context__, struct regex::Regex & __regex_rename_at_600, struct regex::ReNode * __node_rename_at_600, uint8_t * const  __str_rename_at_600 );
+inline uint8_t * re_match2_set_b4dca9a4881ef5de ( Context * __context__, struct regex::Regex & __regex_rename_at_546, struct regex::ReNode * __node_rename_at_546, uint8_t * const  __str_rename_at_546 );
+inline uint8_t * re_match2_single_char_f467a074f85119cf ( Context * __context__, struct regex::Regex & __regex_rename_at_505, struct regex::ReNode * __node_rename_at_505, uint8_t * const  __str_rename_at_505 );
+inline uint8_t * re_match2_star_55088e5150600cff ( Context * __context__, struct regex::Regex & __regex_rename_at_671, struct regex::ReNode * __node_rename_at_671, uint8_t * const  __str_rename_at_671 );
+inline uint8_t * re_match2_union_bcfeb6f902495257 ( Context * __context__, struct regex::Regex & __regex_rename_at_535, struct regex::ReNode * __node_rename_at_535, uint8_t * const  __str_rename_at_535 );
+inline struct regex::ReNode * re_parse_31932cd2c8f5a6e6 ( Context * __context__, char * const  __expr_rename_at_421 );
+inline TVariant<16,struct regex::ReNode *,void *> re_re_fa81d25275ee5884 ( Context * __context__, char * const  __expr_rename_at_375, int32_t __offset_rename_at_375 );
+inline TVariant<16,struct regex::ReNode *,void *> re_set_2fe7c33ed9dcf01c ( Context * __context__, char * const  __expr_rename_at_246, int32_t __offset_rename_at_246 );
+inline TVariant<16,struct regex::ReNode *,void *> re_set_items_6d46881d4c3a48a7 ( Context * __context__, char * const  __expr_rename_at_206, int32_t __offset_rename_at_206 );
+inline struct regex::Regex regex_compile_2990a441ec4245c0 ( Context * __context__, struct regex::Regex & __re_rename_at_770 );
+inline bool regex_compile_b36953a2bb5d5307 ( Context * __context__, struct regex::Regex & __re_rename_at_752, char * const  __expr_rename_at_752 );
+inline struct regex::Regex regex_compile_d1324af73074c8c8 ( Context * __context__, char * const  __expr_rename_at_763 );
+inline void regex_debug_d6af24b1a07eae0b ( Context * __context__, struct regex::Regex const  & __regex_rename_at_833 );
+inline void regex_foreach_a33b5b26c7926f1d ( Context * __context__, struct regex::Regex & __regex_rename_at_795, char * const  __str_rename_at_795, Block DAS_COMMENT((bool,range)) const  & __blk_rename_at_795 );
+inline char * regex_group_4be2fa6920455849 ( Context * __context__, struct regex::Regex const  & __regex_rename_at_790, int32_t __index_rename_at_790, char * const  __match_rename_at_790 );
+inline int32_t regex_match_89e4de8eb0b82a1d ( Context * __context__, struct regex::Regex & __regex_rename_at_777, char * const  __str_rename_at_777, int32_t __offset_rename_at_777 );
+inline void set_meta_54cf3cdb21046a26 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_155, int32_t __che_rename_at_155 );
+inline void set_negative_9a0b2ed2b4231348 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_150 );
+inline void set_or_char_3ae19d169cde2ccb ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_131, int32_t __ch_rename_at_131 );
+inline void set_or_range_698b6406f2a4153c ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_135, range __bits_rename_at_135 );
+inline void set_or_set_d9bfd2cba9b16ba5 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_145, TDim<uint32_t,8> const  & __eset_rename_at_145 );
+inline void visit_top_down_1f42d2ae2c877acf ( Context * __context__, struct regex::ReNode * __node_rename_at_432, Block DAS_COMMENT((void,struct regex::ReNode *)) const  & __blk_rename_at_432 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t at_c9bade5ff7edd57d ( Context * __context__, char * const  __expr_rename_at_101, int32_t __offset_rename_at_101 )
+{
+	return get_character_uat(__expr_rename_at_101,__offset_rename_at_101);
+}
+
+inline void _Funcbuiltin_0x60_finalize_dd8c5cab6f6afc46 ( Context * __context__, TArray<struct regex::ReNode *> &  __a_rename_at_285 )
+{
+	{
+		bool __need_loop_287 = true;
+		// aV : regex::ReNode? aka TT&
+		das_iterator<TArray<struct regex::ReNode *>> __aV_iterator(__a_rename_at_285);
+		struct regex::ReNode * * __aV_rename_at_287;
+		__need_loop_287 = __aV_iterator.first(__context__,(__aV_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __aV_iterator.next(__context__,(__aV_rename_at_287)) )
+		{
+			finalize_b321625d5d1ae328(__context__,(*__aV_rename_at_287));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_287));
+	};
+	builtin_array_free(das_arg<TArray<struct regex::ReNode *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_3fdf4fc723ad236a ( Context * __context__, TArray<struct regex::ReNode *> &  __Arr_rename_at_40, struct regex::ReNode * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<struct regex::ReNode *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_40551da8a4209c68 ( Context * __context__, TArray<TTuple<16,range,char *>> &  __Arr_rename_at_40, TTuple<16,range,char *> const  &  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<TTuple<16,range,char *>>>::pass(__Arr_rename_at_40),__at_rename_at_40,16,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_resize_13e4a05653768251 ( Context * __context__, TArray<struct regex::ReNode *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct regex::ReNode *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline TArray<struct regex::ReNode *> _Funcbuiltin_0x60_to_array_move_55ba84047fc802d6 ( Context * __context__, TDim<struct regex::ReNode *,2> &  __a_rename_at_398 )
+{
+	TArray<struct regex::ReNode *> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_13e4a05653768251(__context__,das_arg<TArray<struct regex::ReNode *>>::pass(__arr_rename_at_399),2);
+	das_copy(das_cast<TDim<struct regex::ReNode *,2>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline void debug_re_7cf48f46d0970cb7 ( Context * __context__, struct regex::ReNode * const  __node_rename_at_854, int32_t __tab_rename_at_854 )
+{
+	builtin_print(((char *) "("),__context__);
+	if ( __node_rename_at_854 != nullptr )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "#")), cast<int32_t>::from(__node_rename_at_854->id))),__context__);
+		if ( __node_rename_at_854->next != nullptr )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "->")), cast<int32_t>::from(__node_rename_at_854->next->id))),__context__);
+		} else {
+			builtin_print(((char *) "->!"),__context__);
+		};
+		builtin_print(((char *) " "),__context__);
+	};
+	if ( __node_rename_at_854 == nullptr )
+	{
+		builtin_print(((char *) "null)"),__context__);
+	} else if ( __node_rename_at_854->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_2, cast<char * const >::from(((char *) "Char `")), cast<char * const >::from(__node_rename_at_854->text), cast<char * const >::from(((char *) "`)")))),__context__);
+	} else if ( __node_rename_at_854->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		builtin_print(((char *) "Set "),__context__);
+		debug_set_9e4757c00b2a92ec(__context__,__node_rename_at_854->cset);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_854->op == DAS_COMMENT(enum) regex::ReOp::Any )
+	{
+		builtin_print(((char *) "Any)"),__context__);
+	} else if ( __node_rename_at_854->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+	{
+		builtin_print(((char *) "Eos)"),__context__);
+	} else if ( __node_rename_at_854->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		builtin_print(((char *) "Group "),__context__);
+		debug_re_7cf48f46d0970cb7(__context__,__node_rename_at_854->subexpr,__tab_rename_at_854 + 1);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_854->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+	{
+		builtin_print(((char *) "Plus "),__context__);
+		debug_re_7cf48f46d0970cb7(__context__,__node_rename_at_854->subexpr,__tab_rename_at_854);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_854->op == DAS_COMMENT(enum) regex::ReOp::Star )
+	{
+		builtin_print(((char *) "Star "),__context__);
+		debug_re_7cf48f46d0970cb7(__context__,__node_rename_at_854->subexpr,__tab_rename_at_854);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_854->op == DAS_COMMENT(enum) regex::ReOp::Question )
+	{
+		builtin_print(((char *) "Question "),__context__);
+		debug_re_7cf48f46d0970cb7(__context__,__node_rename_at_854->subexpr,__tab_rename_at_854);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_854->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		builtin_print(((char *) "Contact"),__context__);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_854,__context__)))))),__context__);
+		debug_re_7cf48f46d0970cb7(__context__,__node_rename_at_854->left,__tab_rename_at_854 + 1);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_4, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_854,__context__)))))),__context__);
+		debug_re_7cf48f46d0970cb7(__context__,__node_rename_at_854->right,__tab_rename_at_854 + 1);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_854 - 1,__context__)))), cast<char * const >::from(((char *) ")")))),__context__);
+	} else if ( __node_rename_at_854->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		builtin_print(((char *) "Union\n"),__context__);
+		{
+			bool __need_loop_900 = true;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<struct regex::ReNode *> const > __sub_iterator(__node_rename_at_854->all);
+			struct regex::ReNode * const  * __sub_rename_at_900;
+			__need_loop_900 = __sub_iterator.first(__context__,(__sub_rename_at_900)) && __need_loop_900;
+			for ( ; __need_loop_900 ; __need_loop_900 = __sub_iterator.next(__context__,(__sub_rename_at_900)) )
+			{
+				builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_6, cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_854,__context__)))))),__context__);
+				debug_re_7cf48f46d0970cb7(__context__,(*__sub_rename_at_900),__tab_rename_at_854 + 1);
+				builtin_print(((char *) "\n"),__context__);
+			}
+			__sub_iterator.close(__context__,(__sub_rename_at_900));
+		};
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_854 - 1,__context__)))), cast<char * const >::from(((char *) ")")))),__context__);
+	} else {
+		builtin_throw(((char *) "unsupported op"),__context__);
+	};
+}
+
+inline void debug_set_9e4757c00b2a92ec ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_845 )
+{
+	{
+		bool __need_loop_846 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,256));
+		int32_t __x_rename_at_846;
+		__need_loop_846 = __x_iterator.first(__context__,(__x_rename_at_846)) && __need_loop_846;
+		for ( ; __need_loop_846 ; __need_loop_846 = __x_iterator.next(__context__,(__x_rename_at_846)) )
+		{
+			if ( (__cset_rename_at_845((__x_rename_at_846 >> 5),__context__) & uint32_t(1 << (__x_rename_at_846 & 31))) != 0x0u )
+			{
+				if ( (__x_rename_at_846 >= 32) && (__x_rename_at_846 <= 127) )
+				{
+					builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<char *>::from(((char *)(to_string_char(__x_rename_at_846,__context__)))))),__context__);
+				} else {
+					builtin_print(((char *) "{x}"),__context__);
+				};
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_846));
+	};
+}
+
+inline bool eos_77a77ef5845fccf8 ( Context * __context__, char * const  __expr_rename_at_97, int32_t __offset_rename_at_97 )
+{
+	return __offset_rename_at_97 >= builtin_string_length(__expr_rename_at_97,__context__);
+}
+
+inline void finalize_b321625d5d1ae328 ( Context * __context__, struct regex::ReNode * & ____this_rename_at_302 )
+{
+	if ( ____this_rename_at_302 != nullptr )
+	{
+		finalize_4b5b3ac4f531983c(__context__,das_arg<struct regex::ReNode>::pass(das_deref(__context__,____this_rename_at_302)));
+		das_delete<struct regex::ReNode *>::clear(__context__,____this_rename_at_302);
+		das_copy(____this_rename_at_302,nullptr);
+	};
+}
+
+inline void finalize_99d8b8a6e8d8847f ( Context * __context__, TVariant<16,struct regex::ReNode *,void *> &  ____this_rename_at_302 )
+{
+	if ( das_get_variant_field<struct regex::ReNode *,8,0>::is(____this_rename_at_302) )
+	{
+		finalize_b321625d5d1ae328(__context__,das_get_variant_field<struct regex::ReNode *,8,0>::get(____this_rename_at_302));
+	};
+	memset(&(____this_rename_at_302), 0, 16);
+}
+
+inline void finalize_4b5b3ac4f531983c ( Context * __context__, struct regex::ReNode &  ____this_rename_at_22 )
+{
+	_Funcbuiltin_0x60_finalize_dd8c5cab6f6afc46(__context__,das_arg<TArray<struct regex::ReNode *>>::pass(____this_rename_at_22.all));
+	finalize_b321625d5d1ae328(__context__,____this_rename_at_22.left);
+	finalize_b321625d5d1ae328(__context__,____this_rename_at_22.right);
+	finalize_b321625d5d1ae328(__context__,____this_rename_at_22.subexpr);
+	finalize_b321625d5d1ae328(__context__,____this_rename_at_22.next);
+	memset(&(____this_rename_at_22), 0, 144);
+}
+
+inline bool is_meta_character_9e5a1eca7384b1f ( Context * __context__, int32_t __ch_rename_at_173 )
+{
+	return builtin_find_first_char_of(((char *) "\\+-*.()[]|^"),__ch_rename_at_173,__context__) != -1;
+}
+
+inline bool is_set_character_77a3c75117a26e66 ( Context * __context__, int32_t __ch_rename_at_177 )
+{
+	return builtin_find_first_char_of(((char *) "wW"),__ch_rename_at_177,__context__) != -1;
+}
+
+inline bool is_set_empty_ccd4b091eb82a1dd ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_124 )
+{
+	{
+		bool __need_loop_125 = true;
+		// x : uint aka CharSet const&
+		das_iterator<TDim<uint32_t,8> const > __x_iterator(__cset_rename_at_124);
+		uint32_t const  * __x_rename_at_125;
+		__need_loop_125 = __x_iterator.first(__context__,(__x_rename_at_125)) && __need_loop_125;
+		for ( ; __need_loop_125 ; __need_loop_125 = __x_iterator.next(__context__,(__x_rename_at_125)) )
+		{
+			if ( (*__x_rename_at_125) != 0x0u )
+			{
+				return false;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_125));
+	};
+	return true;
+}
+
+inline bool is_valid_13f013884e52501b ( Context * __context__, struct regex::Regex &  __re_rename_at_748 )
+{
+	return __re_rename_at_748.root != nullptr;
+}
+
+inline TVariant<16,struct regex::ReNode *,void *> maybe_9a67bfcd21418f2b ( Context * __context__, struct regex::ReNode * const  __value_rename_at_92 )
+{
+	return (([&]() -> TVariant<16,struct regex::ReNode *,void *> {
+		TVariant<16,struct regex::ReNode *,void *> __mkv_94;
+		das_get_variant_field<struct regex::ReNode *,8,0>::set(__mkv_94) = __value_rename_at_92;
+		return __mkv_94;
+	})());
+}
+
+inline struct regex::ReNode * mk_concat_9566cb5dde2eb2a8 ( Context * __context__, struct regex::ReNode * __left_rename_at_330, struct regex::ReNode * __right_rename_at_330 )
+{
+	if ( __left_rename_at_330 == nullptr )
+	{
+		return __right_rename_at_330;
+	} else if ( (__left_rename_at_330->op == DAS_COMMENT(enum) regex::ReOp::Char) && (__right_rename_at_330->op == DAS_COMMENT(enum) regex::ReOp::Char) )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_330->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_330->at) /*y*/);
+		SimPolicy<char *>::SetAdd((char *)&(__left_rename_at_330->text),cast<char *>::from(__right_rename_at_330->text),*__context__);
+		__left_rename_at_330->textLen += __right_rename_at_330->textLen;
+		finalize_b321625d5d1ae328(__context__,__right_rename_at_330);
+		return __left_rename_at_330;
+	} else if ( ((__left_rename_at_330->op == DAS_COMMENT(enum) regex::ReOp::Concat) && (__left_rename_at_330->right->op == DAS_COMMENT(enum) regex::ReOp::Char)) && (__right_rename_at_330->op == DAS_COMMENT(enum) regex::ReOp::Char) )
+	{
+		struct regex::ReNode * __lor_rename_at_342 = __left_rename_at_330->right;
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_330->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_330->at) /*y*/);
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__lor_rename_at_342->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_330->at) /*y*/);
+		SimPolicy<char *>::SetAdd((char *)&(__lor_rename_at_342->text),cast<char *>::from(__right_rename_at_330->text),*__context__);
+		__lor_rename_at_342->textLen += __right_rename_at_330->textLen;
+		finalize_b321625d5d1ae328(__context__,__right_rename_at_330);
+		return __left_rename_at_330;
+	} else {
+		return das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+			struct regex::ReNode __mks_350;
+			das_zero(__mks_350);
+			das_copy((__mks_350.op),(DAS_COMMENT(enum) regex::ReOp::Concat));
+			das_copy((__mks_350.left),(__left_rename_at_330));
+			das_copy((__mks_350.right),(__right_rename_at_330));
+			das_copy((__mks_350.at),(range(v_extract_xi(v_cast_vec4i(__left_rename_at_330->at)) /*x*/,v_extract_yi(v_cast_vec4i(__right_rename_at_330->at)) /*y*/)));
+			return __mks_350;
+		})()));
+	};
+}
+
+inline struct regex::ReNode * mk_union_8b47f400ee527052 ( Context * __context__, struct regex::ReNode * __left_rename_at_353, struct regex::ReNode * __right_rename_at_353 )
+{
+	if ( __left_rename_at_353->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_353->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_353->at) /*y*/);
+		if ( __right_rename_at_353->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			{
+				bool __need_loop_357 = true;
+				// x : regex::ReNode?&
+				das_iterator<TArray<struct regex::ReNode *>> __x_iterator(__right_rename_at_353->all);
+				struct regex::ReNode * * __x_rename_at_357;
+				__need_loop_357 = __x_iterator.first(__context__,(__x_rename_at_357)) && __need_loop_357;
+				for ( ; __need_loop_357 ; __need_loop_357 = __x_iterator.next(__context__,(__x_rename_at_357)) )
+				{
+					_Funcbuiltin_0x60_push_3fdf4fc723ad236a(__context__,das_arg<TArray<struct regex::ReNode *>>::pass(__left_rename_at_353->all),(*__x_rename_at_357),-1);
+				}
+				__x_iterator.close(__context__,(__x_rename_at_357));
+			};
+			finalize_b321625d5d1ae328(__context__,__right_rename_at_353);
+		} else {
+			_Funcbuiltin_0x60_push_3fdf4fc723ad236a(__context__,das_arg<TArray<struct regex::ReNode *>>::pass(__left_rename_at_353->all),__right_rename_at_353,-1);
+		};
+		return __left_rename_at_353;
+	} else if ( __right_rename_at_353->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,0>::swizzle(__right_rename_at_353->at) /*x*/,das_swizzle_ref<int32_t,range,0>::swizzle(__left_rename_at_353->at) /*x*/);
+		_Funcbuiltin_0x60_push_3fdf4fc723ad236a(__context__,das_arg<TArray<struct regex::ReNode *>>::pass(__right_rename_at_353->all),__left_rename_at_353,-1);
+		return __right_rename_at_353;
+	} else {
+		TDim<struct regex::ReNode *,2> _temp_make_local_368_64;
+		return das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+			struct regex::ReNode __mks_368;
+			das_zero(__mks_368);
+			das_copy((__mks_368.op),(DAS_COMMENT(enum) regex::ReOp::Union));
+			das_move((__mks_368.all),(_Funcbuiltin_0x60_to_array_move_55ba84047fc802d6(__context__,das_arg<TDim<struct regex::ReNode *,2>>::pass((([&]() -> TDim<struct regex::ReNode *,2>& {
+				_temp_make_local_368_64(0,__context__) = __left_rename_at_353;
+				_temp_make_local_368_64(1,__context__) = __right_rename_at_353;
+				return _temp_make_local_368_64;
+			})())))));
+			das_copy((__mks_368.at),(range(v_extract_xi(v_cast_vec4i(__left_rename_at_353->at)) /*x*/,v_extract_yi(v_cast_vec4i(__right_rename_at_353->at)) /*y*/)));
+			return __mks_368;
+		})()));
+	};
+}
+
+inline TVariant<16,struct regex::ReNode *,void *> nada_e26047260042fc86 ( Context * __context__ )
+{
+	return (([&]() -> TVariant<16,struct regex::ReNode *,void *> {
+		TVariant<16,struct regex::ReNode *,void *> __mkv_89;
+		das_get_variant_field<void *,8,1>::set(__mkv_89) = nullptr;
+		return __mkv_89;
+	})());
+}
+
+inline int32_t next_ed40d1d5d47c8ce0 ( Context * __context__, TVariant<16,struct regex::ReNode *,void *> const  &  __re_rename_at_117 )
+{
+	if ( !das_get_variant_field<struct regex::ReNode *,8,0>::is(__re_rename_at_117) )
+	{
+		builtin_stackwalk(__context__,nullptr);
+		builtin_throw(((char *) "expecting value"),__context__);
+	};
+	return v_extract_yi(v_cast_vec4i(das_get_variant_field<struct regex::ReNode *,8,0>::as(__re_rename_at_117,__context__)->at)) /*y*/;
+}
+
+inline TVariant<16,struct regex::ReNode *,void *> re_any_a9b85795201936a3 ( Context * __context__, char * const  __expr_rename_at_272, int32_t __offset_rename_at_272 )
+{
+	TVariant<16,struct regex::ReNode *,void *> _temp_make_local_275_32;
+	TVariant<16,struct regex::ReNode *,void *> _temp_make_local_277_48;
+	TVariant<16,struct regex::ReNode *,void *> _temp_make_local_278_80;
+	return eos_77a77ef5845fccf8(__context__,__expr_rename_at_272,__offset_rename_at_272) ? ((_temp_make_local_275_32 = (nada_e26047260042fc86(__context__)))) : (((at_c9bade5ff7edd57d(__context__,__expr_rename_at_272,__offset_rename_at_272) == 46) ? ((_temp_make_local_277_48 = (maybe_9a67bfcd21418f2b(__context__,das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+		struct regex::ReNode __mks_277;
+		das_zero(__mks_277);
+		das_copy((__mks_277.op),(DAS_COMMENT(enum) regex::ReOp::Any));
+		das_copy((__mks_277.at),(range(__offset_rename_at_272,__offset_rename_at_272 + 1)));
+		return __mks_277;
+	})())))))) : ((_temp_make_local_278_80 = (nada_e26047260042fc86(__context__))))));
+}
+
+inline void re_assign_groups_9ac5348360243c9a ( Context * __context__, struct regex::Regex &  __re_rename_at_458 ) { das_stack_prologue __prologue(__context__,144,"re_assign_groups " DAS_FILE_LINE);
+{
+	TTuple<16,range,char *> _temp_make_local_459_32;
+	_Funcbuiltin_0x60_push_40551da8a4209c68(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_458.groups),das_arg<TTuple<16,range,char *>>::pass((([&]() -> TTuple<16,range,char *>& {
+		das_get_tuple_field<range,0>::get(_temp_make_local_459_32) = range(0,0);
+		das_get_tuple_field<char *,8>::get(_temp_make_local_459_32) = ((char *) "");
+		return _temp_make_local_459_32;
+	})())),-1);
+	visit_top_down_1f42d2ae2c877acf(__context__,__re_rename_at_458.root,das_make_block<void,struct regex::ReNode *>(__context__,96,0,&__func_info__d2e1683e,[&](struct regex::ReNode * __node_rename_at_460)->void{
+		if ( __node_rename_at_460->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			TTuple<16,range,char *> _temp_make_local_464_128;
+			int32_t __index_rename_at_462 = (int32_t)builtin_array_size(das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_458.groups));
+			das_copy(__node_rename_at_460->index,__index_rename_at_462);
+			_Funcbuiltin_0x60_push_40551da8a4209c68(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_458.groups),das_arg<TTuple<16,range,char *>>::pass((([&]() -> TTuple<16,range,char *>& {
+				das_get_tuple_field<range,0>::get(_temp_make_local_464_128) = range(0,0);
+				das_get_tuple_field<char *,8>::get(_temp_make_local_464_128) = das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_9, cast<int32_t>::from(__index_rename_at_462)));
+				return _temp_make_local_464_128;
+			})())),-1);
+		};
+	}));
+}}
+
+inline void re_assign_match_functions_b3e7e37087621da7 ( Context * __context__, struct regex::Regex &  __re_rename_at_471 ) { das_stack_prologue __prologue(__context__,96,"re_assign_match_functions " DAS_FILE_LINE);
+{
+	visit_top_down_1f42d2ae2c877acf(__context__,__re_rename_at_471.root,das_make_block<void,struct regex::ReNode *>(__context__,80,0,&__func_info__d2e1683e,[&](struct regex::ReNode * __node_rename_at_472)->void{
+		if ( __node_rename_at_472->op == DAS_COMMENT(enum) regex::ReOp::Char )
+		{
+			if ( __node_rename_at_472->textLen == 1 )
+			{
+				das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_single_char Regex #ptr#ReNode #ptr#uint8#const*/ 3226839771u)));
+			} else {
+				das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_char Regex #ptr#ReNode #ptr#uint8#const*/ 3089601592u)));
+			};
+		} else if ( __node_rename_at_472->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_union Regex #ptr#ReNode #ptr#uint8#const*/ 1207848181u)));
+		} else if ( __node_rename_at_472->op == DAS_COMMENT(enum) regex::ReOp::Set )
+		{
+			das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_set Regex #ptr#ReNode #ptr#uint8#const*/ 2850924220u)));
+		} else if ( __node_rename_at_472->op == DAS_COMMENT(enum) regex::ReOp::Any )
+		{
+			das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_any Regex #ptr#ReNode #ptr#uint8#const*/ 657129790u)));
+		} else if ( __node_rename_at_472->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+		{
+			das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_eos Regex #ptr#ReNode #ptr#uint8#const*/ 2101372619u)));
+		} else if ( __node_rename_at_472->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+		{
+			das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_concat Regex #ptr#ReNode #ptr#uint8#const*/ 1497369900u)));
+		} else if ( __node_rename_at_472->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+		{
+			if ( __node_rename_at_472->subexpr->op == DAS_COMMENT(enum) regex::ReOp::Set )
+			{
+				das_copy(__node_rename_at_472->cset,__node_rename_at_472->subexpr->cset);
+				das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_plus_set Regex #ptr#ReNode #ptr#uint8#const*/ 3835863389u)));
+			} else {
+				das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_plus Regex #ptr#ReNode #ptr#uint8#const*/ 3049769048u)));
+			};
+			das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_plus Regex #ptr#ReNode #ptr#uint8#const*/ 3049769048u)));
+		} else if ( __node_rename_at_472->op == DAS_COMMENT(enum) regex::ReOp::Star )
+		{
+			das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_star Regex #ptr#ReNode #ptr#uint8#const*/ 2464857604u)));
+		} else if ( __node_rename_at_472->op == DAS_COMMENT(enum) regex::ReOp::Question )
+		{
+			das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_question Regex #ptr#ReNode #ptr#uint8#const*/ 134306708u)));
+		} else if ( __node_rename_at_472->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			das_copy(__node_rename_at_472->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_group Regex #ptr#ReNode #ptr#uint8#const*/ 3941244897u)));
+		} else {
+			builtin_throw(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_10, cast<char * const >::from(((char *) "unsupported ")), cast<DAS_COMMENT(enum) regex::ReOp>::from(__node_rename_at_472->op))),__context__);
+		};
+	}));
+}}
+
+inline void re_assign_next_3cbb830952003b86 ( Context * __context__, struct regex::Regex &  __re_rename_at_444 ) { das_stack_prologue __prologue(__context__,128,"re_assign_next " DAS_FILE_LINE);
+{
+	int32_t __id_rename_at_445 = 0;
+	visit_top_down_1f42d2ae2c877acf(__context__,__re_rename_at_444.root,das_make_block<void,struct regex::ReNode *>(__context__,96,0,&__func_info__d2e1683e,[&](struct regex::ReNode * __node_rename_at_446)->void{
+		das_copy(__node_rename_at_446->id,__id_rename_at_445++);
+		if ( __node_rename_at_446->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+		{
+			das_copy(__node_rename_at_446->left->next,__node_rename_at_446->right);
+			das_copy(__node_rename_at_446->right->next,__node_rename_at_446->next);
+		} else if ( __node_rename_at_446->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			das_copy(__node_rename_at_446->subexpr->next,__node_rename_at_446->next);
+		} else if ( __node_rename_at_446->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			{
+				bool __need_loop_454 = true;
+				// sub : regex::ReNode?&
+				das_iterator<TArray<struct regex::ReNode *>> __sub_iterator(__node_rename_at_446->all);
+				struct regex::ReNode * * __sub_rename_at_454;
+				__need_loop_454 = __sub_iterator.first(__context__,(__sub_rename_at_454)) && __need_loop_454;
+				for ( ; __need_loop_454 ; __need_loop_454 = __sub_iterator.next(__context__,(__sub_rename_at_454)) )
+				{
+					das_copy((*__sub_rename_at_454)->next,__node_rename_at_446->next);
+				}
+				__sub_iterator.close(__context__,(__sub_rename_at_454));
+			};
+		};
+	}));
+}}
+
+inline TVariant<16,struct regex::ReNode *,void *> re_basic_c3370642f80cb146 ( Context * __context__, char * const  __expr_rename_at_404, int32_t __offset_rename_at_404 )
+{
+	if ( eos_77a77ef5845fccf8(__context__,__expr_rename_at_404,__offset_rename_at_404) )
+	{
+		return nada_e26047260042fc86(__context__);
+	} else {
+		TVariant<16,struct regex::ReNode *,void *> __oelem_rename_at_408 = re_elementary_ea025bf992c116ee(__context__,__expr_rename_at_404,__offset_rename_at_404);
+		if ( das_get_variant_field<void *,8,1>::is(__oelem_rename_at_408) )
+		{
+			return nada_e26047260042fc86(__context__);
+		} else {
+			int32_t __ch_rename_at_411 = (int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_404,next_ed40d1d5d47c8ce0(__context__,das_arg<TVariant<16,struct regex::ReNode *,void *>>::pass(__oelem_rename_at_408)));
+			if ( __ch_rename_at_411 == 42 )
+			{
+				return maybe_9a67bfcd21418f2b(__context__,das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+					struct regex::ReNode __mks_413;
+					das_zero(__mks_413);
+					das_copy((__mks_413.op),(DAS_COMMENT(enum) regex::ReOp::Star));
+					das_copy((__mks_413.subexpr),(das_get_variant_field<struct regex::ReNode *,8,0>::as(__oelem_rename_at_408,__context__)));
+					das_copy((__mks_413.at),(range(__offset_rename_at_404,next_ed40d1d5d47c8ce0(__context__,das_arg<TVariant<16,struct regex::ReNode *,void *>>::pass(__oelem_rename_at_408)) + 1)));
+					return __mks_413;
+				})())));
+			} else if ( __ch_rename_at_411 == 43 )
+			{
+				return maybe_9a67bfcd21418f2b(__context__,das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+					struct regex::ReNode __mks_415;
+					das_zero(__mks_415);
+					das_copy((__mks_415.op),(DAS_COMMENT(enum) regex::ReOp::Plus));
+					das_copy((__mks_415.subexpr),(das_get_variant_field<struct regex::ReNode *,8,0>::as(__oelem_rename_at_408,__context__)));
+					das_copy((__mks_415.at),(range(__offset_rename_at_404,next_ed40d1d5d47c8ce0(__context__,das_arg<TVariant<16,struct regex::ReNode *,void *>>::pass(__oelem_rename_at_408)) + 1)));
+					return __mks_415;
+				})())));
+			} else if ( __ch_rename_at_411 == 63 )
+			{
+				return maybe_9a67bfcd21418f2b(__context__,das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+					struct regex::ReNode __mks_417;
+					das_zero(__mks_417);
+					das_copy((__mks_417.op),(DAS_COMMENT(enum) regex::ReOp::Question));
+					das_copy((__mks_417.subexpr),(das_get_variant_field<struct regex::ReNode *,8,0>::as(__oelem_rename_at_408,__context__)));
+					das_copy((__mks_417.at),(range(__offset_rename_at_404,next_ed40d1d5d47c8ce0(__context__,das_arg<TVariant<16,struct regex::ReNode *,void *>>::pass(__oelem_rename_at_408)) + 1)));
+					return __mks_417;
+				})())));
+			};
+			return __oelem_rename_at_408;
+		};
+	};
+}
+
+inline TVariant<16,struct regex::ReNode *,void *> re_char_cc7fcf1004fb0a5b ( Context * __context__, char * const  __expr_rename_at_182, int32_t __offset_rename_at_182 )
+{
+	if ( eos_77a77ef5845fccf8(__context__,__expr_rename_at_182,__offset_rename_at_182) )
+	{
+		return nada_e26047260042fc86(__context__);
+	} else {
+		int32_t __ch_rename_at_186 = (int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_182,__offset_rename_at_182);
+		if ( __ch_rename_at_186 == 92 )
+		{
+			int32_t __ech_rename_at_188 = (int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_182,__offset_rename_at_182 + 1);
+			if ( __ech_rename_at_188 == 0 )
+			{
+				return nada_e26047260042fc86(__context__);
+			} else {
+				if ( is_set_character_77a3c75117a26e66(__context__,__ech_rename_at_188) )
+				{
+					TDim<uint32_t,8> __cset_rename_at_193; das_zero(__cset_rename_at_193);
+					set_meta_54cf3cdb21046a26(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_193),__ech_rename_at_188);
+					return maybe_9a67bfcd21418f2b(__context__,das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+						struct regex::ReNode __mks_195;
+						das_zero(__mks_195);
+						das_copy((__mks_195.op),(DAS_COMMENT(enum) regex::ReOp::Set));
+						das_copy((__mks_195.cset),(__cset_rename_at_193));
+						das_copy((__mks_195.at),(range(__offset_rename_at_182,__offset_rename_at_182 + 2)));
+						return __mks_195;
+					})())));
+				} else {
+					return maybe_9a67bfcd21418f2b(__context__,das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+						struct regex::ReNode __mks_196;
+						das_zero(__mks_196);
+						das_copy((__mks_196.op),(DAS_COMMENT(enum) regex::ReOp::Char));
+						das_copy((__mks_196.text),(((char *)(to_string_char(__ech_rename_at_188,__context__)))));
+						das_copy((__mks_196.textLen),(1));
+						das_copy((__mks_196.at),(range(__offset_rename_at_182,__offset_rename_at_182 + 2)));
+						return __mks_196;
+					})())));
+				};
+			};
+		} else if ( is_meta_character_9e5a1eca7384b1f(__context__,__ch_rename_at_186) )
+		{
+			return nada_e26047260042fc86(__context__);
+		};
+		return maybe_9a67bfcd21418f2b(__context__,das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+			struct regex::ReNode __mks_199;
+			das_zero(__mks_199);
+			das_copy((__mks_199.op),(DAS_COMMENT(enum) regex::ReOp::Char));
+			das_copy((__mks_199.text),(((char *)(to_string_char(__ch_rename_at_186,__context__)))));
+			das_copy((__mks_199.textLen),(1));
+			das_copy((__mks_199.at),(range(__offset_rename_at_182,__offset_rename_at_182 + 1)));
+			return __mks_199;
+		})())));
+	};
+}
+
+inline bool re_early_out_c0e6ee8919572965 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_708, struct regex::ReNode * const  __node_rename_at_708 )
+{
+	if ( __node_rename_at_708->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		set_or_char_3ae19d169cde2ccb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_708),get_character_at(__node_rename_at_708->text,0,__context__));
+		return false;
+	} else if ( __node_rename_at_708->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		set_or_set_d9bfd2cba9b16ba5(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_708),__node_rename_at_708->cset);
+		return false;
+	} else if ( __node_rename_at_708->op == DAS_COMMENT(enum) regex::ReOp::Any )
+	{
+		{
+			bool __need_loop_716 = true;
+			// x : uint aka CharSet& -const
+			das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_708);
+			uint32_t * __x_rename_at_716;
+			__need_loop_716 = __x_iterator.first(__context__,(__x_rename_at_716)) && __need_loop_716;
+			for ( ; __need_loop_716 ; __need_loop_716 = __x_iterator.next(__context__,(__x_rename_at_716)) )
+			{
+				das_copy((*__x_rename_at_716),0xffffffffu);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_716));
+		};
+		return false;
+	} else if ( __node_rename_at_708->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+	{
+		return false;
+	} else if ( __node_rename_at_708->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		return re_early_out_c0e6ee8919572965(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_708),__node_rename_at_708->subexpr);
+	} else if ( __node_rename_at_708->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+	{
+		return re_early_out_c0e6ee8919572965(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_708),__node_rename_at_708->subexpr);
+	} else if ( __node_rename_at_708->op == DAS_COMMENT(enum) regex::ReOp::Star )
+	{
+		re_early_out_c0e6ee8919572965(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_708),__node_rename_at_708->subexpr);
+		return true;
+	} else if ( __node_rename_at_708->op == DAS_COMMENT(enum) regex::ReOp::Question )
+	{
+		re_early_out_c0e6ee8919572965(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_708),__node_rename_at_708->subexpr);
+		return true;
+	} else if ( __node_rename_at_708->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		bool __left_rename_at_732 = (bool)re_early_out_c0e6ee8919572965(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_708),__node_rename_at_708->left);
+		return __left_rename_at_732 ? (re_early_out_c0e6ee8919572965(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_708),__node_rename_at_708->right)) : (false);
+	} else if ( __node_rename_at_708->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		bool __any_rename_at_735 = false;
+		{
+			bool __need_loop_736 = true;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<struct regex::ReNode *> const > __sub_iterator(__node_rename_at_708->all);
+			struct regex::ReNode * const  * __sub_rename_at_736;
+			__need_loop_736 = __sub_iterator.first(__context__,(__sub_rename_at_736)) && __need_loop_736;
+			for ( ; __need_loop_736 ; __need_loop_736 = __sub_iterator.next(__context__,(__sub_rename_at_736)) )
+			{
+				das_copy(__any_rename_at_735,re_early_out_c0e6ee8919572965(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_708),(*__sub_rename_at_736)) || __any_rename_at_735);
+			}
+			__sub_iterator.close(__context__,(__sub_rename_at_736));
+		};
+		return __any_rename_at_735;
+	} else {
+		builtin_throw(((char *) "unsupported operation"),__context__);
+		return false;
+	};
+}
+
+inline TVariant<16,struct regex::ReNode *,void *> re_elementary_ea025bf992c116ee ( Context * __context__, char * const  __expr_rename_at_308, int32_t __offset_rename_at_308 )
+{
+	if ( eos_77a77ef5845fccf8(__context__,__expr_rename_at_308,__offset_rename_at_308) )
+	{
+		return nada_e26047260042fc86(__context__);
+	} else {
+		TVariant<16,struct regex::ReNode *,void *> __ogr_rename_at_312 = re_group_48dd14ed9a44d9f3(__context__,__expr_rename_at_308,__offset_rename_at_308);
+		if ( das_get_variant_field<struct regex::ReNode *,8,0>::is(__ogr_rename_at_312) )
+		{
+			return __ogr_rename_at_312;
+		} else {
+			TVariant<16,struct regex::ReNode *,void *> __oany_rename_at_315 = re_any_a9b85795201936a3(__context__,__expr_rename_at_308,__offset_rename_at_308);
+			if ( das_get_variant_field<struct regex::ReNode *,8,0>::is(__oany_rename_at_315) )
+			{
+				return __oany_rename_at_315;
+			} else {
+				TVariant<16,struct regex::ReNode *,void *> __oeos_rename_at_318 = re_eos_2da6bc306bcf43b0(__context__,__expr_rename_at_308,__offset_rename_at_308);
+				if ( das_get_variant_field<struct regex::ReNode *,8,0>::is(__oeos_rename_at_318) )
+				{
+					return __oeos_rename_at_318;
+				} else {
+					TVariant<16,struct regex::ReNode *,void *> __oset_rename_at_321 = re_set_2fe7c33ed9dcf01c(__context__,__expr_rename_at_308,__offset_rename_at_308);
+					if ( das_get_variant_field<struct regex::ReNode *,8,0>::is(__oset_rename_at_321) )
+					{
+						return __oset_rename_at_321;
+					} else {
+						TVariant<16,struct regex::ReNode *,void *> _temp_make_local_327_112;
+						TVariant<16,struct regex::ReNode *,void *> __ochr_rename_at_324 = re_char_cc7fcf1004fb0a5b(__context__,__expr_rename_at_308,__offset_rename_at_308);
+						return das_get_variant_field<struct regex::ReNode *,8,0>::is(__ochr_rename_at_324) ? (__ochr_rename_at_324) : ((_temp_make_local_327_112 = (nada_e26047260042fc86(__context__))));
+					};
+				};
+			};
+		};
+	};
+}
+
+inline TVariant<16,struct regex::ReNode *,void *> re_eos_2da6bc306bcf43b0 ( Context * __context__, char * const  __expr_rename_at_282, int32_t __offset_rename_at_282 )
+{
+	TVariant<16,struct regex::ReNode *,void *> _temp_make_local_285_32;
+	TVariant<16,struct regex::ReNode *,void *> _temp_make_local_287_48;
+	TVariant<16,struct regex::ReNode *,void *> _temp_make_local_288_80;
+	return eos_77a77ef5845fccf8(__context__,__expr_rename_at_282,__offset_rename_at_282) ? ((_temp_make_local_285_32 = (nada_e26047260042fc86(__context__)))) : (((at_c9bade5ff7edd57d(__context__,__expr_rename_at_282,__offset_rename_at_282) == 36) ? ((_temp_make_local_287_48 = (maybe_9a67bfcd21418f2b(__context__,das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+		struct regex::ReNode __mks_287;
+		das_zero(__mks_287);
+		das_copy((__mks_287.op),(DAS_COMMENT(enum) regex::ReOp::Eos));
+		das_copy((__mks_287.at),(range(__offset_rename_at_282,__offset_rename_at_282 + 1)));
+		return __mks_287;
+	})())))))) : ((_temp_make_local_288_80 = (nada_e26047260042fc86(__context__))))));
+}
+
+inline TVariant<16,struct regex::ReNode *,void *> re_group_48dd14ed9a44d9f3 ( Context * __context__, char * const  __expr_rename_at_292, int32_t __offset_rename_at_292 )
+{
+	if ( eos_77a77ef5845fccf8(__context__,__expr_rename_at_292,__offset_rename_at_292) )
+	{
+		return nada_e26047260042fc86(__context__);
+	} else {
+		if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_292,__offset_rename_at_292) != 40 )
+		{
+			return nada_e26047260042fc86(__context__);
+		} else {
+			TVariant<16,struct regex::ReNode *,void *> __ore_rename_at_298 = re_re_fa81d25275ee5884(__context__,__expr_rename_at_292,__offset_rename_at_292 + 1);
+			if ( das_get_variant_field<void *,8,1>::is(__ore_rename_at_298) )
+			{
+				return nada_e26047260042fc86(__context__);
+			} else {
+				if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_292,next_ed40d1d5d47c8ce0(__context__,das_arg<TVariant<16,struct regex::ReNode *,void *>>::pass(__ore_rename_at_298))) != 41 )
+				{
+					finalize_99d8b8a6e8d8847f(__context__,das_arg<TVariant<16,struct regex::ReNode *,void *>>::pass(__ore_rename_at_298));
+					return nada_e26047260042fc86(__context__);
+				} else {
+					return maybe_9a67bfcd21418f2b(__context__,das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+						struct regex::ReNode __mks_304;
+						das_zero(__mks_304);
+						das_copy((__mks_304.op),(DAS_COMMENT(enum) regex::ReOp::Group));
+						das_copy((__mks_304.subexpr),(das_get_variant_field<struct regex::ReNode *,8,0>::as(__ore_rename_at_298,__context__)));
+						das_copy((__mks_304.at),(range(__offset_rename_at_292,next_ed40d1d5d47c8ce0(__context__,das_arg<TVariant<16,struct regex::ReNode *,void *>>::pass(__ore_rename_at_298)) + 1)));
+						return __mks_304;
+					})())));
+				};
+			};
+		};
+	};
+}
+
+inline uint8_t * re_match2_any_e94ab3d7d8964629 ( Context * __context__, struct regex::Regex &  __regex_rename_at_561, struct regex::ReNode * __node_rename_at_561, uint8_t * const  __str_rename_at_561 )
+{
+	if ( int32_t((*(__str_rename_at_561))) == 0 )
+	{
+		return nullptr;
+	} else {
+		uint8_t * __tail_rename_at_567 = das_ptr_add(__str_rename_at_561,1,1);
+		das_copy(__node_rename_at_561->tail,__tail_rename_at_567);
+		struct regex::ReNode * __node2_rename_at_569 = __node_rename_at_561->next;
+		return (__node2_rename_at_569 != nullptr) ? (das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_569->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_561),__node2_rename_at_569,__tail_rename_at_567)) : (__tail_rename_at_567);
+	};
+}
+
+inline uint8_t * re_match2_char_db8d3f11c0c117b9 ( Context * __context__, struct regex::Regex &  __regex_rename_at_520, struct regex::ReNode * __node_rename_at_520, uint8_t * const  __str_rename_at_520 )
+{
+	if ( das_memcmp(das_cast<uint8_t *>::cast(__node_rename_at_520->text),__str_rename_at_520,__node_rename_at_520->textLen) != 0 )
+	{
+		return nullptr;
+	} else {
+		uint8_t * __tail_rename_at_526 = das_ptr_add(__str_rename_at_520,__node_rename_at_520->textLen,1);
+		das_copy(__node_rename_at_520->tail,__tail_rename_at_526);
+		struct regex::ReNode * __node2_rename_at_528 = __node_rename_at_520->next;
+		return (__node2_rename_at_528 != nullptr) ? (das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_528->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_520),__node2_rename_at_528,__tail_rename_at_526)) : (__tail_rename_at_526);
+	};
+}
+
+inline uint8_t * re_match2_concat_51a6261aee4576ab ( Context * __context__, struct regex::Regex &  __regex_rename_at_576, struct regex::ReNode * __node_rename_at_576, uint8_t * const  __str_rename_at_576 )
+{
+	struct regex::ReNode * __left_rename_at_579 = __node_rename_at_576->left;
+	uint8_t * __oleft_rename_at_580 = (uint8_t *)das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t * const >(__context__,__left_rename_at_579->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_576),__left_rename_at_579,__str_rename_at_576);
+	if ( __oleft_rename_at_580 == nullptr )
+	{
+		return nullptr;
+	} else {
+		das_copy(__node_rename_at_576->tail,__node_rename_at_576->right->tail);
+		return __oleft_rename_at_580;
+	};
+}
+
+inline uint8_t * re_match2_eos_95cec9bf71f3f1d8 ( Context * __context__, struct regex::Regex &  __regex_rename_at_587, struct regex::ReNode * __node_rename_at_587, uint8_t * const  __str_rename_at_587 )
+{
+	if ( int32_t((*(__str_rename_at_587))) != 0 )
+	{
+		return nullptr;
+	} else {
+		das_copy(__node_rename_at_587->tail,__str_rename_at_587);
+		struct regex::ReNode * __node2_rename_at_593 = __node_rename_at_587->next;
+		return (__node2_rename_at_593 != nullptr) ? (das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t * const >(__context__,__node2_rename_at_593->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_587),__node2_rename_at_593,__str_rename_at_587)) : (__str_rename_at_587);
+	};
+}
+
+inline uint8_t * re_match2_group_2a22c466440843aa ( Context * __context__, struct regex::Regex &  __regex_rename_at_694, struct regex::ReNode * __node_rename_at_694, uint8_t * const  __str_rename_at_694 )
+{
+	struct regex::ReNode * __nsub_rename_at_697 = __node_rename_at_694->subexpr;
+	uint8_t * __osub_rename_at_698 = (uint8_t *)das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t * const >(__context__,__nsub_rename_at_697->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_694),__nsub_rename_at_697,__str_rename_at_694);
+	if ( __osub_rename_at_698 == nullptr )
+	{
+		return nullptr;
+	} else {
+		das_copy(das_get_tuple_field<range,0>::get(__regex_rename_at_694.groups(__node_rename_at_694->index,__context__)),range(int32_t(i_das_ptr_diff(__str_rename_at_694,__regex_rename_at_694.match,1)),int32_t(i_das_ptr_diff(__node_rename_at_694->subexpr->tail,__regex_rename_at_694.match,1))));
+		return __osub_rename_at_698;
+	};
+}
+
+inline uint8_t * re_match2_plus_1e1614cdc46c85c5 ( Context * __context__, struct regex::Regex &  __regex_rename_at_615, struct regex::ReNode * __node_rename_at_615, uint8_t * const  __str_rename_at_615 )
+{
+	struct regex::ReNode * __nsub_rename_at_618 = __node_rename_at_615->subexpr;
+	uint8_t * __osym_rename_at_619 = das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t * const >(__context__,__nsub_rename_at_618->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_615),__nsub_rename_at_618,__str_rename_at_615);
+	if ( __osym_rename_at_619 == nullptr )
+	{
+		return nullptr;
+	} else {
+		uint8_t * __ofs_rename_at_622 = __osym_rename_at_619;
+		struct regex::ReNode * __node2_rename_at_623 = __node_rename_at_615->next;
+		if ( __node2_rename_at_623 != nullptr )
+		{
+			while ( __osym_rename_at_619 != nullptr )
+			{
+				das_copy(__node_rename_at_615->tail,__osym_rename_at_619);
+				uint8_t * __otail_rename_at_627 = das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_623->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_615),__node2_rename_at_623,__osym_rename_at_619);
+				if ( __otail_rename_at_627 != nullptr )
+				{
+					return __otail_rename_at_627;
+				} else {
+					das_copy(__osym_rename_at_619,das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__nsub_rename_at_618->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_615),__nsub_rename_at_618,__osym_rename_at_619));
+				};
+			};
+			return nullptr;
+		} else {
+			while ( __osym_rename_at_619 != nullptr )
+			{
+				das_copy(__ofs_rename_at_622,__osym_rename_at_619);
+				das_copy(__osym_rename_at_619,das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__nsub_rename_at_618->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_615),__nsub_rename_at_618,__ofs_rename_at_622));
+			};
+			das_copy(__node_rename_at_615->tail,__ofs_rename_at_622);
+			return __ofs_rename_at_622;
+		};
+	};
+}
+
+inline uint8_t * re_match2_plus_set_986819b30ab98f26 ( Context * __context__, struct regex::Regex &  __regex_rename_at_640, struct regex::ReNode * __node_rename_at_640, uint8_t * const  __str_rename_at_640 )
+{
+	builtin_throw(((char *) "oi"),__context__);
+	if ( !is_char_in_set(int32_t((*(__str_rename_at_640))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_640->cset)) )
+	{
+		return nullptr;
+	} else {
+		uint8_t * __ofs_rename_at_648 = das_ptr_add(__str_rename_at_640,1,1);
+		uint8_t * __osym_rename_at_649 = __ofs_rename_at_648;
+		struct regex::ReNode * __node2_rename_at_650 = __node_rename_at_640->next;
+		if ( __node2_rename_at_650 != nullptr )
+		{
+			while ( __osym_rename_at_649 != nullptr )
+			{
+				das_copy(__node_rename_at_640->tail,__osym_rename_at_649);
+				uint8_t * __otail_rename_at_654 = das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_650->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_640),__node2_rename_at_650,__osym_rename_at_649);
+				if ( __otail_rename_at_654 != nullptr )
+				{
+					return __otail_rename_at_654;
+				} else {
+					if ( !is_char_in_set(int32_t((*(__osym_rename_at_649))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_640->cset)) )
+					{
+						return nullptr;
+					} else {
+						das_ptr_inc(__osym_rename_at_649,1);
+					};
+				};
+			};
+			return nullptr;
+		} else {
+			while ( __osym_rename_at_649 != nullptr )
+			{
+				das_copy(__ofs_rename_at_648,__osym_rename_at_649);
+				if ( !is_char_in_set(int32_t((*(__osym_rename_at_649))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_640->cset)) )
+				{
+					break;
+				} else {
+					das_ptr_inc(__osym_rename_at_649,1);
+				};
+			};
+			das_copy(__node_rename_at_640->tail,__ofs_rename_at_648);
+			return __ofs_rename_at_648;
+		};
+	};
+}
+
+inline uint8_t * re_match2_question_4066686cd132b881 ( Context * __context__, struct regex::Regex &  __regex_rename_at_600, struct regex::ReNode * __node_rename_at_600, uint8_t * const  __str_rename_at_600 )
+{
+	struct regex::ReNode * __nsub_rename_at_603 = __node_rename_at_600->subexpr;
+	uint8_t * __tail_rename_at_604 = das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t * const >(__context__,__nsub_rename_at_603->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_600),__nsub_rename_at_603,__str_rename_at_600);
+	if ( __tail_rename_at_604 == nullptr )
+	{
+		das_copy(__tail_rename_at_604,__str_rename_at_600);
+	};
+	das_copy(__node_rename_at_600->tail,__tail_rename_at_604);
+	struct regex::ReNode * __node2_rename_at_608 = __node_rename_at_600->next;
+	return (__node2_rename_at_608 != nullptr) ? (das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_608->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_600),__node2_rename_at_608,__tail_rename_at_604)) : (__tail_rename_at_604);
+}
+
+inline uint8_t * re_match2_set_b4dca9a4881ef5de ( Context * __context__, struct regex::Regex &  __regex_rename_at_546, struct regex::ReNode * __node_rename_at_546, uint8_t * const  __str_rename_at_546 )
+{
+	if ( !is_char_in_set(int32_t((*(__str_rename_at_546))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_546->cset)) )
+	{
+		return nullptr;
+	} else {
+		uint8_t * __tail_rename_at_552 = das_ptr_add(__str_rename_at_546,1,1);
+		das_copy(__node_rename_at_546->tail,__tail_rename_at_552);
+		struct regex::ReNode * __node2_rename_at_554 = __node_rename_at_546->next;
+		return (__node2_rename_at_554 != nullptr) ? (das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_554->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_546),__node2_rename_at_554,__tail_rename_at_552)) : (__tail_rename_at_552);
+	};
+}
+
+inline uint8_t * re_match2_single_char_f467a074f85119cf ( Context * __context__, struct regex::Regex &  __regex_rename_at_505, struct regex::ReNode * __node_rename_at_505, uint8_t * const  __str_rename_at_505 )
+{
+	if ( get_character_uat(__node_rename_at_505->text,0) != int32_t((*(__str_rename_at_505))) )
+	{
+		return nullptr;
+	} else {
+		uint8_t * __tail_rename_at_511 = das_ptr_add(__str_rename_at_505,1,1);
+		das_copy(__node_rename_at_505->tail,__tail_rename_at_511);
+		struct regex::ReNode * __node2_rename_at_513 = __node_rename_at_505->next;
+		return (__node2_rename_at_513 != nullptr) ? (das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_513->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_505),__node2_rename_at_513,__tail_rename_at_511)) : (__tail_rename_at_511);
+	};
+}
+
+inline uint8_t * re_match2_star_55088e5150600cff ( Context * __context__, struct regex::Regex &  __regex_rename_at_671, struct regex::ReNode * __node_rename_at_671, uint8_t * const  __str_rename_at_671 )
+{
+	uint8_t * __ofs_rename_at_674 = __str_rename_at_671;
+	struct regex::ReNode * __node2_rename_at_675 = __node_rename_at_671->next;
+	struct regex::ReNode * __nsub_rename_at_676 = __node_rename_at_671->subexpr;
+	if ( __node2_rename_at_675 != nullptr )
+	{
+		while ( __ofs_rename_at_674 != nullptr )
+		{
+			das_copy(__node_rename_at_671->tail,__ofs_rename_at_674);
+			uint8_t * __oany_rename_at_680 = (uint8_t *)das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_675->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_671),__node2_rename_at_675,__ofs_rename_at_674);
+			if ( __oany_rename_at_680 != nullptr )
+			{
+				return __oany_rename_at_680;
+			} else {
+				das_copy(__ofs_rename_at_674,das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__nsub_rename_at_676->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_671),__nsub_rename_at_676,__ofs_rename_at_674));
+			};
+		};
+		return nullptr;
+	} else {
+		uint8_t * __osym_rename_at_686 = __ofs_rename_at_674;
+		while ( __osym_rename_at_686 != nullptr )
+		{
+			das_copy(__ofs_rename_at_674,__osym_rename_at_686);
+			das_copy(__osym_rename_at_686,das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__nsub_rename_at_676->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_671),__nsub_rename_at_676,__ofs_rename_at_674));
+		};
+		das_copy(__node_rename_at_671->tail,__ofs_rename_at_674);
+		return __ofs_rename_at_674;
+	};
+}
+
+inline uint8_t * re_match2_union_bcfeb6f902495257 ( Context * __context__, struct regex::Regex &  __regex_rename_at_535, struct regex::ReNode * __node_rename_at_535, uint8_t * const  __str_rename_at_535 )
+{
+	{
+		bool __need_loop_538 = true;
+		// sub : regex::ReNode?&
+		das_iterator<TArray<struct regex::ReNode *>> __sub_iterator(__node_rename_at_535->all);
+		struct regex::ReNode * * __sub_rename_at_538;
+		__need_loop_538 = __sub_iterator.first(__context__,(__sub_rename_at_538)) && __need_loop_538;
+		for ( ; __need_loop_538 ; __need_loop_538 = __sub_iterator.next(__context__,(__sub_rename_at_538)) )
+		{
+			uint8_t * __osub_rename_at_539 = (uint8_t *)das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t * const >(__context__,(*__sub_rename_at_538)->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_535),(*__sub_rename_at_538),__str_rename_at_535);
+			if ( __osub_rename_at_539 != nullptr )
+			{
+				das_copy(__node_rename_at_535->tail,(*__sub_rename_at_538)->tail);
+				return __osub_rename_at_539;
+			};
+		}
+		__sub_iterator.close(__context__,(__sub_rename_at_538));
+	};
+	return nullptr;
+}
+
+inline struct regex::ReNode * re_parse_31932cd2c8f5a6e6 ( Context * __context__, char * const  __expr_rename_at_421 )
+{
+	TVariant<16,struct regex::ReNode *,void *> __ore_rename_at_422 = re_re_fa81d25275ee5884(__context__,__expr_rename_at_421,0);
+	if ( das_get_variant_field<void *,8,1>::is(__ore_rename_at_422) )
+	{
+		return nullptr;
+	} else {
+		int32_t __at_rename_at_425 = (int32_t)next_ed40d1d5d47c8ce0(__context__,das_arg<TVariant<16,struct regex::ReNode *,void *>>::pass(__ore_rename_at_422));
+		return (__at_rename_at_425 != builtin_string_length(__expr_rename_at_421,__context__)) ? (nullptr) : (das_get_variant_field<struct regex::ReNode *,8,0>::as(__ore_rename_at_422,__context__));
+	};
+}
+
+inline TVariant<16,struct regex::ReNode *,void *> re_re_fa81d25275ee5884 ( Context * __context__, char * const  __expr_rename_at_375, int32_t __offset_rename_at_375 )
+{
+	if ( eos_77a77ef5845fccf8(__context__,__expr_rename_at_375,__offset_rename_at_375) )
+	{
+		return nada_e26047260042fc86(__context__);
+	} else {
+		int32_t __cofs_rename_at_379 = __offset_rename_at_375;
+		struct regex::ReNode * __last_rename_at_380 = 0;
+		while ( !eos_77a77ef5845fccf8(__context__,__expr_rename_at_375,__cofs_rename_at_379) )
+		{
+			if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_375,__cofs_rename_at_379) == 124 )
+			{
+				if ( __last_rename_at_380 == nullptr )
+				{
+					return nada_e26047260042fc86(__context__);
+				} else {
+					TVariant<16,struct regex::ReNode *,void *> __oright_rename_at_386 = re_re_fa81d25275ee5884(__context__,__expr_rename_at_375,__cofs_rename_at_379 + 1);
+					if ( das_get_variant_field<void *,8,1>::is(__oright_rename_at_386) )
+					{
+						return nada_e26047260042fc86(__context__);
+					} else {
+						das_copy(__last_rename_at_380,mk_union_8b47f400ee527052(__context__,__last_rename_at_380,das_get_variant_field<struct regex::ReNode *,8,0>::as(__oright_rename_at_386,__context__)));
+						das_copy(__cofs_rename_at_379,das_swizzle_ref<int32_t,range,1>::swizzle(__last_rename_at_380->at) /*y*/);
+					};
+				};
+			} else {
+				TVariant<16,struct regex::ReNode *,void *> __onext_rename_at_393 = re_basic_c3370642f80cb146(__context__,__expr_rename_at_375,__cofs_rename_at_379);
+				if ( das_get_variant_field<void *,8,1>::is(__onext_rename_at_393) )
+				{
+					TVariant<16,struct regex::ReNode *,void *> _temp_make_local_395_96;
+					TVariant<16,struct regex::ReNode *,void *> _temp_make_local_395_112;
+					return (__last_rename_at_380 == nullptr) ? ((_temp_make_local_395_96 = (nada_e26047260042fc86(__context__)))) : ((_temp_make_local_395_112 = (maybe_9a67bfcd21418f2b(__context__,__last_rename_at_380))));
+				} else {
+					das_copy(__last_rename_at_380,mk_concat_9566cb5dde2eb2a8(__context__,__last_rename_at_380,das_get_variant_field<struct regex::ReNode *,8,0>::as(__onext_rename_at_393,__context__)));
+					das_copy(__cofs_rename_at_379,das_swizzle_ref<int32_t,range,1>::swizzle(__last_rename_at_380->at) /*y*/);
+				};
+			};
+		};
+		return maybe_9a67bfcd21418f2b(__context__,__last_rename_at_380);
+	};
+}
+
+inline TVariant<16,struct regex::ReNode *,void *> re_set_2fe7c33ed9dcf01c ( Context * __context__, char * const  __expr_rename_at_246, int32_t __offset_rename_at_246 )
+{
+	if ( eos_77a77ef5845fccf8(__context__,__expr_rename_at_246,__offset_rename_at_246) )
+	{
+		return nada_e26047260042fc86(__context__);
+	} else {
+		if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_246,__offset_rename_at_246) != 91 )
+		{
+			return nada_e26047260042fc86(__context__);
+		} else {
+			bool __negative_rename_at_252 = false;
+			if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_246,__offset_rename_at_246 + 1) == 94 )
+			{
+				das_copy(__negative_rename_at_252,true);
+			};
+			TVariant<16,struct regex::ReNode *,void *> __oset_rename_at_255 = re_set_items_6d46881d4c3a48a7(__context__,__expr_rename_at_246,__negative_rename_at_252 ? ((__offset_rename_at_246 + 2)) : ((__offset_rename_at_246 + 1)));
+			if ( das_get_variant_field<void *,8,1>::is(__oset_rename_at_255) )
+			{
+				return nada_e26047260042fc86(__context__);
+			} else {
+				if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_246,next_ed40d1d5d47c8ce0(__context__,das_arg<TVariant<16,struct regex::ReNode *,void *>>::pass(__oset_rename_at_255))) != 93 )
+				{
+					finalize_99d8b8a6e8d8847f(__context__,das_arg<TVariant<16,struct regex::ReNode *,void *>>::pass(__oset_rename_at_255));
+					return nada_e26047260042fc86(__context__);
+				} else {
+					struct regex::ReNode * __oval_rename_at_261 = das_get_variant_field<struct regex::ReNode *,8,0>::as(__oset_rename_at_255,__context__);
+					das_copy(das_swizzle_ref<int32_t,range,0>::swizzle(__oval_rename_at_261->at) /*x*/,__offset_rename_at_246);
+					das_swizzle_ref<int32_t,range,1>::swizzle(__oval_rename_at_261->at) /*y*/++;
+					das_copy(__oval_rename_at_261->op,DAS_COMMENT(enum) regex::ReOp::Set);
+					if ( __negative_rename_at_252 )
+					{
+						set_negative_9a0b2ed2b4231348(__context__,das_arg<TDim<uint32_t,8>>::pass(__oval_rename_at_261->cset));
+					};
+					return __oset_rename_at_255;
+				};
+			};
+		};
+	};
+}
+
+inline TVariant<16,struct regex::ReNode *,void *> re_set_items_6d46881d4c3a48a7 ( Context * __context__, char * const  __expr_rename_at_206, int32_t __offset_rename_at_206 )
+{
+	if ( eos_77a77ef5845fccf8(__context__,__expr_rename_at_206,__offset_rename_at_206) )
+	{
+		return nada_e26047260042fc86(__context__);
+	} else {
+		TDim<uint32_t,8> __cset_rename_at_210; das_zero(__cset_rename_at_210);
+		int32_t __iofs_rename_at_211 = __offset_rename_at_206;
+		while ( !eos_77a77ef5845fccf8(__context__,__expr_rename_at_206,__iofs_rename_at_211) )
+		{
+			int32_t __ch_rename_at_213 = (int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_206,__iofs_rename_at_211);
+			if ( __ch_rename_at_213 == 93 )
+			{
+				break;
+			} else if ( __ch_rename_at_213 == 92 )
+			{
+				int32_t __che_rename_at_218 = (int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_206,__iofs_rename_at_211 + 1);
+				if ( __che_rename_at_218 == 0 )
+				{
+					return nada_e26047260042fc86(__context__);
+				} else {
+					set_meta_54cf3cdb21046a26(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_210),__che_rename_at_218);
+					__iofs_rename_at_211 += 2;
+				};
+			} else if ( (at_c9bade5ff7edd57d(__context__,__expr_rename_at_206,__iofs_rename_at_211 + 1) == 45) && (at_c9bade5ff7edd57d(__context__,__expr_rename_at_206,__iofs_rename_at_211 + 2) != 93) )
+			{
+				int32_t __che_rename_at_226 = (int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_206,__iofs_rename_at_211 + 2);
+				if ( __che_rename_at_226 == 0 )
+				{
+					return nada_e26047260042fc86(__context__);
+				} else if ( __ch_rename_at_213 > __che_rename_at_226 )
+				{
+					return nada_e26047260042fc86(__context__);
+				};
+				set_or_range_698b6406f2a4153c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_210),range(__ch_rename_at_213,__che_rename_at_226));
+				__iofs_rename_at_211 += 3;
+			} else {
+				set_or_char_3ae19d169cde2ccb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_210),__ch_rename_at_213);
+				__iofs_rename_at_211 += 1;
+			};
+		};
+		return maybe_9a67bfcd21418f2b(__context__,das_ascend<struct regex::ReNode,struct regex::ReNode>::make(__context__,nullptr,(([&]() -> struct regex::ReNode {
+			struct regex::ReNode __mks_240;
+			das_zero(__mks_240);
+			das_copy((__mks_240.op),(DAS_COMMENT(enum) regex::ReOp::Set));
+			das_copy((__mks_240.cset),(__cset_rename_at_210));
+			das_copy((__mks_240.at),(range(__offset_rename_at_206,__iofs_rename_at_211)));
+			return __mks_240;
+		})())));
+	};
+}
+
+inline struct regex::Regex regex_compile_2990a441ec4245c0 ( Context * __context__, struct regex::Regex &  __re_rename_at_770 )
+{
+	if ( __re_rename_at_770.root != nullptr )
+	{
+		re_assign_next_3cbb830952003b86(__context__,das_arg<struct regex::Regex>::pass(__re_rename_at_770));
+		re_assign_match_functions_b3e7e37087621da7(__context__,das_arg<struct regex::Regex>::pass(__re_rename_at_770));
+	};
+	return /* <- */ __re_rename_at_770;
+}
+
+inline bool regex_compile_b36953a2bb5d5307 ( Context * __context__, struct regex::Regex &  __re_rename_at_752, char * const  __expr_rename_at_752 )
+{
+	das_copy(__re_rename_at_752.root,re_parse_31932cd2c8f5a6e6(__context__,__expr_rename_at_752));
+	if ( __re_rename_at_752.root != nullptr )
+	{
+		re_assign_next_3cbb830952003b86(__context__,das_arg<struct regex::Regex>::pass(__re_rename_at_752));
+		re_assign_groups_9ac5348360243c9a(__context__,das_arg<struct regex::Regex>::pass(__re_rename_at_752));
+		re_assign_match_functions_b3e7e37087621da7(__context__,das_arg<struct regex::Regex>::pass(__re_rename_at_752));
+		re_early_out_c0e6ee8919572965(__context__,das_arg<TDim<uint32_t,8>>::pass(__re_rename_at_752.earlyOut),__re_rename_at_752.root);
+		das_copy(__re_rename_at_752.canEarlyOut,!is_set_empty_ccd4b091eb82a1dd(__context__,das_arg<TDim<uint32_t,8>>::pass(__re_rename_at_752.earlyOut)));
+	};
+	return __re_rename_at_752.root != nullptr;
+}
+
+inline struct regex::Regex regex_compile_d1324af73074c8c8 ( Context * __context__, char * const  __expr_rename_at_763 )
+{
+	struct regex::Regex __re_rename_at_764; das_zero(__re_rename_at_764);
+	if ( !regex_compile_b36953a2bb5d5307(__context__,das_arg<struct regex::Regex>::pass(__re_rename_at_764),__expr_rename_at_763) )
+	{
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_11, cast<char * const >::from(((char *) "regular expression ")), cast<char * const >::from(__expr_rename_at_763), cast<char * const >::from(((char *) " did not compile")))),__context__);
+	};
+	return /* <- */ __re_rename_at_764;
+}
+
+inline void regex_debug_d6af24b1a07eae0b ( Context * __context__, struct regex::Regex const  &  __regex_rename_at_833 )
+{
+	debug_re_7cf48f46d0970cb7(__context__,__regex_rename_at_833.root,1);
+	builtin_print(((char *) "\n"),__context__);
+	if ( __regex_rename_at_833.canEarlyOut )
+	{
+		builtin_print(((char *) "early out: "),__context__);
+		debug_set_9e4757c00b2a92ec(__context__,__regex_rename_at_833.earlyOut);
+		builtin_print(((char *) "\n"),__context__);
+	};
+	if ( builtin_array_size(__regex_rename_at_833.groups) != 0 )
+	{
+		builtin_print(((char *) "groups:"),__context__);
+		{
+			bool __need_loop_842 = true;
+			// g : tuple<range;string> const&
+			das_iterator<TArray<TTuple<16,range,char *>> const > __g_iterator(__regex_rename_at_833.groups);
+			TTuple<16,range,char *> const  * __g_rename_at_842;
+			__need_loop_842 = __g_iterator.first(__context__,(__g_rename_at_842)) && __need_loop_842;
+			for ( ; __need_loop_842 ; __need_loop_842 = __g_iterator.next(__context__,(__g_rename_at_842)) )
+			{
+				builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_12, cast<char * const >::from(((char *) "\t")), cast<char * const >::from(das_get_tuple_field<char *,8>::get((*__g_rename_at_842))), cast<char * const >::from(((char *) "\n")))),__context__);
+			}
+			__g_iterator.close(__context__,(__g_rename_at_842));
+		};
+	};
+}
+
+inline void regex_foreach_a33b5b26c7926f1d ( Context * __context__, struct regex::Regex &  __regex_rename_at_795, char * const  __str_rename_at_795, Block DAS_COMMENT((bool,range)) const  &  __blk_rename_at_795 )
+{
+	if ( builtin_empty(__str_rename_at_795) )
+	{
+		return ;
+	} else {
+		struct regex::ReNode * __root_rename_at_799 = __regex_rename_at_795.root;
+		uint8_t * __pstr_rename_at_800 = das_cast<uint8_t *>::cast(__str_rename_at_795);
+		uint8_t * __cstr_rename_at_801 = __pstr_rename_at_800;
+		if ( __regex_rename_at_795.canEarlyOut )
+		{
+			while ( true )
+			{
+				int32_t __Ch_rename_at_805 = (int32_t)int32_t((*(__cstr_rename_at_801)));
+				if ( __Ch_rename_at_805 == 0 )
+				{
+					break;
+				} else {
+					if ( is_char_in_set(__Ch_rename_at_805,das_arg<TDim<uint32_t,8>>::pass(__regex_rename_at_795.earlyOut)) )
+					{
+						uint8_t * __om_rename_at_809 = (uint8_t *)das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__root_rename_at_799->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_795),__root_rename_at_799,__cstr_rename_at_801);
+						if ( __om_rename_at_809 != nullptr )
+						{
+							if ( !das_invoke<bool>::invoke<range>(__context__,__blk_rename_at_795,range(int32_t(i_das_ptr_diff(__cstr_rename_at_801,__pstr_rename_at_800,1)),int32_t(i_das_ptr_diff(__om_rename_at_809,__pstr_rename_at_800,1)))) )
+							{
+								break;
+							} else {
+								das_copy(__cstr_rename_at_801,__om_rename_at_809);
+							};
+						} else {
+							das_ptr_inc(__cstr_rename_at_801,1);
+						};
+					} else {
+						das_ptr_inc(__cstr_rename_at_801,1);
+					};
+				};
+			};
+		} else {
+			while ( int32_t((*(__cstr_rename_at_801))) != 0 )
+			{
+				uint8_t * __om_rename_at_820 = (uint8_t *)das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__root_rename_at_799->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_795),__root_rename_at_799,__cstr_rename_at_801);
+				if ( __om_rename_at_820 != nullptr )
+				{
+					if ( !das_invoke<bool>::invoke<range>(__context__,__blk_rename_at_795,range(int32_t(i_das_ptr_diff(__cstr_rename_at_801,__pstr_rename_at_800,1)),int32_t(i_das_ptr_diff(__om_rename_at_820,__pstr_rename_at_800,1)))) )
+					{
+						break;
+					} else {
+						das_copy(__cstr_rename_at_801,__om_rename_at_820);
+					};
+				} else {
+					das_ptr_inc(__cstr_rename_at_801,1);
+				};
+			};
+		};
+	};
+}
+
+inline char * regex_group_4be2fa6920455849 ( Context * __context__, struct regex::Regex const  &  __regex_rename_at_790, int32_t __index_rename_at_790, char * const  __match_rename_at_790 )
+{
+	range __sub_range_rename_at_791 = (range)das_get_tuple_field<range,0>::get(__regex_rename_at_790.groups(__index_rename_at_790,__context__));
+	return ((char *)(builtin_string_slice1(__match_rename_at_790,v_extract_xi(v_cast_vec4i(__sub_range_rename_at_791)) /*x*/,v_extract_yi(v_cast_vec4i(__sub_range_rename_at_791)) /*y*/,__context__)));
+}
+
+inline int32_t regex_match_89e4de8eb0b82a1d ( Context * __context__, struct regex::Regex &  __regex_rename_at_777, char * const  __str_rename_at_777, int32_t __offset_rename_at_777 )
+{
+	if ( builtin_empty(__str_rename_at_777) )
+	{
+		return -1;
+	} else {
+		das_copy(__regex_rename_at_777.match,das_cast<uint8_t *>::cast(__str_rename_at_777));
+		uint8_t * __mptr_rename_at_784 = (uint8_t *)das_invoke_function<uint8_t *>::invoke<struct regex::Regex &,struct regex::ReNode *,uint8_t *>(__context__,__regex_rename_at_777.root->fun2,das_arg<struct regex::Regex>::pass(__regex_rename_at_777),__regex_rename_at_777.root,__regex_rename_at_777.match);
+		return (__mptr_rename_at_784 == nullptr) ? (-1) : (int32_t(i_das_ptr_diff(__mptr_rename_at_784,__regex_rename_at_777.match,1)));
+	};
+}
+
+inline void set_meta_54cf3cdb21046a26 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_155, int32_t __che_rename_at_155 )
+{
+	if ( __che_rename_at_155 == 119 )
+	{
+		set_or_range_698b6406f2a4153c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_155),range(97,122));
+		set_or_range_698b6406f2a4153c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_155),range(65,90));
+		set_or_range_698b6406f2a4153c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_155),range(48,57));
+		set_or_char_3ae19d169cde2ccb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_155),95);
+	} else if ( __che_rename_at_155 == 87 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_162; das_zero(__eset_rename_at_162);
+		set_meta_54cf3cdb21046a26(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_162),119);
+		set_or_set_d9bfd2cba9b16ba5(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_155),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_162));
+	} else {
+		set_or_char_3ae19d169cde2ccb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_155),__che_rename_at_155);
+	};
+}
+
+inline void set_negative_9a0b2ed2b4231348 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_150 )
+{
+	{
+		bool __need_loop_151 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_150);
+		uint32_t * __x_rename_at_151;
+		__need_loop_151 = __x_iterator.first(__context__,(__x_rename_at_151)) && __need_loop_151;
+		for ( ; __need_loop_151 ; __need_loop_151 = __x_iterator.next(__context__,(__x_rename_at_151)) )
+		{
+			das_copy((*__x_rename_at_151),~(*__x_rename_at_151));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_151));
+	};
+}
+
+inline void set_or_char_3ae19d169cde2ccb ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_131, int32_t __ch_rename_at_131 )
+{
+	__cset_rename_at_131((__ch_rename_at_131 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_131 & 31));
+}
+
+inline void set_or_range_698b6406f2a4153c ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_135, range __bits_rename_at_135 )
+{
+	{
+		bool __need_loop_136 = true;
+		// ch : int const
+		das_iterator<range> __ch_iterator(range(v_extract_xi(v_cast_vec4i(__bits_rename_at_135)) /*x*/,v_extract_yi(v_cast_vec4i(__bits_rename_at_135)) /*y*/ + 1));
+		int32_t __ch_rename_at_136;
+		__need_loop_136 = __ch_iterator.first(__context__,(__ch_rename_at_136)) && __need_loop_136;
+		for ( ; __need_loop_136 ; __need_loop_136 = __ch_iterator.next(__context__,(__ch_rename_at_136)) )
+		{
+			__cset_rename_at_135((__ch_rename_at_136 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_136 & 31));
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_136));
+	};
+}
+
+inline void set_or_set_d9bfd2cba9b16ba5 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_145, TDim<uint32_t,8> const  &  __eset_rename_at_145 )
+{
+	{
+		bool __need_loop_146 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_145);
+		uint32_t * __x_rename_at_146;
+		__need_loop_146 = __x_iterator.first(__context__,(__x_rename_at_146)) && __need_loop_146;
+		// y : uint aka CharSet const&
+		das_iterator<TDim<uint32_t,8> const > __y_iterator(__eset_rename_at_145);
+		uint32_t const  * __y_rename_at_146;
+		__need_loop_146 = __y_iterator.first(__context__,(__y_rename_at_146)) && __need_loop_146;
+		for ( ; __need_loop_146 ; __need_loop_146 = __x_iterator.next(__context__,(__x_rename_at_146)) && __y_iterator.next(__context__,(__y_rename_at_146)) )
+		{
+			(*__x_rename_at_146) |= (*__y_rename_at_146);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_146));
+		__y_iterator.close(__context__,(__y_rename_at_146));
+	};
+}
+
+inline void visit_top_down_1f42d2ae2c877acf ( Context * __context__, struct regex::ReNode * __node_rename_at_432, Block DAS_COMMENT((void,struct regex::ReNode *)) const  &  __blk_rename_at_432 )
+{
+	das_invoke<void>::invoke<struct regex::ReNode *>(__context__,__blk_rename_at_432,__node_rename_at_432);
+	{
+		bool __need_loop_434 = true;
+		// x : regex::ReNode?&
+		das_iterator<TArray<struct regex::ReNode *>> __x_iterator(__node_rename_at_432->all);
+		struct regex::ReNode * * __x_rename_at_434;
+		__need_loop_434 = __x_iterator.first(__context__,(__x_rename_at_434)) && __need_loop_434;
+		for ( ; __need_loop_434 ; __need_loop_434 = __x_iterator.next(__context__,(__x_rename_at_434)) )
+		{
+			visit_top_down_1f42d2ae2c877acf(__context__,(*__x_rename_at_434),__blk_rename_at_432);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_434));
+	};
+	if ( __node_rename_at_432->subexpr != nullptr )
+	{
+		visit_top_down_1f42d2ae2c877acf(__context__,__node_rename_at_432->subexpr,__blk_rename_at_432);
+	};
+	if ( __node_rename_at_432->left != nullptr )
+	{
+		visit_top_down_1f42d2ae2c877acf(__context__,__node_rename_at_432->left,__blk_rename_at_432);
+	};
+	if ( __node_rename_at_432->right != nullptr )
+	{
+		visit_top_down_1f42d2ae2c877acf(__context__,__node_rename_at_432->right,__blk_rename_at_432);
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// at_c9bade5ff7edd57d
+		aotLib[0x9d976e8cdb634999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , int32_t  ),&at_c9bade5ff7edd57d>>();
+	};
+		// _Funcbuiltin_0x60_finalize_dd8c5cab6f6afc46
+		aotLib[0x5493ff4ea1a6af24] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct regex::ReNode *> &  ),&_Funcbuiltin_0x60_finalize_dd8c5cab6f6afc46>>();
+	};
+		// _Funcbuiltin_0x60_push_3fdf4fc723ad236a
+		aotLib[0xa08e0895c5338055] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct regex::ReNode *> & , struct regex::ReNode * const  , int32_t  ),&_Funcbuiltin_0x60_push_3fdf4fc723ad236a>>();
+	};
+		// _Funcbuiltin_0x60_push_40551da8a4209c68
+		aotLib[0xb6d05a41c823b899] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,range,char *>> & , TTuple<16,range,char *> const  & , int32_t  ),&_Funcbuiltin_0x60_push_40551da8a4209c68>>();
+	};
+		// _Funcbuiltin_0x60_resize_13e4a05653768251
+		aotLib[0xb8d697922f2109d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct regex::ReNode *> & , int32_t  ),&_Funcbuiltin_0x60_resize_13e4a05653768251>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_55ba84047fc802d6
+		aotLib[0x2986d944ee2e12d2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<struct regex::ReNode *> (*) ( Context * __context__, TDim<struct regex::ReNode *,2> &  ),&_Funcbuiltin_0x60_to_array_move_55ba84047fc802d6>>();
+	};
+		// debug_re_7cf48f46d0970cb7
+		aotLib[0x1139240c4b4bb564] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex::ReNode * const  , int32_t  ),&debug_re_7cf48f46d0970cb7>>();
+	};
+		// debug_set_9e4757c00b2a92ec
+		aotLib[0xfe42d315ca69bef5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&debug_set_9e4757c00b2a92ec>>();
+	};
+		// eos_77a77ef5845fccf8
+		aotLib[0x73596420952a5821] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const  , int32_t  ),&eos_77a77ef5845fccf8>>();
+	};
+		// finalize_b321625d5d1ae328
+		aotLib[0xc30e6d28dddcd4f6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex::ReNode * &  ),&finalize_b321625d5d1ae328>>();
+	};
+		// finalize_99d8b8a6e8d8847f
+		aotLib[0xc55edf8c79712a3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TVariant<16,struct regex::ReNode *,void *> &  ),&finalize_99d8b8a6e8d8847f>>();
+	};
+		// finalize_4b5b3ac4f531983c
+		aotLib[0xd165ab808ce5580f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex::ReNode &  ),&finalize_4b5b3ac4f531983c>>();
+	};
+		// is_meta_character_9e5a1eca7384b1f
+		aotLib[0x1c2f96a3f06718fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_meta_character_9e5a1eca7384b1f>>();
+	};
+		// is_set_character_77a3c75117a26e66
+		aotLib[0xead91fa6a6dd5af9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_set_character_77a3c75117a26e66>>();
+	};
+		// is_set_empty_ccd4b091eb82a1dd
+		aotLib[0x369bd734d9bc2375] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&is_set_empty_ccd4b091eb82a1dd>>();
+	};
+		// is_valid_13f013884e52501b
+		aotLib[0xd4657eff32fed869] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct regex::Regex &  ),&is_valid_13f013884e52501b>>();
+	};
+		// maybe_9a67bfcd21418f2b
+		aotLib[0xb3cbcd62a452fa7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__, struct regex::ReNode * const   ),&maybe_9a67bfcd21418f2b>>();
+	};
+		// mk_concat_9566cb5dde2eb2a8
+		aotLib[0x8c1fab07cc925afd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct regex::ReNode * (*) ( Context * __context__, struct regex::ReNode * , struct regex::ReNode *  ),&mk_concat_9566cb5dde2eb2a8>>();
+	};
+		// mk_union_8b47f400ee527052
+		aotLib[0x6bf6419532becbb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct regex::ReNode * (*) ( Context * __context__, struct regex::ReNode * , struct regex::ReNode *  ),&mk_union_8b47f400ee527052>>();
+	};
+		// nada_e26047260042fc86
+		aotLib[0x1c3e39d1a0e5eb19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__ ),&nada_e26047260042fc86>>();
+	};
+		// next_ed40d1d5d47c8ce0
+		aotLib[0xf31a5baa5c550925] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TVariant<16,struct regex::ReNode *,void *> const  &  ),&next_ed40d1d5d47c8ce0>>();
+	};
+		// re_any_a9b85795201936a3
+		aotLib[0x986118b500c2bf65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_any_a9b85795201936a3>>();
+	};
+		// re_assign_groups_9ac5348360243c9a
+		aotLib[0x5c0370b885b8c1aa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex::Regex &  ),&re_assign_groups_9ac5348360243c9a>>();
+	};
+		// re_assign_match_functions_b3e7e37087621da7
+		aotLib[0xa9af8da7fc166120] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex::Regex &  ),&re_assign_match_functions_b3e7e37087621da7>>();
+	};
+		// re_assign_next_3cbb830952003b86
+		aotLib[0xee1484ddc067eee4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex::Regex &  ),&re_assign_next_3cbb830952003b86>>();
+	};
+		// re_basic_c3370642f80cb146
+		aotLib[0xf048e0711fb7904] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_basic_c3370642f80cb146>>();
+	};
+		// re_char_cc7fcf1004fb0a5b
+		aotLib[0x4975141b9f1f0e46] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_char_cc7fcf1004fb0a5b>>();
+	};
+		// re_early_out_c0e6ee8919572965
+		aotLib[0x48092c379c603175] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<uint32_t,8> & , struct regex::ReNode * const   ),&re_early_out_c0e6ee8919572965>>();
+	};
+		// re_elementary_ea025bf992c116ee
+		aotLib[0x1ffca06c35a42060] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_elementary_ea025bf992c116ee>>();
+	};
+		// re_eos_2da6bc306bcf43b0
+		aotLib[0xa75d8bd082497ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_eos_2da6bc306bcf43b0>>();
+	};
+		// re_group_48dd14ed9a44d9f3
+		aotLib[0x7f376e0377107705] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_group_48dd14ed9a44d9f3>>();
+	};
+		// re_match2_any_e94ab3d7d8964629
+		aotLib[0xe5ee60de628a87cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_any_e94ab3d7d8964629>>();
+	};
+		// re_match2_char_db8d3f11c0c117b9
+		aotLib[0x5cf40534c2b059a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_char_db8d3f11c0c117b9>>();
+	};
+		// re_match2_concat_51a6261aee4576ab
+		aotLib[0x8f3441421c3bb9d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_concat_51a6261aee4576ab>>();
+	};
+		// re_match2_eos_95cec9bf71f3f1d8
+		aotLib[0x13232b5dd5bdc76d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_eos_95cec9bf71f3f1d8>>();
+	};
+		// re_match2_group_2a22c466440843aa
+		aotLib[0x96847d7b92be3a21] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_group_2a22c466440843aa>>();
+	};
+		// re_match2_plus_1e1614cdc46c85c5
+		aotLib[0x2c14ba386df1e859] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_plus_1e1614cdc46c85c5>>();
+	};
+		// re_match2_plus_set_986819b30ab98f26
+		aotLib[0xb3067376c80830e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_plus_set_986819b30ab98f26>>();
+	};
+		// re_match2_question_4066686cd132b881
+		aotLib[0x35b34acafda79a59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_question_4066686cd132b881>>();
+	};
+		// re_match2_set_b4dca9a4881ef5de
+		aotLib[0x2099f05158cc106d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_set_b4dca9a4881ef5de>>();
+	};
+		// re_match2_single_char_f467a074f85119cf
+		aotLib[0xe8a40ea48d710d81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_single_char_f467a074f85119cf>>();
+	};
+		// re_match2_star_55088e5150600cff
+		aotLib[0x25c2d7f8b5792db9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_star_55088e5150600cff>>();
+	};
+		// re_match2_union_bcfeb6f902495257
+		aotLib[0x2b45e393ce79b721] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, struct regex::Regex & , struct regex::ReNode * , uint8_t * const   ),&re_match2_union_bcfeb6f902495257>>();
+	};
+		// re_parse_31932cd2c8f5a6e6
+		aotLib[0xfafc869c110927ab] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct regex::ReNode * (*) ( Context * __context__, char * const   ),&re_parse_31932cd2c8f5a6e6>>();
+	};
+		// re_re_fa81d25275ee5884
+		aotLib[0x4f6215bcf8d36e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_re_fa81d25275ee5884>>();
+	};
+		// re_set_2fe7c33ed9dcf01c
+		aotLib[0xdbe7567a87c263c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_set_2fe7c33ed9dcf01c>>();
+	};
+		// re_set_items_6d46881d4c3a48a7
+		aotLib[0xb405400917e326c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,struct regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_set_items_6d46881d4c3a48a7>>();
+	};
+		// regex_compile_2990a441ec4245c0
+		aotLib[0xc31f629d34e2a122] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct regex::Regex (*) ( Context * __context__, struct regex::Regex &  ),&regex_compile_2990a441ec4245c0>>();
+	};
+		// regex_compile_b36953a2bb5d5307
+		aotLib[0x57c26d435270565c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct regex::Regex & , char * const   ),&regex_compile_b36953a2bb5d5307>>();
+	};
+		// regex_compile_d1324af73074c8c8
+		aotLib[0xdd88652bdbdd5fdd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct regex::Regex (*) ( Context * __context__, char * const   ),&regex_compile_d1324af73074c8c8>>();
+	};
+		// regex_debug_d6af24b1a07eae0b
+		aotLib[0x366030ec1650490f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex::Regex const  &  ),&regex_debug_d6af24b1a07eae0b>>();
+	};
+		// regex_foreach_a33b5b26c7926f1d
+		aotLib[0x4bee345660f1b6ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex::Regex & , char * const  , Block DAS_COMMENT((bool,range)) const  &  ),&regex_foreach_a33b5b26c7926f1d>>();
+	};
+		// regex_group_4be2fa6920455849
+		aotLib[0xbba735234e1bbe25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, struct regex::Regex const  & , int32_t , char * const   ),&regex_group_4be2fa6920455849>>();
+	};
+		// regex_match_89e4de8eb0b82a1d
+		aotLib[0xf7ab0ab31b84d64d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct regex::Regex & , char * const  , int32_t  ),&regex_match_89e4de8eb0b82a1d>>();
+	};
+		// set_meta_54cf3cdb21046a26
+		aotLib[0x14071fc72a87afc2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , int32_t  ),&set_meta_54cf3cdb21046a26>>();
+	};
+		// set_negative_9a0b2ed2b4231348
+		aotLib[0x64577f97097194e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> &  ),&set_negative_9a0b2ed2b4231348>>();
+	};
+		// set_or_char_3ae19d169cde2ccb
+		aotLib[0x4cd90c73c3f0f501] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , int32_t  ),&set_or_char_3ae19d169cde2ccb>>();
+	};
+		// set_or_range_698b6406f2a4153c
+		aotLib[0xae457f99399f42d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , range  ),&set_or_range_698b6406f2a4153c>>();
+	};
+		// set_or_set_d9bfd2cba9b16ba5
+		aotLib[0x8f001c828e4f369d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , TDim<uint32_t,8> const  &  ),&set_or_set_d9bfd2cba9b16ba5>>();
+	};
+		// visit_top_down_1f42d2ae2c877acf
+		aotLib[0x9a826ed48e98b5cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex::ReNode * , Block DAS_COMMENT((void,struct regex::ReNode *)) const  &  ),&visit_top_down_1f42d2ae2c877acf>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,435 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require regex_boost
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings_boost
+ // require ast_boost
+ // require regex
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__6399c7e8;
+extern StructInfo __struct_info__92c3c52e;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__b676c5e0;
+extern TypeInfo __type_info__239a820b;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__56607ebd;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__d6c2593b;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__2ba0095f;
+extern TypeInfo __type_info__b049b391;
+extern TypeInfo __type_info__75b7ce79;
+extern VarInfo __var_info__4782b24d;
+extern VarInfo __var_info__bae603ca;
+extern VarInfo __var_info__db4c6b98;
+extern VarInfo __var_info__88942b34;
+extern VarInfo __var_info__754fb163;
+extern VarInfo __var_info__269ec52a;
+extern VarInfo __var_info__b7f3aed1;
+extern VarInfo __var_info__c98cc4f;
+
+VarInfo __struct_info__6399c7e8_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x754fb163, "__rtti", 0 };
+TypeInfo * __type_info__db4c6b98_arg_types_var_1671022568[1] = { &__type_info__b676c5e0 };
+VarInfo __struct_info__6399c7e8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__db4c6b98_arg_types_var_1671022568, nullptr, 1, 0, nullptr, 28, 0xdb4c6b98, "__finalize", 8 };
+TypeInfo * __type_info__88942b34_arg_types_var_1671022568[6] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__56607ebd, &__type_info__359c1b32, &__type_info__239a820b };
+VarInfo __struct_info__6399c7e8_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__88942b34_arg_types_var_1671022568, nullptr, 6, 0, nullptr, 28, 0x88942b34, "accept", 12 };
+TypeInfo * __type_info__c98cc4f_arg_types_var_1671022568[4] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__2ba0095f };
+VarInfo __struct_info__6399c7e8_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c98cc4f_arg_types_var_1671022568, nullptr, 4, 0, nullptr, 28, 0xc98cc4f, "visit", 16 };
+VarInfo * __struct_info__6399c7e8_fields[4] =  { &__struct_info__6399c7e8_field_0, &__struct_info__6399c7e8_field_1, &__struct_info__6399c7e8_field_2, &__struct_info__6399c7e8_field_3 };
+StructInfo __struct_info__6399c7e8 = {"RegexReader", __struct_info__6399c7e8_fields, 4, 24, -1, nullptr, 0x6399c7e8 };
+VarInfo __struct_info__92c3c52e_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4782b24d, "__rtti", 0 };
+TypeInfo * __type_info__269ec52a_arg_types_var_2462303534[1] = { &__type_info__b676c5e0 };
+VarInfo __struct_info__92c3c52e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__269ec52a_arg_types_var_2462303534, nullptr, 1, 0, nullptr, 28, 0x269ec52a, "__finalize", 8 };
+TypeInfo * __type_info__bae603ca_arg_types_var_2462303534[6] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__56607ebd, &__type_info__359c1b32, &__type_info__239a820b };
+VarInfo __struct_info__92c3c52e_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__bae603ca_arg_types_var_2462303534, nullptr, 6, 0, nullptr, 28, 0xbae603ca, "accept", 12 };
+TypeInfo * __type_info__b7f3aed1_arg_types_var_2462303534[4] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__2ba0095f };
+VarInfo __struct_info__92c3c52e_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b7f3aed1_arg_types_var_2462303534, nullptr, 4, 0, nullptr, 28, 0xb7f3aed1, "visit", 16 };
+VarInfo * __struct_info__92c3c52e_fields[4] =  { &__struct_info__92c3c52e_field_0, &__struct_info__92c3c52e_field_1, &__struct_info__92c3c52e_field_2, &__struct_info__92c3c52e_field_3 };
+StructInfo __struct_info__92c3c52e = {"AstReaderMacro", __struct_info__92c3c52e_fields, 4, 24, -1, nullptr, 0x92c3c52e };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__b676c5e0 = { Type::tStructure, &__struct_info__92c3c52e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb676c5e0 };
+TypeInfo __type_info__239a820b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::LineInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 38, 0x239a820b };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__56607ebd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x56607ebd };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__d6c2593b = { Type::tStructure, &__struct_info__6399c7e8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xd6c2593b };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__2ba0095f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2ba0095f };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+TypeInfo __type_info__75b7ce79 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReader"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x75b7ce79 };
+
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+namespace ast {
+
+struct AstReaderMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(AstReaderMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,accept)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,visit)==16,"structure field offset mismatch with DAS");
+}
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace regex {
+
+enum class ReOp : int32_t {
+	Char = int32_t(0),
+	Set = int32_t(1),
+	Any = int32_t(2),
+	Eos = int32_t(3),
+	Group = int32_t(4),
+	Plus = int32_t(5),
+	Star = int32_t(6),
+	Question = int32_t(7),
+	Concat = int32_t(8),
+	Union = int32_t(9),
+};
+}
+}
+template <> struct cast< regex::ReOp > : cast_enum < regex::ReOp > {};
+namespace {
+namespace regex {
+
+struct ReNode {
+	DAS_COMMENT(enum) regex::ReOp op;
+	int32_t id;
+	Func DAS_COMMENT((uint8_t *,struct regex::Regex,struct regex::ReNode *,uint8_t * const )) fun2;
+	range at;
+	char * text;
+	int32_t textLen;
+	TArray<struct regex::ReNode *> all;
+	struct regex::ReNode * left;
+	struct regex::ReNode * right;
+	struct regex::ReNode * subexpr;
+	struct regex::ReNode * next;
+	TDim<uint32_t,8> cset;
+	int32_t index;
+	uint8_t * tail;
+};
+static_assert(sizeof(ReNode)==144,"structure size mismatch with DAS");
+static_assert(offsetof(ReNode,op)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,id)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,fun2)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,at)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,text)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,textLen)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,all)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,left)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,right)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,subexpr)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,next)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,cset)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,index)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,tail)==136,"structure field offset mismatch with DAS");
+}
+namespace regex {
+
+struct Regex {
+	struct regex::ReNode * root;
+	uint8_t * match;
+	TArray<TTuple<16,range,char *>> groups;
+	TDim<uint32_t,8> earlyOut;
+	bool canEarlyOut;
+};
+static_assert(sizeof(Regex)==80,"structure size mismatch with DAS");
+static_assert(offsetof(Regex,root)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,match)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,groups)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,earlyOut)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,canEarlyOut)==72,"structure field offset mismatch with DAS");
+}
+namespace regex_boost {
+
+struct RegexReader {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(RegexReader)==24,"structure size mismatch with DAS");
+static_assert(offsetof(RegexReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(RegexReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(RegexReader,accept)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(RegexReader,visit)==16,"structure field offset mismatch with DAS");
+}
+
+inline struct regex_boost::RegexReader RegexReader_6158dcc9c461787e ( Context * __context__ );
+inline void _FuncRegexReader_0x27___finalize_81b745a088be5ca9 ( Context * __context__, struct regex_boost::RegexReader & __self_rename_at_11 );
+inline bool _FuncRegexReader_0x60_accept_205132cc65ab0e49 ( Context * __context__, struct regex_boost::RegexReader & __self_rename_at_12, smart_ptr_raw<Program> const  __prog_rename_at_12, Module * const  __mod_rename_at_12, ExprReader * __expr_rename_at_12, int32_t __ch_rename_at_12, LineInfo const  & __info_rename_at_12 );
+inline smart_ptr_raw<Expression> _FuncRegexReader_0x60_visit_72fc2e97932c4a83 ( Context * __context__, struct regex_boost::RegexReader & __self_rename_at_21, smart_ptr_raw<Program> const  __prog_rename_at_21, Module * const  __mod_rename_at_21, smart_ptr_raw<ExprReader> const  __expr_rename_at_21 );
+inline void __setup_macros_2a6a56609ab69a6 ( Context * __context__ );
+inline void _Funcast_0x60_add_new_reader_macro_8964a4d0072fa52a ( Context * __context__, char * const  __name_rename_at_515, struct regex_boost::RegexReader * const  __someClassPtr_rename_at_515 );
+inline smart_ptr_raw<ReaderMacro> _Funcast_0x60_make_reader_macro_ec80f1cb21d406cc ( Context * __context__, char * const  __name_rename_at_465, struct regex_boost::RegexReader * const  __someClassPtr_rename_at_465 );
+inline void _Funcbuiltin_0x60_finalize_6dda7ea5f2695554 ( Context * __context__, TArray<TTuple<16,range,char *>> & __a_rename_at_285 );
+inline void finalize_1db505b7ad774ab5 ( Context * __context__, TTuple<16,range,char *> & ____this_rename_at_289 );
+inline void finalize_1eb5223d00df51b5 ( Context * __context__, struct regex::Regex & ____this_rename_at_38 );
+inline void finalize_a3a001a249ad2764 ( Context * __context__, struct regex_boost::RegexReader & ____this_rename_at_11 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_4653091e6ecb64df ( Context * __context__, struct regex_boost::RegexReader const  & __cl_rename_at_88 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	__setup_macros_2a6a56609ab69a6(__context__);
+}
+
+inline struct regex_boost::RegexReader RegexReader_6158dcc9c461787e ( Context * __context__ )
+{
+	return (([&]() -> struct regex_boost::RegexReader {
+		struct regex_boost::RegexReader __mks_11;
+		das_copy((__mks_11.__rtti),(((void *)(&__type_info__d6c2593b))));
+		das_copy((__mks_11.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstReaderMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@regex_boost::RegexReader'__finalize RegexReader*/ 2945045759u)))));
+		das_copy((__mks_11.accept),(das_cast<Func DAS_COMMENT((bool,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const ))>::cast(Func(__context__->fnIdxByMangledName(/*@regex_boost::RegexReader`accept RegexReader #smart_ptr##handle#Program#const #ptr##handle#Module#const #ptr##handle#ExprReader int#const #handle#LineInfo#const*/ 2556622803u)))));
+		das_copy((__mks_11.visit),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@regex_boost::RegexReader`visit RegexReader #smart_ptr##handle#Program#const #ptr##handle#Module#const #smart_ptr##handle#ExprReader#const*/ 1006917069u)))));
+		return __mks_11;
+	})());
+}
+
+inline void _FuncRegexReader_0x27___finalize_81b745a088be5ca9 ( Context * __context__, struct regex_boost::RegexReader &  __self_rename_at_11 )
+{
+	finalize_a3a001a249ad2764(__context__,das_arg<struct regex_boost::RegexReader>::pass(__self_rename_at_11));
+}
+
+inline bool _FuncRegexReader_0x60_accept_205132cc65ab0e49 ( Context * __context__, struct regex_boost::RegexReader &  __self_rename_at_12, smart_ptr_raw<Program> const  __prog_rename_at_12, Module * const  __mod_rename_at_12, ExprReader * __expr_rename_at_12, int32_t __ch_rename_at_12, LineInfo const  &  __info_rename_at_12 )
+{
+	if ( (__ch_rename_at_12 != 10) && (__ch_rename_at_12 != 13) )
+	{
+		builtin_append_char_to_string(das_arg<das::string>::pass(__expr_rename_at_12->sequence /*sequence*/),__ch_rename_at_12);
+	};
+	if ( builtin_string_ends_with(das_arg<das::string>::pass(__expr_rename_at_12->sequence /*sequence*/),((char *) "%%"),__context__) )
+	{
+		int32_t __len_rename_at_16 = (int32_t)builtin_ext_string_length(das_arg<das::string>::pass(__expr_rename_at_12->sequence /*sequence*/));
+		builtin_resize_string(das_arg<das::string>::pass(__expr_rename_at_12->sequence /*sequence*/),__len_rename_at_16 - 2);
+		return false;
+	} else {
+		return true;
+	};
+}
+
+inline smart_ptr_raw<Expression> _FuncRegexReader_0x60_visit_72fc2e97932c4a83 ( Context * __context__, struct regex_boost::RegexReader &  __self_rename_at_21, smart_ptr_raw<Program> const  __prog_rename_at_21, Module * const  __mod_rename_at_21, smart_ptr_raw<ExprReader> const  __expr_rename_at_21 ) { das_stack_prologue __prologue(__context__,288,"RegexReader`visit " DAS_FILE_LINE);
+{
+	struct regex::Regex __regex_rename_at_22; das_zero(__regex_rename_at_22);
+	peek_das_string_T(__expr_rename_at_21->sequence /*sequence*/,[&](char * const  __seqStr_rename_at_23)->void{
+		das_invoke_function<bool>::invoke<struct regex::Regex &,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@regex::regex_compile Regex string#const*/ 1215890493u)),das_arg<struct regex::Regex>::pass(__regex_rename_at_22),__seqStr_rename_at_23);
+	},__context__);
+	if ( !das_invoke_function<bool>::invoke<struct regex::Regex &>(__context__,Func(__context__->fnIdxByMangledName(/*@regex::is_valid Regex*/ 679979928u)),das_arg<struct regex::Regex>::pass(__regex_rename_at_22)) )
+	{
+		finalize_1eb5223d00df51b5(__context__,das_arg<struct regex::Regex>::pass(__regex_rename_at_22));
+		ast_error(__prog_rename_at_21,__expr_rename_at_21->at /*at*/,((char *) "regular expression did not compile"));
+		return nullptr;
+	} else {
+		smart_ptr_raw<Expression> __re_data_rename_at_30; das_zero(__re_data_rename_at_30); das_move(__re_data_rename_at_30, (smart_ptr_raw<Expression>)das_invoke_function<smart_ptr_raw<Expression>>::invoke<struct regex::Regex &,LineInfo const  &>(__context__,Func(__context__->fnIdxByMangledName(/*@regex_boost::ast_boost`convert_to_expression Regex#explicit #handle#LineInfo#const*/ 1797467100u)),das_arg<struct regex::Regex>::pass(__regex_rename_at_22),__expr_rename_at_21->at /*at*/));
+		finalize_1eb5223d00df51b5(__context__,das_arg<struct regex::Regex>::pass(__regex_rename_at_22));
+		smart_ptr_raw<ExprCall> __creg_rename_at_32; das_zero(__creg_rename_at_32); das_move(__creg_rename_at_32, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_32) {
+			das_copy((__mks_32.at /*at*/),(__expr_rename_at_21->at /*at*/));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_32.name /*name*/),((char *) "regex::regex_compile"));
+			}		}))));
+		das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__creg_rename_at_32->arguments /*arguments*/),__re_data_rename_at_30);
+		return __creg_rename_at_32;
+	};
+}}
+
+inline void __setup_macros_2a6a56609ab69a6 ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "regex_boost"),__context__) )
+	{
+		_Funcast_0x60_add_new_reader_macro_8964a4d0072fa52a(__context__,((char *) "regex"),das_new<struct regex_boost::RegexReader>::make_and_init(__context__,[&]() { return RegexReader_6158dcc9c461787e(__context__); }));
+	};
+}
+
+inline void _Funcast_0x60_add_new_reader_macro_8964a4d0072fa52a ( Context * __context__, char * const  __name_rename_at_515, struct regex_boost::RegexReader * const  __someClassPtr_rename_at_515 )
+{
+	smart_ptr_raw<ReaderMacro> __ann_rename_at_516; das_zero(__ann_rename_at_516); das_move(__ann_rename_at_516, _Funcast_0x60_make_reader_macro_ec80f1cb21d406cc(__context__,__name_rename_at_515,__someClassPtr_rename_at_515));
+	addModuleReaderMacro(thisModule(__context__,nullptr),__ann_rename_at_516,__context__);
+	das_delete_handle<smart_ptr_raw<ReaderMacro>>::clear(__context__,__ann_rename_at_516);
+}
+
+inline smart_ptr_raw<ReaderMacro> _Funcast_0x60_make_reader_macro_ec80f1cb21d406cc ( Context * __context__, char * const  __name_rename_at_465, struct regex_boost::RegexReader * const  __someClassPtr_rename_at_465 )
+{
+	StructInfo const  * __classInfo_rename_at_467 = (StructInfo const  *)_Funcrtti_0x60_class_info_4653091e6ecb64df(__context__,das_deref(__context__,__someClassPtr_rename_at_465));
+	return makeReaderMacro(__name_rename_at_465,__someClassPtr_rename_at_465,__classInfo_rename_at_467,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_6dda7ea5f2695554 ( Context * __context__, TArray<TTuple<16,range,char *>> &  __a_rename_at_285 )
+{
+	{
+		bool __need_loop_287 = true;
+		// aV : tuple<range;string> aka TT&
+		das_iterator<TArray<TTuple<16,range,char *>>> __aV_iterator(__a_rename_at_285);
+		TTuple<16,range,char *> * __aV_rename_at_287;
+		__need_loop_287 = __aV_iterator.first(__context__,(__aV_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __aV_iterator.next(__context__,(__aV_rename_at_287)) )
+		{
+			finalize_1db505b7ad774ab5(__context__,das_arg<TTuple<16,range,char *>>::pass((*__aV_rename_at_287)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_287));
+	};
+	builtin_array_free(das_arg<TArray<TTuple<16,range,char *>>>::pass(__a_rename_at_285),16,__context__);
+}
+
+inline void finalize_1db505b7ad774ab5 ( Context * __context__, TTuple<16,range,char *> &  ____this_rename_at_289 )
+{
+	memset(&(____this_rename_at_289), 0, 16);
+}
+
+inline void finalize_1eb5223d00df51b5 ( Context * __context__, struct regex::Regex &  ____this_rename_at_38 )
+{
+	das_invoke_function<void>::invoke<struct regex::ReNode * &>(__context__,Func(__context__->fnIdxByMangledName(/*@regex::finalize #ptr#ReNode#ref#explicit*/ 4120082102u)),____this_rename_at_38.root);
+	_Funcbuiltin_0x60_finalize_6dda7ea5f2695554(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(____this_rename_at_38.groups));
+	memset(&(____this_rename_at_38), 0, 80);
+}
+
+inline void finalize_a3a001a249ad2764 ( Context * __context__, struct regex_boost::RegexReader &  ____this_rename_at_11 )
+{
+	memset(&(____this_rename_at_11), 0, 24);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_4653091e6ecb64df ( Context * __context__, struct regex_boost::RegexReader const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// RegexReader_6158dcc9c461787e
+		aotLib[0xcc3c84c8e844b084] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct regex_boost::RegexReader (*) ( Context * __context__ ),&RegexReader_6158dcc9c461787e>>();
+	};
+		// _FuncRegexReader_0x27___finalize_81b745a088be5ca9
+		aotLib[0xc91686e93307ee4a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex_boost::RegexReader &  ),&_FuncRegexReader_0x27___finalize_81b745a088be5ca9>>();
+	};
+		// _FuncRegexReader_0x60_accept_205132cc65ab0e49
+		aotLib[0x2dd764e1af5ddb65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct regex_boost::RegexReader & , smart_ptr_raw<Program> const  , Module * const  , ExprReader * , int32_t , LineInfo const  &  ),&_FuncRegexReader_0x60_accept_205132cc65ab0e49>>();
+	};
+		// _FuncRegexReader_0x60_visit_72fc2e97932c4a83
+		aotLib[0x937333348a74ce14] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct regex_boost::RegexReader & , smart_ptr_raw<Program> const  , Module * const  , smart_ptr_raw<ExprReader> const   ),&_FuncRegexReader_0x60_visit_72fc2e97932c4a83>>();
+	};
+		// __setup_macros_2a6a56609ab69a6
+		aotLib[0x70b528b30a76a2a6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_2a6a56609ab69a6>>();
+	};
+		// _Funcast_0x60_add_new_reader_macro_8964a4d0072fa52a
+		aotLib[0xdcda000effd471ca] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct regex_boost::RegexReader * const   ),&_Funcast_0x60_add_new_reader_macro_8964a4d0072fa52a>>();
+	};
+		// _Funcast_0x60_make_reader_macro_ec80f1cb21d406cc
+		aotLib[0xc4f7caf310d3e3b3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ReaderMacro> (*) ( Context * __context__, char * const  , struct regex_boost::RegexReader * const   ),&_Funcast_0x60_make_reader_macro_ec80f1cb21d406cc>>();
+	};
+		// _Funcbuiltin_0x60_finalize_6dda7ea5f2695554
+		aotLib[0xb076ff460383fbc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,range,char *>> &  ),&_Funcbuiltin_0x60_finalize_6dda7ea5f2695554>>();
+	};
+		// finalize_1db505b7ad774ab5
+		aotLib[0x4bc36dc46e50113d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<16,range,char *> &  ),&finalize_1db505b7ad774ab5>>();
+	};
+		// finalize_1eb5223d00df51b5
+		aotLib[0x4d47ae56a4673a32] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex::Regex &  ),&finalize_1eb5223d00df51b5>>();
+	};
+		// finalize_a3a001a249ad2764
+		aotLib[0xeb809fe3791934f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct regex_boost::RegexReader &  ),&finalize_a3a001a249ad2764>>();
+	};
+		// _Funcrtti_0x60_class_info_4653091e6ecb64df
+		aotLib[0xb5c1e141a563be69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct regex_boost::RegexReader const  &  ),&_Funcrtti_0x60_class_info_4653091e6ecb64df>>();
+	};
+		// [[ init script ]]
+		aotLib[0xea3cf8daf563c7b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,146 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rst
+ // require fio
+#include "daScript/simulate/aot_builtin_fio.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+ // require regex
+ // require regex_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused structure df_header
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused enumeration ReOp
+// unused structure ReNode
+// unused structure Regex
+// unused structure RegexReader
+namespace rst {
+
+struct DocGroup {
+	char * name;
+	TArray<Function *> func;
+	bool hidden;
+};
+static_assert(sizeof(DocGroup)==40,"structure size mismatch with DAS");
+static_assert(offsetof(DocGroup,name)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(DocGroup,func)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(DocGroup,hidden)==32,"structure field offset mismatch with DAS");
+}
+namespace rst {
+
+struct _lambda_rst_748_30_1 {
+	Func DAS_COMMENT((bool,struct rst::_lambda_rst_748_30_1,char * * &)) __lambda;
+	Func DAS_COMMENT((void,struct rst::_lambda_rst_748_30_1 *)) __finalize;
+	int32_t __yield;
+	int32_t index;
+	TArray<char *> snp;
+	bool _loop_at_748;
+	int32_t i;
+	void * _pvar_0_at_748;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_748;
+};
+static_assert(sizeof(_lambda_rst_748_30_1)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_rst_748_30_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_rst_748_30_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_rst_748_30_1,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_rst_748_30_1,index)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_rst_748_30_1,snp)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_rst_748_30_1,_loop_at_748)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_rst_748_30_1,i)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_rst_748_30_1,_pvar_0_at_748)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_rst_748_30_1,_source_0_at_748)==56,"structure field offset mismatch with DAS");
+}
+
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,4221 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require small_array
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__713aafe3;
+extern StructInfo __struct_info__2fae7274;
+extern StructInfo __struct_info__17d0e062;
+extern StructInfo __struct_info__d8299e85;
+extern StructInfo __struct_info__89f0c0ca;
+extern StructInfo __struct_info__5ed6db18;
+extern TypeInfo __type_info__10db1c1d;
+extern TypeInfo __type_info__da50b805;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__f42f651e;
+extern TypeInfo __type_info__dc52e0d5;
+extern TypeInfo __type_info__c0e5e0ad;
+extern TypeInfo __type_info__8bc5634d;
+extern TypeInfo __type_info__bab365e;
+extern TypeInfo __type_info__7ec7955d;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__3737d9d1;
+extern TypeInfo __type_info__cd849a9b;
+extern TypeInfo __type_info__aaadd575;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__c2b9b42c;
+extern TypeInfo __type_info__6f381053;
+extern TypeInfo __type_info__261bce6f;
+extern TypeInfo __type_info__dd644f60;
+extern TypeInfo __type_info__e749bd33;
+extern TypeInfo __type_info__73c8114e;
+extern TypeInfo __type_info__7da04467;
+extern TypeInfo __type_info__b1ceb1d4;
+extern TypeInfo __type_info__653ef983;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__1cb4fa6d;
+extern TypeInfo __type_info__515c0a3;
+extern TypeInfo __type_info__ccb7c90a;
+extern TypeInfo __type_info__b3bcfd53;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__46fed0f3;
+extern TypeInfo __type_info__523f6667;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__6d1d425d;
+extern TypeInfo __type_info__ebcc21eb;
+extern TypeInfo __type_info__5ef84086;
+extern TypeInfo __type_info__7a1c4eb7;
+extern TypeInfo __type_info__2b3e54e5;
+extern TypeInfo __type_info__4de83811;
+extern TypeInfo __type_info__94ae69a3;
+extern TypeInfo __type_info__87a6e894;
+extern TypeInfo __type_info__a6a527e0;
+extern TypeInfo __type_info__83498580;
+extern TypeInfo __type_info__a960d6ab;
+extern TypeInfo __type_info__b108e3;
+extern TypeInfo __type_info__d7eb08f1;
+extern TypeInfo __type_info__f486e881;
+extern TypeInfo __type_info__fdd27932;
+extern TypeInfo __type_info__1683ec13;
+extern TypeInfo __type_info__1d5a02b1;
+extern TypeInfo __type_info__8f8da119;
+extern TypeInfo __type_info__d9283a27;
+extern TypeInfo __type_info__5bc565f1;
+extern TypeInfo __type_info__819d499d;
+extern TypeInfo __type_info__81be117c;
+extern TypeInfo __type_info__b5d7ce5d;
+extern TypeInfo __type_info__32f7a66b;
+extern TypeInfo __type_info__cae7a171;
+extern TypeInfo __type_info__453f3d02;
+extern TypeInfo __type_info__30023ebb;
+extern TypeInfo __type_info__dcfff1ff;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__4edf488d;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__8fce7587;
+extern TypeInfo __type_info__a01f8605;
+extern TypeInfo __type_info__15780d4b;
+extern TypeInfo __type_info__7ec0323f;
+extern TypeInfo __type_info__ae076c;
+extern TypeInfo __type_info__ff9fd5d3;
+extern TypeInfo __type_info__3c4f7906;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__c4ccbb7e;
+extern TypeInfo __type_info__8e3dc326;
+extern TypeInfo __type_info__d73ee2dd;
+extern TypeInfo __type_info__72ae9081;
+extern TypeInfo __type_info__c831b26a;
+extern TypeInfo __type_info__d25748d6;
+extern TypeInfo __type_info__3a70d70f;
+extern TypeInfo __type_info__7c510f91;
+extern TypeInfo __type_info__b66d9ef1;
+extern TypeInfo __type_info__91c4dfb3;
+extern TypeInfo __type_info__15e14f92;
+extern TypeInfo __type_info__ebc70931;
+extern TypeInfo __type_info__3c8fd4b4;
+extern TypeInfo __type_info__4e52e6ae;
+extern TypeInfo __type_info__8891fc55;
+extern TypeInfo __type_info__7ebfa292;
+extern TypeInfo __type_info__9773df12;
+extern TypeInfo __type_info__317f8d25;
+extern TypeInfo __type_info__3c6fa07f;
+extern TypeInfo __type_info__9920ba3b;
+extern TypeInfo __type_info__8f234b97;
+extern TypeInfo __type_info__87882376;
+extern TypeInfo __type_info__5f6a7cad;
+extern TypeInfo __type_info__10b7decc;
+extern TypeInfo __type_info__c9679a50;
+extern TypeInfo __type_info__8494e015;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__b867c43d;
+extern TypeInfo __type_info__9e20c21a;
+extern TypeInfo __type_info__b9491240;
+extern TypeInfo __type_info__8ce26751;
+extern TypeInfo __type_info__963c776b;
+extern TypeInfo __type_info__b58fe8a6;
+extern TypeInfo __type_info__5527f9ed;
+extern TypeInfo __type_info__fba33907;
+extern TypeInfo __type_info__51c55633;
+extern TypeInfo __type_info__84917dd0;
+extern TypeInfo __type_info__b9a2b501;
+extern TypeInfo __type_info__68f47b8a;
+extern TypeInfo __type_info__34157e23;
+extern TypeInfo __type_info__37ca469d;
+extern TypeInfo __type_info__14c14bf4;
+extern TypeInfo __type_info__4fa9a2d8;
+extern TypeInfo __type_info__d4f3571c;
+extern TypeInfo __type_info__2d8fb614;
+extern TypeInfo __type_info__10edfe53;
+extern TypeInfo __type_info__a07921bf;
+extern TypeInfo __type_info__b38eb5b3;
+extern TypeInfo __type_info__2481035b;
+extern TypeInfo __type_info__a1ba446d;
+extern TypeInfo __type_info__9fee7340;
+extern TypeInfo __type_info__ada7aa90;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__664a2fe7;
+extern TypeInfo __type_info__655bd8a4;
+extern TypeInfo __type_info__2f1bdc9a;
+extern TypeInfo __type_info__8fd2ec2e;
+extern TypeInfo __type_info__5dc56917;
+extern TypeInfo __type_info__d16acbbb;
+extern TypeInfo __type_info__d4aee91;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__2ba0095f;
+extern TypeInfo __type_info__d057deb9;
+extern TypeInfo __type_info__6dd946fa;
+extern TypeInfo __type_info__32b24044;
+extern TypeInfo __type_info__531e5432;
+extern TypeInfo __type_info__e0a995b4;
+extern TypeInfo __type_info__368fac4c;
+extern TypeInfo __type_info__76b8ad03;
+extern TypeInfo __type_info__48d9d78;
+extern TypeInfo __type_info__6535171f;
+extern TypeInfo __type_info__9ee277f5;
+extern TypeInfo __type_info__e7b89eff;
+extern TypeInfo __type_info__7454c789;
+extern TypeInfo __type_info__8f8b0275;
+extern TypeInfo __type_info__764dc75a;
+extern TypeInfo __type_info__e2deda56;
+extern TypeInfo __type_info__5a28d785;
+extern TypeInfo __type_info__9445fbcf;
+extern TypeInfo __type_info__7df5ef2c;
+extern TypeInfo __type_info__bf2d884b;
+extern TypeInfo __type_info__6c2a86f9;
+extern TypeInfo __type_info__e97755bb;
+extern TypeInfo __type_info__295e937b;
+extern TypeInfo __type_info__4ca379ed;
+extern TypeInfo __type_info__1d3d6764;
+extern TypeInfo __type_info__251bccdc;
+extern TypeInfo __type_info__bd757ca;
+extern TypeInfo __type_info__5ac5645e;
+extern TypeInfo __type_info__e4d4c1e4;
+extern TypeInfo __type_info__d514cba4;
+extern TypeInfo __type_info__60d19370;
+extern TypeInfo __type_info__c5ddc6fa;
+extern TypeInfo __type_info__9f20c3ad;
+extern TypeInfo __type_info__1b3c6d8d;
+extern TypeInfo __type_info__6529db2b;
+extern TypeInfo __type_info__a8d37f6f;
+extern TypeInfo __type_info__d7ddca10;
+extern TypeInfo __type_info__130d26f9;
+extern TypeInfo __type_info__721467d3;
+extern TypeInfo __type_info__8728109a;
+extern TypeInfo __type_info__1bb5fdf7;
+extern TypeInfo __type_info__a65edd74;
+extern TypeInfo __type_info__76972586;
+extern TypeInfo __type_info__5ca338ad;
+extern TypeInfo __type_info__d180e781;
+extern TypeInfo __type_info__74b0f2db;
+extern TypeInfo __type_info__cf57dd26;
+extern TypeInfo __type_info__535415eb;
+extern TypeInfo __type_info__ccc9122b;
+extern TypeInfo __type_info__b2cb4a2b;
+extern TypeInfo __type_info__a5b6b194;
+extern TypeInfo __type_info__ccee123b;
+extern TypeInfo __type_info__374b4b09;
+extern TypeInfo __type_info__9338185;
+extern TypeInfo __type_info__cf52b1be;
+extern TypeInfo __type_info__b049b391;
+extern TypeInfo __type_info__9a5b5986;
+extern TypeInfo __type_info__7856e79d;
+extern TypeInfo __type_info__75b7ce79;
+extern TypeInfo __type_info__5f1adc0e;
+extern TypeInfo __type_info__cd57da00;
+extern TypeInfo __type_info__c1bd2f4c;
+extern TypeInfo __type_info__a8981616;
+extern TypeInfo __type_info__88de8728;
+extern TypeInfo __type_info__1b9f61f8;
+extern TypeInfo __type_info__79323f61;
+extern TypeInfo __type_info__231bc9b6;
+extern TypeInfo __type_info__8121e453;
+extern TypeInfo __type_info__d3ebcc43;
+extern TypeInfo __type_info__f2cdf1a0;
+extern TypeInfo __type_info__d8ac9e75;
+extern TypeInfo __type_info__fc0d99dd;
+extern TypeInfo __type_info__c1e3d526;
+extern TypeInfo __type_info__c627fc0a;
+extern TypeInfo __type_info__a40a0d70;
+extern TypeInfo __type_info__858d2368;
+extern TypeInfo __type_info__c6cb0399;
+extern TypeInfo __type_info__f66d4d6;
+extern TypeInfo __type_info__fe4bfa47;
+extern TypeInfo __type_info__cb3ec93c;
+extern TypeInfo __type_info__27a9a437;
+extern TypeInfo __type_info__374bcd9;
+extern TypeInfo __type_info__39dd41c1;
+extern TypeInfo __type_info__d00bb3d6;
+extern TypeInfo __type_info__f1eeff10;
+extern TypeInfo __type_info__b081465d;
+extern TypeInfo __type_info__8c0d0a29;
+extern TypeInfo __type_info__cf76cec3;
+extern TypeInfo __type_info__be386f7a;
+extern TypeInfo __type_info__ed20bab;
+extern TypeInfo __type_info__309172d;
+extern VarInfo __var_info__655e37da;
+extern VarInfo __var_info__8cae215c;
+extern VarInfo __var_info__98c60d5c;
+extern VarInfo __var_info__81e64471;
+extern VarInfo __var_info__e8cd6348;
+extern VarInfo __var_info__21dc0f2b;
+extern VarInfo __var_info__cc4c841;
+extern VarInfo __var_info__17b491;
+extern VarInfo __var_info__a3389722;
+extern VarInfo __var_info__aefafc88;
+extern VarInfo __var_info__14bcb702;
+extern VarInfo __var_info__f34461a5;
+extern VarInfo __var_info__6e97f0ea;
+extern VarInfo __var_info__bd94d45e;
+extern VarInfo __var_info__ace1480d;
+extern VarInfo __var_info__11aeae1c;
+extern VarInfo __var_info__a1981da5;
+extern VarInfo __var_info__6f4d2d82;
+extern VarInfo __var_info__8965dfd1;
+extern VarInfo __var_info__baa2f162;
+extern VarInfo __var_info__e89e0dfe;
+extern VarInfo __var_info__af8f2435;
+extern VarInfo __var_info__442b5d7f;
+extern VarInfo __var_info__d4f9c662;
+extern VarInfo __var_info__fde3ac29;
+extern VarInfo __var_info__7607b7d3;
+extern VarInfo __var_info__d6c089cc;
+extern VarInfo __var_info__301336b9;
+extern VarInfo __var_info__e58427b3;
+extern VarInfo __var_info__b18c8024;
+extern VarInfo __var_info__d561f037;
+extern VarInfo __var_info__ea2c39a8;
+extern VarInfo __var_info__a92f607e;
+extern VarInfo __var_info__9f12d2db;
+extern VarInfo __var_info__c84acfc5;
+extern VarInfo __var_info__f7045e6f;
+extern VarInfo __var_info__8c000b33;
+extern VarInfo __var_info__7c486554;
+extern VarInfo __var_info__bc050f2a;
+extern VarInfo __var_info__473c4f4d;
+extern VarInfo __var_info__128e68c7;
+extern VarInfo __var_info__35e4f53d;
+extern VarInfo __var_info__529b2933;
+extern VarInfo __var_info__8d4497d0;
+extern VarInfo __var_info__98dc5351;
+extern VarInfo __var_info__fdbf4730;
+extern VarInfo __var_info__de11b7cd;
+extern VarInfo __var_info__e1438b47;
+extern VarInfo __var_info__f3715aaa;
+extern VarInfo __var_info__db853894;
+extern VarInfo __var_info__6c13d877;
+extern VarInfo __var_info__84572b6e;
+extern VarInfo __var_info__383d618;
+extern VarInfo __var_info__439427d4;
+extern VarInfo __var_info__f05e42f7;
+extern VarInfo __var_info__e1903c80;
+extern VarInfo __var_info__f7387f87;
+extern VarInfo __var_info__233f2ecd;
+extern VarInfo __var_info__ad5a0405;
+extern VarInfo __var_info__f902c2de;
+extern VarInfo __var_info__6758a118;
+extern VarInfo __var_info__215e3c49;
+extern VarInfo __var_info__75bd5101;
+extern VarInfo __var_info__dda489ff;
+extern VarInfo __var_info__a88b2040;
+extern VarInfo __var_info__3b14171a;
+extern VarInfo __var_info__a0da95f7;
+extern VarInfo __var_info__835a4d58;
+extern VarInfo __var_info__ffc5510f;
+extern VarInfo __var_info__90579e0c;
+extern VarInfo __var_info__94b680e0;
+extern VarInfo __var_info__fd6fad6;
+extern VarInfo __var_info__21e2c27c;
+extern VarInfo __var_info__359e840f;
+extern VarInfo __var_info__c311b554;
+extern VarInfo __var_info__80719338;
+extern VarInfo __var_info__d1222c0d;
+extern VarInfo __var_info__6d3d92b1;
+extern VarInfo __var_info__988afcfd;
+extern VarInfo __var_info__d58c4281;
+extern VarInfo __var_info__899d8766;
+extern VarInfo __var_info__775fa14c;
+extern VarInfo __var_info__dc873d46;
+extern VarInfo __var_info__598d38fe;
+extern VarInfo __var_info__b0344663;
+extern VarInfo __var_info__d11ed6d8;
+extern VarInfo __var_info__cc1a33f1;
+extern VarInfo __var_info__d811ae5b;
+extern VarInfo __var_info__384557da;
+extern VarInfo __var_info__1311b0ac;
+extern VarInfo __var_info__80289013;
+extern VarInfo __var_info__6eaa7d50;
+extern VarInfo __var_info__74b89556;
+extern VarInfo __var_info__ca23ae4c;
+extern VarInfo __var_info__284e759;
+extern VarInfo __var_info__9cd677e8;
+extern VarInfo __var_info__cb496173;
+extern VarInfo __var_info__2663c954;
+extern VarInfo __var_info__917879ff;
+extern VarInfo __var_info__e660163e;
+extern VarInfo __var_info__2cbdc12a;
+extern VarInfo __var_info__ab019c8a;
+extern VarInfo __var_info__cb23afdf;
+extern VarInfo __var_info__5fa7d37b;
+extern VarInfo __var_info__38c3eba1;
+extern VarInfo __var_info__7c352f3e;
+extern VarInfo __var_info__3faadbe1;
+extern VarInfo __var_info__adfc1354;
+extern VarInfo __var_info__c8e5f55;
+extern VarInfo __var_info__9d59dc9b;
+extern VarInfo __var_info__31003f6c;
+extern VarInfo __var_info__4ea380c9;
+extern VarInfo __var_info__5b5aed7e;
+extern VarInfo __var_info__2544ff76;
+extern VarInfo __var_info__35318804;
+extern VarInfo __var_info__1f26d85a;
+extern VarInfo __var_info__7ea03b0a;
+extern VarInfo __var_info__3f5db93a;
+extern VarInfo __var_info__7894c6d;
+extern VarInfo __var_info__b9189477;
+extern VarInfo __var_info__7887d69f;
+extern VarInfo __var_info__c3059e01;
+extern VarInfo __var_info__345035e;
+extern VarInfo __var_info__56bc3b31;
+extern VarInfo __var_info__e85d642a;
+extern VarInfo __var_info__fff52e7f;
+extern VarInfo __var_info__a433d831;
+extern VarInfo __var_info__cafe3512;
+extern VarInfo __var_info__29e6b331;
+extern VarInfo __var_info__a64ce65d;
+extern VarInfo __var_info__dc5ab88a;
+extern VarInfo __var_info__fcdb84a;
+extern VarInfo __var_info__ad56015e;
+extern VarInfo __var_info__cb3eecea;
+extern VarInfo __var_info__378f9ccc;
+extern VarInfo __var_info__e4f77dd3;
+extern VarInfo __var_info__84a1f0b5;
+extern VarInfo __var_info__ccdb76a3;
+extern VarInfo __var_info__344d19dc;
+extern VarInfo __var_info__5bede5bc;
+extern VarInfo __var_info__4c957b89;
+extern VarInfo __var_info__ba4af169;
+extern VarInfo __var_info__cb50360b;
+extern VarInfo __var_info__d25aa8cc;
+extern VarInfo __var_info__c35127d9;
+extern VarInfo __var_info__ba8cda98;
+extern VarInfo __var_info__cf04c484;
+extern VarInfo __var_info__e4dec3a3;
+extern VarInfo __var_info__999f9e51;
+extern VarInfo __var_info__9f4cdb58;
+extern VarInfo __var_info__af4d385a;
+extern VarInfo __var_info__e39a31a9;
+extern VarInfo __var_info__36422837;
+extern VarInfo __var_info__e831210f;
+extern VarInfo __var_info__43f7c55f;
+extern VarInfo __var_info__955e0b53;
+extern VarInfo __var_info__491e734a;
+extern VarInfo __var_info__73590db4;
+extern VarInfo __var_info__52c5da8;
+extern VarInfo __var_info__1f78c3bf;
+extern VarInfo __var_info__13f77b13;
+extern VarInfo __var_info__5e90f2e0;
+extern VarInfo __var_info__159c68d2;
+extern VarInfo __var_info__824a1c45;
+extern VarInfo __var_info__f25a787;
+extern VarInfo __var_info__3924c25d;
+extern VarInfo __var_info__8c229562;
+extern VarInfo __var_info__362ecdc0;
+extern VarInfo __var_info__de842a27;
+extern VarInfo __var_info__4048a67e;
+extern VarInfo __var_info__88bd350e;
+extern VarInfo __var_info__a3d70e25;
+extern VarInfo __var_info__7cfe7756;
+extern VarInfo __var_info__f8571359;
+extern VarInfo __var_info__89b1ed2f;
+extern VarInfo __var_info__ed636a01;
+extern VarInfo __var_info__3b82a2be;
+extern VarInfo __var_info__4f32f1d0;
+extern VarInfo __var_info__134ae51;
+extern VarInfo __var_info__ad464f32;
+extern VarInfo __var_info__3ea249af;
+extern VarInfo __var_info__4be8c729;
+extern VarInfo __var_info__781e42ff;
+extern VarInfo __var_info__b52b75c6;
+extern VarInfo __var_info__989f9cbe;
+extern VarInfo __var_info__c9d28329;
+extern VarInfo __var_info__b69afd24;
+extern VarInfo __var_info__45dae5c8;
+extern VarInfo __var_info__754e508d;
+extern VarInfo __var_info__db88d48d;
+extern VarInfo __var_info__c4a28f5d;
+extern VarInfo __var_info__2965e55d;
+extern VarInfo __var_info__eea3d7b7;
+extern VarInfo __var_info__2a51bc45;
+extern VarInfo __var_info__a6016d01;
+extern VarInfo __var_info__918f2fa8;
+extern VarInfo __var_info__d15980dd;
+extern VarInfo __var_info__a80e5f39;
+extern VarInfo __var_info__52b11500;
+extern VarInfo __var_info__88b468bd;
+extern VarInfo __var_info__a658a917;
+extern VarInfo __var_info__d676fdc3;
+extern VarInfo __var_info__4f35c13c;
+extern VarInfo __var_info__ac1f0992;
+extern VarInfo __var_info__f502f93d;
+extern VarInfo __var_info__901de769;
+extern VarInfo __var_info__cbd679f5;
+extern VarInfo __var_info__4bbc29e0;
+extern VarInfo __var_info__a5960d57;
+extern VarInfo __var_info__702f6c0c;
+extern VarInfo __var_info__9e841a65;
+extern VarInfo __var_info__2f87634a;
+extern VarInfo __var_info__f567494e;
+extern VarInfo __var_info__880f2249;
+extern VarInfo __var_info__a6095a93;
+extern VarInfo __var_info__1f11402;
+extern VarInfo __var_info__d35aaa5f;
+extern VarInfo __var_info__1c56de;
+extern VarInfo __var_info__9f981a7f;
+extern VarInfo __var_info__d6bd6ae8;
+extern VarInfo __var_info__f3ae166d;
+extern VarInfo __var_info__67cfaaa3;
+extern VarInfo __var_info__37233ab;
+extern VarInfo __var_info__9b9fa177;
+extern VarInfo __var_info__a10f6f08;
+extern VarInfo __var_info__43eadf9f;
+extern VarInfo __var_info__d9eea817;
+extern VarInfo __var_info__b39ab720;
+extern VarInfo __var_info__d999f930;
+extern VarInfo __var_info__59a80c5a;
+extern VarInfo __var_info__5cd4d5a9;
+extern VarInfo __var_info__8644430a;
+extern VarInfo __var_info__ba63339f;
+extern VarInfo __var_info__a14b7311;
+extern VarInfo __var_info__b0efa126;
+extern VarInfo __var_info__f2348094;
+extern VarInfo __var_info__41370bda;
+extern VarInfo __var_info__7e384a49;
+extern VarInfo __var_info__15e49214;
+extern VarInfo __var_info__e1686f7;
+extern VarInfo __var_info__118e6734;
+extern VarInfo __var_info__6c08a2e5;
+extern VarInfo __var_info__827a7b9f;
+extern VarInfo __var_info__b5313fec;
+extern VarInfo __var_info__21588a7a;
+extern VarInfo __var_info__aa30df58;
+extern VarInfo __var_info__b35acbb;
+extern VarInfo __var_info__1220ad2f;
+extern VarInfo __var_info__67b843da;
+extern VarInfo __var_info__7bfc60e8;
+extern VarInfo __var_info__cc0f5e2c;
+extern VarInfo __var_info__64f4b569;
+extern VarInfo __var_info__d8bba517;
+extern VarInfo __var_info__c6bf2bd2;
+extern VarInfo __var_info__2d3a4cbf;
+extern VarInfo __var_info__dfbb50cb;
+extern VarInfo __var_info__3f48a4eb;
+extern VarInfo __var_info__fbd35c53;
+extern VarInfo __var_info__d7cd20f;
+extern VarInfo __var_info__a9b0cc55;
+extern VarInfo __var_info__a246be3c;
+extern VarInfo __var_info__6d5c4cbf;
+extern VarInfo __var_info__e95012d3;
+extern VarInfo __var_info__6fc12b47;
+extern VarInfo __var_info__5386100d;
+extern VarInfo __var_info__46c6c1aa;
+extern VarInfo __var_info__7a87bd0e;
+extern VarInfo __var_info__26dcc9ef;
+extern VarInfo __var_info__919eabb1;
+extern VarInfo __var_info__12214d06;
+extern VarInfo __var_info__dbe74630;
+extern VarInfo __var_info__388ebfb4;
+extern VarInfo __var_info__97b1c4ed;
+extern VarInfo __var_info__47035ac2;
+extern VarInfo __var_info__62000f4;
+extern VarInfo __var_info__9edf622c;
+extern VarInfo __var_info__b7c8ff8a;
+extern VarInfo __var_info__a2a4fede;
+extern VarInfo __var_info__31c5695d;
+extern VarInfo __var_info__5f51b55e;
+extern VarInfo __var_info__bd3bde81;
+extern VarInfo __var_info__d5035a4e;
+extern VarInfo __var_info__cdf950db;
+extern VarInfo __var_info__257704a0;
+extern VarInfo __var_info__5afbb756;
+extern VarInfo __var_info__cb901576;
+extern VarInfo __var_info__ab6bc7c7;
+extern VarInfo __var_info__525d24c;
+extern VarInfo __var_info__171280cf;
+extern VarInfo __var_info__f891e8e9;
+extern VarInfo __var_info__e4eb34d9;
+extern VarInfo __var_info__a7045273;
+extern VarInfo __var_info__b632464e;
+extern VarInfo __var_info__85473ce6;
+extern VarInfo __var_info__d05aa5a6;
+extern VarInfo __var_info__b2d7e987;
+extern VarInfo __var_info__3fddb549;
+extern VarInfo __var_info__9e9818ec;
+extern VarInfo __var_info__e6a0bda4;
+extern VarInfo __var_info__93c61a3;
+extern VarInfo __var_info__90bf70c9;
+extern VarInfo __var_info__c3c74ef1;
+extern VarInfo __var_info__fb05f748;
+extern VarInfo __var_info__57bc3cc4;
+extern VarInfo __var_info__c053d161;
+extern VarInfo __var_info__b8ba8abc;
+extern VarInfo __var_info__893ef4cc;
+extern VarInfo __var_info__3566a2c4;
+extern VarInfo __var_info__78532346;
+extern VarInfo __var_info__b873b4e2;
+extern VarInfo __var_info__64bce7f2;
+extern VarInfo __var_info__7d3530d1;
+extern VarInfo __var_info__ac29e6b9;
+extern VarInfo __var_info__56569ad4;
+extern VarInfo __var_info__1ca461a0;
+extern VarInfo __var_info__89e422d2;
+extern VarInfo __var_info__519b27a0;
+extern VarInfo __var_info__435d9f3f;
+extern VarInfo __var_info__a93e35ec;
+extern VarInfo __var_info__cfe854bb;
+extern VarInfo __var_info__1bbde4e9;
+extern VarInfo __var_info__1413a912;
+extern VarInfo __var_info__d036b837;
+extern VarInfo __var_info__9b78bd2b;
+extern VarInfo __var_info__822a0a6f;
+extern VarInfo __var_info__8e000e59;
+extern VarInfo __var_info__f1675330;
+extern VarInfo __var_info__63a3eac;
+extern VarInfo __var_info__3bbe5820;
+extern VarInfo __var_info__45f3c674;
+extern VarInfo __var_info__ee052303;
+extern VarInfo __var_info__9bd0e54c;
+extern VarInfo __var_info__ee4cc0de;
+extern VarInfo __var_info__eb549b2b;
+extern VarInfo __var_info__94f4e6e0;
+extern VarInfo __var_info__6982e200;
+extern VarInfo __var_info__9ee4a50c;
+extern VarInfo __var_info__c2ec29d8;
+extern VarInfo __var_info__3e4933fe;
+extern VarInfo __var_info__c90a9df1;
+extern VarInfo __var_info__8d000cc6;
+extern VarInfo __var_info__29b1a3bb;
+extern VarInfo __var_info__8a0a63b6;
+extern VarInfo __var_info__e8005be5;
+extern VarInfo __var_info__a9db41f5;
+extern VarInfo __var_info__f2f1d3aa;
+extern VarInfo __var_info__3e48a358;
+extern VarInfo __var_info__d1708300;
+extern VarInfo __var_info__61bb9be9;
+extern VarInfo __var_info__5532d30;
+extern VarInfo __var_info__8b3ef7f2;
+extern VarInfo __var_info__9edcbce;
+extern VarInfo __var_info__8f9f8e93;
+extern VarInfo __var_info__ebf77614;
+extern VarInfo __var_info__52ff6128;
+extern VarInfo __var_info__58b7fc54;
+extern VarInfo __var_info__a8f3fc80;
+extern VarInfo __var_info__cb80a4fa;
+extern VarInfo __var_info__c32d1370;
+extern VarInfo __var_info__71b4c6bf;
+extern VarInfo __var_info__a14c8807;
+extern VarInfo __var_info__bb163ec9;
+extern VarInfo __var_info__d7a0c00a;
+extern VarInfo __var_info__e06cc61f;
+extern VarInfo __var_info__2a0a26ae;
+extern VarInfo __var_info__d62685b2;
+extern VarInfo __var_info__10bf88c5;
+extern VarInfo __var_info__33655228;
+extern VarInfo __var_info__5aac8631;
+extern VarInfo __var_info__1c9914bb;
+extern VarInfo __var_info__f4999d8b;
+extern VarInfo __var_info__4c1aef66;
+extern VarInfo __var_info__42082e22;
+extern VarInfo __var_info__55762a94;
+extern VarInfo __var_info__6521e890;
+extern VarInfo __var_info__e99a3b1b;
+extern VarInfo __var_info__92e3d111;
+extern VarInfo __var_info__554a21ae;
+extern VarInfo __var_info__56310dd4;
+extern VarInfo __var_info__de0d9283;
+extern VarInfo __var_info__2faa5a53;
+extern VarInfo __var_info__9cd84da2;
+extern VarInfo __var_info__afac4da3;
+extern VarInfo __var_info__f41f5a;
+extern VarInfo __var_info__4ed6b54c;
+extern VarInfo __var_info__1dd0d240;
+extern VarInfo __var_info__dcd95cf7;
+extern VarInfo __var_info__1fff0112;
+extern VarInfo __var_info__cdf3a38f;
+extern VarInfo __var_info__7447bb4f;
+extern VarInfo __var_info__915be3cd;
+extern VarInfo __var_info__c923acb9;
+extern VarInfo __var_info__c5f99f7a;
+extern VarInfo __var_info__a628088b;
+extern VarInfo __var_info__a0ecfbb9;
+extern VarInfo __var_info__bac4281b;
+extern VarInfo __var_info__8b73a850;
+extern VarInfo __var_info__7290ff5c;
+extern VarInfo __var_info__490512e0;
+extern VarInfo __var_info__afd807ea;
+extern VarInfo __var_info__1823315a;
+extern VarInfo __var_info__757540b8;
+extern VarInfo __var_info__7f4a92a8;
+extern VarInfo __var_info__75c92fd3;
+extern VarInfo __var_info__949a3bae;
+extern VarInfo __var_info__e3083f3d;
+extern VarInfo __var_info__9356e5ba;
+extern VarInfo __var_info__90a51465;
+extern VarInfo __var_info__2f133526;
+extern VarInfo __var_info__c6dba628;
+extern VarInfo __var_info__f25fabc1;
+extern VarInfo __var_info__78bcb4df;
+extern VarInfo __var_info__4f717bf5;
+extern VarInfo __var_info__285c303f;
+extern VarInfo __var_info__e1345261;
+extern VarInfo __var_info__4fa54769;
+extern VarInfo __var_info__8f4c9038;
+extern VarInfo __var_info__6c97d67;
+extern VarInfo __var_info__126ea055;
+extern VarInfo __var_info__d5146090;
+extern VarInfo __var_info__21f91cf0;
+extern VarInfo __var_info__d711acc8;
+extern VarInfo __var_info__eb653800;
+extern VarInfo __var_info__10f347bd;
+extern VarInfo __var_info__c93f0085;
+extern VarInfo __var_info__233a0f5e;
+extern VarInfo __var_info__1e070140;
+extern VarInfo __var_info__2c383e55;
+extern VarInfo __var_info__43b9e565;
+extern VarInfo __var_info__f2b8de74;
+extern VarInfo __var_info__46efd33e;
+extern VarInfo __var_info__f3cfe2fe;
+extern VarInfo __var_info__ae8d05f1;
+extern VarInfo __var_info__b08b6929;
+extern VarInfo __var_info__a71bbede;
+extern VarInfo __var_info__7acd6d0b;
+extern VarInfo __var_info__ba5333e6;
+extern VarInfo __var_info__6dbb285b;
+extern VarInfo __var_info__58e8e746;
+extern VarInfo __var_info__cc02d1d4;
+extern VarInfo __var_info__688c4c1e;
+extern VarInfo __var_info__a03e40dd;
+extern VarInfo __var_info__2f90ec93;
+extern VarInfo __var_info__a54ce4ca;
+extern VarInfo __var_info__83d50dee;
+extern VarInfo __var_info__178806c2;
+extern VarInfo __var_info__55a1f5a1;
+extern VarInfo __var_info__a74c85b9;
+extern VarInfo __var_info__717f8e67;
+extern VarInfo __var_info__f95f2045;
+extern VarInfo __var_info__2af4d3dc;
+extern VarInfo __var_info__23fa073a;
+extern VarInfo __var_info__a343220e;
+extern VarInfo __var_info__5ca5ff1d;
+extern VarInfo __var_info__108e65a1;
+extern VarInfo __var_info__bec657ef;
+extern VarInfo __var_info__b4355e7;
+extern VarInfo __var_info__b7d4d4bf;
+extern VarInfo __var_info__89631998;
+extern VarInfo __var_info__13c3afaf;
+extern VarInfo __var_info__a216b644;
+extern VarInfo __var_info__5fa0ff2d;
+extern VarInfo __var_info__a42b136c;
+extern VarInfo __var_info__25c0eaac;
+extern VarInfo __var_info__e51104e3;
+extern VarInfo __var_info__888bf034;
+extern VarInfo __var_info__d7b465cc;
+extern VarInfo __var_info__1ad4800e;
+extern VarInfo __var_info__40fc627a;
+extern VarInfo __var_info__dbd063e3;
+extern VarInfo __var_info__66a30bef;
+extern VarInfo __var_info__9ea2db8;
+extern VarInfo __var_info__3463b662;
+extern VarInfo __var_info__7705b54f;
+extern VarInfo __var_info__ebd6bd76;
+extern VarInfo __var_info__c91d0b87;
+extern VarInfo __var_info__9794b2fb;
+extern VarInfo __var_info__d6146223;
+extern VarInfo __var_info__319243ae;
+extern VarInfo __var_info__169d2283;
+extern VarInfo __var_info__546203a;
+extern VarInfo __var_info__cbc8f6a;
+extern VarInfo __var_info__452f6688;
+extern VarInfo __var_info__3113384c;
+extern VarInfo __var_info__7e353264;
+extern VarInfo __var_info__9b4cd50c;
+extern VarInfo __var_info__c003c6e5;
+extern VarInfo __var_info__b1d0bbc3;
+extern VarInfo __var_info__327e2124;
+extern VarInfo __var_info__3601ee7e;
+extern VarInfo __var_info__1bb3c1b5;
+extern VarInfo __var_info__cf4336da;
+extern VarInfo __var_info__5c9b38f1;
+extern VarInfo __var_info__ae1a919f;
+extern VarInfo __var_info__1d6435a3;
+extern VarInfo __var_info__35133e98;
+extern VarInfo __var_info__39fc6bb1;
+extern VarInfo __var_info__36bf6516;
+extern VarInfo __var_info__4ff0f910;
+extern VarInfo __var_info__3021cb;
+extern VarInfo __var_info__5508e573;
+extern VarInfo __var_info__b50a9c8d;
+extern VarInfo __var_info__21052a3e;
+extern VarInfo __var_info__ffd9fe3a;
+extern VarInfo __var_info__55bc399e;
+extern VarInfo __var_info__af00471;
+extern VarInfo __var_info__851fa42c;
+extern VarInfo __var_info__42823b0b;
+extern VarInfo __var_info__7776bab9;
+extern VarInfo __var_info__e9e73a57;
+extern VarInfo __var_info__ee0efbc3;
+extern VarInfo __var_info__cea9756b;
+extern VarInfo __var_info__ea5d24a1;
+extern VarInfo __var_info__1f2d75d0;
+extern VarInfo __var_info__7778c4db;
+extern VarInfo __var_info__3cb36c5c;
+extern VarInfo __var_info__ef9a448d;
+extern VarInfo __var_info__f48812b8;
+extern VarInfo __var_info__f22346f5;
+extern VarInfo __var_info__d89707df;
+extern VarInfo __var_info__584a9874;
+extern VarInfo __var_info__ae308407;
+extern VarInfo __var_info__4a0238bf;
+extern VarInfo __var_info__92b26d15;
+extern VarInfo __var_info__589b32a5;
+extern VarInfo __var_info__94bb64af;
+extern VarInfo __var_info__6c164ebf;
+extern VarInfo __var_info__c985a48c;
+extern VarInfo __var_info__1c524c4f;
+extern VarInfo __var_info__eee3bc09;
+extern VarInfo __var_info__f1edd27b;
+extern VarInfo __var_info__2c21d013;
+extern VarInfo __var_info__e89a3988;
+extern VarInfo __var_info__31ca940d;
+extern VarInfo __var_info__2960a7f6;
+extern VarInfo __var_info__d9ab9409;
+extern VarInfo __var_info__8a3ef65f;
+extern VarInfo __var_info__bf6c2e7c;
+extern VarInfo __var_info__db146a02;
+extern VarInfo __var_info__25069bca;
+extern VarInfo __var_info__4a66add7;
+extern VarInfo __var_info__c2023960;
+extern VarInfo __var_info__fdcc980e;
+extern VarInfo __var_info__9731e280;
+extern VarInfo __var_info__d76915b6;
+extern VarInfo __var_info__fdba97c2;
+extern VarInfo __var_info__28ff7fc0;
+extern VarInfo __var_info__1849f5d1;
+extern VarInfo __var_info__f7a010db;
+extern VarInfo __var_info__aff78d24;
+extern VarInfo __var_info__12c1f55a;
+extern VarInfo __var_info__21bed633;
+extern VarInfo __var_info__aa2395c;
+extern VarInfo __var_info__2587dae5;
+extern VarInfo __var_info__388f56b;
+
+VarInfo __struct_info__713aafe3_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x159c68d2, "__rtti", 0 };
+TypeInfo * __type_info__43b9e565_arg_types_var_1899671523[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__713aafe3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43b9e565_arg_types_var_1899671523, nullptr, 1, 0, nullptr, 28, 0x43b9e565, "__finalize", 8 };
+TypeInfo * __type_info__1f78c3bf_arg_types_var_1899671523[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__713aafe3_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1f78c3bf_arg_types_var_1899671523, nullptr, 5, 0, nullptr, 28, 0x1f78c3bf, "apply", 12 };
+TypeInfo * __type_info__cb901576_arg_types_var_1899671523[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__713aafe3_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cb901576_arg_types_var_1899671523, nullptr, 5, 0, nullptr, 28, 0xcb901576, "finish", 16 };
+VarInfo * __struct_info__713aafe3_fields[4] =  { &__struct_info__713aafe3_field_0, &__struct_info__713aafe3_field_1, &__struct_info__713aafe3_field_2, &__struct_info__713aafe3_field_3 };
+StructInfo __struct_info__713aafe3 = {"AstStructureAnnotation", __struct_info__713aafe3_fields, 4, 24, -1, nullptr, 0x713aafe3 };
+VarInfo __struct_info__2fae7274_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xae308407, "__rtti", 0 };
+TypeInfo * __type_info__a93e35ec_arg_types_var_799961716[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__2fae7274_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a93e35ec_arg_types_var_799961716, nullptr, 1, 0, nullptr, 28, 0xa93e35ec, "__finalize", 8 };
+TypeInfo * __type_info__3566a2c4_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__2fae7274_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3566a2c4_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x3566a2c4, "preVisitProgram", 12 };
+TypeInfo * __type_info__7894c6d_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__2fae7274_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7894c6d_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x7894c6d, "visitProgram", 16 };
+TypeInfo * __type_info__6982e200_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__2fae7274_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6982e200_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x6982e200, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__4ed6b54c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__2fae7274_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4ed6b54c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x4ed6b54c, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__43eadf9f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__2fae7274_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__43eadf9f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x43eadf9f, "visitTypeDecl", 28 };
+TypeInfo * __type_info__56310dd4_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__2fae7274_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__56310dd4_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x56310dd4, "preVisitAlias", 32 };
+TypeInfo * __type_info__126ea055_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__2fae7274_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__126ea055_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x126ea055, "visitAlias", 36 };
+TypeInfo * __type_info__b9189477_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__2fae7274_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b9189477_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xb9189477, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__525d24c_arg_types_var_799961716[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__525d24c_arg_types_var_799961716, nullptr, 5, 0, nullptr, 28, 0x525d24c, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__435d9f3f_arg_types_var_799961716[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__435d9f3f_arg_types_var_799961716, nullptr, 5, 0, nullptr, 28, 0x435d9f3f, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__233a0f5e_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__2fae7274_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__233a0f5e_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x233a0f5e, "visitEnumeration", 52 };
+TypeInfo * __type_info__5386100d_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__2fae7274_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5386100d_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x5386100d, "preVisitStructure", 56 };
+TypeInfo * __type_info__917879ff_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__917879ff_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x917879ff, "preVisitStructureField", 60 };
+TypeInfo * __type_info__98c60d5c_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__98c60d5c_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x98c60d5c, "visitStructureField", 64 };
+TypeInfo * __type_info__4f32f1d0_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__2fae7274_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__4f32f1d0_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x4f32f1d0, "visitStructure", 68 };
+TypeInfo * __type_info__52b11500_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__2fae7274_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__52b11500_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x52b11500, "preVisitFunction", 72 };
+TypeInfo * __type_info__eb549b2b_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__2fae7274_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__eb549b2b_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xeb549b2b, "visitFunction", 76 };
+TypeInfo * __type_info__13c3afaf_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__13c3afaf_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x13c3afaf, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__918f2fa8_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__918f2fa8_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x918f2fa8, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__61bb9be9_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__61bb9be9_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x61bb9be9, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__f41f5a_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f41f5a_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xf41f5a, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__9edf622c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__2fae7274_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9edf622c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x9edf622c, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__5508e573_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__2fae7274_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5508e573_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x5508e573, "visitFunctionBody", 100 };
+TypeInfo * __type_info__af4d385a_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af4d385a_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xaf4d385a, "preVisitExpression", 104 };
+TypeInfo * __type_info__10f347bd_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__10f347bd_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x10f347bd, "visitExpression", 108 };
+TypeInfo * __type_info__9731e280_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__2fae7274_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9731e280_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x9731e280, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__c3c74ef1_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__2fae7274_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c3c74ef1_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xc3c74ef1, "visitExprBlock", 116 };
+TypeInfo * __type_info__1220ad2f_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1220ad2f_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x1220ad2f, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__baa2f162_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__baa2f162_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xbaa2f162, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__ba4af169_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ba4af169_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xba4af169, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__45dae5c8_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__45dae5c8_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x45dae5c8, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__42082e22_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__42082e22_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x42082e22, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__b2d7e987_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b2d7e987_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xb2d7e987, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__7bfc60e8_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__2fae7274_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7bfc60e8_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x7bfc60e8, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__1d6435a3_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__2fae7274_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1d6435a3_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x1d6435a3, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__cbc8f6a_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cbc8f6a_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xcbc8f6a, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__f22346f5_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f22346f5_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xf22346f5, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__94f4e6e0_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__2fae7274_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__94f4e6e0_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x94f4e6e0, "preVisitExprLet", 160 };
+TypeInfo * __type_info__824a1c45_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__2fae7274_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__824a1c45_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x824a1c45, "visitExprLet", 164 };
+TypeInfo * __type_info__a88b2040_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a88b2040_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xa88b2040, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__f34461a5_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__f34461a5_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xf34461a5, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__1f11402_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1f11402_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x1f11402, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__21bed633_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21bed633_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x21bed633, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__257704a0_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__2fae7274_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__257704a0_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x257704a0, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__92b26d15_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__2fae7274_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__92b26d15_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x92b26d15, "visitGlobalLet", 188 };
+TypeInfo * __type_info__d1708300_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d1708300_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xd1708300, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__84a1f0b5_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__84a1f0b5_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x84a1f0b5, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__47035ac2_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__47035ac2_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x47035ac2, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__ccdb76a3_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ccdb76a3_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xccdb76a3, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__af8f2435_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__2fae7274_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af8f2435_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xaf8f2435, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__90579e0c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__2fae7274_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__90579e0c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x90579e0c, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__ab6bc7c7_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ab6bc7c7_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xab6bc7c7, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__ebf77614_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ebf77614_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xebf77614, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__bec657ef_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__2fae7274_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bec657ef_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xbec657ef, "preVisitExprNew", 224 };
+TypeInfo * __type_info__688c4c1e_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__2fae7274_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__688c4c1e_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x688c4c1e, "visitExprNew", 228 };
+TypeInfo * __type_info__702f6c0c_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__702f6c0c_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x702f6c0c, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__f8571359_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f8571359_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xf8571359, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__383d618_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__2fae7274_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__383d618_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x383d618, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__4fa54769_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__2fae7274_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4fa54769_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x4fa54769, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__de842a27_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__de842a27_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xde842a27, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__655e37da_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__655e37da_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x655e37da, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__cf4336da_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__2fae7274_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cf4336da_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xcf4336da, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__dbd063e3_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__2fae7274_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dbd063e3_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xdbd063e3, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__1bb3c1b5_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1bb3c1b5_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x1bb3c1b5, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__28ff7fc0_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__28ff7fc0_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x28ff7fc0, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__4a0238bf_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__2fae7274_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4a0238bf_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x4a0238bf, "preVisitExprCall", 272 };
+TypeInfo * __type_info__1ca461a0_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__2fae7274_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1ca461a0_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x1ca461a0, "visitExprCall", 276 };
+TypeInfo * __type_info__4f35c13c_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4f35c13c_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0x4f35c13c, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__e831210f_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e831210f_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xe831210f, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__f567494e_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__2fae7274_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f567494e_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xf567494e, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__9e841a65_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__2fae7274_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9e841a65_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x9e841a65, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__13f77b13_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__13f77b13_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x13f77b13, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__41370bda_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__2fae7274_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__41370bda_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x41370bda, "preVisitExprAt", 300 };
+TypeInfo * __type_info__2a51bc45_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__2fae7274_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2a51bc45_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x2a51bc45, "visitExprAt", 304 };
+TypeInfo * __type_info__84572b6e_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__84572b6e_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x84572b6e, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__dda489ff_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__2fae7274_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dda489ff_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xdda489ff, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__d999f930_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__2fae7274_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d999f930_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xd999f930, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__a3d70e25_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a3d70e25_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xa3d70e25, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__2c21d013_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__2fae7274_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2c21d013_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x2c21d013, "preVisitExprIs", 324 };
+TypeInfo * __type_info__33655228_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__2fae7274_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__33655228_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x33655228, "visitExprIs", 328 };
+TypeInfo * __type_info__42823b0b_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__2fae7274_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__42823b0b_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x42823b0b, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__8d000cc6_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__2fae7274_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8d000cc6_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x8d000cc6, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__8a3ef65f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__2fae7274_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8a3ef65f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x8a3ef65f, "visitExprOp2", 340 };
+TypeInfo * __type_info__d7b465cc_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d7b465cc_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xd7b465cc, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__8e000e59_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__2fae7274_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8e000e59_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x8e000e59, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__893ef4cc_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__2fae7274_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__893ef4cc_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x893ef4cc, "visitExprOp3", 352 };
+TypeInfo * __type_info__58b7fc54_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__58b7fc54_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x58b7fc54, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__d58c4281_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d58c4281_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xd58c4281, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__e660163e_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__2fae7274_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e660163e_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe660163e, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__5ca5ff1d_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__2fae7274_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5ca5ff1d_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x5ca5ff1d, "visitExprCopy", 368 };
+TypeInfo * __type_info__adfc1354_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__adfc1354_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xadfc1354, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__4c1aef66_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__2fae7274_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c1aef66_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x4c1aef66, "preVisitExprMove", 376 };
+TypeInfo * __type_info__db88d48d_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__2fae7274_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db88d48d_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xdb88d48d, "visitExprMove", 380 };
+TypeInfo * __type_info__1311b0ac_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1311b0ac_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x1311b0ac, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__775fa14c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__2fae7274_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__775fa14c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x775fa14c, "preVisitExprClone", 388 };
+TypeInfo * __type_info__a03e40dd_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__2fae7274_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a03e40dd_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa03e40dd, "visitExprClone", 392 };
+TypeInfo * __type_info__2960a7f6_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2960a7f6_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x2960a7f6, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__d9eea817_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__2fae7274_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d9eea817_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xd9eea817, "preVisitExprWith", 400 };
+TypeInfo * __type_info__9ea2db8_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__2fae7274_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9ea2db8_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x9ea2db8, "visitExprWith", 404 };
+TypeInfo * __type_info__66a30bef_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__66a30bef_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x66a30bef, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__94b680e0_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__2fae7274_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__94b680e0_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x94b680e0, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__4f717bf5_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__2fae7274_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4f717bf5_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x4f717bf5, "visitExprWhile", 416 };
+TypeInfo * __type_info__378f9ccc_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__378f9ccc_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x378f9ccc, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__36422837_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__2fae7274_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__36422837_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x36422837, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__eb653800_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__2fae7274_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__eb653800_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xeb653800, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__fdba97c2_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fdba97c2_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xfdba97c2, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__1f26d85a_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__2fae7274_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1f26d85a_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x1f26d85a, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__31c5695d_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__2fae7274_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__31c5695d_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x31c5695d, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__1823315a_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1823315a_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x1823315a, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__1f2d75d0_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1f2d75d0_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x1f2d75d0, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__384557da_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__2fae7274_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__384557da_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x384557da, "preVisitExprFor", 452 };
+TypeInfo * __type_info__f7045e6f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__2fae7274_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f7045e6f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xf7045e6f, "visitExprFor", 456 };
+TypeInfo * __type_info__a71bbede_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a71bbede_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xa71bbede, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__b1d0bbc3_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__b1d0bbc3_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xb1d0bbc3, "visitExprForVariable", 464 };
+TypeInfo * __type_info__c91d0b87_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c91d0b87_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xc91d0b87, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__ab019c8a_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ab019c8a_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xab019c8a, "visitExprForSource", 472 };
+TypeInfo * __type_info__25069bca_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__2fae7274_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__25069bca_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x25069bca, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__bd94d45e_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__2fae7274_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bd94d45e_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xbd94d45e, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__d5035a4e_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__2fae7274_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d5035a4e_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xd5035a4e, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__9f12d2db_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__2fae7274_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9f12d2db_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x9f12d2db, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__cb80a4fa_arg_types_var_799961716[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cb80a4fa_arg_types_var_799961716, nullptr, 5, 0, nullptr, 28, 0xcb80a4fa, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__2587dae5_arg_types_var_799961716[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__2587dae5_arg_types_var_799961716, nullptr, 5, 0, nullptr, 28, 0x2587dae5, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__835a4d58_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__2fae7274_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__835a4d58_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x835a4d58, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__d7cd20f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__2fae7274_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d7cd20f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xd7cd20f, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__f2b8de74_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2b8de74_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xf2b8de74, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__a9db41f5_arg_types_var_799961716[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a9db41f5_arg_types_var_799961716, nullptr, 4, 0, nullptr, 28, 0xa9db41f5, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__45f3c674_arg_types_var_799961716[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__45f3c674_arg_types_var_799961716, nullptr, 5, 0, nullptr, 28, 0x45f3c674, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__c90a9df1_arg_types_var_799961716[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__c90a9df1_arg_types_var_799961716, nullptr, 5, 0, nullptr, 28, 0xc90a9df1, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__a2a4fede_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__2fae7274_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a2a4fede_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa2a4fede, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__a628088b_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__2fae7274_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a628088b_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa628088b, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__3463b662_arg_types_var_799961716[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3463b662_arg_types_var_799961716, nullptr, 5, 0, nullptr, 28, 0x3463b662, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__55a1f5a1_arg_types_var_799961716[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__55a1f5a1_arg_types_var_799961716, nullptr, 5, 0, nullptr, 28, 0x55a1f5a1, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__7e384a49_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__2fae7274_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7e384a49_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x7e384a49, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__b5313fec_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__2fae7274_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b5313fec_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xb5313fec, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__d89707df_arg_types_var_799961716[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d89707df_arg_types_var_799961716, nullptr, 5, 0, nullptr, 28, 0xd89707df, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__7f4a92a8_arg_types_var_799961716[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__2fae7274_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7f4a92a8_arg_types_var_799961716, nullptr, 5, 0, nullptr, 28, 0x7f4a92a8, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__439427d4_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__2fae7274_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__439427d4_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x439427d4, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__3ea249af_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__2fae7274_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3ea249af_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x3ea249af, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__38c3eba1_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__38c3eba1_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0x38c3eba1, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__ba63339f_arg_types_var_799961716[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__2fae7274_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ba63339f_arg_types_var_799961716, nullptr, 3, 0, nullptr, 28, 0xba63339f, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__2faa5a53_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__2fae7274_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2faa5a53_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x2faa5a53, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__584a9874_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__2fae7274_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__584a9874_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x584a9874, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__cf04c484_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__2fae7274_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cf04c484_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xcf04c484, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__c003c6e5_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__2fae7274_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c003c6e5_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xc003c6e5, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__f05e42f7_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__2fae7274_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f05e42f7_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xf05e42f7, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__21052a3e_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__2fae7274_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21052a3e_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x21052a3e, "visitExprLabel", 592 };
+TypeInfo * __type_info__55762a94_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__2fae7274_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__55762a94_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x55762a94, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__ee052303_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__2fae7274_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ee052303_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xee052303, "visitExprGoto", 600 };
+TypeInfo * __type_info__a658a917_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__2fae7274_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a658a917_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa658a917, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__8c229562_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__2fae7274_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8c229562_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x8c229562, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__b39ab720_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__2fae7274_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b39ab720_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xb39ab720, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__81e64471_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__2fae7274_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__81e64471_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x81e64471, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__c6dba628_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__2fae7274_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c6dba628_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xc6dba628, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__93c61a3_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__2fae7274_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__93c61a3_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x93c61a3, "visitExprAddr", 624 };
+TypeInfo * __type_info__75bd5101_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__2fae7274_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__75bd5101_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x75bd5101, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__178806c2_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__2fae7274_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__178806c2_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x178806c2, "visitExprAssert", 632 };
+TypeInfo * __type_info__7778c4db_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__2fae7274_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7778c4db_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x7778c4db, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__21e2c27c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__2fae7274_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21e2c27c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x21e2c27c, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__2a0a26ae_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__2fae7274_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2a0a26ae_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x2a0a26ae, "preVisitExprDebug", 644 };
+TypeInfo * __type_info__b4355e7_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__2fae7274_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b4355e7_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xb4355e7, "visitExprDebug", 648 };
+TypeInfo * __type_info__7887d69f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__2fae7274_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7887d69f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x7887d69f, "preVisitExprInvoke", 652 };
+TypeInfo * __type_info__a8f3fc80_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__2fae7274_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a8f3fc80_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa8f3fc80, "visitExprInvoke", 656 };
+TypeInfo * __type_info__e58427b3_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__2fae7274_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e58427b3_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe58427b3, "preVisitExprErase", 660 };
+TypeInfo * __type_info__1413a912_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__2fae7274_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1413a912_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x1413a912, "visitExprErase", 664 };
+TypeInfo * __type_info__73590db4_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__2fae7274_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__73590db4_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x73590db4, "preVisitExprFind", 668 };
+TypeInfo * __type_info__29b1a3bb_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__2fae7274_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__29b1a3bb_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x29b1a3bb, "visitExprFind", 672 };
+TypeInfo * __type_info__3e4933fe_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__2fae7274_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3e4933fe_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x3e4933fe, "preVisitExprKeyExists", 676 };
+TypeInfo * __type_info__ae1a919f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__2fae7274_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ae1a919f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xae1a919f, "visitExprKeyExists", 680 };
+TypeInfo * __type_info__b50a9c8d_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__2fae7274_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b50a9c8d_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xb50a9c8d, "preVisitExprAscend", 684 };
+TypeInfo * __type_info__e89e0dfe_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__2fae7274_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e89e0dfe_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe89e0dfe, "visitExprAscend", 688 };
+TypeInfo * __type_info__4ff0f910_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__2fae7274_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4ff0f910_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x4ff0f910, "preVisitExprCast", 692 };
+TypeInfo * __type_info__26dcc9ef_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__2fae7274_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__26dcc9ef_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x26dcc9ef, "visitExprCast", 696 };
+TypeInfo * __type_info__851fa42c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__2fae7274_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__851fa42c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x851fa42c, "preVisitExprDelete", 700 };
+TypeInfo * __type_info__f7a010db_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__2fae7274_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f7a010db_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xf7a010db, "visitExprDelete", 704 };
+TypeInfo * __type_info__62000f4_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__2fae7274_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__62000f4_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x62000f4, "preVisitExprVar", 708 };
+TypeInfo * __type_info__cc1a33f1_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__2fae7274_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cc1a33f1_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xcc1a33f1, "visitExprVar", 712 };
+TypeInfo * __type_info__39fc6bb1_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__2fae7274_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__39fc6bb1_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x39fc6bb1, "preVisitExprField", 716 };
+TypeInfo * __type_info__9ee4a50c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__2fae7274_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9ee4a50c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x9ee4a50c, "visitExprField", 720 };
+TypeInfo * __type_info__5f51b55e_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__2fae7274_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5f51b55e_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x5f51b55e, "preVisitExprSafeField", 724 };
+TypeInfo * __type_info__71b4c6bf_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__2fae7274_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__71b4c6bf_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x71b4c6bf, "visitExprSafeField", 728 };
+TypeInfo * __type_info__285c303f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__2fae7274_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__285c303f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x285c303f, "preVisitExprSwizzle", 732 };
+TypeInfo * __type_info__949a3bae_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__2fae7274_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__949a3bae_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x949a3bae, "visitExprSwizzle", 736 };
+TypeInfo * __type_info__b18c8024_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__2fae7274_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b18c8024_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xb18c8024, "preVisitExprIsVariant", 740 };
+TypeInfo * __type_info__901de769_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__2fae7274_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__901de769_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x901de769, "visitExprIsVariant", 744 };
+TypeInfo * __type_info__aa2395c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__2fae7274_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aa2395c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xaa2395c, "preVisitExprAsVariant", 748 };
+TypeInfo * __type_info__5aac8631_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__2fae7274_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5aac8631_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x5aac8631, "visitExprAsVariant", 752 };
+TypeInfo * __type_info__a5960d57_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__2fae7274_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a5960d57_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa5960d57, "preVisitExprSafeAsVariant", 756 };
+TypeInfo * __type_info__fd6fad6_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__2fae7274_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fd6fad6_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xfd6fad6, "visitExprSafeAsVariant", 760 };
+TypeInfo * __type_info__8c000b33_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__2fae7274_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8c000b33_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x8c000b33, "preVisitExprOp1", 764 };
+TypeInfo * __type_info__8b3ef7f2_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__2fae7274_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8b3ef7f2_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x8b3ef7f2, "visitExprOp1", 768 };
+TypeInfo * __type_info__473c4f4d_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__2fae7274_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__473c4f4d_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x473c4f4d, "preVisitExprReturn", 772 };
+TypeInfo * __type_info__b0efa126_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__2fae7274_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b0efa126_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xb0efa126, "visitExprReturn", 776 };
+TypeInfo * __type_info__7290ff5c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__2fae7274_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7290ff5c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x7290ff5c, "preVisitExprYield", 780 };
+TypeInfo * __type_info__cc4c841_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__2fae7274_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cc4c841_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xcc4c841, "visitExprYield", 784 };
+TypeInfo * __type_info__a3389722_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__2fae7274_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a3389722_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa3389722, "preVisitExprBreak", 788 };
+TypeInfo * __type_info__e06cc61f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__2fae7274_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e06cc61f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe06cc61f, "visitExprBreak", 792 };
+TypeInfo * __type_info__b52b75c6_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__2fae7274_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b52b75c6_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xb52b75c6, "preVisitExprContinue", 796 };
+TypeInfo * __type_info__29e6b331_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__2fae7274_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__29e6b331_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x29e6b331, "visitExprContinue", 800 };
+TypeInfo * __type_info__67b843da_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__2fae7274_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__67b843da_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x67b843da, "preVisitExprMakeBlock", 804 };
+TypeInfo * __type_info__cdf3a38f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__2fae7274_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cdf3a38f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xcdf3a38f, "visitExprMakeBlock", 808 };
+TypeInfo * __type_info__bc050f2a_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__2fae7274_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bc050f2a_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xbc050f2a, "preVisitExprMakeGenerator", 812 };
+TypeInfo * __type_info__6c13d877_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__2fae7274_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6c13d877_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x6c13d877, "visitExprMakeGenerator", 816 };
+TypeInfo * __type_info__f3cfe2fe_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__2fae7274_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f3cfe2fe_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xf3cfe2fe, "preVisitExprMemZero", 820 };
+TypeInfo * __type_info__ffc5510f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__2fae7274_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ffc5510f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xffc5510f, "visitExprMemZero", 824 };
+TypeInfo * __type_info__b7c8ff8a_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__2fae7274_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b7c8ff8a_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xb7c8ff8a, "preVisitExprConst", 828 };
+TypeInfo * __type_info__a7045273_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__2fae7274_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a7045273_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa7045273, "visitExprConst", 832 };
+TypeInfo * __type_info__c311b554_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__2fae7274_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c311b554_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xc311b554, "preVisitExprConstPtr", 836 };
+TypeInfo * __type_info__fff52e7f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__2fae7274_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fff52e7f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xfff52e7f, "visitExprConstPtr", 840 };
+TypeInfo * __type_info__f95f2045_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__2fae7274_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f95f2045_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xf95f2045, "preVisitExprConstEnumeration", 844 };
+TypeInfo * __type_info__899d8766_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__2fae7274_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__899d8766_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x899d8766, "visitExprConstEnumeration", 848 };
+TypeInfo * __type_info__a0da95f7_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__2fae7274_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a0da95f7_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa0da95f7, "preVisitExprConstBitfield", 852 };
+TypeInfo * __type_info__46c6c1aa_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__2fae7274_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__46c6c1aa_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x46c6c1aa, "visitExprConstBitfield", 856 };
+TypeInfo * __type_info__5c9b38f1_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__2fae7274_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5c9b38f1_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x5c9b38f1, "preVisitExprConstInt8", 860 };
+TypeInfo * __type_info__9b4cd50c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__2fae7274_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9b4cd50c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x9b4cd50c, "visitExprConstInt8", 864 };
+TypeInfo * __type_info__8d4497d0_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__2fae7274_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8d4497d0_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x8d4497d0, "preVisitExprConstInt16", 868 };
+TypeInfo * __type_info__a6095a93_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__2fae7274_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a6095a93_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa6095a93, "visitExprConstInt16", 872 };
+TypeInfo * __type_info__a14b7311_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__2fae7274_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a14b7311_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa14b7311, "preVisitExprConstInt64", 876 };
+TypeInfo * __type_info__3601ee7e_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__2fae7274_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3601ee7e_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x3601ee7e, "visitExprConstInt64", 880 };
+TypeInfo * __type_info__e4f77dd3_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__2fae7274_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4f77dd3_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe4f77dd3, "preVisitExprConstInt", 884 };
+TypeInfo * __type_info__bf6c2e7c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__2fae7274_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__bf6c2e7c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xbf6c2e7c, "visitExprConstInt", 888 };
+TypeInfo * __type_info__529b2933_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__2fae7274_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__529b2933_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x529b2933, "preVisitExprConstInt2", 892 };
+TypeInfo * __type_info__a54ce4ca_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__2fae7274_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a54ce4ca_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa54ce4ca, "visitExprConstInt2", 896 };
+TypeInfo * __type_info__519b27a0_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__2fae7274_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__519b27a0_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x519b27a0, "preVisitExprConstInt3", 900 };
+TypeInfo * __type_info__a64ce65d_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__2fae7274_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a64ce65d_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xa64ce65d, "visitExprConstInt3", 904 };
+TypeInfo * __type_info__589b32a5_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__2fae7274_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__589b32a5_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x589b32a5, "preVisitExprConstInt4", 908 };
+TypeInfo * __type_info__9f4cdb58_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__2fae7274_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9f4cdb58_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x9f4cdb58, "visitExprConstInt4", 912 };
+TypeInfo * __type_info__dc5ab88a_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__2fae7274_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dc5ab88a_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xdc5ab88a, "preVisitExprConstUInt8", 916 };
+TypeInfo * __type_info__e39a31a9_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__2fae7274_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e39a31a9_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe39a31a9, "visitExprConstUInt8", 920 };
+TypeInfo * __type_info__90bf70c9_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__2fae7274_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__90bf70c9_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x90bf70c9, "preVisitExprConstUInt16", 924 };
+TypeInfo * __type_info__e8cd6348_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__2fae7274_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e8cd6348_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe8cd6348, "visitExprConstUInt16", 928 };
+TypeInfo * __type_info__8cae215c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__2fae7274_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8cae215c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x8cae215c, "preVisitExprConstUInt64", 932 };
+TypeInfo * __type_info__5cd4d5a9_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__2fae7274_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5cd4d5a9_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x5cd4d5a9, "visitExprConstUInt64", 936 };
+TypeInfo * __type_info__8a0a63b6_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__2fae7274_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8a0a63b6_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x8a0a63b6, "preVisitExprConstUInt", 940 };
+TypeInfo * __type_info__388f56b_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__2fae7274_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__388f56b_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x388f56b, "visitExprConstUInt", 944 };
+TypeInfo * __type_info__d25aa8cc_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__2fae7274_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d25aa8cc_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xd25aa8cc, "preVisitExprConstUInt2", 948 };
+TypeInfo * __type_info__e99a3b1b_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__2fae7274_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e99a3b1b_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe99a3b1b, "visitExprConstUInt2", 952 };
+TypeInfo * __type_info__d35aaa5f_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__2fae7274_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d35aaa5f_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xd35aaa5f, "preVisitExprConstUInt3", 956 };
+TypeInfo * __type_info__e89a3988_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__2fae7274_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e89a3988_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe89a3988, "visitExprConstUInt3", 960 };
+TypeInfo * __type_info__d05aa5a6_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__2fae7274_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d05aa5a6_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xd05aa5a6, "preVisitExprConstUInt4", 964 };
+TypeInfo * __type_info__ef9a448d_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__2fae7274_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ef9a448d_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xef9a448d, "visitExprConstUInt4", 968 };
+TypeInfo * __type_info__d8bba517_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__2fae7274_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d8bba517_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xd8bba517, "preVisitExprConstRange", 972 };
+TypeInfo * __type_info__ea2c39a8_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__2fae7274_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ea2c39a8_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xea2c39a8, "visitExprConstRange", 976 };
+TypeInfo * __type_info__40fc627a_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__2fae7274_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__40fc627a_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x40fc627a, "preVisitExprConstURange", 980 };
+TypeInfo * __type_info__781e42ff_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__2fae7274_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__781e42ff_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x781e42ff, "visitExprConstURange", 984 };
+TypeInfo * __type_info__58e8e746_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__2fae7274_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__58e8e746_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x58e8e746, "preVisitExprConstBool", 988 };
+TypeInfo * __type_info__e1438b47_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__2fae7274_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e1438b47_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe1438b47, "visitExprConstBool", 992 };
+TypeInfo * __type_info__f48812b8_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__2fae7274_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f48812b8_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xf48812b8, "preVisitExprConstFloat", 996 };
+TypeInfo * __type_info__d036b837_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__2fae7274_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d036b837_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xd036b837, "visitExprConstFloat", 1000 };
+TypeInfo * __type_info__7c352f3e_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__2fae7274_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7c352f3e_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x7c352f3e, "preVisitExprConstFloat2", 1004 };
+TypeInfo * __type_info__cb23afdf_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__2fae7274_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb23afdf_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xcb23afdf, "visitExprConstFloat2", 1008 };
+TypeInfo * __type_info__7d3530d1_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__2fae7274_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7d3530d1_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x7d3530d1, "preVisitExprConstFloat3", 1012 };
+TypeInfo * __type_info__ca23ae4c_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__2fae7274_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ca23ae4c_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xca23ae4c, "visitExprConstFloat3", 1016 };
+TypeInfo * __type_info__7e353264_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__2fae7274_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7e353264_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x7e353264, "preVisitExprConstFloat4", 1020 };
+TypeInfo * __type_info__c923acb9_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__2fae7274_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c923acb9_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xc923acb9, "visitExprConstFloat4", 1024 };
+TypeInfo * __type_info__de0d9283_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__2fae7274_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__de0d9283_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xde0d9283, "preVisitExprConstString", 1028 };
+TypeInfo * __type_info__2544ff76_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__2fae7274_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2544ff76_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x2544ff76, "visitExprConstString", 1032 };
+TypeInfo * __type_info__e1686f7_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__2fae7274_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1686f7_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xe1686f7, "preVisitExprConstDouble", 1036 };
+TypeInfo * __type_info__ee4cc0de_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__2fae7274_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ee4cc0de_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xee4cc0de, "visitExprConstDouble", 1040 };
+TypeInfo * __type_info__4be8c729_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__2fae7274_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4be8c729_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x4be8c729, "preVisitExprFakeContext", 1044 };
+TypeInfo * __type_info__362ecdc0_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__2fae7274_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__362ecdc0_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x362ecdc0, "visitExprFakeContext", 1048 };
+TypeInfo * __type_info__452f6688_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__2fae7274_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__452f6688_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x452f6688, "preVisitExprFakeLineInfo", 1052 };
+TypeInfo * __type_info__eea3d7b7_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__2fae7274_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__eea3d7b7_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xeea3d7b7, "visitExprFakeLineInfo", 1056 };
+TypeInfo * __type_info__fdbf4730_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__2fae7274_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fdbf4730_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xfdbf4730, "preVisitExprReader", 1060 };
+TypeInfo * __type_info__b0344663_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__2fae7274_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b0344663_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xb0344663, "visitExprReader", 1064 };
+TypeInfo * __type_info__233f2ecd_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__2fae7274_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__233f2ecd_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x233f2ecd, "preVisitExprUnsafe", 1068 };
+TypeInfo * __type_info__598d38fe_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__2fae7274_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__598d38fe_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x598d38fe, "visitExprUnsafe", 1072 };
+TypeInfo * __type_info__ace1480d_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__2fae7274_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ace1480d_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0xace1480d, "preVisitExprCallMacro", 1076 };
+TypeInfo * __type_info__388ebfb4_arg_types_var_799961716[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__2fae7274_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__388ebfb4_arg_types_var_799961716, nullptr, 2, 0, nullptr, 28, 0x388ebfb4, "visitExprCallMacro", 1080 };
+VarInfo __struct_info__2fae7274_field_270 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x15e49214, "changed", 1084 };
+VarInfo * __struct_info__2fae7274_fields[271] =  { &__struct_info__2fae7274_field_0, &__struct_info__2fae7274_field_1, &__struct_info__2fae7274_field_2, &__struct_info__2fae7274_field_3, &__struct_info__2fae7274_field_4, &__struct_info__2fae7274_field_5, &__struct_info__2fae7274_field_6, &__struct_info__2fae7274_field_7, &__struct_info__2fae7274_field_8, &__struct_info__2fae7274_field_9, &__struct_info__2fae7274_field_10, &__struct_info__2fae7274_field_11, &__struct_info__2fae7274_field_12, &__struct_info__2fae7274_field_13, &__struct_info__2fae7274_field_14, &__struct_info__2fae7274_field_15, &__struct_info__2fae7274_field_16, &__struct_info__2fae7274_field_17, &__struct_info__2fae7274_field_18, &__struct_info__2fae7274_field_19, &__struct_info__2fae7274_field_20, &__struct_info__2fae7274_field_21, &__struct_info__2fae7274_field_22, &__struct_info__2fae7274_field_23, &__struct_info__2fae7274_field_24, &__struct_info__2fae7274_field_25, &__struct_info__2fae7274_field_26, &__struct_info__2fae7274_field_27, &__struct_info__2fae7274_field_28, &__struct_info__2fae7274_field_29, &__struct_info__2fae7274_field_30, &__struct_info__2fae7274_field_31, &__struct_info__2fae7274_field_32, &__struct_info__2fae7274_field_33, &__struct_info__2fae7274_field_34, &__struct_info__2fae7274_field_35, &__struct_info__2fae7274_field_36, &__struct_info__2fae7274_field_37, &__struct_info__2fae7274_field_38, &__struct_info__2fae7274_field_39, &__struct_info__2fae7274_field_40, &__struct_info__2fae7274_field_41, &__struct_info__2fae7274_field_42, &__struct_info__2fae7274_field_43, &__struct_info__2fae7274_field_44, &__struct_info__2fae7274_field_45, &__struct_info__2fae7274_field_46, &__struct_info__2fae7274_field_47, &__struct_info__2fae7274_field_48, &__struct_info__2fae7274_field_49, &__struct_info__2fae7274_field_50, &__struct_info__2fae7274_field_51, &__struct_info__2fae7274_field_52, &__struct_info__2fae7274_field_53, &__struct_info__2fae7274_field_54, &__struct_info__2fae7274_field_55, &__struct_info__2fae7274_field_56, &__struct_info__2fae7274_field_57, &__struct_info__2fae7274_field_58, &__struct_info__2fae7274_field_59, &__struct_info__2fae7274_field_60, &__struct_info__2fae7274_field_61, &__struct_info__2fae7274_field_62, &__struct_info__2fae7274_field_63, &__struct_info__2fae7274_field_64, &__struct_info__2fae7274_field_65, &__struct_info__2fae7274_field_66, &__struct_info__2fae7274_field_67, &__struct_info__2fae7274_field_68, &__struct_info__2fae7274_field_69, &__struct_info__2fae7274_field_70, &__struct_info__2fae7274_field_71, &__struct_info__2fae7274_field_72, &__struct_info__2fae7274_field_73, &__struct_info__2fae7274_field_74, &__struct_info__2fae7274_field_75, &__struct_info__2fae7274_field_76, &__struct_info__2fae7274_field_77, &__struct_info__2fae7274_field_78, &__struct_info__2fae7274_field_79, &__struct_info__2fae7274_field_80, &__struct_info__2fae7274_field_81, &__struct_info__2fae7274_field_82, &__struct_info__2fae7274_field_83, &__struct_info__2fae7274_field_84, &__struct_info__2fae7274_field_85, &__struct_info__2fae7274_field_86, &__struct_info__2fae7274_field_87, &__struct_info__2fae7274_field_88, &__struct_info__2fae7274_field_89, &__struct_info__2fae7274_field_90, &__struct_info__2fae7274_field_91, &__struct_info__2fae7274_field_92, &__struct_info__2fae7274_field_93, &__struct_info__2fae7274_field_94, &__struct_info__2fae7274_field_95, &__struct_info__2fae7274_field_96, &__struct_info__2fae7274_field_97, &__struct_info__2fae7274_field_98, &__struct_info__2fae7274_field_99, &__struct_info__2fae7274_field_100, &__struct_info__2fae7274_field_101, &__struct_info__2fae7274_field_102, &__struct_info__2fae7274_field_103, &__struct_info__2fae7274_field_104, &__struct_info__2fae7274_field_105, &__struct_info__2fae7274_field_106, &__struct_info__2fae7274_field_107, &__struct_info__2fae7274_field_108, &__struct_info__2fae7274_field_109, &__struct_info__2fae7274_field_110, &__struct_info__2fae7274_field_111, &__struct_info__2fae7274_field_112, &__struct_info__2fae7274_field_113, &__struct_info__2fae7274_field_114, &__struct_info__2fae7274_field_115, &__struct_info__2fae7274_field_116, &__struct_info__2fae7274_field_117, &__struct_info__2fae7274_field_118, &__struct_info__2fae7274_field_119, &__struct_info__2fae7274_field_120, &__struct_info__2fae7274_field_121, &__struct_info__2fae7274_field_122, &__struct_info__2fae7274_field_123, &__struct_info__2fae7274_field_124, &__struct_info__2fae7274_field_125, &__struct_info__2fae7274_field_126, &__struct_info__2fae7274_field_127, &__struct_info__2fae7274_field_128, &__struct_info__2fae7274_field_129, &__struct_info__2fae7274_field_130, &__struct_info__2fae7274_field_131, &__struct_info__2fae7274_field_132, &__struct_info__2fae7274_field_133, &__struct_info__2fae7274_field_134, &__struct_info__2fae7274_field_135, &__struct_info__2fae7274_field_136, &__struct_info__2fae7274_field_137, &__struct_info__2fae7274_field_138, &__struct_info__2fae7274_field_139, &__struct_info__2fae7274_field_140, &__struct_info__2fae7274_field_141, &__struct_info__2fae7274_field_142, &__struct_info__2fae7274_field_143, &__struct_info__2fae7274_field_144, &__struct_info__2fae7274_field_145, &__struct_info__2fae7274_field_146, &__struct_info__2fae7274_field_147, &__struct_info__2fae7274_field_148, &__struct_info__2fae7274_field_149, &__struct_info__2fae7274_field_150, &__struct_info__2fae7274_field_151, &__struct_info__2fae7274_field_152, &__struct_info__2fae7274_field_153, &__struct_info__2fae7274_field_154, &__struct_info__2fae7274_field_155, &__struct_info__2fae7274_field_156, &__struct_info__2fae7274_field_157, &__struct_info__2fae7274_field_158, &__struct_info__2fae7274_field_159, &__struct_info__2fae7274_field_160, &__struct_info__2fae7274_field_161, &__struct_info__2fae7274_field_162, &__struct_info__2fae7274_field_163, &__struct_info__2fae7274_field_164, &__struct_info__2fae7274_field_165, &__struct_info__2fae7274_field_166, &__struct_info__2fae7274_field_167, &__struct_info__2fae7274_field_168, &__struct_info__2fae7274_field_169, &__struct_info__2fae7274_field_170, &__struct_info__2fae7274_field_171, &__struct_info__2fae7274_field_172, &__struct_info__2fae7274_field_173, &__struct_info__2fae7274_field_174, &__struct_info__2fae7274_field_175, &__struct_info__2fae7274_field_176, &__struct_info__2fae7274_field_177, &__struct_info__2fae7274_field_178, &__struct_info__2fae7274_field_179, &__struct_info__2fae7274_field_180, &__struct_info__2fae7274_field_181, &__struct_info__2fae7274_field_182, &__struct_info__2fae7274_field_183, &__struct_info__2fae7274_field_184, &__struct_info__2fae7274_field_185, &__struct_info__2fae7274_field_186, &__struct_info__2fae7274_field_187, &__struct_info__2fae7274_field_188, &__struct_info__2fae7274_field_189, &__struct_info__2fae7274_field_190, &__struct_info__2fae7274_field_191, &__struct_info__2fae7274_field_192, &__struct_info__2fae7274_field_193, &__struct_info__2fae7274_field_194, &__struct_info__2fae7274_field_195, &__struct_info__2fae7274_field_196, &__struct_info__2fae7274_field_197, &__struct_info__2fae7274_field_198, &__struct_info__2fae7274_field_199, &__struct_info__2fae7274_field_200, &__struct_info__2fae7274_field_201, &__struct_info__2fae7274_field_202, &__struct_info__2fae7274_field_203, &__struct_info__2fae7274_field_204, &__struct_info__2fae7274_field_205, &__struct_info__2fae7274_field_206, &__struct_info__2fae7274_field_207, &__struct_info__2fae7274_field_208, &__struct_info__2fae7274_field_209, &__struct_info__2fae7274_field_210, &__struct_info__2fae7274_field_211, &__struct_info__2fae7274_field_212, &__struct_info__2fae7274_field_213, &__struct_info__2fae7274_field_214, &__struct_info__2fae7274_field_215, &__struct_info__2fae7274_field_216, &__struct_info__2fae7274_field_217, &__struct_info__2fae7274_field_218, &__struct_info__2fae7274_field_219, &__struct_info__2fae7274_field_220, &__struct_info__2fae7274_field_221, &__struct_info__2fae7274_field_222, &__struct_info__2fae7274_field_223, &__struct_info__2fae7274_field_224, &__struct_info__2fae7274_field_225, &__struct_info__2fae7274_field_226, &__struct_info__2fae7274_field_227, &__struct_info__2fae7274_field_228, &__struct_info__2fae7274_field_229, &__struct_info__2fae7274_field_230, &__struct_info__2fae7274_field_231, &__struct_info__2fae7274_field_232, &__struct_info__2fae7274_field_233, &__struct_info__2fae7274_field_234, &__struct_info__2fae7274_field_235, &__struct_info__2fae7274_field_236, &__struct_info__2fae7274_field_237, &__struct_info__2fae7274_field_238, &__struct_info__2fae7274_field_239, &__struct_info__2fae7274_field_240, &__struct_info__2fae7274_field_241, &__struct_info__2fae7274_field_242, &__struct_info__2fae7274_field_243, &__struct_info__2fae7274_field_244, &__struct_info__2fae7274_field_245, &__struct_info__2fae7274_field_246, &__struct_info__2fae7274_field_247, &__struct_info__2fae7274_field_248, &__struct_info__2fae7274_field_249, &__struct_info__2fae7274_field_250, &__struct_info__2fae7274_field_251, &__struct_info__2fae7274_field_252, &__struct_info__2fae7274_field_253, &__struct_info__2fae7274_field_254, &__struct_info__2fae7274_field_255, &__struct_info__2fae7274_field_256, &__struct_info__2fae7274_field_257, &__struct_info__2fae7274_field_258, &__struct_info__2fae7274_field_259, &__struct_info__2fae7274_field_260, &__struct_info__2fae7274_field_261, &__struct_info__2fae7274_field_262, &__struct_info__2fae7274_field_263, &__struct_info__2fae7274_field_264, &__struct_info__2fae7274_field_265, &__struct_info__2fae7274_field_266, &__struct_info__2fae7274_field_267, &__struct_info__2fae7274_field_268, &__struct_info__2fae7274_field_269, &__struct_info__2fae7274_field_270 };
+StructInfo __struct_info__2fae7274 = {"SmallArrayVisitor", __struct_info__2fae7274_fields, 271, 1088, -1, nullptr, 0x2fae7274 };
+VarInfo __struct_info__17d0e062_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3fddb549, "__rtti", 0 };
+TypeInfo * __type_info__74b89556_arg_types_var_399564898[1] = { &__type_info__fdd27932 };
+VarInfo __struct_info__17d0e062_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__74b89556_arg_types_var_399564898, nullptr, 1, 0, nullptr, 28, 0x74b89556, "__finalize", 8 };
+TypeInfo * __type_info__46efd33e_arg_types_var_399564898[3] = { &__type_info__fdd27932, &__type_info__8f3455dd, &__type_info__b049b391 };
+VarInfo __struct_info__17d0e062_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__46efd33e_arg_types_var_399564898, nullptr, 3, 0, nullptr, 28, 0x46efd33e, "apply", 12 };
+VarInfo * __struct_info__17d0e062_fields[3] =  { &__struct_info__17d0e062_field_0, &__struct_info__17d0e062_field_1, &__struct_info__17d0e062_field_2 };
+StructInfo __struct_info__17d0e062 = {"SmallArrayRewriteMacro", __struct_info__17d0e062_fields, 3, 16, -1, nullptr, 0x17d0e062 };
+VarInfo __struct_info__d8299e85_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1dd0d240, "__rtti", 0 };
+TypeInfo * __type_info__1c9914bb_arg_types_var_3626606213[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__d8299e85_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c9914bb_arg_types_var_3626606213, nullptr, 1, 0, nullptr, 28, 0x1c9914bb, "__finalize", 8 };
+TypeInfo * __type_info__e1345261_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1345261_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe1345261, "preVisitProgram", 12 };
+TypeInfo * __type_info__f902c2de_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f902c2de_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf902c2de, "visitProgram", 16 };
+TypeInfo * __type_info__6d3d92b1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d3d92b1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6d3d92b1, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__7acd6d0b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7acd6d0b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7acd6d0b, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__9edcbce_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__9edcbce_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9edcbce, "visitTypeDecl", 28 };
+TypeInfo * __type_info__4c957b89_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__d8299e85_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c957b89_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x4c957b89, "preVisitAlias", 32 };
+TypeInfo * __type_info__2cbdc12a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__d8299e85_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__2cbdc12a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x2cbdc12a, "visitAlias", 36 };
+TypeInfo * __type_info__7ea03b0a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__d8299e85_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7ea03b0a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7ea03b0a, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__7607b7d3_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7607b7d3_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x7607b7d3, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__a92f607e_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a92f607e_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xa92f607e, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__134ae51_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__d8299e85_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__134ae51_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x134ae51, "visitEnumeration", 52 };
+TypeInfo * __type_info__327e2124_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__d8299e85_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__327e2124_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x327e2124, "preVisitStructure", 56 };
+TypeInfo * __type_info__c2ec29d8_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c2ec29d8_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xc2ec29d8, "preVisitStructureField", 60 };
+TypeInfo * __type_info__e4eb34d9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4eb34d9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xe4eb34d9, "visitStructureField", 64 };
+TypeInfo * __type_info__6c97d67_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__d8299e85_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__6c97d67_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6c97d67, "visitStructure", 68 };
+TypeInfo * __type_info__7447bb4f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7447bb4f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7447bb4f, "preVisitFunction", 72 };
+TypeInfo * __type_info__c6bf2bd2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__c6bf2bd2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc6bf2bd2, "visitFunction", 76 };
+TypeInfo * __type_info__63a3eac_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__63a3eac_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x63a3eac, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__5fa0ff2d_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__5fa0ff2d_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5fa0ff2d, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__ad56015e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad56015e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xad56015e, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__f4999d8b_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f4999d8b_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xf4999d8b, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__f25a787_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f25a787_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf25a787, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__d76915b6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d76915b6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd76915b6, "visitFunctionBody", 100 };
+TypeInfo * __type_info__af00471_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af00471_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaf00471, "preVisitExpression", 104 };
+TypeInfo * __type_info__a246be3c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a246be3c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa246be3c, "visitExpression", 108 };
+TypeInfo * __type_info__2c383e55_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2c383e55_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2c383e55, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__7a87bd0e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7a87bd0e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7a87bd0e, "visitExprBlock", 116 };
+TypeInfo * __type_info__dc873d46_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dc873d46_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xdc873d46, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__f891e8e9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__f891e8e9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xf891e8e9, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__5bede5bc_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5bede5bc_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5bede5bc, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__4a66add7_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4a66add7_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x4a66add7, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__b35acbb_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b35acbb_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb35acbb, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__d6c089cc_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d6c089cc_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xd6c089cc, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__6fc12b47_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6fc12b47_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6fc12b47, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__8644430a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8644430a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8644430a, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__fde3ac29_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fde3ac29_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xfde3ac29, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__89631998_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__89631998_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x89631998, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__bd3bde81_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__d8299e85_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bd3bde81_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbd3bde81, "preVisitExprLet", 160 };
+TypeInfo * __type_info__1c56de_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__d8299e85_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1c56de_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1c56de, "visitExprLet", 164 };
+TypeInfo * __type_info__4ea380c9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4ea380c9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x4ea380c9, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__d7a0c00a_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__d7a0c00a_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xd7a0c00a, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__dcd95cf7_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dcd95cf7_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xdcd95cf7, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__5e90f2e0_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5e90f2e0_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5e90f2e0, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__284e759_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__284e759_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x284e759, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__554a21ae_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__554a21ae_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x554a21ae, "visitGlobalLet", 188 };
+TypeInfo * __type_info__a6016d01_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a6016d01_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xa6016d01, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__3b14171a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__3b14171a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x3b14171a, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__78bcb4df_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__78bcb4df_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x78bcb4df, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__6521e890_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6521e890_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x6521e890, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__aefafc88_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__d8299e85_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aefafc88_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaefafc88, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__75c92fd3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__d8299e85_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__75c92fd3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x75c92fd3, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__6eaa7d50_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6eaa7d50_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x6eaa7d50, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__ad5a0405_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ad5a0405_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xad5a0405, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__9356e5ba_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__d8299e85_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9356e5ba_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9356e5ba, "preVisitExprNew", 224 };
+TypeInfo * __type_info__c84acfc5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__d8299e85_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c84acfc5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc84acfc5, "visitExprNew", 228 };
+TypeInfo * __type_info__a9b0cc55_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a9b0cc55_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa9b0cc55, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__7cfe7756_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7cfe7756_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x7cfe7756, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__915be3cd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__d8299e85_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__915be3cd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x915be3cd, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__85473ce6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__d8299e85_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85473ce6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x85473ce6, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__345035e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__345035e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x345035e, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__c053d161_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__c053d161_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xc053d161, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__359e840f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__d8299e85_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__359e840f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x359e840f, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__c32d1370_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__d8299e85_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c32d1370_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc32d1370, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__31003f6c_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31003f6c_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x31003f6c, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__442b5d7f_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__442b5d7f_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x442b5d7f, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__11aeae1c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__d8299e85_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__11aeae1c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x11aeae1c, "preVisitExprCall", 272 };
+TypeInfo * __type_info__2965e55d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__d8299e85_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2965e55d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2965e55d, "visitExprCall", 276 };
+TypeInfo * __type_info__cdf950db_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cdf950db_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xcdf950db, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__a343220e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a343220e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa343220e, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__ac29e6b9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__d8299e85_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac29e6b9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xac29e6b9, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__2663c954_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__d8299e85_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2663c954_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2663c954, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__f3715aaa_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f3715aaa_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf3715aaa, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__bb163ec9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__d8299e85_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bb163ec9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbb163ec9, "preVisitExprAt", 300 };
+TypeInfo * __type_info__888bf034_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__d8299e85_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__888bf034_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x888bf034, "visitExprAt", 304 };
+TypeInfo * __type_info__43f7c55f_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43f7c55f_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x43f7c55f, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__aff78d24_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__d8299e85_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aff78d24_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaff78d24, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__880f2249_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__d8299e85_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__880f2249_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x880f2249, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__e1903c80_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1903c80_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xe1903c80, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__cc02d1d4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__d8299e85_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc02d1d4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcc02d1d4, "preVisitExprIs", 324 };
+TypeInfo * __type_info__7776bab9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__d8299e85_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7776bab9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7776bab9, "visitExprIs", 328 };
+TypeInfo * __type_info__3cb36c5c_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3cb36c5c_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x3cb36c5c, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__3f48a4eb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__d8299e85_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3f48a4eb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3f48a4eb, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__9e9818ec_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__d8299e85_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9e9818ec_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9e9818ec, "visitExprOp2", 340 };
+TypeInfo * __type_info__b7d4d4bf_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b7d4d4bf_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb7d4d4bf, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__3e48a358_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__d8299e85_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3e48a358_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3e48a358, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__9f981a7f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__d8299e85_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9f981a7f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9f981a7f, "visitExprOp3", 352 };
+TypeInfo * __type_info__eee3bc09_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__eee3bc09_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xeee3bc09, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__f2f1d3aa_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2f1d3aa_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf2f1d3aa, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__c3059e01_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__d8299e85_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c3059e01_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc3059e01, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__3bbe5820_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__d8299e85_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3bbe5820_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3bbe5820, "visitExprCopy", 368 };
+TypeInfo * __type_info__a0ecfbb9_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a0ecfbb9_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xa0ecfbb9, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__215e3c49_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__d8299e85_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__215e3c49_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x215e3c49, "preVisitExprMove", 376 };
+TypeInfo * __type_info__8f4c9038_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__d8299e85_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f4c9038_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8f4c9038, "visitExprMove", 380 };
+TypeInfo * __type_info__98dc5351_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__98dc5351_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x98dc5351, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__17b491_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__d8299e85_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__17b491_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x17b491, "preVisitExprClone", 388 };
+TypeInfo * __type_info__1ad4800e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__d8299e85_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1ad4800e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1ad4800e, "visitExprClone", 392 };
+TypeInfo * __type_info__b08b6929_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b08b6929_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb08b6929, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__f2348094_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__d8299e85_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2348094_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf2348094, "preVisitExprWith", 400 };
+TypeInfo * __type_info__f3ae166d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__d8299e85_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f3ae166d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf3ae166d, "visitExprWith", 404 };
+TypeInfo * __type_info__f1675330_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1675330_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf1675330, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__92e3d111_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__d8299e85_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__92e3d111_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x92e3d111, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__cafe3512_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__d8299e85_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cafe3512_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcafe3512, "visitExprWhile", 416 };
+TypeInfo * __type_info__ed636a01_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ed636a01_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xed636a01, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__25c0eaac_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__d8299e85_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__25c0eaac_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x25c0eaac, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__90a51465_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__d8299e85_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__90a51465_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x90a51465, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__169d2283_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__169d2283_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x169d2283, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__8965dfd1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__d8299e85_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8965dfd1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8965dfd1, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__757540b8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__d8299e85_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__757540b8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x757540b8, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__7705b54f_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7705b54f_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x7705b54f, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__97b1c4ed_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__97b1c4ed_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x97b1c4ed, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__e95012d3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e95012d3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe95012d3, "preVisitExprFor", 452 };
+TypeInfo * __type_info__344d19dc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__344d19dc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x344d19dc, "visitExprFor", 456 };
+TypeInfo * __type_info__6c164ebf_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c164ebf_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x6c164ebf, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__56569ad4_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__56569ad4_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x56569ad4, "visitExprForVariable", 464 };
+TypeInfo * __type_info__12214d06_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__12214d06_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x12214d06, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__64f4b569_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__64f4b569_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x64f4b569, "visitExprForSource", 472 };
+TypeInfo * __type_info__10bf88c5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__10bf88c5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x10bf88c5, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__6dbb285b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6dbb285b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6dbb285b, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__717f8e67_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__d8299e85_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__717f8e67_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x717f8e67, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__e6a0bda4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__d8299e85_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e6a0bda4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe6a0bda4, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__c35127d9_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c35127d9_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xc35127d9, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__aa30df58_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__aa30df58_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xaa30df58, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__67cfaaa3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__d8299e85_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__67cfaaa3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x67cfaaa3, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__23fa073a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__d8299e85_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__23fa073a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x23fa073a, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__a74c85b9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a74c85b9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa74c85b9, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__88bd350e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88bd350e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x88bd350e, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__35e4f53d_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35e4f53d_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x35e4f53d, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__83d50dee_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__83d50dee_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x83d50dee, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__6d5c4cbf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__d8299e85_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d5c4cbf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6d5c4cbf, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__52c5da8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__d8299e85_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52c5da8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x52c5da8, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__e8005be5_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e8005be5_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xe8005be5, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__a216b644_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a216b644_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xa216b644, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__8b73a850_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__d8299e85_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8b73a850_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8b73a850, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__955e0b53_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__d8299e85_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__955e0b53_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x955e0b53, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__cc0f5e2c_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc0f5e2c_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xcc0f5e2c, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__c9d28329_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c9d28329_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xc9d28329, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__e4dec3a3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__d8299e85_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4dec3a3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe4dec3a3, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__12c1f55a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__d8299e85_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__12c1f55a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x12c1f55a, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__b69afd24_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b69afd24_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb69afd24, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__491e734a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__491e734a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x491e734a, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__d6bd6ae8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__d8299e85_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d6bd6ae8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd6bd6ae8, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__1bbde4e9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__d8299e85_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1bbde4e9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1bbde4e9, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__f25fabc1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__d8299e85_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f25fabc1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf25fabc1, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__546203a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__d8299e85_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__546203a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x546203a, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__e85d642a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__d8299e85_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e85d642a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe85d642a, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__919eabb1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__d8299e85_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__919eabb1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x919eabb1, "visitExprLabel", 592 };
+TypeInfo * __type_info__94bb64af_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__d8299e85_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__94bb64af_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x94bb64af, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__fcdb84a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__d8299e85_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fcdb84a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfcdb84a, "visitExprGoto", 600 };
+TypeInfo * __type_info__ebd6bd76_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__d8299e85_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ebd6bd76_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xebd6bd76, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__754e508d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__d8299e85_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__754e508d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x754e508d, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__e3083f3d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__d8299e85_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e3083f3d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe3083f3d, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__fdcc980e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__d8299e85_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fdcc980e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfdcc980e, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__822a0a6f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__d8299e85_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__822a0a6f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x822a0a6f, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__36bf6516_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__d8299e85_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__36bf6516_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x36bf6516, "visitExprAddr", 624 };
+TypeInfo * __type_info__b632464e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__d8299e85_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b632464e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb632464e, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__171280cf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__d8299e85_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__171280cf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x171280cf, "visitExprAssert", 632 };
+TypeInfo * __type_info__9cd677e8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__d8299e85_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9cd677e8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9cd677e8, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__3faadbe1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__d8299e85_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3faadbe1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3faadbe1, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__3021cb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__d8299e85_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3021cb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3021cb, "preVisitExprDebug", 644 };
+TypeInfo * __type_info__db853894_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__d8299e85_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db853894_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdb853894, "visitExprDebug", 648 };
+TypeInfo * __type_info__a42b136c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__d8299e85_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a42b136c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa42b136c, "preVisitExprInvoke", 652 };
+TypeInfo * __type_info__ae8d05f1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__d8299e85_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ae8d05f1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xae8d05f1, "visitExprInvoke", 656 };
+TypeInfo * __type_info__5afbb756_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__d8299e85_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5afbb756_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5afbb756, "preVisitExprErase", 660 };
+TypeInfo * __type_info__a433d831_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__d8299e85_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a433d831_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa433d831, "visitExprErase", 664 };
+TypeInfo * __type_info__89b1ed2f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__d8299e85_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89b1ed2f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x89b1ed2f, "preVisitExprFind", 668 };
+TypeInfo * __type_info__ba5333e6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__d8299e85_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba5333e6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xba5333e6, "visitExprFind", 672 };
+TypeInfo * __type_info__9d59dc9b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__d8299e85_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9d59dc9b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9d59dc9b, "preVisitExprKeyExists", 676 };
+TypeInfo * __type_info__5532d30_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__d8299e85_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5532d30_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5532d30, "visitExprKeyExists", 680 };
+TypeInfo * __type_info__ac1f0992_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__d8299e85_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac1f0992_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xac1f0992, "preVisitExprAscend", 684 };
+TypeInfo * __type_info__d676fdc3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__d8299e85_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d676fdc3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd676fdc3, "visitExprAscend", 688 };
+TypeInfo * __type_info__fbd35c53_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__d8299e85_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fbd35c53_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfbd35c53, "preVisitExprCast", 692 };
+TypeInfo * __type_info__3f5db93a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__d8299e85_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3f5db93a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3f5db93a, "visitExprCast", 696 };
+TypeInfo * __type_info__e9e73a57_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__d8299e85_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e9e73a57_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe9e73a57, "preVisitExprDelete", 700 };
+TypeInfo * __type_info__5b5aed7e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__d8299e85_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5b5aed7e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5b5aed7e, "visitExprDelete", 704 };
+TypeInfo * __type_info__31ca940d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__d8299e85_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31ca940d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x31ca940d, "preVisitExprVar", 708 };
+TypeInfo * __type_info__64bce7f2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__d8299e85_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__64bce7f2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x64bce7f2, "visitExprVar", 712 };
+TypeInfo * __type_info__490512e0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__d8299e85_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__490512e0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x490512e0, "preVisitExprField", 716 };
+TypeInfo * __type_info__cb496173_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__d8299e85_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb496173_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb496173, "visitExprField", 720 };
+TypeInfo * __type_info__afac4da3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__d8299e85_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__afac4da3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xafac4da3, "preVisitExprSafeField", 724 };
+TypeInfo * __type_info__c2023960_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__d8299e85_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c2023960_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc2023960, "visitExprSafeField", 728 };
+TypeInfo * __type_info__2f87634a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__d8299e85_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f87634a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2f87634a, "preVisitExprSwizzle", 732 };
+TypeInfo * __type_info__cbd679f5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__d8299e85_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cbd679f5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcbd679f5, "visitExprSwizzle", 736 };
+TypeInfo * __type_info__c93f0085_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__d8299e85_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c93f0085_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc93f0085, "preVisitExprIsVariant", 740 };
+TypeInfo * __type_info__c5f99f7a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__d8299e85_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c5f99f7a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc5f99f7a, "visitExprIsVariant", 744 };
+TypeInfo * __type_info__d15980dd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__d8299e85_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d15980dd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd15980dd, "preVisitExprAsVariant", 748 };
+TypeInfo * __type_info__1fff0112_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__d8299e85_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1fff0112_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1fff0112, "visitExprAsVariant", 752 };
+TypeInfo * __type_info__6f4d2d82_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__d8299e85_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6f4d2d82_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6f4d2d82, "preVisitExprSafeAsVariant", 756 };
+TypeInfo * __type_info__c4a28f5d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__d8299e85_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c4a28f5d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc4a28f5d, "visitExprSafeAsVariant", 760 };
+TypeInfo * __type_info__4048a67e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__d8299e85_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4048a67e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x4048a67e, "preVisitExprOp1", 764 };
+TypeInfo * __type_info__a1981da5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__d8299e85_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a1981da5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa1981da5, "visitExprOp1", 768 };
+TypeInfo * __type_info__9cd84da2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__d8299e85_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9cd84da2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9cd84da2, "preVisitExprReturn", 772 };
+TypeInfo * __type_info__e51104e3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__d8299e85_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e51104e3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe51104e3, "visitExprReturn", 776 };
+TypeInfo * __type_info__88b468bd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__d8299e85_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88b468bd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x88b468bd, "preVisitExprYield", 780 };
+TypeInfo * __type_info__b873b4e2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__d8299e85_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b873b4e2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb873b4e2, "visitExprYield", 784 };
+TypeInfo * __type_info__bac4281b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__d8299e85_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bac4281b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbac4281b, "preVisitExprBreak", 788 };
+TypeInfo * __type_info__b8ba8abc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__d8299e85_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b8ba8abc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb8ba8abc, "visitExprBreak", 792 };
+TypeInfo * __type_info__988afcfd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__d8299e85_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__988afcfd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x988afcfd, "preVisitExprContinue", 796 };
+TypeInfo * __type_info__d11ed6d8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__d8299e85_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d11ed6d8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd11ed6d8, "visitExprContinue", 800 };
+TypeInfo * __type_info__80289013_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__d8299e85_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__80289013_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x80289013, "preVisitExprMakeBlock", 804 };
+TypeInfo * __type_info__c985a48c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__d8299e85_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c985a48c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc985a48c, "visitExprMakeBlock", 808 };
+TypeInfo * __type_info__37233ab_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__d8299e85_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__37233ab_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x37233ab, "preVisitExprMakeGenerator", 812 };
+TypeInfo * __type_info__6758a118_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__d8299e85_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6758a118_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6758a118, "visitExprMakeGenerator", 816 };
+TypeInfo * __type_info__cea9756b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__d8299e85_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cea9756b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcea9756b, "preVisitExprMemZero", 820 };
+TypeInfo * __type_info__21f91cf0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__d8299e85_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21f91cf0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21f91cf0, "visitExprMemZero", 824 };
+TypeInfo * __type_info__827a7b9f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__d8299e85_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__827a7b9f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x827a7b9f, "preVisitExprConst", 828 };
+TypeInfo * __type_info__80719338_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__d8299e85_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__80719338_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x80719338, "visitExprConst", 832 };
+TypeInfo * __type_info__f1edd27b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__d8299e85_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1edd27b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf1edd27b, "preVisitExprConstPtr", 836 };
+TypeInfo * __type_info__d4f9c662_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__d8299e85_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d4f9c662_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd4f9c662, "visitExprConstPtr", 840 };
+TypeInfo * __type_info__59a80c5a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__d8299e85_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__59a80c5a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x59a80c5a, "preVisitExprConstEnumeration", 844 };
+TypeInfo * __type_info__d561f037_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__d8299e85_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d561f037_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd561f037, "visitExprConstEnumeration", 848 };
+TypeInfo * __type_info__319243ae_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__d8299e85_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__319243ae_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x319243ae, "preVisitExprConstBitfield", 852 };
+TypeInfo * __type_info__f502f93d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__d8299e85_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f502f93d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf502f93d, "visitExprConstBitfield", 856 };
+TypeInfo * __type_info__35133e98_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__d8299e85_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35133e98_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x35133e98, "preVisitExprConstInt8", 860 };
+TypeInfo * __type_info__8f9f8e93_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__d8299e85_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f9f8e93_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8f9f8e93, "visitExprConstInt8", 864 };
+TypeInfo * __type_info__2d3a4cbf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__d8299e85_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2d3a4cbf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2d3a4cbf, "preVisitExprConstInt16", 868 };
+TypeInfo * __type_info__cb3eecea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__d8299e85_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb3eecea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb3eecea, "visitExprConstInt16", 872 };
+TypeInfo * __type_info__ad464f32_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__d8299e85_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad464f32_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xad464f32, "preVisitExprConstInt64", 876 };
+TypeInfo * __type_info__cb50360b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__d8299e85_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb50360b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb50360b, "visitExprConstInt64", 880 };
+TypeInfo * __type_info__dbe74630_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__d8299e85_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dbe74630_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdbe74630, "preVisitExprConstInt", 884 };
+TypeInfo * __type_info__a80e5f39_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__d8299e85_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a80e5f39_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa80e5f39, "visitExprConstInt", 888 };
+TypeInfo * __type_info__2f133526_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__d8299e85_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f133526_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2f133526, "preVisitExprConstInt2", 892 };
+TypeInfo * __type_info__999f9e51_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__d8299e85_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__999f9e51_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x999f9e51, "visitExprConstInt2", 896 };
+TypeInfo * __type_info__301336b9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__d8299e85_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__301336b9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x301336b9, "preVisitExprConstInt3", 900 };
+TypeInfo * __type_info__989f9cbe_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__d8299e85_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__989f9cbe_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x989f9cbe, "visitExprConstInt3", 904 };
+TypeInfo * __type_info__3113384c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__d8299e85_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3113384c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3113384c, "preVisitExprConstInt4", 908 };
+TypeInfo * __type_info__9b9fa177_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__d8299e85_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9b9fa177_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9b9fa177, "visitExprConstInt4", 912 };
+TypeInfo * __type_info__c8e5f55_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__d8299e85_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c8e5f55_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc8e5f55, "preVisitExprConstUInt8", 916 };
+TypeInfo * __type_info__4bbc29e0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__d8299e85_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4bbc29e0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x4bbc29e0, "visitExprConstUInt8", 920 };
+TypeInfo * __type_info__35318804_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__d8299e85_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35318804_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x35318804, "preVisitExprConstUInt16", 924 };
+TypeInfo * __type_info__a14c8807_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__d8299e85_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a14c8807_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa14c8807, "visitExprConstUInt16", 928 };
+TypeInfo * __type_info__3924c25d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__d8299e85_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3924c25d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3924c25d, "preVisitExprConstUInt64", 932 };
+TypeInfo * __type_info__21588a7a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__d8299e85_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21588a7a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21588a7a, "visitExprConstUInt64", 936 };
+TypeInfo * __type_info__1c524c4f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__d8299e85_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c524c4f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1c524c4f, "preVisitExprConstUInt", 940 };
+TypeInfo * __type_info__ba8cda98_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__d8299e85_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba8cda98_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xba8cda98, "visitExprConstUInt", 944 };
+TypeInfo * __type_info__128e68c7_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__d8299e85_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__128e68c7_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x128e68c7, "preVisitExprConstUInt2", 948 };
+TypeInfo * __type_info__55bc399e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__d8299e85_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__55bc399e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x55bc399e, "visitExprConstUInt2", 952 };
+TypeInfo * __type_info__118e6734_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__d8299e85_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__118e6734_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x118e6734, "preVisitExprConstUInt3", 956 };
+TypeInfo * __type_info__56bc3b31_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__d8299e85_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__56bc3b31_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x56bc3b31, "visitExprConstUInt3", 960 };
+TypeInfo * __type_info__108e65a1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__d8299e85_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__108e65a1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x108e65a1, "preVisitExprConstUInt4", 964 };
+TypeInfo * __type_info__57bc3cc4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__d8299e85_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__57bc3cc4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x57bc3cc4, "visitExprConstUInt4", 968 };
+TypeInfo * __type_info__7c486554_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__d8299e85_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7c486554_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7c486554, "preVisitExprConstRange", 972 };
+TypeInfo * __type_info__d1222c0d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__d8299e85_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d1222c0d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd1222c0d, "visitExprConstRange", 976 };
+TypeInfo * __type_info__21dc0f2b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__d8299e85_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__21dc0f2b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21dc0f2b, "preVisitExprConstURange", 980 };
+TypeInfo * __type_info__9bd0e54c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__d8299e85_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9bd0e54c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9bd0e54c, "visitExprConstURange", 984 };
+TypeInfo * __type_info__cfe854bb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__d8299e85_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cfe854bb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcfe854bb, "preVisitExprConstBool", 988 };
+TypeInfo * __type_info__52ff6128_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__d8299e85_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52ff6128_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x52ff6128, "visitExprConstBool", 992 };
+TypeInfo * __type_info__9b78bd2b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__d8299e85_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9b78bd2b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9b78bd2b, "preVisitExprConstFloat", 996 };
+TypeInfo * __type_info__14bcb702_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__d8299e85_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__14bcb702_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x14bcb702, "visitExprConstFloat", 1000 };
+TypeInfo * __type_info__d811ae5b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__d8299e85_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d811ae5b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd811ae5b, "preVisitExprConstFloat2", 1004 };
+TypeInfo * __type_info__d5146090_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__d8299e85_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d5146090_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd5146090, "visitExprConstFloat2", 1008 };
+TypeInfo * __type_info__d711acc8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__d8299e85_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d711acc8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd711acc8, "preVisitExprConstFloat3", 1012 };
+TypeInfo * __type_info__d6146223_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__d8299e85_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d6146223_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd6146223, "visitExprConstFloat3", 1016 };
+TypeInfo * __type_info__de11b7cd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__d8299e85_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__de11b7cd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xde11b7cd, "preVisitExprConstFloat4", 1020 };
+TypeInfo * __type_info__db146a02_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__d8299e85_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db146a02_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdb146a02, "visitExprConstFloat4", 1024 };
+TypeInfo * __type_info__6e97f0ea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__d8299e85_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6e97f0ea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6e97f0ea, "preVisitExprConstString", 1028 };
+TypeInfo * __type_info__ea5d24a1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__d8299e85_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ea5d24a1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xea5d24a1, "visitExprConstString", 1032 };
+TypeInfo * __type_info__89e422d2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__d8299e85_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89e422d2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x89e422d2, "preVisitExprConstDouble", 1036 };
+TypeInfo * __type_info__6c08a2e5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__d8299e85_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6c08a2e5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6c08a2e5, "visitExprConstDouble", 1040 };
+TypeInfo * __type_info__2af4d3dc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__d8299e85_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2af4d3dc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2af4d3dc, "preVisitExprFakeContext", 1044 };
+TypeInfo * __type_info__5fa7d37b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__d8299e85_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5fa7d37b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5fa7d37b, "visitExprFakeContext", 1048 };
+TypeInfo * __type_info__ee0efbc3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__d8299e85_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ee0efbc3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xee0efbc3, "preVisitExprFakeLineInfo", 1052 };
+TypeInfo * __type_info__afd807ea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__d8299e85_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__afd807ea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xafd807ea, "visitExprFakeLineInfo", 1056 };
+TypeInfo * __type_info__f7387f87_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__d8299e85_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f7387f87_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf7387f87, "preVisitExprReader", 1060 };
+TypeInfo * __type_info__d62685b2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__d8299e85_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d62685b2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd62685b2, "visitExprReader", 1064 };
+TypeInfo * __type_info__ffd9fe3a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__d8299e85_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ffd9fe3a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xffd9fe3a, "preVisitExprUnsafe", 1068 };
+TypeInfo * __type_info__dfbb50cb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__d8299e85_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dfbb50cb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdfbb50cb, "visitExprUnsafe", 1072 };
+TypeInfo * __type_info__a10f6f08_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__d8299e85_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a10f6f08_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa10f6f08, "preVisitExprCallMacro", 1076 };
+TypeInfo * __type_info__9794b2fb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__d8299e85_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9794b2fb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9794b2fb, "visitExprCallMacro", 1080 };
+VarInfo * __struct_info__d8299e85_fields[270] =  { &__struct_info__d8299e85_field_0, &__struct_info__d8299e85_field_1, &__struct_info__d8299e85_field_2, &__struct_info__d8299e85_field_3, &__struct_info__d8299e85_field_4, &__struct_info__d8299e85_field_5, &__struct_info__d8299e85_field_6, &__struct_info__d8299e85_field_7, &__struct_info__d8299e85_field_8, &__struct_info__d8299e85_field_9, &__struct_info__d8299e85_field_10, &__struct_info__d8299e85_field_11, &__struct_info__d8299e85_field_12, &__struct_info__d8299e85_field_13, &__struct_info__d8299e85_field_14, &__struct_info__d8299e85_field_15, &__struct_info__d8299e85_field_16, &__struct_info__d8299e85_field_17, &__struct_info__d8299e85_field_18, &__struct_info__d8299e85_field_19, &__struct_info__d8299e85_field_20, &__struct_info__d8299e85_field_21, &__struct_info__d8299e85_field_22, &__struct_info__d8299e85_field_23, &__struct_info__d8299e85_field_24, &__struct_info__d8299e85_field_25, &__struct_info__d8299e85_field_26, &__struct_info__d8299e85_field_27, &__struct_info__d8299e85_field_28, &__struct_info__d8299e85_field_29, &__struct_info__d8299e85_field_30, &__struct_info__d8299e85_field_31, &__struct_info__d8299e85_field_32, &__struct_info__d8299e85_field_33, &__struct_info__d8299e85_field_34, &__struct_info__d8299e85_field_35, &__struct_info__d8299e85_field_36, &__struct_info__d8299e85_field_37, &__struct_info__d8299e85_field_38, &__struct_info__d8299e85_field_39, &__struct_info__d8299e85_field_40, &__struct_info__d8299e85_field_41, &__struct_info__d8299e85_field_42, &__struct_info__d8299e85_field_43, &__struct_info__d8299e85_field_44, &__struct_info__d8299e85_field_45, &__struct_info__d8299e85_field_46, &__struct_info__d8299e85_field_47, &__struct_info__d8299e85_field_48, &__struct_info__d8299e85_field_49, &__struct_info__d8299e85_field_50, &__struct_info__d8299e85_field_51, &__struct_info__d8299e85_field_52, &__struct_info__d8299e85_field_53, &__struct_info__d8299e85_field_54, &__struct_info__d8299e85_field_55, &__struct_info__d8299e85_field_56, &__struct_info__d8299e85_field_57, &__struct_info__d8299e85_field_58, &__struct_info__d8299e85_field_59, &__struct_info__d8299e85_field_60, &__struct_info__d8299e85_field_61, &__struct_info__d8299e85_field_62, &__struct_info__d8299e85_field_63, &__struct_info__d8299e85_field_64, &__struct_info__d8299e85_field_65, &__struct_info__d8299e85_field_66, &__struct_info__d8299e85_field_67, &__struct_info__d8299e85_field_68, &__struct_info__d8299e85_field_69, &__struct_info__d8299e85_field_70, &__struct_info__d8299e85_field_71, &__struct_info__d8299e85_field_72, &__struct_info__d8299e85_field_73, &__struct_info__d8299e85_field_74, &__struct_info__d8299e85_field_75, &__struct_info__d8299e85_field_76, &__struct_info__d8299e85_field_77, &__struct_info__d8299e85_field_78, &__struct_info__d8299e85_field_79, &__struct_info__d8299e85_field_80, &__struct_info__d8299e85_field_81, &__struct_info__d8299e85_field_82, &__struct_info__d8299e85_field_83, &__struct_info__d8299e85_field_84, &__struct_info__d8299e85_field_85, &__struct_info__d8299e85_field_86, &__struct_info__d8299e85_field_87, &__struct_info__d8299e85_field_88, &__struct_info__d8299e85_field_89, &__struct_info__d8299e85_field_90, &__struct_info__d8299e85_field_91, &__struct_info__d8299e85_field_92, &__struct_info__d8299e85_field_93, &__struct_info__d8299e85_field_94, &__struct_info__d8299e85_field_95, &__struct_info__d8299e85_field_96, &__struct_info__d8299e85_field_97, &__struct_info__d8299e85_field_98, &__struct_info__d8299e85_field_99, &__struct_info__d8299e85_field_100, &__struct_info__d8299e85_field_101, &__struct_info__d8299e85_field_102, &__struct_info__d8299e85_field_103, &__struct_info__d8299e85_field_104, &__struct_info__d8299e85_field_105, &__struct_info__d8299e85_field_106, &__struct_info__d8299e85_field_107, &__struct_info__d8299e85_field_108, &__struct_info__d8299e85_field_109, &__struct_info__d8299e85_field_110, &__struct_info__d8299e85_field_111, &__struct_info__d8299e85_field_112, &__struct_info__d8299e85_field_113, &__struct_info__d8299e85_field_114, &__struct_info__d8299e85_field_115, &__struct_info__d8299e85_field_116, &__struct_info__d8299e85_field_117, &__struct_info__d8299e85_field_118, &__struct_info__d8299e85_field_119, &__struct_info__d8299e85_field_120, &__struct_info__d8299e85_field_121, &__struct_info__d8299e85_field_122, &__struct_info__d8299e85_field_123, &__struct_info__d8299e85_field_124, &__struct_info__d8299e85_field_125, &__struct_info__d8299e85_field_126, &__struct_info__d8299e85_field_127, &__struct_info__d8299e85_field_128, &__struct_info__d8299e85_field_129, &__struct_info__d8299e85_field_130, &__struct_info__d8299e85_field_131, &__struct_info__d8299e85_field_132, &__struct_info__d8299e85_field_133, &__struct_info__d8299e85_field_134, &__struct_info__d8299e85_field_135, &__struct_info__d8299e85_field_136, &__struct_info__d8299e85_field_137, &__struct_info__d8299e85_field_138, &__struct_info__d8299e85_field_139, &__struct_info__d8299e85_field_140, &__struct_info__d8299e85_field_141, &__struct_info__d8299e85_field_142, &__struct_info__d8299e85_field_143, &__struct_info__d8299e85_field_144, &__struct_info__d8299e85_field_145, &__struct_info__d8299e85_field_146, &__struct_info__d8299e85_field_147, &__struct_info__d8299e85_field_148, &__struct_info__d8299e85_field_149, &__struct_info__d8299e85_field_150, &__struct_info__d8299e85_field_151, &__struct_info__d8299e85_field_152, &__struct_info__d8299e85_field_153, &__struct_info__d8299e85_field_154, &__struct_info__d8299e85_field_155, &__struct_info__d8299e85_field_156, &__struct_info__d8299e85_field_157, &__struct_info__d8299e85_field_158, &__struct_info__d8299e85_field_159, &__struct_info__d8299e85_field_160, &__struct_info__d8299e85_field_161, &__struct_info__d8299e85_field_162, &__struct_info__d8299e85_field_163, &__struct_info__d8299e85_field_164, &__struct_info__d8299e85_field_165, &__struct_info__d8299e85_field_166, &__struct_info__d8299e85_field_167, &__struct_info__d8299e85_field_168, &__struct_info__d8299e85_field_169, &__struct_info__d8299e85_field_170, &__struct_info__d8299e85_field_171, &__struct_info__d8299e85_field_172, &__struct_info__d8299e85_field_173, &__struct_info__d8299e85_field_174, &__struct_info__d8299e85_field_175, &__struct_info__d8299e85_field_176, &__struct_info__d8299e85_field_177, &__struct_info__d8299e85_field_178, &__struct_info__d8299e85_field_179, &__struct_info__d8299e85_field_180, &__struct_info__d8299e85_field_181, &__struct_info__d8299e85_field_182, &__struct_info__d8299e85_field_183, &__struct_info__d8299e85_field_184, &__struct_info__d8299e85_field_185, &__struct_info__d8299e85_field_186, &__struct_info__d8299e85_field_187, &__struct_info__d8299e85_field_188, &__struct_info__d8299e85_field_189, &__struct_info__d8299e85_field_190, &__struct_info__d8299e85_field_191, &__struct_info__d8299e85_field_192, &__struct_info__d8299e85_field_193, &__struct_info__d8299e85_field_194, &__struct_info__d8299e85_field_195, &__struct_info__d8299e85_field_196, &__struct_info__d8299e85_field_197, &__struct_info__d8299e85_field_198, &__struct_info__d8299e85_field_199, &__struct_info__d8299e85_field_200, &__struct_info__d8299e85_field_201, &__struct_info__d8299e85_field_202, &__struct_info__d8299e85_field_203, &__struct_info__d8299e85_field_204, &__struct_info__d8299e85_field_205, &__struct_info__d8299e85_field_206, &__struct_info__d8299e85_field_207, &__struct_info__d8299e85_field_208, &__struct_info__d8299e85_field_209, &__struct_info__d8299e85_field_210, &__struct_info__d8299e85_field_211, &__struct_info__d8299e85_field_212, &__struct_info__d8299e85_field_213, &__struct_info__d8299e85_field_214, &__struct_info__d8299e85_field_215, &__struct_info__d8299e85_field_216, &__struct_info__d8299e85_field_217, &__struct_info__d8299e85_field_218, &__struct_info__d8299e85_field_219, &__struct_info__d8299e85_field_220, &__struct_info__d8299e85_field_221, &__struct_info__d8299e85_field_222, &__struct_info__d8299e85_field_223, &__struct_info__d8299e85_field_224, &__struct_info__d8299e85_field_225, &__struct_info__d8299e85_field_226, &__struct_info__d8299e85_field_227, &__struct_info__d8299e85_field_228, &__struct_info__d8299e85_field_229, &__struct_info__d8299e85_field_230, &__struct_info__d8299e85_field_231, &__struct_info__d8299e85_field_232, &__struct_info__d8299e85_field_233, &__struct_info__d8299e85_field_234, &__struct_info__d8299e85_field_235, &__struct_info__d8299e85_field_236, &__struct_info__d8299e85_field_237, &__struct_info__d8299e85_field_238, &__struct_info__d8299e85_field_239, &__struct_info__d8299e85_field_240, &__struct_info__d8299e85_field_241, &__struct_info__d8299e85_field_242, &__struct_info__d8299e85_field_243, &__struct_info__d8299e85_field_244, &__struct_info__d8299e85_field_245, &__struct_info__d8299e85_field_246, &__struct_info__d8299e85_field_247, &__struct_info__d8299e85_field_248, &__struct_info__d8299e85_field_249, &__struct_info__d8299e85_field_250, &__struct_info__d8299e85_field_251, &__struct_info__d8299e85_field_252, &__struct_info__d8299e85_field_253, &__struct_info__d8299e85_field_254, &__struct_info__d8299e85_field_255, &__struct_info__d8299e85_field_256, &__struct_info__d8299e85_field_257, &__struct_info__d8299e85_field_258, &__struct_info__d8299e85_field_259, &__struct_info__d8299e85_field_260, &__struct_info__d8299e85_field_261, &__struct_info__d8299e85_field_262, &__struct_info__d8299e85_field_263, &__struct_info__d8299e85_field_264, &__struct_info__d8299e85_field_265, &__struct_info__d8299e85_field_266, &__struct_info__d8299e85_field_267, &__struct_info__d8299e85_field_268, &__struct_info__d8299e85_field_269 };
+StructInfo __struct_info__d8299e85 = {"AstVisitor", __struct_info__d8299e85_fields, 270, 1088, -1, nullptr, 0xd8299e85 };
+VarInfo __struct_info__89f0c0ca_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1849f5d1, "__rtti", 0 };
+TypeInfo * __type_info__3b82a2be_arg_types_var_2314256586[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__89f0c0ca_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3b82a2be_arg_types_var_2314256586, nullptr, 1, 0, nullptr, 28, 0x3b82a2be, "__finalize", 8 };
+TypeInfo * __type_info__78532346_arg_types_var_2314256586[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__89f0c0ca_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__78532346_arg_types_var_2314256586, nullptr, 5, 0, nullptr, 28, 0x78532346, "apply", 12 };
+TypeInfo * __type_info__d9ab9409_arg_types_var_2314256586[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__89f0c0ca_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__d9ab9409_arg_types_var_2314256586, nullptr, 5, 0, nullptr, 28, 0xd9ab9409, "finish", 16 };
+VarInfo * __struct_info__89f0c0ca_fields[4] =  { &__struct_info__89f0c0ca_field_0, &__struct_info__89f0c0ca_field_1, &__struct_info__89f0c0ca_field_2, &__struct_info__89f0c0ca_field_3 };
+StructInfo __struct_info__89f0c0ca = {"SmallArrayMacro", __struct_info__89f0c0ca_fields, 4, 24, -1, nullptr, 0x89f0c0ca };
+VarInfo __struct_info__5ed6db18_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2f90ec93, "__rtti", 0 };
+TypeInfo * __type_info__fb05f748_arg_types_var_1591139096[1] = { &__type_info__fdd27932 };
+VarInfo __struct_info__5ed6db18_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fb05f748_arg_types_var_1591139096, nullptr, 1, 0, nullptr, 28, 0xfb05f748, "__finalize", 8 };
+TypeInfo * __type_info__1e070140_arg_types_var_1591139096[3] = { &__type_info__fdd27932, &__type_info__8f3455dd, &__type_info__b049b391 };
+VarInfo __struct_info__5ed6db18_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1e070140_arg_types_var_1591139096, nullptr, 3, 0, nullptr, 28, 0x1e070140, "apply", 12 };
+VarInfo * __struct_info__5ed6db18_fields[3] =  { &__struct_info__5ed6db18_field_0, &__struct_info__5ed6db18_field_1, &__struct_info__5ed6db18_field_2 };
+StructInfo __struct_info__5ed6db18 = {"AstPassMacro", __struct_info__5ed6db18_fields, 3, 16, -1, nullptr, 0x5ed6db18 };
+TypeInfo __type_info__10db1c1d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x10db1c1d };
+TypeInfo __type_info__da50b805 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__515c0a3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xda50b805 };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__f42f651e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprStringBuilder"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf42f651e };
+TypeInfo __type_info__dc52e0d5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a8d37f6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xdc52e0d5 };
+TypeInfo __type_info__c0e5e0ad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstURange"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc0e5e0ad };
+TypeInfo __type_info__8bc5634d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__91c4dfb3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8bc5634d };
+TypeInfo __type_info__bab365e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a40a0d70, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xbab365e };
+TypeInfo __type_info__7ec7955d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x7ec7955d };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__3737d9d1 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeGenerator"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3737d9d1 };
+TypeInfo __type_info__cd849a9b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7856e79d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xcd849a9b };
+TypeInfo __type_info__aaadd575 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFakeLineInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xaaadd575 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x13667ab1 };
+TypeInfo __type_info__c2b9b42c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt64"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc2b9b42c };
+TypeInfo __type_info__6f381053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprVar"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6f381053 };
+TypeInfo __type_info__261bce6f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x261bce6f };
+TypeInfo __type_info__dd644f60 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReturn"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xdd644f60 };
+TypeInfo __type_info__e749bd33 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5527f9ed, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe749bd33 };
+TypeInfo __type_info__73c8114e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dd644f60, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x73c8114e };
+TypeInfo __type_info__7da04467 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4aee91, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x7da04467 };
+TypeInfo __type_info__b1ceb1d4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprRef2Value"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb1ceb1d4 };
+TypeInfo __type_info__653ef983 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8f8da119, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x653ef983 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__1cb4fa6d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e97755bb, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1cb4fa6d };
+TypeInfo __type_info__515c0a3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMove"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x515c0a3 };
+TypeInfo __type_info__ccb7c90a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt16"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xccb7c90a };
+TypeInfo __type_info__b3bcfd53 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprBlock"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb3bcfd53 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__46fed0f3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b867c43d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x46fed0f3 };
+TypeInfo __type_info__523f6667 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x523f6667 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__6d1d425d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b2cb4a2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6d1d425d };
+TypeInfo __type_info__ebcc21eb = { Type::tStructure, &__struct_info__d8299e85, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xebcc21eb };
+TypeInfo __type_info__5ef84086 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprStaticAssert"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5ef84086 };
+TypeInfo __type_info__7a1c4eb7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fc0d99dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x7a1c4eb7 };
+TypeInfo __type_info__2b3e54e5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstBool"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2b3e54e5 };
+TypeInfo __type_info__4de83811 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstPtr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4de83811 };
+TypeInfo __type_info__94ae69a3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__aaadd575, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x94ae69a3 };
+TypeInfo __type_info__87a6e894 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7ebfa292, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x87a6e894 };
+TypeInfo __type_info__a6a527e0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNew"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa6a527e0 };
+TypeInfo __type_info__83498580 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstDouble"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x83498580 };
+TypeInfo __type_info__a960d6ab = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7856e79d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa960d6ab };
+TypeInfo __type_info__b108e3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d73ee2dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb108e3 };
+TypeInfo __type_info__d7eb08f1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9920ba3b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd7eb08f1 };
+TypeInfo __type_info__f486e881 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3a70d70f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xf486e881 };
+TypeInfo __type_info__fdd27932 = { Type::tStructure, &__struct_info__5ed6db18, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xfdd27932 };
+TypeInfo __type_info__1683ec13 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374b4b09, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1683ec13 };
+TypeInfo __type_info__1d5a02b1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6f381053, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1d5a02b1 };
+TypeInfo __type_info__8f8da119 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprArrayComprehension"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8f8da119 };
+TypeInfo __type_info__d9283a27 = { Type::tStructure, &__struct_info__89f0c0ca, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xd9283a27 };
+TypeInfo __type_info__5bc565f1 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5bc565f1 };
+TypeInfo __type_info__819d499d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5dc56917, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x819d499d };
+TypeInfo __type_info__81be117c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be386f7a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x81be117c };
+TypeInfo __type_info__b5d7ce5d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7ec0323f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb5d7ce5d };
+TypeInfo __type_info__32f7a66b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cae7a171, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x32f7a66b };
+TypeInfo __type_info__cae7a171 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprDebug"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcae7a171 };
+TypeInfo __type_info__453f3d02 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cd57da00, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x453f3d02 };
+TypeInfo __type_info__30023ebb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5f6a7cad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x30023ebb };
+TypeInfo __type_info__dcfff1ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xdcfff1ff };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__4edf488d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x4edf488d };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__8fce7587 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a1ba446d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fce7587 };
+TypeInfo __type_info__a01f8605 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__721467d3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa01f8605 };
+TypeInfo __type_info__15780d4b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3737d9d1, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x15780d4b };
+TypeInfo __type_info__7ec0323f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLet"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7ec0323f };
+TypeInfo __type_info__ae076c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9a5b5986, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xae076c };
+TypeInfo __type_info__ff9fd5d3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d73ee2dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xff9fd5d3 };
+TypeInfo __type_info__3c4f7906 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3c4f7906 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__c4ccbb7e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__83498580, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc4ccbb7e };
+TypeInfo __type_info__8e3dc326 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a65edd74, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8e3dc326 };
+TypeInfo __type_info__d73ee2dd = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Variable"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd73ee2dd };
+TypeInfo __type_info__72ae9081 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ccc9122b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x72ae9081 };
+TypeInfo __type_info__c831b26a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprTryCatch"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc831b26a };
+TypeInfo __type_info__d25748d6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4fa9a2d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd25748d6 };
+TypeInfo __type_info__3a70d70f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprContinue"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3a70d70f };
+TypeInfo __type_info__7c510f91 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprDelete"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7c510f91 };
+TypeInfo __type_info__b66d9ef1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8121e453, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb66d9ef1 };
+TypeInfo __type_info__91c4dfb3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprClone"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x91c4dfb3 };
+TypeInfo __type_info__15e14f92 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1d3d6764, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x15e14f92 };
+TypeInfo __type_info__ebc70931 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeArray"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xebc70931 };
+TypeInfo __type_info__3c8fd4b4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8728109a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x3c8fd4b4 };
+TypeInfo __type_info__4e52e6ae = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Structure"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4e52e6ae };
+TypeInfo __type_info__8891fc55 = { Type::tStructure, &__struct_info__713aafe3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x8891fc55 };
+TypeInfo __type_info__7ebfa292 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprWith"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7ebfa292 };
+TypeInfo __type_info__9773df12 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprField"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9773df12 };
+TypeInfo __type_info__317f8d25 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::FieldDeclaration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x317f8d25 };
+TypeInfo __type_info__3c6fa07f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5bc565f1, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x3c6fa07f };
+TypeInfo __type_info__9920ba3b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9920ba3b };
+TypeInfo __type_info__8f234b97 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c6cb0399, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f234b97 };
+TypeInfo __type_info__87882376 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4f3571c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x87882376 };
+TypeInfo __type_info__5f6a7cad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprBreak"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5f6a7cad };
+TypeInfo __type_info__10b7decc = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c831b26a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x10b7decc };
+TypeInfo __type_info__c9679a50 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76972586, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc9679a50 };
+TypeInfo __type_info__8494e015 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLooksLikeCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8494e015 };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__b867c43d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCast"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb867c43d };
+TypeInfo __type_info__9e20c21a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9e20c21a };
+TypeInfo __type_info__b9491240 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cf57dd26, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9491240 };
+TypeInfo __type_info__8ce26751 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8ce26751 };
+TypeInfo __type_info__963c776b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c0e5e0ad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x963c776b };
+TypeInfo __type_info__b58fe8a6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a6a527e0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb58fe8a6 };
+TypeInfo __type_info__5527f9ed = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFor"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5527f9ed };
+TypeInfo __type_info__fba33907 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8494e015, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xfba33907 };
+TypeInfo __type_info__51c55633 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt8"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x51c55633 };
+TypeInfo __type_info__84917dd0 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d00bb3d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x84917dd0 };
+TypeInfo __type_info__b9a2b501 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b38eb5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9a2b501 };
+TypeInfo __type_info__68f47b8a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__251bccdc, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x68f47b8a };
+TypeInfo __type_info__34157e23 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__309172d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x34157e23 };
+TypeInfo __type_info__37ca469d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__27a9a437, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x37ca469d };
+TypeInfo __type_info__14c14bf4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c627fc0a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x14c14bf4 };
+TypeInfo __type_info__4fa9a2d8 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSwizzle"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4fa9a2d8 };
+TypeInfo __type_info__d4f3571c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLabel"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4f3571c };
+TypeInfo __type_info__2d8fb614 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x2d8fb614 };
+TypeInfo __type_info__10edfe53 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8f8b0275, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x10edfe53 };
+TypeInfo __type_info__a07921bf = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::AnnotationArgumentList"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xa07921bf };
+TypeInfo __type_info__b38eb5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb38eb5b3 };
+TypeInfo __type_info__2481035b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9f20c3ad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2481035b };
+TypeInfo __type_info__a1ba446d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprGoto"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa1ba446d };
+TypeInfo __type_info__9fee7340 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f1bdc9a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x9fee7340 };
+TypeInfo __type_info__ada7aa90 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstString"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xada7aa90 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__664a2fe7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374bcd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x664a2fe7 };
+TypeInfo __type_info__655bd8a4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f66d4d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x655bd8a4 };
+TypeInfo __type_info__2f1bdc9a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt8"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2f1bdc9a };
+TypeInfo __type_info__8fd2ec2e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f2cdf1a0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fd2ec2e };
+TypeInfo __type_info__5dc56917 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5dc56917 };
+TypeInfo __type_info__d16acbbb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2b3e54e5, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd16acbbb };
+TypeInfo __type_info__d4aee91 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFind"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4aee91 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__2ba0095f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2ba0095f };
+TypeInfo __type_info__d057deb9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd057deb9 };
+TypeInfo __type_info__6dd946fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e0a995b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x6dd946fa };
+TypeInfo __type_info__32b24044 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x32b24044 };
+TypeInfo __type_info__531e5432 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7df5ef2c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x531e5432 };
+TypeInfo __type_info__e0a995b4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Enumeration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe0a995b4 };
+TypeInfo __type_info__368fac4c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__231bc9b6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x368fac4c };
+TypeInfo __type_info__76b8ad03 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprYield"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76b8ad03 };
+TypeInfo __type_info__48d9d78 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c4f7906, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x48d9d78 };
+TypeInfo __type_info__6535171f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIfThenElse"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6535171f };
+TypeInfo __type_info__9ee277f5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAddr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9ee277f5 };
+TypeInfo __type_info__e7b89eff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__10db1c1d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe7b89eff };
+TypeInfo __type_info__7454c789 = { Type::tStructure, &__struct_info__17d0e062, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x7454c789 };
+TypeInfo __type_info__8f8b0275 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeBlock"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8f8b0275 };
+TypeInfo __type_info__764dc75a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b1ceb1d4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x764dc75a };
+TypeInfo __type_info__e2deda56 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ada7aa90, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe2deda56 };
+TypeInfo __type_info__5a28d785 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprKeyExists"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5a28d785 };
+TypeInfo __type_info__9445fbcf = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7c510f91, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x9445fbcf };
+TypeInfo __type_info__7df5ef2c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAssert"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7df5ef2c };
+TypeInfo __type_info__bf2d884b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbf2d884b };
+TypeInfo __type_info__6c2a86f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b3bcfd53, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6c2a86f9 };
+TypeInfo __type_info__e97755bb = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprWhile"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe97755bb };
+TypeInfo __type_info__295e937b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4de83811, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x295e937b };
+TypeInfo __type_info__4ca379ed = { Type::tStructure, &__struct_info__2fae7274, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x4ca379ed };
+TypeInfo __type_info__1d3d6764 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstBitfield"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1d3d6764 };
+TypeInfo __type_info__251bccdc = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x251bccdc };
+TypeInfo __type_info__bd757ca = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeTuple"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbd757ca };
+TypeInfo __type_info__5ac5645e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5ac5645e };
+TypeInfo __type_info__e4d4c1e4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ccb7c90a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe4d4c1e4 };
+TypeInfo __type_info__d514cba4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprErase"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd514cba4 };
+TypeInfo __type_info__60d19370 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9e20c21a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x60d19370 };
+TypeInfo __type_info__c5ddc6fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d514cba4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc5ddc6fa };
+TypeInfo __type_info__9f20c3ad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9f20c3ad };
+TypeInfo __type_info__1b3c6d8d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1b3c6d8d };
+TypeInfo __type_info__6529db2b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1b3c6d8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6529db2b };
+TypeInfo __type_info__a8d37f6f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNullCoalescing"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa8d37f6f };
+TypeInfo __type_info__d7ddca10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5ef84086, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd7ddca10 };
+TypeInfo __type_info__130d26f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__51c55633, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x130d26f9 };
+TypeInfo __type_info__721467d3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x721467d3 };
+TypeInfo __type_info__8728109a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIs"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8728109a };
+TypeInfo __type_info__1bb5fdf7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ebc70931, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1bb5fdf7 };
+TypeInfo __type_info__a65edd74 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstEnumeration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa65edd74 };
+TypeInfo __type_info__76972586 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCallMacro"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76972586 };
+TypeInfo __type_info__5ca338ad = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6535171f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x5ca338ad };
+TypeInfo __type_info__d180e781 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76b8ad03, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd180e781 };
+TypeInfo __type_info__74b0f2db = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprRef2Ptr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x74b0f2db };
+TypeInfo __type_info__cf57dd26 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcf57dd26 };
+TypeInfo __type_info__535415eb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9338185, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x535415eb };
+TypeInfo __type_info__ccc9122b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt64"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xccc9122b };
+TypeInfo __type_info__b2cb4a2b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCopy"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb2cb4a2b };
+TypeInfo __type_info__a5b6b194 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5ac5645e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa5b6b194 };
+TypeInfo __type_info__ccee123b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5a28d785, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xccee123b };
+TypeInfo __type_info__374b4b09 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::MakeFieldDecl"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x374b4b09 };
+TypeInfo __type_info__9338185 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMemZero"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9338185 };
+TypeInfo __type_info__cf52b1be = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c2b9b42c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcf52b1be };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+TypeInfo __type_info__9a5b5986 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprInvoke"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9a5b5986 };
+TypeInfo __type_info__7856e79d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::TypeDecl"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7856e79d };
+TypeInfo __type_info__75b7ce79 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReader"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x75b7ce79 };
+TypeInfo __type_info__5f1adc0e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFakeContext"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5f1adc0e };
+TypeInfo __type_info__cd57da00 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp1"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcd57da00 };
+TypeInfo __type_info__c1bd2f4c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ModuleGroup"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc1bd2f4c };
+TypeInfo __type_info__a8981616 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e0a995b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa8981616 };
+TypeInfo __type_info__88de8728 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9773df12, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x88de8728 };
+TypeInfo __type_info__1b9f61f8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bd757ca, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1b9f61f8 };
+TypeInfo __type_info__79323f61 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Function"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x79323f61 };
+TypeInfo __type_info__231bc9b6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x231bc9b6 };
+TypeInfo __type_info__8121e453 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNamedCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8121e453 };
+TypeInfo __type_info__d3ebcc43 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374b4b09, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xd3ebcc43 };
+TypeInfo __type_info__f2cdf1a0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf2cdf1a0 };
+TypeInfo __type_info__d8ac9e75 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__261bce6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd8ac9e75 };
+TypeInfo __type_info__fc0d99dd = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConst"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xfc0d99dd };
+TypeInfo __type_info__c1e3d526 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__858d2368, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc1e3d526 };
+TypeInfo __type_info__c627fc0a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstRange"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc627fc0a };
+TypeInfo __type_info__a40a0d70 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAscend"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa40a0d70 };
+TypeInfo __type_info__858d2368 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprUnsafe"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x858d2368 };
+TypeInfo __type_info__c6cb0399 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt16"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc6cb0399 };
+TypeInfo __type_info__f66d4d6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf66d4d6 };
+TypeInfo __type_info__fe4bfa47 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9ee277f5, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xfe4bfa47 };
+TypeInfo __type_info__cb3ec93c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5f1adc0e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcb3ec93c };
+TypeInfo __type_info__27a9a437 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprPtr2Ref"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x27a9a437 };
+TypeInfo __type_info__374bcd9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x374bcd9 };
+TypeInfo __type_info__39dd41c1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__74b0f2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x39dd41c1 };
+TypeInfo __type_info__d00bb3d6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprTypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd00bb3d6 };
+TypeInfo __type_info__f1eeff10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f42f651e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xf1eeff10 };
+TypeInfo __type_info__b081465d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeField"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb081465d };
+TypeInfo __type_info__8c0d0a29 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bf2d884b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8c0d0a29 };
+TypeInfo __type_info__cf76cec3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b081465d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcf76cec3 };
+TypeInfo __type_info__be386f7a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbe386f7a };
+TypeInfo __type_info__ed20bab = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d057deb9, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xed20bab };
+TypeInfo __type_info__309172d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeStruct"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x309172d };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__3ffbf730, &__type_info__95e97e5e };
+TypeInfo * __tinfo_1[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__e8c29053 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+namespace ast {
+
+struct AstPassMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstPassMacro)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const )) apply;
+};
+static_assert(sizeof(AstPassMacro)==16,"structure size mismatch with DAS");
+static_assert(offsetof(AstPassMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstPassMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstPassMacro,apply)==12,"structure field offset mismatch with DAS");
+}
+// unused structure AstReaderMacro
+namespace ast {
+
+struct AstStructureAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AstStructureAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,finish)==16,"structure field offset mismatch with DAS");
+}
+// unused structure AstVariantMacro
+namespace ast {
+
+struct AstVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,struct ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,struct ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+};
+static_assert(sizeof(AstVisitor)==1088,"structure size mismatch with DAS");
+static_assert(offsetof(AstVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDebug)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDebug)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprInvoke)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprInvoke)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprErase)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprErase)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFind)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFind)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprKeyExists)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprKeyExists)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAscend)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAscend)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCast)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCast)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDelete)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDelete)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprVar)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprVar)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprField)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprField)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSwizzle)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSwizzle)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsVariant)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIsVariant)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp1)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp1)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReturn)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReturn)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprYield)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprYield)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBreak)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBreak)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprContinue)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprContinue)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeBlock)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeBlock)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeGenerator)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeGenerator)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMemZero)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMemZero)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConst)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConst)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstPtr)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstPtr)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstEnumeration)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstEnumeration)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBitfield)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBitfield)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt8)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt8)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt16)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt16)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt64)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt64)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt2)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt2)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt3)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt3)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt4)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt4)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt8)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt8)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt16)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt16)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt64)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt64)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt2)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt2)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt3)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt3)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt4)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt4)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstRange)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstRange)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstURange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstURange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBool)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBool)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat2)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat2)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat3)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat3)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat4)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat4)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstString)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstString)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstDouble)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstDouble)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeContext)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeContext)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeLineInfo)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeLineInfo)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReader)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReader)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprUnsafe)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprUnsafe)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallMacro)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallMacro)==1080,"structure field offset mismatch with DAS");
+}
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace small_array {
+
+struct SmallArrayMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(SmallArrayMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(SmallArrayMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayMacro,finish)==16,"structure field offset mismatch with DAS");
+}
+namespace small_array {
+
+struct SmallArrayVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,struct ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,struct ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+	bool changed;
+};
+static_assert(sizeof(SmallArrayVisitor)==1088,"structure size mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprDebug)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprDebug)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprInvoke)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprInvoke)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprErase)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprErase)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprFind)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprFind)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprKeyExists)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprKeyExists)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprAscend)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprAscend)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprCast)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprCast)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprDelete)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprDelete)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprVar)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprVar)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprField)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprField)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprSafeField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprSafeField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprSwizzle)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprSwizzle)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprIsVariant)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprIsVariant)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprAsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprAsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprSafeAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprSafeAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprOp1)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprOp1)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprReturn)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprReturn)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprYield)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprYield)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprBreak)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprBreak)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprContinue)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprContinue)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeBlock)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeBlock)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMakeGenerator)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMakeGenerator)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprMemZero)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprMemZero)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConst)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConst)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstPtr)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstPtr)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstEnumeration)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstEnumeration)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstBitfield)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstBitfield)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstInt8)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstInt8)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstInt16)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstInt16)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstInt64)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstInt64)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstInt)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstInt)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstInt2)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstInt2)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstInt3)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstInt3)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstInt4)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstInt4)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstUInt8)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstUInt8)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstUInt16)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstUInt16)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstUInt64)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstUInt64)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstUInt)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstUInt)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstUInt2)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstUInt2)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstUInt3)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstUInt3)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstUInt4)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstUInt4)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstRange)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstRange)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstURange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstURange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstBool)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstBool)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstFloat)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstFloat)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstFloat2)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstFloat2)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstFloat3)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstFloat3)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstFloat4)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstFloat4)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstString)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstString)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprConstDouble)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprConstDouble)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprFakeContext)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprFakeContext)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprFakeLineInfo)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprFakeLineInfo)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprReader)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprReader)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprUnsafe)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprUnsafe)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,preVisitExprCallMacro)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,visitExprCallMacro)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayVisitor,changed)==1084,"structure field offset mismatch with DAS");
+}
+namespace small_array {
+
+struct SmallArrayRewriteMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstPassMacro)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const )) apply;
+};
+static_assert(sizeof(SmallArrayRewriteMacro)==16,"structure size mismatch with DAS");
+static_assert(offsetof(SmallArrayRewriteMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayRewriteMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SmallArrayRewriteMacro,apply)==12,"structure field offset mismatch with DAS");
+}
+
+inline struct small_array::SmallArrayMacro SmallArrayMacro_7e2c51ea58ff6abd ( Context * __context__ );
+inline void _FuncSmallArrayMacro_0x27___finalize_9a83f9eac10b8035 ( Context * __context__, struct small_array::SmallArrayMacro & __self_rename_at_231 );
+inline bool _FuncSmallArrayMacro_0x60_apply_b3884cb9241b9cc4 ( Context * __context__, struct small_array::SmallArrayMacro & __self_rename_at_232, smart_ptr_raw<Structure> __st_rename_at_232, ModuleGroup & __group_rename_at_232, AnnotationArgumentList const  & __args_rename_at_232, das::string & __errors_rename_at_232 );
+inline struct small_array::SmallArrayRewriteMacro SmallArrayRewriteMacro_3cd2e5502eab1df6 ( Context * __context__ );
+inline void _FuncSmallArrayRewriteMacro_0x27___finalize_deae09e19dbdbb2d ( Context * __context__, struct small_array::SmallArrayRewriteMacro & __self_rename_at_350 );
+inline bool _FuncSmallArrayRewriteMacro_0x60_apply_e36bd1b518dc89ba ( Context * __context__, struct small_array::SmallArrayRewriteMacro & __self_rename_at_351, smart_ptr_raw<Program> const  __prog_rename_at_351, Module * const  __mod_rename_at_351 );
+inline struct small_array::SmallArrayVisitor SmallArrayVisitor_21869b7bda84dc08 ( Context * __context__ );
+inline void _FuncSmallArrayVisitor_0x27___finalize_28498398044e4e65 ( Context * __context__, struct small_array::SmallArrayVisitor & __self_rename_at_324 );
+inline smart_ptr_raw<Expression> _FuncSmallArrayVisitor_0x60_visitExprAt_5fc9d9623c00854a ( Context * __context__, struct small_array::SmallArrayVisitor & __self_rename_at_326, smart_ptr_raw<ExprAt> const  __expr_rename_at_326 );
+inline smart_ptr_raw<Expression> _FuncSmallArrayVisitor_0x60_visitExprFor_55aac27bc6ceb7e2 ( Context * __context__, struct small_array::SmallArrayVisitor & __self_rename_at_335, smart_ptr_raw<ExprFor> const  __expr_rename_at_335 );
+inline smart_ptr_raw<Expression> _FuncSmallArrayVisitor_0x60_visitExprForSource_27fb29941ddf4889 ( Context * __context__, struct small_array::SmallArrayVisitor & __self_rename_at_340, smart_ptr_raw<ExprFor> const  __expr_rename_at_340, smart_ptr_raw<Expression> const  __source_rename_at_340, bool __last_rename_at_340 );
+inline void __setup_macros_d1164b64f39526d ( Context * __context__ );
+inline void add_argument_a02bcfb2a1bd4f5c ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_157, char * const  __name_rename_at_157, smart_ptr_raw<TypeDecl> __typ_rename_at_157, LineInfo const  & __at_rename_at_157 );
+inline void _Funcast_boost_0x60_add_new_infer_macro_2bd10b7b3ddde394 ( Context * __context__, char * const  __name_rename_at_144, struct small_array::SmallArrayRewriteMacro * const  __someClassPtr_rename_at_144 );
+inline void _Funcast_0x60_add_new_structure_annotation_19698c26d50220e8 ( Context * __context__, char * const  __name_rename_at_503, struct small_array::SmallArrayMacro * const  __someClassPtr_rename_at_503 );
+inline smart_ptr_raw<PassMacro> _Funcast_0x60_make_pass_macro_1a154690555938dc ( Context * __context__, char * const  __name_rename_at_481, struct small_array::SmallArrayRewriteMacro * const  __someClassPtr_rename_at_481 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_2795f4f0f39c62fd ( Context * __context__, char * const  __name_rename_at_447, struct small_array::SmallArrayMacro * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_cad73f592196793d ( Context * __context__, struct small_array::SmallArrayVisitor const  & __someClass_rename_at_455 );
+inline Expression * _Funcbuiltin_0x60_get_ptr_98dd15e167848d85 ( Context * __context__, smart_ptr<Expression> const  __src_rename_at_701 );
+inline Structure * _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9 ( Context * __context__, smart_ptr_raw<Structure> const  __src_rename_at_701 );
+inline bool _Funcbuiltin_0x60_key_exists_ab1bd808c5cad437 ( Context * __context__, TTable<char *,char *> const  & __Tab_rename_at_183, char * const  __at_rename_at_183 );
+inline void finalize_203784ab4ad934d7 ( Context * __context__, struct small_array::SmallArrayVisitor * & ____this_rename_at_358 );
+inline void finalize_f319d906d7e4b472 ( Context * __context__, struct small_array::SmallArrayMacro & ____this_rename_at_231 );
+inline void finalize_200515370e8a956a ( Context * __context__, struct small_array::SmallArrayRewriteMacro & ____this_rename_at_350 );
+inline void finalize_d656f1ddb3d7915c ( Context * __context__, struct small_array::SmallArrayVisitor & ____this_rename_at_324 );
+inline void generate_functions_57eef079893501a2 ( Context * __context__, Structure * const  __st_rename_at_186, char * const  __storage_rename_at_186, smart_ptr_raw<TypeDecl> const  __etype_rename_at_186, LineInfo const  & __at_rename_at_186 );
+inline bool is_simple_path_9c52711d311a7e94 ( Context * __context__, Expression * const  __expr_rename_at_125 );
+inline bool is_small_array_type_a765e70bd10aca67 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __typ_rename_at_118 );
+inline bool is_split_loop_6a3ec0c01a434b36 ( Context * __context__, smart_ptr_raw<ExprFor> const  __expr_rename_at_319 );
+inline smart_ptr_raw<Expression> make_block_129fb94c306a5be ( Context * __context__, smart_ptr_raw<Expression> __expr_rename_at_277, LineInfo const  & __at_rename_at_277 );
+inline smart_ptr_raw<Expression> make_field_bcfe86351493a221 ( Context * __context__, char * const  __name_rename_at_138, char * const  __field_rename_at_138, LineInfo const  & __at_rename_at_138 );
+inline smart_ptr_raw<Function> make_function_a788106be33a3536 ( Context * __context__, char * const  __name_rename_at_149, Structure * const  __st_rename_at_149, bool __isConst_rename_at_149, LineInfo const  & __at_rename_at_149 );
+inline smart_ptr_raw<Expression> make_helper_call_be933f6a1e7213af ( Context * __context__, char * const  __storage_rename_at_162, char * const  __name_rename_at_162, char * const  __arg_rename_at_162, LineInfo const  & __at_rename_at_162 );
+inline smart_ptr_raw<Expression> make_loop_a58f6ffef93403a8 ( Context * __context__, smart_ptr_raw<ExprFor> const  __expr_rename_at_267, char * const  __name_rename_at_267, smart_ptr_raw<Expression> __src_rename_at_267, smart_ptr_raw<Expression> __body_rename_at_267 );
+inline smart_ptr_raw<Expression> make_split_loop_e0a4be20d7cf1f0e ( Context * __context__, smart_ptr_raw<ExprFor> const  __expr_rename_at_294, char * const  __storage_rename_at_294 );
+inline smart_ptr_raw<Expression> make_var_a6a6672e3646a9d ( Context * __context__, char * const  __name_rename_at_134, LineInfo const  & __at_rename_at_134 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_4ee6558e772261e9 ( Context * __context__, struct small_array::SmallArrayMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_e1948b3e85d382d1 ( Context * __context__, struct small_array::SmallArrayRewriteMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_abfc16c1825d18cb ( Context * __context__, struct small_array::SmallArrayVisitor const  & __cl_rename_at_88 );
+inline void set_body_7ea9188cf2e4f110 ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_173, smart_ptr_raw<Expression> __expr_rename_at_173, bool __isReturn_rename_at_173, LineInfo const  & __at_rename_at_173 );
+inline char * small_array_key_4dc0a8b2750d6e9d ( Context * __context__, Structure * const  __st_rename_at_114 );
+inline smart_ptr_raw<Expression> source_field_250aae62ce81233c ( Context * __context__, smart_ptr_raw<ExprFor> const  __expr_rename_at_283, char * const  __name_rename_at_283 );
+inline smart_ptr_raw<TypeDecl> struct_type_b1bb452182a2b9c7 ( Context * __context__, Structure * const  __st_rename_at_142, bool __isConst_rename_at_142 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TTable<char *,char *>,0>(__context__);/*smallArrayStructures*/
+	das_global<int32_t,48>(__context__) = 0;/*smallArrayLoopCounter*/
+	__setup_macros_d1164b64f39526d(__context__);
+}
+
+inline struct small_array::SmallArrayMacro SmallArrayMacro_7e2c51ea58ff6abd ( Context * __context__ )
+{
+	return (([&]() -> struct small_array::SmallArrayMacro {
+		struct small_array::SmallArrayMacro __mks_231;
+		das_zero(__mks_231);
+		das_copy((__mks_231.__rtti),(((void *)(&__type_info__d9283a27))));
+		das_copy((__mks_231.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@small_array::SmallArrayMacro'__finalize SmallArrayMacro*/ 3581798693u)))));
+		das_copy((__mks_231.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@small_array::SmallArrayMacro`apply SmallArrayMacro #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 1985335176u)))));
+		return __mks_231;
+	})());
+}
+
+inline void _FuncSmallArrayMacro_0x27___finalize_9a83f9eac10b8035 ( Context * __context__, struct small_array::SmallArrayMacro &  __self_rename_at_231 )
+{
+	finalize_f319d906d7e4b472(__context__,das_arg<struct small_array::SmallArrayMacro>::pass(__self_rename_at_231));
+}
+
+inline bool _FuncSmallArrayMacro_0x60_apply_b3884cb9241b9cc4 ( Context * __context__, struct small_array::SmallArrayMacro &  __self_rename_at_232, smart_ptr_raw<Structure> __st_rename_at_232, ModuleGroup &  __group_rename_at_232, AnnotationArgumentList const  &  __args_rename_at_232, das::string &  __errors_rename_at_232 )
+{
+	if ( das_get_bitfield(__st_rename_at_232->flags /*flags*/,1u << 0) )
+	{
+		set_das_string(das_arg<das::string>::pass(__errors_rename_at_232),((char *) "small_array can't be applied to a class"));
+		return false;
+	} else {
+		char * __storage_rename_at_236 = (char *)(((char *) ""));
+		smart_ptr_raw<TypeDecl> __etype_rename_at_237; das_zero(__etype_rename_at_237);
+		{
+			bool __need_loop_238 = true;
+			// fld : ast::FieldDeclaration&
+			das_iterator<das::vector<Structure::FieldDeclaration>> __fld_iterator(__st_rename_at_232->fields /*fields*/);
+			Structure::FieldDeclaration * __fld_rename_at_238;
+			__need_loop_238 = __fld_iterator.first(__context__,(__fld_rename_at_238)) && __need_loop_238;
+			for ( ; __need_loop_238 ; __need_loop_238 = __fld_iterator.next(__context__,(__fld_rename_at_238)) )
+			{
+				if ( (*__fld_rename_at_238).type /*_type*/->dim /*dim*/.size() /*length*/ == 1 )
+				{
+					das_copy(__storage_rename_at_236,((char *)(to_das_string(das_arg<das::string>::pass((*__fld_rename_at_238).name /*name*/),__context__))));
+					smart_ptr<TypeDecl> __typ_rename_at_241; das_zero(__typ_rename_at_241); das_move(__typ_rename_at_241, clone_type((*__fld_rename_at_238).type /*_type*/));
+					das_move(__etype_rename_at_237,__typ_rename_at_241);
+				};
+			}
+			__fld_iterator.close(__context__,(__fld_rename_at_238));
+		};
+		if ( (__st_rename_at_232->fields /*fields*/.size() /*length*/ != 1) || (SimPolicy<char *>::Equ(cast<char *>::from(__storage_rename_at_236),cast<char *>::from(((char *) "")),*__context__)) )
+		{
+			set_das_string(das_arg<das::string>::pass(__errors_rename_at_232),((char *) "small_array structure needs exactly one field, which is the inline storage, i.e. items : int[4]"));
+			return false;
+		} else {
+			das_vector_clear(das_arg<das::vector<int32_t>>::pass(__etype_rename_at_237->dim /*dim*/));
+			das_vector_clear(das_arg<das::vector<smart_ptr<Expression>>>::pass(__etype_rename_at_237->dimExpr /*dimExpr*/));
+			LineInfo __at_rename_at_248 = (LineInfo)__st_rename_at_232->at /*at*/;
+			smart_ptr_raw<TypeDecl> __htype_rename_at_249; das_zero(__htype_rename_at_249); das_move(__htype_rename_at_249, das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_249) {
+				das_copy((__mks_249.at /*at*/),(__at_rename_at_248));
+				das_copy((__mks_249.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tArray));
+				das_move((__mks_249.firstType /*firstType*/),(clone_type(__etype_rename_at_237)));
+			}))));
+			das_vector_resize(das_arg<das::vector<Structure::FieldDeclaration>>::pass(__st_rename_at_232->fields /*fields*/),3);
+			int32_t __index_rename_at_251 = 0;
+			{
+				bool __need_loop_252 = true;
+				// fld : ast::FieldDeclaration&
+				das_iterator<das::vector<Structure::FieldDeclaration>> __fld_iterator(__st_rename_at_232->fields /*fields*/);
+				Structure::FieldDeclaration * __fld_rename_at_252;
+				__need_loop_252 = __fld_iterator.first(__context__,(__fld_rename_at_252)) && __need_loop_252;
+				for ( ; __need_loop_252 ; __need_loop_252 = __fld_iterator.next(__context__,(__fld_rename_at_252)) )
+				{
+					if ( __index_rename_at_251 == 1 )
+					{
+						set_das_string(das_arg<das::string>::pass((*__fld_rename_at_252).name /*name*/),((char *) "_count"));
+						das_copy((*__fld_rename_at_252).at /*at*/,__at_rename_at_248);
+						das_move((*__fld_rename_at_252).type /*_type*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_256) {
+							das_copy((__mks_256.at /*at*/),(__at_rename_at_248));
+							das_copy((__mks_256.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tInt));
+						}))));
+					} else if ( __index_rename_at_251 == 2 )
+					{
+						set_das_string(das_arg<das::string>::pass((*__fld_rename_at_252).name /*name*/),((char *) "_heap"));
+						das_copy((*__fld_rename_at_252).at /*at*/,__at_rename_at_248);
+						das_move((*__fld_rename_at_252).type /*_type*/,__htype_rename_at_249);
+					};
+					__index_rename_at_251++;
+				}
+				__fld_iterator.close(__context__,(__fld_rename_at_252));
+			};
+			das_copy(das_global<TTable<char *,char *>,0>(__context__) /*smallArrayStructures*/(small_array_key_4dc0a8b2750d6e9d(__context__,_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9(__context__,__st_rename_at_232)),__context__),__storage_rename_at_236);
+			generate_functions_57eef079893501a2(__context__,_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9(__context__,__st_rename_at_232),__storage_rename_at_236,__etype_rename_at_237,__at_rename_at_248);
+			return true;
+		};
+	};
+}
+
+inline struct small_array::SmallArrayRewriteMacro SmallArrayRewriteMacro_3cd2e5502eab1df6 ( Context * __context__ )
+{
+	return (([&]() -> struct small_array::SmallArrayRewriteMacro {
+		struct small_array::SmallArrayRewriteMacro __mks_350;
+		das_copy((__mks_350.__rtti),(((void *)(&__type_info__7454c789))));
+		das_copy((__mks_350.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstPassMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@small_array::SmallArrayRewriteMacro'__finalize SmallArrayRewriteMacro*/ 1132765407u)))));
+		das_copy((__mks_350.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const ))>::cast(Func(__context__->fnIdxByMangledName(/*@small_array::SmallArrayRewriteMacro`apply SmallArrayRewriteMacro #smart_ptr##handle#Program#const #ptr##handle#Module#const*/ 1461805598u)))));
+		return __mks_350;
+	})());
+}
+
+inline void _FuncSmallArrayRewriteMacro_0x27___finalize_deae09e19dbdbb2d ( Context * __context__, struct small_array::SmallArrayRewriteMacro &  __self_rename_at_350 )
+{
+	finalize_200515370e8a956a(__context__,das_arg<struct small_array::SmallArrayRewriteMacro>::pass(__self_rename_at_350));
+}
+
+inline bool _FuncSmallArrayRewriteMacro_0x60_apply_e36bd1b518dc89ba ( Context * __context__, struct small_array::SmallArrayRewriteMacro &  __self_rename_at_351, smart_ptr_raw<Program> const  __prog_rename_at_351, Module * const  __mod_rename_at_351 )
+{
+	struct small_array::SmallArrayVisitor * __astVisitor_rename_at_352 = das_new<struct small_array::SmallArrayVisitor>::make_and_init(__context__,[&]() { return SmallArrayVisitor_21869b7bda84dc08(__context__); });
+	smart_ptr_raw<VisitorAdapter> __astVisitorAdapter_rename_at_353; das_zero(__astVisitorAdapter_rename_at_353); das_move(__astVisitorAdapter_rename_at_353, _Funcast_0x60_make_visitor_cad73f592196793d(__context__,das_arg<struct small_array::SmallArrayVisitor>::pass(das_deref(__context__,__astVisitor_rename_at_352))));
+	astVisit(__prog_rename_at_351,__astVisitorAdapter_rename_at_353);
+	bool __changed_rename_at_355 = (bool)__astVisitor_rename_at_352->changed;
+	das_delete_handle<smart_ptr_raw<VisitorAdapter>>::clear(__context__,__astVisitorAdapter_rename_at_353);
+	finalize_203784ab4ad934d7(__context__,__astVisitor_rename_at_352);
+	return __changed_rename_at_355;
+}
+
+inline struct small_array::SmallArrayVisitor SmallArrayVisitor_21869b7bda84dc08 ( Context * __context__ )
+{
+	return (([&]() -> struct small_array::SmallArrayVisitor {
+		struct small_array::SmallArrayVisitor __mks_324;
+		das_zero(__mks_324);
+		das_copy((__mks_324.__rtti),(((void *)(&__type_info__4ca379ed))));
+		das_copy((__mks_324.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstVisitor))>::cast(Func(__context__->fnIdxByMangledName(/*@small_array::SmallArrayVisitor'__finalize SmallArrayVisitor*/ 3225518837u)))));
+		das_copy((__mks_324.visitExprAt),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@small_array::SmallArrayVisitor`visitExprAt SmallArrayVisitor #smart_ptr##handle#ExprAt#const*/ 3558137371u)))));
+		das_copy((__mks_324.visitExprFor),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@small_array::SmallArrayVisitor`visitExprFor SmallArrayVisitor #smart_ptr##handle#ExprFor#const*/ 3468286027u)))));
+		das_copy((__mks_324.visitExprForSource),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool))>::cast(Func(__context__->fnIdxByMangledName(/*@small_array::SmallArrayVisitor`visitExprForSource SmallArrayVisitor #smart_ptr##handle#ExprFor#const #smart_ptr##handle#Expression#const bool#const*/ 1462264258u)))));
+		das_copy((__mks_324.changed),(false));
+		return __mks_324;
+	})());
+}
+
+inline void _FuncSmallArrayVisitor_0x27___finalize_28498398044e4e65 ( Context * __context__, struct small_array::SmallArrayVisitor &  __self_rename_at_324 )
+{
+	finalize_d656f1ddb3d7915c(__context__,das_arg<struct small_array::SmallArrayVisitor>::pass(__self_rename_at_324));
+}
+
+inline smart_ptr_raw<Expression> _FuncSmallArrayVisitor_0x60_visitExprAt_5fc9d9623c00854a ( Context * __context__, struct small_array::SmallArrayVisitor &  __self_rename_at_326, smart_ptr_raw<ExprAt> const  __expr_rename_at_326 ) { das_stack_prologue __prologue(__context__,144,"SmallArrayVisitor`visitExprAt " DAS_FILE_LINE);
+{
+	if ( !is_small_array_type_a765e70bd10aca67(__context__,__expr_rename_at_326->subexpr /*subexpr*/->type /*_type*/) )
+	{
+		return __expr_rename_at_326;
+	} else {
+		das_copy(__self_rename_at_326.changed,true);
+		char * __name_rename_at_330 = (char *)(char *)((das_get_bitfield(__expr_rename_at_326->subexpr /*subexpr*/->type /*_type*/->flags /*flags*/,1u << 1) ? (((char *) "small_array_at_const")) : (((char *) "small_array_at"))));
+		smart_ptr_raw<ExprCall> __call_rename_at_331; das_zero(__call_rename_at_331); das_move(__call_rename_at_331, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_331) {
+			das_copy((__mks_331.at /*at*/),(__expr_rename_at_326->at /*at*/));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_331.name /*name*/),__name_rename_at_330);
+			}		}))));
+		das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_331->arguments /*arguments*/),clone_expression(__expr_rename_at_326->subexpr /*subexpr*/));
+		das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_331->arguments /*arguments*/),clone_expression(__expr_rename_at_326->index /*index*/));
+		return /* <- */ __call_rename_at_331;
+	};
+}}
+
+inline smart_ptr_raw<Expression> _FuncSmallArrayVisitor_0x60_visitExprFor_55aac27bc6ceb7e2 ( Context * __context__, struct small_array::SmallArrayVisitor &  __self_rename_at_335, smart_ptr_raw<ExprFor> const  __expr_rename_at_335 )
+{
+	if ( !is_split_loop_6a3ec0c01a434b36(__context__,__expr_rename_at_335) )
+	{
+		return __expr_rename_at_335;
+	} else {
+		das_copy(__self_rename_at_335.changed,true);
+		return /* <- */ make_split_loop_e0a4be20d7cf1f0e(__context__,__expr_rename_at_335,das_global<TTable<char *,char *>,0>(__context__) /*smallArrayStructures*/(small_array_key_4dc0a8b2750d6e9d(__context__,das_index<das::vector<smart_ptr<Expression>> const >::at(__expr_rename_at_335->sources /*sources*/,0,__context__)->type /*_type*/->structType /*structType*/),__context__));
+	};
+}
+
+inline smart_ptr_raw<Expression> _FuncSmallArrayVisitor_0x60_visitExprForSource_27fb29941ddf4889 ( Context * __context__, struct small_array::SmallArrayVisitor &  __self_rename_at_340, smart_ptr_raw<ExprFor> const  __expr_rename_at_340, smart_ptr_raw<Expression> const  __source_rename_at_340, bool __last_rename_at_340 ) { das_stack_prologue __prologue(__context__,128,"SmallArrayVisitor`visitExprForSource " DAS_FILE_LINE);
+{
+	if ( !(is_small_array_type_a765e70bd10aca67(__context__,__source_rename_at_340->type /*_type*/)) || is_split_loop_6a3ec0c01a434b36(__context__,__expr_rename_at_340) )
+	{
+		return __source_rename_at_340;
+	} else {
+		das_copy(__self_rename_at_340.changed,true);
+		smart_ptr_raw<ExprCall> __call_rename_at_344; das_zero(__call_rename_at_344); das_move(__call_rename_at_344, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_344) {
+			das_copy((__mks_344.at /*at*/),(__source_rename_at_340->at /*at*/));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_344.name /*name*/),((char *) "each"));
+			}		}))));
+		__call_rename_at_344->genFlags /*genFlags*/ |= 0x1u;
+		das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_344->arguments /*arguments*/),clone_expression(__source_rename_at_340));
+		return /* <- */ __call_rename_at_344;
+	};
+}}
+
+inline void __setup_macros_d1164b64f39526d ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "small_array"),__context__) )
+	{
+		_Funcast_0x60_add_new_structure_annotation_19698c26d50220e8(__context__,((char *) "small_array"),das_new<struct small_array::SmallArrayMacro>::make_and_init(__context__,[&]() { return SmallArrayMacro_7e2c51ea58ff6abd(__context__); }));
+		_Funcast_boost_0x60_add_new_infer_macro_2bd10b7b3ddde394(__context__,((char *) "small_array_rewrite"),das_new<struct small_array::SmallArrayRewriteMacro>::make_and_init(__context__,[&]() { return SmallArrayRewriteMacro_3cd2e5502eab1df6(__context__); }));
+	};
+}
+
+inline void add_argument_a02bcfb2a1bd4f5c ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_157, char * const  __name_rename_at_157, smart_ptr_raw<TypeDecl> __typ_rename_at_157, LineInfo const  &  __at_rename_at_157 ) { das_stack_prologue __prologue(__context__,112,"add_argument " DAS_FILE_LINE);
+{
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Variable>>>::pass(__fn_rename_at_157->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_158) {
+		das_copy((__mks_158.at /*at*/),(__at_rename_at_157));
+		das_move((__mks_158.type /*_type*/),(__typ_rename_at_157));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_158.name /*name*/),__name_rename_at_157);
+		}	}))));
+}}
+
+inline void _Funcast_boost_0x60_add_new_infer_macro_2bd10b7b3ddde394 ( Context * __context__, char * const  __name_rename_at_144, struct small_array::SmallArrayRewriteMacro * const  __someClassPtr_rename_at_144 )
+{
+	smart_ptr_raw<PassMacro> __ann_rename_at_145; das_zero(__ann_rename_at_145); das_move(__ann_rename_at_145, _Funcast_0x60_make_pass_macro_1a154690555938dc(__context__,__name_rename_at_144,__someClassPtr_rename_at_144));
+	addModuleInferDirtyMacro(thisModule(__context__,nullptr),__ann_rename_at_145,__context__);
+	das_delete_handle<smart_ptr_raw<PassMacro>>::clear(__context__,__ann_rename_at_145);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_19698c26d50220e8 ( Context * __context__, char * const  __name_rename_at_503, struct small_array::SmallArrayMacro * const  __someClassPtr_rename_at_503 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_504; das_zero(__ann_rename_at_504); das_move(__ann_rename_at_504, _Funcast_0x60_make_structure_annotation_2795f4f0f39c62fd(__context__,__name_rename_at_503,__someClassPtr_rename_at_503));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_504,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_504);
+}
+
+inline smart_ptr_raw<PassMacro> _Funcast_0x60_make_pass_macro_1a154690555938dc ( Context * __context__, char * const  __name_rename_at_481, struct small_array::SmallArrayRewriteMacro * const  __someClassPtr_rename_at_481 )
+{
+	StructInfo const  * __classInfo_rename_at_483 = (StructInfo const  *)_Funcrtti_0x60_class_info_e1948b3e85d382d1(__context__,das_deref(__context__,__someClassPtr_rename_at_481));
+	return makePassMacro(__name_rename_at_481,__someClassPtr_rename_at_481,__classInfo_rename_at_483,__context__);
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_2795f4f0f39c62fd ( Context * __context__, char * const  __name_rename_at_447, struct small_array::SmallArrayMacro * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = (StructInfo const  *)_Funcrtti_0x60_class_info_4ee6558e772261e9(__context__,das_deref(__context__,__someClassPtr_rename_at_447));
+	return makeStructureAnnotation(__name_rename_at_447,__someClassPtr_rename_at_447,__classInfo_rename_at_449,__context__);
+}
+
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_cad73f592196793d ( Context * __context__, struct small_array::SmallArrayVisitor const  &  __someClass_rename_at_455 )
+{
+	struct small_array::SmallArrayVisitor const  * __classPtr_rename_at_458 = (struct small_array::SmallArrayVisitor const  *)das_ref(__context__,__someClass_rename_at_455);
+	StructInfo const  * __classInfo_rename_at_459 = (StructInfo const  *)_Funcrtti_0x60_class_info_abfc16c1825d18cb(__context__,__someClass_rename_at_455);
+	return makeVisitor(__classPtr_rename_at_458,__classInfo_rename_at_459,__context__);
+}
+
+inline Expression * _Funcbuiltin_0x60_get_ptr_98dd15e167848d85 ( Context * __context__, smart_ptr<Expression> const  __src_rename_at_701 )
+{
+	return das_cast<Expression *>::cast(__src_rename_at_701);
+}
+
+inline Structure * _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9 ( Context * __context__, smart_ptr_raw<Structure> const  __src_rename_at_701 )
+{
+	return das_cast<Structure *>::cast(__src_rename_at_701);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_ab1bd808c5cad437 ( Context * __context__, TTable<char *,char *> const  &  __Tab_rename_at_183, char * const  __at_rename_at_183 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_183,__at_rename_at_183);
+}
+
+inline void finalize_203784ab4ad934d7 ( Context * __context__, struct small_array::SmallArrayVisitor * & ____this_rename_at_358 )
+{
+	if ( ____this_rename_at_358 != nullptr )
+	{
+		das_invoke_function<void>::invoke<struct ast::AstVisitor &>(__context__,____this_rename_at_358->__finalize,das_arg<struct ast::AstVisitor>::pass(das_cast<struct ast::AstVisitor>::cast(das_deref(__context__,____this_rename_at_358))));
+		das_delete<struct small_array::SmallArrayVisitor *>::clear(__context__,____this_rename_at_358);
+		das_copy(____this_rename_at_358,nullptr);
+	};
+}
+
+inline void finalize_f319d906d7e4b472 ( Context * __context__, struct small_array::SmallArrayMacro &  ____this_rename_at_231 )
+{
+	memset(&(____this_rename_at_231), 0, 24);
+}
+
+inline void finalize_200515370e8a956a ( Context * __context__, struct small_array::SmallArrayRewriteMacro &  ____this_rename_at_350 )
+{
+	memset(&(____this_rename_at_350), 0, 16);
+}
+
+inline void finalize_d656f1ddb3d7915c ( Context * __context__, struct small_array::SmallArrayVisitor &  ____this_rename_at_324 )
+{
+	memset(&(____this_rename_at_324), 0, 1088);
+}
+
+inline void generate_functions_57eef079893501a2 ( Context * __context__, Structure * const  __st_rename_at_186, char * const  __storage_rename_at_186, smart_ptr_raw<TypeDecl> const  __etype_rename_at_186, LineInfo const  &  __at_rename_at_186 )
+{
+	TDim<bool,2> _temp_make_local_218_192;
+	smart_ptr_raw<Function> __flen_rename_at_188; das_zero(__flen_rename_at_188); das_move(__flen_rename_at_188, make_function_a788106be33a3536(__context__,((char *) "length"),__st_rename_at_186,true,__at_rename_at_186));
+	das_move(__flen_rename_at_188->result /*result*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_189) {
+		das_copy((__mks_189.at /*at*/),(__at_rename_at_186));
+		das_copy((__mks_189.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tInt));
+	}))));
+	set_body_7ea9188cf2e4f110(__context__,__flen_rename_at_188,make_field_bcfe86351493a221(__context__,((char *) "a"),((char *) "_count"),__at_rename_at_186),true,__at_rename_at_186);
+	addModuleFunction(compileModule(__context__),__flen_rename_at_188,__context__);
+	smart_ptr_raw<Function> __fpush_rename_at_193; das_zero(__fpush_rename_at_193); das_move(__fpush_rename_at_193, make_function_a788106be33a3536(__context__,((char *) "push"),__st_rename_at_186,false,__at_rename_at_186));
+	smart_ptr<TypeDecl> __vtype_rename_at_194; das_zero(__vtype_rename_at_194); das_move(__vtype_rename_at_194, clone_type(__etype_rename_at_186));
+	__vtype_rename_at_194->flags /*flags*/ |= 0x2u;
+	add_argument_a02bcfb2a1bd4f5c(__context__,__fpush_rename_at_193,((char *) "value"),__vtype_rename_at_194,__at_rename_at_186);
+	set_body_7ea9188cf2e4f110(__context__,__fpush_rename_at_193,make_helper_call_be933f6a1e7213af(__context__,__storage_rename_at_186,((char *) "small_array_push"),((char *) "value"),__at_rename_at_186),false,__at_rename_at_186);
+	addModuleFunction(compileModule(__context__),__fpush_rename_at_193,__context__);
+	smart_ptr_raw<Function> __ferase_rename_at_200; das_zero(__ferase_rename_at_200); das_move(__ferase_rename_at_200, make_function_a788106be33a3536(__context__,((char *) "erase"),__st_rename_at_186,false,__at_rename_at_186));
+	add_argument_a02bcfb2a1bd4f5c(__context__,__ferase_rename_at_200,((char *) "index"),das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_201) {
+		das_copy((__mks_201.at /*at*/),(__at_rename_at_186));
+		das_copy((__mks_201.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tInt));
+	}))),__at_rename_at_186);
+	set_body_7ea9188cf2e4f110(__context__,__ferase_rename_at_200,make_helper_call_be933f6a1e7213af(__context__,__storage_rename_at_186,((char *) "small_array_erase"),((char *) "index"),__at_rename_at_186),false,__at_rename_at_186);
+	addModuleFunction(compileModule(__context__),__ferase_rename_at_200,__context__);
+	smart_ptr_raw<Function> __fclear_rename_at_205; das_zero(__fclear_rename_at_205); das_move(__fclear_rename_at_205, make_function_a788106be33a3536(__context__,((char *) "clear"),__st_rename_at_186,false,__at_rename_at_186));
+	set_body_7ea9188cf2e4f110(__context__,__fclear_rename_at_205,make_helper_call_be933f6a1e7213af(__context__,__storage_rename_at_186,((char *) "small_array_clear"),((char *) ""),__at_rename_at_186),false,__at_rename_at_186);
+	addModuleFunction(compileModule(__context__),__fclear_rename_at_205,__context__);
+	smart_ptr_raw<Function> __feach_rename_at_209; das_zero(__feach_rename_at_209); das_move(__feach_rename_at_209, make_function_a788106be33a3536(__context__,((char *) "each"),__st_rename_at_186,false,__at_rename_at_186));
+	__feach_rename_at_209->flags /*flags*/ |= 0x4000u;
+	smart_ptr<TypeDecl> __itype_rename_at_211; das_zero(__itype_rename_at_211); das_move(__itype_rename_at_211, clone_type(__etype_rename_at_186));
+	__itype_rename_at_211->flags /*flags*/ |= 0x1u;
+	das_move(__feach_rename_at_209->result /*result*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_213) {
+		das_copy((__mks_213.at /*at*/),(__at_rename_at_186));
+		das_copy((__mks_213.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tIterator));
+		das_move((__mks_213.firstType /*firstType*/),(__itype_rename_at_211));
+	}))));
+	set_body_7ea9188cf2e4f110(__context__,__feach_rename_at_209,make_helper_call_be933f6a1e7213af(__context__,__storage_rename_at_186,((char *) "small_array_each"),((char *) ""),__at_rename_at_186),true,__at_rename_at_186);
+	addModuleFunction(compileModule(__context__),__feach_rename_at_209,__context__);
+	{
+		bool __need_loop_218 = true;
+		// isConst : bool&
+		das_iterator<TDim<bool,2>> __isConst_iterator((([&]() -> TDim<bool,2>& {
+			_temp_make_local_218_192(0,__context__) = false;
+			_temp_make_local_218_192(1,__context__) = true;
+			return _temp_make_local_218_192;
+		})()));
+		bool * __isConst_rename_at_218;
+		__need_loop_218 = __isConst_iterator.first(__context__,(__isConst_rename_at_218)) && __need_loop_218;
+		for ( ; __need_loop_218 ; __need_loop_218 = __isConst_iterator.next(__context__,(__isConst_rename_at_218)) )
+		{
+			char * __name_rename_at_219 = (char *)(char *)(((*__isConst_rename_at_218) ? (((char *) "small_array_at_const")) : (((char *) "small_array_at"))));
+			smart_ptr_raw<Function> __fat_rename_at_220; das_zero(__fat_rename_at_220); das_move(__fat_rename_at_220, make_function_a788106be33a3536(__context__,__name_rename_at_219,__st_rename_at_186,(*__isConst_rename_at_218),__at_rename_at_186));
+			add_argument_a02bcfb2a1bd4f5c(__context__,__fat_rename_at_220,((char *) "index"),das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_221) {
+				das_copy((__mks_221.at /*at*/),(__at_rename_at_186));
+				das_copy((__mks_221.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tInt));
+			}))),__at_rename_at_186);
+			smart_ptr<TypeDecl> __rtype_rename_at_222; das_zero(__rtype_rename_at_222); das_move(__rtype_rename_at_222, clone_type(__etype_rename_at_186));
+			__rtype_rename_at_222->flags /*flags*/ |= 0x1u;
+			if ( (*__isConst_rename_at_218) )
+			{
+				__rtype_rename_at_222->flags /*flags*/ |= 0x2u;
+			};
+			das_move(__fat_rename_at_220->result /*result*/,__rtype_rename_at_222);
+			set_body_7ea9188cf2e4f110(__context__,__fat_rename_at_220,make_helper_call_be933f6a1e7213af(__context__,__storage_rename_at_186,__name_rename_at_219,((char *) "index"),__at_rename_at_186),true,__at_rename_at_186);
+			addModuleFunction(compileModule(__context__),__fat_rename_at_220,__context__);
+		}
+		__isConst_iterator.close(__context__,(__isConst_rename_at_218));
+	};
+}
+
+inline bool is_simple_path_9c52711d311a7e94 ( Context * __context__, Expression * const  __expr_rename_at_125 )
+{
+	return (SimPolicy<char *>::Equ(cast<char *>::from(__expr_rename_at_125->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprVar")),*__context__)) ? (true) : (((SimPolicy<char *>::Equ(cast<char *>::from(__expr_rename_at_125->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprField")),*__context__)) ? (is_simple_path_9c52711d311a7e94(__context__,_Funcbuiltin_0x60_get_ptr_98dd15e167848d85(__context__,das_cast<ExprField *>::cast(__expr_rename_at_125)->value /*value*/))) : (false)));
+}
+
+inline bool is_small_array_type_a765e70bd10aca67 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __typ_rename_at_118 )
+{
+	return ((((equ_sptr_ptr(__typ_rename_at_118,nullptr)) || (__typ_rename_at_118->baseType /*baseType*/ != DAS_COMMENT(bound_enum) das::Type::tStructure)) || (__typ_rename_at_118->dim /*dim*/.size() /*length*/ != 0)) || (__typ_rename_at_118->structType /*structType*/ == nullptr)) ? (false) : (_Funcbuiltin_0x60_key_exists_ab1bd808c5cad437(__context__,das_arg<TTable<char *,char *>>::pass(das_global<TTable<char *,char *>,0>(__context__) /*smallArrayStructures*/),small_array_key_4dc0a8b2750d6e9d(__context__,__typ_rename_at_118->structType /*structType*/)));
+}
+
+inline bool is_split_loop_6a3ec0c01a434b36 ( Context * __context__, smart_ptr_raw<ExprFor> const  __expr_rename_at_319 )
+{
+	return ((__expr_rename_at_319->sources /*sources*/.size() /*length*/ == 1) && is_small_array_type_a765e70bd10aca67(__context__,das_index<das::vector<smart_ptr<Expression>> const >::at(__expr_rename_at_319->sources /*sources*/,0,__context__)->type /*_type*/)) && is_simple_path_9c52711d311a7e94(__context__,_Funcbuiltin_0x60_get_ptr_98dd15e167848d85(__context__,das_index<das::vector<smart_ptr<Expression>> const >::at(__expr_rename_at_319->sources /*sources*/,0,__context__)));
+}
+
+inline smart_ptr_raw<Expression> make_block_129fb94c306a5be ( Context * __context__, smart_ptr_raw<Expression> __expr_rename_at_277, LineInfo const  &  __at_rename_at_277 )
+{
+	smart_ptr_raw<ExprBlock> __blk_rename_at_278; das_zero(__blk_rename_at_278); das_move(__blk_rename_at_278, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_278) {
+		das_copy((__mks_278.at /*at*/),(__at_rename_at_277));
+	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_278->list /*list*/),__expr_rename_at_277);
+	return /* <- */ __blk_rename_at_278;
+}
+
+inline smart_ptr_raw<Expression> make_field_bcfe86351493a221 ( Context * __context__, char * const  __name_rename_at_138, char * const  __field_rename_at_138, LineInfo const  &  __at_rename_at_138 ) { das_stack_prologue __prologue(__context__,112,"make_field " DAS_FILE_LINE);
+{
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_139) {
+		das_copy((__mks_139.at /*at*/),(__at_rename_at_138));
+		das_move((__mks_139.value /*value*/),(make_var_a6a6672e3646a9d(__context__,__name_rename_at_138,__at_rename_at_138)));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_139.name /*name*/),__field_rename_at_138);
+		}	})));
+}}
+
+inline smart_ptr_raw<Function> make_function_a788106be33a3536 ( Context * __context__, char * const  __name_rename_at_149, Structure * const  __st_rename_at_149, bool __isConst_rename_at_149, LineInfo const  &  __at_rename_at_149 ) { das_stack_prologue __prologue(__context__,224,"make_function " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __fn_rename_at_150; das_zero(__fn_rename_at_150); das_move(__fn_rename_at_150, das_ascend_handle<true,smart_ptr_raw<Function>>::make(__context__,nullptr,(([&](Function & __mks_150) {
+		das_copy((__mks_150.at /*at*/),(__at_rename_at_149));
+		das_copy((__mks_150.atDecl /*atDecl*/),(__at_rename_at_149));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_150.name /*name*/),__name_rename_at_149);
+		}	}))));
+	__fn_rename_at_150->flags /*flags*/ |= 0x200000u;
+	das_move(__fn_rename_at_150->result /*result*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_152) {
+		das_copy((__mks_152.at /*at*/),(__at_rename_at_149));
+		das_copy((__mks_152.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tVoid));
+	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Variable>>>::pass(__fn_rename_at_150->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_153) {
+		das_copy((__mks_153.at /*at*/),(__at_rename_at_149));
+		das_move((__mks_153.type /*_type*/),(struct_type_b1bb452182a2b9c7(__context__,__st_rename_at_149,__isConst_rename_at_149)));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_153.name /*name*/),((char *) "a"));
+		}	}))));
+	return /* <- */ __fn_rename_at_150;
+}}
+
+inline smart_ptr_raw<Expression> make_helper_call_be933f6a1e7213af ( Context * __context__, char * const  __storage_rename_at_162, char * const  __name_rename_at_162, char * const  __arg_rename_at_162, LineInfo const  &  __at_rename_at_162 ) { das_stack_prologue __prologue(__context__,128,"make_helper_call " DAS_FILE_LINE);
+{
+	smart_ptr_raw<ExprCall> __call_rename_at_163; das_zero(__call_rename_at_163); das_move(__call_rename_at_163, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_163) {
+		das_copy((__mks_163.at /*at*/),(__at_rename_at_162));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_163.name /*name*/),__name_rename_at_162);
+		}	}))));
+	__call_rename_at_163->genFlags /*genFlags*/ |= 0x1u;
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_163->arguments /*arguments*/),make_field_bcfe86351493a221(__context__,((char *) "a"),__storage_rename_at_162,__at_rename_at_162));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_163->arguments /*arguments*/),make_field_bcfe86351493a221(__context__,((char *) "a"),((char *) "_count"),__at_rename_at_162));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_163->arguments /*arguments*/),make_field_bcfe86351493a221(__context__,((char *) "a"),((char *) "_heap"),__at_rename_at_162));
+	if ( SimPolicy<char *>::NotEqu(cast<char *>::from(__arg_rename_at_162),cast<char *>::from(((char *) "")),*__context__) )
+	{
+		das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_163->arguments /*arguments*/),make_var_a6a6672e3646a9d(__context__,__arg_rename_at_162,__at_rename_at_162));
+	};
+	return /* <- */ __call_rename_at_163;
+}}
+
+inline smart_ptr_raw<Expression> make_loop_a58f6ffef93403a8 ( Context * __context__, smart_ptr_raw<ExprFor> const  __expr_rename_at_267, char * const  __name_rename_at_267, smart_ptr_raw<Expression> __src_rename_at_267, smart_ptr_raw<Expression> __body_rename_at_267 )
+{
+	smart_ptr_raw<ExprFor> __loop_rename_at_268; das_zero(__loop_rename_at_268); das_move(__loop_rename_at_268, das_ascend_handle<true,smart_ptr_raw<ExprFor>>::make(__context__,nullptr,(([&](ExprFor & __mks_268) {
+		das_copy((__mks_268.at /*at*/),(__expr_rename_at_267->at /*at*/));
+		das_copy((__mks_268.visibility /*visibility*/),(__expr_rename_at_267->visibility /*visibility*/));
+	}))));
+	das_vector_resize(das_arg<das::vector<das::string>>::pass(__loop_rename_at_268->iterators /*iterators*/),1);
+	set_das_string(das_arg<das::string>::pass(das_index<das::vector<das::string>>::at(__loop_rename_at_268->iterators /*iterators*/,0,__context__)),__name_rename_at_267);
+	das_vector_push(das_arg<das::vector<LineInfo>>::pass(__loop_rename_at_268->iteratorsAt /*iteratorsAt*/),das_index<das::vector<LineInfo> const >::at(__expr_rename_at_267->iteratorsAt /*iteratorsAt*/,0,__context__));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__loop_rename_at_268->sources /*sources*/),__src_rename_at_267);
+	das_move(__loop_rename_at_268->body /*body*/,__body_rename_at_267);
+	return /* <- */ __loop_rename_at_268;
+}
+
+inline smart_ptr_raw<Expression> make_split_loop_e0a4be20d7cf1f0e ( Context * __context__, smart_ptr_raw<ExprFor> const  __expr_rename_at_294, char * const  __storage_rename_at_294 ) { das_stack_prologue __prologue(__context__,672,"make_split_loop " DAS_FILE_LINE);
+{
+	LineInfo __at_rename_at_295 = (LineInfo)__expr_rename_at_294->at /*at*/;
+	char * __name_rename_at_296 = (char *)(char *)(((char *)(to_das_string(das_index<das::vector<das::string> const >::at(__expr_rename_at_294->iterators /*iterators*/,0,__context__),__context__))));
+	smart_ptr_raw<Expression> __heapLoop_rename_at_297; das_zero(__heapLoop_rename_at_297); das_move(__heapLoop_rename_at_297, make_loop_a58f6ffef93403a8(__context__,__expr_rename_at_294,__name_rename_at_296,source_field_250aae62ce81233c(__context__,__expr_rename_at_294,((char *) "_heap")),clone_expression(__expr_rename_at_294->body /*body*/)));
+	char * __index_rename_at_298 = (char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "__sa_index")), cast<int32_t>::from(das_global<int32_t,48>(__context__) /*smallArrayLoopCounter*/++))));
+	smart_ptr_raw<ExprCall> __rng_rename_at_299; das_zero(__rng_rename_at_299); das_move(__rng_rename_at_299, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_299) {
+		das_copy((__mks_299.at /*at*/),(__at_rename_at_295));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_299.name /*name*/),((char *) "range"));
+		}	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__rng_rename_at_299->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprConstInt>>::make(__context__,nullptr,(([&](ExprConstInt & __mks_300) {
+		das_copy((__mks_300.at /*at*/),(__at_rename_at_295));
+		das_copy((__mks_300.cvalue<int32_t>() /*value*/),(0));
+	})))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__rng_rename_at_299->arguments /*arguments*/),source_field_250aae62ce81233c(__context__,__expr_rename_at_294,((char *) "_count")));
+	smart_ptr_raw<ExprAt> __element_rename_at_302; das_zero(__element_rename_at_302); das_move(__element_rename_at_302, das_ascend_handle<true,smart_ptr_raw<ExprAt>>::make(__context__,nullptr,(([&](ExprAt & __mks_302) {
+		das_copy((__mks_302.at /*at*/),(__at_rename_at_295));
+		das_move((__mks_302.subexpr /*subexpr*/),(source_field_250aae62ce81233c(__context__,__expr_rename_at_294,__storage_rename_at_294)));
+		das_move((__mks_302.index /*index*/),(make_var_a6a6672e3646a9d(__context__,__index_rename_at_298,__at_rename_at_295)));
+	}))));
+	smart_ptr_raw<TypeDecl> __etype_rename_at_303; das_zero(__etype_rename_at_303); das_move(__etype_rename_at_303, das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_303) {
+		das_copy((__mks_303.at /*at*/),(__at_rename_at_295));
+		das_copy((__mks_303.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::autoinfer));
+	}))));
+	__etype_rename_at_303->flags /*flags*/ |= 0x1u;
+	if ( das_get_bitfield(das_index<das::vector<smart_ptr<Expression>> const >::at(__expr_rename_at_294->sources /*sources*/,0,__context__)->type /*_type*/->flags /*flags*/,1u << 1) )
+	{
+		__etype_rename_at_303->flags /*flags*/ |= 0x2u;
+	};
+	smart_ptr_raw<ExprLet> __vlet_rename_at_307; das_zero(__vlet_rename_at_307); das_move(__vlet_rename_at_307, das_ascend_handle<true,smart_ptr_raw<ExprLet>>::make(__context__,nullptr,(([&](ExprLet & __mks_307) {
+		das_copy((__mks_307.at /*at*/),(__at_rename_at_295));
+		das_copy((__mks_307.atInit /*atInit*/),(__at_rename_at_295));
+	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Variable>>>::pass(__vlet_rename_at_307->variables /*variables*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_308) {
+		das_copy((__mks_308.at /*at*/),(das_index<das::vector<LineInfo> const >::at(__expr_rename_at_294->iteratorsAt /*iteratorsAt*/,0,__context__)));
+		das_move((__mks_308.type /*_type*/),(__etype_rename_at_303));
+		das_move((__mks_308.init /*init*/),(__element_rename_at_302));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_308.name /*name*/),__name_rename_at_296);
+		}	}))));
+	smart_ptr_raw<ExprBlock> __inlineBody_rename_at_309; das_zero(__inlineBody_rename_at_309); das_move(__inlineBody_rename_at_309, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_309) {
+		das_copy((__mks_309.at /*at*/),(__at_rename_at_295));
+	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__inlineBody_rename_at_309->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__vlet_rename_at_307));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__inlineBody_rename_at_309->list /*list*/),clone_expression(__expr_rename_at_294->body /*body*/));
+	smart_ptr_raw<Expression> __inlineLoop_rename_at_312; das_zero(__inlineLoop_rename_at_312); das_move(__inlineLoop_rename_at_312, make_loop_a58f6ffef93403a8(__context__,__expr_rename_at_294,__index_rename_at_298,das_reinterpret<smart_ptr_raw<Expression>>::pass(__rng_rename_at_299),das_reinterpret<smart_ptr_raw<Expression>>::pass(__inlineBody_rename_at_309)));
+	smart_ptr_raw<ExprCall> __len_rename_at_313; das_zero(__len_rename_at_313); das_move(__len_rename_at_313, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_313) {
+		das_copy((__mks_313.at /*at*/),(__at_rename_at_295));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_313.name /*name*/),((char *) "length"));
+		}	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__len_rename_at_313->arguments /*arguments*/),source_field_250aae62ce81233c(__context__,__expr_rename_at_294,((char *) "_heap")));
+	smart_ptr_raw<ExprOp2> __cond_rename_at_315; das_zero(__cond_rename_at_315); das_move(__cond_rename_at_315, das_ascend_handle<true,smart_ptr_raw<ExprOp2>>::make(__context__,nullptr,(([&](ExprOp2 & __mks_315) {
+		das_copy((__mks_315.at /*at*/),(__at_rename_at_295));
+		das_move((__mks_315.left /*left*/),(__len_rename_at_313));
+		das_move((__mks_315.right /*right*/),(das_ascend_handle<true,smart_ptr_raw<ExprConstInt>>::make(__context__,nullptr,(([&](ExprConstInt & __mks_315) {
+			das_copy((__mks_315.at /*at*/),(__at_rename_at_295));
+			das_copy((__mks_315.cvalue<int32_t>() /*value*/),(0));
+		})))));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_315.op /*op*/),((char *) "!="));
+		}	}))));
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_316) {
+		das_copy((__mks_316.at /*at*/),(__at_rename_at_295));
+		das_move((__mks_316.cond /*cond*/),(__cond_rename_at_315));
+		das_move((__mks_316.if_true /*if_true*/),(make_block_129fb94c306a5be(__context__,__heapLoop_rename_at_297,__at_rename_at_295)));
+		das_move((__mks_316.if_false /*if_false*/),(make_block_129fb94c306a5be(__context__,__inlineLoop_rename_at_312,__at_rename_at_295)));
+	})));
+}}
+
+inline smart_ptr_raw<Expression> make_var_a6a6672e3646a9d ( Context * __context__, char * const  __name_rename_at_134, LineInfo const  &  __at_rename_at_134 ) { das_stack_prologue __prologue(__context__,112,"make_var " DAS_FILE_LINE);
+{
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_135) {
+		das_copy((__mks_135.at /*at*/),(__at_rename_at_134));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_135.name /*name*/),__name_rename_at_134);
+		}	})));
+}}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_4ee6558e772261e9 ( Context * __context__, struct small_array::SmallArrayMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_e1948b3e85d382d1 ( Context * __context__, struct small_array::SmallArrayRewriteMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_abfc16c1825d18cb ( Context * __context__, struct small_array::SmallArrayVisitor const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline void set_body_7ea9188cf2e4f110 ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_173, smart_ptr_raw<Expression> __expr_rename_at_173, bool __isReturn_rename_at_173, LineInfo const  &  __at_rename_at_173 )
+{
+	smart_ptr_raw<ExprBlock> __blk_rename_at_174; das_zero(__blk_rename_at_174); das_move(__blk_rename_at_174, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_174) {
+		das_copy((__mks_174.at /*at*/),(__at_rename_at_173));
+	}))));
+	if ( __isReturn_rename_at_173 )
+	{
+		smart_ptr_raw<ExprReturn> __ret_rename_at_176; das_zero(__ret_rename_at_176); das_move(__ret_rename_at_176, das_ascend_handle<true,smart_ptr_raw<ExprReturn>>::make(__context__,nullptr,(([&](ExprReturn & __mks_176) {
+			das_copy((__mks_176.at /*at*/),(__at_rename_at_173));
+			das_move((__mks_176.subexpr /*subexpr*/),(__expr_rename_at_173));
+		}))));
+		__ret_rename_at_176->genFlags /*genFlags*/ |= 0x1u;
+		if ( __fn_rename_at_173->result /*result*/->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tIterator )
+		{
+			__ret_rename_at_176->returnFlags /*returnFlags*/ |= 0x1u;
+		};
+		das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_174->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__ret_rename_at_176));
+	} else {
+		das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_174->list /*list*/),__expr_rename_at_173);
+	};
+	das_move(__fn_rename_at_173->body /*body*/,__blk_rename_at_174);
+}
+
+inline char * small_array_key_4dc0a8b2750d6e9d ( Context * __context__, Structure * const  __st_rename_at_114 )
+{
+	return das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((__st_rename_at_114->module /*_module*/ != nullptr) ? (((char *)(to_das_string(__st_rename_at_114->module /*_module*/->name /*name*/,__context__)))) : (((char *) "")))), cast<char * const >::from(((char *) "::")), cast<das::string const  &>::from(__st_rename_at_114->name /*name*/)));
+}
+
+inline smart_ptr_raw<Expression> source_field_250aae62ce81233c ( Context * __context__, smart_ptr_raw<ExprFor> const  __expr_rename_at_283, char * const  __name_rename_at_283 ) { das_stack_prologue __prologue(__context__,112,"source_field " DAS_FILE_LINE);
+{
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_284) {
+		das_copy((__mks_284.at /*at*/),(__expr_rename_at_283->at /*at*/));
+		das_move((__mks_284.value /*value*/),(clone_expression(das_index<das::vector<smart_ptr<Expression>> const >::at(__expr_rename_at_283->sources /*sources*/,0,__context__))));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_284.name /*name*/),__name_rename_at_283);
+		}	})));
+}}
+
+inline smart_ptr_raw<TypeDecl> struct_type_b1bb452182a2b9c7 ( Context * __context__, Structure * const  __st_rename_at_142, bool __isConst_rename_at_142 )
+{
+	smart_ptr_raw<TypeDecl> __typ_rename_at_143; das_zero(__typ_rename_at_143); das_move(__typ_rename_at_143, das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_143) {
+		das_copy((__mks_143.at /*at*/),(__st_rename_at_142->at /*at*/));
+		das_copy((__mks_143.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tStructure));
+		das_copy((__mks_143.structType /*structType*/),(__st_rename_at_142));
+	}))));
+	if ( __isConst_rename_at_142 )
+	{
+		__typ_rename_at_143->flags /*flags*/ |= 0x2u;
+	};
+	return /* <- */ __typ_rename_at_143;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// SmallArrayMacro_7e2c51ea58ff6abd
+		aotLib[0x5eddfd60f26b3e98] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct small_array::SmallArrayMacro (*) ( Context * __context__ ),&SmallArrayMacro_7e2c51ea58ff6abd>>();
+	};
+		// _FuncSmallArrayMacro_0x27___finalize_9a83f9eac10b8035
+		aotLib[0x4f62962c486a1bcb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct small_array::SmallArrayMacro &  ),&_FuncSmallArrayMacro_0x27___finalize_9a83f9eac10b8035>>();
+	};
+		// _FuncSmallArrayMacro_0x60_apply_b3884cb9241b9cc4
+		aotLib[0xc3bb5dc24ad0be24] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct small_array::SmallArrayMacro & , smart_ptr_raw<Structure> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncSmallArrayMacro_0x60_apply_b3884cb9241b9cc4>>();
+	};
+		// SmallArrayRewriteMacro_3cd2e5502eab1df6
+		aotLib[0x90584e48c0494461] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct small_array::SmallArrayRewriteMacro (*) ( Context * __context__ ),&SmallArrayRewriteMacro_3cd2e5502eab1df6>>();
+	};
+		// _FuncSmallArrayRewriteMacro_0x27___finalize_deae09e19dbdbb2d
+		aotLib[0xc5e418c0b13d635] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct small_array::SmallArrayRewriteMacro &  ),&_FuncSmallArrayRewriteMacro_0x27___finalize_deae09e19dbdbb2d>>();
+	};
+		// _FuncSmallArrayRewriteMacro_0x60_apply_e36bd1b518dc89ba
+		aotLib[0x1db2ecee69fddc6c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct small_array::SmallArrayRewriteMacro & , smart_ptr_raw<Program> const  , Module * const   ),&_FuncSmallArrayRewriteMacro_0x60_apply_e36bd1b518dc89ba>>();
+	};
+		// SmallArrayVisitor_21869b7bda84dc08
+		aotLib[0xb1fb475cc5390041] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct small_array::SmallArrayVisitor (*) ( Context * __context__ ),&SmallArrayVisitor_21869b7bda84dc08>>();
+	};
+		// _FuncSmallArrayVisitor_0x27___finalize_28498398044e4e65
+		aotLib[0x529b7eb0df784ca] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct small_array::SmallArrayVisitor &  ),&_FuncSmallArrayVisitor_0x27___finalize_28498398044e4e65>>();
+	};
+		// _FuncSmallArrayVisitor_0x60_visitExprAt_5fc9d9623c00854a
+		aotLib[0xc905e116741a94cf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct small_array::SmallArrayVisitor & , smart_ptr_raw<ExprAt> const   ),&_FuncSmallArrayVisitor_0x60_visitExprAt_5fc9d9623c00854a>>();
+	};
+		// _FuncSmallArrayVisitor_0x60_visitExprFor_55aac27bc6ceb7e2
+		aotLib[0xdc510c054f2bf1e0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct small_array::SmallArrayVisitor & , smart_ptr_raw<ExprFor> const   ),&_FuncSmallArrayVisitor_0x60_visitExprFor_55aac27bc6ceb7e2>>();
+	};
+		// _FuncSmallArrayVisitor_0x60_visitExprForSource_27fb29941ddf4889
+		aotLib[0xdd718c95af93d002] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct small_array::SmallArrayVisitor & , smart_ptr_raw<ExprFor> const  , smart_ptr_raw<Expression> const  , bool  ),&_FuncSmallArrayVisitor_0x60_visitExprForSource_27fb29941ddf4889>>();
+	};
+		// __setup_macros_d1164b64f39526d
+		aotLib[0x1cc6c39cdb0b97d2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_d1164b64f39526d>>();
+	};
+		// add_argument_a02bcfb2a1bd4f5c
+		aotLib[0xe021f120a0f1edfd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Function> , char * const  , smart_ptr_raw<TypeDecl> , LineInfo const  &  ),&add_argument_a02bcfb2a1bd4f5c>>();
+	};
+		// _Funcast_boost_0x60_add_new_infer_macro_2bd10b7b3ddde394
+		aotLib[0x2a4b6672d18c106d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct small_array::SmallArrayRewriteMacro * const   ),&_Funcast_boost_0x60_add_new_infer_macro_2bd10b7b3ddde394>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_19698c26d50220e8
+		aotLib[0xa6b5f77363def8e3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct small_array::SmallArrayMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_19698c26d50220e8>>();
+	};
+		// _Funcast_0x60_make_pass_macro_1a154690555938dc
+		aotLib[0x196895a75d43f7e6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<PassMacro> (*) ( Context * __context__, char * const  , struct small_array::SmallArrayRewriteMacro * const   ),&_Funcast_0x60_make_pass_macro_1a154690555938dc>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_2795f4f0f39c62fd
+		aotLib[0xc2e21cb19d38a54d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , struct small_array::SmallArrayMacro * const   ),&_Funcast_0x60_make_structure_annotation_2795f4f0f39c62fd>>();
+	};
+		// _Funcast_0x60_make_visitor_cad73f592196793d
+		aotLib[0xe5263d2c9493e57f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<VisitorAdapter> (*) ( Context * __context__, struct small_array::SmallArrayVisitor const  &  ),&_Funcast_0x60_make_visitor_cad73f592196793d>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_98dd15e167848d85
+		aotLib[0xfbfa2e866537498d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Expression * (*) ( Context * __context__, smart_ptr<Expression> const   ),&_Funcbuiltin_0x60_get_ptr_98dd15e167848d85>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9
+		aotLib[0x9295bc7cb9b31c25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Structure * (*) ( Context * __context__, smart_ptr_raw<Structure> const   ),&_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_ab1bd808c5cad437
+		aotLib[0xaf4c23028dbee555] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,char *> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_ab1bd808c5cad437>>();
+	};
+		// finalize_203784ab4ad934d7
+		aotLib[0x6a1e2cb16a0f9425] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct small_array::SmallArrayVisitor * &  ),&finalize_203784ab4ad934d7>>();
+	};
+		// finalize_f319d906d7e4b472
+		aotLib[0xfcfae4a7744cbe31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct small_array::SmallArrayMacro &  ),&finalize_f319d906d7e4b472>>();
+	};
+		// finalize_200515370e8a956a
+		aotLib[0x5d69636e2ff7c325] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct small_array::SmallArrayRewriteMacro &  ),&finalize_200515370e8a956a>>();
+	};
+		// finalize_d656f1ddb3d7915c
+		aotLib[0xefdf045bfa998fe5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct small_array::SmallArrayVisitor &  ),&finalize_d656f1ddb3d7915c>>();
+	};
+		// generate_functions_57eef079893501a2
+		aotLib[0xba594258cb179c31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Structure * const  , char * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&generate_functions_57eef079893501a2>>();
+	};
+		// is_simple_path_9c52711d311a7e94
+		aotLib[0xd81d6f470c92099] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Expression * const   ),&is_simple_path_9c52711d311a7e94>>();
+	};
+		// is_small_array_type_a765e70bd10aca67
+		aotLib[0x86505334741b63f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<TypeDecl> const   ),&is_small_array_type_a765e70bd10aca67>>();
+	};
+		// is_split_loop_6a3ec0c01a434b36
+		aotLib[0xfe5953c4469cc9d8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<ExprFor> const   ),&is_split_loop_6a3ec0c01a434b36>>();
+	};
+		// make_block_129fb94c306a5be
+		aotLib[0x963d1ffa056e5e95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, smart_ptr_raw<Expression> , LineInfo const  &  ),&make_block_129fb94c306a5be>>();
+	};
+		// make_field_bcfe86351493a221
+		aotLib[0x4845f240e727dc43] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, char * const  , char * const  , LineInfo const  &  ),&make_field_bcfe86351493a221>>();
+	};
+		// make_function_a788106be33a3536
+		aotLib[0x1aa8d582f8c68dcb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Function> (*) ( Context * __context__, char * const  , Structure * const  , bool , LineInfo const  &  ),&make_function_a788106be33a3536>>();
+	};
+		// make_helper_call_be933f6a1e7213af
+		aotLib[0xbf5c7292fd173b7a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, char * const  , char * const  , char * const  , LineInfo const  &  ),&make_helper_call_be933f6a1e7213af>>();
+	};
+		// make_loop_a58f6ffef93403a8
+		aotLib[0x373ef02584ebff3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, smart_ptr_raw<ExprFor> const  , char * const  , smart_ptr_raw<Expression> , smart_ptr_raw<Expression>  ),&make_loop_a58f6ffef93403a8>>();
+	};
+		// make_split_loop_e0a4be20d7cf1f0e
+		aotLib[0xc45cd5b69d2c18c4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, smart_ptr_raw<ExprFor> const  , char * const   ),&make_split_loop_e0a4be20d7cf1f0e>>();
+	};
+		// make_var_a6a6672e3646a9d
+		aotLib[0x6e55604f271d34e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, char * const  , LineInfo const  &  ),&make_var_a6a6672e3646a9d>>();
+	};
+		// _Funcrtti_0x60_class_info_4ee6558e772261e9
+		aotLib[0x2d01ae4b7808ac5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct small_array::SmallArrayMacro const  &  ),&_Funcrtti_0x60_class_info_4ee6558e772261e9>>();
+	};
+		// _Funcrtti_0x60_class_info_e1948b3e85d382d1
+		aotLib[0x4e2c6e43f27872d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct small_array::SmallArrayRewriteMacro const  &  ),&_Funcrtti_0x60_class_info_e1948b3e85d382d1>>();
+	};
+		// _Funcrtti_0x60_class_info_abfc16c1825d18cb
+		aotLib[0xfed0aaec014c00b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct small_array::SmallArrayVisitor const  &  ),&_Funcrtti_0x60_class_info_abfc16c1825d18cb>>();
+	};
+		// set_body_7ea9188cf2e4f110
+		aotLib[0xf56032f7f8a4079] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Function> , smart_ptr_raw<Expression> , bool , LineInfo const  &  ),&set_body_7ea9188cf2e4f110>>();
+	};
+		// small_array_key_4dc0a8b2750d6e9d
+		aotLib[0x6070fd7601b93475] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, Structure * const   ),&small_array_key_4dc0a8b2750d6e9d>>();
+	};
+		// source_field_250aae62ce81233c
+		aotLib[0x389d7dc5266ae8a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, smart_ptr_raw<ExprFor> const  , char * const   ),&source_field_250aae62ce81233c>>();
+	};
+		// struct_type_b1bb452182a2b9c7
+		aotLib[0xc966104e6a8100a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TypeDecl> (*) ( Context * __context__, Structure * const  , bool  ),&struct_type_b1bb452182a2b9c7>>();
+	};
+		// [[ init script ]]
+		aotLib[0x2f21a5b8dbe47fcd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
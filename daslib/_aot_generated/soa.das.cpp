@@ -0,0 +1,4397 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require soa
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__713aafe3;
+extern StructInfo __struct_info__a6e2d8c5;
+extern StructInfo __struct_info__f338bdeb;
+extern StructInfo __struct_info__d8299e85;
+extern StructInfo __struct_info__77bf9876;
+extern StructInfo __struct_info__69c83b8f;
+extern StructInfo __struct_info__5ed6db18;
+extern TypeInfo __type_info__10db1c1d;
+extern TypeInfo __type_info__da50b805;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__f42f651e;
+extern TypeInfo __type_info__dc52e0d5;
+extern TypeInfo __type_info__c0e5e0ad;
+extern TypeInfo __type_info__8bc5634d;
+extern TypeInfo __type_info__bab365e;
+extern TypeInfo __type_info__7ec7955d;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__3737d9d1;
+extern TypeInfo __type_info__cd849a9b;
+extern TypeInfo __type_info__aaadd575;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__c2b9b42c;
+extern TypeInfo __type_info__6f381053;
+extern TypeInfo __type_info__261bce6f;
+extern TypeInfo __type_info__dd644f60;
+extern TypeInfo __type_info__e749bd33;
+extern TypeInfo __type_info__73c8114e;
+extern TypeInfo __type_info__7da04467;
+extern TypeInfo __type_info__b1ceb1d4;
+extern TypeInfo __type_info__653ef983;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__1cb4fa6d;
+extern TypeInfo __type_info__515c0a3;
+extern TypeInfo __type_info__ccb7c90a;
+extern TypeInfo __type_info__b3bcfd53;
+extern TypeInfo __type_info__46fed0f3;
+extern TypeInfo __type_info__523f6667;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__6d1d425d;
+extern TypeInfo __type_info__ebcc21eb;
+extern TypeInfo __type_info__5ef84086;
+extern TypeInfo __type_info__7a1c4eb7;
+extern TypeInfo __type_info__2b3e54e5;
+extern TypeInfo __type_info__4de83811;
+extern TypeInfo __type_info__94ae69a3;
+extern TypeInfo __type_info__87a6e894;
+extern TypeInfo __type_info__a6a527e0;
+extern TypeInfo __type_info__a703f317;
+extern TypeInfo __type_info__f494d7e5;
+extern TypeInfo __type_info__83498580;
+extern TypeInfo __type_info__a960d6ab;
+extern TypeInfo __type_info__b108e3;
+extern TypeInfo __type_info__d7eb08f1;
+extern TypeInfo __type_info__f486e881;
+extern TypeInfo __type_info__fdd27932;
+extern TypeInfo __type_info__1683ec13;
+extern TypeInfo __type_info__1d5a02b1;
+extern TypeInfo __type_info__8f8da119;
+extern TypeInfo __type_info__5bc565f1;
+extern TypeInfo __type_info__819d499d;
+extern TypeInfo __type_info__81be117c;
+extern TypeInfo __type_info__b5d7ce5d;
+extern TypeInfo __type_info__32f7a66b;
+extern TypeInfo __type_info__cae7a171;
+extern TypeInfo __type_info__453f3d02;
+extern TypeInfo __type_info__30023ebb;
+extern TypeInfo __type_info__dcfff1ff;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__4edf488d;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__8fce7587;
+extern TypeInfo __type_info__a01f8605;
+extern TypeInfo __type_info__15780d4b;
+extern TypeInfo __type_info__7ec0323f;
+extern TypeInfo __type_info__ae076c;
+extern TypeInfo __type_info__ff9fd5d3;
+extern TypeInfo __type_info__3c4f7906;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__c4ccbb7e;
+extern TypeInfo __type_info__ab4a876a;
+extern TypeInfo __type_info__8e3dc326;
+extern TypeInfo __type_info__d73ee2dd;
+extern TypeInfo __type_info__72ae9081;
+extern TypeInfo __type_info__c831b26a;
+extern TypeInfo __type_info__d25748d6;
+extern TypeInfo __type_info__3a70d70f;
+extern TypeInfo __type_info__7c510f91;
+extern TypeInfo __type_info__b66d9ef1;
+extern TypeInfo __type_info__91c4dfb3;
+extern TypeInfo __type_info__15e14f92;
+extern TypeInfo __type_info__ebc70931;
+extern TypeInfo __type_info__3c8fd4b4;
+extern TypeInfo __type_info__4e52e6ae;
+extern TypeInfo __type_info__8891fc55;
+extern TypeInfo __type_info__7ebfa292;
+extern TypeInfo __type_info__9773df12;
+extern TypeInfo __type_info__317f8d25;
+extern TypeInfo __type_info__3c6fa07f;
+extern TypeInfo __type_info__9920ba3b;
+extern TypeInfo __type_info__8f234b97;
+extern TypeInfo __type_info__87882376;
+extern TypeInfo __type_info__5f6a7cad;
+extern TypeInfo __type_info__10b7decc;
+extern TypeInfo __type_info__c9679a50;
+extern TypeInfo __type_info__8494e015;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__b867c43d;
+extern TypeInfo __type_info__9e20c21a;
+extern TypeInfo __type_info__b9491240;
+extern TypeInfo __type_info__8ce26751;
+extern TypeInfo __type_info__963c776b;
+extern TypeInfo __type_info__b58fe8a6;
+extern TypeInfo __type_info__5527f9ed;
+extern TypeInfo __type_info__fba33907;
+extern TypeInfo __type_info__51c55633;
+extern TypeInfo __type_info__84917dd0;
+extern TypeInfo __type_info__b9a2b501;
+extern TypeInfo __type_info__68f47b8a;
+extern TypeInfo __type_info__34157e23;
+extern TypeInfo __type_info__37ca469d;
+extern TypeInfo __type_info__14c14bf4;
+extern TypeInfo __type_info__4fa9a2d8;
+extern TypeInfo __type_info__d4f3571c;
+extern TypeInfo __type_info__2d8fb614;
+extern TypeInfo __type_info__10edfe53;
+extern TypeInfo __type_info__a07921bf;
+extern TypeInfo __type_info__b38eb5b3;
+extern TypeInfo __type_info__2481035b;
+extern TypeInfo __type_info__a1ba446d;
+extern TypeInfo __type_info__9fee7340;
+extern TypeInfo __type_info__ada7aa90;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__664a2fe7;
+extern TypeInfo __type_info__655bd8a4;
+extern TypeInfo __type_info__2f1bdc9a;
+extern TypeInfo __type_info__8fd2ec2e;
+extern TypeInfo __type_info__5dc56917;
+extern TypeInfo __type_info__d16acbbb;
+extern TypeInfo __type_info__d4aee91;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__2ba0095f;
+extern TypeInfo __type_info__d057deb9;
+extern TypeInfo __type_info__6dd946fa;
+extern TypeInfo __type_info__32b24044;
+extern TypeInfo __type_info__531e5432;
+extern TypeInfo __type_info__e0a995b4;
+extern TypeInfo __type_info__368fac4c;
+extern TypeInfo __type_info__76b8ad03;
+extern TypeInfo __type_info__48d9d78;
+extern TypeInfo __type_info__6535171f;
+extern TypeInfo __type_info__9ee277f5;
+extern TypeInfo __type_info__e7b89eff;
+extern TypeInfo __type_info__8f8b0275;
+extern TypeInfo __type_info__764dc75a;
+extern TypeInfo __type_info__e2deda56;
+extern TypeInfo __type_info__5a28d785;
+extern TypeInfo __type_info__9445fbcf;
+extern TypeInfo __type_info__7df5ef2c;
+extern TypeInfo __type_info__bf2d884b;
+extern TypeInfo __type_info__6c2a86f9;
+extern TypeInfo __type_info__e97755bb;
+extern TypeInfo __type_info__295e937b;
+extern TypeInfo __type_info__1d3d6764;
+extern TypeInfo __type_info__251bccdc;
+extern TypeInfo __type_info__bd757ca;
+extern TypeInfo __type_info__5ac5645e;
+extern TypeInfo __type_info__e4d4c1e4;
+extern TypeInfo __type_info__d514cba4;
+extern TypeInfo __type_info__60d19370;
+extern TypeInfo __type_info__c5ddc6fa;
+extern TypeInfo __type_info__9f20c3ad;
+extern TypeInfo __type_info__1b3c6d8d;
+extern TypeInfo __type_info__6529db2b;
+extern TypeInfo __type_info__a8d37f6f;
+extern TypeInfo __type_info__d7ddca10;
+extern TypeInfo __type_info__130d26f9;
+extern TypeInfo __type_info__721467d3;
+extern TypeInfo __type_info__8728109a;
+extern TypeInfo __type_info__1bb5fdf7;
+extern TypeInfo __type_info__a65edd74;
+extern TypeInfo __type_info__76972586;
+extern TypeInfo __type_info__5ca338ad;
+extern TypeInfo __type_info__d180e781;
+extern TypeInfo __type_info__74b0f2db;
+extern TypeInfo __type_info__cf57dd26;
+extern TypeInfo __type_info__535415eb;
+extern TypeInfo __type_info__ccc9122b;
+extern TypeInfo __type_info__b2cb4a2b;
+extern TypeInfo __type_info__a5b6b194;
+extern TypeInfo __type_info__ccee123b;
+extern TypeInfo __type_info__374b4b09;
+extern TypeInfo __type_info__9338185;
+extern TypeInfo __type_info__cf52b1be;
+extern TypeInfo __type_info__b049b391;
+extern TypeInfo __type_info__9a5b5986;
+extern TypeInfo __type_info__7856e79d;
+extern TypeInfo __type_info__75b7ce79;
+extern TypeInfo __type_info__5f1adc0e;
+extern TypeInfo __type_info__cd57da00;
+extern TypeInfo __type_info__c1bd2f4c;
+extern TypeInfo __type_info__a8981616;
+extern TypeInfo __type_info__88de8728;
+extern TypeInfo __type_info__1b9f61f8;
+extern TypeInfo __type_info__79323f61;
+extern TypeInfo __type_info__231bc9b6;
+extern TypeInfo __type_info__8121e453;
+extern TypeInfo __type_info__d3ebcc43;
+extern TypeInfo __type_info__f2cdf1a0;
+extern TypeInfo __type_info__d8ac9e75;
+extern TypeInfo __type_info__fc0d99dd;
+extern TypeInfo __type_info__c1e3d526;
+extern TypeInfo __type_info__c627fc0a;
+extern TypeInfo __type_info__a40a0d70;
+extern TypeInfo __type_info__858d2368;
+extern TypeInfo __type_info__c6cb0399;
+extern TypeInfo __type_info__f66d4d6;
+extern TypeInfo __type_info__fe4bfa47;
+extern TypeInfo __type_info__cb3ec93c;
+extern TypeInfo __type_info__27a9a437;
+extern TypeInfo __type_info__374bcd9;
+extern TypeInfo __type_info__39dd41c1;
+extern TypeInfo __type_info__d00bb3d6;
+extern TypeInfo __type_info__f1eeff10;
+extern TypeInfo __type_info__b081465d;
+extern TypeInfo __type_info__8c0d0a29;
+extern TypeInfo __type_info__be386f7a;
+extern TypeInfo __type_info__cf76cec3;
+extern TypeInfo __type_info__d4007c24;
+extern TypeInfo __type_info__ed20bab;
+extern TypeInfo __type_info__b850751a;
+extern TypeInfo __type_info__309172d;
+extern VarInfo __var_info__df621be1;
+extern VarInfo __var_info__c9f80448;
+extern VarInfo __var_info__1a57faec;
+extern VarInfo __var_info__2859cff9;
+extern VarInfo __var_info__9ac8a79d;
+extern VarInfo __var_info__2479d068;
+extern VarInfo __var_info__21dc0f2b;
+extern VarInfo __var_info__17b491;
+extern VarInfo __var_info__94bed59d;
+extern VarInfo __var_info__aefafc88;
+extern VarInfo __var_info__b9cbab3d;
+extern VarInfo __var_info__14bcb702;
+extern VarInfo __var_info__e3ed7bac;
+extern VarInfo __var_info__d748f56;
+extern VarInfo __var_info__f0f679cc;
+extern VarInfo __var_info__6e97f0ea;
+extern VarInfo __var_info__11aeae1c;
+extern VarInfo __var_info__a1981da5;
+extern VarInfo __var_info__6f4d2d82;
+extern VarInfo __var_info__412ca7f1;
+extern VarInfo __var_info__8965dfd1;
+extern VarInfo __var_info__f31c80db;
+extern VarInfo __var_info__a59d5f88;
+extern VarInfo __var_info__59d26bc7;
+extern VarInfo __var_info__442b5d7f;
+extern VarInfo __var_info__d4f9c662;
+extern VarInfo __var_info__fde3ac29;
+extern VarInfo __var_info__7607b7d3;
+extern VarInfo __var_info__d6c089cc;
+extern VarInfo __var_info__301336b9;
+extern VarInfo __var_info__d561f037;
+extern VarInfo __var_info__a92f607e;
+extern VarInfo __var_info__c84acfc5;
+extern VarInfo __var_info__283a7ca3;
+extern VarInfo __var_info__d28aabf9;
+extern VarInfo __var_info__7c486554;
+extern VarInfo __var_info__f75632a0;
+extern VarInfo __var_info__351a0bc7;
+extern VarInfo __var_info__128e68c7;
+extern VarInfo __var_info__35e4f53d;
+extern VarInfo __var_info__12320745;
+extern VarInfo __var_info__98dc5351;
+extern VarInfo __var_info__a6af2d15;
+extern VarInfo __var_info__de11b7cd;
+extern VarInfo __var_info__f3715aaa;
+extern VarInfo __var_info__db853894;
+extern VarInfo __var_info__e6cca2c9;
+extern VarInfo __var_info__e1903c80;
+extern VarInfo __var_info__f7387f87;
+extern VarInfo __var_info__ad5a0405;
+extern VarInfo __var_info__1055523b;
+extern VarInfo __var_info__f902c2de;
+extern VarInfo __var_info__6758a118;
+extern VarInfo __var_info__215e3c49;
+extern VarInfo __var_info__9dd5fe8e;
+extern VarInfo __var_info__b66dff52;
+extern VarInfo __var_info__699ff8ab;
+extern VarInfo __var_info__3b14171a;
+extern VarInfo __var_info__362c96a0;
+extern VarInfo __var_info__ad0de3d2;
+extern VarInfo __var_info__54d36777;
+extern VarInfo __var_info__4c0ae0f9;
+extern VarInfo __var_info__359e840f;
+extern VarInfo __var_info__80719338;
+extern VarInfo __var_info__d1222c0d;
+extern VarInfo __var_info__6d3d92b1;
+extern VarInfo __var_info__b1168bad;
+extern VarInfo __var_info__988afcfd;
+extern VarInfo __var_info__7d10d569;
+extern VarInfo __var_info__dd11fe0c;
+extern VarInfo __var_info__847a0de8;
+extern VarInfo __var_info__d24e36a;
+extern VarInfo __var_info__dc873d46;
+extern VarInfo __var_info__d11ed6d8;
+extern VarInfo __var_info__466858f8;
+extern VarInfo __var_info__d811ae5b;
+extern VarInfo __var_info__80289013;
+extern VarInfo __var_info__6eaa7d50;
+extern VarInfo __var_info__284e759;
+extern VarInfo __var_info__9cd677e8;
+extern VarInfo __var_info__cb496173;
+extern VarInfo __var_info__2663c954;
+extern VarInfo __var_info__b4ea9e;
+extern VarInfo __var_info__2cbdc12a;
+extern VarInfo __var_info__d446f811;
+extern VarInfo __var_info__5fa7d37b;
+extern VarInfo __var_info__422ca984;
+extern VarInfo __var_info__acf25e8a;
+extern VarInfo __var_info__3faadbe1;
+extern VarInfo __var_info__915cd895;
+extern VarInfo __var_info__c8e5f55;
+extern VarInfo __var_info__aaaf3361;
+extern VarInfo __var_info__9d59dc9b;
+extern VarInfo __var_info__af127413;
+extern VarInfo __var_info__31003f6c;
+extern VarInfo __var_info__908409e3;
+extern VarInfo __var_info__4ea380c9;
+extern VarInfo __var_info__6a9ffa3e;
+extern VarInfo __var_info__5b5aed7e;
+extern VarInfo __var_info__b74f0c7a;
+extern VarInfo __var_info__35318804;
+extern VarInfo __var_info__8ab30e7c;
+extern VarInfo __var_info__7288f76b;
+extern VarInfo __var_info__88efa8ff;
+extern VarInfo __var_info__7ea03b0a;
+extern VarInfo __var_info__3f5db93a;
+extern VarInfo __var_info__9f9e2028;
+extern VarInfo __var_info__c3059e01;
+extern VarInfo __var_info__345035e;
+extern VarInfo __var_info__56bc3b31;
+extern VarInfo __var_info__ac9d6a8d;
+extern VarInfo __var_info__41c5b40b;
+extern VarInfo __var_info__e85d642a;
+extern VarInfo __var_info__38a7314e;
+extern VarInfo __var_info__b9d9aeeb;
+extern VarInfo __var_info__f680f7e2;
+extern VarInfo __var_info__8fdce0ec;
+extern VarInfo __var_info__47f67780;
+extern VarInfo __var_info__a433d831;
+extern VarInfo __var_info__cafe3512;
+extern VarInfo __var_info__871a8595;
+extern VarInfo __var_info__fcdb84a;
+extern VarInfo __var_info__ad56015e;
+extern VarInfo __var_info__cb3eecea;
+extern VarInfo __var_info__78d2e971;
+extern VarInfo __var_info__5bede5bc;
+extern VarInfo __var_info__344d19dc;
+extern VarInfo __var_info__4c957b89;
+extern VarInfo __var_info__a3e37f22;
+extern VarInfo __var_info__db11fae6;
+extern VarInfo __var_info__cb50360b;
+extern VarInfo __var_info__c35127d9;
+extern VarInfo __var_info__ba8cda98;
+extern VarInfo __var_info__e4dec3a3;
+extern VarInfo __var_info__999f9e51;
+extern VarInfo __var_info__6a218714;
+extern VarInfo __var_info__9ff71a7;
+extern VarInfo __var_info__6a0e64c1;
+extern VarInfo __var_info__44a86e2d;
+extern VarInfo __var_info__b9c76a25;
+extern VarInfo __var_info__43f7c55f;
+extern VarInfo __var_info__e7d4504e;
+extern VarInfo __var_info__871054a5;
+extern VarInfo __var_info__955e0b53;
+extern VarInfo __var_info__c00b486a;
+extern VarInfo __var_info__491e734a;
+extern VarInfo __var_info__52c5da8;
+extern VarInfo __var_info__1f78c3bf;
+extern VarInfo __var_info__5e90f2e0;
+extern VarInfo __var_info__ae8a6712;
+extern VarInfo __var_info__fdd22aac;
+extern VarInfo __var_info__159c68d2;
+extern VarInfo __var_info__f25a787;
+extern VarInfo __var_info__3924c25d;
+extern VarInfo __var_info__9e3c917f;
+extern VarInfo __var_info__17222b1f;
+extern VarInfo __var_info__b7195064;
+extern VarInfo __var_info__eb9e31ea;
+extern VarInfo __var_info__4048a67e;
+extern VarInfo __var_info__88bd350e;
+extern VarInfo __var_info__dbcbf787;
+extern VarInfo __var_info__c19ea0d4;
+extern VarInfo __var_info__7cfe7756;
+extern VarInfo __var_info__965c169c;
+extern VarInfo __var_info__41fce565;
+extern VarInfo __var_info__89b1ed2f;
+extern VarInfo __var_info__ed636a01;
+extern VarInfo __var_info__134ae51;
+extern VarInfo __var_info__ad464f32;
+extern VarInfo __var_info__2f9a4741;
+extern VarInfo __var_info__c366986c;
+extern VarInfo __var_info__5238421c;
+extern VarInfo __var_info__989f9cbe;
+extern VarInfo __var_info__295789d;
+extern VarInfo __var_info__c9d28329;
+extern VarInfo __var_info__b69afd24;
+extern VarInfo __var_info__754e508d;
+extern VarInfo __var_info__e42e56d0;
+extern VarInfo __var_info__839dc51c;
+extern VarInfo __var_info__37bdfa4a;
+extern VarInfo __var_info__c4a28f5d;
+extern VarInfo __var_info__2965e55d;
+extern VarInfo __var_info__a6016d01;
+extern VarInfo __var_info__d15980dd;
+extern VarInfo __var_info__a80e5f39;
+extern VarInfo __var_info__5daec0ba;
+extern VarInfo __var_info__88b468bd;
+extern VarInfo __var_info__262c78f;
+extern VarInfo __var_info__d676fdc3;
+extern VarInfo __var_info__ac1f0992;
+extern VarInfo __var_info__f502f93d;
+extern VarInfo __var_info__b867a91;
+extern VarInfo __var_info__cbd679f5;
+extern VarInfo __var_info__4bbc29e0;
+extern VarInfo __var_info__cc7bc1b;
+extern VarInfo __var_info__2f87634a;
+extern VarInfo __var_info__fec8f29;
+extern VarInfo __var_info__880f2249;
+extern VarInfo __var_info__d6c3d2fc;
+extern VarInfo __var_info__c23f4a42;
+extern VarInfo __var_info__1c56de;
+extern VarInfo __var_info__9f981a7f;
+extern VarInfo __var_info__d6bd6ae8;
+extern VarInfo __var_info__f3ae166d;
+extern VarInfo __var_info__67cfaaa3;
+extern VarInfo __var_info__4c7d7178;
+extern VarInfo __var_info__467e4da7;
+extern VarInfo __var_info__d671222a;
+extern VarInfo __var_info__b70d417;
+extern VarInfo __var_info__f25e8ce;
+extern VarInfo __var_info__37233ab;
+extern VarInfo __var_info__7047ba47;
+extern VarInfo __var_info__d3dafb1e;
+extern VarInfo __var_info__9b9fa177;
+extern VarInfo __var_info__a10f6f08;
+extern VarInfo __var_info__9b3fa77d;
+extern VarInfo __var_info__59a80c5a;
+extern VarInfo __var_info__3edb5270;
+extern VarInfo __var_info__8644430a;
+extern VarInfo __var_info__2f579c72;
+extern VarInfo __var_info__3b7fa296;
+extern VarInfo __var_info__3500ec4a;
+extern VarInfo __var_info__b3d55520;
+extern VarInfo __var_info__dc11fc79;
+extern VarInfo __var_info__7a244520;
+extern VarInfo __var_info__acaf3687;
+extern VarInfo __var_info__f2348094;
+extern VarInfo __var_info__3efce0ac;
+extern VarInfo __var_info__118e6734;
+extern VarInfo __var_info__e8aece05;
+extern VarInfo __var_info__6c08a2e5;
+extern VarInfo __var_info__154a5f89;
+extern VarInfo __var_info__d0c5570f;
+extern VarInfo __var_info__827a7b9f;
+extern VarInfo __var_info__cd362d8a;
+extern VarInfo __var_info__abaf34f4;
+extern VarInfo __var_info__21588a7a;
+extern VarInfo __var_info__aa30df58;
+extern VarInfo __var_info__b35acbb;
+extern VarInfo __var_info__26559778;
+extern VarInfo __var_info__4bec5f30;
+extern VarInfo __var_info__97c13f9f;
+extern VarInfo __var_info__ea880481;
+extern VarInfo __var_info__8ff55541;
+extern VarInfo __var_info__cc0f5e2c;
+extern VarInfo __var_info__f0052568;
+extern VarInfo __var_info__64f4b569;
+extern VarInfo __var_info__b35f2799;
+extern VarInfo __var_info__c6bf2bd2;
+extern VarInfo __var_info__2d3a4cbf;
+extern VarInfo __var_info__2db38041;
+extern VarInfo __var_info__dfbb50cb;
+extern VarInfo __var_info__3f48a4eb;
+extern VarInfo __var_info__fbd35c53;
+extern VarInfo __var_info__dd7763ee;
+extern VarInfo __var_info__17d96d41;
+extern VarInfo __var_info__5af9fbd1;
+extern VarInfo __var_info__a9b0cc55;
+extern VarInfo __var_info__a246be3c;
+extern VarInfo __var_info__6d5c4cbf;
+extern VarInfo __var_info__e95012d3;
+extern VarInfo __var_info__768ca6f2;
+extern VarInfo __var_info__2283b5be;
+extern VarInfo __var_info__6fc12b47;
+extern VarInfo __var_info__43facf98;
+extern VarInfo __var_info__dfd72bdf;
+extern VarInfo __var_info__7a87bd0e;
+extern VarInfo __var_info__919eabb1;
+extern VarInfo __var_info__165b28fa;
+extern VarInfo __var_info__56302653;
+extern VarInfo __var_info__12214d06;
+extern VarInfo __var_info__dbe74630;
+extern VarInfo __var_info__97b1c4ed;
+extern VarInfo __var_info__7fb86212;
+extern VarInfo __var_info__f6f7b5fd;
+extern VarInfo __var_info__28fb901d;
+extern VarInfo __var_info__1b24584f;
+extern VarInfo __var_info__df656d69;
+extern VarInfo __var_info__de1e869a;
+extern VarInfo __var_info__59368709;
+extern VarInfo __var_info__f593eec8;
+extern VarInfo __var_info__cae93403;
+extern VarInfo __var_info__a69d611b;
+extern VarInfo __var_info__3fa237c2;
+extern VarInfo __var_info__e6e48890;
+extern VarInfo __var_info__bfcb048c;
+extern VarInfo __var_info__7c87c94a;
+extern VarInfo __var_info__bd3bde81;
+extern VarInfo __var_info__e0b1362a;
+extern VarInfo __var_info__9eeb822a;
+extern VarInfo __var_info__49337809;
+extern VarInfo __var_info__ead7a797;
+extern VarInfo __var_info__cdf950db;
+extern VarInfo __var_info__1ec2e313;
+extern VarInfo __var_info__b247b012;
+extern VarInfo __var_info__da475246;
+extern VarInfo __var_info__5afbb756;
+extern VarInfo __var_info__cb901576;
+extern VarInfo __var_info__171280cf;
+extern VarInfo __var_info__f891e8e9;
+extern VarInfo __var_info__e4eb34d9;
+extern VarInfo __var_info__8db8bc90;
+extern VarInfo __var_info__ecb00170;
+extern VarInfo __var_info__ac0224c9;
+extern VarInfo __var_info__b632464e;
+extern VarInfo __var_info__85473ce6;
+extern VarInfo __var_info__d90d9f18;
+extern VarInfo __var_info__93a69d13;
+extern VarInfo __var_info__9e9818ec;
+extern VarInfo __var_info__23b74d11;
+extern VarInfo __var_info__e6a0bda4;
+extern VarInfo __var_info__59c81bc3;
+extern VarInfo __var_info__ac60830b;
+extern VarInfo __var_info__fb05f748;
+extern VarInfo __var_info__57bc3cc4;
+extern VarInfo __var_info__c053d161;
+extern VarInfo __var_info__b8ba8abc;
+extern VarInfo __var_info__f96d7afb;
+extern VarInfo __var_info__b873b4e2;
+extern VarInfo __var_info__49811019;
+extern VarInfo __var_info__64bce7f2;
+extern VarInfo __var_info__8d5808fc;
+extern VarInfo __var_info__ac29e6b9;
+extern VarInfo __var_info__56569ad4;
+extern VarInfo __var_info__89e422d2;
+extern VarInfo __var_info__67637a0d;
+extern VarInfo __var_info__cfe854bb;
+extern VarInfo __var_info__1bbde4e9;
+extern VarInfo __var_info__5edf1194;
+extern VarInfo __var_info__1d5466ee;
+extern VarInfo __var_info__9b78bd2b;
+extern VarInfo __var_info__822a0a6f;
+extern VarInfo __var_info__484e10a1;
+extern VarInfo __var_info__e39e4e74;
+extern VarInfo __var_info__f1675330;
+extern VarInfo __var_info__63a3eac;
+extern VarInfo __var_info__3bbe5820;
+extern VarInfo __var_info__69346179;
+extern VarInfo __var_info__9bd0e54c;
+extern VarInfo __var_info__4caad24e;
+extern VarInfo __var_info__d737429b;
+extern VarInfo __var_info__c2ec29d8;
+extern VarInfo __var_info__af351c14;
+extern VarInfo __var_info__49a94186;
+extern VarInfo __var_info__e1173b5c;
+extern VarInfo __var_info__e8005be5;
+extern VarInfo __var_info__f2f1d3aa;
+extern VarInfo __var_info__3e48a358;
+extern VarInfo __var_info__11e34a29;
+extern VarInfo __var_info__5532d30;
+extern VarInfo __var_info__1ec22aa1;
+extern VarInfo __var_info__2510b028;
+extern VarInfo __var_info__9edcbce;
+extern VarInfo __var_info__8f9f8e93;
+extern VarInfo __var_info__52ff6128;
+extern VarInfo __var_info__63c353f1;
+extern VarInfo __var_info__c6285a4d;
+extern VarInfo __var_info__c32d1370;
+extern VarInfo __var_info__bb163ec9;
+extern VarInfo __var_info__a14c8807;
+extern VarInfo __var_info__d4796351;
+extern VarInfo __var_info__689ff718;
+extern VarInfo __var_info__e31ef20e;
+extern VarInfo __var_info__d7a0c00a;
+extern VarInfo __var_info__14edeb60;
+extern VarInfo __var_info__4eb06dab;
+extern VarInfo __var_info__d62685b2;
+extern VarInfo __var_info__10bf88c5;
+extern VarInfo __var_info__ea5af670;
+extern VarInfo __var_info__8e19c99e;
+extern VarInfo __var_info__cc29b605;
+extern VarInfo __var_info__1c9914bb;
+extern VarInfo __var_info__f4999d8b;
+extern VarInfo __var_info__6521e890;
+extern VarInfo __var_info__140a9c8a;
+extern VarInfo __var_info__92e3d111;
+extern VarInfo __var_info__45d5df8f;
+extern VarInfo __var_info__de9b874d;
+extern VarInfo __var_info__554a21ae;
+extern VarInfo __var_info__2080551e;
+extern VarInfo __var_info__cb3be993;
+extern VarInfo __var_info__a9387dbf;
+extern VarInfo __var_info__85227932;
+extern VarInfo __var_info__a9b3f36;
+extern VarInfo __var_info__9cd84da2;
+extern VarInfo __var_info__2e829a6b;
+extern VarInfo __var_info__be271e3a;
+extern VarInfo __var_info__f879f31;
+extern VarInfo __var_info__afac4da3;
+extern VarInfo __var_info__1dd0d240;
+extern VarInfo __var_info__dcd95cf7;
+extern VarInfo __var_info__6fecc66f;
+extern VarInfo __var_info__b859fa96;
+extern VarInfo __var_info__1fff0112;
+extern VarInfo __var_info__d346f67e;
+extern VarInfo __var_info__915be3cd;
+extern VarInfo __var_info__7447bb4f;
+extern VarInfo __var_info__9e4634d8;
+extern VarInfo __var_info__d4575e64;
+extern VarInfo __var_info__c5f99f7a;
+extern VarInfo __var_info__a0ecfbb9;
+extern VarInfo __var_info__e0c27f4b;
+extern VarInfo __var_info__a308d1be;
+extern VarInfo __var_info__bebd7bb;
+extern VarInfo __var_info__e22515a;
+extern VarInfo __var_info__bac4281b;
+extern VarInfo __var_info__cd38dbfb;
+extern VarInfo __var_info__188edf7a;
+extern VarInfo __var_info__8b73a850;
+extern VarInfo __var_info__96d56d44;
+extern VarInfo __var_info__fc59ba5b;
+extern VarInfo __var_info__f0c85c89;
+extern VarInfo __var_info__d49ed084;
+extern VarInfo __var_info__490512e0;
+extern VarInfo __var_info__afd807ea;
+extern VarInfo __var_info__757540b8;
+extern VarInfo __var_info__75c92fd3;
+extern VarInfo __var_info__2c9446e3;
+extern VarInfo __var_info__c6f695d4;
+extern VarInfo __var_info__e3083f3d;
+extern VarInfo __var_info__b11e04b;
+extern VarInfo __var_info__9356e5ba;
+extern VarInfo __var_info__90a51465;
+extern VarInfo __var_info__5987c2ff;
+extern VarInfo __var_info__77c8db69;
+extern VarInfo __var_info__2f133526;
+extern VarInfo __var_info__f25fabc1;
+extern VarInfo __var_info__78bcb4df;
+extern VarInfo __var_info__ca46e853;
+extern VarInfo __var_info__e1345261;
+extern VarInfo __var_info__6380f0c0;
+extern VarInfo __var_info__8f4c9038;
+extern VarInfo __var_info__6c97d67;
+extern VarInfo __var_info__c7269e2e;
+extern VarInfo __var_info__d5146090;
+extern VarInfo __var_info__21f91cf0;
+extern VarInfo __var_info__d711acc8;
+extern VarInfo __var_info__c93f0085;
+extern VarInfo __var_info__135210e8;
+extern VarInfo __var_info__76deb203;
+extern VarInfo __var_info__1e070140;
+extern VarInfo __var_info__2c383e55;
+extern VarInfo __var_info__d852ec91;
+extern VarInfo __var_info__43b9e565;
+extern VarInfo __var_info__ae8d05f1;
+extern VarInfo __var_info__38580ab1;
+extern VarInfo __var_info__b08b6929;
+extern VarInfo __var_info__7243b64;
+extern VarInfo __var_info__581c63d6;
+extern VarInfo __var_info__9ec3db23;
+extern VarInfo __var_info__7acd6d0b;
+extern VarInfo __var_info__ba5333e6;
+extern VarInfo __var_info__6dbb285b;
+extern VarInfo __var_info__cc02d1d4;
+extern VarInfo __var_info__8e81b2d8;
+extern VarInfo __var_info__2f90ec93;
+extern VarInfo __var_info__3ffce23f;
+extern VarInfo __var_info__83d50dee;
+extern VarInfo __var_info__a74c85b9;
+extern VarInfo __var_info__717f8e67;
+extern VarInfo __var_info__2af4d3dc;
+extern VarInfo __var_info__23fa073a;
+extern VarInfo __var_info__a343220e;
+extern VarInfo __var_info__108e65a1;
+extern VarInfo __var_info__bae48ff1;
+extern VarInfo __var_info__4f19c1af;
+extern VarInfo __var_info__b7d4d4bf;
+extern VarInfo __var_info__89631998;
+extern VarInfo __var_info__a216b644;
+extern VarInfo __var_info__5fa0ff2d;
+extern VarInfo __var_info__45ba146a;
+extern VarInfo __var_info__62940135;
+extern VarInfo __var_info__dd1c267d;
+extern VarInfo __var_info__d210f17a;
+extern VarInfo __var_info__8baca1cb;
+extern VarInfo __var_info__a42b136c;
+extern VarInfo __var_info__b8a62ea9;
+extern VarInfo __var_info__25c0eaac;
+extern VarInfo __var_info__81db7c19;
+extern VarInfo __var_info__3aa22fe3;
+extern VarInfo __var_info__e51104e3;
+extern VarInfo __var_info__9382c726;
+extern VarInfo __var_info__888bf034;
+extern VarInfo __var_info__e1120458;
+extern VarInfo __var_info__1ad4800e;
+extern VarInfo __var_info__f38f670c;
+extern VarInfo __var_info__c0b8844e;
+extern VarInfo __var_info__39479b18;
+extern VarInfo __var_info__7705b54f;
+extern VarInfo __var_info__ebd6bd76;
+extern VarInfo __var_info__5b52b3a0;
+extern VarInfo __var_info__9794b2fb;
+extern VarInfo __var_info__39a22e50;
+extern VarInfo __var_info__d6146223;
+extern VarInfo __var_info__319243ae;
+extern VarInfo __var_info__169d2283;
+extern VarInfo __var_info__402ca65e;
+extern VarInfo __var_info__ccec8af9;
+extern VarInfo __var_info__c599af52;
+extern VarInfo __var_info__86e166c2;
+extern VarInfo __var_info__af4b99ff;
+extern VarInfo __var_info__546203a;
+extern VarInfo __var_info__b7292eb0;
+extern VarInfo __var_info__3113384c;
+extern VarInfo __var_info__8f9ddf9a;
+extern VarInfo __var_info__3d04d5e4;
+extern VarInfo __var_info__4f239829;
+extern VarInfo __var_info__6ed5dbee;
+extern VarInfo __var_info__53d8e8c5;
+extern VarInfo __var_info__c426b0fb;
+extern VarInfo __var_info__3aa821a2;
+extern VarInfo __var_info__327e2124;
+extern VarInfo __var_info__d646fb37;
+extern VarInfo __var_info__2ca8ab25;
+extern VarInfo __var_info__35133e98;
+extern VarInfo __var_info__36bf6516;
+extern VarInfo __var_info__582bd095;
+extern VarInfo __var_info__3021cb;
+extern VarInfo __var_info__ffd9fe3a;
+extern VarInfo __var_info__6601ba78;
+extern VarInfo __var_info__1038b679;
+extern VarInfo __var_info__55bc399e;
+extern VarInfo __var_info__af00471;
+extern VarInfo __var_info__1f86b8e3;
+extern VarInfo __var_info__2a02779d;
+extern VarInfo __var_info__811d954d;
+extern VarInfo __var_info__7776bab9;
+extern VarInfo __var_info__e9e73a57;
+extern VarInfo __var_info__ee0efbc3;
+extern VarInfo __var_info__cea9756b;
+extern VarInfo __var_info__ea5d24a1;
+extern VarInfo __var_info__3cb36c5c;
+extern VarInfo __var_info__8ecb0037;
+extern VarInfo __var_info__7d1f6821;
+extern VarInfo __var_info__94bb64af;
+extern VarInfo __var_info__6c164ebf;
+extern VarInfo __var_info__c985a48c;
+extern VarInfo __var_info__9c124126;
+extern VarInfo __var_info__1c524c4f;
+extern VarInfo __var_info__eee3bc09;
+extern VarInfo __var_info__f1edd27b;
+extern VarInfo __var_info__31ca940d;
+extern VarInfo __var_info__e61118fd;
+extern VarInfo __var_info__db146a02;
+extern VarInfo __var_info__53570c94;
+extern VarInfo __var_info__f053bcba;
+extern VarInfo __var_info__fa49ad6d;
+extern VarInfo __var_info__e90df193;
+extern VarInfo __var_info__4a66add7;
+extern VarInfo __var_info__c2023960;
+extern VarInfo __var_info__7d70a6ef;
+extern VarInfo __var_info__fdcc980e;
+extern VarInfo __var_info__2b4fabb;
+extern VarInfo __var_info__40296bfa;
+extern VarInfo __var_info__d76915b6;
+extern VarInfo __var_info__20d61058;
+extern VarInfo __var_info__edb84f8f;
+extern VarInfo __var_info__aff78d24;
+extern VarInfo __var_info__12c1f55a;
+extern VarInfo __var_info__712ef8b3;
+extern VarInfo __var_info__f08f15f6;
+
+VarInfo __struct_info__713aafe3_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x159c68d2, "__rtti", 0 };
+TypeInfo * __type_info__43b9e565_arg_types_var_1899671523[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__713aafe3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43b9e565_arg_types_var_1899671523, nullptr, 1, 0, nullptr, 28, 0x43b9e565, "__finalize", 8 };
+TypeInfo * __type_info__1f78c3bf_arg_types_var_1899671523[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__713aafe3_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1f78c3bf_arg_types_var_1899671523, nullptr, 5, 0, nullptr, 28, 0x1f78c3bf, "apply", 12 };
+TypeInfo * __type_info__cb901576_arg_types_var_1899671523[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__713aafe3_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cb901576_arg_types_var_1899671523, nullptr, 5, 0, nullptr, 28, 0xcb901576, "finish", 16 };
+VarInfo * __struct_info__713aafe3_fields[4] =  { &__struct_info__713aafe3_field_0, &__struct_info__713aafe3_field_1, &__struct_info__713aafe3_field_2, &__struct_info__713aafe3_field_3 };
+StructInfo __struct_info__713aafe3 = {"AstStructureAnnotation", __struct_info__713aafe3_fields, 4, 24, -1, nullptr, 0x713aafe3 };
+VarInfo __struct_info__a6e2d8c5_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x47f67780, "__rtti", 0 };
+TypeInfo * __type_info__c426b0fb_arg_types_var_2799884485[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__a6e2d8c5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c426b0fb_arg_types_var_2799884485, nullptr, 1, 0, nullptr, 28, 0xc426b0fb, "__finalize", 8 };
+TypeInfo * __type_info__1ec22aa1_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__a6e2d8c5_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1ec22aa1_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x1ec22aa1, "preVisitProgram", 12 };
+TypeInfo * __type_info__d3dafb1e_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__a6e2d8c5_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d3dafb1e_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd3dafb1e, "visitProgram", 16 };
+TypeInfo * __type_info__bae48ff1_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__a6e2d8c5_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bae48ff1_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xbae48ff1, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__b11e04b_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__a6e2d8c5_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b11e04b_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb11e04b, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__e31ef20e_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__a6e2d8c5_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__e31ef20e_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xe31ef20e, "visitTypeDecl", 28 };
+TypeInfo * __type_info__e6cca2c9_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__a6e2d8c5_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e6cca2c9_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xe6cca2c9, "preVisitAlias", 32 };
+TypeInfo * __type_info__d24e36a_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__a6e2d8c5_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__d24e36a_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xd24e36a, "visitAlias", 36 };
+TypeInfo * __type_info__37bdfa4a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__a6e2d8c5_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__37bdfa4a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x37bdfa4a, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__af127413_arg_types_var_2799884485[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af127413_arg_types_var_2799884485, nullptr, 5, 0, nullptr, 28, 0xaf127413, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__2283b5be_arg_types_var_2799884485[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2283b5be_arg_types_var_2799884485, nullptr, 5, 0, nullptr, 28, 0x2283b5be, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__b867a91_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__a6e2d8c5_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__b867a91_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb867a91, "visitEnumeration", 52 };
+TypeInfo * __type_info__b7195064_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__a6e2d8c5_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b7195064_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb7195064, "preVisitStructure", 56 };
+TypeInfo * __type_info__d90d9f18_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d90d9f18_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xd90d9f18, "preVisitStructureField", 60 };
+TypeInfo * __type_info__81db7c19_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__81db7c19_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x81db7c19, "visitStructureField", 64 };
+TypeInfo * __type_info__9ff71a7_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__a6e2d8c5_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__9ff71a7_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x9ff71a7, "visitStructure", 68 };
+TypeInfo * __type_info__edb84f8f_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__a6e2d8c5_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__edb84f8f_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xedb84f8f, "preVisitFunction", 72 };
+TypeInfo * __type_info__b247b012_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__a6e2d8c5_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__b247b012_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb247b012, "visitFunction", 76 };
+TypeInfo * __type_info__1a57faec_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1a57faec_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x1a57faec, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__fa49ad6d_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__fa49ad6d_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xfa49ad6d, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__8e19c99e_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8e19c99e_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x8e19c99e, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__8baca1cb_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8baca1cb_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x8baca1cb, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__59d26bc7_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__a6e2d8c5_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__59d26bc7_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x59d26bc7, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__f08f15f6_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__a6e2d8c5_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f08f15f6_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf08f15f6, "visitFunctionBody", 100 };
+TypeInfo * __type_info__38580ab1_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__38580ab1_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x38580ab1, "preVisitExpression", 104 };
+TypeInfo * __type_info__8ab30e7c_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8ab30e7c_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x8ab30e7c, "visitExpression", 108 };
+TypeInfo * __type_info__871a8595_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__a6e2d8c5_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__871a8595_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x871a8595, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__4caad24e_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__a6e2d8c5_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4caad24e_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x4caad24e, "visitExprBlock", 116 };
+TypeInfo * __type_info__49a94186_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__49a94186_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x49a94186, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__4f239829_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__4f239829_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x4f239829, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__d6c3d2fc_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d6c3d2fc_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xd6c3d2fc, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__b70d417_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b70d417_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xb70d417, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__cd38dbfb_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cd38dbfb_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xcd38dbfb, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__f38f670c_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f38f670c_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xf38f670c, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__dbcbf787_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__a6e2d8c5_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dbcbf787_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xdbcbf787, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__7c87c94a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__a6e2d8c5_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7c87c94a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x7c87c94a, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__df656d69_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__df656d69_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xdf656d69, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__9e4634d8_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9e4634d8_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x9e4634d8, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__6a0e64c1_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__a6e2d8c5_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6a0e64c1_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x6a0e64c1, "preVisitExprLet", 160 };
+TypeInfo * __type_info__2080551e_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__a6e2d8c5_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2080551e_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x2080551e, "visitExprLet", 164 };
+TypeInfo * __type_info__49337809_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__49337809_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x49337809, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__3500ec4a_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__3500ec4a_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x3500ec4a, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__8ecb0037_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8ecb0037_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x8ecb0037, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__b3d55520_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b3d55520_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xb3d55520, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__b35f2799_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__a6e2d8c5_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b35f2799_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb35f2799, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__dd7763ee_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__a6e2d8c5_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dd7763ee_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xdd7763ee, "visitGlobalLet", 188 };
+TypeInfo * __type_info__17d96d41_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__17d96d41_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x17d96d41, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__e22515a_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__e22515a_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xe22515a, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__17222b1f_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__17222b1f_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x17222b1f, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__e42e56d0_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e42e56d0_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xe42e56d0, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__f593eec8_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__a6e2d8c5_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f593eec8_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf593eec8, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__1ec2e313_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__a6e2d8c5_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1ec2e313_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x1ec2e313, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__e6e48890_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e6e48890_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xe6e48890, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__12320745_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__12320745_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x12320745, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__40296bfa_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__a6e2d8c5_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__40296bfa_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x40296bfa, "preVisitExprNew", 224 };
+TypeInfo * __type_info__e8aece05_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__a6e2d8c5_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e8aece05_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xe8aece05, "visitExprNew", 228 };
+TypeInfo * __type_info__582bd095_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__582bd095_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x582bd095, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__3b7fa296_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3b7fa296_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x3b7fa296, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__67637a0d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__a6e2d8c5_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__67637a0d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x67637a0d, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__9c124126_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__a6e2d8c5_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9c124126_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x9c124126, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__b4ea9e_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b4ea9e_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xb4ea9e, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__484e10a1_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__484e10a1_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x484e10a1, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__1b24584f_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__a6e2d8c5_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1b24584f_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x1b24584f, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__b7292eb0_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__a6e2d8c5_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b7292eb0_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb7292eb0, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__e3ed7bac_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e3ed7bac_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xe3ed7bac, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__a9387dbf_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a9387dbf_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xa9387dbf, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__e1173b5c_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__a6e2d8c5_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1173b5c_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xe1173b5c, "preVisitExprCall", 272 };
+TypeInfo * __type_info__295789d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__a6e2d8c5_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__295789d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x295789d, "visitExprCall", 276 };
+TypeInfo * __type_info__cc7bc1b_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc7bc1b_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xcc7bc1b, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__38a7314e_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__38a7314e_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x38a7314e, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__2859cff9_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__a6e2d8c5_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2859cff9_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x2859cff9, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__5edf1194_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__a6e2d8c5_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5edf1194_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x5edf1194, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__eb9e31ea_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__eb9e31ea_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xeb9e31ea, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__59368709_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__a6e2d8c5_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__59368709_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x59368709, "preVisitExprAt", 300 };
+TypeInfo * __type_info__e39e4e74_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__a6e2d8c5_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e39e4e74_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xe39e4e74, "visitExprAt", 304 };
+TypeInfo * __type_info__97c13f9f_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__97c13f9f_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x97c13f9f, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__7243b64_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__a6e2d8c5_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7243b64_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x7243b64, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__154a5f89_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__a6e2d8c5_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__154a5f89_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x154a5f89, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__6380f0c0_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6380f0c0_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x6380f0c0, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__6a218714_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__a6e2d8c5_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6a218714_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x6a218714, "preVisitExprIs", 324 };
+TypeInfo * __type_info__d28aabf9_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__a6e2d8c5_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d28aabf9_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd28aabf9, "visitExprIs", 328 };
+TypeInfo * __type_info__965c169c_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__a6e2d8c5_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__965c169c_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x965c169c, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__699ff8ab_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__a6e2d8c5_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__699ff8ab_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x699ff8ab, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__3efce0ac_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__a6e2d8c5_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3efce0ac_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x3efce0ac, "visitExprOp2", 340 };
+TypeInfo * __type_info__9e3c917f_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9e3c917f_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x9e3c917f, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__689ff718_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__a6e2d8c5_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__689ff718_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x689ff718, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__3ffce23f_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__a6e2d8c5_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3ffce23f_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x3ffce23f, "visitExprOp3", 352 };
+TypeInfo * __type_info__ac0224c9_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac0224c9_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xac0224c9, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__c00b486a_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c00b486a_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xc00b486a, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__8ff55541_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__a6e2d8c5_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8ff55541_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x8ff55541, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__14edeb60_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__a6e2d8c5_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__14edeb60_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x14edeb60, "visitExprCopy", 368 };
+TypeInfo * __type_info__ccec8af9_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ccec8af9_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xccec8af9, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__f0c85c89_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__a6e2d8c5_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f0c85c89_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf0c85c89, "preVisitExprMove", 376 };
+TypeInfo * __type_info__6601ba78_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__a6e2d8c5_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6601ba78_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x6601ba78, "visitExprMove", 380 };
+TypeInfo * __type_info__d852ec91_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d852ec91_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xd852ec91, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__5af9fbd1_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__a6e2d8c5_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5af9fbd1_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x5af9fbd1, "preVisitExprClone", 388 };
+TypeInfo * __type_info__c0b8844e_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__a6e2d8c5_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c0b8844e_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xc0b8844e, "visitExprClone", 392 };
+TypeInfo * __type_info__77c8db69_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__77c8db69_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x77c8db69, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__c19ea0d4_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__a6e2d8c5_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c19ea0d4_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xc19ea0d4, "preVisitExprWith", 400 };
+TypeInfo * __type_info__b1168bad_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__a6e2d8c5_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b1168bad_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb1168bad, "visitExprWith", 404 };
+TypeInfo * __type_info__3edb5270_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3edb5270_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x3edb5270, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__d4796351_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__a6e2d8c5_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d4796351_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd4796351, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__b66dff52_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__a6e2d8c5_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b66dff52_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb66dff52, "visitExprWhile", 416 };
+TypeInfo * __type_info__2f9a4741_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f9a4741_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x2f9a4741, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__8fdce0ec_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__a6e2d8c5_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8fdce0ec_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x8fdce0ec, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__871054a5_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__a6e2d8c5_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__871054a5_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x871054a5, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__59c81bc3_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__59c81bc3_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x59c81bc3, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__23b74d11_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__a6e2d8c5_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__23b74d11_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x23b74d11, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__466858f8_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__a6e2d8c5_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__466858f8_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x466858f8, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__262c78f_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__262c78f_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x262c78f, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__44a86e2d_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__44a86e2d_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0x44a86e2d, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__93a69d13_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__a6e2d8c5_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__93a69d13_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x93a69d13, "preVisitExprFor", 452 };
+TypeInfo * __type_info__5238421c_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__a6e2d8c5_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5238421c_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x5238421c, "visitExprFor", 456 };
+TypeInfo * __type_info__5987c2ff_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5987c2ff_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x5987c2ff, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__af351c14_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__af351c14_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xaf351c14, "visitExprForVariable", 464 };
+TypeInfo * __type_info__da475246_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__da475246_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xda475246, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__b8a62ea9_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b8a62ea9_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xb8a62ea9, "visitExprForSource", 472 };
+TypeInfo * __type_info__cc29b605_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__a6e2d8c5_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc29b605_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xcc29b605, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__d737429b_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__a6e2d8c5_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d737429b_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd737429b, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__467e4da7_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__a6e2d8c5_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__467e4da7_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x467e4da7, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__3d04d5e4_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__a6e2d8c5_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3d04d5e4_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x3d04d5e4, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__49811019_arg_types_var_2799884485[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__49811019_arg_types_var_2799884485, nullptr, 5, 0, nullptr, 28, 0x49811019, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__43facf98_arg_types_var_2799884485[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__43facf98_arg_types_var_2799884485, nullptr, 5, 0, nullptr, 28, 0x43facf98, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__2c9446e3_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__a6e2d8c5_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2c9446e3_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x2c9446e3, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__b74f0c7a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__a6e2d8c5_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b74f0c7a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb74f0c7a, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__4c0ae0f9_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c0ae0f9_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0x4c0ae0f9, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__e7d4504e_arg_types_var_2799884485[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e7d4504e_arg_types_var_2799884485, nullptr, 4, 0, nullptr, 28, 0xe7d4504e, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__dd1c267d_arg_types_var_2799884485[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dd1c267d_arg_types_var_2799884485, nullptr, 5, 0, nullptr, 28, 0xdd1c267d, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__c7269e2e_arg_types_var_2799884485[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__c7269e2e_arg_types_var_2799884485, nullptr, 5, 0, nullptr, 28, 0xc7269e2e, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__88efa8ff_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__a6e2d8c5_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88efa8ff_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x88efa8ff, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__135210e8_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__a6e2d8c5_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__135210e8_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x135210e8, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__2ca8ab25_arg_types_var_2799884485[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2ca8ab25_arg_types_var_2799884485, nullptr, 5, 0, nullptr, 28, 0x2ca8ab25, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__d49ed084_arg_types_var_2799884485[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d49ed084_arg_types_var_2799884485, nullptr, 5, 0, nullptr, 28, 0xd49ed084, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__8db8bc90_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__a6e2d8c5_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8db8bc90_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x8db8bc90, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__e90df193_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__a6e2d8c5_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e90df193_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xe90df193, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__c366986c_arg_types_var_2799884485[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c366986c_arg_types_var_2799884485, nullptr, 5, 0, nullptr, 28, 0xc366986c, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__7d10d569_arg_types_var_2799884485[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__a6e2d8c5_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7d10d569_arg_types_var_2799884485, nullptr, 5, 0, nullptr, 28, 0x7d10d569, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__1f86b8e3_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__a6e2d8c5_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1f86b8e3_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x1f86b8e3, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__de1e869a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__a6e2d8c5_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__de1e869a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xde1e869a, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__d4575e64_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d4575e64_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xd4575e64, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__acf25e8a_arg_types_var_2799884485[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__a6e2d8c5_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__acf25e8a_arg_types_var_2799884485, nullptr, 3, 0, nullptr, 28, 0xacf25e8a, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__2510b028_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__a6e2d8c5_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2510b028_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x2510b028, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__11e34a29_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__a6e2d8c5_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__11e34a29_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x11e34a29, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__ea880481_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__a6e2d8c5_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ea880481_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xea880481, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__165b28fa_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__a6e2d8c5_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__165b28fa_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x165b28fa, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__45ba146a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__a6e2d8c5_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__45ba146a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x45ba146a, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__63c353f1_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__a6e2d8c5_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__63c353f1_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x63c353f1, "visitExprLabel", 592 };
+TypeInfo * __type_info__7d70a6ef_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__a6e2d8c5_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7d70a6ef_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x7d70a6ef, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__cd362d8a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__a6e2d8c5_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cd362d8a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xcd362d8a, "visitExprGoto", 600 };
+TypeInfo * __type_info__a9b3f36_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__a6e2d8c5_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a9b3f36_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xa9b3f36, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__c6285a4d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__a6e2d8c5_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c6285a4d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xc6285a4d, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__f6f7b5fd_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__a6e2d8c5_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f6f7b5fd_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf6f7b5fd, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__f25e8ce_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__a6e2d8c5_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f25e8ce_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf25e8ce, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__4f19c1af_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__a6e2d8c5_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4f19c1af_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x4f19c1af, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__d748f56_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__a6e2d8c5_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d748f56_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd748f56, "visitExprAddr", 624 };
+TypeInfo * __type_info__9dd5fe8e_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__a6e2d8c5_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9dd5fe8e_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x9dd5fe8e, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__d0c5570f_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__a6e2d8c5_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d0c5570f_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd0c5570f, "visitExprAssert", 632 };
+TypeInfo * __type_info__9f9e2028_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__a6e2d8c5_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9f9e2028_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x9f9e2028, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__7d1f6821_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__a6e2d8c5_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7d1f6821_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x7d1f6821, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__41c5b40b_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__a6e2d8c5_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__41c5b40b_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x41c5b40b, "preVisitExprDebug", 644 };
+TypeInfo * __type_info__c6f695d4_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__a6e2d8c5_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c6f695d4_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xc6f695d4, "visitExprDebug", 648 };
+TypeInfo * __type_info__fdd22aac_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__a6e2d8c5_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fdd22aac_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xfdd22aac, "preVisitExprInvoke", 652 };
+TypeInfo * __type_info__f879f31_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__a6e2d8c5_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f879f31_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf879f31, "visitExprInvoke", 656 };
+TypeInfo * __type_info__b859fa96_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__a6e2d8c5_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b859fa96_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb859fa96, "preVisitExprErase", 660 };
+TypeInfo * __type_info__78d2e971_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__a6e2d8c5_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__78d2e971_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x78d2e971, "visitExprErase", 664 };
+TypeInfo * __type_info__6fecc66f_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__a6e2d8c5_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6fecc66f_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x6fecc66f, "preVisitExprFind", 668 };
+TypeInfo * __type_info__9382c726_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__a6e2d8c5_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9382c726_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x9382c726, "visitExprFind", 672 };
+TypeInfo * __type_info__f31c80db_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__a6e2d8c5_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f31c80db_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf31c80db, "preVisitExprKeyExists", 676 };
+TypeInfo * __type_info__ea5af670_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__a6e2d8c5_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ea5af670_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xea5af670, "visitExprKeyExists", 680 };
+TypeInfo * __type_info__ad0de3d2_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__a6e2d8c5_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad0de3d2_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xad0de3d2, "preVisitExprAscend", 684 };
+TypeInfo * __type_info__76deb203_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__a6e2d8c5_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__76deb203_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x76deb203, "visitExprAscend", 688 };
+TypeInfo * __type_info__cb3be993_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__a6e2d8c5_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cb3be993_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xcb3be993, "preVisitExprCast", 692 };
+TypeInfo * __type_info__188edf7a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__a6e2d8c5_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__188edf7a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x188edf7a, "visitExprCast", 696 };
+TypeInfo * __type_info__ead7a797_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__a6e2d8c5_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ead7a797_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xead7a797, "preVisitExprDelete", 700 };
+TypeInfo * __type_info__a308d1be_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__a6e2d8c5_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a308d1be_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xa308d1be, "visitExprDelete", 704 };
+TypeInfo * __type_info__de9b874d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__a6e2d8c5_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__de9b874d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xde9b874d, "preVisitExprVar", 708 };
+TypeInfo * __type_info__85227932_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__a6e2d8c5_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85227932_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x85227932, "visitExprVar", 712 };
+TypeInfo * __type_info__7a244520_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__a6e2d8c5_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7a244520_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x7a244520, "preVisitExprField", 716 };
+TypeInfo * __type_info__712ef8b3_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__a6e2d8c5_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__712ef8b3_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x712ef8b3, "visitExprField", 720 };
+TypeInfo * __type_info__908409e3_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__a6e2d8c5_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__908409e3_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x908409e3, "preVisitExprSafeField", 724 };
+TypeInfo * __type_info__f75632a0_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__a6e2d8c5_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f75632a0_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf75632a0, "visitExprSafeField", 728 };
+TypeInfo * __type_info__140a9c8a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__a6e2d8c5_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__140a9c8a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x140a9c8a, "preVisitExprSwizzle", 732 };
+TypeInfo * __type_info__62940135_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__a6e2d8c5_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__62940135_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x62940135, "visitExprSwizzle", 736 };
+TypeInfo * __type_info__53d8e8c5_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__a6e2d8c5_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__53d8e8c5_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x53d8e8c5, "preVisitExprIsVariant", 740 };
+TypeInfo * __type_info__5daec0ba_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__a6e2d8c5_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5daec0ba_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x5daec0ba, "visitExprIsVariant", 744 };
+TypeInfo * __type_info__28fb901d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__a6e2d8c5_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__28fb901d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x28fb901d, "preVisitExprAsVariant", 748 };
+TypeInfo * __type_info__c599af52_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__a6e2d8c5_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c599af52_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xc599af52, "visitExprAsVariant", 752 };
+TypeInfo * __type_info__86e166c2_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__a6e2d8c5_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__86e166c2_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x86e166c2, "preVisitExprSafeAsVariant", 756 };
+TypeInfo * __type_info__94bed59d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__a6e2d8c5_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__94bed59d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x94bed59d, "visitExprSafeAsVariant", 760 };
+TypeInfo * __type_info__6a9ffa3e_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__a6e2d8c5_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6a9ffa3e_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x6a9ffa3e, "preVisitExprOp1", 764 };
+TypeInfo * __type_info__41fce565_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__a6e2d8c5_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__41fce565_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x41fce565, "visitExprOp1", 768 };
+TypeInfo * __type_info__f680f7e2_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__a6e2d8c5_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f680f7e2_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf680f7e2, "preVisitExprReturn", 772 };
+TypeInfo * __type_info__9ec3db23_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__a6e2d8c5_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9ec3db23_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x9ec3db23, "visitExprReturn", 776 };
+TypeInfo * __type_info__e61118fd_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__a6e2d8c5_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e61118fd_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xe61118fd, "preVisitExprYield", 780 };
+TypeInfo * __type_info__a3e37f22_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__a6e2d8c5_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a3e37f22_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xa3e37f22, "visitExprYield", 784 };
+TypeInfo * __type_info__fc59ba5b_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__a6e2d8c5_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fc59ba5b_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xfc59ba5b, "preVisitExprBreak", 788 };
+TypeInfo * __type_info__8d5808fc_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__a6e2d8c5_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8d5808fc_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x8d5808fc, "visitExprBreak", 792 };
+TypeInfo * __type_info__b9cbab3d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__a6e2d8c5_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b9cbab3d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb9cbab3d, "preVisitExprContinue", 796 };
+TypeInfo * __type_info__39479b18_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__a6e2d8c5_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__39479b18_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x39479b18, "visitExprContinue", 800 };
+TypeInfo * __type_info__56302653_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__a6e2d8c5_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__56302653_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x56302653, "preVisitExprMakeBlock", 804 };
+TypeInfo * __type_info__f0f679cc_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__a6e2d8c5_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f0f679cc_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf0f679cc, "visitExprMakeBlock", 808 };
+TypeInfo * __type_info__b9d9aeeb_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__a6e2d8c5_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b9d9aeeb_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb9d9aeeb, "preVisitExprMakeGenerator", 812 };
+TypeInfo * __type_info__20d61058_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__a6e2d8c5_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__20d61058_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x20d61058, "visitExprMakeGenerator", 816 };
+TypeInfo * __type_info__4eb06dab_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__a6e2d8c5_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4eb06dab_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x4eb06dab, "preVisitExprMemZero", 820 };
+TypeInfo * __type_info__4bec5f30_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__a6e2d8c5_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4bec5f30_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x4bec5f30, "visitExprMemZero", 824 };
+TypeInfo * __type_info__dfd72bdf_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__a6e2d8c5_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dfd72bdf_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xdfd72bdf, "preVisitExprConst", 828 };
+TypeInfo * __type_info__26559778_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__a6e2d8c5_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__26559778_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x26559778, "visitExprConst", 832 };
+TypeInfo * __type_info__2b4fabb_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__a6e2d8c5_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2b4fabb_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x2b4fabb, "preVisitExprConstPtr", 836 };
+TypeInfo * __type_info__3aa821a2_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__a6e2d8c5_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3aa821a2_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x3aa821a2, "visitExprConstPtr", 840 };
+TypeInfo * __type_info__8f9ddf9a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__a6e2d8c5_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8f9ddf9a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x8f9ddf9a, "preVisitExprConstEnumeration", 844 };
+TypeInfo * __type_info__54d36777_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__a6e2d8c5_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__54d36777_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x54d36777, "visitExprConstEnumeration", 848 };
+TypeInfo * __type_info__6ed5dbee_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__a6e2d8c5_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6ed5dbee_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x6ed5dbee, "preVisitExprConstBitfield", 852 };
+TypeInfo * __type_info__9b3fa77d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__a6e2d8c5_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9b3fa77d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x9b3fa77d, "visitExprConstBitfield", 856 };
+TypeInfo * __type_info__e1120458_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__a6e2d8c5_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1120458_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xe1120458, "preVisitExprConstInt8", 860 };
+TypeInfo * __type_info__ca46e853_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__a6e2d8c5_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ca46e853_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xca46e853, "visitExprConstInt8", 864 };
+TypeInfo * __type_info__af4b99ff_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__a6e2d8c5_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af4b99ff_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xaf4b99ff, "preVisitExprConstInt16", 868 };
+TypeInfo * __type_info__e0b1362a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__a6e2d8c5_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e0b1362a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xe0b1362a, "visitExprConstInt16", 872 };
+TypeInfo * __type_info__2f579c72_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__a6e2d8c5_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f579c72_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x2f579c72, "preVisitExprConstInt64", 876 };
+TypeInfo * __type_info__e0c27f4b_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__a6e2d8c5_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e0c27f4b_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xe0c27f4b, "visitExprConstInt64", 880 };
+TypeInfo * __type_info__ecb00170_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__a6e2d8c5_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ecb00170_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xecb00170, "preVisitExprConstInt", 884 };
+TypeInfo * __type_info__1038b679_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__a6e2d8c5_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1038b679_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x1038b679, "visitExprConstInt", 888 };
+TypeInfo * __type_info__db11fae6_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__a6e2d8c5_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__db11fae6_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xdb11fae6, "preVisitExprConstInt2", 892 };
+TypeInfo * __type_info__d446f811_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__a6e2d8c5_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d446f811_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd446f811, "visitExprConstInt2", 896 };
+TypeInfo * __type_info__dc11fc79_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__a6e2d8c5_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dc11fc79_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xdc11fc79, "preVisitExprConstInt3", 900 };
+TypeInfo * __type_info__d346f67e_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__a6e2d8c5_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d346f67e_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd346f67e, "visitExprConstInt3", 904 };
+TypeInfo * __type_info__dd11fe0c_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__a6e2d8c5_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dd11fe0c_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xdd11fe0c, "preVisitExprConstInt4", 908 };
+TypeInfo * __type_info__d646fb37_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__a6e2d8c5_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d646fb37_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd646fb37, "visitExprConstInt4", 912 };
+TypeInfo * __type_info__a6af2d15_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__a6e2d8c5_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a6af2d15_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xa6af2d15, "preVisitExprConstUInt8", 916 };
+TypeInfo * __type_info__362c96a0_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__a6e2d8c5_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__362c96a0_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x362c96a0, "visitExprConstUInt8", 920 };
+TypeInfo * __type_info__96d56d44_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__a6e2d8c5_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__96d56d44_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x96d56d44, "preVisitExprConstUInt16", 924 };
+TypeInfo * __type_info__7047ba47_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__a6e2d8c5_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7047ba47_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x7047ba47, "visitExprConstUInt16", 928 };
+TypeInfo * __type_info__9ac8a79d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__a6e2d8c5_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9ac8a79d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x9ac8a79d, "preVisitExprConstUInt64", 932 };
+TypeInfo * __type_info__f053bcba_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__a6e2d8c5_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f053bcba_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf053bcba, "visitExprConstUInt64", 936 };
+TypeInfo * __type_info__45d5df8f_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__a6e2d8c5_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__45d5df8f_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x45d5df8f, "preVisitExprConstUInt", 940 };
+TypeInfo * __type_info__8e81b2d8_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__a6e2d8c5_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8e81b2d8_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x8e81b2d8, "visitExprConstUInt", 944 };
+TypeInfo * __type_info__acaf3687_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__a6e2d8c5_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__acaf3687_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xacaf3687, "preVisitExprConstUInt2", 948 };
+TypeInfo * __type_info__402ca65e_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__a6e2d8c5_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__402ca65e_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x402ca65e, "visitExprConstUInt2", 952 };
+TypeInfo * __type_info__abaf34f4_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__a6e2d8c5_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__abaf34f4_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xabaf34f4, "preVisitExprConstUInt3", 956 };
+TypeInfo * __type_info__412ca7f1_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__a6e2d8c5_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__412ca7f1_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x412ca7f1, "visitExprConstUInt3", 960 };
+TypeInfo * __type_info__aaaf3361_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__a6e2d8c5_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aaaf3361_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xaaaf3361, "preVisitExprConstUInt4", 964 };
+TypeInfo * __type_info__422ca984_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__a6e2d8c5_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__422ca984_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x422ca984, "visitExprConstUInt4", 968 };
+TypeInfo * __type_info__53570c94_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__a6e2d8c5_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__53570c94_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x53570c94, "preVisitExprConstRange", 972 };
+TypeInfo * __type_info__811d954d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__a6e2d8c5_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__811d954d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x811d954d, "visitExprConstRange", 976 };
+TypeInfo * __type_info__2e829a6b_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__a6e2d8c5_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2e829a6b_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x2e829a6b, "preVisitExprConstURange", 980 };
+TypeInfo * __type_info__bfcb048c_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__a6e2d8c5_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__bfcb048c_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xbfcb048c, "visitExprConstURange", 984 };
+TypeInfo * __type_info__f96d7afb_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__a6e2d8c5_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f96d7afb_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xf96d7afb, "preVisitExprConstBool", 988 };
+TypeInfo * __type_info__2479d068_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__a6e2d8c5_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2479d068_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x2479d068, "visitExprConstBool", 992 };
+TypeInfo * __type_info__7288f76b_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__a6e2d8c5_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7288f76b_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x7288f76b, "preVisitExprConstFloat", 996 };
+TypeInfo * __type_info__c23f4a42_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__a6e2d8c5_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c23f4a42_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xc23f4a42, "visitExprConstFloat", 1000 };
+TypeInfo * __type_info__a69d611b_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__a6e2d8c5_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a69d611b_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xa69d611b, "preVisitExprConstFloat2", 1004 };
+TypeInfo * __type_info__39a22e50_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__a6e2d8c5_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__39a22e50_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x39a22e50, "visitExprConstFloat2", 1008 };
+TypeInfo * __type_info__a59d5f88_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__a6e2d8c5_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a59d5f88_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xa59d5f88, "preVisitExprConstFloat3", 1012 };
+TypeInfo * __type_info__3aa22fe3_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__a6e2d8c5_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3aa22fe3_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x3aa22fe3, "visitExprConstFloat3", 1016 };
+TypeInfo * __type_info__ac9d6a8d_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__a6e2d8c5_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac9d6a8d_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xac9d6a8d, "preVisitExprConstFloat4", 1020 };
+TypeInfo * __type_info__3fa237c2_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__a6e2d8c5_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3fa237c2_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x3fa237c2, "visitExprConstFloat4", 1024 };
+TypeInfo * __type_info__d671222a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__a6e2d8c5_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d671222a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd671222a, "preVisitExprConstString", 1028 };
+TypeInfo * __type_info__df621be1_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__a6e2d8c5_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__df621be1_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xdf621be1, "visitExprConstString", 1032 };
+TypeInfo * __type_info__7fb86212_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__a6e2d8c5_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7fb86212_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x7fb86212, "preVisitExprConstDouble", 1036 };
+TypeInfo * __type_info__b9c76a25_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__a6e2d8c5_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b9c76a25_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xb9c76a25, "visitExprConstDouble", 1040 };
+TypeInfo * __type_info__839dc51c_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__a6e2d8c5_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__839dc51c_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x839dc51c, "preVisitExprFakeContext", 1044 };
+TypeInfo * __type_info__bebd7bb_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__a6e2d8c5_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__bebd7bb_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xbebd7bb, "visitExprFakeContext", 1048 };
+TypeInfo * __type_info__cae93403_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__a6e2d8c5_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cae93403_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xcae93403, "preVisitExprFakeLineInfo", 1052 };
+TypeInfo * __type_info__9eeb822a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__a6e2d8c5_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9eeb822a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x9eeb822a, "visitExprFakeLineInfo", 1056 };
+TypeInfo * __type_info__351a0bc7_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__a6e2d8c5_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__351a0bc7_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x351a0bc7, "preVisitExprReader", 1060 };
+TypeInfo * __type_info__768ca6f2_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__a6e2d8c5_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__768ca6f2_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x768ca6f2, "visitExprReader", 1064 };
+TypeInfo * __type_info__d210f17a_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__a6e2d8c5_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d210f17a_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xd210f17a, "preVisitExprUnsafe", 1068 };
+TypeInfo * __type_info__ac60830b_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__a6e2d8c5_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ac60830b_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xac60830b, "visitExprUnsafe", 1072 };
+TypeInfo * __type_info__c9f80448_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__a6e2d8c5_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c9f80448_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0xc9f80448, "preVisitExprCallMacro", 1076 };
+TypeInfo * __type_info__1055523b_arg_types_var_2799884485[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__a6e2d8c5_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1055523b_arg_types_var_2799884485, nullptr, 2, 0, nullptr, 28, 0x1055523b, "visitExprCallMacro", 1080 };
+VarInfo __struct_info__a6e2d8c5_field_270 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xfec8f29, "changed", 1084 };
+VarInfo __struct_info__a6e2d8c5_field_271 =  { Type::tTable, nullptr, nullptr, nullptr, &__type_info__17c16538, &__type_info__ab4a876a, nullptr, nullptr, 0, 0, nullptr, 2, 0x4c7d7178, "loopIterators", 1088 };
+VarInfo * __struct_info__a6e2d8c5_fields[272] =  { &__struct_info__a6e2d8c5_field_0, &__struct_info__a6e2d8c5_field_1, &__struct_info__a6e2d8c5_field_2, &__struct_info__a6e2d8c5_field_3, &__struct_info__a6e2d8c5_field_4, &__struct_info__a6e2d8c5_field_5, &__struct_info__a6e2d8c5_field_6, &__struct_info__a6e2d8c5_field_7, &__struct_info__a6e2d8c5_field_8, &__struct_info__a6e2d8c5_field_9, &__struct_info__a6e2d8c5_field_10, &__struct_info__a6e2d8c5_field_11, &__struct_info__a6e2d8c5_field_12, &__struct_info__a6e2d8c5_field_13, &__struct_info__a6e2d8c5_field_14, &__struct_info__a6e2d8c5_field_15, &__struct_info__a6e2d8c5_field_16, &__struct_info__a6e2d8c5_field_17, &__struct_info__a6e2d8c5_field_18, &__struct_info__a6e2d8c5_field_19, &__struct_info__a6e2d8c5_field_20, &__struct_info__a6e2d8c5_field_21, &__struct_info__a6e2d8c5_field_22, &__struct_info__a6e2d8c5_field_23, &__struct_info__a6e2d8c5_field_24, &__struct_info__a6e2d8c5_field_25, &__struct_info__a6e2d8c5_field_26, &__struct_info__a6e2d8c5_field_27, &__struct_info__a6e2d8c5_field_28, &__struct_info__a6e2d8c5_field_29, &__struct_info__a6e2d8c5_field_30, &__struct_info__a6e2d8c5_field_31, &__struct_info__a6e2d8c5_field_32, &__struct_info__a6e2d8c5_field_33, &__struct_info__a6e2d8c5_field_34, &__struct_info__a6e2d8c5_field_35, &__struct_info__a6e2d8c5_field_36, &__struct_info__a6e2d8c5_field_37, &__struct_info__a6e2d8c5_field_38, &__struct_info__a6e2d8c5_field_39, &__struct_info__a6e2d8c5_field_40, &__struct_info__a6e2d8c5_field_41, &__struct_info__a6e2d8c5_field_42, &__struct_info__a6e2d8c5_field_43, &__struct_info__a6e2d8c5_field_44, &__struct_info__a6e2d8c5_field_45, &__struct_info__a6e2d8c5_field_46, &__struct_info__a6e2d8c5_field_47, &__struct_info__a6e2d8c5_field_48, &__struct_info__a6e2d8c5_field_49, &__struct_info__a6e2d8c5_field_50, &__struct_info__a6e2d8c5_field_51, &__struct_info__a6e2d8c5_field_52, &__struct_info__a6e2d8c5_field_53, &__struct_info__a6e2d8c5_field_54, &__struct_info__a6e2d8c5_field_55, &__struct_info__a6e2d8c5_field_56, &__struct_info__a6e2d8c5_field_57, &__struct_info__a6e2d8c5_field_58, &__struct_info__a6e2d8c5_field_59, &__struct_info__a6e2d8c5_field_60, &__struct_info__a6e2d8c5_field_61, &__struct_info__a6e2d8c5_field_62, &__struct_info__a6e2d8c5_field_63, &__struct_info__a6e2d8c5_field_64, &__struct_info__a6e2d8c5_field_65, &__struct_info__a6e2d8c5_field_66, &__struct_info__a6e2d8c5_field_67, &__struct_info__a6e2d8c5_field_68, &__struct_info__a6e2d8c5_field_69, &__struct_info__a6e2d8c5_field_70, &__struct_info__a6e2d8c5_field_71, &__struct_info__a6e2d8c5_field_72, &__struct_info__a6e2d8c5_field_73, &__struct_info__a6e2d8c5_field_74, &__struct_info__a6e2d8c5_field_75, &__struct_info__a6e2d8c5_field_76, &__struct_info__a6e2d8c5_field_77, &__struct_info__a6e2d8c5_field_78, &__struct_info__a6e2d8c5_field_79, &__struct_info__a6e2d8c5_field_80, &__struct_info__a6e2d8c5_field_81, &__struct_info__a6e2d8c5_field_82, &__struct_info__a6e2d8c5_field_83, &__struct_info__a6e2d8c5_field_84, &__struct_info__a6e2d8c5_field_85, &__struct_info__a6e2d8c5_field_86, &__struct_info__a6e2d8c5_field_87, &__struct_info__a6e2d8c5_field_88, &__struct_info__a6e2d8c5_field_89, &__struct_info__a6e2d8c5_field_90, &__struct_info__a6e2d8c5_field_91, &__struct_info__a6e2d8c5_field_92, &__struct_info__a6e2d8c5_field_93, &__struct_info__a6e2d8c5_field_94, &__struct_info__a6e2d8c5_field_95, &__struct_info__a6e2d8c5_field_96, &__struct_info__a6e2d8c5_field_97, &__struct_info__a6e2d8c5_field_98, &__struct_info__a6e2d8c5_field_99, &__struct_info__a6e2d8c5_field_100, &__struct_info__a6e2d8c5_field_101, &__struct_info__a6e2d8c5_field_102, &__struct_info__a6e2d8c5_field_103, &__struct_info__a6e2d8c5_field_104, &__struct_info__a6e2d8c5_field_105, &__struct_info__a6e2d8c5_field_106, &__struct_info__a6e2d8c5_field_107, &__struct_info__a6e2d8c5_field_108, &__struct_info__a6e2d8c5_field_109, &__struct_info__a6e2d8c5_field_110, &__struct_info__a6e2d8c5_field_111, &__struct_info__a6e2d8c5_field_112, &__struct_info__a6e2d8c5_field_113, &__struct_info__a6e2d8c5_field_114, &__struct_info__a6e2d8c5_field_115, &__struct_info__a6e2d8c5_field_116, &__struct_info__a6e2d8c5_field_117, &__struct_info__a6e2d8c5_field_118, &__struct_info__a6e2d8c5_field_119, &__struct_info__a6e2d8c5_field_120, &__struct_info__a6e2d8c5_field_121, &__struct_info__a6e2d8c5_field_122, &__struct_info__a6e2d8c5_field_123, &__struct_info__a6e2d8c5_field_124, &__struct_info__a6e2d8c5_field_125, &__struct_info__a6e2d8c5_field_126, &__struct_info__a6e2d8c5_field_127, &__struct_info__a6e2d8c5_field_128, &__struct_info__a6e2d8c5_field_129, &__struct_info__a6e2d8c5_field_130, &__struct_info__a6e2d8c5_field_131, &__struct_info__a6e2d8c5_field_132, &__struct_info__a6e2d8c5_field_133, &__struct_info__a6e2d8c5_field_134, &__struct_info__a6e2d8c5_field_135, &__struct_info__a6e2d8c5_field_136, &__struct_info__a6e2d8c5_field_137, &__struct_info__a6e2d8c5_field_138, &__struct_info__a6e2d8c5_field_139, &__struct_info__a6e2d8c5_field_140, &__struct_info__a6e2d8c5_field_141, &__struct_info__a6e2d8c5_field_142, &__struct_info__a6e2d8c5_field_143, &__struct_info__a6e2d8c5_field_144, &__struct_info__a6e2d8c5_field_145, &__struct_info__a6e2d8c5_field_146, &__struct_info__a6e2d8c5_field_147, &__struct_info__a6e2d8c5_field_148, &__struct_info__a6e2d8c5_field_149, &__struct_info__a6e2d8c5_field_150, &__struct_info__a6e2d8c5_field_151, &__struct_info__a6e2d8c5_field_152, &__struct_info__a6e2d8c5_field_153, &__struct_info__a6e2d8c5_field_154, &__struct_info__a6e2d8c5_field_155, &__struct_info__a6e2d8c5_field_156, &__struct_info__a6e2d8c5_field_157, &__struct_info__a6e2d8c5_field_158, &__struct_info__a6e2d8c5_field_159, &__struct_info__a6e2d8c5_field_160, &__struct_info__a6e2d8c5_field_161, &__struct_info__a6e2d8c5_field_162, &__struct_info__a6e2d8c5_field_163, &__struct_info__a6e2d8c5_field_164, &__struct_info__a6e2d8c5_field_165, &__struct_info__a6e2d8c5_field_166, &__struct_info__a6e2d8c5_field_167, &__struct_info__a6e2d8c5_field_168, &__struct_info__a6e2d8c5_field_169, &__struct_info__a6e2d8c5_field_170, &__struct_info__a6e2d8c5_field_171, &__struct_info__a6e2d8c5_field_172, &__struct_info__a6e2d8c5_field_173, &__struct_info__a6e2d8c5_field_174, &__struct_info__a6e2d8c5_field_175, &__struct_info__a6e2d8c5_field_176, &__struct_info__a6e2d8c5_field_177, &__struct_info__a6e2d8c5_field_178, &__struct_info__a6e2d8c5_field_179, &__struct_info__a6e2d8c5_field_180, &__struct_info__a6e2d8c5_field_181, &__struct_info__a6e2d8c5_field_182, &__struct_info__a6e2d8c5_field_183, &__struct_info__a6e2d8c5_field_184, &__struct_info__a6e2d8c5_field_185, &__struct_info__a6e2d8c5_field_186, &__struct_info__a6e2d8c5_field_187, &__struct_info__a6e2d8c5_field_188, &__struct_info__a6e2d8c5_field_189, &__struct_info__a6e2d8c5_field_190, &__struct_info__a6e2d8c5_field_191, &__struct_info__a6e2d8c5_field_192, &__struct_info__a6e2d8c5_field_193, &__struct_info__a6e2d8c5_field_194, &__struct_info__a6e2d8c5_field_195, &__struct_info__a6e2d8c5_field_196, &__struct_info__a6e2d8c5_field_197, &__struct_info__a6e2d8c5_field_198, &__struct_info__a6e2d8c5_field_199, &__struct_info__a6e2d8c5_field_200, &__struct_info__a6e2d8c5_field_201, &__struct_info__a6e2d8c5_field_202, &__struct_info__a6e2d8c5_field_203, &__struct_info__a6e2d8c5_field_204, &__struct_info__a6e2d8c5_field_205, &__struct_info__a6e2d8c5_field_206, &__struct_info__a6e2d8c5_field_207, &__struct_info__a6e2d8c5_field_208, &__struct_info__a6e2d8c5_field_209, &__struct_info__a6e2d8c5_field_210, &__struct_info__a6e2d8c5_field_211, &__struct_info__a6e2d8c5_field_212, &__struct_info__a6e2d8c5_field_213, &__struct_info__a6e2d8c5_field_214, &__struct_info__a6e2d8c5_field_215, &__struct_info__a6e2d8c5_field_216, &__struct_info__a6e2d8c5_field_217, &__struct_info__a6e2d8c5_field_218, &__struct_info__a6e2d8c5_field_219, &__struct_info__a6e2d8c5_field_220, &__struct_info__a6e2d8c5_field_221, &__struct_info__a6e2d8c5_field_222, &__struct_info__a6e2d8c5_field_223, &__struct_info__a6e2d8c5_field_224, &__struct_info__a6e2d8c5_field_225, &__struct_info__a6e2d8c5_field_226, &__struct_info__a6e2d8c5_field_227, &__struct_info__a6e2d8c5_field_228, &__struct_info__a6e2d8c5_field_229, &__struct_info__a6e2d8c5_field_230, &__struct_info__a6e2d8c5_field_231, &__struct_info__a6e2d8c5_field_232, &__struct_info__a6e2d8c5_field_233, &__struct_info__a6e2d8c5_field_234, &__struct_info__a6e2d8c5_field_235, &__struct_info__a6e2d8c5_field_236, &__struct_info__a6e2d8c5_field_237, &__struct_info__a6e2d8c5_field_238, &__struct_info__a6e2d8c5_field_239, &__struct_info__a6e2d8c5_field_240, &__struct_info__a6e2d8c5_field_241, &__struct_info__a6e2d8c5_field_242, &__struct_info__a6e2d8c5_field_243, &__struct_info__a6e2d8c5_field_244, &__struct_info__a6e2d8c5_field_245, &__struct_info__a6e2d8c5_field_246, &__struct_info__a6e2d8c5_field_247, &__struct_info__a6e2d8c5_field_248, &__struct_info__a6e2d8c5_field_249, &__struct_info__a6e2d8c5_field_250, &__struct_info__a6e2d8c5_field_251, &__struct_info__a6e2d8c5_field_252, &__struct_info__a6e2d8c5_field_253, &__struct_info__a6e2d8c5_field_254, &__struct_info__a6e2d8c5_field_255, &__struct_info__a6e2d8c5_field_256, &__struct_info__a6e2d8c5_field_257, &__struct_info__a6e2d8c5_field_258, &__struct_info__a6e2d8c5_field_259, &__struct_info__a6e2d8c5_field_260, &__struct_info__a6e2d8c5_field_261, &__struct_info__a6e2d8c5_field_262, &__struct_info__a6e2d8c5_field_263, &__struct_info__a6e2d8c5_field_264, &__struct_info__a6e2d8c5_field_265, &__struct_info__a6e2d8c5_field_266, &__struct_info__a6e2d8c5_field_267, &__struct_info__a6e2d8c5_field_268, &__struct_info__a6e2d8c5_field_269, &__struct_info__a6e2d8c5_field_270, &__struct_info__a6e2d8c5_field_271 };
+StructInfo __struct_info__a6e2d8c5 = {"SoaIndexVisitor", __struct_info__a6e2d8c5_fields, 272, 1136, -1, nullptr, 0xa6e2d8c5 };
+VarInfo __struct_info__f338bdeb_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x1d5466ee, "soa", 0 };
+VarInfo __struct_info__f338bdeb_field_1 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x847a0de8, "fields", 8 };
+VarInfo __struct_info__f338bdeb_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x2db38041, "uses", 32 };
+VarInfo __struct_info__f338bdeb_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x5b52b3a0, "failed", 36 };
+VarInfo __struct_info__f338bdeb_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf0052568, "columns", 40 };
+VarInfo * __struct_info__f338bdeb_fields[5] =  { &__struct_info__f338bdeb_field_0, &__struct_info__f338bdeb_field_1, &__struct_info__f338bdeb_field_2, &__struct_info__f338bdeb_field_3, &__struct_info__f338bdeb_field_4 };
+StructInfo __struct_info__f338bdeb = {"SoaLoopIterator", __struct_info__f338bdeb_fields, 5, 64, -1, nullptr, 0xf338bdeb };
+VarInfo __struct_info__d8299e85_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1dd0d240, "__rtti", 0 };
+TypeInfo * __type_info__1c9914bb_arg_types_var_3626606213[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__d8299e85_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c9914bb_arg_types_var_3626606213, nullptr, 1, 0, nullptr, 28, 0x1c9914bb, "__finalize", 8 };
+TypeInfo * __type_info__e1345261_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1345261_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe1345261, "preVisitProgram", 12 };
+TypeInfo * __type_info__f902c2de_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f902c2de_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf902c2de, "visitProgram", 16 };
+TypeInfo * __type_info__6d3d92b1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d3d92b1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6d3d92b1, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__7acd6d0b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7acd6d0b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7acd6d0b, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__9edcbce_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__9edcbce_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9edcbce, "visitTypeDecl", 28 };
+TypeInfo * __type_info__4c957b89_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__d8299e85_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c957b89_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x4c957b89, "preVisitAlias", 32 };
+TypeInfo * __type_info__2cbdc12a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__d8299e85_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__2cbdc12a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x2cbdc12a, "visitAlias", 36 };
+TypeInfo * __type_info__7ea03b0a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__d8299e85_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7ea03b0a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7ea03b0a, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__7607b7d3_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7607b7d3_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x7607b7d3, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__a92f607e_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a92f607e_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xa92f607e, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__134ae51_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__d8299e85_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__134ae51_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x134ae51, "visitEnumeration", 52 };
+TypeInfo * __type_info__327e2124_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__d8299e85_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__327e2124_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x327e2124, "preVisitStructure", 56 };
+TypeInfo * __type_info__c2ec29d8_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c2ec29d8_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xc2ec29d8, "preVisitStructureField", 60 };
+TypeInfo * __type_info__e4eb34d9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4eb34d9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xe4eb34d9, "visitStructureField", 64 };
+TypeInfo * __type_info__6c97d67_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__d8299e85_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__6c97d67_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6c97d67, "visitStructure", 68 };
+TypeInfo * __type_info__7447bb4f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7447bb4f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7447bb4f, "preVisitFunction", 72 };
+TypeInfo * __type_info__c6bf2bd2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__c6bf2bd2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc6bf2bd2, "visitFunction", 76 };
+TypeInfo * __type_info__63a3eac_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__63a3eac_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x63a3eac, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__5fa0ff2d_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__5fa0ff2d_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5fa0ff2d, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__ad56015e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad56015e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xad56015e, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__f4999d8b_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f4999d8b_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xf4999d8b, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__f25a787_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f25a787_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf25a787, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__d76915b6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d76915b6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd76915b6, "visitFunctionBody", 100 };
+TypeInfo * __type_info__af00471_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af00471_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaf00471, "preVisitExpression", 104 };
+TypeInfo * __type_info__a246be3c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a246be3c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa246be3c, "visitExpression", 108 };
+TypeInfo * __type_info__2c383e55_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2c383e55_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2c383e55, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__7a87bd0e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7a87bd0e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7a87bd0e, "visitExprBlock", 116 };
+TypeInfo * __type_info__dc873d46_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dc873d46_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xdc873d46, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__f891e8e9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__f891e8e9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xf891e8e9, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__5bede5bc_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5bede5bc_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5bede5bc, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__4a66add7_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4a66add7_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x4a66add7, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__b35acbb_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b35acbb_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb35acbb, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__d6c089cc_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d6c089cc_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xd6c089cc, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__6fc12b47_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6fc12b47_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6fc12b47, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__8644430a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8644430a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8644430a, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__fde3ac29_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fde3ac29_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xfde3ac29, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__89631998_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__89631998_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x89631998, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__bd3bde81_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__d8299e85_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bd3bde81_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbd3bde81, "preVisitExprLet", 160 };
+TypeInfo * __type_info__1c56de_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__d8299e85_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1c56de_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1c56de, "visitExprLet", 164 };
+TypeInfo * __type_info__4ea380c9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4ea380c9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x4ea380c9, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__d7a0c00a_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__d7a0c00a_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xd7a0c00a, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__dcd95cf7_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dcd95cf7_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xdcd95cf7, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__5e90f2e0_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5e90f2e0_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5e90f2e0, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__284e759_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__284e759_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x284e759, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__554a21ae_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__554a21ae_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x554a21ae, "visitGlobalLet", 188 };
+TypeInfo * __type_info__a6016d01_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a6016d01_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xa6016d01, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__3b14171a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__3b14171a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x3b14171a, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__78bcb4df_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__78bcb4df_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x78bcb4df, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__6521e890_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6521e890_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x6521e890, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__aefafc88_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__d8299e85_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aefafc88_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaefafc88, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__75c92fd3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__d8299e85_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__75c92fd3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x75c92fd3, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__6eaa7d50_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6eaa7d50_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x6eaa7d50, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__ad5a0405_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ad5a0405_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xad5a0405, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__9356e5ba_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__d8299e85_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9356e5ba_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9356e5ba, "preVisitExprNew", 224 };
+TypeInfo * __type_info__c84acfc5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__d8299e85_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c84acfc5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc84acfc5, "visitExprNew", 228 };
+TypeInfo * __type_info__a9b0cc55_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a9b0cc55_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa9b0cc55, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__7cfe7756_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7cfe7756_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x7cfe7756, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__915be3cd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__d8299e85_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__915be3cd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x915be3cd, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__85473ce6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__d8299e85_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85473ce6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x85473ce6, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__345035e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__345035e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x345035e, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__c053d161_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__c053d161_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xc053d161, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__359e840f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__d8299e85_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__359e840f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x359e840f, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__c32d1370_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__d8299e85_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c32d1370_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc32d1370, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__31003f6c_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31003f6c_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x31003f6c, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__442b5d7f_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__442b5d7f_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x442b5d7f, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__11aeae1c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__d8299e85_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__11aeae1c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x11aeae1c, "preVisitExprCall", 272 };
+TypeInfo * __type_info__2965e55d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__d8299e85_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2965e55d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2965e55d, "visitExprCall", 276 };
+TypeInfo * __type_info__cdf950db_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cdf950db_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xcdf950db, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__a343220e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a343220e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa343220e, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__ac29e6b9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__d8299e85_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac29e6b9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xac29e6b9, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__2663c954_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__d8299e85_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2663c954_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2663c954, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__f3715aaa_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f3715aaa_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf3715aaa, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__bb163ec9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__d8299e85_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bb163ec9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbb163ec9, "preVisitExprAt", 300 };
+TypeInfo * __type_info__888bf034_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__d8299e85_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__888bf034_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x888bf034, "visitExprAt", 304 };
+TypeInfo * __type_info__43f7c55f_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43f7c55f_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x43f7c55f, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__aff78d24_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__d8299e85_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aff78d24_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaff78d24, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__880f2249_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__d8299e85_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__880f2249_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x880f2249, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__e1903c80_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1903c80_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xe1903c80, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__cc02d1d4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__d8299e85_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc02d1d4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcc02d1d4, "preVisitExprIs", 324 };
+TypeInfo * __type_info__7776bab9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__d8299e85_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7776bab9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7776bab9, "visitExprIs", 328 };
+TypeInfo * __type_info__3cb36c5c_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3cb36c5c_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x3cb36c5c, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__3f48a4eb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__d8299e85_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3f48a4eb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3f48a4eb, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__9e9818ec_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__d8299e85_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9e9818ec_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9e9818ec, "visitExprOp2", 340 };
+TypeInfo * __type_info__b7d4d4bf_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b7d4d4bf_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb7d4d4bf, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__3e48a358_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__d8299e85_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3e48a358_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3e48a358, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__9f981a7f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__d8299e85_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9f981a7f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9f981a7f, "visitExprOp3", 352 };
+TypeInfo * __type_info__eee3bc09_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__eee3bc09_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xeee3bc09, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__f2f1d3aa_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2f1d3aa_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf2f1d3aa, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__c3059e01_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__d8299e85_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c3059e01_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc3059e01, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__3bbe5820_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__d8299e85_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3bbe5820_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3bbe5820, "visitExprCopy", 368 };
+TypeInfo * __type_info__a0ecfbb9_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a0ecfbb9_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xa0ecfbb9, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__215e3c49_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__d8299e85_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__215e3c49_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x215e3c49, "preVisitExprMove", 376 };
+TypeInfo * __type_info__8f4c9038_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__d8299e85_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f4c9038_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8f4c9038, "visitExprMove", 380 };
+TypeInfo * __type_info__98dc5351_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__98dc5351_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x98dc5351, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__17b491_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__d8299e85_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__17b491_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x17b491, "preVisitExprClone", 388 };
+TypeInfo * __type_info__1ad4800e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__d8299e85_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1ad4800e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1ad4800e, "visitExprClone", 392 };
+TypeInfo * __type_info__b08b6929_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b08b6929_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb08b6929, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__f2348094_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__d8299e85_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2348094_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf2348094, "preVisitExprWith", 400 };
+TypeInfo * __type_info__f3ae166d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__d8299e85_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f3ae166d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf3ae166d, "visitExprWith", 404 };
+TypeInfo * __type_info__f1675330_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1675330_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf1675330, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__92e3d111_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__d8299e85_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__92e3d111_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x92e3d111, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__cafe3512_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__d8299e85_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cafe3512_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcafe3512, "visitExprWhile", 416 };
+TypeInfo * __type_info__ed636a01_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ed636a01_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xed636a01, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__25c0eaac_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__d8299e85_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__25c0eaac_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x25c0eaac, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__90a51465_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__d8299e85_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__90a51465_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x90a51465, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__169d2283_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__169d2283_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x169d2283, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__8965dfd1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__d8299e85_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8965dfd1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8965dfd1, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__757540b8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__d8299e85_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__757540b8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x757540b8, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__7705b54f_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7705b54f_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x7705b54f, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__97b1c4ed_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__97b1c4ed_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x97b1c4ed, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__e95012d3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e95012d3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe95012d3, "preVisitExprFor", 452 };
+TypeInfo * __type_info__344d19dc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__344d19dc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x344d19dc, "visitExprFor", 456 };
+TypeInfo * __type_info__6c164ebf_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c164ebf_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x6c164ebf, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__56569ad4_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__56569ad4_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x56569ad4, "visitExprForVariable", 464 };
+TypeInfo * __type_info__12214d06_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__12214d06_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x12214d06, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__64f4b569_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__64f4b569_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x64f4b569, "visitExprForSource", 472 };
+TypeInfo * __type_info__10bf88c5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__10bf88c5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x10bf88c5, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__6dbb285b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6dbb285b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6dbb285b, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__717f8e67_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__d8299e85_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__717f8e67_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x717f8e67, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__e6a0bda4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__d8299e85_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e6a0bda4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe6a0bda4, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__c35127d9_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c35127d9_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xc35127d9, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__aa30df58_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__aa30df58_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xaa30df58, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__67cfaaa3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__d8299e85_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__67cfaaa3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x67cfaaa3, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__23fa073a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__d8299e85_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__23fa073a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x23fa073a, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__a74c85b9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a74c85b9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa74c85b9, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__88bd350e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88bd350e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x88bd350e, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__35e4f53d_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35e4f53d_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x35e4f53d, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__83d50dee_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__83d50dee_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x83d50dee, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__6d5c4cbf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__d8299e85_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d5c4cbf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6d5c4cbf, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__52c5da8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__d8299e85_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52c5da8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x52c5da8, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__e8005be5_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e8005be5_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xe8005be5, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__a216b644_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a216b644_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xa216b644, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__8b73a850_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__d8299e85_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8b73a850_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8b73a850, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__955e0b53_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__d8299e85_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__955e0b53_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x955e0b53, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__cc0f5e2c_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc0f5e2c_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xcc0f5e2c, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__c9d28329_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c9d28329_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xc9d28329, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__e4dec3a3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__d8299e85_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4dec3a3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe4dec3a3, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__12c1f55a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__d8299e85_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__12c1f55a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x12c1f55a, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__b69afd24_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b69afd24_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb69afd24, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__491e734a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__491e734a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x491e734a, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__d6bd6ae8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__d8299e85_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d6bd6ae8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd6bd6ae8, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__1bbde4e9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__d8299e85_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1bbde4e9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1bbde4e9, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__f25fabc1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__d8299e85_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f25fabc1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf25fabc1, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__546203a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__d8299e85_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__546203a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x546203a, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__e85d642a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__d8299e85_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e85d642a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe85d642a, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__919eabb1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__d8299e85_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__919eabb1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x919eabb1, "visitExprLabel", 592 };
+TypeInfo * __type_info__94bb64af_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__d8299e85_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__94bb64af_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x94bb64af, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__fcdb84a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__d8299e85_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fcdb84a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfcdb84a, "visitExprGoto", 600 };
+TypeInfo * __type_info__ebd6bd76_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__d8299e85_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ebd6bd76_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xebd6bd76, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__754e508d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__d8299e85_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__754e508d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x754e508d, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__e3083f3d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__d8299e85_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e3083f3d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe3083f3d, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__fdcc980e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__d8299e85_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fdcc980e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfdcc980e, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__822a0a6f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__d8299e85_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__822a0a6f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x822a0a6f, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__36bf6516_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__d8299e85_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__36bf6516_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x36bf6516, "visitExprAddr", 624 };
+TypeInfo * __type_info__b632464e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__d8299e85_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b632464e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb632464e, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__171280cf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__d8299e85_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__171280cf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x171280cf, "visitExprAssert", 632 };
+TypeInfo * __type_info__9cd677e8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__d8299e85_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9cd677e8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9cd677e8, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__3faadbe1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__d8299e85_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3faadbe1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3faadbe1, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__3021cb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__d8299e85_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3021cb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3021cb, "preVisitExprDebug", 644 };
+TypeInfo * __type_info__db853894_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__d8299e85_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db853894_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdb853894, "visitExprDebug", 648 };
+TypeInfo * __type_info__a42b136c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__d8299e85_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a42b136c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa42b136c, "preVisitExprInvoke", 652 };
+TypeInfo * __type_info__ae8d05f1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__d8299e85_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ae8d05f1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xae8d05f1, "visitExprInvoke", 656 };
+TypeInfo * __type_info__5afbb756_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__d8299e85_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5afbb756_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5afbb756, "preVisitExprErase", 660 };
+TypeInfo * __type_info__a433d831_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__d8299e85_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a433d831_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa433d831, "visitExprErase", 664 };
+TypeInfo * __type_info__89b1ed2f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__d8299e85_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89b1ed2f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x89b1ed2f, "preVisitExprFind", 668 };
+TypeInfo * __type_info__ba5333e6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__d8299e85_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba5333e6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xba5333e6, "visitExprFind", 672 };
+TypeInfo * __type_info__9d59dc9b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__d8299e85_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9d59dc9b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9d59dc9b, "preVisitExprKeyExists", 676 };
+TypeInfo * __type_info__5532d30_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__d8299e85_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5532d30_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5532d30, "visitExprKeyExists", 680 };
+TypeInfo * __type_info__ac1f0992_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__d8299e85_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac1f0992_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xac1f0992, "preVisitExprAscend", 684 };
+TypeInfo * __type_info__d676fdc3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__d8299e85_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d676fdc3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd676fdc3, "visitExprAscend", 688 };
+TypeInfo * __type_info__fbd35c53_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__d8299e85_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fbd35c53_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfbd35c53, "preVisitExprCast", 692 };
+TypeInfo * __type_info__3f5db93a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__d8299e85_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3f5db93a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3f5db93a, "visitExprCast", 696 };
+TypeInfo * __type_info__e9e73a57_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__d8299e85_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e9e73a57_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe9e73a57, "preVisitExprDelete", 700 };
+TypeInfo * __type_info__5b5aed7e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__d8299e85_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5b5aed7e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5b5aed7e, "visitExprDelete", 704 };
+TypeInfo * __type_info__31ca940d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__d8299e85_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31ca940d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x31ca940d, "preVisitExprVar", 708 };
+TypeInfo * __type_info__64bce7f2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__d8299e85_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__64bce7f2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x64bce7f2, "visitExprVar", 712 };
+TypeInfo * __type_info__490512e0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__d8299e85_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__490512e0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x490512e0, "preVisitExprField", 716 };
+TypeInfo * __type_info__cb496173_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__d8299e85_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb496173_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb496173, "visitExprField", 720 };
+TypeInfo * __type_info__afac4da3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__d8299e85_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__afac4da3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xafac4da3, "preVisitExprSafeField", 724 };
+TypeInfo * __type_info__c2023960_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__d8299e85_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c2023960_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc2023960, "visitExprSafeField", 728 };
+TypeInfo * __type_info__2f87634a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__d8299e85_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f87634a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2f87634a, "preVisitExprSwizzle", 732 };
+TypeInfo * __type_info__cbd679f5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__d8299e85_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cbd679f5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcbd679f5, "visitExprSwizzle", 736 };
+TypeInfo * __type_info__c93f0085_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__d8299e85_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c93f0085_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc93f0085, "preVisitExprIsVariant", 740 };
+TypeInfo * __type_info__c5f99f7a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__d8299e85_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c5f99f7a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc5f99f7a, "visitExprIsVariant", 744 };
+TypeInfo * __type_info__d15980dd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__d8299e85_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d15980dd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd15980dd, "preVisitExprAsVariant", 748 };
+TypeInfo * __type_info__1fff0112_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__d8299e85_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1fff0112_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1fff0112, "visitExprAsVariant", 752 };
+TypeInfo * __type_info__6f4d2d82_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__d8299e85_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6f4d2d82_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6f4d2d82, "preVisitExprSafeAsVariant", 756 };
+TypeInfo * __type_info__c4a28f5d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__d8299e85_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c4a28f5d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc4a28f5d, "visitExprSafeAsVariant", 760 };
+TypeInfo * __type_info__4048a67e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__d8299e85_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4048a67e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x4048a67e, "preVisitExprOp1", 764 };
+TypeInfo * __type_info__a1981da5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__d8299e85_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a1981da5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa1981da5, "visitExprOp1", 768 };
+TypeInfo * __type_info__9cd84da2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__d8299e85_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9cd84da2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9cd84da2, "preVisitExprReturn", 772 };
+TypeInfo * __type_info__e51104e3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__d8299e85_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e51104e3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe51104e3, "visitExprReturn", 776 };
+TypeInfo * __type_info__88b468bd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__d8299e85_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88b468bd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x88b468bd, "preVisitExprYield", 780 };
+TypeInfo * __type_info__b873b4e2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__d8299e85_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b873b4e2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb873b4e2, "visitExprYield", 784 };
+TypeInfo * __type_info__bac4281b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__d8299e85_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bac4281b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbac4281b, "preVisitExprBreak", 788 };
+TypeInfo * __type_info__b8ba8abc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__d8299e85_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b8ba8abc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb8ba8abc, "visitExprBreak", 792 };
+TypeInfo * __type_info__988afcfd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__d8299e85_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__988afcfd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x988afcfd, "preVisitExprContinue", 796 };
+TypeInfo * __type_info__d11ed6d8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__d8299e85_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d11ed6d8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd11ed6d8, "visitExprContinue", 800 };
+TypeInfo * __type_info__80289013_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__d8299e85_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__80289013_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x80289013, "preVisitExprMakeBlock", 804 };
+TypeInfo * __type_info__c985a48c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__d8299e85_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c985a48c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc985a48c, "visitExprMakeBlock", 808 };
+TypeInfo * __type_info__37233ab_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__d8299e85_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__37233ab_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x37233ab, "preVisitExprMakeGenerator", 812 };
+TypeInfo * __type_info__6758a118_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__d8299e85_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6758a118_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6758a118, "visitExprMakeGenerator", 816 };
+TypeInfo * __type_info__cea9756b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__d8299e85_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cea9756b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcea9756b, "preVisitExprMemZero", 820 };
+TypeInfo * __type_info__21f91cf0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__d8299e85_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21f91cf0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21f91cf0, "visitExprMemZero", 824 };
+TypeInfo * __type_info__827a7b9f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__d8299e85_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__827a7b9f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x827a7b9f, "preVisitExprConst", 828 };
+TypeInfo * __type_info__80719338_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__d8299e85_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__80719338_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x80719338, "visitExprConst", 832 };
+TypeInfo * __type_info__f1edd27b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__d8299e85_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1edd27b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf1edd27b, "preVisitExprConstPtr", 836 };
+TypeInfo * __type_info__d4f9c662_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__d8299e85_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d4f9c662_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd4f9c662, "visitExprConstPtr", 840 };
+TypeInfo * __type_info__59a80c5a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__d8299e85_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__59a80c5a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x59a80c5a, "preVisitExprConstEnumeration", 844 };
+TypeInfo * __type_info__d561f037_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__d8299e85_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d561f037_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd561f037, "visitExprConstEnumeration", 848 };
+TypeInfo * __type_info__319243ae_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__d8299e85_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__319243ae_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x319243ae, "preVisitExprConstBitfield", 852 };
+TypeInfo * __type_info__f502f93d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__d8299e85_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f502f93d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf502f93d, "visitExprConstBitfield", 856 };
+TypeInfo * __type_info__35133e98_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__d8299e85_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35133e98_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x35133e98, "preVisitExprConstInt8", 860 };
+TypeInfo * __type_info__8f9f8e93_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__d8299e85_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f9f8e93_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8f9f8e93, "visitExprConstInt8", 864 };
+TypeInfo * __type_info__2d3a4cbf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__d8299e85_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2d3a4cbf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2d3a4cbf, "preVisitExprConstInt16", 868 };
+TypeInfo * __type_info__cb3eecea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__d8299e85_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb3eecea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb3eecea, "visitExprConstInt16", 872 };
+TypeInfo * __type_info__ad464f32_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__d8299e85_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad464f32_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xad464f32, "preVisitExprConstInt64", 876 };
+TypeInfo * __type_info__cb50360b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__d8299e85_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb50360b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb50360b, "visitExprConstInt64", 880 };
+TypeInfo * __type_info__dbe74630_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__d8299e85_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dbe74630_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdbe74630, "preVisitExprConstInt", 884 };
+TypeInfo * __type_info__a80e5f39_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__d8299e85_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a80e5f39_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa80e5f39, "visitExprConstInt", 888 };
+TypeInfo * __type_info__2f133526_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__d8299e85_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f133526_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2f133526, "preVisitExprConstInt2", 892 };
+TypeInfo * __type_info__999f9e51_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__d8299e85_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__999f9e51_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x999f9e51, "visitExprConstInt2", 896 };
+TypeInfo * __type_info__301336b9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__d8299e85_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__301336b9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x301336b9, "preVisitExprConstInt3", 900 };
+TypeInfo * __type_info__989f9cbe_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__d8299e85_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__989f9cbe_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x989f9cbe, "visitExprConstInt3", 904 };
+TypeInfo * __type_info__3113384c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__d8299e85_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3113384c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3113384c, "preVisitExprConstInt4", 908 };
+TypeInfo * __type_info__9b9fa177_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__d8299e85_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9b9fa177_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9b9fa177, "visitExprConstInt4", 912 };
+TypeInfo * __type_info__c8e5f55_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__d8299e85_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c8e5f55_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc8e5f55, "preVisitExprConstUInt8", 916 };
+TypeInfo * __type_info__4bbc29e0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__d8299e85_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4bbc29e0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x4bbc29e0, "visitExprConstUInt8", 920 };
+TypeInfo * __type_info__35318804_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__d8299e85_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35318804_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x35318804, "preVisitExprConstUInt16", 924 };
+TypeInfo * __type_info__a14c8807_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__d8299e85_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a14c8807_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa14c8807, "visitExprConstUInt16", 928 };
+TypeInfo * __type_info__3924c25d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__d8299e85_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3924c25d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3924c25d, "preVisitExprConstUInt64", 932 };
+TypeInfo * __type_info__21588a7a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__d8299e85_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21588a7a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21588a7a, "visitExprConstUInt64", 936 };
+TypeInfo * __type_info__1c524c4f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__d8299e85_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c524c4f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1c524c4f, "preVisitExprConstUInt", 940 };
+TypeInfo * __type_info__ba8cda98_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__d8299e85_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba8cda98_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xba8cda98, "visitExprConstUInt", 944 };
+TypeInfo * __type_info__128e68c7_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__d8299e85_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__128e68c7_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x128e68c7, "preVisitExprConstUInt2", 948 };
+TypeInfo * __type_info__55bc399e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__d8299e85_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__55bc399e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x55bc399e, "visitExprConstUInt2", 952 };
+TypeInfo * __type_info__118e6734_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__d8299e85_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__118e6734_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x118e6734, "preVisitExprConstUInt3", 956 };
+TypeInfo * __type_info__56bc3b31_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__d8299e85_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__56bc3b31_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x56bc3b31, "visitExprConstUInt3", 960 };
+TypeInfo * __type_info__108e65a1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__d8299e85_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__108e65a1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x108e65a1, "preVisitExprConstUInt4", 964 };
+TypeInfo * __type_info__57bc3cc4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__d8299e85_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__57bc3cc4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x57bc3cc4, "visitExprConstUInt4", 968 };
+TypeInfo * __type_info__7c486554_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__d8299e85_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7c486554_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7c486554, "preVisitExprConstRange", 972 };
+TypeInfo * __type_info__d1222c0d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__d8299e85_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d1222c0d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd1222c0d, "visitExprConstRange", 976 };
+TypeInfo * __type_info__21dc0f2b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__d8299e85_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__21dc0f2b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21dc0f2b, "preVisitExprConstURange", 980 };
+TypeInfo * __type_info__9bd0e54c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__d8299e85_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9bd0e54c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9bd0e54c, "visitExprConstURange", 984 };
+TypeInfo * __type_info__cfe854bb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__d8299e85_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cfe854bb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcfe854bb, "preVisitExprConstBool", 988 };
+TypeInfo * __type_info__52ff6128_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__d8299e85_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52ff6128_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x52ff6128, "visitExprConstBool", 992 };
+TypeInfo * __type_info__9b78bd2b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__d8299e85_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9b78bd2b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9b78bd2b, "preVisitExprConstFloat", 996 };
+TypeInfo * __type_info__14bcb702_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__d8299e85_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__14bcb702_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x14bcb702, "visitExprConstFloat", 1000 };
+TypeInfo * __type_info__d811ae5b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__d8299e85_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d811ae5b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd811ae5b, "preVisitExprConstFloat2", 1004 };
+TypeInfo * __type_info__d5146090_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__d8299e85_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d5146090_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd5146090, "visitExprConstFloat2", 1008 };
+TypeInfo * __type_info__d711acc8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__d8299e85_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d711acc8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd711acc8, "preVisitExprConstFloat3", 1012 };
+TypeInfo * __type_info__d6146223_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__d8299e85_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d6146223_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd6146223, "visitExprConstFloat3", 1016 };
+TypeInfo * __type_info__de11b7cd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__d8299e85_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__de11b7cd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xde11b7cd, "preVisitExprConstFloat4", 1020 };
+TypeInfo * __type_info__db146a02_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__d8299e85_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db146a02_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdb146a02, "visitExprConstFloat4", 1024 };
+TypeInfo * __type_info__6e97f0ea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__d8299e85_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6e97f0ea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6e97f0ea, "preVisitExprConstString", 1028 };
+TypeInfo * __type_info__ea5d24a1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__d8299e85_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ea5d24a1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xea5d24a1, "visitExprConstString", 1032 };
+TypeInfo * __type_info__89e422d2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__d8299e85_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89e422d2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x89e422d2, "preVisitExprConstDouble", 1036 };
+TypeInfo * __type_info__6c08a2e5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__d8299e85_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6c08a2e5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6c08a2e5, "visitExprConstDouble", 1040 };
+TypeInfo * __type_info__2af4d3dc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__d8299e85_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2af4d3dc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2af4d3dc, "preVisitExprFakeContext", 1044 };
+TypeInfo * __type_info__5fa7d37b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__d8299e85_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5fa7d37b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5fa7d37b, "visitExprFakeContext", 1048 };
+TypeInfo * __type_info__ee0efbc3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__d8299e85_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ee0efbc3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xee0efbc3, "preVisitExprFakeLineInfo", 1052 };
+TypeInfo * __type_info__afd807ea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__d8299e85_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__afd807ea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xafd807ea, "visitExprFakeLineInfo", 1056 };
+TypeInfo * __type_info__f7387f87_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__d8299e85_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f7387f87_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf7387f87, "preVisitExprReader", 1060 };
+TypeInfo * __type_info__d62685b2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__d8299e85_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d62685b2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd62685b2, "visitExprReader", 1064 };
+TypeInfo * __type_info__ffd9fe3a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__d8299e85_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ffd9fe3a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xffd9fe3a, "preVisitExprUnsafe", 1068 };
+TypeInfo * __type_info__dfbb50cb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__d8299e85_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dfbb50cb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdfbb50cb, "visitExprUnsafe", 1072 };
+TypeInfo * __type_info__a10f6f08_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__d8299e85_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a10f6f08_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa10f6f08, "preVisitExprCallMacro", 1076 };
+TypeInfo * __type_info__9794b2fb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__d8299e85_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9794b2fb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9794b2fb, "visitExprCallMacro", 1080 };
+VarInfo * __struct_info__d8299e85_fields[270] =  { &__struct_info__d8299e85_field_0, &__struct_info__d8299e85_field_1, &__struct_info__d8299e85_field_2, &__struct_info__d8299e85_field_3, &__struct_info__d8299e85_field_4, &__struct_info__d8299e85_field_5, &__struct_info__d8299e85_field_6, &__struct_info__d8299e85_field_7, &__struct_info__d8299e85_field_8, &__struct_info__d8299e85_field_9, &__struct_info__d8299e85_field_10, &__struct_info__d8299e85_field_11, &__struct_info__d8299e85_field_12, &__struct_info__d8299e85_field_13, &__struct_info__d8299e85_field_14, &__struct_info__d8299e85_field_15, &__struct_info__d8299e85_field_16, &__struct_info__d8299e85_field_17, &__struct_info__d8299e85_field_18, &__struct_info__d8299e85_field_19, &__struct_info__d8299e85_field_20, &__struct_info__d8299e85_field_21, &__struct_info__d8299e85_field_22, &__struct_info__d8299e85_field_23, &__struct_info__d8299e85_field_24, &__struct_info__d8299e85_field_25, &__struct_info__d8299e85_field_26, &__struct_info__d8299e85_field_27, &__struct_info__d8299e85_field_28, &__struct_info__d8299e85_field_29, &__struct_info__d8299e85_field_30, &__struct_info__d8299e85_field_31, &__struct_info__d8299e85_field_32, &__struct_info__d8299e85_field_33, &__struct_info__d8299e85_field_34, &__struct_info__d8299e85_field_35, &__struct_info__d8299e85_field_36, &__struct_info__d8299e85_field_37, &__struct_info__d8299e85_field_38, &__struct_info__d8299e85_field_39, &__struct_info__d8299e85_field_40, &__struct_info__d8299e85_field_41, &__struct_info__d8299e85_field_42, &__struct_info__d8299e85_field_43, &__struct_info__d8299e85_field_44, &__struct_info__d8299e85_field_45, &__struct_info__d8299e85_field_46, &__struct_info__d8299e85_field_47, &__struct_info__d8299e85_field_48, &__struct_info__d8299e85_field_49, &__struct_info__d8299e85_field_50, &__struct_info__d8299e85_field_51, &__struct_info__d8299e85_field_52, &__struct_info__d8299e85_field_53, &__struct_info__d8299e85_field_54, &__struct_info__d8299e85_field_55, &__struct_info__d8299e85_field_56, &__struct_info__d8299e85_field_57, &__struct_info__d8299e85_field_58, &__struct_info__d8299e85_field_59, &__struct_info__d8299e85_field_60, &__struct_info__d8299e85_field_61, &__struct_info__d8299e85_field_62, &__struct_info__d8299e85_field_63, &__struct_info__d8299e85_field_64, &__struct_info__d8299e85_field_65, &__struct_info__d8299e85_field_66, &__struct_info__d8299e85_field_67, &__struct_info__d8299e85_field_68, &__struct_info__d8299e85_field_69, &__struct_info__d8299e85_field_70, &__struct_info__d8299e85_field_71, &__struct_info__d8299e85_field_72, &__struct_info__d8299e85_field_73, &__struct_info__d8299e85_field_74, &__struct_info__d8299e85_field_75, &__struct_info__d8299e85_field_76, &__struct_info__d8299e85_field_77, &__struct_info__d8299e85_field_78, &__struct_info__d8299e85_field_79, &__struct_info__d8299e85_field_80, &__struct_info__d8299e85_field_81, &__struct_info__d8299e85_field_82, &__struct_info__d8299e85_field_83, &__struct_info__d8299e85_field_84, &__struct_info__d8299e85_field_85, &__struct_info__d8299e85_field_86, &__struct_info__d8299e85_field_87, &__struct_info__d8299e85_field_88, &__struct_info__d8299e85_field_89, &__struct_info__d8299e85_field_90, &__struct_info__d8299e85_field_91, &__struct_info__d8299e85_field_92, &__struct_info__d8299e85_field_93, &__struct_info__d8299e85_field_94, &__struct_info__d8299e85_field_95, &__struct_info__d8299e85_field_96, &__struct_info__d8299e85_field_97, &__struct_info__d8299e85_field_98, &__struct_info__d8299e85_field_99, &__struct_info__d8299e85_field_100, &__struct_info__d8299e85_field_101, &__struct_info__d8299e85_field_102, &__struct_info__d8299e85_field_103, &__struct_info__d8299e85_field_104, &__struct_info__d8299e85_field_105, &__struct_info__d8299e85_field_106, &__struct_info__d8299e85_field_107, &__struct_info__d8299e85_field_108, &__struct_info__d8299e85_field_109, &__struct_info__d8299e85_field_110, &__struct_info__d8299e85_field_111, &__struct_info__d8299e85_field_112, &__struct_info__d8299e85_field_113, &__struct_info__d8299e85_field_114, &__struct_info__d8299e85_field_115, &__struct_info__d8299e85_field_116, &__struct_info__d8299e85_field_117, &__struct_info__d8299e85_field_118, &__struct_info__d8299e85_field_119, &__struct_info__d8299e85_field_120, &__struct_info__d8299e85_field_121, &__struct_info__d8299e85_field_122, &__struct_info__d8299e85_field_123, &__struct_info__d8299e85_field_124, &__struct_info__d8299e85_field_125, &__struct_info__d8299e85_field_126, &__struct_info__d8299e85_field_127, &__struct_info__d8299e85_field_128, &__struct_info__d8299e85_field_129, &__struct_info__d8299e85_field_130, &__struct_info__d8299e85_field_131, &__struct_info__d8299e85_field_132, &__struct_info__d8299e85_field_133, &__struct_info__d8299e85_field_134, &__struct_info__d8299e85_field_135, &__struct_info__d8299e85_field_136, &__struct_info__d8299e85_field_137, &__struct_info__d8299e85_field_138, &__struct_info__d8299e85_field_139, &__struct_info__d8299e85_field_140, &__struct_info__d8299e85_field_141, &__struct_info__d8299e85_field_142, &__struct_info__d8299e85_field_143, &__struct_info__d8299e85_field_144, &__struct_info__d8299e85_field_145, &__struct_info__d8299e85_field_146, &__struct_info__d8299e85_field_147, &__struct_info__d8299e85_field_148, &__struct_info__d8299e85_field_149, &__struct_info__d8299e85_field_150, &__struct_info__d8299e85_field_151, &__struct_info__d8299e85_field_152, &__struct_info__d8299e85_field_153, &__struct_info__d8299e85_field_154, &__struct_info__d8299e85_field_155, &__struct_info__d8299e85_field_156, &__struct_info__d8299e85_field_157, &__struct_info__d8299e85_field_158, &__struct_info__d8299e85_field_159, &__struct_info__d8299e85_field_160, &__struct_info__d8299e85_field_161, &__struct_info__d8299e85_field_162, &__struct_info__d8299e85_field_163, &__struct_info__d8299e85_field_164, &__struct_info__d8299e85_field_165, &__struct_info__d8299e85_field_166, &__struct_info__d8299e85_field_167, &__struct_info__d8299e85_field_168, &__struct_info__d8299e85_field_169, &__struct_info__d8299e85_field_170, &__struct_info__d8299e85_field_171, &__struct_info__d8299e85_field_172, &__struct_info__d8299e85_field_173, &__struct_info__d8299e85_field_174, &__struct_info__d8299e85_field_175, &__struct_info__d8299e85_field_176, &__struct_info__d8299e85_field_177, &__struct_info__d8299e85_field_178, &__struct_info__d8299e85_field_179, &__struct_info__d8299e85_field_180, &__struct_info__d8299e85_field_181, &__struct_info__d8299e85_field_182, &__struct_info__d8299e85_field_183, &__struct_info__d8299e85_field_184, &__struct_info__d8299e85_field_185, &__struct_info__d8299e85_field_186, &__struct_info__d8299e85_field_187, &__struct_info__d8299e85_field_188, &__struct_info__d8299e85_field_189, &__struct_info__d8299e85_field_190, &__struct_info__d8299e85_field_191, &__struct_info__d8299e85_field_192, &__struct_info__d8299e85_field_193, &__struct_info__d8299e85_field_194, &__struct_info__d8299e85_field_195, &__struct_info__d8299e85_field_196, &__struct_info__d8299e85_field_197, &__struct_info__d8299e85_field_198, &__struct_info__d8299e85_field_199, &__struct_info__d8299e85_field_200, &__struct_info__d8299e85_field_201, &__struct_info__d8299e85_field_202, &__struct_info__d8299e85_field_203, &__struct_info__d8299e85_field_204, &__struct_info__d8299e85_field_205, &__struct_info__d8299e85_field_206, &__struct_info__d8299e85_field_207, &__struct_info__d8299e85_field_208, &__struct_info__d8299e85_field_209, &__struct_info__d8299e85_field_210, &__struct_info__d8299e85_field_211, &__struct_info__d8299e85_field_212, &__struct_info__d8299e85_field_213, &__struct_info__d8299e85_field_214, &__struct_info__d8299e85_field_215, &__struct_info__d8299e85_field_216, &__struct_info__d8299e85_field_217, &__struct_info__d8299e85_field_218, &__struct_info__d8299e85_field_219, &__struct_info__d8299e85_field_220, &__struct_info__d8299e85_field_221, &__struct_info__d8299e85_field_222, &__struct_info__d8299e85_field_223, &__struct_info__d8299e85_field_224, &__struct_info__d8299e85_field_225, &__struct_info__d8299e85_field_226, &__struct_info__d8299e85_field_227, &__struct_info__d8299e85_field_228, &__struct_info__d8299e85_field_229, &__struct_info__d8299e85_field_230, &__struct_info__d8299e85_field_231, &__struct_info__d8299e85_field_232, &__struct_info__d8299e85_field_233, &__struct_info__d8299e85_field_234, &__struct_info__d8299e85_field_235, &__struct_info__d8299e85_field_236, &__struct_info__d8299e85_field_237, &__struct_info__d8299e85_field_238, &__struct_info__d8299e85_field_239, &__struct_info__d8299e85_field_240, &__struct_info__d8299e85_field_241, &__struct_info__d8299e85_field_242, &__struct_info__d8299e85_field_243, &__struct_info__d8299e85_field_244, &__struct_info__d8299e85_field_245, &__struct_info__d8299e85_field_246, &__struct_info__d8299e85_field_247, &__struct_info__d8299e85_field_248, &__struct_info__d8299e85_field_249, &__struct_info__d8299e85_field_250, &__struct_info__d8299e85_field_251, &__struct_info__d8299e85_field_252, &__struct_info__d8299e85_field_253, &__struct_info__d8299e85_field_254, &__struct_info__d8299e85_field_255, &__struct_info__d8299e85_field_256, &__struct_info__d8299e85_field_257, &__struct_info__d8299e85_field_258, &__struct_info__d8299e85_field_259, &__struct_info__d8299e85_field_260, &__struct_info__d8299e85_field_261, &__struct_info__d8299e85_field_262, &__struct_info__d8299e85_field_263, &__struct_info__d8299e85_field_264, &__struct_info__d8299e85_field_265, &__struct_info__d8299e85_field_266, &__struct_info__d8299e85_field_267, &__struct_info__d8299e85_field_268, &__struct_info__d8299e85_field_269 };
+StructInfo __struct_info__d8299e85 = {"AstVisitor", __struct_info__d8299e85_fields, 270, 1088, -1, nullptr, 0xd8299e85 };
+VarInfo __struct_info__77bf9876_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x915cd895, "__rtti", 0 };
+TypeInfo * __type_info__ae8a6712_arg_types_var_2009045110[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__77bf9876_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ae8a6712_arg_types_var_2009045110, nullptr, 1, 0, nullptr, 28, 0xae8a6712, "__finalize", 8 };
+TypeInfo * __type_info__be271e3a_arg_types_var_2009045110[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__77bf9876_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__be271e3a_arg_types_var_2009045110, nullptr, 5, 0, nullptr, 28, 0xbe271e3a, "apply", 12 };
+TypeInfo * __type_info__2a02779d_arg_types_var_2009045110[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__77bf9876_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__2a02779d_arg_types_var_2009045110, nullptr, 5, 0, nullptr, 28, 0x2a02779d, "finish", 16 };
+VarInfo * __struct_info__77bf9876_fields[4] =  { &__struct_info__77bf9876_field_0, &__struct_info__77bf9876_field_1, &__struct_info__77bf9876_field_2, &__struct_info__77bf9876_field_3 };
+StructInfo __struct_info__77bf9876 = {"SoaStructMacro", __struct_info__77bf9876_fields, 4, 24, -1, nullptr, 0x77bf9876 };
+VarInfo __struct_info__69c83b8f_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x581c63d6, "__rtti", 0 };
+TypeInfo * __type_info__69346179_arg_types_var_1774730127[1] = { &__type_info__fdd27932 };
+VarInfo __struct_info__69c83b8f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__69346179_arg_types_var_1774730127, nullptr, 1, 0, nullptr, 28, 0x69346179, "__finalize", 8 };
+TypeInfo * __type_info__283a7ca3_arg_types_var_1774730127[3] = { &__type_info__fdd27932, &__type_info__8f3455dd, &__type_info__b049b391 };
+VarInfo __struct_info__69c83b8f_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__283a7ca3_arg_types_var_1774730127, nullptr, 3, 0, nullptr, 28, 0x283a7ca3, "apply", 12 };
+VarInfo * __struct_info__69c83b8f_fields[3] =  { &__struct_info__69c83b8f_field_0, &__struct_info__69c83b8f_field_1, &__struct_info__69c83b8f_field_2 };
+StructInfo __struct_info__69c83b8f = {"SoaIndexMacro", __struct_info__69c83b8f_fields, 3, 16, -1, nullptr, 0x69c83b8f };
+VarInfo __struct_info__5ed6db18_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2f90ec93, "__rtti", 0 };
+TypeInfo * __type_info__fb05f748_arg_types_var_1591139096[1] = { &__type_info__fdd27932 };
+VarInfo __struct_info__5ed6db18_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fb05f748_arg_types_var_1591139096, nullptr, 1, 0, nullptr, 28, 0xfb05f748, "__finalize", 8 };
+TypeInfo * __type_info__1e070140_arg_types_var_1591139096[3] = { &__type_info__fdd27932, &__type_info__8f3455dd, &__type_info__b049b391 };
+VarInfo __struct_info__5ed6db18_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1e070140_arg_types_var_1591139096, nullptr, 3, 0, nullptr, 28, 0x1e070140, "apply", 12 };
+VarInfo * __struct_info__5ed6db18_fields[3] =  { &__struct_info__5ed6db18_field_0, &__struct_info__5ed6db18_field_1, &__struct_info__5ed6db18_field_2 };
+StructInfo __struct_info__5ed6db18 = {"AstPassMacro", __struct_info__5ed6db18_fields, 3, 16, -1, nullptr, 0x5ed6db18 };
+TypeInfo __type_info__10db1c1d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x10db1c1d };
+TypeInfo __type_info__da50b805 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__515c0a3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xda50b805 };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__f42f651e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprStringBuilder"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf42f651e };
+TypeInfo __type_info__dc52e0d5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a8d37f6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xdc52e0d5 };
+TypeInfo __type_info__c0e5e0ad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstURange"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc0e5e0ad };
+TypeInfo __type_info__8bc5634d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__91c4dfb3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8bc5634d };
+TypeInfo __type_info__bab365e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a40a0d70, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xbab365e };
+TypeInfo __type_info__7ec7955d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x7ec7955d };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__3737d9d1 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeGenerator"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3737d9d1 };
+TypeInfo __type_info__cd849a9b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7856e79d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xcd849a9b };
+TypeInfo __type_info__aaadd575 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFakeLineInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xaaadd575 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x13667ab1 };
+TypeInfo __type_info__c2b9b42c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt64"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc2b9b42c };
+TypeInfo __type_info__6f381053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprVar"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6f381053 };
+TypeInfo __type_info__261bce6f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x261bce6f };
+TypeInfo __type_info__dd644f60 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReturn"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xdd644f60 };
+TypeInfo __type_info__e749bd33 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5527f9ed, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe749bd33 };
+TypeInfo __type_info__73c8114e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dd644f60, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x73c8114e };
+TypeInfo __type_info__7da04467 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4aee91, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x7da04467 };
+TypeInfo __type_info__b1ceb1d4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprRef2Value"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb1ceb1d4 };
+TypeInfo __type_info__653ef983 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8f8da119, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x653ef983 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__1cb4fa6d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e97755bb, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1cb4fa6d };
+TypeInfo __type_info__515c0a3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMove"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x515c0a3 };
+TypeInfo __type_info__ccb7c90a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt16"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xccb7c90a };
+TypeInfo __type_info__b3bcfd53 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprBlock"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb3bcfd53 };
+TypeInfo __type_info__46fed0f3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b867c43d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x46fed0f3 };
+TypeInfo __type_info__523f6667 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x523f6667 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__6d1d425d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b2cb4a2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6d1d425d };
+TypeInfo __type_info__ebcc21eb = { Type::tStructure, &__struct_info__d8299e85, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xebcc21eb };
+TypeInfo __type_info__5ef84086 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprStaticAssert"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5ef84086 };
+TypeInfo __type_info__7a1c4eb7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fc0d99dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x7a1c4eb7 };
+TypeInfo __type_info__2b3e54e5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstBool"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2b3e54e5 };
+TypeInfo __type_info__4de83811 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstPtr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4de83811 };
+TypeInfo __type_info__94ae69a3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__aaadd575, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x94ae69a3 };
+TypeInfo __type_info__87a6e894 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7ebfa292, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x87a6e894 };
+TypeInfo __type_info__a6a527e0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNew"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa6a527e0 };
+TypeInfo __type_info__a703f317 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 258, 0xa703f317 };
+TypeInfo __type_info__f494d7e5 = { Type::tStructure, &__struct_info__77bf9876, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xf494d7e5 };
+TypeInfo __type_info__83498580 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstDouble"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x83498580 };
+TypeInfo __type_info__a960d6ab = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7856e79d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa960d6ab };
+TypeInfo __type_info__b108e3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d73ee2dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb108e3 };
+TypeInfo __type_info__d7eb08f1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9920ba3b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd7eb08f1 };
+TypeInfo __type_info__f486e881 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3a70d70f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xf486e881 };
+TypeInfo __type_info__fdd27932 = { Type::tStructure, &__struct_info__5ed6db18, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xfdd27932 };
+TypeInfo __type_info__1683ec13 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374b4b09, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1683ec13 };
+TypeInfo __type_info__1d5a02b1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6f381053, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1d5a02b1 };
+TypeInfo __type_info__8f8da119 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprArrayComprehension"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8f8da119 };
+TypeInfo __type_info__5bc565f1 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5bc565f1 };
+TypeInfo __type_info__819d499d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5dc56917, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x819d499d };
+TypeInfo __type_info__81be117c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be386f7a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x81be117c };
+TypeInfo __type_info__b5d7ce5d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7ec0323f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb5d7ce5d };
+TypeInfo __type_info__32f7a66b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cae7a171, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x32f7a66b };
+TypeInfo __type_info__cae7a171 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprDebug"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcae7a171 };
+TypeInfo __type_info__453f3d02 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cd57da00, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x453f3d02 };
+TypeInfo __type_info__30023ebb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5f6a7cad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x30023ebb };
+TypeInfo __type_info__dcfff1ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xdcfff1ff };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__4edf488d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x4edf488d };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__8fce7587 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a1ba446d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fce7587 };
+TypeInfo __type_info__a01f8605 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__721467d3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa01f8605 };
+TypeInfo __type_info__15780d4b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3737d9d1, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x15780d4b };
+TypeInfo __type_info__7ec0323f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLet"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7ec0323f };
+TypeInfo __type_info__ae076c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9a5b5986, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xae076c };
+TypeInfo __type_info__ff9fd5d3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d73ee2dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xff9fd5d3 };
+TypeInfo __type_info__3c4f7906 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3c4f7906 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__c4ccbb7e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__83498580, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc4ccbb7e };
+TypeInfo __type_info__ab4a876a = { Type::tStructure, &__struct_info__f338bdeb, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xab4a876a };
+TypeInfo __type_info__8e3dc326 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a65edd74, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8e3dc326 };
+TypeInfo __type_info__d73ee2dd = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Variable"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd73ee2dd };
+TypeInfo __type_info__72ae9081 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ccc9122b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x72ae9081 };
+TypeInfo __type_info__c831b26a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprTryCatch"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc831b26a };
+TypeInfo __type_info__d25748d6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4fa9a2d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd25748d6 };
+TypeInfo __type_info__3a70d70f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprContinue"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3a70d70f };
+TypeInfo __type_info__7c510f91 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprDelete"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7c510f91 };
+TypeInfo __type_info__b66d9ef1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8121e453, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb66d9ef1 };
+TypeInfo __type_info__91c4dfb3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprClone"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x91c4dfb3 };
+TypeInfo __type_info__15e14f92 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1d3d6764, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x15e14f92 };
+TypeInfo __type_info__ebc70931 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeArray"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xebc70931 };
+TypeInfo __type_info__3c8fd4b4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8728109a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x3c8fd4b4 };
+TypeInfo __type_info__4e52e6ae = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Structure"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4e52e6ae };
+TypeInfo __type_info__8891fc55 = { Type::tStructure, &__struct_info__713aafe3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x8891fc55 };
+TypeInfo __type_info__7ebfa292 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprWith"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7ebfa292 };
+TypeInfo __type_info__9773df12 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprField"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9773df12 };
+TypeInfo __type_info__317f8d25 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::FieldDeclaration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x317f8d25 };
+TypeInfo __type_info__3c6fa07f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5bc565f1, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x3c6fa07f };
+TypeInfo __type_info__9920ba3b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9920ba3b };
+TypeInfo __type_info__8f234b97 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c6cb0399, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f234b97 };
+TypeInfo __type_info__87882376 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4f3571c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x87882376 };
+TypeInfo __type_info__5f6a7cad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprBreak"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5f6a7cad };
+TypeInfo __type_info__10b7decc = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c831b26a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x10b7decc };
+TypeInfo __type_info__c9679a50 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76972586, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc9679a50 };
+TypeInfo __type_info__8494e015 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLooksLikeCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8494e015 };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__b867c43d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCast"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb867c43d };
+TypeInfo __type_info__9e20c21a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9e20c21a };
+TypeInfo __type_info__b9491240 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cf57dd26, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9491240 };
+TypeInfo __type_info__8ce26751 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8ce26751 };
+TypeInfo __type_info__963c776b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c0e5e0ad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x963c776b };
+TypeInfo __type_info__b58fe8a6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a6a527e0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb58fe8a6 };
+TypeInfo __type_info__5527f9ed = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFor"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5527f9ed };
+TypeInfo __type_info__fba33907 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8494e015, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xfba33907 };
+TypeInfo __type_info__51c55633 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt8"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x51c55633 };
+TypeInfo __type_info__84917dd0 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d00bb3d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x84917dd0 };
+TypeInfo __type_info__b9a2b501 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b38eb5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9a2b501 };
+TypeInfo __type_info__68f47b8a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__251bccdc, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x68f47b8a };
+TypeInfo __type_info__34157e23 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__309172d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x34157e23 };
+TypeInfo __type_info__37ca469d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__27a9a437, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x37ca469d };
+TypeInfo __type_info__14c14bf4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c627fc0a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x14c14bf4 };
+TypeInfo __type_info__4fa9a2d8 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSwizzle"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4fa9a2d8 };
+TypeInfo __type_info__d4f3571c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLabel"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4f3571c };
+TypeInfo __type_info__2d8fb614 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x2d8fb614 };
+TypeInfo __type_info__10edfe53 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8f8b0275, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x10edfe53 };
+TypeInfo __type_info__a07921bf = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::AnnotationArgumentList"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xa07921bf };
+TypeInfo __type_info__b38eb5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb38eb5b3 };
+TypeInfo __type_info__2481035b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9f20c3ad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2481035b };
+TypeInfo __type_info__a1ba446d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprGoto"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa1ba446d };
+TypeInfo __type_info__9fee7340 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f1bdc9a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x9fee7340 };
+TypeInfo __type_info__ada7aa90 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstString"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xada7aa90 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__664a2fe7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374bcd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x664a2fe7 };
+TypeInfo __type_info__655bd8a4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f66d4d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x655bd8a4 };
+TypeInfo __type_info__2f1bdc9a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt8"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2f1bdc9a };
+TypeInfo __type_info__8fd2ec2e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f2cdf1a0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fd2ec2e };
+TypeInfo __type_info__5dc56917 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5dc56917 };
+TypeInfo __type_info__d16acbbb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2b3e54e5, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd16acbbb };
+TypeInfo __type_info__d4aee91 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFind"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4aee91 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__2ba0095f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2ba0095f };
+TypeInfo __type_info__d057deb9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd057deb9 };
+TypeInfo __type_info__6dd946fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e0a995b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x6dd946fa };
+TypeInfo __type_info__32b24044 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x32b24044 };
+TypeInfo __type_info__531e5432 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7df5ef2c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x531e5432 };
+TypeInfo __type_info__e0a995b4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Enumeration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe0a995b4 };
+TypeInfo __type_info__368fac4c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__231bc9b6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x368fac4c };
+TypeInfo __type_info__76b8ad03 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprYield"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76b8ad03 };
+TypeInfo __type_info__48d9d78 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c4f7906, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x48d9d78 };
+TypeInfo __type_info__6535171f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIfThenElse"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6535171f };
+TypeInfo __type_info__9ee277f5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAddr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9ee277f5 };
+TypeInfo __type_info__e7b89eff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__10db1c1d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe7b89eff };
+TypeInfo __type_info__8f8b0275 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeBlock"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8f8b0275 };
+TypeInfo __type_info__764dc75a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b1ceb1d4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x764dc75a };
+TypeInfo __type_info__e2deda56 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ada7aa90, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe2deda56 };
+TypeInfo __type_info__5a28d785 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprKeyExists"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5a28d785 };
+TypeInfo __type_info__9445fbcf = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7c510f91, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x9445fbcf };
+TypeInfo __type_info__7df5ef2c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAssert"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7df5ef2c };
+TypeInfo __type_info__bf2d884b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbf2d884b };
+TypeInfo __type_info__6c2a86f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b3bcfd53, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6c2a86f9 };
+TypeInfo __type_info__e97755bb = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprWhile"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe97755bb };
+TypeInfo __type_info__295e937b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4de83811, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x295e937b };
+TypeInfo __type_info__1d3d6764 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstBitfield"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1d3d6764 };
+TypeInfo __type_info__251bccdc = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x251bccdc };
+TypeInfo __type_info__bd757ca = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeTuple"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbd757ca };
+TypeInfo __type_info__5ac5645e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5ac5645e };
+TypeInfo __type_info__e4d4c1e4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ccb7c90a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe4d4c1e4 };
+TypeInfo __type_info__d514cba4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprErase"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd514cba4 };
+TypeInfo __type_info__60d19370 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9e20c21a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x60d19370 };
+TypeInfo __type_info__c5ddc6fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d514cba4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc5ddc6fa };
+TypeInfo __type_info__9f20c3ad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9f20c3ad };
+TypeInfo __type_info__1b3c6d8d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1b3c6d8d };
+TypeInfo __type_info__6529db2b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1b3c6d8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6529db2b };
+TypeInfo __type_info__a8d37f6f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNullCoalescing"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa8d37f6f };
+TypeInfo __type_info__d7ddca10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5ef84086, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd7ddca10 };
+TypeInfo __type_info__130d26f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__51c55633, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x130d26f9 };
+TypeInfo __type_info__721467d3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x721467d3 };
+TypeInfo __type_info__8728109a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIs"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8728109a };
+TypeInfo __type_info__1bb5fdf7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ebc70931, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1bb5fdf7 };
+TypeInfo __type_info__a65edd74 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstEnumeration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa65edd74 };
+TypeInfo __type_info__76972586 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCallMacro"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76972586 };
+TypeInfo __type_info__5ca338ad = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6535171f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x5ca338ad };
+TypeInfo __type_info__d180e781 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76b8ad03, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd180e781 };
+TypeInfo __type_info__74b0f2db = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprRef2Ptr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x74b0f2db };
+TypeInfo __type_info__cf57dd26 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcf57dd26 };
+TypeInfo __type_info__535415eb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9338185, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x535415eb };
+TypeInfo __type_info__ccc9122b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt64"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xccc9122b };
+TypeInfo __type_info__b2cb4a2b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCopy"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb2cb4a2b };
+TypeInfo __type_info__a5b6b194 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5ac5645e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa5b6b194 };
+TypeInfo __type_info__ccee123b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5a28d785, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xccee123b };
+TypeInfo __type_info__374b4b09 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::MakeFieldDecl"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x374b4b09 };
+TypeInfo __type_info__9338185 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMemZero"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9338185 };
+TypeInfo __type_info__cf52b1be = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c2b9b42c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcf52b1be };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+TypeInfo __type_info__9a5b5986 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprInvoke"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9a5b5986 };
+TypeInfo __type_info__7856e79d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::TypeDecl"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7856e79d };
+TypeInfo __type_info__75b7ce79 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReader"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x75b7ce79 };
+TypeInfo __type_info__5f1adc0e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFakeContext"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5f1adc0e };
+TypeInfo __type_info__cd57da00 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp1"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcd57da00 };
+TypeInfo __type_info__c1bd2f4c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ModuleGroup"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc1bd2f4c };
+TypeInfo __type_info__a8981616 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e0a995b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa8981616 };
+TypeInfo __type_info__88de8728 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9773df12, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x88de8728 };
+TypeInfo __type_info__1b9f61f8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bd757ca, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1b9f61f8 };
+TypeInfo __type_info__79323f61 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Function"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x79323f61 };
+TypeInfo __type_info__231bc9b6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x231bc9b6 };
+TypeInfo __type_info__8121e453 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNamedCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8121e453 };
+TypeInfo __type_info__d3ebcc43 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374b4b09, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xd3ebcc43 };
+TypeInfo __type_info__f2cdf1a0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf2cdf1a0 };
+TypeInfo __type_info__d8ac9e75 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__261bce6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd8ac9e75 };
+TypeInfo __type_info__fc0d99dd = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConst"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xfc0d99dd };
+TypeInfo __type_info__c1e3d526 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__858d2368, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc1e3d526 };
+TypeInfo __type_info__c627fc0a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstRange"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc627fc0a };
+TypeInfo __type_info__a40a0d70 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAscend"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa40a0d70 };
+TypeInfo __type_info__858d2368 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprUnsafe"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x858d2368 };
+TypeInfo __type_info__c6cb0399 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt16"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc6cb0399 };
+TypeInfo __type_info__f66d4d6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf66d4d6 };
+TypeInfo __type_info__fe4bfa47 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9ee277f5, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xfe4bfa47 };
+TypeInfo __type_info__cb3ec93c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5f1adc0e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcb3ec93c };
+TypeInfo __type_info__27a9a437 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprPtr2Ref"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x27a9a437 };
+TypeInfo __type_info__374bcd9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x374bcd9 };
+TypeInfo __type_info__39dd41c1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__74b0f2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x39dd41c1 };
+TypeInfo __type_info__d00bb3d6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprTypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd00bb3d6 };
+TypeInfo __type_info__f1eeff10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f42f651e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xf1eeff10 };
+TypeInfo __type_info__b081465d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeField"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb081465d };
+TypeInfo __type_info__8c0d0a29 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bf2d884b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8c0d0a29 };
+TypeInfo __type_info__be386f7a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbe386f7a };
+TypeInfo __type_info__cf76cec3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b081465d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcf76cec3 };
+TypeInfo __type_info__d4007c24 = { Type::tStructure, &__struct_info__a6e2d8c5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4007c24 };
+TypeInfo __type_info__ed20bab = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d057deb9, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xed20bab };
+TypeInfo __type_info__b850751a = { Type::tStructure, &__struct_info__69c83b8f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb850751a };
+TypeInfo __type_info__309172d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeStruct"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x309172d };
+
+TypeInfo * __tinfo_0[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_1[8] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__e8c29053, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__e8c29053 };
+TypeInfo * __tinfo_2[2] = { &__type_info__a703f317, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[3] = { &__type_info__3ffbf730, &__type_info__a703f317, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_4[4] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_5[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__e8c29053 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+namespace ast {
+
+struct AstPassMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstPassMacro)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const )) apply;
+};
+static_assert(sizeof(AstPassMacro)==16,"structure size mismatch with DAS");
+static_assert(offsetof(AstPassMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstPassMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstPassMacro,apply)==12,"structure field offset mismatch with DAS");
+}
+// unused structure AstReaderMacro
+namespace ast {
+
+struct AstStructureAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AstStructureAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,finish)==16,"structure field offset mismatch with DAS");
+}
+// unused structure AstVariantMacro
+namespace ast {
+
+struct AstVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,struct ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,struct ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+};
+static_assert(sizeof(AstVisitor)==1088,"structure size mismatch with DAS");
+static_assert(offsetof(AstVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDebug)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDebug)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprInvoke)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprInvoke)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprErase)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprErase)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFind)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFind)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprKeyExists)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprKeyExists)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAscend)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAscend)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCast)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCast)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDelete)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDelete)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprVar)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprVar)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprField)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprField)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSwizzle)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSwizzle)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsVariant)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIsVariant)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp1)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp1)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReturn)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReturn)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprYield)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprYield)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBreak)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBreak)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprContinue)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprContinue)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeBlock)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeBlock)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeGenerator)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeGenerator)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMemZero)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMemZero)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConst)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConst)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstPtr)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstPtr)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstEnumeration)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstEnumeration)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBitfield)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBitfield)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt8)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt8)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt16)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt16)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt64)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt64)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt2)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt2)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt3)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt3)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt4)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt4)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt8)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt8)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt16)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt16)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt64)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt64)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt2)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt2)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt3)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt3)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt4)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt4)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstRange)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstRange)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstURange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstURange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBool)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBool)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat2)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat2)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat3)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat3)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat4)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat4)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstString)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstString)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstDouble)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstDouble)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeContext)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeContext)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeLineInfo)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeLineInfo)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReader)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReader)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprUnsafe)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprUnsafe)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallMacro)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallMacro)==1080,"structure field offset mismatch with DAS");
+}
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace soa {
+
+struct SoaStructMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(SoaStructMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(SoaStructMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaStructMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaStructMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaStructMacro,finish)==16,"structure field offset mismatch with DAS");
+}
+namespace soa {
+
+struct SoaLoopIterator {
+	char * soa;
+	TArray<char *> fields;
+	int32_t uses;
+	bool failed;
+	TArray<char *> columns;
+};
+static_assert(sizeof(SoaLoopIterator)==64,"structure size mismatch with DAS");
+static_assert(offsetof(SoaLoopIterator,soa)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaLoopIterator,fields)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaLoopIterator,uses)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaLoopIterator,failed)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaLoopIterator,columns)==40,"structure field offset mismatch with DAS");
+}
+namespace soa {
+
+struct SoaIndexVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,struct ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,struct ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,struct ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,struct ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+	bool changed;
+	TTable<char *,struct soa::SoaLoopIterator> loopIterators;
+};
+static_assert(sizeof(SoaIndexVisitor)==1136,"structure size mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprDebug)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprDebug)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprInvoke)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprInvoke)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprErase)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprErase)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprFind)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprFind)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprKeyExists)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprKeyExists)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprAscend)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprAscend)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprCast)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprCast)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprDelete)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprDelete)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprVar)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprVar)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprField)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprField)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprSafeField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprSafeField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprSwizzle)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprSwizzle)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprIsVariant)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprIsVariant)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprAsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprAsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprSafeAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprSafeAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprOp1)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprOp1)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprReturn)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprReturn)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprYield)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprYield)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprBreak)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprBreak)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprContinue)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprContinue)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeBlock)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeBlock)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMakeGenerator)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMakeGenerator)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprMemZero)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprMemZero)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConst)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConst)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstPtr)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstPtr)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstEnumeration)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstEnumeration)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstBitfield)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstBitfield)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstInt8)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstInt8)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstInt16)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstInt16)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstInt64)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstInt64)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstInt)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstInt)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstInt2)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstInt2)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstInt3)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstInt3)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstInt4)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstInt4)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstUInt8)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstUInt8)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstUInt16)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstUInt16)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstUInt64)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstUInt64)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstUInt)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstUInt)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstUInt2)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstUInt2)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstUInt3)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstUInt3)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstUInt4)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstUInt4)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstRange)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstRange)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstURange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstURange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstBool)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstBool)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstFloat)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstFloat)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstFloat2)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstFloat2)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstFloat3)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstFloat3)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstFloat4)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstFloat4)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstString)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstString)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprConstDouble)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprConstDouble)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprFakeContext)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprFakeContext)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprFakeLineInfo)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprFakeLineInfo)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprReader)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprReader)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprUnsafe)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprUnsafe)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,preVisitExprCallMacro)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,visitExprCallMacro)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,changed)==1084,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexVisitor,loopIterators)==1088,"structure field offset mismatch with DAS");
+}
+namespace soa {
+
+struct SoaIndexMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstPassMacro)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const )) apply;
+};
+static_assert(sizeof(SoaIndexMacro)==16,"structure size mismatch with DAS");
+static_assert(offsetof(SoaIndexMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaIndexMacro,apply)==12,"structure field offset mismatch with DAS");
+}
+
+inline struct soa::SoaIndexMacro SoaIndexMacro_bbc2d5639c520f24 ( Context * __context__ );
+inline void _FuncSoaIndexMacro_0x27___finalize_de20d1bb89aaca8f ( Context * __context__, struct soa::SoaIndexMacro & __self_rename_at_263 );
+inline bool _FuncSoaIndexMacro_0x60_apply_19e77a34cf4289c5 ( Context * __context__, struct soa::SoaIndexMacro & __self_rename_at_264, smart_ptr_raw<Program> const  __prog_rename_at_264, Module * const  __mod_rename_at_264 );
+inline struct soa::SoaIndexVisitor SoaIndexVisitor_26b58386aca161b6 ( Context * __context__ );
+inline void _FuncSoaIndexVisitor_0x27___finalize_f82945d1bdf2d775 ( Context * __context__, struct soa::SoaIndexVisitor & __self_rename_at_186 );
+inline void _FuncSoaIndexVisitor_0x60_preVisitExprFor_8f4083e8a836cdc5 ( Context * __context__, struct soa::SoaIndexVisitor & __self_rename_at_218, smart_ptr_raw<ExprFor> const  __expr_rename_at_218 );
+inline smart_ptr_raw<Expression> _FuncSoaIndexVisitor_0x60_visitExprField_ba6ca3932df41b60 ( Context * __context__, struct soa::SoaIndexVisitor & __self_rename_at_189, smart_ptr_raw<ExprField> const  __expr_rename_at_189 );
+inline smart_ptr_raw<Expression> _FuncSoaIndexVisitor_0x60_visitExprFor_d13689cfcc4545f2 ( Context * __context__, struct soa::SoaIndexVisitor & __self_rename_at_225, smart_ptr_raw<ExprFor> const  __expr_rename_at_225 );
+inline smart_ptr_raw<Expression> _FuncSoaIndexVisitor_0x60_visitExprVar_6bb96e9319373a6f ( Context * __context__, struct soa::SoaIndexVisitor & __self_rename_at_213, smart_ptr_raw<ExprVar> const  __expr_rename_at_213 );
+inline struct soa::SoaStructMacro SoaStructMacro_b8c4870004aa705b ( Context * __context__ );
+inline void _FuncSoaStructMacro_0x27___finalize_a1d05e2082647f59 ( Context * __context__, struct soa::SoaStructMacro & __self_rename_at_126 );
+inline bool _FuncSoaStructMacro_0x60_apply_579af7bdbe5efa8f ( Context * __context__, struct soa::SoaStructMacro & __self_rename_at_127, smart_ptr_raw<Structure> __st_rename_at_127, ModuleGroup & __group_rename_at_127, AnnotationArgumentList const  & __args_rename_at_127, das::string & __errors_rename_at_127 );
+inline void __setup_macros_109fa2d1b5ee9e0c ( Context * __context__ );
+inline void add_argument_a02bcfb2a1bd4f5c ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_75, char * const  __name_rename_at_75, smart_ptr_raw<TypeDecl> __typ_rename_at_75, LineInfo const  & __at_rename_at_75 );
+inline void add_iterator_5e16bd3c41ceb163 ( Context * __context__, smart_ptr_raw<ExprFor> __loop_rename_at_166, char * const  __name_rename_at_166 );
+inline void _Funcast_boost_0x60_add_new_infer_macro_208841e51335b966 ( Context * __context__, char * const  __name_rename_at_144, struct soa::SoaIndexMacro * const  __someClassPtr_rename_at_144 );
+inline void _Funcast_0x60_add_new_structure_annotation_9adfc7e85c7f8d0e ( Context * __context__, char * const  __name_rename_at_503, struct soa::SoaStructMacro * const  __someClassPtr_rename_at_503 );
+inline smart_ptr_raw<PassMacro> _Funcast_0x60_make_pass_macro_7b64b679e17c16f0 ( Context * __context__, char * const  __name_rename_at_481, struct soa::SoaIndexMacro * const  __someClassPtr_rename_at_481 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_387775a111ed5a8b ( Context * __context__, char * const  __name_rename_at_447, struct soa::SoaStructMacro * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_77e8d351d3db6b01 ( Context * __context__, struct soa::SoaIndexVisitor const  & __someClass_rename_at_455 );
+inline bool _Funcbuiltin_0x60_erase_85f507120ddd4252 ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> & __Tab_rename_at_180, char * const  __at_rename_at_180 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_a43d15b4031d8219 ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> & __a_rename_at_292 );
+inline int32_t _Funcbuiltin_0x60_find_index_391234c3541d2c09 ( Context * __context__, TArray<char *> const  & __arr_rename_at_633, char * const  __key_rename_at_633 );
+inline Expression * _Funcbuiltin_0x60_get_ptr_98dd15e167848d85 ( Context * __context__, smart_ptr<Expression> const  __src_rename_at_701 );
+inline Structure * _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9 ( Context * __context__, smart_ptr<Structure> const  __src_rename_at_701 );
+inline bool _Funcbuiltin_0x60_key_exists_9333da3222ff08a2 ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> const  & __Tab_rename_at_183, char * const  __at_rename_at_183 );
+inline bool _Funcbuiltin_0x60_key_exists_7f36a4402097a77 ( Context * __context__, TTable<char *,bool> const  & __Tab_rename_at_183, char * const  __at_rename_at_183 );
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> & __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline Sequence DAS_COMMENT((struct soa::SoaLoopIterator &)) _Funcbuiltin_0x60_values_bc7e14cea4b1cf4e ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> & __a_rename_at_272 );
+inline char * column_var_15dca5cef524fc1c ( Context * __context__, char * const  __it_rename_at_172, char * const  __field_rename_at_172 );
+inline void finalize_72b128e3f5f15ad6 ( Context * __context__, struct soa::SoaIndexVisitor * & ____this_rename_at_271 );
+inline void finalize_64b80aaf5235539 ( Context * __context__, struct soa::SoaIndexMacro & ____this_rename_at_263 );
+inline void finalize_a5f0d706a0d32603 ( Context * __context__, struct soa::SoaIndexVisitor & ____this_rename_at_186 );
+inline void finalize_916f543ff91d1662 ( Context * __context__, struct soa::SoaLoopIterator & ____this_rename_at_176 );
+inline void finalize_219b89fabaf27b02 ( Context * __context__, struct soa::SoaStructMacro & ____this_rename_at_126 );
+inline void generate_length_5a59334671a89743 ( Context * __context__, Structure * const  __soa_rename_at_100, LineInfo const  & __at_rename_at_100 );
+inline void generate_per_column_99c031c68aa7198b ( Context * __context__, Structure * const  __soa_rename_at_84, char * const  __name_rename_at_84, char * const  __argName_rename_at_84, LineInfo const  & __at_rename_at_84 );
+inline void generate_push_9e41f90ae8e50517 ( Context * __context__, Structure * const  __soa_rename_at_113, Structure * const  __st_rename_at_113, LineInfo const  & __at_rename_at_113 );
+inline smart_ptr_raw<TypeDecl> int_type_1abb4ebc7b84b873 ( Context * __context__, LineInfo const  & __at_rename_at_79 );
+inline bool is_simple_path_9d4b7081c9c2bfa0 ( Context * __context__, Expression * const  __expr_rename_at_157 );
+inline bool is_soa_type_d72aca54849a3942 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __typ_rename_at_46 );
+inline smart_ptr_raw<Expression> make_field_4ffacec1682aee91 ( Context * __context__, char * const  __name_rename_at_56, char * const  __field_rename_at_56, LineInfo const  & __at_rename_at_56 );
+inline smart_ptr_raw<Function> make_function_e3f5821fa771d9c0 ( Context * __context__, char * const  __name_rename_at_67, Structure * const  __st_rename_at_67, bool __isConst_rename_at_67, LineInfo const  & __at_rename_at_67 );
+inline smart_ptr_raw<Expression> make_var_a6a6672e3646a9d ( Context * __context__, char * const  __name_rename_at_52, LineInfo const  & __at_rename_at_52 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_2f092740ebba8004 ( Context * __context__, struct soa::SoaIndexMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_555df62c5ef98c6a ( Context * __context__, struct soa::SoaIndexVisitor const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_2da3ffb9e63c6811 ( Context * __context__, struct soa::SoaStructMacro const  & __cl_rename_at_88 );
+inline char * soa_key_4dc0a8b2750d6e9d ( Context * __context__, Structure * const  __st_rename_at_42 );
+inline smart_ptr_raw<TypeDecl> struct_type_b1bb452182a2b9c7 ( Context * __context__, Structure * const  __st_rename_at_60, bool __isConst_rename_at_60 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TTable<char *,bool>,0>(__context__);/*soaStructures*/
+	__setup_macros_109fa2d1b5ee9e0c(__context__);
+}
+
+inline struct soa::SoaIndexMacro SoaIndexMacro_bbc2d5639c520f24 ( Context * __context__ )
+{
+	return (([&]() -> struct soa::SoaIndexMacro {
+		struct soa::SoaIndexMacro __mks_263;
+		das_copy((__mks_263.__rtti),(((void *)(&__type_info__b850751a))));
+		das_copy((__mks_263.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstPassMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaIndexMacro'__finalize SoaIndexMacro*/ 1412152287u)))));
+		das_copy((__mks_263.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const ))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaIndexMacro`apply SoaIndexMacro #smart_ptr##handle#Program#const #ptr##handle#Module#const*/ 513643294u)))));
+		return __mks_263;
+	})());
+}
+
+inline void _FuncSoaIndexMacro_0x27___finalize_de20d1bb89aaca8f ( Context * __context__, struct soa::SoaIndexMacro &  __self_rename_at_263 )
+{
+	finalize_64b80aaf5235539(__context__,das_arg<struct soa::SoaIndexMacro>::pass(__self_rename_at_263));
+}
+
+inline bool _FuncSoaIndexMacro_0x60_apply_19e77a34cf4289c5 ( Context * __context__, struct soa::SoaIndexMacro &  __self_rename_at_264, smart_ptr_raw<Program> const  __prog_rename_at_264, Module * const  __mod_rename_at_264 )
+{
+	struct soa::SoaIndexVisitor * __astVisitor_rename_at_265 = das_new<struct soa::SoaIndexVisitor>::make_and_init(__context__,[&]() { return SoaIndexVisitor_26b58386aca161b6(__context__); });
+	smart_ptr_raw<VisitorAdapter> __astVisitorAdapter_rename_at_266; das_zero(__astVisitorAdapter_rename_at_266); das_move(__astVisitorAdapter_rename_at_266, _Funcast_0x60_make_visitor_77e8d351d3db6b01(__context__,das_arg<struct soa::SoaIndexVisitor>::pass(das_deref(__context__,__astVisitor_rename_at_265))));
+	astVisit(__prog_rename_at_264,__astVisitorAdapter_rename_at_266);
+	bool __changed_rename_at_268 = (bool)__astVisitor_rename_at_265->changed;
+	das_delete_handle<smart_ptr_raw<VisitorAdapter>>::clear(__context__,__astVisitorAdapter_rename_at_266);
+	finalize_72b128e3f5f15ad6(__context__,__astVisitor_rename_at_265);
+	return __changed_rename_at_268;
+}
+
+inline struct soa::SoaIndexVisitor SoaIndexVisitor_26b58386aca161b6 ( Context * __context__ )
+{
+	return /* <- */ (([&]() -> struct soa::SoaIndexVisitor {
+		struct soa::SoaIndexVisitor __mks_186;
+		das_zero(__mks_186);
+		das_copy((__mks_186.__rtti),(((void *)(&__type_info__d4007c24))));
+		das_copy((__mks_186.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstVisitor))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaIndexVisitor'__finalize SoaIndexVisitor*/ 3297853903u)))));
+		das_copy((__mks_186.preVisitExprFor),(das_cast<Func DAS_COMMENT((void,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaIndexVisitor`preVisitExprFor SoaIndexVisitor #smart_ptr##handle#ExprFor#const*/ 2487074964u)))));
+		das_copy((__mks_186.visitExprFor),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprFor> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaIndexVisitor`visitExprFor SoaIndexVisitor #smart_ptr##handle#ExprFor#const*/ 3051166989u)))));
+		das_copy((__mks_186.visitExprVar),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprVar> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaIndexVisitor`visitExprVar SoaIndexVisitor #smart_ptr##handle#ExprVar#const*/ 3745755725u)))));
+		das_copy((__mks_186.visitExprField),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstVisitor,smart_ptr_raw<ExprField> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaIndexVisitor`visitExprField SoaIndexVisitor #smart_ptr##handle#ExprField#const*/ 3740497163u)))));
+		das_copy((__mks_186.changed),(false));
+		return __mks_186;
+	})());
+}
+
+inline void _FuncSoaIndexVisitor_0x27___finalize_f82945d1bdf2d775 ( Context * __context__, struct soa::SoaIndexVisitor &  __self_rename_at_186 )
+{
+	finalize_a5f0d706a0d32603(__context__,das_arg<struct soa::SoaIndexVisitor>::pass(__self_rename_at_186));
+}
+
+inline void _FuncSoaIndexVisitor_0x60_preVisitExprFor_8f4083e8a836cdc5 ( Context * __context__, struct soa::SoaIndexVisitor &  __self_rename_at_218, smart_ptr_raw<ExprFor> const  __expr_rename_at_218 )
+{
+	{
+		bool __need_loop_219 = true;
+		// it : $::das_string const&
+		das_iterator<das::vector<das::string> const > __it_iterator(__expr_rename_at_218->iterators /*iterators*/);
+		das::string const  * __it_rename_at_219;
+		__need_loop_219 = __it_iterator.first(__context__,(__it_rename_at_219)) && __need_loop_219;
+		// src : smart_ptr<ast::Expression> const&
+		das_iterator<das::vector<smart_ptr<Expression>> const > __src_iterator(__expr_rename_at_218->sources /*sources*/);
+		smart_ptr<Expression> const  * __src_rename_at_219;
+		__need_loop_219 = __src_iterator.first(__context__,(__src_rename_at_219)) && __need_loop_219;
+		for ( ; __need_loop_219 ; __need_loop_219 = __it_iterator.next(__context__,(__it_rename_at_219)) && __src_iterator.next(__context__,(__src_rename_at_219)) )
+		{
+			if ( is_soa_type_d72aca54849a3942(__context__,(*__src_rename_at_219)->type /*_type*/) )
+			{
+				struct soa::SoaLoopIterator __loopIt_rename_at_221; das_zero(__loopIt_rename_at_221); das_move(__loopIt_rename_at_221, (([&]() -> struct soa::SoaLoopIterator {
+					struct soa::SoaLoopIterator __mks_221;
+					das_zero(__mks_221);
+					das_copy((__mks_221.soa),(((char *)(to_das_string((*__src_rename_at_219)->type /*_type*/->structType /*structType*/->name /*name*/,__context__)))));
+					return __mks_221;
+				})()));
+				{
+					bool __need_loop_222 = true;
+					// fld : ast::FieldDeclaration const&
+					das_iterator<das::vector<Structure::FieldDeclaration> const > __fld_iterator((*__src_rename_at_219)->type /*_type*/->structType /*structType*/->fields /*fields*/);
+					Structure::FieldDeclaration const  * __fld_rename_at_222;
+					__need_loop_222 = __fld_iterator.first(__context__,(__fld_rename_at_222)) && __need_loop_222;
+					for ( ; __need_loop_222 ; __need_loop_222 = __fld_iterator.next(__context__,(__fld_rename_at_222)) )
+					{
+						_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass(__loopIt_rename_at_221.fields),((char *)(to_das_string((*__fld_rename_at_222).name /*name*/,__context__))),-1);
+					}
+					__fld_iterator.close(__context__,(__fld_rename_at_222));
+				};
+				das_move(__self_rename_at_218.loopIterators(((char *)(to_das_string((*__it_rename_at_219),__context__))),__context__),__loopIt_rename_at_221);
+			};
+		}
+		__it_iterator.close(__context__,(__it_rename_at_219));
+		__src_iterator.close(__context__,(__src_rename_at_219));
+	};
+}
+
+inline smart_ptr_raw<Expression> _FuncSoaIndexVisitor_0x60_visitExprField_ba6ca3932df41b60 ( Context * __context__, struct soa::SoaIndexVisitor &  __self_rename_at_189, smart_ptr_raw<ExprField> const  __expr_rename_at_189 ) { das_stack_prologue __prologue(__context__,208,"SoaIndexVisitor`visitExprField " DAS_FILE_LINE);
+{
+	if ( SimPolicy<char *>::Equ(cast<char *>::from(__expr_rename_at_189->value /*value*/->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprVar")),*__context__) )
+	{
+		char * __name_rename_at_192 = (char *)(char *)(((char *)(to_das_string(das_arg<das::string>::pass(das_cast<ExprVar *>::cast(__expr_rename_at_189->value /*value*/)->name /*name*/),__context__))));
+		if ( _Funcbuiltin_0x60_key_exists_9333da3222ff08a2(__context__,das_arg<TTable<char *,struct soa::SoaLoopIterator>>::pass(__self_rename_at_189.loopIterators),__name_rename_at_192) )
+		{
+			struct soa::SoaLoopIterator * __it_rename_at_194 = &(__self_rename_at_189.loopIterators(__name_rename_at_192,__context__));
+			char * __field_rename_at_195 = (char *)(char *)(((char *)(to_das_string(__expr_rename_at_189->name /*name*/,__context__))));
+			if ( _Funcbuiltin_0x60_find_index_391234c3541d2c09(__context__,das_arg<TArray<char *>>::pass((*__it_rename_at_194).fields),__field_rename_at_195) == -1 )
+			{
+				ast_error(compileProgram(__context__),__expr_rename_at_189->at /*at*/,das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(__field_rename_at_195), cast<char * const >::from(((char *) " is not a column of ")), cast<char *>::from((*__it_rename_at_194).soa))));
+				das_copy((*__it_rename_at_194).failed,true);
+				return __expr_rename_at_189;
+			} else {
+				(*__it_rename_at_194).uses--;
+				if ( _Funcbuiltin_0x60_find_index_391234c3541d2c09(__context__,das_arg<TArray<char *>>::pass((*__it_rename_at_194).columns),__field_rename_at_195) == -1 )
+				{
+					_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass((*__it_rename_at_194).columns),__field_rename_at_195,-1);
+				};
+				return /* <- */ make_var_a6a6672e3646a9d(__context__,column_var_15dca5cef524fc1c(__context__,__name_rename_at_192,__field_rename_at_195),__expr_rename_at_189->at /*at*/);
+			};
+		};
+	};
+	if ( !(SimPolicy<char *>::Equ(cast<char *>::from(__expr_rename_at_189->value /*value*/->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprAt")),*__context__)) )
+	{
+		return __expr_rename_at_189;
+	} else {
+		ExprAt * __eat_rename_at_207 = (ExprAt *)das_cast<ExprAt *>::cast(__expr_rename_at_189->value /*value*/);
+		if ( !is_soa_type_d72aca54849a3942(__context__,__eat_rename_at_207->subexpr /*subexpr*/->type /*_type*/) )
+		{
+			return __expr_rename_at_189;
+		} else {
+			das_copy(__self_rename_at_189.changed,true);
+			smart_ptr_raw<ExprField> __column_rename_at_211; das_zero(__column_rename_at_211); das_move(__column_rename_at_211, das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_211) {
+				das_copy((__mks_211.at /*at*/),(__expr_rename_at_189->at /*at*/));
+				das_move((__mks_211.value /*value*/),(clone_expression(__eat_rename_at_207->subexpr /*subexpr*/)));
+				{
+					das_clone(__mks_211.name /*name*/,__expr_rename_at_189->name /*name*/);
+				}			}))));
+			return /* <- */ das_ascend_handle<true,smart_ptr_raw<ExprAt>>::make(__context__,nullptr,(([&](ExprAt & __mks_212) {
+				das_copy((__mks_212.at /*at*/),(__eat_rename_at_207->at /*at*/));
+				das_move((__mks_212.subexpr /*subexpr*/),(__column_rename_at_211));
+				das_move((__mks_212.index /*index*/),(clone_expression(__eat_rename_at_207->index /*index*/)));
+			})));
+		};
+	};
+}}
+
+inline smart_ptr_raw<Expression> _FuncSoaIndexVisitor_0x60_visitExprFor_d13689cfcc4545f2 ( Context * __context__, struct soa::SoaIndexVisitor &  __self_rename_at_225, smart_ptr_raw<ExprFor> const  __expr_rename_at_225 ) { das_stack_prologue __prologue(__context__,400,"SoaIndexVisitor`visitExprFor " DAS_FILE_LINE);
+{
+	bool __isSoa_rename_at_226 = false;
+	bool __failed_rename_at_227 = false;
+	{
+		bool __need_loop_228 = true;
+		// it : $::das_string const&
+		das_iterator<das::vector<das::string> const > __it_iterator(__expr_rename_at_225->iterators /*iterators*/);
+		das::string const  * __it_rename_at_228;
+		__need_loop_228 = __it_iterator.first(__context__,(__it_rename_at_228)) && __need_loop_228;
+		// src : smart_ptr<ast::Expression> const&
+		das_iterator<das::vector<smart_ptr<Expression>> const > __src_iterator(__expr_rename_at_225->sources /*sources*/);
+		smart_ptr<Expression> const  * __src_rename_at_228;
+		__need_loop_228 = __src_iterator.first(__context__,(__src_rename_at_228)) && __need_loop_228;
+		for ( ; __need_loop_228 ; __need_loop_228 = __it_iterator.next(__context__,(__it_rename_at_228)) && __src_iterator.next(__context__,(__src_rename_at_228)) )
+		{
+			if ( !is_soa_type_d72aca54849a3942(__context__,(*__src_rename_at_228)->type /*_type*/) )
+			{
+				continue;
+			} else {
+				das_copy(__isSoa_rename_at_226,true);
+				char * __name_rename_at_232 = (char *)(char *)(((char *)(to_das_string((*__it_rename_at_228),__context__))));
+				Structure * __st_rename_at_233 = (Structure *)(*__src_rename_at_228)->type /*_type*/->structType /*structType*/;
+				if ( __self_rename_at_225.loopIterators(__name_rename_at_232,__context__).failed )
+				{
+					das_copy(__failed_rename_at_227,true);
+				} else if ( (__self_rename_at_225.loopIterators(__name_rename_at_232,__context__).uses != 0) || !(is_simple_path_9d4b7081c9c2bfa0(__context__,_Funcbuiltin_0x60_get_ptr_98dd15e167848d85(__context__,(*__src_rename_at_228)))) )
+				{
+					ast_error(compileProgram(__context__),__expr_rename_at_225->at /*at*/,das_string_builder(__context__,SimNode_AotInterop<8>(__tinfo_1, cast<char * const >::from(((char *) "for ")), cast<char * const >::from(__name_rename_at_232), cast<char * const >::from(((char *) " in ")), cast<das::string const  &>::from(__st_rename_at_233->name /*name*/), cast<char * const >::from(((char *) " only supports ")), cast<char * const >::from(__name_rename_at_232), cast<char * const >::from(((char *) ".field access, iterate the columns instead, i.e. for x in soa.")), cast<das::string const  &>::from(das_index<das::vector<Structure::FieldDeclaration> const >::at(__st_rename_at_233->fields /*fields*/,0,__context__).name /*name*/))));
+					das_copy(__failed_rename_at_227,true);
+				};
+			};
+		}
+		__it_iterator.close(__context__,(__it_rename_at_228));
+		__src_iterator.close(__context__,(__src_rename_at_228));
+	};
+	if ( !__isSoa_rename_at_226 || __failed_rename_at_227 )
+	{
+		return __expr_rename_at_225;
+	} else {
+		das_copy(__self_rename_at_225.changed,true);
+		smart_ptr_raw<ExprFor> __loop_rename_at_242; das_zero(__loop_rename_at_242); das_move(__loop_rename_at_242, das_ascend_handle<true,smart_ptr_raw<ExprFor>>::make(__context__,nullptr,(([&](ExprFor & __mks_242) {
+			das_copy((__mks_242.at /*at*/),(__expr_rename_at_225->at /*at*/));
+			das_copy((__mks_242.visibility /*visibility*/),(__expr_rename_at_225->visibility /*visibility*/));
+		}))));
+		{
+			bool __need_loop_243 = true;
+			// it : $::das_string const&
+			das_iterator<das::vector<das::string> const > __it_iterator(__expr_rename_at_225->iterators /*iterators*/);
+			das::string const  * __it_rename_at_243;
+			__need_loop_243 = __it_iterator.first(__context__,(__it_rename_at_243)) && __need_loop_243;
+			// itAt : rtti::LineInfo const&
+			das_iterator<das::vector<LineInfo> const > __itAt_iterator(__expr_rename_at_225->iteratorsAt /*iteratorsAt*/);
+			LineInfo const  * __itAt_rename_at_243;
+			__need_loop_243 = __itAt_iterator.first(__context__,(__itAt_rename_at_243)) && __need_loop_243;
+			// src : smart_ptr<ast::Expression> const&
+			das_iterator<das::vector<smart_ptr<Expression>> const > __src_iterator(__expr_rename_at_225->sources /*sources*/);
+			smart_ptr<Expression> const  * __src_rename_at_243;
+			__need_loop_243 = __src_iterator.first(__context__,(__src_rename_at_243)) && __need_loop_243;
+			for ( ; __need_loop_243 ; __need_loop_243 = __it_iterator.next(__context__,(__it_rename_at_243)) && __itAt_iterator.next(__context__,(__itAt_rename_at_243)) && __src_iterator.next(__context__,(__src_rename_at_243)) )
+			{
+				char * __name_rename_at_244 = (char *)(char *)(((char *)(to_das_string((*__it_rename_at_243),__context__))));
+				if ( !is_soa_type_d72aca54849a3942(__context__,(*__src_rename_at_243)->type /*_type*/) )
+				{
+					add_iterator_5e16bd3c41ceb163(__context__,__loop_rename_at_242,__name_rename_at_244);
+					das_vector_push(das_arg<das::vector<LineInfo>>::pass(__loop_rename_at_242->iteratorsAt /*iteratorsAt*/),(*__itAt_rename_at_243));
+					das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__loop_rename_at_242->sources /*sources*/),clone_expression((*__src_rename_at_243)));
+					continue;
+				} else {
+					TArray<char *> * __columns_rename_at_250 = &(__self_rename_at_225.loopIterators(__name_rename_at_244,__context__).columns);
+					if ( builtin_array_size(das_arg<TArray<char *>>::pass((*__columns_rename_at_250))) == 0 )
+					{
+						_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass((*__columns_rename_at_250)),((char *)(to_das_string(das_index<das::vector<Structure::FieldDeclaration> const >::at((*__src_rename_at_243)->type /*_type*/->structType /*structType*/->fields /*fields*/,0,__context__).name /*name*/,__context__))),-1);
+					};
+					{
+						bool __need_loop_253 = true;
+						// field : string&
+						das_iterator<TArray<char *>> __field_iterator((*__columns_rename_at_250));
+						char * * __field_rename_at_253;
+						__need_loop_253 = __field_iterator.first(__context__,(__field_rename_at_253)) && __need_loop_253;
+						for ( ; __need_loop_253 ; __need_loop_253 = __field_iterator.next(__context__,(__field_rename_at_253)) )
+						{
+							add_iterator_5e16bd3c41ceb163(__context__,__loop_rename_at_242,column_var_15dca5cef524fc1c(__context__,__name_rename_at_244,(*__field_rename_at_253)));
+							das_vector_push(das_arg<das::vector<LineInfo>>::pass(__loop_rename_at_242->iteratorsAt /*iteratorsAt*/),(*__itAt_rename_at_243));
+							das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__loop_rename_at_242->sources /*sources*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_256) {
+								das_copy((__mks_256.at /*at*/),((*__src_rename_at_243)->at /*at*/));
+								das_move((__mks_256.value /*value*/),(clone_expression((*__src_rename_at_243))));
+								{
+									set_das_string(das_arg<das::string>::pass(__mks_256.name /*name*/),(*__field_rename_at_253));
+								}							})))));
+						}
+						__field_iterator.close(__context__,(__field_rename_at_253));
+					};
+					_Funcbuiltin_0x60_erase_85f507120ddd4252(__context__,das_arg<TTable<char *,struct soa::SoaLoopIterator>>::pass(__self_rename_at_225.loopIterators),__name_rename_at_244);
+				};
+			}
+			__it_iterator.close(__context__,(__it_rename_at_243));
+			__itAt_iterator.close(__context__,(__itAt_rename_at_243));
+			__src_iterator.close(__context__,(__src_rename_at_243));
+		};
+		smart_ptr<Expression> __body_rename_at_258; das_zero(__body_rename_at_258); das_move(__body_rename_at_258, clone_expression(__expr_rename_at_225->body /*body*/));
+		das_move(__loop_rename_at_242->body /*body*/,__body_rename_at_258);
+		return /* <- */ __loop_rename_at_242;
+	};
+}}
+
+inline smart_ptr_raw<Expression> _FuncSoaIndexVisitor_0x60_visitExprVar_6bb96e9319373a6f ( Context * __context__, struct soa::SoaIndexVisitor &  __self_rename_at_213, smart_ptr_raw<ExprVar> const  __expr_rename_at_213 )
+{
+	char * __name_rename_at_214 = (char *)(char *)(((char *)(to_das_string(__expr_rename_at_213->name /*name*/,__context__))));
+	if ( _Funcbuiltin_0x60_key_exists_9333da3222ff08a2(__context__,das_arg<TTable<char *,struct soa::SoaLoopIterator>>::pass(__self_rename_at_213.loopIterators),__name_rename_at_214) )
+	{
+		__self_rename_at_213.loopIterators(__name_rename_at_214,__context__).uses++;
+	};
+	return __expr_rename_at_213;
+}
+
+inline struct soa::SoaStructMacro SoaStructMacro_b8c4870004aa705b ( Context * __context__ )
+{
+	return (([&]() -> struct soa::SoaStructMacro {
+		struct soa::SoaStructMacro __mks_126;
+		das_zero(__mks_126);
+		das_copy((__mks_126.__rtti),(((void *)(&__type_info__f494d7e5))));
+		das_copy((__mks_126.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaStructMacro'__finalize SoaStructMacro*/ 2862454687u)))));
+		das_copy((__mks_126.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaStructMacro`apply SoaStructMacro #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 2554737600u)))));
+		return __mks_126;
+	})());
+}
+
+inline void _FuncSoaStructMacro_0x27___finalize_a1d05e2082647f59 ( Context * __context__, struct soa::SoaStructMacro &  __self_rename_at_126 )
+{
+	finalize_219b89fabaf27b02(__context__,das_arg<struct soa::SoaStructMacro>::pass(__self_rename_at_126));
+}
+
+inline bool _FuncSoaStructMacro_0x60_apply_579af7bdbe5efa8f ( Context * __context__, struct soa::SoaStructMacro &  __self_rename_at_127, smart_ptr_raw<Structure> __st_rename_at_127, ModuleGroup &  __group_rename_at_127, AnnotationArgumentList const  &  __args_rename_at_127, das::string &  __errors_rename_at_127 )
+{
+	if ( das_get_bitfield(__st_rename_at_127->flags /*flags*/,1u << 0) )
+	{
+		set_das_string(das_arg<das::string>::pass(__errors_rename_at_127),((char *) "soa can't be applied to a class"));
+		return false;
+	} else {
+		if ( __st_rename_at_127->fields /*fields*/.size() /*length*/ == 0 )
+		{
+			set_das_string(das_arg<das::string>::pass(__errors_rename_at_127),((char *) "soa structure needs at least one field"));
+			return false;
+		} else {
+			smart_ptr<Structure> __soa_rename_at_134; das_zero(__soa_rename_at_134); das_move(__soa_rename_at_134, clone_structure(__st_rename_at_127));
+			set_das_string(das_arg<das::string>::pass(__soa_rename_at_134->name /*name*/),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<das::string &>::from(__st_rename_at_127->name /*name*/), cast<char * const >::from(((char *) "_SOA")))));
+			__soa_rename_at_134->flags /*flags*/ |= 0x10u;
+			{
+				bool __need_loop_137 = true;
+				// fld : ast::FieldDeclaration&
+				das_iterator<das::vector<Structure::FieldDeclaration>> __fld_iterator(__soa_rename_at_134->fields /*fields*/);
+				Structure::FieldDeclaration * __fld_rename_at_137;
+				__need_loop_137 = __fld_iterator.first(__context__,(__fld_rename_at_137)) && __need_loop_137;
+				for ( ; __need_loop_137 ; __need_loop_137 = __fld_iterator.next(__context__,(__fld_rename_at_137)) )
+				{
+					smart_ptr_raw<TypeDecl> __column_rename_at_138; das_zero(__column_rename_at_138); das_move(__column_rename_at_138, das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_138) {
+						das_copy((__mks_138.at /*at*/),((*__fld_rename_at_137).at /*at*/));
+						das_copy((__mks_138.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tArray));
+						das_move((__mks_138.firstType /*firstType*/),(clone_type((*__fld_rename_at_137).type /*_type*/)));
+					}))));
+					das_move((*__fld_rename_at_137).type /*_type*/,__column_rename_at_138);
+					das_delete_handle<smart_ptr<Expression>>::clear(__context__,(*__fld_rename_at_137).init /*init*/);
+				}
+				__fld_iterator.close(__context__,(__fld_rename_at_137));
+			};
+			LineInfo __at_rename_at_142 = (LineInfo)__st_rename_at_127->at /*at*/;
+			Structure * __psoa_rename_at_143 = (Structure *)_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9(__context__,__soa_rename_at_134);
+			if ( !addModuleStructure(compileModule(__context__),__soa_rename_at_134,__context__) )
+			{
+				set_das_string(das_arg<das::string>::pass(__errors_rename_at_127),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "soa structure ")), cast<das::string &>::from(__st_rename_at_127->name /*name*/), cast<char * const >::from(((char *) "_SOA is already defined")))));
+				return false;
+			} else {
+				das_copy(das_global<TTable<char *,bool>,0>(__context__) /*soaStructures*/(soa_key_4dc0a8b2750d6e9d(__context__,__psoa_rename_at_143),__context__),true);
+				generate_length_5a59334671a89743(__context__,__psoa_rename_at_143,__at_rename_at_142);
+				generate_push_9e41f90ae8e50517(__context__,__psoa_rename_at_143,_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9(__context__,__st_rename_at_127),__at_rename_at_142);
+				generate_per_column_99c031c68aa7198b(__context__,__psoa_rename_at_143,((char *) "resize"),((char *) "newSize"),__at_rename_at_142);
+				generate_per_column_99c031c68aa7198b(__context__,__psoa_rename_at_143,((char *) "reserve"),((char *) "newSize"),__at_rename_at_142);
+				generate_per_column_99c031c68aa7198b(__context__,__psoa_rename_at_143,((char *) "erase"),((char *) "index"),__at_rename_at_142);
+				generate_per_column_99c031c68aa7198b(__context__,__psoa_rename_at_143,((char *) "clear"),((char *) ""),__at_rename_at_142);
+				return true;
+			};
+		};
+	};
+}
+
+inline void __setup_macros_109fa2d1b5ee9e0c ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "soa"),__context__) )
+	{
+		_Funcast_0x60_add_new_structure_annotation_9adfc7e85c7f8d0e(__context__,((char *) "soa"),das_new<struct soa::SoaStructMacro>::make_and_init(__context__,[&]() { return SoaStructMacro_b8c4870004aa705b(__context__); }));
+		_Funcast_boost_0x60_add_new_infer_macro_208841e51335b966(__context__,((char *) "soa_index"),das_new<struct soa::SoaIndexMacro>::make_and_init(__context__,[&]() { return SoaIndexMacro_bbc2d5639c520f24(__context__); }));
+	};
+}
+
+inline void add_argument_a02bcfb2a1bd4f5c ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_75, char * const  __name_rename_at_75, smart_ptr_raw<TypeDecl> __typ_rename_at_75, LineInfo const  &  __at_rename_at_75 ) { das_stack_prologue __prologue(__context__,112,"add_argument " DAS_FILE_LINE);
+{
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Variable>>>::pass(__fn_rename_at_75->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_76) {
+		das_copy((__mks_76.at /*at*/),(__at_rename_at_75));
+		das_move((__mks_76.type /*_type*/),(__typ_rename_at_75));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_76.name /*name*/),__name_rename_at_75);
+		}	}))));
+}}
+
+inline void add_iterator_5e16bd3c41ceb163 ( Context * __context__, smart_ptr_raw<ExprFor> __loop_rename_at_166, char * const  __name_rename_at_166 )
+{
+	int32_t __index_rename_at_167 = (int32_t)__loop_rename_at_166->iterators /*iterators*/.size() /*length*/;
+	das_vector_resize(das_arg<das::vector<das::string>>::pass(__loop_rename_at_166->iterators /*iterators*/),__index_rename_at_167 + 1);
+	set_das_string(das_arg<das::string>::pass(das_index<das::vector<das::string>>::at(__loop_rename_at_166->iterators /*iterators*/,__index_rename_at_167,__context__)),__name_rename_at_166);
+}
+
+inline void _Funcast_boost_0x60_add_new_infer_macro_208841e51335b966 ( Context * __context__, char * const  __name_rename_at_144, struct soa::SoaIndexMacro * const  __someClassPtr_rename_at_144 )
+{
+	smart_ptr_raw<PassMacro> __ann_rename_at_145; das_zero(__ann_rename_at_145); das_move(__ann_rename_at_145, _Funcast_0x60_make_pass_macro_7b64b679e17c16f0(__context__,__name_rename_at_144,__someClassPtr_rename_at_144));
+	addModuleInferDirtyMacro(thisModule(__context__,nullptr),__ann_rename_at_145,__context__);
+	das_delete_handle<smart_ptr_raw<PassMacro>>::clear(__context__,__ann_rename_at_145);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_9adfc7e85c7f8d0e ( Context * __context__, char * const  __name_rename_at_503, struct soa::SoaStructMacro * const  __someClassPtr_rename_at_503 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_504; das_zero(__ann_rename_at_504); das_move(__ann_rename_at_504, _Funcast_0x60_make_structure_annotation_387775a111ed5a8b(__context__,__name_rename_at_503,__someClassPtr_rename_at_503));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_504,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_504);
+}
+
+inline smart_ptr_raw<PassMacro> _Funcast_0x60_make_pass_macro_7b64b679e17c16f0 ( Context * __context__, char * const  __name_rename_at_481, struct soa::SoaIndexMacro * const  __someClassPtr_rename_at_481 )
+{
+	StructInfo const  * __classInfo_rename_at_483 = (StructInfo const  *)_Funcrtti_0x60_class_info_2f092740ebba8004(__context__,das_deref(__context__,__someClassPtr_rename_at_481));
+	return makePassMacro(__name_rename_at_481,__someClassPtr_rename_at_481,__classInfo_rename_at_483,__context__);
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_387775a111ed5a8b ( Context * __context__, char * const  __name_rename_at_447, struct soa::SoaStructMacro * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = (StructInfo const  *)_Funcrtti_0x60_class_info_2da3ffb9e63c6811(__context__,das_deref(__context__,__someClassPtr_rename_at_447));
+	return makeStructureAnnotation(__name_rename_at_447,__someClassPtr_rename_at_447,__classInfo_rename_at_449,__context__);
+}
+
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_77e8d351d3db6b01 ( Context * __context__, struct soa::SoaIndexVisitor const  &  __someClass_rename_at_455 )
+{
+	struct soa::SoaIndexVisitor const  * __classPtr_rename_at_458 = (struct soa::SoaIndexVisitor const  *)das_ref(__context__,__someClass_rename_at_455);
+	StructInfo const  * __classInfo_rename_at_459 = (StructInfo const  *)_Funcrtti_0x60_class_info_555df62c5ef98c6a(__context__,__someClass_rename_at_455);
+	return makeVisitor(__classPtr_rename_at_458,__classInfo_rename_at_459,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_erase_85f507120ddd4252 ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> &  __Tab_rename_at_180, char * const  __at_rename_at_180 )
+{
+	return __builtin_table_erase(__context__,__Tab_rename_at_180,__at_rename_at_180);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_a43d15b4031d8219 ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> &  __a_rename_at_292 )
+{
+	Sequence DAS_COMMENT((struct soa::SoaLoopIterator *)) _temp_make_local_294_32;
+	{
+		bool __need_loop_294 = true;
+		// aV : soa::SoaLoopIterator&
+		das_iterator<Sequence DAS_COMMENT((struct soa::SoaLoopIterator))> __aV_iterator((_temp_make_local_294_32 = (_Funcbuiltin_0x60_values_bc7e14cea4b1cf4e(__context__,das_arg<TTable<char *,struct soa::SoaLoopIterator>>::pass(__a_rename_at_292)))));
+		struct soa::SoaLoopIterator * __aV_rename_at_294;
+		__need_loop_294 = __aV_iterator.first(__context__,(__aV_rename_at_294)) && __need_loop_294;
+		for ( ; __need_loop_294 ; __need_loop_294 = __aV_iterator.next(__context__,(__aV_rename_at_294)) )
+		{
+			finalize_916f543ff91d1662(__context__,das_arg<struct soa::SoaLoopIterator>::pass((*__aV_rename_at_294)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_294));
+	};
+	builtin_table_free(das_arg<TTable<char *,struct soa::SoaLoopIterator>>::pass(__a_rename_at_292),8,64,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_find_index_391234c3541d2c09 ( Context * __context__, TArray<char *> const  &  __arr_rename_at_633, char * const  __key_rename_at_633 )
+{
+	{
+		bool __need_loop_637 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,builtin_array_size(__arr_rename_at_633)));
+		int32_t __i_rename_at_637;
+		__need_loop_637 = __i_iterator.first(__context__,(__i_rename_at_637)) && __need_loop_637;
+		for ( ; __need_loop_637 ; __need_loop_637 = __i_iterator.next(__context__,(__i_rename_at_637)) )
+		{
+			if ( SimPolicy<char *>::Equ(cast<char *>::from(__arr_rename_at_633(__i_rename_at_637,__context__)),cast<char *>::from(__key_rename_at_633),*__context__) )
+			{
+				return __i_rename_at_637;
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_637));
+	};
+	return -1;
+}
+
+inline Expression * _Funcbuiltin_0x60_get_ptr_98dd15e167848d85 ( Context * __context__, smart_ptr<Expression> const  __src_rename_at_701 )
+{
+	return das_cast<Expression *>::cast(__src_rename_at_701);
+}
+
+inline Structure * _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9 ( Context * __context__, smart_ptr<Structure> const  __src_rename_at_701 )
+{
+	return das_cast<Structure *>::cast(__src_rename_at_701);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_9333da3222ff08a2 ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> const  &  __Tab_rename_at_183, char * const  __at_rename_at_183 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_183,__at_rename_at_183);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_7f36a4402097a77 ( Context * __context__, TTable<char *,bool> const  &  __Tab_rename_at_183, char * const  __at_rename_at_183 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_183,__at_rename_at_183);
+}
+
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> &  __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<char *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline Sequence DAS_COMMENT((struct soa::SoaLoopIterator &)) _Funcbuiltin_0x60_values_bc7e14cea4b1cf4e ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> &  __a_rename_at_272 )
+{
+	Sequence DAS_COMMENT((struct soa::SoaLoopIterator *)) __it_rename_at_273; das_zero(__it_rename_at_273);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((struct soa::SoaLoopIterator))>::pass(__it_rename_at_273),das_arg<TTable<char *,struct soa::SoaLoopIterator>>::pass(__a_rename_at_272),64,__context__);
+	return /* <- */ __it_rename_at_273;
+}
+
+inline char * column_var_15dca5cef524fc1c ( Context * __context__, char * const  __it_rename_at_172, char * const  __field_rename_at_172 )
+{
+	return das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_4, cast<char * const >::from(((char *) "__soa_")), cast<char * const >::from(__it_rename_at_172), cast<char * const >::from(((char *) "_")), cast<char * const >::from(__field_rename_at_172)));
+}
+
+inline void finalize_72b128e3f5f15ad6 ( Context * __context__, struct soa::SoaIndexVisitor * & ____this_rename_at_271 )
+{
+	if ( ____this_rename_at_271 != nullptr )
+	{
+		das_invoke_function<void>::invoke<struct ast::AstVisitor &>(__context__,____this_rename_at_271->__finalize,das_arg<struct ast::AstVisitor>::pass(das_cast<struct ast::AstVisitor>::cast(das_deref(__context__,____this_rename_at_271))));
+		das_delete<struct soa::SoaIndexVisitor *>::clear(__context__,____this_rename_at_271);
+		das_copy(____this_rename_at_271,nullptr);
+	};
+}
+
+inline void finalize_64b80aaf5235539 ( Context * __context__, struct soa::SoaIndexMacro &  ____this_rename_at_263 )
+{
+	memset(&(____this_rename_at_263), 0, 16);
+}
+
+inline void finalize_a5f0d706a0d32603 ( Context * __context__, struct soa::SoaIndexVisitor &  ____this_rename_at_186 )
+{
+	_Funcbuiltin_0x60_finalize_a43d15b4031d8219(__context__,das_arg<TTable<char *,struct soa::SoaLoopIterator>>::pass(____this_rename_at_186.loopIterators));
+	memset(&(____this_rename_at_186), 0, 1136);
+}
+
+inline void finalize_916f543ff91d1662 ( Context * __context__, struct soa::SoaLoopIterator &  ____this_rename_at_176 )
+{
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(____this_rename_at_176.fields));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(____this_rename_at_176.columns));
+	memset(&(____this_rename_at_176), 0, 64);
+}
+
+inline void finalize_219b89fabaf27b02 ( Context * __context__, struct soa::SoaStructMacro &  ____this_rename_at_126 )
+{
+	memset(&(____this_rename_at_126), 0, 24);
+}
+
+inline void generate_length_5a59334671a89743 ( Context * __context__, Structure * const  __soa_rename_at_100, LineInfo const  &  __at_rename_at_100 ) { das_stack_prologue __prologue(__context__,208,"generate_length " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __fn_rename_at_101; das_zero(__fn_rename_at_101); das_move(__fn_rename_at_101, make_function_e3f5821fa771d9c0(__context__,((char *) "length"),__soa_rename_at_100,true,__at_rename_at_100));
+	smart_ptr_raw<TypeDecl> __rtype_rename_at_102; das_zero(__rtype_rename_at_102); das_move(__rtype_rename_at_102, int_type_1abb4ebc7b84b873(__context__,__at_rename_at_100));
+	das_move(__fn_rename_at_101->result /*result*/,__rtype_rename_at_102);
+	smart_ptr_raw<ExprCall> __call_rename_at_104; das_zero(__call_rename_at_104); das_move(__call_rename_at_104, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_104) {
+		das_copy((__mks_104.at /*at*/),(__at_rename_at_100));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_104.name /*name*/),((char *) "length"));
+		}	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_104->arguments /*arguments*/),make_field_4ffacec1682aee91(__context__,((char *) "soa"),((char *)(to_das_string(das_index<das::vector<Structure::FieldDeclaration> const >::at(__soa_rename_at_100->fields /*fields*/,0,__context__).name /*name*/,__context__))),__at_rename_at_100));
+	smart_ptr_raw<ExprBlock> __blk_rename_at_106; das_zero(__blk_rename_at_106); das_move(__blk_rename_at_106, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_106) {
+		das_copy((__mks_106.at /*at*/),(__at_rename_at_100));
+	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_106->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(das_ascend_handle<true,smart_ptr_raw<ExprReturn>>::make(__context__,nullptr,(([&](ExprReturn & __mks_107) {
+		das_copy((__mks_107.at /*at*/),(__at_rename_at_100));
+		das_move((__mks_107.subexpr /*subexpr*/),(__call_rename_at_104));
+	})))));
+	das_move(__fn_rename_at_101->body /*body*/,__blk_rename_at_106);
+	addModuleFunction(compileModule(__context__),__fn_rename_at_101,__context__);
+}}
+
+inline void generate_per_column_99c031c68aa7198b ( Context * __context__, Structure * const  __soa_rename_at_84, char * const  __name_rename_at_84, char * const  __argName_rename_at_84, LineInfo const  &  __at_rename_at_84 ) { das_stack_prologue __prologue(__context__,288,"generate_per_column " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __fn_rename_at_85; das_zero(__fn_rename_at_85); das_move(__fn_rename_at_85, make_function_e3f5821fa771d9c0(__context__,__name_rename_at_84,__soa_rename_at_84,false,__at_rename_at_84));
+	if ( SimPolicy<char *>::NotEqu(cast<char *>::from(__argName_rename_at_84),cast<char *>::from(((char *) "")),*__context__) )
+	{
+		add_argument_a02bcfb2a1bd4f5c(__context__,__fn_rename_at_85,__argName_rename_at_84,int_type_1abb4ebc7b84b873(__context__,__at_rename_at_84),__at_rename_at_84);
+	};
+	smart_ptr_raw<ExprBlock> __blk_rename_at_88; das_zero(__blk_rename_at_88); das_move(__blk_rename_at_88, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_88) {
+		das_copy((__mks_88.at /*at*/),(__at_rename_at_84));
+	}))));
+	{
+		bool __need_loop_89 = true;
+		// fld : ast::FieldDeclaration const&
+		das_iterator<das::vector<Structure::FieldDeclaration> const > __fld_iterator(__soa_rename_at_84->fields /*fields*/);
+		Structure::FieldDeclaration const  * __fld_rename_at_89;
+		__need_loop_89 = __fld_iterator.first(__context__,(__fld_rename_at_89)) && __need_loop_89;
+		for ( ; __need_loop_89 ; __need_loop_89 = __fld_iterator.next(__context__,(__fld_rename_at_89)) )
+		{
+			smart_ptr_raw<ExprCall> __call_rename_at_90; das_zero(__call_rename_at_90); das_move(__call_rename_at_90, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_90) {
+				das_copy((__mks_90.at /*at*/),(__at_rename_at_84));
+				{
+					set_das_string(das_arg<das::string>::pass(__mks_90.name /*name*/),__name_rename_at_84);
+				}			}))));
+			das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_90->arguments /*arguments*/),make_field_4ffacec1682aee91(__context__,((char *) "soa"),((char *)(to_das_string((*__fld_rename_at_89).name /*name*/,__context__))),__at_rename_at_84));
+			if ( SimPolicy<char *>::NotEqu(cast<char *>::from(__argName_rename_at_84),cast<char *>::from(((char *) "")),*__context__) )
+			{
+				das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_90->arguments /*arguments*/),make_var_a6a6672e3646a9d(__context__,__argName_rename_at_84,__at_rename_at_84));
+			};
+			das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_88->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__call_rename_at_90));
+		}
+		__fld_iterator.close(__context__,(__fld_rename_at_89));
+	};
+	das_move(__fn_rename_at_85->body /*body*/,__blk_rename_at_88);
+	addModuleFunction(compileModule(__context__),__fn_rename_at_85,__context__);
+}}
+
+inline void generate_push_9e41f90ae8e50517 ( Context * __context__, Structure * const  __soa_rename_at_113, Structure * const  __st_rename_at_113, LineInfo const  &  __at_rename_at_113 ) { das_stack_prologue __prologue(__context__,288,"generate_push " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __fn_rename_at_114; das_zero(__fn_rename_at_114); das_move(__fn_rename_at_114, make_function_e3f5821fa771d9c0(__context__,((char *) "push"),__soa_rename_at_113,false,__at_rename_at_113));
+	add_argument_a02bcfb2a1bd4f5c(__context__,__fn_rename_at_114,((char *) "value"),struct_type_b1bb452182a2b9c7(__context__,__st_rename_at_113,true),__at_rename_at_113);
+	smart_ptr_raw<ExprBlock> __blk_rename_at_116; das_zero(__blk_rename_at_116); das_move(__blk_rename_at_116, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_116) {
+		das_copy((__mks_116.at /*at*/),(__at_rename_at_113));
+	}))));
+	{
+		bool __need_loop_117 = true;
+		// fld : ast::FieldDeclaration const&
+		das_iterator<das::vector<Structure::FieldDeclaration> const > __fld_iterator(__soa_rename_at_113->fields /*fields*/);
+		Structure::FieldDeclaration const  * __fld_rename_at_117;
+		__need_loop_117 = __fld_iterator.first(__context__,(__fld_rename_at_117)) && __need_loop_117;
+		for ( ; __need_loop_117 ; __need_loop_117 = __fld_iterator.next(__context__,(__fld_rename_at_117)) )
+		{
+			smart_ptr_raw<ExprCall> __call_rename_at_118; das_zero(__call_rename_at_118); das_move(__call_rename_at_118, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_118) {
+				das_copy((__mks_118.at /*at*/),(__at_rename_at_113));
+				{
+					set_das_string(das_arg<das::string>::pass(__mks_118.name /*name*/),((char *) "push_clone"));
+				}			}))));
+			das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_118->arguments /*arguments*/),make_field_4ffacec1682aee91(__context__,((char *) "soa"),((char *)(to_das_string((*__fld_rename_at_117).name /*name*/,__context__))),__at_rename_at_113));
+			das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_118->arguments /*arguments*/),make_field_4ffacec1682aee91(__context__,((char *) "value"),((char *)(to_das_string((*__fld_rename_at_117).name /*name*/,__context__))),__at_rename_at_113));
+			das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_116->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__call_rename_at_118));
+		}
+		__fld_iterator.close(__context__,(__fld_rename_at_117));
+	};
+	das_move(__fn_rename_at_114->body /*body*/,__blk_rename_at_116);
+	addModuleFunction(compileModule(__context__),__fn_rename_at_114,__context__);
+}}
+
+inline smart_ptr_raw<TypeDecl> int_type_1abb4ebc7b84b873 ( Context * __context__, LineInfo const  &  __at_rename_at_79 )
+{
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_80) {
+		das_copy((__mks_80.at /*at*/),(__at_rename_at_79));
+		das_copy((__mks_80.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tInt));
+	})));
+}
+
+inline bool is_simple_path_9d4b7081c9c2bfa0 ( Context * __context__, Expression * const  __expr_rename_at_157 )
+{
+	return (SimPolicy<char *>::Equ(cast<char *>::from(__expr_rename_at_157->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprVar")),*__context__)) ? (true) : (((SimPolicy<char *>::Equ(cast<char *>::from(__expr_rename_at_157->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprField")),*__context__)) ? (is_simple_path_9d4b7081c9c2bfa0(__context__,_Funcbuiltin_0x60_get_ptr_98dd15e167848d85(__context__,das_cast<ExprField *>::cast(__expr_rename_at_157)->value /*value*/))) : (false)));
+}
+
+inline bool is_soa_type_d72aca54849a3942 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __typ_rename_at_46 )
+{
+	return ((((equ_sptr_ptr(__typ_rename_at_46,nullptr)) || (__typ_rename_at_46->baseType /*baseType*/ != DAS_COMMENT(bound_enum) das::Type::tStructure)) || (__typ_rename_at_46->dim /*dim*/.size() /*length*/ != 0)) || (__typ_rename_at_46->structType /*structType*/ == nullptr)) ? (false) : (_Funcbuiltin_0x60_key_exists_7f36a4402097a77(__context__,das_arg<TTable<char *,bool>>::pass(das_global<TTable<char *,bool>,0>(__context__) /*soaStructures*/),soa_key_4dc0a8b2750d6e9d(__context__,__typ_rename_at_46->structType /*structType*/)));
+}
+
+inline smart_ptr_raw<Expression> make_field_4ffacec1682aee91 ( Context * __context__, char * const  __name_rename_at_56, char * const  __field_rename_at_56, LineInfo const  &  __at_rename_at_56 ) { das_stack_prologue __prologue(__context__,112,"make_field " DAS_FILE_LINE);
+{
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_57) {
+		das_copy((__mks_57.at /*at*/),(__at_rename_at_56));
+		das_move((__mks_57.value /*value*/),(make_var_a6a6672e3646a9d(__context__,__name_rename_at_56,__at_rename_at_56)));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_57.name /*name*/),__field_rename_at_56);
+		}	})));
+}}
+
+inline smart_ptr_raw<Function> make_function_e3f5821fa771d9c0 ( Context * __context__, char * const  __name_rename_at_67, Structure * const  __st_rename_at_67, bool __isConst_rename_at_67, LineInfo const  &  __at_rename_at_67 ) { das_stack_prologue __prologue(__context__,224,"make_function " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __fn_rename_at_68; das_zero(__fn_rename_at_68); das_move(__fn_rename_at_68, das_ascend_handle<true,smart_ptr_raw<Function>>::make(__context__,nullptr,(([&](Function & __mks_68) {
+		das_copy((__mks_68.at /*at*/),(__at_rename_at_67));
+		das_copy((__mks_68.atDecl /*atDecl*/),(__at_rename_at_67));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_68.name /*name*/),__name_rename_at_67);
+		}	}))));
+	__fn_rename_at_68->flags /*flags*/ |= 0x200000u;
+	das_move(__fn_rename_at_68->result /*result*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_70) {
+		das_copy((__mks_70.at /*at*/),(__at_rename_at_67));
+		das_copy((__mks_70.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tVoid));
+	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Variable>>>::pass(__fn_rename_at_68->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_71) {
+		das_copy((__mks_71.at /*at*/),(__at_rename_at_67));
+		das_move((__mks_71.type /*_type*/),(struct_type_b1bb452182a2b9c7(__context__,__st_rename_at_67,__isConst_rename_at_67)));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_71.name /*name*/),((char *) "soa"));
+		}	}))));
+	return /* <- */ __fn_rename_at_68;
+}}
+
+inline smart_ptr_raw<Expression> make_var_a6a6672e3646a9d ( Context * __context__, char * const  __name_rename_at_52, LineInfo const  &  __at_rename_at_52 ) { das_stack_prologue __prologue(__context__,112,"make_var " DAS_FILE_LINE);
+{
+	return /* <- */ das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_53) {
+		das_copy((__mks_53.at /*at*/),(__at_rename_at_52));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_53.name /*name*/),__name_rename_at_52);
+		}	})));
+}}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_2f092740ebba8004 ( Context * __context__, struct soa::SoaIndexMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_555df62c5ef98c6a ( Context * __context__, struct soa::SoaIndexVisitor const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_2da3ffb9e63c6811 ( Context * __context__, struct soa::SoaStructMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline char * soa_key_4dc0a8b2750d6e9d ( Context * __context__, Structure * const  __st_rename_at_42 )
+{
+	return das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char * const >::from(((__st_rename_at_42->module /*_module*/ != nullptr) ? (((char *)(to_das_string(__st_rename_at_42->module /*_module*/->name /*name*/,__context__)))) : (((char *) "")))), cast<char * const >::from(((char *) "::")), cast<das::string const  &>::from(__st_rename_at_42->name /*name*/)));
+}
+
+inline smart_ptr_raw<TypeDecl> struct_type_b1bb452182a2b9c7 ( Context * __context__, Structure * const  __st_rename_at_60, bool __isConst_rename_at_60 )
+{
+	smart_ptr_raw<TypeDecl> __typ_rename_at_61; das_zero(__typ_rename_at_61); das_move(__typ_rename_at_61, das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_61) {
+		das_copy((__mks_61.at /*at*/),(__st_rename_at_60->at /*at*/));
+		das_copy((__mks_61.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tStructure));
+		das_copy((__mks_61.structType /*structType*/),(__st_rename_at_60));
+	}))));
+	if ( __isConst_rename_at_60 )
+	{
+		__typ_rename_at_61->flags /*flags*/ |= 0x2u;
+	};
+	return /* <- */ __typ_rename_at_61;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// SoaIndexMacro_bbc2d5639c520f24
+		aotLib[0x7c1b24e05027b6fc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct soa::SoaIndexMacro (*) ( Context * __context__ ),&SoaIndexMacro_bbc2d5639c520f24>>();
+	};
+		// _FuncSoaIndexMacro_0x27___finalize_de20d1bb89aaca8f
+		aotLib[0x6837b96a8a61ba4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct soa::SoaIndexMacro &  ),&_FuncSoaIndexMacro_0x27___finalize_de20d1bb89aaca8f>>();
+	};
+		// _FuncSoaIndexMacro_0x60_apply_19e77a34cf4289c5
+		aotLib[0xfd2c73f3fbb96954] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct soa::SoaIndexMacro & , smart_ptr_raw<Program> const  , Module * const   ),&_FuncSoaIndexMacro_0x60_apply_19e77a34cf4289c5>>();
+	};
+		// SoaIndexVisitor_26b58386aca161b6
+		aotLib[0x8a1debc0add808a8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct soa::SoaIndexVisitor (*) ( Context * __context__ ),&SoaIndexVisitor_26b58386aca161b6>>();
+	};
+		// _FuncSoaIndexVisitor_0x27___finalize_f82945d1bdf2d775
+		aotLib[0x17476a76c1f3b504] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct soa::SoaIndexVisitor &  ),&_FuncSoaIndexVisitor_0x27___finalize_f82945d1bdf2d775>>();
+	};
+		// _FuncSoaIndexVisitor_0x60_preVisitExprFor_8f4083e8a836cdc5
+		aotLib[0xa54fb3548e1850d8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct soa::SoaIndexVisitor & , smart_ptr_raw<ExprFor> const   ),&_FuncSoaIndexVisitor_0x60_preVisitExprFor_8f4083e8a836cdc5>>();
+	};
+		// _FuncSoaIndexVisitor_0x60_visitExprField_ba6ca3932df41b60
+		aotLib[0x6835b5872509ac08] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct soa::SoaIndexVisitor & , smart_ptr_raw<ExprField> const   ),&_FuncSoaIndexVisitor_0x60_visitExprField_ba6ca3932df41b60>>();
+	};
+		// _FuncSoaIndexVisitor_0x60_visitExprFor_d13689cfcc4545f2
+		aotLib[0x3aa7b5f62a35209d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct soa::SoaIndexVisitor & , smart_ptr_raw<ExprFor> const   ),&_FuncSoaIndexVisitor_0x60_visitExprFor_d13689cfcc4545f2>>();
+	};
+		// _FuncSoaIndexVisitor_0x60_visitExprVar_6bb96e9319373a6f
+		aotLib[0xbcdb22d1c7bac9b8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct soa::SoaIndexVisitor & , smart_ptr_raw<ExprVar> const   ),&_FuncSoaIndexVisitor_0x60_visitExprVar_6bb96e9319373a6f>>();
+	};
+		// SoaStructMacro_b8c4870004aa705b
+		aotLib[0x78c9bb6920d4449a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct soa::SoaStructMacro (*) ( Context * __context__ ),&SoaStructMacro_b8c4870004aa705b>>();
+	};
+		// _FuncSoaStructMacro_0x27___finalize_a1d05e2082647f59
+		aotLib[0x5ac882edede2f72b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct soa::SoaStructMacro &  ),&_FuncSoaStructMacro_0x27___finalize_a1d05e2082647f59>>();
+	};
+		// _FuncSoaStructMacro_0x60_apply_579af7bdbe5efa8f
+		aotLib[0xe2983e46724f65f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct soa::SoaStructMacro & , smart_ptr_raw<Structure> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncSoaStructMacro_0x60_apply_579af7bdbe5efa8f>>();
+	};
+		// __setup_macros_109fa2d1b5ee9e0c
+		aotLib[0x9c71dd83b5b753b4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_109fa2d1b5ee9e0c>>();
+	};
+		// add_argument_a02bcfb2a1bd4f5c
+		aotLib[0xe021f120a0f1edfd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Function> , char * const  , smart_ptr_raw<TypeDecl> , LineInfo const  &  ),&add_argument_a02bcfb2a1bd4f5c>>();
+	};
+		// add_iterator_5e16bd3c41ceb163
+		aotLib[0x5fe4bed54bce60d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprFor> , char * const   ),&add_iterator_5e16bd3c41ceb163>>();
+	};
+		// _Funcast_boost_0x60_add_new_infer_macro_208841e51335b966
+		aotLib[0x848f9cec8a5f5148] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct soa::SoaIndexMacro * const   ),&_Funcast_boost_0x60_add_new_infer_macro_208841e51335b966>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_9adfc7e85c7f8d0e
+		aotLib[0x8cbd2027ef0a136c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct soa::SoaStructMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_9adfc7e85c7f8d0e>>();
+	};
+		// _Funcast_0x60_make_pass_macro_7b64b679e17c16f0
+		aotLib[0x305af087f55c7873] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<PassMacro> (*) ( Context * __context__, char * const  , struct soa::SoaIndexMacro * const   ),&_Funcast_0x60_make_pass_macro_7b64b679e17c16f0>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_387775a111ed5a8b
+		aotLib[0x5f1132d2ada0ebb2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , struct soa::SoaStructMacro * const   ),&_Funcast_0x60_make_structure_annotation_387775a111ed5a8b>>();
+	};
+		// _Funcast_0x60_make_visitor_77e8d351d3db6b01
+		aotLib[0x389c66bb1c23775c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<VisitorAdapter> (*) ( Context * __context__, struct soa::SoaIndexVisitor const  &  ),&_Funcast_0x60_make_visitor_77e8d351d3db6b01>>();
+	};
+		// _Funcbuiltin_0x60_erase_85f507120ddd4252
+		aotLib[0x6ae2900ecbc9e875] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> & , char * const   ),&_Funcbuiltin_0x60_erase_85f507120ddd4252>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_finalize_a43d15b4031d8219
+		aotLib[0xbc534e244119cfb7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> &  ),&_Funcbuiltin_0x60_finalize_a43d15b4031d8219>>();
+	};
+		// _Funcbuiltin_0x60_find_index_391234c3541d2c09
+		aotLib[0xfb3d84a4cd683d79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  & , char * const   ),&_Funcbuiltin_0x60_find_index_391234c3541d2c09>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_98dd15e167848d85
+		aotLib[0xfbfa2e866537498d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Expression * (*) ( Context * __context__, smart_ptr<Expression> const   ),&_Funcbuiltin_0x60_get_ptr_98dd15e167848d85>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9
+		aotLib[0x9295bc7cb9b31c25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Structure * (*) ( Context * __context__, smart_ptr<Structure> const   ),&_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_9333da3222ff08a2
+		aotLib[0x1edb2069b8ef6bbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_9333da3222ff08a2>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_7f36a4402097a77
+		aotLib[0x1c5f314e1a10fd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,bool> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_7f36a4402097a77>>();
+	};
+		// _Funcbuiltin_0x60_push_dbe8c61ce24eace2
+		aotLib[0xe7e1aae867aed505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_dbe8c61ce24eace2>>();
+	};
+		// _Funcbuiltin_0x60_values_bc7e14cea4b1cf4e
+		aotLib[0x6c8c986460c7a691] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((struct soa::SoaLoopIterator &)) (*) ( Context * __context__, TTable<char *,struct soa::SoaLoopIterator> &  ),&_Funcbuiltin_0x60_values_bc7e14cea4b1cf4e>>();
+	};
+		// column_var_15dca5cef524fc1c
+		aotLib[0x3c6d3e1efd45ed89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, char * const  , char * const   ),&column_var_15dca5cef524fc1c>>();
+	};
+		// finalize_72b128e3f5f15ad6
+		aotLib[0xb1f4bc4e3abecac1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct soa::SoaIndexVisitor * &  ),&finalize_72b128e3f5f15ad6>>();
+	};
+		// finalize_64b80aaf5235539
+		aotLib[0xcd5c281cd8ad4f59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct soa::SoaIndexMacro &  ),&finalize_64b80aaf5235539>>();
+	};
+		// finalize_a5f0d706a0d32603
+		aotLib[0xd8c907c71a485362] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct soa::SoaIndexVisitor &  ),&finalize_a5f0d706a0d32603>>();
+	};
+		// finalize_916f543ff91d1662
+		aotLib[0x294e990d3e4078a4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct soa::SoaLoopIterator &  ),&finalize_916f543ff91d1662>>();
+	};
+		// finalize_219b89fabaf27b02
+		aotLib[0xda691f2ddda748f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct soa::SoaStructMacro &  ),&finalize_219b89fabaf27b02>>();
+	};
+		// generate_length_5a59334671a89743
+		aotLib[0x86a29e12064268a7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Structure * const  , LineInfo const  &  ),&generate_length_5a59334671a89743>>();
+	};
+		// generate_per_column_99c031c68aa7198b
+		aotLib[0xa5a3b4aa0a097c68] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Structure * const  , char * const  , char * const  , LineInfo const  &  ),&generate_per_column_99c031c68aa7198b>>();
+	};
+		// generate_push_9e41f90ae8e50517
+		aotLib[0xd484473ecc63fa8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Structure * const  , Structure * const  , LineInfo const  &  ),&generate_push_9e41f90ae8e50517>>();
+	};
+		// int_type_1abb4ebc7b84b873
+		aotLib[0x3d2c1c80e0f0c995] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TypeDecl> (*) ( Context * __context__, LineInfo const  &  ),&int_type_1abb4ebc7b84b873>>();
+	};
+		// is_simple_path_9d4b7081c9c2bfa0
+		aotLib[0x3b8032fb789bf919] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Expression * const   ),&is_simple_path_9d4b7081c9c2bfa0>>();
+	};
+		// is_soa_type_d72aca54849a3942
+		aotLib[0x410d269393f285b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<TypeDecl> const   ),&is_soa_type_d72aca54849a3942>>();
+	};
+		// make_field_4ffacec1682aee91
+		aotLib[0xd527fbb39623f5db] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, char * const  , char * const  , LineInfo const  &  ),&make_field_4ffacec1682aee91>>();
+	};
+		// make_function_e3f5821fa771d9c0
+		aotLib[0x306d3b2434d3f77] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Function> (*) ( Context * __context__, char * const  , Structure * const  , bool , LineInfo const  &  ),&make_function_e3f5821fa771d9c0>>();
+	};
+		// make_var_a6a6672e3646a9d
+		aotLib[0x6e55604f271d34e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, char * const  , LineInfo const  &  ),&make_var_a6a6672e3646a9d>>();
+	};
+		// _Funcrtti_0x60_class_info_2f092740ebba8004
+		aotLib[0xdd32f171add8b179] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct soa::SoaIndexMacro const  &  ),&_Funcrtti_0x60_class_info_2f092740ebba8004>>();
+	};
+		// _Funcrtti_0x60_class_info_555df62c5ef98c6a
+		aotLib[0x3348a3cb61ec4711] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct soa::SoaIndexVisitor const  &  ),&_Funcrtti_0x60_class_info_555df62c5ef98c6a>>();
+	};
+		// _Funcrtti_0x60_class_info_2da3ffb9e63c6811
+		aotLib[0x69832c01292fd64d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct soa::SoaStructMacro const  &  ),&_Funcrtti_0x60_class_info_2da3ffb9e63c6811>>();
+	};
+		// soa_key_4dc0a8b2750d6e9d
+		aotLib[0x6070fd7601b93475] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, Structure * const   ),&soa_key_4dc0a8b2750d6e9d>>();
+	};
+		// struct_type_b1bb452182a2b9c7
+		aotLib[0xc966104e6a8100a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TypeDecl> (*) ( Context * __context__, Structure * const  , bool  ),&struct_type_b1bb452182a2b9c7>>();
+	};
+		// [[ init script ]]
+		aotLib[0xef61f9d7692b73f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
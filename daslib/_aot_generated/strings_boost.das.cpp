@@ -0,0 +1,221 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings_boost
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__349d3c80;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__22794d9a;
+extern VarInfo __var_info__6eed08f6;
+extern FuncInfo __func_info__30c05fcb;
+extern FuncInfo __func_info__a38a0bc5;
+
+VarInfo __func_info__30c05fcb_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__349d3c80, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0x6eed08f6, "arr", 0 };
+VarInfo * __func_info__30c05fcb_fields[1] =  { &__func_info__30c05fcb_field_0 };
+FuncInfo __func_info__30c05fcb = {"invoke block<(arr:array<strings::string_view> const#):void> const", "", __func_info__30c05fcb_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x30c05fcb, 0x0 };
+VarInfo __func_info__a38a0bc5_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0x22794d9a, "arr", 0 };
+VarInfo * __func_info__a38a0bc5_fields[1] =  { &__func_info__a38a0bc5_field_0 };
+FuncInfo __func_info__a38a0bc5 = {"invoke block<(arr:array<string> const#):void> const", "", __func_info__a38a0bc5_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xa38a0bc5, 0x0 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__349d3c80 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::string_view"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x349d3c80 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline void _Funcbuiltin_0x60_clone_df54bf74e7e5c331 ( Context * __context__, TArray<das::StringView> & __a_rename_at_237, TArray<das::StringView> const  & __b_rename_at_237 );
+inline void _Funcbuiltin_0x60_clone_46b27f5d867e9f09 ( Context * __context__, TArray<char *> & __a_rename_at_237, TArray<char *> const  & __b_rename_at_237 );
+inline void _Funcbuiltin_0x60_resize_a75acdf52d35d0c3 ( Context * __context__, TArray<das::StringView> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<char *> split_576479368cb9384f ( Context * __context__, char * const  __text_rename_at_39, char * const  __delim_rename_at_39 );
+inline TArray<char *> split_by_chars_5dab5262ca809978 ( Context * __context__, char * const  __text_rename_at_50, char * const  __delim_rename_at_50 );
+inline TArray<das::StringView> split_by_chars_view_1b1200bc6a58c630 ( Context * __context__, char * const  __text_rename_at_73, char * const  __delim_rename_at_73 );
+inline TArray<das::StringView> split_view_aca9a3972c943269 ( Context * __context__, char * const  __text_rename_at_62, char * const  __delim_rename_at_62 );
+inline char * wide_bb3eefc935ca455c ( Context * __context__, char * const  __text_rename_at_8, int32_t __width_rename_at_8 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_df54bf74e7e5c331 ( Context * __context__, TArray<das::StringView> &  __a_rename_at_237, TArray<das::StringView> const  &  __b_rename_at_237 )
+{
+	_Funcbuiltin_0x60_resize_a75acdf52d35d0c3(__context__,das_arg<TArray<das::StringView>>::pass(__a_rename_at_237),builtin_array_size(__b_rename_at_237));
+	{
+		bool __need_loop_239 = true;
+		// aV : strings::string_view aka TT&
+		das_iterator<TArray<das::StringView>> __aV_iterator(__a_rename_at_237);
+		das::StringView * __aV_rename_at_239;
+		__need_loop_239 = __aV_iterator.first(__context__,(__aV_rename_at_239)) && __need_loop_239;
+		// bV : strings::string_view const&#
+		das_iterator<TArray<das::StringView> const > __bV_iterator(__b_rename_at_237);
+		das::StringView const  * __bV_rename_at_239;
+		__need_loop_239 = __bV_iterator.first(__context__,(__bV_rename_at_239)) && __need_loop_239;
+		for ( ; __need_loop_239 ; __need_loop_239 = __aV_iterator.next(__context__,(__aV_rename_at_239)) && __bV_iterator.next(__context__,(__bV_rename_at_239)) )
+		{
+			das_clone((*__aV_rename_at_239),(*__bV_rename_at_239));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_239));
+		__bV_iterator.close(__context__,(__bV_rename_at_239));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_46b27f5d867e9f09 ( Context * __context__, TArray<char *> &  __a_rename_at_237, TArray<char *> const  &  __b_rename_at_237 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_237),builtin_array_size(__b_rename_at_237));
+	{
+		bool __need_loop_239 = true;
+		// aV : string aka TT&
+		das_iterator<TArray<char *>> __aV_iterator(__a_rename_at_237);
+		char * * __aV_rename_at_239;
+		__need_loop_239 = __aV_iterator.first(__context__,(__aV_rename_at_239)) && __need_loop_239;
+		// bV : string const&#
+		das_iterator<TArray<char *> const > __bV_iterator(__b_rename_at_237);
+		char * const  * __bV_rename_at_239;
+		__need_loop_239 = __bV_iterator.first(__context__,(__bV_rename_at_239)) && __need_loop_239;
+		for ( ; __need_loop_239 ; __need_loop_239 = __aV_iterator.next(__context__,(__aV_rename_at_239)) && __bV_iterator.next(__context__,(__bV_rename_at_239)) )
+		{
+			das_copy((*__aV_rename_at_239),((char *)(builtin_string_clone((*__bV_rename_at_239),__context__))));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_239));
+		__bV_iterator.close(__context__,(__bV_rename_at_239));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_a75acdf52d35d0c3 ( Context * __context__, TArray<das::StringView> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<das::StringView>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline TArray<char *> split_576479368cb9384f ( Context * __context__, char * const  __text_rename_at_39, char * const  __delim_rename_at_39 ) { das_stack_prologue __prologue(__context__,96,"split " DAS_FILE_LINE);
+{
+	TArray<char *> __res_rename_at_40; das_zero(__res_rename_at_40);
+	builtin_string_split(__text_rename_at_39,__delim_rename_at_39,das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__a38a0bc5,[&](TArray<char *> const  & __arr_rename_at_41)->void{
+		_Funcbuiltin_0x60_clone_46b27f5d867e9f09(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_40),__arr_rename_at_41);
+	}),__context__);
+	return /* <- */ __res_rename_at_40;
+}}
+
+inline TArray<char *> split_by_chars_5dab5262ca809978 ( Context * __context__, char * const  __text_rename_at_50, char * const  __delim_rename_at_50 ) { das_stack_prologue __prologue(__context__,96,"split_by_chars " DAS_FILE_LINE);
+{
+	TArray<char *> __res_rename_at_51; das_zero(__res_rename_at_51);
+	builtin_string_split_by_char(__text_rename_at_50,__delim_rename_at_50,das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__a38a0bc5,[&](TArray<char *> const  & __arr_rename_at_52)->void{
+		_Funcbuiltin_0x60_clone_46b27f5d867e9f09(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_51),__arr_rename_at_52);
+	}),__context__);
+	return /* <- */ __res_rename_at_51;
+}}
+
+inline TArray<das::StringView> split_by_chars_view_1b1200bc6a58c630 ( Context * __context__, char * const  __text_rename_at_73, char * const  __delim_rename_at_73 ) { das_stack_prologue __prologue(__context__,96,"split_by_chars_view " DAS_FILE_LINE);
+{
+	TArray<das::StringView> __res_rename_at_74; das_zero(__res_rename_at_74);
+	builtin_string_split_by_char_view(__text_rename_at_73,__delim_rename_at_73,das_make_block<void,TArray<das::StringView> const  &>(__context__,80,0,&__func_info__30c05fcb,[&](TArray<das::StringView> const  & __arr_rename_at_75)->void{
+		_Funcbuiltin_0x60_clone_df54bf74e7e5c331(__context__,das_arg<TArray<das::StringView>>::pass(__res_rename_at_74),__arr_rename_at_75);
+	}),__context__);
+	return /* <- */ __res_rename_at_74;
+}}
+
+inline TArray<das::StringView> split_view_aca9a3972c943269 ( Context * __context__, char * const  __text_rename_at_62, char * const  __delim_rename_at_62 ) { das_stack_prologue __prologue(__context__,96,"split_view " DAS_FILE_LINE);
+{
+	TArray<das::StringView> __res_rename_at_63; das_zero(__res_rename_at_63);
+	builtin_string_split_view(__text_rename_at_62,__delim_rename_at_62,das_make_block<void,TArray<das::StringView> const  &>(__context__,80,0,&__func_info__30c05fcb,[&](TArray<das::StringView> const  & __arr_rename_at_64)->void{
+		_Funcbuiltin_0x60_clone_df54bf74e7e5c331(__context__,das_arg<TArray<das::StringView>>::pass(__res_rename_at_63),__arr_rename_at_64);
+	}),__context__);
+	return /* <- */ __res_rename_at_63;
+}}
+
+inline char * wide_bb3eefc935ca455c ( Context * __context__, char * const  __text_rename_at_8, int32_t __width_rename_at_8 )
+{
+	int32_t __extra_rename_at_9 = (int32_t)(__width_rename_at_8 - builtin_string_length(__text_rename_at_8,__context__));
+	return (__extra_rename_at_9 > 0) ? ((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(__text_rename_at_8),cast<char *>::from(((char *)(string_repeat(((char *) " "),__extra_rename_at_9,__context__)))),*__context__)))) : (__text_rename_at_8);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_df54bf74e7e5c331
+		aotLib[0x3dab08a6495913dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<das::StringView> & , TArray<das::StringView> const  &  ),&_Funcbuiltin_0x60_clone_df54bf74e7e5c331>>();
+	};
+		// _Funcbuiltin_0x60_clone_46b27f5d867e9f09
+		aotLib[0x5d1f7ffcf89b51a3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TArray<char *> const  &  ),&_Funcbuiltin_0x60_clone_46b27f5d867e9f09>>();
+	};
+		// _Funcbuiltin_0x60_resize_a75acdf52d35d0c3
+		aotLib[0x89f7133f69cf6e45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<das::StringView> & , int32_t  ),&_Funcbuiltin_0x60_resize_a75acdf52d35d0c3>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// split_576479368cb9384f
+		aotLib[0x8b5ca3075196ae6f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char * const  , char * const   ),&split_576479368cb9384f>>();
+	};
+		// split_by_chars_5dab5262ca809978
+		aotLib[0xc41e941e1cae14b3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char * const  , char * const   ),&split_by_chars_5dab5262ca809978>>();
+	};
+		// split_by_chars_view_1b1200bc6a58c630
+		aotLib[0xcfc69e58fb12ca95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<das::StringView> (*) ( Context * __context__, char * const  , char * const   ),&split_by_chars_view_1b1200bc6a58c630>>();
+	};
+		// split_view_aca9a3972c943269
+		aotLib[0x711b10081883483d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<das::StringView> (*) ( Context * __context__, char * const  , char * const   ),&split_view_aca9a3972c943269>>();
+	};
+		// wide_bb3eefc935ca455c
+		aotLib[0xd0f79689c4bfc25d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, char * const  , int32_t  ),&wide_bb3eefc935ca455c>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -153,6 +153,8 @@ int main( int argc, char * argv[] ) {
     NEED_MODULE(Module_Strings);
     NEED_MODULE(Module_TestProfile);
     NEED_MODULE(Module_Random);
+    NEED_MODULE(Module_Rtti);
+    NEED_MODULE(Module_Ast);
 #if 0
     auto TEST_NAME = getDasRoot() +  "/examples/profile/tests/annotation.das";
     tout << "\nINTERPRETED:\n";
@@ -0,0 +1,683 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+ // require soa
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__a6c45d85;
+extern VarInfo __var_info__dd4e46ea;
+extern FuncInfo __func_info__fb0181fb;
+extern FuncInfo __func_info__2c47cca3;
+
+VarInfo __func_info__fb0181fb_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"testProfile::dasvector`int"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xdd4e46ea, "arr", 0 };
+VarInfo * __func_info__fb0181fb_fields[1] =  { &__func_info__fb0181fb_field_0 };
+FuncInfo __func_info__fb0181fb = {"invoke block<(arr:testProfile::dasvector`int const):void> const", "", __func_info__fb0181fb_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xfb0181fb, 0x0 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+
+TypeInfo * __tinfo_0[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_4[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_5[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_6[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_7[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure SoaIndexMacro
+// unused structure SoaIndexVisitor
+// unused structure SoaLoopIterator
+// unused structure SoaStructMacro
+namespace  {
+
+struct NObject {
+	float3 position;
+	float3 velocity;
+};
+static_assert(sizeof(NObject)==24,"structure size mismatch with DAS");
+static_assert(offsetof(NObject,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(NObject,velocity)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct SObject {
+	float3 position;
+	float3 velocity;
+};
+static_assert(sizeof(SObject)==24,"structure size mismatch with DAS");
+static_assert(offsetof(SObject,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SObject,velocity)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct SObject_SOA {
+	TArray<float3> position;
+	TArray<float3> velocity;
+};
+static_assert(sizeof(SObject_SOA)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SObject_SOA,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SObject_SOA,velocity)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void init_d24eba838b17ac35 ( Context * __context__, ObjectArray & __objects_rename_at_70 );
+inline void init_e42aa7c1a7ae56e6 ( Context * __context__, TDim<struct NObject,10000> & __objects_rename_at_76 );
+inline void init_161ba1459cdb04fc ( Context * __context__, struct SObject_SOA & __objects_rename_at_82 );
+inline void initObj_d5fa6d4c30a53fcb ( Context * __context__, int32_t __i_rename_at_62, Object & __a_rename_at_62 );
+inline void initObj_cc74a68dac1fc0a ( Context * __context__, int32_t __i_rename_at_66, struct NObject & __a_rename_at_66 );
+inline void ks_update_840c5643656483c3 ( Context * __context__, float3 & __pos_rename_at_43, float3 __vel_rename_at_43 );
+inline bool perks_disabler_unset_es_ca44e31038d4eb5 ( Context * __context__, ObjectArray & __game_effect_dot_allowedMods_rename_at_7, ObjectArray & __allowedMods_rename_at_7 );
+inline void resize_12204e27cf9c5bd6 ( Context * __context__, struct SObject_SOA & __soa_rename_at_32, int32_t __newSize_rename_at_32 );
+inline bool test_57bb2f116f7cf7de ( Context * __context__, ObjectArray & __objects_rename_at_126 );
+inline void testInterop_3bbc95512b405e7d ( Context * __context__, ObjectArray & __objects_rename_at_58 );
+inline void testSim_657b079d3307b5c2 ( Context * __context__, ObjectArray & __objects_rename_at_50 );
+inline void testSim_b73be1f07af0f9f8 ( Context * __context__, TDim<struct NObject,10000> & __objects_rename_at_23 );
+inline void testSimI_3d1dbf40c347e1e4 ( Context * __context__, ObjectArray & __objects_rename_at_54 );
+inline void testSimI_4cc11299e3125756 ( Context * __context__, TDim<struct NObject,10000> & __objects_rename_at_27 );
+inline void testSimSoa_b64bd8fd7feecd28 ( Context * __context__, struct SObject_SOA & __objects_rename_at_38 );
+inline void update_dda61337b3dbeca7 ( Context * __context__, Object & __a_rename_at_47 );
+inline void update_fe2eb4f455fd28f2 ( Context * __context__, struct NObject & __a_rename_at_20 );
+inline void verifyManagedInt_f69ab18efe19b425 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TDim<struct NObject,10000>,0>(__context__);/*nobjects*/
+	das_global_zero<struct SObject_SOA,240000>(__context__);/*sobjects*/
+}
+
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float3>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,12,__context__);
+}
+
+inline void init_d24eba838b17ac35 ( Context * __context__, ObjectArray &  __objects_rename_at_70 )
+{
+	int32_t __index_rename_at_71 = 0;
+	{
+		bool __need_loop_72 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_70);
+		Object * __obj_rename_at_72;
+		__need_loop_72 = __obj_iterator.first(__context__,(__obj_rename_at_72)) && __need_loop_72;
+		for ( ; __need_loop_72 ; __need_loop_72 = __obj_iterator.next(__context__,(__obj_rename_at_72)) )
+		{
+			initObj_d5fa6d4c30a53fcb(__context__,__index_rename_at_71++,das_arg<Object>::pass((*__obj_rename_at_72)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_72));
+	};
+	DAS_ASSERT((__index_rename_at_71 == __objects_rename_at_70.size() /*length*/));
+}
+
+inline void init_e42aa7c1a7ae56e6 ( Context * __context__, TDim<struct NObject,10000> &  __objects_rename_at_76 )
+{
+	int32_t __index_rename_at_77 = 0;
+	{
+		bool __need_loop_78 = true;
+		// obj : NObject& -const
+		das_iterator<TDim<struct NObject,10000>> __obj_iterator(__objects_rename_at_76);
+		struct NObject * __obj_rename_at_78;
+		__need_loop_78 = __obj_iterator.first(__context__,(__obj_rename_at_78)) && __need_loop_78;
+		for ( ; __need_loop_78 ; __need_loop_78 = __obj_iterator.next(__context__,(__obj_rename_at_78)) )
+		{
+			initObj_cc74a68dac1fc0a(__context__,__index_rename_at_77++,das_arg<struct NObject>::pass((*__obj_rename_at_78)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_78));
+	};
+	DAS_ASSERT((__index_rename_at_77 == 10000));
+}
+
+inline void init_161ba1459cdb04fc ( Context * __context__, struct SObject_SOA &  __objects_rename_at_82 )
+{
+	resize_12204e27cf9c5bd6(__context__,das_arg<struct SObject_SOA>::pass(__objects_rename_at_82),10000);
+	int32_t __i_rename_at_84 = 0;
+	{
+		bool __need_loop_85 = true;
+		// pos : float3&
+		das_iterator<TArray<float3>> __pos_iterator(__objects_rename_at_82.position);
+		float3 * __pos_rename_at_85;
+		__need_loop_85 = __pos_iterator.first(__context__,(__pos_rename_at_85)) && __need_loop_85;
+		// vel : float3&
+		das_iterator<TArray<float3>> __vel_iterator(__objects_rename_at_82.velocity);
+		float3 * __vel_rename_at_85;
+		__need_loop_85 = __vel_iterator.first(__context__,(__vel_rename_at_85)) && __need_loop_85;
+		for ( ; __need_loop_85 ; __need_loop_85 = __pos_iterator.next(__context__,(__pos_rename_at_85)) && __vel_iterator.next(__context__,(__vel_rename_at_85)) )
+		{
+			das_copy((*__pos_rename_at_85),float3(__i_rename_at_84++,__i_rename_at_84 + 1,__i_rename_at_84 + 2));
+			das_copy((*__vel_rename_at_85),v_make_vec4f(1.f,2.f,3.f,0.f));
+		}
+		__pos_iterator.close(__context__,(__pos_rename_at_85));
+		__vel_iterator.close(__context__,(__vel_rename_at_85));
+	};
+	DAS_ASSERT((__i_rename_at_84 == 10000));
+}
+
+inline void initObj_d5fa6d4c30a53fcb ( Context * __context__, int32_t __i_rename_at_62, Object &  __a_rename_at_62 )
+{
+	das_copy(__a_rename_at_62.pos /*position*/,float3(__i_rename_at_62++,__i_rename_at_62 + 1,__i_rename_at_62 + 2));
+	das_copy(__a_rename_at_62.vel /*velocity*/,v_make_vec4f(1.f,2.f,3.f,0.f));
+}
+
+inline void initObj_cc74a68dac1fc0a ( Context * __context__, int32_t __i_rename_at_66, struct NObject &  __a_rename_at_66 )
+{
+	das_copy(__a_rename_at_66.position,float3(__i_rename_at_66++,__i_rename_at_66 + 1,__i_rename_at_66 + 2));
+	das_copy(__a_rename_at_66.velocity,v_make_vec4f(1.f,2.f,3.f,0.f));
+}
+
+inline void ks_update_840c5643656483c3 ( Context * __context__, float3 & __pos_rename_at_43, float3 __vel_rename_at_43 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_43),__vel_rename_at_43,*__context__);
+}
+
+inline bool perks_disabler_unset_es_ca44e31038d4eb5 ( Context * __context__, ObjectArray &  __game_effect_dot_allowedMods_rename_at_7, ObjectArray &  __allowedMods_rename_at_7 )
+{
+	{
+		bool __need_loop_8 = true;
+		// perk : testProfile::Object&
+		das_iterator<ObjectArray> __perk_iterator(__game_effect_dot_allowedMods_rename_at_7);
+		Object * __perk_rename_at_8;
+		__need_loop_8 = __perk_iterator.first(__context__,(__perk_rename_at_8)) && __need_loop_8;
+		for ( ; __need_loop_8 ; __need_loop_8 = __perk_iterator.next(__context__,(__perk_rename_at_8)) )
+		{
+			{
+				bool __need_loop_9 = true;
+				// i : int const
+				das_iterator<range> __i_iterator(range(0,__allowedMods_rename_at_7.size() /*length*/));
+				int32_t __i_rename_at_9;
+				__need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9)) && __need_loop_9;
+				for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9)) )
+				{
+					if ( SimPolicy<Object>::Equ(cast<Object*>::from(&(das_index<ObjectArray>::at(__allowedMods_rename_at_7,__i_rename_at_9,__context__))),cast<Object *>::from(&((*__perk_rename_at_8))),*__context__) )
+					{
+						return true;
+					};
+				}
+				__i_iterator.close(__context__,(__i_rename_at_9));
+			};
+		}
+		__perk_iterator.close(__context__,(__perk_rename_at_8));
+	};
+	return false;
+}
+
+inline void resize_12204e27cf9c5bd6 ( Context * __context__, struct SObject_SOA &  __soa_rename_at_32, int32_t __newSize_rename_at_32 )
+{
+	_Funcbuiltin_0x60_resize_d3b08ad0141c2c31(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_32.position),__newSize_rename_at_32);
+	_Funcbuiltin_0x60_resize_d3b08ad0141c2c31(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_32.velocity),__newSize_rename_at_32);
+}
+
+inline bool test_57bb2f116f7cf7de ( Context * __context__, ObjectArray &  __objects_rename_at_126 ) { das_stack_prologue __prologue(__context__,752,"test " DAS_FILE_LINE);
+{
+	verifyManagedInt_f69ab18efe19b425(__context__);
+	perks_disabler_unset_es_ca44e31038d4eb5(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126),das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	init_e42aa7c1a7ae56e6(__context__,das_arg<TDim<struct NObject,10000>>::pass(das_global<TDim<struct NObject,10000>,0>(__context__) /*nobjects*/));
+	testSim_b73be1f07af0f9f8(__context__,das_arg<TDim<struct NObject,10000>>::pass(das_global<TDim<struct NObject,10000>,0>(__context__) /*nobjects*/));
+	init_e42aa7c1a7ae56e6(__context__,das_arg<TDim<struct NObject,10000>>::pass(das_global<TDim<struct NObject,10000>,0>(__context__) /*nobjects*/));
+	testSimI_4cc11299e3125756(__context__,das_arg<TDim<struct NObject,10000>>::pass(das_global<TDim<struct NObject,10000>,0>(__context__) /*nobjects*/));
+	init_161ba1459cdb04fc(__context__,das_arg<struct SObject_SOA>::pass(das_global<struct SObject_SOA,240000>(__context__) /*sobjects*/));
+	testSimSoa_b64bd8fd7feecd28(__context__,das_arg<struct SObject_SOA>::pass(das_global<struct SObject_SOA,240000>(__context__) /*sobjects*/));
+	init_d24eba838b17ac35(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	testSim_657b079d3307b5c2(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	init_d24eba838b17ac35(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	testSimI_3d1dbf40c347e1e4(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	init_d24eba838b17ac35(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	updateTest(das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	init_d24eba838b17ac35(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	testInterop_3bbc95512b405e7d(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	init_d24eba838b17ac35(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	update10000(das_arg<ObjectArray>::pass(__objects_rename_at_126),__context__);
+	init_d24eba838b17ac35(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+	update10000ks(das_arg<ObjectArray>::pass(__objects_rename_at_126),__context__);
+	float __simTN_rename_at_159 = (float)builtin_profile(20,((char *) "native basic version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_160 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_160;
+			__need_loop_160 = __i_iterator.first(__context__,(__i_rename_at_160)) && __need_loop_160;
+			for ( ; __need_loop_160 ; __need_loop_160 = __i_iterator.next(__context__,(__i_rename_at_160)) )
+			{
+				testSim_b73be1f07af0f9f8(__context__,das_arg<TDim<struct NObject,10000>>::pass(das_global<TDim<struct NObject,10000>,0>(__context__) /*nobjects*/));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_160));
+		};
+	}),__context__);
+	float __simTN_I_rename_at_162 = (float)builtin_profile(20,((char *) "native basic version, inline"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_163 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_163;
+			__need_loop_163 = __i_iterator.first(__context__,(__i_rename_at_163)) && __need_loop_163;
+			for ( ; __need_loop_163 ; __need_loop_163 = __i_iterator.next(__context__,(__i_rename_at_163)) )
+			{
+				testSimI_4cc11299e3125756(__context__,das_arg<TDim<struct NObject,10000>>::pass(das_global<TDim<struct NObject,10000>,0>(__context__) /*nobjects*/));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_163));
+		};
+	}),__context__);
+	float __simTN_S_rename_at_165 = (float)builtin_profile(20,((char *) "native soa version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_166 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_166;
+			__need_loop_166 = __i_iterator.first(__context__,(__i_rename_at_166)) && __need_loop_166;
+			for ( ; __need_loop_166 ; __need_loop_166 = __i_iterator.next(__context__,(__i_rename_at_166)) )
+			{
+				testSimSoa_b64bd8fd7feecd28(__context__,das_arg<struct SObject_SOA>::pass(das_global<struct SObject_SOA,240000>(__context__) /*sobjects*/));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_166));
+		};
+	}),__context__);
+	float __simT_rename_at_168 = (float)builtin_profile(20,((char *) "basic version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_169 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_169;
+			__need_loop_169 = __i_iterator.first(__context__,(__i_rename_at_169)) && __need_loop_169;
+			for ( ; __need_loop_169 ; __need_loop_169 = __i_iterator.next(__context__,(__i_rename_at_169)) )
+			{
+				testSim_657b079d3307b5c2(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_169));
+		};
+	}),__context__);
+	float __simT_I_rename_at_171 = (float)builtin_profile(20,((char *) "basic version, inline"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_172 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_172;
+			__need_loop_172 = __i_iterator.first(__context__,(__i_rename_at_172)) && __need_loop_172;
+			for ( ; __need_loop_172 ; __need_loop_172 = __i_iterator.next(__context__,(__i_rename_at_172)) )
+			{
+				testSimI_3d1dbf40c347e1e4(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_172));
+		};
+	}),__context__);
+	float __cT_rename_at_174 = (float)builtin_profile(20,((char *) "c++ version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_175 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_175;
+			__need_loop_175 = __i_iterator.first(__context__,(__i_rename_at_175)) && __need_loop_175;
+			for ( ; __need_loop_175 ; __need_loop_175 = __i_iterator.next(__context__,(__i_rename_at_175)) )
+			{
+				updateTest(das_arg<ObjectArray>::pass(__objects_rename_at_126));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_175));
+		};
+	}),__context__);
+	float __intT_rename_at_177 = (float)builtin_profile(20,((char *) "interop version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_178 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_178;
+			__need_loop_178 = __i_iterator.first(__context__,(__i_rename_at_178)) && __need_loop_178;
+			for ( ; __need_loop_178 ; __need_loop_178 = __i_iterator.next(__context__,(__i_rename_at_178)) )
+			{
+				testInterop_3bbc95512b405e7d(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_126));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_178));
+		};
+	}),__context__);
+	float __manyT_rename_at_180 = (float)builtin_profile(20,((char *) "interop 10000 version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_181 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_181;
+			__need_loop_181 = __i_iterator.first(__context__,(__i_rename_at_181)) && __need_loop_181;
+			for ( ; __need_loop_181 ; __need_loop_181 = __i_iterator.next(__context__,(__i_rename_at_181)) )
+			{
+				update10000(das_arg<ObjectArray>::pass(__objects_rename_at_126),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_181));
+		};
+	}),__context__);
+	float __manyKsT_rename_at_183 = (float)builtin_profile(20,((char *) "interop 10000-ks version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_184 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_184;
+			__need_loop_184 = __i_iterator.first(__context__,(__i_rename_at_184)) && __need_loop_184;
+			for ( ; __need_loop_184 ; __need_loop_184 = __i_iterator.next(__context__,(__i_rename_at_184)) )
+			{
+				update10000ks(das_arg<ObjectArray>::pass(__objects_rename_at_126),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_184));
+		};
+	}),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "ratio nsim/c++ ")), cast<float>::from((SimPolicy<float>::Div(__simTN_rename_at_159,__cT_rename_at_174,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "ratio sim/c++: ")), cast<float>::from((SimPolicy<float>::Div(__simT_rename_at_168,__cT_rename_at_174,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_2, cast<char * const >::from(((char *) "ratio nsim,soa/c++ ")), cast<float>::from((SimPolicy<float>::Div(__simTN_S_rename_at_165,__cT_rename_at_174,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "ratio nsim,inline/c++ ")), cast<float>::from((SimPolicy<float>::Div(__simTN_I_rename_at_162,__cT_rename_at_174,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_4, cast<char * const >::from(((char *) "ratio sim,inline/c++: ")), cast<float>::from((SimPolicy<float>::Div(__simT_I_rename_at_171,__cT_rename_at_174,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char * const >::from(((char *) "ratio interop/c++: ")), cast<float>::from((SimPolicy<float>::Div(__intT_rename_at_177,__cT_rename_at_174,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_6, cast<char * const >::from(((char *) "ratio interop-10000/c++: ")), cast<float>::from((SimPolicy<float>::Div(__manyT_rename_at_180,__cT_rename_at_174,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_7, cast<char * const >::from(((char *) "ratio interop-10000-ks/c++: ")), cast<float>::from((SimPolicy<float>::Div(__manyKsT_rename_at_183,__cT_rename_at_174,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	return true;
+}}
+
+inline void testInterop_3bbc95512b405e7d ( Context * __context__, ObjectArray &  __objects_rename_at_58 )
+{
+	{
+		bool __need_loop_59 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_58);
+		Object * __obj_rename_at_59;
+		__need_loop_59 = __obj_iterator.first(__context__,(__obj_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __obj_iterator.next(__context__,(__obj_rename_at_59)) )
+		{
+			updateObject(das_arg<Object>::pass((*__obj_rename_at_59)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_59));
+	};
+}
+
+inline void testSim_657b079d3307b5c2 ( Context * __context__, ObjectArray &  __objects_rename_at_50 )
+{
+	{
+		bool __need_loop_51 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_50);
+		Object * __obj_rename_at_51;
+		__need_loop_51 = __obj_iterator.first(__context__,(__obj_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __obj_iterator.next(__context__,(__obj_rename_at_51)) )
+		{
+			update_dda61337b3dbeca7(__context__,das_arg<Object>::pass((*__obj_rename_at_51)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_51));
+	};
+}
+
+inline void testSim_b73be1f07af0f9f8 ( Context * __context__, TDim<struct NObject,10000> &  __objects_rename_at_23 )
+{
+	{
+		bool __need_loop_24 = true;
+		// obj : NObject& -const
+		das_iterator<TDim<struct NObject,10000>> __obj_iterator(__objects_rename_at_23);
+		struct NObject * __obj_rename_at_24;
+		__need_loop_24 = __obj_iterator.first(__context__,(__obj_rename_at_24)) && __need_loop_24;
+		for ( ; __need_loop_24 ; __need_loop_24 = __obj_iterator.next(__context__,(__obj_rename_at_24)) )
+		{
+			update_fe2eb4f455fd28f2(__context__,das_arg<struct NObject>::pass((*__obj_rename_at_24)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_24));
+	};
+}
+
+inline void testSimI_3d1dbf40c347e1e4 ( Context * __context__, ObjectArray &  __objects_rename_at_54 )
+{
+	{
+		bool __need_loop_55 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_54);
+		Object * __obj_rename_at_55;
+		__need_loop_55 = __obj_iterator.first(__context__,(__obj_rename_at_55)) && __need_loop_55;
+		for ( ; __need_loop_55 ; __need_loop_55 = __obj_iterator.next(__context__,(__obj_rename_at_55)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_55).pos /*position*/),(*__obj_rename_at_55).vel /*velocity*/,*__context__);
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_55));
+	};
+}
+
+inline void testSimI_4cc11299e3125756 ( Context * __context__, TDim<struct NObject,10000> &  __objects_rename_at_27 )
+{
+	{
+		bool __need_loop_28 = true;
+		// obj : NObject& -const
+		das_iterator<TDim<struct NObject,10000>> __obj_iterator(__objects_rename_at_27);
+		struct NObject * __obj_rename_at_28;
+		__need_loop_28 = __obj_iterator.first(__context__,(__obj_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __obj_iterator.next(__context__,(__obj_rename_at_28)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_28).position),(*__obj_rename_at_28).velocity,*__context__);
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_28));
+	};
+}
+
+inline void testSimSoa_b64bd8fd7feecd28 ( Context * __context__, struct SObject_SOA &  __objects_rename_at_38 )
+{
+	{
+		bool __need_loop_39 = true;
+		// pos : float3&
+		das_iterator<TArray<float3>> __pos_iterator(__objects_rename_at_38.position);
+		float3 * __pos_rename_at_39;
+		__need_loop_39 = __pos_iterator.first(__context__,(__pos_rename_at_39)) && __need_loop_39;
+		// vel : float3&
+		das_iterator<TArray<float3>> __vel_iterator(__objects_rename_at_38.velocity);
+		float3 * __vel_rename_at_39;
+		__need_loop_39 = __vel_iterator.first(__context__,(__vel_rename_at_39)) && __need_loop_39;
+		for ( ; __need_loop_39 ; __need_loop_39 = __pos_iterator.next(__context__,(__pos_rename_at_39)) && __vel_iterator.next(__context__,(__vel_rename_at_39)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__pos_rename_at_39)),(*__vel_rename_at_39),*__context__);
+		}
+		__pos_iterator.close(__context__,(__pos_rename_at_39));
+		__vel_iterator.close(__context__,(__vel_rename_at_39));
+	};
+}
+
+inline void update_dda61337b3dbeca7 ( Context * __context__, Object &  __a_rename_at_47 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_47.pos /*position*/),__a_rename_at_47.vel /*velocity*/,*__context__);
+}
+
+inline void update_fe2eb4f455fd28f2 ( Context * __context__, struct NObject &  __a_rename_at_20 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_20.position),__a_rename_at_20.velocity,*__context__);
+}
+
+inline void verifyManagedInt_f69ab18efe19b425 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,144,"verifyManagedInt " DAS_FILE_LINE);
+{
+	testManagedInt(das_make_block<void,das::vector<int32_t> const  &>(__context__,80,0,&__func_info__fb0181fb,[&](das::vector<int32_t> const  & __arr_rename_at_118)->void{
+		DAS_ASSERT((__arr_rename_at_118.size() /*length*/ == 10));
+		{
+			bool __need_loop_120 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_120;
+			__need_loop_120 = __x_iterator.first(__context__,(__x_rename_at_120)) && __need_loop_120;
+			for ( ; __need_loop_120 ; __need_loop_120 = __x_iterator.next(__context__,(__x_rename_at_120)) )
+			{
+				DAS_ASSERT((das_index<das::vector<int32_t> const >::at(__arr_rename_at_118,__x_rename_at_120,__context__) == __x_rename_at_120));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_120));
+		};
+		{
+			bool __need_loop_122 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_122;
+			__need_loop_122 = __x_iterator.first(__context__,(__x_rename_at_122)) && __need_loop_122;
+			// y : int const&
+			das_iterator<das::vector<int32_t> const > __y_iterator(__arr_rename_at_118);
+			int32_t const  * __y_rename_at_122;
+			__need_loop_122 = __y_iterator.first(__context__,(__y_rename_at_122)) && __need_loop_122;
+			for ( ; __need_loop_122 ; __need_loop_122 = __x_iterator.next(__context__,(__x_rename_at_122)) && __y_iterator.next(__context__,(__y_rename_at_122)) )
+			{
+				DAS_ASSERT((__x_rename_at_122 == (*__y_rename_at_122)));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_122));
+			__y_iterator.close(__context__,(__y_rename_at_122));
+		};
+	}),__context__);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_resize_d3b08ad0141c2c31
+		aotLib[0x6cbb6db64f4979] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_resize_d3b08ad0141c2c31>>();
+	};
+		// init_d24eba838b17ac35
+		aotLib[0x200ce43dc8a38dc4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&init_d24eba838b17ac35>>();
+	};
+		// init_e42aa7c1a7ae56e6
+		aotLib[0xd3ec0fa0035967e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<struct NObject,10000> &  ),&init_e42aa7c1a7ae56e6>>();
+	};
+		// init_161ba1459cdb04fc
+		aotLib[0x605689eb904bb282] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SObject_SOA &  ),&init_161ba1459cdb04fc>>();
+	};
+		// initObj_d5fa6d4c30a53fcb
+		aotLib[0xdc2e5dfd02991f7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Object &  ),&initObj_d5fa6d4c30a53fcb>>();
+	};
+		// initObj_cc74a68dac1fc0a
+		aotLib[0x3391ed6982cbb515] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , struct NObject &  ),&initObj_cc74a68dac1fc0a>>();
+	};
+		// ks_update_840c5643656483c3
+		aotLib[0xff05559c8c2a2525] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float3 & , float3  ),&ks_update_840c5643656483c3>>();
+	};
+		// perks_disabler_unset_es_ca44e31038d4eb5
+		aotLib[0x926ab44d0c7a2fd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ObjectArray & , ObjectArray &  ),&perks_disabler_unset_es_ca44e31038d4eb5>>();
+	};
+		// resize_12204e27cf9c5bd6
+		aotLib[0x3da4f037ffe87b7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SObject_SOA & , int32_t  ),&resize_12204e27cf9c5bd6>>();
+	};
+		// test_57bb2f116f7cf7de
+		aotLib[0xc10403c017a1af4f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ObjectArray &  ),&test_57bb2f116f7cf7de>>();
+	};
+		// testInterop_3bbc95512b405e7d
+		aotLib[0x1e52b9b2dce6295] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&testInterop_3bbc95512b405e7d>>();
+	};
+		// testSim_657b079d3307b5c2
+		aotLib[0x41a79e67cffc5817] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&testSim_657b079d3307b5c2>>();
+	};
+		// testSim_b73be1f07af0f9f8
+		aotLib[0x47767f52e1b0b7a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<struct NObject,10000> &  ),&testSim_b73be1f07af0f9f8>>();
+	};
+		// testSimI_3d1dbf40c347e1e4
+		aotLib[0x8c44571c8a80d715] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&testSimI_3d1dbf40c347e1e4>>();
+	};
+		// testSimI_4cc11299e3125756
+		aotLib[0xe82076e34f1911a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<struct NObject,10000> &  ),&testSimI_4cc11299e3125756>>();
+	};
+		// testSimSoa_b64bd8fd7feecd28
+		aotLib[0xb51b6b4fabfd91c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SObject_SOA &  ),&testSimSoa_b64bd8fd7feecd28>>();
+	};
+		// update_dda61337b3dbeca7
+		aotLib[0x655181afdf9fd9c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Object &  ),&update_dda61337b3dbeca7>>();
+	};
+		// update_fe2eb4f455fd28f2
+		aotLib[0x8c0c00cfb78a2ded] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct NObject &  ),&update_fe2eb4f455fd28f2>>();
+	};
+		// verifyManagedInt_f69ab18efe19b425
+		aotLib[0xd447a74e2350357d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&verifyManagedInt_f69ab18efe19b425>>();
+	};
+		// [[ init script ]]
+		aotLib[0x38636d94435360be] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,185 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline void _Funcbuiltin_0x60_finalize_cd1514d2d7718b99 ( Context * __context__, TArray<float4> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline int32_t churn_medium_9fc2ce68c1fe53cc ( Context * __context__ );
+inline int32_t grow_arrays_3145d8edfeab4ba3 ( Context * __context__ );
+inline bool test_dbdaa20b2da6db96 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_cd1514d2d7718b99 ( Context * __context__, TArray<float4> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<float4>>::pass(__a_rename_at_280),16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_280),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float4>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,16,__context__);
+}
+
+inline int32_t churn_medium_9fc2ce68c1fe53cc ( Context * __context__ )
+{
+	int32_t __total_rename_at_15 = 0;
+	{
+		bool __need_loop_16 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,100000));
+		int32_t __t_rename_at_16;
+		__need_loop_16 = __t_iterator.first(__context__,(__t_rename_at_16)) && __need_loop_16;
+		for ( ; __need_loop_16 ; __need_loop_16 = __t_iterator.next(__context__,(__t_rename_at_16)) )
+		{
+			TArray<float4> __a_rename_at_17; das_zero(__a_rename_at_17);
+			_Funcbuiltin_0x60_resize_761fb73a377a5e66(__context__,das_arg<TArray<float4>>::pass(__a_rename_at_17),16 + (__t_rename_at_16 & 1023));
+			__total_rename_at_15 += builtin_array_size(das_arg<TArray<float4>>::pass(__a_rename_at_17));
+			_Funcbuiltin_0x60_finalize_cd1514d2d7718b99(__context__,das_arg<TArray<float4>>::pass(__a_rename_at_17));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_16));
+	};
+	return __total_rename_at_15;
+}
+
+inline int32_t grow_arrays_3145d8edfeab4ba3 ( Context * __context__ )
+{
+	int32_t __total_rename_at_5 = 0;
+	{
+		bool __need_loop_6 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,16));
+		int32_t __t_rename_at_6;
+		__need_loop_6 = __t_iterator.first(__context__,(__t_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __t_iterator.next(__context__,(__t_rename_at_6)) )
+		{
+			TArray<int32_t> __a_rename_at_7; das_zero(__a_rename_at_7);
+			{
+				bool __need_loop_8 = true;
+				// i : int const
+				das_iterator<range> __i_iterator(range(0,1000000));
+				int32_t __i_rename_at_8;
+				__need_loop_8 = __i_iterator.first(__context__,(__i_rename_at_8)) && __need_loop_8;
+				for ( ; __need_loop_8 ; __need_loop_8 = __i_iterator.next(__context__,(__i_rename_at_8)) )
+				{
+					_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_7),__i_rename_at_8,-1);
+				}
+				__i_iterator.close(__context__,(__i_rename_at_8));
+			};
+			__total_rename_at_5 += builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_7));
+			_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_7));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_6));
+	};
+	return __total_rename_at_5;
+}
+
+inline bool test_dbdaa20b2da6db96 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+	builtin_profile(20,((char *) "big allocations, array growth"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		grow_arrays_3145d8edfeab4ba3(__context__);
+	}),__context__);
+	builtin_profile(20,((char *) "big allocations, medium size churn"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		churn_medium_9fc2ce68c1fe53cc(__context__);
+	}),__context__);
+	heap_report(__context__);
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_cd1514d2d7718b99
+		aotLib[0xcaeab429993cce4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> &  ),&_Funcbuiltin_0x60_finalize_cd1514d2d7718b99>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_resize_761fb73a377a5e66
+		aotLib[0xc267e309ce3735b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , int32_t  ),&_Funcbuiltin_0x60_resize_761fb73a377a5e66>>();
+	};
+		// churn_medium_9fc2ce68c1fe53cc
+		aotLib[0xae57d2f6f950154c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&churn_medium_9fc2ce68c1fe53cc>>();
+	};
+		// grow_arrays_3145d8edfeab4ba3
+		aotLib[0xfb068c2e62defde9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&grow_arrays_3145d8edfeab4ba3>>();
+	};
+		// test_dbdaa20b2da6db96
+		aotLib[0x21ec65dd991a92f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_dbdaa20b2da6db96>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
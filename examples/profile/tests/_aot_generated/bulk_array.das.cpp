@@ -0,0 +1,356 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline void append_bulk_ca3a4b2c7499d0af ( Context * __context__, TArray<int32_t> & __a_rename_at_13, TArray<int32_t> const  & __b_rename_at_13 );
+inline void append_loop_2316e879876ed79b ( Context * __context__, TArray<int32_t> & __a_rename_at_7, TArray<int32_t> const  & __b_rename_at_7 );
+inline bool _Funcbuiltin_0x60_equal_8c45ac6253c3045d ( Context * __context__, TArray<int32_t> const  & __a_rename_at_661, TArray<int32_t> const  & __b_rename_at_661 );
+inline void _Funcbuiltin_0x60_fill_5e4e23bb53b82aa ( Context * __context__, TArray<float> & __Arr_rename_at_114, float __value_rename_at_114 );
+inline void _Funcbuiltin_0x60_fill_eace7e2abe626443 ( Context * __context__, TArray<float> & __Arr_rename_at_101, float __value_rename_at_101, int32_t __from_rename_at_101, int32_t __count_rename_at_101 );
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_280 );
+inline int32_t _Funcbuiltin_0x60_find_index_6536afea02700d6e ( Context * __context__, TArray<int32_t> const  & __arr_rename_at_628, int32_t __key_rename_at_628 );
+inline void _Funcbuiltin_0x60_push_f160cc321c805a96 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_47, TArray<int32_t> const  & __varr_rename_at_47 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline bool equal_bulk_c06d5c1f4a033ab3 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_45, TArray<int32_t> const  & __b_rename_at_45 );
+inline bool equal_loop_3e71628ad965f44a ( Context * __context__, TArray<int32_t> const  & __a_rename_at_38, TArray<int32_t> const  & __b_rename_at_38 );
+inline void fill_bulk_c472e0dfee00ea5d ( Context * __context__, TArray<float> & __a_rename_at_23 );
+inline void fill_loop_844fef42ac848457 ( Context * __context__, TArray<float> & __a_rename_at_18 );
+inline int32_t find_bulk_509fdd0baa2c8b8a ( Context * __context__, TArray<int32_t> const  & __a_rename_at_34, int32_t __key_rename_at_34 );
+inline int32_t find_loop_a92ddd53c5403d46 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_27, int32_t __key_rename_at_27 );
+inline bool test_61f38e07e1c0b103 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void append_bulk_ca3a4b2c7499d0af ( Context * __context__, TArray<int32_t> &  __a_rename_at_13, TArray<int32_t> const  &  __b_rename_at_13 )
+{
+	builtin_array_clear(das_arg<TArray<int32_t>>::pass(__a_rename_at_13),__context__);
+	_Funcbuiltin_0x60_push_f160cc321c805a96(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_13),__b_rename_at_13);
+}
+
+inline void append_loop_2316e879876ed79b ( Context * __context__, TArray<int32_t> &  __a_rename_at_7, TArray<int32_t> const  &  __b_rename_at_7 )
+{
+	builtin_array_clear(das_arg<TArray<int32_t>>::pass(__a_rename_at_7),__context__);
+	{
+		bool __need_loop_9 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__b_rename_at_7);
+		int32_t const  * __x_rename_at_9;
+		__need_loop_9 = __x_iterator.first(__context__,(__x_rename_at_9)) && __need_loop_9;
+		for ( ; __need_loop_9 ; __need_loop_9 = __x_iterator.next(__context__,(__x_rename_at_9)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_7),(*__x_rename_at_9),-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_9));
+	};
+}
+
+inline bool _Funcbuiltin_0x60_equal_8c45ac6253c3045d ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_661, TArray<int32_t> const  &  __b_rename_at_661 )
+{
+	return (builtin_array_size(__a_rename_at_661) != builtin_array_size(__b_rename_at_661)) ? (false) : (((builtin_array_size(__a_rename_at_661) == 0) ? (true) : (builtin_array_equal<int32_t>(__a_rename_at_661,__b_rename_at_661))));
+}
+
+inline void _Funcbuiltin_0x60_fill_5e4e23bb53b82aa ( Context * __context__, TArray<float> &  __Arr_rename_at_114, float __value_rename_at_114 )
+{
+	_Funcbuiltin_0x60_fill_eace7e2abe626443(__context__,das_arg<TArray<float>>::pass(__Arr_rename_at_114),__value_rename_at_114,0,builtin_array_size(das_arg<TArray<float>>::pass(__Arr_rename_at_114)));
+}
+
+inline void _Funcbuiltin_0x60_fill_eace7e2abe626443 ( Context * __context__, TArray<float> &  __Arr_rename_at_101, float __value_rename_at_101, int32_t __from_rename_at_101, int32_t __count_rename_at_101 )
+{
+	float __v_rename_at_103 = __value_rename_at_101;
+	builtin_array_fill(das_arg<TArray<float>>::pass(__Arr_rename_at_101),__from_rename_at_101,__count_rename_at_101,das_ref(__context__,__v_rename_at_103),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<float>>::pass(__a_rename_at_280),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_280),4,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_find_index_6536afea02700d6e ( Context * __context__, TArray<int32_t> const  &  __arr_rename_at_628, int32_t __key_rename_at_628 )
+{
+	return builtin_array_find_index<int32_t>(__arr_rename_at_628,__key_rename_at_628);
+}
+
+inline void _Funcbuiltin_0x60_push_f160cc321c805a96 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_47, TArray<int32_t> const  &  __varr_rename_at_47 )
+{
+	builtin_array_append(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_47),__varr_rename_at_47,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline bool equal_bulk_c06d5c1f4a033ab3 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_45, TArray<int32_t> const  &  __b_rename_at_45 )
+{
+	return _Funcbuiltin_0x60_equal_8c45ac6253c3045d(__context__,__a_rename_at_45,__b_rename_at_45);
+}
+
+inline bool equal_loop_3e71628ad965f44a ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_38, TArray<int32_t> const  &  __b_rename_at_38 )
+{
+	{
+		bool __need_loop_39 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_38);
+		int32_t const  * __x_rename_at_39;
+		__need_loop_39 = __x_iterator.first(__context__,(__x_rename_at_39)) && __need_loop_39;
+		// y : int const&
+		das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_38);
+		int32_t const  * __y_rename_at_39;
+		__need_loop_39 = __y_iterator.first(__context__,(__y_rename_at_39)) && __need_loop_39;
+		for ( ; __need_loop_39 ; __need_loop_39 = __x_iterator.next(__context__,(__x_rename_at_39)) && __y_iterator.next(__context__,(__y_rename_at_39)) )
+		{
+			if ( (*__x_rename_at_39) != (*__y_rename_at_39) )
+			{
+				return false;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_39));
+		__y_iterator.close(__context__,(__y_rename_at_39));
+	};
+	return true;
+}
+
+inline void fill_bulk_c472e0dfee00ea5d ( Context * __context__, TArray<float> &  __a_rename_at_23 )
+{
+	_Funcbuiltin_0x60_fill_5e4e23bb53b82aa(__context__,das_arg<TArray<float>>::pass(__a_rename_at_23),1.f);
+}
+
+inline void fill_loop_844fef42ac848457 ( Context * __context__, TArray<float> &  __a_rename_at_18 )
+{
+	{
+		bool __need_loop_19 = true;
+		// x : float&
+		das_iterator<TArray<float>> __x_iterator(__a_rename_at_18);
+		float * __x_rename_at_19;
+		__need_loop_19 = __x_iterator.first(__context__,(__x_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __x_iterator.next(__context__,(__x_rename_at_19)) )
+		{
+			das_copy((*__x_rename_at_19),1.f);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_19));
+	};
+}
+
+inline int32_t find_bulk_509fdd0baa2c8b8a ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_34, int32_t __key_rename_at_34 )
+{
+	return _Funcbuiltin_0x60_find_index_6536afea02700d6e(__context__,__a_rename_at_34,__key_rename_at_34);
+}
+
+inline int32_t find_loop_a92ddd53c5403d46 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_27, int32_t __key_rename_at_27 )
+{
+	{
+		bool __need_loop_28 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_27);
+		int32_t const  * __x_rename_at_28;
+		__need_loop_28 = __x_iterator.first(__context__,(__x_rename_at_28)) && __need_loop_28;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_28;
+		__need_loop_28 = __i_iterator.first(__context__,(__i_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __x_iterator.next(__context__,(__x_rename_at_28)) && __i_iterator.next(__context__,(__i_rename_at_28)) )
+		{
+			if ( (*__x_rename_at_28) == __key_rename_at_27 )
+			{
+				return __i_rename_at_28;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_28));
+		__i_iterator.close(__context__,(__i_rename_at_28));
+	};
+	return -1;
+}
+
+inline bool test_61f38e07e1c0b103 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,528,"test " DAS_FILE_LINE);
+{
+	TArray<int32_t> __a_rename_at_50; das_zero(__a_rename_at_50);
+	TArray<int32_t> __b_rename_at_51; das_zero(__b_rename_at_51);
+	TArray<float> __f_rename_at_52; das_zero(__f_rename_at_52);
+	{
+		bool __need_loop_53 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_53;
+		__need_loop_53 = __i_iterator.first(__context__,(__i_rename_at_53)) && __need_loop_53;
+		for ( ; __need_loop_53 ; __need_loop_53 = __i_iterator.next(__context__,(__i_rename_at_53)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_51),__i_rename_at_53,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_53));
+	};
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__f_rename_at_52),1000000);
+	append_bulk_ca3a4b2c7499d0af(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),das_arg<TArray<int32_t>>::pass(__b_rename_at_51));
+	DAS_VERIFY((find_loop_a92ddd53c5403d46(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),999999) == find_bulk_509fdd0baa2c8b8a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),999999)));
+	DAS_VERIFY((equal_loop_3e71628ad965f44a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),das_arg<TArray<int32_t>>::pass(__b_rename_at_51)) && equal_bulk_c06d5c1f4a033ab3(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),das_arg<TArray<int32_t>>::pass(__b_rename_at_51))));
+	builtin_profile(20,((char *) "append, loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		append_loop_2316e879876ed79b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),das_arg<TArray<int32_t>>::pass(__b_rename_at_51));
+	}),__context__);
+	builtin_profile(20,((char *) "append, bulk"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		append_bulk_ca3a4b2c7499d0af(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),das_arg<TArray<int32_t>>::pass(__b_rename_at_51));
+	}),__context__);
+	builtin_profile(20,((char *) "fill, loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		fill_loop_844fef42ac848457(__context__,das_arg<TArray<float>>::pass(__f_rename_at_52));
+	}),__context__);
+	builtin_profile(20,((char *) "fill, bulk"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		fill_bulk_c472e0dfee00ea5d(__context__,das_arg<TArray<float>>::pass(__f_rename_at_52));
+	}),__context__);
+	builtin_profile(20,((char *) "find index, loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		find_loop_a92ddd53c5403d46(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),999999);
+	}),__context__);
+	builtin_profile(20,((char *) "find index, bulk"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		find_bulk_509fdd0baa2c8b8a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),999999);
+	}),__context__);
+	builtin_profile(20,((char *) "equal, loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		equal_loop_3e71628ad965f44a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),das_arg<TArray<int32_t>>::pass(__b_rename_at_51));
+	}),__context__);
+	builtin_profile(20,((char *) "equal, bulk"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		equal_bulk_c06d5c1f4a033ab3(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50),das_arg<TArray<int32_t>>::pass(__b_rename_at_51));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_50));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_51));
+	_Funcbuiltin_0x60_finalize_4da34799ba0520c5(__context__,das_arg<TArray<float>>::pass(__f_rename_at_52));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// append_bulk_ca3a4b2c7499d0af
+		aotLib[0x71d3d921fa1366c8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&append_bulk_ca3a4b2c7499d0af>>();
+	};
+		// append_loop_2316e879876ed79b
+		aotLib[0x9a21a182bde9b7da] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&append_loop_2316e879876ed79b>>();
+	};
+		// _Funcbuiltin_0x60_equal_8c45ac6253c3045d
+		aotLib[0xb62e7651fc17bc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_equal_8c45ac6253c3045d>>();
+	};
+		// _Funcbuiltin_0x60_fill_5e4e23bb53b82aa
+		aotLib[0x96f93614a381cf3a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float  ),&_Funcbuiltin_0x60_fill_5e4e23bb53b82aa>>();
+	};
+		// _Funcbuiltin_0x60_fill_eace7e2abe626443
+		aotLib[0xd684090cbc44a499] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float , int32_t , int32_t  ),&_Funcbuiltin_0x60_fill_eace7e2abe626443>>();
+	};
+		// _Funcbuiltin_0x60_finalize_4da34799ba0520c5
+		aotLib[0xbd5f701fe616ff75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_finalize_4da34799ba0520c5>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_find_index_6536afea02700d6e
+		aotLib[0x92096b5c985da301] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , int32_t  ),&_Funcbuiltin_0x60_find_index_6536afea02700d6e>>();
+	};
+		// _Funcbuiltin_0x60_push_f160cc321c805a96
+		aotLib[0xec8ff3b46a13c535] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_push_f160cc321c805a96>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_resize_d240579333227022
+		aotLib[0x40d6b5552dd22f51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , int32_t  ),&_Funcbuiltin_0x60_resize_d240579333227022>>();
+	};
+		// equal_bulk_c06d5c1f4a033ab3
+		aotLib[0xbaaed65c9eb0df31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&equal_bulk_c06d5c1f4a033ab3>>();
+	};
+		// equal_loop_3e71628ad965f44a
+		aotLib[0xfc5f8d6276ba0e85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&equal_loop_3e71628ad965f44a>>();
+	};
+		// fill_bulk_c472e0dfee00ea5d
+		aotLib[0x595ec9a4e89285c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&fill_bulk_c472e0dfee00ea5d>>();
+	};
+		// fill_loop_844fef42ac848457
+		aotLib[0x33273f64bba17389] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&fill_loop_844fef42ac848457>>();
+	};
+		// find_bulk_509fdd0baa2c8b8a
+		aotLib[0x53067bb3d40ef988] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , int32_t  ),&find_bulk_509fdd0baa2c8b8a>>();
+	};
+		// find_loop_a92ddd53c5403d46
+		aotLib[0xc3eb7c5cbd66d765] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , int32_t  ),&find_loop_a92ddd53c5403d46>>();
+	};
+		// test_61f38e07e1c0b103
+		aotLib[0x808c39c55b32d05b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_61f38e07e1c0b103>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
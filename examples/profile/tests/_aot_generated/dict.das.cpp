@@ -0,0 +1,148 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__239b2fad;
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__239b2fad = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x239b2fad };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__239b2fad };
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline int32_t dict_46243f36b21c16d5 ( Context * __context__, TTable<char *,int32_t> & __tab_rename_at_18, TArray<char *> const  & __src_rename_at_18 );
+inline void makeRandomSequence_99f755fbd7198973 ( Context * __context__, TArray<char *> & __src_rename_at_10 );
+inline bool test_6ac62f0a2b62e871 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline int32_t dict_46243f36b21c16d5 ( Context * __context__, TTable<char *,int32_t> &  __tab_rename_at_18, TArray<char *> const  &  __src_rename_at_18 )
+{
+	builtin_table_clear(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_18),__context__);
+	int32_t __maxOcc_rename_at_20 = 0;
+	{
+		bool __need_loop_21 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_18);
+		char * const  * __s_rename_at_21;
+		__need_loop_21 = __s_iterator.first(__context__,(__s_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __s_iterator.next(__context__,(__s_rename_at_21)) )
+		{
+			das_copy(__maxOcc_rename_at_20,SimPolicy<int32_t>::Max(++__tab_rename_at_18((*__s_rename_at_21),__context__),__maxOcc_rename_at_20,*__context__));
+		}
+		__s_iterator.close(__context__,(__s_rename_at_21));
+	};
+	return __maxOcc_rename_at_20;
+}
+
+inline void makeRandomSequence_99f755fbd7198973 ( Context * __context__, TArray<char *> &  __src_rename_at_10 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__src_rename_at_10),500000);
+	{
+		bool __need_loop_14 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,500000));
+		int32_t __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			uint32_t __num_rename_at_15 = (uint32_t)(SimPolicy<uint32_t>::Mod((0x1033c4d7u ^ uint32_t(__i_rename_at_14 * 119)),0x7a120u,*__context__));
+			das_copy(__src_rename_at_10(__i_rename_at_14,__context__),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<uint32_t>::from(__num_rename_at_15))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+}
+
+inline bool test_6ac62f0a2b62e871 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,208,"test " DAS_FILE_LINE);
+{
+	TTable<char *,int32_t> __tab_rename_at_27; das_zero(__tab_rename_at_27);
+	TArray<char *> __src_rename_at_28; das_zero(__src_rename_at_28);
+	makeRandomSequence_99f755fbd7198973(__context__,das_arg<TArray<char *>>::pass(__src_rename_at_28));
+	builtin_profile(20,((char *) "dictionary"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		dict_46243f36b21c16d5(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_27),das_arg<TArray<char *>>::pass(__src_rename_at_28));
+	}),__context__);
+	builtin_profile(20,((char *) "c++ dictionary"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testDict(das_arg<TArray<char *>>::pass(__src_rename_at_28));
+	}),__context__);
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// dict_46243f36b21c16d5
+		aotLib[0xaf5216383d4cb8a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<char *,int32_t> & , TArray<char *> const  &  ),&dict_46243f36b21c16d5>>();
+	};
+		// makeRandomSequence_99f755fbd7198973
+		aotLib[0x7733c1e240221bd3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&makeRandomSequence_99f755fbd7198973>>();
+	};
+		// test_6ac62f0a2b62e871
+		aotLib[0x7bf76512cfeb2e3b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6ac62f0a2b62e871>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
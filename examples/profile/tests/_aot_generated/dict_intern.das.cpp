@@ -0,0 +1,225 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__239b2fad;
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__239b2fad = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x239b2fad };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[1] = { &__type_info__239b2fad };
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline int32_t dict_46243f36b21c16d5 ( Context * __context__, TTable<char *,int32_t> & __tab_rename_at_19, TArray<char *> const  & __src_rename_at_19 );
+inline int32_t json_3d7d2d92944a1cd ( Context * __context__, TTable<char *,int32_t> & __tab_rename_at_33, TArray<char *> const  & __keys_rename_at_33 );
+inline void makeJsonKeys_d17de3b7361fa14 ( Context * __context__, TArray<char *> & __keys_rename_at_27 );
+inline void makeRandomSequence_99f755fbd7198973 ( Context * __context__, TArray<char *> & __src_rename_at_11 );
+inline bool test_803147c64bf44027 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<TDim<char *,8>,0>(__context__) = (([&]() -> TDim<char *,8> {
+		TDim<char *,8> __mka_9;
+		__mka_9(0,__context__) = ((char *) "id");
+		__mka_9(1,__context__) = ((char *) "name");
+		__mka_9(2,__context__) = ((char *) "email");
+		__mka_9(3,__context__) = ((char *) "created_at");
+		__mka_9(4,__context__) = ((char *) "updated_at");
+		__mka_9(5,__context__) = ((char *) "status");
+		__mka_9(6,__context__) = ((char *) "owner");
+		__mka_9(7,__context__) = ((char *) "tags");
+		return __mka_9;
+	})());/*FIELDS*/
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline int32_t dict_46243f36b21c16d5 ( Context * __context__, TTable<char *,int32_t> &  __tab_rename_at_19, TArray<char *> const  &  __src_rename_at_19 )
+{
+	builtin_table_clear(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_19),__context__);
+	int32_t __maxOcc_rename_at_21 = 0;
+	{
+		bool __need_loop_22 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_19);
+		char * const  * __s_rename_at_22;
+		__need_loop_22 = __s_iterator.first(__context__,(__s_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __s_iterator.next(__context__,(__s_rename_at_22)) )
+		{
+			das_copy(__maxOcc_rename_at_21,SimPolicy<int32_t>::Max(++__tab_rename_at_19((*__s_rename_at_22),__context__),__maxOcc_rename_at_21,*__context__));
+		}
+		__s_iterator.close(__context__,(__s_rename_at_22));
+	};
+	return __maxOcc_rename_at_21;
+}
+
+inline int32_t json_3d7d2d92944a1cd ( Context * __context__, TTable<char *,int32_t> &  __tab_rename_at_33, TArray<char *> const  &  __keys_rename_at_33 )
+{
+	builtin_table_clear(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_33),__context__);
+	int32_t __total_rename_at_35 = 0;
+	{
+		bool __need_loop_36 = true;
+		// k : string const&
+		das_iterator<TArray<char *> const > __k_iterator(__keys_rename_at_33);
+		char * const  * __k_rename_at_36;
+		__need_loop_36 = __k_iterator.first(__context__,(__k_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = __k_iterator.next(__context__,(__k_rename_at_36)) )
+		{
+			__tab_rename_at_33((*__k_rename_at_36),__context__)++;
+		}
+		__k_iterator.close(__context__,(__k_rename_at_36));
+	};
+	{
+		bool __need_loop_38 = true;
+		// f : string const&
+		das_iterator<TDim<char *,8> const > __f_iterator(das_global<TDim<char *,8>,0>(__context__) /*FIELDS*/);
+		char * const  * __f_rename_at_38;
+		__need_loop_38 = __f_iterator.first(__context__,(__f_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __f_iterator.next(__context__,(__f_rename_at_38)) )
+		{
+			__total_rename_at_35 += __tab_rename_at_33((*__f_rename_at_38),__context__);
+		}
+		__f_iterator.close(__context__,(__f_rename_at_38));
+	};
+	return __total_rename_at_35;
+}
+
+inline void makeJsonKeys_d17de3b7361fa14 ( Context * __context__, TArray<char *> &  __keys_rename_at_27 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__keys_rename_at_27),500000);
+	{
+		bool __need_loop_30 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,500000));
+		int32_t __i_rename_at_30;
+		__need_loop_30 = __i_iterator.first(__context__,(__i_rename_at_30)) && __need_loop_30;
+		for ( ; __need_loop_30 ; __need_loop_30 = __i_iterator.next(__context__,(__i_rename_at_30)) )
+		{
+			das_copy(__keys_rename_at_27(__i_rename_at_30,__context__),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<char * const >::from(das_global<TDim<char *,8>,0>(__context__) /*FIELDS*/((SimPolicy<int32_t>::Mod(__i_rename_at_30,8,*__context__)),__context__)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_30));
+	};
+}
+
+inline void makeRandomSequence_99f755fbd7198973 ( Context * __context__, TArray<char *> &  __src_rename_at_11 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__src_rename_at_11),500000);
+	{
+		bool __need_loop_15 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,500000));
+		int32_t __i_rename_at_15;
+		__need_loop_15 = __i_iterator.first(__context__,(__i_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __i_iterator.next(__context__,(__i_rename_at_15)) )
+		{
+			uint32_t __num_rename_at_16 = (uint32_t)(SimPolicy<uint32_t>::Mod((0x1033c4d7u ^ uint32_t(__i_rename_at_15 * 119)),0x7a120u,*__context__));
+			das_copy(__src_rename_at_11(__i_rename_at_15,__context__),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<uint32_t>::from(__num_rename_at_16))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_15));
+	};
+}
+
+inline bool test_803147c64bf44027 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,240,"test " DAS_FILE_LINE);
+{
+	TTable<char *,int32_t> __tab_rename_at_44; das_zero(__tab_rename_at_44);
+	TArray<char *> __src_rename_at_45; das_zero(__src_rename_at_45);
+	makeRandomSequence_99f755fbd7198973(__context__,das_arg<TArray<char *>>::pass(__src_rename_at_45));
+	builtin_profile(20,((char *) "dictionary, interned strings"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		dict_46243f36b21c16d5(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_44),das_arg<TArray<char *>>::pass(__src_rename_at_45));
+	}),__context__);
+	TArray<char *> __keys_rename_at_49; das_zero(__keys_rename_at_49);
+	makeJsonKeys_d17de3b7361fa14(__context__,das_arg<TArray<char *>>::pass(__keys_rename_at_49));
+	builtin_profile(20,((char *) "json keys, interned strings"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		json_3d7d2d92944a1cd(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_44),das_arg<TArray<char *>>::pass(__keys_rename_at_49));
+	}),__context__);
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// dict_46243f36b21c16d5
+		aotLib[0xaf5216383d4cb8a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<char *,int32_t> & , TArray<char *> const  &  ),&dict_46243f36b21c16d5>>();
+	};
+		// json_3d7d2d92944a1cd
+		aotLib[0xc1ca6b0625a096d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<char *,int32_t> & , TArray<char *> const  &  ),&json_3d7d2d92944a1cd>>();
+	};
+		// makeJsonKeys_d17de3b7361fa14
+		aotLib[0x283908cd40bb107b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&makeJsonKeys_d17de3b7361fa14>>();
+	};
+		// makeRandomSequence_99f755fbd7198973
+		aotLib[0x7733c1e240221bd3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&makeRandomSequence_99f755fbd7198973>>();
+	};
+		// test_803147c64bf44027
+		aotLib[0x5995c4b0f404ee8c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_803147c64bf44027>>();
+	};
+		// [[ init script ]]
+		aotLib[0x13464b27bacd0e7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,306 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__a0eb0f08;
+extern TypeInfo __type_info__a6c45d85;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__a0eb0f08 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa0eb0f08 };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__95e97e5e };
+TypeInfo * __tinfo_1[1] = { &__type_info__a6c45d85 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f7fba288, &__type_info__a0eb0f08 };
+TypeInfo * __tinfo_3[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_4[2] = { &__type_info__f7fba288, &__type_info__a6c45d85 };
+TypeInfo * __tinfo_5[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_6[2] = { &__type_info__f7fba288, &__type_info__95e97e5e };
+TypeInfo * __tinfo_7[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline int32_t format_ints_aa715994e6a6ba2d ( Context * __context__ );
+inline void makeNumbers_d234d37f94214f95 ( Context * __context__, TArray<char *> & __ints_rename_at_39, TArray<char *> & __floats_rename_at_39 );
+inline float parse_floats_5ee86265ea01dba3 ( Context * __context__, TArray<char *> const  & __floats_rename_at_54 );
+inline int32_t parse_ints_8bb30dacf453d0cc ( Context * __context__, TArray<char *> const  & __ints_rename_at_47 );
+inline bool test_89511abaf6bf3051 ( Context * __context__ );
+inline int32_t write_doubles_1e0141c977a0d2e0 ( Context * __context__ );
+inline int32_t write_floats_a9fa0743ea070eb4 ( Context * __context__ );
+inline int32_t write_ints_b6048bb4bb25f6d4 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_280),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline int32_t format_ints_aa715994e6a6ba2d ( Context * __context__ )
+{
+	char * __text_rename_at_34 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_34)->void{
+		{
+			bool __need_loop_35 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,200000));
+			int32_t __i_rename_at_35;
+			__need_loop_35 = __i_iterator.first(__context__,(__i_rename_at_35)) && __need_loop_35;
+			for ( ; __need_loop_35 ; __need_loop_35 = __i_iterator.next(__context__,(__i_rename_at_35)) )
+			{
+				format_and_write<int32_t>(das_arg<StringBuilderWriter>::pass(__writer_rename_at_34),((char *) "%d"),__i_rename_at_35);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_35));
+		};
+	},__context__))));
+	return builtin_string_length(__text_rename_at_34,__context__);
+}
+
+inline void makeNumbers_d234d37f94214f95 ( Context * __context__, TArray<char *> &  __ints_rename_at_39, TArray<char *> &  __floats_rename_at_39 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__ints_rename_at_39),200000);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__floats_rename_at_39),200000);
+	{
+		bool __need_loop_42 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,200000));
+		int32_t __i_rename_at_42;
+		__need_loop_42 = __i_iterator.first(__context__,(__i_rename_at_42)) && __need_loop_42;
+		for ( ; __need_loop_42 ; __need_loop_42 = __i_iterator.next(__context__,(__i_rename_at_42)) )
+		{
+			das_copy(__ints_rename_at_39(__i_rename_at_42,__context__),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(((__i_rename_at_42 * 7919) - 1000000)))));
+			das_copy(__floats_rename_at_39(__i_rename_at_42,__context__),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<float>::from((float(__i_rename_at_42) * 0.731f)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_42));
+	};
+}
+
+inline float parse_floats_5ee86265ea01dba3 ( Context * __context__, TArray<char *> const  &  __floats_rename_at_54 )
+{
+	float __total_rename_at_55 = 0.f;
+	{
+		bool __need_loop_56 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__floats_rename_at_54);
+		char * const  * __s_rename_at_56;
+		__need_loop_56 = __s_iterator.first(__context__,(__s_rename_at_56)) && __need_loop_56;
+		for ( ; __need_loop_56 ; __need_loop_56 = __s_iterator.next(__context__,(__s_rename_at_56)) )
+		{
+			__total_rename_at_55 += string_to_float((*__s_rename_at_56),__context__);
+		}
+		__s_iterator.close(__context__,(__s_rename_at_56));
+	};
+	return __total_rename_at_55;
+}
+
+inline int32_t parse_ints_8bb30dacf453d0cc ( Context * __context__, TArray<char *> const  &  __ints_rename_at_47 )
+{
+	int32_t __total_rename_at_48 = 0;
+	{
+		bool __need_loop_49 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__ints_rename_at_47);
+		char * const  * __s_rename_at_49;
+		__need_loop_49 = __s_iterator.first(__context__,(__s_rename_at_49)) && __need_loop_49;
+		for ( ; __need_loop_49 ; __need_loop_49 = __s_iterator.next(__context__,(__s_rename_at_49)) )
+		{
+			__total_rename_at_48 += string_to_int((*__s_rename_at_49),__context__);
+		}
+		__s_iterator.close(__context__,(__s_rename_at_49));
+	};
+	return __total_rename_at_48;
+}
+
+inline bool test_89511abaf6bf3051 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,384,"test " DAS_FILE_LINE);
+{
+	builtin_profile(20,((char *) "write int"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		write_ints_b6048bb4bb25f6d4(__context__);
+	}),__context__);
+	builtin_profile(20,((char *) "write float"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		write_floats_a9fa0743ea070eb4(__context__);
+	}),__context__);
+	builtin_profile(20,((char *) "write double"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		write_doubles_1e0141c977a0d2e0(__context__);
+	}),__context__);
+	builtin_profile(20,((char *) "format %d"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		format_ints_aa715994e6a6ba2d(__context__);
+	}),__context__);
+	TArray<char *> __ints_rename_at_70; das_zero(__ints_rename_at_70); TArray<char *> __floats_rename_at_70; das_zero(__floats_rename_at_70);
+	makeNumbers_d234d37f94214f95(__context__,das_arg<TArray<char *>>::pass(__ints_rename_at_70),das_arg<TArray<char *>>::pass(__floats_rename_at_70));
+	builtin_profile(20,((char *) "parse int"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		parse_ints_8bb30dacf453d0cc(__context__,das_arg<TArray<char *>>::pass(__ints_rename_at_70));
+	}),__context__);
+	builtin_profile(20,((char *) "parse float"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		parse_floats_5ee86265ea01dba3(__context__,das_arg<TArray<char *>>::pass(__floats_rename_at_70));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__ints_rename_at_70));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__floats_rename_at_70));
+	return true;
+}}
+
+inline int32_t write_doubles_1e0141c977a0d2e0 ( Context * __context__ )
+{
+	char * __text_rename_at_26 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_26)->void{
+		{
+			bool __need_loop_27 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,200000));
+			int32_t __i_rename_at_27;
+			__need_loop_27 = __i_iterator.first(__context__,(__i_rename_at_27)) && __need_loop_27;
+			for ( ; __need_loop_27 ; __need_loop_27 = __i_iterator.next(__context__,(__i_rename_at_27)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_26),cast<double>::from(double(__i_rename_at_27) * 0.731)));
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_26),cast<char * const >::from(((char *) ","))));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_27));
+		};
+	},__context__))));
+	return builtin_string_length(__text_rename_at_26,__context__);
+}
+
+inline int32_t write_floats_a9fa0743ea070eb4 ( Context * __context__ )
+{
+	char * __text_rename_at_18 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_18)->void{
+		{
+			bool __need_loop_19 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,200000));
+			int32_t __i_rename_at_19;
+			__need_loop_19 = __i_iterator.first(__context__,(__i_rename_at_19)) && __need_loop_19;
+			for ( ; __need_loop_19 ; __need_loop_19 = __i_iterator.next(__context__,(__i_rename_at_19)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<StringBuilderWriter &>::from(__writer_rename_at_18),cast<float>::from(float(__i_rename_at_19) * 0.731f)));
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<StringBuilderWriter &>::from(__writer_rename_at_18),cast<char * const >::from(((char *) ","))));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_19));
+		};
+	},__context__))));
+	return builtin_string_length(__text_rename_at_18,__context__);
+}
+
+inline int32_t write_ints_b6048bb4bb25f6d4 ( Context * __context__ )
+{
+	char * __text_rename_at_10 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_10)->void{
+		{
+			bool __need_loop_11 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,200000));
+			int32_t __i_rename_at_11;
+			__need_loop_11 = __i_iterator.first(__context__,(__i_rename_at_11)) && __need_loop_11;
+			for ( ; __need_loop_11 ; __need_loop_11 = __i_iterator.next(__context__,(__i_rename_at_11)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_6,cast<StringBuilderWriter &>::from(__writer_rename_at_10),cast<int32_t>::from((__i_rename_at_11 * 7919) - 1000000)));
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_7,cast<StringBuilderWriter &>::from(__writer_rename_at_10),cast<char * const >::from(((char *) ","))));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_11));
+		};
+	},__context__))));
+	return builtin_string_length(__text_rename_at_10,__context__);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// format_ints_aa715994e6a6ba2d
+		aotLib[0x2444bc6311926759] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&format_ints_aa715994e6a6ba2d>>();
+	};
+		// makeNumbers_d234d37f94214f95
+		aotLib[0x7a8c24c58a0d83c7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TArray<char *> &  ),&makeNumbers_d234d37f94214f95>>();
+	};
+		// parse_floats_5ee86265ea01dba3
+		aotLib[0x4823351c50894c45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TArray<char *> const  &  ),&parse_floats_5ee86265ea01dba3>>();
+	};
+		// parse_ints_8bb30dacf453d0cc
+		aotLib[0x810731bf3a6c72cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  &  ),&parse_ints_8bb30dacf453d0cc>>();
+	};
+		// test_89511abaf6bf3051
+		aotLib[0x5aec3e57924b7c5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_89511abaf6bf3051>>();
+	};
+		// write_doubles_1e0141c977a0d2e0
+		aotLib[0xc14cf4520bbf881d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&write_doubles_1e0141c977a0d2e0>>();
+	};
+		// write_floats_a9fa0743ea070eb4
+		aotLib[0x9575aebfc6e46d45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&write_floats_a9fa0743ea070eb4>>();
+	};
+		// write_ints_b6048bb4bb25f6d4
+		aotLib[0x3c9e1441221f46d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&write_ints_b6048bb4bb25f6d4>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
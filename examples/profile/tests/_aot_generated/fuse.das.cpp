@@ -0,0 +1,939 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require functional
+ // require strings_boost
+ // require ast_boost
+ // require fuse
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__6ce02eca;
+extern StructInfo __struct_info__530dd76;
+extern StructInfo __struct_info__ae2db0a3;
+extern StructInfo __struct_info__ffcc893c;
+extern StructInfo __struct_info__51831ef8;
+extern StructInfo __struct_info__827ee77f;
+extern StructInfo __struct_info__426ad2e6;
+extern StructInfo __struct_info__f8fabcd3;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__99d54727;
+extern TypeInfo __type_info__84f528db;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__6edc9442;
+extern TypeInfo __type_info__919c60a8;
+extern TypeInfo __type_info__efb0176c;
+extern TypeInfo __type_info__5c79b0a6;
+extern TypeInfo __type_info__9e630bde;
+extern TypeInfo __type_info__e1cdd614;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__4c24bfee;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__9d71db13;
+extern TypeInfo __type_info__58079c3;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__da671e6f;
+extern TypeInfo __type_info__5f87826b;
+extern TypeInfo __type_info__e9838040;
+extern TypeInfo __type_info__3e562156;
+extern TypeInfo __type_info__25c20a3a;
+extern VarInfo __var_info__f80c95ac;
+extern VarInfo __var_info__38ae282;
+extern VarInfo __var_info__405f1b20;
+extern VarInfo __var_info__62d6b924;
+extern VarInfo __var_info__5930d430;
+extern VarInfo __var_info__c09c1dcc;
+extern VarInfo __var_info__5df9aa1b;
+extern VarInfo __var_info__8a63efa8;
+extern VarInfo __var_info__edc84560;
+extern VarInfo __var_info__42ed625;
+extern VarInfo __var_info__ad254ac9;
+extern VarInfo __var_info__c4d56c93;
+extern VarInfo __var_info__acecfcbd;
+extern VarInfo __var_info__bcdf0b29;
+extern VarInfo __var_info__d046b7ef;
+extern VarInfo __var_info__9f7fc612;
+extern VarInfo __var_info__6f50e843;
+extern VarInfo __var_info__b0dd1c2d;
+extern VarInfo __var_info__8d0799d5;
+extern VarInfo __var_info__80c8a369;
+extern VarInfo __var_info__5dd758cf;
+extern VarInfo __var_info__1ee6bb20;
+extern VarInfo __var_info__8844746a;
+extern VarInfo __var_info__13c9f19d;
+extern VarInfo __var_info__c4b4cbe;
+extern VarInfo __var_info__c5277429;
+extern VarInfo __var_info__2124ae94;
+extern VarInfo __var_info__b5d6f2f7;
+extern VarInfo __var_info__fb4e9ccd;
+extern VarInfo __var_info__8ae5e8a1;
+extern FuncInfo __func_info__2c47cca3;
+
+TypeInfo * __type_info__b5d6f2f7_arg_types_var_1826631370[3] = { &__type_info__25c20a3a, &__type_info__359c1b32, &__type_info__359c1b32 };
+VarInfo __struct_info__6ce02eca_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__359c1b32, nullptr, (TypeInfo **)__type_info__b5d6f2f7_arg_types_var_1826631370, nullptr, 3, 0, nullptr, 28, 0xb5d6f2f7, "__lambda", 0 };
+TypeInfo * __type_info__c4b4cbe_arg_types_var_1826631370[1] = { &__type_info__6edc9442 };
+VarInfo __struct_info__6ce02eca_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c4b4cbe_arg_types_var_1826631370, nullptr, 1, 0, nullptr, 28, 0xc4b4cbe, "__finalize", 4 };
+VarInfo * __struct_info__6ce02eca_fields[2] =  { &__struct_info__6ce02eca_field_0, &__struct_info__6ce02eca_field_1 };
+StructInfo __struct_info__6ce02eca = {"_lambda_thismodule_12_100_7", __struct_info__6ce02eca_fields, 2, 8, -1, nullptr, 0x6ce02eca };
+TypeInfo * __type_info__6f50e843_arg_types_var_87088502[2] = { &__type_info__5c79b0a6, &__type_info__359c1b32 };
+VarInfo __struct_info__530dd76_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__6f50e843_arg_types_var_87088502, nullptr, 2, 0, nullptr, 28, 0x6f50e843, "__lambda", 0 };
+TypeInfo * __type_info__9f7fc612_arg_types_var_87088502[1] = { &__type_info__9e630bde };
+VarInfo __struct_info__530dd76_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9f7fc612_arg_types_var_87088502, nullptr, 1, 0, nullptr, 28, 0x9f7fc612, "__finalize", 4 };
+VarInfo * __struct_info__530dd76_fields[2] =  { &__struct_info__530dd76_field_0, &__struct_info__530dd76_field_1 };
+StructInfo __struct_info__530dd76 = {"_lambda_thismodule_12_73_2", __struct_info__530dd76_fields, 2, 8, -1, nullptr, 0x530dd76 };
+TypeInfo * __type_info__1ee6bb20_arg_types_var_2922229923[2] = { &__type_info__9d71db13, &__type_info__359c1b32 };
+VarInfo __struct_info__ae2db0a3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1ee6bb20_arg_types_var_2922229923, nullptr, 2, 0, nullptr, 28, 0x1ee6bb20, "__lambda", 0 };
+TypeInfo * __type_info__42ed625_arg_types_var_2922229923[1] = { &__type_info__5f87826b };
+VarInfo __struct_info__ae2db0a3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__42ed625_arg_types_var_2922229923, nullptr, 1, 0, nullptr, 28, 0x42ed625, "__finalize", 4 };
+VarInfo * __struct_info__ae2db0a3_fields[2] =  { &__struct_info__ae2db0a3_field_0, &__struct_info__ae2db0a3_field_1 };
+StructInfo __struct_info__ae2db0a3 = {"_lambda_thismodule_17_47_3", __struct_info__ae2db0a3_fields, 2, 8, -1, nullptr, 0xae2db0a3 };
+TypeInfo * __type_info__b0dd1c2d_arg_types_var_4291594556[2] = { &__type_info__efb0176c, &__type_info__359c1b32 };
+VarInfo __struct_info__ffcc893c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__b0dd1c2d_arg_types_var_4291594556, nullptr, 2, 0, nullptr, 28, 0xb0dd1c2d, "__lambda", 0 };
+TypeInfo * __type_info__2124ae94_arg_types_var_4291594556[1] = { &__type_info__e1cdd614 };
+VarInfo __struct_info__ffcc893c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2124ae94_arg_types_var_4291594556, nullptr, 1, 0, nullptr, 28, 0x2124ae94, "__finalize", 4 };
+VarInfo * __struct_info__ffcc893c_fields[2] =  { &__struct_info__ffcc893c_field_0, &__struct_info__ffcc893c_field_1 };
+StructInfo __struct_info__ffcc893c = {"_lambda_thismodule_17_78_4", __struct_info__ffcc893c_fields, 2, 8, -1, nullptr, 0xffcc893c };
+TypeInfo * __type_info__c5277429_arg_types_var_1367547640[2] = { &__type_info__919c60a8, &__type_info__e6eb6b88 };
+VarInfo __struct_info__51831ef8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__c5277429_arg_types_var_1367547640, nullptr, 2, 0, nullptr, 28, 0xc5277429, "__lambda", 0 };
+TypeInfo * __type_info__8a63efa8_arg_types_var_1367547640[1] = { &__type_info__e9838040 };
+VarInfo __struct_info__51831ef8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8a63efa8_arg_types_var_1367547640, nullptr, 1, 0, nullptr, 28, 0x8a63efa8, "__finalize", 4 };
+VarInfo __struct_info__51831ef8_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x5dd758cf, "__yield", 8 };
+TypeInfo * __type_info__5df9aa1b_arg_types_var_1367547640[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__51831ef8_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__5df9aa1b_arg_types_var_1367547640, nullptr, 1, 0, nullptr, 0, 0x5df9aa1b, "blk", 16 };
+VarInfo __struct_info__51831ef8_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__e6eb6b88, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x8844746a, "src", 24 };
+VarInfo __struct_info__51831ef8_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xacecfcbd, "_loop_at_9", 32 };
+VarInfo __struct_info__51831ef8_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__e6eb6b88, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xad254ac9, "_source_0_at_9", 40 };
+VarInfo __struct_info__51831ef8_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8ae5e8a1, "w", 48 };
+VarInfo __struct_info__51831ef8_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xfb4e9ccd, "_pvar_0_at_9", 56 };
+VarInfo * __struct_info__51831ef8_fields[9] =  { &__struct_info__51831ef8_field_0, &__struct_info__51831ef8_field_1, &__struct_info__51831ef8_field_2, &__struct_info__51831ef8_field_3, &__struct_info__51831ef8_field_4, &__struct_info__51831ef8_field_5, &__struct_info__51831ef8_field_6, &__struct_info__51831ef8_field_7, &__struct_info__51831ef8_field_8 };
+StructInfo __struct_info__51831ef8 = {"_lambda_thismodule_9_12_5", __struct_info__51831ef8_fields, 9, 64, -1, nullptr, 0x51831ef8 };
+TypeInfo * __type_info__c09c1dcc_arg_types_var_2189354879[2] = { &__type_info__da671e6f, &__type_info__359c1b32 };
+VarInfo __struct_info__827ee77f_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__c09c1dcc_arg_types_var_2189354879, nullptr, 2, 0, nullptr, 28, 0xc09c1dcc, "__lambda", 0 };
+TypeInfo * __type_info__80c8a369_arg_types_var_2189354879[1] = { &__type_info__99d54727 };
+VarInfo __struct_info__827ee77f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__80c8a369_arg_types_var_2189354879, nullptr, 1, 0, nullptr, 28, 0x80c8a369, "__finalize", 4 };
+VarInfo * __struct_info__827ee77f_fields[2] =  { &__struct_info__827ee77f_field_0, &__struct_info__827ee77f_field_1 };
+StructInfo __struct_info__827ee77f = {"_lambda_thismodule_12_42_1", __struct_info__827ee77f_fields, 2, 8, -1, nullptr, 0x827ee77f };
+TypeInfo * __type_info__c4d56c93_arg_types_var_1114297062[2] = { &__type_info__3e562156, &__type_info__e6eb6b88 };
+VarInfo __struct_info__426ad2e6_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__c4d56c93_arg_types_var_1114297062, nullptr, 2, 0, nullptr, 28, 0xc4d56c93, "__lambda", 0 };
+TypeInfo * __type_info__38ae282_arg_types_var_1114297062[1] = { &__type_info__4c24bfee };
+VarInfo __struct_info__426ad2e6_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__38ae282_arg_types_var_1114297062, nullptr, 1, 0, nullptr, 28, 0x38ae282, "__finalize", 4 };
+VarInfo __struct_info__426ad2e6_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xbcdf0b29, "__yield", 8 };
+TypeInfo * __type_info__13c9f19d_arg_types_var_1114297062[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__426ad2e6_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__13c9f19d_arg_types_var_1114297062, nullptr, 1, 0, nullptr, 0, 0x13c9f19d, "blk", 16 };
+VarInfo __struct_info__426ad2e6_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x405f1b20, "src", 24 };
+VarInfo __struct_info__426ad2e6_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xf80c95ac, "_loop_at_31", 32 };
+VarInfo __struct_info__426ad2e6_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x62d6b924, "_source_0_at_31", 40 };
+VarInfo __struct_info__426ad2e6_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd046b7ef, "w", 48 };
+VarInfo __struct_info__426ad2e6_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xedc84560, "_pvar_0_at_31", 56 };
+VarInfo * __struct_info__426ad2e6_fields[9] =  { &__struct_info__426ad2e6_field_0, &__struct_info__426ad2e6_field_1, &__struct_info__426ad2e6_field_2, &__struct_info__426ad2e6_field_3, &__struct_info__426ad2e6_field_4, &__struct_info__426ad2e6_field_5, &__struct_info__426ad2e6_field_6, &__struct_info__426ad2e6_field_7, &__struct_info__426ad2e6_field_8 };
+StructInfo __struct_info__426ad2e6 = {"_lambda_thismodule_31_12_6", __struct_info__426ad2e6_fields, 9, 64, -1, nullptr, 0x426ad2e6 };
+TypeInfo * __type_info__5930d430_arg_types_var_4177181907[3] = { &__type_info__58079c3, &__type_info__359c1b32, &__type_info__359c1b32 };
+VarInfo __struct_info__f8fabcd3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__359c1b32, nullptr, (TypeInfo **)__type_info__5930d430_arg_types_var_4177181907, nullptr, 3, 0, nullptr, 28, 0x5930d430, "__lambda", 0 };
+TypeInfo * __type_info__8d0799d5_arg_types_var_4177181907[1] = { &__type_info__84f528db };
+VarInfo __struct_info__f8fabcd3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8d0799d5_arg_types_var_4177181907, nullptr, 1, 0, nullptr, 28, 0x8d0799d5, "__finalize", 4 };
+VarInfo * __struct_info__f8fabcd3_fields[2] =  { &__struct_info__f8fabcd3_field_0, &__struct_info__f8fabcd3_field_1 };
+StructInfo __struct_info__f8fabcd3 = {"_lambda_thismodule_17_105_8", __struct_info__f8fabcd3_fields, 2, 8, -1, nullptr, 0xf8fabcd3 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x13667ab1 };
+TypeInfo __type_info__99d54727 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da671e6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x99d54727 };
+TypeInfo __type_info__84f528db = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__58079c3, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x84f528db };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__6edc9442 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__25c20a3a, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x6edc9442 };
+TypeInfo __type_info__919c60a8 = { Type::tStructure, &__struct_info__51831ef8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x919c60a8 };
+TypeInfo __type_info__efb0176c = { Type::tStructure, &__struct_info__ffcc893c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xefb0176c };
+TypeInfo __type_info__5c79b0a6 = { Type::tStructure, &__struct_info__530dd76, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x5c79b0a6 };
+TypeInfo __type_info__9e630bde = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5c79b0a6, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x9e630bde };
+TypeInfo __type_info__e1cdd614 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__efb0176c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe1cdd614 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__4c24bfee = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3e562156, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4c24bfee };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0xe6eb6b88 };
+TypeInfo __type_info__9d71db13 = { Type::tStructure, &__struct_info__ae2db0a3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x9d71db13 };
+TypeInfo __type_info__58079c3 = { Type::tStructure, &__struct_info__f8fabcd3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x58079c3 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__da671e6f = { Type::tStructure, &__struct_info__827ee77f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xda671e6f };
+TypeInfo __type_info__5f87826b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9d71db13, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x5f87826b };
+TypeInfo __type_info__e9838040 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__919c60a8, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe9838040 };
+TypeInfo __type_info__3e562156 = { Type::tStructure, &__struct_info__426ad2e6, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3e562156 };
+TypeInfo __type_info__25c20a3a = { Type::tStructure, &__struct_info__6ce02eca, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x25c20a3a };
+
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure FuseMacro
+namespace  {
+
+struct _lambda_thismodule_12_42_1 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_12_42_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_12_42_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_12_42_1)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_42_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_42_1,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_12_73_2 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_12_73_2,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_12_73_2 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_12_73_2)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_73_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_73_2,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_17_47_3 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_17_47_3,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_17_47_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_17_47_3)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_17_47_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_17_47_3,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_17_78_4 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_17_78_4,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_17_78_4 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_17_78_4)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_17_78_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_17_78_4,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_12_5 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_9_12_5,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_9_12_5 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t &)) src;
+	bool _loop_at_9;
+	Sequence DAS_COMMENT((int32_t &)) _source_0_at_9;
+	int32_t * w;
+	void * _pvar_0_at_9;
+};
+static_assert(sizeof(_lambda_thismodule_9_12_5)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_5,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_5,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_5,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_5,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_5,_loop_at_9)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_5,_source_0_at_9)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_5,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_5,_pvar_0_at_9)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_6 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_6,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_6 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_31;
+	int32_t w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_6)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_6,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_6,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_6,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_6,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_6,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_6,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_6,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_6,_pvar_0_at_31)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_12_100_7 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_12_100_7,int32_t,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_12_100_7 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_12_100_7)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_100_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_100_7,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_17_105_8 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_17_105_8,int32_t,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_17_105_8 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_17_105_8)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_17_105_8,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_17_105_8,__finalize)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_12_100_7_0x60_finazlier_e8d16dc066a6c316 ( Context * __context__, struct _lambda_thismodule_12_100_7 * ____this_rename_at_12 );
+inline int32_t _Func_lambda_thismodule_12_100_7_0x60_function_3f6e7b29086f8a4e ( Context * __context__, struct _lambda_thismodule_12_100_7 & ____this_rename_at_12, int32_t __l_rename_at_12, int32_t __r_rename_at_12 );
+inline void _Func_lambda_thismodule_12_42_1_0x60_finazlier_868e4cf47cbd4c26 ( Context * __context__, struct _lambda_thismodule_12_42_1 * ____this_rename_at_12 );
+inline bool _Func_lambda_thismodule_12_42_1_0x60_function_1d65cbe833e7f829 ( Context * __context__, struct _lambda_thismodule_12_42_1 & ____this_rename_at_12, int32_t __x_rename_at_12 );
+inline void _Func_lambda_thismodule_12_73_2_0x60_finazlier_2911fd1a9e83c41e ( Context * __context__, struct _lambda_thismodule_12_73_2 * ____this_rename_at_12 );
+inline int32_t _Func_lambda_thismodule_12_73_2_0x60_function_d840bef18a0d6f72 ( Context * __context__, struct _lambda_thismodule_12_73_2 & ____this_rename_at_12, int32_t __x_rename_at_12 );
+inline void _Func_lambda_thismodule_17_105_8_0x60_finazlier_c8a8bc633c26e45c ( Context * __context__, struct _lambda_thismodule_17_105_8 * ____this_rename_at_17 );
+inline int32_t _Func_lambda_thismodule_17_105_8_0x60_function_90215742bc3156fd ( Context * __context__, struct _lambda_thismodule_17_105_8 & ____this_rename_at_17, int32_t __l_rename_at_17, int32_t __r_rename_at_17 );
+inline void _Func_lambda_thismodule_17_47_3_0x60_finazlier_24116991497c9cae ( Context * __context__, struct _lambda_thismodule_17_47_3 * ____this_rename_at_17 );
+inline bool _Func_lambda_thismodule_17_47_3_0x60_function_83eab02b2a4efded ( Context * __context__, struct _lambda_thismodule_17_47_3 & ____this_rename_at_17, int32_t __x_rename_at_17 );
+inline void _Func_lambda_thismodule_17_78_4_0x60_finazlier_58f8cdb863204116 ( Context * __context__, struct _lambda_thismodule_17_78_4 * ____this_rename_at_17 );
+inline int32_t _Func_lambda_thismodule_17_78_4_0x60_function_36a5c006802d3244 ( Context * __context__, struct _lambda_thismodule_17_78_4 & ____this_rename_at_17, int32_t __x_rename_at_17 );
+inline void _Func_lambda_thismodule_31_12_6_0x60_finazlier_576168d25ab049d8 ( Context * __context__, struct _lambda_thismodule_31_12_6 * ____this_rename_at_31 );
+inline bool _Func_lambda_thismodule_31_12_6_0x60_function_b3d85a5786d063a0 ( Context * __context__, struct _lambda_thismodule_31_12_6 & ____this_rename_at_31, int32_t & ___yield_31_rename_at_31 );
+inline void _Func_lambda_thismodule_9_12_5_0x60_finazlier_f3b653d752683fc ( Context * __context__, struct _lambda_thismodule_9_12_5 * ____this_rename_at_9 );
+inline bool _Func_lambda_thismodule_9_12_5_0x60_function_6f6c58c289756f24 ( Context * __context__, struct _lambda_thismodule_9_12_5 & ____this_rename_at_9, int32_t & ___yield_9_rename_at_9 );
+inline int32_t _Func_0x60_fuse_0x60_0x11_0x60_0xf_0x60_0_403c69d153a95450 ( Context * __context__, TArray<int32_t> const  & ____src_rename_at_17, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_17, Lambda DAS_COMMENT((int32_t,int32_t)) const  ____fn1_rename_at_17, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  ____fnr_rename_at_17 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_348 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_53ccff887674360c ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_353 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void finalize_24785af4982de746 ( Context * __context__, struct _lambda_thismodule_12_100_7 & ____this_rename_at_12 );
+inline void finalize_7b88146426db1081 ( Context * __context__, struct _lambda_thismodule_12_42_1 & ____this_rename_at_12 );
+inline void finalize_cc837b88adcfdd26 ( Context * __context__, struct _lambda_thismodule_12_73_2 & ____this_rename_at_12 );
+inline void finalize_a481c3f01461cf2d ( Context * __context__, struct _lambda_thismodule_17_105_8 & ____this_rename_at_17 );
+inline void finalize_c3c5209a4f439e79 ( Context * __context__, struct _lambda_thismodule_17_47_3 & ____this_rename_at_17 );
+inline void finalize_565ba0bfa200266c ( Context * __context__, struct _lambda_thismodule_17_78_4 & ____this_rename_at_17 );
+inline void finalize_6cd1a9fab31e9614 ( Context * __context__, struct _lambda_thismodule_31_12_6 & ____this_rename_at_31 );
+inline void finalize_5ae5083f56453efa ( Context * __context__, struct _lambda_thismodule_9_12_5 & ____this_rename_at_9 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_dd04023fc297a5a9 ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) & __src_rename_at_20, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_20 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_1c710a5b8757d07c ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) & __src_rename_at_6, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_6 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_478dab29ef056fb6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_46, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_46 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_11bdc1cb8443f4d0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_28, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_28 );
+inline int32_t _Funcfunctional_0x60_reduce_cb178b30ab4da07 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_69, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_69 );
+inline int32_t _Funcfunctional_0x60_reduce_any_6c02eae7c8fa51a7 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_55, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_55 );
+inline int32_t pipeline_ded6b8877c8236d9 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_10 );
+inline int32_t pipeline_fused_3fb2e876bb9bc870 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_15 );
+inline bool test_65667982604edc43 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_12_100_7_0x60_finazlier_e8d16dc066a6c316 ( Context * __context__, struct _lambda_thismodule_12_100_7 * ____this_rename_at_12 )
+{
+	finalize_24785af4982de746(__context__,das_arg<struct _lambda_thismodule_12_100_7>::pass(das_deref(__context__,____this_rename_at_12)));
+	das_delete_lambda_struct<struct _lambda_thismodule_12_100_7 *>::clear(__context__,____this_rename_at_12);
+}
+
+inline int32_t _Func_lambda_thismodule_12_100_7_0x60_function_3f6e7b29086f8a4e ( Context * __context__, struct _lambda_thismodule_12_100_7 &  ____this_rename_at_12, int32_t __l_rename_at_12, int32_t __r_rename_at_12 )
+{
+	return __l_rename_at_12 + __r_rename_at_12;
+}
+
+inline void _Func_lambda_thismodule_12_42_1_0x60_finazlier_868e4cf47cbd4c26 ( Context * __context__, struct _lambda_thismodule_12_42_1 * ____this_rename_at_12 )
+{
+	finalize_7b88146426db1081(__context__,das_arg<struct _lambda_thismodule_12_42_1>::pass(das_deref(__context__,____this_rename_at_12)));
+	das_delete_lambda_struct<struct _lambda_thismodule_12_42_1 *>::clear(__context__,____this_rename_at_12);
+}
+
+inline bool _Func_lambda_thismodule_12_42_1_0x60_function_1d65cbe833e7f829 ( Context * __context__, struct _lambda_thismodule_12_42_1 &  ____this_rename_at_12, int32_t __x_rename_at_12 )
+{
+	return (SimPolicy<int32_t>::Mod(__x_rename_at_12,3,*__context__)) != 0;
+}
+
+inline void _Func_lambda_thismodule_12_73_2_0x60_finazlier_2911fd1a9e83c41e ( Context * __context__, struct _lambda_thismodule_12_73_2 * ____this_rename_at_12 )
+{
+	finalize_cc837b88adcfdd26(__context__,das_arg<struct _lambda_thismodule_12_73_2>::pass(das_deref(__context__,____this_rename_at_12)));
+	das_delete_lambda_struct<struct _lambda_thismodule_12_73_2 *>::clear(__context__,____this_rename_at_12);
+}
+
+inline int32_t _Func_lambda_thismodule_12_73_2_0x60_function_d840bef18a0d6f72 ( Context * __context__, struct _lambda_thismodule_12_73_2 &  ____this_rename_at_12, int32_t __x_rename_at_12 )
+{
+	return __x_rename_at_12 * 2;
+}
+
+inline void _Func_lambda_thismodule_17_105_8_0x60_finazlier_c8a8bc633c26e45c ( Context * __context__, struct _lambda_thismodule_17_105_8 * ____this_rename_at_17 )
+{
+	finalize_a481c3f01461cf2d(__context__,das_arg<struct _lambda_thismodule_17_105_8>::pass(das_deref(__context__,____this_rename_at_17)));
+	das_delete_lambda_struct<struct _lambda_thismodule_17_105_8 *>::clear(__context__,____this_rename_at_17);
+}
+
+inline int32_t _Func_lambda_thismodule_17_105_8_0x60_function_90215742bc3156fd ( Context * __context__, struct _lambda_thismodule_17_105_8 &  ____this_rename_at_17, int32_t __l_rename_at_17, int32_t __r_rename_at_17 )
+{
+	return __l_rename_at_17 + __r_rename_at_17;
+}
+
+inline void _Func_lambda_thismodule_17_47_3_0x60_finazlier_24116991497c9cae ( Context * __context__, struct _lambda_thismodule_17_47_3 * ____this_rename_at_17 )
+{
+	finalize_c3c5209a4f439e79(__context__,das_arg<struct _lambda_thismodule_17_47_3>::pass(das_deref(__context__,____this_rename_at_17)));
+	das_delete_lambda_struct<struct _lambda_thismodule_17_47_3 *>::clear(__context__,____this_rename_at_17);
+}
+
+inline bool _Func_lambda_thismodule_17_47_3_0x60_function_83eab02b2a4efded ( Context * __context__, struct _lambda_thismodule_17_47_3 &  ____this_rename_at_17, int32_t __x_rename_at_17 )
+{
+	return (SimPolicy<int32_t>::Mod(__x_rename_at_17,3,*__context__)) != 0;
+}
+
+inline void _Func_lambda_thismodule_17_78_4_0x60_finazlier_58f8cdb863204116 ( Context * __context__, struct _lambda_thismodule_17_78_4 * ____this_rename_at_17 )
+{
+	finalize_565ba0bfa200266c(__context__,das_arg<struct _lambda_thismodule_17_78_4>::pass(das_deref(__context__,____this_rename_at_17)));
+	das_delete_lambda_struct<struct _lambda_thismodule_17_78_4 *>::clear(__context__,____this_rename_at_17);
+}
+
+inline int32_t _Func_lambda_thismodule_17_78_4_0x60_function_36a5c006802d3244 ( Context * __context__, struct _lambda_thismodule_17_78_4 &  ____this_rename_at_17, int32_t __x_rename_at_17 )
+{
+	return __x_rename_at_17 * 2;
+}
+
+inline void _Func_lambda_thismodule_31_12_6_0x60_finazlier_576168d25ab049d8 ( Context * __context__, struct _lambda_thismodule_31_12_6 * ____this_rename_at_31 )
+{
+	finalize_6cd1a9fab31e9614(__context__,das_arg<struct _lambda_thismodule_31_12_6>::pass(das_deref(__context__,____this_rename_at_31)));
+	das_delete_lambda_struct<struct _lambda_thismodule_31_12_6 *>::clear(__context__,____this_rename_at_31);
+}
+
+inline bool _Func_lambda_thismodule_31_12_6_0x60_function_b3d85a5786d063a0 ( Context * __context__, struct _lambda_thismodule_31_12_6 &  ____this_rename_at_31, int32_t & ___yield_31_rename_at_31 )
+{
+	switch (____this_rename_at_31.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_31._loop_at_31,true);
+	das_move(____this_rename_at_31._source_0_at_31,____this_rename_at_31.src);
+	memset(&(____this_rename_at_31.w), 0, 4);
+	das_copy(____this_rename_at_31._pvar_0_at_31,das_ref(__context__,____this_rename_at_31.w));
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_31._loop_at_31 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_31_rename_at_31,das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,____this_rename_at_31.blk,____this_rename_at_31.w));
+	das_copy(____this_rename_at_31.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_9_12_5_0x60_finazlier_f3b653d752683fc ( Context * __context__, struct _lambda_thismodule_9_12_5 * ____this_rename_at_9 )
+{
+	finalize_5ae5083f56453efa(__context__,das_arg<struct _lambda_thismodule_9_12_5>::pass(das_deref(__context__,____this_rename_at_9)));
+	das_delete_lambda_struct<struct _lambda_thismodule_9_12_5 *>::clear(__context__,____this_rename_at_9);
+}
+
+inline bool _Func_lambda_thismodule_9_12_5_0x60_function_6f6c58c289756f24 ( Context * __context__, struct _lambda_thismodule_9_12_5 &  ____this_rename_at_9, int32_t & ___yield_9_rename_at_9 )
+{
+	switch (____this_rename_at_9.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_9._loop_at_9,true);
+	das_move(____this_rename_at_9._source_0_at_9,____this_rename_at_9.src);
+	memset(&(____this_rename_at_9.w), 0, 8);
+	das_copy(____this_rename_at_9._pvar_0_at_9,das_ref(__context__,____this_rename_at_9.w));
+	DAS_SETBOOLAND((____this_rename_at_9._loop_at_9),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_9._loop_at_9 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,____this_rename_at_9.blk,das_deref(__context__,____this_rename_at_9.w)) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_9_rename_at_9,das_deref(__context__,____this_rename_at_9.w));
+	das_copy(____this_rename_at_9.__yield,1);
+	return true;
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_9._loop_at_9),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__);
+	return false;
+}
+
+inline int32_t _Func_0x60_fuse_0x60_0x11_0x60_0xf_0x60_0_403c69d153a95450 ( Context * __context__, TArray<int32_t> const  &  ____src_rename_at_17, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_17, Lambda DAS_COMMENT((int32_t,int32_t)) const  ____fn1_rename_at_17, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  ____fnr_rename_at_17 )
+{
+	int32_t ____acc_rename_at_17 = 0;
+	bool ____started_rename_at_17 = 0;
+	{
+		bool __need_loop_17 = true;
+		// __x0 : int aka TT const&
+		das_iterator<TArray<int32_t> const > ____x0_iterator(____src_rename_at_17);
+		int32_t const  * ____x0_rename_at_17;
+		__need_loop_17 = ____x0_iterator.first(__context__,(____x0_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = ____x0_iterator.next(__context__,(____x0_rename_at_17)) )
+		{
+			if ( das_invoke_lambda<bool>::invoke<int32_t>(__context__,____fn0_rename_at_17,(*____x0_rename_at_17)) )
+			{
+				int32_t ____x2_rename_at_17; das_zero(____x2_rename_at_17); das_move(____x2_rename_at_17, das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,____fn1_rename_at_17,(*____x0_rename_at_17)));
+				if ( ____started_rename_at_17 )
+				{
+					das_copy(____acc_rename_at_17,das_invoke_lambda<int32_t>::invoke<int32_t,int32_t>(__context__,____fnr_rename_at_17,____acc_rename_at_17,____x2_rename_at_17));
+				} else {
+					das_copy(____started_rename_at_17,true);
+					das_copy(____acc_rename_at_17,____x2_rename_at_17);
+				};
+			};
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_17));
+	};
+	if ( !____started_rename_at_17 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return ____acc_rename_at_17;
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_348 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_349; das_zero(__it_rename_at_349);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_349),__a_rename_at_348,4,__context__);
+	return /* <- */ __it_rename_at_349;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_53ccff887674360c ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_353 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_355; das_zero(__it_rename_at_355);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_355),__lam_rename_at_353,__context__);
+	return /* <- */ __it_rename_at_355;
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_280),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void finalize_24785af4982de746 ( Context * __context__, struct _lambda_thismodule_12_100_7 &  ____this_rename_at_12 )
+{
+	memset(&(____this_rename_at_12), 0, 8);
+}
+
+inline void finalize_7b88146426db1081 ( Context * __context__, struct _lambda_thismodule_12_42_1 &  ____this_rename_at_12 )
+{
+	memset(&(____this_rename_at_12), 0, 8);
+}
+
+inline void finalize_cc837b88adcfdd26 ( Context * __context__, struct _lambda_thismodule_12_73_2 &  ____this_rename_at_12 )
+{
+	memset(&(____this_rename_at_12), 0, 8);
+}
+
+inline void finalize_a481c3f01461cf2d ( Context * __context__, struct _lambda_thismodule_17_105_8 &  ____this_rename_at_17 )
+{
+	memset(&(____this_rename_at_17), 0, 8);
+}
+
+inline void finalize_c3c5209a4f439e79 ( Context * __context__, struct _lambda_thismodule_17_47_3 &  ____this_rename_at_17 )
+{
+	memset(&(____this_rename_at_17), 0, 8);
+}
+
+inline void finalize_565ba0bfa200266c ( Context * __context__, struct _lambda_thismodule_17_78_4 &  ____this_rename_at_17 )
+{
+	memset(&(____this_rename_at_17), 0, 8);
+}
+
+inline void finalize_6cd1a9fab31e9614 ( Context * __context__, struct _lambda_thismodule_31_12_6 &  ____this_rename_at_31 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),__context__);
+	memset(&(____this_rename_at_31), 0, 64);
+}
+
+inline void finalize_5ae5083f56453efa ( Context * __context__, struct _lambda_thismodule_9_12_5 &  ____this_rename_at_9 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),__context__);
+	memset(&(____this_rename_at_9), 0, 64);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_dd04023fc297a5a9 ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) &  __src_rename_at_20, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_20 )
+{
+	return /* <- */ _Funcfunctional_0x60_filter_any_1c710a5b8757d07c(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_20),__blk_rename_at_20);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_1c710a5b8757d07c ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) &  __src_rename_at_6, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_6 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_53ccff887674360c(__context__,das_ascend<bool,struct _lambda_thismodule_9_12_5>::make(__context__,&__type_info__919c60a8,(([&]() -> struct _lambda_thismodule_9_12_5 {
+		struct _lambda_thismodule_9_12_5 __mks_8;
+		das_zero(__mks_8);
+		das_copy((__mks_8.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_12_5`function _lambda_thismodule_9_12_5 int#ref*/ 781608028u))));
+		das_copy((__mks_8.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_12_5`finazlier #ptr#_lambda_thismodule_9_12_5#explicit*/ 802351452u))));
+		das_move((__mks_8.blk),(__blk_rename_at_6));
+		das_move((__mks_8.src),(__src_rename_at_6));
+		return __mks_8;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_478dab29ef056fb6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_46, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_46 )
+{
+	return /* <- */ _Funcfunctional_0x60_map_any_11bdc1cb8443f4d0(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_46),__blk_rename_at_46);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_11bdc1cb8443f4d0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_28, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_28 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_53ccff887674360c(__context__,das_ascend<bool,struct _lambda_thismodule_31_12_6>::make(__context__,&__type_info__3e562156,(([&]() -> struct _lambda_thismodule_31_12_6 {
+		struct _lambda_thismodule_31_12_6 __mks_30;
+		das_zero(__mks_30);
+		das_copy((__mks_30.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_6`function _lambda_thismodule_31_12_6 int#ref*/ 87507030u))));
+		das_copy((__mks_30.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_6`finazlier #ptr#_lambda_thismodule_31_12_6#explicit*/ 411576082u))));
+		das_move((__mks_30.blk),(__blk_rename_at_28));
+		das_move((__mks_30.src),(__src_rename_at_28));
+		return __mks_30;
+	})())));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_cb178b30ab4da07 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_69, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_69 )
+{
+	return _Funcfunctional_0x60_reduce_any_6c02eae7c8fa51a7(__context__,__it_rename_at_69,__blk_rename_at_69);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_6c02eae7c8fa51a7 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_55, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_55 )
+{
+	int32_t __left_rename_at_56 = 0;
+	bool __first_rename_at_57 = true;
+	{
+		bool __need_loop_58 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_55);
+		int32_t __right_rename_at_58;
+		__need_loop_58 = __right_iterator.first(__context__,(__right_rename_at_58)) && __need_loop_58;
+		for ( ; __need_loop_58 ; __need_loop_58 = __right_iterator.next(__context__,(__right_rename_at_58)) )
+		{
+			if ( __first_rename_at_57 )
+			{
+				das_copy(__first_rename_at_57,false);
+				das_copy(__left_rename_at_56,__right_rename_at_58);
+			} else {
+				das_copy(__left_rename_at_56,das_invoke_lambda<int32_t>::invoke<int32_t,int32_t>(__context__,__functor_rename_at_55,__left_rename_at_56,__right_rename_at_58));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_58));
+	};
+	if ( __first_rename_at_57 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return __left_rename_at_56;
+}
+
+inline int32_t pipeline_ded6b8877c8236d9 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_10 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_12_48;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_12_64;
+	return _Funcfunctional_0x60_reduce_cb178b30ab4da07(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_12_32 = (_Funcfunctional_0x60_map_478dab29ef056fb6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_12_48 = (_Funcfunctional_0x60_filter_dd04023fc297a5a9(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_12_64 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,__a_rename_at_10)))),das_ascend<bool,struct _lambda_thismodule_12_42_1>::make(__context__,&__type_info__da671e6f,(([&]() -> struct _lambda_thismodule_12_42_1 {
+		struct _lambda_thismodule_12_42_1 __mks_12;
+		das_copy((__mks_12.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_12_42_1`function _lambda_thismodule_12_42_1 int#const*/ 3672595160u))));
+		das_copy((__mks_12.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_12_42_1`finazlier #ptr#_lambda_thismodule_12_42_1#explicit*/ 3958527638u))));
+		return __mks_12;
+	})())))))),das_ascend<int32_t,struct _lambda_thismodule_12_73_2>::make(__context__,&__type_info__5c79b0a6,(([&]() -> struct _lambda_thismodule_12_73_2 {
+		struct _lambda_thismodule_12_73_2 __mks_12;
+		das_copy((__mks_12.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_12_73_2`function _lambda_thismodule_12_73_2 int#const*/ 1783514612u))));
+		das_copy((__mks_12.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_12_73_2`finazlier #ptr#_lambda_thismodule_12_73_2#explicit*/ 1318751518u))));
+		return __mks_12;
+	})())))))),das_ascend<int32_t,struct _lambda_thismodule_12_100_7>::make(__context__,&__type_info__25c20a3a,(([&]() -> struct _lambda_thismodule_12_100_7 {
+		struct _lambda_thismodule_12_100_7 __mks_12;
+		das_copy((__mks_12.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_12_100_7`function _lambda_thismodule_12_100_7 int#const int#const*/ 2029711323u))));
+		das_copy((__mks_12.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_12_100_7`finazlier #ptr#_lambda_thismodule_12_100_7#explicit*/ 2137822108u))));
+		return __mks_12;
+	})())));
+}
+
+inline int32_t pipeline_fused_3fb2e876bb9bc870 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_15 )
+{
+	return _Func_0x60_fuse_0x60_0x11_0x60_0xf_0x60_0_403c69d153a95450(__context__,__a_rename_at_15,das_ascend<bool,struct _lambda_thismodule_17_47_3>::make(__context__,&__type_info__9d71db13,(([&]() -> struct _lambda_thismodule_17_47_3 {
+		struct _lambda_thismodule_17_47_3 __mks_17;
+		das_copy((__mks_17.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_17_47_3`function _lambda_thismodule_17_47_3 int#const*/ 361739548u))));
+		das_copy((__mks_17.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_17_47_3`finazlier #ptr#_lambda_thismodule_17_47_3#explicit*/ 511258938u))));
+		return __mks_17;
+	})())),das_ascend<int32_t,struct _lambda_thismodule_17_78_4>::make(__context__,&__type_info__efb0176c,(([&]() -> struct _lambda_thismodule_17_78_4 {
+		struct _lambda_thismodule_17_78_4 __mks_17;
+		das_copy((__mks_17.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_17_78_4`function _lambda_thismodule_17_78_4 int#const*/ 1723398584u))));
+		das_copy((__mks_17.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_17_78_4`finazlier #ptr#_lambda_thismodule_17_78_4#explicit*/ 2190513938u))));
+		return __mks_17;
+	})())),das_ascend<int32_t,struct _lambda_thismodule_17_105_8>::make(__context__,&__type_info__58079c3,(([&]() -> struct _lambda_thismodule_17_105_8 {
+		struct _lambda_thismodule_17_105_8 __mks_17;
+		das_copy((__mks_17.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_17_105_8`function _lambda_thismodule_17_105_8 int#const int#const*/ 305294077u))));
+		das_copy((__mks_17.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_17_105_8`finazlier #ptr#_lambda_thismodule_17_105_8#explicit*/ 3555287526u))));
+		return __mks_17;
+	})())));
+}
+
+inline bool test_65667982604edc43 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,176,"test " DAS_FILE_LINE);
+{
+	TArray<int32_t> __a_rename_at_21; das_zero(__a_rename_at_21);
+	{
+		bool __need_loop_22 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_21),__i_rename_at_22,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+	DAS_VERIFY((pipeline_ded6b8877c8236d9(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_21)) == pipeline_fused_3fb2e876bb9bc870(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_21))));
+	builtin_profile(20,((char *) "filter, map, reduce"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		pipeline_ded6b8877c8236d9(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_21));
+	}),__context__);
+	builtin_profile(20,((char *) "fused filter, map, reduce"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		pipeline_fused_3fb2e876bb9bc870(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_21));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_21));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_12_100_7_0x60_finazlier_e8d16dc066a6c316
+		aotLib[0xd0380a9d334b7385] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_12_100_7 *  ),&_Func_lambda_thismodule_12_100_7_0x60_finazlier_e8d16dc066a6c316>>();
+	};
+		// _Func_lambda_thismodule_12_100_7_0x60_function_3f6e7b29086f8a4e
+		aotLib[0x264c538b1d3af17d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_12_100_7 & , int32_t , int32_t  ),&_Func_lambda_thismodule_12_100_7_0x60_function_3f6e7b29086f8a4e>>();
+	};
+		// _Func_lambda_thismodule_12_42_1_0x60_finazlier_868e4cf47cbd4c26
+		aotLib[0xdbb93c7d64dfa674] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_12_42_1 *  ),&_Func_lambda_thismodule_12_42_1_0x60_finazlier_868e4cf47cbd4c26>>();
+	};
+		// _Func_lambda_thismodule_12_42_1_0x60_function_1d65cbe833e7f829
+		aotLib[0xdd7936c54aff2725] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_12_42_1 & , int32_t  ),&_Func_lambda_thismodule_12_42_1_0x60_function_1d65cbe833e7f829>>();
+	};
+		// _Func_lambda_thismodule_12_73_2_0x60_finazlier_2911fd1a9e83c41e
+		aotLib[0x7228839208e6529a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_12_73_2 *  ),&_Func_lambda_thismodule_12_73_2_0x60_finazlier_2911fd1a9e83c41e>>();
+	};
+		// _Func_lambda_thismodule_12_73_2_0x60_function_d840bef18a0d6f72
+		aotLib[0x5e9e017a6f2893e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_12_73_2 & , int32_t  ),&_Func_lambda_thismodule_12_73_2_0x60_function_d840bef18a0d6f72>>();
+	};
+		// _Func_lambda_thismodule_17_105_8_0x60_finazlier_c8a8bc633c26e45c
+		aotLib[0x543ba086c7520f04] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_17_105_8 *  ),&_Func_lambda_thismodule_17_105_8_0x60_finazlier_c8a8bc633c26e45c>>();
+	};
+		// _Func_lambda_thismodule_17_105_8_0x60_function_90215742bc3156fd
+		aotLib[0xbbad19f4bddca00d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_17_105_8 & , int32_t , int32_t  ),&_Func_lambda_thismodule_17_105_8_0x60_function_90215742bc3156fd>>();
+	};
+		// _Func_lambda_thismodule_17_47_3_0x60_finazlier_24116991497c9cae
+		aotLib[0xf4d8c8d10735da7a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_17_47_3 *  ),&_Func_lambda_thismodule_17_47_3_0x60_finazlier_24116991497c9cae>>();
+	};
+		// _Func_lambda_thismodule_17_47_3_0x60_function_83eab02b2a4efded
+		aotLib[0x722cbc5f60a47675] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_17_47_3 & , int32_t  ),&_Func_lambda_thismodule_17_47_3_0x60_function_83eab02b2a4efded>>();
+	};
+		// _Func_lambda_thismodule_17_78_4_0x60_finazlier_58f8cdb863204116
+		aotLib[0x5d6dc27fa3023bcb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_17_78_4 *  ),&_Func_lambda_thismodule_17_78_4_0x60_finazlier_58f8cdb863204116>>();
+	};
+		// _Func_lambda_thismodule_17_78_4_0x60_function_36a5c006802d3244
+		aotLib[0x3f286c77b7d66bf5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_17_78_4 & , int32_t  ),&_Func_lambda_thismodule_17_78_4_0x60_function_36a5c006802d3244>>();
+	};
+		// _Func_lambda_thismodule_31_12_6_0x60_finazlier_576168d25ab049d8
+		aotLib[0x4267462d4a59f2a0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_6 *  ),&_Func_lambda_thismodule_31_12_6_0x60_finazlier_576168d25ab049d8>>();
+	};
+		// _Func_lambda_thismodule_31_12_6_0x60_function_b3d85a5786d063a0
+		aotLib[0xd47bd1b8081ebed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_31_12_6 & , int32_t &  ),&_Func_lambda_thismodule_31_12_6_0x60_function_b3d85a5786d063a0>>();
+	};
+		// _Func_lambda_thismodule_9_12_5_0x60_finazlier_f3b653d752683fc
+		aotLib[0x6e3e0910ab5f6af2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_12_5 *  ),&_Func_lambda_thismodule_9_12_5_0x60_finazlier_f3b653d752683fc>>();
+	};
+		// _Func_lambda_thismodule_9_12_5_0x60_function_6f6c58c289756f24
+		aotLib[0x2f8991de2f7a6c25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_9_12_5 & , int32_t &  ),&_Func_lambda_thismodule_9_12_5_0x60_function_6f6c58c289756f24>>();
+	};
+		// _Func_0x60_fuse_0x60_0x11_0x60_0xf_0x60_0_403c69d153a95450
+		aotLib[0xe506006a3a55ff8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , Lambda DAS_COMMENT((bool,int32_t)) const  , Lambda DAS_COMMENT((int32_t,int32_t)) const  , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Func_0x60_fuse_0x60_0x11_0x60_0xf_0x60_0_403c69d153a95450>>();
+	};
+		// _Funcbuiltin_0x60_each_49ba41ea6e9b0c25
+		aotLib[0x6a4a051ab138a935] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_49ba41ea6e9b0c25>>();
+	};
+		// _Funcbuiltin_0x60_each_53ccff887674360c
+		aotLib[0x33b53dc307e70da5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_53ccff887674360c>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// finalize_24785af4982de746
+		aotLib[0x8110d459c6241385] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_12_100_7 &  ),&finalize_24785af4982de746>>();
+	};
+		// finalize_7b88146426db1081
+		aotLib[0x31b8ad82dd8262e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_12_42_1 &  ),&finalize_7b88146426db1081>>();
+	};
+		// finalize_cc837b88adcfdd26
+		aotLib[0x604b4019ca398f81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_12_73_2 &  ),&finalize_cc837b88adcfdd26>>();
+	};
+		// finalize_a481c3f01461cf2d
+		aotLib[0x7ce40bd45f697015] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_17_105_8 &  ),&finalize_a481c3f01461cf2d>>();
+	};
+		// finalize_c3c5209a4f439e79
+		aotLib[0x2a4711f999207461] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_17_47_3 &  ),&finalize_c3c5209a4f439e79>>();
+	};
+		// finalize_565ba0bfa200266c
+		aotLib[0x8bec60b6725e15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_17_78_4 &  ),&finalize_565ba0bfa200266c>>();
+	};
+		// finalize_6cd1a9fab31e9614
+		aotLib[0x9e29e4b4b993649d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_6 &  ),&finalize_6cd1a9fab31e9614>>();
+	};
+		// finalize_5ae5083f56453efa
+		aotLib[0x252ad73bc644e839] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_12_5 &  ),&finalize_5ae5083f56453efa>>();
+	};
+		// _Funcfunctional_0x60_filter_dd04023fc297a5a9
+		aotLib[0x6f3d12f94e47f5f4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_dd04023fc297a5a9>>();
+	};
+		// _Funcfunctional_0x60_filter_any_1c710a5b8757d07c
+		aotLib[0x7681ccff27cdddee] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_1c710a5b8757d07c>>();
+	};
+		// _Funcfunctional_0x60_map_478dab29ef056fb6
+		aotLib[0x6f4aa07205159269] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((int32_t,int32_t)) const   ),&_Funcfunctional_0x60_map_478dab29ef056fb6>>();
+	};
+		// _Funcfunctional_0x60_map_any_11bdc1cb8443f4d0
+		aotLib[0x99247230f3cb9b60] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((int32_t,int32_t))  ),&_Funcfunctional_0x60_map_any_11bdc1cb8443f4d0>>();
+	};
+		// _Funcfunctional_0x60_reduce_cb178b30ab4da07
+		aotLib[0x7a1f362e14b04308] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_cb178b30ab4da07>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_6c02eae7c8fa51a7
+		aotLib[0xb518e2774a5238d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_any_6c02eae7c8fa51a7>>();
+	};
+		// pipeline_ded6b8877c8236d9
+		aotLib[0x75859e84f149abd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  &  ),&pipeline_ded6b8877c8236d9>>();
+	};
+		// pipeline_fused_3fb2e876bb9bc870
+		aotLib[0x79de85050edaa83f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  &  ),&pipeline_fused_3fb2e876bb9bc870>>();
+	};
+		// test_65667982604edc43
+		aotLib[0x61f7511f7f91f892] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_65667982604edc43>>();
+	};
+		// [[ init script ]]
+		aotLib[0x655f8e78b84d7dc8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
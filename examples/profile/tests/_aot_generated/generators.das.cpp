@@ -0,0 +1,838 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require functional
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__2073cac9;
+extern StructInfo __struct_info__588329fd;
+extern StructInfo __struct_info__406acfc0;
+extern StructInfo __struct_info__ce73aa07;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__989c6bad;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__100f1dc6;
+extern TypeInfo __type_info__e6eb2af7;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__b1b9f91f;
+extern TypeInfo __type_info__3c561e30;
+extern TypeInfo __type_info__f0838b45;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__90568f79;
+extern TypeInfo __type_info__4a24bcc8;
+extern TypeInfo __type_info__aee6cd01;
+extern VarInfo __var_info__ec3f48d3;
+extern VarInfo __var_info__bdff04c2;
+extern VarInfo __var_info__429505ae;
+extern VarInfo __var_info__664e787a;
+extern VarInfo __var_info__b5ef5084;
+extern VarInfo __var_info__342023a7;
+extern VarInfo __var_info__d2a89f03;
+extern VarInfo __var_info__2b5f5247;
+extern VarInfo __var_info__41658230;
+extern VarInfo __var_info__eef6f7d2;
+extern VarInfo __var_info__6c23d5d1;
+extern VarInfo __var_info__7fc05cb6;
+extern VarInfo __var_info__932fd369;
+extern VarInfo __var_info__45c4a927;
+extern VarInfo __var_info__91430be6;
+extern VarInfo __var_info__b6db1b23;
+extern VarInfo __var_info__47fded52;
+extern VarInfo __var_info__261c84c2;
+extern VarInfo __var_info__62afdaa1;
+extern VarInfo __var_info__beb72672;
+extern VarInfo __var_info__ebc291b2;
+extern VarInfo __var_info__9e494efa;
+extern VarInfo __var_info__ce6336d2;
+extern VarInfo __var_info__301da724;
+extern FuncInfo __func_info__9c1ebcad;
+extern FuncInfo __func_info__2c47cca3;
+extern FuncInfo __func_info__7525326e;
+
+TypeInfo * __type_info__261c84c2_arg_types_var_544459465[2] = { &__type_info__90568f79, &__type_info__359c1b32 };
+VarInfo __struct_info__2073cac9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, (TypeInfo **)__type_info__261c84c2_arg_types_var_544459465, nullptr, 2, 0, nullptr, 28, 0x261c84c2, "__lambda", 0 };
+TypeInfo * __type_info__2b5f5247_arg_types_var_544459465[1] = { &__type_info__aee6cd01 };
+VarInfo __struct_info__2073cac9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2b5f5247_arg_types_var_544459465, nullptr, 1, 0, nullptr, 28, 0x2b5f5247, "__finalize", 4 };
+VarInfo * __struct_info__2073cac9_fields[2] =  { &__struct_info__2073cac9_field_0, &__struct_info__2073cac9_field_1 };
+StructInfo __struct_info__2073cac9 = {"_lambda_thismodule_29_22_3", __struct_info__2073cac9_fields, 2, 8, -1, nullptr, 0x2073cac9 };
+TypeInfo * __type_info__91430be6_arg_types_var_1484990973[2] = { &__type_info__989c6bad, &__type_info__e6eb6b88 };
+VarInfo __struct_info__588329fd_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__91430be6_arg_types_var_1484990973, nullptr, 2, 0, nullptr, 28, 0x91430be6, "__lambda", 0 };
+TypeInfo * __type_info__ec3f48d3_arg_types_var_1484990973[1] = { &__type_info__f0838b45 };
+VarInfo __struct_info__588329fd_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ec3f48d3_arg_types_var_1484990973, nullptr, 1, 0, nullptr, 28, 0xec3f48d3, "__finalize", 4 };
+VarInfo __struct_info__588329fd_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x47fded52, "__yield", 8 };
+TypeInfo * __type_info__664e787a_arg_types_var_1484990973[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__588329fd_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__664e787a_arg_types_var_1484990973, nullptr, 1, 0, nullptr, 0, 0x664e787a, "blk", 16 };
+VarInfo __struct_info__588329fd_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x342023a7, "src", 24 };
+VarInfo __struct_info__588329fd_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x9e494efa, "_loop_at_9", 32 };
+VarInfo __struct_info__588329fd_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x429505ae, "_source_0_at_9", 40 };
+VarInfo __struct_info__588329fd_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xb5ef5084, "w", 48 };
+VarInfo __struct_info__588329fd_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xebc291b2, "_pvar_0_at_9", 56 };
+VarInfo * __struct_info__588329fd_fields[9] =  { &__struct_info__588329fd_field_0, &__struct_info__588329fd_field_1, &__struct_info__588329fd_field_2, &__struct_info__588329fd_field_3, &__struct_info__588329fd_field_4, &__struct_info__588329fd_field_5, &__struct_info__588329fd_field_6, &__struct_info__588329fd_field_7, &__struct_info__588329fd_field_8 };
+StructInfo __struct_info__588329fd = {"_lambda_thismodule_9_12_2", __struct_info__588329fd_fields, 9, 64, -1, nullptr, 0x588329fd };
+TypeInfo * __type_info__62afdaa1_arg_types_var_1080741824[2] = { &__type_info__3c561e30, &__type_info__100f1dc6 };
+VarInfo __struct_info__406acfc0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__62afdaa1_arg_types_var_1080741824, nullptr, 2, 0, nullptr, 28, 0x62afdaa1, "__lambda", 0 };
+TypeInfo * __type_info__41658230_arg_types_var_1080741824[1] = { &__type_info__4a24bcc8 };
+VarInfo __struct_info__406acfc0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__41658230_arg_types_var_1080741824, nullptr, 1, 0, nullptr, 28, 0x41658230, "__finalize", 4 };
+VarInfo __struct_info__406acfc0_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x45c4a927, "__yield", 8 };
+TypeInfo * __type_info__d2a89f03_arg_types_var_1080741824[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__406acfc0_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, (TypeInfo **)__type_info__d2a89f03_arg_types_var_1080741824, nullptr, 1, 0, nullptr, 0, 0xd2a89f03, "blk", 16 };
+VarInfo __struct_info__406acfc0_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xeef6f7d2, "src", 24 };
+VarInfo __struct_info__406acfc0_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xbeb72672, "_loop_at_31", 32 };
+VarInfo __struct_info__406acfc0_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x7fc05cb6, "_source_0_at_31", 40 };
+VarInfo __struct_info__406acfc0_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x932fd369, "w", 48 };
+VarInfo __struct_info__406acfc0_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xbdff04c2, "_pvar_0_at_31", 56 };
+VarInfo * __struct_info__406acfc0_fields[9] =  { &__struct_info__406acfc0_field_0, &__struct_info__406acfc0_field_1, &__struct_info__406acfc0_field_2, &__struct_info__406acfc0_field_3, &__struct_info__406acfc0_field_4, &__struct_info__406acfc0_field_5, &__struct_info__406acfc0_field_6, &__struct_info__406acfc0_field_7, &__struct_info__406acfc0_field_8 };
+StructInfo __struct_info__406acfc0 = {"_lambda_thismodule_31_12_4", __struct_info__406acfc0_fields, 9, 64, -1, nullptr, 0x406acfc0 };
+TypeInfo * __type_info__301da724_arg_types_var_3463686663[2] = { &__type_info__e6eb2af7, &__type_info__359c1b32 };
+VarInfo __struct_info__ce73aa07_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__301da724_arg_types_var_3463686663, nullptr, 2, 0, nullptr, 28, 0x301da724, "__lambda", 0 };
+TypeInfo * __type_info__6c23d5d1_arg_types_var_3463686663[1] = { &__type_info__b1b9f91f };
+VarInfo __struct_info__ce73aa07_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c23d5d1_arg_types_var_3463686663, nullptr, 1, 0, nullptr, 28, 0x6c23d5d1, "__finalize", 4 };
+VarInfo __struct_info__ce73aa07_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xb6db1b23, "mod", 8 };
+VarInfo * __struct_info__ce73aa07_fields[3] =  { &__struct_info__ce73aa07_field_0, &__struct_info__ce73aa07_field_1, &__struct_info__ce73aa07_field_2 };
+StructInfo __struct_info__ce73aa07 = {"_lambda_thismodule_28_25_1", __struct_info__ce73aa07_fields, 3, 12, -1, nullptr, 0xce73aa07 };
+VarInfo __func_info__9c1ebcad_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xce6336d2, "x", 0 };
+VarInfo * __func_info__9c1ebcad_fields[1] =  { &__func_info__9c1ebcad_field_0 };
+FuncInfo __func_info__9c1ebcad = {"invoke block<(x:int const):bool> const", "", __func_info__9c1ebcad_fields, 1, 32, &__type_info__c894953d, nullptr,0,0x9c1ebcad, 0x0 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+VarInfo __func_info__7525326e_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xce6336d2, "x", 0 };
+VarInfo * __func_info__7525326e_fields[1] =  { &__func_info__7525326e_field_0 };
+FuncInfo __func_info__7525326e = {"invoke block<(x:int const):string> const", "", __func_info__7525326e_fields, 1, 32, &__type_info__17c16538, nullptr,0,0x7525326e, 0x0 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x13667ab1 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__989c6bad = { Type::tStructure, &__struct_info__588329fd, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x989c6bad };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__100f1dc6 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 261, 0x100f1dc6 };
+TypeInfo __type_info__e6eb2af7 = { Type::tStructure, &__struct_info__ce73aa07, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xe6eb2af7 };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0xe6eb6b88 };
+TypeInfo __type_info__b1b9f91f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e6eb2af7, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb1b9f91f };
+TypeInfo __type_info__3c561e30 = { Type::tStructure, &__struct_info__406acfc0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3c561e30 };
+TypeInfo __type_info__f0838b45 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__989c6bad, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf0838b45 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__90568f79 = { Type::tStructure, &__struct_info__2073cac9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x90568f79 };
+TypeInfo __type_info__4a24bcc8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c561e30, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4a24bcc8 };
+TypeInfo __type_info__aee6cd01 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__90568f79, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xaee6cd01 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_4[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_5[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_6[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_7[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+namespace  {
+
+struct _lambda_thismodule_28_25_1 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_28_25_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_28_25_1 *)) __finalize;
+	int32_t mod;
+};
+static_assert(sizeof(_lambda_thismodule_28_25_1)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_25_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_25_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_25_1,mod)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_12_2 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_9_12_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_9_12_2 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_9;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_9;
+	int32_t w;
+	void * _pvar_0_at_9;
+};
+static_assert(sizeof(_lambda_thismodule_9_12_2)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_2,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_2,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_2,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_2,_loop_at_9)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_2,_source_0_at_9)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_2,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_2,_pvar_0_at_9)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_29_22_3 {
+	Func DAS_COMMENT((char *,struct _lambda_thismodule_29_22_3,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_29_22_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_29_22_3)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_29_22_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_29_22_3,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_4 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_4,char * &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_4 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((char *,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_31;
+	int32_t w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_4)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_4,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_4,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_4,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_4,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_4,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_4,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_4,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_4,_pvar_0_at_31)==56,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_28_25_1_0x60_finazlier_7af8d6a610c46dfa ( Context * __context__, struct _lambda_thismodule_28_25_1 * ____this_rename_at_28 );
+inline bool _Func_lambda_thismodule_28_25_1_0x60_function_8dca9be04c4836bf ( Context * __context__, struct _lambda_thismodule_28_25_1 & ____this_rename_at_28, int32_t __x_rename_at_28 );
+inline void _Func_lambda_thismodule_29_22_3_0x60_finazlier_f65f2b86545deee2 ( Context * __context__, struct _lambda_thismodule_29_22_3 * ____this_rename_at_29 );
+inline char * _Func_lambda_thismodule_29_22_3_0x60_function_aa342d51f0f4fdc6 ( Context * __context__, struct _lambda_thismodule_29_22_3 & ____this_rename_at_29, int32_t __x_rename_at_29 );
+inline void _Func_lambda_thismodule_31_12_4_0x60_finazlier_3fb80c461b2389fc ( Context * __context__, struct _lambda_thismodule_31_12_4 * ____this_rename_at_31 );
+inline bool _Func_lambda_thismodule_31_12_4_0x60_function_4d0fc08c80a5f6c2 ( Context * __context__, struct _lambda_thismodule_31_12_4 & ____this_rename_at_31, char * & ___yield_31_rename_at_31 );
+inline void _Func_lambda_thismodule_9_12_2_0x60_finazlier_d9d5c4223bb86382 ( Context * __context__, struct _lambda_thismodule_9_12_2 * ____this_rename_at_9 );
+inline bool _Func_lambda_thismodule_9_12_2_0x60_function_84a2c01e57edb3d0 ( Context * __context__, struct _lambda_thismodule_9_12_2 & ____this_rename_at_9, int32_t & ___yield_9_rename_at_9 );
+inline TArray<int32_t> _Func_0x60_filter_a_a35a0ecd329db747 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_18, Block DAS_COMMENT((bool,int32_t)) const  & __blk_rename_at_18 );
+inline TArray<char *> _Func_0x60_map_a_91f4129245e8a5b8 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_11, Block DAS_COMMENT((char *,int32_t)) const  & __blk_rename_at_11 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_53ccff887674360c ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_353 );
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_c21edea77a12a033 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_353 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_328 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> & __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline TArray<int32_t> each_a_b2375ff9428e0fe7 ( Context * __context__, range __r_rename_at_4 );
+inline void finalize_f94c41bed51a4305 ( Context * __context__, struct _lambda_thismodule_28_25_1 & ____this_rename_at_28 );
+inline void finalize_e1706409876a0e93 ( Context * __context__, struct _lambda_thismodule_29_22_3 & ____this_rename_at_29 );
+inline void finalize_1b7671264010290a ( Context * __context__, struct _lambda_thismodule_31_12_4 & ____this_rename_at_31 );
+inline void finalize_f815f191caafc037 ( Context * __context__, struct _lambda_thismodule_9_12_2 & ____this_rename_at_9 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_29a3b3a7512b71f5 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_20, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_20 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_4299366f33da7b43 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_6, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_6 );
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_db6357cf1138ac4c ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_46, Lambda DAS_COMMENT((char *,int32_t)) const  __blk_rename_at_46 );
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_any_dee3f5649c774dd6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_28, Lambda DAS_COMMENT((char *,int32_t)) __blk_rename_at_28 );
+inline char * const  _Funcstrings_boost_0x60_join_7a2ff2ee78269e80 ( Context * __context__, TArray<char *> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_472340ee08c232e4 ( Context * __context__, Sequence DAS_COMMENT((char *)) const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline bool test_c2a8bd16f4ad65c7 ( Context * __context__ );
+inline char * const  testArr_980887a3021066c4 ( Context * __context__, int32_t __total_rename_at_33, int32_t __mod_rename_at_33 );
+inline char * const  testGen_bd3817bca9d0e2bd ( Context * __context__, int32_t __total_rename_at_25, int32_t __mod_rename_at_25 );
+inline char * const  testLoop_e69bcc5fa948e72c ( Context * __context__, int32_t __total_rename_at_43, int32_t __mod_rename_at_43 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_28_25_1_0x60_finazlier_7af8d6a610c46dfa ( Context * __context__, struct _lambda_thismodule_28_25_1 * ____this_rename_at_28 )
+{
+	finalize_f94c41bed51a4305(__context__,das_arg<struct _lambda_thismodule_28_25_1>::pass(das_deref(__context__,____this_rename_at_28)));
+	das_delete_lambda_struct<struct _lambda_thismodule_28_25_1 *>::clear(__context__,____this_rename_at_28);
+}
+
+inline bool _Func_lambda_thismodule_28_25_1_0x60_function_8dca9be04c4836bf ( Context * __context__, struct _lambda_thismodule_28_25_1 &  ____this_rename_at_28, int32_t __x_rename_at_28 )
+{
+	return (SimPolicy<int32_t>::Mod(__x_rename_at_28,____this_rename_at_28.mod,*__context__)) == 0;
+}
+
+inline void _Func_lambda_thismodule_29_22_3_0x60_finazlier_f65f2b86545deee2 ( Context * __context__, struct _lambda_thismodule_29_22_3 * ____this_rename_at_29 )
+{
+	finalize_e1706409876a0e93(__context__,das_arg<struct _lambda_thismodule_29_22_3>::pass(das_deref(__context__,____this_rename_at_29)));
+	das_delete_lambda_struct<struct _lambda_thismodule_29_22_3 *>::clear(__context__,____this_rename_at_29);
+}
+
+inline char * _Func_lambda_thismodule_29_22_3_0x60_function_aa342d51f0f4fdc6 ( Context * __context__, struct _lambda_thismodule_29_22_3 &  ____this_rename_at_29, int32_t __x_rename_at_29 )
+{
+	return das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(__x_rename_at_29)));
+}
+
+inline void _Func_lambda_thismodule_31_12_4_0x60_finazlier_3fb80c461b2389fc ( Context * __context__, struct _lambda_thismodule_31_12_4 * ____this_rename_at_31 )
+{
+	finalize_1b7671264010290a(__context__,das_arg<struct _lambda_thismodule_31_12_4>::pass(das_deref(__context__,____this_rename_at_31)));
+	das_delete_lambda_struct<struct _lambda_thismodule_31_12_4 *>::clear(__context__,____this_rename_at_31);
+}
+
+inline bool _Func_lambda_thismodule_31_12_4_0x60_function_4d0fc08c80a5f6c2 ( Context * __context__, struct _lambda_thismodule_31_12_4 &  ____this_rename_at_31, char * & ___yield_31_rename_at_31 )
+{
+	switch (____this_rename_at_31.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_31._loop_at_31,true);
+	das_move(____this_rename_at_31._source_0_at_31,____this_rename_at_31.src);
+	memset(&(____this_rename_at_31.w), 0, 4);
+	das_copy(____this_rename_at_31._pvar_0_at_31,das_ref(__context__,____this_rename_at_31.w));
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_31._loop_at_31 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_31_rename_at_31,das_invoke_lambda<char *>::invoke<int32_t>(__context__,____this_rename_at_31.blk,____this_rename_at_31.w));
+	das_copy(____this_rename_at_31.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_9_12_2_0x60_finazlier_d9d5c4223bb86382 ( Context * __context__, struct _lambda_thismodule_9_12_2 * ____this_rename_at_9 )
+{
+	finalize_f815f191caafc037(__context__,das_arg<struct _lambda_thismodule_9_12_2>::pass(das_deref(__context__,____this_rename_at_9)));
+	das_delete_lambda_struct<struct _lambda_thismodule_9_12_2 *>::clear(__context__,____this_rename_at_9);
+}
+
+inline bool _Func_lambda_thismodule_9_12_2_0x60_function_84a2c01e57edb3d0 ( Context * __context__, struct _lambda_thismodule_9_12_2 &  ____this_rename_at_9, int32_t & ___yield_9_rename_at_9 )
+{
+	switch (____this_rename_at_9.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_9._loop_at_9,true);
+	das_move(____this_rename_at_9._source_0_at_9,____this_rename_at_9.src);
+	memset(&(____this_rename_at_9.w), 0, 4);
+	das_copy(____this_rename_at_9._pvar_0_at_9,das_ref(__context__,____this_rename_at_9.w));
+	DAS_SETBOOLAND((____this_rename_at_9._loop_at_9),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_9._loop_at_9 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,____this_rename_at_9.blk,____this_rename_at_9.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_9_rename_at_9,____this_rename_at_9.w);
+	das_copy(____this_rename_at_9.__yield,1);
+	return true;
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_9._loop_at_9),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__);
+	return false;
+}
+
+inline TArray<int32_t> _Func_0x60_filter_a_a35a0ecd329db747 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_18, Block DAS_COMMENT((bool,int32_t)) const  &  __blk_rename_at_18 )
+{
+	TArray<int32_t> __a_rename_at_19; das_zero(__a_rename_at_19);
+	{
+		bool __need_loop_20 = true;
+		// x : int aka TT const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_18);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) )
+		{
+			if ( das_invoke<bool>::invoke<int32_t>(__context__,__blk_rename_at_18,(*__x_rename_at_20)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_19),(*__x_rename_at_20),-1);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+	};
+	return /* <- */ __a_rename_at_19;
+}
+
+inline TArray<char *> _Func_0x60_map_a_91f4129245e8a5b8 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_11, Block DAS_COMMENT((char *,int32_t)) const  &  __blk_rename_at_11 )
+{
+	TArray<char *> __a_rename_at_12; das_zero(__a_rename_at_12);
+	_Funcbuiltin_0x60_reserve_cecea833d1e66117(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_12),builtin_array_size(__src_rename_at_11));
+	{
+		bool __need_loop_14 = true;
+		// x : int aka TT const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_11);
+		int32_t const  * __x_rename_at_14;
+		__need_loop_14 = __x_iterator.first(__context__,(__x_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __x_iterator.next(__context__,(__x_rename_at_14)) )
+		{
+			_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_12),das_invoke<char *>::invoke<int32_t>(__context__,__blk_rename_at_11,(*__x_rename_at_14)),-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_14));
+	};
+	return /* <- */ __a_rename_at_12;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_53ccff887674360c ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_353 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_355; das_zero(__it_rename_at_355);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_355),__lam_rename_at_353,__context__);
+	return /* <- */ __it_rename_at_355;
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_c21edea77a12a033 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_353 )
+{
+	Sequence DAS_COMMENT((char *)) __it_rename_at_355; das_zero(__it_rename_at_355);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_355),__lam_rename_at_353,__context__);
+	return /* <- */ __it_rename_at_355;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_328 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_329; das_zero(__it_rename_at_329);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_329),__rng_rename_at_328,__context__);
+	return /* <- */ __it_rename_at_329;
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_280),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_280),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> &  __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<char *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<char *>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,8,__context__);
+}
+
+inline TArray<int32_t> each_a_b2375ff9428e0fe7 ( Context * __context__, range __r_rename_at_4 )
+{
+	TArray<int32_t> __a_rename_at_5; das_zero(__a_rename_at_5);
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_5),v_extract_yi(v_cast_vec4i(__r_rename_at_4)) /*y*/ - v_extract_xi(v_cast_vec4i(__r_rename_at_4)) /*x*/);
+	{
+		bool __need_loop_7 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(__r_rename_at_4);
+		int32_t __x_rename_at_7;
+		__need_loop_7 = __x_iterator.first(__context__,(__x_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __x_iterator.next(__context__,(__x_rename_at_7)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_5),__x_rename_at_7,-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_7));
+	};
+	return /* <- */ __a_rename_at_5;
+}
+
+inline void finalize_f94c41bed51a4305 ( Context * __context__, struct _lambda_thismodule_28_25_1 &  ____this_rename_at_28 )
+{
+	memset(&(____this_rename_at_28), 0, 12);
+}
+
+inline void finalize_e1706409876a0e93 ( Context * __context__, struct _lambda_thismodule_29_22_3 &  ____this_rename_at_29 )
+{
+	memset(&(____this_rename_at_29), 0, 8);
+}
+
+inline void finalize_1b7671264010290a ( Context * __context__, struct _lambda_thismodule_31_12_4 &  ____this_rename_at_31 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),__context__);
+	memset(&(____this_rename_at_31), 0, 64);
+}
+
+inline void finalize_f815f191caafc037 ( Context * __context__, struct _lambda_thismodule_9_12_2 &  ____this_rename_at_9 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),__context__);
+	memset(&(____this_rename_at_9), 0, 64);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_29a3b3a7512b71f5 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_20, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_20 )
+{
+	return /* <- */ _Funcfunctional_0x60_filter_any_4299366f33da7b43(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_20),__blk_rename_at_20);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_4299366f33da7b43 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_6, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_6 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_53ccff887674360c(__context__,das_ascend<bool,struct _lambda_thismodule_9_12_2>::make(__context__,&__type_info__989c6bad,(([&]() -> struct _lambda_thismodule_9_12_2 {
+		struct _lambda_thismodule_9_12_2 __mks_8;
+		das_zero(__mks_8);
+		das_copy((__mks_8.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_12_2`function _lambda_thismodule_9_12_2 int#ref*/ 835738678u))));
+		das_copy((__mks_8.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_12_2`finazlier #ptr#_lambda_thismodule_9_12_2#explicit*/ 4005204054u))));
+		das_move((__mks_8.blk),(__blk_rename_at_6));
+		das_move((__mks_8.src),(__src_rename_at_6));
+		return __mks_8;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_db6357cf1138ac4c ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_46, Lambda DAS_COMMENT((char *,int32_t)) const  __blk_rename_at_46 )
+{
+	return /* <- */ _Funcfunctional_0x60_map_any_dee3f5649c774dd6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_46),__blk_rename_at_46);
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_any_dee3f5649c774dd6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_28, Lambda DAS_COMMENT((char *,int32_t)) __blk_rename_at_28 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_c21edea77a12a033(__context__,das_ascend<bool,struct _lambda_thismodule_31_12_4>::make(__context__,&__type_info__3c561e30,(([&]() -> struct _lambda_thismodule_31_12_4 {
+		struct _lambda_thismodule_31_12_4 __mks_30;
+		das_zero(__mks_30);
+		das_copy((__mks_30.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_4`function _lambda_thismodule_31_12_4 string#ref*/ 2305365596u))));
+		das_copy((__mks_30.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_4`finazlier #ptr#_lambda_thismodule_31_12_4#explicit*/ 2673279778u))));
+		das_move((__mks_30.blk),(__blk_rename_at_28));
+		das_move((__mks_30.src),(__src_rename_at_28));
+		return __mks_30;
+	})())));
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_7a2ff2ee78269e80 ( Context * __context__, TArray<char *> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : string const&
+			das_iterator<TArray<char *> const > __elem_iterator(__it_rename_at_16);
+			char * const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__))));
+	return __st_rename_at_21;
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_472340ee08c232e4 ( Context * __context__, Sequence DAS_COMMENT((char *)) const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : string const
+			das_iterator<Sequence DAS_COMMENT((char *)) const > __elem_iterator(__it_rename_at_16);
+			char * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__elem_rename_at_23)));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__))));
+	return __st_rename_at_21;
+}
+
+inline bool test_c2a8bd16f4ad65c7 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	char * __s1_rename_at_57 = 0; char * __s2_rename_at_57 = 0; char * __s3_rename_at_57 = 0;
+	builtin_profile(40,((char *) "testLoop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__s1_rename_at_57,testLoop_e69bcc5fa948e72c(__context__,1000000,99961));
+	}),__context__);
+	builtin_profile(40,((char *) "testGen"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__s2_rename_at_57,testGen_bd3817bca9d0e2bd(__context__,1000000,99961));
+	}),__context__);
+	builtin_profile(40,((char *) "testArr"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__s3_rename_at_57,testArr_980887a3021066c4(__context__,1000000,99961));
+	}),__context__);
+	DAS_ASSERT((((SimPolicy<char *>::Equ(cast<char *>::from(__s1_rename_at_57),cast<char *>::from(__s2_rename_at_57),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__s1_rename_at_57),cast<char *>::from(__s3_rename_at_57),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(__s2_rename_at_57),cast<char *>::from(__s3_rename_at_57),*__context__))));
+	return true;
+}}
+
+inline char * const  testArr_980887a3021066c4 ( Context * __context__, int32_t __total_rename_at_33, int32_t __mod_rename_at_33 ) { das_stack_prologue __prologue(__context__,256,"testArr " DAS_FILE_LINE);
+{
+	TArray<int32_t> __a1_rename_at_34; memset(&__a1_rename_at_34,0,sizeof(__a1_rename_at_34));
+	TArray<int32_t> __a2_rename_at_35; memset(&__a2_rename_at_35,0,sizeof(__a2_rename_at_35));
+	TArray<char *> __a3_rename_at_36; memset(&__a3_rename_at_36,0,sizeof(__a3_rename_at_36));
+/* finally */ auto __finally_34= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a1_rename_at_34));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a2_rename_at_35));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__a3_rename_at_36));
+/* end finally */ });
+	__a1_rename_at_34; das_zero(__a1_rename_at_34); das_move(__a1_rename_at_34, each_a_b2375ff9428e0fe7(__context__,range(0,__total_rename_at_33)));
+	__a2_rename_at_35; das_zero(__a2_rename_at_35); das_move(__a2_rename_at_35, _Func_0x60_filter_a_a35a0ecd329db747(__context__,das_arg<TArray<int32_t>>::pass(__a1_rename_at_34),das_make_block<bool,int32_t>(__context__,144,0,&__func_info__9c1ebcad,[&](int32_t const  __x_rename_at_35)->bool{
+		return (SimPolicy<int32_t>::Mod(__x_rename_at_35,__mod_rename_at_33,*__context__)) == 0;
+	})));
+	__a3_rename_at_36; das_zero(__a3_rename_at_36); das_move(__a3_rename_at_36, _Func_0x60_map_a_91f4129245e8a5b8(__context__,das_arg<TArray<int32_t>>::pass(__a2_rename_at_35),das_make_block<char *,int32_t>(__context__,240,0,&__func_info__7525326e,[&](int32_t const  __x_rename_at_36)->char *{
+		return das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_5, cast<int32_t>::from(__x_rename_at_36)));
+	})));
+	return _Funcstrings_boost_0x60_join_7a2ff2ee78269e80(__context__,das_arg<TArray<char *>>::pass(__a3_rename_at_36),((char *) ","));
+}}
+
+inline char * const  testGen_bd3817bca9d0e2bd ( Context * __context__, int32_t __total_rename_at_25, int32_t __mod_rename_at_25 )
+{
+	Sequence DAS_COMMENT((char *)) _temp_make_local_29_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_28_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_27_64;
+	return _Funcstrings_boost_0x60_join_472340ee08c232e4(__context__,das_arg<Sequence DAS_COMMENT((char *))>::pass((_temp_make_local_29_32 = (_Funcfunctional_0x60_map_db6357cf1138ac4c(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_28_48 = (_Funcfunctional_0x60_filter_29a3b3a7512b71f5(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_27_64 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,__total_rename_at_25))))),das_ascend<bool,struct _lambda_thismodule_28_25_1>::make(__context__,&__type_info__e6eb2af7,(([&]() -> struct _lambda_thismodule_28_25_1 {
+		struct _lambda_thismodule_28_25_1 __mks_28;
+		das_copy((__mks_28.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_28_25_1`function _lambda_thismodule_28_25_1 int#const*/ 21626728u))));
+		das_copy((__mks_28.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_28_25_1`finazlier #ptr#_lambda_thismodule_28_25_1#explicit*/ 2219428182u))));
+		das_copy((__mks_28.mod),(__mod_rename_at_25));
+		return __mks_28;
+	})())))))),das_ascend<char *,struct _lambda_thismodule_29_22_3>::make(__context__,&__type_info__90568f79,(([&]() -> struct _lambda_thismodule_29_22_3 {
+		struct _lambda_thismodule_29_22_3 __mks_29;
+		das_copy((__mks_29.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_29_22_3`function _lambda_thismodule_29_22_3 int#const*/ 525847120u))));
+		das_copy((__mks_29.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_29_22_3`finazlier #ptr#_lambda_thismodule_29_22_3#explicit*/ 2472563846u))));
+		return __mks_29;
+	})())))))),((char *) ","));
+}
+
+inline char * const  testLoop_e69bcc5fa948e72c ( Context * __context__, int32_t __total_rename_at_43, int32_t __mod_rename_at_43 )
+{
+	char * __st_rename_at_44 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_44)->void{
+		bool __skip_first_rename_at_45 = true;
+		{
+			bool __need_loop_46 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(range(0,__total_rename_at_43));
+			int32_t __t_rename_at_46;
+			__need_loop_46 = __t_iterator.first(__context__,(__t_rename_at_46)) && __need_loop_46;
+			for ( ; __need_loop_46 ; __need_loop_46 = __t_iterator.next(__context__,(__t_rename_at_46)) )
+			{
+				if ( (SimPolicy<int32_t>::Mod(__t_rename_at_46,__mod_rename_at_43,*__context__)) == 0 )
+				{
+					if ( __skip_first_rename_at_45 )
+					{
+						das_copy(__skip_first_rename_at_45,false);
+					} else {
+						das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_6,cast<StringBuilderWriter &>::from(__writer_rename_at_44),cast<char * const >::from(((char *) ","))));
+					};
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_7,cast<StringBuilderWriter &>::from(__writer_rename_at_44),cast<char *>::from(((char *)(das_lexical_cast(__t_rename_at_46,__context__))))));
+				};
+			}
+			__t_iterator.close(__context__,(__t_rename_at_46));
+		};
+	},__context__))));
+	return __st_rename_at_44;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_28_25_1_0x60_finazlier_7af8d6a610c46dfa
+		aotLib[0xd9923cd2f532dd66] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_28_25_1 *  ),&_Func_lambda_thismodule_28_25_1_0x60_finazlier_7af8d6a610c46dfa>>();
+	};
+		// _Func_lambda_thismodule_28_25_1_0x60_function_8dca9be04c4836bf
+		aotLib[0xcc6a94dbdcf55e8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_28_25_1 & , int32_t  ),&_Func_lambda_thismodule_28_25_1_0x60_function_8dca9be04c4836bf>>();
+	};
+		// _Func_lambda_thismodule_29_22_3_0x60_finazlier_f65f2b86545deee2
+		aotLib[0x6331fba0aacaa799] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_29_22_3 *  ),&_Func_lambda_thismodule_29_22_3_0x60_finazlier_f65f2b86545deee2>>();
+	};
+		// _Func_lambda_thismodule_29_22_3_0x60_function_aa342d51f0f4fdc6
+		aotLib[0xd6dadcd24c146941] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, struct _lambda_thismodule_29_22_3 & , int32_t  ),&_Func_lambda_thismodule_29_22_3_0x60_function_aa342d51f0f4fdc6>>();
+	};
+		// _Func_lambda_thismodule_31_12_4_0x60_finazlier_3fb80c461b2389fc
+		aotLib[0xe9bbef1c302521ba] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_4 *  ),&_Func_lambda_thismodule_31_12_4_0x60_finazlier_3fb80c461b2389fc>>();
+	};
+		// _Func_lambda_thismodule_31_12_4_0x60_function_4d0fc08c80a5f6c2
+		aotLib[0x991377f9b63b7d0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_31_12_4 & , char * &  ),&_Func_lambda_thismodule_31_12_4_0x60_function_4d0fc08c80a5f6c2>>();
+	};
+		// _Func_lambda_thismodule_9_12_2_0x60_finazlier_d9d5c4223bb86382
+		aotLib[0x1068071d235672e0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_12_2 *  ),&_Func_lambda_thismodule_9_12_2_0x60_finazlier_d9d5c4223bb86382>>();
+	};
+		// _Func_lambda_thismodule_9_12_2_0x60_function_84a2c01e57edb3d0
+		aotLib[0x8e10d7d4875c4335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_9_12_2 & , int32_t &  ),&_Func_lambda_thismodule_9_12_2_0x60_function_84a2c01e57edb3d0>>();
+	};
+		// _Func_0x60_filter_a_a35a0ecd329db747
+		aotLib[0xeed9db4edaa0eede] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  & , Block DAS_COMMENT((bool,int32_t)) const  &  ),&_Func_0x60_filter_a_a35a0ecd329db747>>();
+	};
+		// _Func_0x60_map_a_91f4129245e8a5b8
+		aotLib[0x63fc468984191b2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TArray<int32_t> const  & , Block DAS_COMMENT((char *,int32_t)) const  &  ),&_Func_0x60_map_a_91f4129245e8a5b8>>();
+	};
+		// _Funcbuiltin_0x60_each_53ccff887674360c
+		aotLib[0x33b53dc307e70da5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_53ccff887674360c>>();
+	};
+		// _Funcbuiltin_0x60_each_c21edea77a12a033
+		aotLib[0xcc8312206219435d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const   ),&_Funcbuiltin_0x60_each_c21edea77a12a033>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_push_dbe8c61ce24eace2
+		aotLib[0xe7e1aae867aed505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_dbe8c61ce24eace2>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_reserve_cecea833d1e66117
+		aotLib[0x58482c2f23d3c0ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_cecea833d1e66117>>();
+	};
+		// each_a_b2375ff9428e0fe7
+		aotLib[0xe7247ccb318557] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, range  ),&each_a_b2375ff9428e0fe7>>();
+	};
+		// finalize_f94c41bed51a4305
+		aotLib[0x69916fbd96421fb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_28_25_1 &  ),&finalize_f94c41bed51a4305>>();
+	};
+		// finalize_e1706409876a0e93
+		aotLib[0x4ade1653eda56265] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_29_22_3 &  ),&finalize_e1706409876a0e93>>();
+	};
+		// finalize_1b7671264010290a
+		aotLib[0x9242e342f9a248a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_4 &  ),&finalize_1b7671264010290a>>();
+	};
+		// finalize_f815f191caafc037
+		aotLib[0x4acb506bb17671d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_12_2 &  ),&finalize_f815f191caafc037>>();
+	};
+		// _Funcfunctional_0x60_filter_29a3b3a7512b71f5
+		aotLib[0xf00f31c7ab220bf0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_29a3b3a7512b71f5>>();
+	};
+		// _Funcfunctional_0x60_filter_any_4299366f33da7b43
+		aotLib[0xb3f8e17054c73ce7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_4299366f33da7b43>>();
+	};
+		// _Funcfunctional_0x60_map_db6357cf1138ac4c
+		aotLib[0x972caad61b208da7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((char *,int32_t)) const   ),&_Funcfunctional_0x60_map_db6357cf1138ac4c>>();
+	};
+		// _Funcfunctional_0x60_map_any_dee3f5649c774dd6
+		aotLib[0xf8d34b103fff8c0b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((char *,int32_t))  ),&_Funcfunctional_0x60_map_any_dee3f5649c774dd6>>();
+	};
+		// _Funcstrings_boost_0x60_join_7a2ff2ee78269e80
+		aotLib[0x45ed9715bedb8659] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<char *> const  & , char * const   ),&_Funcstrings_boost_0x60_join_7a2ff2ee78269e80>>();
+	};
+		// _Funcstrings_boost_0x60_join_472340ee08c232e4
+		aotLib[0x1fa25fbc06194285] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, Sequence DAS_COMMENT((char *)) const  & , char * const   ),&_Funcstrings_boost_0x60_join_472340ee08c232e4>>();
+	};
+		// test_c2a8bd16f4ad65c7
+		aotLib[0x74a44b38f3d961a4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c2a8bd16f4ad65c7>>();
+	};
+		// testArr_980887a3021066c4
+		aotLib[0x78f38fcd192f7dba] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, int32_t , int32_t  ),&testArr_980887a3021066c4>>();
+	};
+		// testGen_bd3817bca9d0e2bd
+		aotLib[0xb52a17568f297ebf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, int32_t , int32_t  ),&testGen_bd3817bca9d0e2bd>>();
+	};
+		// testLoop_e69bcc5fa948e72c
+		aotLib[0x96206677e0b7985] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, int32_t , int32_t  ),&testLoop_e69bcc5fa948e72c>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
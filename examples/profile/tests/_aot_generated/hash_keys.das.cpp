@@ -0,0 +1,361 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__5292e0fc;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__8d89c7fa;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__e202bb6e;
+extern VarInfo __var_info__e302bd01;
+extern VarInfo __var_info__e102b9db;
+extern VarInfo __var_info__e402be94;
+extern FuncInfo __func_info__2c47cca3;
+
+VarInfo __struct_info__5292e0fc_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe102b9db, "a", 0 };
+VarInfo __struct_info__5292e0fc_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe202bb6e, "b", 4 };
+VarInfo __struct_info__5292e0fc_field_2 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe302bd01, "c", 8 };
+VarInfo __struct_info__5292e0fc_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe402be94, "d", 12 };
+VarInfo * __struct_info__5292e0fc_fields[4] =  { &__struct_info__5292e0fc_field_0, &__struct_info__5292e0fc_field_1, &__struct_info__5292e0fc_field_2, &__struct_info__5292e0fc_field_3 };
+StructInfo __struct_info__5292e0fc = {"Key", __struct_info__5292e0fc_fields, 4, 16, -1, nullptr, 0x5292e0fc };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__8d89c7fa = { Type::tStructure, &__struct_info__5292e0fc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2366, 0x8d89c7fa };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_1[1] = { &__type_info__8d89c7fa };
+TypeInfo * __tinfo_2[1] = { &__type_info__8d89c7fa };
+namespace  {
+
+struct Key {
+	int32_t a;
+	int32_t b;
+	float c;
+	int32_t d;
+};
+static_assert(sizeof(Key)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Key,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Key,b)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Key,c)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Key,d)==12,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_finalize_90813738a6285d25 ( Context * __context__, TArray<struct Key> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_287 );
+inline void _Funcbuiltin_0x60_finalize_b80ec54858224d1b ( Context * __context__, TTable<uint32_t,int32_t> & __a_rename_at_287 );
+inline bool _Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_178, char * const  __at_rename_at_178 );
+inline bool _Funcbuiltin_0x60_key_exists_b75961c07a8f34ad ( Context * __context__, TTable<uint32_t,int32_t> const  & __Tab_rename_at_178, uint32_t __at_rename_at_178 );
+inline void _Funcbuiltin_0x60_resize_8b10ec6c8ae14fd1 ( Context * __context__, TArray<struct Key> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void finalize_41e0b23c7b8337cc ( Context * __context__, struct Key & ____this_rename_at_4 );
+inline void make_strings_91e2ee8ea0e29705 ( Context * __context__, TArray<char *> & __src_rename_at_10 );
+inline int32_t string_table_c1d29ecf03c68ec3 ( Context * __context__, TTable<char *,int32_t> & __tab_rename_at_15, TArray<char *> const  & __src_rename_at_15 );
+inline int32_t struct_table_53258ed70a3c91a9 ( Context * __context__, TTable<uint32_t,int32_t> & __tab_rename_at_25, TArray<struct Key> const  & __src_rename_at_25 );
+inline bool test_e17eb82e7ff7f321 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_90813738a6285d25 ( Context * __context__, TArray<struct Key> &  __a_rename_at_280 )
+{
+	{
+		bool __need_loop_282 = true;
+		// aV : Key aka TT&
+		das_iterator<TArray<struct Key>> __aV_iterator(__a_rename_at_280);
+		struct Key * __aV_rename_at_282;
+		__need_loop_282 = __aV_iterator.first(__context__,(__aV_rename_at_282)) && __need_loop_282;
+		for ( ; __need_loop_282 ; __need_loop_282 = __aV_iterator.next(__context__,(__aV_rename_at_282)) )
+		{
+			finalize_41e0b23c7b8337cc(__context__,das_arg<struct Key>::pass((*__aV_rename_at_282)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_282));
+	};
+	builtin_array_free(das_arg<TArray<struct Key>>::pass(__a_rename_at_280),16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_280),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_287 )
+{
+	builtin_table_free(das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_287),8,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_b80ec54858224d1b ( Context * __context__, TTable<uint32_t,int32_t> &  __a_rename_at_287 )
+{
+	builtin_table_free(das_arg<TTable<uint32_t,int32_t>>::pass(__a_rename_at_287),4,4,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_178, char * const  __at_rename_at_178 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_178,__at_rename_at_178);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_b75961c07a8f34ad ( Context * __context__, TTable<uint32_t,int32_t> const  &  __Tab_rename_at_178, uint32_t __at_rename_at_178 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_178,__at_rename_at_178);
+}
+
+inline void _Funcbuiltin_0x60_resize_8b10ec6c8ae14fd1 ( Context * __context__, TArray<struct Key> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct Key>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void finalize_41e0b23c7b8337cc ( Context * __context__, struct Key &  ____this_rename_at_4 )
+{
+	memset(&(____this_rename_at_4), 0, 16);
+}
+
+inline void make_strings_91e2ee8ea0e29705 ( Context * __context__, TArray<char *> &  __src_rename_at_10 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__src_rename_at_10),200000);
+	{
+		bool __need_loop_12 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,200000));
+		int32_t __i_rename_at_12;
+		__need_loop_12 = __i_iterator.first(__context__,(__i_rename_at_12)) && __need_loop_12;
+		for ( ; __need_loop_12 ; __need_loop_12 = __i_iterator.next(__context__,(__i_rename_at_12)) )
+		{
+			das_copy(__src_rename_at_10(__i_rename_at_12,__context__),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "some_longer_key_prefix_")), cast<int32_t>::from(__i_rename_at_12))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_12));
+	};
+}
+
+inline int32_t string_table_c1d29ecf03c68ec3 ( Context * __context__, TTable<char *,int32_t> &  __tab_rename_at_15, TArray<char *> const  &  __src_rename_at_15 )
+{
+	builtin_table_clear(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_15),__context__);
+	{
+		bool __need_loop_17 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_15);
+		char * const  * __s_rename_at_17;
+		__need_loop_17 = __s_iterator.first(__context__,(__s_rename_at_17)) && __need_loop_17;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,200000));
+		int32_t __i_rename_at_17;
+		__need_loop_17 = __i_iterator.first(__context__,(__i_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __s_iterator.next(__context__,(__s_rename_at_17)) && __i_iterator.next(__context__,(__i_rename_at_17)) )
+		{
+			das_copy(__tab_rename_at_15((*__s_rename_at_17),__context__),__i_rename_at_17);
+		}
+		__s_iterator.close(__context__,(__s_rename_at_17));
+		__i_iterator.close(__context__,(__i_rename_at_17));
+	};
+	int32_t __found_rename_at_19 = 0;
+	{
+		bool __need_loop_20 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_15);
+		char * const  * __s_rename_at_20;
+		__need_loop_20 = __s_iterator.first(__context__,(__s_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __s_iterator.next(__context__,(__s_rename_at_20)) )
+		{
+			if ( _Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_15),(*__s_rename_at_20)) )
+			{
+				__found_rename_at_19++;
+			};
+		}
+		__s_iterator.close(__context__,(__s_rename_at_20));
+	};
+	return __found_rename_at_19;
+}
+
+inline int32_t struct_table_53258ed70a3c91a9 ( Context * __context__, TTable<uint32_t,int32_t> &  __tab_rename_at_25, TArray<struct Key> const  &  __src_rename_at_25 )
+{
+	builtin_table_clear(das_arg<TTable<uint32_t,int32_t>>::pass(__tab_rename_at_25),__context__);
+	{
+		bool __need_loop_27 = true;
+		// k : Key const&
+		das_iterator<TArray<struct Key> const > __k_iterator(__src_rename_at_25);
+		struct Key const  * __k_rename_at_27;
+		__need_loop_27 = __k_iterator.first(__context__,(__k_rename_at_27)) && __need_loop_27;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,200000));
+		int32_t __i_rename_at_27;
+		__need_loop_27 = __i_iterator.first(__context__,(__i_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __k_iterator.next(__context__,(__k_rename_at_27)) && __i_iterator.next(__context__,(__i_rename_at_27)) )
+		{
+			das_copy(__tab_rename_at_25(das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<struct Key const  &>::from((*__k_rename_at_27)))),__context__),__i_rename_at_27);
+		}
+		__k_iterator.close(__context__,(__k_rename_at_27));
+		__i_iterator.close(__context__,(__i_rename_at_27));
+	};
+	int32_t __found_rename_at_29 = 0;
+	{
+		bool __need_loop_30 = true;
+		// k : Key const&
+		das_iterator<TArray<struct Key> const > __k_iterator(__src_rename_at_25);
+		struct Key const  * __k_rename_at_30;
+		__need_loop_30 = __k_iterator.first(__context__,(__k_rename_at_30)) && __need_loop_30;
+		for ( ; __need_loop_30 ; __need_loop_30 = __k_iterator.next(__context__,(__k_rename_at_30)) )
+		{
+			if ( _Funcbuiltin_0x60_key_exists_b75961c07a8f34ad(__context__,das_arg<TTable<uint32_t,int32_t>>::pass(__tab_rename_at_25),das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<struct Key const  &>::from((*__k_rename_at_30))))) )
+			{
+				__found_rename_at_29++;
+			};
+		}
+		__k_iterator.close(__context__,(__k_rename_at_30));
+	};
+	return __found_rename_at_29;
+}
+
+inline bool test_e17eb82e7ff7f321 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,336,"test " DAS_FILE_LINE);
+{
+	TArray<char *> __src_rename_at_37; das_zero(__src_rename_at_37);
+	make_strings_91e2ee8ea0e29705(__context__,das_arg<TArray<char *>>::pass(__src_rename_at_37));
+	TArray<struct Key> __keys_rename_at_39; das_zero(__keys_rename_at_39);
+	_Funcbuiltin_0x60_resize_8b10ec6c8ae14fd1(__context__,das_arg<TArray<struct Key>>::pass(__keys_rename_at_39),200000);
+	{
+		bool __need_loop_41 = true;
+		// k : Key&
+		das_iterator<TArray<struct Key>> __k_iterator(__keys_rename_at_39);
+		struct Key * __k_rename_at_41;
+		__need_loop_41 = __k_iterator.first(__context__,(__k_rename_at_41)) && __need_loop_41;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,200000));
+		int32_t __i_rename_at_41;
+		__need_loop_41 = __i_iterator.first(__context__,(__i_rename_at_41)) && __need_loop_41;
+		for ( ; __need_loop_41 ; __need_loop_41 = __k_iterator.next(__context__,(__k_rename_at_41)) && __i_iterator.next(__context__,(__i_rename_at_41)) )
+		{
+			das_copy((*__k_rename_at_41),(([&]() -> struct Key {
+				struct Key __mks_42;
+				das_copy((__mks_42.a),(__i_rename_at_41));
+				das_copy((__mks_42.b),((__i_rename_at_41 * 3)));
+				das_copy((__mks_42.c),(float(__i_rename_at_41)));
+				das_copy((__mks_42.d),(-__i_rename_at_41));
+				return __mks_42;
+			})()));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_41));
+		__i_iterator.close(__context__,(__i_rename_at_41));
+	};
+	TTable<char *,int32_t> __stab_rename_at_43; das_zero(__stab_rename_at_43);
+	TTable<uint32_t,int32_t> __utab_rename_at_44; das_zero(__utab_rename_at_44);
+	builtin_profile(10,((char *) "table with string keys"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		string_table_c1d29ecf03c68ec3(__context__,das_arg<TTable<char *,int32_t>>::pass(__stab_rename_at_43),das_arg<TArray<char *>>::pass(__src_rename_at_37));
+	}),__context__);
+	builtin_profile(10,((char *) "table with struct hash keys"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		struct_table_53258ed70a3c91a9(__context__,das_arg<TTable<uint32_t,int32_t>>::pass(__utab_rename_at_44),das_arg<TArray<struct Key>>::pass(__keys_rename_at_39));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_bb3702af962b623e(__context__,das_arg<TTable<char *,int32_t>>::pass(__stab_rename_at_43));
+	_Funcbuiltin_0x60_finalize_b80ec54858224d1b(__context__,das_arg<TTable<uint32_t,int32_t>>::pass(__utab_rename_at_44));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__src_rename_at_37));
+	_Funcbuiltin_0x60_finalize_90813738a6285d25(__context__,das_arg<TArray<struct Key>>::pass(__keys_rename_at_39));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_90813738a6285d25
+		aotLib[0xccad17d4264ca1c3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Key> &  ),&_Funcbuiltin_0x60_finalize_90813738a6285d25>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_finalize_bb3702af962b623e
+		aotLib[0x47ccc641525eada1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Funcbuiltin_0x60_finalize_bb3702af962b623e>>();
+	};
+		// _Funcbuiltin_0x60_finalize_b80ec54858224d1b
+		aotLib[0xabdf177af0ad1ab5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<uint32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_b80ec54858224d1b>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d
+		aotLib[0xd387297f5cd4e119] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_b75961c07a8f34ad
+		aotLib[0x880ef2aee360b7b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<uint32_t,int32_t> const  & , uint32_t  ),&_Funcbuiltin_0x60_key_exists_b75961c07a8f34ad>>();
+	};
+		// _Funcbuiltin_0x60_resize_8b10ec6c8ae14fd1
+		aotLib[0xc5849e6371315ccd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Key> & , int32_t  ),&_Funcbuiltin_0x60_resize_8b10ec6c8ae14fd1>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// finalize_41e0b23c7b8337cc
+		aotLib[0x17155e4b6e4af81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Key &  ),&finalize_41e0b23c7b8337cc>>();
+	};
+		// make_strings_91e2ee8ea0e29705
+		aotLib[0x342ba939e5fc6c7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&make_strings_91e2ee8ea0e29705>>();
+	};
+		// string_table_c1d29ecf03c68ec3
+		aotLib[0xc39b1bb7e2e1db5c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<char *,int32_t> & , TArray<char *> const  &  ),&string_table_c1d29ecf03c68ec3>>();
+	};
+		// struct_table_53258ed70a3c91a9
+		aotLib[0x9ecda816ce23fdbe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<uint32_t,int32_t> & , TArray<struct Key> const  &  ),&struct_table_53258ed70a3c91a9>>();
+	};
+		// test_e17eb82e7ff7f321
+		aotLib[0x2a3336b0b0cace71] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e17eb82e7ff7f321>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,112 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline int32_t _Func_0x60_fibR_d14c7688fb55d631 ( Context * __context__, int32_t __n_rename_at_6 );
+inline int32_t _Func_0x60_fibRH_b21dca03808846f5 ( Context * __context__, int32_t __n_rename_at_18 );
+inline bool test_e23bf89f60facac6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _Func_0x60_fibR_d14c7688fb55d631 ( Context * __context__, int32_t __n_rename_at_6 )
+{
+	return (__n_rename_at_6 < 2) ? (__n_rename_at_6) : ((_Func_0x60_fibR_d14c7688fb55d631(__context__,__n_rename_at_6 - 1) + _Func_0x60_fibR_d14c7688fb55d631(__context__,__n_rename_at_6 - 2)));
+}
+
+inline int32_t _Func_0x60_fibRH_b21dca03808846f5 ( Context * __context__, int32_t __n_rename_at_18 )
+{
+	return (__n_rename_at_18 < 2) ? (__n_rename_at_18) : ((das_invoke_function<int32_t>::invoke<int32_t>(__context__,Func(__context__->fnIdxByMangledName(/*`fibRH int#const#explicit*/ 4158839364u)),__n_rename_at_18 - 1) + das_invoke_function<int32_t>::invoke<int32_t>(__context__,Func(__context__->fnIdxByMangledName(/*`fibRH int#const#explicit*/ 4158839364u)),__n_rename_at_18 - 2)));
+}
+
+inline bool test_e23bf89f60facac6 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	int32_t __f1_rename_at_25 = 0;
+	builtin_profile(20,((char *) "fibbonacci recursive"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f1_rename_at_25,_Func_0x60_fibR_d14c7688fb55d631(__context__,31));
+	}),__context__);
+	DAS_ASSERT((__f1_rename_at_25 == 1346269));
+	int32_t __f2_rename_at_29 = 0;
+	builtin_profile(20,((char *) "fibbonacci recursive, no aot"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f2_rename_at_29,das_invoke_function<int32_t>::invoke<int32_t>(__context__,Func(__context__->fnIdxByMangledName(/*`fibRNA int#const#explicit*/ 2023891387u)),31));
+	}),__context__);
+	DAS_ASSERT((__f2_rename_at_29 == 1346269));
+	int32_t __f3_rename_at_33 = 0;
+	builtin_profile(20,((char *) "fibbonacci recursive, hybrid"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f3_rename_at_33,das_invoke_function<int32_t>::invoke<int32_t>(__context__,Func(__context__->fnIdxByMangledName(/*`fibRH int#const#explicit*/ 4158839364u)),31));
+	}),__context__);
+	DAS_ASSERT((__f3_rename_at_33 == 1346269));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_fibR_d14c7688fb55d631
+		aotLib[0x7f60fcb9548e0815] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_fibR_d14c7688fb55d631>>();
+	};
+		// _Func_0x60_fibRH_b21dca03808846f5
+		aotLib[0x52330514d30235f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_fibRH_b21dca03808846f5>>();
+	};
+		// test_e23bf89f60facac6
+		aotLib[0xa8425dc11422e1f6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e23bf89f60facac6>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
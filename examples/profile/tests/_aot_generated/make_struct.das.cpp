@@ -0,0 +1,179 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+	int32_t z;
+	int32_t w;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,w)==12,"structure field offset mismatch with DAS");
+}
+
+inline struct Foo make_1_a317d314540f9d5f ( Context * __context__ );
+inline struct Foo make_2_dfb44b4908790739 ( Context * __context__ );
+inline bool test_d4326a7835a4a590 ( Context * __context__ );
+inline int32_t test_1_d970898fa7f8a909 ( Context * __context__ );
+inline int32_t test_2_c3bc6c15446ac6bb ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline struct Foo make_1_a317d314540f9d5f ( Context * __context__ )
+{
+	struct Foo __t_rename_at_6; das_zero(__t_rename_at_6);
+	das_copy(__t_rename_at_6.x,1);
+	das_copy(__t_rename_at_6.y,2);
+	das_copy(__t_rename_at_6.z,3);
+	das_copy(__t_rename_at_6.w,4);
+	return __t_rename_at_6;
+}
+
+inline struct Foo make_2_dfb44b4908790739 ( Context * __context__ )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_15;
+		das_copy((__mks_15.x),(1));
+		das_copy((__mks_15.y),(2));
+		das_copy((__mks_15.z),(3));
+		das_copy((__mks_15.w),(4));
+		return __mks_15;
+	})());
+}
+
+inline bool test_d4326a7835a4a590 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"test " DAS_FILE_LINE);
+{
+	int32_t __q1_rename_at_31 = 0;
+	builtin_profile(20,((char *) "make t.x=1;..."),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__q1_rename_at_31,test_1_d970898fa7f8a909(__context__));
+	}),__context__);
+	DAS_ASSERT((__q1_rename_at_31 == 1000000));
+	int32_t __q2_rename_at_35 = 0;
+	builtin_profile(20,((char *) "make [[Foo x=1;...]]"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__q2_rename_at_35,test_2_c3bc6c15446ac6bb(__context__));
+	}),__context__);
+	DAS_ASSERT((__q2_rename_at_35 == 1000000));
+	return true;
+}}
+
+inline int32_t test_1_d970898fa7f8a909 ( Context * __context__ )
+{
+	int32_t __q_rename_at_18 = 0;
+	{
+		bool __need_loop_19 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,1000000));
+		int32_t __x_rename_at_19;
+		__need_loop_19 = __x_iterator.first(__context__,(__x_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __x_iterator.next(__context__,(__x_rename_at_19)) )
+		{
+			struct Foo _temp_make_local_20_64;
+			__q_rename_at_18 += (_temp_make_local_20_64 = (make_1_a317d314540f9d5f(__context__))).x;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_19));
+	};
+	return __q_rename_at_18;
+}
+
+inline int32_t test_2_c3bc6c15446ac6bb ( Context * __context__ )
+{
+	int32_t __q_rename_at_24 = 0;
+	{
+		bool __need_loop_25 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,1000000));
+		int32_t __x_rename_at_25;
+		__need_loop_25 = __x_iterator.first(__context__,(__x_rename_at_25)) && __need_loop_25;
+		for ( ; __need_loop_25 ; __need_loop_25 = __x_iterator.next(__context__,(__x_rename_at_25)) )
+		{
+			struct Foo _temp_make_local_26_64;
+			__q_rename_at_24 += (_temp_make_local_26_64 = (make_2_dfb44b4908790739(__context__))).x;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_25));
+	};
+	return __q_rename_at_24;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// make_1_a317d314540f9d5f
+		aotLib[0xfd0ec966ab8abba5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__ ),&make_1_a317d314540f9d5f>>();
+	};
+		// make_2_dfb44b4908790739
+		aotLib[0x57acd31589cfb8d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__ ),&make_2_dfb44b4908790739>>();
+	};
+		// test_d4326a7835a4a590
+		aotLib[0xe5e24d9c1447e3d2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d4326a7835a4a590>>();
+	};
+		// test_1_d970898fa7f8a909
+		aotLib[0xe1eabe644466ec35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&test_1_d970898fa7f8a909>>();
+	};
+		// test_2_c3bc6c15446ac6bb
+		aotLib[0x7454ff75a19a7e95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&test_2_c3bc6c15446ac6bb>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
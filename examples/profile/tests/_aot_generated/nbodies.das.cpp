@@ -0,0 +1,274 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+namespace  {
+
+struct body {
+	float3 x;
+	float pad;
+	float3 v;
+	float mass;
+};
+static_assert(sizeof(body)==32,"structure size mismatch with DAS");
+static_assert(offsetof(body,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,pad)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,v)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,mass)==28,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_0x60_nbodies_abe0d600c87103b7 ( Context * __context__, int32_t __n_rename_at_83 );
+inline void _Func_0x60_scale_bodies_326173d0f9d3781a ( Context * __context__, float __scale_rename_at_78 );
+inline void advance_1a1b4627cce8009b ( Context * __context__ );
+inline float energy_3a2e5a21129283fa ( Context * __context__ );
+inline void offset_momentum_2fbd7a0758f4e31f ( Context * __context__ );
+inline bool test_ccb7ffb22e4e44d3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<float,0>(__context__) = 39.47842f;/*SOLAR_MASS*/
+	das_global<TDim<struct body,5>,16>(__context__) = (([&]() -> TDim<struct body,5> {
+		TDim<struct body,5> __mks_19;
+		das_zero(__mks_19);
+		das_copy((__mks_19(0,__context__).x),(v_zero()));
+		das_copy((__mks_19(0,__context__).v),(v_zero()));
+		das_copy((__mks_19(0,__context__).mass),(das_global<float,0>(__context__) /*SOLAR_MASS*/));
+		das_copy((__mks_19(1,__context__).x),(v_make_vec4f(4.8414316f,-1.16032f,-0.10362204f,0.f)));
+		das_copy((__mks_19(1,__context__).v),(v_make_vec4f(0.6063264f,2.811987f,-0.02521836f,0.f)));
+		das_copy((__mks_19(1,__context__).mass),(0.03769368f));
+		das_copy((__mks_19(2,__context__).x),(v_make_vec4f(8.343367f,4.124799f,-0.40352342f,0.f)));
+		das_copy((__mks_19(2,__context__).v),(v_make_vec4f(-1.0107743f,1.8256623f,0.008415761f,0.f)));
+		das_copy((__mks_19(2,__context__).mass),(0.011286327f));
+		das_copy((__mks_19(3,__context__).x),(v_make_vec4f(12.894369f,-15.111152f,-0.22330758f,0.f)));
+		das_copy((__mks_19(3,__context__).v),(v_make_vec4f(1.082791f,0.86871296f,-0.010832638f,0.f)));
+		das_copy((__mks_19(3,__context__).mass),(0.0017237242f));
+		das_copy((__mks_19(4,__context__).x),(v_make_vec4f(15.379697f,-25.919315f,0.17925878f,0.f)));
+		das_copy((__mks_19(4,__context__).v),(v_make_vec4f(0.9790907f,0.59469897f,-0.034755953f,0.f)));
+		das_copy((__mks_19(4,__context__).mass),(0.002033687f));
+		return __mks_19;
+	})());/*bodies*/
+}
+
+inline void _Func_0x60_nbodies_abe0d600c87103b7 ( Context * __context__, int32_t __n_rename_at_83 )
+{
+	_Func_0x60_scale_bodies_326173d0f9d3781a(__context__,0.01f);
+	{
+		bool __need_loop_85 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_83));
+		int32_t __i_rename_at_85;
+		__need_loop_85 = __i_iterator.first(__context__,(__i_rename_at_85)) && __need_loop_85;
+		for ( ; __need_loop_85 ; __need_loop_85 = __i_iterator.next(__context__,(__i_rename_at_85)) )
+		{
+			advance_1a1b4627cce8009b(__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_85));
+	};
+	_Func_0x60_scale_bodies_326173d0f9d3781a(__context__,100.f);
+}
+
+inline void _Func_0x60_scale_bodies_326173d0f9d3781a ( Context * __context__, float __scale_rename_at_78 )
+{
+	{
+		bool __need_loop_79 = true;
+		// b : body&
+		das_iterator<TDim<struct body,5>> __b_iterator(das_global<TDim<struct body,5>,16>(__context__) /*bodies*/);
+		struct body * __b_rename_at_79;
+		__need_loop_79 = __b_iterator.first(__context__,(__b_rename_at_79)) && __need_loop_79;
+		for ( ; __need_loop_79 ; __need_loop_79 = __b_iterator.next(__context__,(__b_rename_at_79)) )
+		{
+			(*__b_rename_at_79).mass *= (__scale_rename_at_78 * __scale_rename_at_78);
+			SimPolicy<float3>::SetMulScal((char *)&((*__b_rename_at_79).v),cast<float>::from(__scale_rename_at_78),*__context__);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_79));
+	};
+}
+
+inline void advance_1a1b4627cce8009b ( Context * __context__ )
+{
+	int32_t __i_rename_at_49 = 0;
+	{
+		bool __need_loop_50 = true;
+		// b : body&
+		das_iterator<TDim<struct body,5>> __b_iterator(das_global<TDim<struct body,5>,16>(__context__) /*bodies*/);
+		struct body * __b_rename_at_50;
+		__need_loop_50 = __b_iterator.first(__context__,(__b_rename_at_50)) && __need_loop_50;
+		for ( ; __need_loop_50 ; __need_loop_50 = __b_iterator.next(__context__,(__b_rename_at_50)) )
+		{
+			++__i_rename_at_49;
+			{
+				bool __need_loop_52 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(__i_rename_at_49,5));
+				int32_t __j_rename_at_52;
+				__need_loop_52 = __j_iterator.first(__context__,(__j_rename_at_52)) && __need_loop_52;
+				for ( ; __need_loop_52 ; __need_loop_52 = __j_iterator.next(__context__,(__j_rename_at_52)) )
+				{
+					struct body * __b2_rename_at_53 = &(das_global<TDim<struct body,5>,16>(__context__) /*bodies*/(__j_rename_at_52,__context__));
+					float3 __dx_rename_at_54 = (float3)(SimPolicy<float3>::Sub((*__b_rename_at_50).x,(*__b2_rename_at_53).x,*__context__));
+					float __inv_distance_rename_at_55 = (float)invlength3(__dx_rename_at_54);
+					float __mag_rename_at_56 = (float)((__inv_distance_rename_at_55 * __inv_distance_rename_at_55) * __inv_distance_rename_at_55);
+					SimPolicy<float3>::SetSub((char *)&((*__b_rename_at_50).v),(SimPolicy<float3>::MulVecScal(__dx_rename_at_54,cast<float>::from(((*__b2_rename_at_53).mass * __mag_rename_at_56)),*__context__)),*__context__);
+					SimPolicy<float3>::SetAdd((char *)&((*__b2_rename_at_53).v),(SimPolicy<float3>::MulVecScal(__dx_rename_at_54,cast<float>::from(((*__b_rename_at_50).mass * __mag_rename_at_56)),*__context__)),*__context__);
+				}
+				__j_iterator.close(__context__,(__j_rename_at_52));
+			};
+			SimPolicy<float3>::SetAdd((char *)&((*__b_rename_at_50).x),(*__b_rename_at_50).v,*__context__);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_50));
+	};
+}
+
+inline float energy_3a2e5a21129283fa ( Context * __context__ )
+{
+	float __e_rename_at_62 = 0.f;
+	int32_t __i_rename_at_63 = 0;
+	{
+		bool __need_loop_64 = true;
+		// b : body&
+		das_iterator<TDim<struct body,5>> __b_iterator(das_global<TDim<struct body,5>,16>(__context__) /*bodies*/);
+		struct body * __b_rename_at_64;
+		__need_loop_64 = __b_iterator.first(__context__,(__b_rename_at_64)) && __need_loop_64;
+		for ( ; __need_loop_64 ; __need_loop_64 = __b_iterator.next(__context__,(__b_rename_at_64)) )
+		{
+			__e_rename_at_62 += ((0.5f * (*__b_rename_at_64).mass) * lengthSq3((*__b_rename_at_64).v));
+			++__i_rename_at_63;
+			{
+				bool __need_loop_67 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(__i_rename_at_63,5));
+				int32_t __j_rename_at_67;
+				__need_loop_67 = __j_iterator.first(__context__,(__j_rename_at_67)) && __need_loop_67;
+				for ( ; __need_loop_67 ; __need_loop_67 = __j_iterator.next(__context__,(__j_rename_at_67)) )
+				{
+					struct body __b2_rename_at_68 = (struct body)das_global<TDim<struct body,5>,16>(__context__) /*bodies*/(__j_rename_at_67,__context__);
+					__e_rename_at_62 -= (SimPolicy<float>::Div(((*__b_rename_at_64).mass * __b2_rename_at_68.mass),distance3((*__b_rename_at_64).x,__b2_rename_at_68.x),*__context__));
+				}
+				__j_iterator.close(__context__,(__j_rename_at_67));
+			};
+		}
+		__b_iterator.close(__context__,(__b_rename_at_64));
+	};
+	return __e_rename_at_62;
+}
+
+inline void offset_momentum_2fbd7a0758f4e31f ( Context * __context__ )
+{
+	float3 __px_rename_at_43 = v_zero();
+	{
+		bool __need_loop_44 = true;
+		// b : body&
+		das_iterator<TDim<struct body,5>> __b_iterator(das_global<TDim<struct body,5>,16>(__context__) /*bodies*/);
+		struct body * __b_rename_at_44;
+		__need_loop_44 = __b_iterator.first(__context__,(__b_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __b_iterator.next(__context__,(__b_rename_at_44)) )
+		{
+			SimPolicy<float3>::SetSub((char *)&(__px_rename_at_43),(SimPolicy<float3>::MulVecScal((*__b_rename_at_44).v,cast<float>::from((*__b_rename_at_44).mass),*__context__)),*__context__);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_44));
+	};
+	das_copy(das_global<TDim<struct body,5>,16>(__context__) /*bodies*/(0,__context__).v,SimPolicy<float3>::DivVecScal(__px_rename_at_43,cast<float>::from(39.47842f),*__context__));
+}
+
+inline bool test_ccb7ffb22e4e44d3 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+	offset_momentum_2fbd7a0758f4e31f(__context__);
+	energy_3a2e5a21129283fa(__context__);
+	builtin_profile(10,((char *) "n-bodies"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		_Func_0x60_nbodies_abe0d600c87103b7(__context__,500000);
+	}),__context__);
+	energy_3a2e5a21129283fa(__context__);
+	testNBodiesInit();
+	builtin_profile(10,((char *) "n-bodies, C++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testNBodiesS(500000);
+	}),__context__);
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_nbodies_abe0d600c87103b7
+		aotLib[0x1d08c235bf95988a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&_Func_0x60_nbodies_abe0d600c87103b7>>();
+	};
+		// _Func_0x60_scale_bodies_326173d0f9d3781a
+		aotLib[0xe93585446d5c25fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float  ),&_Func_0x60_scale_bodies_326173d0f9d3781a>>();
+	};
+		// advance_1a1b4627cce8009b
+		aotLib[0x14155de973b7b12d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&advance_1a1b4627cce8009b>>();
+	};
+		// energy_3a2e5a21129283fa
+		aotLib[0x3e391de5f94d15a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__ ),&energy_3a2e5a21129283fa>>();
+	};
+		// offset_momentum_2fbd7a0758f4e31f
+		aotLib[0xb6a2ec8884a66389] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&offset_momentum_2fbd7a0758f4e31f>>();
+	};
+		// test_ccb7ffb22e4e44d3
+		aotLib[0x114844952ac61541] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_ccb7ffb22e4e44d3>>();
+	};
+		// [[ init script ]]
+		aotLib[0x3eaf8a548fba43ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,627 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+ // require soa
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__c22aaef9;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__c8271e89;
+extern VarInfo __var_info__1ba5095c;
+extern VarInfo __var_info__93a8b837;
+extern VarInfo __var_info__61367e18;
+extern VarInfo __var_info__5423e76e;
+extern VarInfo __var_info__22c629bc;
+extern FuncInfo __func_info__2c47cca3;
+
+VarInfo __struct_info__c22aaef9_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1ba5095c, "__rtti", 0 };
+TypeInfo * __type_info__93a8b837_arg_types_var_3257577209[1] = { &__type_info__c8271e89 };
+VarInfo __struct_info__c22aaef9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__93a8b837_arg_types_var_3257577209, nullptr, 1, 0, nullptr, 28, 0x93a8b837, "__finalize", 8 };
+VarInfo __struct_info__c22aaef9_field_2 =  { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x22c629bc, "position", 12 };
+VarInfo __struct_info__c22aaef9_field_3 =  { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x61367e18, "velocity", 24 };
+TypeInfo * __type_info__5423e76e_arg_types_var_3257577209[1] = { &__type_info__c8271e89 };
+VarInfo __struct_info__c22aaef9_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5423e76e_arg_types_var_3257577209, nullptr, 1, 0, nullptr, 28, 0x5423e76e, "update", 36 };
+VarInfo * __struct_info__c22aaef9_fields[5] =  { &__struct_info__c22aaef9_field_0, &__struct_info__c22aaef9_field_1, &__struct_info__c22aaef9_field_2, &__struct_info__c22aaef9_field_3, &__struct_info__c22aaef9_field_4 };
+StructInfo __struct_info__c22aaef9 = {"CObject", __struct_info__c22aaef9_fields, 5, 40, -1, nullptr, 0xc22aaef9 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__c8271e89 = { Type::tStructure, &__struct_info__c22aaef9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xc8271e89 };
+
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure SoaIndexMacro
+// unused structure SoaIndexVisitor
+// unused structure SoaLoopIterator
+// unused structure SoaStructMacro
+namespace  {
+
+struct CObject {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct CObject)) __finalize;
+	float3 position;
+	float3 velocity;
+	Func DAS_COMMENT((void,struct CObject)) update;
+};
+static_assert(sizeof(CObject)==40,"structure size mismatch with DAS");
+static_assert(offsetof(CObject,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,position)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,velocity)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,update)==36,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct NObject {
+	float3 position;
+	float3 velocity;
+};
+static_assert(sizeof(NObject)==24,"structure size mismatch with DAS");
+static_assert(offsetof(NObject,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(NObject,velocity)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct SObject {
+	float3 position;
+	float3 velocity;
+};
+static_assert(sizeof(SObject)==24,"structure size mismatch with DAS");
+static_assert(offsetof(SObject,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SObject,velocity)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct SObject_SOA {
+	TArray<float3> position;
+	TArray<float3> velocity;
+};
+static_assert(sizeof(SObject_SOA)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SObject_SOA,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SObject_SOA,velocity)==24,"structure field offset mismatch with DAS");
+}
+
+inline struct CObject CObject_7ceb8f902bde3913 ( Context * __context__, int32_t __i_rename_at_11 );
+inline void _FuncCObject_0x27___finalize_f5cbf43d32bf4313 ( Context * __context__, struct CObject & __self_rename_at_8 );
+inline void _FuncCObject_0x60_CObject_56061226887192dd ( Context * __context__, struct CObject & __self_rename_at_11, int32_t __i_rename_at_11 );
+inline void _FuncCObject_0x60_update_1d50b4de1a63635f ( Context * __context__, struct CObject & __self_rename_at_14 );
+inline void _Funcbuiltin_0x60_resize_a846d6ac5833aec2 ( Context * __context__, TArray<struct CObject> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_895b2ff719a60fbf ( Context * __context__, TArray<struct NObject> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void finalize_4d77d82602476a33 ( Context * __context__, struct CObject & ____this_rename_at_8 );
+inline void init_b9126b1109108a55 ( Context * __context__, TArray<struct CObject> & __objects_rename_at_33 );
+inline void init_69fa228145663536 ( Context * __context__, TArray<struct NObject> & __objects_rename_at_63 );
+inline void init_a6c56e6d8b915237 ( Context * __context__, struct SObject_SOA & __objects_rename_at_84 );
+inline int32_t length_64fd9465ba70762e ( Context * __context__, struct SObject_SOA const  & __soa_rename_at_72 );
+inline void resize_12204e27cf9c5bd6 ( Context * __context__, struct SObject_SOA & __soa_rename_at_72, int32_t __newSize_rename_at_72 );
+inline bool test_2d6847c338618026 ( Context * __context__ );
+inline void testMethod_a600be71db1e7e81 ( Context * __context__, TArray<struct CObject> & __objects_rename_at_25 );
+inline void testMethod2_658d49f002c24c76 ( Context * __context__, TArray<struct CObject> & __objects_rename_at_29, int32_t __count_rename_at_29 );
+inline void testSim_adfd4989f8d7ec33 ( Context * __context__, TArray<struct NObject> & __objects_rename_at_47 );
+inline void testSim2_7269cdc685f1eb24 ( Context * __context__, TArray<struct NObject> & __objects_rename_at_51, int32_t __count_rename_at_51 );
+inline void testSim2I_e53b966cc8eb55fc ( Context * __context__, TArray<struct NObject> & __objects_rename_at_59, int32_t __count_rename_at_59 );
+inline void testSim2Soa_412c39d8902763e0 ( Context * __context__, struct SObject_SOA & __objects_rename_at_80, int32_t __count_rename_at_80 );
+inline void testSimI_e97c626421e90fb9 ( Context * __context__, TArray<struct NObject> & __objects_rename_at_55 );
+inline void testSimSoa_b64bd8fd7feecd28 ( Context * __context__, struct SObject_SOA & __objects_rename_at_76 );
+inline void testVirtual_8db7e9fe5ed7f33a ( Context * __context__, TArray<struct CObject> & __objects_rename_at_17 );
+inline void testVirtual2_8f59d0c6dd444864 ( Context * __context__, TArray<struct CObject> & __objects_rename_at_21, int32_t __count_rename_at_21 );
+inline void update_fe2eb4f455fd28f2 ( Context * __context__, struct NObject & __a_rename_at_44 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline struct CObject CObject_7ceb8f902bde3913 ( Context * __context__, int32_t __i_rename_at_11 )
+{
+	struct CObject __self_rename_at_11; das_zero(__self_rename_at_11); das_move(__self_rename_at_11, (([&]() -> struct CObject {
+		struct CObject __mks_11;
+		das_zero(__mks_11);
+		das_copy((__mks_11.__rtti),(((void *)(&__type_info__c8271e89))));
+		das_copy((__mks_11.__finalize),(Func(__context__->fnIdxByMangledName(/*CObject'__finalize CObject*/ 3571535988u))));
+		das_copy((__mks_11.update),(Func(__context__->fnIdxByMangledName(/*CObject`update CObject*/ 3664857060u))));
+		return __mks_11;
+	})()));
+	_FuncCObject_0x60_CObject_56061226887192dd(__context__,das_arg<struct CObject>::pass(__self_rename_at_11),__i_rename_at_11);
+	return /* <- */ __self_rename_at_11;
+}
+
+inline void _FuncCObject_0x27___finalize_f5cbf43d32bf4313 ( Context * __context__, struct CObject &  __self_rename_at_8 )
+{
+	finalize_4d77d82602476a33(__context__,das_arg<struct CObject>::pass(__self_rename_at_8));
+}
+
+inline void _FuncCObject_0x60_CObject_56061226887192dd ( Context * __context__, struct CObject &  __self_rename_at_11, int32_t __i_rename_at_11 )
+{
+	das_copy(__self_rename_at_11.position,float3(__i_rename_at_11,__i_rename_at_11 + 1,__i_rename_at_11 + 2));
+	das_copy(__self_rename_at_11.velocity,v_make_vec4f(1.f,2.f,3.f,0.f));
+}
+
+inline void _FuncCObject_0x60_update_1d50b4de1a63635f ( Context * __context__, struct CObject &  __self_rename_at_14 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__self_rename_at_14.position),__self_rename_at_14.velocity,*__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_a846d6ac5833aec2 ( Context * __context__, TArray<struct CObject> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct CObject>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,40,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_895b2ff719a60fbf ( Context * __context__, TArray<struct NObject> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct NObject>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float3>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,12,__context__);
+}
+
+inline void finalize_4d77d82602476a33 ( Context * __context__, struct CObject &  ____this_rename_at_8 )
+{
+	memset(&(____this_rename_at_8), 0, 40);
+}
+
+inline void init_b9126b1109108a55 ( Context * __context__, TArray<struct CObject> &  __objects_rename_at_33 )
+{
+	_Funcbuiltin_0x60_resize_a846d6ac5833aec2(__context__,das_arg<TArray<struct CObject>>::pass(__objects_rename_at_33),50000);
+	int32_t __i_rename_at_35 = 0;
+	{
+		bool __need_loop_36 = true;
+		// obj : CObject&
+		das_iterator<TArray<struct CObject>> __obj_iterator(__objects_rename_at_33);
+		struct CObject * __obj_rename_at_36;
+		__need_loop_36 = __obj_iterator.first(__context__,(__obj_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = __obj_iterator.next(__context__,(__obj_rename_at_36)) )
+		{
+			das_copy((*__obj_rename_at_36),CObject_7ceb8f902bde3913(__context__,__i_rename_at_35++));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_36));
+	};
+}
+
+inline void init_69fa228145663536 ( Context * __context__, TArray<struct NObject> &  __objects_rename_at_63 )
+{
+	_Funcbuiltin_0x60_resize_895b2ff719a60fbf(__context__,das_arg<TArray<struct NObject>>::pass(__objects_rename_at_63),50000);
+	int32_t __i_rename_at_65 = 0;
+	{
+		bool __need_loop_66 = true;
+		// obj : NObject&
+		das_iterator<TArray<struct NObject>> __obj_iterator(__objects_rename_at_63);
+		struct NObject * __obj_rename_at_66;
+		__need_loop_66 = __obj_iterator.first(__context__,(__obj_rename_at_66)) && __need_loop_66;
+		for ( ; __need_loop_66 ; __need_loop_66 = __obj_iterator.next(__context__,(__obj_rename_at_66)) )
+		{
+			das_copy((*__obj_rename_at_66).position,float3(__i_rename_at_65++,__i_rename_at_65 + 1,__i_rename_at_65 + 2));
+			das_copy((*__obj_rename_at_66).velocity,v_make_vec4f(1.f,2.f,3.f,0.f));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_66));
+	};
+	DAS_ASSERT((__i_rename_at_65 == builtin_array_size(das_arg<TArray<struct NObject>>::pass(__objects_rename_at_63))));
+}
+
+inline void init_a6c56e6d8b915237 ( Context * __context__, struct SObject_SOA &  __objects_rename_at_84 )
+{
+	resize_12204e27cf9c5bd6(__context__,das_arg<struct SObject_SOA>::pass(__objects_rename_at_84),50000);
+	int32_t __i_rename_at_86 = 0;
+	{
+		bool __need_loop_87 = true;
+		// pos : float3&
+		das_iterator<TArray<float3>> __pos_iterator(__objects_rename_at_84.position);
+		float3 * __pos_rename_at_87;
+		__need_loop_87 = __pos_iterator.first(__context__,(__pos_rename_at_87)) && __need_loop_87;
+		// vel : float3&
+		das_iterator<TArray<float3>> __vel_iterator(__objects_rename_at_84.velocity);
+		float3 * __vel_rename_at_87;
+		__need_loop_87 = __vel_iterator.first(__context__,(__vel_rename_at_87)) && __need_loop_87;
+		for ( ; __need_loop_87 ; __need_loop_87 = __pos_iterator.next(__context__,(__pos_rename_at_87)) && __vel_iterator.next(__context__,(__vel_rename_at_87)) )
+		{
+			das_copy((*__pos_rename_at_87),float3(__i_rename_at_86++,__i_rename_at_86 + 1,__i_rename_at_86 + 2));
+			das_copy((*__vel_rename_at_87),v_make_vec4f(1.f,2.f,3.f,0.f));
+		}
+		__pos_iterator.close(__context__,(__pos_rename_at_87));
+		__vel_iterator.close(__context__,(__vel_rename_at_87));
+	};
+	DAS_ASSERT((__i_rename_at_86 == length_64fd9465ba70762e(__context__,das_arg<struct SObject_SOA>::pass(__objects_rename_at_84))));
+}
+
+inline int32_t length_64fd9465ba70762e ( Context * __context__, struct SObject_SOA const  &  __soa_rename_at_72 )
+{
+	return builtin_array_size(__soa_rename_at_72.position);
+}
+
+inline void resize_12204e27cf9c5bd6 ( Context * __context__, struct SObject_SOA &  __soa_rename_at_72, int32_t __newSize_rename_at_72 )
+{
+	_Funcbuiltin_0x60_resize_d3b08ad0141c2c31(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_72.position),__newSize_rename_at_72);
+	_Funcbuiltin_0x60_resize_d3b08ad0141c2c31(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_72.velocity),__newSize_rename_at_72);
+}
+
+inline bool test_2d6847c338618026 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,480,"test " DAS_FILE_LINE);
+{
+	TArray<struct NObject> __objects_rename_at_94; das_zero(__objects_rename_at_94);
+	init_69fa228145663536(__context__,das_arg<TArray<struct NObject>>::pass(__objects_rename_at_94));
+	builtin_profile(20,((char *) "particles kinematics"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testSim2_7269cdc685f1eb24(__context__,das_arg<TArray<struct NObject>>::pass(__objects_rename_at_94),100);
+	}),__context__);
+	builtin_profile(20,((char *) "particles kinematics, inlined"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testSim2I_e53b966cc8eb55fc(__context__,das_arg<TArray<struct NObject>>::pass(__objects_rename_at_94),100);
+	}),__context__);
+	struct SObject_SOA __soa_rename_at_101; das_zero(__soa_rename_at_101);
+	init_a6c56e6d8b915237(__context__,das_arg<struct SObject_SOA>::pass(__soa_rename_at_101));
+	builtin_profile(20,((char *) "particles kinematics, soa"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testSim2Soa_412c39d8902763e0(__context__,das_arg<struct SObject_SOA>::pass(__soa_rename_at_101),100);
+	}),__context__);
+	TArray<struct CObject> __classes_rename_at_106; das_zero(__classes_rename_at_106);
+	init_b9126b1109108a55(__context__,das_arg<TArray<struct CObject>>::pass(__classes_rename_at_106));
+	builtin_profile(20,((char *) "particles kinematics OOP, virtual"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testVirtual2_8f59d0c6dd444864(__context__,das_arg<TArray<struct CObject>>::pass(__classes_rename_at_106),100);
+	}),__context__);
+	builtin_profile(20,((char *) "particles kinematics OOP, method"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testMethod2_658d49f002c24c76(__context__,das_arg<TArray<struct CObject>>::pass(__classes_rename_at_106),100);
+	}),__context__);
+	builtin_profile(20,((char *) "particles kinematics, C++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testParticles(100);
+	}),__context__);
+	builtin_profile(20,((char *) "particles kinematics, inlined C++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testParticlesI(100);
+	}),__context__);
+	return true;
+}}
+
+inline void testMethod_a600be71db1e7e81 ( Context * __context__, TArray<struct CObject> &  __objects_rename_at_25 )
+{
+	{
+		bool __need_loop_26 = true;
+		// obj : CObject&
+		das_iterator<TArray<struct CObject>> __obj_iterator(__objects_rename_at_25);
+		struct CObject * __obj_rename_at_26;
+		__need_loop_26 = __obj_iterator.first(__context__,(__obj_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __obj_iterator.next(__context__,(__obj_rename_at_26)) )
+		{
+			_FuncCObject_0x60_update_1d50b4de1a63635f(__context__,das_arg<struct CObject>::pass((*__obj_rename_at_26)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_26));
+	};
+}
+
+inline void testMethod2_658d49f002c24c76 ( Context * __context__, TArray<struct CObject> &  __objects_rename_at_29, int32_t __count_rename_at_29 )
+{
+	{
+		bool __need_loop_30 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__count_rename_at_29));
+		int32_t __i_rename_at_30;
+		__need_loop_30 = __i_iterator.first(__context__,(__i_rename_at_30)) && __need_loop_30;
+		for ( ; __need_loop_30 ; __need_loop_30 = __i_iterator.next(__context__,(__i_rename_at_30)) )
+		{
+			testMethod_a600be71db1e7e81(__context__,das_arg<TArray<struct CObject>>::pass(__objects_rename_at_29));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_30));
+	};
+}
+
+inline void testSim_adfd4989f8d7ec33 ( Context * __context__, TArray<struct NObject> &  __objects_rename_at_47 )
+{
+	{
+		bool __need_loop_48 = true;
+		// obj : NObject&
+		das_iterator<TArray<struct NObject>> __obj_iterator(__objects_rename_at_47);
+		struct NObject * __obj_rename_at_48;
+		__need_loop_48 = __obj_iterator.first(__context__,(__obj_rename_at_48)) && __need_loop_48;
+		for ( ; __need_loop_48 ; __need_loop_48 = __obj_iterator.next(__context__,(__obj_rename_at_48)) )
+		{
+			update_fe2eb4f455fd28f2(__context__,das_arg<struct NObject>::pass((*__obj_rename_at_48)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_48));
+	};
+}
+
+inline void testSim2_7269cdc685f1eb24 ( Context * __context__, TArray<struct NObject> &  __objects_rename_at_51, int32_t __count_rename_at_51 )
+{
+	{
+		bool __need_loop_52 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__count_rename_at_51));
+		int32_t __i_rename_at_52;
+		__need_loop_52 = __i_iterator.first(__context__,(__i_rename_at_52)) && __need_loop_52;
+		for ( ; __need_loop_52 ; __need_loop_52 = __i_iterator.next(__context__,(__i_rename_at_52)) )
+		{
+			testSim_adfd4989f8d7ec33(__context__,das_arg<TArray<struct NObject>>::pass(__objects_rename_at_51));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_52));
+	};
+}
+
+inline void testSim2I_e53b966cc8eb55fc ( Context * __context__, TArray<struct NObject> &  __objects_rename_at_59, int32_t __count_rename_at_59 )
+{
+	{
+		bool __need_loop_60 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__count_rename_at_59));
+		int32_t __i_rename_at_60;
+		__need_loop_60 = __i_iterator.first(__context__,(__i_rename_at_60)) && __need_loop_60;
+		for ( ; __need_loop_60 ; __need_loop_60 = __i_iterator.next(__context__,(__i_rename_at_60)) )
+		{
+			testSimI_e97c626421e90fb9(__context__,das_arg<TArray<struct NObject>>::pass(__objects_rename_at_59));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_60));
+	};
+}
+
+inline void testSim2Soa_412c39d8902763e0 ( Context * __context__, struct SObject_SOA &  __objects_rename_at_80, int32_t __count_rename_at_80 )
+{
+	{
+		bool __need_loop_81 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__count_rename_at_80));
+		int32_t __i_rename_at_81;
+		__need_loop_81 = __i_iterator.first(__context__,(__i_rename_at_81)) && __need_loop_81;
+		for ( ; __need_loop_81 ; __need_loop_81 = __i_iterator.next(__context__,(__i_rename_at_81)) )
+		{
+			testSimSoa_b64bd8fd7feecd28(__context__,das_arg<struct SObject_SOA>::pass(__objects_rename_at_80));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_81));
+	};
+}
+
+inline void testSimI_e97c626421e90fb9 ( Context * __context__, TArray<struct NObject> &  __objects_rename_at_55 )
+{
+	{
+		bool __need_loop_56 = true;
+		// obj : NObject&
+		das_iterator<TArray<struct NObject>> __obj_iterator(__objects_rename_at_55);
+		struct NObject * __obj_rename_at_56;
+		__need_loop_56 = __obj_iterator.first(__context__,(__obj_rename_at_56)) && __need_loop_56;
+		for ( ; __need_loop_56 ; __need_loop_56 = __obj_iterator.next(__context__,(__obj_rename_at_56)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_56).position),(*__obj_rename_at_56).velocity,*__context__);
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_56));
+	};
+}
+
+inline void testSimSoa_b64bd8fd7feecd28 ( Context * __context__, struct SObject_SOA &  __objects_rename_at_76 )
+{
+	{
+		bool __need_loop_77 = true;
+		// pos : float3&
+		das_iterator<TArray<float3>> __pos_iterator(__objects_rename_at_76.position);
+		float3 * __pos_rename_at_77;
+		__need_loop_77 = __pos_iterator.first(__context__,(__pos_rename_at_77)) && __need_loop_77;
+		// vel : float3&
+		das_iterator<TArray<float3>> __vel_iterator(__objects_rename_at_76.velocity);
+		float3 * __vel_rename_at_77;
+		__need_loop_77 = __vel_iterator.first(__context__,(__vel_rename_at_77)) && __need_loop_77;
+		for ( ; __need_loop_77 ; __need_loop_77 = __pos_iterator.next(__context__,(__pos_rename_at_77)) && __vel_iterator.next(__context__,(__vel_rename_at_77)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__pos_rename_at_77)),(*__vel_rename_at_77),*__context__);
+		}
+		__pos_iterator.close(__context__,(__pos_rename_at_77));
+		__vel_iterator.close(__context__,(__vel_rename_at_77));
+	};
+}
+
+inline void testVirtual_8db7e9fe5ed7f33a ( Context * __context__, TArray<struct CObject> &  __objects_rename_at_17 )
+{
+	{
+		bool __need_loop_18 = true;
+		// obj : CObject&
+		das_iterator<TArray<struct CObject>> __obj_iterator(__objects_rename_at_17);
+		struct CObject * __obj_rename_at_18;
+		__need_loop_18 = __obj_iterator.first(__context__,(__obj_rename_at_18)) && __need_loop_18;
+		for ( ; __need_loop_18 ; __need_loop_18 = __obj_iterator.next(__context__,(__obj_rename_at_18)) )
+		{
+			das_invoke_function<void>::invoke<struct CObject &>(__context__,(*__obj_rename_at_18).update,das_arg<struct CObject>::pass(das_cast<struct CObject>::cast((*__obj_rename_at_18))));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_18));
+	};
+}
+
+inline void testVirtual2_8f59d0c6dd444864 ( Context * __context__, TArray<struct CObject> &  __objects_rename_at_21, int32_t __count_rename_at_21 )
+{
+	{
+		bool __need_loop_22 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__count_rename_at_21));
+		int32_t __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			testVirtual_8db7e9fe5ed7f33a(__context__,das_arg<TArray<struct CObject>>::pass(__objects_rename_at_21));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+}
+
+inline void update_fe2eb4f455fd28f2 ( Context * __context__, struct NObject &  __a_rename_at_44 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_44.position),__a_rename_at_44.velocity,*__context__);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// CObject_7ceb8f902bde3913
+		aotLib[0xcf6831cadd1ef3a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct CObject (*) ( Context * __context__, int32_t  ),&CObject_7ceb8f902bde3913>>();
+	};
+		// _FuncCObject_0x27___finalize_f5cbf43d32bf4313
+		aotLib[0xc9211e7568df0b2b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct CObject &  ),&_FuncCObject_0x27___finalize_f5cbf43d32bf4313>>();
+	};
+		// _FuncCObject_0x60_CObject_56061226887192dd
+		aotLib[0x53ad98ba4242b415] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct CObject & , int32_t  ),&_FuncCObject_0x60_CObject_56061226887192dd>>();
+	};
+		// _FuncCObject_0x60_update_1d50b4de1a63635f
+		aotLib[0x2e52a3bfe42e1045] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct CObject &  ),&_FuncCObject_0x60_update_1d50b4de1a63635f>>();
+	};
+		// _Funcbuiltin_0x60_resize_a846d6ac5833aec2
+		aotLib[0x1a43b7d314fe872d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct CObject> & , int32_t  ),&_Funcbuiltin_0x60_resize_a846d6ac5833aec2>>();
+	};
+		// _Funcbuiltin_0x60_resize_895b2ff719a60fbf
+		aotLib[0xb7586077ac9dfa8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct NObject> & , int32_t  ),&_Funcbuiltin_0x60_resize_895b2ff719a60fbf>>();
+	};
+		// _Funcbuiltin_0x60_resize_d3b08ad0141c2c31
+		aotLib[0x6cbb6db64f4979] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_resize_d3b08ad0141c2c31>>();
+	};
+		// finalize_4d77d82602476a33
+		aotLib[0x21e65091a2d669e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct CObject &  ),&finalize_4d77d82602476a33>>();
+	};
+		// init_b9126b1109108a55
+		aotLib[0xfcca98fff01e23bb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct CObject> &  ),&init_b9126b1109108a55>>();
+	};
+		// init_69fa228145663536
+		aotLib[0x75dafa607c7516b4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct NObject> &  ),&init_69fa228145663536>>();
+	};
+		// init_a6c56e6d8b915237
+		aotLib[0x489604d041f3bff0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SObject_SOA &  ),&init_a6c56e6d8b915237>>();
+	};
+		// length_64fd9465ba70762e
+		aotLib[0xe7940669da48c3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct SObject_SOA const  &  ),&length_64fd9465ba70762e>>();
+	};
+		// resize_12204e27cf9c5bd6
+		aotLib[0x3da4f037ffe87b7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SObject_SOA & , int32_t  ),&resize_12204e27cf9c5bd6>>();
+	};
+		// test_2d6847c338618026
+		aotLib[0xb81be3617e02e80b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_2d6847c338618026>>();
+	};
+		// testMethod_a600be71db1e7e81
+		aotLib[0x73f34c111f8ce8f7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct CObject> &  ),&testMethod_a600be71db1e7e81>>();
+	};
+		// testMethod2_658d49f002c24c76
+		aotLib[0x54702cb69bf80a86] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct CObject> & , int32_t  ),&testMethod2_658d49f002c24c76>>();
+	};
+		// testSim_adfd4989f8d7ec33
+		aotLib[0x35c79f77568f2cd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct NObject> &  ),&testSim_adfd4989f8d7ec33>>();
+	};
+		// testSim2_7269cdc685f1eb24
+		aotLib[0xcfd69a2c50658b69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct NObject> & , int32_t  ),&testSim2_7269cdc685f1eb24>>();
+	};
+		// testSim2I_e53b966cc8eb55fc
+		aotLib[0x319a4ae8aeeb4026] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct NObject> & , int32_t  ),&testSim2I_e53b966cc8eb55fc>>();
+	};
+		// testSim2Soa_412c39d8902763e0
+		aotLib[0xfa678b564f66aa69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SObject_SOA & , int32_t  ),&testSim2Soa_412c39d8902763e0>>();
+	};
+		// testSimI_e97c626421e90fb9
+		aotLib[0xf57360ec23bd24ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct NObject> &  ),&testSimI_e97c626421e90fb9>>();
+	};
+		// testSimSoa_b64bd8fd7feecd28
+		aotLib[0xb51b6b4fabfd91c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SObject_SOA &  ),&testSimSoa_b64bd8fd7feecd28>>();
+	};
+		// testVirtual_8db7e9fe5ed7f33a
+		aotLib[0xf267fbaf0921924d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct CObject> &  ),&testVirtual_8db7e9fe5ed7f33a>>();
+	};
+		// testVirtual2_8f59d0c6dd444864
+		aotLib[0xcd2b700507264732] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct CObject> & , int32_t  ),&testVirtual2_8f59d0c6dd444864>>();
+	};
+		// update_fe2eb4f455fd28f2
+		aotLib[0x8c0c00cfb78a2ded] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct NObject &  ),&update_fe2eb4f455fd28f2>>();
+	};
+		// [[ init script ]]
+		aotLib[0x39726858ecaf3689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
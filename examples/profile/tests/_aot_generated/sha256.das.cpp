@@ -0,0 +1,347 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__a6c45d85;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__a6c45d85, &__type_info__3ffbf730 };
+
+inline void _Funcbuiltin_0x60_push_6f903bf56272d4e7 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_40, uint8_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_reserve_19ebb52049415d3b ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void digestBlock_b17dec9ac7d03036 ( Context * __context__, uint32_t * const  __data_rename_at_32, TDim<uint32_t,8> & __hash_rename_at_32 );
+inline char * const  sha256_ccb4de5af7d49f01 ( Context * __context__, TArray<uint8_t> const  & __msg_rename_at_75 );
+inline bool test_5e96a284f62d73ff ( Context * __context__ );
+inline char * const  toHex_64953700dda0e661 ( Context * __context__, TDim<uint32_t,8> const  & __hash_rename_at_26 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<TDim<uint32_t,64>,0>(__context__) = (([&]() -> TDim<uint32_t,64> {
+		TDim<uint32_t,64> __mka_7;
+		__mka_7(0,__context__) = 0x428a2f98u;
+		__mka_7(1,__context__) = 0x71374491u;
+		__mka_7(2,__context__) = 0xb5c0fbcfu;
+		__mka_7(3,__context__) = 0xe9b5dba5u;
+		__mka_7(4,__context__) = 0x3956c25bu;
+		__mka_7(5,__context__) = 0x59f111f1u;
+		__mka_7(6,__context__) = 0x923f82a4u;
+		__mka_7(7,__context__) = 0xab1c5ed5u;
+		__mka_7(8,__context__) = 0xd807aa98u;
+		__mka_7(9,__context__) = 0x12835b01u;
+		__mka_7(10,__context__) = 0x243185beu;
+		__mka_7(11,__context__) = 0x550c7dc3u;
+		__mka_7(12,__context__) = 0x72be5d74u;
+		__mka_7(13,__context__) = 0x80deb1feu;
+		__mka_7(14,__context__) = 0x9bdc06a7u;
+		__mka_7(15,__context__) = 0xc19bf174u;
+		__mka_7(16,__context__) = 0xe49b69c1u;
+		__mka_7(17,__context__) = 0xefbe4786u;
+		__mka_7(18,__context__) = 0xfc19dc6u;
+		__mka_7(19,__context__) = 0x240ca1ccu;
+		__mka_7(20,__context__) = 0x2de92c6fu;
+		__mka_7(21,__context__) = 0x4a7484aau;
+		__mka_7(22,__context__) = 0x5cb0a9dcu;
+		__mka_7(23,__context__) = 0x76f988dau;
+		__mka_7(24,__context__) = 0x983e5152u;
+		__mka_7(25,__context__) = 0xa831c66du;
+		__mka_7(26,__context__) = 0xb00327c8u;
+		__mka_7(27,__context__) = 0xbf597fc7u;
+		__mka_7(28,__context__) = 0xc6e00bf3u;
+		__mka_7(29,__context__) = 0xd5a79147u;
+		__mka_7(30,__context__) = 0x6ca6351u;
+		__mka_7(31,__context__) = 0x14292967u;
+		__mka_7(32,__context__) = 0x27b70a85u;
+		__mka_7(33,__context__) = 0x2e1b2138u;
+		__mka_7(34,__context__) = 0x4d2c6dfcu;
+		__mka_7(35,__context__) = 0x53380d13u;
+		__mka_7(36,__context__) = 0x650a7354u;
+		__mka_7(37,__context__) = 0x766a0abbu;
+		__mka_7(38,__context__) = 0x81c2c92eu;
+		__mka_7(39,__context__) = 0x92722c85u;
+		__mka_7(40,__context__) = 0xa2bfe8a1u;
+		__mka_7(41,__context__) = 0xa81a664bu;
+		__mka_7(42,__context__) = 0xc24b8b70u;
+		__mka_7(43,__context__) = 0xc76c51a3u;
+		__mka_7(44,__context__) = 0xd192e819u;
+		__mka_7(45,__context__) = 0xd6990624u;
+		__mka_7(46,__context__) = 0xf40e3585u;
+		__mka_7(47,__context__) = 0x106aa070u;
+		__mka_7(48,__context__) = 0x19a4c116u;
+		__mka_7(49,__context__) = 0x1e376c08u;
+		__mka_7(50,__context__) = 0x2748774cu;
+		__mka_7(51,__context__) = 0x34b0bcb5u;
+		__mka_7(52,__context__) = 0x391c0cb3u;
+		__mka_7(53,__context__) = 0x4ed8aa4au;
+		__mka_7(54,__context__) = 0x5b9cca4fu;
+		__mka_7(55,__context__) = 0x682e6ff3u;
+		__mka_7(56,__context__) = 0x748f82eeu;
+		__mka_7(57,__context__) = 0x78a5636fu;
+		__mka_7(58,__context__) = 0x84c87814u;
+		__mka_7(59,__context__) = 0x8cc70208u;
+		__mka_7(60,__context__) = 0x90befffau;
+		__mka_7(61,__context__) = 0xa4506cebu;
+		__mka_7(62,__context__) = 0xbef9a3f7u;
+		__mka_7(63,__context__) = 0xc67178f2u;
+		return __mka_7;
+	})());/*primes*/
+}
+
+inline void _Funcbuiltin_0x60_push_6f903bf56272d4e7 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_40, uint8_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,1,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_reserve_19ebb52049415d3b ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,1,__context__);
+}
+
+inline void digestBlock_b17dec9ac7d03036 ( Context * __context__, uint32_t * const  __data_rename_at_32, TDim<uint32_t,8> &  __hash_rename_at_32 )
+{
+	TDim<uint32_t,64> __digest_rename_at_33; das_zero(__digest_rename_at_33);
+	{
+		bool __need_loop_34 = true;
+		// j : int const
+		das_iterator<range> __j_iterator(range(0,16));
+		int32_t __j_rename_at_34;
+		__need_loop_34 = __j_iterator.first(__context__,(__j_rename_at_34)) && __need_loop_34;
+		for ( ; __need_loop_34 ; __need_loop_34 = __j_iterator.next(__context__,(__j_rename_at_34)) )
+		{
+			das_copy(__digest_rename_at_33(__j_rename_at_34,__context__),das_index<uint32_t * const >::at(__data_rename_at_32,__j_rename_at_34,__context__));
+		}
+		__j_iterator.close(__context__,(__j_rename_at_34));
+	};
+	{
+		bool __need_loop_37 = true;
+		// j : int const
+		das_iterator<range> __j_iterator(range(16,64));
+		int32_t __j_rename_at_37;
+		__need_loop_37 = __j_iterator.first(__context__,(__j_rename_at_37)) && __need_loop_37;
+		for ( ; __need_loop_37 ; __need_loop_37 = __j_iterator.next(__context__,(__j_rename_at_37)) )
+		{
+			uint32_t __v0_rename_at_38 = (uint32_t)__digest_rename_at_33((__j_rename_at_37 - 15),__context__);
+			uint32_t __s0_rename_at_39 = (uint32_t)(((SimPolicy<uint32_t>::BinRotr(__v0_rename_at_38,0x7u,*__context__)) ^ (SimPolicy<uint32_t>::BinRotr(__v0_rename_at_38,0x12u,*__context__))) ^ (__v0_rename_at_38 >> 0x3u));
+			uint32_t __v1_rename_at_40 = (uint32_t)__digest_rename_at_33((__j_rename_at_37 - 2),__context__);
+			uint32_t __s1_rename_at_41 = (uint32_t)(((SimPolicy<uint32_t>::BinRotr(__v1_rename_at_40,0x11u,*__context__)) ^ (SimPolicy<uint32_t>::BinRotr(__v1_rename_at_40,0x13u,*__context__))) ^ (__v1_rename_at_40 >> 0xau));
+			das_copy(__digest_rename_at_33(__j_rename_at_37,__context__),((__digest_rename_at_33((__j_rename_at_37 - 16),__context__) + __s0_rename_at_39) + __digest_rename_at_33((__j_rename_at_37 - 7),__context__)) + __s1_rename_at_41);
+		}
+		__j_iterator.close(__context__,(__j_rename_at_37));
+	};
+	uint32_t __a_rename_at_43 = __hash_rename_at_32(0,__context__);
+	uint32_t __b_rename_at_44 = __hash_rename_at_32(1,__context__);
+	uint32_t __c_rename_at_45 = __hash_rename_at_32(2,__context__);
+	uint32_t __d_rename_at_46 = __hash_rename_at_32(3,__context__);
+	uint32_t __e_rename_at_47 = __hash_rename_at_32(4,__context__);
+	uint32_t __f_rename_at_48 = __hash_rename_at_32(5,__context__);
+	uint32_t __g_rename_at_49 = __hash_rename_at_32(6,__context__);
+	uint32_t __h_rename_at_50 = __hash_rename_at_32(7,__context__);
+	{
+		bool __need_loop_51 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,64));
+		int32_t __i_rename_at_51;
+		__need_loop_51 = __i_iterator.first(__context__,(__i_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __i_iterator.next(__context__,(__i_rename_at_51)) )
+		{
+			uint32_t __s0_rename_at_52 = (uint32_t)(((SimPolicy<uint32_t>::BinRotr(__a_rename_at_43,0x2u,*__context__)) ^ (SimPolicy<uint32_t>::BinRotr(__a_rename_at_43,0xdu,*__context__))) ^ (SimPolicy<uint32_t>::BinRotr(__a_rename_at_43,0x16u,*__context__)));
+			uint32_t __maj_rename_at_53 = (uint32_t)(((__a_rename_at_43 & __b_rename_at_44) ^ (__a_rename_at_43 & __c_rename_at_45)) ^ (__b_rename_at_44 & __c_rename_at_45));
+			uint32_t __t2_rename_at_54 = (uint32_t)(__s0_rename_at_52 + __maj_rename_at_53);
+			uint32_t __s1_rename_at_55 = (uint32_t)(((SimPolicy<uint32_t>::BinRotr(__e_rename_at_47,0x6u,*__context__)) ^ (SimPolicy<uint32_t>::BinRotr(__e_rename_at_47,0xbu,*__context__))) ^ (SimPolicy<uint32_t>::BinRotr(__e_rename_at_47,0x19u,*__context__)));
+			uint32_t __ch_rename_at_56 = (uint32_t)((__e_rename_at_47 & __f_rename_at_48) ^ (~__e_rename_at_47 & __g_rename_at_49));
+			uint32_t __t1_rename_at_57 = (uint32_t)((((__h_rename_at_50 + __s1_rename_at_55) + __ch_rename_at_56) + das_global<TDim<uint32_t,64>,0>(__context__) /*primes*/(__i_rename_at_51,__context__)) + __digest_rename_at_33(__i_rename_at_51,__context__));
+			das_copy(__h_rename_at_50,__g_rename_at_49);
+			das_copy(__g_rename_at_49,__f_rename_at_48);
+			das_copy(__f_rename_at_48,__e_rename_at_47);
+			das_copy(__e_rename_at_47,__d_rename_at_46 + __t1_rename_at_57);
+			das_copy(__d_rename_at_46,__c_rename_at_45);
+			das_copy(__c_rename_at_45,__b_rename_at_44);
+			das_copy(__b_rename_at_44,__a_rename_at_43);
+			das_copy(__a_rename_at_43,__t1_rename_at_57 + __t2_rename_at_54);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_51));
+	};
+	__hash_rename_at_32(0,__context__) += __a_rename_at_43;
+	__hash_rename_at_32(1,__context__) += __b_rename_at_44;
+	__hash_rename_at_32(2,__context__) += __c_rename_at_45;
+	__hash_rename_at_32(3,__context__) += __d_rename_at_46;
+	__hash_rename_at_32(4,__context__) += __e_rename_at_47;
+	__hash_rename_at_32(5,__context__) += __f_rename_at_48;
+	__hash_rename_at_32(6,__context__) += __g_rename_at_49;
+	__hash_rename_at_32(7,__context__) += __h_rename_at_50;
+}
+
+inline char * const  sha256_ccb4de5af7d49f01 ( Context * __context__, TArray<uint8_t> const  &  __msg_rename_at_75 )
+{
+	TDim<uint32_t,8> __hash_rename_at_76 = (([&]() -> TDim<uint32_t,8> {
+		TDim<uint32_t,8> __mka_76;
+		__mka_76(0,__context__) = 0x6a09e667u;
+		__mka_76(1,__context__) = 0xbb67ae85u;
+		__mka_76(2,__context__) = 0x3c6ef372u;
+		__mka_76(3,__context__) = 0xa54ff53au;
+		__mka_76(4,__context__) = 0x510e527fu;
+		__mka_76(5,__context__) = 0x9b05688cu;
+		__mka_76(6,__context__) = 0x1f83d9abu;
+		__mka_76(7,__context__) = 0x5be0cd19u;
+		return __mka_76;
+	})());
+	int32_t __len_rename_at_86 = (int32_t)(SimPolicy<int32_t>::Div(builtin_array_size(__msg_rename_at_75),64,*__context__));
+	{
+		bool __need_loop_87 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__len_rename_at_86));
+		int32_t __i_rename_at_87;
+		__need_loop_87 = __i_iterator.first(__context__,(__i_rename_at_87)) && __need_loop_87;
+		for ( ; __need_loop_87 ; __need_loop_87 = __i_iterator.next(__context__,(__i_rename_at_87)) )
+		{
+			digestBlock_b17dec9ac7d03036(__context__,das_cast<uint32_t *>::cast(das_ref(__context__,__msg_rename_at_75((__i_rename_at_87 * 64),__context__))),das_arg<TDim<uint32_t,8>>::pass(__hash_rename_at_76));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_87));
+	};
+	return toHex_64953700dda0e661(__context__,das_arg<TDim<uint32_t,8>>::pass(__hash_rename_at_76));
+}
+
+inline bool test_5e96a284f62d73ff ( Context * __context__ ) { das_stack_prologue __prologue(__context__,256,"test " DAS_FILE_LINE);
+{
+	TArray<uint8_t> __input_rename_at_94; das_zero(__input_rename_at_94); das_move(__input_rename_at_94, (TArray<uint8_t>)das_invoke<TArray<uint8_t>>::invoke_cmres(__context__,[&]()->TArray<uint8_t>{
+		TArray<uint8_t> ____acomp_94_rename_at_94; das_zero(____acomp_94_rename_at_94);
+		_Funcbuiltin_0x60_reserve_19ebb52049415d3b(__context__,das_arg<TArray<uint8_t>>::pass(____acomp_94_rename_at_94),1024);
+		{
+			bool __need_loop_94 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1024));
+			int32_t __i_rename_at_94;
+			__need_loop_94 = __i_iterator.first(__context__,(__i_rename_at_94)) && __need_loop_94;
+			for ( ; __need_loop_94 ; __need_loop_94 = __i_iterator.next(__context__,(__i_rename_at_94)) )
+			{
+				_Funcbuiltin_0x60_push_6f903bf56272d4e7(__context__,das_arg<TArray<uint8_t>>::pass(____acomp_94_rename_at_94),uint8_t(46),-1);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_94));
+		};
+		return /* <- */ ____acomp_94_rename_at_94;
+	}));
+	float __dt_rename_at_95 = (float)builtin_profile(20,((char *) "sha256"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_96 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1024));
+			int32_t __i_rename_at_96;
+			__need_loop_96 = __i_iterator.first(__context__,(__i_rename_at_96)) && __need_loop_96;
+			for ( ; __need_loop_96 ; __need_loop_96 = __i_iterator.next(__context__,(__i_rename_at_96)) )
+			{
+				sha256_ccb4de5af7d49f01(__context__,__input_rename_at_94);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_96));
+		};
+	}),__context__);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(sha256_ccb4de5af7d49f01(__context__,__input_rename_at_94)),cast<char *>::from(((char *) "8adcaee60bb05a9964a1df12d2f007adcb8f3fa20ff7d1ecfde0a2ac301ff412")),*__context__)));
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<float>::from((SimPolicy<float>::Div(1.f,__dt_rename_at_95,*__context__))), cast<char * const >::from(((char *) " mb/sec\n")))),__context__);
+	return true;
+}}
+
+inline char * const  toHex_64953700dda0e661 ( Context * __context__, TDim<uint32_t,8> const  &  __hash_rename_at_26 )
+{
+	char * __st_rename_at_27 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_27)->void{
+		{
+			bool __need_loop_28 = true;
+			// i : uint const&
+			das_iterator<TDim<uint32_t,8> const > __i_iterator(__hash_rename_at_26);
+			uint32_t const  * __i_rename_at_28;
+			__need_loop_28 = __i_iterator.first(__context__,(__i_rename_at_28)) && __need_loop_28;
+			for ( ; __need_loop_28 ; __need_loop_28 = __i_iterator.next(__context__,(__i_rename_at_28)) )
+			{
+				format_and_write<uint32_t>(das_arg<StringBuilderWriter>::pass(__writer_rename_at_27),((char *) "%08x"),(*__i_rename_at_28));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_28));
+		};
+	},__context__))));
+	return __st_rename_at_27;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_push_6f903bf56272d4e7
+		aotLib[0x4ba69093003e2a9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , uint8_t , int32_t  ),&_Funcbuiltin_0x60_push_6f903bf56272d4e7>>();
+	};
+		// _Funcbuiltin_0x60_reserve_19ebb52049415d3b
+		aotLib[0x87a0223316988e7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_19ebb52049415d3b>>();
+	};
+		// digestBlock_b17dec9ac7d03036
+		aotLib[0xf34d455e6adb7681] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, uint32_t * const  , TDim<uint32_t,8> &  ),&digestBlock_b17dec9ac7d03036>>();
+	};
+		// sha256_ccb4de5af7d49f01
+		aotLib[0x51ef8f1b8b100cf6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<uint8_t> const  &  ),&sha256_ccb4de5af7d49f01>>();
+	};
+		// test_5e96a284f62d73ff
+		aotLib[0xa775d2957ee74d58] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5e96a284f62d73ff>>();
+	};
+		// toHex_64953700dda0e661
+		aotLib[0xd0b74db2a0729115] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&toHex_64953700dda0e661>>();
+	};
+		// [[ init script ]]
+		aotLib[0x717744632b97349b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,549 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+ // require small_array
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure SmallArrayMacro
+// unused structure SmallArrayRewriteMacro
+// unused structure SmallArrayVisitor
+namespace  {
+
+struct Tags {
+	TDim<int32_t,4> items;
+	int32_t _count;
+	TArray<int32_t> _heap;
+};
+static_assert(sizeof(Tags)==48,"structure size mismatch with DAS");
+static_assert(offsetof(Tags,items)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Tags,_count)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Tags,_heap)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct EntityArray {
+	TArray<int32_t> tags;
+};
+static_assert(sizeof(EntityArray)==24,"structure size mismatch with DAS");
+static_assert(offsetof(EntityArray,tags)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct EntitySmall {
+	struct Tags tags;
+};
+static_assert(sizeof(EntitySmall)==48,"structure size mismatch with DAS");
+static_assert(offsetof(EntitySmall,tags)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_emplace_f3054aa6951dfab9 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_69, int32_t __value_rename_at_69, int32_t __at_rename_at_69 );
+inline void _Funcbuiltin_0x60_finalize_fa6e8d78a42e0801 ( Context * __context__, TArray<struct EntityArray> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_795b5c453a684ea1 ( Context * __context__, TArray<struct EntitySmall> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_clone_76ab6a8882326f97 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_1c3ab32c1470f528 ( Context * __context__, TArray<struct EntityArray> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_f525ab2b6fa7be56 ( Context * __context__, TArray<struct EntitySmall> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void clear_19073dc6c4a047c4 ( Context * __context__, struct Tags & __a_rename_at_10 );
+inline void finalize_fe688e4a374bed17 ( Context * __context__, struct EntityArray & ____this_rename_at_13 );
+inline void finalize_671d30f7ddee4dd0 ( Context * __context__, struct EntitySmall & ____this_rename_at_16 );
+inline void finalize_fee601dbe1903ada ( Context * __context__, struct Tags & ____this_rename_at_10 );
+inline void push_59d6819997126171 ( Context * __context__, struct Tags & __a_rename_at_10, int32_t __value_rename_at_10 );
+inline void _Funcsmall_array_0x60_small_array_clear_766fcf15f6a7653d ( Context * __context__, TDim<int32_t,4> & __data_rename_at_89, int32_t & __count_rename_at_89, TArray<int32_t> & __heap_rename_at_89 );
+inline void _Funcsmall_array_0x60_small_array_push_a3b9101e3bdcdcf4 ( Context * __context__, TDim<int32_t,4> & __data_rename_at_65, int32_t & __count_rename_at_65, TArray<int32_t> & __heap_rename_at_65, int32_t __value_rename_at_65 );
+inline int32_t sum_array_7aa7b718456a9b00 ( Context * __context__, TArray<struct EntityArray> const  & __entities_rename_at_34 );
+inline int32_t sum_small_363774f54cafcb4 ( Context * __context__, TArray<struct EntitySmall> & __entities_rename_at_42 );
+inline void tag_array_55dd313942eb3104 ( Context * __context__, TArray<struct EntityArray> & __entities_rename_at_20 );
+inline void tag_small_13f50f6396072bfd ( Context * __context__, TArray<struct EntitySmall> & __entities_rename_at_27 );
+inline bool test_8b6d0127796de1ed ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_emplace_f3054aa6951dfab9 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_69, int32_t __value_rename_at_69, int32_t __at_rename_at_69 )
+{
+	das_move(__Arr_rename_at_69(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_69),__at_rename_at_69,4,__context__),__context__),__value_rename_at_69);
+}
+
+inline void _Funcbuiltin_0x60_finalize_fa6e8d78a42e0801 ( Context * __context__, TArray<struct EntityArray> &  __a_rename_at_280 )
+{
+	{
+		bool __need_loop_282 = true;
+		// aV : EntityArray aka TT&
+		das_iterator<TArray<struct EntityArray>> __aV_iterator(__a_rename_at_280);
+		struct EntityArray * __aV_rename_at_282;
+		__need_loop_282 = __aV_iterator.first(__context__,(__aV_rename_at_282)) && __need_loop_282;
+		for ( ; __need_loop_282 ; __need_loop_282 = __aV_iterator.next(__context__,(__aV_rename_at_282)) )
+		{
+			finalize_fe688e4a374bed17(__context__,das_arg<struct EntityArray>::pass((*__aV_rename_at_282)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_282));
+	};
+	builtin_array_free(das_arg<TArray<struct EntityArray>>::pass(__a_rename_at_280),24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_795b5c453a684ea1 ( Context * __context__, TArray<struct EntitySmall> &  __a_rename_at_280 )
+{
+	{
+		bool __need_loop_282 = true;
+		// aV : EntitySmall aka TT&
+		das_iterator<TArray<struct EntitySmall>> __aV_iterator(__a_rename_at_280);
+		struct EntitySmall * __aV_rename_at_282;
+		__need_loop_282 = __aV_iterator.first(__context__,(__aV_rename_at_282)) && __need_loop_282;
+		for ( ; __need_loop_282 ; __need_loop_282 = __aV_iterator.next(__context__,(__aV_rename_at_282)) )
+		{
+			finalize_671d30f7ddee4dd0(__context__,das_arg<struct EntitySmall>::pass((*__aV_rename_at_282)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_282));
+	};
+	builtin_array_free(das_arg<TArray<struct EntitySmall>>::pass(__a_rename_at_280),48,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_280),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_76ab6a8882326f97 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),__at_rename_at_75,4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1c3ab32c1470f528 ( Context * __context__, TArray<struct EntityArray> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct EntityArray>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_f525ab2b6fa7be56 ( Context * __context__, TArray<struct EntitySmall> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct EntitySmall>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,48,__context__);
+}
+
+inline void clear_19073dc6c4a047c4 ( Context * __context__, struct Tags &  __a_rename_at_10 )
+{
+	_Funcsmall_array_0x60_small_array_clear_766fcf15f6a7653d(__context__,das_arg<TDim<int32_t,4>>::pass(__a_rename_at_10.items),__a_rename_at_10._count,das_arg<TArray<int32_t>>::pass(__a_rename_at_10._heap));
+}
+
+inline void finalize_fe688e4a374bed17 ( Context * __context__, struct EntityArray &  ____this_rename_at_13 )
+{
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_13.tags));
+	memset(&(____this_rename_at_13), 0, 24);
+}
+
+inline void finalize_671d30f7ddee4dd0 ( Context * __context__, struct EntitySmall &  ____this_rename_at_16 )
+{
+	finalize_fee601dbe1903ada(__context__,das_arg<struct Tags>::pass(____this_rename_at_16.tags));
+	memset(&(____this_rename_at_16), 0, 48);
+}
+
+inline void finalize_fee601dbe1903ada ( Context * __context__, struct Tags &  ____this_rename_at_10 )
+{
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_10._heap));
+	memset(&(____this_rename_at_10), 0, 48);
+}
+
+inline void push_59d6819997126171 ( Context * __context__, struct Tags &  __a_rename_at_10, int32_t __value_rename_at_10 )
+{
+	_Funcsmall_array_0x60_small_array_push_a3b9101e3bdcdcf4(__context__,das_arg<TDim<int32_t,4>>::pass(__a_rename_at_10.items),__a_rename_at_10._count,das_arg<TArray<int32_t>>::pass(__a_rename_at_10._heap),__value_rename_at_10);
+}
+
+inline void _Funcsmall_array_0x60_small_array_clear_766fcf15f6a7653d ( Context * __context__, TDim<int32_t,4> &  __data_rename_at_89, int32_t & __count_rename_at_89, TArray<int32_t> &  __heap_rename_at_89 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__heap_rename_at_89)) != 0 )
+	{
+		builtin_array_clear(das_arg<TArray<int32_t>>::pass(__heap_rename_at_89),__context__);
+	};
+	das_copy(__count_rename_at_89,0);
+}
+
+inline void _Funcsmall_array_0x60_small_array_push_a3b9101e3bdcdcf4 ( Context * __context__, TDim<int32_t,4> &  __data_rename_at_65, int32_t & __count_rename_at_65, TArray<int32_t> &  __heap_rename_at_65, int32_t __value_rename_at_65 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__heap_rename_at_65)) != 0 )
+	{
+		_Funcbuiltin_0x60_push_clone_76ab6a8882326f97(__context__,das_arg<TArray<int32_t>>::pass(__heap_rename_at_65),__value_rename_at_65,-1);
+	} else if ( __count_rename_at_65 < 4 )
+	{
+		das_copy(__data_rename_at_65(__count_rename_at_65,__context__),__value_rename_at_65);
+	} else {
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__heap_rename_at_65),__count_rename_at_65 * 2);
+		{
+			bool __need_loop_72 = true;
+			// x : int aka TT&
+			das_iterator<TDim<int32_t,4>> __x_iterator(__data_rename_at_65);
+			int32_t * __x_rename_at_72;
+			__need_loop_72 = __x_iterator.first(__context__,(__x_rename_at_72)) && __need_loop_72;
+			for ( ; __need_loop_72 ; __need_loop_72 = __x_iterator.next(__context__,(__x_rename_at_72)) )
+			{
+				_Funcbuiltin_0x60_emplace_f3054aa6951dfab9(__context__,das_arg<TArray<int32_t>>::pass(__heap_rename_at_65),(*__x_rename_at_72),-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_72));
+		};
+		_Funcbuiltin_0x60_push_clone_76ab6a8882326f97(__context__,das_arg<TArray<int32_t>>::pass(__heap_rename_at_65),__value_rename_at_65,-1);
+	};
+	__count_rename_at_65++;
+}
+
+inline int32_t sum_array_7aa7b718456a9b00 ( Context * __context__, TArray<struct EntityArray> const  &  __entities_rename_at_34 )
+{
+	int32_t __total_rename_at_35 = 0;
+	{
+		bool __need_loop_36 = true;
+		// e : EntityArray const&
+		das_iterator<TArray<struct EntityArray> const > __e_iterator(__entities_rename_at_34);
+		struct EntityArray const  * __e_rename_at_36;
+		__need_loop_36 = __e_iterator.first(__context__,(__e_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = __e_iterator.next(__context__,(__e_rename_at_36)) )
+		{
+			{
+				bool __need_loop_37 = true;
+				// t : int const&
+				das_iterator<TArray<int32_t> const > __t_iterator((*__e_rename_at_36).tags);
+				int32_t const  * __t_rename_at_37;
+				__need_loop_37 = __t_iterator.first(__context__,(__t_rename_at_37)) && __need_loop_37;
+				for ( ; __need_loop_37 ; __need_loop_37 = __t_iterator.next(__context__,(__t_rename_at_37)) )
+				{
+					__total_rename_at_35 += (*__t_rename_at_37);
+				}
+				__t_iterator.close(__context__,(__t_rename_at_37));
+			};
+		}
+		__e_iterator.close(__context__,(__e_rename_at_36));
+	};
+	return __total_rename_at_35;
+}
+
+inline int32_t sum_small_363774f54cafcb4 ( Context * __context__, TArray<struct EntitySmall> &  __entities_rename_at_42 )
+{
+	int32_t __total_rename_at_43 = 0;
+	{
+		bool __need_loop_44 = true;
+		// e : EntitySmall&
+		das_iterator<TArray<struct EntitySmall>> __e_iterator(__entities_rename_at_42);
+		struct EntitySmall * __e_rename_at_44;
+		__need_loop_44 = __e_iterator.first(__context__,(__e_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __e_iterator.next(__context__,(__e_rename_at_44)) )
+		{
+			if ( builtin_array_size(das_arg<TArray<int32_t>>::pass((*__e_rename_at_44).tags._heap)) != 0 )
+			{
+				{
+					bool __need_loop_45 = true;
+					// t : int&
+					das_iterator<TArray<int32_t>> __t_iterator((*__e_rename_at_44).tags._heap);
+					int32_t * __t_rename_at_45;
+					__need_loop_45 = __t_iterator.first(__context__,(__t_rename_at_45)) && __need_loop_45;
+					for ( ; __need_loop_45 ; __need_loop_45 = __t_iterator.next(__context__,(__t_rename_at_45)) )
+					{
+						__total_rename_at_43 += (*__t_rename_at_45);
+					}
+					__t_iterator.close(__context__,(__t_rename_at_45));
+				};
+			} else {
+				{
+					bool __need_loop_45 = true;
+					// __sa_index0 : int const
+					das_iterator<range> ____sa_index0_iterator(range(0,(*__e_rename_at_44).tags._count));
+					int32_t ____sa_index0_rename_at_45;
+					__need_loop_45 = ____sa_index0_iterator.first(__context__,(____sa_index0_rename_at_45)) && __need_loop_45;
+					for ( ; __need_loop_45 ; __need_loop_45 = ____sa_index0_iterator.next(__context__,(____sa_index0_rename_at_45)) )
+					{
+						int32_t * __t_rename_at_45 = &((*__e_rename_at_44).tags.items(____sa_index0_rename_at_45,__context__));
+						__total_rename_at_43 += (*__t_rename_at_45);
+					}
+					____sa_index0_iterator.close(__context__,(____sa_index0_rename_at_45));
+				};
+			};
+		}
+		__e_iterator.close(__context__,(__e_rename_at_44));
+	};
+	return __total_rename_at_43;
+}
+
+inline void tag_array_55dd313942eb3104 ( Context * __context__, TArray<struct EntityArray> &  __entities_rename_at_20 )
+{
+	{
+		bool __need_loop_21 = true;
+		// e : EntityArray&
+		das_iterator<TArray<struct EntityArray>> __e_iterator(__entities_rename_at_20);
+		struct EntityArray * __e_rename_at_21;
+		__need_loop_21 = __e_iterator.first(__context__,(__e_rename_at_21)) && __need_loop_21;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_21;
+		__need_loop_21 = __i_iterator.first(__context__,(__i_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __e_iterator.next(__context__,(__e_rename_at_21)) && __i_iterator.next(__context__,(__i_rename_at_21)) )
+		{
+			builtin_array_clear(das_arg<TArray<int32_t>>::pass((*__e_rename_at_21).tags),__context__);
+			{
+				bool __need_loop_23 = true;
+				// t : int const
+				das_iterator<range> __t_iterator(range(0,3));
+				int32_t __t_rename_at_23;
+				__need_loop_23 = __t_iterator.first(__context__,(__t_rename_at_23)) && __need_loop_23;
+				for ( ; __need_loop_23 ; __need_loop_23 = __t_iterator.next(__context__,(__t_rename_at_23)) )
+				{
+					_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass((*__e_rename_at_21).tags),__i_rename_at_21 + __t_rename_at_23,-1);
+				}
+				__t_iterator.close(__context__,(__t_rename_at_23));
+			};
+		}
+		__e_iterator.close(__context__,(__e_rename_at_21));
+		__i_iterator.close(__context__,(__i_rename_at_21));
+	};
+}
+
+inline void tag_small_13f50f6396072bfd ( Context * __context__, TArray<struct EntitySmall> &  __entities_rename_at_27 )
+{
+	{
+		bool __need_loop_28 = true;
+		// e : EntitySmall&
+		das_iterator<TArray<struct EntitySmall>> __e_iterator(__entities_rename_at_27);
+		struct EntitySmall * __e_rename_at_28;
+		__need_loop_28 = __e_iterator.first(__context__,(__e_rename_at_28)) && __need_loop_28;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_28;
+		__need_loop_28 = __i_iterator.first(__context__,(__i_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __e_iterator.next(__context__,(__e_rename_at_28)) && __i_iterator.next(__context__,(__i_rename_at_28)) )
+		{
+			clear_19073dc6c4a047c4(__context__,das_arg<struct Tags>::pass((*__e_rename_at_28).tags));
+			{
+				bool __need_loop_30 = true;
+				// t : int const
+				das_iterator<range> __t_iterator(range(0,3));
+				int32_t __t_rename_at_30;
+				__need_loop_30 = __t_iterator.first(__context__,(__t_rename_at_30)) && __need_loop_30;
+				for ( ; __need_loop_30 ; __need_loop_30 = __t_iterator.next(__context__,(__t_rename_at_30)) )
+				{
+					push_59d6819997126171(__context__,das_arg<struct Tags>::pass((*__e_rename_at_28).tags),__i_rename_at_28 + __t_rename_at_30);
+				}
+				__t_iterator.close(__context__,(__t_rename_at_30));
+			};
+		}
+		__e_iterator.close(__context__,(__e_rename_at_28));
+		__i_iterator.close(__context__,(__i_rename_at_28));
+	};
+}
+
+inline bool test_8b6d0127796de1ed ( Context * __context__ ) { das_stack_prologue __prologue(__context__,352,"test " DAS_FILE_LINE);
+{
+	TArray<struct EntityArray> __ea_rename_at_51; das_zero(__ea_rename_at_51);
+	TArray<struct EntitySmall> __es_rename_at_52; das_zero(__es_rename_at_52);
+	_Funcbuiltin_0x60_resize_1c3ab32c1470f528(__context__,das_arg<TArray<struct EntityArray>>::pass(__ea_rename_at_51),10000);
+	_Funcbuiltin_0x60_resize_f525ab2b6fa7be56(__context__,das_arg<TArray<struct EntitySmall>>::pass(__es_rename_at_52),10000);
+	tag_array_55dd313942eb3104(__context__,das_arg<TArray<struct EntityArray>>::pass(__ea_rename_at_51));
+	tag_small_13f50f6396072bfd(__context__,das_arg<TArray<struct EntitySmall>>::pass(__es_rename_at_52));
+	DAS_VERIFY((sum_array_7aa7b718456a9b00(__context__,das_arg<TArray<struct EntityArray>>::pass(__ea_rename_at_51)) == sum_small_363774f54cafcb4(__context__,das_arg<TArray<struct EntitySmall>>::pass(__es_rename_at_52))));
+	builtin_profile(20,((char *) "tag lists, array"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		TArray<struct EntityArray> __entities_rename_at_59; das_zero(__entities_rename_at_59);
+		_Funcbuiltin_0x60_resize_1c3ab32c1470f528(__context__,das_arg<TArray<struct EntityArray>>::pass(__entities_rename_at_59),10000);
+		tag_array_55dd313942eb3104(__context__,das_arg<TArray<struct EntityArray>>::pass(__entities_rename_at_59));
+		_Funcbuiltin_0x60_finalize_fa6e8d78a42e0801(__context__,das_arg<TArray<struct EntityArray>>::pass(__entities_rename_at_59));
+	}),__context__);
+	builtin_profile(20,((char *) "tag lists, small_array"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		TArray<struct EntitySmall> __entities_rename_at_64; das_zero(__entities_rename_at_64);
+		_Funcbuiltin_0x60_resize_f525ab2b6fa7be56(__context__,das_arg<TArray<struct EntitySmall>>::pass(__entities_rename_at_64),10000);
+		tag_small_13f50f6396072bfd(__context__,das_arg<TArray<struct EntitySmall>>::pass(__entities_rename_at_64));
+		_Funcbuiltin_0x60_finalize_795b5c453a684ea1(__context__,das_arg<TArray<struct EntitySmall>>::pass(__entities_rename_at_64));
+	}),__context__);
+	builtin_profile(20,((char *) "tag lists, array iteration"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sum_array_7aa7b718456a9b00(__context__,das_arg<TArray<struct EntityArray>>::pass(__ea_rename_at_51));
+	}),__context__);
+	builtin_profile(20,((char *) "tag lists, small_array iteration"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sum_small_363774f54cafcb4(__context__,das_arg<TArray<struct EntitySmall>>::pass(__es_rename_at_52));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_fa6e8d78a42e0801(__context__,das_arg<TArray<struct EntityArray>>::pass(__ea_rename_at_51));
+	_Funcbuiltin_0x60_finalize_795b5c453a684ea1(__context__,das_arg<TArray<struct EntitySmall>>::pass(__es_rename_at_52));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_emplace_f3054aa6951dfab9
+		aotLib[0x1820c8c418295ac9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_emplace_f3054aa6951dfab9>>();
+	};
+		// _Funcbuiltin_0x60_finalize_fa6e8d78a42e0801
+		aotLib[0x9f25d77d10ba412] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct EntityArray> &  ),&_Funcbuiltin_0x60_finalize_fa6e8d78a42e0801>>();
+	};
+		// _Funcbuiltin_0x60_finalize_795b5c453a684ea1
+		aotLib[0x6f9ede6092e8fad4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct EntitySmall> &  ),&_Funcbuiltin_0x60_finalize_795b5c453a684ea1>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_76ab6a8882326f97
+		aotLib[0x20e0f7bfb5006d89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_clone_76ab6a8882326f97>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_resize_1c3ab32c1470f528
+		aotLib[0x3ffa4de2b9cbb015] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct EntityArray> & , int32_t  ),&_Funcbuiltin_0x60_resize_1c3ab32c1470f528>>();
+	};
+		// _Funcbuiltin_0x60_resize_f525ab2b6fa7be56
+		aotLib[0x958ddf73daa14521] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct EntitySmall> & , int32_t  ),&_Funcbuiltin_0x60_resize_f525ab2b6fa7be56>>();
+	};
+		// clear_19073dc6c4a047c4
+		aotLib[0x2a7c3a2eb85ce3ef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Tags &  ),&clear_19073dc6c4a047c4>>();
+	};
+		// finalize_fe688e4a374bed17
+		aotLib[0xca9a4fefb6d96b36] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct EntityArray &  ),&finalize_fe688e4a374bed17>>();
+	};
+		// finalize_671d30f7ddee4dd0
+		aotLib[0xf61d3efa6348599] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct EntitySmall &  ),&finalize_671d30f7ddee4dd0>>();
+	};
+		// finalize_fee601dbe1903ada
+		aotLib[0x265c1d6e430871f6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Tags &  ),&finalize_fee601dbe1903ada>>();
+	};
+		// push_59d6819997126171
+		aotLib[0x1acd09e1eb4ffd3b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Tags & , int32_t  ),&push_59d6819997126171>>();
+	};
+		// _Funcsmall_array_0x60_small_array_clear_766fcf15f6a7653d
+		aotLib[0xcd55e1d82427fc75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> & , int32_t & , TArray<int32_t> &  ),&_Funcsmall_array_0x60_small_array_clear_766fcf15f6a7653d>>();
+	};
+		// _Funcsmall_array_0x60_small_array_push_a3b9101e3bdcdcf4
+		aotLib[0xe1bede542d5e9904] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> & , int32_t & , TArray<int32_t> & , int32_t  ),&_Funcsmall_array_0x60_small_array_push_a3b9101e3bdcdcf4>>();
+	};
+		// sum_array_7aa7b718456a9b00
+		aotLib[0xce55c80271e39e75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<struct EntityArray> const  &  ),&sum_array_7aa7b718456a9b00>>();
+	};
+		// sum_small_363774f54cafcb4
+		aotLib[0x1ee97b1356046c6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<struct EntitySmall> &  ),&sum_small_363774f54cafcb4>>();
+	};
+		// tag_array_55dd313942eb3104
+		aotLib[0x53efaafa5030a63a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct EntityArray> &  ),&tag_array_55dd313942eb3104>>();
+	};
+		// tag_small_13f50f6396072bfd
+		aotLib[0xcc62b1bf2971d98f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct EntitySmall> &  ),&tag_small_13f50f6396072bfd>>();
+	};
+		// test_8b6d0127796de1ed
+		aotLib[0xf216697f91a712c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_8b6d0127796de1ed>>();
+	};
+		// [[ init script ]]
+		aotLib[0x2842b25bbd1182e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,503 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+ // require soa
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure SoaIndexMacro
+// unused structure SoaIndexVisitor
+// unused structure SoaLoopIterator
+// unused structure SoaStructMacro
+namespace  {
+
+struct Entity {
+	float3 position;
+	float3 velocity;
+	float3 color;
+	float3 scale;
+	float3 rotation;
+	float3 pivot;
+	float3 bounds_min;
+	float3 bounds_max;
+	float3 target;
+	float3 normal;
+	float3 tangent;
+	float3 extra;
+};
+static_assert(sizeof(Entity)==144,"structure size mismatch with DAS");
+static_assert(offsetof(Entity,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,velocity)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,color)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,scale)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,rotation)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,pivot)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,bounds_min)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,bounds_max)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,target)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,normal)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,tangent)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity,extra)==132,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Entity_SOA {
+	TArray<float3> position;
+	TArray<float3> velocity;
+	TArray<float3> color;
+	TArray<float3> scale;
+	TArray<float3> rotation;
+	TArray<float3> pivot;
+	TArray<float3> bounds_min;
+	TArray<float3> bounds_max;
+	TArray<float3> target;
+	TArray<float3> normal;
+	TArray<float3> tangent;
+	TArray<float3> extra;
+};
+static_assert(sizeof(Entity_SOA)==288,"structure size mismatch with DAS");
+static_assert(offsetof(Entity_SOA,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,velocity)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,color)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,scale)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,rotation)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,pivot)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,bounds_min)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,bounds_max)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,target)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,normal)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,tangent)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(Entity_SOA,extra)==264,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_finalize_31deb65690d711c9 ( Context * __context__, TArray<struct Entity> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_push_442b11550cc98104 ( Context * __context__, TArray<struct Entity> & __Arr_rename_at_40, struct Entity const  & __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43 ( Context * __context__, TArray<float3> & __Arr_rename_at_75, float3 __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_reserve_c5848e80e2e42c0d ( Context * __context__, TArray<struct Entity> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_reserve_5e4ae50957d101f9 ( Context * __context__, TArray<float3> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void finalize_5a975cf3f91b9076 ( Context * __context__, struct Entity & ____this_rename_at_10 );
+inline int32_t length_f9e3e4f4ed05069d ( Context * __context__, struct Entity_SOA const  & __soa_rename_at_10 );
+inline void push_878c5370837a0689 ( Context * __context__, struct Entity_SOA & __soa_rename_at_10, struct Entity const  & __value_rename_at_10 );
+inline void reserve_bb61dee14e7869dc ( Context * __context__, struct Entity_SOA & __soa_rename_at_10, int32_t __newSize_rename_at_10 );
+inline bool test_a13b1e9c6ee9fd4f ( Context * __context__ );
+inline void update_aos_98ecd2b5938b2db7 ( Context * __context__, TArray<struct Entity> & __entities_rename_at_25 );
+inline void update_soa_6a43245b9eb646f1 ( Context * __context__, struct Entity_SOA & __entities_rename_at_35 );
+inline void update_soa_for_6a43245b9eb646f1 ( Context * __context__, struct Entity_SOA & __entities_rename_at_40 );
+inline void update_soa_index_8fa0db8cfd711041 ( Context * __context__, struct Entity_SOA & __entities_rename_at_30 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_31deb65690d711c9 ( Context * __context__, TArray<struct Entity> &  __a_rename_at_280 )
+{
+	{
+		bool __need_loop_282 = true;
+		// aV : Entity aka TT&
+		das_iterator<TArray<struct Entity>> __aV_iterator(__a_rename_at_280);
+		struct Entity * __aV_rename_at_282;
+		__need_loop_282 = __aV_iterator.first(__context__,(__aV_rename_at_282)) && __need_loop_282;
+		for ( ; __need_loop_282 ; __need_loop_282 = __aV_iterator.next(__context__,(__aV_rename_at_282)) )
+		{
+			finalize_5a975cf3f91b9076(__context__,das_arg<struct Entity>::pass((*__aV_rename_at_282)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_282));
+	};
+	builtin_array_free(das_arg<TArray<struct Entity>>::pass(__a_rename_at_280),144,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_442b11550cc98104 ( Context * __context__, TArray<struct Entity> &  __Arr_rename_at_40, struct Entity const  &  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<struct Entity>>::pass(__Arr_rename_at_40),__at_rename_at_40,144,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43 ( Context * __context__, TArray<float3> &  __Arr_rename_at_75, float3 __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<float3>>::pass(__Arr_rename_at_75),__at_rename_at_75,12,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_reserve_c5848e80e2e42c0d ( Context * __context__, TArray<struct Entity> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<struct Entity>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,144,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_5e4ae50957d101f9 ( Context * __context__, TArray<float3> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<float3>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,12,__context__);
+}
+
+inline void finalize_5a975cf3f91b9076 ( Context * __context__, struct Entity &  ____this_rename_at_10 )
+{
+	memset(&(____this_rename_at_10), 0, 144);
+}
+
+inline int32_t length_f9e3e4f4ed05069d ( Context * __context__, struct Entity_SOA const  &  __soa_rename_at_10 )
+{
+	return builtin_array_size(__soa_rename_at_10.position);
+}
+
+inline void push_878c5370837a0689 ( Context * __context__, struct Entity_SOA &  __soa_rename_at_10, struct Entity const  &  __value_rename_at_10 )
+{
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.position),__value_rename_at_10.position,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.velocity),__value_rename_at_10.velocity,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.color),__value_rename_at_10.color,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.scale),__value_rename_at_10.scale,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.rotation),__value_rename_at_10.rotation,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.pivot),__value_rename_at_10.pivot,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.bounds_min),__value_rename_at_10.bounds_min,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.bounds_max),__value_rename_at_10.bounds_max,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.target),__value_rename_at_10.target,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.normal),__value_rename_at_10.normal,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.tangent),__value_rename_at_10.tangent,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.extra),__value_rename_at_10.extra,-1);
+}
+
+inline void reserve_bb61dee14e7869dc ( Context * __context__, struct Entity_SOA &  __soa_rename_at_10, int32_t __newSize_rename_at_10 )
+{
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.position),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.velocity),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.color),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.scale),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.rotation),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.pivot),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.bounds_min),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.bounds_max),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.target),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.normal),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.tangent),__newSize_rename_at_10);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_10.extra),__newSize_rename_at_10);
+}
+
+inline bool test_a13b1e9c6ee9fd4f ( Context * __context__ ) { das_stack_prologue __prologue(__context__,928,"test " DAS_FILE_LINE);
+{
+	TArray<struct Entity> __aos_rename_at_46; das_zero(__aos_rename_at_46);
+	struct Entity_SOA __soa_rename_at_47; das_zero(__soa_rename_at_47);
+	_Funcbuiltin_0x60_reserve_c5848e80e2e42c0d(__context__,das_arg<TArray<struct Entity>>::pass(__aos_rename_at_46),50000);
+	reserve_bb61dee14e7869dc(__context__,das_arg<struct Entity_SOA>::pass(__soa_rename_at_47),50000);
+	{
+		bool __need_loop_50 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,50000));
+		int32_t __i_rename_at_50;
+		__need_loop_50 = __i_iterator.first(__context__,(__i_rename_at_50)) && __need_loop_50;
+		for ( ; __need_loop_50 ; __need_loop_50 = __i_iterator.next(__context__,(__i_rename_at_50)) )
+		{
+			struct Entity __e_rename_at_51 = (struct Entity)(([&]() -> struct Entity {
+				struct Entity __mks_51;
+				das_zero(__mks_51);
+				das_copy((__mks_51.position),(v_splats(__i_rename_at_50)));
+				das_copy((__mks_51.velocity),(v_make_vec4f(1.f,2.f,3.f,0.f)));
+				return __mks_51;
+			})());
+			_Funcbuiltin_0x60_push_442b11550cc98104(__context__,das_arg<TArray<struct Entity>>::pass(__aos_rename_at_46),__e_rename_at_51,-1);
+			push_878c5370837a0689(__context__,das_arg<struct Entity_SOA>::pass(__soa_rename_at_47),__e_rename_at_51);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_50));
+	};
+	update_aos_98ecd2b5938b2db7(__context__,das_arg<TArray<struct Entity>>::pass(__aos_rename_at_46));
+	update_soa_index_8fa0db8cfd711041(__context__,das_arg<struct Entity_SOA>::pass(__soa_rename_at_47));
+	update_aos_98ecd2b5938b2db7(__context__,das_arg<TArray<struct Entity>>::pass(__aos_rename_at_46));
+	update_soa_6a43245b9eb646f1(__context__,das_arg<struct Entity_SOA>::pass(__soa_rename_at_47));
+	update_aos_98ecd2b5938b2db7(__context__,das_arg<TArray<struct Entity>>::pass(__aos_rename_at_46));
+	update_soa_for_6a43245b9eb646f1(__context__,das_arg<struct Entity_SOA>::pass(__soa_rename_at_47));
+	{
+		bool __need_loop_60 = true;
+		// a : Entity&
+		das_iterator<TArray<struct Entity>> __a_iterator(__aos_rename_at_46);
+		struct Entity * __a_rename_at_60;
+		__need_loop_60 = __a_iterator.first(__context__,(__a_rename_at_60)) && __need_loop_60;
+		// p : float3&
+		das_iterator<TArray<float3>> __p_iterator(__soa_rename_at_47.position);
+		float3 * __p_rename_at_60;
+		__need_loop_60 = __p_iterator.first(__context__,(__p_rename_at_60)) && __need_loop_60;
+		for ( ; __need_loop_60 ; __need_loop_60 = __a_iterator.next(__context__,(__a_rename_at_60)) && __p_iterator.next(__context__,(__p_rename_at_60)) )
+		{
+			DAS_VERIFY((SimPolicy<float3>::Equ((*__a_rename_at_60).position,(*__p_rename_at_60),*__context__)));
+		}
+		__a_iterator.close(__context__,(__a_rename_at_60));
+		__p_iterator.close(__context__,(__p_rename_at_60));
+	};
+	builtin_profile(20,((char *) "array of structures"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_63 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(range(0,100));
+			int32_t __t_rename_at_63;
+			__need_loop_63 = __t_iterator.first(__context__,(__t_rename_at_63)) && __need_loop_63;
+			for ( ; __need_loop_63 ; __need_loop_63 = __t_iterator.next(__context__,(__t_rename_at_63)) )
+			{
+				update_aos_98ecd2b5938b2db7(__context__,das_arg<TArray<struct Entity>>::pass(__aos_rename_at_46));
+			}
+			__t_iterator.close(__context__,(__t_rename_at_63));
+		};
+	}),__context__);
+	builtin_profile(20,((char *) "soa, element syntax"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_66 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(range(0,100));
+			int32_t __t_rename_at_66;
+			__need_loop_66 = __t_iterator.first(__context__,(__t_rename_at_66)) && __need_loop_66;
+			for ( ; __need_loop_66 ; __need_loop_66 = __t_iterator.next(__context__,(__t_rename_at_66)) )
+			{
+				update_soa_index_8fa0db8cfd711041(__context__,das_arg<struct Entity_SOA>::pass(__soa_rename_at_47));
+			}
+			__t_iterator.close(__context__,(__t_rename_at_66));
+		};
+	}),__context__);
+	builtin_profile(20,((char *) "soa, columns"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_69 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(range(0,100));
+			int32_t __t_rename_at_69;
+			__need_loop_69 = __t_iterator.first(__context__,(__t_rename_at_69)) && __need_loop_69;
+			for ( ; __need_loop_69 ; __need_loop_69 = __t_iterator.next(__context__,(__t_rename_at_69)) )
+			{
+				update_soa_6a43245b9eb646f1(__context__,das_arg<struct Entity_SOA>::pass(__soa_rename_at_47));
+			}
+			__t_iterator.close(__context__,(__t_rename_at_69));
+		};
+	}),__context__);
+	builtin_profile(20,((char *) "soa, for e in soa"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_72 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(range(0,100));
+			int32_t __t_rename_at_72;
+			__need_loop_72 = __t_iterator.first(__context__,(__t_rename_at_72)) && __need_loop_72;
+			for ( ; __need_loop_72 ; __need_loop_72 = __t_iterator.next(__context__,(__t_rename_at_72)) )
+			{
+				update_soa_for_6a43245b9eb646f1(__context__,das_arg<struct Entity_SOA>::pass(__soa_rename_at_47));
+			}
+			__t_iterator.close(__context__,(__t_rename_at_72));
+		};
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_31deb65690d711c9(__context__,das_arg<TArray<struct Entity>>::pass(__aos_rename_at_46));
+	return true;
+}}
+
+inline void update_aos_98ecd2b5938b2db7 ( Context * __context__, TArray<struct Entity> &  __entities_rename_at_25 )
+{
+	{
+		bool __need_loop_26 = true;
+		// e : Entity&
+		das_iterator<TArray<struct Entity>> __e_iterator(__entities_rename_at_25);
+		struct Entity * __e_rename_at_26;
+		__need_loop_26 = __e_iterator.first(__context__,(__e_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __e_iterator.next(__context__,(__e_rename_at_26)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__e_rename_at_26).position),(*__e_rename_at_26).velocity,*__context__);
+		}
+		__e_iterator.close(__context__,(__e_rename_at_26));
+	};
+}
+
+inline void update_soa_6a43245b9eb646f1 ( Context * __context__, struct Entity_SOA &  __entities_rename_at_35 )
+{
+	{
+		bool __need_loop_36 = true;
+		// pos : float3&
+		das_iterator<TArray<float3>> __pos_iterator(__entities_rename_at_35.position);
+		float3 * __pos_rename_at_36;
+		__need_loop_36 = __pos_iterator.first(__context__,(__pos_rename_at_36)) && __need_loop_36;
+		// vel : float3&
+		das_iterator<TArray<float3>> __vel_iterator(__entities_rename_at_35.velocity);
+		float3 * __vel_rename_at_36;
+		__need_loop_36 = __vel_iterator.first(__context__,(__vel_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = __pos_iterator.next(__context__,(__pos_rename_at_36)) && __vel_iterator.next(__context__,(__vel_rename_at_36)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__pos_rename_at_36)),(*__vel_rename_at_36),*__context__);
+		}
+		__pos_iterator.close(__context__,(__pos_rename_at_36));
+		__vel_iterator.close(__context__,(__vel_rename_at_36));
+	};
+}
+
+inline void update_soa_for_6a43245b9eb646f1 ( Context * __context__, struct Entity_SOA &  __entities_rename_at_40 )
+{
+	{
+		bool __need_loop_41 = true;
+		// __soa_e_position : float3&
+		das_iterator<TArray<float3>> ____soa_e_position_iterator(__entities_rename_at_40.position);
+		float3 * ____soa_e_position_rename_at_41;
+		__need_loop_41 = ____soa_e_position_iterator.first(__context__,(____soa_e_position_rename_at_41)) && __need_loop_41;
+		// __soa_e_velocity : float3&
+		das_iterator<TArray<float3>> ____soa_e_velocity_iterator(__entities_rename_at_40.velocity);
+		float3 * ____soa_e_velocity_rename_at_41;
+		__need_loop_41 = ____soa_e_velocity_iterator.first(__context__,(____soa_e_velocity_rename_at_41)) && __need_loop_41;
+		for ( ; __need_loop_41 ; __need_loop_41 = ____soa_e_position_iterator.next(__context__,(____soa_e_position_rename_at_41)) && ____soa_e_velocity_iterator.next(__context__,(____soa_e_velocity_rename_at_41)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*____soa_e_position_rename_at_41)),(*____soa_e_velocity_rename_at_41),*__context__);
+		}
+		____soa_e_position_iterator.close(__context__,(____soa_e_position_rename_at_41));
+		____soa_e_velocity_iterator.close(__context__,(____soa_e_velocity_rename_at_41));
+	};
+}
+
+inline void update_soa_index_8fa0db8cfd711041 ( Context * __context__, struct Entity_SOA &  __entities_rename_at_30 )
+{
+	{
+		bool __need_loop_31 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,length_f9e3e4f4ed05069d(__context__,das_arg<struct Entity_SOA>::pass(__entities_rename_at_30))));
+		int32_t __i_rename_at_31;
+		__need_loop_31 = __i_iterator.first(__context__,(__i_rename_at_31)) && __need_loop_31;
+		for ( ; __need_loop_31 ; __need_loop_31 = __i_iterator.next(__context__,(__i_rename_at_31)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&(__entities_rename_at_30.position(__i_rename_at_31,__context__)),__entities_rename_at_30.velocity(__i_rename_at_31,__context__),*__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_31));
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_31deb65690d711c9
+		aotLib[0x3cba17e508d24bd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Entity> &  ),&_Funcbuiltin_0x60_finalize_31deb65690d711c9>>();
+	};
+		// _Funcbuiltin_0x60_push_442b11550cc98104
+		aotLib[0x9dd484f6838b59bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Entity> & , struct Entity const  & , int32_t  ),&_Funcbuiltin_0x60_push_442b11550cc98104>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43
+		aotLib[0xb6bb7bced1d80885] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , float3 , int32_t  ),&_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43>>();
+	};
+		// _Funcbuiltin_0x60_reserve_c5848e80e2e42c0d
+		aotLib[0x857bff50e3ef6f91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Entity> & , int32_t  ),&_Funcbuiltin_0x60_reserve_c5848e80e2e42c0d>>();
+	};
+		// _Funcbuiltin_0x60_reserve_5e4ae50957d101f9
+		aotLib[0xdc4ac0a7c38b2c45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_reserve_5e4ae50957d101f9>>();
+	};
+		// finalize_5a975cf3f91b9076
+		aotLib[0x2f38fab7db7f81a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Entity &  ),&finalize_5a975cf3f91b9076>>();
+	};
+		// length_f9e3e4f4ed05069d
+		aotLib[0x79e510e0d419fd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct Entity_SOA const  &  ),&length_f9e3e4f4ed05069d>>();
+	};
+		// push_878c5370837a0689
+		aotLib[0xf72c4f2b94c75d19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Entity_SOA & , struct Entity const  &  ),&push_878c5370837a0689>>();
+	};
+		// reserve_bb61dee14e7869dc
+		aotLib[0xb957d9e66ec2958d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Entity_SOA & , int32_t  ),&reserve_bb61dee14e7869dc>>();
+	};
+		// test_a13b1e9c6ee9fd4f
+		aotLib[0xc9984fd89a499d41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_a13b1e9c6ee9fd4f>>();
+	};
+		// update_aos_98ecd2b5938b2db7
+		aotLib[0x4a0e150843757b6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Entity> &  ),&update_aos_98ecd2b5938b2db7>>();
+	};
+		// update_soa_6a43245b9eb646f1
+		aotLib[0xe7cf3dbfbce95b01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Entity_SOA &  ),&update_soa_6a43245b9eb646f1>>();
+	};
+		// update_soa_for_6a43245b9eb646f1
+		aotLib[0xe7cf3dbfbce95b01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Entity_SOA &  ),&update_soa_for_6a43245b9eb646f1>>();
+	};
+		// update_soa_index_8fa0db8cfd711041
+		aotLib[0x19a46fd5ceacca78] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Entity_SOA &  ),&update_soa_index_8fa0db8cfd711041>>();
+	};
+		// [[ init script ]]
+		aotLib[0x39726858ecaf3689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
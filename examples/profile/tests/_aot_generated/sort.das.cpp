@@ -0,0 +1,783 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__8514e1ef;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__a6c45d85;
+extern VarInfo __var_info__393cbc39;
+extern VarInfo __var_info__5a7c01a1;
+extern VarInfo __var_info__8a51f950;
+extern VarInfo __var_info__11b11108;
+extern VarInfo __var_info__441a1ddd;
+extern VarInfo __var_info__d7acb4f3;
+extern VarInfo __var_info__b891957f;
+extern VarInfo __var_info__ce6336d2;
+extern FuncInfo __func_info__e8a029f4;
+extern FuncInfo __func_info__cb3c84a7;
+extern FuncInfo __func_info__42b67783;
+extern FuncInfo __func_info__8317809f;
+extern FuncInfo __func_info__2c47cca3;
+
+VarInfo __struct_info__8514e1ef_field_0 =  { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x5a7c01a1, "pos", 0 };
+VarInfo __struct_info__8514e1ef_field_1 =  { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x8a51f950, "vel", 12 };
+VarInfo __struct_info__8514e1ef_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x11b11108, "id", 24 };
+VarInfo * __struct_info__8514e1ef_fields[3] =  { &__struct_info__8514e1ef_field_0, &__struct_info__8514e1ef_field_1, &__struct_info__8514e1ef_field_2 };
+StructInfo __struct_info__8514e1ef = {"Particle", __struct_info__8514e1ef_fields, 3, 28, -1, nullptr, 0x8514e1ef };
+VarInfo __func_info__e8a029f4_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xce6336d2, "x", 0 };
+VarInfo __func_info__e8a029f4_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x393cbc39, "y", 0 };
+VarInfo * __func_info__e8a029f4_fields[2] =  { &__func_info__e8a029f4_field_0, &__func_info__e8a029f4_field_1 };
+FuncInfo __func_info__e8a029f4 = {"invoke block<(x:int const;y:int const):bool> const", "", __func_info__e8a029f4_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xe8a029f4, 0x0 };
+VarInfo __func_info__cb3c84a7_field_0 =  { Type::tStructure, &__struct_info__8514e1ef, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0xd7acb4f3, "l", 0 };
+VarInfo __func_info__cb3c84a7_field_1 =  { Type::tStructure, &__struct_info__8514e1ef, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x441a1ddd, "r", 0 };
+VarInfo * __func_info__cb3c84a7_fields[2] =  { &__func_info__cb3c84a7_field_0, &__func_info__cb3c84a7_field_1 };
+FuncInfo __func_info__cb3c84a7 = {"invoke block<(l:Particle const;r:Particle const):bool> const", "", __func_info__cb3c84a7_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xcb3c84a7, 0x0 };
+VarInfo __func_info__42b67783_field_0 =  { Type::tStructure, &__struct_info__8514e1ef, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0xb891957f, "p", 0 };
+VarInfo * __func_info__42b67783_fields[1] =  { &__func_info__42b67783_field_0 };
+FuncInfo __func_info__42b67783 = {"invoke block<(p:Particle const):int const> const", "", __func_info__42b67783_fields, 1, 32, &__type_info__359c1b32, nullptr,0,0x42b67783, 0x0 };
+VarInfo __func_info__8317809f_field_0 =  { Type::tStructure, &__struct_info__8514e1ef, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0xb891957f, "p", 0 };
+VarInfo * __func_info__8317809f_fields[1] =  { &__func_info__8317809f_field_0 };
+FuncInfo __func_info__8317809f = {"invoke block<(p:Particle const):float> const", "", __func_info__8317809f_fields, 1, 32, &__type_info__a6c45d85, nullptr,0,0x8317809f, 0x0 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__95e97e5e };
+namespace  {
+
+struct Particle {
+	float3 pos;
+	float3 vel;
+	int32_t id;
+};
+static_assert(sizeof(Particle)==28,"structure size mismatch with DAS");
+static_assert(offsetof(Particle,pos)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,vel)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,id)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> & __a_rename_at_227, TArray<int32_t> const  & __b_rename_at_227 );
+inline void _Funcbuiltin_0x60_clone_91e87523cb5ef731 ( Context * __context__, TArray<char *> & __a_rename_at_227, TArray<char *> const  & __b_rename_at_227 );
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb ( Context * __context__, TArray<int32_t> const  & __clone_src_rename_at_215 );
+inline TArray<char *> _Funcbuiltin_0x60_clone_to_move_61cfbdf6365e371 ( Context * __context__, TArray<char *> const  & __clone_src_rename_at_215 );
+inline void _Funcbuiltin_0x60_finalize_b3f5644522ac111 ( Context * __context__, TArray<struct Particle> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> & __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_resize_e1c1018682eb227a ( Context * __context__, TArray<struct Particle> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_sort_b48370d42a7a5fc1 ( Context * __context__, TArray<struct Particle> & __a_rename_at_473, Block DAS_COMMENT((bool,struct Particle const ,struct Particle const )) const  & __cmp_rename_at_473 );
+inline void _Funcbuiltin_0x60_sort_375e0ed4c09ca997 ( Context * __context__, TArray<float> & __a_rename_at_441 );
+inline void _Funcbuiltin_0x60_sort_f52f40276c6eddae ( Context * __context__, TArray<int32_t> & __a_rename_at_441 );
+inline void _Funcbuiltin_0x60_sort_780509c039a2989f ( Context * __context__, TArray<int32_t> & __a_rename_at_473, Block DAS_COMMENT((bool,int32_t,int32_t)) const  & __cmp_rename_at_473 );
+inline void _Funcbuiltin_0x60_sort_d46e57cd1dcd0dda ( Context * __context__, TArray<char *> & __a_rename_at_441 );
+inline void _Funcbuiltin_0x60_sort_by_key_908261a79d38f99e ( Context * __context__, TArray<struct Particle> & __a_rename_at_607, Block DAS_COMMENT((float,struct Particle const )) const  & __key_rename_at_607 );
+inline void _Funcbuiltin_0x60_sort_parallel_767618d0340a6bc3 ( Context * __context__, TArray<struct Particle> & __a_rename_at_573, Block DAS_COMMENT((int32_t,struct Particle const )) const  & __key_rename_at_573 );
+inline void _Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c ( Context * __context__, TArray<int32_t> & __a_rename_at_562 );
+inline void _Funcbuiltin_0x60_stable_sort_5360c5d29b98e3f1 ( Context * __context__, TArray<int32_t> & __a_rename_at_537, Block DAS_COMMENT((bool,int32_t,int32_t)) const  & __cmp_rename_at_537 );
+inline void finalize_8d028769000a5cd ( Context * __context__, struct Particle & ____this_rename_at_43 );
+inline void makeInputs_48825f36211e6893 ( Context * __context__, TArray<int32_t> & __random_rename_at_8, TArray<int32_t> & __sorted_rename_at_8, TArray<int32_t> & __reversed_rename_at_8 );
+inline void sortFloats_7d0822e9616d97d ( Context * __context__, TArray<int32_t> const  & __src_rename_at_74 );
+inline void sortInts_4e0462225ee9525 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_20 );
+inline void sortIntsBlock_293e94003555a5d5 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_26 );
+inline void sortIntsParallel_8c207b82a6f4cf7 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_38 );
+inline void sortParticles_fea27ac94de51efb ( Context * __context__, TArray<int32_t> const  & __src_rename_at_49, bool __parallel_rename_at_49 );
+inline void sortParticlesByDistance_e86c902422a26272 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_62, bool __by_key_rename_at_62 );
+inline void sortStrings_b2ac6a98cb5021eb ( Context * __context__, TArray<char *> const  & __src_rename_at_83 );
+inline void stableSortIntsBlock_a92f5fa78a8b7e43 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_32 );
+inline bool test_af226472cc3ddfb8 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> &  __a_rename_at_227, TArray<int32_t> const  &  __b_rename_at_227 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_227),builtin_array_size(__b_rename_at_227));
+	{
+		bool __need_loop_229 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_227);
+		int32_t * __aV_rename_at_229;
+		__need_loop_229 = __aV_iterator.first(__context__,(__aV_rename_at_229)) && __need_loop_229;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_227);
+		int32_t const  * __bV_rename_at_229;
+		__need_loop_229 = __bV_iterator.first(__context__,(__bV_rename_at_229)) && __need_loop_229;
+		for ( ; __need_loop_229 ; __need_loop_229 = __aV_iterator.next(__context__,(__aV_rename_at_229)) && __bV_iterator.next(__context__,(__bV_rename_at_229)) )
+		{
+			das_copy((*__aV_rename_at_229),(*__bV_rename_at_229));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_229));
+		__bV_iterator.close(__context__,(__bV_rename_at_229));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_91e87523cb5ef731 ( Context * __context__, TArray<char *> &  __a_rename_at_227, TArray<char *> const  &  __b_rename_at_227 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_227),builtin_array_size(__b_rename_at_227));
+	{
+		bool __need_loop_229 = true;
+		// aV : string aka TT&
+		das_iterator<TArray<char *>> __aV_iterator(__a_rename_at_227);
+		char * * __aV_rename_at_229;
+		__need_loop_229 = __aV_iterator.first(__context__,(__aV_rename_at_229)) && __need_loop_229;
+		// bV : string const&
+		das_iterator<TArray<char *> const > __bV_iterator(__b_rename_at_227);
+		char * const  * __bV_rename_at_229;
+		__need_loop_229 = __bV_iterator.first(__context__,(__bV_rename_at_229)) && __need_loop_229;
+		for ( ; __need_loop_229 ; __need_loop_229 = __aV_iterator.next(__context__,(__aV_rename_at_229)) && __bV_iterator.next(__context__,(__bV_rename_at_229)) )
+		{
+			das_copy((*__aV_rename_at_229),(*__bV_rename_at_229));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_229));
+		__bV_iterator.close(__context__,(__bV_rename_at_229));
+	};
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb ( Context * __context__, TArray<int32_t> const  &  __clone_src_rename_at_215 )
+{
+	TArray<int32_t> __clone_dest_rename_at_216; das_zero(__clone_dest_rename_at_216);
+	_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__clone_dest_rename_at_216),__clone_src_rename_at_215);
+	return /* <- */ __clone_dest_rename_at_216;
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_clone_to_move_61cfbdf6365e371 ( Context * __context__, TArray<char *> const  &  __clone_src_rename_at_215 )
+{
+	TArray<char *> __clone_dest_rename_at_216; das_zero(__clone_dest_rename_at_216);
+	_Funcbuiltin_0x60_clone_91e87523cb5ef731(__context__,das_arg<TArray<char *>>::pass(__clone_dest_rename_at_216),__clone_src_rename_at_215);
+	return /* <- */ __clone_dest_rename_at_216;
+}
+
+inline void _Funcbuiltin_0x60_finalize_b3f5644522ac111 ( Context * __context__, TArray<struct Particle> &  __a_rename_at_280 )
+{
+	{
+		bool __need_loop_282 = true;
+		// aV : Particle aka TT&
+		das_iterator<TArray<struct Particle>> __aV_iterator(__a_rename_at_280);
+		struct Particle * __aV_rename_at_282;
+		__need_loop_282 = __aV_iterator.first(__context__,(__aV_rename_at_282)) && __need_loop_282;
+		for ( ; __need_loop_282 ; __need_loop_282 = __aV_iterator.next(__context__,(__aV_rename_at_282)) )
+		{
+			finalize_8d028769000a5cd(__context__,das_arg<struct Particle>::pass((*__aV_rename_at_282)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_282));
+	};
+	builtin_array_free(das_arg<TArray<struct Particle>>::pass(__a_rename_at_280),28,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<float>>::pass(__a_rename_at_280),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_280),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_280),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> &  __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<char *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_resize_e1c1018682eb227a ( Context * __context__, TArray<struct Particle> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct Particle>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,28,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_b48370d42a7a5fc1 ( Context * __context__, TArray<struct Particle> &  __a_rename_at_473, Block DAS_COMMENT((bool,struct Particle const ,struct Particle const )) const  &  __cmp_rename_at_473 )
+{
+	if ( builtin_array_size(das_arg<TArray<struct Particle>>::pass(__a_rename_at_473)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<struct Particle>>::pass(__a_rename_at_473),__context__);
+		builtin_sort_any_cblock(das_ref(__context__,__a_rename_at_473(0,__context__)),28,builtin_array_size(das_arg<TArray<struct Particle>>::pass(__a_rename_at_473)),__cmp_rename_at_473,__context__);
+		builtin_array_unlock(das_arg<TArray<struct Particle>>::pass(__a_rename_at_473),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_375e0ed4c09ca997 ( Context * __context__, TArray<float> &  __a_rename_at_441 )
+{
+	if ( builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_441)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<float>>::pass(__a_rename_at_441),__context__);
+		builtin_sort<float>(das_ref(__context__,__a_rename_at_441(0,__context__)),builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_441)));
+		builtin_array_unlock(das_arg<TArray<float>>::pass(__a_rename_at_441),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_f52f40276c6eddae ( Context * __context__, TArray<int32_t> &  __a_rename_at_441 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_441)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_441),__context__);
+		builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_441(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_441)));
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_441),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_780509c039a2989f ( Context * __context__, TArray<int32_t> &  __a_rename_at_473, Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  __cmp_rename_at_473 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_473)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_473),__context__);
+		builtin_sort_cblock<int32_t>(das_ref(__context__,__a_rename_at_473(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_473)),__cmp_rename_at_473,__context__);
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_473),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_d46e57cd1dcd0dda ( Context * __context__, TArray<char *> &  __a_rename_at_441 )
+{
+	if ( builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_441)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<char *>>::pass(__a_rename_at_441),__context__);
+		builtin_sort_string(das_ref(__context__,__a_rename_at_441(0,__context__)),builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_441)));
+		builtin_array_unlock(das_arg<TArray<char *>>::pass(__a_rename_at_441),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_by_key_908261a79d38f99e ( Context * __context__, TArray<struct Particle> &  __a_rename_at_607, Block DAS_COMMENT((float,struct Particle const )) const  &  __key_rename_at_607 )
+{
+	if ( builtin_array_size(das_arg<TArray<struct Particle>>::pass(__a_rename_at_607)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<struct Particle>>::pass(__a_rename_at_607),__context__);
+		TArray<float> __keys_rename_at_612; das_zero(__keys_rename_at_612);
+		_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__keys_rename_at_612),builtin_array_size(das_arg<TArray<struct Particle>>::pass(__a_rename_at_607)));
+		{
+			bool __need_loop_614 = true;
+			// x : Particle aka TT&
+			das_iterator<TArray<struct Particle>> __x_iterator(__a_rename_at_607);
+			struct Particle * __x_rename_at_614;
+			__need_loop_614 = __x_iterator.first(__context__,(__x_rename_at_614)) && __need_loop_614;
+			// k : float&
+			das_iterator<TArray<float>> __k_iterator(__keys_rename_at_612);
+			float * __k_rename_at_614;
+			__need_loop_614 = __k_iterator.first(__context__,(__k_rename_at_614)) && __need_loop_614;
+			for ( ; __need_loop_614 ; __need_loop_614 = __x_iterator.next(__context__,(__x_rename_at_614)) && __k_iterator.next(__context__,(__k_rename_at_614)) )
+			{
+				das_copy((*__k_rename_at_614),das_invoke<float>::invoke<struct Particle &>(__context__,__key_rename_at_607,das_arg<struct Particle>::pass((*__x_rename_at_614))));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_614));
+			__k_iterator.close(__context__,(__k_rename_at_614));
+		};
+		builtin_sort_by_key<float>(das_ref(__context__,__a_rename_at_607(0,__context__)),28,builtin_array_size(das_arg<TArray<struct Particle>>::pass(__a_rename_at_607)),das_ref(__context__,__keys_rename_at_612(0,__context__)));
+		_Funcbuiltin_0x60_finalize_4da34799ba0520c5(__context__,das_arg<TArray<float>>::pass(__keys_rename_at_612));
+		builtin_array_unlock(das_arg<TArray<struct Particle>>::pass(__a_rename_at_607),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_parallel_767618d0340a6bc3 ( Context * __context__, TArray<struct Particle> &  __a_rename_at_573, Block DAS_COMMENT((int32_t,struct Particle const )) const  &  __key_rename_at_573 )
+{
+	if ( builtin_array_size(das_arg<TArray<struct Particle>>::pass(__a_rename_at_573)) == 0 )
+	{
+		return ;
+	} else {
+		TArray<int32_t> __keys_rename_at_578; das_zero(__keys_rename_at_578);
+		_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_578),builtin_array_size(das_arg<TArray<struct Particle>>::pass(__a_rename_at_573)));
+		{
+			bool __need_loop_580 = true;
+			// x : Particle aka TT&
+			das_iterator<TArray<struct Particle>> __x_iterator(__a_rename_at_573);
+			struct Particle * __x_rename_at_580;
+			__need_loop_580 = __x_iterator.first(__context__,(__x_rename_at_580)) && __need_loop_580;
+			// k : int&
+			das_iterator<TArray<int32_t>> __k_iterator(__keys_rename_at_578);
+			int32_t * __k_rename_at_580;
+			__need_loop_580 = __k_iterator.first(__context__,(__k_rename_at_580)) && __need_loop_580;
+			for ( ; __need_loop_580 ; __need_loop_580 = __x_iterator.next(__context__,(__x_rename_at_580)) && __k_iterator.next(__context__,(__k_rename_at_580)) )
+			{
+				das_copy((*__k_rename_at_580),das_invoke<int32_t>::invoke<struct Particle &>(__context__,__key_rename_at_573,das_arg<struct Particle>::pass((*__x_rename_at_580))));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_580));
+			__k_iterator.close(__context__,(__k_rename_at_580));
+		};
+		builtin_array_lock(das_arg<TArray<struct Particle>>::pass(__a_rename_at_573),__context__);
+		builtin_sort_parallel_by_key<int32_t>(das_ref(__context__,__a_rename_at_573(0,__context__)),28,builtin_array_size(das_arg<TArray<struct Particle>>::pass(__a_rename_at_573)),das_ref(__context__,__keys_rename_at_578(0,__context__)));
+		builtin_array_unlock(das_arg<TArray<struct Particle>>::pass(__a_rename_at_573),__context__);
+		_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_578));
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c ( Context * __context__, TArray<int32_t> &  __a_rename_at_562 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_562)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_562),__context__);
+		builtin_sort_parallel<int32_t>(das_ref(__context__,__a_rename_at_562(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_562)));
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_562),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_stable_sort_5360c5d29b98e3f1 ( Context * __context__, TArray<int32_t> &  __a_rename_at_537, Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  __cmp_rename_at_537 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_537)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_537),__context__);
+		builtin_stable_sort_cblock<int32_t>(das_ref(__context__,__a_rename_at_537(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_537)),__cmp_rename_at_537,__context__);
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_537),__context__);
+	};
+}
+
+inline void finalize_8d028769000a5cd ( Context * __context__, struct Particle &  ____this_rename_at_43 )
+{
+	memset(&(____this_rename_at_43), 0, 28);
+}
+
+inline void makeInputs_48825f36211e6893 ( Context * __context__, TArray<int32_t> &  __random_rename_at_8, TArray<int32_t> &  __sorted_rename_at_8, TArray<int32_t> &  __reversed_rename_at_8 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_8),1000000);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__sorted_rename_at_8),1000000);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__reversed_rename_at_8),1000000);
+	int32_t __seed_rename_at_12 = 13;
+	{
+		bool __need_loop_13 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_13;
+		__need_loop_13 = __i_iterator.first(__context__,(__i_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __i_iterator.next(__context__,(__i_rename_at_13)) )
+		{
+			das_copy(__seed_rename_at_12,(__seed_rename_at_12 * 1103515245) + 12345);
+			das_copy(__random_rename_at_8(__i_rename_at_13,__context__),__seed_rename_at_12);
+			das_copy(__sorted_rename_at_8(__i_rename_at_13,__context__),__i_rename_at_13);
+			das_copy(__reversed_rename_at_8(__i_rename_at_13,__context__),1000000 - __i_rename_at_13);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_13));
+	};
+}
+
+inline void sortFloats_7d0822e9616d97d ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_74 )
+{
+	TArray<float> __a_rename_at_75; das_zero(__a_rename_at_75);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__a_rename_at_75),builtin_array_size(__src_rename_at_74));
+	{
+		bool __need_loop_77 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_74);
+		int32_t const  * __x_rename_at_77;
+		__need_loop_77 = __x_iterator.first(__context__,(__x_rename_at_77)) && __need_loop_77;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_77;
+		__need_loop_77 = __i_iterator.first(__context__,(__i_rename_at_77)) && __need_loop_77;
+		for ( ; __need_loop_77 ; __need_loop_77 = __x_iterator.next(__context__,(__x_rename_at_77)) && __i_iterator.next(__context__,(__i_rename_at_77)) )
+		{
+			das_copy(__a_rename_at_75(__i_rename_at_77,__context__),float((*__x_rename_at_77)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_77));
+		__i_iterator.close(__context__,(__i_rename_at_77));
+	};
+	_Funcbuiltin_0x60_sort_375e0ed4c09ca997(__context__,das_arg<TArray<float>>::pass(__a_rename_at_75));
+	_Funcbuiltin_0x60_finalize_4da34799ba0520c5(__context__,das_arg<TArray<float>>::pass(__a_rename_at_75));
+}
+
+inline void sortInts_4e0462225ee9525 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_20 )
+{
+	TArray<int32_t> __a_rename_at_21; das_zero(__a_rename_at_21); das_move(__a_rename_at_21, _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb(__context__,__src_rename_at_20));
+	_Funcbuiltin_0x60_sort_f52f40276c6eddae(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_21));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_21));
+}
+
+inline void sortIntsBlock_293e94003555a5d5 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_26 ) { das_stack_prologue __prologue(__context__,128,"sortIntsBlock " DAS_FILE_LINE);
+{
+	TArray<int32_t> __a_rename_at_27; das_zero(__a_rename_at_27); das_move(__a_rename_at_27, _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb(__context__,__src_rename_at_26));
+	_Funcbuiltin_0x60_sort_780509c039a2989f(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_27),das_make_block<bool,int32_t,int32_t>(__context__,112,0,&__func_info__e8a029f4,[&](int32_t const  __x_rename_at_28, int32_t const  __y_rename_at_28)->bool{
+		return __x_rename_at_28 < __y_rename_at_28;
+	}));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_27));
+}}
+
+inline void sortIntsParallel_8c207b82a6f4cf7 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_38 )
+{
+	TArray<int32_t> __a_rename_at_39; das_zero(__a_rename_at_39); das_move(__a_rename_at_39, _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb(__context__,__src_rename_at_38));
+	_Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_39));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_39));
+}
+
+inline void sortParticles_fea27ac94de51efb ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_49, bool __parallel_rename_at_49 ) { das_stack_prologue __prologue(__context__,224,"sortParticles " DAS_FILE_LINE);
+{
+	TArray<struct Particle> __a_rename_at_50; das_zero(__a_rename_at_50);
+	_Funcbuiltin_0x60_resize_e1c1018682eb227a(__context__,das_arg<TArray<struct Particle>>::pass(__a_rename_at_50),builtin_array_size(__src_rename_at_49));
+	{
+		bool __need_loop_52 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_49);
+		int32_t const  * __x_rename_at_52;
+		__need_loop_52 = __x_iterator.first(__context__,(__x_rename_at_52)) && __need_loop_52;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_52;
+		__need_loop_52 = __i_iterator.first(__context__,(__i_rename_at_52)) && __need_loop_52;
+		for ( ; __need_loop_52 ; __need_loop_52 = __x_iterator.next(__context__,(__x_rename_at_52)) && __i_iterator.next(__context__,(__i_rename_at_52)) )
+		{
+			das_copy(__a_rename_at_50(__i_rename_at_52,__context__).id,(*__x_rename_at_52));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_52));
+		__i_iterator.close(__context__,(__i_rename_at_52));
+	};
+	if ( __parallel_rename_at_49 )
+	{
+		_Funcbuiltin_0x60_sort_parallel_767618d0340a6bc3(__context__,das_arg<TArray<struct Particle>>::pass(__a_rename_at_50),das_make_block<int32_t,struct Particle const  &>(__context__,144,0,&__func_info__42b67783,[&](struct Particle const  & __p_rename_at_55)->int32_t{
+			return __p_rename_at_55.id;
+		}));
+	} else {
+		_Funcbuiltin_0x60_sort_b48370d42a7a5fc1(__context__,das_arg<TArray<struct Particle>>::pass(__a_rename_at_50),das_make_block<bool,struct Particle const  &,struct Particle const  &>(__context__,208,0,&__func_info__cb3c84a7,[&](struct Particle const  & __l_rename_at_57, struct Particle const  & __r_rename_at_57)->bool{
+			return __l_rename_at_57.id < __r_rename_at_57.id;
+		}));
+	};
+	_Funcbuiltin_0x60_finalize_b3f5644522ac111(__context__,das_arg<TArray<struct Particle>>::pass(__a_rename_at_50));
+}}
+
+inline void sortParticlesByDistance_e86c902422a26272 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_62, bool __by_key_rename_at_62 ) { das_stack_prologue __prologue(__context__,224,"sortParticlesByDistance " DAS_FILE_LINE);
+{
+	TArray<struct Particle> __a_rename_at_63; das_zero(__a_rename_at_63);
+	_Funcbuiltin_0x60_resize_e1c1018682eb227a(__context__,das_arg<TArray<struct Particle>>::pass(__a_rename_at_63),builtin_array_size(__src_rename_at_62));
+	{
+		bool __need_loop_65 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_62);
+		int32_t const  * __x_rename_at_65;
+		__need_loop_65 = __x_iterator.first(__context__,(__x_rename_at_65)) && __need_loop_65;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_65;
+		__need_loop_65 = __i_iterator.first(__context__,(__i_rename_at_65)) && __need_loop_65;
+		for ( ; __need_loop_65 ; __need_loop_65 = __x_iterator.next(__context__,(__x_rename_at_65)) && __i_iterator.next(__context__,(__i_rename_at_65)) )
+		{
+			das_copy(__a_rename_at_63(__i_rename_at_65,__context__).pos,float3(float((*__x_rename_at_65) & 1023),float(((*__x_rename_at_65) >> 10) & 1023),float(((*__x_rename_at_65) >> 20) & 1023)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_65));
+		__i_iterator.close(__context__,(__i_rename_at_65));
+	};
+	if ( __by_key_rename_at_62 )
+	{
+		_Funcbuiltin_0x60_sort_by_key_908261a79d38f99e(__context__,das_arg<TArray<struct Particle>>::pass(__a_rename_at_63),das_make_block<float,struct Particle const  &>(__context__,144,0,&__func_info__8317809f,[&](struct Particle const  & __p_rename_at_68)->float{
+			return length3(__p_rename_at_68.pos);
+		}));
+	} else {
+		_Funcbuiltin_0x60_sort_b48370d42a7a5fc1(__context__,das_arg<TArray<struct Particle>>::pass(__a_rename_at_63),das_make_block<bool,struct Particle const  &,struct Particle const  &>(__context__,208,0,&__func_info__cb3c84a7,[&](struct Particle const  & __l_rename_at_70, struct Particle const  & __r_rename_at_70)->bool{
+			return length3(__l_rename_at_70.pos) < length3(__r_rename_at_70.pos);
+		}));
+	};
+	_Funcbuiltin_0x60_finalize_b3f5644522ac111(__context__,das_arg<TArray<struct Particle>>::pass(__a_rename_at_63));
+}}
+
+inline void sortStrings_b2ac6a98cb5021eb ( Context * __context__, TArray<char *> const  &  __src_rename_at_83 )
+{
+	TArray<char *> __a_rename_at_84; das_zero(__a_rename_at_84); das_move(__a_rename_at_84, _Funcbuiltin_0x60_clone_to_move_61cfbdf6365e371(__context__,__src_rename_at_83));
+	_Funcbuiltin_0x60_sort_d46e57cd1dcd0dda(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_84));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_84));
+}
+
+inline void stableSortIntsBlock_a92f5fa78a8b7e43 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_32 ) { das_stack_prologue __prologue(__context__,128,"stableSortIntsBlock " DAS_FILE_LINE);
+{
+	TArray<int32_t> __a_rename_at_33; das_zero(__a_rename_at_33); das_move(__a_rename_at_33, _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb(__context__,__src_rename_at_32));
+	_Funcbuiltin_0x60_stable_sort_5360c5d29b98e3f1(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_33),das_make_block<bool,int32_t,int32_t>(__context__,112,0,&__func_info__e8a029f4,[&](int32_t const  __x_rename_at_34, int32_t const  __y_rename_at_34)->bool{
+		return __x_rename_at_34 < __y_rename_at_34;
+	}));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_33));
+}}
+
+inline bool test_af226472cc3ddfb8 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,944,"test " DAS_FILE_LINE);
+{
+	TArray<int32_t> __random_rename_at_90; das_zero(__random_rename_at_90); TArray<int32_t> __sorted_rename_at_90; das_zero(__sorted_rename_at_90); TArray<int32_t> __reversed_rename_at_90; das_zero(__reversed_rename_at_90);
+	makeInputs_48825f36211e6893(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90),das_arg<TArray<int32_t>>::pass(__sorted_rename_at_90),das_arg<TArray<int32_t>>::pass(__reversed_rename_at_90));
+	builtin_profile(10,((char *) "sort int, random"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortInts_4e0462225ee9525(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90));
+	}),__context__);
+	builtin_profile(10,((char *) "sort int, sorted"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortInts_4e0462225ee9525(__context__,das_arg<TArray<int32_t>>::pass(__sorted_rename_at_90));
+	}),__context__);
+	builtin_profile(10,((char *) "sort int, reversed"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortInts_4e0462225ee9525(__context__,das_arg<TArray<int32_t>>::pass(__reversed_rename_at_90));
+	}),__context__);
+	builtin_profile(10,((char *) "sort_parallel int, random"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortIntsParallel_8c207b82a6f4cf7(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90));
+	}),__context__);
+	builtin_profile(10,((char *) "sort_parallel int, sorted"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortIntsParallel_8c207b82a6f4cf7(__context__,das_arg<TArray<int32_t>>::pass(__sorted_rename_at_90));
+	}),__context__);
+	builtin_profile(10,((char *) "sort_parallel int, reversed"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortIntsParallel_8c207b82a6f4cf7(__context__,das_arg<TArray<int32_t>>::pass(__reversed_rename_at_90));
+	}),__context__);
+	builtin_profile(10,((char *) "sort struct with block, random"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortParticles_fea27ac94de51efb(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90),false);
+	}),__context__);
+	builtin_profile(10,((char *) "sort_parallel struct by key, random"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortParticles_fea27ac94de51efb(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90),true);
+	}),__context__);
+	builtin_profile(10,((char *) "sort struct by distance, comparator"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortParticlesByDistance_e86c902422a26272(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90),false);
+	}),__context__);
+	builtin_profile(10,((char *) "sort struct by distance, sort_by_key"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortParticlesByDistance_e86c902422a26272(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90),true);
+	}),__context__);
+	builtin_profile(10,((char *) "sort float, random"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortFloats_7d0822e9616d97d(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90));
+	}),__context__);
+	builtin_profile(10,((char *) "sort int with block, random"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortIntsBlock_293e94003555a5d5(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90));
+	}),__context__);
+	builtin_profile(10,((char *) "sort int with block, sorted"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortIntsBlock_293e94003555a5d5(__context__,das_arg<TArray<int32_t>>::pass(__sorted_rename_at_90));
+	}),__context__);
+	builtin_profile(10,((char *) "sort int with block, reversed"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortIntsBlock_293e94003555a5d5(__context__,das_arg<TArray<int32_t>>::pass(__reversed_rename_at_90));
+	}),__context__);
+	builtin_profile(10,((char *) "stable sort int with block, random"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		stableSortIntsBlock_a92f5fa78a8b7e43(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90));
+	}),__context__);
+	TArray<char *> __strings_rename_at_122; das_zero(__strings_rename_at_122);
+	{
+		bool __need_loop_123 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__random_rename_at_90);
+		int32_t * __x_rename_at_123;
+		__need_loop_123 = __x_iterator.first(__context__,(__x_rename_at_123)) && __need_loop_123;
+		for ( ; __need_loop_123 ; __need_loop_123 = __x_iterator.next(__context__,(__x_rename_at_123)) )
+		{
+			if ( builtin_array_size(das_arg<TArray<char *>>::pass(__strings_rename_at_122)) < 100000 )
+			{
+				_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass(__strings_rename_at_122),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from((*__x_rename_at_123)))),-1);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_123));
+	};
+	builtin_profile(10,((char *) "sort string, random"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sortStrings_b2ac6a98cb5021eb(__context__,das_arg<TArray<char *>>::pass(__strings_rename_at_122));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__random_rename_at_90));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__sorted_rename_at_90));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__reversed_rename_at_90));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__strings_rename_at_122));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_9217fda5fb53190b
+		aotLib[0xb00d3e185e494e59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_9217fda5fb53190b>>();
+	};
+		// _Funcbuiltin_0x60_clone_91e87523cb5ef731
+		aotLib[0xb63e2e650b9e4da3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TArray<char *> const  &  ),&_Funcbuiltin_0x60_clone_91e87523cb5ef731>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb
+		aotLib[0x763662b86d69e114] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_61cfbdf6365e371
+		aotLib[0x90f814daf1f45b1b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TArray<char *> const  &  ),&_Funcbuiltin_0x60_clone_to_move_61cfbdf6365e371>>();
+	};
+		// _Funcbuiltin_0x60_finalize_b3f5644522ac111
+		aotLib[0x1565ce97ef46a6c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Particle> &  ),&_Funcbuiltin_0x60_finalize_b3f5644522ac111>>();
+	};
+		// _Funcbuiltin_0x60_finalize_4da34799ba0520c5
+		aotLib[0xbd5f701fe616ff75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_finalize_4da34799ba0520c5>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_push_dbe8c61ce24eace2
+		aotLib[0xe7e1aae867aed505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_dbe8c61ce24eace2>>();
+	};
+		// _Funcbuiltin_0x60_resize_e1c1018682eb227a
+		aotLib[0x4581b5cff52301dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Particle> & , int32_t  ),&_Funcbuiltin_0x60_resize_e1c1018682eb227a>>();
+	};
+		// _Funcbuiltin_0x60_resize_d240579333227022
+		aotLib[0x40d6b5552dd22f51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , int32_t  ),&_Funcbuiltin_0x60_resize_d240579333227022>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// _Funcbuiltin_0x60_sort_b48370d42a7a5fc1
+		aotLib[0xfadc0b6878abfe55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Particle> & , Block DAS_COMMENT((bool,struct Particle const ,struct Particle const )) const  &  ),&_Funcbuiltin_0x60_sort_b48370d42a7a5fc1>>();
+	};
+		// _Funcbuiltin_0x60_sort_375e0ed4c09ca997
+		aotLib[0xf72a6538b9b603fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_sort_375e0ed4c09ca997>>();
+	};
+		// _Funcbuiltin_0x60_sort_f52f40276c6eddae
+		aotLib[0x2ab87c647a368105] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_sort_f52f40276c6eddae>>();
+	};
+		// _Funcbuiltin_0x60_sort_780509c039a2989f
+		aotLib[0xacd22c7eb41611a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  ),&_Funcbuiltin_0x60_sort_780509c039a2989f>>();
+	};
+		// _Funcbuiltin_0x60_sort_d46e57cd1dcd0dda
+		aotLib[0x5c571e3acbc9b955] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_sort_d46e57cd1dcd0dda>>();
+	};
+		// _Funcbuiltin_0x60_sort_by_key_908261a79d38f99e
+		aotLib[0xcfa4c0b2929a1c4e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Particle> & , Block DAS_COMMENT((float,struct Particle const )) const  &  ),&_Funcbuiltin_0x60_sort_by_key_908261a79d38f99e>>();
+	};
+		// _Funcbuiltin_0x60_sort_parallel_767618d0340a6bc3
+		aotLib[0x52459f7f19cbc08a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Particle> & , Block DAS_COMMENT((int32_t,struct Particle const )) const  &  ),&_Funcbuiltin_0x60_sort_parallel_767618d0340a6bc3>>();
+	};
+		// _Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c
+		aotLib[0x99575c698a51b3c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c>>();
+	};
+		// _Funcbuiltin_0x60_stable_sort_5360c5d29b98e3f1
+		aotLib[0x611524b1b727dae9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  ),&_Funcbuiltin_0x60_stable_sort_5360c5d29b98e3f1>>();
+	};
+		// finalize_8d028769000a5cd
+		aotLib[0x8cb59fe2ccf13d35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Particle &  ),&finalize_8d028769000a5cd>>();
+	};
+		// makeInputs_48825f36211e6893
+		aotLib[0x3ee68dec18a64101] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> & , TArray<int32_t> &  ),&makeInputs_48825f36211e6893>>();
+	};
+		// sortFloats_7d0822e9616d97d
+		aotLib[0xe4f4302ad5c542f3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&sortFloats_7d0822e9616d97d>>();
+	};
+		// sortInts_4e0462225ee9525
+		aotLib[0x3821bcc865f92813] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&sortInts_4e0462225ee9525>>();
+	};
+		// sortIntsBlock_293e94003555a5d5
+		aotLib[0xc8ac448a6116119f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&sortIntsBlock_293e94003555a5d5>>();
+	};
+		// sortIntsParallel_8c207b82a6f4cf7
+		aotLib[0x4fd2871000055ada] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&sortIntsParallel_8c207b82a6f4cf7>>();
+	};
+		// sortParticles_fea27ac94de51efb
+		aotLib[0x926cd27b5ca087f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , bool  ),&sortParticles_fea27ac94de51efb>>();
+	};
+		// sortParticlesByDistance_e86c902422a26272
+		aotLib[0xbf9ab740cc059bcd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , bool  ),&sortParticlesByDistance_e86c902422a26272>>();
+	};
+		// sortStrings_b2ac6a98cb5021eb
+		aotLib[0xd93e3bb8687a477f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&sortStrings_b2ac6a98cb5021eb>>();
+	};
+		// stableSortIntsBlock_a92f5fa78a8b7e43
+		aotLib[0x4c81c3e6a85ce74a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&stableSortIntsBlock_a92f5fa78a8b7e43>>();
+	};
+		// test_af226472cc3ddfb8
+		aotLib[0xf0edf616df6fd839] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_af226472cc3ddfb8>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,220 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__349d3c80;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__f20e2e2b;
+extern VarInfo __var_info__534310c1;
+extern FuncInfo __func_info__a843e978;
+extern FuncInfo __func_info__296441b4;
+extern FuncInfo __func_info__2c47cca3;
+
+VarInfo __func_info__a843e978_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0xf20e2e2b, "parts", 0 };
+VarInfo * __func_info__a843e978_fields[1] =  { &__func_info__a843e978_field_0 };
+FuncInfo __func_info__a843e978 = {"invoke block<(parts:array<string> const#):void> const", "", __func_info__a843e978_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xa843e978, 0x0 };
+VarInfo __func_info__296441b4_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__349d3c80, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0x534310c1, "parts", 0 };
+VarInfo * __func_info__296441b4_fields[1] =  { &__func_info__296441b4_field_0 };
+FuncInfo __func_info__296441b4 = {"invoke block<(parts:array<strings::string_view> const#):void> const", "", __func_info__296441b4_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x296441b4, 0x0 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__349d3c80 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::string_view"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x349d3c80 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+TypeInfo * __tinfo_0[9] = { &__type_info__3ffbf730, &__type_info__95e97e5e, &__type_info__3ffbf730, &__type_info__95e97e5e, &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__95e97e5e, &__type_info__3ffbf730 };
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void makeLines_d09d2ee09f0022bd ( Context * __context__, TArray<char *> & __lines_rename_at_9 );
+inline void _Funcstrings_boost_0x60_split_ac735ac70fef0b27 ( Context * __context__, char * const  __text_rename_at_35, char * const  __delim_rename_at_35, Block DAS_COMMENT((void,TArray<char *> const )) const  & __blk_rename_at_35 );
+inline void _Funcstrings_boost_0x60_split_view_b02e5bf9510e1463 ( Context * __context__, char * const  __text_rename_at_58, char * const  __delim_rename_at_58, Block DAS_COMMENT((void,TArray<das::StringView> const )) const  & __blk_rename_at_58 );
+inline int32_t sum_copy_8eb265c60f25184a ( Context * __context__, TArray<char *> const  & __lines_rename_at_14 );
+inline int32_t sum_view_6cafb669043bcca4 ( Context * __context__, TArray<char *> const  & __lines_rename_at_21 );
+inline bool test_673d40ce1603f706 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_280),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void makeLines_d09d2ee09f0022bd ( Context * __context__, TArray<char *> &  __lines_rename_at_9 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_9),200000);
+	{
+		bool __need_loop_11 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,200000));
+		int32_t __i_rename_at_11;
+		__need_loop_11 = __i_iterator.first(__context__,(__i_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __i_iterator.next(__context__,(__i_rename_at_11)) )
+		{
+			das_copy(__lines_rename_at_9(__i_rename_at_11,__context__),das_string_builder(__context__,SimNode_AotInterop<9>(__tinfo_0, cast<char * const >::from(((char *) "2020-01-01 12:00:")), cast<int32_t>::from((SimPolicy<int32_t>::Mod(__i_rename_at_11,60,*__context__))), cast<char * const >::from(((char *) " INFO worker")), cast<int32_t>::from((SimPolicy<int32_t>::Mod(__i_rename_at_11,16,*__context__))), cast<char * const >::from(((char *) " request ")), cast<int32_t>::from(__i_rename_at_11), cast<char * const >::from(((char *) " done in ")), cast<int32_t>::from((SimPolicy<int32_t>::Mod(__i_rename_at_11,1000,*__context__))), cast<char * const >::from(((char *) " ms")))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_11));
+	};
+}
+
+inline void _Funcstrings_boost_0x60_split_ac735ac70fef0b27 ( Context * __context__, char * const  __text_rename_at_35, char * const  __delim_rename_at_35, Block DAS_COMMENT((void,TArray<char *> const )) const  &  __blk_rename_at_35 )
+{
+	builtin_string_split(__text_rename_at_35,__delim_rename_at_35,__blk_rename_at_35,__context__);
+}
+
+inline void _Funcstrings_boost_0x60_split_view_b02e5bf9510e1463 ( Context * __context__, char * const  __text_rename_at_58, char * const  __delim_rename_at_58, Block DAS_COMMENT((void,TArray<das::StringView> const )) const  &  __blk_rename_at_58 )
+{
+	builtin_string_split_view(__text_rename_at_58,__delim_rename_at_58,__blk_rename_at_58,__context__);
+}
+
+inline int32_t sum_copy_8eb265c60f25184a ( Context * __context__, TArray<char *> const  &  __lines_rename_at_14 ) { das_stack_prologue __prologue(__context__,128,"sum_copy " DAS_FILE_LINE);
+{
+	int32_t __total_rename_at_15 = 0;
+	{
+		bool __need_loop_16 = true;
+		// line : string const&
+		das_iterator<TArray<char *> const > __line_iterator(__lines_rename_at_14);
+		char * const  * __line_rename_at_16;
+		__need_loop_16 = __line_iterator.first(__context__,(__line_rename_at_16)) && __need_loop_16;
+		for ( ; __need_loop_16 ; __need_loop_16 = __line_iterator.next(__context__,(__line_rename_at_16)) )
+		{
+			_Funcstrings_boost_0x60_split_ac735ac70fef0b27(__context__,(*__line_rename_at_16),((char *) " "),das_make_block<void,TArray<char *> const  &>(__context__,112,0,&__func_info__a843e978,[&](TArray<char *> const  & __parts_rename_at_17)->void{
+				__total_rename_at_15 += string_to_int(__parts_rename_at_17(8,__context__),__context__);
+			}));
+		}
+		__line_iterator.close(__context__,(__line_rename_at_16));
+	};
+	return __total_rename_at_15;
+}}
+
+inline int32_t sum_view_6cafb669043bcca4 ( Context * __context__, TArray<char *> const  &  __lines_rename_at_21 ) { das_stack_prologue __prologue(__context__,128,"sum_view " DAS_FILE_LINE);
+{
+	int32_t __total_rename_at_22 = 0;
+	{
+		bool __need_loop_23 = true;
+		// line : string const&
+		das_iterator<TArray<char *> const > __line_iterator(__lines_rename_at_21);
+		char * const  * __line_rename_at_23;
+		__need_loop_23 = __line_iterator.first(__context__,(__line_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __line_iterator.next(__context__,(__line_rename_at_23)) )
+		{
+			_Funcstrings_boost_0x60_split_view_b02e5bf9510e1463(__context__,(*__line_rename_at_23),((char *) " "),das_make_block<void,TArray<das::StringView> const  &>(__context__,112,0,&__func_info__296441b4,[&](TArray<das::StringView> const  & __parts_rename_at_24)->void{
+				__total_rename_at_22 += builtin_string_view_to_int(__parts_rename_at_24(8,__context__));
+			}));
+		}
+		__line_iterator.close(__context__,(__line_rename_at_23));
+	};
+	return __total_rename_at_22;
+}}
+
+inline bool test_673d40ce1603f706 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"test " DAS_FILE_LINE);
+{
+	TArray<char *> __lines_rename_at_30; das_zero(__lines_rename_at_30);
+	makeLines_d09d2ee09f0022bd(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_30));
+	builtin_profile(5,((char *) "split into strings"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sum_copy_8eb265c60f25184a(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_30));
+	}),__context__);
+	builtin_profile(5,((char *) "split into views"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sum_view_6cafb669043bcca4(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_30));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_30));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// makeLines_d09d2ee09f0022bd
+		aotLib[0x8ea06d17726415a7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&makeLines_d09d2ee09f0022bd>>();
+	};
+		// _Funcstrings_boost_0x60_split_ac735ac70fef0b27
+		aotLib[0x765defde947a4f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,TArray<char *> const )) const  &  ),&_Funcstrings_boost_0x60_split_ac735ac70fef0b27>>();
+	};
+		// _Funcstrings_boost_0x60_split_view_b02e5bf9510e1463
+		aotLib[0x8a4d42a0ecb22655] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,TArray<das::StringView> const )) const  &  ),&_Funcstrings_boost_0x60_split_view_b02e5bf9510e1463>>();
+	};
+		// sum_copy_8eb265c60f25184a
+		aotLib[0xb789a5a6819b8387] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  &  ),&sum_copy_8eb265c60f25184a>>();
+	};
+		// sum_view_6cafb669043bcca4
+		aotLib[0x2951acf81ed970bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  &  ),&sum_view_6cafb669043bcca4>>();
+	};
+		// test_673d40ce1603f706
+		aotLib[0x7ed41009123e8551] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_673d40ce1603f706>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
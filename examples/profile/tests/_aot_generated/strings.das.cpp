@@ -0,0 +1,285 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+TypeInfo * __tinfo_0[5] = { &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__95e97e5e, &__type_info__3ffbf730 };
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline int32_t find_all_c3d3531da05a7233 ( Context * __context__, TArray<char *> const  & __lines_rename_at_14 );
+inline int32_t find_char_all_40eb6fd4847ac6bb ( Context * __context__, TArray<char *> const  & __lines_rename_at_21 );
+inline int32_t find_set_all_119a2c0977ff5c3b ( Context * __context__, TArray<char *> const  & __lines_rename_at_28 );
+inline void makeLines_5fc668216160d9c1 ( Context * __context__, TArray<char *> & __lines_rename_at_8 );
+inline int32_t replace_all_a2dfd1c0f6ea6c ( Context * __context__, TArray<char *> const  & __lines_rename_at_49 );
+inline int32_t strip_all_5c2dd5daeb67a0d0 ( Context * __context__, TArray<char *> const  & __lines_rename_at_42 );
+inline bool test_9162289680277c3c ( Context * __context__ );
+inline int32_t upper_all_d3e296e76dcb2ec8 ( Context * __context__, TArray<char *> const  & __lines_rename_at_35 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_280),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline int32_t find_all_c3d3531da05a7233 ( Context * __context__, TArray<char *> const  &  __lines_rename_at_14 )
+{
+	int32_t __total_rename_at_15 = 0;
+	{
+		bool __need_loop_16 = true;
+		// line : string const&
+		das_iterator<TArray<char *> const > __line_iterator(__lines_rename_at_14);
+		char * const  * __line_rename_at_16;
+		__need_loop_16 = __line_iterator.first(__context__,(__line_rename_at_16)) && __need_loop_16;
+		for ( ; __need_loop_16 ; __need_loop_16 = __line_iterator.next(__context__,(__line_rename_at_16)) )
+		{
+			__total_rename_at_15 += builtin_string_find2((*__line_rename_at_16),((char *) "status="));
+		}
+		__line_iterator.close(__context__,(__line_rename_at_16));
+	};
+	return __total_rename_at_15;
+}
+
+inline int32_t find_char_all_40eb6fd4847ac6bb ( Context * __context__, TArray<char *> const  &  __lines_rename_at_21 )
+{
+	int32_t __total_rename_at_22 = 0;
+	{
+		bool __need_loop_23 = true;
+		// line : string const&
+		das_iterator<TArray<char *> const > __line_iterator(__lines_rename_at_21);
+		char * const  * __line_rename_at_23;
+		__need_loop_23 = __line_iterator.first(__context__,(__line_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __line_iterator.next(__context__,(__line_rename_at_23)) )
+		{
+			__total_rename_at_22 += builtin_find_first_char_of((*__line_rename_at_23),63,__context__);
+		}
+		__line_iterator.close(__context__,(__line_rename_at_23));
+	};
+	return __total_rename_at_22;
+}
+
+inline int32_t find_set_all_119a2c0977ff5c3b ( Context * __context__, TArray<char *> const  &  __lines_rename_at_28 )
+{
+	int32_t __total_rename_at_29 = 0;
+	{
+		bool __need_loop_30 = true;
+		// line : string const&
+		das_iterator<TArray<char *> const > __line_iterator(__lines_rename_at_28);
+		char * const  * __line_rename_at_30;
+		__need_loop_30 = __line_iterator.first(__context__,(__line_rename_at_30)) && __need_loop_30;
+		for ( ; __need_loop_30 ; __need_loop_30 = __line_iterator.next(__context__,(__line_rename_at_30)) )
+		{
+			__total_rename_at_29 += builtin_find_first_of((*__line_rename_at_30),((char *) "?=&"),__context__);
+		}
+		__line_iterator.close(__context__,(__line_rename_at_30));
+	};
+	return __total_rename_at_29;
+}
+
+inline void makeLines_5fc668216160d9c1 ( Context * __context__, TArray<char *> &  __lines_rename_at_8 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_8),100000);
+	{
+		bool __need_loop_10 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100000));
+		int32_t __i_rename_at_10;
+		__need_loop_10 = __i_iterator.first(__context__,(__i_rename_at_10)) && __need_loop_10;
+		for ( ; __need_loop_10 ; __need_loop_10 = __i_iterator.next(__context__,(__i_rename_at_10)) )
+		{
+			das_copy(__lines_rename_at_8(__i_rename_at_10,__context__),das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_0, cast<char * const >::from(((char *) "   GET /api/v1/users/")), cast<int32_t>::from(__i_rename_at_10), cast<char * const >::from(((char *) "/profile?fields=name,email,created_at HTTP/1.1 status=")), cast<int32_t>::from((SimPolicy<int32_t>::Mod(__i_rename_at_10,500,*__context__))), cast<char * const >::from(((char *) " Agent=Mozilla   ")))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_10));
+	};
+}
+
+inline int32_t replace_all_a2dfd1c0f6ea6c ( Context * __context__, TArray<char *> const  &  __lines_rename_at_49 )
+{
+	int32_t __total_rename_at_50 = 0;
+	{
+		bool __need_loop_51 = true;
+		// line : string const&
+		das_iterator<TArray<char *> const > __line_iterator(__lines_rename_at_49);
+		char * const  * __line_rename_at_51;
+		__need_loop_51 = __line_iterator.first(__context__,(__line_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __line_iterator.next(__context__,(__line_rename_at_51)) )
+		{
+			__total_rename_at_50 += builtin_string_length(((char *)(builtin_string_replace((*__line_rename_at_51),((char *) "users"),((char *) "accounts"),__context__))),__context__);
+		}
+		__line_iterator.close(__context__,(__line_rename_at_51));
+	};
+	return __total_rename_at_50;
+}
+
+inline int32_t strip_all_5c2dd5daeb67a0d0 ( Context * __context__, TArray<char *> const  &  __lines_rename_at_42 )
+{
+	int32_t __total_rename_at_43 = 0;
+	{
+		bool __need_loop_44 = true;
+		// line : string const&
+		das_iterator<TArray<char *> const > __line_iterator(__lines_rename_at_42);
+		char * const  * __line_rename_at_44;
+		__need_loop_44 = __line_iterator.first(__context__,(__line_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __line_iterator.next(__context__,(__line_rename_at_44)) )
+		{
+			__total_rename_at_43 += builtin_string_length(((char *)(builtin_string_strip((*__line_rename_at_44),__context__))),__context__);
+		}
+		__line_iterator.close(__context__,(__line_rename_at_44));
+	};
+	return __total_rename_at_43;
+}
+
+inline bool test_9162289680277c3c ( Context * __context__ ) { das_stack_prologue __prologue(__context__,352,"test " DAS_FILE_LINE);
+{
+	TArray<char *> __lines_rename_at_57; das_zero(__lines_rename_at_57);
+	makeLines_5fc668216160d9c1(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_57));
+	builtin_profile(20,((char *) "string find substring"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		find_all_c3d3531da05a7233(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_57));
+	}),__context__);
+	builtin_profile(20,((char *) "string find character"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		find_char_all_40eb6fd4847ac6bb(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_57));
+	}),__context__);
+	builtin_profile(20,((char *) "string find first of set"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		find_set_all_119a2c0977ff5c3b(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_57));
+	}),__context__);
+	builtin_profile(20,((char *) "string to_upper"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		upper_all_d3e296e76dcb2ec8(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_57));
+	}),__context__);
+	builtin_profile(20,((char *) "string strip"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		strip_all_5c2dd5daeb67a0d0(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_57));
+	}),__context__);
+	builtin_profile(20,((char *) "string replace"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		replace_all_a2dfd1c0f6ea6c(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_57));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_57));
+	return true;
+}}
+
+inline int32_t upper_all_d3e296e76dcb2ec8 ( Context * __context__, TArray<char *> const  &  __lines_rename_at_35 )
+{
+	int32_t __total_rename_at_36 = 0;
+	{
+		bool __need_loop_37 = true;
+		// line : string const&
+		das_iterator<TArray<char *> const > __line_iterator(__lines_rename_at_35);
+		char * const  * __line_rename_at_37;
+		__need_loop_37 = __line_iterator.first(__context__,(__line_rename_at_37)) && __need_loop_37;
+		for ( ; __need_loop_37 ; __need_loop_37 = __line_iterator.next(__context__,(__line_rename_at_37)) )
+		{
+			__total_rename_at_36 += builtin_string_length(((char *)(builtin_string_toupper((*__line_rename_at_37),__context__))),__context__);
+		}
+		__line_iterator.close(__context__,(__line_rename_at_37));
+	};
+	return __total_rename_at_36;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// find_all_c3d3531da05a7233
+		aotLib[0x6ff99631442a2121] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  &  ),&find_all_c3d3531da05a7233>>();
+	};
+		// find_char_all_40eb6fd4847ac6bb
+		aotLib[0x7ae107a0fa834e29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  &  ),&find_char_all_40eb6fd4847ac6bb>>();
+	};
+		// find_set_all_119a2c0977ff5c3b
+		aotLib[0xc22cee3067b42e31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  &  ),&find_set_all_119a2c0977ff5c3b>>();
+	};
+		// makeLines_5fc668216160d9c1
+		aotLib[0x3e5d45ffe089f107] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&makeLines_5fc668216160d9c1>>();
+	};
+		// replace_all_a2dfd1c0f6ea6c
+		aotLib[0x2c88a0295dd55751] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  &  ),&replace_all_a2dfd1c0f6ea6c>>();
+	};
+		// strip_all_5c2dd5daeb67a0d0
+		aotLib[0xe5edf520b9ad0ead] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  &  ),&strip_all_5c2dd5daeb67a0d0>>();
+	};
+		// test_9162289680277c3c
+		aotLib[0x67245cc14102a72c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9162289680277c3c>>();
+	};
+		// upper_all_d3e296e76dcb2ec8
+		aotLib[0x14347099f2dadcbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  &  ),&upper_all_d3e296e76dcb2ec8>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,188 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_175, int32_t __at_rename_at_175 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_287 );
+inline bool _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1 ( Context * __context__, TTable<int32_t,int32_t> const  & __Tab_rename_at_178, int32_t __at_rename_at_178 );
+inline void erase_keys_7af86bd7ea084f6a ( Context * __context__, TTable<int32_t,int32_t> & __tab_rename_at_16 );
+inline void insert_keys_4a96249bc98fae5d ( Context * __context__, TTable<int32_t,int32_t> & __tab_rename_at_4 );
+inline int32_t lookup_keys_49167081bfedb584 ( Context * __context__, TTable<int32_t,int32_t> & __tab_rename_at_9 );
+inline bool test_725248ee60b566e4 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_175, int32_t __at_rename_at_175 )
+{
+	return __builtin_table_erase(__context__,__Tab_rename_at_175,__at_rename_at_175);
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_287 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_287),4,4,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1 ( Context * __context__, TTable<int32_t,int32_t> const  &  __Tab_rename_at_178, int32_t __at_rename_at_178 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_178,__at_rename_at_178);
+}
+
+inline void erase_keys_7af86bd7ea084f6a ( Context * __context__, TTable<int32_t,int32_t> &  __tab_rename_at_16 )
+{
+	{
+		bool __need_loop_17 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,5000000));
+		int32_t __i_rename_at_17;
+		__need_loop_17 = __i_iterator.first(__context__,(__i_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __i_iterator.next(__context__,(__i_rename_at_17)) )
+		{
+			_Funcbuiltin_0x60_erase_3b06d4792ac86bb9(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_16),__i_rename_at_17 * 14);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_17));
+	};
+}
+
+inline void insert_keys_4a96249bc98fae5d ( Context * __context__, TTable<int32_t,int32_t> &  __tab_rename_at_4 )
+{
+	{
+		bool __need_loop_5 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000000));
+		int32_t __i_rename_at_5;
+		__need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5)) )
+		{
+			das_copy(__tab_rename_at_4((__i_rename_at_5 * 7),__context__),__i_rename_at_5);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_5));
+	};
+}
+
+inline int32_t lookup_keys_49167081bfedb584 ( Context * __context__, TTable<int32_t,int32_t> &  __tab_rename_at_9 )
+{
+	int32_t __found_rename_at_10 = 0;
+	{
+		bool __need_loop_11 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,20000000));
+		int32_t __i_rename_at_11;
+		__need_loop_11 = __i_iterator.first(__context__,(__i_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __i_iterator.next(__context__,(__i_rename_at_11)) )
+		{
+			if ( _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_9),__i_rename_at_11 * 7) )
+			{
+				__found_rename_at_10++;
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_11));
+	};
+	return __found_rename_at_10;
+}
+
+inline bool test_725248ee60b566e4 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,272,"test " DAS_FILE_LINE);
+{
+	TTable<int32_t,int32_t> __tab_rename_at_22; das_zero(__tab_rename_at_22);
+	builtin_profile(1,((char *) "table 10M keys, insert"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		builtin_table_clear(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22),__context__);
+		insert_keys_4a96249bc98fae5d(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22));
+	}),__context__);
+	builtin_profile(1,((char *) "table 10M keys, lookup"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		lookup_keys_49167081bfedb584(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22));
+	}),__context__);
+	builtin_profile(1,((char *) "table 10M keys, erase half"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		erase_keys_7af86bd7ea084f6a(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22));
+	}),__context__);
+	builtin_profile(1,((char *) "table 10M keys, lookup after erase"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		lookup_keys_49167081bfedb584(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_erase_3b06d4792ac86bb9
+		aotLib[0x25338066fdc3cf05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_3b06d4792ac86bb9>>();
+	};
+		// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+		aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1
+		aotLib[0xdf468ea27c66cb49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1>>();
+	};
+		// erase_keys_7af86bd7ea084f6a
+		aotLib[0x22d380657e90ba91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&erase_keys_7af86bd7ea084f6a>>();
+	};
+		// insert_keys_4a96249bc98fae5d
+		aotLib[0x7a515bcf75a4c3f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&insert_keys_4a96249bc98fae5d>>();
+	};
+		// lookup_keys_49167081bfedb584
+		aotLib[0x3767a58acb84256] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&lookup_keys_49167081bfedb584>>();
+	};
+		// test_725248ee60b566e4
+		aotLib[0xda563a020181f0c2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_725248ee60b566e4>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
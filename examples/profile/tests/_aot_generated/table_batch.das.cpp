@@ -0,0 +1,279 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__f1b9498d;
+extern TypeInfo __type_info__ac987970;
+extern TypeInfo __type_info__d2401e5a;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__43fda976;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__f1b9498d = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xf1b9498d };
+TypeInfo __type_info__ac987970 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xac987970 };
+TypeInfo __type_info__d2401e5a = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__95e97e5e, &__type_info__95e97e5e, nullptr, nullptr, 0, 0, nullptr, 2, 0xd2401e5a };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__43fda976 = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__95e97e5e, &__type_info__95e97e5e, nullptr, nullptr, 0, 0, nullptr, 34, 0x43fda976 };
+
+TypeInfo * __tinfo_0[3] = { &__type_info__d2401e5a, &__type_info__f1b9498d, &__type_info__f1b9498d };
+TypeInfo * __tinfo_1[3] = { &__type_info__43fda976, &__type_info__f1b9498d, &__type_info__ac987970 };
+
+inline void _Funcbuiltin_0x60_finalize_332d1b0381aed2e2 ( Context * __context__, TArray<bool> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_287 );
+inline void _Funcbuiltin_0x60_insert_batch_9d81edcd42242c68 ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_199, TArray<int32_t> const  & __Keys_rename_at_199, TArray<int32_t> const  & __Values_rename_at_199 );
+inline bool _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1 ( Context * __context__, TTable<int32_t,int32_t> const  & __Tab_rename_at_178, int32_t __at_rename_at_178 );
+inline void _Funcbuiltin_0x60_key_exists_batch_a33af0efaa636e0e ( Context * __context__, TTable<int32_t,int32_t> const  & __Tab_rename_at_182, TArray<int32_t> const  & __Keys_rename_at_182, TArray<bool> & __Result_rename_at_182 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline int32_t lookup_batch_1f79cad160a80e79 ( Context * __context__, TTable<int32_t,int32_t> const  & __tab_rename_at_17, TArray<int32_t> const  & __keys_rename_at_17, TArray<bool> & __res_rename_at_17 );
+inline int32_t lookup_one_by_one_c261d2e63035221 ( Context * __context__, TTable<int32_t,int32_t> const  & __tab_rename_at_10, TArray<int32_t> const  & __keys_rename_at_10 );
+inline void make_keys_cb4e750781186048 ( Context * __context__, TArray<int32_t> & __keys_rename_at_4 );
+inline bool test_1f07f4e1f16c131c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_332d1b0381aed2e2 ( Context * __context__, TArray<bool> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<bool>>::pass(__a_rename_at_280),1,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_280),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_287 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_287),4,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_insert_batch_9d81edcd42242c68 ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_199, TArray<int32_t> const  &  __Keys_rename_at_199, TArray<int32_t> const  &  __Values_rename_at_199 )
+{
+	das_call_interop<void>::call(&_builtin_table_insert_batch,__context__,SimNode_AotInterop<3>(__tinfo_0,cast<TTable<int32_t,int32_t> &>::from(__Tab_rename_at_199),cast<TArray<int32_t> const  &>::from(__Keys_rename_at_199),cast<TArray<int32_t> const  &>::from(__Values_rename_at_199)));
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1 ( Context * __context__, TTable<int32_t,int32_t> const  &  __Tab_rename_at_178, int32_t __at_rename_at_178 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_178,__at_rename_at_178);
+}
+
+inline void _Funcbuiltin_0x60_key_exists_batch_a33af0efaa636e0e ( Context * __context__, TTable<int32_t,int32_t> const  &  __Tab_rename_at_182, TArray<int32_t> const  &  __Keys_rename_at_182, TArray<bool> &  __Result_rename_at_182 )
+{
+	das_call_interop<void>::call(&_builtin_table_key_exists_batch,__context__,SimNode_AotInterop<3>(__tinfo_1,cast<TTable<int32_t,int32_t> const  &>::from(__Tab_rename_at_182),cast<TArray<int32_t> const  &>::from(__Keys_rename_at_182),cast<TArray<bool> &>::from(__Result_rename_at_182)));
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline int32_t lookup_batch_1f79cad160a80e79 ( Context * __context__, TTable<int32_t,int32_t> const  &  __tab_rename_at_17, TArray<int32_t> const  &  __keys_rename_at_17, TArray<bool> &  __res_rename_at_17 )
+{
+	_Funcbuiltin_0x60_key_exists_batch_a33af0efaa636e0e(__context__,__tab_rename_at_17,__keys_rename_at_17,das_arg<TArray<bool>>::pass(__res_rename_at_17));
+	int32_t __found_rename_at_19 = 0;
+	{
+		bool __need_loop_20 = true;
+		// r : bool&
+		das_iterator<TArray<bool>> __r_iterator(__res_rename_at_17);
+		bool * __r_rename_at_20;
+		__need_loop_20 = __r_iterator.first(__context__,(__r_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __r_iterator.next(__context__,(__r_rename_at_20)) )
+		{
+			if ( (*__r_rename_at_20) )
+			{
+				__found_rename_at_19++;
+			};
+		}
+		__r_iterator.close(__context__,(__r_rename_at_20));
+	};
+	return __found_rename_at_19;
+}
+
+inline int32_t lookup_one_by_one_c261d2e63035221 ( Context * __context__, TTable<int32_t,int32_t> const  &  __tab_rename_at_10, TArray<int32_t> const  &  __keys_rename_at_10 )
+{
+	int32_t __found_rename_at_11 = 0;
+	{
+		bool __need_loop_12 = true;
+		// k : int const&
+		das_iterator<TArray<int32_t> const > __k_iterator(__keys_rename_at_10);
+		int32_t const  * __k_rename_at_12;
+		__need_loop_12 = __k_iterator.first(__context__,(__k_rename_at_12)) && __need_loop_12;
+		for ( ; __need_loop_12 ; __need_loop_12 = __k_iterator.next(__context__,(__k_rename_at_12)) )
+		{
+			if ( _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1(__context__,__tab_rename_at_10,(*__k_rename_at_12)) )
+			{
+				__found_rename_at_11++;
+			};
+		}
+		__k_iterator.close(__context__,(__k_rename_at_12));
+	};
+	return __found_rename_at_11;
+}
+
+inline void make_keys_cb4e750781186048 ( Context * __context__, TArray<int32_t> &  __keys_rename_at_4 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_4),1000000);
+	{
+		bool __need_loop_6 = true;
+		// k : int&
+		das_iterator<TArray<int32_t>> __k_iterator(__keys_rename_at_4);
+		int32_t * __k_rename_at_6;
+		__need_loop_6 = __k_iterator.first(__context__,(__k_rename_at_6)) && __need_loop_6;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_6;
+		__need_loop_6 = __i_iterator.first(__context__,(__i_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __k_iterator.next(__context__,(__k_rename_at_6)) && __i_iterator.next(__context__,(__i_rename_at_6)) )
+		{
+			das_copy((*__k_rename_at_6),SimPolicy<int32_t>::Mod((__i_rename_at_6 * 7919),2000000,*__context__));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_6));
+		__i_iterator.close(__context__,(__i_rename_at_6));
+	};
+}
+
+inline bool test_1f07f4e1f16c131c ( Context * __context__ ) { das_stack_prologue __prologue(__context__,400,"test " DAS_FILE_LINE);
+{
+	TTable<int32_t,int32_t> __tab_rename_at_27; das_zero(__tab_rename_at_27);
+	TArray<int32_t> __keys_rename_at_28; das_zero(__keys_rename_at_28);
+	TArray<int32_t> __values_rename_at_29; das_zero(__values_rename_at_29);
+	make_keys_cb4e750781186048(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_28));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__values_rename_at_29),1000000);
+	builtin_profile(1,((char *) "table 1M keys, insert one by one"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		builtin_table_clear(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_27),__context__);
+		{
+			bool __need_loop_34 = true;
+			// k : int&
+			das_iterator<TArray<int32_t>> __k_iterator(__keys_rename_at_28);
+			int32_t * __k_rename_at_34;
+			__need_loop_34 = __k_iterator.first(__context__,(__k_rename_at_34)) && __need_loop_34;
+			// v : int&
+			das_iterator<TArray<int32_t>> __v_iterator(__values_rename_at_29);
+			int32_t * __v_rename_at_34;
+			__need_loop_34 = __v_iterator.first(__context__,(__v_rename_at_34)) && __need_loop_34;
+			for ( ; __need_loop_34 ; __need_loop_34 = __k_iterator.next(__context__,(__k_rename_at_34)) && __v_iterator.next(__context__,(__v_rename_at_34)) )
+			{
+				das_copy(__tab_rename_at_27((*__k_rename_at_34),__context__),(*__v_rename_at_34));
+			}
+			__k_iterator.close(__context__,(__k_rename_at_34));
+			__v_iterator.close(__context__,(__v_rename_at_34));
+		};
+	}),__context__);
+	builtin_profile(1,((char *) "table 1M keys, insert_batch"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		builtin_table_clear(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_27),__context__);
+		_Funcbuiltin_0x60_insert_batch_9d81edcd42242c68(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_27),das_arg<TArray<int32_t>>::pass(__keys_rename_at_28),das_arg<TArray<int32_t>>::pass(__values_rename_at_29));
+	}),__context__);
+	builtin_profile(10,((char *) "table 1M keys, key_exists one by one"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		lookup_one_by_one_c261d2e63035221(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_27),das_arg<TArray<int32_t>>::pass(__keys_rename_at_28));
+	}),__context__);
+	TArray<bool> __res_rename_at_41; das_zero(__res_rename_at_41);
+	builtin_profile(10,((char *) "table 1M keys, key_exists_batch"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		lookup_batch_1f79cad160a80e79(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_27),das_arg<TArray<int32_t>>::pass(__keys_rename_at_28),das_arg<TArray<bool>>::pass(__res_rename_at_41));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_27));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_28));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__values_rename_at_29));
+	_Funcbuiltin_0x60_finalize_332d1b0381aed2e2(__context__,das_arg<TArray<bool>>::pass(__res_rename_at_41));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_332d1b0381aed2e2
+		aotLib[0x97e55bfa28d80b21] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<bool> &  ),&_Funcbuiltin_0x60_finalize_332d1b0381aed2e2>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+		aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+		// _Funcbuiltin_0x60_insert_batch_9d81edcd42242c68
+		aotLib[0xc98a1959e4ccb9fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> & , TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_insert_batch_9d81edcd42242c68>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1
+		aotLib[0xdf468ea27c66cb49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_batch_a33af0efaa636e0e
+		aotLib[0x24ddca35102cb0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> const  & , TArray<int32_t> const  & , TArray<bool> &  ),&_Funcbuiltin_0x60_key_exists_batch_a33af0efaa636e0e>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// lookup_batch_1f79cad160a80e79
+		aotLib[0xc54e445adb5252f4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<int32_t,int32_t> const  & , TArray<int32_t> const  & , TArray<bool> &  ),&lookup_batch_1f79cad160a80e79>>();
+	};
+		// lookup_one_by_one_c261d2e63035221
+		aotLib[0x85ab815d8ecf89ea] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<int32_t,int32_t> const  & , TArray<int32_t> const  &  ),&lookup_one_by_one_c261d2e63035221>>();
+	};
+		// make_keys_cb4e750781186048
+		aotLib[0xcab1cdbd338c6f45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&make_keys_cb4e750781186048>>();
+	};
+		// test_1f07f4e1f16c131c
+		aotLib[0x23eb4eb7a0793ead] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_1f07f4e1f16c131c>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,181 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_175, int32_t __at_rename_at_175 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_287 );
+inline bool _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1 ( Context * __context__, TTable<int32_t,int32_t> const  & __Tab_rename_at_178, int32_t __at_rename_at_178 );
+inline void _Funcbuiltin_0x60_shrink_to_fit_10a5632c276dab7c ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_33 );
+inline void churn_6b50b08ae77c66de ( Context * __context__, TTable<int32_t,int32_t> & __tab_rename_at_6 );
+inline int32_t lookup_keys_dc7b94514a32bcec ( Context * __context__, TTable<int32_t,int32_t> const  & __tab_rename_at_13 );
+inline bool test_470acb222607851d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_175, int32_t __at_rename_at_175 )
+{
+	return __builtin_table_erase(__context__,__Tab_rename_at_175,__at_rename_at_175);
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_287 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_287),4,4,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1 ( Context * __context__, TTable<int32_t,int32_t> const  &  __Tab_rename_at_178, int32_t __at_rename_at_178 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_178,__at_rename_at_178);
+}
+
+inline void _Funcbuiltin_0x60_shrink_to_fit_10a5632c276dab7c ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_33 )
+{
+	builtin_table_shrink(das_arg<TTable<int32_t,int32_t>>::pass(__Tab_rename_at_33),4,4,__context__);
+}
+
+inline void churn_6b50b08ae77c66de ( Context * __context__, TTable<int32_t,int32_t> &  __tab_rename_at_6 )
+{
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			das_copy(__tab_rename_at_6(__i_rename_at_7,__context__),__i_rename_at_7);
+			if ( __i_rename_at_7 >= 100000 )
+			{
+				_Funcbuiltin_0x60_erase_3b06d4792ac86bb9(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_6),__i_rename_at_7 - 100000);
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline int32_t lookup_keys_dc7b94514a32bcec ( Context * __context__, TTable<int32_t,int32_t> const  &  __tab_rename_at_13 )
+{
+	int32_t __found_rename_at_14 = 0;
+	{
+		bool __need_loop_15 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_15;
+		__need_loop_15 = __i_iterator.first(__context__,(__i_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __i_iterator.next(__context__,(__i_rename_at_15)) )
+		{
+			if ( _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1(__context__,__tab_rename_at_13,__i_rename_at_15) )
+			{
+				__found_rename_at_14++;
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_15));
+	};
+	return __found_rename_at_14;
+}
+
+inline bool test_470acb222607851d ( Context * __context__ ) { das_stack_prologue __prologue(__context__,272,"test " DAS_FILE_LINE);
+{
+	TTable<int32_t,int32_t> __tab_rename_at_22; das_zero(__tab_rename_at_22);
+	builtin_profile(1,((char *) "table churn, 1M inserts with 100K live keys"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		builtin_table_clear(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22),__context__);
+		churn_6b50b08ae77c66de(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22));
+	}),__context__);
+	builtin_profile(10,((char *) "table churn, lookup"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		lookup_keys_dc7b94514a32bcec(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22));
+	}),__context__);
+	builtin_profile(1,((char *) "table churn, shrink_to_fit"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		_Funcbuiltin_0x60_shrink_to_fit_10a5632c276dab7c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22));
+	}),__context__);
+	builtin_profile(10,((char *) "table churn, lookup after shrink"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		lookup_keys_dc7b94514a32bcec(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_22));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_erase_3b06d4792ac86bb9
+		aotLib[0x25338066fdc3cf05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_3b06d4792ac86bb9>>();
+	};
+		// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+		aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1
+		aotLib[0xdf468ea27c66cb49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_ffa62b2123f77dd1>>();
+	};
+		// _Funcbuiltin_0x60_shrink_to_fit_10a5632c276dab7c
+		aotLib[0x4d1d192884f5f3e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_shrink_to_fit_10a5632c276dab7c>>();
+	};
+		// churn_6b50b08ae77c66de
+		aotLib[0x9089345ec435e5e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&churn_6b50b08ae77c66de>>();
+	};
+		// lookup_keys_dc7b94514a32bcec
+		aotLib[0xba0a07183a4d5756] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&lookup_keys_dc7b94514a32bcec>>();
+	};
+		// test_470acb222607851d
+		aotLib[0xa1b5b0f32c197ad9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_470acb222607851d>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,166 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_175, int32_t __at_rename_at_175 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_287 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_6c2830dfa4ff0355 ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_257 );
+inline int32_t sum_keys_5d0df57da5c5b388 ( Context * __context__, TTable<int32_t,int32_t> const  & __tab_rename_at_4 );
+inline bool test_328cce8ef5f1384 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_175, int32_t __at_rename_at_175 )
+{
+	return __builtin_table_erase(__context__,__Tab_rename_at_175,__at_rename_at_175);
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_287 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_287),4,4,__context__);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_6c2830dfa4ff0355 ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_257 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_258; das_zero(__it_rename_at_258);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_258),__a_rename_at_257,4,__context__);
+	return /* <- */ __it_rename_at_258;
+}
+
+inline int32_t sum_keys_5d0df57da5c5b388 ( Context * __context__, TTable<int32_t,int32_t> const  &  __tab_rename_at_4 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_6_48;
+	int32_t __total_rename_at_5 = 0;
+	{
+		bool __need_loop_6 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_6_48 = (_Funcbuiltin_0x60_keys_6c2830dfa4ff0355(__context__,__tab_rename_at_4))));
+		int32_t const  * __k_rename_at_6;
+		__need_loop_6 = __k_iterator.first(__context__,(__k_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __k_iterator.next(__context__,(__k_rename_at_6)) )
+		{
+			__total_rename_at_5 += (*__k_rename_at_6);
+		}
+		__k_iterator.close(__context__,(__k_rename_at_6));
+	};
+	return __total_rename_at_5;
+}
+
+inline bool test_328cce8ef5f1384 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,208,"test " DAS_FILE_LINE);
+{
+	TTable<int32_t,int32_t> __tab_rename_at_12; das_zero(__tab_rename_at_12);
+	{
+		bool __need_loop_13 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_13;
+		__need_loop_13 = __i_iterator.first(__context__,(__i_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __i_iterator.next(__context__,(__i_rename_at_13)) )
+		{
+			das_copy(__tab_rename_at_12(__i_rename_at_13,__context__),__i_rename_at_13);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_13));
+	};
+	builtin_profile(20,((char *) "table 1M keys, iterate"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sum_keys_5d0df57da5c5b388(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_12));
+	}),__context__);
+	{
+		bool __need_loop_17 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_17;
+		__need_loop_17 = __i_iterator.first(__context__,(__i_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __i_iterator.next(__context__,(__i_rename_at_17)) )
+		{
+			if ( (SimPolicy<int32_t>::Mod(__i_rename_at_17,16,*__context__)) != 0 )
+			{
+				_Funcbuiltin_0x60_erase_3b06d4792ac86bb9(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_12),__i_rename_at_17);
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_17));
+	};
+	builtin_profile(20,((char *) "table 1M keys, 1/16 left, iterate"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		sum_keys_5d0df57da5c5b388(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_12));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_12));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_erase_3b06d4792ac86bb9
+		aotLib[0x25338066fdc3cf05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_3b06d4792ac86bb9>>();
+	};
+		// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+		aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+		// _Funcbuiltin_0x60_keys_6c2830dfa4ff0355
+		aotLib[0x40b58262c96d3a05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_keys_6c2830dfa4ff0355>>();
+	};
+		// sum_keys_5d0df57da5c5b388
+		aotLib[0x1dfd0f7a7d6b6fe1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&sum_keys_5d0df57da5c5b388>>();
+	};
+		// test_328cce8ef5f1384
+		aotLib[0x8b1a3fc6e9f07f00] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_328cce8ef5f1384>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
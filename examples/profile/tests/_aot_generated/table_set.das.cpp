@@ -0,0 +1,253 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__3d22364;
+extern TypeInfo __type_info__91270d7b;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__3d22364 = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x3d22364 };
+TypeInfo __type_info__91270d7b = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__95e97e5e, &__type_info__48b5725f, nullptr, nullptr, 0, 0, nullptr, 2, 0x91270d7b };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__91270d7b, &__type_info__359c1b32 };
+TypeInfo * __tinfo_1[3] = { &__type_info__3ffbf730, &__type_info__3d22364, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[3] = { &__type_info__3ffbf730, &__type_info__3d22364, &__type_info__3ffbf730 };
+
+inline void _Funcbuiltin_0x60_finalize_174cce982d7cfe48 ( Context * __context__, TTable<int32_t,bool> & __a_rename_at_287 );
+inline void _Funcbuiltin_0x60_finalize_dd0710b85d81813f ( Context * __context__, TTable<int32_t,void> & __a_rename_at_287 );
+inline bool _Funcbuiltin_0x60_insert_db76063e7079d629 ( Context * __context__, TTable<int32_t,void> & __Tab_rename_at_204, int32_t __at_rename_at_204 );
+inline bool _Funcbuiltin_0x60_key_exists_161a3dd225d1cb99 ( Context * __context__, TTable<int32_t,bool> const  & __Tab_rename_at_178, int32_t __at_rename_at_178 );
+inline bool _Funcbuiltin_0x60_key_exists_62fcc4e31829d134 ( Context * __context__, TTable<int32_t,void> const  & __Tab_rename_at_178, int32_t __at_rename_at_178 );
+inline int32_t count_bool_8cdcacee23fecb46 ( Context * __context__, TTable<int32_t,bool> const  & __s_rename_at_21 );
+inline int32_t count_set_23e239c6dfda2e22 ( Context * __context__, TTable<int32_t,void> const  & __s_rename_at_13 );
+inline void fill_bool_2aa1d252ef151a85 ( Context * __context__, TTable<int32_t,bool> & __s_rename_at_8 );
+inline void fill_set_27c531d09ea04d23 ( Context * __context__, TTable<int32_t,void> & __s_rename_at_4 );
+inline bool test_fb8ae72341029716 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_174cce982d7cfe48 ( Context * __context__, TTable<int32_t,bool> &  __a_rename_at_287 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,bool>>::pass(__a_rename_at_287),4,1,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_dd0710b85d81813f ( Context * __context__, TTable<int32_t,void> &  __a_rename_at_287 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,void>>::pass(__a_rename_at_287),4,0,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_insert_db76063e7079d629 ( Context * __context__, TTable<int32_t,void> &  __Tab_rename_at_204, int32_t __at_rename_at_204 )
+{
+	return das_call_interop<bool>::call(&_builtin_table_set_insert,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TTable<int32_t,void> &>::from(__Tab_rename_at_204),cast<int32_t>::from(__at_rename_at_204)));
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_161a3dd225d1cb99 ( Context * __context__, TTable<int32_t,bool> const  &  __Tab_rename_at_178, int32_t __at_rename_at_178 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_178,__at_rename_at_178);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_62fcc4e31829d134 ( Context * __context__, TTable<int32_t,void> const  &  __Tab_rename_at_178, int32_t __at_rename_at_178 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_178,__at_rename_at_178);
+}
+
+inline int32_t count_bool_8cdcacee23fecb46 ( Context * __context__, TTable<int32_t,bool> const  &  __s_rename_at_21 )
+{
+	int32_t __found_rename_at_22 = 0;
+	{
+		bool __need_loop_23 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,2000000));
+		int32_t __i_rename_at_23;
+		__need_loop_23 = __i_iterator.first(__context__,(__i_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __i_iterator.next(__context__,(__i_rename_at_23)) )
+		{
+			if ( _Funcbuiltin_0x60_key_exists_161a3dd225d1cb99(__context__,__s_rename_at_21,__i_rename_at_23 * 7) )
+			{
+				__found_rename_at_22++;
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_23));
+	};
+	return __found_rename_at_22;
+}
+
+inline int32_t count_set_23e239c6dfda2e22 ( Context * __context__, TTable<int32_t,void> const  &  __s_rename_at_13 )
+{
+	int32_t __found_rename_at_14 = 0;
+	{
+		bool __need_loop_15 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,2000000));
+		int32_t __i_rename_at_15;
+		__need_loop_15 = __i_iterator.first(__context__,(__i_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __i_iterator.next(__context__,(__i_rename_at_15)) )
+		{
+			if ( _Funcbuiltin_0x60_key_exists_62fcc4e31829d134(__context__,__s_rename_at_13,__i_rename_at_15 * 7) )
+			{
+				__found_rename_at_14++;
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_15));
+	};
+	return __found_rename_at_14;
+}
+
+inline void fill_bool_2aa1d252ef151a85 ( Context * __context__, TTable<int32_t,bool> &  __s_rename_at_8 )
+{
+	{
+		bool __need_loop_9 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_9;
+		__need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9)) && __need_loop_9;
+		for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9)) )
+		{
+			das_copy(__s_rename_at_8((__i_rename_at_9 * 7),__context__),true);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_9));
+	};
+}
+
+inline void fill_set_27c531d09ea04d23 ( Context * __context__, TTable<int32_t,void> &  __s_rename_at_4 )
+{
+	{
+		bool __need_loop_5 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_5;
+		__need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5)) )
+		{
+			_Funcbuiltin_0x60_insert_db76063e7079d629(__context__,das_arg<TTable<int32_t,void>>::pass(__s_rename_at_4),__i_rename_at_5 * 7);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_5));
+	};
+}
+
+inline bool test_fb8ae72341029716 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,368,"test " DAS_FILE_LINE);
+{
+	TTable<int32_t,void> __s_rename_at_30; das_zero(__s_rename_at_30);
+	TTable<int32_t,bool> __b_rename_at_31; das_zero(__b_rename_at_31);
+	uint64_t __before_rename_at_32 = (uint64_t)heap_bytes_allocated(__context__);
+	builtin_profile(1,((char *) "set 1M keys, insert"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		fill_set_27c531d09ea04d23(__context__,das_arg<TTable<int32_t,void>>::pass(__s_rename_at_30));
+	}),__context__);
+	uint64_t __afterSet_rename_at_35 = (uint64_t)heap_bytes_allocated(__context__);
+	builtin_profile(1,((char *) "table<int;bool> 1M keys, insert"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		fill_bool_2aa1d252ef151a85(__context__,das_arg<TTable<int32_t,bool>>::pass(__b_rename_at_31));
+	}),__context__);
+	uint64_t __afterBool_rename_at_38 = (uint64_t)heap_bytes_allocated(__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "set 1M keys, ")), cast<int64_t>::from(int64_t(__afterSet_rename_at_35 - __before_rename_at_32)), cast<char * const >::from(((char *) " bytes\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_2, cast<char * const >::from(((char *) "table<int;bool> 1M keys, ")), cast<int64_t>::from(int64_t(__afterBool_rename_at_38 - __afterSet_rename_at_35)), cast<char * const >::from(((char *) " bytes\n")))),__context__);
+	builtin_profile(1,((char *) "set 1M keys, lookup"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		count_set_23e239c6dfda2e22(__context__,das_arg<TTable<int32_t,void>>::pass(__s_rename_at_30));
+	}),__context__);
+	builtin_profile(1,((char *) "table<int;bool> 1M keys, lookup"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		count_bool_8cdcacee23fecb46(__context__,das_arg<TTable<int32_t,bool>>::pass(__b_rename_at_31));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_dd0710b85d81813f(__context__,das_arg<TTable<int32_t,void>>::pass(__s_rename_at_30));
+	_Funcbuiltin_0x60_finalize_174cce982d7cfe48(__context__,das_arg<TTable<int32_t,bool>>::pass(__b_rename_at_31));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_174cce982d7cfe48
+		aotLib[0x7f62f10f2e231a4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,bool> &  ),&_Funcbuiltin_0x60_finalize_174cce982d7cfe48>>();
+	};
+		// _Funcbuiltin_0x60_finalize_dd0710b85d81813f
+		aotLib[0xcb94f763b2f9ae09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,void> &  ),&_Funcbuiltin_0x60_finalize_dd0710b85d81813f>>();
+	};
+		// _Funcbuiltin_0x60_insert_db76063e7079d629
+		aotLib[0xff6260c58597498d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,void> & , int32_t  ),&_Funcbuiltin_0x60_insert_db76063e7079d629>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_161a3dd225d1cb99
+		aotLib[0x8cacf766c84b96ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,bool> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_161a3dd225d1cb99>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_62fcc4e31829d134
+		aotLib[0x5d8372d9a5886791] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,void> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_62fcc4e31829d134>>();
+	};
+		// count_bool_8cdcacee23fecb46
+		aotLib[0x16c8d539a529d07e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<int32_t,bool> const  &  ),&count_bool_8cdcacee23fecb46>>();
+	};
+		// count_set_23e239c6dfda2e22
+		aotLib[0x27400f760756a5ee] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<int32_t,void> const  &  ),&count_set_23e239c6dfda2e22>>();
+	};
+		// fill_bool_2aa1d252ef151a85
+		aotLib[0xf010bd7adc766485] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,bool> &  ),&fill_bool_2aa1d252ef151a85>>();
+	};
+		// fill_set_27c531d09ea04d23
+		aotLib[0xb2b3e70c6d3b5980] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,void> &  ),&fill_set_27c531d09ea04d23>>();
+	};
+		// test_fb8ae72341029716
+		aotLib[0x8a3c28f6f71bb24e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_fb8ae72341029716>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,496 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__4040dbd3;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__7a5d8ac3;
+extern TypeInfo __type_info__6c76339b;
+extern VarInfo __var_info__d2caf980;
+extern VarInfo __var_info__bc1cd930;
+extern VarInfo __var_info__a437a6d5;
+extern FuncInfo __func_info__2c47cca3;
+
+TypeInfo * __type_info__bc1cd930_arg_types_var_1077992403[2] = { &__type_info__7a5d8ac3, &__type_info__e6eb6b88 };
+VarInfo __struct_info__4040dbd3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__bc1cd930_arg_types_var_1077992403, nullptr, 2, 0, nullptr, 28, 0xbc1cd930, "__lambda", 0 };
+TypeInfo * __type_info__a437a6d5_arg_types_var_1077992403[1] = { &__type_info__6c76339b };
+VarInfo __struct_info__4040dbd3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a437a6d5_arg_types_var_1077992403, nullptr, 1, 0, nullptr, 28, 0xa437a6d5, "__finalize", 4 };
+VarInfo __struct_info__4040dbd3_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd2caf980, "count", 8 };
+VarInfo * __struct_info__4040dbd3_fields[3] =  { &__struct_info__4040dbd3_field_0, &__struct_info__4040dbd3_field_1, &__struct_info__4040dbd3_field_2 };
+StructInfo __struct_info__4040dbd3 = {"_lambda_thismodule_34_8_1", __struct_info__4040dbd3_fields, 3, 12, -1, nullptr, 0x4040dbd3 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0xe6eb6b88 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__7a5d8ac3 = { Type::tStructure, &__struct_info__4040dbd3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x7a5d8ac3 };
+TypeInfo __type_info__6c76339b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7a5d8ac3, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x6c76339b };
+
+namespace  {
+
+struct _lambda_thismodule_34_8_1 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_34_8_1,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_34_8_1 *)) __finalize;
+	int32_t count;
+};
+static_assert(sizeof(_lambda_thismodule_34_8_1)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_34_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_34_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_34_8_1,count)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_34_8_1_0x60_finazlier_748d7645603c3c84 ( Context * __context__, struct _lambda_thismodule_34_8_1 * ____this_rename_at_34 );
+inline bool _Func_lambda_thismodule_34_8_1_0x60_function_72900bd1bdd77eb2 ( Context * __context__, struct _lambda_thismodule_34_8_1 & ____this_rename_at_34, int32_t & __a_rename_at_33 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_348 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_ec0a92925ebe3455 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_353 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_328 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_3bd22e87ecbdcf79 ( Context * __context__, char * const  __str_rename_at_334 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_280 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_287 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_6c2830dfa4ff0355 ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_257 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline int32_t _Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_122 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_e7337cf490aef504 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_374 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_374 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_d45ac51cb08b659f ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) const  & __it_rename_at_374 );
+inline void comprehension_array_87e05fca633138d2 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_42 );
+inline void comprehension_array_where_54b737421aa8c0c9 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_47 );
+inline void comprehension_range_a2e1050168f0c372 ( Context * __context__ );
+inline void drain_array_ed43d344ea751875 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_8 );
+inline void drain_keys_775daa68e5b9ee51 ( Context * __context__, TTable<int32_t,int32_t> const  & __tab_rename_at_26 );
+inline void drain_lambda_2294cb420790bb5c ( Context * __context__ );
+inline void drain_range_3562d5310ff4b575 ( Context * __context__ );
+inline void drain_string_783221109f5971db ( Context * __context__, char * const  __s_rename_at_19 );
+inline void finalize_4f152d911ddfb009 ( Context * __context__, struct _lambda_thismodule_34_8_1 & ____this_rename_at_34 );
+inline bool test_afeaac1964b354a6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_34_8_1_0x60_finazlier_748d7645603c3c84 ( Context * __context__, struct _lambda_thismodule_34_8_1 * ____this_rename_at_34 )
+{
+	finalize_4f152d911ddfb009(__context__,das_arg<struct _lambda_thismodule_34_8_1>::pass(das_deref(__context__,____this_rename_at_34)));
+	das_delete_lambda_struct<struct _lambda_thismodule_34_8_1 *>::clear(__context__,____this_rename_at_34);
+}
+
+inline bool _Func_lambda_thismodule_34_8_1_0x60_function_72900bd1bdd77eb2 ( Context * __context__, struct _lambda_thismodule_34_8_1 &  ____this_rename_at_34, int32_t & __a_rename_at_33 )
+{
+	if ( ____this_rename_at_34.count < 1000000 )
+	{
+		das_copy(__a_rename_at_33,____this_rename_at_34.count++);
+		return true;
+	} else {
+		return false;
+	};
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_348 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_349; das_zero(__it_rename_at_349);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_349),__a_rename_at_348,4,__context__);
+	return /* <- */ __it_rename_at_349;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_ec0a92925ebe3455 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_353 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_355; das_zero(__it_rename_at_355);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_355),__lam_rename_at_353,__context__);
+	return /* <- */ __it_rename_at_355;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_328 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_329; das_zero(__it_rename_at_329);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_329),__rng_rename_at_328,__context__);
+	return /* <- */ __it_rename_at_329;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_3bd22e87ecbdcf79 ( Context * __context__, char * const  __str_rename_at_334 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_335; das_zero(__it_rename_at_335);
+	builtin_make_string_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_335),__str_rename_at_334,__context__);
+	return /* <- */ __it_rename_at_335;
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_280 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_280),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_287 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_287),4,4,__context__);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_6c2830dfa4ff0355 ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_257 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_258; das_zero(__it_rename_at_258);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_258),__a_rename_at_257,4,__context__);
+	return /* <- */ __it_rename_at_258;
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_122 )
+{
+	return builtin_array_size(__a_rename_at_122);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_e7337cf490aef504 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_374 )
+{
+	TArray<int32_t> __arr_rename_at_375; das_zero(__arr_rename_at_375);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_375),__it_rename_at_374,4,false,__context__);
+	return /* <- */ __arr_rename_at_375;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_374 )
+{
+	TArray<int32_t> __arr_rename_at_375; das_zero(__arr_rename_at_375);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_375),__it_rename_at_374,4,true,__context__);
+	return /* <- */ __arr_rename_at_375;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_d45ac51cb08b659f ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) const  &  __it_rename_at_374 )
+{
+	TArray<int32_t> __arr_rename_at_375; das_zero(__arr_rename_at_375);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_375),__it_rename_at_374,4,true,__context__);
+	return /* <- */ __arr_rename_at_375;
+}
+
+inline void comprehension_array_87e05fca633138d2 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_42 )
+{
+	TArray<int32_t> __b_rename_at_43; das_zero(__b_rename_at_43); das_move(__b_rename_at_43, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_43_rename_at_43; das_zero(____acomp_43_rename_at_43);
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(____acomp_43_rename_at_43),_Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7(__context__,__a_rename_at_42));
+		{
+			bool __need_loop_43 = true;
+			// x : int const&
+			das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_42);
+			int32_t const  * __x_rename_at_43;
+			__need_loop_43 = __x_iterator.first(__context__,(__x_rename_at_43)) && __need_loop_43;
+			for ( ; __need_loop_43 ; __need_loop_43 = __x_iterator.next(__context__,(__x_rename_at_43)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_43_rename_at_43),(*__x_rename_at_43) + 1,-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_43));
+		};
+		return /* <- */ ____acomp_43_rename_at_43;
+	}));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_43));
+}
+
+inline void comprehension_array_where_54b737421aa8c0c9 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_47 )
+{
+	TArray<int32_t> __b_rename_at_48; das_zero(__b_rename_at_48); das_move(__b_rename_at_48, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_48_rename_at_48; das_zero(____acomp_48_rename_at_48);
+		{
+			bool __need_loop_48 = true;
+			// x : int const&
+			das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_47);
+			int32_t const  * __x_rename_at_48;
+			__need_loop_48 = __x_iterator.first(__context__,(__x_rename_at_48)) && __need_loop_48;
+			for ( ; __need_loop_48 ; __need_loop_48 = __x_iterator.next(__context__,(__x_rename_at_48)) )
+			{
+				if ( (*__x_rename_at_48) >= 0 )
+				{
+					_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_48_rename_at_48),(*__x_rename_at_48) + 1,-1);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_48));
+		};
+		return /* <- */ ____acomp_48_rename_at_48;
+	}));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_48));
+}
+
+inline void comprehension_range_a2e1050168f0c372 ( Context * __context__ )
+{
+	TArray<int32_t> __b_rename_at_53; das_zero(__b_rename_at_53); das_move(__b_rename_at_53, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_53_rename_at_53; das_zero(____acomp_53_rename_at_53);
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(____acomp_53_rename_at_53),1000000);
+		{
+			bool __need_loop_53 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,1000000));
+			int32_t __x_rename_at_53;
+			__need_loop_53 = __x_iterator.first(__context__,(__x_rename_at_53)) && __need_loop_53;
+			for ( ; __need_loop_53 ; __need_loop_53 = __x_iterator.next(__context__,(__x_rename_at_53)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_53_rename_at_53),__x_rename_at_53 + 1,-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_53));
+		};
+		return /* <- */ ____acomp_53_rename_at_53;
+	}));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_53));
+}
+
+inline void drain_array_ed43d344ea751875 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_8 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_10_64;
+	TArray<int32_t> __b_rename_at_10; das_zero(__b_rename_at_10); das_move(__b_rename_at_10, _Funcbuiltin_0x60_to_array_d45ac51cb08b659f(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_10_64 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,__a_rename_at_8))))));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_10));
+}
+
+inline void drain_keys_775daa68e5b9ee51 ( Context * __context__, TTable<int32_t,int32_t> const  &  __tab_rename_at_26 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_27_64;
+	TArray<int32_t> __b_rename_at_27; das_zero(__b_rename_at_27); das_move(__b_rename_at_27, _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_27_64 = (_Funcbuiltin_0x60_keys_6c2830dfa4ff0355(__context__,__tab_rename_at_26))))));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_27));
+}
+
+inline void drain_lambda_2294cb420790bb5c ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_38_112;
+	int32_t __count_rename_at_32 = 0;
+	Lambda DAS_COMMENT((bool,int32_t &)) __lam_rename_at_33; das_zero(__lam_rename_at_33); das_move(__lam_rename_at_33, das_ascend<bool,struct _lambda_thismodule_34_8_1>::make(__context__,&__type_info__7a5d8ac3,(([&]() -> struct _lambda_thismodule_34_8_1 {
+		struct _lambda_thismodule_34_8_1 __mks_34;
+		das_copy((__mks_34.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_34_8_1`function _lambda_thismodule_34_8_1 int#ref*/ 1100874990u))));
+		das_copy((__mks_34.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_34_8_1`finazlier #ptr#_lambda_thismodule_34_8_1#explicit*/ 2849354902u))));
+		das_copy((__mks_34.count),(__count_rename_at_32));
+		return __mks_34;
+	})())));
+	TArray<int32_t> __b_rename_at_38; das_zero(__b_rename_at_38); das_move(__b_rename_at_38, _Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_38_112 = (_Funcbuiltin_0x60_each_ec0a92925ebe3455(__context__,__lam_rename_at_33))))));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_38));
+}
+
+inline void drain_range_3562d5310ff4b575 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_15_64;
+	TArray<int32_t> __b_rename_at_15; das_zero(__b_rename_at_15); das_move(__b_rename_at_15, _Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_15_64 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,1000000)))))));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_15));
+}
+
+inline void drain_string_783221109f5971db ( Context * __context__, char * const  __s_rename_at_19 )
+{
+	TArray<int32_t> _temp_make_local_22_64;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_22_96;
+	TArray<int32_t> __b_rename_at_20; das_zero(__b_rename_at_20);
+	das_move(__b_rename_at_20,(_temp_make_local_22_64 = (_Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_22_96 = (_Funcbuiltin_0x60_each_3bd22e87ecbdcf79(__context__,__s_rename_at_19))))))));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_20));
+}
+
+inline void finalize_4f152d911ddfb009 ( Context * __context__, struct _lambda_thismodule_34_8_1 &  ____this_rename_at_34 )
+{
+	memset(&(____this_rename_at_34), 0, 12);
+}
+
+inline bool test_afeaac1964b354a6 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,544,"test " DAS_FILE_LINE);
+{
+	TArray<int32_t> __a_rename_at_58; das_zero(__a_rename_at_58);
+	TTable<int32_t,int32_t> __tab_rename_at_59; das_zero(__tab_rename_at_59);
+	{
+		bool __need_loop_60 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000000));
+		int32_t __i_rename_at_60;
+		__need_loop_60 = __i_iterator.first(__context__,(__i_rename_at_60)) && __need_loop_60;
+		for ( ; __need_loop_60 ; __need_loop_60 = __i_iterator.next(__context__,(__i_rename_at_60)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_58),__i_rename_at_60,-1);
+			das_copy(__tab_rename_at_59(__i_rename_at_60,__context__),__i_rename_at_60);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_60));
+	};
+	char * __s_rename_at_63 = (char *)(((char *) ""));
+	{
+		bool __need_loop_64 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_64;
+		__need_loop_64 = __i_iterator.first(__context__,(__i_rename_at_64)) && __need_loop_64;
+		for ( ; __need_loop_64 ; __need_loop_64 = __i_iterator.next(__context__,(__i_rename_at_64)) )
+		{
+			das_copy(__s_rename_at_63,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(__s_rename_at_63),cast<char *>::from(((char *) "0123456789")),*__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_64));
+	};
+	builtin_profile(20,((char *) "to_array(each(array))"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		drain_array_ed43d344ea751875(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_58));
+	}),__context__);
+	builtin_profile(20,((char *) "to_array(each(range))"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		drain_range_3562d5310ff4b575(__context__);
+	}),__context__);
+	builtin_profile(20,((char *) "to_array(each(string))"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		drain_string_783221109f5971db(__context__,__s_rename_at_63);
+	}),__context__);
+	builtin_profile(20,((char *) "to_array(keys(table))"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		drain_keys_775daa68e5b9ee51(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_59));
+	}),__context__);
+	builtin_profile(20,((char *) "to_array(each(lambda))"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		drain_lambda_2294cb420790bb5c(__context__);
+	}),__context__);
+	builtin_profile(20,((char *) "comprehension, array"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		comprehension_array_87e05fca633138d2(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_58));
+	}),__context__);
+	builtin_profile(20,((char *) "comprehension, array, where"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		comprehension_array_where_54b737421aa8c0c9(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_58));
+	}),__context__);
+	builtin_profile(20,((char *) "comprehension, range"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		comprehension_range_a2e1050168f0c372(__context__);
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_58));
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_59));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_34_8_1_0x60_finazlier_748d7645603c3c84
+		aotLib[0x776c387d447c045a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_34_8_1 *  ),&_Func_lambda_thismodule_34_8_1_0x60_finazlier_748d7645603c3c84>>();
+	};
+		// _Func_lambda_thismodule_34_8_1_0x60_function_72900bd1bdd77eb2
+		aotLib[0x61d44be84120e13d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_34_8_1 & , int32_t &  ),&_Func_lambda_thismodule_34_8_1_0x60_function_72900bd1bdd77eb2>>();
+	};
+		// _Funcbuiltin_0x60_each_49ba41ea6e9b0c25
+		aotLib[0x6a4a051ab138a935] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_49ba41ea6e9b0c25>>();
+	};
+		// _Funcbuiltin_0x60_each_ec0a92925ebe3455
+		aotLib[0xcabef3115f435abd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_ec0a92925ebe3455>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_each_3bd22e87ecbdcf79
+		aotLib[0x4c2de9cff1fb15e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, char * const   ),&_Funcbuiltin_0x60_each_3bd22e87ecbdcf79>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+		aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+		// _Funcbuiltin_0x60_keys_6c2830dfa4ff0355
+		aotLib[0x40b58262c96d3a05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_keys_6c2830dfa4ff0355>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7
+		aotLib[0xfcfe5da5af4c2ec5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7>>();
+	};
+		// _Funcbuiltin_0x60_to_array_e7337cf490aef504
+		aotLib[0xb019749877860f09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcbuiltin_0x60_to_array_e7337cf490aef504>>();
+	};
+		// _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa
+		aotLib[0xe82facb3d4281305] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  ),&_Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa>>();
+	};
+		// _Funcbuiltin_0x60_to_array_d45ac51cb08b659f
+		aotLib[0xdd2eb1e5815397d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) const  &  ),&_Funcbuiltin_0x60_to_array_d45ac51cb08b659f>>();
+	};
+		// comprehension_array_87e05fca633138d2
+		aotLib[0x481c07e9b1d6cfc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&comprehension_array_87e05fca633138d2>>();
+	};
+		// comprehension_array_where_54b737421aa8c0c9
+		aotLib[0x1faadf76966db60d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&comprehension_array_where_54b737421aa8c0c9>>();
+	};
+		// comprehension_range_a2e1050168f0c372
+		aotLib[0xcabcd405d22bba40] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&comprehension_range_a2e1050168f0c372>>();
+	};
+		// drain_array_ed43d344ea751875
+		aotLib[0x6fcb96efa5eacdf4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&drain_array_ed43d344ea751875>>();
+	};
+		// drain_keys_775daa68e5b9ee51
+		aotLib[0x97a1442d0dbc1a3f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&drain_keys_775daa68e5b9ee51>>();
+	};
+		// drain_lambda_2294cb420790bb5c
+		aotLib[0x3ec487364a959dc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&drain_lambda_2294cb420790bb5c>>();
+	};
+		// drain_range_3562d5310ff4b575
+		aotLib[0x93b31386749fc24c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&drain_range_3562d5310ff4b575>>();
+	};
+		// drain_string_783221109f5971db
+		aotLib[0xf89811d8a5fe86f2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const   ),&drain_string_783221109f5971db>>();
+	};
+		// finalize_4f152d911ddfb009
+		aotLib[0x488ef09d89c97b89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_34_8_1 &  ),&finalize_4f152d911ddfb009>>();
+	};
+		// test_afeaac1964b354a6
+		aotLib[0x9052124d6cd58c65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_afeaac1964b354a6>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
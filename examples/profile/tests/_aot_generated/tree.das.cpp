@@ -0,0 +1,452 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require random
+#include "daScript/simulate/aot_builtin_random.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+namespace  {
+
+struct Node {
+	int32_t x;
+	int32_t y;
+	struct Node * left;
+	struct Node * right;
+};
+static_assert(sizeof(Node)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Node,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,left)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,right)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Pair {
+	struct Node * first;
+	struct Node * second;
+};
+static_assert(sizeof(Pair)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Pair,first)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Pair,second)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct SplitResult {
+	struct Node * lower;
+	struct Node * equal;
+	struct Node * greater;
+};
+static_assert(sizeof(SplitResult)==24,"structure size mismatch with DAS");
+static_assert(offsetof(SplitResult,lower)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SplitResult,equal)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SplitResult,greater)==16,"structure field offset mismatch with DAS");
+}
+
+inline void erase_raw_4bed158f4cb00b02 ( Context * __context__, struct Node * & __mRoot_rename_at_68, int32_t __x_rename_at_68 );
+inline void erase_rawNaive_6f9ad6fa38d6b18a ( Context * __context__, struct Node * & __mRoot_rename_at_130, int32_t __x_rename_at_130 );
+inline void finalize_a3480ab8fab98008 ( Context * __context__, struct Node * & ____this_rename_at_73 );
+inline void finalize_b383e97479656dd4 ( Context * __context__, struct Node & ____this_rename_at_14 );
+inline bool hasValue_c473dfa460ee8fe3 ( Context * __context__, struct Node * & __mRoot_rename_at_54, int32_t __x_rename_at_54 );
+inline bool hasValueNaive_df4f8099390f98d1 ( Context * __context__, struct Node * & __mRoot_rename_at_118, int32_t __x_rename_at_118 );
+inline void insert_a8f06a49eb7e15d9 ( Context * __context__, struct Node * & __mRoot_rename_at_61, int32_t __x_rename_at_61 );
+inline void insertNaive_a06dd16400855861 ( Context * __context__, struct Node * & __mRoot_rename_at_124, int32_t __x_rename_at_124 );
+inline int32_t main_9a9ee3a3ffa0295a ( Context * __context__ );
+inline int32_t mainNaive_72bb08a1373682be ( Context * __context__ );
+inline struct Node * merge_6bedd75977fcaee5 ( Context * __context__, struct Node * __lower_rename_at_22, struct Node * __greater_rename_at_22 );
+inline struct Node * merge_820cfe2d73809db1 ( Context * __context__, struct Node * __lower_rename_at_34, struct Node * __equal_rename_at_34, struct Node * __greater_rename_at_34 );
+inline void split_3c3f9f756f1a3b79 ( Context * __context__, struct Node * __orig_rename_at_49, struct Node * & __lower_rename_at_49, struct Node * & __equal_rename_at_49, struct Node * & __greater_rename_at_49, int32_t __value_rename_at_49 );
+inline void split_8a870c807beff596 ( Context * __context__, struct Node * __orig_rename_at_38, struct Node * & __lower_rename_at_38, struct Node * & __greaterOrEqual_rename_at_38, int32_t __value_rename_at_38 );
+inline struct Pair splitBinary_a4c390ea3d6143e3 ( Context * __context__, struct Node * __orig_rename_at_96, int32_t __value_rename_at_96 );
+inline struct SplitResult splitNaive_6fd7a636aac3fd26 ( Context * __context__, struct Node * __orig_rename_at_113, int32_t __value_rename_at_113 );
+inline bool test_5049658ca86a1a3e ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int4,0>(__context__) = int4(1,1,1,1);/*seed*/
+}
+
+inline void erase_raw_4bed158f4cb00b02 ( Context * __context__, struct Node * & __mRoot_rename_at_68, int32_t __x_rename_at_68 )
+{
+	struct Node * __lower_rename_at_69 = 0; struct Node * __equal_rename_at_69 = 0; struct Node * __greater_rename_at_69 = 0;
+	split_3c3f9f756f1a3b79(__context__,__mRoot_rename_at_68,__lower_rename_at_69,__equal_rename_at_69,__greater_rename_at_69,__x_rename_at_68);
+	das_copy(__mRoot_rename_at_68,merge_6bedd75977fcaee5(__context__,__lower_rename_at_69,__greater_rename_at_69));
+	finalize_a3480ab8fab98008(__context__,__equal_rename_at_69);
+}
+
+inline void erase_rawNaive_6f9ad6fa38d6b18a ( Context * __context__, struct Node * & __mRoot_rename_at_130, int32_t __x_rename_at_130 )
+{
+	struct SplitResult __splited_rename_at_131 = splitNaive_6fd7a636aac3fd26(__context__,__mRoot_rename_at_130,__x_rename_at_130);
+	das_copy(__mRoot_rename_at_130,merge_6bedd75977fcaee5(__context__,__splited_rename_at_131.lower,__splited_rename_at_131.greater));
+	finalize_a3480ab8fab98008(__context__,__splited_rename_at_131.equal);
+}
+
+inline void finalize_a3480ab8fab98008 ( Context * __context__, struct Node * & ____this_rename_at_73 )
+{
+	if ( ____this_rename_at_73 != nullptr )
+	{
+		finalize_b383e97479656dd4(__context__,das_arg<struct Node>::pass(das_deref(__context__,____this_rename_at_73)));
+		das_delete<struct Node *>::clear(__context__,____this_rename_at_73);
+		das_copy(____this_rename_at_73,nullptr);
+	};
+}
+
+inline void finalize_b383e97479656dd4 ( Context * __context__, struct Node &  ____this_rename_at_14 )
+{
+	finalize_a3480ab8fab98008(__context__,____this_rename_at_14.left);
+	finalize_a3480ab8fab98008(__context__,____this_rename_at_14.right);
+	memset(&(____this_rename_at_14), 0, 24);
+}
+
+inline bool hasValue_c473dfa460ee8fe3 ( Context * __context__, struct Node * & __mRoot_rename_at_54, int32_t __x_rename_at_54 )
+{
+	struct Node * __lower_rename_at_55 = 0; struct Node * __equal_rename_at_55 = 0; struct Node * __greater_rename_at_55 = 0;
+	split_3c3f9f756f1a3b79(__context__,__mRoot_rename_at_54,__lower_rename_at_55,__equal_rename_at_55,__greater_rename_at_55,__x_rename_at_54);
+	bool __res_rename_at_57 = (bool)(__equal_rename_at_55 != nullptr);
+	das_copy(__mRoot_rename_at_54,merge_820cfe2d73809db1(__context__,__lower_rename_at_55,__equal_rename_at_55,__greater_rename_at_55));
+	return __res_rename_at_57;
+}
+
+inline bool hasValueNaive_df4f8099390f98d1 ( Context * __context__, struct Node * & __mRoot_rename_at_118, int32_t __x_rename_at_118 )
+{
+	struct SplitResult __splited_rename_at_119 = splitNaive_6fd7a636aac3fd26(__context__,__mRoot_rename_at_118,__x_rename_at_118);
+	bool __res_rename_at_120 = (bool)(__splited_rename_at_119.equal != nullptr);
+	das_copy(__mRoot_rename_at_118,merge_820cfe2d73809db1(__context__,__splited_rename_at_119.lower,__splited_rename_at_119.equal,__splited_rename_at_119.greater));
+	return __res_rename_at_120;
+}
+
+inline void insert_a8f06a49eb7e15d9 ( Context * __context__, struct Node * & __mRoot_rename_at_61, int32_t __x_rename_at_61 )
+{
+	struct Node * __lower_rename_at_62 = 0; struct Node * __equal_rename_at_62 = 0; struct Node * __greater_rename_at_62 = 0;
+	split_3c3f9f756f1a3b79(__context__,__mRoot_rename_at_61,__lower_rename_at_62,__equal_rename_at_62,__greater_rename_at_62,__x_rename_at_61);
+	if ( __equal_rename_at_62 == nullptr )
+	{
+		das_copy(__equal_rename_at_62,das_ascend<struct Node,struct Node>::make(__context__,nullptr,(([&]() -> struct Node {
+			struct Node __mks_65;
+			das_zero(__mks_65);
+			das_copy((__mks_65.x),(__x_rename_at_61));
+			das_copy((__mks_65.y),(randomInt(das_global<int4,0>(__context__) /*seed*/)));
+			return __mks_65;
+		})())));
+	};
+	das_copy(__mRoot_rename_at_61,merge_820cfe2d73809db1(__context__,__lower_rename_at_62,__equal_rename_at_62,__greater_rename_at_62));
+}
+
+inline void insertNaive_a06dd16400855861 ( Context * __context__, struct Node * & __mRoot_rename_at_124, int32_t __x_rename_at_124 )
+{
+	struct SplitResult __splited_rename_at_125 = splitNaive_6fd7a636aac3fd26(__context__,__mRoot_rename_at_124,__x_rename_at_124);
+	if ( __splited_rename_at_125.equal == nullptr )
+	{
+		das_copy(__splited_rename_at_125.equal,das_ascend<struct Node,struct Node>::make(__context__,nullptr,(([&]() -> struct Node {
+			struct Node __mks_127;
+			das_zero(__mks_127);
+			das_copy((__mks_127.x),(__x_rename_at_124));
+			das_copy((__mks_127.y),(randomInt(das_global<int4,0>(__context__) /*seed*/)));
+			return __mks_127;
+		})())));
+	};
+	das_copy(__mRoot_rename_at_124,merge_820cfe2d73809db1(__context__,__splited_rename_at_125.lower,__splited_rename_at_125.equal,__splited_rename_at_125.greater));
+}
+
+inline int32_t main_9a9ee3a3ffa0295a ( Context * __context__ )
+{
+	struct Node * __tree_rename_at_76 = 0;
+	int32_t __cur_rename_at_77 = 5;
+	int32_t __res_rename_at_78 = 0;
+	{
+		bool __need_loop_79 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000000));
+		int32_t __i_rename_at_79;
+		__need_loop_79 = __i_iterator.first(__context__,(__i_rename_at_79)) && __need_loop_79;
+		for ( ; __need_loop_79 ; __need_loop_79 = __i_iterator.next(__context__,(__i_rename_at_79)) )
+		{
+			int32_t __a_rename_at_80 = (int32_t)(SimPolicy<int32_t>::Mod(__i_rename_at_79,3,*__context__));
+			das_copy(__cur_rename_at_77,SimPolicy<int32_t>::Mod(((__cur_rename_at_77 * 57) + 43),10007,*__context__));
+			if ( __a_rename_at_80 == 0 )
+			{
+				insert_a8f06a49eb7e15d9(__context__,__tree_rename_at_76,__cur_rename_at_77);
+			} else if ( __a_rename_at_80 == 1 )
+			{
+				erase_raw_4bed158f4cb00b02(__context__,__tree_rename_at_76,__cur_rename_at_77);
+			} else if ( __a_rename_at_80 == 2 )
+			{
+				__res_rename_at_78 += (hasValue_c473dfa460ee8fe3(__context__,__tree_rename_at_76,__cur_rename_at_77) ? (1) : (0));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_79));
+	};
+	finalize_a3480ab8fab98008(__context__,__tree_rename_at_76);
+	return __res_rename_at_78;
+}
+
+inline int32_t mainNaive_72bb08a1373682be ( Context * __context__ )
+{
+	struct Node * __tree_rename_at_137 = 0;
+	int32_t __cur_rename_at_138 = 5;
+	int32_t __res_rename_at_139 = 0;
+	{
+		bool __need_loop_140 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000000));
+		int32_t __i_rename_at_140;
+		__need_loop_140 = __i_iterator.first(__context__,(__i_rename_at_140)) && __need_loop_140;
+		for ( ; __need_loop_140 ; __need_loop_140 = __i_iterator.next(__context__,(__i_rename_at_140)) )
+		{
+			int32_t __a_rename_at_141 = (int32_t)(SimPolicy<int32_t>::Mod(__i_rename_at_140,3,*__context__));
+			das_copy(__cur_rename_at_138,SimPolicy<int32_t>::Mod(((__cur_rename_at_138 * 57) + 43),10007,*__context__));
+			if ( __a_rename_at_141 == 0 )
+			{
+				insertNaive_a06dd16400855861(__context__,__tree_rename_at_137,__cur_rename_at_138);
+			} else if ( __a_rename_at_141 == 1 )
+			{
+				erase_rawNaive_6f9ad6fa38d6b18a(__context__,__tree_rename_at_137,__cur_rename_at_138);
+			} else if ( __a_rename_at_141 == 2 )
+			{
+				__res_rename_at_139 += (hasValueNaive_df4f8099390f98d1(__context__,__tree_rename_at_137,__cur_rename_at_138) ? (1) : (0));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_140));
+	};
+	finalize_a3480ab8fab98008(__context__,__tree_rename_at_137);
+	return __res_rename_at_139;
+}
+
+inline struct Node * merge_6bedd75977fcaee5 ( Context * __context__, struct Node * __lower_rename_at_22, struct Node * __greater_rename_at_22 )
+{
+	if ( __lower_rename_at_22 == nullptr )
+	{
+		return __greater_rename_at_22;
+	} else {
+		if ( __greater_rename_at_22 == nullptr )
+		{
+			return __lower_rename_at_22;
+		} else {
+			if ( __lower_rename_at_22->y < __greater_rename_at_22->y )
+			{
+				das_copy(__lower_rename_at_22->right,merge_6bedd75977fcaee5(__context__,__lower_rename_at_22->right,__greater_rename_at_22));
+				return __lower_rename_at_22;
+			} else {
+				das_copy(__greater_rename_at_22->left,merge_6bedd75977fcaee5(__context__,__lower_rename_at_22,__greater_rename_at_22->left));
+				return __greater_rename_at_22;
+			};
+		};
+	};
+}
+
+inline struct Node * merge_820cfe2d73809db1 ( Context * __context__, struct Node * __lower_rename_at_34, struct Node * __equal_rename_at_34, struct Node * __greater_rename_at_34 )
+{
+	return merge_6bedd75977fcaee5(__context__,merge_6bedd75977fcaee5(__context__,__lower_rename_at_34,__equal_rename_at_34),__greater_rename_at_34);
+}
+
+inline void split_3c3f9f756f1a3b79 ( Context * __context__, struct Node * __orig_rename_at_49, struct Node * & __lower_rename_at_49, struct Node * & __equal_rename_at_49, struct Node * & __greater_rename_at_49, int32_t __value_rename_at_49 )
+{
+	struct Node * __equalOrGreater_rename_at_50 = 0;
+	split_8a870c807beff596(__context__,__orig_rename_at_49,__lower_rename_at_49,__equalOrGreater_rename_at_50,__value_rename_at_49);
+	split_8a870c807beff596(__context__,__equalOrGreater_rename_at_50,__equal_rename_at_49,__greater_rename_at_49,__value_rename_at_49 + 1);
+}
+
+inline void split_8a870c807beff596 ( Context * __context__, struct Node * __orig_rename_at_38, struct Node * & __lower_rename_at_38, struct Node * & __greaterOrEqual_rename_at_38, int32_t __value_rename_at_38 )
+{
+	if ( __orig_rename_at_38 == nullptr )
+	{
+		das_copy(__lower_rename_at_38,nullptr);
+		das_copy(__greaterOrEqual_rename_at_38,nullptr);
+	} else if ( __orig_rename_at_38->x < __value_rename_at_38 )
+	{
+		das_copy(__lower_rename_at_38,__orig_rename_at_38);
+		split_8a870c807beff596(__context__,__lower_rename_at_38->right,__lower_rename_at_38->right,__greaterOrEqual_rename_at_38,__value_rename_at_38);
+	} else {
+		das_copy(__greaterOrEqual_rename_at_38,__orig_rename_at_38);
+		split_8a870c807beff596(__context__,__greaterOrEqual_rename_at_38->left,__lower_rename_at_38,__greaterOrEqual_rename_at_38->left,__value_rename_at_38);
+	};
+}
+
+inline struct Pair splitBinary_a4c390ea3d6143e3 ( Context * __context__, struct Node * __orig_rename_at_96, int32_t __value_rename_at_96 )
+{
+	if ( __orig_rename_at_96 == nullptr )
+	{
+		return (([&]() -> struct Pair {
+			struct Pair __mks_98;
+			das_copy((__mks_98.first),(nullptr));
+			das_copy((__mks_98.second),(nullptr));
+			return __mks_98;
+		})());
+	} else {
+		if ( __orig_rename_at_96->x < __value_rename_at_96 )
+		{
+			struct Pair __splitPair_rename_at_101 = (struct Pair)splitBinary_a4c390ea3d6143e3(__context__,__orig_rename_at_96->right,__value_rename_at_96);
+			das_copy(__orig_rename_at_96->right,__splitPair_rename_at_101.first);
+			return (([&]() -> struct Pair {
+				struct Pair __mks_103;
+				das_copy((__mks_103.first),(__orig_rename_at_96));
+				das_copy((__mks_103.second),(__splitPair_rename_at_101.second));
+				return __mks_103;
+			})());
+		} else {
+			struct Pair __splitPair_rename_at_105 = (struct Pair)splitBinary_a4c390ea3d6143e3(__context__,__orig_rename_at_96->left,__value_rename_at_96);
+			das_copy(__orig_rename_at_96->left,__splitPair_rename_at_105.second);
+			return (([&]() -> struct Pair {
+				struct Pair __mks_107;
+				das_copy((__mks_107.first),(__splitPair_rename_at_105.first));
+				das_copy((__mks_107.second),(__orig_rename_at_96));
+				return __mks_107;
+			})());
+		};
+	};
+}
+
+inline struct SplitResult splitNaive_6fd7a636aac3fd26 ( Context * __context__, struct Node * __orig_rename_at_113, int32_t __value_rename_at_113 )
+{
+	struct Pair __lower_eg_rename_at_114 = splitBinary_a4c390ea3d6143e3(__context__,__orig_rename_at_113,__value_rename_at_113);
+	struct Pair __equal_greater_rename_at_115 = splitBinary_a4c390ea3d6143e3(__context__,__lower_eg_rename_at_114.second,__value_rename_at_113 + 1);
+	return (([&]() -> struct SplitResult {
+		struct SplitResult __mks_116;
+		das_copy((__mks_116.lower),(__lower_eg_rename_at_114.first));
+		das_copy((__mks_116.equal),(__equal_greater_rename_at_115.first));
+		das_copy((__mks_116.greater),(__equal_greater_rename_at_115.second));
+		return __mks_116;
+	})());
+}
+
+inline bool test_5049658ca86a1a3e ( Context * __context__ ) { das_stack_prologue __prologue(__context__,176,"test " DAS_FILE_LINE);
+{
+	builtin_profile(10,((char *) "tree"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		main_9a9ee3a3ffa0295a(__context__);
+	}),__context__);
+	builtin_profile(10,((char *) "tree-naive"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		mainNaive_72bb08a1373682be(__context__);
+	}),__context__);
+	builtin_profile(10,((char *) "tree C++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testTree();
+	}),__context__);
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// erase_raw_4bed158f4cb00b02
+		aotLib[0x61a98ee66dca3771] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Node * & , int32_t  ),&erase_raw_4bed158f4cb00b02>>();
+	};
+		// erase_rawNaive_6f9ad6fa38d6b18a
+		aotLib[0x3316049195740098] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Node * & , int32_t  ),&erase_rawNaive_6f9ad6fa38d6b18a>>();
+	};
+		// finalize_a3480ab8fab98008
+		aotLib[0x8d9bdd3738664639] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Node * &  ),&finalize_a3480ab8fab98008>>();
+	};
+		// finalize_b383e97479656dd4
+		aotLib[0x6360f97b6437bd8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Node &  ),&finalize_b383e97479656dd4>>();
+	};
+		// hasValue_c473dfa460ee8fe3
+		aotLib[0x7adc03444a922107] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct Node * & , int32_t  ),&hasValue_c473dfa460ee8fe3>>();
+	};
+		// hasValueNaive_df4f8099390f98d1
+		aotLib[0xe9f838f067a93baa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct Node * & , int32_t  ),&hasValueNaive_df4f8099390f98d1>>();
+	};
+		// insert_a8f06a49eb7e15d9
+		aotLib[0x263ae8c8e962190f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Node * & , int32_t  ),&insert_a8f06a49eb7e15d9>>();
+	};
+		// insertNaive_a06dd16400855861
+		aotLib[0x3ef60bb16244a26] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Node * & , int32_t  ),&insertNaive_a06dd16400855861>>();
+	};
+		// main_9a9ee3a3ffa0295a
+		aotLib[0xb165aaa90b02911c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&main_9a9ee3a3ffa0295a>>();
+	};
+		// mainNaive_72bb08a1373682be
+		aotLib[0x1bf12217f37d246a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&mainNaive_72bb08a1373682be>>();
+	};
+		// merge_6bedd75977fcaee5
+		aotLib[0x63a889a3fdfdcaa1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct Node * (*) ( Context * __context__, struct Node * , struct Node *  ),&merge_6bedd75977fcaee5>>();
+	};
+		// merge_820cfe2d73809db1
+		aotLib[0x2d5be71d1508cb9b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<struct Node * (*) ( Context * __context__, struct Node * , struct Node * , struct Node *  ),&merge_820cfe2d73809db1>>();
+	};
+		// split_3c3f9f756f1a3b79
+		aotLib[0xc796c00ad0e7949f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Node * , struct Node * & , struct Node * & , struct Node * & , int32_t  ),&split_3c3f9f756f1a3b79>>();
+	};
+		// split_8a870c807beff596
+		aotLib[0x84386e5808e426d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Node * , struct Node * & , struct Node * & , int32_t  ),&split_8a870c807beff596>>();
+	};
+		// splitBinary_a4c390ea3d6143e3
+		aotLib[0x8829a7ab13fe83a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Pair (*) ( Context * __context__, struct Node * , int32_t  ),&splitBinary_a4c390ea3d6143e3>>();
+	};
+		// splitNaive_6fd7a636aac3fd26
+		aotLib[0x7a16f2456ee64e80] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct SplitResult (*) ( Context * __context__, struct Node * , int32_t  ),&splitNaive_6fd7a636aac3fd26>>();
+	};
+		// test_5049658ca86a1a3e
+		aotLib[0x7e873d8193ca3bb6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5049658ca86a1a3e>>();
+	};
+		// [[ init script ]]
+		aotLib[0x97012be76455a149] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
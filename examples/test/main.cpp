@@ -371,6 +371,11 @@ bool debug_unit_test ( const string & fn, int CURSOR_X, int CURSOR_Y, bool useAo
     }
 }
 
+// tests, which need more than 4gb of memory
+#ifndef DAS_LARGE_TESTS
+#define DAS_LARGE_TESTS 0
+#endif
+
 extern int das_yydebug;
 
 int main( int argc, char * argv[] ) {
@@ -426,6 +431,9 @@ int main( int argc, char * argv[] ) {
     ok = run_unit_tests(getDasRoot() +  "/examples/test/unit_tests", true) && ok;
     ok = run_unit_tests(getDasRoot() +  "/examples/test/optimizations") && ok;
     ok = run_exception_tests(getDasRoot() +  "/examples/test/runtime_errors") && ok;
+#if DAS_LARGE_TESTS
+    ok = run_unit_tests(getDasRoot() +  "/examples/test/large_tests") && ok;
+#endif
     ok = run_module_test(getDasRoot() +  "/examples/test/module", "main.das", true) && ok;
     ok = run_module_test(getDasRoot() +  "/examples/test/module", "main_default.das", false) && ok;
     ok = run_module_test(getDasRoot() +  "/examples/test/module/alias", "main.das", true) && ok;
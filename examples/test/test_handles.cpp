@@ -379,7 +379,7 @@ struct CheckEidFunctionAnnotation : TransformFunctionAnnotation {
         if ( arg->type && arg->type->isString() && arg->type->isConst() && arg->rtti_isConstant() ) {
             auto starg = static_pointer_cast<ExprConstString>(arg);
             if (!starg->getValue().empty()) {
-                uint32_t hv = hash_blockz32((uint8_t *)starg->text.c_str());
+                uint32_t hv = wyhashz32((const uint8_t *)starg->text.c_str());
                 auto hconst = make_smart<ExprConstUInt>(arg->at, hv);
                 hconst->type = make_smart<TypeDecl>(Type::tUInt);
                 hconst->type->constant = true;
@@ -0,0 +1,331 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _apply_macro
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__48703320;
+extern StructInfo __struct_info__664da6b0;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__dcfff1ff;
+extern TypeInfo __type_info__f955b4ec;
+extern TypeInfo __type_info__5dab71c;
+extern TypeInfo __type_info__8ce26751;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__a07921bf;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__a80e24ba;
+extern TypeInfo __type_info__c1bd2f4c;
+extern TypeInfo __type_info__79323f61;
+extern TypeInfo __type_info__be386f7a;
+extern VarInfo __var_info__8944cab8;
+extern VarInfo __var_info__4f80340b;
+extern VarInfo __var_info__3ec892a0;
+extern VarInfo __var_info__63f998c3;
+extern VarInfo __var_info__3989b8f3;
+extern VarInfo __var_info__1c223b0;
+extern VarInfo __var_info__4c663710;
+extern VarInfo __var_info__6041a740;
+extern VarInfo __var_info__6197a9c8;
+extern VarInfo __var_info__70fbc23b;
+
+VarInfo __struct_info__48703320_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x70fbc23b, "__rtti", 0 };
+TypeInfo * __type_info__4c663710_arg_types_var_1215312672[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__48703320_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c663710_arg_types_var_1215312672, nullptr, 1, 0, nullptr, 28, 0x4c663710, "__finalize", 8 };
+TypeInfo * __type_info__1c223b0_arg_types_var_1215312672[3] = { &__type_info__a80e24ba, &__type_info__f955b4ec, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1c223b0_arg_types_var_1215312672, nullptr, 3, 0, nullptr, 28, 0x1c223b0, "transform", 12 };
+TypeInfo * __type_info__6197a9c8_arg_types_var_1215312672[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__6197a9c8_arg_types_var_1215312672, nullptr, 5, 0, nullptr, 28, 0x6197a9c8, "apply", 16 };
+TypeInfo * __type_info__3989b8f3_arg_types_var_1215312672[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3989b8f3_arg_types_var_1215312672, nullptr, 6, 0, nullptr, 28, 0x3989b8f3, "finish", 20 };
+VarInfo * __struct_info__48703320_fields[5] =  { &__struct_info__48703320_field_0, &__struct_info__48703320_field_1, &__struct_info__48703320_field_2, &__struct_info__48703320_field_3, &__struct_info__48703320_field_4 };
+StructInfo __struct_info__48703320 = {"AstFunctionAnnotation", __struct_info__48703320_fields, 5, 24, -1, nullptr, 0x48703320 };
+VarInfo __struct_info__664da6b0_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4f80340b, "__rtti", 0 };
+TypeInfo * __type_info__3ec892a0_arg_types_var_1716364976[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__664da6b0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3ec892a0_arg_types_var_1716364976, nullptr, 1, 0, nullptr, 28, 0x3ec892a0, "__finalize", 8 };
+TypeInfo * __type_info__6041a740_arg_types_var_1716364976[3] = { &__type_info__a80e24ba, &__type_info__f955b4ec, &__type_info__8ce26751 };
+VarInfo __struct_info__664da6b0_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6041a740_arg_types_var_1716364976, nullptr, 3, 0, nullptr, 28, 0x6041a740, "transform", 12 };
+TypeInfo * __type_info__8944cab8_arg_types_var_1716364976[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__664da6b0_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__8944cab8_arg_types_var_1716364976, nullptr, 5, 0, nullptr, 28, 0x8944cab8, "apply", 16 };
+TypeInfo * __type_info__63f998c3_arg_types_var_1716364976[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__664da6b0_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__63f998c3_arg_types_var_1716364976, nullptr, 6, 0, nullptr, 28, 0x63f998c3, "finish", 20 };
+VarInfo * __struct_info__664da6b0_fields[5] =  { &__struct_info__664da6b0_field_0, &__struct_info__664da6b0_field_1, &__struct_info__664da6b0_field_2, &__struct_info__664da6b0_field_3, &__struct_info__664da6b0_field_4 };
+StructInfo __struct_info__664da6b0 = {"AppendCondAnnotation", __struct_info__664da6b0_fields, 5, 24, -1, nullptr, 0x664da6b0 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__dcfff1ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xdcfff1ff };
+TypeInfo __type_info__f955b4ec = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be386f7a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xf955b4ec };
+TypeInfo __type_info__5dab71c = { Type::tStructure, &__struct_info__664da6b0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x5dab71c };
+TypeInfo __type_info__8ce26751 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8ce26751 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__a07921bf = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::AnnotationArgumentList"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xa07921bf };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__a80e24ba = { Type::tStructure, &__struct_info__48703320, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xa80e24ba };
+TypeInfo __type_info__c1bd2f4c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ModuleGroup"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc1bd2f4c };
+TypeInfo __type_info__79323f61 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Function"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x79323f61 };
+TypeInfo __type_info__be386f7a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbe386f7a };
+
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+namespace ast {
+
+struct AstFunctionAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstFunctionAnnotation,smart_ptr_raw<ExprCall>,das::string)) transform;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AstFunctionAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==20,"structure field offset mismatch with DAS");
+}
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace _apply_macro {
+
+struct AppendCondAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstFunctionAnnotation,smart_ptr_raw<ExprCall>,das::string)) transform;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AppendCondAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,finish)==20,"structure field offset mismatch with DAS");
+}
+
+inline struct _apply_macro::AppendCondAnnotation AppendCondAnnotation_314ae7a472451b9 ( Context * __context__ );
+inline void _FuncAppendCondAnnotation_0x27___finalize_70ee78e3952df723 ( Context * __context__, struct _apply_macro::AppendCondAnnotation & __self_rename_at_16 );
+inline bool _FuncAppendCondAnnotation_0x60_apply_c694eb54d82548c7 ( Context * __context__, struct _apply_macro::AppendCondAnnotation & __self_rename_at_17, smart_ptr_raw<Function> __func_rename_at_17, ModuleGroup & __group_rename_at_17, AnnotationArgumentList const  & __args_rename_at_17, das::string & __errors_rename_at_17 );
+inline void __setup_macros_8a2ca2e6c31834f1 ( Context * __context__ );
+inline void _Funcast_0x60_add_new_function_annotation_79e91a039f415302 ( Context * __context__, char * const  __name_rename_at_497, struct _apply_macro::AppendCondAnnotation * const  __someClassPtr_rename_at_497 );
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_9bee04cc769df77c ( Context * __context__, char * const  __name_rename_at_439, struct _apply_macro::AppendCondAnnotation * const  __someClassPtr_rename_at_439 );
+inline void clone_3985cae92193dfc7 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_11, smart_ptr<Expression> const  __src_rename_at_11 );
+inline void finalize_593338fe1416b6c0 ( Context * __context__, struct _apply_macro::AppendCondAnnotation & ____this_rename_at_16 );
+inline void prepend_cond_550197a645722a8d ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_7, char * const  __cond_rename_at_7 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_3f14f93b8ac665ab ( Context * __context__, struct _apply_macro::AppendCondAnnotation const  & __cl_rename_at_88 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	__setup_macros_8a2ca2e6c31834f1(__context__);
+}
+
+inline struct _apply_macro::AppendCondAnnotation AppendCondAnnotation_314ae7a472451b9 ( Context * __context__ )
+{
+	return (([&]() -> struct _apply_macro::AppendCondAnnotation {
+		struct _apply_macro::AppendCondAnnotation __mks_16;
+		das_zero(__mks_16);
+		das_copy((__mks_16.__rtti),(((void *)(&__type_info__5dab71c))));
+		das_copy((__mks_16.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@_apply_macro::AppendCondAnnotation'__finalize AppendCondAnnotation*/ 2610192452u)))));
+		das_copy((__mks_16.apply),(das_cast<Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@_apply_macro::AppendCondAnnotation`apply AppendCondAnnotation #smart_ptr##handle#Function #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 1354883138u)))));
+		return __mks_16;
+	})());
+}
+
+inline void _FuncAppendCondAnnotation_0x27___finalize_70ee78e3952df723 ( Context * __context__, struct _apply_macro::AppendCondAnnotation &  __self_rename_at_16 )
+{
+	finalize_593338fe1416b6c0(__context__,das_arg<struct _apply_macro::AppendCondAnnotation>::pass(__self_rename_at_16));
+}
+
+inline bool _FuncAppendCondAnnotation_0x60_apply_c694eb54d82548c7 ( Context * __context__, struct _apply_macro::AppendCondAnnotation &  __self_rename_at_17, smart_ptr_raw<Function> __func_rename_at_17, ModuleGroup &  __group_rename_at_17, AnnotationArgumentList const  &  __args_rename_at_17, das::string &  __errors_rename_at_17 )
+{
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __argName_rename_at_19 = (TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>)das_alias<RttiValue>::from(das_invoke_function<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::invoke_cmres<char * const ,AnnotationArgumentList const  &>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::find_arg string#const #handle#AnnotationArgumentList#const*/ 417553568u)),((char *) "cond"),__args_rename_at_17));
+	if ( !das_get_variant_field<char *,16,7>::is(__argName_rename_at_19) )
+	{
+		builtin_throw(((char *) "cond must be string"),__context__);
+	} else {
+		prepend_cond_550197a645722a8d(__context__,__func_rename_at_17,das_get_variant_field<char *,16,7>::as(__argName_rename_at_19,__context__));
+	};
+	return true;
+}
+
+inline void __setup_macros_8a2ca2e6c31834f1 ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "_apply_macro"),__context__) )
+	{
+		_Funcast_0x60_add_new_function_annotation_79e91a039f415302(__context__,((char *) "add_cond"),das_new<struct _apply_macro::AppendCondAnnotation>::make_and_init(__context__,[&]() { return AppendCondAnnotation_314ae7a472451b9(__context__); }));
+	};
+}
+
+inline void _Funcast_0x60_add_new_function_annotation_79e91a039f415302 ( Context * __context__, char * const  __name_rename_at_497, struct _apply_macro::AppendCondAnnotation * const  __someClassPtr_rename_at_497 )
+{
+	smart_ptr_raw<FunctionAnnotation> __ann_rename_at_498; das_zero(__ann_rename_at_498); das_move(__ann_rename_at_498, _Funcast_0x60_make_function_annotation_9bee04cc769df77c(__context__,__name_rename_at_497,__someClassPtr_rename_at_497));
+	addModuleFunctionAnnotation(thisModule(__context__,nullptr),__ann_rename_at_498,__context__);
+	das_delete_handle<smart_ptr_raw<FunctionAnnotation>>::clear(__context__,__ann_rename_at_498);
+}
+
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_9bee04cc769df77c ( Context * __context__, char * const  __name_rename_at_439, struct _apply_macro::AppendCondAnnotation * const  __someClassPtr_rename_at_439 )
+{
+	StructInfo const  * __classInfo_rename_at_441 = (StructInfo const  *)_Funcrtti_0x60_class_info_3f14f93b8ac665ab(__context__,das_deref(__context__,__someClassPtr_rename_at_439));
+	return makeFunctionAnnotation(__name_rename_at_439,__someClassPtr_rename_at_439,__classInfo_rename_at_441,__context__);
+}
+
+inline void clone_3985cae92193dfc7 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_11, smart_ptr<Expression> const  __src_rename_at_11 )
+{
+	builtin_smart_ptr_clone(__dest_rename_at_11,__src_rename_at_11);
+}
+
+inline void finalize_593338fe1416b6c0 ( Context * __context__, struct _apply_macro::AppendCondAnnotation &  ____this_rename_at_16 )
+{
+	memset(&(____this_rename_at_16), 0, 24);
+}
+
+inline void prepend_cond_550197a645722a8d ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_7, char * const  __cond_rename_at_7 ) { das_stack_prologue __prologue(__context__,272,"prepend_cond " DAS_FILE_LINE);
+{
+	smart_ptr<Expression> __iblk_rename_at_8; das_zero(__iblk_rename_at_8); das_move(__iblk_rename_at_8, __fn_rename_at_7->body /*body*/);
+	smart_ptr_raw<ExprBlock> __blk_rename_at_9; das_zero(__blk_rename_at_9); das_move(__blk_rename_at_9, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_9) {
+		das_copy((__mks_9.at /*at*/),(__fn_rename_at_7->at /*at*/));
+	}))));
+	smart_ptr_raw<ExprCall> __ifm_rename_at_10; das_zero(__ifm_rename_at_10); das_move(__ifm_rename_at_10, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_10) {
+		das_copy((__mks_10.at /*at*/),(__fn_rename_at_7->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_10.name /*name*/),__cond_rename_at_7);
+		}	}))));
+	smart_ptr_raw<ExprIfThenElse> __ife_rename_at_11; das_zero(__ife_rename_at_11); das_move(__ife_rename_at_11, das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_11) {
+		das_copy((__mks_11.at /*at*/),(__fn_rename_at_7->at /*at*/));
+		das_move((__mks_11.cond /*cond*/),(__ifm_rename_at_10));
+		{
+			clone_3985cae92193dfc7(__context__,__mks_11.if_true /*if_true*/,__iblk_rename_at_8);
+		}	}))));
+	das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_9->list /*list*/),das_reinterpret<smart_ptr<Expression> const >::pass(__ife_rename_at_11));
+	das_move(__fn_rename_at_7->body /*body*/,__blk_rename_at_9);
+}}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_3f14f93b8ac665ab ( Context * __context__, struct _apply_macro::AppendCondAnnotation const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// AppendCondAnnotation_314ae7a472451b9
+		aotLib[0xa8f45363afe31fa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct _apply_macro::AppendCondAnnotation (*) ( Context * __context__ ),&AppendCondAnnotation_314ae7a472451b9>>();
+	};
+		// _FuncAppendCondAnnotation_0x27___finalize_70ee78e3952df723
+		aotLib[0x2c6857044280fbab] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _apply_macro::AppendCondAnnotation &  ),&_FuncAppendCondAnnotation_0x27___finalize_70ee78e3952df723>>();
+	};
+		// _FuncAppendCondAnnotation_0x60_apply_c694eb54d82548c7
+		aotLib[0xa27050e8674be97c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _apply_macro::AppendCondAnnotation & , smart_ptr_raw<Function> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncAppendCondAnnotation_0x60_apply_c694eb54d82548c7>>();
+	};
+		// __setup_macros_8a2ca2e6c31834f1
+		aotLib[0x39ddb94f53e4ca68] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_8a2ca2e6c31834f1>>();
+	};
+		// _Funcast_0x60_add_new_function_annotation_79e91a039f415302
+		aotLib[0xb56de56e2ce255c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct _apply_macro::AppendCondAnnotation * const   ),&_Funcast_0x60_add_new_function_annotation_79e91a039f415302>>();
+	};
+		// _Funcast_0x60_make_function_annotation_9bee04cc769df77c
+		aotLib[0x489082892ef47f90] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<FunctionAnnotation> (*) ( Context * __context__, char * const  , struct _apply_macro::AppendCondAnnotation * const   ),&_Funcast_0x60_make_function_annotation_9bee04cc769df77c>>();
+	};
+		// clone_3985cae92193dfc7
+		aotLib[0x2d2b0d39ead0d3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr<Expression> & , smart_ptr<Expression> const   ),&clone_3985cae92193dfc7>>();
+	};
+		// finalize_593338fe1416b6c0
+		aotLib[0x3589ba952c950439] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _apply_macro::AppendCondAnnotation &  ),&finalize_593338fe1416b6c0>>();
+	};
+		// prepend_cond_550197a645722a8d
+		aotLib[0xae4a669a7bf97e2e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Function> , char * const   ),&prepend_cond_550197a645722a8d>>();
+	};
+		// _Funcrtti_0x60_class_info_3f14f93b8ac665ab
+		aotLib[0x3083fde6b644d721] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct _apply_macro::AppendCondAnnotation const  &  ),&_Funcrtti_0x60_class_info_3f14f93b8ac665ab>>();
+	};
+		// [[ init script ]]
+		aotLib[0x672960f08e330055] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
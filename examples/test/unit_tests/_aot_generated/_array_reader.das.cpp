@@ -0,0 +1,376 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _array_reader
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__92c3c52e;
+extern StructInfo __struct_info__3e6ad543;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__b676c5e0;
+extern TypeInfo __type_info__239a820b;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__56607ebd;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__2ba0095f;
+extern TypeInfo __type_info__226526a9;
+extern TypeInfo __type_info__b049b391;
+extern TypeInfo __type_info__75b7ce79;
+extern VarInfo __var_info__985e32a8;
+extern VarInfo __var_info__4782b24d;
+extern VarInfo __var_info__bae603ca;
+extern VarInfo __var_info__a93534b2;
+extern VarInfo __var_info__e274c345;
+extern VarInfo __var_info__269ec52a;
+extern VarInfo __var_info__b7f3aed1;
+extern VarInfo __var_info__31b4482d;
+
+VarInfo __struct_info__92c3c52e_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4782b24d, "__rtti", 0 };
+TypeInfo * __type_info__269ec52a_arg_types_var_2462303534[1] = { &__type_info__b676c5e0 };
+VarInfo __struct_info__92c3c52e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__269ec52a_arg_types_var_2462303534, nullptr, 1, 0, nullptr, 28, 0x269ec52a, "__finalize", 8 };
+TypeInfo * __type_info__bae603ca_arg_types_var_2462303534[6] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__56607ebd, &__type_info__359c1b32, &__type_info__239a820b };
+VarInfo __struct_info__92c3c52e_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__bae603ca_arg_types_var_2462303534, nullptr, 6, 0, nullptr, 28, 0xbae603ca, "accept", 12 };
+TypeInfo * __type_info__b7f3aed1_arg_types_var_2462303534[4] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__2ba0095f };
+VarInfo __struct_info__92c3c52e_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b7f3aed1_arg_types_var_2462303534, nullptr, 4, 0, nullptr, 28, 0xb7f3aed1, "visit", 16 };
+VarInfo * __struct_info__92c3c52e_fields[4] =  { &__struct_info__92c3c52e_field_0, &__struct_info__92c3c52e_field_1, &__struct_info__92c3c52e_field_2, &__struct_info__92c3c52e_field_3 };
+StructInfo __struct_info__92c3c52e = {"AstReaderMacro", __struct_info__92c3c52e_fields, 4, 24, -1, nullptr, 0x92c3c52e };
+VarInfo __struct_info__3e6ad543_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa93534b2, "__rtti", 0 };
+TypeInfo * __type_info__e274c345_arg_types_var_1047188803[1] = { &__type_info__b676c5e0 };
+VarInfo __struct_info__3e6ad543_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e274c345_arg_types_var_1047188803, nullptr, 1, 0, nullptr, 28, 0xe274c345, "__finalize", 8 };
+TypeInfo * __type_info__31b4482d_arg_types_var_1047188803[6] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__56607ebd, &__type_info__359c1b32, &__type_info__239a820b };
+VarInfo __struct_info__3e6ad543_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__31b4482d_arg_types_var_1047188803, nullptr, 6, 0, nullptr, 28, 0x31b4482d, "accept", 12 };
+TypeInfo * __type_info__985e32a8_arg_types_var_1047188803[4] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__2ba0095f };
+VarInfo __struct_info__3e6ad543_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__985e32a8_arg_types_var_1047188803, nullptr, 4, 0, nullptr, 28, 0x985e32a8, "visit", 16 };
+VarInfo * __struct_info__3e6ad543_fields[4] =  { &__struct_info__3e6ad543_field_0, &__struct_info__3e6ad543_field_1, &__struct_info__3e6ad543_field_2, &__struct_info__3e6ad543_field_3 };
+StructInfo __struct_info__3e6ad543 = {"ArrayReader", __struct_info__3e6ad543_fields, 4, 24, -1, nullptr, 0x3e6ad543 };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__b676c5e0 = { Type::tStructure, &__struct_info__92c3c52e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb676c5e0 };
+TypeInfo __type_info__239a820b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::LineInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 38, 0x239a820b };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__56607ebd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x56607ebd };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__2ba0095f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2ba0095f };
+TypeInfo __type_info__226526a9 = { Type::tStructure, &__struct_info__3e6ad543, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x226526a9 };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+TypeInfo __type_info__75b7ce79 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReader"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x75b7ce79 };
+
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+namespace ast {
+
+struct AstReaderMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(AstReaderMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,accept)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,visit)==16,"structure field offset mismatch with DAS");
+}
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace _array_reader {
+
+struct ArrayReader {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(ArrayReader)==24,"structure size mismatch with DAS");
+static_assert(offsetof(ArrayReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ArrayReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ArrayReader,accept)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(ArrayReader,visit)==16,"structure field offset mismatch with DAS");
+}
+
+inline struct _array_reader::ArrayReader ArrayReader_aca336781958dc2a ( Context * __context__ );
+inline void _FuncArrayReader_0x27___finalize_b8b9778f237723b5 ( Context * __context__, struct _array_reader::ArrayReader & __self_rename_at_9 );
+inline bool _FuncArrayReader_0x60_accept_782ed11659625e53 ( Context * __context__, struct _array_reader::ArrayReader & __self_rename_at_10, smart_ptr_raw<Program> const  __prog_rename_at_10, Module * const  __mod_rename_at_10, ExprReader * __expr_rename_at_10, int32_t __ch_rename_at_10, LineInfo const  & __info_rename_at_10 );
+inline smart_ptr_raw<Expression> _FuncArrayReader_0x60_visit_3cb684795f957f4a ( Context * __context__, struct _array_reader::ArrayReader & __self_rename_at_18, smart_ptr_raw<Program> const  __prog_rename_at_18, Module * const  __mod_rename_at_18, smart_ptr_raw<ExprReader> const  __expr_rename_at_18 );
+inline void __setup_macros_983bdbf3185d1a5 ( Context * __context__ );
+inline void _Funcast_0x60_add_new_reader_macro_6b2e135707e74566 ( Context * __context__, char * const  __name_rename_at_515, struct _array_reader::ArrayReader * const  __someClassPtr_rename_at_515 );
+inline smart_ptr_raw<ReaderMacro> _Funcast_0x60_make_reader_macro_8d6c4c4cae6337f2 ( Context * __context__, char * const  __name_rename_at_465, struct _array_reader::ArrayReader * const  __someClassPtr_rename_at_465 );
+inline void finalize_397b8f290cae6405 ( Context * __context__, struct _array_reader::ArrayReader & ____this_rename_at_9 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_92094718ccacb3c8 ( Context * __context__, struct _array_reader::ArrayReader const  & __cl_rename_at_88 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	__setup_macros_983bdbf3185d1a5(__context__);
+}
+
+inline struct _array_reader::ArrayReader ArrayReader_aca336781958dc2a ( Context * __context__ )
+{
+	return (([&]() -> struct _array_reader::ArrayReader {
+		struct _array_reader::ArrayReader __mks_9;
+		das_copy((__mks_9.__rtti),(((void *)(&__type_info__226526a9))));
+		das_copy((__mks_9.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstReaderMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@_array_reader::ArrayReader'__finalize ArrayReader*/ 1157738756u)))));
+		das_copy((__mks_9.accept),(das_cast<Func DAS_COMMENT((bool,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const ))>::cast(Func(__context__->fnIdxByMangledName(/*@_array_reader::ArrayReader`accept ArrayReader #smart_ptr##handle#Program#const #ptr##handle#Module#const #ptr##handle#ExprReader int#const #handle#LineInfo#const*/ 2003128408u)))));
+		das_copy((__mks_9.visit),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@_array_reader::ArrayReader`visit ArrayReader #smart_ptr##handle#Program#const #ptr##handle#Module#const #smart_ptr##handle#ExprReader#const*/ 3122727386u)))));
+		return __mks_9;
+	})());
+}
+
+inline void _FuncArrayReader_0x27___finalize_b8b9778f237723b5 ( Context * __context__, struct _array_reader::ArrayReader &  __self_rename_at_9 )
+{
+	finalize_397b8f290cae6405(__context__,das_arg<struct _array_reader::ArrayReader>::pass(__self_rename_at_9));
+}
+
+inline bool _FuncArrayReader_0x60_accept_782ed11659625e53 ( Context * __context__, struct _array_reader::ArrayReader &  __self_rename_at_10, smart_ptr_raw<Program> const  __prog_rename_at_10, Module * const  __mod_rename_at_10, ExprReader * __expr_rename_at_10, int32_t __ch_rename_at_10, LineInfo const  &  __info_rename_at_10 )
+{
+	builtin_append_char_to_string(das_arg<das::string>::pass(__expr_rename_at_10->sequence /*sequence*/),__ch_rename_at_10);
+	if ( builtin_string_ends_with(das_arg<das::string>::pass(__expr_rename_at_10->sequence /*sequence*/),((char *) "%%"),__context__) )
+	{
+		int32_t __len_rename_at_13 = (int32_t)builtin_ext_string_length(das_arg<das::string>::pass(__expr_rename_at_10->sequence /*sequence*/));
+		builtin_resize_string(das_arg<das::string>::pass(__expr_rename_at_10->sequence /*sequence*/),__len_rename_at_13 - 2);
+		return false;
+	} else {
+		return true;
+	};
+}
+
+inline smart_ptr_raw<Expression> _FuncArrayReader_0x60_visit_3cb684795f957f4a ( Context * __context__, struct _array_reader::ArrayReader &  __self_rename_at_18, smart_ptr_raw<Program> const  __prog_rename_at_18, Module * const  __mod_rename_at_18, smart_ptr_raw<ExprReader> const  __expr_rename_at_18 )
+{
+	char * __seqStr_rename_at_19 = (char *)(char *)(((char *)(to_das_string(__expr_rename_at_18->sequence /*sequence*/,__context__))));
+	smart_ptr_raw<TypeDecl> __arrT_rename_at_20; das_zero(__arrT_rename_at_20); das_move(__arrT_rename_at_20, das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_20) {
+		das_copy((__mks_20.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tInt));
+	}))));
+	das_vector_push_value(das_arg<das::vector<int32_t>>::pass(__arrT_rename_at_20->dim /*dim*/),builtin_string_length(__seqStr_rename_at_19,__context__));
+	smart_ptr_raw<ExprMakeArray> __mkArr_rename_at_22; das_zero(__mkArr_rename_at_22); das_move(__mkArr_rename_at_22, das_ascend_handle<true,smart_ptr_raw<ExprMakeArray>>::make(__context__,nullptr,(([&](ExprMakeArray & __mks_22) {
+		das_copy((__mks_22.at /*at*/),(__expr_rename_at_18->at /*at*/));
+		das_move((__mks_22.makeType /*makeType*/),(__arrT_rename_at_20));
+	}))));
+	{
+		bool __need_loop_23 = true;
+		// x : int const
+		das_iterator<char * const > __x_iterator(__seqStr_rename_at_19);
+		int32_t __x_rename_at_23;
+		__need_loop_23 = __x_iterator.first(__context__,(__x_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __x_iterator.next(__context__,(__x_rename_at_23)) )
+		{
+			smart_ptr_raw<ExprConstInt> __mkC_rename_at_24; das_zero(__mkC_rename_at_24); das_move(__mkC_rename_at_24, das_ascend_handle<true,smart_ptr_raw<ExprConstInt>>::make(__context__,nullptr,(([&](ExprConstInt & __mks_24) {
+				das_copy((__mks_24.at /*at*/),(__expr_rename_at_18->at /*at*/));
+				das_copy((__mks_24.cvalue<int32_t>() /*value*/),(__x_rename_at_23));
+			}))));
+			das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__mkArr_rename_at_22->values /*values*/),das_reinterpret<smart_ptr<Expression> const >::pass(__mkC_rename_at_24));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_23));
+	};
+	return __mkArr_rename_at_22;
+}
+
+inline void __setup_macros_983bdbf3185d1a5 ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "_array_reader"),__context__) )
+	{
+		_Funcast_0x60_add_new_reader_macro_6b2e135707e74566(__context__,((char *) "arr"),das_new<struct _array_reader::ArrayReader>::make_and_init(__context__,[&]() { return ArrayReader_aca336781958dc2a(__context__); }));
+	};
+}
+
+inline void _Funcast_0x60_add_new_reader_macro_6b2e135707e74566 ( Context * __context__, char * const  __name_rename_at_515, struct _array_reader::ArrayReader * const  __someClassPtr_rename_at_515 )
+{
+	smart_ptr_raw<ReaderMacro> __ann_rename_at_516; das_zero(__ann_rename_at_516); das_move(__ann_rename_at_516, _Funcast_0x60_make_reader_macro_8d6c4c4cae6337f2(__context__,__name_rename_at_515,__someClassPtr_rename_at_515));
+	addModuleReaderMacro(thisModule(__context__,nullptr),__ann_rename_at_516,__context__);
+	das_delete_handle<smart_ptr_raw<ReaderMacro>>::clear(__context__,__ann_rename_at_516);
+}
+
+inline smart_ptr_raw<ReaderMacro> _Funcast_0x60_make_reader_macro_8d6c4c4cae6337f2 ( Context * __context__, char * const  __name_rename_at_465, struct _array_reader::ArrayReader * const  __someClassPtr_rename_at_465 )
+{
+	StructInfo const  * __classInfo_rename_at_467 = (StructInfo const  *)_Funcrtti_0x60_class_info_92094718ccacb3c8(__context__,das_deref(__context__,__someClassPtr_rename_at_465));
+	return makeReaderMacro(__name_rename_at_465,__someClassPtr_rename_at_465,__classInfo_rename_at_467,__context__);
+}
+
+inline void finalize_397b8f290cae6405 ( Context * __context__, struct _array_reader::ArrayReader &  ____this_rename_at_9 )
+{
+	memset(&(____this_rename_at_9), 0, 24);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_92094718ccacb3c8 ( Context * __context__, struct _array_reader::ArrayReader const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// ArrayReader_aca336781958dc2a
+		aotLib[0xf3b5d439d7cadd0c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct _array_reader::ArrayReader (*) ( Context * __context__ ),&ArrayReader_aca336781958dc2a>>();
+	};
+		// _FuncArrayReader_0x27___finalize_b8b9778f237723b5
+		aotLib[0x3f444a27f77fb7e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _array_reader::ArrayReader &  ),&_FuncArrayReader_0x27___finalize_b8b9778f237723b5>>();
+	};
+		// _FuncArrayReader_0x60_accept_782ed11659625e53
+		aotLib[0x3bd58500eccf2d41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _array_reader::ArrayReader & , smart_ptr_raw<Program> const  , Module * const  , ExprReader * , int32_t , LineInfo const  &  ),&_FuncArrayReader_0x60_accept_782ed11659625e53>>();
+	};
+		// _FuncArrayReader_0x60_visit_3cb684795f957f4a
+		aotLib[0xf64e293a46ab3385] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct _array_reader::ArrayReader & , smart_ptr_raw<Program> const  , Module * const  , smart_ptr_raw<ExprReader> const   ),&_FuncArrayReader_0x60_visit_3cb684795f957f4a>>();
+	};
+		// __setup_macros_983bdbf3185d1a5
+		aotLib[0xcd149baf8ba49c6c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_983bdbf3185d1a5>>();
+	};
+		// _Funcast_0x60_add_new_reader_macro_6b2e135707e74566
+		aotLib[0xff9b9ba7de9d6dbf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , struct _array_reader::ArrayReader * const   ),&_Funcast_0x60_add_new_reader_macro_6b2e135707e74566>>();
+	};
+		// _Funcast_0x60_make_reader_macro_8d6c4c4cae6337f2
+		aotLib[0xe928f244651109e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ReaderMacro> (*) ( Context * __context__, char * const  , struct _array_reader::ArrayReader * const   ),&_Funcast_0x60_make_reader_macro_8d6c4c4cae6337f2>>();
+	};
+		// finalize_397b8f290cae6405
+		aotLib[0x20894239e5b06f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _array_reader::ArrayReader &  ),&finalize_397b8f290cae6405>>();
+	};
+		// _Funcrtti_0x60_class_info_92094718ccacb3c8
+		aotLib[0xa8b35fb0d59425f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct _array_reader::ArrayReader const  &  ),&_Funcrtti_0x60_class_info_92094718ccacb3c8>>();
+	};
+		// [[ init script ]]
+		aotLib[0xdfa68d46c3f435b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
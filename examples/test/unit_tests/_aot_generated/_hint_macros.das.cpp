@@ -0,0 +1,340 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _hint_macros
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__48703320;
+extern StructInfo __struct_info__6a4ffaaa;
+extern TypeInfo __type_info__a6e25c66;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__dcfff1ff;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__f955b4ec;
+extern TypeInfo __type_info__8ce26751;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__a07921bf;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__a80e24ba;
+extern TypeInfo __type_info__c1bd2f4c;
+extern TypeInfo __type_info__79323f61;
+extern TypeInfo __type_info__be386f7a;
+extern VarInfo __var_info__53346e76;
+extern VarInfo __var_info__29362869;
+extern VarInfo __var_info__ba3575b1;
+extern VarInfo __var_info__bd9d5026;
+extern VarInfo __var_info__3989b8f3;
+extern VarInfo __var_info__1c223b0;
+extern VarInfo __var_info__4c663710;
+extern VarInfo __var_info__6197a9c8;
+extern VarInfo __var_info__733a1a9e;
+extern VarInfo __var_info__70fbc23b;
+
+VarInfo __struct_info__48703320_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x70fbc23b, "__rtti", 0 };
+TypeInfo * __type_info__4c663710_arg_types_var_1215312672[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__48703320_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c663710_arg_types_var_1215312672, nullptr, 1, 0, nullptr, 28, 0x4c663710, "__finalize", 8 };
+TypeInfo * __type_info__1c223b0_arg_types_var_1215312672[3] = { &__type_info__a80e24ba, &__type_info__f955b4ec, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1c223b0_arg_types_var_1215312672, nullptr, 3, 0, nullptr, 28, 0x1c223b0, "transform", 12 };
+TypeInfo * __type_info__6197a9c8_arg_types_var_1215312672[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__6197a9c8_arg_types_var_1215312672, nullptr, 5, 0, nullptr, 28, 0x6197a9c8, "apply", 16 };
+TypeInfo * __type_info__3989b8f3_arg_types_var_1215312672[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3989b8f3_arg_types_var_1215312672, nullptr, 6, 0, nullptr, 28, 0x3989b8f3, "finish", 20 };
+VarInfo * __struct_info__48703320_fields[5] =  { &__struct_info__48703320_field_0, &__struct_info__48703320_field_1, &__struct_info__48703320_field_2, &__struct_info__48703320_field_3, &__struct_info__48703320_field_4 };
+StructInfo __struct_info__48703320 = {"AstFunctionAnnotation", __struct_info__48703320_fields, 5, 24, -1, nullptr, 0x48703320 };
+VarInfo __struct_info__6a4ffaaa_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xba3575b1, "__rtti", 0 };
+TypeInfo * __type_info__733a1a9e_arg_types_var_1783626410[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__6a4ffaaa_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__733a1a9e_arg_types_var_1783626410, nullptr, 1, 0, nullptr, 28, 0x733a1a9e, "__finalize", 8 };
+TypeInfo * __type_info__53346e76_arg_types_var_1783626410[3] = { &__type_info__a80e24ba, &__type_info__f955b4ec, &__type_info__8ce26751 };
+VarInfo __struct_info__6a4ffaaa_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__53346e76_arg_types_var_1783626410, nullptr, 3, 0, nullptr, 28, 0x53346e76, "transform", 12 };
+TypeInfo * __type_info__bd9d5026_arg_types_var_1783626410[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__6a4ffaaa_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__bd9d5026_arg_types_var_1783626410, nullptr, 5, 0, nullptr, 28, 0xbd9d5026, "apply", 16 };
+TypeInfo * __type_info__29362869_arg_types_var_1783626410[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__6a4ffaaa_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__29362869_arg_types_var_1783626410, nullptr, 6, 0, nullptr, 28, 0x29362869, "finish", 20 };
+VarInfo * __struct_info__6a4ffaaa_fields[5] =  { &__struct_info__6a4ffaaa_field_0, &__struct_info__6a4ffaaa_field_1, &__struct_info__6a4ffaaa_field_2, &__struct_info__6a4ffaaa_field_3, &__struct_info__6a4ffaaa_field_4 };
+StructInfo __struct_info__6a4ffaaa = {"GetHintFnMacro", __struct_info__6a4ffaaa_fields, 5, 24, -1, nullptr, 0x6a4ffaaa };
+TypeInfo __type_info__a6e25c66 = { Type::tStructure, &__struct_info__6a4ffaaa, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xa6e25c66 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__dcfff1ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xdcfff1ff };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__f955b4ec = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be386f7a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xf955b4ec };
+TypeInfo __type_info__8ce26751 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8ce26751 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__a07921bf = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::AnnotationArgumentList"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xa07921bf };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__a80e24ba = { Type::tStructure, &__struct_info__48703320, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xa80e24ba };
+TypeInfo __type_info__c1bd2f4c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ModuleGroup"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc1bd2f4c };
+TypeInfo __type_info__79323f61 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Function"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x79323f61 };
+TypeInfo __type_info__be386f7a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbe386f7a };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__17c16538 };
+TypeInfo * __tinfo_1[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_2[1] = { &__type_info__3ffbf730 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+namespace ast {
+
+struct AstFunctionAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstFunctionAnnotation,smart_ptr_raw<ExprCall>,das::string)) transform;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AstFunctionAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==20,"structure field offset mismatch with DAS");
+}
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace _hint_macros {
+
+struct HintLookup {
+	TTable<uint32_t,char *> tab;
+};
+static_assert(sizeof(HintLookup)==48,"structure size mismatch with DAS");
+static_assert(offsetof(HintLookup,tab)==0,"structure field offset mismatch with DAS");
+}
+namespace _hint_macros {
+
+struct GetHintFnMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstFunctionAnnotation,smart_ptr_raw<ExprCall>,das::string)) transform;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,struct ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(GetHintFnMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,finish)==20,"structure field offset mismatch with DAS");
+}
+
+inline struct _hint_macros::GetHintFnMacro GetHintFnMacro_3a5fde22fb465661 ( Context * __context__ );
+inline void _FuncGetHintFnMacro_0x27___finalize_8ddf39201e8a51ab ( Context * __context__, struct _hint_macros::GetHintFnMacro & __self_rename_at_22 );
+inline smart_ptr_raw<Expression> _FuncGetHintFnMacro_0x60_transform_3694b6ce8b4d4ac3 ( Context * __context__, struct _hint_macros::GetHintFnMacro & __self_rename_at_23, smart_ptr_raw<ExprCall> __call_rename_at_23, das::string & __errors_rename_at_23 );
+inline void __setup_macros_80ad3c9759486b5e ( Context * __context__ );
+inline void _Funcast_boost_0x60_setup_tag_annotation_d39192658e5966a9 ( Context * __context__, char * const  __name_rename_at_137, char * const  __tag_rename_at_137, struct _hint_macros::GetHintFnMacro * const  __classPtr_rename_at_137 );
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_e43091da5e86282c ( Context * __context__, char * const  __name_rename_at_439, struct _hint_macros::GetHintFnMacro * const  __someClassPtr_rename_at_439 );
+inline void finalize_27f6a869f8a66dea ( Context * __context__, struct _hint_macros::GetHintFnMacro & ____this_rename_at_22 );
+inline char * const  get_hint_5953ce75eb6a06d7 ( Context * __context__, struct _hint_macros::HintLookup const  & __lookup_rename_at_17, char * const  __id_rename_at_17, char * const  __defv_rename_at_17 );
+inline char * const  get_hint_5f5e02436d95155 ( Context * __context__, struct _hint_macros::HintLookup const  & __lookup_rename_at_13, char * const  __id_rename_at_13, char * const  __defv_rename_at_13, uint32_t __hint_rename_at_13 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_a8c4161f9656ac31 ( Context * __context__, struct _hint_macros::GetHintFnMacro const  & __cl_rename_at_88 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0>(__context__) = 0;/*g_non_hints*/
+	__setup_macros_80ad3c9759486b5e(__context__);
+}
+
+inline struct _hint_macros::GetHintFnMacro GetHintFnMacro_3a5fde22fb465661 ( Context * __context__ )
+{
+	return (([&]() -> struct _hint_macros::GetHintFnMacro {
+		struct _hint_macros::GetHintFnMacro __mks_22;
+		das_zero(__mks_22);
+		das_copy((__mks_22.__rtti),(((void *)(&__type_info__a6e25c66))));
+		das_copy((__mks_22.__finalize),(das_cast<Func DAS_COMMENT((void,struct ast::AstFunctionAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@_hint_macros::GetHintFnMacro'__finalize GetHintFnMacro*/ 3904178732u)))));
+		das_copy((__mks_22.transform),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,struct ast::AstFunctionAnnotation,smart_ptr_raw<ExprCall>,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@_hint_macros::GetHintFnMacro`transform GetHintFnMacro #smart_ptr##handle#ExprCall #handle#das_string*/ 4038265272u)))));
+		return __mks_22;
+	})());
+}
+
+inline void _FuncGetHintFnMacro_0x27___finalize_8ddf39201e8a51ab ( Context * __context__, struct _hint_macros::GetHintFnMacro &  __self_rename_at_22 )
+{
+	finalize_27f6a869f8a66dea(__context__,das_arg<struct _hint_macros::GetHintFnMacro>::pass(__self_rename_at_22));
+}
+
+inline smart_ptr_raw<Expression> _FuncGetHintFnMacro_0x60_transform_3694b6ce8b4d4ac3 ( Context * __context__, struct _hint_macros::GetHintFnMacro &  __self_rename_at_23, smart_ptr_raw<ExprCall> __call_rename_at_23, das::string &  __errors_rename_at_23 )
+{
+	if ( SimPolicy<char *>::Equ(cast<char *>::from(das_index<das::vector<smart_ptr<Expression>>>::at(__call_rename_at_23->arguments /*arguments*/,1,__context__)->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprConstString")),*__context__) )
+	{
+		ExprConstString * __arg2_rename_at_26 = (ExprConstString *)das_cast<ExprConstString *>::cast(das_index<das::vector<smart_ptr<Expression>>>::at(__call_rename_at_23->arguments /*arguments*/,1,__context__));
+		uint32_t __hint_rename_at_27 = (uint32_t)das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<das::string const  &>::from(__arg2_rename_at_26->text /*value*/))))));
+		smart_ptr_raw<ExprConstUInt> __mkc_rename_at_28; das_zero(__mkc_rename_at_28); das_move(__mkc_rename_at_28, das_ascend_handle<true,smart_ptr_raw<ExprConstUInt>>::make(__context__,nullptr,(([&](ExprConstUInt & __mks_28) {
+			das_copy((__mks_28.at /*at*/),(__arg2_rename_at_26->at /*at*/));
+			das_copy((__mks_28.cvalue<uint32_t>() /*value*/),(__hint_rename_at_27));
+		}))));
+		das_vector_push_value(das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_23->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression> const >::pass(__mkc_rename_at_28));
+		return /* <- */ __call_rename_at_23;
+	} else {
+		return nullptr;
+	};
+}
+
+inline void __setup_macros_80ad3c9759486b5e ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "_hint_macros"),__context__) )
+	{
+		_Funcast_boost_0x60_setup_tag_annotation_d39192658e5966a9(__context__,((char *) "GetHintFnMacro"),((char *) "get_hint_tag"),das_new<struct _hint_macros::GetHintFnMacro>::make_and_init(__context__,[&]() { return GetHintFnMacro_3a5fde22fb465661(__context__); }));
+	};
+}
+
+inline void _Funcast_boost_0x60_setup_tag_annotation_d39192658e5966a9 ( Context * __context__, char * const  __name_rename_at_137, char * const  __tag_rename_at_137, struct _hint_macros::GetHintFnMacro * const  __classPtr_rename_at_137 )
+{
+	smart_ptr_raw<FunctionAnnotation> __ann_rename_at_138; das_zero(__ann_rename_at_138); das_move(__ann_rename_at_138, _Funcast_0x60_make_function_annotation_e43091da5e86282c(__context__,__name_rename_at_137,__classPtr_rename_at_137));
+	das_invoke_function<void>::invoke<char * const ,smart_ptr_raw<FunctionAnnotation>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::apply_tag_annotation string#const #smart_ptr##handle#FunctionAnnotation#const*/ 2944298228u)),__tag_rename_at_137,__ann_rename_at_138);
+	addModuleFunctionAnnotation(thisModule(__context__,nullptr),__ann_rename_at_138,__context__);
+	das_delete_handle<smart_ptr_raw<FunctionAnnotation>>::clear(__context__,__ann_rename_at_138);
+}
+
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_e43091da5e86282c ( Context * __context__, char * const  __name_rename_at_439, struct _hint_macros::GetHintFnMacro * const  __someClassPtr_rename_at_439 )
+{
+	StructInfo const  * __classInfo_rename_at_441 = (StructInfo const  *)_Funcrtti_0x60_class_info_a8c4161f9656ac31(__context__,das_deref(__context__,__someClassPtr_rename_at_439));
+	return makeFunctionAnnotation(__name_rename_at_439,__someClassPtr_rename_at_439,__classInfo_rename_at_441,__context__);
+}
+
+inline void finalize_27f6a869f8a66dea ( Context * __context__, struct _hint_macros::GetHintFnMacro &  ____this_rename_at_22 )
+{
+	memset(&(____this_rename_at_22), 0, 24);
+}
+
+inline char * const  get_hint_5953ce75eb6a06d7 ( Context * __context__, struct _hint_macros::HintLookup const  &  __lookup_rename_at_17, char * const  __id_rename_at_17, char * const  __defv_rename_at_17 )
+{
+	das_global<int32_t,0>(__context__) /*g_non_hints*/++;
+	return get_hint_5f5e02436d95155(__context__,__lookup_rename_at_17,__id_rename_at_17,__defv_rename_at_17,das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<char * const >::from(__id_rename_at_17))));
+}
+
+inline char * const  get_hint_5f5e02436d95155 ( Context * __context__, struct _hint_macros::HintLookup const  &  __lookup_rename_at_13, char * const  __id_rename_at_13, char * const  __defv_rename_at_13, uint32_t __hint_rename_at_13 )
+{
+	return das_null_coalescing<char * const >::get(TTable<uint32_t,char *>::safe_index(&(__lookup_rename_at_13.tab),__hint_rename_at_13,__context__),__defv_rename_at_13);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_a8c4161f9656ac31 ( Context * __context__, struct _hint_macros::GetHintFnMacro const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// GetHintFnMacro_3a5fde22fb465661
+		aotLib[0x77ad8510ec1e79b0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct _hint_macros::GetHintFnMacro (*) ( Context * __context__ ),&GetHintFnMacro_3a5fde22fb465661>>();
+	};
+		// _FuncGetHintFnMacro_0x27___finalize_8ddf39201e8a51ab
+		aotLib[0xd0b1b87d44c89ba8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _hint_macros::GetHintFnMacro &  ),&_FuncGetHintFnMacro_0x27___finalize_8ddf39201e8a51ab>>();
+	};
+		// _FuncGetHintFnMacro_0x60_transform_3694b6ce8b4d4ac3
+		aotLib[0x58ecdfaea1b36675] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, struct _hint_macros::GetHintFnMacro & , smart_ptr_raw<ExprCall> , das::string &  ),&_FuncGetHintFnMacro_0x60_transform_3694b6ce8b4d4ac3>>();
+	};
+		// __setup_macros_80ad3c9759486b5e
+		aotLib[0xb30606ba340bb66c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_80ad3c9759486b5e>>();
+	};
+		// _Funcast_boost_0x60_setup_tag_annotation_d39192658e5966a9
+		aotLib[0x2d598738ca03c9ff] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , struct _hint_macros::GetHintFnMacro * const   ),&_Funcast_boost_0x60_setup_tag_annotation_d39192658e5966a9>>();
+	};
+		// _Funcast_0x60_make_function_annotation_e43091da5e86282c
+		aotLib[0xa538c22789bc6f39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<FunctionAnnotation> (*) ( Context * __context__, char * const  , struct _hint_macros::GetHintFnMacro * const   ),&_Funcast_0x60_make_function_annotation_e43091da5e86282c>>();
+	};
+		// finalize_27f6a869f8a66dea
+		aotLib[0xbcb228898de20d59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _hint_macros::GetHintFnMacro &  ),&finalize_27f6a869f8a66dea>>();
+	};
+		// get_hint_5953ce75eb6a06d7
+		aotLib[0x7f85da3f8b88209e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, struct _hint_macros::HintLookup const  & , char * const  , char * const   ),&get_hint_5953ce75eb6a06d7>>();
+	};
+		// get_hint_5f5e02436d95155
+		aotLib[0xf5cf91981f1de791] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, struct _hint_macros::HintLookup const  & , char * const  , char * const  , uint32_t  ),&get_hint_5f5e02436d95155>>();
+	};
+		// _Funcrtti_0x60_class_info_a8c4161f9656ac31
+		aotLib[0x64ce5c8f1df564ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct _hint_macros::GetHintFnMacro const  &  ),&_Funcrtti_0x60_class_info_a8c4161f9656ac31>>();
+	};
+		// [[ init script ]]
+		aotLib[0xd46e60b6f8d673bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
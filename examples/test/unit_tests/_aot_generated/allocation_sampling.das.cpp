@@ -0,0 +1,252 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__e0eb17eb;
+extern FuncInfo __func_info__f7955f30;
+
+VarInfo __func_info__f7955f30_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::AllocationSite"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xe0eb17eb, "site", 0 };
+VarInfo * __func_info__f7955f30_fields[1] =  { &__func_info__f7955f30_field_0 };
+FuncInfo __func_info__f7955f30 = {"invoke block<(site:$::AllocationSite const):void> const", "", __func_info__f7955f30_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xf7955f30, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+namespace  {
+
+struct Foo {
+	int32_t a;
+	float4 b;
+};
+static_assert(sizeof(Foo)==20,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_finalize_3eaa6fadb08b29b2 ( Context * __context__, TArray<struct Foo *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_f8d9405a57e5f61a ( Context * __context__, TArray<struct Foo *> & __Arr_rename_at_40, struct Foo * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> & __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void finalize_35cbc9c319ff14d ( Context * __context__, struct Foo * & ____this_rename_at_289 );
+inline void finalize_3efe2afcc84ff89d ( Context * __context__, struct Foo & ____this_rename_at_3 );
+inline TArray<struct Foo *> make_foos_4d05b1571f2b02ee ( Context * __context__, int32_t __count_rename_at_7 );
+inline TArray<char *> make_names_cc5e4097aa84a61a ( Context * __context__, int32_t __count_rename_at_13 );
+inline bool test_99f3f82b521231e1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_3eaa6fadb08b29b2 ( Context * __context__, TArray<struct Foo *> &  __a_rename_at_285 )
+{
+	{
+		bool __need_loop_287 = true;
+		// aV : Foo? aka TT&
+		das_iterator<TArray<struct Foo *>> __aV_iterator(__a_rename_at_285);
+		struct Foo * * __aV_rename_at_287;
+		__need_loop_287 = __aV_iterator.first(__context__,(__aV_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __aV_iterator.next(__context__,(__aV_rename_at_287)) )
+		{
+			finalize_35cbc9c319ff14d(__context__,(*__aV_rename_at_287));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_287));
+	};
+	builtin_array_free(das_arg<TArray<struct Foo *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_f8d9405a57e5f61a ( Context * __context__, TArray<struct Foo *> &  __Arr_rename_at_40, struct Foo * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<struct Foo *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> &  __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<char *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void finalize_35cbc9c319ff14d ( Context * __context__, struct Foo * & ____this_rename_at_289 )
+{
+	if ( ____this_rename_at_289 != nullptr )
+	{
+		finalize_3efe2afcc84ff89d(__context__,das_arg<struct Foo>::pass(das_deref(__context__,____this_rename_at_289)));
+		das_delete<struct Foo *>::clear(__context__,____this_rename_at_289);
+		das_copy(____this_rename_at_289,nullptr);
+	};
+}
+
+inline void finalize_3efe2afcc84ff89d ( Context * __context__, struct Foo &  ____this_rename_at_3 )
+{
+	memset(&(____this_rename_at_3), 0, 20);
+}
+
+inline TArray<struct Foo *> make_foos_4d05b1571f2b02ee ( Context * __context__, int32_t __count_rename_at_7 )
+{
+	TArray<struct Foo *> __foos_rename_at_8; das_zero(__foos_rename_at_8);
+	{
+		bool __need_loop_9 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__count_rename_at_7));
+		int32_t __i_rename_at_9;
+		__need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9)) && __need_loop_9;
+		for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9)) )
+		{
+			_Funcbuiltin_0x60_push_f8d9405a57e5f61a(__context__,das_arg<TArray<struct Foo *>>::pass(__foos_rename_at_8),das_ascend<struct Foo,struct Foo>::make(__context__,nullptr,(([&]() -> struct Foo {
+				struct Foo __mks_10;
+				das_zero(__mks_10);
+				das_copy((__mks_10.a),(__i_rename_at_9));
+				return __mks_10;
+			})())),-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_9));
+	};
+	return /* <- */ __foos_rename_at_8;
+}
+
+inline TArray<char *> make_names_cc5e4097aa84a61a ( Context * __context__, int32_t __count_rename_at_13 )
+{
+	TArray<char *> __names_rename_at_14; das_zero(__names_rename_at_14);
+	{
+		bool __need_loop_15 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__count_rename_at_13));
+		int32_t __i_rename_at_15;
+		__need_loop_15 = __i_iterator.first(__context__,(__i_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __i_iterator.next(__context__,(__i_rename_at_15)) )
+		{
+			_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass(__names_rename_at_14),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "name_")), cast<int32_t>::from(__i_rename_at_15))),-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_15));
+	};
+	return /* <- */ __names_rename_at_14;
+}
+
+inline bool test_99f3f82b521231e1 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,304,"test " DAS_FILE_LINE);
+{
+	set_allocation_sampling(0x1000ull,__context__);
+	TArray<struct Foo *> __foos_rename_at_23; das_zero(__foos_rename_at_23); das_move(__foos_rename_at_23, make_foos_4d05b1571f2b02ee(__context__,10000));
+	TArray<char *> __names_rename_at_24; das_zero(__names_rename_at_24); das_move(__names_rename_at_24, make_names_cc5e4097aa84a61a(__context__,10000));
+	uint64_t __heapSamples_rename_at_25 = 0; uint64_t __heapBytes_rename_at_25 = 0; uint64_t __stringSamples_rename_at_25 = 0; uint64_t __stringBytes_rename_at_25 = 0;
+	allocation_sites(100,das_make_block<void,das::AllocationSite const  &>(__context__,208,0,&__func_info__f7955f30,[&](das::AllocationSite const  & __site_rename_at_26)->void{
+		DAS_ASSERT((__site_rename_at_26.samples /*samples*/ != 0x0ull));
+		DAS_ASSERT((__site_rename_at_26.sampledBytes /*sampledBytes*/ >= __site_rename_at_26.samples /*samples*/));
+		DAS_ASSERT((__site_rename_at_26.estimatedBytes /*estimatedBytes*/ >= __site_rename_at_26.sampledBytes /*sampledBytes*/));
+		DAS_ASSERT((__site_rename_at_26.estimatedBytes /*estimatedBytes*/ >= (__site_rename_at_26.samples /*samples*/ * 0x1000ull)));
+		if ( __site_rename_at_26.stringHeap /*stringHeap*/ )
+		{
+			__stringSamples_rename_at_25 += __site_rename_at_26.samples /*samples*/;
+			__stringBytes_rename_at_25 += __site_rename_at_26.estimatedBytes /*estimatedBytes*/;
+		} else {
+			__heapSamples_rename_at_25 += __site_rename_at_26.samples /*samples*/;
+			__heapBytes_rename_at_25 += __site_rename_at_26.estimatedBytes /*estimatedBytes*/;
+		};
+	}),__context__);
+	DAS_ASSERT((__heapSamples_rename_at_25 != 0x0ull));
+	DAS_ASSERT(((__heapBytes_rename_at_25 >= 0x27100ull) && (__heapBytes_rename_at_25 <= 0x1e8480ull)));
+	DAS_ASSERT((__stringSamples_rename_at_25 != 0x0ull));
+	DAS_ASSERT(((__stringBytes_rename_at_25 >= 0x9c40ull) && (__stringBytes_rename_at_25 <= 0x61a80ull)));
+	reset_allocation_sampling(__context__);
+	int32_t __sites_rename_at_45 = 0;
+	allocation_sites(100,das_make_block<void,das::AllocationSite const  &>(__context__,288,0,&__func_info__f7955f30,[&](das::AllocationSite const  & __site_rename_at_46)->void{
+		__sites_rename_at_45++;
+	}),__context__);
+	DAS_ASSERT((__sites_rename_at_45 == 0));
+	set_allocation_sampling(0x0ull,__context__);
+	_Funcbuiltin_0x60_finalize_3eaa6fadb08b29b2(__context__,das_arg<TArray<struct Foo *>>::pass(__foos_rename_at_23));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__names_rename_at_24));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_3eaa6fadb08b29b2
+		aotLib[0xcd875dab52e38eea] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo *> &  ),&_Funcbuiltin_0x60_finalize_3eaa6fadb08b29b2>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_push_f8d9405a57e5f61a
+		aotLib[0x55199531be8a970d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo *> & , struct Foo * const  , int32_t  ),&_Funcbuiltin_0x60_push_f8d9405a57e5f61a>>();
+	};
+		// _Funcbuiltin_0x60_push_dbe8c61ce24eace2
+		aotLib[0xe7e1aae867aed505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_dbe8c61ce24eace2>>();
+	};
+		// finalize_35cbc9c319ff14d
+		aotLib[0x6a297ab8c4f087d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo * &  ),&finalize_35cbc9c319ff14d>>();
+	};
+		// finalize_3efe2afcc84ff89d
+		aotLib[0x60d3a747f235eed5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&finalize_3efe2afcc84ff89d>>();
+	};
+		// make_foos_4d05b1571f2b02ee
+		aotLib[0xcda3149882a1982a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<struct Foo *> (*) ( Context * __context__, int32_t  ),&make_foos_4d05b1571f2b02ee>>();
+	};
+		// make_names_cc5e4097aa84a61a
+		aotLib[0x19dabe2c8067ed8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, int32_t  ),&make_names_cc5e4097aa84a61a>>();
+	};
+		// test_99f3f82b521231e1
+		aotLib[0x3b2599ad56574408] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_99f3f82b521231e1>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
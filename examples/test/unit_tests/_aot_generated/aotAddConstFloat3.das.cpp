@@ -0,0 +1,95 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline float3 add_8ff41da1ef2434f7 ( Context * __context__, float3 const  & __a_rename_at_3, float3 const  & __b_rename_at_3 );
+inline bool test_cd530d4f2b8fe60a ( Context * __context__ );
+inline float3 test_add_baad16a4a8d06794 ( Context * __context__, float3x4 const  & __m_rename_at_6 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline float3 add_8ff41da1ef2434f7 ( Context * __context__, float3 const  & __a_rename_at_3, float3 const  & __b_rename_at_3 )
+{
+	return SimPolicy<float3>::Add(__a_rename_at_3,__b_rename_at_3,*__context__);
+}
+
+inline bool test_cd530d4f2b8fe60a ( Context * __context__ )
+{
+	float3x4 __m_rename_at_11; das_zero(__m_rename_at_11);
+	DAS_ASSERT((SimPolicy<float3>::Equ(test_add_baad16a4a8d06794(__context__,__m_rename_at_11),v_zero(),*__context__)));
+	return true;
+}
+
+inline float3 test_add_baad16a4a8d06794 ( Context * __context__, float3x4 const  &  __m_rename_at_6 )
+{
+	return add_8ff41da1ef2434f7(__context__,das_index<float3x4 const >::at(__m_rename_at_6,3,__context__),das_index<float3x4 const >::at(__m_rename_at_6,3,__context__));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// add_8ff41da1ef2434f7
+		aotLib[0x22092f119da331c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, float3 const  & , float3 const  &  ),&add_8ff41da1ef2434f7>>();
+	};
+		// test_cd530d4f2b8fe60a
+		aotLib[0xabd10e558bbbc30c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_cd530d4f2b8fe60a>>();
+	};
+		// test_add_baad16a4a8d06794
+		aotLib[0x2a3cb5c420b5570] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, float3x4 const  &  ),&test_add_baad16a4a8d06794>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,110 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Foo {
+	int32_t a;
+	int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+
+inline das::string * _Func_0x60_get_ecs_string_5806eb3b7c835228 ( Context * __context__, struct Foo const  & __obj_rename_at_8, char * const  __name_rename_at_8 );
+inline char * const  _Func_0x60_get_string_14e7c810fb890f39 ( Context * __context__, struct Foo const  & __obj_rename_at_11, char * const  __name_rename_at_11, char * const  __defaultValue_rename_at_11 );
+inline bool test_8e51e343f3f03657 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<das::string *,0>(__context__);/*ds*/
+}
+
+inline das::string * _Func_0x60_get_ecs_string_5806eb3b7c835228 ( Context * __context__, struct Foo const  &  __obj_rename_at_8, char * const  __name_rename_at_8 )
+{
+	return das_global<das::string *,0>(__context__) /*ds*/;
+}
+
+inline char * const  _Func_0x60_get_string_14e7c810fb890f39 ( Context * __context__, struct Foo const  &  __obj_rename_at_11, char * const  __name_rename_at_11, char * const  __defaultValue_rename_at_11 )
+{
+	das::string * __str_rename_at_12 = (das::string *)_Func_0x60_get_ecs_string_5806eb3b7c835228(__context__,__obj_rename_at_11,__name_rename_at_11);
+	return (__str_rename_at_12 != nullptr) ? (((char *)(to_das_string(das_deref(__context__,__str_rename_at_12),__context__)))) : (__defaultValue_rename_at_11);
+}
+
+inline bool test_8e51e343f3f03657 ( Context * __context__ )
+{
+	struct Foo __abilityObj_rename_at_17; das_zero(__abilityObj_rename_at_17);
+	char * __name_rename_at_18 = (char *)(_Func_0x60_get_string_14e7c810fb890f39(__context__,__abilityObj_rename_at_17,((char *) "name"),((char *) "")));
+	das_copy(__name_rename_at_18,_Func_0x60_get_string_14e7c810fb890f39(__context__,__abilityObj_rename_at_17,((char *) "name"),((char *) "")));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_get_ecs_string_5806eb3b7c835228
+		aotLib[0x48fb68ffe78801a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<das::string * (*) ( Context * __context__, struct Foo const  & , char * const   ),&_Func_0x60_get_ecs_string_5806eb3b7c835228>>();
+	};
+		// _Func_0x60_get_string_14e7c810fb890f39
+		aotLib[0xd5c5096311bdf0a8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, struct Foo const  & , char * const  , char * const   ),&_Func_0x60_get_string_14e7c810fb890f39>>();
+	};
+		// test_8e51e343f3f03657
+		aotLib[0xfcef01db3f404413] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_8e51e343f3f03657>>();
+	};
+		// [[ init script ]]
+		aotLib[0xcbc7d317d8719f16] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
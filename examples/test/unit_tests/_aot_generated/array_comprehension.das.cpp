@@ -0,0 +1,160 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline bool test_ad1a32266cb3bb50 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline bool test_ad1a32266cb3bb50 ( Context * __context__ )
+{
+	TArray<int32_t> __q_rename_at_3; das_zero(__q_rename_at_3); das_move(__q_rename_at_3, (TArray<int32_t>)das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_3_rename_at_3; das_zero(____acomp_3_rename_at_3);
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(____acomp_3_rename_at_3),10);
+		{
+			bool __need_loop_3 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_3;
+			__need_loop_3 = __x_iterator.first(__context__,(__x_rename_at_3)) && __need_loop_3;
+			for ( ; __need_loop_3 ; __need_loop_3 = __x_iterator.next(__context__,(__x_rename_at_3)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_3_rename_at_3),__x_rename_at_3 * __x_rename_at_3,-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_3));
+		};
+		return /* <- */ ____acomp_3_rename_at_3;
+	}));
+	{
+		bool __need_loop_4 = true;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,10));
+		int32_t __y_rename_at_4;
+		__need_loop_4 = __y_iterator.first(__context__,(__y_rename_at_4)) && __need_loop_4;
+		// qV : int const&
+		das_iterator<TArray<int32_t> const > __qV_iterator(__q_rename_at_3);
+		int32_t const  * __qV_rename_at_4;
+		__need_loop_4 = __qV_iterator.first(__context__,(__qV_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __y_iterator.next(__context__,(__y_rename_at_4)) && __qV_iterator.next(__context__,(__qV_rename_at_4)) )
+		{
+			DAS_VERIFY(((__y_rename_at_4 * __y_rename_at_4) == (*__qV_rename_at_4)));
+		}
+		__y_iterator.close(__context__,(__y_rename_at_4));
+		__qV_iterator.close(__context__,(__qV_rename_at_4));
+	};
+	TArray<int32_t> __t_rename_at_6; das_zero(__t_rename_at_6); das_move(__t_rename_at_6, (TArray<int32_t>)das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_6_rename_at_6; das_zero(____acomp_6_rename_at_6);
+		{
+			bool __need_loop_6 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_6;
+			__need_loop_6 = __x_iterator.first(__context__,(__x_rename_at_6)) && __need_loop_6;
+			for ( ; __need_loop_6 ; __need_loop_6 = __x_iterator.next(__context__,(__x_rename_at_6)) )
+			{
+				if ( (__x_rename_at_6 & 1) == 0 )
+				{
+					_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_6_rename_at_6),__x_rename_at_6 * __x_rename_at_6,-1);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_6));
+		};
+		return /* <- */ ____acomp_6_rename_at_6;
+	}));
+	int32_t __count_rename_at_7 = 0;
+	{
+		bool __need_loop_8 = true;
+		// z : int const
+		das_iterator<range> __z_iterator(range(0,10));
+		int32_t __z_rename_at_8;
+		__need_loop_8 = __z_iterator.first(__context__,(__z_rename_at_8)) && __need_loop_8;
+		for ( ; __need_loop_8 ; __need_loop_8 = __z_iterator.next(__context__,(__z_rename_at_8)) )
+		{
+			if ( (__z_rename_at_8 & 1) == 0 )
+			{
+				DAS_VERIFY((__t_rename_at_6(__count_rename_at_7++,__context__) == (__z_rename_at_8 * __z_rename_at_8)));
+			};
+		}
+		__z_iterator.close(__context__,(__z_rename_at_8));
+	};
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// test_ad1a32266cb3bb50
+		aotLib[0x8f95ef0f05073d17] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_ad1a32266cb3bb50>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,146 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline int32_t abs_4efd5c1d289dcb ( Context * __context__, int32_t __i_rename_at_1 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline TArray<int32_t> foo_6a707de0b769c30b ( Context * __context__, TArray<int32_t> & __bar_rename_at_4 );
+inline bool test_708fcaa92e4414e3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t abs_4efd5c1d289dcb ( Context * __context__, int32_t __i_rename_at_1 )
+{
+	return (__i_rename_at_1 < 0) ? (-__i_rename_at_1) : (__i_rename_at_1);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline TArray<int32_t> foo_6a707de0b769c30b ( Context * __context__, TArray<int32_t> &  __bar_rename_at_4 )
+{
+	TArray<int32_t> * __b_rename_at_5 = &(__bar_rename_at_4);
+	{
+		bool __need_loop_6 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_6;
+		__need_loop_6 = __x_iterator.first(__context__,(__x_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __x_iterator.next(__context__,(__x_rename_at_6)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_5)),__x_rename_at_6,-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_6));
+	};
+	return /* <- */ (*__b_rename_at_5);
+}
+
+inline bool test_708fcaa92e4414e3 ( Context * __context__ )
+{
+	TArray<int32_t> __a_rename_at_12; das_zero(__a_rename_at_12);
+	{
+		bool __need_loop_13 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_13;
+		__need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_12),10 - __x_rename_at_13,-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_13));
+	};
+	TArray<int32_t> __t_rename_at_15; das_zero(__t_rename_at_15); das_move(__t_rename_at_15, foo_6a707de0b769c30b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_12)));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_12)) == 0));
+	{
+		bool __need_loop_17 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(-10,10));
+		int32_t __x_rename_at_17;
+		__need_loop_17 = __x_iterator.first(__context__,(__x_rename_at_17)) && __need_loop_17;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator(__t_rename_at_15);
+		int32_t * __y_rename_at_17;
+		__need_loop_17 = __y_iterator.first(__context__,(__y_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __x_iterator.next(__context__,(__x_rename_at_17)) && __y_iterator.next(__context__,(__y_rename_at_17)) )
+		{
+			DAS_ASSERT((abs_4efd5c1d289dcb(__context__,__x_rename_at_17) == (*__y_rename_at_17)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_17));
+		__y_iterator.close(__context__,(__y_rename_at_17));
+	};
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// abs_4efd5c1d289dcb
+		aotLib[0x939326ce9222cda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&abs_4efd5c1d289dcb>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// foo_6a707de0b769c30b
+		aotLib[0x15929b54b3e53136] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> &  ),&foo_6a707de0b769c30b>>();
+	};
+		// test_708fcaa92e4414e3
+		aotLib[0xf6ed4b9dc6cfd0df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_708fcaa92e4414e3>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,203 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Funcbuiltin_0x60_finalize_cd1514d2d7718b99 ( Context * __context__, TArray<float4> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline bool test_4ae18cb308edb570 ( Context * __context__ );
+inline void test_grow_25bc066bf08e84f6 ( Context * __context__, int32_t __count_rename_at_3 );
+inline void test_reuse_3d62d86cc39a0574 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_cd1514d2d7718b99 ( Context * __context__, TArray<float4> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<float4>>::pass(__a_rename_at_285),16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float4>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,16,__context__);
+}
+
+inline bool test_4ae18cb308edb570 ( Context * __context__ )
+{
+	test_grow_25bc066bf08e84f6(__context__,100);
+	test_grow_25bc066bf08e84f6(__context__,10000);
+	test_grow_25bc066bf08e84f6(__context__,1000000);
+	test_reuse_3d62d86cc39a0574(__context__);
+	return true;
+}
+
+inline void test_grow_25bc066bf08e84f6 ( Context * __context__, int32_t __count_rename_at_3 )
+{
+	TArray<int32_t> __a_rename_at_4; das_zero(__a_rename_at_4);
+	uint64_t __w0_rename_at_5 = (uint64_t)heap_bytes_allocated(__context__);
+	{
+		bool __need_loop_6 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__count_rename_at_3));
+		int32_t __i_rename_at_6;
+		__need_loop_6 = __i_iterator.first(__context__,(__i_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __i_iterator.next(__context__,(__i_rename_at_6)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_4),__i_rename_at_6,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_6));
+	};
+	{
+		bool __need_loop_8 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__count_rename_at_3));
+		int32_t __i_rename_at_8;
+		__need_loop_8 = __i_iterator.first(__context__,(__i_rename_at_8)) && __need_loop_8;
+		for ( ; __need_loop_8 ; __need_loop_8 = __i_iterator.next(__context__,(__i_rename_at_8)) )
+		{
+			DAS_ASSERT((__a_rename_at_4(__i_rename_at_8,__context__) == __i_rename_at_8));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_8));
+	};
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_4));
+	uint64_t __w1_rename_at_11 = (uint64_t)heap_bytes_allocated(__context__);
+	DAS_ASSERT((__w0_rename_at_5 == __w1_rename_at_11));
+}
+
+inline void test_reuse_3d62d86cc39a0574 ( Context * __context__ )
+{
+	uint64_t __w0_rename_at_15 = (uint64_t)heap_bytes_allocated(__context__);
+	{
+		bool __need_loop_16 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,100));
+		int32_t __t_rename_at_16;
+		__need_loop_16 = __t_iterator.first(__context__,(__t_rename_at_16)) && __need_loop_16;
+		for ( ; __need_loop_16 ; __need_loop_16 = __t_iterator.next(__context__,(__t_rename_at_16)) )
+		{
+			TArray<float4> __a_rename_at_17; das_zero(__a_rename_at_17);
+			_Funcbuiltin_0x60_resize_761fb73a377a5e66(__context__,das_arg<TArray<float4>>::pass(__a_rename_at_17),16 + (__t_rename_at_16 * 37));
+			{
+				bool __need_loop_19 = true;
+				// i : int const
+				das_iterator<range> __i_iterator(range(0,builtin_array_size(das_arg<TArray<float4>>::pass(__a_rename_at_17))));
+				int32_t __i_rename_at_19;
+				__need_loop_19 = __i_iterator.first(__context__,(__i_rename_at_19)) && __need_loop_19;
+				for ( ; __need_loop_19 ; __need_loop_19 = __i_iterator.next(__context__,(__i_rename_at_19)) )
+				{
+					das_copy(__a_rename_at_17(__i_rename_at_19,__context__),v_splats(float(__i_rename_at_19)));
+				}
+				__i_iterator.close(__context__,(__i_rename_at_19));
+			};
+			{
+				bool __need_loop_21 = true;
+				// i : int const
+				das_iterator<range> __i_iterator(range(0,builtin_array_size(das_arg<TArray<float4>>::pass(__a_rename_at_17))));
+				int32_t __i_rename_at_21;
+				__need_loop_21 = __i_iterator.first(__context__,(__i_rename_at_21)) && __need_loop_21;
+				for ( ; __need_loop_21 ; __need_loop_21 = __i_iterator.next(__context__,(__i_rename_at_21)) )
+				{
+					DAS_ASSERT((v_extract_x(__a_rename_at_17(__i_rename_at_21,__context__)) /*x*/ == float(__i_rename_at_21)));
+				}
+				__i_iterator.close(__context__,(__i_rename_at_21));
+			};
+			_Funcbuiltin_0x60_finalize_cd1514d2d7718b99(__context__,das_arg<TArray<float4>>::pass(__a_rename_at_17));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_16));
+	};
+	uint64_t __w1_rename_at_24 = (uint64_t)heap_bytes_allocated(__context__);
+	DAS_ASSERT((__w0_rename_at_15 == __w1_rename_at_24));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_cd1514d2d7718b99
+		aotLib[0xcaeab429993cce4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> &  ),&_Funcbuiltin_0x60_finalize_cd1514d2d7718b99>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_resize_761fb73a377a5e66
+		aotLib[0xc267e309ce3735b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , int32_t  ),&_Funcbuiltin_0x60_resize_761fb73a377a5e66>>();
+	};
+		// test_4ae18cb308edb570
+		aotLib[0x7b98f4f9f8a854c3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_4ae18cb308edb570>>();
+	};
+		// test_grow_25bc066bf08e84f6
+		aotLib[0x7afdfbe6776f6d4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&test_grow_25bc066bf08e84f6>>();
+	};
+		// test_reuse_3d62d86cc39a0574
+		aotLib[0x26a4e08853c0e61c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_reuse_3d62d86cc39a0574>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,254 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__613628aa;
+extern StructInfo __struct_info__b1589007;
+extern TypeInfo __type_info__94181030;
+extern TypeInfo __type_info__d445a339;
+extern TypeInfo __type_info__758b1d3f;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__199df2db;
+extern TypeInfo __type_info__c7e1677;
+extern TypeInfo __type_info__a6c45d85;
+extern VarInfo __var_info__f19db34d;
+extern VarInfo __var_info__64a354d7;
+extern VarInfo __var_info__b3d425c2;
+extern VarInfo __var_info__ff30b424;
+extern VarInfo __var_info__7af97d9c;
+extern VarInfo __var_info__3009abdf;
+extern VarInfo __var_info__620803fe;
+extern VarInfo __var_info__35e912f2;
+extern FuncInfo __func_info__63f35a93;
+
+VarInfo __struct_info__613628aa_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x620803fe, "t", 0 };
+VarInfo __struct_info__613628aa_field_1 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__a6c45d85, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf19db34d, "ta", 8 };
+VarInfo * __struct_info__613628aa_fields[2] =  { &__struct_info__613628aa_field_0, &__struct_info__613628aa_field_1 };
+StructInfo __struct_info__613628aa = {"Bar", __struct_info__613628aa_fields, 2, 32, 0, nullptr, 0x613628aa };
+VarInfo __struct_info__b1589007_field_0 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xb3d425c2, "data_bool", 0 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x3009abdf, "data_int", 4 };
+VarInfo __struct_info__b1589007_field_2 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xff30b424, "data_float", 8 };
+VarInfo __struct_info__b1589007_field_3 =  { Type::tStructure, &__struct_info__613628aa, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x64a354d7, "data_bar", 16 };
+uint32_t __type_info__7af97d9c_dim_var_2975371271[1] = { 3 };
+VarInfo __struct_info__b1589007_field_4 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__7af97d9c_dim_var_2975371271, 2078, 0x7af97d9c, "data_uint_3", 48 };
+VarInfo * __struct_info__b1589007_fields[5] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1, &__struct_info__b1589007_field_2, &__struct_info__b1589007_field_3, &__struct_info__b1589007_field_4 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 5, 64, 1, nullptr, 0xb1589007 };
+VarInfo __func_info__63f35a93_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x35e912f2, "data", 0 };
+VarInfo * __func_info__63f35a93_fields[1] =  { &__func_info__63f35a93_field_0 };
+FuncInfo __func_info__63f35a93 = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__63f35a93_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x63f35a93, 0x0 };
+TypeInfo __type_info__94181030 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x94181030 };
+TypeInfo * __type_info__d445a339_arg_types[1] = { &__type_info__94181030 };
+TypeInfo __type_info__d445a339 = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d445a339_arg_types, nullptr, 1, 0, nullptr, 34, 0xd445a339 };
+TypeInfo __type_info__758b1d3f = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x758b1d3f };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__199df2db = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x199df2db };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc7e1677 };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__c7e1677, &__type_info__94181030 };
+TypeInfo * __tinfo_1[2] = { &__type_info__758b1d3f, &__type_info__d445a339 };
+namespace  {
+
+struct Bar {
+	char * t;
+	TArray<float> ta;
+};
+static_assert(sizeof(Bar)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,t)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,ta)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+	bool data_bool;
+	int32_t data_int;
+	float data_float;
+	struct Bar data_bar;
+	TDim<uint32_t,3> data_uint_3;
+};
+static_assert(sizeof(Foo)==64,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,data_bool)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_int)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_float)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_bar)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_uint_3)==48,"structure field offset mismatch with DAS");
+}
+
+inline struct Bar Bar_bc00cf90c377160d ( Context * __context__ );
+inline struct Foo Foo_bfae825a65134333 ( Context * __context__ );
+inline void _Funcbuiltin_0x60_binary_load_43040880b26c4465 ( Context * __context__, struct Foo & __obj_rename_at_216, TArray<uint8_t> const  & __data_rename_at_216 );
+inline void _Funcbuiltin_0x60_binary_save_df945637b1078ab2 ( Context * __context__, struct Foo const  & __obj_rename_at_212, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_212 );
+inline void _Funcbuiltin_0x60_push_8a9191e5eb1aa83e ( Context * __context__, TArray<float> & __Arr_rename_at_40, float __value_rename_at_40, int32_t __at_rename_at_40 );
+inline TArray<float> make_10_6f19bc476ee65700 ( Context * __context__ );
+inline bool test_923ed469d0ec915b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline struct Bar Bar_bc00cf90c377160d ( Context * __context__ )
+{
+	return /* <- */ (([&]() -> struct Bar {
+		struct Bar __mks_9;
+		das_copy((__mks_9.t),(((char *) "blah")));
+		das_move((__mks_9.ta),(make_10_6f19bc476ee65700(__context__)));
+		return __mks_9;
+	})());
+}
+
+inline struct Foo Foo_bfae825a65134333 ( Context * __context__ )
+{
+	return /* <- */ (([&]() -> struct Foo {
+		struct Foo __mks_13;
+		das_copy((__mks_13.data_bool),(true));
+		das_copy((__mks_13.data_int),(1));
+		das_copy((__mks_13.data_float),(3.14f));
+		das_move((__mks_13.data_bar),(Bar_bc00cf90c377160d(__context__)));
+		das_copy((__mks_13.data_uint_3),((([&]() -> TDim<uint32_t,3> {
+			TDim<uint32_t,3> __mka_18;
+			__mka_18(0,__context__) = 0x1u;
+			__mka_18(1,__context__) = 0x2u;
+			__mka_18(2,__context__) = 0x3u;
+			return __mka_18;
+		})())));
+		return __mks_13;
+	})());
+}
+
+inline void _Funcbuiltin_0x60_binary_load_43040880b26c4465 ( Context * __context__, struct Foo &  __obj_rename_at_216, TArray<uint8_t> const  &  __data_rename_at_216 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<struct Foo &>::from(__obj_rename_at_216),cast<TArray<uint8_t> const  &>::from(__data_rename_at_216)));
+}
+
+inline void _Funcbuiltin_0x60_binary_save_df945637b1078ab2 ( Context * __context__, struct Foo const  &  __obj_rename_at_212, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_212 )
+{
+	das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<struct Foo const  &>::from(__obj_rename_at_212),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_212)));
+}
+
+inline void _Funcbuiltin_0x60_push_8a9191e5eb1aa83e ( Context * __context__, TArray<float> &  __Arr_rename_at_40, float __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<float>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline TArray<float> make_10_6f19bc476ee65700 ( Context * __context__ )
+{
+	TArray<float> __a_rename_at_4; das_zero(__a_rename_at_4);
+	{
+		bool __need_loop_5 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_5;
+		__need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5)) )
+		{
+			_Funcbuiltin_0x60_push_8a9191e5eb1aa83e(__context__,das_arg<TArray<float>>::pass(__a_rename_at_4),float(__i_rename_at_5),-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_5));
+	};
+	return /* <- */ __a_rename_at_4;
+}
+
+inline bool test_923ed469d0ec915b ( Context * __context__ ) { das_stack_prologue __prologue(__context__,240,"test " DAS_FILE_LINE);
+{
+	struct Foo __f0_rename_at_22; das_zero(__f0_rename_at_22); das_move(__f0_rename_at_22, (struct Foo)Foo_bfae825a65134333(__context__));
+	struct Foo __f1_rename_at_23; das_zero(__f1_rename_at_23);
+	_Funcbuiltin_0x60_binary_save_df945637b1078ab2(__context__,__f0_rename_at_22,das_make_block<void,TArray<uint8_t> const  &>(__context__,208,0,&__func_info__63f35a93,[&](TArray<uint8_t> const  & __data_rename_at_24)->void{
+		_Funcbuiltin_0x60_binary_load_43040880b26c4465(__context__,das_arg<struct Foo>::pass(__f1_rename_at_23),__data_rename_at_24);
+		DAS_ASSERT((__f1_rename_at_23.data_bool == true));
+		DAS_ASSERT((__f1_rename_at_23.data_int == 1));
+		DAS_ASSERT((__f1_rename_at_23.data_float == 3.14f));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__f1_rename_at_23.data_bar.t),cast<char *>::from(((char *) "blah")),*__context__)));
+		DAS_ASSERT((((__f1_rename_at_23.data_uint_3(0,__context__) == 0x1u) && (__f1_rename_at_23.data_uint_3(1,__context__) == 0x2u)) && (__f1_rename_at_23.data_uint_3(2,__context__) == 0x3u)));
+		{
+			bool __need_loop_31 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,10));
+			int32_t __i_rename_at_31;
+			__need_loop_31 = __i_iterator.first(__context__,(__i_rename_at_31)) && __need_loop_31;
+			for ( ; __need_loop_31 ; __need_loop_31 = __i_iterator.next(__context__,(__i_rename_at_31)) )
+			{
+				DAS_ASSERT((__f1_rename_at_23.data_bar.ta(__i_rename_at_31,__context__) == float(__i_rename_at_31)));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_31));
+		};
+	}));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Bar_bc00cf90c377160d
+		aotLib[0xb5020d0d4b2a7933] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Bar (*) ( Context * __context__ ),&Bar_bc00cf90c377160d>>();
+	};
+		// Foo_bfae825a65134333
+		aotLib[0x6006d6764a474aef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__ ),&Foo_bfae825a65134333>>();
+	};
+		// _Funcbuiltin_0x60_binary_load_43040880b26c4465
+		aotLib[0x6bdd023c49b23d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_43040880b26c4465>>();
+	};
+		// _Funcbuiltin_0x60_binary_save_df945637b1078ab2
+		aotLib[0xd0fc38c10c0acad5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo const  & , Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  ),&_Funcbuiltin_0x60_binary_save_df945637b1078ab2>>();
+	};
+		// _Funcbuiltin_0x60_push_8a9191e5eb1aa83e
+		aotLib[0xc0f5dc1255d7c9dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float , int32_t  ),&_Funcbuiltin_0x60_push_8a9191e5eb1aa83e>>();
+	};
+		// make_10_6f19bc476ee65700
+		aotLib[0x5ddacd693ae06669] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__ ),&make_10_6f19bc476ee65700>>();
+	};
+		// test_923ed469d0ec915b
+		aotLib[0x25eb29890ff06670] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_923ed469d0ec915b>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,273 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__ce841872;
+extern VarInfo __var_info__5de75773;
+extern VarInfo __var_info__e9de14c7;
+extern VarInfo __var_info__7e9792f0;
+extern FuncInfo __func_info__b8f8733;
+extern FuncInfo __func_info__da95b5be;
+extern FuncInfo __func_info__b478a3fa;
+extern FuncInfo __func_info__d87eeb54;
+extern FuncInfo __func_info__6741f196;
+extern FuncInfo __func_info__2c47cca3;
+
+VarInfo __func_info__b8f8733_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xe9de14c7, "a2", 0 };
+VarInfo * __func_info__b8f8733_fields[1] =  { &__func_info__b8f8733_field_0 };
+FuncInfo __func_info__b8f8733 = {"invoke block<(a2:int const):int> const", "", __func_info__b8f8733_fields, 1, 32, &__type_info__95e97e5e, nullptr,0,0xb8f8733, 0x0 };
+FuncInfo __func_info__da95b5be = {"invoke block<int> const", "", nullptr, 0, 32, &__type_info__95e97e5e, nullptr,0,0xda95b5be, 0x0 };
+VarInfo __func_info__b478a3fa_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0x5de75773, "a", 0 };
+VarInfo * __func_info__b478a3fa_fields[1] =  { &__func_info__b478a3fa_field_0 };
+FuncInfo __func_info__b478a3fa = {"invoke block<(a:int& -const):int> const", "", __func_info__b478a3fa_fields, 1, 32, &__type_info__95e97e5e, nullptr,0,0xb478a3fa, 0x0 };
+VarInfo __func_info__d87eeb54_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x7e9792f0, "a3", 0 };
+VarInfo * __func_info__d87eeb54_fields[1] =  { &__func_info__d87eeb54_field_0 };
+FuncInfo __func_info__d87eeb54 = {"invoke block<(a3:int const):int> const", "", __func_info__d87eeb54_fields, 1, 32, &__type_info__95e97e5e, nullptr,0,0xd87eeb54, 0x0 };
+VarInfo __func_info__6741f196_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xce841872, "a1", 0 };
+VarInfo * __func_info__6741f196_fields[1] =  { &__func_info__6741f196_field_0 };
+FuncInfo __func_info__6741f196 = {"invoke block<(a1:int const):int> const", "", __func_info__6741f196_fields, 1, 32, &__type_info__95e97e5e, nullptr,0,0x6741f196, 0x0 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline int32_t badd_2561f855b652e9f ( Context * __context__, int32_t __ext_rename_at_40, Block DAS_COMMENT((int32_t,int32_t)) const  & __b_rename_at_40 );
+inline void crapOnStack_5189aebe3142b6e6 ( Context * __context__ );
+inline void func1_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  & __b_rename_at_20 );
+inline void func2_1534669a42a55171 ( Context * __context__, Block DAS_COMMENT((void)) const  & __b_rename_at_25 );
+inline void func3_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  & __b_rename_at_30 );
+inline void func4_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  & __b_rename_at_35 );
+inline int32_t radd_f99307a4cdee40a7 ( Context * __context__, int32_t & __ext_rename_at_43, Block DAS_COMMENT((int32_t,int32_t &)) const  & __b_rename_at_43 );
+inline bool test_eff61c7c1f34948e ( Context * __context__ );
+inline void twice_8e54f11b4ead5bbf ( Context * __context__, Block DAS_COMMENT((void)) const  & __b_rename_at_4 );
+inline int32_t twice_good_758bc91ae5dea48f ( Context * __context__, Block DAS_COMMENT((int32_t)) const  & __b_rename_at_8 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t badd_2561f855b652e9f ( Context * __context__, int32_t __ext_rename_at_40, Block DAS_COMMENT((int32_t,int32_t)) const  &  __b_rename_at_40 )
+{
+	return das_invoke<int32_t>::invoke<int32_t>(__context__,__b_rename_at_40,__ext_rename_at_40);
+}
+
+inline void crapOnStack_5189aebe3142b6e6 ( Context * __context__ )
+{
+	TDim<int32_t,20> __a_rename_at_16; das_zero(__a_rename_at_16);
+	{
+		bool __need_loop_17 = true;
+		// b : int& -const
+		das_iterator<TDim<int32_t,20>> __b_iterator(__a_rename_at_16);
+		int32_t * __b_rename_at_17;
+		__need_loop_17 = __b_iterator.first(__context__,(__b_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __b_iterator.next(__context__,(__b_rename_at_17)) )
+		{
+			das_copy((*__b_rename_at_17),13);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_17));
+	};
+}
+
+inline void func1_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  &  __b_rename_at_20 )
+{
+	crapOnStack_5189aebe3142b6e6(__context__);
+	das_invoke<void>::invoke(__context__,__b_rename_at_20);
+	crapOnStack_5189aebe3142b6e6(__context__);
+}
+
+inline void func2_1534669a42a55171 ( Context * __context__, Block DAS_COMMENT((void)) const  &  __b_rename_at_25 )
+{
+	crapOnStack_5189aebe3142b6e6(__context__);
+	func3_b01e3c7942154c1e(__context__,__b_rename_at_25);
+	crapOnStack_5189aebe3142b6e6(__context__);
+}
+
+inline void func3_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  &  __b_rename_at_30 )
+{
+	crapOnStack_5189aebe3142b6e6(__context__);
+	das_invoke<void>::invoke(__context__,__b_rename_at_30);
+	crapOnStack_5189aebe3142b6e6(__context__);
+}
+
+inline void func4_b01e3c7942154c1e ( Context * __context__, Block DAS_COMMENT((void)) const  &  __b_rename_at_35 )
+{
+	crapOnStack_5189aebe3142b6e6(__context__);
+	das_invoke<void>::invoke(__context__,__b_rename_at_35);
+	crapOnStack_5189aebe3142b6e6(__context__);
+}
+
+inline int32_t radd_f99307a4cdee40a7 ( Context * __context__, int32_t & __ext_rename_at_43, Block DAS_COMMENT((int32_t,int32_t &)) const  &  __b_rename_at_43 )
+{
+	return das_invoke<int32_t>::invoke<int32_t &>(__context__,__b_rename_at_43,__ext_rename_at_43);
+}
+
+inline bool test_eff61c7c1f34948e ( Context * __context__ ) { das_stack_prologue __prologue(__context__,848,"test " DAS_FILE_LINE);
+{
+	int32_t __a_rename_at_49 = 0;
+	int32_t __b_rename_at_50 = 0;
+	twice_8e54f11b4ead5bbf(__context__,das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__a_rename_at_49++;
+	}));
+	DAS_ASSERT((__a_rename_at_49 == 2));
+	das_copy(__b_rename_at_50,twice_good_758bc91ae5dea48f(__context__,das_make_block<int32_t>(__context__,0,0,&__func_info__da95b5be,[&]()->int32_t{
+		return __a_rename_at_49++;
+	})));
+	DAS_ASSERT(((__a_rename_at_49 == 4) && (__b_rename_at_50 == 5)));
+	das_copy(__b_rename_at_50,twice_good_758bc91ae5dea48f(__context__,das_make_block<int32_t>(__context__,0,0,&__func_info__da95b5be,[&]()->int32_t{
+		return __a_rename_at_49++;
+	})));
+	DAS_ASSERT((__b_rename_at_50 == 9));
+	das_copy(__b_rename_at_50,twice_good_758bc91ae5dea48f(__context__,das_make_block<int32_t>(__context__,0,0,&__func_info__da95b5be,[&]()->int32_t{
+		return ++__a_rename_at_49;
+	})));
+	DAS_ASSERT((__a_rename_at_49 == 8));
+	DAS_ASSERT((__b_rename_at_50 == 15));
+	int32_t __x_rename_at_62 = 0;
+	int32_t __y_rename_at_63 = 0;
+	func1_b01e3c7942154c1e(__context__,das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__x_rename_at_62 += 1;
+		__y_rename_at_63 += 2;
+		func2_1534669a42a55171(__context__,das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+			__x_rename_at_62++;
+			__y_rename_at_63 += 3;
+		}));
+		func4_b01e3c7942154c1e(__context__,das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+			__x_rename_at_62++;
+			__y_rename_at_63 += 4;
+		}));
+	}));
+	DAS_ASSERT(((__x_rename_at_62 == 3) && (__y_rename_at_63 == 9)));
+	int32_t __v1_rename_at_75 = 1;
+	int32_t __res_rename_at_76 = badd_2561f855b652e9f(__context__,1000,das_make_block<int32_t,int32_t>(__context__,512,0,&__func_info__6741f196,[&](int32_t const  __a1_rename_at_76)->int32_t{
+		return __v1_rename_at_75++ + __a1_rename_at_76;
+	}));
+	DAS_ASSERT((__res_rename_at_76 == 1001));
+	das_copy(__res_rename_at_76,badd_2561f855b652e9f(__context__,1000,das_make_block<int32_t,int32_t>(__context__,576,0,&__func_info__6741f196,[&](int32_t const  __a1_rename_at_78)->int32_t{
+		return __v1_rename_at_75 + __a1_rename_at_78;
+	})));
+	DAS_ASSERT((__res_rename_at_76 == 1002));
+	das_copy(__v1_rename_at_75,3);
+	das_copy(__res_rename_at_76,badd_2561f855b652e9f(__context__,1000,das_make_block<int32_t,int32_t>(__context__,640,0,&__func_info__6741f196,[&](int32_t const  __a1_rename_at_81)->int32_t{
+		return __v1_rename_at_75 + __a1_rename_at_81;
+	})));
+	DAS_ASSERT((__res_rename_at_76 == 1003));
+	das_copy(__v1_rename_at_75,4);
+	das_copy(__res_rename_at_76,badd_2561f855b652e9f(__context__,1000,das_make_block<int32_t,int32_t>(__context__,704,0,&__func_info__b8f8733,[&](int32_t const  __a2_rename_at_85)->int32_t{
+		return badd_2561f855b652e9f(__context__,2000,das_make_block<int32_t,int32_t>(__context__,768,0,&__func_info__d87eeb54,[&](int32_t const  __a3_rename_at_86)->int32_t{
+			return (__a3_rename_at_86 + __a2_rename_at_85) + __v1_rename_at_75;
+		}));
+	})));
+	DAS_ASSERT((__res_rename_at_76 == 3004));
+	das_copy(__v1_rename_at_75,3);
+	das_copy(__res_rename_at_76,radd_f99307a4cdee40a7(__context__,__v1_rename_at_75,das_make_block<int32_t,int32_t &>(__context__,832,0,&__func_info__b478a3fa,[&](int32_t & __a_rename_at_89)->int32_t{
+		return __a_rename_at_89++;
+	})));
+	DAS_ASSERT(((__res_rename_at_76 == 3) && (__v1_rename_at_75 == 4)));
+	return true;
+}}
+
+inline void twice_8e54f11b4ead5bbf ( Context * __context__, Block DAS_COMMENT((void)) const  &  __b_rename_at_4 )
+{
+	das_invoke<void>::invoke(__context__,__b_rename_at_4);
+	das_invoke<void>::invoke(__context__,__b_rename_at_4);
+}
+
+inline int32_t twice_good_758bc91ae5dea48f ( Context * __context__, Block DAS_COMMENT((int32_t)) const  &  __b_rename_at_8 )
+{
+	int32_t __t_rename_at_9 = 0;
+	__t_rename_at_9 += das_invoke<int32_t>::invoke(__context__,__b_rename_at_8);
+	__t_rename_at_9 += das_invoke<int32_t>::invoke(__context__,__b_rename_at_8);
+	return __t_rename_at_9;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// badd_2561f855b652e9f
+		aotLib[0x974f23b94ad52b05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , Block DAS_COMMENT((int32_t,int32_t)) const  &  ),&badd_2561f855b652e9f>>();
+	};
+		// crapOnStack_5189aebe3142b6e6
+		aotLib[0x9689d65221ba26bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&crapOnStack_5189aebe3142b6e6>>();
+	};
+		// func1_b01e3c7942154c1e
+		aotLib[0x2331969039810b12] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&func1_b01e3c7942154c1e>>();
+	};
+		// func2_1534669a42a55171
+		aotLib[0xfac1eb7420967f08] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&func2_1534669a42a55171>>();
+	};
+		// func3_b01e3c7942154c1e
+		aotLib[0x2331969039810b12] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&func3_b01e3c7942154c1e>>();
+	};
+		// func4_b01e3c7942154c1e
+		aotLib[0x2331969039810b12] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&func4_b01e3c7942154c1e>>();
+	};
+		// radd_f99307a4cdee40a7
+		aotLib[0x356b436447da1f21] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t & , Block DAS_COMMENT((int32_t,int32_t &)) const  &  ),&radd_f99307a4cdee40a7>>();
+	};
+		// test_eff61c7c1f34948e
+		aotLib[0x3689497880f427a0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_eff61c7c1f34948e>>();
+	};
+		// twice_8e54f11b4ead5bbf
+		aotLib[0xde398c5380df08d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&twice_8e54f11b4ead5bbf>>();
+	};
+		// twice_good_758bc91ae5dea48f
+		aotLib[0x2179a1c4ba2aa55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Block DAS_COMMENT((int32_t)) const  &  ),&twice_good_758bc91ae5dea48f>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,162 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__cdc6fee1;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__c890eba9;
+extern TypeInfo __type_info__139142d1;
+extern VarInfo __var_info__2c1c52ca;
+extern VarInfo __var_info__efefba66;
+extern VarInfo __var_info__9cab9fb3;
+extern VarInfo __var_info__aa813edf;
+extern FuncInfo __func_info__a9593e3;
+
+TypeInfo * __type_info__2c1c52ca_arg_types_var_3452370657[2] = { &__type_info__139142d1, &__type_info__359c1b32 };
+VarInfo __struct_info__cdc6fee1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__2c1c52ca_arg_types_var_3452370657, nullptr, 2, 0, nullptr, 28, 0x2c1c52ca, "__lambda", 0 };
+TypeInfo * __type_info__aa813edf_arg_types_var_3452370657[1] = { &__type_info__c890eba9 };
+VarInfo __struct_info__cdc6fee1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aa813edf_arg_types_var_3452370657, nullptr, 1, 0, nullptr, 28, 0xaa813edf, "__finalize", 4 };
+VarInfo __struct_info__cdc6fee1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xefefba66, "CNT", 8 };
+VarInfo * __struct_info__cdc6fee1_fields[3] =  { &__struct_info__cdc6fee1_field_0, &__struct_info__cdc6fee1_field_1, &__struct_info__cdc6fee1_field_2 };
+StructInfo __struct_info__cdc6fee1 = {"_lambda_thismodule_10_8_1", __struct_info__cdc6fee1_fields, 3, 12, -1, nullptr, 0xcdc6fee1 };
+VarInfo __func_info__a9593e3_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x9cab9fb3, "extraBlock", 0 };
+VarInfo * __func_info__a9593e3_fields[1] =  { &__func_info__a9593e3_field_0 };
+FuncInfo __func_info__a9593e3 = {"invoke block<(extraBlock:int const):int> const", "", __func_info__a9593e3_fields, 1, 32, &__type_info__95e97e5e, nullptr,0,0xa9593e3, 0x0 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__c890eba9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__139142d1, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc890eba9 };
+TypeInfo __type_info__139142d1 = { Type::tStructure, &__struct_info__cdc6fee1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x139142d1 };
+
+namespace  {
+
+struct _lambda_thismodule_10_8_1 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_10_8_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_10_8_1 *)) __finalize;
+	int32_t CNT;
+};
+static_assert(sizeof(_lambda_thismodule_10_8_1)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_8_1,CNT)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_10_8_1_0x60_finazlier_a35565b9edb87a2c ( Context * __context__, struct _lambda_thismodule_10_8_1 * ____this_rename_at_10 );
+inline int32_t _Func_lambda_thismodule_10_8_1_0x60_function_e525abd1c84c8601 ( Context * __context__, struct _lambda_thismodule_10_8_1 & ____this_rename_at_10, int32_t __extra_rename_at_9 );
+inline int32_t _Func_0x60_addValue_945c1a1e14d6ff6 ( Context * __context__, int32_t __a_rename_at_3, Block DAS_COMMENT((int32_t,int32_t)) const  & __blk_rename_at_3 );
+inline void finalize_46eccf7ea71cb76b ( Context * __context__, struct _lambda_thismodule_10_8_1 & ____this_rename_at_10 );
+inline bool test_1bbcff7b01585a1a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_10_8_1_0x60_finazlier_a35565b9edb87a2c ( Context * __context__, struct _lambda_thismodule_10_8_1 * ____this_rename_at_10 )
+{
+	finalize_46eccf7ea71cb76b(__context__,das_arg<struct _lambda_thismodule_10_8_1>::pass(das_deref(__context__,____this_rename_at_10)));
+	das_delete_lambda_struct<struct _lambda_thismodule_10_8_1 *>::clear(__context__,____this_rename_at_10);
+}
+
+inline int32_t _Func_lambda_thismodule_10_8_1_0x60_function_e525abd1c84c8601 ( Context * __context__, struct _lambda_thismodule_10_8_1 &  ____this_rename_at_10, int32_t __extra_rename_at_9 ) { das_stack_prologue __prologue(__context__,112,"_lambda_thismodule_10_8_1`function " DAS_FILE_LINE);
+{
+	int32_t __e1_rename_at_10 = (int32_t)_Func_0x60_addValue_945c1a1e14d6ff6(__context__,1,das_make_block<int32_t,int32_t>(__context__,96,0,&__func_info__a9593e3,[&](int32_t const  __extraBlock_rename_at_10)->int32_t{
+		return __extraBlock_rename_at_10 + ____this_rename_at_10.CNT;
+	}));
+	return (____this_rename_at_10.CNT++) + __e1_rename_at_10;
+}}
+
+inline int32_t _Func_0x60_addValue_945c1a1e14d6ff6 ( Context * __context__, int32_t __a_rename_at_3, Block DAS_COMMENT((int32_t,int32_t)) const  &  __blk_rename_at_3 )
+{
+	return das_invoke<int32_t>::invoke<int32_t>(__context__,__blk_rename_at_3,__a_rename_at_3);
+}
+
+inline void finalize_46eccf7ea71cb76b ( Context * __context__, struct _lambda_thismodule_10_8_1 &  ____this_rename_at_10 )
+{
+	memset(&(____this_rename_at_10), 0, 12);
+}
+
+inline bool test_1bbcff7b01585a1a ( Context * __context__ )
+{
+	int32_t __CNT_rename_at_8 = 0;
+	Lambda DAS_COMMENT((int32_t,int32_t)) __counter_rename_at_9; das_zero(__counter_rename_at_9); das_move(__counter_rename_at_9, (Lambda DAS_COMMENT((int32_t,int32_t)))das_ascend<int32_t,struct _lambda_thismodule_10_8_1>::make(__context__,&__type_info__139142d1,(([&]() -> struct _lambda_thismodule_10_8_1 {
+		struct _lambda_thismodule_10_8_1 __mks_10;
+		das_copy((__mks_10.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_10_8_1`function _lambda_thismodule_10_8_1 int#const*/ 1345189448u))));
+		das_copy((__mks_10.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_10_8_1`finazlier #ptr#_lambda_thismodule_10_8_1#explicit*/ 3889430278u))));
+		das_copy((__mks_10.CNT),(__CNT_rename_at_8));
+		return __mks_10;
+	})())));
+	DAS_VERIFY((das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,__counter_rename_at_9,0) == 1));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_10_8_1_0x60_finazlier_a35565b9edb87a2c
+		aotLib[0x9d1c15f803820273] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_10_8_1 *  ),&_Func_lambda_thismodule_10_8_1_0x60_finazlier_a35565b9edb87a2c>>();
+	};
+		// _Func_lambda_thismodule_10_8_1_0x60_function_e525abd1c84c8601
+		aotLib[0x3ca3863e11e8e56c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_10_8_1 & , int32_t  ),&_Func_lambda_thismodule_10_8_1_0x60_function_e525abd1c84c8601>>();
+	};
+		// _Func_0x60_addValue_945c1a1e14d6ff6
+		aotLib[0x7aa0ae3d441c1911] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , Block DAS_COMMENT((int32_t,int32_t)) const  &  ),&_Func_0x60_addValue_945c1a1e14d6ff6>>();
+	};
+		// finalize_46eccf7ea71cb76b
+		aotLib[0xf30df74093c583a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_10_8_1 &  ),&finalize_46eccf7ea71cb76b>>();
+	};
+		// test_1bbcff7b01585a1a
+		aotLib[0xbabc6a3c17147090] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_1bbcff7b01585a1a>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
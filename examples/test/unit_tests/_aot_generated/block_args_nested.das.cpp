@@ -0,0 +1,239 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__e7e9c971;
+extern VarInfo __var_info__47853825;
+extern VarInfo __var_info__9a0fd5bc;
+extern VarInfo __var_info__b8a999d5;
+extern VarInfo __var_info__ae670a69;
+extern VarInfo __var_info__46700c5f;
+extern VarInfo __var_info__e4dd1c69;
+extern VarInfo __var_info__644a27a8;
+extern VarInfo __var_info__a80d2396;
+extern VarInfo __var_info__c27f0c37;
+extern VarInfo __var_info__14345350;
+extern VarInfo __var_info__bb39699a;
+extern VarInfo __var_info__8d1dfdb7;
+extern FuncInfo __func_info__be42162a;
+extern FuncInfo __func_info__fcd345f2;
+extern FuncInfo __func_info__18524cbc;
+extern FuncInfo __func_info__31e37f84;
+extern FuncInfo __func_info__bcb34709;
+extern FuncInfo __func_info__a4852add;
+extern FuncInfo __func_info__3eceb46d;
+extern FuncInfo __func_info__fdd2cec0;
+extern FuncInfo __func_info__d8724787;
+extern FuncInfo __func_info__1129c550;
+extern FuncInfo __func_info__3648a9f3;
+extern FuncInfo __func_info__c4b1198e;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe4dd1c69, "v", 0 };
+VarInfo * __struct_info__b1589007_fields[1] =  { &__struct_info__b1589007_field_0 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 1, 4, -1, nullptr, 0xb1589007 };
+VarInfo __func_info__be42162a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2365, 0xae670a69, "c", 0 };
+VarInfo * __func_info__be42162a_fields[1] =  { &__func_info__be42162a_field_0 };
+FuncInfo __func_info__be42162a = {"invoke block<(c:int const&):void> const", "", __func_info__be42162a_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xbe42162a, 0x0 };
+VarInfo __func_info__fcd345f2_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0xbb39699a, "c", 0 };
+VarInfo * __func_info__fcd345f2_fields[1] =  { &__func_info__fcd345f2_field_0 };
+FuncInfo __func_info__fcd345f2 = {"invoke block<(c:Foo const):void> const", "", __func_info__fcd345f2_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xfcd345f2, 0x0 };
+VarInfo __func_info__18524cbc_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2365, 0xc27f0c37, "a", 0 };
+VarInfo * __func_info__18524cbc_fields[1] =  { &__func_info__18524cbc_field_0 };
+FuncInfo __func_info__18524cbc = {"invoke block<(a:int const&):void> const", "", __func_info__18524cbc_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x18524cbc, 0x0 };
+VarInfo __func_info__31e37f84_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x14345350, "b", 0 };
+VarInfo * __func_info__31e37f84_fields[1] =  { &__func_info__31e37f84_field_0 };
+FuncInfo __func_info__31e37f84 = {"invoke block<(b:int? const):void> const", "", __func_info__31e37f84_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x31e37f84, 0x0 };
+VarInfo __func_info__bcb34709_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x47853825, "c", 0 };
+VarInfo * __func_info__bcb34709_fields[1] =  { &__func_info__bcb34709_field_0 };
+FuncInfo __func_info__bcb34709 = {"invoke block<(c:int? const):void> const", "", __func_info__bcb34709_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xbcb34709, 0x0 };
+VarInfo __func_info__a4852add_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2365, 0xa80d2396, "b", 0 };
+VarInfo * __func_info__a4852add_fields[1] =  { &__func_info__a4852add_field_0 };
+FuncInfo __func_info__a4852add = {"invoke block<(b:int const&):void> const", "", __func_info__a4852add_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xa4852add, 0x0 };
+VarInfo __func_info__3eceb46d_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x644a27a8, "b", 0 };
+VarInfo * __func_info__3eceb46d_fields[1] =  { &__func_info__3eceb46d_field_0 };
+FuncInfo __func_info__3eceb46d = {"invoke block<(b:int const):void> const", "", __func_info__3eceb46d_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x3eceb46d, 0x0 };
+VarInfo __func_info__fdd2cec0_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x46700c5f, "c", 0 };
+VarInfo * __func_info__fdd2cec0_fields[1] =  { &__func_info__fdd2cec0_field_0 };
+FuncInfo __func_info__fdd2cec0 = {"invoke block<(c:int const):void> const", "", __func_info__fdd2cec0_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xfdd2cec0, 0x0 };
+VarInfo __func_info__d8724787_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x8d1dfdb7, "a", 0 };
+VarInfo * __func_info__d8724787_fields[1] =  { &__func_info__d8724787_field_0 };
+FuncInfo __func_info__d8724787 = {"invoke block<(a:int? const):void> const", "", __func_info__d8724787_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xd8724787, 0x0 };
+VarInfo __func_info__1129c550_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x9a0fd5bc, "a", 0 };
+VarInfo * __func_info__1129c550_fields[1] =  { &__func_info__1129c550_field_0 };
+FuncInfo __func_info__1129c550 = {"invoke block<(a:Foo const):void> const", "", __func_info__1129c550_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x1129c550, 0x0 };
+VarInfo __func_info__3648a9f3_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0xb8a999d5, "b", 0 };
+VarInfo * __func_info__3648a9f3_fields[1] =  { &__func_info__3648a9f3_field_0 };
+FuncInfo __func_info__3648a9f3 = {"invoke block<(b:Foo const):void> const", "", __func_info__3648a9f3_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x3648a9f3, 0x0 };
+VarInfo __func_info__c4b1198e_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xe7e9c971, "a", 0 };
+VarInfo * __func_info__c4b1198e_fields[1] =  { &__func_info__c4b1198e_field_0 };
+FuncInfo __func_info__c4b1198e = {"invoke block<(a:int const):void> const", "", __func_info__c4b1198e_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xc4b1198e, 0x0 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+namespace  {
+
+struct Foo {
+	int32_t v;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,v)==0,"structure field offset mismatch with DAS");
+}
+
+inline void passthrough_2b483dc4984ff341 ( Context * __context__, int32_t __a_rename_at_1, Block DAS_COMMENT((void,int32_t)) const  & __blk_rename_at_1 );
+inline void passthroughFoo_857ec50884293c9d ( Context * __context__, struct Foo const  & __a_rename_at_13, Block DAS_COMMENT((void,struct Foo const )) const  & __blk_rename_at_13 );
+inline void passthroughptr_6af8e096cf860265 ( Context * __context__, int32_t * const  __a_rename_at_7, Block DAS_COMMENT((void,int32_t * const )) const  & __blk_rename_at_7 );
+inline void passthroughref_6c13e02c413b8e0b ( Context * __context__, int32_t const  & __a_rename_at_4, Block DAS_COMMENT((void,int32_t const  &)) const  & __blk_rename_at_4 );
+inline bool test_8adcd6ee33e78cfd ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void passthrough_2b483dc4984ff341 ( Context * __context__, int32_t __a_rename_at_1, Block DAS_COMMENT((void,int32_t)) const  &  __blk_rename_at_1 )
+{
+	das_invoke<void>::invoke<int32_t>(__context__,__blk_rename_at_1,__a_rename_at_1);
+}
+
+inline void passthroughFoo_857ec50884293c9d ( Context * __context__, struct Foo const  &  __a_rename_at_13, Block DAS_COMMENT((void,struct Foo const )) const  &  __blk_rename_at_13 )
+{
+	das_invoke<void>::invoke<struct Foo const  &>(__context__,__blk_rename_at_13,__a_rename_at_13);
+}
+
+inline void passthroughptr_6af8e096cf860265 ( Context * __context__, int32_t * const  __a_rename_at_7, Block DAS_COMMENT((void,int32_t * const )) const  &  __blk_rename_at_7 )
+{
+	das_invoke<void>::invoke<int32_t * const >(__context__,__blk_rename_at_7,__a_rename_at_7);
+}
+
+inline void passthroughref_6c13e02c413b8e0b ( Context * __context__, int32_t const  & __a_rename_at_4, Block DAS_COMMENT((void,int32_t const  &)) const  &  __blk_rename_at_4 )
+{
+	das_invoke<void>::invoke<int32_t const  &>(__context__,__blk_rename_at_4,__a_rename_at_4);
+}
+
+inline bool test_8adcd6ee33e78cfd ( Context * __context__ ) { das_stack_prologue __prologue(__context__,896,"test " DAS_FILE_LINE);
+{
+	struct Foo _temp_make_local_43_656;
+	passthrough_2b483dc4984ff341(__context__,1,das_make_block<void,int32_t>(__context__,80,0,&__func_info__c4b1198e,[&](int32_t const  __a_rename_at_18)->void{
+		DAS_ASSERT((__a_rename_at_18 == 1));
+		passthrough_2b483dc4984ff341(__context__,2,das_make_block<void,int32_t>(__context__,144,0,&__func_info__3eceb46d,[&](int32_t const  __b_rename_at_20)->void{
+			DAS_ASSERT(((__a_rename_at_18 == 1) && (__b_rename_at_20 == 2)));
+			passthrough_2b483dc4984ff341(__context__,3,das_make_block<void,int32_t>(__context__,208,0,&__func_info__fdd2cec0,[&](int32_t const  __c_rename_at_22)->void{
+				DAS_ASSERT((((__a_rename_at_18 == 1) && (__b_rename_at_20 == 2)) && (__c_rename_at_22 == 3)));
+			}));
+		}));
+	}));
+	int32_t __A_rename_at_25 = 1;
+	int32_t __B_rename_at_26 = 2;
+	int32_t __C_rename_at_27 = 3;
+	passthroughref_6c13e02c413b8e0b(__context__,__A_rename_at_25,das_make_block<void,int32_t const  &>(__context__,320,0,&__func_info__18524cbc,[&](int32_t const  & __a_rename_at_28)->void{
+		DAS_ASSERT((__a_rename_at_28 == 1));
+		passthroughref_6c13e02c413b8e0b(__context__,__B_rename_at_26,das_make_block<void,int32_t const  &>(__context__,384,0,&__func_info__a4852add,[&](int32_t const  & __b_rename_at_30)->void{
+			DAS_ASSERT(((__a_rename_at_28 == 1) && (__b_rename_at_30 == 2)));
+			passthroughref_6c13e02c413b8e0b(__context__,__C_rename_at_27,das_make_block<void,int32_t const  &>(__context__,448,0,&__func_info__be42162a,[&](int32_t const  & __c_rename_at_32)->void{
+				DAS_ASSERT((((__a_rename_at_28 == 1) && (__b_rename_at_30 == 2)) && (__c_rename_at_32 == 3)));
+			}));
+		}));
+	}));
+	passthroughptr_6af8e096cf860265(__context__,das_ref(__context__,__A_rename_at_25),das_make_block<void,int32_t * const >(__context__,512,0,&__func_info__d8724787,[&](int32_t * const  __a_rename_at_36)->void{
+		DAS_ASSERT((das_deref(__context__,__a_rename_at_36) == 1));
+		passthroughptr_6af8e096cf860265(__context__,das_ref(__context__,__B_rename_at_26),das_make_block<void,int32_t * const >(__context__,576,0,&__func_info__31e37f84,[&](int32_t * const  __b_rename_at_38)->void{
+			DAS_ASSERT(((das_deref(__context__,__a_rename_at_36) == 1) && (das_deref(__context__,__b_rename_at_38) == 2)));
+			passthroughptr_6af8e096cf860265(__context__,das_ref(__context__,__C_rename_at_27),das_make_block<void,int32_t * const >(__context__,640,0,&__func_info__bcb34709,[&](int32_t * const  __c_rename_at_40)->void{
+				DAS_ASSERT((((das_deref(__context__,__a_rename_at_36) == 1) && (das_deref(__context__,__b_rename_at_38) == 2)) && (das_deref(__context__,__c_rename_at_40) == 3)));
+			}));
+		}));
+	}));
+	passthroughFoo_857ec50884293c9d(__context__,das_arg<struct Foo>::pass((([&]() -> struct Foo& {
+		das_copy((_temp_make_local_43_656.v),(1));
+		return _temp_make_local_43_656;
+	})())),das_make_block<void,struct Foo const  &>(__context__,720,0,&__func_info__1129c550,[&](struct Foo const  & __a_rename_at_43)->void{
+		struct Foo _temp_make_local_45_736;
+		DAS_ASSERT((__a_rename_at_43.v == 1));
+		passthroughFoo_857ec50884293c9d(__context__,das_arg<struct Foo>::pass((([&]() -> struct Foo& {
+			das_copy((_temp_make_local_45_736.v),(2));
+			return _temp_make_local_45_736;
+		})())),das_make_block<void,struct Foo const  &>(__context__,800,0,&__func_info__3648a9f3,[&](struct Foo const  & __b_rename_at_45)->void{
+			struct Foo _temp_make_local_47_816;
+			DAS_ASSERT(((__a_rename_at_43.v == 1) && (__b_rename_at_45.v == 2)));
+			passthroughFoo_857ec50884293c9d(__context__,das_arg<struct Foo>::pass((([&]() -> struct Foo& {
+				das_copy((_temp_make_local_47_816.v),(3));
+				return _temp_make_local_47_816;
+			})())),das_make_block<void,struct Foo const  &>(__context__,880,0,&__func_info__fcd345f2,[&](struct Foo const  & __c_rename_at_47)->void{
+				DAS_ASSERT((((__a_rename_at_43.v == 1) && (__b_rename_at_45.v == 2)) && (__c_rename_at_47.v == 3)));
+			}));
+		}));
+	}));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// passthrough_2b483dc4984ff341
+		aotLib[0x6fe0d841d0d71739] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Block DAS_COMMENT((void,int32_t)) const  &  ),&passthrough_2b483dc4984ff341>>();
+	};
+		// passthroughFoo_857ec50884293c9d
+		aotLib[0x705ed0553a517e95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo const  & , Block DAS_COMMENT((void,struct Foo const )) const  &  ),&passthroughFoo_857ec50884293c9d>>();
+	};
+		// passthroughptr_6af8e096cf860265
+		aotLib[0xfc1fa0a4ddae434d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t * const  , Block DAS_COMMENT((void,int32_t * const )) const  &  ),&passthroughptr_6af8e096cf860265>>();
+	};
+		// passthroughref_6c13e02c413b8e0b
+		aotLib[0xd3946cd003dd8c51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t const  & , Block DAS_COMMENT((void,int32_t const  &)) const  &  ),&passthroughref_6c13e02c413b8e0b>>();
+	};
+		// test_8adcd6ee33e78cfd
+		aotLib[0xd4afa9e128a6f4c0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_8adcd6ee33e78cfd>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
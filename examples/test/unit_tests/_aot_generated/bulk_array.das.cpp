@@ -0,0 +1,982 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__95e97e5e;
+
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+
+TypeInfo * __tinfo_0[10] = { &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__95e97e5e, &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__95e97e5e };
+TypeInfo * __tinfo_1[6] = { &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__95e97e5e };
+namespace  {
+
+struct Foo {
+	int32_t a;
+	float b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_copy_slice_cf66f093939e81d5 ( Context * __context__, TArray<int32_t> & __dst_rename_at_85, int32_t __dst_index_rename_at_85, TArray<int32_t> const  & __src_rename_at_85, int32_t __src_index_rename_at_85, int32_t __count_rename_at_85 );
+inline void _Funcbuiltin_0x60_copy_slice_92878ad28c3bccca ( Context * __context__, TArray<char *> & __dst_rename_at_85, int32_t __dst_index_rename_at_85, TArray<char *> const  & __src_rename_at_85, int32_t __src_index_rename_at_85, int32_t __count_rename_at_85 );
+inline int32_t _Funcbuiltin_0x60_count_value_4b682176366b2eeb ( Context * __context__, TArray<float> const  & __arr_rename_at_648, float __key_rename_at_648 );
+inline int32_t _Funcbuiltin_0x60_count_value_281143fd4ae5694d ( Context * __context__, TArray<float3> const  & __arr_rename_at_648, float3 __key_rename_at_648 );
+inline int32_t _Funcbuiltin_0x60_count_value_e233843efbedadad ( Context * __context__, TArray<int32_t> const  & __arr_rename_at_648, int32_t __key_rename_at_648 );
+inline int32_t _Funcbuiltin_0x60_count_value_7040f4d3ddd436f6 ( Context * __context__, TArray<char *> const  & __arr_rename_at_648, char * const  __key_rename_at_648 );
+inline int32_t _Funcbuiltin_0x60_count_value_a59e9f175834b8c4 ( Context * __context__, TDim<int32_t,5> const  & __arr_rename_at_658, int32_t __key_rename_at_658 );
+inline bool _Funcbuiltin_0x60_equal_8c45ac6253c3045d ( Context * __context__, TArray<int32_t> const  & __a_rename_at_666, TArray<int32_t> const  & __b_rename_at_666 );
+inline void _Funcbuiltin_0x60_fill_904f8e830cd26a5a ( Context * __context__, TArray<struct Foo> & __Arr_rename_at_114, struct Foo const  & __value_rename_at_114 );
+inline void _Funcbuiltin_0x60_fill_698a7ee4883f5610 ( Context * __context__, TArray<struct Foo> & __Arr_rename_at_101, struct Foo const  & __value_rename_at_101, int32_t __from_rename_at_101, int32_t __count_rename_at_101 );
+inline void _Funcbuiltin_0x60_fill_7d0d25b173a8e8e0 ( Context * __context__, TArray<float3> & __Arr_rename_at_114, float3 __value_rename_at_114 );
+inline void _Funcbuiltin_0x60_fill_6bd6e194a6b60f1f ( Context * __context__, TArray<float3> & __Arr_rename_at_101, float3 __value_rename_at_101, int32_t __from_rename_at_101, int32_t __count_rename_at_101 );
+inline void _Funcbuiltin_0x60_fill_8e52ee0020b94f3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_114, int32_t __value_rename_at_114 );
+inline void _Funcbuiltin_0x60_fill_ae9c53ec33532eab ( Context * __context__, TArray<int32_t> & __Arr_rename_at_101, int32_t __value_rename_at_101, int32_t __from_rename_at_101, int32_t __count_rename_at_101 );
+inline void _Funcbuiltin_0x60_fill_5f71e7c581afd510 ( Context * __context__, TArray<char *> & __Arr_rename_at_114, char * const  __value_rename_at_114 );
+inline void _Funcbuiltin_0x60_fill_232c4134cc1d4265 ( Context * __context__, TArray<char *> & __Arr_rename_at_101, char * const  __value_rename_at_101, int32_t __from_rename_at_101, int32_t __count_rename_at_101 );
+inline void _Funcbuiltin_0x60_finalize_3335fd2773bd6893 ( Context * __context__, TArray<struct Foo> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_98531a3eac92cc54 ( Context * __context__, TArray<float3> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_285 );
+inline int32_t _Funcbuiltin_0x60_find_index_2d6a70285e6d577c ( Context * __context__, TArray<float> const  & __arr_rename_at_633, float __key_rename_at_633 );
+inline int32_t _Funcbuiltin_0x60_find_index_d3c475e57755edce ( Context * __context__, TArray<float3> const  & __arr_rename_at_633, float3 __key_rename_at_633 );
+inline int32_t _Funcbuiltin_0x60_find_index_6536afea02700d6e ( Context * __context__, TArray<int32_t> const  & __arr_rename_at_633, int32_t __key_rename_at_633 );
+inline int32_t _Funcbuiltin_0x60_find_index_391234c3541d2c09 ( Context * __context__, TArray<char *> const  & __arr_rename_at_633, char * const  __key_rename_at_633 );
+inline int32_t _Funcbuiltin_0x60_find_index_1d34018233623b10 ( Context * __context__, TDim<int32_t,5> const  & __arr_rename_at_642, int32_t __key_rename_at_642 );
+inline void _Funcbuiltin_0x60_pop_c64eaaff4b3d9a8c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_66 );
+inline void _Funcbuiltin_0x60_push_8a9191e5eb1aa83e ( Context * __context__, TArray<float> & __Arr_rename_at_40, float __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_a1cf41a85e2beaf2 ( Context * __context__, TArray<float3> & __Arr_rename_at_40, float3 __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_f160cc321c805a96 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_47, TArray<int32_t> const  & __varr_rename_at_47 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_90cec1a1c2c24351 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_57, TDim<int32_t,3> const  & __varr_rename_at_57 );
+inline void _Funcbuiltin_0x60_push_20c8f0745dcc7b07 ( Context * __context__, TArray<char *> & __Arr_rename_at_47, TArray<char *> const  & __varr_rename_at_47 );
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> & __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_b475faa190e1a07d ( Context * __context__, TArray<char *> & __Arr_rename_at_57, TDim<char *,2> const  & __varr_rename_at_57 );
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_df901583a0cdec70 ( Context * __context__, TArray<struct Foo> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_3e806eb2cc07d595 ( Context * __context__, TDim<char *,2> & __a_rename_at_398 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627 ( Context * __context__, TDim<char *,3> & __a_rename_at_398 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_f77c6221a73cea41 ( Context * __context__, TDim<char *,4> & __a_rename_at_398 );
+inline void finalize_28d612ce489d8dc9 ( Context * __context__, struct Foo & ____this_rename_at_3 );
+inline bool test_5fd941ccf9aa3c42 ( Context * __context__ );
+inline void test_copy_slice_1b23d815a4d4d762 ( Context * __context__ );
+inline void test_fill_1cbc6d02048015f1 ( Context * __context__ );
+inline void test_find_count_equal_97f56f69ae7c26b7 ( Context * __context__ );
+inline void test_push_f47aa598989805a7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_copy_slice_cf66f093939e81d5 ( Context * __context__, TArray<int32_t> &  __dst_rename_at_85, int32_t __dst_index_rename_at_85, TArray<int32_t> const  &  __src_rename_at_85, int32_t __src_index_rename_at_85, int32_t __count_rename_at_85 )
+{
+	builtin_array_copy_slice(das_arg<TArray<int32_t>>::pass(__dst_rename_at_85),__dst_index_rename_at_85,__src_rename_at_85,__src_index_rename_at_85,__count_rename_at_85,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_copy_slice_92878ad28c3bccca ( Context * __context__, TArray<char *> &  __dst_rename_at_85, int32_t __dst_index_rename_at_85, TArray<char *> const  &  __src_rename_at_85, int32_t __src_index_rename_at_85, int32_t __count_rename_at_85 )
+{
+	if ( ((((__count_rename_at_85 < 0) || (__dst_index_rename_at_85 < 0)) || (__src_index_rename_at_85 < 0)) || ((__dst_index_rename_at_85 + __count_rename_at_85) > builtin_array_size(das_arg<TArray<char *>>::pass(__dst_rename_at_85)))) || ((__src_index_rename_at_85 + __count_rename_at_85) > builtin_array_size(__src_rename_at_85)) )
+	{
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<10>(__tinfo_0, cast<char * const >::from(((char *) "copy_slice out of range, ")), cast<int32_t>::from(__count_rename_at_85), cast<char * const >::from(((char *) " elements from ")), cast<int32_t>::from(__src_index_rename_at_85), cast<char * const >::from(((char *) " of ")), cast<int32_t>::from(builtin_array_size(__src_rename_at_85)), cast<char * const >::from(((char *) " to ")), cast<int32_t>::from(__dst_index_rename_at_85), cast<char * const >::from(((char *) " of ")), cast<int32_t>::from(builtin_array_size(das_arg<TArray<char *>>::pass(__dst_rename_at_85))))),__context__);
+	};
+	if ( __dst_index_rename_at_85 <= __src_index_rename_at_85 )
+	{
+		{
+			bool __need_loop_92 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,__count_rename_at_85));
+			int32_t __i_rename_at_92;
+			__need_loop_92 = __i_iterator.first(__context__,(__i_rename_at_92)) && __need_loop_92;
+			for ( ; __need_loop_92 ; __need_loop_92 = __i_iterator.next(__context__,(__i_rename_at_92)) )
+			{
+				das_copy(__dst_rename_at_85((__dst_index_rename_at_85 + __i_rename_at_92),__context__),__src_rename_at_85((__src_index_rename_at_85 + __i_rename_at_92),__context__));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_92));
+		};
+	} else {
+		{
+			bool __need_loop_95 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,__count_rename_at_85));
+			int32_t __i_rename_at_95;
+			__need_loop_95 = __i_iterator.first(__context__,(__i_rename_at_95)) && __need_loop_95;
+			for ( ; __need_loop_95 ; __need_loop_95 = __i_iterator.next(__context__,(__i_rename_at_95)) )
+			{
+				das_copy(__dst_rename_at_85((((__dst_index_rename_at_85 + __count_rename_at_85) - 1) - __i_rename_at_95),__context__),__src_rename_at_85((((__src_index_rename_at_85 + __count_rename_at_85) - 1) - __i_rename_at_95),__context__));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_95));
+		};
+	};
+}
+
+inline int32_t _Funcbuiltin_0x60_count_value_4b682176366b2eeb ( Context * __context__, TArray<float> const  &  __arr_rename_at_648, float __key_rename_at_648 )
+{
+	return builtin_array_count<float>(__arr_rename_at_648,__key_rename_at_648);
+}
+
+inline int32_t _Funcbuiltin_0x60_count_value_281143fd4ae5694d ( Context * __context__, TArray<float3> const  &  __arr_rename_at_648, float3 __key_rename_at_648 )
+{
+	return builtin_array_count<float3>(__arr_rename_at_648,__key_rename_at_648);
+}
+
+inline int32_t _Funcbuiltin_0x60_count_value_e233843efbedadad ( Context * __context__, TArray<int32_t> const  &  __arr_rename_at_648, int32_t __key_rename_at_648 )
+{
+	return builtin_array_count<int32_t>(__arr_rename_at_648,__key_rename_at_648);
+}
+
+inline int32_t _Funcbuiltin_0x60_count_value_7040f4d3ddd436f6 ( Context * __context__, TArray<char *> const  &  __arr_rename_at_648, char * const  __key_rename_at_648 )
+{
+	int32_t __total_rename_at_652 = 0;
+	{
+		bool __need_loop_653 = true;
+		// x : string aka TT const&
+		das_iterator<TArray<char *> const > __x_iterator(__arr_rename_at_648);
+		char * const  * __x_rename_at_653;
+		__need_loop_653 = __x_iterator.first(__context__,(__x_rename_at_653)) && __need_loop_653;
+		for ( ; __need_loop_653 ; __need_loop_653 = __x_iterator.next(__context__,(__x_rename_at_653)) )
+		{
+			if ( SimPolicy<char *>::Equ(cast<char *>::from((*__x_rename_at_653)),cast<char *>::from(__key_rename_at_648),*__context__) )
+			{
+				__total_rename_at_652++;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_653));
+	};
+	return __total_rename_at_652;
+}
+
+inline int32_t _Funcbuiltin_0x60_count_value_a59e9f175834b8c4 ( Context * __context__, TDim<int32_t,5> const  &  __arr_rename_at_658, int32_t __key_rename_at_658 )
+{
+	int32_t __total_rename_at_659 = 0;
+	{
+		bool __need_loop_660 = true;
+		// x : int aka TT const& implicit
+		das_iterator<TDim<int32_t,5> const > __x_iterator(__arr_rename_at_658);
+		int32_t const  * __x_rename_at_660;
+		__need_loop_660 = __x_iterator.first(__context__,(__x_rename_at_660)) && __need_loop_660;
+		for ( ; __need_loop_660 ; __need_loop_660 = __x_iterator.next(__context__,(__x_rename_at_660)) )
+		{
+			if ( (*__x_rename_at_660) == __key_rename_at_658 )
+			{
+				__total_rename_at_659++;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_660));
+	};
+	return __total_rename_at_659;
+}
+
+inline bool _Funcbuiltin_0x60_equal_8c45ac6253c3045d ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_666, TArray<int32_t> const  &  __b_rename_at_666 )
+{
+	return (builtin_array_size(__a_rename_at_666) != builtin_array_size(__b_rename_at_666)) ? (false) : (((builtin_array_size(__a_rename_at_666) == 0) ? (true) : (builtin_array_equal<int32_t>(__a_rename_at_666,__b_rename_at_666))));
+}
+
+inline void _Funcbuiltin_0x60_fill_904f8e830cd26a5a ( Context * __context__, TArray<struct Foo> &  __Arr_rename_at_114, struct Foo const  &  __value_rename_at_114 )
+{
+	_Funcbuiltin_0x60_fill_698a7ee4883f5610(__context__,das_arg<TArray<struct Foo>>::pass(__Arr_rename_at_114),__value_rename_at_114,0,builtin_array_size(das_arg<TArray<struct Foo>>::pass(__Arr_rename_at_114)));
+}
+
+inline void _Funcbuiltin_0x60_fill_698a7ee4883f5610 ( Context * __context__, TArray<struct Foo> &  __Arr_rename_at_101, struct Foo const  &  __value_rename_at_101, int32_t __from_rename_at_101, int32_t __count_rename_at_101 )
+{
+	struct Foo __v_rename_at_103 = __value_rename_at_101;
+	builtin_array_fill(das_arg<TArray<struct Foo>>::pass(__Arr_rename_at_101),__from_rename_at_101,__count_rename_at_101,das_ref(__context__,__v_rename_at_103),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_fill_7d0d25b173a8e8e0 ( Context * __context__, TArray<float3> &  __Arr_rename_at_114, float3 __value_rename_at_114 )
+{
+	_Funcbuiltin_0x60_fill_6bd6e194a6b60f1f(__context__,das_arg<TArray<float3>>::pass(__Arr_rename_at_114),__value_rename_at_114,0,builtin_array_size(das_arg<TArray<float3>>::pass(__Arr_rename_at_114)));
+}
+
+inline void _Funcbuiltin_0x60_fill_6bd6e194a6b60f1f ( Context * __context__, TArray<float3> &  __Arr_rename_at_101, float3 __value_rename_at_101, int32_t __from_rename_at_101, int32_t __count_rename_at_101 )
+{
+	float3 __v_rename_at_103 = __value_rename_at_101;
+	builtin_array_fill(das_arg<TArray<float3>>::pass(__Arr_rename_at_101),__from_rename_at_101,__count_rename_at_101,das_ref(__context__,__v_rename_at_103),12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_fill_8e52ee0020b94f3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_114, int32_t __value_rename_at_114 )
+{
+	_Funcbuiltin_0x60_fill_ae9c53ec33532eab(__context__,das_arg<TArray<int32_t>>::pass(__Arr_rename_at_114),__value_rename_at_114,0,builtin_array_size(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_114)));
+}
+
+inline void _Funcbuiltin_0x60_fill_ae9c53ec33532eab ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_101, int32_t __value_rename_at_101, int32_t __from_rename_at_101, int32_t __count_rename_at_101 )
+{
+	int32_t __v_rename_at_103 = __value_rename_at_101;
+	builtin_array_fill(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_101),__from_rename_at_101,__count_rename_at_101,das_ref(__context__,__v_rename_at_103),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_fill_5f71e7c581afd510 ( Context * __context__, TArray<char *> &  __Arr_rename_at_114, char * const  __value_rename_at_114 )
+{
+	_Funcbuiltin_0x60_fill_232c4134cc1d4265(__context__,das_arg<TArray<char *>>::pass(__Arr_rename_at_114),__value_rename_at_114,0,builtin_array_size(das_arg<TArray<char *>>::pass(__Arr_rename_at_114)));
+}
+
+inline void _Funcbuiltin_0x60_fill_232c4134cc1d4265 ( Context * __context__, TArray<char *> &  __Arr_rename_at_101, char * const  __value_rename_at_101, int32_t __from_rename_at_101, int32_t __count_rename_at_101 )
+{
+	if ( ((__count_rename_at_101 < 0) || (__from_rename_at_101 < 0)) || ((__from_rename_at_101 + __count_rename_at_101) > builtin_array_size(das_arg<TArray<char *>>::pass(__Arr_rename_at_101))) )
+	{
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<6>(__tinfo_1, cast<char * const >::from(((char *) "fill out of range, ")), cast<int32_t>::from(__count_rename_at_101), cast<char * const >::from(((char *) " elements from ")), cast<int32_t>::from(__from_rename_at_101), cast<char * const >::from(((char *) " of ")), cast<int32_t>::from(builtin_array_size(das_arg<TArray<char *>>::pass(__Arr_rename_at_101))))),__context__);
+	};
+	{
+		bool __need_loop_109 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(__from_rename_at_101,__from_rename_at_101 + __count_rename_at_101));
+		int32_t __i_rename_at_109;
+		__need_loop_109 = __i_iterator.first(__context__,(__i_rename_at_109)) && __need_loop_109;
+		for ( ; __need_loop_109 ; __need_loop_109 = __i_iterator.next(__context__,(__i_rename_at_109)) )
+		{
+			das_copy(__Arr_rename_at_101(__i_rename_at_109,__context__),__value_rename_at_101);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_109));
+	};
+}
+
+inline void _Funcbuiltin_0x60_finalize_3335fd2773bd6893 ( Context * __context__, TArray<struct Foo> &  __a_rename_at_285 )
+{
+	{
+		bool __need_loop_287 = true;
+		// aV : Foo aka TT&
+		das_iterator<TArray<struct Foo>> __aV_iterator(__a_rename_at_285);
+		struct Foo * __aV_rename_at_287;
+		__need_loop_287 = __aV_iterator.first(__context__,(__aV_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __aV_iterator.next(__context__,(__aV_rename_at_287)) )
+		{
+			finalize_28d612ce489d8dc9(__context__,das_arg<struct Foo>::pass((*__aV_rename_at_287)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_287));
+	};
+	builtin_array_free(das_arg<TArray<struct Foo>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<float>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_98531a3eac92cc54 ( Context * __context__, TArray<float3> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<float3>>::pass(__a_rename_at_285),12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_find_index_2d6a70285e6d577c ( Context * __context__, TArray<float> const  &  __arr_rename_at_633, float __key_rename_at_633 )
+{
+	return builtin_array_find_index<float>(__arr_rename_at_633,__key_rename_at_633);
+}
+
+inline int32_t _Funcbuiltin_0x60_find_index_d3c475e57755edce ( Context * __context__, TArray<float3> const  &  __arr_rename_at_633, float3 __key_rename_at_633 )
+{
+	return builtin_array_find_index<float3>(__arr_rename_at_633,__key_rename_at_633);
+}
+
+inline int32_t _Funcbuiltin_0x60_find_index_6536afea02700d6e ( Context * __context__, TArray<int32_t> const  &  __arr_rename_at_633, int32_t __key_rename_at_633 )
+{
+	return builtin_array_find_index<int32_t>(__arr_rename_at_633,__key_rename_at_633);
+}
+
+inline int32_t _Funcbuiltin_0x60_find_index_391234c3541d2c09 ( Context * __context__, TArray<char *> const  &  __arr_rename_at_633, char * const  __key_rename_at_633 )
+{
+	{
+		bool __need_loop_637 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,builtin_array_size(__arr_rename_at_633)));
+		int32_t __i_rename_at_637;
+		__need_loop_637 = __i_iterator.first(__context__,(__i_rename_at_637)) && __need_loop_637;
+		for ( ; __need_loop_637 ; __need_loop_637 = __i_iterator.next(__context__,(__i_rename_at_637)) )
+		{
+			if ( SimPolicy<char *>::Equ(cast<char *>::from(__arr_rename_at_633(__i_rename_at_637,__context__)),cast<char *>::from(__key_rename_at_633),*__context__) )
+			{
+				return __i_rename_at_637;
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_637));
+	};
+	return -1;
+}
+
+inline int32_t _Funcbuiltin_0x60_find_index_1d34018233623b10 ( Context * __context__, TDim<int32_t,5> const  &  __arr_rename_at_642, int32_t __key_rename_at_642 )
+{
+	{
+		bool __need_loop_643 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,5));
+		int32_t __i_rename_at_643;
+		__need_loop_643 = __i_iterator.first(__context__,(__i_rename_at_643)) && __need_loop_643;
+		for ( ; __need_loop_643 ; __need_loop_643 = __i_iterator.next(__context__,(__i_rename_at_643)) )
+		{
+			if ( __arr_rename_at_642(__i_rename_at_643,__context__) == __key_rename_at_642 )
+			{
+				return __i_rename_at_643;
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_643));
+	};
+	return -1;
+}
+
+inline void _Funcbuiltin_0x60_pop_c64eaaff4b3d9a8c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_66 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__Arr_rename_at_66),builtin_array_size(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_66)) - 1);
+}
+
+inline void _Funcbuiltin_0x60_push_8a9191e5eb1aa83e ( Context * __context__, TArray<float> &  __Arr_rename_at_40, float __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<float>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_a1cf41a85e2beaf2 ( Context * __context__, TArray<float3> &  __Arr_rename_at_40, float3 __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<float3>>::pass(__Arr_rename_at_40),__at_rename_at_40,12,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_f160cc321c805a96 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_47, TArray<int32_t> const  &  __varr_rename_at_47 )
+{
+	builtin_array_append(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_47),__varr_rename_at_47,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_90cec1a1c2c24351 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_57, TDim<int32_t,3> const  &  __varr_rename_at_57 )
+{
+	int32_t __at_rename_at_59 = (int32_t)builtin_array_size(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_57));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__Arr_rename_at_57),__at_rename_at_59 + 3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__Arr_rename_at_57(__at_rename_at_59,__context__))),__varr_rename_at_57);
+}
+
+inline void _Funcbuiltin_0x60_push_20c8f0745dcc7b07 ( Context * __context__, TArray<char *> &  __Arr_rename_at_47, TArray<char *> const  &  __varr_rename_at_47 )
+{
+	_Funcbuiltin_0x60_reserve_cecea833d1e66117(__context__,das_arg<TArray<char *>>::pass(__Arr_rename_at_47),builtin_array_size(das_arg<TArray<char *>>::pass(__Arr_rename_at_47)) + builtin_array_size(__varr_rename_at_47));
+	{
+		bool __need_loop_52 = true;
+		// x : string const&
+		das_iterator<TArray<char *> const > __x_iterator(__varr_rename_at_47);
+		char * const  * __x_rename_at_52;
+		__need_loop_52 = __x_iterator.first(__context__,(__x_rename_at_52)) && __need_loop_52;
+		for ( ; __need_loop_52 ; __need_loop_52 = __x_iterator.next(__context__,(__x_rename_at_52)) )
+		{
+			_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass(__Arr_rename_at_47),(*__x_rename_at_52),-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_52));
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> &  __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<char *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_b475faa190e1a07d ( Context * __context__, TArray<char *> &  __Arr_rename_at_57, TDim<char *,2> const  &  __varr_rename_at_57 )
+{
+	int32_t __at_rename_at_59 = (int32_t)builtin_array_size(das_arg<TArray<char *>>::pass(__Arr_rename_at_57));
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__Arr_rename_at_57),__at_rename_at_59 + 2);
+	das_copy(das_cast<TDim<char *,2>>::cast(das_ref(__context__,__Arr_rename_at_57(__at_rename_at_59,__context__))),__varr_rename_at_57);
+}
+
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<char *>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_df901583a0cdec70 ( Context * __context__, TArray<struct Foo> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct Foo>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float3>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_3e806eb2cc07d595 ( Context * __context__, TDim<char *,2> &  __a_rename_at_398 )
+{
+	TArray<char *> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_399),2);
+	das_copy(das_cast<TDim<char *,2>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627 ( Context * __context__, TDim<char *,3> &  __a_rename_at_398 )
+{
+	TArray<char *> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_399),3);
+	das_copy(das_cast<TDim<char *,3>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_f77c6221a73cea41 ( Context * __context__, TDim<char *,4> &  __a_rename_at_398 )
+{
+	TArray<char *> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_399),4);
+	das_copy(das_cast<TDim<char *,4>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline void finalize_28d612ce489d8dc9 ( Context * __context__, struct Foo &  ____this_rename_at_3 )
+{
+	memset(&(____this_rename_at_3), 0, 8);
+}
+
+inline bool test_5fd941ccf9aa3c42 ( Context * __context__ )
+{
+	test_push_f47aa598989805a7(__context__);
+	test_copy_slice_1b23d815a4d4d762(__context__);
+	test_fill_1cbc6d02048015f1(__context__);
+	test_find_count_equal_97f56f69ae7c26b7(__context__);
+	return true;
+}
+
+inline void test_copy_slice_1b23d815a4d4d762 ( Context * __context__ )
+{
+	TDim<char *,4> _temp_make_local_48_160;
+	TArray<int32_t> __a_rename_at_30; das_zero(__a_rename_at_30);
+	{
+		bool __need_loop_31 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_31;
+		__need_loop_31 = __i_iterator.first(__context__,(__i_rename_at_31)) && __need_loop_31;
+		for ( ; __need_loop_31 ; __need_loop_31 = __i_iterator.next(__context__,(__i_rename_at_31)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_30),__i_rename_at_31,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_31));
+	};
+	TArray<int32_t> __b_rename_at_33; das_zero(__b_rename_at_33);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_33),5);
+	_Funcbuiltin_0x60_copy_slice_cf66f093939e81d5(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_33),1,das_arg<TArray<int32_t>>::pass(__a_rename_at_30),6,4);
+	DAS_ASSERT((((__b_rename_at_33(0,__context__) == 0) && (__b_rename_at_33(1,__context__) == 6)) && (__b_rename_at_33(4,__context__) == 9)));
+	_Funcbuiltin_0x60_copy_slice_cf66f093939e81d5(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_30),2,das_arg<TArray<int32_t>>::pass(__a_rename_at_30),0,8);
+	DAS_ASSERT(((((__a_rename_at_30(0,__context__) == 0) && (__a_rename_at_30(1,__context__) == 1)) && (__a_rename_at_30(2,__context__) == 0)) && (__a_rename_at_30(9,__context__) == 7)));
+	_Funcbuiltin_0x60_copy_slice_cf66f093939e81d5(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_30),0,das_arg<TArray<int32_t>>::pass(__a_rename_at_30),2,8);
+	DAS_ASSERT((((__a_rename_at_30(0,__context__) == 0) && (__a_rename_at_30(7,__context__) == 7)) && (__a_rename_at_30(9,__context__) == 7)));
+	bool __failed_rename_at_42 = false;
+	das_try_recover(__context__, [&]()
+	{
+		_Funcbuiltin_0x60_copy_slice_cf66f093939e81d5(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_33),3,das_arg<TArray<int32_t>>::pass(__a_rename_at_30),0,3);
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_42,true);
+	});
+	DAS_ASSERT((__failed_rename_at_42));
+	TArray<char *> __s_rename_at_48; das_zero(__s_rename_at_48); das_move(__s_rename_at_48, _Funcbuiltin_0x60_to_array_move_f77c6221a73cea41(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_48_160(0,__context__) = ((char *) "a");
+		_temp_make_local_48_160(1,__context__) = ((char *) "b");
+		_temp_make_local_48_160(2,__context__) = ((char *) "c");
+		_temp_make_local_48_160(3,__context__) = ((char *) "d");
+		return _temp_make_local_48_160;
+	})()))));
+	_Funcbuiltin_0x60_copy_slice_92878ad28c3bccca(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_48),1,das_arg<TArray<char *>>::pass(__s_rename_at_48),0,3);
+	DAS_ASSERT(((((SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_48(0,__context__)),cast<char *>::from(((char *) "a")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_48(1,__context__)),cast<char *>::from(((char *) "a")),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_48(2,__context__)),cast<char *>::from(((char *) "b")),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_48(3,__context__)),cast<char *>::from(((char *) "c")),*__context__))));
+	{
+		bool __need_loop_52 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_30);
+		int32_t * __x_rename_at_52;
+		__need_loop_52 = __x_iterator.first(__context__,(__x_rename_at_52)) && __need_loop_52;
+		for ( ; __need_loop_52 ; __need_loop_52 = __x_iterator.next(__context__,(__x_rename_at_52)) )
+		{
+			_Funcbuiltin_0x60_copy_slice_cf66f093939e81d5(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_30),0,das_arg<TArray<int32_t>>::pass(__a_rename_at_30),9,1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_52));
+	};
+	DAS_ASSERT((__a_rename_at_30(0,__context__) == 7));
+	{
+		bool __need_loop_55 = true;
+		// x : string&
+		das_iterator<TArray<char *>> __x_iterator(__s_rename_at_48);
+		char * * __x_rename_at_55;
+		__need_loop_55 = __x_iterator.first(__context__,(__x_rename_at_55)) && __need_loop_55;
+		for ( ; __need_loop_55 ; __need_loop_55 = __x_iterator.next(__context__,(__x_rename_at_55)) )
+		{
+			_Funcbuiltin_0x60_copy_slice_92878ad28c3bccca(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_48),0,das_arg<TArray<char *>>::pass(__s_rename_at_48),3,1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_55));
+	};
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_48(0,__context__)),cast<char *>::from(((char *) "c")),*__context__)));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_30));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_33));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_48));
+}
+
+inline void test_fill_1cbc6d02048015f1 ( Context * __context__ )
+{
+	struct Foo _temp_make_local_71_96;
+	TArray<int32_t> __a_rename_at_63; das_zero(__a_rename_at_63);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_63),100);
+	_Funcbuiltin_0x60_fill_8e52ee0020b94f3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_63),7);
+	DAS_ASSERT((_Funcbuiltin_0x60_count_value_e233843efbedadad(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_63),7) == 100));
+	_Funcbuiltin_0x60_fill_ae9c53ec33532eab(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_63),3,10,5);
+	DAS_ASSERT(((((__a_rename_at_63(9,__context__) == 7) && (__a_rename_at_63(10,__context__) == 3)) && (__a_rename_at_63(14,__context__) == 3)) && (__a_rename_at_63(15,__context__) == 7)));
+	TArray<struct Foo> __f_rename_at_69; das_zero(__f_rename_at_69);
+	_Funcbuiltin_0x60_resize_df901583a0cdec70(__context__,das_arg<TArray<struct Foo>>::pass(__f_rename_at_69),33);
+	_Funcbuiltin_0x60_fill_904f8e830cd26a5a(__context__,das_arg<TArray<struct Foo>>::pass(__f_rename_at_69),das_arg<struct Foo>::pass((([&]() -> struct Foo& {
+		das_copy((_temp_make_local_71_96.a),(1));
+		das_copy((_temp_make_local_71_96.b),(2.f));
+		return _temp_make_local_71_96;
+	})())));
+	{
+		bool __need_loop_72 = true;
+		// x : Foo&
+		das_iterator<TArray<struct Foo>> __x_iterator(__f_rename_at_69);
+		struct Foo * __x_rename_at_72;
+		__need_loop_72 = __x_iterator.first(__context__,(__x_rename_at_72)) && __need_loop_72;
+		for ( ; __need_loop_72 ; __need_loop_72 = __x_iterator.next(__context__,(__x_rename_at_72)) )
+		{
+			DAS_ASSERT((((*__x_rename_at_72).a == 1) && ((*__x_rename_at_72).b == 2.f)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_72));
+	};
+	TArray<float3> __v_rename_at_74; das_zero(__v_rename_at_74);
+	_Funcbuiltin_0x60_resize_d3b08ad0141c2c31(__context__,das_arg<TArray<float3>>::pass(__v_rename_at_74),17);
+	_Funcbuiltin_0x60_fill_7d0d25b173a8e8e0(__context__,das_arg<TArray<float3>>::pass(__v_rename_at_74),v_make_vec4f(1.f,2.f,3.f,0.f));
+	DAS_ASSERT((SimPolicy<float3>::Equ(__v_rename_at_74(16,__context__),v_make_vec4f(1.f,2.f,3.f,0.f),*__context__)));
+	bool __failed_rename_at_78 = false;
+	das_try_recover(__context__, [&]()
+	{
+		_Funcbuiltin_0x60_fill_ae9c53ec33532eab(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_63),1,99,2);
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_78,true);
+	});
+	DAS_ASSERT((__failed_rename_at_78));
+	TArray<char *> __s_rename_at_84; das_zero(__s_rename_at_84);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_84),3);
+	_Funcbuiltin_0x60_fill_5f71e7c581afd510(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_84),((char *) "x"));
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_84(0,__context__)),cast<char *>::from(((char *) "x")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_84(2,__context__)),cast<char *>::from(((char *) "x")),*__context__))));
+	{
+		bool __need_loop_88 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_63);
+		int32_t * __x_rename_at_88;
+		__need_loop_88 = __x_iterator.first(__context__,(__x_rename_at_88)) && __need_loop_88;
+		for ( ; __need_loop_88 ; __need_loop_88 = __x_iterator.next(__context__,(__x_rename_at_88)) )
+		{
+			_Funcbuiltin_0x60_fill_ae9c53ec33532eab(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_63),11,0,1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_88));
+	};
+	DAS_ASSERT((__a_rename_at_63(0,__context__) == 11));
+	{
+		bool __need_loop_91 = true;
+		// x : string&
+		das_iterator<TArray<char *>> __x_iterator(__s_rename_at_84);
+		char * * __x_rename_at_91;
+		__need_loop_91 = __x_iterator.first(__context__,(__x_rename_at_91)) && __need_loop_91;
+		for ( ; __need_loop_91 ; __need_loop_91 = __x_iterator.next(__context__,(__x_rename_at_91)) )
+		{
+			_Funcbuiltin_0x60_fill_5f71e7c581afd510(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_84),((char *) "y"));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_91));
+	};
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_84(0,__context__)),cast<char *>::from(((char *) "y")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_84(2,__context__)),cast<char *>::from(((char *) "y")),*__context__))));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_63));
+	_Funcbuiltin_0x60_finalize_3335fd2773bd6893(__context__,das_arg<TArray<struct Foo>>::pass(__f_rename_at_69));
+	_Funcbuiltin_0x60_finalize_98531a3eac92cc54(__context__,das_arg<TArray<float3>>::pass(__v_rename_at_74));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_84));
+}
+
+inline void test_find_count_equal_97f56f69ae7c26b7 ( Context * __context__ )
+{
+	TDim<char *,3> _temp_make_local_124_272;
+	TArray<int32_t> __a_rename_at_100; das_zero(__a_rename_at_100);
+	{
+		bool __need_loop_101 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_101;
+		__need_loop_101 = __i_iterator.first(__context__,(__i_rename_at_101)) && __need_loop_101;
+		for ( ; __need_loop_101 ; __need_loop_101 = __i_iterator.next(__context__,(__i_rename_at_101)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_100),SimPolicy<int32_t>::Mod(__i_rename_at_101,10,*__context__),-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_101));
+	};
+	DAS_ASSERT((_Funcbuiltin_0x60_find_index_6536afea02700d6e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_100),3) == 3));
+	DAS_ASSERT((_Funcbuiltin_0x60_find_index_6536afea02700d6e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_100),10) == -1));
+	DAS_ASSERT((_Funcbuiltin_0x60_count_value_e233843efbedadad(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_100),3) == 10));
+	TArray<int32_t> __b_rename_at_106; das_zero(__b_rename_at_106);
+	_Funcbuiltin_0x60_push_f160cc321c805a96(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_106),das_arg<TArray<int32_t>>::pass(__a_rename_at_100));
+	DAS_ASSERT((_Funcbuiltin_0x60_equal_8c45ac6253c3045d(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_100),das_arg<TArray<int32_t>>::pass(__b_rename_at_106))));
+	das_copy(__b_rename_at_106(77,__context__),100);
+	DAS_ASSERT((!_Funcbuiltin_0x60_equal_8c45ac6253c3045d(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_100),das_arg<TArray<int32_t>>::pass(__b_rename_at_106))));
+	DAS_ASSERT((_Funcbuiltin_0x60_find_index_6536afea02700d6e(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_106),100) == 77));
+	_Funcbuiltin_0x60_pop_c64eaaff4b3d9a8c(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_106));
+	DAS_ASSERT((!_Funcbuiltin_0x60_equal_8c45ac6253c3045d(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_100),das_arg<TArray<int32_t>>::pass(__b_rename_at_106))));
+	TArray<float> __fl_rename_at_114; das_zero(__fl_rename_at_114);
+	{
+		bool __need_loop_115 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,20));
+		int32_t __i_rename_at_115;
+		__need_loop_115 = __i_iterator.first(__context__,(__i_rename_at_115)) && __need_loop_115;
+		for ( ; __need_loop_115 ; __need_loop_115 = __i_iterator.next(__context__,(__i_rename_at_115)) )
+		{
+			_Funcbuiltin_0x60_push_8a9191e5eb1aa83e(__context__,das_arg<TArray<float>>::pass(__fl_rename_at_114),float(__i_rename_at_115),-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_115));
+	};
+	DAS_ASSERT(((_Funcbuiltin_0x60_find_index_2d6a70285e6d577c(__context__,das_arg<TArray<float>>::pass(__fl_rename_at_114),19.f) == 19) && (_Funcbuiltin_0x60_count_value_4b682176366b2eeb(__context__,das_arg<TArray<float>>::pass(__fl_rename_at_114),0.f) == 1)));
+	TArray<float3> __v_rename_at_118; das_zero(__v_rename_at_118);
+	{
+		bool __need_loop_119 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,20));
+		int32_t __i_rename_at_119;
+		__need_loop_119 = __i_iterator.first(__context__,(__i_rename_at_119)) && __need_loop_119;
+		for ( ; __need_loop_119 ; __need_loop_119 = __i_iterator.next(__context__,(__i_rename_at_119)) )
+		{
+			_Funcbuiltin_0x60_push_a1cf41a85e2beaf2(__context__,das_arg<TArray<float3>>::pass(__v_rename_at_118),v_splats(__i_rename_at_119),-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_119));
+	};
+	DAS_ASSERT(((_Funcbuiltin_0x60_find_index_d3c475e57755edce(__context__,das_arg<TArray<float3>>::pass(__v_rename_at_118),v_splats(18.f)) == 18) && (_Funcbuiltin_0x60_count_value_281143fd4ae5694d(__context__,das_arg<TArray<float3>>::pass(__v_rename_at_118),v_make_vec4f(1.f,2.f,3.f,0.f)) == 0)));
+	TDim<int32_t,5> __fixed_rename_at_122 = (TDim<int32_t,5>)(([&]() -> TDim<int32_t,5> {
+		TDim<int32_t,5> __mka_122;
+		__mka_122(0,__context__) = 1;
+		__mka_122(1,__context__) = 2;
+		__mka_122(2,__context__) = 3;
+		__mka_122(3,__context__) = 2;
+		__mka_122(4,__context__) = 1;
+		return __mka_122;
+	})());
+	DAS_ASSERT(((_Funcbuiltin_0x60_find_index_1d34018233623b10(__context__,__fixed_rename_at_122,3) == 2) && (_Funcbuiltin_0x60_count_value_a59e9f175834b8c4(__context__,__fixed_rename_at_122,2) == 2)));
+	TArray<char *> __s_rename_at_124; das_zero(__s_rename_at_124); das_move(__s_rename_at_124, _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627(__context__,das_arg<TDim<char *,3>>::pass((([&]() -> TDim<char *,3>& {
+		_temp_make_local_124_272(0,__context__) = ((char *) "a");
+		_temp_make_local_124_272(1,__context__) = ((char *) "b");
+		_temp_make_local_124_272(2,__context__) = ((char *) "a");
+		return _temp_make_local_124_272;
+	})()))));
+	DAS_ASSERT(((_Funcbuiltin_0x60_find_index_391234c3541d2c09(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_124),((char *) "b")) == 1) && (_Funcbuiltin_0x60_count_value_7040f4d3ddd436f6(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_124),((char *) "a")) == 2)));
+	TArray<int32_t> __e_rename_at_126; das_zero(__e_rename_at_126);
+	DAS_ASSERT(((_Funcbuiltin_0x60_find_index_6536afea02700d6e(__context__,das_arg<TArray<int32_t>>::pass(__e_rename_at_126),1) == -1) && (_Funcbuiltin_0x60_count_value_e233843efbedadad(__context__,das_arg<TArray<int32_t>>::pass(__e_rename_at_126),1) == 0)));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_100));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_106));
+	_Funcbuiltin_0x60_finalize_4da34799ba0520c5(__context__,das_arg<TArray<float>>::pass(__fl_rename_at_114));
+	_Funcbuiltin_0x60_finalize_98531a3eac92cc54(__context__,das_arg<TArray<float3>>::pass(__v_rename_at_118));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_124));
+}
+
+inline void test_push_f47aa598989805a7 ( Context * __context__ )
+{
+	TDim<int32_t,3> _temp_make_local_17_112;
+	TDim<char *,2> _temp_make_local_20_192;
+	TDim<char *,2> _temp_make_local_22_208;
+	TArray<int32_t> __a_rename_at_8; das_zero(__a_rename_at_8);
+	TArray<int32_t> __b_rename_at_9; das_zero(__b_rename_at_9);
+	{
+		bool __need_loop_10 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,40));
+		int32_t __i_rename_at_10;
+		__need_loop_10 = __i_iterator.first(__context__,(__i_rename_at_10)) && __need_loop_10;
+		for ( ; __need_loop_10 ; __need_loop_10 = __i_iterator.next(__context__,(__i_rename_at_10)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_9),__i_rename_at_10,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_10));
+	};
+	_Funcbuiltin_0x60_push_f160cc321c805a96(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_8),das_arg<TArray<int32_t>>::pass(__b_rename_at_9));
+	_Funcbuiltin_0x60_push_f160cc321c805a96(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_8),das_arg<TArray<int32_t>>::pass(__b_rename_at_9));
+	DAS_ASSERT(((((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_8)) == 80) && (__a_rename_at_8(39,__context__) == 39)) && (__a_rename_at_8(40,__context__) == 0)) && (__a_rename_at_8(79,__context__) == 39)));
+	_Funcbuiltin_0x60_push_f160cc321c805a96(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_8),das_arg<TArray<int32_t>>::pass(__a_rename_at_8));
+	DAS_ASSERT((((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_8)) == 160) && (__a_rename_at_8(119,__context__) == 39)) && (__a_rename_at_8(159,__context__) == 39)));
+	_Funcbuiltin_0x60_push_90cec1a1c2c24351(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_8),das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_17_112(0,__context__) = 1;
+		_temp_make_local_17_112(1,__context__) = 2;
+		_temp_make_local_17_112(2,__context__) = 3;
+		return _temp_make_local_17_112;
+	})())));
+	DAS_ASSERT((((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_8)) == 163) && (__a_rename_at_8(160,__context__) == 1)) && (__a_rename_at_8(162,__context__) == 3)));
+	TArray<char *> __s_rename_at_19; das_zero(__s_rename_at_19);
+	TArray<char *> __t_rename_at_20; das_zero(__t_rename_at_20); das_move(__t_rename_at_20, _Funcbuiltin_0x60_to_array_move_3e806eb2cc07d595(__context__,das_arg<TDim<char *,2>>::pass((([&]() -> TDim<char *,2>& {
+		_temp_make_local_20_192(0,__context__) = ((char *) "one");
+		_temp_make_local_20_192(1,__context__) = ((char *) "two");
+		return _temp_make_local_20_192;
+	})()))));
+	_Funcbuiltin_0x60_push_20c8f0745dcc7b07(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_19),das_arg<TArray<char *>>::pass(__t_rename_at_20));
+	_Funcbuiltin_0x60_push_b475faa190e1a07d(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_19),das_arg<TDim<char *,2>>::pass((([&]() -> TDim<char *,2>& {
+		_temp_make_local_22_208(0,__context__) = ((char *) "three");
+		_temp_make_local_22_208(1,__context__) = ((char *) "four");
+		return _temp_make_local_22_208;
+	})())));
+	DAS_ASSERT((((builtin_array_size(das_arg<TArray<char *>>::pass(__s_rename_at_19)) == 4) && (SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_19(1,__context__)),cast<char *>::from(((char *) "two")),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(__s_rename_at_19(3,__context__)),cast<char *>::from(((char *) "four")),*__context__))));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_8));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_9));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__s_rename_at_19));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__t_rename_at_20));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_copy_slice_cf66f093939e81d5
+		aotLib[0xe4e195f39aec9009] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , TArray<int32_t> const  & , int32_t , int32_t  ),&_Funcbuiltin_0x60_copy_slice_cf66f093939e81d5>>();
+	};
+		// _Funcbuiltin_0x60_copy_slice_92878ad28c3bccca
+		aotLib[0xb15d2ac0e5be6e25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t , TArray<char *> const  & , int32_t , int32_t  ),&_Funcbuiltin_0x60_copy_slice_92878ad28c3bccca>>();
+	};
+		// _Funcbuiltin_0x60_count_value_4b682176366b2eeb
+		aotLib[0xef5a0eb8100a3d85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<float> const  & , float  ),&_Funcbuiltin_0x60_count_value_4b682176366b2eeb>>();
+	};
+		// _Funcbuiltin_0x60_count_value_281143fd4ae5694d
+		aotLib[0xa7152034a8011c25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<float3> const  & , float3  ),&_Funcbuiltin_0x60_count_value_281143fd4ae5694d>>();
+	};
+		// _Funcbuiltin_0x60_count_value_e233843efbedadad
+		aotLib[0xa74c8c36ec1386ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , int32_t  ),&_Funcbuiltin_0x60_count_value_e233843efbedadad>>();
+	};
+		// _Funcbuiltin_0x60_count_value_7040f4d3ddd436f6
+		aotLib[0xe25ed093bccb3d85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  & , char * const   ),&_Funcbuiltin_0x60_count_value_7040f4d3ddd436f6>>();
+	};
+		// _Funcbuiltin_0x60_count_value_a59e9f175834b8c4
+		aotLib[0x7a5740a747488249] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<int32_t,5> const  & , int32_t  ),&_Funcbuiltin_0x60_count_value_a59e9f175834b8c4>>();
+	};
+		// _Funcbuiltin_0x60_equal_8c45ac6253c3045d
+		aotLib[0xb62e7651fc17bc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_equal_8c45ac6253c3045d>>();
+	};
+		// _Funcbuiltin_0x60_fill_904f8e830cd26a5a
+		aotLib[0xc5c04fba61a16a33] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , struct Foo const  &  ),&_Funcbuiltin_0x60_fill_904f8e830cd26a5a>>();
+	};
+		// _Funcbuiltin_0x60_fill_698a7ee4883f5610
+		aotLib[0x90ac88530a360691] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , struct Foo const  & , int32_t , int32_t  ),&_Funcbuiltin_0x60_fill_698a7ee4883f5610>>();
+	};
+		// _Funcbuiltin_0x60_fill_7d0d25b173a8e8e0
+		aotLib[0xe966aed5908df1d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , float3  ),&_Funcbuiltin_0x60_fill_7d0d25b173a8e8e0>>();
+	};
+		// _Funcbuiltin_0x60_fill_6bd6e194a6b60f1f
+		aotLib[0x22727f297058f759] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , float3 , int32_t , int32_t  ),&_Funcbuiltin_0x60_fill_6bd6e194a6b60f1f>>();
+	};
+		// _Funcbuiltin_0x60_fill_8e52ee0020b94f3c
+		aotLib[0xde6e7cf690a274f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_fill_8e52ee0020b94f3c>>();
+	};
+		// _Funcbuiltin_0x60_fill_ae9c53ec33532eab
+		aotLib[0xb9c7094ba8eeb65d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t , int32_t  ),&_Funcbuiltin_0x60_fill_ae9c53ec33532eab>>();
+	};
+		// _Funcbuiltin_0x60_fill_5f71e7c581afd510
+		aotLib[0x53a2303b81ba4d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_fill_5f71e7c581afd510>>();
+	};
+		// _Funcbuiltin_0x60_fill_232c4134cc1d4265
+		aotLib[0xc93eea824633d9a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t , int32_t  ),&_Funcbuiltin_0x60_fill_232c4134cc1d4265>>();
+	};
+		// _Funcbuiltin_0x60_finalize_3335fd2773bd6893
+		aotLib[0xbba38e04904d9d10] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> &  ),&_Funcbuiltin_0x60_finalize_3335fd2773bd6893>>();
+	};
+		// _Funcbuiltin_0x60_finalize_4da34799ba0520c5
+		aotLib[0xbd5f701fe616ff75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_finalize_4da34799ba0520c5>>();
+	};
+		// _Funcbuiltin_0x60_finalize_98531a3eac92cc54
+		aotLib[0x4bfc8cef68576f79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> &  ),&_Funcbuiltin_0x60_finalize_98531a3eac92cc54>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_find_index_2d6a70285e6d577c
+		aotLib[0x70f5413101f7a85d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<float> const  & , float  ),&_Funcbuiltin_0x60_find_index_2d6a70285e6d577c>>();
+	};
+		// _Funcbuiltin_0x60_find_index_d3c475e57755edce
+		aotLib[0x29ea4520d0833985] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<float3> const  & , float3  ),&_Funcbuiltin_0x60_find_index_d3c475e57755edce>>();
+	};
+		// _Funcbuiltin_0x60_find_index_6536afea02700d6e
+		aotLib[0x92096b5c985da301] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , int32_t  ),&_Funcbuiltin_0x60_find_index_6536afea02700d6e>>();
+	};
+		// _Funcbuiltin_0x60_find_index_391234c3541d2c09
+		aotLib[0xfb3d84a4cd683d79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<char *> const  & , char * const   ),&_Funcbuiltin_0x60_find_index_391234c3541d2c09>>();
+	};
+		// _Funcbuiltin_0x60_find_index_1d34018233623b10
+		aotLib[0x12557cb6420e2bbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<int32_t,5> const  & , int32_t  ),&_Funcbuiltin_0x60_find_index_1d34018233623b10>>();
+	};
+		// _Funcbuiltin_0x60_pop_c64eaaff4b3d9a8c
+		aotLib[0xea40c63ea3f01f8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_pop_c64eaaff4b3d9a8c>>();
+	};
+		// _Funcbuiltin_0x60_push_8a9191e5eb1aa83e
+		aotLib[0xc0f5dc1255d7c9dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float , int32_t  ),&_Funcbuiltin_0x60_push_8a9191e5eb1aa83e>>();
+	};
+		// _Funcbuiltin_0x60_push_a1cf41a85e2beaf2
+		aotLib[0x377d40b44db2aa5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , float3 , int32_t  ),&_Funcbuiltin_0x60_push_a1cf41a85e2beaf2>>();
+	};
+		// _Funcbuiltin_0x60_push_f160cc321c805a96
+		aotLib[0xec8ff3b46a13c535] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_push_f160cc321c805a96>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_push_90cec1a1c2c24351
+		aotLib[0xdca50aeea663897d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TDim<int32_t,3> const  &  ),&_Funcbuiltin_0x60_push_90cec1a1c2c24351>>();
+	};
+		// _Funcbuiltin_0x60_push_20c8f0745dcc7b07
+		aotLib[0xb7e9b0ccfc437f7a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TArray<char *> const  &  ),&_Funcbuiltin_0x60_push_20c8f0745dcc7b07>>();
+	};
+		// _Funcbuiltin_0x60_push_dbe8c61ce24eace2
+		aotLib[0xe7e1aae867aed505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_dbe8c61ce24eace2>>();
+	};
+		// _Funcbuiltin_0x60_push_b475faa190e1a07d
+		aotLib[0x11d143030db68d3b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TDim<char *,2> const  &  ),&_Funcbuiltin_0x60_push_b475faa190e1a07d>>();
+	};
+		// _Funcbuiltin_0x60_reserve_cecea833d1e66117
+		aotLib[0x58482c2f23d3c0ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_cecea833d1e66117>>();
+	};
+		// _Funcbuiltin_0x60_resize_df901583a0cdec70
+		aotLib[0xd1cfb1c711f572e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , int32_t  ),&_Funcbuiltin_0x60_resize_df901583a0cdec70>>();
+	};
+		// _Funcbuiltin_0x60_resize_d3b08ad0141c2c31
+		aotLib[0x6cbb6db64f4979] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_resize_d3b08ad0141c2c31>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_3e806eb2cc07d595
+		aotLib[0x50a8779b62fcad0b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,2> &  ),&_Funcbuiltin_0x60_to_array_move_3e806eb2cc07d595>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627
+		aotLib[0xd9c10fb92f4cd82f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,3> &  ),&_Funcbuiltin_0x60_to_array_move_bfd0e514057ae627>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_f77c6221a73cea41
+		aotLib[0x7d3d0fa319b704cb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,4> &  ),&_Funcbuiltin_0x60_to_array_move_f77c6221a73cea41>>();
+	};
+		// finalize_28d612ce489d8dc9
+		aotLib[0x388aed6673d06b5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&finalize_28d612ce489d8dc9>>();
+	};
+		// test_5fd941ccf9aa3c42
+		aotLib[0xfddd0a9cbc6dd90c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5fd941ccf9aa3c42>>();
+	};
+		// test_copy_slice_1b23d815a4d4d762
+		aotLib[0x490d5d5125b5a2df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_copy_slice_1b23d815a4d4d762>>();
+	};
+		// test_fill_1cbc6d02048015f1
+		aotLib[0x581e6532b13f5189] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_fill_1cbc6d02048015f1>>();
+	};
+		// test_find_count_equal_97f56f69ae7c26b7
+		aotLib[0x3f3ee8157b9ffccf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_find_count_equal_97f56f69ae7c26b7>>();
+	};
+		// test_push_f47aa598989805a7
+		aotLib[0xcd1ad1a7cf035250] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_push_f47aa598989805a7>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
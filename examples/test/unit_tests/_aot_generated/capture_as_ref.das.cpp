@@ -0,0 +1,248 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern StructInfo __struct_info__ad05124b;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__62446245;
+extern TypeInfo __type_info__c7e1677;
+extern TypeInfo __type_info__dda6b763;
+extern TypeInfo __type_info__a76b37fb;
+extern VarInfo __var_info__bde41cd;
+extern VarInfo __var_info__dddd1164;
+extern VarInfo __var_info__dfdd148a;
+extern VarInfo __var_info__7e382ffe;
+extern VarInfo __var_info__4b2267d1;
+extern VarInfo __var_info__dc138f98;
+extern VarInfo __var_info__115b073b;
+extern VarInfo __var_info__d2aa970e;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd2aa970e, "__rtti", 0 };
+TypeInfo * __type_info__4b2267d1_arg_types_var_2975371271[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4b2267d1_arg_types_var_2975371271, nullptr, 1, 0, nullptr, 28, 0x4b2267d1, "__finalize", 8 };
+VarInfo __struct_info__b1589007_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xdddd1164, "i", 12 };
+VarInfo __struct_info__b1589007_field_3 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xdfdd148a, "k", 16 };
+TypeInfo * __type_info__7e382ffe_arg_types_var_2975371271[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__b1589007_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__62446245, nullptr, (TypeInfo **)__type_info__7e382ffe_arg_types_var_2975371271, nullptr, 1, 0, nullptr, 28, 0x7e382ffe, "kaboom", 40 };
+VarInfo * __struct_info__b1589007_fields[5] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1, &__struct_info__b1589007_field_2, &__struct_info__b1589007_field_3, &__struct_info__b1589007_field_4 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 5, 48, 0, nullptr, 0xb1589007 };
+TypeInfo * __type_info__dc138f98_arg_types_var_2902790731[1] = { &__type_info__a76b37fb };
+VarInfo __struct_info__ad05124b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__dc138f98_arg_types_var_2902790731, nullptr, 1, 0, nullptr, 28, 0xdc138f98, "__lambda", 0 };
+TypeInfo * __type_info__bde41cd_arg_types_var_2902790731[1] = { &__type_info__dda6b763 };
+VarInfo __struct_info__ad05124b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bde41cd_arg_types_var_2902790731, nullptr, 1, 0, nullptr, 28, 0xbde41cd, "__finalize", 4 };
+VarInfo __struct_info__ad05124b_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c7e1677, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x115b073b, "self", 8 };
+VarInfo * __struct_info__ad05124b_fields[3] =  { &__struct_info__ad05124b_field_0, &__struct_info__ad05124b_field_1, &__struct_info__ad05124b_field_2 };
+StructInfo __struct_info__ad05124b = {"_lambda_thismodule_8_3_1", __struct_info__ad05124b_fields, 3, 16, -1, nullptr, 0xad05124b };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__62446245 = { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 0, 0x62446245 };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc7e1677 };
+TypeInfo __type_info__dda6b763 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a76b37fb, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xdda6b763 };
+TypeInfo __type_info__a76b37fb = { Type::tStructure, &__struct_info__ad05124b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xa76b37fb };
+
+namespace  {
+
+struct Foo {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct Foo)) __finalize;
+	int32_t i;
+	TArray<int32_t> k;
+	Func DAS_COMMENT((Lambda DAS_COMMENT((int32_t)),struct Foo)) kaboom;
+};
+static_assert(sizeof(Foo)==48,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,i)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,k)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,kaboom)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_8_3_1 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_8_3_1)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_8_3_1 *)) __finalize;
+	struct Foo * self;
+};
+static_assert(sizeof(_lambda_thismodule_8_3_1)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_8_3_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_8_3_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_8_3_1,self)==8,"structure field offset mismatch with DAS");
+}
+
+inline struct Foo Foo_cf5df84683e93176 ( Context * __context__ );
+inline void _FuncFoo_0x27___finalize_5a2550aa40213729 ( Context * __context__, struct Foo & __self_rename_at_1 );
+inline void _FuncFoo_0x60_Foo_16d46ab5c3ca0927 ( Context * __context__, struct Foo & __self_rename_at_4 );
+inline Lambda DAS_COMMENT((int32_t)) _FuncFoo_0x60_kaboom_ec85caf9e5c658d5 ( Context * __context__, struct Foo & __self_rename_at_6 );
+inline void _Func_lambda_thismodule_8_3_1_0x60_finazlier_ecae31d086276f7e ( Context * __context__, struct _lambda_thismodule_8_3_1 * ____this_rename_at_8 );
+inline int32_t _Func_lambda_thismodule_8_3_1_0x60_function_e293311d2e526beb ( Context * __context__, struct _lambda_thismodule_8_3_1 & ____this_rename_at_8 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void finalize_60076e58c404a803 ( Context * __context__, struct Foo & ____this_rename_at_1 );
+inline void finalize_6d3e06f585c422d1 ( Context * __context__, struct _lambda_thismodule_8_3_1 & ____this_rename_at_8 );
+inline bool test_e71f66034f0c01d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline struct Foo Foo_cf5df84683e93176 ( Context * __context__ )
+{
+	struct Foo __self_rename_at_4; das_zero(__self_rename_at_4); das_move(__self_rename_at_4, (([&]() -> struct Foo {
+		struct Foo __mks_4;
+		das_zero(__mks_4);
+		das_copy((__mks_4.__rtti),(((void *)(&__type_info__c7e1677))));
+		das_copy((__mks_4.__finalize),(Func(__context__->fnIdxByMangledName(/*Foo'__finalize Foo*/ 2693173404u))));
+		das_copy((__mks_4.kaboom),(Func(__context__->fnIdxByMangledName(/*Foo`kaboom Foo*/ 1530344570u))));
+		return __mks_4;
+	})()));
+	_FuncFoo_0x60_Foo_16d46ab5c3ca0927(__context__,das_arg<struct Foo>::pass(__self_rename_at_4));
+	return /* <- */ __self_rename_at_4;
+}
+
+inline void _FuncFoo_0x27___finalize_5a2550aa40213729 ( Context * __context__, struct Foo &  __self_rename_at_1 )
+{
+	finalize_60076e58c404a803(__context__,das_arg<struct Foo>::pass(__self_rename_at_1));
+}
+
+inline void _FuncFoo_0x60_Foo_16d46ab5c3ca0927 ( Context * __context__, struct Foo &  __self_rename_at_4 )
+{
+	das_copy(__self_rename_at_4.i,5);
+}
+
+inline Lambda DAS_COMMENT((int32_t)) _FuncFoo_0x60_kaboom_ec85caf9e5c658d5 ( Context * __context__, struct Foo &  __self_rename_at_6 )
+{
+	Lambda DAS_COMMENT((int32_t)) __counter_rename_at_7; das_zero(__counter_rename_at_7); das_move(__counter_rename_at_7, das_ascend<int32_t,struct _lambda_thismodule_8_3_1>::make(__context__,&__type_info__a76b37fb,(([&]() -> struct _lambda_thismodule_8_3_1 {
+		struct _lambda_thismodule_8_3_1 __mks_8;
+		das_copy((__mks_8.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_8_3_1`function _lambda_thismodule_8_3_1*/ 431435849u))));
+		das_copy((__mks_8.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_8_3_1`finazlier #ptr#_lambda_thismodule_8_3_1#explicit*/ 4148342458u))));
+		das_copy((__mks_8.self),(das_ref(__context__,__self_rename_at_6)));
+		return __mks_8;
+	})())));
+	return /* <- */ __counter_rename_at_7;
+}
+
+inline void _Func_lambda_thismodule_8_3_1_0x60_finazlier_ecae31d086276f7e ( Context * __context__, struct _lambda_thismodule_8_3_1 * ____this_rename_at_8 )
+{
+	finalize_6d3e06f585c422d1(__context__,das_arg<struct _lambda_thismodule_8_3_1>::pass(das_deref(__context__,____this_rename_at_8)));
+	das_delete_lambda_struct<struct _lambda_thismodule_8_3_1 *>::clear(__context__,____this_rename_at_8);
+}
+
+inline int32_t _Func_lambda_thismodule_8_3_1_0x60_function_e293311d2e526beb ( Context * __context__, struct _lambda_thismodule_8_3_1 &  ____this_rename_at_8 )
+{
+	return das_deref(__context__,____this_rename_at_8.self).i++;
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void finalize_60076e58c404a803 ( Context * __context__, struct Foo &  ____this_rename_at_1 )
+{
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_1.k));
+	memset(&(____this_rename_at_1), 0, 48);
+}
+
+inline void finalize_6d3e06f585c422d1 ( Context * __context__, struct _lambda_thismodule_8_3_1 &  ____this_rename_at_8 )
+{
+	memset(&(____this_rename_at_8), 0, 16);
+}
+
+inline bool test_e71f66034f0c01d ( Context * __context__ )
+{
+	struct Foo * __x_rename_at_13 = das_new<struct Foo>::make_and_init(__context__,[&]() { return Foo_cf5df84683e93176(__context__); });
+	Lambda DAS_COMMENT((int32_t)) __boom_rename_at_14; das_zero(__boom_rename_at_14); das_move(__boom_rename_at_14, (Lambda DAS_COMMENT((int32_t)))das_invoke_function<Lambda DAS_COMMENT((int32_t))>::invoke<struct Foo &>(__context__,__x_rename_at_13->kaboom,das_arg<struct Foo>::pass(das_cast<struct Foo>::cast(das_deref(__context__,__x_rename_at_13)))));
+	DAS_ASSERT((__x_rename_at_13->i == 5));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Foo_cf5df84683e93176
+		aotLib[0xe3f5bdbfad950444] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__ ),&Foo_cf5df84683e93176>>();
+	};
+		// _FuncFoo_0x27___finalize_5a2550aa40213729
+		aotLib[0x4eefb2839c04ab20] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&_FuncFoo_0x27___finalize_5a2550aa40213729>>();
+	};
+		// _FuncFoo_0x60_Foo_16d46ab5c3ca0927
+		aotLib[0x9ee621fad05de4a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&_FuncFoo_0x60_Foo_16d46ab5c3ca0927>>();
+	};
+		// _FuncFoo_0x60_kaboom_ec85caf9e5c658d5
+		aotLib[0xa915c5202953f9c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Lambda DAS_COMMENT((int32_t)) (*) ( Context * __context__, struct Foo &  ),&_FuncFoo_0x60_kaboom_ec85caf9e5c658d5>>();
+	};
+		// _Func_lambda_thismodule_8_3_1_0x60_finazlier_ecae31d086276f7e
+		aotLib[0xe145afe5db47c3e3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_8_3_1 *  ),&_Func_lambda_thismodule_8_3_1_0x60_finazlier_ecae31d086276f7e>>();
+	};
+		// _Func_lambda_thismodule_8_3_1_0x60_function_e293311d2e526beb
+		aotLib[0xfeaf8df9b6393241] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_8_3_1 &  ),&_Func_lambda_thismodule_8_3_1_0x60_function_e293311d2e526beb>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// finalize_60076e58c404a803
+		aotLib[0x905bb60621a9d86a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&finalize_60076e58c404a803>>();
+	};
+		// finalize_6d3e06f585c422d1
+		aotLib[0xabafa82d9fc212d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_8_3_1 &  ),&finalize_6d3e06f585c422d1>>();
+	};
+		// test_e71f66034f0c01d
+		aotLib[0x431069ba320d70c7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e71f66034f0c01d>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,263 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo3D {
+	int32_t x;
+	int32_t y;
+	int32_t z;
+};
+static_assert(sizeof(Foo3D)==12,"structure size mismatch with DAS");
+static_assert(offsetof(Foo3D,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,z)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct FooVision {
+	struct Foo3D f3d;
+	float4 color;
+};
+static_assert(sizeof(FooVision)==28,"structure size mismatch with DAS");
+static_assert(offsetof(FooVision,f3d)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(FooVision,color)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Int2Float {
+	uint32_t iv;
+	float fv;
+};
+static_assert(sizeof(Int2Float)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Int2Float,iv)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Int2Float,fv)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Float2Int {
+	float fv;
+	uint32_t iv;
+};
+static_assert(sizeof(Float2Int)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Float2Int,fv)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Float2Int,iv)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_0x60_setFooGeneric_ba8bdfcb7b210329 ( Context * __context__, struct Foo * __foo_rename_at_13, int32_t __x_rename_at_13, int32_t __y_rename_at_13 );
+inline void _Func_0x60_setFooGeneric_70266ca607804f38 ( Context * __context__, struct Foo3D * __foo_rename_at_13, int32_t __x_rename_at_13, int32_t __y_rename_at_13 );
+inline void _Func_0x60_setFooGeneric_7a8da74d54e6b068 ( Context * __context__, struct Foo & __foo_rename_at_13, int32_t __x_rename_at_13, int32_t __y_rename_at_13 );
+inline void _Func_0x60_setFooGeneric_9f2bdf2f87e01733 ( Context * __context__, struct Foo3D & __foo_rename_at_13, int32_t __x_rename_at_13, int32_t __y_rename_at_13 );
+inline void setFoo_2efe8cad9c89e8be ( Context * __context__, struct Foo & __foo_rename_at_17, int32_t __x_rename_at_17, int32_t __y_rename_at_17 );
+inline void setFooPtr_51d20c528f366bdf ( Context * __context__, struct Foo * __foo_rename_at_21, int32_t __x_rename_at_21, int32_t __y_rename_at_21 );
+inline bool test_ecace6d6b3c0bc09 ( Context * __context__ );
+inline void test_ptr_67379821c5d2c679 ( Context * __context__ );
+inline bool test_reinterpret_698df00d71a73268 ( Context * __context__ );
+inline bool test_struct_a0407944ee3d9a64 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_setFooGeneric_ba8bdfcb7b210329 ( Context * __context__, struct Foo * __foo_rename_at_13, int32_t __x_rename_at_13, int32_t __y_rename_at_13 )
+{
+	das_copy(__foo_rename_at_13->x,__x_rename_at_13);
+	das_copy(__foo_rename_at_13->y,__y_rename_at_13);
+}
+
+inline void _Func_0x60_setFooGeneric_70266ca607804f38 ( Context * __context__, struct Foo3D * __foo_rename_at_13, int32_t __x_rename_at_13, int32_t __y_rename_at_13 )
+{
+	das_copy(__foo_rename_at_13->x,__x_rename_at_13);
+	das_copy(__foo_rename_at_13->y,__y_rename_at_13);
+}
+
+inline void _Func_0x60_setFooGeneric_7a8da74d54e6b068 ( Context * __context__, struct Foo &  __foo_rename_at_13, int32_t __x_rename_at_13, int32_t __y_rename_at_13 )
+{
+	das_copy(__foo_rename_at_13.x,__x_rename_at_13);
+	das_copy(__foo_rename_at_13.y,__y_rename_at_13);
+}
+
+inline void _Func_0x60_setFooGeneric_9f2bdf2f87e01733 ( Context * __context__, struct Foo3D &  __foo_rename_at_13, int32_t __x_rename_at_13, int32_t __y_rename_at_13 )
+{
+	das_copy(__foo_rename_at_13.x,__x_rename_at_13);
+	das_copy(__foo_rename_at_13.y,__y_rename_at_13);
+}
+
+inline void setFoo_2efe8cad9c89e8be ( Context * __context__, struct Foo &  __foo_rename_at_17, int32_t __x_rename_at_17, int32_t __y_rename_at_17 )
+{
+	das_copy(__foo_rename_at_17.x,__x_rename_at_17);
+	das_copy(__foo_rename_at_17.y,__y_rename_at_17);
+}
+
+inline void setFooPtr_51d20c528f366bdf ( Context * __context__, struct Foo * __foo_rename_at_21, int32_t __x_rename_at_21, int32_t __y_rename_at_21 )
+{
+	das_copy(__foo_rename_at_21->x,__x_rename_at_21);
+	das_copy(__foo_rename_at_21->y,__y_rename_at_21);
+}
+
+inline bool test_ecace6d6b3c0bc09 ( Context * __context__ )
+{
+	test_struct_a0407944ee3d9a64(__context__);
+	test_ptr_67379821c5d2c679(__context__);
+	test_reinterpret_698df00d71a73268(__context__);
+	return true;
+}
+
+inline void test_ptr_67379821c5d2c679 ( Context * __context__ )
+{
+	struct Foo * __f_rename_at_48 = das_new<struct Foo>::make(__context__);
+	struct Foo3D * __f3d_rename_at_49 = das_new<struct Foo3D>::make(__context__);
+	DAS_ASSERT(((__f_rename_at_48->x == 0) && (__f_rename_at_48->y == 0)));
+	DAS_ASSERT(((__f3d_rename_at_49->x == 0) && (__f3d_rename_at_49->y == 0)));
+	_Func_0x60_setFooGeneric_ba8bdfcb7b210329(__context__,__f_rename_at_48,1,2);
+	_Func_0x60_setFooGeneric_70266ca607804f38(__context__,__f3d_rename_at_49,1,2);
+	DAS_ASSERT(((__f_rename_at_48->x == 1) && (__f_rename_at_48->y == 2)));
+	DAS_ASSERT(((__f3d_rename_at_49->x == 1) && (__f3d_rename_at_49->y == 2)));
+	setFooPtr_51d20c528f366bdf(__context__,__f_rename_at_48,3,4);
+	setFooPtr_51d20c528f366bdf(__context__,das_cast<struct Foo *>::cast(__f3d_rename_at_49),3,4);
+	DAS_ASSERT(((__f_rename_at_48->x == 3) && (__f_rename_at_48->y == 4)));
+	DAS_ASSERT(((__f3d_rename_at_49->x == 3) && (__f3d_rename_at_49->y == 4)));
+	das_copy(das_cast<struct Foo *>::cast(__f3d_rename_at_49)->y,5);
+	DAS_ASSERT((__f3d_rename_at_49->y == 5));
+	struct FooVision * __fv_rename_at_62 = das_new<struct FooVision>::make(__context__);
+	das_copy(das_cast<struct Foo>::cast(__fv_rename_at_62->f3d).y,13);
+	DAS_ASSERT((das_cast<struct Foo>::cast(__fv_rename_at_62->f3d).y == 13));
+}
+
+inline bool test_reinterpret_698df00d71a73268 ( Context * __context__ )
+{
+	struct Int2Float __f2i_rename_at_76 = (struct Int2Float)(([&]() -> struct Int2Float {
+		struct Int2Float __mks_76;
+		das_copy((__mks_76.iv),(0x3f400000u));
+		das_copy((__mks_76.fv),(1.f));
+		return __mks_76;
+	})());
+	struct Float2Int __i2f_rename_at_78 = (struct Float2Int)das_cast<struct Float2Int>::cast(__f2i_rename_at_76);
+	DAS_ASSERT(((__i2f_rename_at_78.fv == 0.75f) && (__i2f_rename_at_78.iv == 0x3f800000u)));
+	return true;
+}
+
+inline bool test_struct_a0407944ee3d9a64 ( Context * __context__ )
+{
+	struct Foo __f_rename_at_27; das_zero(__f_rename_at_27);
+	struct Foo3D __f3d_rename_at_28; das_zero(__f3d_rename_at_28);
+	DAS_ASSERT(((__f_rename_at_27.x == 0) && (__f_rename_at_27.y == 0)));
+	DAS_ASSERT(((__f3d_rename_at_28.x == 0) && (__f3d_rename_at_28.y == 0)));
+	_Func_0x60_setFooGeneric_7a8da74d54e6b068(__context__,das_arg<struct Foo>::pass(__f_rename_at_27),1,2);
+	_Func_0x60_setFooGeneric_9f2bdf2f87e01733(__context__,das_arg<struct Foo3D>::pass(__f3d_rename_at_28),1,2);
+	DAS_ASSERT(((__f_rename_at_27.x == 1) && (__f_rename_at_27.y == 2)));
+	DAS_ASSERT(((__f3d_rename_at_28.x == 1) && (__f3d_rename_at_28.y == 2)));
+	setFoo_2efe8cad9c89e8be(__context__,das_arg<struct Foo>::pass(__f_rename_at_27),3,4);
+	setFoo_2efe8cad9c89e8be(__context__,das_arg<struct Foo>::pass(das_cast<struct Foo>::cast(__f3d_rename_at_28)),3,4);
+	DAS_ASSERT(((__f_rename_at_27.x == 3) && (__f_rename_at_27.y == 4)));
+	DAS_ASSERT(((__f3d_rename_at_28.x == 3) && (__f3d_rename_at_28.y == 4)));
+	das_copy(das_cast<struct Foo>::cast(__f3d_rename_at_28).y,5);
+	DAS_ASSERT((__f3d_rename_at_28.y == 5));
+	struct FooVision __fv_rename_at_41; das_zero(__fv_rename_at_41);
+	das_copy(das_cast<struct Foo>::cast(__fv_rename_at_41.f3d).y,13);
+	DAS_ASSERT((das_cast<struct Foo>::cast(__fv_rename_at_41.f3d).y == 13));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_setFooGeneric_ba8bdfcb7b210329
+		aotLib[0xfb8a53d682d9e5b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo * , int32_t , int32_t  ),&_Func_0x60_setFooGeneric_ba8bdfcb7b210329>>();
+	};
+		// _Func_0x60_setFooGeneric_70266ca607804f38
+		aotLib[0x2056131d6dba3dd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo3D * , int32_t , int32_t  ),&_Func_0x60_setFooGeneric_70266ca607804f38>>();
+	};
+		// _Func_0x60_setFooGeneric_7a8da74d54e6b068
+		aotLib[0xd787a6f919f74529] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo & , int32_t , int32_t  ),&_Func_0x60_setFooGeneric_7a8da74d54e6b068>>();
+	};
+		// _Func_0x60_setFooGeneric_9f2bdf2f87e01733
+		aotLib[0x3fea94f34db681bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo3D & , int32_t , int32_t  ),&_Func_0x60_setFooGeneric_9f2bdf2f87e01733>>();
+	};
+		// setFoo_2efe8cad9c89e8be
+		aotLib[0x5c8b5f39369929fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo & , int32_t , int32_t  ),&setFoo_2efe8cad9c89e8be>>();
+	};
+		// setFooPtr_51d20c528f366bdf
+		aotLib[0x4926e1834f8150a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo * , int32_t , int32_t  ),&setFooPtr_51d20c528f366bdf>>();
+	};
+		// test_ecace6d6b3c0bc09
+		aotLib[0xa387933c541e7a86] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_ecace6d6b3c0bc09>>();
+	};
+		// test_ptr_67379821c5d2c679
+		aotLib[0x9e29aaf3101d2390] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_ptr_67379821c5d2c679>>();
+	};
+		// test_reinterpret_698df00d71a73268
+		aotLib[0x4b52c4cde7800289] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_reinterpret_698df00d71a73268>>();
+	};
+		// test_struct_a0407944ee3d9a64
+		aotLib[0x2bac8bd96b8eb711] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_struct_a0407944ee3d9a64>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
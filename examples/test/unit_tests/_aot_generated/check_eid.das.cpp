@@ -0,0 +1,108 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline uint32_t GetGoo_46dfe19e3594808e ( Context * __context__, char * const  __arg_rename_at_9 );
+inline uint32_t GetGoo2_7ae45ba38d256636 ( Context * __context__, char * const  __arg_rename_at_13 );
+inline bool test_23fdb245cc879797 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TestObjectFoo,0>(__context__);/*foo*/
+}
+
+inline uint32_t GetGoo_46dfe19e3594808e ( Context * __context__, char * const  __arg_rename_at_9 )
+{
+	return CheckEid(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0>(__context__) /*foo*/),__arg_rename_at_9,__context__);
+}
+
+inline uint32_t GetGoo2_7ae45ba38d256636 ( Context * __context__, char * const  __arg_rename_at_13 )
+{
+	return CheckEid(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0>(__context__) /*foo*/),__arg_rename_at_13,__context__);
+}
+
+inline bool test_23fdb245cc879797 ( Context * __context__ )
+{
+	uint32_t __a_rename_at_18 = (uint32_t)CheckEidHint(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0>(__context__) /*foo*/),((char *) "goo"),0x156d7762u,__context__);
+	uint32_t __b_rename_at_19 = (uint32_t)GetGoo_46dfe19e3594808e(__context__,((char *) "goo"));
+	DAS_ASSERT((__a_rename_at_18 == __b_rename_at_19));
+	uint32_t __a2_rename_at_21 = (uint32_t)CheckEid(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0>(__context__) /*foo*/),((char *) "goo"),__context__);
+	uint32_t __b2_rename_at_22 = (uint32_t)GetGoo2_7ae45ba38d256636(__context__,((char *) "goo"));
+	DAS_ASSERT((__a2_rename_at_21 == __b2_rename_at_22));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// GetGoo_46dfe19e3594808e
+		aotLib[0x2a746e3dabcf30a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, char * const   ),&GetGoo_46dfe19e3594808e>>();
+	};
+		// GetGoo2_7ae45ba38d256636
+		aotLib[0xd9cd6347c7bd15d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, char * const   ),&GetGoo2_7ae45ba38d256636>>();
+	};
+		// test_23fdb245cc879797
+		aotLib[0xb6cce820ef4cd87a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_23fdb245cc879797>>();
+	};
+		// [[ init script ]]
+		aotLib[0x30460c64b15bc66f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,544 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Foo {
+	int32_t a;
+	TArray<int32_t> b;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Bar {
+	TArray<struct Foo> z;
+};
+static_assert(sizeof(Bar)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,z)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_clone_3404df552608ce2a ( Context * __context__, TArray<struct Bar> & __a_rename_at_232, TArray<struct Bar> const  & __b_rename_at_232 );
+inline void _Funcbuiltin_0x60_clone_314c6c97dbc4114f ( Context * __context__, TArray<struct Foo> & __a_rename_at_232, TArray<struct Foo> const  & __b_rename_at_232 );
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> & __a_rename_at_232, TArray<int32_t> const  & __b_rename_at_232 );
+inline void _Funcbuiltin_0x60_clone_2044c963fbdb2e05 ( Context * __context__, TTable<int32_t,char *> & __a_rename_at_242, TTable<int32_t,char *> const  & __b_rename_at_242 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_4a6d55545da47163 ( Context * __context__, TTable<int32_t,char *> const  & __a_rename_at_262 );
+inline void _Funcbuiltin_0x60_resize_1b2c971938bfeb4b ( Context * __context__, TArray<struct Bar> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_42465f534c5c61d8 ( Context * __context__, TArray<struct Foo> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_values_a873419ea853c020 ( Context * __context__, TTable<int32_t,char *> const  & __a_rename_at_267 );
+inline void clone_8dfe58ad6ef28cae ( Context * __context__, struct Bar & __a_rename_at_7, struct Bar const  & __b_rename_at_7 );
+inline void clone_dfd9d60946ab3d77 ( Context * __context__, struct Foo & __a_rename_at_3, struct Foo const  & __b_rename_at_3 );
+inline bool test_6f2216df10db91a ( Context * __context__ );
+inline void test_clone_array_fe760db844774333 ( Context * __context__ );
+inline void test_clone_complex_e0fe44f9c6bd9fce ( Context * __context__ );
+inline void test_clone_struct_8ed0e42f8e5caa84 ( Context * __context__ );
+inline void test_clone_table_88a3286cd1c3a6c1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_3404df552608ce2a ( Context * __context__, TArray<struct Bar> &  __a_rename_at_232, TArray<struct Bar> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_1b2c971938bfeb4b(__context__,das_arg<TArray<struct Bar>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : Bar aka TT&
+		das_iterator<TArray<struct Bar>> __aV_iterator(__a_rename_at_232);
+		struct Bar * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : Bar const&
+		das_iterator<TArray<struct Bar> const > __bV_iterator(__b_rename_at_232);
+		struct Bar const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			clone_8dfe58ad6ef28cae(__context__,das_arg<struct Bar>::pass((*__aV_rename_at_234)),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_314c6c97dbc4114f ( Context * __context__, TArray<struct Foo> &  __a_rename_at_232, TArray<struct Foo> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_42465f534c5c61d8(__context__,das_arg<TArray<struct Foo>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : Foo aka TT&
+		das_iterator<TArray<struct Foo>> __aV_iterator(__a_rename_at_232);
+		struct Foo * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : Foo const&
+		das_iterator<TArray<struct Foo> const > __bV_iterator(__b_rename_at_232);
+		struct Foo const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			clone_dfd9d60946ab3d77(__context__,das_arg<struct Foo>::pass((*__aV_rename_at_234)),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> &  __a_rename_at_232, TArray<int32_t> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_232);
+		int32_t * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_232);
+		int32_t const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			das_copy((*__aV_rename_at_234),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_2044c963fbdb2e05 ( Context * __context__, TTable<int32_t,char *> &  __a_rename_at_242, TTable<int32_t,char *> const  &  __b_rename_at_242 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_244_32;
+	Sequence DAS_COMMENT((char * *)) _temp_make_local_244_48;
+	builtin_table_clear(das_arg<TTable<int32_t,char *>>::pass(__a_rename_at_242),__context__);
+	{
+		bool __need_loop_244 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_244_32 = (_Funcbuiltin_0x60_keys_4a6d55545da47163(__context__,__b_rename_at_242))));
+		int32_t const  * __k_rename_at_244;
+		__need_loop_244 = __k_iterator.first(__context__,(__k_rename_at_244)) && __need_loop_244;
+		// v : string const&
+		das_iterator<Sequence DAS_COMMENT((char * const ))> __v_iterator((_temp_make_local_244_48 = (_Funcbuiltin_0x60_values_a873419ea853c020(__context__,__b_rename_at_242))));
+		char * const  * __v_rename_at_244;
+		__need_loop_244 = __v_iterator.first(__context__,(__v_rename_at_244)) && __need_loop_244;
+		for ( ; __need_loop_244 ; __need_loop_244 = __k_iterator.next(__context__,(__k_rename_at_244)) && __v_iterator.next(__context__,(__v_rename_at_244)) )
+		{
+			das_copy(__a_rename_at_242((*__k_rename_at_244),__context__),(*__v_rename_at_244));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_244));
+		__v_iterator.close(__context__,(__v_rename_at_244));
+	};
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_4a6d55545da47163 ( Context * __context__, TTable<int32_t,char *> const  &  __a_rename_at_262 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_263; das_zero(__it_rename_at_263);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_263),__a_rename_at_262,4,__context__);
+	return /* <- */ __it_rename_at_263;
+}
+
+inline void _Funcbuiltin_0x60_resize_1b2c971938bfeb4b ( Context * __context__, TArray<struct Bar> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct Bar>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_42465f534c5c61d8 ( Context * __context__, TArray<struct Foo> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct Foo>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,32,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_values_a873419ea853c020 ( Context * __context__, TTable<int32_t,char *> const  &  __a_rename_at_267 )
+{
+	Sequence DAS_COMMENT((char * *)) __it_rename_at_268; das_zero(__it_rename_at_268);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((char * const ))>::pass(__it_rename_at_268),__a_rename_at_267,8,__context__);
+	return /* <- */ __it_rename_at_268;
+}
+
+inline void clone_8dfe58ad6ef28cae ( Context * __context__, struct Bar &  __a_rename_at_7, struct Bar const  &  __b_rename_at_7 )
+{
+	_Funcbuiltin_0x60_clone_314c6c97dbc4114f(__context__,das_arg<TArray<struct Foo>>::pass(__a_rename_at_7.z),__b_rename_at_7.z);
+}
+
+inline void clone_dfd9d60946ab3d77 ( Context * __context__, struct Foo &  __a_rename_at_3, struct Foo const  &  __b_rename_at_3 )
+{
+	das_copy(__a_rename_at_3.a,__b_rename_at_3.a);
+	_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_3.b),__b_rename_at_3.b);
+}
+
+inline bool test_6f2216df10db91a ( Context * __context__ )
+{
+	test_clone_array_fe760db844774333(__context__);
+	test_clone_table_88a3286cd1c3a6c1(__context__);
+	test_clone_struct_8ed0e42f8e5caa84(__context__);
+	test_clone_complex_e0fe44f9c6bd9fce(__context__);
+	return true;
+}
+
+inline void test_clone_array_fe760db844774333 ( Context * __context__ )
+{
+	TArray<int32_t> __x_rename_at_50; das_zero(__x_rename_at_50); TArray<int32_t> __y_rename_at_50; das_zero(__y_rename_at_50);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__x_rename_at_50),3);
+	{
+		bool __need_loop_52 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_52;
+		__need_loop_52 = __t_iterator.first(__context__,(__t_rename_at_52)) && __need_loop_52;
+		for ( ; __need_loop_52 ; __need_loop_52 = __t_iterator.next(__context__,(__t_rename_at_52)) )
+		{
+			das_copy(__x_rename_at_50(__t_rename_at_52,__context__),__t_rename_at_52);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_52));
+	};
+	_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__y_rename_at_50),das_arg<TArray<int32_t>>::pass(__x_rename_at_50));
+	{
+		bool __need_loop_55 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_55;
+		__need_loop_55 = __t_iterator.first(__context__,(__t_rename_at_55)) && __need_loop_55;
+		for ( ; __need_loop_55 ; __need_loop_55 = __t_iterator.next(__context__,(__t_rename_at_55)) )
+		{
+			das_copy(__x_rename_at_50(__t_rename_at_55,__context__),__t_rename_at_55 + 1);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_55));
+	};
+	{
+		bool __need_loop_57 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_57;
+		__need_loop_57 = __t_iterator.first(__context__,(__t_rename_at_57)) && __need_loop_57;
+		for ( ; __need_loop_57 ; __need_loop_57 = __t_iterator.next(__context__,(__t_rename_at_57)) )
+		{
+			DAS_ASSERT((__y_rename_at_50(__t_rename_at_57,__context__) == __t_rename_at_57));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_57));
+	};
+}
+
+inline void test_clone_complex_e0fe44f9c6bd9fce ( Context * __context__ )
+{
+	TArray<struct Bar> __x_rename_at_12; das_zero(__x_rename_at_12); TArray<struct Bar> __y_rename_at_12; das_zero(__y_rename_at_12);
+	_Funcbuiltin_0x60_resize_1b2c971938bfeb4b(__context__,das_arg<TArray<struct Bar>>::pass(__x_rename_at_12),2);
+	{
+		bool __need_loop_14 = true;
+		// xx : Bar&
+		das_iterator<TArray<struct Bar>> __xx_iterator(__x_rename_at_12);
+		struct Bar * __xx_rename_at_14;
+		__need_loop_14 = __xx_iterator.first(__context__,(__xx_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __xx_iterator.next(__context__,(__xx_rename_at_14)) )
+		{
+			_Funcbuiltin_0x60_resize_42465f534c5c61d8(__context__,das_arg<TArray<struct Foo>>::pass((*__xx_rename_at_14).z),4);
+			{
+				bool __need_loop_16 = true;
+				// xxx : Foo&
+				das_iterator<TArray<struct Foo>> __xxx_iterator((*__xx_rename_at_14).z);
+				struct Foo * __xxx_rename_at_16;
+				__need_loop_16 = __xxx_iterator.first(__context__,(__xxx_rename_at_16)) && __need_loop_16;
+				for ( ; __need_loop_16 ; __need_loop_16 = __xxx_iterator.next(__context__,(__xxx_rename_at_16)) )
+				{
+					das_copy((*__xxx_rename_at_16).a,5);
+					_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass((*__xxx_rename_at_16).b),3);
+					{
+						bool __need_loop_19 = true;
+						// t : int const
+						das_iterator<range> __t_iterator(range(0,3));
+						int32_t __t_rename_at_19;
+						__need_loop_19 = __t_iterator.first(__context__,(__t_rename_at_19)) && __need_loop_19;
+						for ( ; __need_loop_19 ; __need_loop_19 = __t_iterator.next(__context__,(__t_rename_at_19)) )
+						{
+							das_copy((*__xxx_rename_at_16).b(__t_rename_at_19,__context__),__t_rename_at_19);
+						}
+						__t_iterator.close(__context__,(__t_rename_at_19));
+					};
+				}
+				__xxx_iterator.close(__context__,(__xxx_rename_at_16));
+			};
+		}
+		__xx_iterator.close(__context__,(__xx_rename_at_14));
+	};
+	_Funcbuiltin_0x60_clone_3404df552608ce2a(__context__,das_arg<TArray<struct Bar>>::pass(__y_rename_at_12),das_arg<TArray<struct Bar>>::pass(__x_rename_at_12));
+	{
+		bool __need_loop_22 = true;
+		// xx : Bar&
+		das_iterator<TArray<struct Bar>> __xx_iterator(__x_rename_at_12);
+		struct Bar * __xx_rename_at_22;
+		__need_loop_22 = __xx_iterator.first(__context__,(__xx_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __xx_iterator.next(__context__,(__xx_rename_at_22)) )
+		{
+			{
+				bool __need_loop_23 = true;
+				// xxx : Foo&
+				das_iterator<TArray<struct Foo>> __xxx_iterator((*__xx_rename_at_22).z);
+				struct Foo * __xxx_rename_at_23;
+				__need_loop_23 = __xxx_iterator.first(__context__,(__xxx_rename_at_23)) && __need_loop_23;
+				for ( ; __need_loop_23 ; __need_loop_23 = __xxx_iterator.next(__context__,(__xxx_rename_at_23)) )
+				{
+					das_copy((*__xxx_rename_at_23).a,6);
+					{
+						bool __need_loop_25 = true;
+						// t : int const
+						das_iterator<range> __t_iterator(range(0,3));
+						int32_t __t_rename_at_25;
+						__need_loop_25 = __t_iterator.first(__context__,(__t_rename_at_25)) && __need_loop_25;
+						for ( ; __need_loop_25 ; __need_loop_25 = __t_iterator.next(__context__,(__t_rename_at_25)) )
+						{
+							das_copy((*__xxx_rename_at_23).b(__t_rename_at_25,__context__),__t_rename_at_25 + 1);
+						}
+						__t_iterator.close(__context__,(__t_rename_at_25));
+					};
+				}
+				__xxx_iterator.close(__context__,(__xxx_rename_at_23));
+			};
+		}
+		__xx_iterator.close(__context__,(__xx_rename_at_22));
+	};
+	{
+		bool __need_loop_27 = true;
+		// yy : Bar&
+		das_iterator<TArray<struct Bar>> __yy_iterator(__y_rename_at_12);
+		struct Bar * __yy_rename_at_27;
+		__need_loop_27 = __yy_iterator.first(__context__,(__yy_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __yy_iterator.next(__context__,(__yy_rename_at_27)) )
+		{
+			{
+				bool __need_loop_28 = true;
+				// yyy : Foo&
+				das_iterator<TArray<struct Foo>> __yyy_iterator((*__yy_rename_at_27).z);
+				struct Foo * __yyy_rename_at_28;
+				__need_loop_28 = __yyy_iterator.first(__context__,(__yyy_rename_at_28)) && __need_loop_28;
+				for ( ; __need_loop_28 ; __need_loop_28 = __yyy_iterator.next(__context__,(__yyy_rename_at_28)) )
+				{
+					DAS_ASSERT(((*__yyy_rename_at_28).a == 5));
+					{
+						bool __need_loop_30 = true;
+						// t : int const
+						das_iterator<range> __t_iterator(range(0,3));
+						int32_t __t_rename_at_30;
+						__need_loop_30 = __t_iterator.first(__context__,(__t_rename_at_30)) && __need_loop_30;
+						for ( ; __need_loop_30 ; __need_loop_30 = __t_iterator.next(__context__,(__t_rename_at_30)) )
+						{
+							DAS_ASSERT(((*__yyy_rename_at_28).b(__t_rename_at_30,__context__) == __t_rename_at_30));
+						}
+						__t_iterator.close(__context__,(__t_rename_at_30));
+					};
+				}
+				__yyy_iterator.close(__context__,(__yyy_rename_at_28));
+			};
+		}
+		__yy_iterator.close(__context__,(__yy_rename_at_27));
+	};
+}
+
+inline void test_clone_struct_8ed0e42f8e5caa84 ( Context * __context__ )
+{
+	struct Foo __x_rename_at_35; das_zero(__x_rename_at_35); struct Foo __y_rename_at_35; das_zero(__y_rename_at_35);
+	das_copy(__x_rename_at_35.a,5);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__x_rename_at_35.b),3);
+	{
+		bool __need_loop_38 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_38;
+		__need_loop_38 = __t_iterator.first(__context__,(__t_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __t_iterator.next(__context__,(__t_rename_at_38)) )
+		{
+			das_copy(__x_rename_at_35.b(__t_rename_at_38,__context__),__t_rename_at_38);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_38));
+	};
+	clone_dfd9d60946ab3d77(__context__,das_arg<struct Foo>::pass(__y_rename_at_35),das_arg<struct Foo>::pass(__x_rename_at_35));
+	das_copy(__x_rename_at_35.a,6);
+	{
+		bool __need_loop_42 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_42;
+		__need_loop_42 = __t_iterator.first(__context__,(__t_rename_at_42)) && __need_loop_42;
+		for ( ; __need_loop_42 ; __need_loop_42 = __t_iterator.next(__context__,(__t_rename_at_42)) )
+		{
+			das_copy(__x_rename_at_35.b(__t_rename_at_42,__context__),__t_rename_at_42 + 1);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_42));
+	};
+	DAS_ASSERT((__y_rename_at_35.a == 5));
+	{
+		bool __need_loop_45 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_45;
+		__need_loop_45 = __t_iterator.first(__context__,(__t_rename_at_45)) && __need_loop_45;
+		for ( ; __need_loop_45 ; __need_loop_45 = __t_iterator.next(__context__,(__t_rename_at_45)) )
+		{
+			DAS_ASSERT((__y_rename_at_35.b(__t_rename_at_45,__context__) == __t_rename_at_45));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_45));
+	};
+}
+
+inline void test_clone_table_88a3286cd1c3a6c1 ( Context * __context__ )
+{
+	TTable<int32_t,char *> __x_rename_at_62; das_zero(__x_rename_at_62); TTable<int32_t,char *> __y_rename_at_62; das_zero(__y_rename_at_62);
+	{
+		bool __need_loop_63 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_63;
+		__need_loop_63 = __t_iterator.first(__context__,(__t_rename_at_63)) && __need_loop_63;
+		for ( ; __need_loop_63 ; __need_loop_63 = __t_iterator.next(__context__,(__t_rename_at_63)) )
+		{
+			das_copy(__x_rename_at_62(__t_rename_at_63,__context__),((char *)(das_lexical_cast(__t_rename_at_63,__context__))));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_63));
+	};
+	_Funcbuiltin_0x60_clone_2044c963fbdb2e05(__context__,das_arg<TTable<int32_t,char *>>::pass(__y_rename_at_62),das_arg<TTable<int32_t,char *>>::pass(__x_rename_at_62));
+	{
+		bool __need_loop_66 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_66;
+		__need_loop_66 = __t_iterator.first(__context__,(__t_rename_at_66)) && __need_loop_66;
+		for ( ; __need_loop_66 ; __need_loop_66 = __t_iterator.next(__context__,(__t_rename_at_66)) )
+		{
+			das_copy(__x_rename_at_62(__t_rename_at_66,__context__),((char *)(das_lexical_cast(__t_rename_at_66 + 1,__context__))));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_66));
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,char *>>::pass(__y_rename_at_62)) == 3));
+	{
+		bool __need_loop_69 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_69;
+		__need_loop_69 = __t_iterator.first(__context__,(__t_rename_at_69)) && __need_loop_69;
+		for ( ; __need_loop_69 ; __need_loop_69 = __t_iterator.next(__context__,(__t_rename_at_69)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__y_rename_at_62(__t_rename_at_69,__context__)),cast<char *>::from(((char *)(das_lexical_cast(__t_rename_at_69,__context__)))),*__context__)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_69));
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_3404df552608ce2a
+		aotLib[0x8b36f06cef125ce0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Bar> & , TArray<struct Bar> const  &  ),&_Funcbuiltin_0x60_clone_3404df552608ce2a>>();
+	};
+		// _Funcbuiltin_0x60_clone_314c6c97dbc4114f
+		aotLib[0x2e948a5c3f71eb8b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , TArray<struct Foo> const  &  ),&_Funcbuiltin_0x60_clone_314c6c97dbc4114f>>();
+	};
+		// _Funcbuiltin_0x60_clone_9217fda5fb53190b
+		aotLib[0xb00d3e185e494e59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_9217fda5fb53190b>>();
+	};
+		// _Funcbuiltin_0x60_clone_2044c963fbdb2e05
+		aotLib[0xdee8181d8a759c37] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,char *> & , TTable<int32_t,char *> const  &  ),&_Funcbuiltin_0x60_clone_2044c963fbdb2e05>>();
+	};
+		// _Funcbuiltin_0x60_keys_4a6d55545da47163
+		aotLib[0xc92767d6650249a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,char *> const  &  ),&_Funcbuiltin_0x60_keys_4a6d55545da47163>>();
+	};
+		// _Funcbuiltin_0x60_resize_1b2c971938bfeb4b
+		aotLib[0xdce27ee6641f0ee5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Bar> & , int32_t  ),&_Funcbuiltin_0x60_resize_1b2c971938bfeb4b>>();
+	};
+		// _Funcbuiltin_0x60_resize_42465f534c5c61d8
+		aotLib[0x9af088cbe8d342cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , int32_t  ),&_Funcbuiltin_0x60_resize_42465f534c5c61d8>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_values_a873419ea853c020
+		aotLib[0xaa94521e9a0e3701] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char * const  &)) (*) ( Context * __context__, TTable<int32_t,char *> const  &  ),&_Funcbuiltin_0x60_values_a873419ea853c020>>();
+	};
+		// clone_8dfe58ad6ef28cae
+		aotLib[0x64a02111448f9076] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Bar & , struct Bar const  &  ),&clone_8dfe58ad6ef28cae>>();
+	};
+		// clone_dfd9d60946ab3d77
+		aotLib[0x1e04858555b94038] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo & , struct Foo const  &  ),&clone_dfd9d60946ab3d77>>();
+	};
+		// test_6f2216df10db91a
+		aotLib[0xffd028153385b5f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6f2216df10db91a>>();
+	};
+		// test_clone_array_fe760db844774333
+		aotLib[0xc915681b11a7770c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_clone_array_fe760db844774333>>();
+	};
+		// test_clone_complex_e0fe44f9c6bd9fce
+		aotLib[0x189185f610ea0eb2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_clone_complex_e0fe44f9c6bd9fce>>();
+	};
+		// test_clone_struct_8ed0e42f8e5caa84
+		aotLib[0x3e6e35b02c3c880e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_clone_struct_8ed0e42f8e5caa84>>();
+	};
+		// test_clone_table_88a3286cd1c3a6c1
+		aotLib[0x390b5a6804053a8e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_clone_table_88a3286cd1c3a6c1>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
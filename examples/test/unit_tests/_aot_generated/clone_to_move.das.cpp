@@ -0,0 +1,189 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> & __a_rename_at_232, TArray<int32_t> const  & __b_rename_at_232 );
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb ( Context * __context__, TArray<int32_t> const  & __clone_src_rename_at_220 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_398 );
+inline bool test_4bbd08b3a91096f4 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TDim<int32_t,3> _temp_make_local_2_32;
+	das_global<TArray<int32_t>,0>(__context__) = _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_2_32(0,__context__) = 1;
+		_temp_make_local_2_32(1,__context__) = 2;
+		_temp_make_local_2_32(2,__context__) = 3;
+		return _temp_make_local_2_32;
+	})())));/*g_a*/
+	das_global<TArray<int32_t>,32>(__context__) = _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb(__context__,das_global<TArray<int32_t>,0>(__context__) /*g_a*/);/*g_b*/
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> &  __a_rename_at_232, TArray<int32_t> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_232);
+		int32_t * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_232);
+		int32_t const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			das_copy((*__aV_rename_at_234),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb ( Context * __context__, TArray<int32_t> const  &  __clone_src_rename_at_220 )
+{
+	TArray<int32_t> __clone_dest_rename_at_221; das_zero(__clone_dest_rename_at_221);
+	_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__clone_dest_rename_at_221),__clone_src_rename_at_220);
+	return /* <- */ __clone_dest_rename_at_221;
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_398 )
+{
+	TArray<int32_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_399),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline bool test_4bbd08b3a91096f4 ( Context * __context__ )
+{
+	TDim<int32_t,3> _temp_make_local_10_96;
+	DAS_ASSERT(((builtin_array_size(das_global<TArray<int32_t>,0>(__context__) /*g_a*/) == 3) && (builtin_array_size(das_global<TArray<int32_t>,32>(__context__) /*g_b*/) == 3)));
+	{
+		bool __need_loop_8 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(das_global<TArray<int32_t>,0>(__context__) /*g_a*/);
+		int32_t const  * __x_rename_at_8;
+		__need_loop_8 = __x_iterator.first(__context__,(__x_rename_at_8)) && __need_loop_8;
+		// y : int const&
+		das_iterator<TArray<int32_t> const > __y_iterator(das_global<TArray<int32_t>,32>(__context__) /*g_b*/);
+		int32_t const  * __y_rename_at_8;
+		__need_loop_8 = __y_iterator.first(__context__,(__y_rename_at_8)) && __need_loop_8;
+		for ( ; __need_loop_8 ; __need_loop_8 = __x_iterator.next(__context__,(__x_rename_at_8)) && __y_iterator.next(__context__,(__y_rename_at_8)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_8) == (*__y_rename_at_8)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_8));
+		__y_iterator.close(__context__,(__y_rename_at_8));
+	};
+	TArray<int32_t> __a_rename_at_10; das_zero(__a_rename_at_10); das_move(__a_rename_at_10, (TArray<int32_t>)_Funcbuiltin_0x60_to_array_move_228cbd1e470b6291(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_10_96(0,__context__) = 1;
+		_temp_make_local_10_96(1,__context__) = 2;
+		_temp_make_local_10_96(2,__context__) = 3;
+		return _temp_make_local_10_96;
+	})()))));
+	TArray<int32_t> __b_rename_at_11; das_zero(__b_rename_at_11); das_move(__b_rename_at_11, (TArray<int32_t>)_Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb(__context__,__a_rename_at_10));
+	DAS_ASSERT(((builtin_array_size(__a_rename_at_10) == 3) && (builtin_array_size(__b_rename_at_11) == 3)));
+	{
+		bool __need_loop_13 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_10);
+		int32_t const  * __x_rename_at_13;
+		__need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13)) && __need_loop_13;
+		// y : int const&
+		das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_11);
+		int32_t const  * __y_rename_at_13;
+		__need_loop_13 = __y_iterator.first(__context__,(__y_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13)) && __y_iterator.next(__context__,(__y_rename_at_13)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_13) == (*__y_rename_at_13)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_13));
+		__y_iterator.close(__context__,(__y_rename_at_13));
+	};
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_9217fda5fb53190b
+		aotLib[0xb00d3e185e494e59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_9217fda5fb53190b>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb
+		aotLib[0x763662b86d69e114] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_to_move_60744b4ef03c58cb>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291
+		aotLib[0xc37e6f73e998be11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_228cbd1e470b6291>>();
+	};
+		// test_4bbd08b3a91096f4
+		aotLib[0x5c1503cb5538b66a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_4bbd08b3a91096f4>>();
+	};
+		// [[ init script ]]
+		aotLib[0x1b2977927b003e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,136 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct S1 {
+	int64_t a;
+	int64_t b;
+	int32_t c;
+};
+static_assert(sizeof(S1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(S1,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(S1,b)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(S1,c)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct S2 {
+	int64_t a;
+	int64_t b;
+	int32_t c;
+	int32_t d;
+};
+static_assert(sizeof(S2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(S2,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(S2,b)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(S2,c)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(S2,d)==20,"structure field offset mismatch with DAS");
+}
+
+#if 0 // skipping structure CppS1 declaration due to CPP layoutnamespace  {
+
+struct CppS1 {
+	void * vtable;
+	int64_t b;
+	int32_t c;
+};
+static_assert(sizeof(CppS1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(CppS1,vtable)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(CppS1,b)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(CppS1,c)==16,"structure field offset mismatch with DAS");
+}
+#endif // end of skipping structure CppS1 declaration due to CPP layout
+
+#if 0 // skipping structure CppS2 declaration due to CPP layoutnamespace  {
+
+struct CppS2 : CppS1 {
+	/* skipping vtable, from CppS1 */
+	/* skipping b, from CppS1 */
+	/* skipping c, from CppS1 */
+	int32_t d;
+};
+static_assert(sizeof(CppS2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(CppS2,vtable)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(CppS2,b)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(CppS2,c)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(CppS2,d)==20,"structure field offset mismatch with DAS");
+}
+#endif // end of skipping structure CppS2 declaration due to CPP layout
+
+inline bool test_9fca23f6d69e1b24 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_9fca23f6d69e1b24 ( Context * __context__ )
+{
+	DAS_VERIFY((24 == CppS1Size()));
+	DAS_VERIFY((24 == CppS2Size()));
+	DAS_VERIFY((20 == CppS2DOffset()));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_9fca23f6d69e1b24
+		aotLib[0x92d5c5041f0090e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9fca23f6d69e1b24>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,126 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Foo {
+	int32_t i;
+	float f;
+	char * s;
+	int64_t n;
+};
+static_assert(sizeof(Foo)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,i)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,f)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,s)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,n)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Bar {
+	int32_t i;
+};
+static_assert(sizeof(Bar)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,i)==0,"structure field offset mismatch with DAS");
+}
+
+inline struct Bar Bar_4bb174d95ee89deb ( Context * __context__ );
+inline struct Foo Foo_9d6bd2e1e6f0ff8e ( Context * __context__ );
+inline bool test_35422e763ebb28ea ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline struct Bar Bar_4bb174d95ee89deb ( Context * __context__ )
+{
+	struct Bar __b_rename_at_13; das_zero(__b_rename_at_13);
+	das_copy(__b_rename_at_13.i,13);
+	return __b_rename_at_13;
+}
+
+inline struct Foo Foo_9d6bd2e1e6f0ff8e ( Context * __context__ )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_3;
+		das_zero(__mks_3);
+		das_copy((__mks_3.i),(5));
+		das_copy((__mks_3.f),(6.f));
+		das_copy((__mks_3.s),(((char *) "hello")));
+		return __mks_3;
+	})());
+}
+
+inline bool test_35422e763ebb28ea ( Context * __context__ )
+{
+	struct Foo __t_rename_at_19 = (struct Foo)Foo_9d6bd2e1e6f0ff8e(__context__);
+	DAS_ASSERT((__t_rename_at_19.i == 5));
+	struct Bar __b_rename_at_21 = (struct Bar)Bar_4bb174d95ee89deb(__context__);
+	DAS_ASSERT((__b_rename_at_21.i == 13));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Bar_4bb174d95ee89deb
+		aotLib[0x11f323a7c7639105] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Bar (*) ( Context * __context__ ),&Bar_4bb174d95ee89deb>>();
+	};
+		// Foo_9d6bd2e1e6f0ff8e
+		aotLib[0xf774e815e2e50c85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__ ),&Foo_9d6bd2e1e6f0ff8e>>();
+	};
+		// test_35422e763ebb28ea
+		aotLib[0xfb549f36bce3715c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_35422e763ebb28ea>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
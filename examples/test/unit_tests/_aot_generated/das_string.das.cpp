@@ -0,0 +1,101 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__8ce26751;
+extern VarInfo __var_info__a984dff8;
+extern VarInfo __var_info__3dd1e762;
+extern FuncInfo __func_info__3d4483eb;
+
+VarInfo __func_info__3d4483eb_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3dd1e762, "s", 0 };
+VarInfo __func_info__3d4483eb_field_1 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa984dff8, "s2", 0 };
+VarInfo * __func_info__3d4483eb_fields[2] =  { &__func_info__3d4483eb_field_0, &__func_info__3d4483eb_field_1 };
+FuncInfo __func_info__3d4483eb = {"invoke block<(s:$::das_string -const;s2:$::das_string -const):void> const", "", __func_info__3d4483eb_fields, 2, 32, &__type_info__48b5725f, nullptr,0,0x3d4483eb, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__8ce26751 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8ce26751 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__8ce26751 };
+TypeInfo * __tinfo_1[1] = { &__type_info__8ce26751 };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline bool test_5e892e5ff4b24565 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_5e892e5ff4b24565 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"test " DAS_FILE_LINE);
+{
+	test_das_string(das_make_block<void,das::string &,das::string &>(__context__,80,0,&__func_info__3d4483eb,[&](das::string & __s_rename_at_7, das::string & __s2_rename_at_7)->void{
+		set_das_string(das_arg<das::string>::pass(__s2_rename_at_7),((char *) "test_das_string"));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<das::string &>::from(__s_rename_at_7)))),cast<char *>::from(((char *) "test_das_string")),*__context__)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(((char *)(to_das_string(das_arg<das::string>::pass(__s_rename_at_7),__context__)))),cast<char *>::from(((char *) "test_das_string")),*__context__)));
+		peek_das_string_T(das_arg<das::string>::pass(__s_rename_at_7),[&](char * const  __st_rename_at_11)->void{
+			DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__st_rename_at_11),cast<char *>::from(((char *) "test_das_string")),*__context__)));
+		},__context__);
+		set_das_string(das_arg<das::string>::pass(__s_rename_at_7),((char *) "out_of_it"));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<das::string &>::from(__s_rename_at_7)))),cast<char *>::from(((char *) "out_of_it")),*__context__)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(((char *)(to_das_string(das_arg<das::string>::pass(__s_rename_at_7),__context__)))),cast<char *>::from(((char *) "out_of_it")),*__context__)));
+	}),__context__);
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_5e892e5ff4b24565
+		aotLib[0xb3cc06ec5f9d9299] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5e892e5ff4b24565>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
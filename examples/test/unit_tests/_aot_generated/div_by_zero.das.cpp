@@ -0,0 +1,311 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline double _Func_0x60_div_by_zero_1f4a6412d6a82fe2 ( Context * __context__, double __num_rename_at_2 );
+inline float _Func_0x60_div_by_zero_b08667a940649cd7 ( Context * __context__, float __num_rename_at_2 );
+inline int32_t _Func_0x60_div_by_zero_6cc8ccad36b48454 ( Context * __context__, int32_t __num_rename_at_2 );
+inline int64_t _Func_0x60_div_by_zero_4defa0634587997a ( Context * __context__, int64_t __num_rename_at_2 );
+inline uint32_t _Func_0x60_div_by_zero_2128e4214fe86fb5 ( Context * __context__, uint32_t __num_rename_at_2 );
+inline uint64_t _Func_0x60_div_by_zero_7c11119c69cc2167 ( Context * __context__, uint64_t __num_rename_at_2 );
+inline double _Func_0x60_mod_by_zero_3f98a9ef6d244793 ( Context * __context__, double __num_rename_at_12 );
+inline float _Func_0x60_mod_by_zero_ca5803c1700eae3c ( Context * __context__, float __num_rename_at_12 );
+inline int32_t _Func_0x60_mod_by_zero_48ad6db367d27c4f ( Context * __context__, int32_t __num_rename_at_12 );
+inline int64_t _Func_0x60_mod_by_zero_bd330b4d741f866d ( Context * __context__, int64_t __num_rename_at_12 );
+inline uint32_t _Func_0x60_mod_by_zero_771f4a2cfd36eef0 ( Context * __context__, uint32_t __num_rename_at_12 );
+inline uint64_t _Func_0x60_mod_by_zero_8387f75521df513e ( Context * __context__, uint64_t __num_rename_at_12 );
+inline bool test_69572efd2186cf2a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline double _Func_0x60_div_by_zero_1f4a6412d6a82fe2 ( Context * __context__, double __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<double>::Div(__num_rename_at_2,0,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return __num_rename_at_2;
+}
+
+inline float _Func_0x60_div_by_zero_b08667a940649cd7 ( Context * __context__, float __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<float>::Div(__num_rename_at_2,0.f,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return __num_rename_at_2;
+}
+
+inline int32_t _Func_0x60_div_by_zero_6cc8ccad36b48454 ( Context * __context__, int32_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<int32_t>::Div(__num_rename_at_2,0,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return __num_rename_at_2;
+}
+
+inline int64_t _Func_0x60_div_by_zero_4defa0634587997a ( Context * __context__, int64_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<int64_t>::Div(__num_rename_at_2,0ll,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return __num_rename_at_2;
+}
+
+inline uint32_t _Func_0x60_div_by_zero_2128e4214fe86fb5 ( Context * __context__, uint32_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<uint32_t>::Div(__num_rename_at_2,0x0u,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return __num_rename_at_2;
+}
+
+inline uint64_t _Func_0x60_div_by_zero_7c11119c69cc2167 ( Context * __context__, uint64_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<uint64_t>::Div(__num_rename_at_2,0x0ull,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return __num_rename_at_2;
+}
+
+inline double _Func_0x60_mod_by_zero_3f98a9ef6d244793 ( Context * __context__, double __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<double>::Mod(__num_rename_at_12,0,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return __num_rename_at_12;
+}
+
+inline float _Func_0x60_mod_by_zero_ca5803c1700eae3c ( Context * __context__, float __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<float>::Mod(__num_rename_at_12,0.f,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return __num_rename_at_12;
+}
+
+inline int32_t _Func_0x60_mod_by_zero_48ad6db367d27c4f ( Context * __context__, int32_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<int32_t>::Mod(__num_rename_at_12,0,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return __num_rename_at_12;
+}
+
+inline int64_t _Func_0x60_mod_by_zero_bd330b4d741f866d ( Context * __context__, int64_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<int64_t>::Mod(__num_rename_at_12,0ll,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return __num_rename_at_12;
+}
+
+inline uint32_t _Func_0x60_mod_by_zero_771f4a2cfd36eef0 ( Context * __context__, uint32_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<uint32_t>::Mod(__num_rename_at_12,0x0u,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return __num_rename_at_12;
+}
+
+inline uint64_t _Func_0x60_mod_by_zero_8387f75521df513e ( Context * __context__, uint64_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return SimPolicy<uint64_t>::Mod(__num_rename_at_12,0x0ull,*__context__);
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return __num_rename_at_12;
+}
+
+inline bool test_69572efd2186cf2a ( Context * __context__ )
+{
+	DAS_VERIFY((_Func_0x60_div_by_zero_6cc8ccad36b48454(__context__,1) == 1));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_48ad6db367d27c4f(__context__,1) == 1));
+	DAS_VERIFY((_Func_0x60_div_by_zero_2128e4214fe86fb5(__context__,0x1u) == 0x1u));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_771f4a2cfd36eef0(__context__,0x1u) == 0x1u));
+	DAS_VERIFY((_Func_0x60_div_by_zero_4defa0634587997a(__context__,1ll) == 1ll));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_bd330b4d741f866d(__context__,1ll) == 1ll));
+	DAS_VERIFY((_Func_0x60_div_by_zero_7c11119c69cc2167(__context__,0x1ull) == 0x1ull));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_8387f75521df513e(__context__,0x1ull) == 0x1ull));
+	DAS_VERIFY((_Func_0x60_div_by_zero_b08667a940649cd7(__context__,1.f) == 1.f));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_ca5803c1700eae3c(__context__,1.f) == 1.f));
+	DAS_VERIFY((_Func_0x60_div_by_zero_1f4a6412d6a82fe2(__context__,1) == 1));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_3f98a9ef6d244793(__context__,1) == 1));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_div_by_zero_1f4a6412d6a82fe2
+		aotLib[0x3832d36137f4a235] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<double (*) ( Context * __context__, double  ),&_Func_0x60_div_by_zero_1f4a6412d6a82fe2>>();
+	};
+		// _Func_0x60_div_by_zero_b08667a940649cd7
+		aotLib[0x68ebc942b221453d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float  ),&_Func_0x60_div_by_zero_b08667a940649cd7>>();
+	};
+		// _Func_0x60_div_by_zero_6cc8ccad36b48454
+		aotLib[0xf25dcd7da8a87a51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_div_by_zero_6cc8ccad36b48454>>();
+	};
+		// _Func_0x60_div_by_zero_4defa0634587997a
+		aotLib[0xc8b750864a797179] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int64_t (*) ( Context * __context__, int64_t  ),&_Func_0x60_div_by_zero_4defa0634587997a>>();
+	};
+		// _Func_0x60_div_by_zero_2128e4214fe86fb5
+		aotLib[0xd431de4da08de40d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, uint32_t  ),&_Func_0x60_div_by_zero_2128e4214fe86fb5>>();
+	};
+		// _Func_0x60_div_by_zero_7c11119c69cc2167
+		aotLib[0x9852eb7967897379] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, uint64_t  ),&_Func_0x60_div_by_zero_7c11119c69cc2167>>();
+	};
+		// _Func_0x60_mod_by_zero_3f98a9ef6d244793
+		aotLib[0x939dcb27c3fc49c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<double (*) ( Context * __context__, double  ),&_Func_0x60_mod_by_zero_3f98a9ef6d244793>>();
+	};
+		// _Func_0x60_mod_by_zero_ca5803c1700eae3c
+		aotLib[0x4f8eb9d65f5538f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float  ),&_Func_0x60_mod_by_zero_ca5803c1700eae3c>>();
+	};
+		// _Func_0x60_mod_by_zero_48ad6db367d27c4f
+		aotLib[0x5cb467ea19c6cc19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_mod_by_zero_48ad6db367d27c4f>>();
+	};
+		// _Func_0x60_mod_by_zero_bd330b4d741f866d
+		aotLib[0x30ed27edc6376125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int64_t (*) ( Context * __context__, int64_t  ),&_Func_0x60_mod_by_zero_bd330b4d741f866d>>();
+	};
+		// _Func_0x60_mod_by_zero_771f4a2cfd36eef0
+		aotLib[0x6cb2ce39d02ee7e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, uint32_t  ),&_Func_0x60_mod_by_zero_771f4a2cfd36eef0>>();
+	};
+		// _Func_0x60_mod_by_zero_8387f75521df513e
+		aotLib[0xdd332083607c030d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, uint64_t  ),&_Func_0x60_mod_by_zero_8387f75521df513e>>();
+	};
+		// test_69572efd2186cf2a
+		aotLib[0xc1a11c0d1b2b9bf4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_69572efd2186cf2a>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,135 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require haha
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace haha {
+
+struct Foo {
+	int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_finalize_17dcb092398d1c9a ( Context * __context__, TArray<struct haha::Foo> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_168311e0502fb150 ( Context * __context__, TArray<struct haha::Foo> & __Arr_rename_at_40, struct haha::Foo const  & __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void finalize_4b59a25352e5c242 ( Context * __context__, struct haha::Foo & __f_rename_at_9 );
+inline bool test_69c161bf10ed5540 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<bool,0>(__context__) = false;/*all_good*/
+}
+
+inline void _Funcbuiltin_0x60_finalize_17dcb092398d1c9a ( Context * __context__, TArray<struct haha::Foo> &  __a_rename_at_285 )
+{
+	{
+		bool __need_loop_287 = true;
+		// aV : haha::Foo aka TT&
+		das_iterator<TArray<struct haha::Foo>> __aV_iterator(__a_rename_at_285);
+		struct haha::Foo * __aV_rename_at_287;
+		__need_loop_287 = __aV_iterator.first(__context__,(__aV_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __aV_iterator.next(__context__,(__aV_rename_at_287)) )
+		{
+			finalize_4b59a25352e5c242(__context__,das_arg<struct haha::Foo>::pass((*__aV_rename_at_287)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_287));
+	};
+	builtin_array_free(das_arg<TArray<struct haha::Foo>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_168311e0502fb150 ( Context * __context__, TArray<struct haha::Foo> &  __Arr_rename_at_40, struct haha::Foo const  &  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<struct haha::Foo>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void finalize_4b59a25352e5c242 ( Context * __context__, struct haha::Foo &  __f_rename_at_9 )
+{
+	das_copy(das_global<bool,0>(__context__) /*all_good*/,true);
+}
+
+inline bool test_69c161bf10ed5540 ( Context * __context__ )
+{
+	struct haha::Foo _temp_make_local_15_64;
+	TArray<struct haha::Foo> __arr_rename_at_14; das_zero(__arr_rename_at_14);
+	_Funcbuiltin_0x60_push_168311e0502fb150(__context__,das_arg<TArray<struct haha::Foo>>::pass(__arr_rename_at_14),das_arg<struct haha::Foo>::pass((([&]() -> struct haha::Foo& {
+		das_copy((_temp_make_local_15_64.a),(1));
+		return _temp_make_local_15_64;
+	})())),-1);
+	_Funcbuiltin_0x60_finalize_17dcb092398d1c9a(__context__,das_arg<TArray<struct haha::Foo>>::pass(__arr_rename_at_14));
+	DAS_ASSERT((das_global<bool,0>(__context__) /*all_good*/));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_17dcb092398d1c9a
+		aotLib[0x608fa1d737d90eb7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct haha::Foo> &  ),&_Funcbuiltin_0x60_finalize_17dcb092398d1c9a>>();
+	};
+		// _Funcbuiltin_0x60_push_168311e0502fb150
+		aotLib[0xeadea4961b878715] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct haha::Foo> & , struct haha::Foo const  & , int32_t  ),&_Funcbuiltin_0x60_push_168311e0502fb150>>();
+	};
+		// finalize_4b59a25352e5c242
+		aotLib[0x91c59e4112a173c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct haha::Foo &  ),&finalize_4b59a25352e5c242>>();
+	};
+		// test_69c161bf10ed5540
+		aotLib[0x708b3588725f3982] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_69c161bf10ed5540>>();
+	};
+		// [[ init script ]]
+		aotLib[0x4cb4c096cc7fd04a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
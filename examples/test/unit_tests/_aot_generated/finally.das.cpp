@@ -0,0 +1,239 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline int32_t func_finally_13619409d70f1fe4 ( Context * __context__ );
+inline int32_t one_be260723d5547fe3 ( Context * __context__ );
+inline bool test_4c13d1046b5a30ef ( Context * __context__ );
+inline void test_block_finally_a8acb5de369b44ce ( Context * __context__ );
+inline bool test_for_finally_6164ae6a866653aa ( Context * __context__ );
+inline void test_func_finally_48df3c63bdf5befd ( Context * __context__ );
+inline bool test_if_finally_1921b19f747ac9a6 ( Context * __context__ );
+inline bool test_while_finally_feece27992560193 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0>(__context__) = 1;/*ONE*/
+	das_global<int32_t,16>(__context__) = 0;/*glob*/
+	das_global<int32_t,32>(__context__) = 0;/*glob_count*/
+}
+
+inline int32_t func_finally_13619409d70f1fe4 ( Context * __context__ )
+{
+/* finally */ auto __finally_63= das_finally([&](){
+	das_copy(das_global<int32_t,16>(__context__) /*glob*/,13);
+	das_global<int32_t,32>(__context__) /*glob_count*/++;
+/* end finally */ });
+	return 12;
+}
+
+inline int32_t one_be260723d5547fe3 ( Context * __context__ )
+{
+	das_copy(das_global<int32_t,0>(__context__) /*ONE*/,1);
+	DAS_ASSERT((das_global<int32_t,0>(__context__) /*ONE*/ == 1));
+	return das_global<int32_t,0>(__context__) /*ONE*/;
+}
+
+inline bool test_4c13d1046b5a30ef ( Context * __context__ )
+{
+	test_block_finally_a8acb5de369b44ce(__context__);
+	test_for_finally_6164ae6a866653aa(__context__);
+	test_if_finally_1921b19f747ac9a6(__context__);
+	test_while_finally_feece27992560193(__context__);
+	test_func_finally_48df3c63bdf5befd(__context__);
+	return true;
+}
+
+inline void test_block_finally_a8acb5de369b44ce ( Context * __context__ )
+{
+	int32_t __t_rename_at_76 = 0;
+	das_invoke<void>::invoke(__context__,[&]()->void{
+	/* finally */ auto __finally_77= das_finally([&](){
+		das_copy(__t_rename_at_76,2);
+	/* end finally */ });
+		das_copy(__t_rename_at_76,1);
+	});
+	DAS_ASSERT((__t_rename_at_76 == 2));
+}
+
+inline bool test_for_finally_6164ae6a866653aa ( Context * __context__ )
+{
+	int32_t __uno_rename_at_22; memset(&__uno_rename_at_22,0,sizeof(__uno_rename_at_22));
+	TDim<int32_t,10> __t_rename_at_19; das_zero(__t_rename_at_19);
+	int32_t __count_rename_at_20 = 0;
+	{
+		bool __need_loop_21 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_21;
+		__need_loop_21 = __x_iterator.first(__context__,(__x_rename_at_21)) && __need_loop_21;
+	/* finally */ auto __finally_22= das_finally([&](){
+		das_copy(__t_rename_at_19(9,__context__),13);
+		(__count_rename_at_20 += __uno_rename_at_22);
+	/* end finally */ });
+		for ( ; __need_loop_21 ; __need_loop_21 = __x_iterator.next(__context__,(__x_rename_at_21)) )
+		{
+			__uno_rename_at_22 = (int32_t)one_be260723d5547fe3(__context__);
+			das_copy(__t_rename_at_19(__x_rename_at_21,__context__),__x_rename_at_21 + __uno_rename_at_22);
+			if ( __x_rename_at_21 == 5 )
+			{
+				break;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_21));
+	};
+	DAS_ASSERT(((__count_rename_at_20 == 1) && (__t_rename_at_19(9,__context__) == 13)));
+	return true;
+}
+
+inline void test_func_finally_48df3c63bdf5befd ( Context * __context__ )
+{
+	das_copy(das_global<int32_t,16>(__context__) /*glob*/,0);
+	das_copy(das_global<int32_t,32>(__context__) /*glob_count*/,0);
+	int32_t __t_rename_at_71 = (int32_t)func_finally_13619409d70f1fe4(__context__);
+	DAS_ASSERT((((__t_rename_at_71 == 12) && (das_global<int32_t,16>(__context__) /*glob*/ == 13)) && (das_global<int32_t,32>(__context__) /*glob_count*/ == 1)));
+}
+
+inline bool test_if_finally_1921b19f747ac9a6 ( Context * __context__ )
+{
+	TDim<int32_t,10> __t_rename_at_5; das_zero(__t_rename_at_5);
+	int32_t __count_rename_at_6 = 0;
+	{
+		bool __need_loop_7 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_7;
+		__need_loop_7 = __x_iterator.first(__context__,(__x_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __x_iterator.next(__context__,(__x_rename_at_7)) )
+		{
+			das_copy(__t_rename_at_5(__x_rename_at_7,__context__),__x_rename_at_7 + 1);
+			if ( __x_rename_at_7 == 5 )
+			{
+			/* finally */ auto __finally_10= das_finally([&](){
+				das_copy(__t_rename_at_5(9,__context__),13);
+				__count_rename_at_6++;
+			/* end finally */ });
+				break;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_7));
+	};
+	DAS_ASSERT(((__count_rename_at_6 == 1) && (__t_rename_at_5(9,__context__) == 13)));
+	return true;
+}
+
+inline bool test_while_finally_feece27992560193 ( Context * __context__ )
+{
+	int32_t __uno_rename_at_47; memset(&__uno_rename_at_47,0,sizeof(__uno_rename_at_47));
+	TDim<int32_t,10> __t_rename_at_43; das_zero(__t_rename_at_43);
+	int32_t __count_rename_at_44 = 0;
+	int32_t __x_rename_at_45 = 0;
+	{
+	/* finally */ auto __finally_47= das_finally([&](){
+		das_copy(__t_rename_at_43(9,__context__),(12 + __uno_rename_at_47));
+		__count_rename_at_44++;
+	/* end finally */ });
+		while ( __x_rename_at_45 != 10 )
+		{
+			__uno_rename_at_47 = (int32_t)one_be260723d5547fe3(__context__);
+			das_copy(__t_rename_at_43(__x_rename_at_45,__context__),__x_rename_at_45 + __uno_rename_at_47);
+			if ( __x_rename_at_45 == 5 )
+			{
+				break;
+			} else {
+				++__x_rename_at_45;
+			};
+		}
+	};
+	DAS_ASSERT(((__count_rename_at_44 == 1) && (__t_rename_at_43(9,__context__) == 13)));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// func_finally_13619409d70f1fe4
+		aotLib[0x8af92709bf89ed01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&func_finally_13619409d70f1fe4>>();
+	};
+		// one_be260723d5547fe3
+		aotLib[0x5ce7eedf688cb631] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&one_be260723d5547fe3>>();
+	};
+		// test_4c13d1046b5a30ef
+		aotLib[0xe932317ca96306d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_4c13d1046b5a30ef>>();
+	};
+		// test_block_finally_a8acb5de369b44ce
+		aotLib[0xfb19177e0f0bea71] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_block_finally_a8acb5de369b44ce>>();
+	};
+		// test_for_finally_6164ae6a866653aa
+		aotLib[0x960328d69c602f6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_for_finally_6164ae6a866653aa>>();
+	};
+		// test_func_finally_48df3c63bdf5befd
+		aotLib[0x366c1b5055104c3f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_func_finally_48df3c63bdf5befd>>();
+	};
+		// test_if_finally_1921b19f747ac9a6
+		aotLib[0x3841a135ea96ffe9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_if_finally_1921b19f747ac9a6>>();
+	};
+		// test_while_finally_feece27992560193
+		aotLib[0xf2197294a677ec36] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_while_finally_feece27992560193>>();
+	};
+		// [[ init script ]]
+		aotLib[0x9ca6ace6280c110] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,105 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline bool _FuncUnitTest_0x60_start_effect_1e2eade881d0b509 ( Context * __context__, char * const  __name_rename_at_3, float3x4 const  & __tm_rename_at_3 );
+inline bool on_armor_hit_fx_effect_es_623d1dd04c9aa6dd ( Context * __context__, char * const  __visual_armor_hit_dot_effectName_rename_at_4 );
+inline bool test_45a139bd4db44467 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _FuncUnitTest_0x60_start_effect_1e2eade881d0b509 ( Context * __context__, char * const  __name_rename_at_3, float3x4 const  &  __tm_rename_at_3 )
+{
+	return start_effect(__name_rename_at_3,__tm_rename_at_3,1.f);
+}
+
+inline bool on_armor_hit_fx_effect_es_623d1dd04c9aa6dd ( Context * __context__, char * const  __visual_armor_hit_dot_effectName_rename_at_4 )
+{
+	float3x4 __tm_rename_at_5; das_zero(__tm_rename_at_5);
+	float3x4_identity(das_arg<float3x4>::pass(__tm_rename_at_5));
+	return _FuncUnitTest_0x60_start_effect_1e2eade881d0b509(__context__,__visual_armor_hit_dot_effectName_rename_at_4,das_arg<float3x4>::pass(__tm_rename_at_5));
+}
+
+inline bool test_45a139bd4db44467 ( Context * __context__ )
+{
+	DAS_VERIFY((!on_armor_hit_fx_effect_es_623d1dd04c9aa6dd(__context__,((char *) "test"))));
+	float3x4 __tm_rename_at_12; das_zero(__tm_rename_at_12);
+	float3x4_identity(das_arg<float3x4>::pass(__tm_rename_at_12));
+	_FuncUnitTest_0x60_start_effect_1e2eade881d0b509(__context__,((char *) "test-test"),das_arg<float3x4>::pass(__tm_rename_at_12));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _FuncUnitTest_0x60_start_effect_1e2eade881d0b509
+		aotLib[0xe724e52577b95329] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const  , float3x4 const  &  ),&_FuncUnitTest_0x60_start_effect_1e2eade881d0b509>>();
+	};
+		// on_armor_hit_fx_effect_es_623d1dd04c9aa6dd
+		aotLib[0xdc042d18981b27af] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const   ),&on_armor_hit_fx_effect_es_623d1dd04c9aa6dd>>();
+	};
+		// test_45a139bd4db44467
+		aotLib[0xb9364c6a9a4691de] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_45a139bd4db44467>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,5377 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require functional
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__632e7ca6;
+extern StructInfo __struct_info__44989078;
+extern StructInfo __struct_info__2c66e33;
+extern StructInfo __struct_info__db339c93;
+extern StructInfo __struct_info__e2118965;
+extern StructInfo __struct_info__de33a14c;
+extern StructInfo __struct_info__9feadc05;
+extern StructInfo __struct_info__b79e1c01;
+extern StructInfo __struct_info__f5ea5153;
+extern StructInfo __struct_info__3a289c3d;
+extern StructInfo __struct_info__e7130a75;
+extern StructInfo __struct_info__4b8ba355;
+extern StructInfo __struct_info__531ce5d3;
+extern StructInfo __struct_info__d5e64c8c;
+extern StructInfo __struct_info__237acdb7;
+extern StructInfo __struct_info__67c568ab;
+extern StructInfo __struct_info__3a106938;
+extern StructInfo __struct_info__278f712d;
+extern StructInfo __struct_info__e751e179;
+extern StructInfo __struct_info__6036ac89;
+extern StructInfo __struct_info__227acc24;
+extern StructInfo __struct_info__e033a472;
+extern StructInfo __struct_info__e651dfe6;
+extern StructInfo __struct_info__98b62e70;
+extern StructInfo __struct_info__6bf82f0c;
+extern StructInfo __struct_info__6df83232;
+extern StructInfo __struct_info__f8630aea;
+extern StructInfo __struct_info__e133a605;
+extern StructInfo __struct_info__1f74a4fc;
+extern StructInfo __struct_info__5099bec2;
+extern StructInfo __struct_info__79b6706b;
+extern StructInfo __struct_info__cac0e8cb;
+extern StructInfo __struct_info__b25466c1;
+extern StructInfo __struct_info__a4bdadf1;
+extern StructInfo __struct_info__712a5427;
+extern StructInfo __struct_info__6f5517f1;
+extern TypeInfo __type_info__d238d5a8;
+extern TypeInfo __type_info__6c914b27;
+extern TypeInfo __type_info__d27d2f5d;
+extern TypeInfo __type_info__8b19aaba;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__db3d6827;
+extern TypeInfo __type_info__73acd24d;
+extern TypeInfo __type_info__b4ab2da3;
+extern TypeInfo __type_info__564b8c0f;
+extern TypeInfo __type_info__35e3c4e4;
+extern TypeInfo __type_info__f96efa8d;
+extern TypeInfo __type_info__45839f1;
+extern TypeInfo __type_info__5b038296;
+extern TypeInfo __type_info__76f93d21;
+extern TypeInfo __type_info__fc05925b;
+extern TypeInfo __type_info__ee787d42;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__575f76e9;
+extern TypeInfo __type_info__4a052b5;
+extern TypeInfo __type_info__b57008b;
+extern TypeInfo __type_info__1078e869;
+extern TypeInfo __type_info__146e3c83;
+extern TypeInfo __type_info__1314879c;
+extern TypeInfo __type_info__3c15753;
+extern TypeInfo __type_info__b7e6d021;
+extern TypeInfo __type_info__df321397;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__636e62a1;
+extern TypeInfo __type_info__d9e606f9;
+extern TypeInfo __type_info__16899671;
+extern TypeInfo __type_info__59047065;
+extern TypeInfo __type_info__f1b9498d;
+extern TypeInfo __type_info__37f8377d;
+extern TypeInfo __type_info__8dc06b9a;
+extern TypeInfo __type_info__1414892f;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__1983f0e3;
+extern TypeInfo __type_info__260b3481;
+extern TypeInfo __type_info__479b2884;
+extern TypeInfo __type_info__21ca7a51;
+extern TypeInfo __type_info__63564868;
+extern TypeInfo __type_info__413b3264;
+extern TypeInfo __type_info__d7010bfb;
+extern TypeInfo __type_info__76b9d575;
+extern TypeInfo __type_info__d8d67e29;
+extern TypeInfo __type_info__3cb1ffa2;
+extern TypeInfo __type_info__fea04943;
+extern TypeInfo __type_info__cf91711b;
+extern TypeInfo __type_info__f9c3b13b;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__20ca78be;
+extern TypeInfo __type_info__4f1f8183;
+extern TypeInfo __type_info__ac13bbb3;
+extern TypeInfo __type_info__b42f8ab2;
+extern TypeInfo __type_info__1f07c8fa;
+extern TypeInfo __type_info__8bc49635;
+extern TypeInfo __type_info__a6c45d85;
+extern TypeInfo __type_info__3a05122;
+extern TypeInfo __type_info__38e3c99d;
+extern TypeInfo __type_info__8919a794;
+extern TypeInfo __type_info__3ab1fc7c;
+extern TypeInfo __type_info__34f42543;
+extern TypeInfo __type_info__a969907c;
+extern TypeInfo __type_info__82115e6d;
+extern TypeInfo __type_info__3a28fb9;
+extern TypeInfo __type_info__58ba7e63;
+extern TypeInfo __type_info__430d762d;
+extern TypeInfo __type_info__e5bb2fbb;
+extern TypeInfo __type_info__34ea7395;
+extern TypeInfo __type_info__e09ef0a0;
+extern TypeInfo __type_info__a9c65abe;
+extern TypeInfo __type_info__cd314265;
+extern TypeInfo __type_info__ffd30770;
+extern TypeInfo __type_info__8f9c436d;
+extern TypeInfo __type_info__32e3c02b;
+extern TypeInfo __type_info__da3d6694;
+extern TypeInfo __type_info__575c1f43;
+extern TypeInfo __type_info__3bc97285;
+extern TypeInfo __type_info__6df81eef;
+extern TypeInfo __type_info__d7d67c96;
+extern TypeInfo __type_info__9b0d4e04;
+extern TypeInfo __type_info__37e3c80a;
+extern TypeInfo __type_info__fc8e246c;
+extern TypeInfo __type_info__cb86e0e0;
+extern TypeInfo __type_info__ad459a25;
+extern TypeInfo __type_info__cbd13238;
+extern TypeInfo __type_info__70b9d639;
+extern TypeInfo __type_info__1a04dfc;
+extern VarInfo __var_info__e6e0c6e9;
+extern VarInfo __var_info__7a666790;
+extern VarInfo __var_info__870881e2;
+extern VarInfo __var_info__84741750;
+extern VarInfo __var_info__c904cee5;
+extern VarInfo __var_info__ee29c2be;
+extern VarInfo __var_info__a12eb6a6;
+extern VarInfo __var_info__2efc05a;
+extern VarInfo __var_info__273e986f;
+extern VarInfo __var_info__64d79b27;
+extern VarInfo __var_info__283356e3;
+extern VarInfo __var_info__6a653939;
+extern VarInfo __var_info__2b172eee;
+extern VarInfo __var_info__1652b5ab;
+extern VarInfo __var_info__12b5c873;
+extern VarInfo __var_info__fc89a7bd;
+extern VarInfo __var_info__7158f885;
+extern VarInfo __var_info__23412d03;
+extern VarInfo __var_info__2b53371d;
+extern VarInfo __var_info__cddba76a;
+extern VarInfo __var_info__c9a40b93;
+extern VarInfo __var_info__4b9448ef;
+extern VarInfo __var_info__74406506;
+extern VarInfo __var_info__cd508ca2;
+extern VarInfo __var_info__d2c1237f;
+extern VarInfo __var_info__81225e0b;
+extern VarInfo __var_info__313e8ca2;
+extern VarInfo __var_info__e6bb03e5;
+extern VarInfo __var_info__9e419c8a;
+extern VarInfo __var_info__551333bf;
+extern VarInfo __var_info__aea48e45;
+extern VarInfo __var_info__550b319b;
+extern VarInfo __var_info__48510269;
+extern VarInfo __var_info__7800272c;
+extern VarInfo __var_info__6c355029;
+extern VarInfo __var_info__88bd54dd;
+extern VarInfo __var_info__8d8d7f7b;
+extern VarInfo __var_info__da162f0f;
+extern VarInfo __var_info__97166bea;
+extern VarInfo __var_info__34e66247;
+extern VarInfo __var_info__3a849630;
+extern VarInfo __var_info__f1940a94;
+extern VarInfo __var_info__d4114e39;
+extern VarInfo __var_info__aa3440cd;
+extern VarInfo __var_info__ee7e6124;
+extern VarInfo __var_info__7d229efa;
+extern VarInfo __var_info__9bd6acaa;
+extern VarInfo __var_info__20fc96db;
+extern VarInfo __var_info__c7e93868;
+extern VarInfo __var_info__ad29f041;
+extern VarInfo __var_info__4872697c;
+extern VarInfo __var_info__4e5ccd53;
+extern VarInfo __var_info__cc22053b;
+extern VarInfo __var_info__79f4cfa;
+extern VarInfo __var_info__ec160f60;
+extern VarInfo __var_info__f89b8a;
+extern VarInfo __var_info__6b8ba911;
+extern VarInfo __var_info__3d7dac2c;
+extern VarInfo __var_info__a82dce9b;
+extern VarInfo __var_info__910b998e;
+extern VarInfo __var_info__2a8a25ef;
+extern VarInfo __var_info__5a521f3e;
+extern VarInfo __var_info__8d13f1a4;
+extern VarInfo __var_info__dc97b75a;
+extern VarInfo __var_info__2c89dc03;
+extern VarInfo __var_info__ecbee68b;
+extern VarInfo __var_info__64201aed;
+extern VarInfo __var_info__b2101982;
+extern VarInfo __var_info__b2a3eaad;
+extern VarInfo __var_info__9b9d693c;
+extern VarInfo __var_info__55b62830;
+extern VarInfo __var_info__a7290d08;
+extern VarInfo __var_info__2206d735;
+extern VarInfo __var_info__1d996ce1;
+extern VarInfo __var_info__1320c55a;
+extern VarInfo __var_info__d71f6ba5;
+extern VarInfo __var_info__911acc39;
+extern VarInfo __var_info__b5a7b0aa;
+extern VarInfo __var_info__e7146240;
+extern VarInfo __var_info__d5f6b217;
+extern VarInfo __var_info__8c8b4082;
+extern VarInfo __var_info__a98c5c42;
+extern VarInfo __var_info__24d38396;
+extern VarInfo __var_info__81eeda74;
+extern VarInfo __var_info__56901958;
+extern VarInfo __var_info__16c7d036;
+extern VarInfo __var_info__3545119b;
+extern VarInfo __var_info__4d60c769;
+extern VarInfo __var_info__614d23d3;
+extern VarInfo __var_info__47a00595;
+extern VarInfo __var_info__ab8ba91b;
+extern VarInfo __var_info__d4da13e8;
+extern VarInfo __var_info__8ce84ca9;
+extern VarInfo __var_info__a0e26cce;
+extern VarInfo __var_info__aeb62e0d;
+extern VarInfo __var_info__5d482f0;
+extern VarInfo __var_info__199fca8c;
+extern VarInfo __var_info__e0038a85;
+extern VarInfo __var_info__246f936c;
+extern VarInfo __var_info__561a7cf6;
+extern VarInfo __var_info__87b76ff0;
+extern VarInfo __var_info__c6919440;
+extern VarInfo __var_info__6db5678d;
+extern VarInfo __var_info__3f4de3f8;
+extern VarInfo __var_info__93fb4bcd;
+extern VarInfo __var_info__393cbc39;
+extern VarInfo __var_info__7e221ab6;
+extern VarInfo __var_info__932f3a6f;
+extern VarInfo __var_info__add20c93;
+extern VarInfo __var_info__20429929;
+extern VarInfo __var_info__c16859b5;
+extern VarInfo __var_info__8a22f142;
+extern VarInfo __var_info__5c6dc5f6;
+extern VarInfo __var_info__68aabf55;
+extern VarInfo __var_info__d48ff6ca;
+extern VarInfo __var_info__cb124f1;
+extern VarInfo __var_info__bec030cb;
+extern VarInfo __var_info__3c948071;
+extern VarInfo __var_info__36b402e0;
+extern VarInfo __var_info__b5e2377f;
+extern VarInfo __var_info__cc111afd;
+extern VarInfo __var_info__8ff18fac;
+extern VarInfo __var_info__672be2f3;
+extern VarInfo __var_info__4b9a455d;
+extern VarInfo __var_info__8c15f483;
+extern VarInfo __var_info__eddf1cbe;
+extern VarInfo __var_info__d661540a;
+extern VarInfo __var_info__2c8b21c1;
+extern VarInfo __var_info__d7ab6136;
+extern VarInfo __var_info__ae786acf;
+extern VarInfo __var_info__2a803b63;
+extern VarInfo __var_info__ef9e6730;
+extern VarInfo __var_info__60a99510;
+extern VarInfo __var_info__23edf279;
+extern VarInfo __var_info__57f0ae61;
+extern VarInfo __var_info__73d33e26;
+extern VarInfo __var_info__1f2e4aca;
+extern VarInfo __var_info__a796f034;
+extern VarInfo __var_info__ed7756eb;
+extern VarInfo __var_info__af4c965e;
+extern VarInfo __var_info__1db9b1bc;
+extern VarInfo __var_info__ab591494;
+extern VarInfo __var_info__4056a5c4;
+extern VarInfo __var_info__b8d1180b;
+extern VarInfo __var_info__43f5bfed;
+extern VarInfo __var_info__f15d4a64;
+extern VarInfo __var_info__9f6a71de;
+extern VarInfo __var_info__b0041b2e;
+extern VarInfo __var_info__36ff1db0;
+extern VarInfo __var_info__2c7fe21f;
+extern VarInfo __var_info__48024766;
+extern VarInfo __var_info__b2c3902d;
+extern VarInfo __var_info__999df74b;
+extern VarInfo __var_info__e2a602c0;
+extern VarInfo __var_info__2fa1b31d;
+extern VarInfo __var_info__1b8cb484;
+extern VarInfo __var_info__6d164326;
+extern VarInfo __var_info__7b16d9e5;
+extern VarInfo __var_info__76139976;
+extern VarInfo __var_info__cde46b92;
+extern VarInfo __var_info__e168513e;
+extern VarInfo __var_info__e590118d;
+extern VarInfo __var_info__91b51af6;
+extern VarInfo __var_info__4169c5c;
+extern VarInfo __var_info__3afd8a53;
+extern VarInfo __var_info__a6606d62;
+extern VarInfo __var_info__af9457c5;
+extern VarInfo __var_info__966afd4d;
+extern VarInfo __var_info__4d25ad31;
+extern VarInfo __var_info__ef38d86d;
+extern VarInfo __var_info__10a9bc28;
+extern VarInfo __var_info__ffecf07d;
+extern VarInfo __var_info__2f101fb7;
+extern VarInfo __var_info__5121335e;
+extern VarInfo __var_info__7375565e;
+extern VarInfo __var_info__4dab1020;
+extern VarInfo __var_info__83d1ef2f;
+extern VarInfo __var_info__f16c07cd;
+extern VarInfo __var_info__d485852f;
+extern VarInfo __var_info__55aa652c;
+extern VarInfo __var_info__f4fb1a1e;
+extern VarInfo __var_info__7eaef221;
+extern VarInfo __var_info__f6d46b53;
+extern VarInfo __var_info__60838c1f;
+extern VarInfo __var_info__aa189916;
+extern VarInfo __var_info__7de0a32;
+extern VarInfo __var_info__fe5e7299;
+extern VarInfo __var_info__edf0c08;
+extern VarInfo __var_info__beafb69d;
+extern VarInfo __var_info__e92787d;
+extern VarInfo __var_info__2564fdb8;
+extern VarInfo __var_info__3efc909e;
+extern VarInfo __var_info__f3c0e1d9;
+extern VarInfo __var_info__108697d;
+extern VarInfo __var_info__e3344379;
+extern VarInfo __var_info__232fce6b;
+extern VarInfo __var_info__fc981fdd;
+extern VarInfo __var_info__843707be;
+extern VarInfo __var_info__9e7eaf5f;
+extern VarInfo __var_info__d4a6cec4;
+extern VarInfo __var_info__13cf9a34;
+extern VarInfo __var_info__626a927b;
+extern VarInfo __var_info__4bc4e1ff;
+extern VarInfo __var_info__3387cb57;
+extern VarInfo __var_info__5cd53bd1;
+extern VarInfo __var_info__b6defe19;
+extern VarInfo __var_info__5cc827a2;
+extern VarInfo __var_info__b8d2cd4d;
+extern VarInfo __var_info__acd6c76d;
+extern VarInfo __var_info__9bf1165;
+extern VarInfo __var_info__5e854c9c;
+extern VarInfo __var_info__90147d82;
+extern VarInfo __var_info__b8bc17b7;
+extern VarInfo __var_info__81bc7599;
+extern VarInfo __var_info__28172d36;
+extern VarInfo __var_info__694fd9c8;
+extern VarInfo __var_info__dd306cf6;
+extern VarInfo __var_info__30ff4f18;
+extern VarInfo __var_info__92eac40f;
+extern VarInfo __var_info__6c33833b;
+extern VarInfo __var_info__10a649c4;
+extern VarInfo __var_info__2a1ceadc;
+extern VarInfo __var_info__9e06e4d5;
+extern VarInfo __var_info__19f851a4;
+extern VarInfo __var_info__5c2079ea;
+extern VarInfo __var_info__3faa7011;
+extern VarInfo __var_info__c72542bf;
+extern VarInfo __var_info__92d1a600;
+extern VarInfo __var_info__20d20f0b;
+extern VarInfo __var_info__fb770a54;
+extern VarInfo __var_info__808d9907;
+extern VarInfo __var_info__578576fa;
+extern VarInfo __var_info__3d6c5b3c;
+extern VarInfo __var_info__b8b18312;
+extern VarInfo __var_info__d136e61e;
+extern VarInfo __var_info__bb1b1947;
+extern VarInfo __var_info__927227af;
+extern VarInfo __var_info__75b372e0;
+extern VarInfo __var_info__68aa7963;
+extern VarInfo __var_info__c56da57e;
+extern VarInfo __var_info__a9030fe6;
+extern VarInfo __var_info__29805b29;
+extern VarInfo __var_info__bd2b0f8d;
+extern VarInfo __var_info__3035c2ed;
+extern VarInfo __var_info__895686b1;
+extern VarInfo __var_info__ef3ac3ff;
+extern VarInfo __var_info__c9c0c0a9;
+extern VarInfo __var_info__a403ff76;
+extern VarInfo __var_info__faf7654c;
+extern VarInfo __var_info__30a8ad13;
+extern VarInfo __var_info__94434c5f;
+extern VarInfo __var_info__96df89e0;
+extern VarInfo __var_info__6f5e25ea;
+extern VarInfo __var_info__3b15665e;
+extern VarInfo __var_info__257c5583;
+extern VarInfo __var_info__ce6336d2;
+extern VarInfo __var_info__5e0e1b86;
+extern VarInfo __var_info__6d03fb10;
+extern VarInfo __var_info__7adbb3e8;
+extern FuncInfo __func_info__2e807d1c;
+extern FuncInfo __func_info__56461723;
+
+TypeInfo * __type_info__3afd8a53_arg_types_var_1663990950[2] = { &__type_info__5b038296, &__type_info__260b3481 };
+VarInfo __struct_info__632e7ca6_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__3afd8a53_arg_types_var_1663990950, nullptr, 2, 0, nullptr, 28, 0x3afd8a53, "__lambda", 0 };
+TypeInfo * __type_info__a98c5c42_arg_types_var_1663990950[1] = { &__type_info__a9c65abe };
+VarInfo __struct_info__632e7ca6_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a98c5c42_arg_types_var_1663990950, nullptr, 1, 0, nullptr, 28, 0xa98c5c42, "__finalize", 4 };
+VarInfo __struct_info__632e7ca6_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe6e0c6e9, "__yield", 8 };
+TypeInfo * __type_info__4b9a455d_arg_types_var_1663990950[1] = { &__type_info__f1b9498d };
+VarInfo __struct_info__632e7ca6_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, (TypeInfo **)__type_info__4b9a455d_arg_types_var_1663990950, nullptr, 1, 0, nullptr, 0, 0x4b9a455d, "blk", 16 };
+VarInfo __struct_info__632e7ca6_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6c914b27, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x75b372e0, "src", 24 };
+VarInfo __struct_info__632e7ca6_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xf3c0e1d9, "_loop_at_36", 32 };
+VarInfo __struct_info__632e7ca6_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6c914b27, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x5cd53bd1, "_source_0_at_36", 40 };
+VarInfo __struct_info__632e7ca6_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x927227af, "w", 48 };
+VarInfo __struct_info__632e7ca6_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd71f6ba5, "_pvar_0_at_36", 56 };
+VarInfo * __struct_info__632e7ca6_fields[9] =  { &__struct_info__632e7ca6_field_0, &__struct_info__632e7ca6_field_1, &__struct_info__632e7ca6_field_2, &__struct_info__632e7ca6_field_3, &__struct_info__632e7ca6_field_4, &__struct_info__632e7ca6_field_5, &__struct_info__632e7ca6_field_6, &__struct_info__632e7ca6_field_7, &__struct_info__632e7ca6_field_8 };
+StructInfo __struct_info__632e7ca6 = {"_lambda_thismodule_36_12_34", __struct_info__632e7ca6_fields, 9, 64, -1, nullptr, 0x632e7ca6 };
+TypeInfo * __type_info__8ce84ca9_arg_types_var_1150849144[2] = { &__type_info__d238d5a8, &__type_info__359c1b32 };
+VarInfo __struct_info__44989078_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__8ce84ca9_arg_types_var_1150849144, nullptr, 2, 0, nullptr, 28, 0x8ce84ca9, "__lambda", 0 };
+TypeInfo * __type_info__10a9bc28_arg_types_var_1150849144[1] = { &__type_info__cb86e0e0 };
+VarInfo __struct_info__44989078_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__10a9bc28_arg_types_var_1150849144, nullptr, 1, 0, nullptr, 28, 0x10a9bc28, "__finalize", 4 };
+VarInfo * __struct_info__44989078_fields[2] =  { &__struct_info__44989078_field_0, &__struct_info__44989078_field_1 };
+StructInfo __struct_info__44989078 = {"_lambda_thismodule_180_30_18", __struct_info__44989078_fields, 2, 8, -1, nullptr, 0x44989078 };
+TypeInfo * __type_info__7a666790_arg_types_var_46558771[2] = { &__type_info__1983f0e3, &__type_info__f1b9498d };
+VarInfo __struct_info__2c66e33_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__7a666790_arg_types_var_46558771, nullptr, 2, 0, nullptr, 28, 0x7a666790, "__lambda", 0 };
+TypeInfo * __type_info__2206d735_arg_types_var_46558771[1] = { &__type_info__e5bb2fbb };
+VarInfo __struct_info__2c66e33_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2206d735_arg_types_var_46558771, nullptr, 1, 0, nullptr, 28, 0x2206d735, "__finalize", 4 };
+VarInfo * __struct_info__2c66e33_fields[2] =  { &__struct_info__2c66e33_field_0, &__struct_info__2c66e33_field_1 };
+StructInfo __struct_info__2c66e33 = {"_lambda_thismodule_91_25_27", __struct_info__2c66e33_fields, 2, 8, -1, nullptr, 0x2c66e33 };
+TypeInfo * __type_info__87b76ff0_arg_types_var_3677592723[2] = { &__type_info__fea04943, &__type_info__e6eb6b88 };
+VarInfo __struct_info__db339c93_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__87b76ff0_arg_types_var_3677592723, nullptr, 2, 0, nullptr, 28, 0x87b76ff0, "__lambda", 0 };
+TypeInfo * __type_info__47a00595_arg_types_var_3677592723[1] = { &__type_info__32e3c02b };
+VarInfo __struct_info__db339c93_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__47a00595_arg_types_var_3677592723, nullptr, 1, 0, nullptr, 28, 0x47a00595, "__finalize", 4 };
+VarInfo __struct_info__db339c93_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x10a649c4, "__yield", 8 };
+TypeInfo * __type_info__13cf9a34_arg_types_var_3677592723[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__db339c93_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__13cf9a34_arg_types_var_3677592723, nullptr, 1, 0, nullptr, 28, 0x13cf9a34, "blk", 12 };
+VarInfo __struct_info__db339c93_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xaf9457c5, "src", 16 };
+VarInfo __struct_info__db339c93_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x895686b1, "_loop_at_31", 24 };
+VarInfo __struct_info__db339c93_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x57f0ae61, "_source_0_at_31", 32 };
+VarInfo __struct_info__db339c93_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd661540a, "w", 40 };
+VarInfo __struct_info__db339c93_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7b16d9e5, "_pvar_0_at_31", 48 };
+VarInfo * __struct_info__db339c93_fields[9] =  { &__struct_info__db339c93_field_0, &__struct_info__db339c93_field_1, &__struct_info__db339c93_field_2, &__struct_info__db339c93_field_3, &__struct_info__db339c93_field_4, &__struct_info__db339c93_field_5, &__struct_info__db339c93_field_6, &__struct_info__db339c93_field_7, &__struct_info__db339c93_field_8 };
+StructInfo __struct_info__db339c93 = {"_lambda_thismodule_31_12_23", __struct_info__db339c93_fields, 9, 56, -1, nullptr, 0xdb339c93 };
+TypeInfo * __type_info__3efc909e_arg_types_var_3792800101[2] = { &__type_info__34ea7395, &__type_info__260b3481 };
+VarInfo __struct_info__e2118965_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__3efc909e_arg_types_var_3792800101, nullptr, 2, 0, nullptr, 28, 0x3efc909e, "__lambda", 0 };
+TypeInfo * __type_info__a82dce9b_arg_types_var_3792800101[1] = { &__type_info__8f9c436d };
+VarInfo __struct_info__e2118965_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a82dce9b_arg_types_var_3792800101, nullptr, 1, 0, nullptr, 28, 0xa82dce9b, "__finalize", 4 };
+VarInfo __struct_info__e2118965_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x1f2e4aca, "__yield", 8 };
+VarInfo __struct_info__e2118965_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd7ab6136, "_loop_at_90", 12 };
+VarInfo __struct_info__e2118965_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x6b8ba911, "x", 16 };
+VarInfo __struct_info__e2118965_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf4fb1a1e, "_pvar_0_at_90", 24 };
+VarInfo __struct_info__e2118965_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x8a22f142, "_source_0_at_90", 32 };
+VarInfo * __struct_info__e2118965_fields[7] =  { &__struct_info__e2118965_field_0, &__struct_info__e2118965_field_1, &__struct_info__e2118965_field_2, &__struct_info__e2118965_field_3, &__struct_info__e2118965_field_4, &__struct_info__e2118965_field_5, &__struct_info__e2118965_field_6 };
+StructInfo __struct_info__e2118965 = {"_lambda_thismodule_90_14_11", __struct_info__e2118965_fields, 7, 40, -1, nullptr, 0xe2118965 };
+TypeInfo * __type_info__88bd54dd_arg_types_var_3727925580[2] = { &__type_info__1a04dfc, &__type_info__3c15753 };
+VarInfo __struct_info__de33a14c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__88bd54dd_arg_types_var_3727925580, nullptr, 2, 0, nullptr, 28, 0x88bd54dd, "__lambda", 0 };
+TypeInfo * __type_info__f15d4a64_arg_types_var_3727925580[1] = { &__type_info__35e3c4e4 };
+VarInfo __struct_info__de33a14c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f15d4a64_arg_types_var_3727925580, nullptr, 1, 0, nullptr, 28, 0xf15d4a64, "__finalize", 4 };
+VarInfo __struct_info__de33a14c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xbec030cb, "__yield", 8 };
+TypeInfo * __type_info__34e66247_arg_types_var_3727925580[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__de33a14c_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, (TypeInfo **)__type_info__34e66247_arg_types_var_3727925580, nullptr, 1, 0, nullptr, 0, 0x34e66247, "blk", 16 };
+VarInfo __struct_info__de33a14c_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x5121335e, "src", 24 };
+VarInfo __struct_info__de33a14c_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x5e0e1b86, "_loop_at_31", 32 };
+VarInfo __struct_info__de33a14c_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xcd508ca2, "_source_0_at_31", 40 };
+VarInfo __struct_info__de33a14c_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xf16c07cd, "w", 48 };
+VarInfo __struct_info__de33a14c_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb0041b2e, "_pvar_0_at_31", 56 };
+VarInfo * __struct_info__de33a14c_fields[9] =  { &__struct_info__de33a14c_field_0, &__struct_info__de33a14c_field_1, &__struct_info__de33a14c_field_2, &__struct_info__de33a14c_field_3, &__struct_info__de33a14c_field_4, &__struct_info__de33a14c_field_5, &__struct_info__de33a14c_field_6, &__struct_info__de33a14c_field_7, &__struct_info__de33a14c_field_8 };
+StructInfo __struct_info__de33a14c = {"_lambda_thismodule_31_12_26", __struct_info__de33a14c_fields, 9, 64, -1, nullptr, 0xde33a14c };
+TypeInfo * __type_info__e168513e_arg_types_var_2682969093[2] = { &__type_info__76b9d575, &__type_info__e6eb6b88 };
+VarInfo __struct_info__9feadc05_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__e168513e_arg_types_var_2682969093, nullptr, 2, 0, nullptr, 28, 0xe168513e, "__lambda", 0 };
+TypeInfo * __type_info__cc22053b_arg_types_var_2682969093[1] = { &__type_info__f96efa8d };
+VarInfo __struct_info__9feadc05_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc22053b_arg_types_var_2682969093, nullptr, 1, 0, nullptr, 28, 0xcc22053b, "__finalize", 4 };
+VarInfo __struct_info__9feadc05_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x97166bea, "__yield", 8 };
+VarInfo __struct_info__9feadc05_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd4da13e8, "_loop_at_227", 12 };
+VarInfo __struct_info__9feadc05_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x4d25ad31, "x", 16 };
+VarInfo __struct_info__9feadc05_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x6d03fb10, "_pvar_0_at_227", 24 };
+VarInfo __struct_info__9feadc05_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xd4a6cec4, "_source_0_at_227", 32 };
+VarInfo * __struct_info__9feadc05_fields[7] =  { &__struct_info__9feadc05_field_0, &__struct_info__9feadc05_field_1, &__struct_info__9feadc05_field_2, &__struct_info__9feadc05_field_3, &__struct_info__9feadc05_field_4, &__struct_info__9feadc05_field_5, &__struct_info__9feadc05_field_6 };
+StructInfo __struct_info__9feadc05 = {"_lambda_thismodule_227_19_7", __struct_info__9feadc05_fields, 7, 40, -1, nullptr, 0x9feadc05 };
+TypeInfo * __type_info__5c2079ea_arg_types_var_3080592385[2] = { &__type_info__45839f1, &__type_info__359c1b32 };
+VarInfo __struct_info__b79e1c01_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__5c2079ea_arg_types_var_3080592385, nullptr, 2, 0, nullptr, 28, 0x5c2079ea, "__lambda", 0 };
+TypeInfo * __type_info__4bc4e1ff_arg_types_var_3080592385[1] = { &__type_info__575f76e9 };
+VarInfo __struct_info__b79e1c01_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4bc4e1ff_arg_types_var_3080592385, nullptr, 1, 0, nullptr, 28, 0x4bc4e1ff, "__finalize", 4 };
+VarInfo * __struct_info__b79e1c01_fields[2] =  { &__struct_info__b79e1c01_field_0, &__struct_info__b79e1c01_field_1 };
+StructInfo __struct_info__b79e1c01 = {"_lambda_thismodule_163_30_16", __struct_info__b79e1c01_fields, 2, 8, -1, nullptr, 0xb79e1c01 };
+TypeInfo * __type_info__36ff1db0_arg_types_var_4125774163[2] = { &__type_info__4f1f8183, &__type_info__359c1b32 };
+VarInfo __struct_info__f5ea5153_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__36ff1db0_arg_types_var_4125774163, nullptr, 2, 0, nullptr, 28, 0x36ff1db0, "__lambda", 0 };
+TypeInfo * __type_info__68aabf55_arg_types_var_4125774163[1] = { &__type_info__f9c3b13b };
+VarInfo __struct_info__f5ea5153_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__68aabf55_arg_types_var_4125774163, nullptr, 1, 0, nullptr, 28, 0x68aabf55, "__finalize", 4 };
+VarInfo * __struct_info__f5ea5153_fields[2] =  { &__struct_info__f5ea5153_field_0, &__struct_info__f5ea5153_field_1 };
+StructInfo __struct_info__f5ea5153 = {"_lambda_thismodule_85_28_1", __struct_info__f5ea5153_fields, 2, 8, -1, nullptr, 0xf5ea5153 };
+TypeInfo * __type_info__73d33e26_arg_types_var_975739965[2] = { &__type_info__82115e6d, &__type_info__260b3481 };
+VarInfo __struct_info__3a289c3d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__73d33e26_arg_types_var_975739965, nullptr, 2, 0, nullptr, 28, 0x73d33e26, "__lambda", 0 };
+TypeInfo * __type_info__30a8ad13_arg_types_var_975739965[1] = { &__type_info__cd314265 };
+VarInfo __struct_info__3a289c3d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__30a8ad13_arg_types_var_975739965, nullptr, 1, 0, nullptr, 28, 0x30a8ad13, "__finalize", 4 };
+VarInfo __struct_info__3a289c3d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xcde46b92, "__yield", 8 };
+VarInfo __struct_info__3a289c3d_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x257c5583, "_loop_at_240", 12 };
+VarInfo __struct_info__3a289c3d_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x81bc7599, "x", 16 };
+VarInfo __struct_info__3a289c3d_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x232fce6b, "_pvar_0_at_240", 24 };
+VarInfo __struct_info__3a289c3d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xb5e2377f, "_source_0_at_240", 32 };
+VarInfo * __struct_info__3a289c3d_fields[7] =  { &__struct_info__3a289c3d_field_0, &__struct_info__3a289c3d_field_1, &__struct_info__3a289c3d_field_2, &__struct_info__3a289c3d_field_3, &__struct_info__3a289c3d_field_4, &__struct_info__3a289c3d_field_5, &__struct_info__3a289c3d_field_6 };
+StructInfo __struct_info__3a289c3d = {"_lambda_thismodule_240_10_12", __struct_info__3a289c3d_fields, 7, 40, -1, nullptr, 0x3a289c3d };
+TypeInfo * __type_info__910b998e_arg_types_var_3876784757[2] = { &__type_info__ad459a25, &__type_info__6df81eef };
+VarInfo __struct_info__e7130a75_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__910b998e_arg_types_var_3876784757, nullptr, 2, 0, nullptr, 28, 0x910b998e, "__lambda", 0 };
+TypeInfo * __type_info__1652b5ab_arg_types_var_3876784757[1] = { &__type_info__73acd24d };
+VarInfo __struct_info__e7130a75_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1652b5ab_arg_types_var_3876784757, nullptr, 1, 0, nullptr, 28, 0x1652b5ab, "__finalize", 4 };
+VarInfo __struct_info__e7130a75_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x578576fa, "__yield", 8 };
+TypeInfo * __type_info__7de0a32_arg_types_var_3876784757[1] = { &__type_info__f1b9498d };
+VarInfo __struct_info__e7130a75_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__7de0a32_arg_types_var_3876784757, nullptr, 1, 0, nullptr, 0, 0x7de0a32, "blk", 16 };
+VarInfo __struct_info__e7130a75_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x60838c1f, "src", 24 };
+VarInfo __struct_info__e7130a75_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x3035c2ed, "_loop_at_15", 32 };
+VarInfo __struct_info__e7130a75_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x1d996ce1, "_source_0_at_15", 40 };
+VarInfo __struct_info__e7130a75_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9b9d693c, "w", 48 };
+VarInfo __struct_info__e7130a75_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7158f885, "_pvar_0_at_15", 72 };
+VarInfo * __struct_info__e7130a75_fields[9] =  { &__struct_info__e7130a75_field_0, &__struct_info__e7130a75_field_1, &__struct_info__e7130a75_field_2, &__struct_info__e7130a75_field_3, &__struct_info__e7130a75_field_4, &__struct_info__e7130a75_field_5, &__struct_info__e7130a75_field_6, &__struct_info__e7130a75_field_7, &__struct_info__e7130a75_field_8 };
+StructInfo __struct_info__e7130a75 = {"_lambda_thismodule_15_12_30", __struct_info__e7130a75_fields, 9, 80, -1, nullptr, 0xe7130a75 };
+TypeInfo * __type_info__2b172eee_arg_types_var_1267442517[3] = { &__type_info__3bc97285, &__type_info__359c1b32, &__type_info__359c1b32 };
+VarInfo __struct_info__4b8ba355_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__359c1b32, nullptr, (TypeInfo **)__type_info__2b172eee_arg_types_var_1267442517, nullptr, 3, 0, nullptr, 28, 0x2b172eee, "__lambda", 0 };
+TypeInfo * __type_info__81225e0b_arg_types_var_1267442517[1] = { &__type_info__37f8377d };
+VarInfo __struct_info__4b8ba355_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__81225e0b_arg_types_var_1267442517, nullptr, 1, 0, nullptr, 28, 0x81225e0b, "__finalize", 4 };
+VarInfo * __struct_info__4b8ba355_fields[2] =  { &__struct_info__4b8ba355_field_0, &__struct_info__4b8ba355_field_1 };
+StructInfo __struct_info__4b8ba355 = {"_lambda_thismodule_115_27_15", __struct_info__4b8ba355_fields, 2, 8, -1, nullptr, 0x4b8ba355 };
+TypeInfo * __type_info__ef9e6730_arg_types_var_1394402771[2] = { &__type_info__34f42543, &__type_info__359c1b32 };
+VarInfo __struct_info__531ce5d3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__ef9e6730_arg_types_var_1394402771, nullptr, 2, 0, nullptr, 28, 0xef9e6730, "__lambda", 0 };
+TypeInfo * __type_info__9e06e4d5_arg_types_var_1394402771[1] = { &__type_info__b57008b };
+VarInfo __struct_info__531ce5d3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9e06e4d5_arg_types_var_1394402771, nullptr, 1, 0, nullptr, 28, 0x9e06e4d5, "__finalize", 4 };
+VarInfo * __struct_info__531ce5d3_fields[2] =  { &__struct_info__531ce5d3_field_0, &__struct_info__531ce5d3_field_1 };
+StructInfo __struct_info__531ce5d3 = {"_lambda_thismodule_71_25_14", __struct_info__531ce5d3_fields, 2, 8, -1, nullptr, 0x531ce5d3 };
+TypeInfo * __type_info__2fa1b31d_arg_types_var_3588639884[2] = { &__type_info__a969907c, &__type_info__359c1b32 };
+VarInfo __struct_info__d5e64c8c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, (TypeInfo **)__type_info__2fa1b31d_arg_types_var_3588639884, nullptr, 2, 0, nullptr, 28, 0x2fa1b31d, "__lambda", 0 };
+TypeInfo * __type_info__8d13f1a4_arg_types_var_3588639884[1] = { &__type_info__9b0d4e04 };
+VarInfo __struct_info__d5e64c8c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8d13f1a4_arg_types_var_3588639884, nullptr, 1, 0, nullptr, 28, 0x8d13f1a4, "__finalize", 4 };
+VarInfo * __struct_info__d5e64c8c_fields[2] =  { &__struct_info__d5e64c8c_field_0, &__struct_info__d5e64c8c_field_1 };
+StructInfo __struct_info__d5e64c8c = {"_lambda_thismodule_139_28_6", __struct_info__d5e64c8c_fields, 2, 8, -1, nullptr, 0xd5e64c8c };
+TypeInfo * __type_info__a796f034_arg_types_var_595250615[2] = { &__type_info__db3d6827, &__type_info__e6eb6b88 };
+VarInfo __struct_info__237acdb7_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__a796f034_arg_types_var_595250615, nullptr, 2, 0, nullptr, 28, 0xa796f034, "__lambda", 0 };
+TypeInfo * __type_info__ad29f041_arg_types_var_595250615[1] = { &__type_info__1414892f };
+VarInfo __struct_info__237acdb7_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad29f041_arg_types_var_595250615, nullptr, 1, 0, nullptr, 28, 0xad29f041, "__finalize", 4 };
+VarInfo __struct_info__237acdb7_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x55b62830, "__yield", 8 };
+TypeInfo * __type_info__60a99510_arg_types_var_595250615[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__237acdb7_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__60a99510_arg_types_var_595250615, nullptr, 1, 0, nullptr, 28, 0x60a99510, "blk", 12 };
+VarInfo __struct_info__237acdb7_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xfe5e7299, "src", 16 };
+VarInfo __struct_info__237acdb7_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x96df89e0, "_loop_at_9", 24 };
+VarInfo __struct_info__237acdb7_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x56901958, "_source_0_at_9", 32 };
+VarInfo __struct_info__237acdb7_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa9030fe6, "w", 40 };
+VarInfo __struct_info__237acdb7_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x81eeda74, "_pvar_0_at_9", 48 };
+VarInfo * __struct_info__237acdb7_fields[9] =  { &__struct_info__237acdb7_field_0, &__struct_info__237acdb7_field_1, &__struct_info__237acdb7_field_2, &__struct_info__237acdb7_field_3, &__struct_info__237acdb7_field_4, &__struct_info__237acdb7_field_5, &__struct_info__237acdb7_field_6, &__struct_info__237acdb7_field_7, &__struct_info__237acdb7_field_8 };
+StructInfo __struct_info__237acdb7 = {"_lambda_thismodule_9_12_20", __struct_info__237acdb7_fields, 9, 56, -1, nullptr, 0x237acdb7 };
+TypeInfo * __type_info__3f4de3f8_arg_types_var_1740990635[2] = { &__type_info__fc05925b, &__type_info__413b3264 };
+VarInfo __struct_info__67c568ab_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__3f4de3f8_arg_types_var_1740990635, nullptr, 2, 0, nullptr, 28, 0x3f4de3f8, "__lambda", 0 };
+TypeInfo * __type_info__b2c3902d_arg_types_var_1740990635[1] = { &__type_info__146e3c83 };
+VarInfo __struct_info__67c568ab_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b2c3902d_arg_types_var_1740990635, nullptr, 1, 0, nullptr, 28, 0xb2c3902d, "__finalize", 4 };
+VarInfo __struct_info__67c568ab_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x199fca8c, "__yield", 8 };
+VarInfo __struct_info__67c568ab_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x561a7cf6, "_loop_at_106", 12 };
+VarInfo __struct_info__67c568ab_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x20fc96db, "x", 16 };
+VarInfo __struct_info__67c568ab_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x9e419c8a, "_pvar_0_at_106", 24 };
+VarInfo __struct_info__67c568ab_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xdd306cf6, "_source_0_at_106", 32 };
+VarInfo * __struct_info__67c568ab_fields[7] =  { &__struct_info__67c568ab_field_0, &__struct_info__67c568ab_field_1, &__struct_info__67c568ab_field_2, &__struct_info__67c568ab_field_3, &__struct_info__67c568ab_field_4, &__struct_info__67c568ab_field_5, &__struct_info__67c568ab_field_6 };
+StructInfo __struct_info__67c568ab = {"_lambda_thismodule_106_15_5", __struct_info__67c568ab_fields, 7, 40, -1, nullptr, 0x67c568ab };
+TypeInfo * __type_info__48510269_arg_types_var_974154040[2] = { &__type_info__63564868, &__type_info__260b3481 };
+VarInfo __struct_info__3a106938_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__48510269_arg_types_var_974154040, nullptr, 2, 0, nullptr, 28, 0x48510269, "__lambda", 0 };
+TypeInfo * __type_info__7adbb3e8_arg_types_var_974154040[1] = { &__type_info__ffd30770 };
+VarInfo __struct_info__3a106938_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7adbb3e8_arg_types_var_974154040, nullptr, 1, 0, nullptr, 28, 0x7adbb3e8, "__finalize", 4 };
+VarInfo __struct_info__3a106938_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xda162f0f, "__yield", 8 };
+VarInfo __struct_info__3a106938_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe92787d, "_loop_at_56", 12 };
+VarInfo __struct_info__3a106938_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x2a1ceadc, "x", 16 };
+VarInfo __struct_info__3a106938_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x93fb4bcd, "_pvar_0_at_56", 24 };
+VarInfo __struct_info__3a106938_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x2c8b21c1, "_source_0_at_56", 32 };
+VarInfo * __struct_info__3a106938_fields[7] =  { &__struct_info__3a106938_field_0, &__struct_info__3a106938_field_1, &__struct_info__3a106938_field_2, &__struct_info__3a106938_field_3, &__struct_info__3a106938_field_4, &__struct_info__3a106938_field_5, &__struct_info__3a106938_field_6 };
+StructInfo __struct_info__3a106938 = {"_lambda_thismodule_56_21_10", __struct_info__3a106938_fields, 7, 40, -1, nullptr, 0x3a106938 };
+TypeInfo * __type_info__a403ff76_arg_types_var_663712045[2] = { &__type_info__d27d2f5d, &__type_info__3c15753 };
+VarInfo __struct_info__278f712d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__a403ff76_arg_types_var_663712045, nullptr, 2, 0, nullptr, 28, 0xa403ff76, "__lambda", 0 };
+TypeInfo * __type_info__8c15f483_arg_types_var_663712045[1] = { &__type_info__59047065 };
+VarInfo __struct_info__278f712d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8c15f483_arg_types_var_663712045, nullptr, 1, 0, nullptr, 28, 0x8c15f483, "__finalize", 4 };
+VarInfo __struct_info__278f712d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x313e8ca2, "__yield", 8 };
+VarInfo __struct_info__278f712d_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x283356e3, "_loop_at_235", 12 };
+VarInfo __struct_info__278f712d_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x20429929, "x", 16 };
+VarInfo __struct_info__278f712d_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x20d20f0b, "_pvar_0_at_235", 24 };
+VarInfo __struct_info__278f712d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x92eac40f, "_source_0_at_235", 32 };
+VarInfo * __struct_info__278f712d_fields[7] =  { &__struct_info__278f712d_field_0, &__struct_info__278f712d_field_1, &__struct_info__278f712d_field_2, &__struct_info__278f712d_field_3, &__struct_info__278f712d_field_4, &__struct_info__278f712d_field_5, &__struct_info__278f712d_field_6 };
+StructInfo __struct_info__278f712d = {"_lambda_thismodule_235_18_9", __struct_info__278f712d_fields, 7, 40, -1, nullptr, 0x278f712d };
+TypeInfo * __type_info__b8b18312_arg_types_var_3880903033[2] = { &__type_info__d8d67e29, &__type_info__6df81eef };
+VarInfo __struct_info__e751e179_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__b8b18312_arg_types_var_3880903033, nullptr, 2, 0, nullptr, 28, 0xb8b18312, "__lambda", 0 };
+TypeInfo * __type_info__b8bc17b7_arg_types_var_3880903033[1] = { &__type_info__21ca7a51 };
+VarInfo __struct_info__e751e179_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b8bc17b7_arg_types_var_3880903033, nullptr, 1, 0, nullptr, 28, 0xb8bc17b7, "__finalize", 4 };
+VarInfo __struct_info__e751e179_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xaa189916, "__yield", 8 };
+VarInfo __struct_info__e751e179_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xadd20c93, "src", 16 };
+VarInfo __struct_info__e751e179_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7375565e, "arr", 24 };
+VarInfo __struct_info__e751e179_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc904cee5, "___loop_at_130_rename_at_130", 48 };
+VarInfo __struct_info__e751e179_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x29805b29, "__x_rename_at_130", 56 };
+VarInfo __struct_info__e751e179_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc9c0c0a9, "___pvar_0_at_130_rename_at_130", 64 };
+VarInfo __struct_info__e751e179_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x24d38396, "_loop_at_126", 72 };
+VarInfo __struct_info__e751e179_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xcddba76a, "_source_0_at_126", 80 };
+VarInfo __struct_info__e751e179_field_10 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xaea48e45, "x", 88 };
+VarInfo __struct_info__e751e179_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x91b51af6, "_pvar_0_at_126", 112 };
+VarInfo __struct_info__e751e179_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6c914b27, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xbd2b0f8d, "___source_0_at_130_rename_at_130", 120 };
+VarInfo * __struct_info__e751e179_fields[13] =  { &__struct_info__e751e179_field_0, &__struct_info__e751e179_field_1, &__struct_info__e751e179_field_2, &__struct_info__e751e179_field_3, &__struct_info__e751e179_field_4, &__struct_info__e751e179_field_5, &__struct_info__e751e179_field_6, &__struct_info__e751e179_field_7, &__struct_info__e751e179_field_8, &__struct_info__e751e179_field_9, &__struct_info__e751e179_field_10, &__struct_info__e751e179_field_11, &__struct_info__e751e179_field_12 };
+StructInfo __struct_info__e751e179 = {"_lambda_thismodule_125_12_29", __struct_info__e751e179_fields, 13, 128, -1, nullptr, 0xe751e179 };
+TypeInfo * __type_info__8c8b4082_arg_types_var_1614195849[2] = { &__type_info__3a28fb9, &__type_info__e6eb6b88 };
+VarInfo __struct_info__6036ac89_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__8c8b4082_arg_types_var_1614195849, nullptr, 2, 0, nullptr, 28, 0x8c8b4082, "__lambda", 0 };
+TypeInfo * __type_info__808d9907_arg_types_var_1614195849[1] = { &__type_info__b7e6d021 };
+VarInfo __struct_info__6036ac89_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__808d9907_arg_types_var_1614195849, nullptr, 1, 0, nullptr, 28, 0x808d9907, "__finalize", 4 };
+VarInfo __struct_info__6036ac89_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x74406506, "__yield", 8 };
+TypeInfo * __type_info__af4c965e_arg_types_var_1614195849[1] = { &__type_info__f1b9498d };
+VarInfo __struct_info__6036ac89_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__af4c965e_arg_types_var_1614195849, nullptr, 1, 0, nullptr, 0, 0xaf4c965e, "blk", 16 };
+VarInfo __struct_info__6036ac89_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x2a803b63, "src", 24 };
+VarInfo __struct_info__6036ac89_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x8d8d7f7b, "_loop_at_31", 32 };
+VarInfo __struct_info__6036ac89_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x83d1ef2f, "_source_0_at_31", 40 };
+VarInfo __struct_info__6036ac89_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x694fd9c8, "w", 48 };
+VarInfo __struct_info__6036ac89_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xab8ba91b, "_pvar_0_at_31", 72 };
+VarInfo * __struct_info__6036ac89_fields[9] =  { &__struct_info__6036ac89_field_0, &__struct_info__6036ac89_field_1, &__struct_info__6036ac89_field_2, &__struct_info__6036ac89_field_3, &__struct_info__6036ac89_field_4, &__struct_info__6036ac89_field_5, &__struct_info__6036ac89_field_6, &__struct_info__6036ac89_field_7, &__struct_info__6036ac89_field_8 };
+StructInfo __struct_info__6036ac89 = {"_lambda_thismodule_31_12_36", __struct_info__6036ac89_fields, 9, 80, -1, nullptr, 0x6036ac89 };
+TypeInfo * __type_info__9bf1165_arg_types_var_578472996[2] = { &__type_info__da3d6694, &__type_info__e6eb6b88 };
+VarInfo __struct_info__227acc24_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__9bf1165_arg_types_var_578472996, nullptr, 2, 0, nullptr, 28, 0x9bf1165, "__lambda", 0 };
+TypeInfo * __type_info__5e854c9c_arg_types_var_578472996[1] = { &__type_info__1314879c };
+VarInfo __struct_info__227acc24_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5e854c9c_arg_types_var_578472996, nullptr, 1, 0, nullptr, 28, 0x5e854c9c, "__finalize", 4 };
+VarInfo __struct_info__227acc24_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x614d23d3, "__yield", 8 };
+TypeInfo * __type_info__c72542bf_arg_types_var_578472996[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__227acc24_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__c72542bf_arg_types_var_578472996, nullptr, 1, 0, nullptr, 0, 0xc72542bf, "blk", 16 };
+VarInfo __struct_info__227acc24_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x76139976, "src", 24 };
+VarInfo __struct_info__227acc24_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x4d60c769, "_loop_at_9", 32 };
+VarInfo __struct_info__227acc24_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xffecf07d, "_source_0_at_9", 40 };
+VarInfo __struct_info__227acc24_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe0038a85, "w", 48 };
+VarInfo __struct_info__227acc24_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3faa7011, "_pvar_0_at_9", 56 };
+VarInfo * __struct_info__227acc24_fields[9] =  { &__struct_info__227acc24_field_0, &__struct_info__227acc24_field_1, &__struct_info__227acc24_field_2, &__struct_info__227acc24_field_3, &__struct_info__227acc24_field_4, &__struct_info__227acc24_field_5, &__struct_info__227acc24_field_6, &__struct_info__227acc24_field_7, &__struct_info__227acc24_field_8 };
+StructInfo __struct_info__227acc24 = {"_lambda_thismodule_9_12_21", __struct_info__227acc24_fields, 9, 64, -1, nullptr, 0x227acc24 };
+TypeInfo * __type_info__d485852f_arg_types_var_3761480818[2] = { &__type_info__3a05122, &__type_info__ac13bbb3 };
+VarInfo __struct_info__e033a472_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__d485852f_arg_types_var_3761480818, nullptr, 2, 0, nullptr, 28, 0xd485852f, "__lambda", 0 };
+TypeInfo * __type_info__a12eb6a6_arg_types_var_3761480818[1] = { &__type_info__37e3c80a };
+VarInfo __struct_info__e033a472_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a12eb6a6_arg_types_var_3761480818, nullptr, 1, 0, nullptr, 28, 0xa12eb6a6, "__finalize", 4 };
+VarInfo __struct_info__e033a472_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xfc89a7bd, "__yield", 8 };
+TypeInfo * __type_info__7eaef221_arg_types_var_3761480818[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__e033a472_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__7eaef221_arg_types_var_3761480818, nullptr, 1, 0, nullptr, 0, 0x7eaef221, "blk", 16 };
+VarInfo __struct_info__e033a472_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x1db9b1bc, "src", 24 };
+VarInfo __struct_info__e033a472_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x92d1a600, "_loop_at_31", 32 };
+VarInfo __struct_info__e033a472_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x36b402e0, "_source_0_at_31", 40 };
+VarInfo __struct_info__e033a472_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x12b5c873, "w", 48 };
+VarInfo __struct_info__e033a472_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x55aa652c, "_pvar_0_at_31", 56 };
+VarInfo * __struct_info__e033a472_fields[9] =  { &__struct_info__e033a472_field_0, &__struct_info__e033a472_field_1, &__struct_info__e033a472_field_2, &__struct_info__e033a472_field_3, &__struct_info__e033a472_field_4, &__struct_info__e033a472_field_5, &__struct_info__e033a472_field_6, &__struct_info__e033a472_field_7, &__struct_info__e033a472_field_8 };
+StructInfo __struct_info__e033a472 = {"_lambda_thismodule_31_12_24", __struct_info__e033a472_fields, 9, 64, -1, nullptr, 0xe033a472 };
+TypeInfo * __type_info__c9a40b93_arg_types_var_3864125414[2] = { &__type_info__d7d67c96, &__type_info__8bc49635 };
+VarInfo __struct_info__e651dfe6_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__c9a40b93_arg_types_var_3864125414, nullptr, 2, 0, nullptr, 28, 0xc9a40b93, "__lambda", 0 };
+TypeInfo * __type_info__b2101982_arg_types_var_3864125414[1] = { &__type_info__20ca78be };
+VarInfo __struct_info__e651dfe6_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b2101982_arg_types_var_3864125414, nullptr, 1, 0, nullptr, 28, 0xb2101982, "__finalize", 4 };
+VarInfo __struct_info__e651dfe6_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x6c355029, "__yield", 8 };
+VarInfo __struct_info__e651dfe6_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x4dab1020, "src", 16 };
+VarInfo __struct_info__e651dfe6_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6a653939, "arr", 24 };
+VarInfo __struct_info__e651dfe6_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xf1940a94, "___loop_at_130_rename_at_130", 48 };
+VarInfo __struct_info__e651dfe6_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xdc97b75a, "__x_rename_at_130", 56 };
+VarInfo __struct_info__e651dfe6_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3d6c5b3c, "___pvar_0_at_130_rename_at_130", 64 };
+VarInfo __struct_info__e651dfe6_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x2c89dc03, "_loop_at_126", 72 };
+VarInfo __struct_info__e651dfe6_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xed7756eb, "_source_0_at_126", 80 };
+TypeInfo * __type_info__a0e26cce_arg_types_var_3864125414[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+VarInfo __struct_info__e651dfe6_field_10 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__a0e26cce_arg_types_var_3864125414, nullptr, 2, 0, nullptr, 2078, 0xa0e26cce, "x", 88 };
+VarInfo __struct_info__e651dfe6_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3387cb57, "_pvar_0_at_126", 96 };
+VarInfo __struct_info__e651dfe6_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__430d762d, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xa7290d08, "___source_0_at_130_rename_at_130", 104 };
+VarInfo * __struct_info__e651dfe6_fields[13] =  { &__struct_info__e651dfe6_field_0, &__struct_info__e651dfe6_field_1, &__struct_info__e651dfe6_field_2, &__struct_info__e651dfe6_field_3, &__struct_info__e651dfe6_field_4, &__struct_info__e651dfe6_field_5, &__struct_info__e651dfe6_field_6, &__struct_info__e651dfe6_field_7, &__struct_info__e651dfe6_field_8, &__struct_info__e651dfe6_field_9, &__struct_info__e651dfe6_field_10, &__struct_info__e651dfe6_field_11, &__struct_info__e651dfe6_field_12 };
+StructInfo __struct_info__e651dfe6 = {"_lambda_thismodule_125_12_28", __struct_info__e651dfe6_fields, 13, 112, -1, nullptr, 0xe651dfe6 };
+TypeInfo * __type_info__cb124f1_arg_types_var_2562076272[2] = { &__type_info__e09ef0a0, &__type_info__359c1b32 };
+VarInfo __struct_info__98b62e70_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cb124f1_arg_types_var_2562076272, nullptr, 2, 0, nullptr, 28, 0xcb124f1, "__lambda", 0 };
+TypeInfo * __type_info__ec160f60_arg_types_var_2562076272[1] = { &__type_info__cbd13238 };
+VarInfo __struct_info__98b62e70_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ec160f60_arg_types_var_2562076272, nullptr, 1, 0, nullptr, 28, 0xec160f60, "__finalize", 4 };
+VarInfo * __struct_info__98b62e70_fields[2] =  { &__struct_info__98b62e70_field_0, &__struct_info__98b62e70_field_1 };
+StructInfo __struct_info__98b62e70 = {"_lambda_thismodule_172_30_17", __struct_info__98b62e70_fields, 2, 8, -1, nullptr, 0x98b62e70 };
+TypeInfo * __type_info__beafb69d_arg_types_var_1811427084[2] = { &__type_info__3ab1fc7c, &__type_info__6df81eef };
+VarInfo __struct_info__6bf82f0c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__beafb69d_arg_types_var_1811427084, nullptr, 2, 0, nullptr, 28, 0xbeafb69d, "__lambda", 0 };
+TypeInfo * __type_info__ee7e6124_arg_types_var_1811427084[1] = { &__type_info__8919a794 };
+VarInfo __struct_info__6bf82f0c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ee7e6124_arg_types_var_1811427084, nullptr, 1, 0, nullptr, 28, 0xee7e6124, "__finalize", 4 };
+VarInfo __struct_info__6bf82f0c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xecbee68b, "__yield", 8 };
+VarInfo __struct_info__6bf82f0c_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6c914b27, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xd136e61e, "src", 16 };
+VarInfo __struct_info__6bf82f0c_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xab591494, "start", 24 };
+VarInfo __struct_info__6bf82f0c_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x84741750, "stop", 28 };
+VarInfo __struct_info__6bf82f0c_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x6d164326, "_loop_at_145", 32 };
+VarInfo __struct_info__6bf82f0c_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6c914b27, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xf89b8a, "_source_0_at_145", 40 };
+VarInfo __struct_info__6bf82f0c_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x5d482f0, "x", 48 };
+VarInfo __struct_info__6bf82f0c_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc56da57e, "_pvar_0_at_145", 56 };
+VarInfo __struct_info__6bf82f0c_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xf6d46b53, "i", 64 };
+VarInfo __struct_info__6bf82f0c_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xae786acf, "_pvar_1_at_145", 72 };
+VarInfo __struct_info__6bf82f0c_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x550b319b, "_source_1_at_145", 80 };
+VarInfo * __struct_info__6bf82f0c_fields[13] =  { &__struct_info__6bf82f0c_field_0, &__struct_info__6bf82f0c_field_1, &__struct_info__6bf82f0c_field_2, &__struct_info__6bf82f0c_field_3, &__struct_info__6bf82f0c_field_4, &__struct_info__6bf82f0c_field_5, &__struct_info__6bf82f0c_field_6, &__struct_info__6bf82f0c_field_7, &__struct_info__6bf82f0c_field_8, &__struct_info__6bf82f0c_field_9, &__struct_info__6bf82f0c_field_10, &__struct_info__6bf82f0c_field_11, &__struct_info__6bf82f0c_field_12 };
+StructInfo __struct_info__6bf82f0c = {"_lambda_thismodule_145_12_33", __struct_info__6bf82f0c_fields, 13, 88, -1, nullptr, 0x6bf82f0c };
+TypeInfo * __type_info__2a8a25ef_arg_types_var_1844982322[2] = { &__type_info__3cb1ffa2, &__type_info__8bc49635 };
+VarInfo __struct_info__6df83232_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__2a8a25ef_arg_types_var_1844982322, nullptr, 2, 0, nullptr, 28, 0x2a8a25ef, "__lambda", 0 };
+TypeInfo * __type_info__48024766_arg_types_var_1844982322[1] = { &__type_info__8b19aaba };
+VarInfo __struct_info__6df83232_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__48024766_arg_types_var_1844982322, nullptr, 1, 0, nullptr, 28, 0x48024766, "__finalize", 4 };
+VarInfo __struct_info__6df83232_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x108697d, "__yield", 8 };
+VarInfo __struct_info__6df83232_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__430d762d, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x4872697c, "src", 16 };
+VarInfo __struct_info__6df83232_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x28172d36, "start", 24 };
+VarInfo __struct_info__6df83232_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x3b15665e, "stop", 28 };
+VarInfo __struct_info__6df83232_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xedf0c08, "_loop_at_145", 32 };
+VarInfo __struct_info__6df83232_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__430d762d, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xc7e93868, "_source_0_at_145", 40 };
+VarInfo __struct_info__6df83232_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x9bd6acaa, "x", 48 };
+VarInfo __struct_info__6df83232_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4169c5c, "_pvar_0_at_145", 56 };
+VarInfo __struct_info__6df83232_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xacd6c76d, "i", 64 };
+VarInfo __struct_info__6df83232_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x966afd4d, "_pvar_1_at_145", 72 };
+VarInfo __struct_info__6df83232_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x23edf279, "_source_1_at_145", 80 };
+VarInfo * __struct_info__6df83232_fields[13] =  { &__struct_info__6df83232_field_0, &__struct_info__6df83232_field_1, &__struct_info__6df83232_field_2, &__struct_info__6df83232_field_3, &__struct_info__6df83232_field_4, &__struct_info__6df83232_field_5, &__struct_info__6df83232_field_6, &__struct_info__6df83232_field_7, &__struct_info__6df83232_field_8, &__struct_info__6df83232_field_9, &__struct_info__6df83232_field_10, &__struct_info__6df83232_field_11, &__struct_info__6df83232_field_12 };
+StructInfo __struct_info__6df83232 = {"_lambda_thismodule_145_12_31", __struct_info__6df83232_fields, 13, 88, -1, nullptr, 0x6df83232 };
+TypeInfo * __type_info__d5f6b217_arg_types_var_4167240426[2] = { &__type_info__8dc06b9a, &__type_info__f1b9498d };
+VarInfo __struct_info__f8630aea_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__d5f6b217_arg_types_var_4167240426, nullptr, 2, 0, nullptr, 28, 0xd5f6b217, "__lambda", 0 };
+TypeInfo * __type_info__9f6a71de_arg_types_var_4167240426[1] = { &__type_info__ee787d42 };
+VarInfo __struct_info__f8630aea_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9f6a71de_arg_types_var_4167240426, nullptr, 1, 0, nullptr, 28, 0x9f6a71de, "__finalize", 4 };
+VarInfo * __struct_info__f8630aea_fields[2] =  { &__struct_info__f8630aea_field_0, &__struct_info__f8630aea_field_1 };
+StructInfo __struct_info__f8630aea = {"_lambda_thismodule_93_29_35", __struct_info__f8630aea_fields, 2, 8, -1, nullptr, 0xf8630aea };
+TypeInfo * __type_info__5a521f3e_arg_types_var_3778258437[2] = { &__type_info__4a052b5, &__type_info__e6eb6b88 };
+VarInfo __struct_info__e133a605_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__5a521f3e_arg_types_var_3778258437, nullptr, 2, 0, nullptr, 28, 0x5a521f3e, "__lambda", 0 };
+TypeInfo * __type_info__6c33833b_arg_types_var_3778258437[1] = { &__type_info__38e3c99d };
+VarInfo __struct_info__e133a605_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c33833b_arg_types_var_3778258437, nullptr, 1, 0, nullptr, 28, 0x6c33833b, "__finalize", 4 };
+VarInfo __struct_info__e133a605_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x6f5e25ea, "__yield", 8 };
+TypeInfo * __type_info__90147d82_arg_types_var_3778258437[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__e133a605_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__90147d82_arg_types_var_3778258437, nullptr, 1, 0, nullptr, 0, 0x90147d82, "blk", 16 };
+VarInfo __struct_info__e133a605_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x4b9448ef, "src", 24 };
+VarInfo __struct_info__e133a605_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xef3ac3ff, "_loop_at_31", 32 };
+VarInfo __struct_info__e133a605_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x999df74b, "_source_0_at_31", 40 };
+VarInfo __struct_info__e133a605_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x3d7dac2c, "w", 48 };
+VarInfo __struct_info__e133a605_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2f101fb7, "_pvar_0_at_31", 56 };
+VarInfo * __struct_info__e133a605_fields[9] =  { &__struct_info__e133a605_field_0, &__struct_info__e133a605_field_1, &__struct_info__e133a605_field_2, &__struct_info__e133a605_field_3, &__struct_info__e133a605_field_4, &__struct_info__e133a605_field_5, &__struct_info__e133a605_field_6, &__struct_info__e133a605_field_7, &__struct_info__e133a605_field_8 };
+StructInfo __struct_info__e133a605 = {"_lambda_thismodule_31_12_25", __struct_info__e133a605_fields, 9, 64, -1, nullptr, 0xe133a605 };
+TypeInfo * __type_info__43f5bfed_arg_types_var_527738108[2] = { &__type_info__fc8e246c, &__type_info__f1b9498d };
+VarInfo __struct_info__1f74a4fc_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, (TypeInfo **)__type_info__43f5bfed_arg_types_var_527738108, nullptr, 2, 0, nullptr, 28, 0x43f5bfed, "__lambda", 0 };
+TypeInfo * __type_info__fb770a54_arg_types_var_527738108[1] = { &__type_info__479b2884 };
+VarInfo __struct_info__1f74a4fc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fb770a54_arg_types_var_527738108, nullptr, 1, 0, nullptr, 28, 0xfb770a54, "__finalize", 4 };
+VarInfo * __struct_info__1f74a4fc_fields[2] =  { &__struct_info__1f74a4fc_field_0, &__struct_info__1f74a4fc_field_1 };
+StructInfo __struct_info__1f74a4fc = {"_lambda_thismodule_92_36_32", __struct_info__1f74a4fc_fields, 2, 8, -1, nullptr, 0x1f74a4fc };
+TypeInfo * __type_info__9e7eaf5f_arg_types_var_1352253122[2] = { &__type_info__b42f8ab2, &__type_info__e6eb6b88 };
+VarInfo __struct_info__5099bec2_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__9e7eaf5f_arg_types_var_1352253122, nullptr, 2, 0, nullptr, 28, 0x9e7eaf5f, "__lambda", 0 };
+TypeInfo * __type_info__7e221ab6_arg_types_var_1352253122[1] = { &__type_info__1f07c8fa };
+VarInfo __struct_info__5099bec2_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7e221ab6_arg_types_var_1352253122, nullptr, 1, 0, nullptr, 28, 0x7e221ab6, "__finalize", 4 };
+VarInfo __struct_info__5099bec2_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xb2a3eaad, "__yield", 8 };
+VarInfo __struct_info__5099bec2_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc16859b5, "count", 12 };
+VarInfo __struct_info__5099bec2_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x64d79b27, "value", 16 };
+VarInfo __struct_info__5099bec2_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x911acc39, "_loop_at_164", 20 };
+VarInfo __struct_info__5099bec2_field_6 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x1320c55a, "x", 24 };
+VarInfo __struct_info__5099bec2_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xef38d86d, "_pvar_0_at_164", 32 };
+VarInfo __struct_info__5099bec2_field_8 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xb6defe19, "_source_0_at_164", 40 };
+VarInfo * __struct_info__5099bec2_fields[9] =  { &__struct_info__5099bec2_field_0, &__struct_info__5099bec2_field_1, &__struct_info__5099bec2_field_2, &__struct_info__5099bec2_field_3, &__struct_info__5099bec2_field_4, &__struct_info__5099bec2_field_5, &__struct_info__5099bec2_field_6, &__struct_info__5099bec2_field_7, &__struct_info__5099bec2_field_8 };
+StructInfo __struct_info__5099bec2 = {"_lambda_thismodule_161_8_3", __struct_info__5099bec2_fields, 9, 48, -1, nullptr, 0x5099bec2 };
+TypeInfo * __type_info__2564fdb8_arg_types_var_2041999467[2] = { &__type_info__cf91711b, &__type_info__260b3481 };
+VarInfo __struct_info__79b6706b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__2564fdb8_arg_types_var_2041999467, nullptr, 2, 0, nullptr, 28, 0x2564fdb8, "__lambda", 0 };
+TypeInfo * __type_info__64201aed_arg_types_var_2041999467[1] = { &__type_info__575c1f43 };
+VarInfo __struct_info__79b6706b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__64201aed_arg_types_var_2041999467, nullptr, 1, 0, nullptr, 28, 0x64201aed, "__finalize", 4 };
+VarInfo __struct_info__79b6706b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xfaf7654c, "__yield", 8 };
+VarInfo __struct_info__79b6706b_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe2a602c0, "_loop_at_243", 12 };
+VarInfo __struct_info__79b6706b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x3545119b, "x", 16 };
+VarInfo __struct_info__79b6706b_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x19f851a4, "_pvar_0_at_243", 24 };
+VarInfo __struct_info__79b6706b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xc6919440, "_source_0_at_243", 32 };
+VarInfo * __struct_info__79b6706b_fields[7] =  { &__struct_info__79b6706b_field_0, &__struct_info__79b6706b_field_1, &__struct_info__79b6706b_field_2, &__struct_info__79b6706b_field_3, &__struct_info__79b6706b_field_4, &__struct_info__79b6706b_field_5, &__struct_info__79b6706b_field_6 };
+StructInfo __struct_info__79b6706b = {"_lambda_thismodule_243_18_13", __struct_info__79b6706b_fields, 7, 40, -1, nullptr, 0x79b6706b };
+TypeInfo * __type_info__30ff4f18_arg_types_var_3401640139[2] = { &__type_info__d7010bfb, &__type_info__e6eb6b88 };
+VarInfo __struct_info__cac0e8cb_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__30ff4f18_arg_types_var_3401640139, nullptr, 2, 0, nullptr, 28, 0x30ff4f18, "__lambda", 0 };
+TypeInfo * __type_info__b8d2cd4d_arg_types_var_3401640139[1] = { &__type_info__b4ab2da3 };
+VarInfo __struct_info__cac0e8cb_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b8d2cd4d_arg_types_var_3401640139, nullptr, 1, 0, nullptr, 28, 0xb8d2cd4d, "__finalize", 4 };
+VarInfo __struct_info__cac0e8cb_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x7800272c, "__yield", 8 };
+VarInfo __struct_info__cac0e8cb_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xcc111afd, "src", 16 };
+VarInfo __struct_info__cac0e8cb_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x246f936c, "arr", 24 };
+VarInfo __struct_info__cac0e8cb_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x4e5ccd53, "___loop_at_118_rename_at_118", 48 };
+VarInfo __struct_info__cac0e8cb_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xfc981fdd, "__x_rename_at_118", 56 };
+VarInfo __struct_info__cac0e8cb_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x672be2f3, "___pvar_0_at_118_rename_at_118", 64 };
+VarInfo __struct_info__cac0e8cb_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd4114e39, "_loop_at_114", 72 };
+VarInfo __struct_info__cac0e8cb_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xe3344379, "_source_0_at_114", 80 };
+VarInfo __struct_info__cac0e8cb_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x626a927b, "x", 88 };
+VarInfo __struct_info__cac0e8cb_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xaeb62e0d, "_pvar_0_at_114", 96 };
+VarInfo __struct_info__cac0e8cb_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__e6eb6b88, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x94434c5f, "___source_0_at_118_rename_at_118", 104 };
+VarInfo * __struct_info__cac0e8cb_fields[13] =  { &__struct_info__cac0e8cb_field_0, &__struct_info__cac0e8cb_field_1, &__struct_info__cac0e8cb_field_2, &__struct_info__cac0e8cb_field_3, &__struct_info__cac0e8cb_field_4, &__struct_info__cac0e8cb_field_5, &__struct_info__cac0e8cb_field_6, &__struct_info__cac0e8cb_field_7, &__struct_info__cac0e8cb_field_8, &__struct_info__cac0e8cb_field_9, &__struct_info__cac0e8cb_field_10, &__struct_info__cac0e8cb_field_11, &__struct_info__cac0e8cb_field_12 };
+StructInfo __struct_info__cac0e8cb = {"_lambda_thismodule_113_12_19", __struct_info__cac0e8cb_fields, 13, 112, -1, nullptr, 0xcac0e8cb };
+TypeInfo * __type_info__b5a7b0aa_arg_types_var_2991875777[2] = { &__type_info__16899671, &__type_info__e6eb6b88 };
+VarInfo __struct_info__b25466c1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__b5a7b0aa_arg_types_var_2991875777, nullptr, 2, 0, nullptr, 28, 0xb5a7b0aa, "__lambda", 0 };
+TypeInfo * __type_info__551333bf_arg_types_var_2991875777[1] = { &__type_info__d9e606f9 };
+VarInfo __struct_info__b25466c1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__551333bf_arg_types_var_2991875777, nullptr, 1, 0, nullptr, 28, 0x551333bf, "__finalize", 4 };
+VarInfo __struct_info__b25466c1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x2b53371d, "start", 8 };
+VarInfo __struct_info__b25466c1_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe6bb03e5, "step", 12 };
+VarInfo * __struct_info__b25466c1_fields[4] =  { &__struct_info__b25466c1_field_0, &__struct_info__b25466c1_field_1, &__struct_info__b25466c1_field_2, &__struct_info__b25466c1_field_3 };
+StructInfo __struct_info__b25466c1 = {"_lambda_thismodule_154_8_2", __struct_info__b25466c1_fields, 4, 16, -1, nullptr, 0xb25466c1 };
+TypeInfo * __type_info__7d229efa_arg_types_var_2763894257[2] = { &__type_info__636e62a1, &__type_info__3c15753 };
+VarInfo __struct_info__a4bdadf1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__7d229efa_arg_types_var_2763894257, nullptr, 2, 0, nullptr, 28, 0x7d229efa, "__lambda", 0 };
+TypeInfo * __type_info__932f3a6f_arg_types_var_2763894257[1] = { &__type_info__70b9d639 };
+VarInfo __struct_info__a4bdadf1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__932f3a6f_arg_types_var_2763894257, nullptr, 1, 0, nullptr, 28, 0x932f3a6f, "__finalize", 4 };
+VarInfo __struct_info__a4bdadf1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xee29c2be, "__yield", 8 };
+VarInfo __struct_info__a4bdadf1_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x5c6dc5f6, "_loop_at_232", 12 };
+VarInfo __struct_info__a4bdadf1_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x6db5678d, "x", 16 };
+VarInfo __struct_info__a4bdadf1_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x16c7d036, "_pvar_0_at_232", 24 };
+VarInfo __struct_info__a4bdadf1_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x870881e2, "_source_0_at_232", 32 };
+VarInfo * __struct_info__a4bdadf1_fields[7] =  { &__struct_info__a4bdadf1_field_0, &__struct_info__a4bdadf1_field_1, &__struct_info__a4bdadf1_field_2, &__struct_info__a4bdadf1_field_3, &__struct_info__a4bdadf1_field_4, &__struct_info__a4bdadf1_field_5, &__struct_info__a4bdadf1_field_6 };
+StructInfo __struct_info__a4bdadf1 = {"_lambda_thismodule_232_10_8", __struct_info__a4bdadf1_fields, 7, 40, -1, nullptr, 0xa4bdadf1 };
+TypeInfo * __type_info__4056a5c4_arg_types_var_1898599463[2] = { &__type_info__df321397, &__type_info__413b3264 };
+VarInfo __struct_info__712a5427_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__4056a5c4_arg_types_var_1898599463, nullptr, 2, 0, nullptr, 28, 0x4056a5c4, "__lambda", 0 };
+TypeInfo * __type_info__3c948071_arg_types_var_1898599463[1] = { &__type_info__564b8c0f };
+VarInfo __struct_info__712a5427_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3c948071_arg_types_var_1898599463, nullptr, 1, 0, nullptr, 28, 0x3c948071, "__finalize", 4 };
+VarInfo __struct_info__712a5427_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe7146240, "__yield", 8 };
+VarInfo __struct_info__712a5427_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x8ff18fac, "_loop_at_50", 12 };
+VarInfo __struct_info__712a5427_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xbb1b1947, "x", 16 };
+VarInfo __struct_info__712a5427_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3a849630, "_pvar_0_at_50", 24 };
+VarInfo __struct_info__712a5427_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x1b8cb484, "_source_0_at_50", 32 };
+VarInfo * __struct_info__712a5427_fields[7] =  { &__struct_info__712a5427_field_0, &__struct_info__712a5427_field_1, &__struct_info__712a5427_field_2, &__struct_info__712a5427_field_3, &__struct_info__712a5427_field_4, &__struct_info__712a5427_field_5, &__struct_info__712a5427_field_6 };
+StructInfo __struct_info__712a5427 = {"_lambda_thismodule_50_23_4", __struct_info__712a5427_fields, 7, 40, -1, nullptr, 0x712a5427 };
+TypeInfo * __type_info__79f4cfa_arg_types_var_1867847665[2] = { &__type_info__76f93d21, &__type_info__e6eb6b88 };
+VarInfo __struct_info__6f5517f1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__79f4cfa_arg_types_var_1867847665, nullptr, 2, 0, nullptr, 28, 0x79f4cfa, "__lambda", 0 };
+TypeInfo * __type_info__273e986f_arg_types_var_1867847665[1] = { &__type_info__1078e869 };
+VarInfo __struct_info__6f5517f1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__273e986f_arg_types_var_1867847665, nullptr, 1, 0, nullptr, 28, 0x273e986f, "__finalize", 4 };
+VarInfo __struct_info__6f5517f1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xeddf1cbe, "__yield", 8 };
+VarInfo __struct_info__6f5517f1_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xb8d1180b, "src", 16 };
+VarInfo __struct_info__6f5517f1_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xaa3440cd, "start", 24 };
+VarInfo __struct_info__6f5517f1_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd2c1237f, "stop", 28 };
+VarInfo __struct_info__6f5517f1_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6606d62, "_loop_at_139", 32 };
+VarInfo __struct_info__6f5517f1_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x843707be, "_source_0_at_139", 40 };
+VarInfo __struct_info__6f5517f1_field_8 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xe590118d, "x", 48 };
+VarInfo __struct_info__6f5517f1_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x5cc827a2, "_pvar_0_at_139", 56 };
+VarInfo __struct_info__6f5517f1_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd48ff6ca, "i", 64 };
+VarInfo __struct_info__6f5517f1_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x68aa7963, "_pvar_1_at_139", 72 };
+VarInfo __struct_info__6f5517f1_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x2c7fe21f, "_source_1_at_139", 80 };
+VarInfo * __struct_info__6f5517f1_fields[13] =  { &__struct_info__6f5517f1_field_0, &__struct_info__6f5517f1_field_1, &__struct_info__6f5517f1_field_2, &__struct_info__6f5517f1_field_3, &__struct_info__6f5517f1_field_4, &__struct_info__6f5517f1_field_5, &__struct_info__6f5517f1_field_6, &__struct_info__6f5517f1_field_7, &__struct_info__6f5517f1_field_8, &__struct_info__6f5517f1_field_9, &__struct_info__6f5517f1_field_10, &__struct_info__6f5517f1_field_11, &__struct_info__6f5517f1_field_12 };
+StructInfo __struct_info__6f5517f1 = {"_lambda_thismodule_139_12_22", __struct_info__6f5517f1_fields, 13, 88, -1, nullptr, 0x6f5517f1 };
+VarInfo __func_info__2e807d1c_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xce6336d2, "x", 0 };
+VarInfo __func_info__2e807d1c_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x393cbc39, "y", 0 };
+VarInfo * __func_info__2e807d1c_fields[2] =  { &__func_info__2e807d1c_field_0, &__func_info__2e807d1c_field_1 };
+FuncInfo __func_info__2e807d1c = {"invoke block<(x:int const;y:int const):int const> const", "", __func_info__2e807d1c_fields, 2, 32, &__type_info__359c1b32, nullptr,0,0x2e807d1c, 0x0 };
+TypeInfo * __type_info__23412d03_arg_types_var_1447434019[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+VarInfo __func_info__56461723_field_0 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__23412d03_arg_types_var_1447434019, nullptr, 2, 0, nullptr, 2110, 0x23412d03, "x", 0 };
+TypeInfo * __type_info__2efc05a_arg_types_var_1447434019[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+VarInfo __func_info__56461723_field_1 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__2efc05a_arg_types_var_1447434019, nullptr, 2, 0, nullptr, 2110, 0x2efc05a, "y", 0 };
+VarInfo * __func_info__56461723_fields[2] =  { &__func_info__56461723_field_0, &__func_info__56461723_field_1 };
+FuncInfo __func_info__56461723 = {"invoke block<(x:tuple<int;float> const;y:tuple<int;float> const):tuple<int;float> const> const", "", __func_info__56461723_fields, 2, 32, &__type_info__58ba7e63, nullptr,0,0x56461723, 0x0 };
+TypeInfo __type_info__d238d5a8 = { Type::tStructure, &__struct_info__44989078, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xd238d5a8 };
+TypeInfo __type_info__6c914b27 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 258, 0x6c914b27 };
+TypeInfo __type_info__d27d2f5d = { Type::tStructure, &__struct_info__278f712d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xd27d2f5d };
+TypeInfo __type_info__8b19aaba = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3cb1ffa2, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8b19aaba };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x13667ab1 };
+TypeInfo __type_info__db3d6827 = { Type::tStructure, &__struct_info__237acdb7, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xdb3d6827 };
+TypeInfo __type_info__73acd24d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ad459a25, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x73acd24d };
+TypeInfo __type_info__b4ab2da3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d7010bfb, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb4ab2da3 };
+TypeInfo __type_info__564b8c0f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__df321397, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x564b8c0f };
+TypeInfo __type_info__35e3c4e4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1a04dfc, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x35e3c4e4 };
+TypeInfo __type_info__f96efa8d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76b9d575, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf96efa8d };
+TypeInfo __type_info__45839f1 = { Type::tStructure, &__struct_info__b79e1c01, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x45839f1 };
+TypeInfo __type_info__5b038296 = { Type::tStructure, &__struct_info__632e7ca6, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5b038296 };
+TypeInfo __type_info__76f93d21 = { Type::tStructure, &__struct_info__6f5517f1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x76f93d21 };
+TypeInfo __type_info__fc05925b = { Type::tStructure, &__struct_info__67c568ab, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xfc05925b };
+TypeInfo __type_info__ee787d42 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8dc06b9a, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xee787d42 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__575f76e9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__45839f1, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x575f76e9 };
+TypeInfo __type_info__4a052b5 = { Type::tStructure, &__struct_info__e133a605, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4a052b5 };
+TypeInfo __type_info__b57008b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__34f42543, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb57008b };
+TypeInfo __type_info__1078e869 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76f93d21, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1078e869 };
+TypeInfo __type_info__146e3c83 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fc05925b, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x146e3c83 };
+TypeInfo __type_info__1314879c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da3d6694, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1314879c };
+TypeInfo * __type_info__3c15753_arg_types[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+TypeInfo __type_info__3c15753 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__3c15753_arg_types, nullptr, 2, 0, nullptr, 2078, 0x3c15753 };
+TypeInfo __type_info__b7e6d021 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3a28fb9, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb7e6d021 };
+TypeInfo __type_info__df321397 = { Type::tStructure, &__struct_info__712a5427, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xdf321397 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__636e62a1 = { Type::tStructure, &__struct_info__a4bdadf1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x636e62a1 };
+TypeInfo __type_info__d9e606f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__16899671, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd9e606f9 };
+TypeInfo __type_info__16899671 = { Type::tStructure, &__struct_info__b25466c1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x16899671 };
+TypeInfo __type_info__59047065 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d27d2f5d, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x59047065 };
+TypeInfo __type_info__f1b9498d = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xf1b9498d };
+TypeInfo __type_info__37f8377d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3bc97285, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x37f8377d };
+TypeInfo __type_info__8dc06b9a = { Type::tStructure, &__struct_info__f8630aea, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x8dc06b9a };
+TypeInfo __type_info__1414892f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__db3d6827, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1414892f };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0xe6eb6b88 };
+TypeInfo __type_info__1983f0e3 = { Type::tStructure, &__struct_info__2c66e33, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x1983f0e3 };
+TypeInfo __type_info__260b3481 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x260b3481 };
+TypeInfo __type_info__479b2884 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fc8e246c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x479b2884 };
+TypeInfo __type_info__21ca7a51 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d8d67e29, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x21ca7a51 };
+TypeInfo __type_info__63564868 = { Type::tStructure, &__struct_info__3a106938, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x63564868 };
+TypeInfo __type_info__413b3264 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__359c1b32, nullptr, nullptr, nullptr, 0, 0, nullptr, 269, 0x413b3264 };
+TypeInfo __type_info__d7010bfb = { Type::tStructure, &__struct_info__cac0e8cb, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd7010bfb };
+TypeInfo __type_info__76b9d575 = { Type::tStructure, &__struct_info__9feadc05, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x76b9d575 };
+TypeInfo __type_info__d8d67e29 = { Type::tStructure, &__struct_info__e751e179, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd8d67e29 };
+TypeInfo __type_info__3cb1ffa2 = { Type::tStructure, &__struct_info__6df83232, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x3cb1ffa2 };
+TypeInfo __type_info__fea04943 = { Type::tStructure, &__struct_info__db339c93, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xfea04943 };
+TypeInfo __type_info__cf91711b = { Type::tStructure, &__struct_info__79b6706b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xcf91711b };
+TypeInfo __type_info__f9c3b13b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4f1f8183, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf9c3b13b };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__20ca78be = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d7d67c96, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x20ca78be };
+TypeInfo __type_info__4f1f8183 = { Type::tStructure, &__struct_info__f5ea5153, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x4f1f8183 };
+TypeInfo __type_info__ac13bbb3 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0xac13bbb3 };
+TypeInfo __type_info__b42f8ab2 = { Type::tStructure, &__struct_info__5099bec2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xb42f8ab2 };
+TypeInfo __type_info__1f07c8fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b42f8ab2, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1f07c8fa };
+TypeInfo __type_info__8bc49635 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 269, 0x8bc49635 };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+TypeInfo __type_info__3a05122 = { Type::tStructure, &__struct_info__e033a472, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3a05122 };
+TypeInfo __type_info__38e3c99d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4a052b5, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x38e3c99d };
+TypeInfo __type_info__8919a794 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3ab1fc7c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8919a794 };
+TypeInfo __type_info__3ab1fc7c = { Type::tStructure, &__struct_info__6bf82f0c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x3ab1fc7c };
+TypeInfo __type_info__34f42543 = { Type::tStructure, &__struct_info__531ce5d3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x34f42543 };
+TypeInfo __type_info__a969907c = { Type::tStructure, &__struct_info__d5e64c8c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xa969907c };
+TypeInfo __type_info__82115e6d = { Type::tStructure, &__struct_info__3a289c3d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x82115e6d };
+TypeInfo __type_info__3a28fb9 = { Type::tStructure, &__struct_info__6036ac89, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3a28fb9 };
+TypeInfo * __type_info__58ba7e63_arg_types[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+TypeInfo __type_info__58ba7e63 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__58ba7e63_arg_types, nullptr, 2, 0, nullptr, 2110, 0x58ba7e63 };
+TypeInfo * __type_info__430d762d_arg_types[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+TypeInfo __type_info__430d762d = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__430d762d_arg_types, nullptr, 2, 0, nullptr, 2334, 0x430d762d };
+TypeInfo __type_info__e5bb2fbb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1983f0e3, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe5bb2fbb };
+TypeInfo __type_info__34ea7395 = { Type::tStructure, &__struct_info__e2118965, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x34ea7395 };
+TypeInfo __type_info__e09ef0a0 = { Type::tStructure, &__struct_info__98b62e70, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xe09ef0a0 };
+TypeInfo __type_info__a9c65abe = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5b038296, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa9c65abe };
+TypeInfo __type_info__cd314265 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__82115e6d, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xcd314265 };
+TypeInfo __type_info__ffd30770 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__63564868, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xffd30770 };
+TypeInfo __type_info__8f9c436d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__34ea7395, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8f9c436d };
+TypeInfo __type_info__32e3c02b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fea04943, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x32e3c02b };
+TypeInfo __type_info__da3d6694 = { Type::tStructure, &__struct_info__227acc24, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xda3d6694 };
+TypeInfo __type_info__575c1f43 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cf91711b, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x575c1f43 };
+TypeInfo __type_info__3bc97285 = { Type::tStructure, &__struct_info__4b8ba355, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x3bc97285 };
+TypeInfo __type_info__6df81eef = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 269, 0x6df81eef };
+TypeInfo __type_info__d7d67c96 = { Type::tStructure, &__struct_info__e651dfe6, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd7d67c96 };
+TypeInfo __type_info__9b0d4e04 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a969907c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x9b0d4e04 };
+TypeInfo __type_info__37e3c80a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3a05122, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x37e3c80a };
+TypeInfo __type_info__fc8e246c = { Type::tStructure, &__struct_info__1f74a4fc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xfc8e246c };
+TypeInfo __type_info__cb86e0e0 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d238d5a8, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xcb86e0e0 };
+TypeInfo __type_info__ad459a25 = { Type::tStructure, &__struct_info__e7130a75, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xad459a25 };
+TypeInfo __type_info__cbd13238 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e09ef0a0, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xcbd13238 };
+TypeInfo __type_info__70b9d639 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__636e62a1, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x70b9d639 };
+TypeInfo __type_info__1a04dfc = { Type::tStructure, &__struct_info__de33a14c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1a04dfc };
+
+namespace  {
+
+struct _lambda_thismodule_85_28_1 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_85_28_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_85_28_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_85_28_1)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_85_28_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_85_28_1,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_154_8_2 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_154_8_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_154_8_2 *)) __finalize;
+	int32_t start;
+	int32_t step;
+};
+static_assert(sizeof(_lambda_thismodule_154_8_2)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_154_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_154_8_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_154_8_2,start)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_154_8_2,step)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_161_8_3 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_161_8_3,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_161_8_3 *)) __finalize;
+	int32_t __yield;
+	int32_t count;
+	int32_t value;
+	bool _loop_at_164;
+	int32_t x;
+	void * _pvar_0_at_164;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_164;
+};
+static_assert(sizeof(_lambda_thismodule_161_8_3)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_161_8_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_161_8_3,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_161_8_3,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_161_8_3,count)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_161_8_3,value)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_161_8_3,_loop_at_164)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_161_8_3,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_161_8_3,_pvar_0_at_164)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_161_8_3,_source_0_at_164)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_50_23_4 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_50_23_4,int32_t const  * &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_50_23_4 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_50;
+	int32_t x;
+	void * _pvar_0_at_50;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_50;
+};
+static_assert(sizeof(_lambda_thismodule_50_23_4)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_loop_at_50)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_pvar_0_at_50)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_source_0_at_50)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_106_15_5 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_106_15_5,int32_t const  * &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_106_15_5 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_106;
+	int32_t x;
+	void * _pvar_0_at_106;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_106;
+};
+static_assert(sizeof(_lambda_thismodule_106_15_5)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_loop_at_106)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_pvar_0_at_106)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_source_0_at_106)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_139_28_6 {
+	Func DAS_COMMENT((TTuple<8,int32_t,float>,struct _lambda_thismodule_139_28_6,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_139_28_6 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_139_28_6)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_28_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_28_6,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_227_19_7 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_227_19_7,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_227_19_7 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_227;
+	int32_t x;
+	void * _pvar_0_at_227;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_227;
+};
+static_assert(sizeof(_lambda_thismodule_227_19_7)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_loop_at_227)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_pvar_0_at_227)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_source_0_at_227)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_232_10_8 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_232_10_8,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_232_10_8 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_232;
+	int32_t x;
+	void * _pvar_0_at_232;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_232;
+};
+static_assert(sizeof(_lambda_thismodule_232_10_8)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_loop_at_232)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_pvar_0_at_232)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_source_0_at_232)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_235_18_9 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_235_18_9,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_235_18_9 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_235;
+	int32_t x;
+	void * _pvar_0_at_235;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_235;
+};
+static_assert(sizeof(_lambda_thismodule_235_18_9)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_loop_at_235)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_pvar_0_at_235)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_source_0_at_235)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_56_21_10 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_56_21_10,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_56_21_10 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_56;
+	int32_t x;
+	void * _pvar_0_at_56;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_56;
+};
+static_assert(sizeof(_lambda_thismodule_56_21_10)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_loop_at_56)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_pvar_0_at_56)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_source_0_at_56)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_90_14_11 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_90_14_11,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_90_14_11 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_90;
+	int32_t x;
+	void * _pvar_0_at_90;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_90;
+};
+static_assert(sizeof(_lambda_thismodule_90_14_11)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_loop_at_90)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_pvar_0_at_90)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_source_0_at_90)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_240_10_12 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_240_10_12,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_240_10_12 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_240;
+	int32_t x;
+	void * _pvar_0_at_240;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_240;
+};
+static_assert(sizeof(_lambda_thismodule_240_10_12)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_loop_at_240)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_pvar_0_at_240)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_source_0_at_240)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_243_18_13 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_243_18_13,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_243_18_13 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_243;
+	int32_t x;
+	void * _pvar_0_at_243;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_243;
+};
+static_assert(sizeof(_lambda_thismodule_243_18_13)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_loop_at_243)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_pvar_0_at_243)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_source_0_at_243)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_71_25_14 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_71_25_14,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_71_25_14 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_71_25_14)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_71_25_14,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_71_25_14,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_115_27_15 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_115_27_15,int32_t,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_115_27_15 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_115_27_15)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_115_27_15,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_115_27_15,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_163_30_16 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_163_30_16,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_163_30_16 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_163_30_16)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_30_16,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_30_16,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_172_30_17 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_172_30_17,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_172_30_17 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_172_30_17)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_172_30_17,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_172_30_17,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_180_30_18 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_180_30_18,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_180_30_18 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_180_30_18)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_30_18,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_30_18,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_113_12_19 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_113_12_19,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_113_12_19 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((int32_t)) src;
+	TArray<int32_t> arr;
+	bool ___loop_at_118_rename_at_118;
+	int32_t * __x_rename_at_118;
+	void * ___pvar_0_at_118_rename_at_118;
+	bool _loop_at_114;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_114;
+	int32_t x;
+	void * _pvar_0_at_114;
+	Sequence DAS_COMMENT((int32_t &)) ___source_0_at_118_rename_at_118;
+};
+static_assert(sizeof(_lambda_thismodule_113_12_19)==112,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,arr)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,___loop_at_118_rename_at_118)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,__x_rename_at_118)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,___pvar_0_at_118_rename_at_118)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,_loop_at_114)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,_source_0_at_114)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,x)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,_pvar_0_at_114)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_113_12_19,___source_0_at_118_rename_at_118)==104,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_12_20 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_9_12_20,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_9_12_20 *)) __finalize;
+	int32_t __yield;
+	Func DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_9;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_9;
+	int32_t w;
+	void * _pvar_0_at_9;
+};
+static_assert(sizeof(_lambda_thismodule_9_12_20)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_20,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_20,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_20,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_20,blk)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_20,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_20,_loop_at_9)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_20,_source_0_at_9)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_20,w)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_20,_pvar_0_at_9)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_12_21 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_9_12_21,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_9_12_21 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_9;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_9;
+	int32_t w;
+	void * _pvar_0_at_9;
+};
+static_assert(sizeof(_lambda_thismodule_9_12_21)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_21,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_21,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_21,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_21,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_21,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_21,_loop_at_9)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_21,_source_0_at_9)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_21,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_21,_pvar_0_at_9)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_139_12_22 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_139_12_22,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_139_12_22 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((int32_t)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_139;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_139;
+	int32_t x;
+	void * _pvar_0_at_139;
+	int32_t i;
+	void * _pvar_1_at_139;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_139;
+};
+static_assert(sizeof(_lambda_thismodule_139_12_22)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,start)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,stop)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,_loop_at_139)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,_source_0_at_139)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,x)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,_pvar_0_at_139)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,i)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,_pvar_1_at_139)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_12_22,_source_1_at_139)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_23 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_23,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_23 *)) __finalize;
+	int32_t __yield;
+	Func DAS_COMMENT((int32_t,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_31;
+	int32_t w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_23)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_23,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_23,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_23,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_23,blk)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_23,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_23,_loop_at_31)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_23,_source_0_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_23,w)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_23,_pvar_0_at_31)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_24 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_24,bool &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_24 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_31;
+	int32_t w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_24)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_24,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_24,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_24,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_24,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_24,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_24,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_24,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_24,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_24,_pvar_0_at_31)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_25 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_25,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_25 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_31;
+	int32_t w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_25)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_25,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_25,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_25,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_25,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_25,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_25,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_25,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_25,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_25,_pvar_0_at_31)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_26 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_26,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_26 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_31;
+	int32_t w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_26)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_26,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_26,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_26,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_26,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_26,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_26,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_26,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_26,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_26,_pvar_0_at_31)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_91_25_27 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_91_25_27,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_91_25_27 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_91_25_27)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_91_25_27,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_91_25_27,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_125_12_28 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_125_12_28,TTuple<8,int32_t,float> * &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_125_12_28 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) src;
+	TArray<TTuple<8,int32_t,float>> arr;
+	bool ___loop_at_130_rename_at_130;
+	TTuple<8,int32_t,float> * __x_rename_at_130;
+	void * ___pvar_0_at_130_rename_at_130;
+	bool _loop_at_126;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _source_0_at_126;
+	TTuple<8,int32_t,float> x;
+	void * _pvar_0_at_126;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) ___source_0_at_130_rename_at_130;
+};
+static_assert(sizeof(_lambda_thismodule_125_12_28)==112,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,arr)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,___loop_at_130_rename_at_130)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,__x_rename_at_130)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,___pvar_0_at_130_rename_at_130)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,_loop_at_126)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,_source_0_at_126)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,x)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,_pvar_0_at_126)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_28,___source_0_at_130_rename_at_130)==104,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_125_12_29 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_125_12_29,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_125_12_29 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	TArray<TArray<int32_t>> arr;
+	bool ___loop_at_130_rename_at_130;
+	TArray<int32_t> * __x_rename_at_130;
+	void * ___pvar_0_at_130_rename_at_130;
+	bool _loop_at_126;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_126;
+	TArray<int32_t> x;
+	void * _pvar_0_at_126;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) ___source_0_at_130_rename_at_130;
+};
+static_assert(sizeof(_lambda_thismodule_125_12_29)==128,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,arr)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,___loop_at_130_rename_at_130)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,__x_rename_at_130)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,___pvar_0_at_130_rename_at_130)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,_loop_at_126)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,_source_0_at_126)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,x)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,_pvar_0_at_126)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_12_29,___source_0_at_130_rename_at_130)==120,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_15_12_30 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_15_12_30,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_15_12_30 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	bool _loop_at_15;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_15;
+	TArray<int32_t> w;
+	void * _pvar_0_at_15;
+};
+static_assert(sizeof(_lambda_thismodule_15_12_30)==80,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_12_30,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_12_30,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_12_30,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_12_30,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_12_30,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_12_30,_loop_at_15)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_12_30,_source_0_at_15)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_12_30,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_12_30,_pvar_0_at_15)==72,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_145_12_31 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_145_12_31,TTuple<8,int32_t,float> * &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_145_12_31 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_145;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _source_0_at_145;
+	TTuple<8,int32_t,float> * x;
+	void * _pvar_0_at_145;
+	int32_t i;
+	void * _pvar_1_at_145;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_145;
+};
+static_assert(sizeof(_lambda_thismodule_145_12_31)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,start)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,stop)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,_loop_at_145)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,_source_0_at_145)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,x)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,_pvar_0_at_145)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,i)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,_pvar_1_at_145)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_31,_source_1_at_145)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_92_36_32 {
+	Func DAS_COMMENT((TArray<int32_t>,struct _lambda_thismodule_92_36_32,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_92_36_32 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_92_36_32)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_92_36_32,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_92_36_32,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_145_12_33 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_145_12_33,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_145_12_33 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_145;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) _source_0_at_145;
+	TArray<int32_t> * x;
+	void * _pvar_0_at_145;
+	int32_t i;
+	void * _pvar_1_at_145;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_145;
+};
+static_assert(sizeof(_lambda_thismodule_145_12_33)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,start)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,stop)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,_loop_at_145)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,_source_0_at_145)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,x)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,_pvar_0_at_145)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,i)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,_pvar_1_at_145)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_145_12_33,_source_1_at_145)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_36_12_34 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_36_12_34,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_36_12_34 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) src;
+	bool _loop_at_36;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) _source_0_at_36;
+	TArray<int32_t> * w;
+	void * _pvar_0_at_36;
+};
+static_assert(sizeof(_lambda_thismodule_36_12_34)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_34,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_34,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_34,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_34,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_34,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_34,_loop_at_36)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_34,_source_0_at_36)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_34,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_34,_pvar_0_at_36)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_93_29_35 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_93_29_35,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_93_29_35 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_93_29_35)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_29_35,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_29_35,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_36 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_36,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_36 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_31;
+	TArray<int32_t> w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_36)==80,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_36,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_36,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_36,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_36,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_36,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_36,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_36,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_36,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_36,_pvar_0_at_31)==72,"structure field offset mismatch with DAS");
+}
+
+inline bool _FuncExclEqu_f4f0b94c8df92c7b ( Context * __context__, TArray<int32_t> const  & __a_rename_at_29, TArray<int32_t> const  & __b_rename_at_29 );
+inline bool _FuncExclEqu_e106a056c753c270 ( Context * __context__, TTuple<8,int32_t,float> const  & __a_rename_at_26, TTuple<8,int32_t,float> const  & __b_rename_at_26 );
+inline void _Func_lambda_thismodule_106_15_5_0x60_finazlier_8ac6e00dd2aa8186 ( Context * __context__, struct _lambda_thismodule_106_15_5 * ____this_rename_at_106 );
+inline bool _Func_lambda_thismodule_106_15_5_0x60_function_5476edfb74ad5dc9 ( Context * __context__, struct _lambda_thismodule_106_15_5 & ____this_rename_at_106, int32_t const  * & ___ryield106_rename_at_106 );
+inline void _Func_lambda_thismodule_113_12_19_0x60_finazlier_bfacc70fdb974f9c ( Context * __context__, struct _lambda_thismodule_113_12_19 * ____this_rename_at_113 );
+inline bool _Func_lambda_thismodule_113_12_19_0x60_function_befbad5a0b228273 ( Context * __context__, struct _lambda_thismodule_113_12_19 & ____this_rename_at_113, int32_t & ___yield_113_rename_at_113 );
+inline void _Func_lambda_thismodule_115_27_15_0x60_finazlier_71e19767abe73d8a ( Context * __context__, struct _lambda_thismodule_115_27_15 * ____this_rename_at_115 );
+inline int32_t _Func_lambda_thismodule_115_27_15_0x60_function_e49611e17107a853 ( Context * __context__, struct _lambda_thismodule_115_27_15 & ____this_rename_at_115, int32_t __x_rename_at_115, int32_t __y_rename_at_115 );
+inline void _Func_lambda_thismodule_125_12_28_0x60_finazlier_f2a3e958418ef82 ( Context * __context__, struct _lambda_thismodule_125_12_28 * ____this_rename_at_125 );
+inline bool _Func_lambda_thismodule_125_12_28_0x60_function_f05401f6c9d42882 ( Context * __context__, struct _lambda_thismodule_125_12_28 & ____this_rename_at_125, TTuple<8,int32_t,float> * & ___ryield125_rename_at_125 );
+inline void _Func_lambda_thismodule_125_12_29_0x60_finazlier_d62c8b1cf676ddc ( Context * __context__, struct _lambda_thismodule_125_12_29 * ____this_rename_at_125 );
+inline bool _Func_lambda_thismodule_125_12_29_0x60_function_c37752c67cb16cbf ( Context * __context__, struct _lambda_thismodule_125_12_29 & ____this_rename_at_125, TArray<int32_t> * & ___ryield125_rename_at_125 );
+inline void _Func_lambda_thismodule_139_12_22_0x60_finazlier_3029a31f3ee593ac ( Context * __context__, struct _lambda_thismodule_139_12_22 * ____this_rename_at_139 );
+inline bool _Func_lambda_thismodule_139_12_22_0x60_function_191cac2061c16d6c ( Context * __context__, struct _lambda_thismodule_139_12_22 & ____this_rename_at_139, int32_t & ___yield_139_rename_at_139 );
+inline void _Func_lambda_thismodule_139_28_6_0x60_finazlier_c81b48322132787e ( Context * __context__, struct _lambda_thismodule_139_28_6 * ____this_rename_at_139 );
+inline TTuple<8,int32_t,float> _Func_lambda_thismodule_139_28_6_0x60_function_3ce4133ac81d2d65 ( Context * __context__, struct _lambda_thismodule_139_28_6 & ____this_rename_at_139, int32_t __x_rename_at_139 );
+inline void _Func_lambda_thismodule_145_12_31_0x60_finazlier_70fcc77fb901aacc ( Context * __context__, struct _lambda_thismodule_145_12_31 * ____this_rename_at_145 );
+inline bool _Func_lambda_thismodule_145_12_31_0x60_function_5e6685e57ae94b32 ( Context * __context__, struct _lambda_thismodule_145_12_31 & ____this_rename_at_145, TTuple<8,int32_t,float> * & ___ryield145_rename_at_145 );
+inline void _Func_lambda_thismodule_145_12_33_0x60_finazlier_f4fb1b13b928b854 ( Context * __context__, struct _lambda_thismodule_145_12_33 * ____this_rename_at_145 );
+inline bool _Func_lambda_thismodule_145_12_33_0x60_function_232273f764b02ab2 ( Context * __context__, struct _lambda_thismodule_145_12_33 & ____this_rename_at_145, TArray<int32_t> * & ___ryield145_rename_at_145 );
+inline void _Func_lambda_thismodule_154_8_2_0x60_finazlier_5de4362f29c6b7e ( Context * __context__, struct _lambda_thismodule_154_8_2 * ____this_rename_at_154 );
+inline bool _Func_lambda_thismodule_154_8_2_0x60_function_8cf8bf0eaa9bd84b ( Context * __context__, struct _lambda_thismodule_154_8_2 & ____this_rename_at_154, int32_t & __result_rename_at_153 );
+inline void _Func_lambda_thismodule_15_12_30_0x60_finazlier_c0f0fb43fd5c1b9a ( Context * __context__, struct _lambda_thismodule_15_12_30 * ____this_rename_at_15 );
+inline bool _Func_lambda_thismodule_15_12_30_0x60_function_c264f016790ba619 ( Context * __context__, struct _lambda_thismodule_15_12_30 & ____this_rename_at_15, TArray<int32_t> * & ___ryield15_rename_at_15 );
+inline void _Func_lambda_thismodule_161_8_3_0x60_finazlier_f78d5769526fcfa4 ( Context * __context__, struct _lambda_thismodule_161_8_3 * ____this_rename_at_161 );
+inline bool _Func_lambda_thismodule_161_8_3_0x60_function_16b36051331311e4 ( Context * __context__, struct _lambda_thismodule_161_8_3 & ____this_rename_at_161, int32_t & ___yield_161_rename_at_161 );
+inline void _Func_lambda_thismodule_163_30_16_0x60_finazlier_fb8ad946134f187a ( Context * __context__, struct _lambda_thismodule_163_30_16 * ____this_rename_at_163 );
+inline bool _Func_lambda_thismodule_163_30_16_0x60_function_2358a7332551bf89 ( Context * __context__, struct _lambda_thismodule_163_30_16 & ____this_rename_at_163, int32_t __x_rename_at_163 );
+inline void _Func_lambda_thismodule_172_30_17_0x60_finazlier_d62dda2187dc1cbe ( Context * __context__, struct _lambda_thismodule_172_30_17 * ____this_rename_at_172 );
+inline bool _Func_lambda_thismodule_172_30_17_0x60_function_85867d03383bf73a ( Context * __context__, struct _lambda_thismodule_172_30_17 & ____this_rename_at_172, int32_t __x_rename_at_172 );
+inline void _Func_lambda_thismodule_180_30_18_0x60_finazlier_f3f210e81a2b3aaa ( Context * __context__, struct _lambda_thismodule_180_30_18 * ____this_rename_at_180 );
+inline bool _Func_lambda_thismodule_180_30_18_0x60_function_de3622d5f5d858d8 ( Context * __context__, struct _lambda_thismodule_180_30_18 & ____this_rename_at_180, int32_t __x_rename_at_180 );
+inline void _Func_lambda_thismodule_227_19_7_0x60_finazlier_77b5578290d2acca ( Context * __context__, struct _lambda_thismodule_227_19_7 * ____this_rename_at_227 );
+inline bool _Func_lambda_thismodule_227_19_7_0x60_function_e0c84006ce79c4cf ( Context * __context__, struct _lambda_thismodule_227_19_7 & ____this_rename_at_227, int32_t & ___yield_227_rename_at_227 );
+inline void _Func_lambda_thismodule_232_10_8_0x60_finazlier_4bce5c5c58c08386 ( Context * __context__, struct _lambda_thismodule_232_10_8 * ____this_rename_at_232 );
+inline bool _Func_lambda_thismodule_232_10_8_0x60_function_8170def38434b7a7 ( Context * __context__, struct _lambda_thismodule_232_10_8 & ____this_rename_at_232, TTuple<8,int32_t,float> & ___yield_232_rename_at_232 );
+inline void _Func_lambda_thismodule_235_18_9_0x60_finazlier_33e50c0cf9c9aace ( Context * __context__, struct _lambda_thismodule_235_18_9 * ____this_rename_at_235 );
+inline bool _Func_lambda_thismodule_235_18_9_0x60_function_bbe7072f5081faf ( Context * __context__, struct _lambda_thismodule_235_18_9 & ____this_rename_at_235, TTuple<8,int32_t,float> & ___yield_235_rename_at_235 );
+inline void _Func_lambda_thismodule_240_10_12_0x60_finazlier_c6049d6e3206fd98 ( Context * __context__, struct _lambda_thismodule_240_10_12 * ____this_rename_at_240 );
+inline bool _Func_lambda_thismodule_240_10_12_0x60_function_a218733ca2cc1c84 ( Context * __context__, struct _lambda_thismodule_240_10_12 & ____this_rename_at_240, TArray<int32_t> & ___yield_240_rename_at_240 );
+inline void _Func_lambda_thismodule_243_18_13_0x60_finazlier_6c8df04d1787ed80 ( Context * __context__, struct _lambda_thismodule_243_18_13 * ____this_rename_at_243 );
+inline bool _Func_lambda_thismodule_243_18_13_0x60_function_56d8ac83771ebaa0 ( Context * __context__, struct _lambda_thismodule_243_18_13 & ____this_rename_at_243, TArray<int32_t> & ___yield_243_rename_at_243 );
+inline void _Func_lambda_thismodule_31_12_23_0x60_finazlier_dd3b67d87541f66e ( Context * __context__, struct _lambda_thismodule_31_12_23 * ____this_rename_at_31 );
+inline bool _Func_lambda_thismodule_31_12_23_0x60_function_2a84fb4ade010279 ( Context * __context__, struct _lambda_thismodule_31_12_23 & ____this_rename_at_31, int32_t & ___yield_31_rename_at_31 );
+inline void _Func_lambda_thismodule_31_12_24_0x60_finazlier_f9e30e37e67a684 ( Context * __context__, struct _lambda_thismodule_31_12_24 * ____this_rename_at_31 );
+inline bool _Func_lambda_thismodule_31_12_24_0x60_function_1c9f896f20c45e59 ( Context * __context__, struct _lambda_thismodule_31_12_24 & ____this_rename_at_31, bool & ___yield_31_rename_at_31 );
+inline void _Func_lambda_thismodule_31_12_25_0x60_finazlier_18b30f1c2454e192 ( Context * __context__, struct _lambda_thismodule_31_12_25 * ____this_rename_at_31 );
+inline bool _Func_lambda_thismodule_31_12_25_0x60_function_d46b695e95774a0f ( Context * __context__, struct _lambda_thismodule_31_12_25 & ____this_rename_at_31, int32_t & ___yield_31_rename_at_31 );
+inline void _Func_lambda_thismodule_31_12_26_0x60_finazlier_2bab9c9fda0e690c ( Context * __context__, struct _lambda_thismodule_31_12_26 * ____this_rename_at_31 );
+inline bool _Func_lambda_thismodule_31_12_26_0x60_function_e9e6b4863dad899e ( Context * __context__, struct _lambda_thismodule_31_12_26 & ____this_rename_at_31, TTuple<8,int32_t,float> & ___yield_31_rename_at_31 );
+inline void _Func_lambda_thismodule_31_12_36_0x60_finazlier_d0925bee24ffbcee ( Context * __context__, struct _lambda_thismodule_31_12_36 * ____this_rename_at_31 );
+inline bool _Func_lambda_thismodule_31_12_36_0x60_function_4ffe3318a27ea7b8 ( Context * __context__, struct _lambda_thismodule_31_12_36 & ____this_rename_at_31, int32_t & ___yield_31_rename_at_31 );
+inline void _Func_lambda_thismodule_36_12_34_0x60_finazlier_c532515853e13ae0 ( Context * __context__, struct _lambda_thismodule_36_12_34 * ____this_rename_at_36 );
+inline bool _Func_lambda_thismodule_36_12_34_0x60_function_ffcc9c524f18b6e0 ( Context * __context__, struct _lambda_thismodule_36_12_34 & ____this_rename_at_36, TArray<int32_t> & ___yield_36_rename_at_36 );
+inline void _Func_lambda_thismodule_50_23_4_0x60_finazlier_94bec26830d25378 ( Context * __context__, struct _lambda_thismodule_50_23_4 * ____this_rename_at_50 );
+inline bool _Func_lambda_thismodule_50_23_4_0x60_function_99aaeed6b450d1aa ( Context * __context__, struct _lambda_thismodule_50_23_4 & ____this_rename_at_50, int32_t const  * & ___ryield50_rename_at_50 );
+inline void _Func_lambda_thismodule_56_21_10_0x60_finazlier_5af839a62194f574 ( Context * __context__, struct _lambda_thismodule_56_21_10 * ____this_rename_at_56 );
+inline bool _Func_lambda_thismodule_56_21_10_0x60_function_8fb561381ecc7a45 ( Context * __context__, struct _lambda_thismodule_56_21_10 & ____this_rename_at_56, TArray<int32_t> & ___yield_56_rename_at_56 );
+inline void _Func_lambda_thismodule_71_25_14_0x60_finazlier_71ea3165571200f0 ( Context * __context__, struct _lambda_thismodule_71_25_14 * ____this_rename_at_71 );
+inline bool _Func_lambda_thismodule_71_25_14_0x60_function_7d139dafd160cd75 ( Context * __context__, struct _lambda_thismodule_71_25_14 & ____this_rename_at_71, int32_t __x_rename_at_71 );
+inline void _Func_lambda_thismodule_85_28_1_0x60_finazlier_9127d836addd785e ( Context * __context__, struct _lambda_thismodule_85_28_1 * ____this_rename_at_85 );
+inline int32_t _Func_lambda_thismodule_85_28_1_0x60_function_fc32ad12852d63cb ( Context * __context__, struct _lambda_thismodule_85_28_1 & ____this_rename_at_85, int32_t __x_rename_at_85 );
+inline void _Func_lambda_thismodule_90_14_11_0x60_finazlier_6211c33db3590752 ( Context * __context__, struct _lambda_thismodule_90_14_11 * ____this_rename_at_90 );
+inline bool _Func_lambda_thismodule_90_14_11_0x60_function_a90556289c67e109 ( Context * __context__, struct _lambda_thismodule_90_14_11 & ____this_rename_at_90, TArray<int32_t> & ___yield_90_rename_at_90 );
+inline void _Func_lambda_thismodule_91_25_27_0x60_finazlier_8b8a9141cef68454 ( Context * __context__, struct _lambda_thismodule_91_25_27 * ____this_rename_at_91 );
+inline bool _Func_lambda_thismodule_91_25_27_0x60_function_37bece982a84c392 ( Context * __context__, struct _lambda_thismodule_91_25_27 & ____this_rename_at_91, TArray<int32_t> const  & __x_rename_at_91 );
+inline void _Func_lambda_thismodule_92_36_32_0x60_finazlier_2bfc7672990c4ec6 ( Context * __context__, struct _lambda_thismodule_92_36_32 * ____this_rename_at_92 );
+inline TArray<int32_t> _Func_lambda_thismodule_92_36_32_0x60_function_28f9b06ed4451972 ( Context * __context__, struct _lambda_thismodule_92_36_32 & ____this_rename_at_92, TArray<int32_t> const  & __x_rename_at_92 );
+inline void _Func_lambda_thismodule_93_29_35_0x60_finazlier_9f733d78516145ce ( Context * __context__, struct _lambda_thismodule_93_29_35 * ____this_rename_at_93 );
+inline int32_t _Func_lambda_thismodule_93_29_35_0x60_function_8d241ebd3f86fba5 ( Context * __context__, struct _lambda_thismodule_93_29_35 & ____this_rename_at_93, TArray<int32_t> const  & __x_rename_at_93 );
+inline void _Func_lambda_thismodule_9_12_20_0x60_finazlier_98f5961684e556b4 ( Context * __context__, struct _lambda_thismodule_9_12_20 * ____this_rename_at_9 );
+inline bool _Func_lambda_thismodule_9_12_20_0x60_function_24611828323dd0f8 ( Context * __context__, struct _lambda_thismodule_9_12_20 & ____this_rename_at_9, int32_t & ___yield_9_rename_at_9 );
+inline void _Func_lambda_thismodule_9_12_21_0x60_finazlier_dd2c46f6117be984 ( Context * __context__, struct _lambda_thismodule_9_12_21 * ____this_rename_at_9 );
+inline bool _Func_lambda_thismodule_9_12_21_0x60_function_82cc0fe87cfae825 ( Context * __context__, struct _lambda_thismodule_9_12_21 & ____this_rename_at_9, int32_t & ___yield_9_rename_at_9 );
+inline int32_t _Func_0x60_first_fc2232d3c243ca99 ( Context * __context__, TTuple<8,int32_t,float> const  & __x_rename_at_23 );
+inline bool _Func_0x60_is_same_590802a3ad1ce37b ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  & __a_rename_at_37, Sequence DAS_COMMENT((TArray<int32_t>)) const  & __b_rename_at_37 );
+inline bool _Func_0x60_is_same_97c40271e1b9fd95 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  & __a_rename_at_37, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __b_rename_at_37 );
+inline bool _Func_0x60_is_same_9afffff6294c0446 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __a_rename_at_37, Sequence DAS_COMMENT((int32_t)) const  & __b_rename_at_37 );
+inline void _Func_0x60_verify_14_35b8308b990b4b30 ( Context * __context__, TArray<TArray<int32_t>> const  & __t_rename_at_43 );
+inline void _Func_0x60_verify_14_ccaf1183e323809f ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  & __t_rename_at_43 );
+inline void _Func_0x60_verify_even_8835d561dd20d47 ( Context * __context__, TArray<int32_t> const  & __arr_rename_at_19 );
+inline void _Func_0x60_verify_even_6078037029e38486 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __arr_rename_at_19 );
+inline void _Func_0x60_verify_even_bb494c9a7d66151f ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __arr_rename_at_19 );
+inline int32_t add_71ce43625bcdc5ea ( Context * __context__, int32_t __a_rename_at_15, int32_t __b_rename_at_15 );
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> & __a_rename_at_232, TArray<int32_t> const  & __b_rename_at_232 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_298c4ba2da976305 ( Context * __context__, TArray<TArray<int32_t>> const  & __a_rename_at_353 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_2d3d435a4c8a02ad ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  & __a_rename_at_353 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_353 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcbuiltin_0x60_each_69d7e7bb51ea3de6 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  __lam_rename_at_358 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcbuiltin_0x60_each_ba1451246e410d44 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  __lam_rename_at_358 );
+inline Sequence DAS_COMMENT((bool)) _Funcbuiltin_0x60_each_73dbf68872e28f81 ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const  __lam_rename_at_358 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_d7a87ffd28768e01 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_ref_dd8113899e5f9ac1 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  __lam_rename_at_364 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_ref_ddfd027208f57be5 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  __lam_rename_at_364 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_ref_576a75d40473b6b2 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_364 );
+inline void _Funcbuiltin_0x60_emplace_9b7538bf247950b8 ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_69, TArray<int32_t> & __value_rename_at_69, int32_t __at_rename_at_69 );
+inline void _Funcbuiltin_0x60_finalize_242c8c79790d8651 ( Context * __context__, TArray<TArray<int32_t>> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_e1c35de9ada57daf ( Context * __context__, TArray<TTuple<8,int32_t,float>> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_clone_9e42c2cbacc8edfd ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_75, TArray<int32_t> const  & __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_push_clone_2d25e6e543f5b2eb ( Context * __context__, TArray<TTuple<8,int32_t,float>> & __Arr_rename_at_75, TTuple<8,int32_t,float> const  & __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_reserve_96529fa671b59898 ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_e7337cf490aef504 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_379 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_398 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_398 );
+inline void finalize_554c45dda146b8a6 ( Context * __context__, TTuple<8,int32_t,float> & ____this_rename_at_126 );
+inline void finalize_a9d0ed6e96725931 ( Context * __context__, struct _lambda_thismodule_106_15_5 & ____this_rename_at_106 );
+inline void finalize_87ca26a909d496c5 ( Context * __context__, struct _lambda_thismodule_113_12_19 & ____this_rename_at_113 );
+inline void finalize_4e0f4bc7b8ca2ddf ( Context * __context__, struct _lambda_thismodule_115_27_15 & ____this_rename_at_115 );
+inline void finalize_3c4ff226a8e359f6 ( Context * __context__, struct _lambda_thismodule_125_12_28 & ____this_rename_at_125 );
+inline void finalize_63d741ed1ad0a885 ( Context * __context__, struct _lambda_thismodule_125_12_29 & ____this_rename_at_125 );
+inline void finalize_ac07579e55ec835c ( Context * __context__, struct _lambda_thismodule_139_12_22 & ____this_rename_at_139 );
+inline void finalize_99b4eff0b688c844 ( Context * __context__, struct _lambda_thismodule_139_28_6 & ____this_rename_at_139 );
+inline void finalize_84432671fa988803 ( Context * __context__, struct _lambda_thismodule_145_12_31 & ____this_rename_at_145 );
+inline void finalize_d09c68d01225d761 ( Context * __context__, struct _lambda_thismodule_145_12_33 & ____this_rename_at_145 );
+inline void finalize_fea47afcce8467af ( Context * __context__, struct _lambda_thismodule_154_8_2 & ____this_rename_at_154 );
+inline void finalize_35204d53807e6c74 ( Context * __context__, struct _lambda_thismodule_15_12_30 & ____this_rename_at_15 );
+inline void finalize_8655051428abd0f4 ( Context * __context__, struct _lambda_thismodule_161_8_3 & ____this_rename_at_161 );
+inline void finalize_790215f236547953 ( Context * __context__, struct _lambda_thismodule_163_30_16 & ____this_rename_at_163 );
+inline void finalize_1bb28fe166db1ff8 ( Context * __context__, struct _lambda_thismodule_172_30_17 & ____this_rename_at_172 );
+inline void finalize_6a14a117832a47b4 ( Context * __context__, struct _lambda_thismodule_180_30_18 & ____this_rename_at_180 );
+inline void finalize_49ff1a0658524f07 ( Context * __context__, struct _lambda_thismodule_227_19_7 & ____this_rename_at_227 );
+inline void finalize_da9a89580c66c5cf ( Context * __context__, struct _lambda_thismodule_232_10_8 & ____this_rename_at_232 );
+inline void finalize_cb84739dfec92af7 ( Context * __context__, struct _lambda_thismodule_235_18_9 & ____this_rename_at_235 );
+inline void finalize_3110b281c7deafcb ( Context * __context__, struct _lambda_thismodule_240_10_12 & ____this_rename_at_240 );
+inline void finalize_3d9c85063ca4a8bd ( Context * __context__, struct _lambda_thismodule_243_18_13 & ____this_rename_at_243 );
+inline void finalize_ea77efc811c36135 ( Context * __context__, struct _lambda_thismodule_31_12_23 & ____this_rename_at_31 );
+inline void finalize_8902c5c3395ffb84 ( Context * __context__, struct _lambda_thismodule_31_12_24 & ____this_rename_at_31 );
+inline void finalize_fb1e929eb75c77d3 ( Context * __context__, struct _lambda_thismodule_31_12_25 & ____this_rename_at_31 );
+inline void finalize_a742d882934bc67a ( Context * __context__, struct _lambda_thismodule_31_12_26 & ____this_rename_at_31 );
+inline void finalize_2c6d673361e95598 ( Context * __context__, struct _lambda_thismodule_31_12_36 & ____this_rename_at_31 );
+inline void finalize_9a32ba1293d999ac ( Context * __context__, struct _lambda_thismodule_36_12_34 & ____this_rename_at_36 );
+inline void finalize_e4e346397db1da55 ( Context * __context__, struct _lambda_thismodule_50_23_4 & ____this_rename_at_50 );
+inline void finalize_7e62c95ba3669c0e ( Context * __context__, struct _lambda_thismodule_56_21_10 & ____this_rename_at_56 );
+inline void finalize_8d49d3be2563d419 ( Context * __context__, struct _lambda_thismodule_71_25_14 & ____this_rename_at_71 );
+inline void finalize_8f217ed02c7d43f1 ( Context * __context__, struct _lambda_thismodule_85_28_1 & ____this_rename_at_85 );
+inline void finalize_75919cb3423249cf ( Context * __context__, struct _lambda_thismodule_90_14_11 & ____this_rename_at_90 );
+inline void finalize_cfd3426561e2e7e5 ( Context * __context__, struct _lambda_thismodule_91_25_27 & ____this_rename_at_91 );
+inline void finalize_6eaa1c4f569102fc ( Context * __context__, struct _lambda_thismodule_92_36_32 & ____this_rename_at_92 );
+inline void finalize_cdc2fc53315b9882 ( Context * __context__, struct _lambda_thismodule_93_29_35 & ____this_rename_at_93 );
+inline void finalize_96301ec05baef2f5 ( Context * __context__, struct _lambda_thismodule_9_12_20 & ____this_rename_at_9 );
+inline void finalize_4b0e4cd0a7164aae ( Context * __context__, struct _lambda_thismodule_9_12_21 & ____this_rename_at_9 );
+inline bool _Funcfunctional_0x60_all_29a13565b52eb7db ( Context * __context__, Sequence DAS_COMMENT((bool)) const  & __it_rename_at_100 );
+inline bool _Funcfunctional_0x60_any_dd77430c4ce8eb4b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  & __it_rename_at_89 );
+inline bool _Funcfunctional_0x60_any_3b173b789b4d659 ( Context * __context__, TDim<bool,2> const  & __it_rename_at_89 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_count_f81ee374cce5540d ( Context * __context__, int32_t __start_rename_at_152, int32_t __step_rename_at_152 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_cycle_45ebe7337522428a ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_110 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_cycle_afb4461f9fcee246 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & __src_rename_at_110 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_cycle_8be75c6ab4e4f342 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_110 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_9c5c2ea0768c39c0 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_20, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  __blk_rename_at_20 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_9ac4a2626818601d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_24, Func DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_24 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_29a3b3a7512b71f5 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_20, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_20 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_any_121721b2e08eefc9 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_6, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) __blk_rename_at_6 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_6eb8df991750122c ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_6, Func DAS_COMMENT((bool,int32_t)) __blk_rename_at_6 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_93484a24b323592f ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_6, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_6 );
+inline bool _Funcfunctional_0x60_is_equal_6b49314146682bc8 ( Context * __context__, int32_t __a_rename_at_168, int32_t __b_rename_at_168 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_islice_1b238c444ec51e4d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_136, int32_t __start_rename_at_136, int32_t __stop_rename_at_136 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_islice_eef73b9790d080de ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & __src_rename_at_136, int32_t __start_rename_at_136, int32_t __stop_rename_at_136 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_islice_f925e02743d56ac ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_136, int32_t __start_rename_at_136, int32_t __stop_rename_at_136 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_4b03d8b25a9f7c5c ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_46, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  __blk_rename_at_46 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_765ff0602dff4f41 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_46, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  __blk_rename_at_46 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_8c8dda3d30684686 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_50, Func DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_50 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_65695f489097f839 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_46, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const  __blk_rename_at_46 );
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_6553bbb9d75fe927 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_46, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_46 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_478dab29ef056fb6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_46, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_46 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_a6b26395efebfa79 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_28, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) __blk_rename_at_28 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_any_fbc5e9f6cd4a2c3 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_28, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) __blk_rename_at_28 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_42e49f214b3338ad ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_28, Func DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_28 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_any_78804bc5438b4457 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_28, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) __blk_rename_at_28 );
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_any_d6e273aa6b995622 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_28, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_28 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_c90db4847f0a8879 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_28, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_28 );
+inline bool _Funcfunctional_0x60_not_62fd3e2cf8622aee ( Context * __context__, bool __x_rename_at_174 );
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_8a228425c3a12cf0 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __it_rename_at_77, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & __blk_rename_at_77 );
+inline int32_t _Funcfunctional_0x60_reduce_fe50d9841ab82207 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_77, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __blk_rename_at_77 );
+inline int32_t _Funcfunctional_0x60_reduce_abe6e78b2b662e9 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_73, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_73 );
+inline int32_t _Funcfunctional_0x60_reduce_cb178b30ab4da07 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_69, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_69 );
+inline int32_t _Funcfunctional_0x60_reduce_7a6bb0d6853a5308 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_77, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __blk_rename_at_77 );
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_any_bd042ec2d83b8d49 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __it_rename_at_55, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & __functor_rename_at_55 );
+inline int32_t _Funcfunctional_0x60_reduce_any_51d9e1545f1073ee ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_55, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __functor_rename_at_55 );
+inline int32_t _Funcfunctional_0x60_reduce_any_c1597e64f62c4a9d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_55, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_55 );
+inline int32_t _Funcfunctional_0x60_reduce_any_6c02eae7c8fa51a7 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_55, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_55 );
+inline int32_t _Funcfunctional_0x60_reduce_any_aedc21539e3b4419 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_55, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __functor_rename_at_55 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_repeat_66c37a2d9ef2191d ( Context * __context__, int32_t __value_rename_at_159, int32_t __count_rename_at_159 );
+inline int32_t _Funcfunctional_0x60_sum_ea2762a9b6c828a6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_82 );
+inline bool is_even_6d9eabfbf704f1dc ( Context * __context__, int32_t __x_rename_at_9 );
+inline bool test_eefa0ae5aee396ca ( Context * __context__ );
+inline int32_t twice_c214784f6f367f97 ( Context * __context__, int32_t __x_rename_at_12 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _FuncExclEqu_f4f0b94c8df92c7b ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_29, TArray<int32_t> const  &  __b_rename_at_29 )
+{
+	if ( builtin_array_size(__a_rename_at_29) != builtin_array_size(__b_rename_at_29) )
+	{
+		return true;
+	} else {
+		{
+			bool __need_loop_32 = true;
+			// x : int const&
+			das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_29);
+			int32_t const  * __x_rename_at_32;
+			__need_loop_32 = __x_iterator.first(__context__,(__x_rename_at_32)) && __need_loop_32;
+			// y : int const&
+			das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_29);
+			int32_t const  * __y_rename_at_32;
+			__need_loop_32 = __y_iterator.first(__context__,(__y_rename_at_32)) && __need_loop_32;
+			for ( ; __need_loop_32 ; __need_loop_32 = __x_iterator.next(__context__,(__x_rename_at_32)) && __y_iterator.next(__context__,(__y_rename_at_32)) )
+			{
+				if ( (*__x_rename_at_32) != (*__y_rename_at_32) )
+				{
+					return true;
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_32));
+			__y_iterator.close(__context__,(__y_rename_at_32));
+		};
+		return false;
+	};
+}
+
+inline bool _FuncExclEqu_e106a056c753c270 ( Context * __context__, TTuple<8,int32_t,float> const  &  __a_rename_at_26, TTuple<8,int32_t,float> const  &  __b_rename_at_26 )
+{
+	return (das_get_tuple_field<int32_t,0>::get(__a_rename_at_26) != das_get_tuple_field<int32_t,0>::get(__b_rename_at_26)) || (das_get_tuple_field<float,4>::get(__a_rename_at_26) != das_get_tuple_field<float,4>::get(__b_rename_at_26));
+}
+
+inline void _Func_lambda_thismodule_106_15_5_0x60_finazlier_8ac6e00dd2aa8186 ( Context * __context__, struct _lambda_thismodule_106_15_5 * ____this_rename_at_106 )
+{
+	finalize_a9d0ed6e96725931(__context__,das_arg<struct _lambda_thismodule_106_15_5>::pass(das_deref(__context__,____this_rename_at_106)));
+	das_delete_lambda_struct<struct _lambda_thismodule_106_15_5 *>::clear(__context__,____this_rename_at_106);
+}
+
+inline bool _Func_lambda_thismodule_106_15_5_0x60_function_5476edfb74ad5dc9 ( Context * __context__, struct _lambda_thismodule_106_15_5 &  ____this_rename_at_106, int32_t const  * & ___ryield106_rename_at_106 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_106_32;
+	switch (____this_rename_at_106.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_106._loop_at_106,true);
+	das_move(____this_rename_at_106._source_0_at_106,(_temp_make_local_106_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))));
+	memset(&(____this_rename_at_106.x), 0, 4);
+	das_copy(____this_rename_at_106._pvar_0_at_106,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_106.x)));
+	DAS_SETBOOLAND((____this_rename_at_106._loop_at_106),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_106._loop_at_106 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield106_rename_at_106,das_ref(__context__,____this_rename_at_106.x));
+	das_copy(____this_rename_at_106.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_106._loop_at_106),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_113_12_19_0x60_finazlier_bfacc70fdb974f9c ( Context * __context__, struct _lambda_thismodule_113_12_19 * ____this_rename_at_113 )
+{
+	builtin_array_clear_lock(das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_113).arr),__context__);
+	finalize_87ca26a909d496c5(__context__,das_arg<struct _lambda_thismodule_113_12_19>::pass(das_deref(__context__,____this_rename_at_113)));
+	das_delete_lambda_struct<struct _lambda_thismodule_113_12_19 *>::clear(__context__,____this_rename_at_113);
+}
+
+inline bool _Func_lambda_thismodule_113_12_19_0x60_function_befbad5a0b228273 ( Context * __context__, struct _lambda_thismodule_113_12_19 &  ____this_rename_at_113, int32_t & ___yield_113_rename_at_113 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_118_32;
+	switch (____this_rename_at_113.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_113.arr), 0, 24);
+	das_copy(____this_rename_at_113._loop_at_114,true);
+	das_move(____this_rename_at_113._source_0_at_114,____this_rename_at_113.src);
+	memset(&(____this_rename_at_113.x), 0, 4);
+	das_copy(____this_rename_at_113._pvar_0_at_114,das_ref(__context__,____this_rename_at_113.x));
+	DAS_SETBOOLAND((____this_rename_at_113._loop_at_114),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_113._source_0_at_114),____this_rename_at_113._pvar_0_at_114,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_113._loop_at_114 )
+	{
+		goto label_10;
+	};
+	das_copy(___yield_113_rename_at_113,____this_rename_at_113.x);
+	das_copy(____this_rename_at_113.__yield,7);
+	return true;
+	label_7:;;
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_113.arr),____this_rename_at_113.x,-1);
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_113._loop_at_114),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_113._source_0_at_114),____this_rename_at_113._pvar_0_at_114,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_113._source_0_at_114),____this_rename_at_113._pvar_0_at_114,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_113.___loop_at_118_rename_at_118,true);
+	das_move(____this_rename_at_113.___source_0_at_118_rename_at_118,(_temp_make_local_118_32 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_113.arr)))));
+	memset(&(____this_rename_at_113.__x_rename_at_118), 0, 8);
+	das_copy(____this_rename_at_113.___pvar_0_at_118_rename_at_118,das_ref(__context__,____this_rename_at_113.__x_rename_at_118));
+	DAS_SETBOOLAND((____this_rename_at_113.___loop_at_118_rename_at_118),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_113.___source_0_at_118_rename_at_118),____this_rename_at_113.___pvar_0_at_118_rename_at_118,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_113.___loop_at_118_rename_at_118 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_113_rename_at_113,das_deref(__context__,____this_rename_at_113.__x_rename_at_118));
+	das_copy(____this_rename_at_113.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_113.___loop_at_118_rename_at_118),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_113.___source_0_at_118_rename_at_118),____this_rename_at_113.___pvar_0_at_118_rename_at_118,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_113.___source_0_at_118_rename_at_118),____this_rename_at_113.___pvar_0_at_118_rename_at_118,__context__);
+	goto label_5;
+	label_6:;;
+	return false;
+}
+
+inline void _Func_lambda_thismodule_115_27_15_0x60_finazlier_71e19767abe73d8a ( Context * __context__, struct _lambda_thismodule_115_27_15 * ____this_rename_at_115 )
+{
+	finalize_4e0f4bc7b8ca2ddf(__context__,das_arg<struct _lambda_thismodule_115_27_15>::pass(das_deref(__context__,____this_rename_at_115)));
+	das_delete_lambda_struct<struct _lambda_thismodule_115_27_15 *>::clear(__context__,____this_rename_at_115);
+}
+
+inline int32_t _Func_lambda_thismodule_115_27_15_0x60_function_e49611e17107a853 ( Context * __context__, struct _lambda_thismodule_115_27_15 &  ____this_rename_at_115, int32_t __x_rename_at_115, int32_t __y_rename_at_115 )
+{
+	return __x_rename_at_115 + __y_rename_at_115;
+}
+
+inline void _Func_lambda_thismodule_125_12_28_0x60_finazlier_f2a3e958418ef82 ( Context * __context__, struct _lambda_thismodule_125_12_28 * ____this_rename_at_125 )
+{
+	builtin_array_clear_lock(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(das_deref(__context__,____this_rename_at_125).arr),__context__);
+	finalize_3c4ff226a8e359f6(__context__,das_arg<struct _lambda_thismodule_125_12_28>::pass(das_deref(__context__,____this_rename_at_125)));
+	das_delete_lambda_struct<struct _lambda_thismodule_125_12_28 *>::clear(__context__,____this_rename_at_125);
+}
+
+inline bool _Func_lambda_thismodule_125_12_28_0x60_function_f05401f6c9d42882 ( Context * __context__, struct _lambda_thismodule_125_12_28 &  ____this_rename_at_125, TTuple<8,int32_t,float> * & ___ryield125_rename_at_125 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_130_32;
+	switch (____this_rename_at_125.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_125.arr), 0, 24);
+	das_copy(____this_rename_at_125._loop_at_126,true);
+	das_move(____this_rename_at_125._source_0_at_126,____this_rename_at_125.src);
+	memset(&(____this_rename_at_125.x), 0, 8);
+	das_copy(____this_rename_at_125._pvar_0_at_126,das_ref(__context__,____this_rename_at_125.x));
+	DAS_SETBOOLAND((____this_rename_at_125._loop_at_126),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_125._source_0_at_126),____this_rename_at_125._pvar_0_at_126,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_125._loop_at_126 )
+	{
+		goto label_10;
+	};
+	das_copy(___ryield125_rename_at_125,das_ref(__context__,____this_rename_at_125.x));
+	das_copy(____this_rename_at_125.__yield,7);
+	return true;
+	label_7:;;
+	_Funcbuiltin_0x60_push_clone_2d25e6e543f5b2eb(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_125.arr),das_arg<TTuple<8,int32_t,float>>::pass(____this_rename_at_125.x),-1);
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_125._loop_at_126),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_125._source_0_at_126),____this_rename_at_125._pvar_0_at_126,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_125._source_0_at_126),____this_rename_at_125._pvar_0_at_126,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_125.___loop_at_130_rename_at_130,true);
+	das_move(____this_rename_at_125.___source_0_at_130_rename_at_130,(_temp_make_local_130_32 = (_Funcbuiltin_0x60_each_2d3d435a4c8a02ad(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_125.arr)))));
+	memset(&(____this_rename_at_125.__x_rename_at_130), 0, 8);
+	das_copy(____this_rename_at_125.___pvar_0_at_130_rename_at_130,das_ref(__context__,____this_rename_at_125.__x_rename_at_130));
+	DAS_SETBOOLAND((____this_rename_at_125.___loop_at_130_rename_at_130),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_125.___source_0_at_130_rename_at_130),____this_rename_at_125.___pvar_0_at_130_rename_at_130,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_125.___loop_at_130_rename_at_130 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield125_rename_at_125,das_ref(__context__,das_deref(__context__,____this_rename_at_125.__x_rename_at_130)));
+	das_copy(____this_rename_at_125.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_125.___loop_at_130_rename_at_130),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_125.___source_0_at_130_rename_at_130),____this_rename_at_125.___pvar_0_at_130_rename_at_130,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_125.___source_0_at_130_rename_at_130),____this_rename_at_125.___pvar_0_at_130_rename_at_130,__context__);
+	goto label_5;
+	label_6:;;
+	return false;
+}
+
+inline void _Func_lambda_thismodule_125_12_29_0x60_finazlier_d62c8b1cf676ddc ( Context * __context__, struct _lambda_thismodule_125_12_29 * ____this_rename_at_125 )
+{
+	builtin_array_clear_lock(das_arg<TArray<TArray<int32_t>>>::pass(das_deref(__context__,____this_rename_at_125).arr),__context__);
+	finalize_63d741ed1ad0a885(__context__,das_arg<struct _lambda_thismodule_125_12_29>::pass(das_deref(__context__,____this_rename_at_125)));
+	das_delete_lambda_struct<struct _lambda_thismodule_125_12_29 *>::clear(__context__,____this_rename_at_125);
+}
+
+inline bool _Func_lambda_thismodule_125_12_29_0x60_function_c37752c67cb16cbf ( Context * __context__, struct _lambda_thismodule_125_12_29 &  ____this_rename_at_125, TArray<int32_t> * & ___ryield125_rename_at_125 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_130_32;
+	switch (____this_rename_at_125.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_125.arr), 0, 24);
+	das_copy(____this_rename_at_125._loop_at_126,true);
+	das_move(____this_rename_at_125._source_0_at_126,____this_rename_at_125.src);
+	memset(&(____this_rename_at_125.x), 0, 24);
+	das_copy(____this_rename_at_125._pvar_0_at_126,das_ref(__context__,____this_rename_at_125.x));
+	DAS_SETBOOLAND((____this_rename_at_125._loop_at_126),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_125._source_0_at_126),____this_rename_at_125._pvar_0_at_126,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_125._loop_at_126 )
+	{
+		goto label_10;
+	};
+	das_copy(___ryield125_rename_at_125,das_ref(__context__,____this_rename_at_125.x));
+	das_copy(____this_rename_at_125.__yield,7);
+	return true;
+	label_7:;;
+	_Funcbuiltin_0x60_push_clone_9e42c2cbacc8edfd(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_125.arr),das_arg<TArray<int32_t>>::pass(____this_rename_at_125.x),-1);
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_125._loop_at_126),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_125._source_0_at_126),____this_rename_at_125._pvar_0_at_126,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_125._source_0_at_126),____this_rename_at_125._pvar_0_at_126,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_125.___loop_at_130_rename_at_130,true);
+	das_move(____this_rename_at_125.___source_0_at_130_rename_at_130,(_temp_make_local_130_32 = (_Funcbuiltin_0x60_each_298c4ba2da976305(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_125.arr)))));
+	memset(&(____this_rename_at_125.__x_rename_at_130), 0, 8);
+	das_copy(____this_rename_at_125.___pvar_0_at_130_rename_at_130,das_ref(__context__,____this_rename_at_125.__x_rename_at_130));
+	DAS_SETBOOLAND((____this_rename_at_125.___loop_at_130_rename_at_130),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_125.___source_0_at_130_rename_at_130),____this_rename_at_125.___pvar_0_at_130_rename_at_130,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_125.___loop_at_130_rename_at_130 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield125_rename_at_125,das_ref(__context__,das_deref(__context__,____this_rename_at_125.__x_rename_at_130)));
+	das_copy(____this_rename_at_125.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_125.___loop_at_130_rename_at_130),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_125.___source_0_at_130_rename_at_130),____this_rename_at_125.___pvar_0_at_130_rename_at_130,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_125.___source_0_at_130_rename_at_130),____this_rename_at_125.___pvar_0_at_130_rename_at_130,__context__);
+	goto label_5;
+	label_6:;;
+	return false;
+}
+
+inline void _Func_lambda_thismodule_139_12_22_0x60_finazlier_3029a31f3ee593ac ( Context * __context__, struct _lambda_thismodule_139_12_22 * ____this_rename_at_139 )
+{
+	finalize_ac07579e55ec835c(__context__,das_arg<struct _lambda_thismodule_139_12_22>::pass(das_deref(__context__,____this_rename_at_139)));
+	das_delete_lambda_struct<struct _lambda_thismodule_139_12_22 *>::clear(__context__,____this_rename_at_139);
+}
+
+inline bool _Func_lambda_thismodule_139_12_22_0x60_function_191cac2061c16d6c ( Context * __context__, struct _lambda_thismodule_139_12_22 &  ____this_rename_at_139, int32_t & ___yield_139_rename_at_139 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_139_32;
+	switch (____this_rename_at_139.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_139._loop_at_139,true);
+	das_move(____this_rename_at_139._source_0_at_139,____this_rename_at_139.src);
+	memset(&(____this_rename_at_139.x), 0, 4);
+	das_copy(____this_rename_at_139._pvar_0_at_139,das_ref(__context__,____this_rename_at_139.x));
+	DAS_SETBOOLAND((____this_rename_at_139._loop_at_139),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_139._source_0_at_139),____this_rename_at_139._pvar_0_at_139,__context__)));
+	das_move(____this_rename_at_139._source_1_at_139,(_temp_make_local_139_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,____this_rename_at_139.stop)))));
+	memset(&(____this_rename_at_139.i), 0, 4);
+	das_copy(____this_rename_at_139._pvar_1_at_139,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_139.i)));
+	DAS_SETBOOLAND((____this_rename_at_139._loop_at_139),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_139._source_1_at_139),____this_rename_at_139._pvar_1_at_139,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_139._loop_at_139 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_139.i >= ____this_rename_at_139.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_139_rename_at_139,____this_rename_at_139.x);
+	das_copy(____this_rename_at_139.__yield,1);
+	return true;
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_139._loop_at_139),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_139._source_0_at_139),____this_rename_at_139._pvar_0_at_139,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_139._loop_at_139),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_139._source_1_at_139),____this_rename_at_139._pvar_1_at_139,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_139._source_0_at_139),____this_rename_at_139._pvar_0_at_139,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_139._source_1_at_139),____this_rename_at_139._pvar_1_at_139,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_139_28_6_0x60_finazlier_c81b48322132787e ( Context * __context__, struct _lambda_thismodule_139_28_6 * ____this_rename_at_139 )
+{
+	finalize_99b4eff0b688c844(__context__,das_arg<struct _lambda_thismodule_139_28_6>::pass(das_deref(__context__,____this_rename_at_139)));
+	das_delete_lambda_struct<struct _lambda_thismodule_139_28_6 *>::clear(__context__,____this_rename_at_139);
+}
+
+inline TTuple<8,int32_t,float> _Func_lambda_thismodule_139_28_6_0x60_function_3ce4133ac81d2d65 ( Context * __context__, struct _lambda_thismodule_139_28_6 &  ____this_rename_at_139, int32_t __x_rename_at_139 )
+{
+	return (([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_139;
+		das_get_tuple_field<int32_t,0>::get(__mkt_139) = __x_rename_at_139;
+		das_get_tuple_field<float,4>::get(__mkt_139) = 1.5f;
+		return __mkt_139;
+	})());
+}
+
+inline void _Func_lambda_thismodule_145_12_31_0x60_finazlier_70fcc77fb901aacc ( Context * __context__, struct _lambda_thismodule_145_12_31 * ____this_rename_at_145 )
+{
+	finalize_84432671fa988803(__context__,das_arg<struct _lambda_thismodule_145_12_31>::pass(das_deref(__context__,____this_rename_at_145)));
+	das_delete_lambda_struct<struct _lambda_thismodule_145_12_31 *>::clear(__context__,____this_rename_at_145);
+}
+
+inline bool _Func_lambda_thismodule_145_12_31_0x60_function_5e6685e57ae94b32 ( Context * __context__, struct _lambda_thismodule_145_12_31 &  ____this_rename_at_145, TTuple<8,int32_t,float> * & ___ryield145_rename_at_145 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_145_32;
+	switch (____this_rename_at_145.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_145._loop_at_145,true);
+	das_move(____this_rename_at_145._source_0_at_145,____this_rename_at_145.src);
+	memset(&(____this_rename_at_145.x), 0, 8);
+	das_copy(____this_rename_at_145._pvar_0_at_145,das_ref(__context__,____this_rename_at_145.x));
+	DAS_SETBOOLAND((____this_rename_at_145._loop_at_145),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_145._source_0_at_145),____this_rename_at_145._pvar_0_at_145,__context__)));
+	das_move(____this_rename_at_145._source_1_at_145,(_temp_make_local_145_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,____this_rename_at_145.stop)))));
+	memset(&(____this_rename_at_145.i), 0, 4);
+	das_copy(____this_rename_at_145._pvar_1_at_145,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_145.i)));
+	DAS_SETBOOLAND((____this_rename_at_145._loop_at_145),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_145._source_1_at_145),____this_rename_at_145._pvar_1_at_145,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_145._loop_at_145 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_145.i >= ____this_rename_at_145.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield145_rename_at_145,das_ref(__context__,das_deref(__context__,____this_rename_at_145.x)));
+	das_copy(____this_rename_at_145.__yield,1);
+	return true;
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_145._loop_at_145),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_145._source_0_at_145),____this_rename_at_145._pvar_0_at_145,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_145._loop_at_145),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_145._source_1_at_145),____this_rename_at_145._pvar_1_at_145,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_145._source_0_at_145),____this_rename_at_145._pvar_0_at_145,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_145._source_1_at_145),____this_rename_at_145._pvar_1_at_145,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_145_12_33_0x60_finazlier_f4fb1b13b928b854 ( Context * __context__, struct _lambda_thismodule_145_12_33 * ____this_rename_at_145 )
+{
+	finalize_d09c68d01225d761(__context__,das_arg<struct _lambda_thismodule_145_12_33>::pass(das_deref(__context__,____this_rename_at_145)));
+	das_delete_lambda_struct<struct _lambda_thismodule_145_12_33 *>::clear(__context__,____this_rename_at_145);
+}
+
+inline bool _Func_lambda_thismodule_145_12_33_0x60_function_232273f764b02ab2 ( Context * __context__, struct _lambda_thismodule_145_12_33 &  ____this_rename_at_145, TArray<int32_t> * & ___ryield145_rename_at_145 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_145_32;
+	switch (____this_rename_at_145.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_145._loop_at_145,true);
+	das_move(____this_rename_at_145._source_0_at_145,____this_rename_at_145.src);
+	memset(&(____this_rename_at_145.x), 0, 8);
+	das_copy(____this_rename_at_145._pvar_0_at_145,das_ref(__context__,____this_rename_at_145.x));
+	DAS_SETBOOLAND((____this_rename_at_145._loop_at_145),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_145._source_0_at_145),____this_rename_at_145._pvar_0_at_145,__context__)));
+	das_move(____this_rename_at_145._source_1_at_145,(_temp_make_local_145_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,____this_rename_at_145.stop)))));
+	memset(&(____this_rename_at_145.i), 0, 4);
+	das_copy(____this_rename_at_145._pvar_1_at_145,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_145.i)));
+	DAS_SETBOOLAND((____this_rename_at_145._loop_at_145),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_145._source_1_at_145),____this_rename_at_145._pvar_1_at_145,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_145._loop_at_145 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_145.i >= ____this_rename_at_145.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield145_rename_at_145,das_ref(__context__,das_deref(__context__,____this_rename_at_145.x)));
+	das_copy(____this_rename_at_145.__yield,1);
+	return true;
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_145._loop_at_145),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_145._source_0_at_145),____this_rename_at_145._pvar_0_at_145,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_145._loop_at_145),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_145._source_1_at_145),____this_rename_at_145._pvar_1_at_145,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_145._source_0_at_145),____this_rename_at_145._pvar_0_at_145,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_145._source_1_at_145),____this_rename_at_145._pvar_1_at_145,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_154_8_2_0x60_finazlier_5de4362f29c6b7e ( Context * __context__, struct _lambda_thismodule_154_8_2 * ____this_rename_at_154 )
+{
+	finalize_fea47afcce8467af(__context__,das_arg<struct _lambda_thismodule_154_8_2>::pass(das_deref(__context__,____this_rename_at_154)));
+	das_delete_lambda_struct<struct _lambda_thismodule_154_8_2 *>::clear(__context__,____this_rename_at_154);
+}
+
+inline bool _Func_lambda_thismodule_154_8_2_0x60_function_8cf8bf0eaa9bd84b ( Context * __context__, struct _lambda_thismodule_154_8_2 &  ____this_rename_at_154, int32_t & __result_rename_at_153 )
+{
+	das_copy(__result_rename_at_153,____this_rename_at_154.start);
+	____this_rename_at_154.start += ____this_rename_at_154.step;
+	return true;
+}
+
+inline void _Func_lambda_thismodule_15_12_30_0x60_finazlier_c0f0fb43fd5c1b9a ( Context * __context__, struct _lambda_thismodule_15_12_30 * ____this_rename_at_15 )
+{
+	finalize_35204d53807e6c74(__context__,das_arg<struct _lambda_thismodule_15_12_30>::pass(das_deref(__context__,____this_rename_at_15)));
+	das_delete_lambda_struct<struct _lambda_thismodule_15_12_30 *>::clear(__context__,____this_rename_at_15);
+}
+
+inline bool _Func_lambda_thismodule_15_12_30_0x60_function_c264f016790ba619 ( Context * __context__, struct _lambda_thismodule_15_12_30 &  ____this_rename_at_15, TArray<int32_t> * & ___ryield15_rename_at_15 )
+{
+	switch (____this_rename_at_15.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_15._loop_at_15,true);
+	das_move(____this_rename_at_15._source_0_at_15,____this_rename_at_15.src);
+	memset(&(____this_rename_at_15.w), 0, 24);
+	das_copy(____this_rename_at_15._pvar_0_at_15,das_ref(__context__,____this_rename_at_15.w));
+	DAS_SETBOOLAND((____this_rename_at_15._loop_at_15),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_15._source_0_at_15),____this_rename_at_15._pvar_0_at_15,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_15._loop_at_15 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<TArray<int32_t> &>(__context__,____this_rename_at_15.blk,das_arg<TArray<int32_t>>::pass(____this_rename_at_15.w)) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield15_rename_at_15,das_ref(__context__,____this_rename_at_15.w));
+	das_copy(____this_rename_at_15.__yield,1);
+	return true;
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_15._loop_at_15),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_15._source_0_at_15),____this_rename_at_15._pvar_0_at_15,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_15._source_0_at_15),____this_rename_at_15._pvar_0_at_15,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_161_8_3_0x60_finazlier_f78d5769526fcfa4 ( Context * __context__, struct _lambda_thismodule_161_8_3 * ____this_rename_at_161 )
+{
+	finalize_8655051428abd0f4(__context__,das_arg<struct _lambda_thismodule_161_8_3>::pass(das_deref(__context__,____this_rename_at_161)));
+	das_delete_lambda_struct<struct _lambda_thismodule_161_8_3 *>::clear(__context__,____this_rename_at_161);
+}
+
+inline bool _Func_lambda_thismodule_161_8_3_0x60_function_16b36051331311e4 ( Context * __context__, struct _lambda_thismodule_161_8_3 &  ____this_rename_at_161, int32_t & ___yield_161_rename_at_161 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_164_32;
+	switch (____this_rename_at_161.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	case 5: goto label_5;
+	case 7: goto label_7;
+	case 8: goto label_8;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_161.count == 0) )
+	{
+		goto label_4;
+	};
+	label_1:;;
+	das_copy(___yield_161_rename_at_161,____this_rename_at_161.value);
+	das_copy(____this_rename_at_161.__yield,3);
+	return true;
+	label_3:;;
+	goto label_1;
+	label_2:;;
+	label_4:;;
+	das_copy(____this_rename_at_161._loop_at_164,true);
+	das_move(____this_rename_at_161._source_0_at_164,(_temp_make_local_164_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,____this_rename_at_161.count)))));
+	memset(&(____this_rename_at_161.x), 0, 4);
+	das_copy(____this_rename_at_161._pvar_0_at_164,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_161.x)));
+	DAS_SETBOOLAND((____this_rename_at_161._loop_at_164),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_161._source_0_at_164),____this_rename_at_161._pvar_0_at_164,__context__)));
+	label_6:;;
+	if ( !____this_rename_at_161._loop_at_164 )
+	{
+		goto label_8;
+	};
+	das_copy(___yield_161_rename_at_161,____this_rename_at_161.value);
+	das_copy(____this_rename_at_161.__yield,5);
+	return true;
+	label_5:;;
+	label_7:;;
+	DAS_SETBOOLAND((____this_rename_at_161._loop_at_164),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_161._source_0_at_164),____this_rename_at_161._pvar_0_at_164,__context__)));
+	goto label_6;
+	label_8:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_161._source_0_at_164),____this_rename_at_161._pvar_0_at_164,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_163_30_16_0x60_finazlier_fb8ad946134f187a ( Context * __context__, struct _lambda_thismodule_163_30_16 * ____this_rename_at_163 )
+{
+	finalize_790215f236547953(__context__,das_arg<struct _lambda_thismodule_163_30_16>::pass(das_deref(__context__,____this_rename_at_163)));
+	das_delete_lambda_struct<struct _lambda_thismodule_163_30_16 *>::clear(__context__,____this_rename_at_163);
+}
+
+inline bool _Func_lambda_thismodule_163_30_16_0x60_function_2358a7332551bf89 ( Context * __context__, struct _lambda_thismodule_163_30_16 &  ____this_rename_at_163, int32_t __x_rename_at_163 )
+{
+	return __x_rename_at_163 > 30;
+}
+
+inline void _Func_lambda_thismodule_172_30_17_0x60_finazlier_d62dda2187dc1cbe ( Context * __context__, struct _lambda_thismodule_172_30_17 * ____this_rename_at_172 )
+{
+	finalize_1bb28fe166db1ff8(__context__,das_arg<struct _lambda_thismodule_172_30_17>::pass(das_deref(__context__,____this_rename_at_172)));
+	das_delete_lambda_struct<struct _lambda_thismodule_172_30_17 *>::clear(__context__,____this_rename_at_172);
+}
+
+inline bool _Func_lambda_thismodule_172_30_17_0x60_function_85867d03383bf73a ( Context * __context__, struct _lambda_thismodule_172_30_17 &  ____this_rename_at_172, int32_t __x_rename_at_172 )
+{
+	return __x_rename_at_172 < 100;
+}
+
+inline void _Func_lambda_thismodule_180_30_18_0x60_finazlier_f3f210e81a2b3aaa ( Context * __context__, struct _lambda_thismodule_180_30_18 * ____this_rename_at_180 )
+{
+	finalize_6a14a117832a47b4(__context__,das_arg<struct _lambda_thismodule_180_30_18>::pass(das_deref(__context__,____this_rename_at_180)));
+	das_delete_lambda_struct<struct _lambda_thismodule_180_30_18 *>::clear(__context__,____this_rename_at_180);
+}
+
+inline bool _Func_lambda_thismodule_180_30_18_0x60_function_de3622d5f5d858d8 ( Context * __context__, struct _lambda_thismodule_180_30_18 &  ____this_rename_at_180, int32_t __x_rename_at_180 )
+{
+	return __x_rename_at_180 > 0;
+}
+
+inline void _Func_lambda_thismodule_227_19_7_0x60_finazlier_77b5578290d2acca ( Context * __context__, struct _lambda_thismodule_227_19_7 * ____this_rename_at_227 )
+{
+	finalize_49ff1a0658524f07(__context__,das_arg<struct _lambda_thismodule_227_19_7>::pass(das_deref(__context__,____this_rename_at_227)));
+	das_delete_lambda_struct<struct _lambda_thismodule_227_19_7 *>::clear(__context__,____this_rename_at_227);
+}
+
+inline bool _Func_lambda_thismodule_227_19_7_0x60_function_e0c84006ce79c4cf ( Context * __context__, struct _lambda_thismodule_227_19_7 &  ____this_rename_at_227, int32_t & ___yield_227_rename_at_227 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_227_32;
+	switch (____this_rename_at_227.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_227._loop_at_227,true);
+	das_move(____this_rename_at_227._source_0_at_227,(_temp_make_local_227_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))));
+	memset(&(____this_rename_at_227.x), 0, 4);
+	das_copy(____this_rename_at_227._pvar_0_at_227,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_227.x)));
+	DAS_SETBOOLAND((____this_rename_at_227._loop_at_227),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_227._loop_at_227 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_227_rename_at_227,(SimPolicy<int32_t>::Mod(____this_rename_at_227.x,3,*__context__)) + 1);
+	das_copy(____this_rename_at_227.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_227._loop_at_227),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_232_10_8_0x60_finazlier_4bce5c5c58c08386 ( Context * __context__, struct _lambda_thismodule_232_10_8 * ____this_rename_at_232 )
+{
+	finalize_da9a89580c66c5cf(__context__,das_arg<struct _lambda_thismodule_232_10_8>::pass(das_deref(__context__,____this_rename_at_232)));
+	das_delete_lambda_struct<struct _lambda_thismodule_232_10_8 *>::clear(__context__,____this_rename_at_232);
+}
+
+inline bool _Func_lambda_thismodule_232_10_8_0x60_function_8170def38434b7a7 ( Context * __context__, struct _lambda_thismodule_232_10_8 &  ____this_rename_at_232, TTuple<8,int32_t,float> &  ___yield_232_rename_at_232 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_232_32;
+	switch (____this_rename_at_232.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_232._loop_at_232,true);
+	das_move(____this_rename_at_232._source_0_at_232,(_temp_make_local_232_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(1,4)))));
+	memset(&(____this_rename_at_232.x), 0, 4);
+	das_copy(____this_rename_at_232._pvar_0_at_232,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_232.x)));
+	DAS_SETBOOLAND((____this_rename_at_232._loop_at_232),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_232._loop_at_232 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_232_rename_at_232,(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_232;
+		das_get_tuple_field<int32_t,0>::get(__mkt_232) = ____this_rename_at_232.x;
+		das_get_tuple_field<float,4>::get(__mkt_232) = 2.5f;
+		return __mkt_232;
+	})()));
+	das_copy(____this_rename_at_232.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_232._loop_at_232),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_235_18_9_0x60_finazlier_33e50c0cf9c9aace ( Context * __context__, struct _lambda_thismodule_235_18_9 * ____this_rename_at_235 )
+{
+	finalize_cb84739dfec92af7(__context__,das_arg<struct _lambda_thismodule_235_18_9>::pass(das_deref(__context__,____this_rename_at_235)));
+	das_delete_lambda_struct<struct _lambda_thismodule_235_18_9 *>::clear(__context__,____this_rename_at_235);
+}
+
+inline bool _Func_lambda_thismodule_235_18_9_0x60_function_bbe7072f5081faf ( Context * __context__, struct _lambda_thismodule_235_18_9 &  ____this_rename_at_235, TTuple<8,int32_t,float> &  ___yield_235_rename_at_235 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_235_32;
+	switch (____this_rename_at_235.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_235._loop_at_235,true);
+	das_move(____this_rename_at_235._source_0_at_235,(_temp_make_local_235_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))));
+	memset(&(____this_rename_at_235.x), 0, 4);
+	das_copy(____this_rename_at_235._pvar_0_at_235,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_235.x)));
+	DAS_SETBOOLAND((____this_rename_at_235._loop_at_235),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_235._loop_at_235 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_235_rename_at_235,(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_235;
+		das_get_tuple_field<int32_t,0>::get(__mkt_235) = ((SimPolicy<int32_t>::Mod(____this_rename_at_235.x,3,*__context__)) + 1);
+		das_get_tuple_field<float,4>::get(__mkt_235) = 2.5f;
+		return __mkt_235;
+	})()));
+	das_copy(____this_rename_at_235.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_235._loop_at_235),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_240_10_12_0x60_finazlier_c6049d6e3206fd98 ( Context * __context__, struct _lambda_thismodule_240_10_12 * ____this_rename_at_240 )
+{
+	finalize_3110b281c7deafcb(__context__,das_arg<struct _lambda_thismodule_240_10_12>::pass(das_deref(__context__,____this_rename_at_240)));
+	das_delete_lambda_struct<struct _lambda_thismodule_240_10_12 *>::clear(__context__,____this_rename_at_240);
+}
+
+inline bool _Func_lambda_thismodule_240_10_12_0x60_function_a218733ca2cc1c84 ( Context * __context__, struct _lambda_thismodule_240_10_12 &  ____this_rename_at_240, TArray<int32_t> &  ___yield_240_rename_at_240 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_240_32;
+	TArray<int32_t> _temp_make_local_240_48;
+	TDim<int32_t,2> _temp_make_local_240_80;
+	switch (____this_rename_at_240.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_240._loop_at_240,true);
+	das_move(____this_rename_at_240._source_0_at_240,(_temp_make_local_240_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(1,4)))));
+	memset(&(____this_rename_at_240.x), 0, 4);
+	das_copy(____this_rename_at_240._pvar_0_at_240,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_240.x)));
+	DAS_SETBOOLAND((____this_rename_at_240._loop_at_240),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_240._loop_at_240 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_240_rename_at_240,(_temp_make_local_240_48 = (_Funcbuiltin_0x60_to_array_move_2214fb125fb27d05(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_240_80(0,__context__) = ____this_rename_at_240.x;
+		_temp_make_local_240_80(1,__context__) = 2;
+		return _temp_make_local_240_80;
+	})()))))));
+	das_copy(____this_rename_at_240.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_240._loop_at_240),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_243_18_13_0x60_finazlier_6c8df04d1787ed80 ( Context * __context__, struct _lambda_thismodule_243_18_13 * ____this_rename_at_243 )
+{
+	finalize_3d9c85063ca4a8bd(__context__,das_arg<struct _lambda_thismodule_243_18_13>::pass(das_deref(__context__,____this_rename_at_243)));
+	das_delete_lambda_struct<struct _lambda_thismodule_243_18_13 *>::clear(__context__,____this_rename_at_243);
+}
+
+inline bool _Func_lambda_thismodule_243_18_13_0x60_function_56d8ac83771ebaa0 ( Context * __context__, struct _lambda_thismodule_243_18_13 &  ____this_rename_at_243, TArray<int32_t> &  ___yield_243_rename_at_243 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_243_32;
+	TArray<int32_t> _temp_make_local_243_48;
+	TDim<int32_t,2> _temp_make_local_243_80;
+	switch (____this_rename_at_243.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_243._loop_at_243,true);
+	das_move(____this_rename_at_243._source_0_at_243,(_temp_make_local_243_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))));
+	memset(&(____this_rename_at_243.x), 0, 4);
+	das_copy(____this_rename_at_243._pvar_0_at_243,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_243.x)));
+	DAS_SETBOOLAND((____this_rename_at_243._loop_at_243),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_243._loop_at_243 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_243_rename_at_243,(_temp_make_local_243_48 = (_Funcbuiltin_0x60_to_array_move_2214fb125fb27d05(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_243_80(0,__context__) = ((SimPolicy<int32_t>::Mod(____this_rename_at_243.x,3,*__context__)) + 1);
+		_temp_make_local_243_80(1,__context__) = 2;
+		return _temp_make_local_243_80;
+	})()))))));
+	das_copy(____this_rename_at_243.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_243._loop_at_243),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_31_12_23_0x60_finazlier_dd3b67d87541f66e ( Context * __context__, struct _lambda_thismodule_31_12_23 * ____this_rename_at_31 )
+{
+	finalize_ea77efc811c36135(__context__,das_arg<struct _lambda_thismodule_31_12_23>::pass(das_deref(__context__,____this_rename_at_31)));
+	das_delete_lambda_struct<struct _lambda_thismodule_31_12_23 *>::clear(__context__,____this_rename_at_31);
+}
+
+inline bool _Func_lambda_thismodule_31_12_23_0x60_function_2a84fb4ade010279 ( Context * __context__, struct _lambda_thismodule_31_12_23 &  ____this_rename_at_31, int32_t & ___yield_31_rename_at_31 )
+{
+	switch (____this_rename_at_31.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_31._loop_at_31,true);
+	das_move(____this_rename_at_31._source_0_at_31,____this_rename_at_31.src);
+	memset(&(____this_rename_at_31.w), 0, 4);
+	das_copy(____this_rename_at_31._pvar_0_at_31,das_ref(__context__,____this_rename_at_31.w));
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_31._loop_at_31 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_31_rename_at_31,das_invoke_function<int32_t>::invoke<int32_t>(__context__,____this_rename_at_31.blk,____this_rename_at_31.w));
+	das_copy(____this_rename_at_31.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_31_12_24_0x60_finazlier_f9e30e37e67a684 ( Context * __context__, struct _lambda_thismodule_31_12_24 * ____this_rename_at_31 )
+{
+	finalize_8902c5c3395ffb84(__context__,das_arg<struct _lambda_thismodule_31_12_24>::pass(das_deref(__context__,____this_rename_at_31)));
+	das_delete_lambda_struct<struct _lambda_thismodule_31_12_24 *>::clear(__context__,____this_rename_at_31);
+}
+
+inline bool _Func_lambda_thismodule_31_12_24_0x60_function_1c9f896f20c45e59 ( Context * __context__, struct _lambda_thismodule_31_12_24 &  ____this_rename_at_31, bool & ___yield_31_rename_at_31 )
+{
+	switch (____this_rename_at_31.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_31._loop_at_31,true);
+	das_move(____this_rename_at_31._source_0_at_31,____this_rename_at_31.src);
+	memset(&(____this_rename_at_31.w), 0, 4);
+	das_copy(____this_rename_at_31._pvar_0_at_31,das_ref(__context__,____this_rename_at_31.w));
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_31._loop_at_31 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_31_rename_at_31,das_invoke_lambda<bool>::invoke<int32_t>(__context__,____this_rename_at_31.blk,____this_rename_at_31.w));
+	das_copy(____this_rename_at_31.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_31_12_25_0x60_finazlier_18b30f1c2454e192 ( Context * __context__, struct _lambda_thismodule_31_12_25 * ____this_rename_at_31 )
+{
+	finalize_fb1e929eb75c77d3(__context__,das_arg<struct _lambda_thismodule_31_12_25>::pass(das_deref(__context__,____this_rename_at_31)));
+	das_delete_lambda_struct<struct _lambda_thismodule_31_12_25 *>::clear(__context__,____this_rename_at_31);
+}
+
+inline bool _Func_lambda_thismodule_31_12_25_0x60_function_d46b695e95774a0f ( Context * __context__, struct _lambda_thismodule_31_12_25 &  ____this_rename_at_31, int32_t & ___yield_31_rename_at_31 )
+{
+	switch (____this_rename_at_31.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_31._loop_at_31,true);
+	das_move(____this_rename_at_31._source_0_at_31,____this_rename_at_31.src);
+	memset(&(____this_rename_at_31.w), 0, 4);
+	das_copy(____this_rename_at_31._pvar_0_at_31,das_ref(__context__,____this_rename_at_31.w));
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_31._loop_at_31 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_31_rename_at_31,das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,____this_rename_at_31.blk,____this_rename_at_31.w));
+	das_copy(____this_rename_at_31.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_31_12_26_0x60_finazlier_2bab9c9fda0e690c ( Context * __context__, struct _lambda_thismodule_31_12_26 * ____this_rename_at_31 )
+{
+	finalize_a742d882934bc67a(__context__,das_arg<struct _lambda_thismodule_31_12_26>::pass(das_deref(__context__,____this_rename_at_31)));
+	das_delete_lambda_struct<struct _lambda_thismodule_31_12_26 *>::clear(__context__,____this_rename_at_31);
+}
+
+inline bool _Func_lambda_thismodule_31_12_26_0x60_function_e9e6b4863dad899e ( Context * __context__, struct _lambda_thismodule_31_12_26 &  ____this_rename_at_31, TTuple<8,int32_t,float> &  ___yield_31_rename_at_31 )
+{
+	switch (____this_rename_at_31.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_31._loop_at_31,true);
+	das_move(____this_rename_at_31._source_0_at_31,____this_rename_at_31.src);
+	memset(&(____this_rename_at_31.w), 0, 4);
+	das_copy(____this_rename_at_31._pvar_0_at_31,das_ref(__context__,____this_rename_at_31.w));
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_31._loop_at_31 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_31_rename_at_31,das_invoke_lambda<TTuple<8,int32_t,float>>::invoke_cmres<int32_t>(__context__,____this_rename_at_31.blk,____this_rename_at_31.w));
+	das_copy(____this_rename_at_31.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_31_12_36_0x60_finazlier_d0925bee24ffbcee ( Context * __context__, struct _lambda_thismodule_31_12_36 * ____this_rename_at_31 )
+{
+	finalize_2c6d673361e95598(__context__,das_arg<struct _lambda_thismodule_31_12_36>::pass(das_deref(__context__,____this_rename_at_31)));
+	das_delete_lambda_struct<struct _lambda_thismodule_31_12_36 *>::clear(__context__,____this_rename_at_31);
+}
+
+inline bool _Func_lambda_thismodule_31_12_36_0x60_function_4ffe3318a27ea7b8 ( Context * __context__, struct _lambda_thismodule_31_12_36 &  ____this_rename_at_31, int32_t & ___yield_31_rename_at_31 )
+{
+	switch (____this_rename_at_31.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_31._loop_at_31,true);
+	das_move(____this_rename_at_31._source_0_at_31,____this_rename_at_31.src);
+	memset(&(____this_rename_at_31.w), 0, 24);
+	das_copy(____this_rename_at_31._pvar_0_at_31,das_ref(__context__,____this_rename_at_31.w));
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_31._loop_at_31 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_31_rename_at_31,das_invoke_lambda<int32_t>::invoke<TArray<int32_t> &>(__context__,____this_rename_at_31.blk,das_arg<TArray<int32_t>>::pass(____this_rename_at_31.w)));
+	das_copy(____this_rename_at_31.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_31._loop_at_31),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_31._source_0_at_31),____this_rename_at_31._pvar_0_at_31,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_36_12_34_0x60_finazlier_c532515853e13ae0 ( Context * __context__, struct _lambda_thismodule_36_12_34 * ____this_rename_at_36 )
+{
+	finalize_9a32ba1293d999ac(__context__,das_arg<struct _lambda_thismodule_36_12_34>::pass(das_deref(__context__,____this_rename_at_36)));
+	das_delete_lambda_struct<struct _lambda_thismodule_36_12_34 *>::clear(__context__,____this_rename_at_36);
+}
+
+inline bool _Func_lambda_thismodule_36_12_34_0x60_function_ffcc9c524f18b6e0 ( Context * __context__, struct _lambda_thismodule_36_12_34 &  ____this_rename_at_36, TArray<int32_t> &  ___yield_36_rename_at_36 )
+{
+	switch (____this_rename_at_36.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_36._loop_at_36,true);
+	das_move(____this_rename_at_36._source_0_at_36,____this_rename_at_36.src);
+	memset(&(____this_rename_at_36.w), 0, 8);
+	das_copy(____this_rename_at_36._pvar_0_at_36,das_ref(__context__,____this_rename_at_36.w));
+	DAS_SETBOOLAND((____this_rename_at_36._loop_at_36),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_36._loop_at_36 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_36_rename_at_36,das_invoke_lambda<TArray<int32_t>>::invoke_cmres<TArray<int32_t> &>(__context__,____this_rename_at_36.blk,das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_36.w))));
+	das_copy(____this_rename_at_36.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_36._loop_at_36),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_50_23_4_0x60_finazlier_94bec26830d25378 ( Context * __context__, struct _lambda_thismodule_50_23_4 * ____this_rename_at_50 )
+{
+	finalize_e4e346397db1da55(__context__,das_arg<struct _lambda_thismodule_50_23_4>::pass(das_deref(__context__,____this_rename_at_50)));
+	das_delete_lambda_struct<struct _lambda_thismodule_50_23_4 *>::clear(__context__,____this_rename_at_50);
+}
+
+inline bool _Func_lambda_thismodule_50_23_4_0x60_function_99aaeed6b450d1aa ( Context * __context__, struct _lambda_thismodule_50_23_4 &  ____this_rename_at_50, int32_t const  * & ___ryield50_rename_at_50 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_50_32;
+	switch (____this_rename_at_50.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_50._loop_at_50,true);
+	das_move(____this_rename_at_50._source_0_at_50,(_temp_make_local_50_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,100)))));
+	memset(&(____this_rename_at_50.x), 0, 4);
+	das_copy(____this_rename_at_50._pvar_0_at_50,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_50.x)));
+	DAS_SETBOOLAND((____this_rename_at_50._loop_at_50),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_50._loop_at_50 )
+	{
+		goto label_5;
+	};
+	if ( !((SimPolicy<int32_t>::Mod(____this_rename_at_50.x,2,*__context__)) == 0) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield50_rename_at_50,das_ref(__context__,____this_rename_at_50.x));
+	das_copy(____this_rename_at_50.__yield,1);
+	return true;
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_50._loop_at_50),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_56_21_10_0x60_finazlier_5af839a62194f574 ( Context * __context__, struct _lambda_thismodule_56_21_10 * ____this_rename_at_56 )
+{
+	finalize_7e62c95ba3669c0e(__context__,das_arg<struct _lambda_thismodule_56_21_10>::pass(das_deref(__context__,____this_rename_at_56)));
+	das_delete_lambda_struct<struct _lambda_thismodule_56_21_10 *>::clear(__context__,____this_rename_at_56);
+}
+
+inline bool _Func_lambda_thismodule_56_21_10_0x60_function_8fb561381ecc7a45 ( Context * __context__, struct _lambda_thismodule_56_21_10 &  ____this_rename_at_56, TArray<int32_t> &  ___yield_56_rename_at_56 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_56_32;
+	TArray<int32_t> _temp_make_local_56_48;
+	TDim<int32_t,2> _temp_make_local_56_80;
+	switch (____this_rename_at_56.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_56._loop_at_56,true);
+	das_move(____this_rename_at_56._source_0_at_56,(_temp_make_local_56_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(1,4)))));
+	memset(&(____this_rename_at_56.x), 0, 4);
+	das_copy(____this_rename_at_56._pvar_0_at_56,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_56.x)));
+	DAS_SETBOOLAND((____this_rename_at_56._loop_at_56),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_56._loop_at_56 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_56_rename_at_56,(_temp_make_local_56_48 = (_Funcbuiltin_0x60_to_array_move_2214fb125fb27d05(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_56_80(0,__context__) = ____this_rename_at_56.x;
+		_temp_make_local_56_80(1,__context__) = 2;
+		return _temp_make_local_56_80;
+	})()))))));
+	das_copy(____this_rename_at_56.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_56._loop_at_56),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_71_25_14_0x60_finazlier_71ea3165571200f0 ( Context * __context__, struct _lambda_thismodule_71_25_14 * ____this_rename_at_71 )
+{
+	finalize_8d49d3be2563d419(__context__,das_arg<struct _lambda_thismodule_71_25_14>::pass(das_deref(__context__,____this_rename_at_71)));
+	das_delete_lambda_struct<struct _lambda_thismodule_71_25_14 *>::clear(__context__,____this_rename_at_71);
+}
+
+inline bool _Func_lambda_thismodule_71_25_14_0x60_function_7d139dafd160cd75 ( Context * __context__, struct _lambda_thismodule_71_25_14 &  ____this_rename_at_71, int32_t __x_rename_at_71 )
+{
+	return (SimPolicy<int32_t>::Mod(__x_rename_at_71,2,*__context__)) == 0;
+}
+
+inline void _Func_lambda_thismodule_85_28_1_0x60_finazlier_9127d836addd785e ( Context * __context__, struct _lambda_thismodule_85_28_1 * ____this_rename_at_85 )
+{
+	finalize_8f217ed02c7d43f1(__context__,das_arg<struct _lambda_thismodule_85_28_1>::pass(das_deref(__context__,____this_rename_at_85)));
+	das_delete_lambda_struct<struct _lambda_thismodule_85_28_1 *>::clear(__context__,____this_rename_at_85);
+}
+
+inline int32_t _Func_lambda_thismodule_85_28_1_0x60_function_fc32ad12852d63cb ( Context * __context__, struct _lambda_thismodule_85_28_1 &  ____this_rename_at_85, int32_t __x_rename_at_85 )
+{
+	return __x_rename_at_85 + __x_rename_at_85;
+}
+
+inline void _Func_lambda_thismodule_90_14_11_0x60_finazlier_6211c33db3590752 ( Context * __context__, struct _lambda_thismodule_90_14_11 * ____this_rename_at_90 )
+{
+	finalize_75919cb3423249cf(__context__,das_arg<struct _lambda_thismodule_90_14_11>::pass(das_deref(__context__,____this_rename_at_90)));
+	das_delete_lambda_struct<struct _lambda_thismodule_90_14_11 *>::clear(__context__,____this_rename_at_90);
+}
+
+inline bool _Func_lambda_thismodule_90_14_11_0x60_function_a90556289c67e109 ( Context * __context__, struct _lambda_thismodule_90_14_11 &  ____this_rename_at_90, TArray<int32_t> &  ___yield_90_rename_at_90 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_90_32;
+	TArray<int32_t> _temp_make_local_90_48;
+	TDim<int32_t,2> _temp_make_local_90_80;
+	switch (____this_rename_at_90.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_90._loop_at_90,true);
+	das_move(____this_rename_at_90._source_0_at_90,(_temp_make_local_90_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,100)))));
+	memset(&(____this_rename_at_90.x), 0, 4);
+	das_copy(____this_rename_at_90._pvar_0_at_90,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_90.x)));
+	DAS_SETBOOLAND((____this_rename_at_90._loop_at_90),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_90._loop_at_90 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_90_rename_at_90,(_temp_make_local_90_48 = (_Funcbuiltin_0x60_to_array_move_2214fb125fb27d05(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_90_80(0,__context__) = ____this_rename_at_90.x;
+		_temp_make_local_90_80(1,__context__) = 2;
+		return _temp_make_local_90_80;
+	})()))))));
+	das_copy(____this_rename_at_90.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_90._loop_at_90),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_91_25_27_0x60_finazlier_8b8a9141cef68454 ( Context * __context__, struct _lambda_thismodule_91_25_27 * ____this_rename_at_91 )
+{
+	finalize_cfd3426561e2e7e5(__context__,das_arg<struct _lambda_thismodule_91_25_27>::pass(das_deref(__context__,____this_rename_at_91)));
+	das_delete_lambda_struct<struct _lambda_thismodule_91_25_27 *>::clear(__context__,____this_rename_at_91);
+}
+
+inline bool _Func_lambda_thismodule_91_25_27_0x60_function_37bece982a84c392 ( Context * __context__, struct _lambda_thismodule_91_25_27 &  ____this_rename_at_91, TArray<int32_t> const  &  __x_rename_at_91 )
+{
+	return (SimPolicy<int32_t>::Mod(__x_rename_at_91(0,__context__),2,*__context__)) == 0;
+}
+
+inline void _Func_lambda_thismodule_92_36_32_0x60_finazlier_2bfc7672990c4ec6 ( Context * __context__, struct _lambda_thismodule_92_36_32 * ____this_rename_at_92 )
+{
+	finalize_6eaa1c4f569102fc(__context__,das_arg<struct _lambda_thismodule_92_36_32>::pass(das_deref(__context__,____this_rename_at_92)));
+	das_delete_lambda_struct<struct _lambda_thismodule_92_36_32 *>::clear(__context__,____this_rename_at_92);
+}
+
+inline TArray<int32_t> _Func_lambda_thismodule_92_36_32_0x60_function_28f9b06ed4451972 ( Context * __context__, struct _lambda_thismodule_92_36_32 &  ____this_rename_at_92, TArray<int32_t> const  &  __x_rename_at_92 )
+{
+	TDim<int32_t,3> _temp_make_local_92_32;
+	return /* <- */ _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_92_32(0,__context__) = __x_rename_at_92(0,__context__);
+		_temp_make_local_92_32(1,__context__) = __x_rename_at_92(0,__context__);
+		_temp_make_local_92_32(2,__context__) = __x_rename_at_92(0,__context__);
+		return _temp_make_local_92_32;
+	})())));
+}
+
+inline void _Func_lambda_thismodule_93_29_35_0x60_finazlier_9f733d78516145ce ( Context * __context__, struct _lambda_thismodule_93_29_35 * ____this_rename_at_93 )
+{
+	finalize_cdc2fc53315b9882(__context__,das_arg<struct _lambda_thismodule_93_29_35>::pass(das_deref(__context__,____this_rename_at_93)));
+	das_delete_lambda_struct<struct _lambda_thismodule_93_29_35 *>::clear(__context__,____this_rename_at_93);
+}
+
+inline int32_t _Func_lambda_thismodule_93_29_35_0x60_function_8d241ebd3f86fba5 ( Context * __context__, struct _lambda_thismodule_93_29_35 &  ____this_rename_at_93, TArray<int32_t> const  &  __x_rename_at_93 )
+{
+	return __x_rename_at_93(0,__context__);
+}
+
+inline void _Func_lambda_thismodule_9_12_20_0x60_finazlier_98f5961684e556b4 ( Context * __context__, struct _lambda_thismodule_9_12_20 * ____this_rename_at_9 )
+{
+	finalize_96301ec05baef2f5(__context__,das_arg<struct _lambda_thismodule_9_12_20>::pass(das_deref(__context__,____this_rename_at_9)));
+	das_delete_lambda_struct<struct _lambda_thismodule_9_12_20 *>::clear(__context__,____this_rename_at_9);
+}
+
+inline bool _Func_lambda_thismodule_9_12_20_0x60_function_24611828323dd0f8 ( Context * __context__, struct _lambda_thismodule_9_12_20 &  ____this_rename_at_9, int32_t & ___yield_9_rename_at_9 )
+{
+	switch (____this_rename_at_9.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_9._loop_at_9,true);
+	das_move(____this_rename_at_9._source_0_at_9,____this_rename_at_9.src);
+	memset(&(____this_rename_at_9.w), 0, 4);
+	das_copy(____this_rename_at_9._pvar_0_at_9,das_ref(__context__,____this_rename_at_9.w));
+	DAS_SETBOOLAND((____this_rename_at_9._loop_at_9),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_9._loop_at_9 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_function<bool>::invoke<int32_t>(__context__,____this_rename_at_9.blk,____this_rename_at_9.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_9_rename_at_9,____this_rename_at_9.w);
+	das_copy(____this_rename_at_9.__yield,1);
+	return true;
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_9._loop_at_9),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_9_12_21_0x60_finazlier_dd2c46f6117be984 ( Context * __context__, struct _lambda_thismodule_9_12_21 * ____this_rename_at_9 )
+{
+	finalize_4b0e4cd0a7164aae(__context__,das_arg<struct _lambda_thismodule_9_12_21>::pass(das_deref(__context__,____this_rename_at_9)));
+	das_delete_lambda_struct<struct _lambda_thismodule_9_12_21 *>::clear(__context__,____this_rename_at_9);
+}
+
+inline bool _Func_lambda_thismodule_9_12_21_0x60_function_82cc0fe87cfae825 ( Context * __context__, struct _lambda_thismodule_9_12_21 &  ____this_rename_at_9, int32_t & ___yield_9_rename_at_9 )
+{
+	switch (____this_rename_at_9.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_9._loop_at_9,true);
+	das_move(____this_rename_at_9._source_0_at_9,____this_rename_at_9.src);
+	memset(&(____this_rename_at_9.w), 0, 4);
+	das_copy(____this_rename_at_9._pvar_0_at_9,das_ref(__context__,____this_rename_at_9.w));
+	DAS_SETBOOLAND((____this_rename_at_9._loop_at_9),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_9._loop_at_9 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,____this_rename_at_9.blk,____this_rename_at_9.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_9_rename_at_9,____this_rename_at_9.w);
+	das_copy(____this_rename_at_9.__yield,1);
+	return true;
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_9._loop_at_9),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__);
+	return false;
+}
+
+inline int32_t _Func_0x60_first_fc2232d3c243ca99 ( Context * __context__, TTuple<8,int32_t,float> const  &  __x_rename_at_23 )
+{
+	return das_get_tuple_field<int32_t,0>::get(__x_rename_at_23);
+}
+
+inline bool _Func_0x60_is_same_590802a3ad1ce37b ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : array<int> const&
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __x_iterator(__a_rename_at_37);
+		TArray<int32_t> const  * __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : array<int> const
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __y_iterator(__b_rename_at_37);
+		TArray<int32_t> const  __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( _FuncExclEqu_f4f0b94c8df92c7b(__context__,(*__x_rename_at_38),__y_rename_at_38) )
+			{
+				return false;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return true;
+}
+
+inline bool _Func_0x60_is_same_97c40271e1b9fd95 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : tuple<int;float> const&
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __x_iterator(__a_rename_at_37);
+		TTuple<8,int32_t,float> const  * __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : tuple<int;float> const
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __y_iterator(__b_rename_at_37);
+		TTuple<8,int32_t,float> const  __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( _FuncExclEqu_e106a056c753c270(__context__,(*__x_rename_at_38),__y_rename_at_38) )
+			{
+				return false;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return true;
+}
+
+inline bool _Func_0x60_is_same_9afffff6294c0446 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((int32_t)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__a_rename_at_37);
+		int32_t __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __y_iterator(__b_rename_at_37);
+		int32_t __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( __x_rename_at_38 != __y_rename_at_38 )
+			{
+				return false;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return true;
+}
+
+inline void _Func_0x60_verify_14_35b8308b990b4b30 ( Context * __context__, TArray<TArray<int32_t>> const  &  __t_rename_at_43 )
+{
+	{
+		bool __need_loop_44 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(1,4));
+		int32_t __x_rename_at_44;
+		__need_loop_44 = __x_iterator.first(__context__,(__x_rename_at_44)) && __need_loop_44;
+		// y : array<int> const&
+		das_iterator<TArray<TArray<int32_t>> const > __y_iterator(__t_rename_at_43);
+		TArray<int32_t> const  * __y_rename_at_44;
+		__need_loop_44 = __y_iterator.first(__context__,(__y_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __x_iterator.next(__context__,(__x_rename_at_44)) && __y_iterator.next(__context__,(__y_rename_at_44)) )
+		{
+			DAS_ASSERT((((*__y_rename_at_44)(0,__context__) == __x_rename_at_44) && ((*__y_rename_at_44)(1,__context__) == 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_44));
+		__y_iterator.close(__context__,(__y_rename_at_44));
+	};
+}
+
+inline void _Func_0x60_verify_14_ccaf1183e323809f ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  __t_rename_at_43 )
+{
+	{
+		bool __need_loop_44 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(1,4));
+		int32_t __x_rename_at_44;
+		__need_loop_44 = __x_iterator.first(__context__,(__x_rename_at_44)) && __need_loop_44;
+		// y : array<int> const
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __y_iterator(__t_rename_at_43);
+		TArray<int32_t> const  __y_rename_at_44;
+		__need_loop_44 = __y_iterator.first(__context__,(__y_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __x_iterator.next(__context__,(__x_rename_at_44)) && __y_iterator.next(__context__,(__y_rename_at_44)) )
+		{
+			DAS_ASSERT(((__y_rename_at_44(0,__context__) == __x_rename_at_44) && (__y_rename_at_44(1,__context__) == 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_44));
+		__y_iterator.close(__context__,(__y_rename_at_44));
+	};
+}
+
+inline void _Func_0x60_verify_even_8835d561dd20d47 ( Context * __context__, TArray<int32_t> const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__arr_rename_at_19);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline void _Func_0x60_verify_even_6078037029e38486 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__arr_rename_at_19);
+		int32_t __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT((__x_rename_at_20 == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline void _Func_0x60_verify_even_bb494c9a7d66151f ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const )) const > __x_iterator(__arr_rename_at_19);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline int32_t add_71ce43625bcdc5ea ( Context * __context__, int32_t __a_rename_at_15, int32_t __b_rename_at_15 )
+{
+	return __a_rename_at_15 + __b_rename_at_15;
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> &  __a_rename_at_232, TArray<int32_t> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_232);
+		int32_t * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_232);
+		int32_t const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			das_copy((*__aV_rename_at_234),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_298c4ba2da976305 ( Context * __context__, TArray<TArray<int32_t>> const  &  __a_rename_at_353 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) __it_rename_at_354; das_zero(__it_rename_at_354);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_354),__a_rename_at_353,24,__context__);
+	return /* <- */ __it_rename_at_354;
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_2d3d435a4c8a02ad ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  &  __a_rename_at_353 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) __it_rename_at_354; das_zero(__it_rename_at_354);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_354),__a_rename_at_353,8,__context__);
+	return /* <- */ __it_rename_at_354;
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_353 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_354; das_zero(__it_rename_at_354);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_354),__a_rename_at_353,4,__context__);
+	return /* <- */ __it_rename_at_354;
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcbuiltin_0x60_each_69d7e7bb51ea3de6 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t>)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcbuiltin_0x60_each_ba1451246e410d44 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline Sequence DAS_COMMENT((bool)) _Funcbuiltin_0x60_each_73dbf68872e28f81 ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((bool)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((bool))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_d7a87ffd28768e01 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_334; das_zero(__it_rename_at_334);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_334),__rng_rename_at_333,__context__);
+	return /* <- */ __it_rename_at_334;
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_ref_dd8113899e5f9ac1 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  __lam_rename_at_364 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) __it_rename_at_365; das_zero(__it_rename_at_365);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_365),__lam_rename_at_364,__context__);
+	return /* <- */ __it_rename_at_365;
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_ref_ddfd027208f57be5 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  __lam_rename_at_364 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) __it_rename_at_365; das_zero(__it_rename_at_365);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_365),__lam_rename_at_364,__context__);
+	return /* <- */ __it_rename_at_365;
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_ref_576a75d40473b6b2 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_364 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_365; das_zero(__it_rename_at_365);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_365),__lam_rename_at_364,__context__);
+	return /* <- */ __it_rename_at_365;
+}
+
+inline void _Funcbuiltin_0x60_emplace_9b7538bf247950b8 ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_69, TArray<int32_t> &  __value_rename_at_69, int32_t __at_rename_at_69 )
+{
+	das_move(__Arr_rename_at_69(builtin_array_push(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_69),__at_rename_at_69,24,__context__),__context__),__value_rename_at_69);
+}
+
+inline void _Funcbuiltin_0x60_finalize_242c8c79790d8651 ( Context * __context__, TArray<TArray<int32_t>> &  __a_rename_at_285 )
+{
+	{
+		bool __need_loop_287 = true;
+		// aV : array<int> aka TT&
+		das_iterator<TArray<TArray<int32_t>>> __aV_iterator(__a_rename_at_285);
+		TArray<int32_t> * __aV_rename_at_287;
+		__need_loop_287 = __aV_iterator.first(__context__,(__aV_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __aV_iterator.next(__context__,(__aV_rename_at_287)) )
+		{
+			_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass((*__aV_rename_at_287)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_287));
+	};
+	builtin_array_free(das_arg<TArray<TArray<int32_t>>>::pass(__a_rename_at_285),24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_e1c35de9ada57daf ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  __a_rename_at_285 )
+{
+	{
+		bool __need_loop_287 = true;
+		// aV : tuple<int;float> aka TT&
+		das_iterator<TArray<TTuple<8,int32_t,float>>> __aV_iterator(__a_rename_at_285);
+		TTuple<8,int32_t,float> * __aV_rename_at_287;
+		__need_loop_287 = __aV_iterator.first(__context__,(__aV_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __aV_iterator.next(__context__,(__aV_rename_at_287)) )
+		{
+			finalize_554c45dda146b8a6(__context__,das_arg<TTuple<8,int32_t,float>>::pass((*__aV_rename_at_287)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_287));
+	};
+	builtin_array_free(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_9e42c2cbacc8edfd ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_75, TArray<int32_t> const  &  __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_75),__at_rename_at_75,24,__context__),__context__)),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_2d25e6e543f5b2eb ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  __Arr_rename_at_75, TTuple<8,int32_t,float> const  &  __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(__Arr_rename_at_75),__at_rename_at_75,8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_reserve_96529fa671b59898 ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_e7337cf490aef504 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_379 )
+{
+	TArray<int32_t> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_380),__it_rename_at_379,4,false,__context__);
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_398 )
+{
+	TArray<int32_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_399),2);
+	das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_398 )
+{
+	TArray<int32_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_399),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline void finalize_554c45dda146b8a6 ( Context * __context__, TTuple<8,int32_t,float> &  ____this_rename_at_126 )
+{
+	memset(&(____this_rename_at_126), 0, 8);
+}
+
+inline void finalize_a9d0ed6e96725931 ( Context * __context__, struct _lambda_thismodule_106_15_5 &  ____this_rename_at_106 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),__context__);
+	memset(&(____this_rename_at_106), 0, 40);
+}
+
+inline void finalize_87ca26a909d496c5 ( Context * __context__, struct _lambda_thismodule_113_12_19 &  ____this_rename_at_113 )
+{
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_113.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_113._source_0_at_114),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_113.___source_0_at_118_rename_at_118),__context__);
+	memset(&(____this_rename_at_113), 0, 112);
+}
+
+inline void finalize_4e0f4bc7b8ca2ddf ( Context * __context__, struct _lambda_thismodule_115_27_15 &  ____this_rename_at_115 )
+{
+	memset(&(____this_rename_at_115), 0, 8);
+}
+
+inline void finalize_3c4ff226a8e359f6 ( Context * __context__, struct _lambda_thismodule_125_12_28 &  ____this_rename_at_125 )
+{
+	_Funcbuiltin_0x60_finalize_e1c35de9ada57daf(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_125.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_125._source_0_at_126),__context__);
+	finalize_554c45dda146b8a6(__context__,das_arg<TTuple<8,int32_t,float>>::pass(____this_rename_at_125.x));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_125.___source_0_at_130_rename_at_130),__context__);
+	memset(&(____this_rename_at_125), 0, 112);
+}
+
+inline void finalize_63d741ed1ad0a885 ( Context * __context__, struct _lambda_thismodule_125_12_29 &  ____this_rename_at_125 )
+{
+	_Funcbuiltin_0x60_finalize_242c8c79790d8651(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_125.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_125._source_0_at_126),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_125.x));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_125.___source_0_at_130_rename_at_130),__context__);
+	memset(&(____this_rename_at_125), 0, 128);
+}
+
+inline void finalize_ac07579e55ec835c ( Context * __context__, struct _lambda_thismodule_139_12_22 &  ____this_rename_at_139 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_139._source_0_at_139),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_139._source_1_at_139),__context__);
+	memset(&(____this_rename_at_139), 0, 88);
+}
+
+inline void finalize_99b4eff0b688c844 ( Context * __context__, struct _lambda_thismodule_139_28_6 &  ____this_rename_at_139 )
+{
+	memset(&(____this_rename_at_139), 0, 8);
+}
+
+inline void finalize_84432671fa988803 ( Context * __context__, struct _lambda_thismodule_145_12_31 &  ____this_rename_at_145 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_145._source_0_at_145),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_145._source_1_at_145),__context__);
+	memset(&(____this_rename_at_145), 0, 88);
+}
+
+inline void finalize_d09c68d01225d761 ( Context * __context__, struct _lambda_thismodule_145_12_33 &  ____this_rename_at_145 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_145._source_0_at_145),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_145._source_1_at_145),__context__);
+	memset(&(____this_rename_at_145), 0, 88);
+}
+
+inline void finalize_fea47afcce8467af ( Context * __context__, struct _lambda_thismodule_154_8_2 &  ____this_rename_at_154 )
+{
+	memset(&(____this_rename_at_154), 0, 16);
+}
+
+inline void finalize_35204d53807e6c74 ( Context * __context__, struct _lambda_thismodule_15_12_30 &  ____this_rename_at_15 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_15._source_0_at_15),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_15.w));
+	memset(&(____this_rename_at_15), 0, 80);
+}
+
+inline void finalize_8655051428abd0f4 ( Context * __context__, struct _lambda_thismodule_161_8_3 &  ____this_rename_at_161 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_161._source_0_at_164),__context__);
+	memset(&(____this_rename_at_161), 0, 48);
+}
+
+inline void finalize_790215f236547953 ( Context * __context__, struct _lambda_thismodule_163_30_16 &  ____this_rename_at_163 )
+{
+	memset(&(____this_rename_at_163), 0, 8);
+}
+
+inline void finalize_1bb28fe166db1ff8 ( Context * __context__, struct _lambda_thismodule_172_30_17 &  ____this_rename_at_172 )
+{
+	memset(&(____this_rename_at_172), 0, 8);
+}
+
+inline void finalize_6a14a117832a47b4 ( Context * __context__, struct _lambda_thismodule_180_30_18 &  ____this_rename_at_180 )
+{
+	memset(&(____this_rename_at_180), 0, 8);
+}
+
+inline void finalize_49ff1a0658524f07 ( Context * __context__, struct _lambda_thismodule_227_19_7 &  ____this_rename_at_227 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),__context__);
+	memset(&(____this_rename_at_227), 0, 40);
+}
+
+inline void finalize_da9a89580c66c5cf ( Context * __context__, struct _lambda_thismodule_232_10_8 &  ____this_rename_at_232 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),__context__);
+	memset(&(____this_rename_at_232), 0, 40);
+}
+
+inline void finalize_cb84739dfec92af7 ( Context * __context__, struct _lambda_thismodule_235_18_9 &  ____this_rename_at_235 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),__context__);
+	memset(&(____this_rename_at_235), 0, 40);
+}
+
+inline void finalize_3110b281c7deafcb ( Context * __context__, struct _lambda_thismodule_240_10_12 &  ____this_rename_at_240 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),__context__);
+	memset(&(____this_rename_at_240), 0, 40);
+}
+
+inline void finalize_3d9c85063ca4a8bd ( Context * __context__, struct _lambda_thismodule_243_18_13 &  ____this_rename_at_243 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),__context__);
+	memset(&(____this_rename_at_243), 0, 40);
+}
+
+inline void finalize_ea77efc811c36135 ( Context * __context__, struct _lambda_thismodule_31_12_23 &  ____this_rename_at_31 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),__context__);
+	memset(&(____this_rename_at_31), 0, 56);
+}
+
+inline void finalize_8902c5c3395ffb84 ( Context * __context__, struct _lambda_thismodule_31_12_24 &  ____this_rename_at_31 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),__context__);
+	memset(&(____this_rename_at_31), 0, 64);
+}
+
+inline void finalize_fb1e929eb75c77d3 ( Context * __context__, struct _lambda_thismodule_31_12_25 &  ____this_rename_at_31 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),__context__);
+	memset(&(____this_rename_at_31), 0, 64);
+}
+
+inline void finalize_a742d882934bc67a ( Context * __context__, struct _lambda_thismodule_31_12_26 &  ____this_rename_at_31 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_31._source_0_at_31),__context__);
+	memset(&(____this_rename_at_31), 0, 64);
+}
+
+inline void finalize_2c6d673361e95598 ( Context * __context__, struct _lambda_thismodule_31_12_36 &  ____this_rename_at_31 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_31._source_0_at_31),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_31.w));
+	memset(&(____this_rename_at_31), 0, 80);
+}
+
+inline void finalize_9a32ba1293d999ac ( Context * __context__, struct _lambda_thismodule_36_12_34 &  ____this_rename_at_36 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_36._source_0_at_36),__context__);
+	memset(&(____this_rename_at_36), 0, 64);
+}
+
+inline void finalize_e4e346397db1da55 ( Context * __context__, struct _lambda_thismodule_50_23_4 &  ____this_rename_at_50 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),__context__);
+	memset(&(____this_rename_at_50), 0, 40);
+}
+
+inline void finalize_7e62c95ba3669c0e ( Context * __context__, struct _lambda_thismodule_56_21_10 &  ____this_rename_at_56 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),__context__);
+	memset(&(____this_rename_at_56), 0, 40);
+}
+
+inline void finalize_8d49d3be2563d419 ( Context * __context__, struct _lambda_thismodule_71_25_14 &  ____this_rename_at_71 )
+{
+	memset(&(____this_rename_at_71), 0, 8);
+}
+
+inline void finalize_8f217ed02c7d43f1 ( Context * __context__, struct _lambda_thismodule_85_28_1 &  ____this_rename_at_85 )
+{
+	memset(&(____this_rename_at_85), 0, 8);
+}
+
+inline void finalize_75919cb3423249cf ( Context * __context__, struct _lambda_thismodule_90_14_11 &  ____this_rename_at_90 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),__context__);
+	memset(&(____this_rename_at_90), 0, 40);
+}
+
+inline void finalize_cfd3426561e2e7e5 ( Context * __context__, struct _lambda_thismodule_91_25_27 &  ____this_rename_at_91 )
+{
+	memset(&(____this_rename_at_91), 0, 8);
+}
+
+inline void finalize_6eaa1c4f569102fc ( Context * __context__, struct _lambda_thismodule_92_36_32 &  ____this_rename_at_92 )
+{
+	memset(&(____this_rename_at_92), 0, 8);
+}
+
+inline void finalize_cdc2fc53315b9882 ( Context * __context__, struct _lambda_thismodule_93_29_35 &  ____this_rename_at_93 )
+{
+	memset(&(____this_rename_at_93), 0, 8);
+}
+
+inline void finalize_96301ec05baef2f5 ( Context * __context__, struct _lambda_thismodule_9_12_20 &  ____this_rename_at_9 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),__context__);
+	memset(&(____this_rename_at_9), 0, 56);
+}
+
+inline void finalize_4b0e4cd0a7164aae ( Context * __context__, struct _lambda_thismodule_9_12_21 &  ____this_rename_at_9 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_9._source_0_at_9),__context__);
+	memset(&(____this_rename_at_9), 0, 64);
+}
+
+inline bool _Funcfunctional_0x60_all_29a13565b52eb7db ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  __it_rename_at_100 )
+{
+	{
+		bool __need_loop_105 = true;
+		// x : bool const
+		das_iterator<Sequence DAS_COMMENT((bool)) const > __x_iterator(__it_rename_at_100);
+		bool __x_rename_at_105;
+		__need_loop_105 = __x_iterator.first(__context__,(__x_rename_at_105)) && __need_loop_105;
+		for ( ; __need_loop_105 ; __need_loop_105 = __x_iterator.next(__context__,(__x_rename_at_105)) )
+		{
+			if ( !__x_rename_at_105 )
+			{
+				return false;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_105));
+	};
+	return true;
+}
+
+inline bool _Funcfunctional_0x60_any_dd77430c4ce8eb4b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  __it_rename_at_89 )
+{
+	{
+		bool __need_loop_94 = true;
+		// x : bool const
+		das_iterator<Sequence DAS_COMMENT((bool)) const > __x_iterator(__it_rename_at_89);
+		bool __x_rename_at_94;
+		__need_loop_94 = __x_iterator.first(__context__,(__x_rename_at_94)) && __need_loop_94;
+		for ( ; __need_loop_94 ; __need_loop_94 = __x_iterator.next(__context__,(__x_rename_at_94)) )
+		{
+			if ( __x_rename_at_94 )
+			{
+				return true;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_94));
+	};
+	return false;
+}
+
+inline bool _Funcfunctional_0x60_any_3b173b789b4d659 ( Context * __context__, TDim<bool,2> const  &  __it_rename_at_89 )
+{
+	{
+		bool __need_loop_94 = true;
+		// x : bool const&
+		das_iterator<TDim<bool,2> const > __x_iterator(__it_rename_at_89);
+		bool const  * __x_rename_at_94;
+		__need_loop_94 = __x_iterator.first(__context__,(__x_rename_at_94)) && __need_loop_94;
+		for ( ; __need_loop_94 ; __need_loop_94 = __x_iterator.next(__context__,(__x_rename_at_94)) )
+		{
+			if ( (*__x_rename_at_94) )
+			{
+				return true;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_94));
+	};
+	return false;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_count_f81ee374cce5540d ( Context * __context__, int32_t __start_rename_at_152, int32_t __step_rename_at_152 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,struct _lambda_thismodule_154_8_2>::make(__context__,&__type_info__16899671,(([&]() -> struct _lambda_thismodule_154_8_2 {
+		struct _lambda_thismodule_154_8_2 __mks_154;
+		das_copy((__mks_154.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_154_8_2`function _lambda_thismodule_154_8_2 int#ref*/ 1669496118u))));
+		das_copy((__mks_154.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_154_8_2`finazlier #ptr#_lambda_thismodule_154_8_2#explicit*/ 776514358u))));
+		das_copy((__mks_154.start),(__start_rename_at_152));
+		das_copy((__mks_154.step),(__step_rename_at_152));
+		return __mks_154;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_cycle_45ebe7337522428a ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_110 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_ref_dd8113899e5f9ac1(__context__,das_ascend<bool,struct _lambda_thismodule_125_12_29>::make(__context__,&__type_info__d8d67e29,(([&]() -> struct _lambda_thismodule_125_12_29 {
+		struct _lambda_thismodule_125_12_29 __mks_124;
+		das_zero(__mks_124);
+		das_copy((__mks_124.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_125_12_29`function _lambda_thismodule_125_12_29 #ptr##array#int#ref*/ 1844362689u))));
+		das_copy((__mks_124.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_125_12_29`finazlier #ptr#_lambda_thismodule_125_12_29#explicit*/ 3719397158u))));
+		das_move((__mks_124.src),(__src_rename_at_110));
+		return __mks_124;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_cycle_afb4461f9fcee246 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  __src_rename_at_110 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_ref_ddfd027208f57be5(__context__,das_ascend<bool,struct _lambda_thismodule_125_12_28>::make(__context__,&__type_info__d7d67c96,(([&]() -> struct _lambda_thismodule_125_12_28 {
+		struct _lambda_thismodule_125_12_28 __mks_124;
+		das_zero(__mks_124);
+		das_copy((__mks_124.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_125_12_28`function _lambda_thismodule_125_12_28 #ptr##tuple#int#float#ref*/ 558609799u))));
+		das_copy((__mks_124.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_125_12_28`finazlier #ptr#_lambda_thismodule_125_12_28#explicit*/ 3458565086u))));
+		das_move((__mks_124.src),(__src_rename_at_110));
+		return __mks_124;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_cycle_8be75c6ab4e4f342 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_110 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,struct _lambda_thismodule_113_12_19>::make(__context__,&__type_info__d7010bfb,(([&]() -> struct _lambda_thismodule_113_12_19 {
+		struct _lambda_thismodule_113_12_19 __mks_112;
+		das_zero(__mks_112);
+		das_copy((__mks_112.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_113_12_19`function _lambda_thismodule_113_12_19 int#ref*/ 2804859950u))));
+		das_copy((__mks_112.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_113_12_19`finazlier #ptr#_lambda_thismodule_113_12_19#explicit*/ 1487758438u))));
+		das_move((__mks_112.src),(__src_rename_at_110));
+		return __mks_112;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_9c5c2ea0768c39c0 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_20, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  __blk_rename_at_20 )
+{
+	return /* <- */ _Funcfunctional_0x60_filter_any_121721b2e08eefc9(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_20),__blk_rename_at_20);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_9ac4a2626818601d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_24, Func DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_24 )
+{
+	return /* <- */ _Funcfunctional_0x60_filter_any_6eb8df991750122c(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_24),__blk_rename_at_24);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_29a3b3a7512b71f5 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_20, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_20 )
+{
+	return /* <- */ _Funcfunctional_0x60_filter_any_93484a24b323592f(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_20),__blk_rename_at_20);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_any_121721b2e08eefc9 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_6, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) __blk_rename_at_6 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_ref_dd8113899e5f9ac1(__context__,das_ascend<bool,struct _lambda_thismodule_15_12_30>::make(__context__,&__type_info__ad459a25,(([&]() -> struct _lambda_thismodule_15_12_30 {
+		struct _lambda_thismodule_15_12_30 __mks_14;
+		das_zero(__mks_14);
+		das_copy((__mks_14.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_15_12_30`function _lambda_thismodule_15_12_30 #ptr##array#int#ref*/ 1939939209u))));
+		das_copy((__mks_14.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_15_12_30`finazlier #ptr#_lambda_thismodule_15_12_30#explicit*/ 1196572190u))));
+		das_move((__mks_14.blk),(__blk_rename_at_6));
+		das_move((__mks_14.src),(__src_rename_at_6));
+		return __mks_14;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_6eb8df991750122c ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_6, Func DAS_COMMENT((bool,int32_t)) __blk_rename_at_6 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,struct _lambda_thismodule_9_12_20>::make(__context__,&__type_info__db3d6827,(([&]() -> struct _lambda_thismodule_9_12_20 {
+		struct _lambda_thismodule_9_12_20 __mks_8;
+		das_zero(__mks_8);
+		das_copy((__mks_8.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_12_20`function _lambda_thismodule_9_12_20 int#ref*/ 3246385670u))));
+		das_copy((__mks_8.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_12_20`finazlier #ptr#_lambda_thismodule_9_12_20#explicit*/ 3478410934u))));
+		das_move((__mks_8.blk),(__blk_rename_at_6));
+		das_move((__mks_8.src),(__src_rename_at_6));
+		return __mks_8;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_93484a24b323592f ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_6, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_6 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,struct _lambda_thismodule_9_12_21>::make(__context__,&__type_info__da3d6694,(([&]() -> struct _lambda_thismodule_9_12_21 {
+		struct _lambda_thismodule_9_12_21 __mks_8;
+		das_zero(__mks_8);
+		das_copy((__mks_8.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_12_21`function _lambda_thismodule_9_12_21 int#ref*/ 4224269454u))));
+		das_copy((__mks_8.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_12_21`finazlier #ptr#_lambda_thismodule_9_12_21#explicit*/ 912118914u))));
+		das_move((__mks_8.blk),(__blk_rename_at_6));
+		das_move((__mks_8.src),(__src_rename_at_6));
+		return __mks_8;
+	})())));
+}
+
+inline bool _Funcfunctional_0x60_is_equal_6b49314146682bc8 ( Context * __context__, int32_t __a_rename_at_168, int32_t __b_rename_at_168 )
+{
+	return __a_rename_at_168 == __b_rename_at_168;
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_islice_1b238c444ec51e4d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_136, int32_t __start_rename_at_136, int32_t __stop_rename_at_136 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_ref_dd8113899e5f9ac1(__context__,das_ascend<bool,struct _lambda_thismodule_145_12_33>::make(__context__,&__type_info__3ab1fc7c,(([&]() -> struct _lambda_thismodule_145_12_33 {
+		struct _lambda_thismodule_145_12_33 __mks_144;
+		das_zero(__mks_144);
+		das_copy((__mks_144.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_145_12_33`function _lambda_thismodule_145_12_33 #ptr##array#int#ref*/ 364124977u))));
+		das_copy((__mks_144.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_145_12_33`finazlier #ptr#_lambda_thismodule_145_12_33#explicit*/ 1331340018u))));
+		das_move((__mks_144.src),(__src_rename_at_136));
+		das_copy((__mks_144.start),(__start_rename_at_136));
+		das_copy((__mks_144.stop),(__stop_rename_at_136));
+		return __mks_144;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_islice_eef73b9790d080de ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) &  __src_rename_at_136, int32_t __start_rename_at_136, int32_t __stop_rename_at_136 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_ref_ddfd027208f57be5(__context__,das_ascend<bool,struct _lambda_thismodule_145_12_31>::make(__context__,&__type_info__3cb1ffa2,(([&]() -> struct _lambda_thismodule_145_12_31 {
+		struct _lambda_thismodule_145_12_31 __mks_144;
+		das_zero(__mks_144);
+		das_copy((__mks_144.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_145_12_31`function _lambda_thismodule_145_12_31 #ptr##tuple#int#float#ref*/ 2710451967u))));
+		das_copy((__mks_144.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_145_12_31`finazlier #ptr#_lambda_thismodule_145_12_31#explicit*/ 1565398350u))));
+		das_move((__mks_144.src),(__src_rename_at_136));
+		das_copy((__mks_144.start),(__start_rename_at_136));
+		das_copy((__mks_144.stop),(__stop_rename_at_136));
+		return __mks_144;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_islice_f925e02743d56ac ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_136, int32_t __start_rename_at_136, int32_t __stop_rename_at_136 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,struct _lambda_thismodule_139_12_22>::make(__context__,&__type_info__76f93d21,(([&]() -> struct _lambda_thismodule_139_12_22 {
+		struct _lambda_thismodule_139_12_22 __mks_138;
+		das_zero(__mks_138);
+		das_copy((__mks_138.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_139_12_22`function _lambda_thismodule_139_12_22 int#ref*/ 2313055526u))));
+		das_copy((__mks_138.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_139_12_22`finazlier #ptr#_lambda_thismodule_139_12_22#explicit*/ 2217451350u))));
+		das_move((__mks_138.src),(__src_rename_at_136));
+		das_copy((__mks_138.start),(__start_rename_at_136));
+		das_copy((__mks_138.stop),(__stop_rename_at_136));
+		return __mks_138;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_4b03d8b25a9f7c5c ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_46, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  __blk_rename_at_46 )
+{
+	return /* <- */ _Funcfunctional_0x60_map_any_a6b26395efebfa79(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_46),__blk_rename_at_46);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_765ff0602dff4f41 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_46, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  __blk_rename_at_46 )
+{
+	return /* <- */ _Funcfunctional_0x60_map_any_fbc5e9f6cd4a2c3(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_46),__blk_rename_at_46);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_8c8dda3d30684686 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_50, Func DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_50 )
+{
+	return /* <- */ _Funcfunctional_0x60_map_any_42e49f214b3338ad(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_50),__blk_rename_at_50);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_65695f489097f839 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_46, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const  __blk_rename_at_46 )
+{
+	return /* <- */ _Funcfunctional_0x60_map_any_78804bc5438b4457(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_46),__blk_rename_at_46);
+}
+
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_6553bbb9d75fe927 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_46, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_46 )
+{
+	return /* <- */ _Funcfunctional_0x60_map_any_d6e273aa6b995622(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_46),__blk_rename_at_46);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_478dab29ef056fb6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_46, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_46 )
+{
+	return /* <- */ _Funcfunctional_0x60_map_any_c90db4847f0a8879(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_46),__blk_rename_at_46);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_a6b26395efebfa79 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_28, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) __blk_rename_at_28 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,struct _lambda_thismodule_31_12_36>::make(__context__,&__type_info__3a28fb9,(([&]() -> struct _lambda_thismodule_31_12_36 {
+		struct _lambda_thismodule_31_12_36 __mks_30;
+		das_zero(__mks_30);
+		das_copy((__mks_30.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_36`function _lambda_thismodule_31_12_36 int#ref*/ 1633247414u))));
+		das_copy((__mks_30.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_36`finazlier #ptr#_lambda_thismodule_31_12_36#explicit*/ 3156167302u))));
+		das_move((__mks_30.blk),(__blk_rename_at_28));
+		das_move((__mks_30.src),(__src_rename_at_28));
+		return __mks_30;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_any_fbc5e9f6cd4a2c3 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_28, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) __blk_rename_at_28 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_69d7e7bb51ea3de6(__context__,das_ascend<bool,struct _lambda_thismodule_36_12_34>::make(__context__,&__type_info__5b038296,(([&]() -> struct _lambda_thismodule_36_12_34 {
+		struct _lambda_thismodule_36_12_34 __mks_35;
+		das_zero(__mks_35);
+		das_copy((__mks_35.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_36_12_34`function _lambda_thismodule_36_12_34 #array#int*/ 4111751261u))));
+		das_copy((__mks_35.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_36_12_34`finazlier #ptr#_lambda_thismodule_36_12_34#explicit*/ 4273422300u))));
+		das_move((__mks_35.blk),(__blk_rename_at_28));
+		das_move((__mks_35.src),(__src_rename_at_28));
+		return __mks_35;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_42e49f214b3338ad ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_28, Func DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_28 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,struct _lambda_thismodule_31_12_23>::make(__context__,&__type_info__fea04943,(([&]() -> struct _lambda_thismodule_31_12_23 {
+		struct _lambda_thismodule_31_12_23 __mks_30;
+		das_zero(__mks_30);
+		das_copy((__mks_30.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_23`function _lambda_thismodule_31_12_23 int#ref*/ 3891345850u))));
+		das_copy((__mks_30.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_23`finazlier #ptr#_lambda_thismodule_31_12_23#explicit*/ 3665198858u))));
+		das_move((__mks_30.blk),(__blk_rename_at_28));
+		das_move((__mks_30.src),(__src_rename_at_28));
+		return __mks_30;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_any_78804bc5438b4457 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_28, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) __blk_rename_at_28 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_ba1451246e410d44(__context__,das_ascend<bool,struct _lambda_thismodule_31_12_26>::make(__context__,&__type_info__1a04dfc,(([&]() -> struct _lambda_thismodule_31_12_26 {
+		struct _lambda_thismodule_31_12_26 __mks_30;
+		das_zero(__mks_30);
+		das_copy((__mks_30.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_26`function _lambda_thismodule_31_12_26 #tuple#int#float*/ 4042642767u))));
+		das_copy((__mks_30.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_26`finazlier #ptr#_lambda_thismodule_31_12_26#explicit*/ 3913553140u))));
+		das_move((__mks_30.blk),(__blk_rename_at_28));
+		das_move((__mks_30.src),(__src_rename_at_28));
+		return __mks_30;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_any_d6e273aa6b995622 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_28, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_28 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_73dbf68872e28f81(__context__,das_ascend<bool,struct _lambda_thismodule_31_12_24>::make(__context__,&__type_info__3a05122,(([&]() -> struct _lambda_thismodule_31_12_24 {
+		struct _lambda_thismodule_31_12_24 __mks_30;
+		das_zero(__mks_30);
+		das_copy((__mks_30.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_24`function _lambda_thismodule_31_12_24 bool#ref*/ 2142022623u))));
+		das_copy((__mks_30.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_24`finazlier #ptr#_lambda_thismodule_31_12_24#explicit*/ 3238111356u))));
+		das_move((__mks_30.blk),(__blk_rename_at_28));
+		das_move((__mks_30.src),(__src_rename_at_28));
+		return __mks_30;
+	})())));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_c90db4847f0a8879 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_28, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_28 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,struct _lambda_thismodule_31_12_25>::make(__context__,&__type_info__4a052b5,(([&]() -> struct _lambda_thismodule_31_12_25 {
+		struct _lambda_thismodule_31_12_25 __mks_30;
+		das_zero(__mks_30);
+		das_copy((__mks_30.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_25`function _lambda_thismodule_31_12_25 int#ref*/ 3256490614u))));
+		das_copy((__mks_30.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_31_12_25`finazlier #ptr#_lambda_thismodule_31_12_25#explicit*/ 2287833214u))));
+		das_move((__mks_30.blk),(__blk_rename_at_28));
+		das_move((__mks_30.src),(__src_rename_at_28));
+		return __mks_30;
+	})())));
+}
+
+inline bool _Funcfunctional_0x60_not_62fd3e2cf8622aee ( Context * __context__, bool __x_rename_at_174 )
+{
+	return !__x_rename_at_174;
+}
+
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_8a228425c3a12cf0 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __it_rename_at_77, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  __blk_rename_at_77 )
+{
+	return _Funcfunctional_0x60_reduce_any_bd042ec2d83b8d49(__context__,__it_rename_at_77,__blk_rename_at_77);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_fe50d9841ab82207 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_77, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __blk_rename_at_77 )
+{
+	return _Funcfunctional_0x60_reduce_any_51d9e1545f1073ee(__context__,__it_rename_at_77,__blk_rename_at_77);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_abe6e78b2b662e9 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_73, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_73 )
+{
+	return _Funcfunctional_0x60_reduce_any_c1597e64f62c4a9d(__context__,__it_rename_at_73,__blk_rename_at_73);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_cb178b30ab4da07 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_69, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_69 )
+{
+	return _Funcfunctional_0x60_reduce_any_6c02eae7c8fa51a7(__context__,__it_rename_at_69,__blk_rename_at_69);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_7a6bb0d6853a5308 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_77, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __blk_rename_at_77 )
+{
+	return _Funcfunctional_0x60_reduce_any_aedc21539e3b4419(__context__,__it_rename_at_77,__blk_rename_at_77);
+}
+
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_any_bd042ec2d83b8d49 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __it_rename_at_55, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  __functor_rename_at_55 )
+{
+	TTuple<8,int32_t,float> __left_rename_at_56; das_zero(__left_rename_at_56);
+	bool __first_rename_at_57 = true;
+	{
+		bool __need_loop_58 = true;
+		// right : tuple<int;float> aka TT const
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __right_iterator(__it_rename_at_55);
+		TTuple<8,int32_t,float> const  __right_rename_at_58;
+		__need_loop_58 = __right_iterator.first(__context__,(__right_rename_at_58)) && __need_loop_58;
+		for ( ; __need_loop_58 ; __need_loop_58 = __right_iterator.next(__context__,(__right_rename_at_58)) )
+		{
+			if ( __first_rename_at_57 )
+			{
+				das_copy(__first_rename_at_57,false);
+				das_copy(__left_rename_at_56,__right_rename_at_58);
+			} else {
+				das_copy(__left_rename_at_56,das_invoke<TTuple<8,int32_t,float> const >::invoke_cmres<TTuple<8,int32_t,float> &,TTuple<8,int32_t,float> const  &>(__context__,__functor_rename_at_55,das_arg<TTuple<8,int32_t,float>>::pass(__left_rename_at_56),__right_rename_at_58));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_58));
+	};
+	if ( __first_rename_at_57 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return __left_rename_at_56;
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_51d9e1545f1073ee ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_55, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __functor_rename_at_55 )
+{
+	int32_t __left_rename_at_56 = 0;
+	bool __first_rename_at_57 = true;
+	{
+		bool __need_loop_58 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_55);
+		int32_t __right_rename_at_58;
+		__need_loop_58 = __right_iterator.first(__context__,(__right_rename_at_58)) && __need_loop_58;
+		for ( ; __need_loop_58 ; __need_loop_58 = __right_iterator.next(__context__,(__right_rename_at_58)) )
+		{
+			if ( __first_rename_at_57 )
+			{
+				das_copy(__first_rename_at_57,false);
+				das_copy(__left_rename_at_56,__right_rename_at_58);
+			} else {
+				das_copy(__left_rename_at_56,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,__functor_rename_at_55,__left_rename_at_56,__right_rename_at_58));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_58));
+	};
+	if ( __first_rename_at_57 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return __left_rename_at_56;
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_c1597e64f62c4a9d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_55, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_55 )
+{
+	int32_t __left_rename_at_56 = 0;
+	bool __first_rename_at_57 = true;
+	{
+		bool __need_loop_58 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_55);
+		int32_t __right_rename_at_58;
+		__need_loop_58 = __right_iterator.first(__context__,(__right_rename_at_58)) && __need_loop_58;
+		for ( ; __need_loop_58 ; __need_loop_58 = __right_iterator.next(__context__,(__right_rename_at_58)) )
+		{
+			if ( __first_rename_at_57 )
+			{
+				das_copy(__first_rename_at_57,false);
+				das_copy(__left_rename_at_56,__right_rename_at_58);
+			} else {
+				das_copy(__left_rename_at_56,das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,__functor_rename_at_55,__left_rename_at_56,__right_rename_at_58));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_58));
+	};
+	if ( __first_rename_at_57 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return __left_rename_at_56;
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_6c02eae7c8fa51a7 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_55, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_55 )
+{
+	int32_t __left_rename_at_56 = 0;
+	bool __first_rename_at_57 = true;
+	{
+		bool __need_loop_58 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_55);
+		int32_t __right_rename_at_58;
+		__need_loop_58 = __right_iterator.first(__context__,(__right_rename_at_58)) && __need_loop_58;
+		for ( ; __need_loop_58 ; __need_loop_58 = __right_iterator.next(__context__,(__right_rename_at_58)) )
+		{
+			if ( __first_rename_at_57 )
+			{
+				das_copy(__first_rename_at_57,false);
+				das_copy(__left_rename_at_56,__right_rename_at_58);
+			} else {
+				das_copy(__left_rename_at_56,das_invoke_lambda<int32_t>::invoke<int32_t,int32_t>(__context__,__functor_rename_at_55,__left_rename_at_56,__right_rename_at_58));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_58));
+	};
+	if ( __first_rename_at_57 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return __left_rename_at_56;
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_aedc21539e3b4419 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_55, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __functor_rename_at_55 )
+{
+	int32_t __left_rename_at_56 = 0;
+	bool __first_rename_at_57 = true;
+	{
+		bool __need_loop_58 = true;
+		// right : int aka TT const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const )) const > __right_iterator(__it_rename_at_55);
+		int32_t const  * __right_rename_at_58;
+		__need_loop_58 = __right_iterator.first(__context__,(__right_rename_at_58)) && __need_loop_58;
+		for ( ; __need_loop_58 ; __need_loop_58 = __right_iterator.next(__context__,(__right_rename_at_58)) )
+		{
+			if ( __first_rename_at_57 )
+			{
+				das_copy(__first_rename_at_57,false);
+				das_copy(__left_rename_at_56,(*__right_rename_at_58));
+			} else {
+				das_copy(__left_rename_at_56,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,__functor_rename_at_55,__left_rename_at_56,(*__right_rename_at_58)));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_58));
+	};
+	if ( __first_rename_at_57 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return __left_rename_at_56;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_repeat_66c37a2d9ef2191d ( Context * __context__, int32_t __value_rename_at_159, int32_t __count_rename_at_159 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,struct _lambda_thismodule_161_8_3>::make(__context__,&__type_info__b42f8ab2,(([&]() -> struct _lambda_thismodule_161_8_3 {
+		struct _lambda_thismodule_161_8_3 __mks_160;
+		das_zero(__mks_160);
+		das_copy((__mks_160.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_161_8_3`function _lambda_thismodule_161_8_3 int#ref#explicit*/ 1736029379u))));
+		das_copy((__mks_160.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_161_8_3`finazlier #ptr#_lambda_thismodule_161_8_3#explicit*/ 1080293070u))));
+		das_copy((__mks_160.count),(__count_rename_at_159));
+		das_copy((__mks_160.value),(__value_rename_at_159));
+		return __mks_160;
+	})())));
+}
+
+inline int32_t _Funcfunctional_0x60_sum_ea2762a9b6c828a6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_82 )
+{
+	int32_t __temp_rename_at_83 = 0;
+	{
+		bool __need_loop_84 = true;
+		// x : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__it_rename_at_82);
+		int32_t __x_rename_at_84;
+		__need_loop_84 = __x_iterator.first(__context__,(__x_rename_at_84)) && __need_loop_84;
+		for ( ; __need_loop_84 ; __need_loop_84 = __x_iterator.next(__context__,(__x_rename_at_84)) )
+		{
+			__temp_rename_at_83 += __x_rename_at_84;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_84));
+	};
+	return __temp_rename_at_83;
+}
+
+inline bool is_even_6d9eabfbf704f1dc ( Context * __context__, int32_t __x_rename_at_9 )
+{
+	return (SimPolicy<int32_t>::Mod(__x_rename_at_9,2,*__context__)) == 0;
+}
+
+inline bool test_eefa0ae5aee396ca ( Context * __context__ ) { das_stack_prologue __prologue(__context__,1728,"test " DAS_FILE_LINE);
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_50_32;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_56_208;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_64_432;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_63_448;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_71_464;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_70_480;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_78_512;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_77_528;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_85_544;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_84_560;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_93_592;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_92_608;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_91_624;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_90_640;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_99_720;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_106_800;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_114_896;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_122_928;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_130_944;
+	TTuple<8,int32_t,float> _temp_make_local_140_960;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_139_976;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_138_992;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_148_1104;
+	TDim<bool,2> _temp_make_local_155_1120;
+	Sequence DAS_COMMENT((bool)) _temp_make_local_163_1136;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_162_1152;
+	Sequence DAS_COMMENT((bool)) _temp_make_local_172_1184;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_171_1200;
+	Sequence DAS_COMMENT((bool)) _temp_make_local_180_1232;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_179_1248;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_191_1280;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_190_1296;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_199_1312;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_198_1328;
+	TArray<int32_t> _temp_make_local_208_1344;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_207_1376;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_206_1392;
+	TArray<int32_t> _temp_make_local_216_1408;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_215_1440;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_226_1456;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_225_1472;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_224_1488;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_227_1504;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_234_1536;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_233_1552;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_232_1568;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_235_1600;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_242_1632;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_241_1648;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_240_1664;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_243_1696;
+	_Func_0x60_verify_even_bb494c9a7d66151f(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_50_32 = (_Funcbuiltin_0x60_each_ref_576a75d40473b6b2(__context__,das_ascend<bool,struct _lambda_thismodule_50_23_4>::make(__context__,&__type_info__df321397,(([&]() -> struct _lambda_thismodule_50_23_4 {
+		struct _lambda_thismodule_50_23_4 __mks_50;
+		das_zero(__mks_50);
+		das_copy((__mks_50.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_50_23_4`function _lambda_thismodule_50_23_4 #ptr#int#const#ref*/ 750696070u))));
+		das_copy((__mks_50.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_50_23_4`finazlier #ptr#_lambda_thismodule_50_23_4#explicit*/ 236906326u))));
+		return __mks_50;
+	})())))))));
+	_Func_0x60_verify_even_8835d561dd20d47(__context__,das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_53_rename_at_53; das_zero(____acomp_53_rename_at_53);
+		{
+			bool __need_loop_53 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,100));
+			int32_t __x_rename_at_53;
+			__need_loop_53 = __x_iterator.first(__context__,(__x_rename_at_53)) && __need_loop_53;
+			for ( ; __need_loop_53 ; __need_loop_53 = __x_iterator.next(__context__,(__x_rename_at_53)) )
+			{
+				if ( (SimPolicy<int32_t>::Mod(__x_rename_at_53,2,*__context__)) == 0 )
+				{
+					_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_53_rename_at_53),__x_rename_at_53,-1);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_53));
+		};
+		return /* <- */ ____acomp_53_rename_at_53;
+	})));
+	_Func_0x60_verify_14_ccaf1183e323809f(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_56_208 = (_Funcbuiltin_0x60_each_69d7e7bb51ea3de6(__context__,das_ascend<bool,struct _lambda_thismodule_56_21_10>::make(__context__,&__type_info__63564868,(([&]() -> struct _lambda_thismodule_56_21_10 {
+		struct _lambda_thismodule_56_21_10 __mks_56;
+		das_zero(__mks_56);
+		das_copy((__mks_56.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_56_21_10`function _lambda_thismodule_56_21_10 #array#int*/ 4255920945u))));
+		das_copy((__mks_56.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_56_21_10`finazlier #ptr#_lambda_thismodule_56_21_10#explicit*/ 1030389160u))));
+		return __mks_56;
+	})())))))));
+	_Func_0x60_verify_14_35b8308b990b4b30(__context__,das_arg<TArray<TArray<int32_t>>>::pass(das_invoke<TArray<TArray<int32_t>>>::invoke_cmres(__context__,[&]()->TArray<TArray<int32_t>>{
+		TArray<TArray<int32_t>> ____acomp_59_rename_at_59; das_zero(____acomp_59_rename_at_59);
+		_Funcbuiltin_0x60_reserve_96529fa671b59898(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____acomp_59_rename_at_59),3);
+		{
+			bool __need_loop_59 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(1,4));
+			int32_t __x_rename_at_59;
+			__need_loop_59 = __x_iterator.first(__context__,(__x_rename_at_59)) && __need_loop_59;
+			for ( ; __need_loop_59 ; __need_loop_59 = __x_iterator.next(__context__,(__x_rename_at_59)) )
+			{
+				TArray<int32_t> _temp_make_local_59_384;
+				TDim<int32_t,2> _temp_make_local_59_416;
+				_Funcbuiltin_0x60_emplace_9b7538bf247950b8(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____acomp_59_rename_at_59),das_arg<TArray<int32_t>>::pass((_temp_make_local_59_384 = (_Funcbuiltin_0x60_to_array_move_2214fb125fb27d05(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+					_temp_make_local_59_416(0,__context__) = __x_rename_at_59;
+					_temp_make_local_59_416(1,__context__) = 2;
+					return _temp_make_local_59_416;
+				})())))))),-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_59));
+		};
+		return /* <- */ ____acomp_59_rename_at_59;
+	})));
+	_Func_0x60_verify_even_6078037029e38486(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_64_432 = (_Funcfunctional_0x60_filter_9ac4a2626818601d(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_63_448 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,100))))),Func(__context__->fnIdxByMangledName(/*is_even int#const*/ 3379734375u)))))));
+	_Func_0x60_verify_even_6078037029e38486(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_71_464 = (_Funcfunctional_0x60_filter_29a3b3a7512b71f5(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_70_480 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,100))))),das_ascend<bool,struct _lambda_thismodule_71_25_14>::make(__context__,&__type_info__34f42543,(([&]() -> struct _lambda_thismodule_71_25_14 {
+		struct _lambda_thismodule_71_25_14 __mks_71;
+		das_copy((__mks_71.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_71_25_14`function _lambda_thismodule_71_25_14 int#const*/ 4064535644u))));
+		das_copy((__mks_71.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_71_25_14`finazlier #ptr#_lambda_thismodule_71_25_14#explicit*/ 2742810434u))));
+		return __mks_71;
+	})())))))));
+	_Func_0x60_verify_even_6078037029e38486(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_78_512 = (_Funcfunctional_0x60_map_8c8dda3d30684686(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_77_528 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,50))))),Func(__context__->fnIdxByMangledName(/*twice int#const*/ 3225769558u)))))));
+	_Func_0x60_verify_even_6078037029e38486(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_85_544 = (_Funcfunctional_0x60_map_478dab29ef056fb6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_84_560 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,50))))),das_ascend<int32_t,struct _lambda_thismodule_85_28_1>::make(__context__,&__type_info__4f1f8183,(([&]() -> struct _lambda_thismodule_85_28_1 {
+		struct _lambda_thismodule_85_28_1 __mks_85;
+		das_copy((__mks_85.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_85_28_1`function _lambda_thismodule_85_28_1 int#const*/ 3418484276u))));
+		das_copy((__mks_85.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_85_28_1`finazlier #ptr#_lambda_thismodule_85_28_1#explicit*/ 2192713426u))));
+		return __mks_85;
+	})())))))));
+	_Func_0x60_verify_even_6078037029e38486(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_93_592 = (_Funcfunctional_0x60_map_4b03d8b25a9f7c5c(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_92_608 = (_Funcfunctional_0x60_map_765ff0602dff4f41(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_91_624 = (_Funcfunctional_0x60_filter_9c5c2ea0768c39c0(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_90_640 = (_Funcbuiltin_0x60_each_69d7e7bb51ea3de6(__context__,das_ascend<bool,struct _lambda_thismodule_90_14_11>::make(__context__,&__type_info__34ea7395,(([&]() -> struct _lambda_thismodule_90_14_11 {
+		struct _lambda_thismodule_90_14_11 __mks_90;
+		das_zero(__mks_90);
+		das_copy((__mks_90.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_90_14_11`function _lambda_thismodule_90_14_11 #array#int*/ 2190446071u))));
+		das_copy((__mks_90.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_90_14_11`finazlier #ptr#_lambda_thismodule_90_14_11#explicit*/ 1882412862u))));
+		return __mks_90;
+	})())))))),das_ascend<bool,struct _lambda_thismodule_91_25_27>::make(__context__,&__type_info__1983f0e3,(([&]() -> struct _lambda_thismodule_91_25_27 {
+		struct _lambda_thismodule_91_25_27 __mks_91;
+		das_copy((__mks_91.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_91_25_27`function _lambda_thismodule_91_25_27 #array#int#const*/ 4212962167u))));
+		das_copy((__mks_91.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_91_25_27`finazlier #ptr#_lambda_thismodule_91_25_27#explicit*/ 836161950u))));
+		return __mks_91;
+	})())))))),das_ascend<TArray<int32_t>,struct _lambda_thismodule_92_36_32>::make(__context__,&__type_info__fc8e246c,(([&]() -> struct _lambda_thismodule_92_36_32 {
+		struct _lambda_thismodule_92_36_32 __mks_92;
+		das_copy((__mks_92.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_92_36_32`function _lambda_thismodule_92_36_32 #array#int#const*/ 734032057u))));
+		das_copy((__mks_92.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_92_36_32`finazlier #ptr#_lambda_thismodule_92_36_32#explicit*/ 1584073180u))));
+		return __mks_92;
+	})())))))),das_ascend<int32_t,struct _lambda_thismodule_93_29_35>::make(__context__,&__type_info__8dc06b9a,(([&]() -> struct _lambda_thismodule_93_29_35 {
+		struct _lambda_thismodule_93_29_35 __mks_93;
+		das_copy((__mks_93.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_93_29_35`function _lambda_thismodule_93_29_35 #array#int#const*/ 3396376833u))));
+		das_copy((__mks_93.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_93_29_35`finazlier #ptr#_lambda_thismodule_93_29_35#explicit*/ 455764308u))));
+		return __mks_93;
+	})())))))));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,_Funcfunctional_0x60_reduce_fe50d9841ab82207(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_99_720 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_make_block<int32_t,int32_t,int32_t>(__context__,784,0,&__func_info__2e807d1c,[&](int32_t const  __x_rename_at_100, int32_t const  __y_rename_at_100)->int32_t{
+		return __x_rename_at_100 + __y_rename_at_100;
+	})),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,_Funcfunctional_0x60_reduce_7a6bb0d6853a5308(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_106_800 = (_Funcbuiltin_0x60_each_ref_576a75d40473b6b2(__context__,das_ascend<bool,struct _lambda_thismodule_106_15_5>::make(__context__,&__type_info__fc05925b,(([&]() -> struct _lambda_thismodule_106_15_5 {
+		struct _lambda_thismodule_106_15_5 __mks_106;
+		das_zero(__mks_106);
+		das_copy((__mks_106.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_106_15_5`function _lambda_thismodule_106_15_5 #ptr#int#const#ref*/ 3363015182u))));
+		das_copy((__mks_106.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_106_15_5`finazlier #ptr#_lambda_thismodule_106_15_5#explicit*/ 536118726u))));
+		return __mks_106;
+	})())))))),das_make_block<int32_t,int32_t,int32_t>(__context__,880,0,&__func_info__2e807d1c,[&](int32_t const  __x_rename_at_107, int32_t const  __y_rename_at_107)->int32_t{
+		return __x_rename_at_107 + __y_rename_at_107;
+	})),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,_Funcfunctional_0x60_reduce_cb178b30ab4da07(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_114_896 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_ascend<int32_t,struct _lambda_thismodule_115_27_15>::make(__context__,&__type_info__3bc97285,(([&]() -> struct _lambda_thismodule_115_27_15 {
+		struct _lambda_thismodule_115_27_15 __mks_115;
+		das_copy((__mks_115.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_115_27_15`function _lambda_thismodule_115_27_15 int#const int#const*/ 1418617037u))));
+		das_copy((__mks_115.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_115_27_15`finazlier #ptr#_lambda_thismodule_115_27_15#explicit*/ 455341414u))));
+		return __mks_115;
+	})()))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,_Funcfunctional_0x60_reduce_abe6e78b2b662e9(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_122_928 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),Func(__context__->fnIdxByMangledName(/*add int#const int#const*/ 3151545828u))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,_Funcfunctional_0x60_reduce_abe6e78b2b662e9(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_130_944 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(45,46))))),Func(__context__->fnIdxByMangledName(/*add int#const int#const*/ 3151545828u))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,_Func_0x60_first_fc2232d3c243ca99(__context__,das_arg<TTuple<8,int32_t,float>>::pass((_temp_make_local_140_960 = (_Funcfunctional_0x60_reduce_8a228425c3a12cf0(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_139_976 = (_Funcfunctional_0x60_map_65695f489097f839(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_138_992 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_ascend<TTuple<8,int32_t,float>,struct _lambda_thismodule_139_28_6>::make(__context__,&__type_info__a969907c,(([&]() -> struct _lambda_thismodule_139_28_6 {
+		struct _lambda_thismodule_139_28_6 __mks_139;
+		das_copy((__mks_139.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_139_28_6`function _lambda_thismodule_139_28_6 int#const*/ 2036236810u))));
+		das_copy((__mks_139.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_139_28_6`finazlier #ptr#_lambda_thismodule_139_28_6#explicit*/ 2627051912u))));
+		return __mks_139;
+	})())))))),das_make_block_cmres<TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const  &,TTuple<8,int32_t,float> const  &>(__context__,1072,0,&__func_info__56461723,[&](TTuple<8,int32_t,float> const  & __x_rename_at_140, TTuple<8,int32_t,float> const  & __y_rename_at_140)->TTuple<8,int32_t,float> const {
+		return (([&]() -> TTuple<8,int32_t,float> {
+			TTuple<8,int32_t,float> __mkt_140;
+			das_get_tuple_field<int32_t,0>::get(__mkt_140) = (das_get_tuple_field<int32_t,0>::get(__x_rename_at_140) + das_get_tuple_field<int32_t,0>::get(__y_rename_at_140));
+			das_get_tuple_field<float,4>::get(__mkt_140) = 2.f;
+			return __mkt_140;
+		})());
+	})))))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,_Funcfunctional_0x60_sum_ea2762a9b6c828a6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_148_1104 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_any_3b173b789b4d659(__context__,das_arg<TDim<bool,2>>::pass((([&]() -> TDim<bool,2>& {
+		_temp_make_local_155_1120(0,__context__) = true;
+		_temp_make_local_155_1120(1,__context__) = false;
+		return _temp_make_local_155_1120;
+	})())))));
+	DAS_VERIFY((_Funcfunctional_0x60_not_62fd3e2cf8622aee(__context__,_Funcfunctional_0x60_any_dd77430c4ce8eb4b(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_163_1136 = (_Funcfunctional_0x60_map_6553bbb9d75fe927(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_162_1152 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_ascend<bool,struct _lambda_thismodule_163_30_16>::make(__context__,&__type_info__45839f1,(([&]() -> struct _lambda_thismodule_163_30_16 {
+		struct _lambda_thismodule_163_30_16 __mks_163;
+		das_copy((__mks_163.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_163_30_16`function _lambda_thismodule_163_30_16 int#const*/ 2767717920u))));
+		das_copy((__mks_163.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_163_30_16`finazlier #ptr#_lambda_thismodule_163_30_16#explicit*/ 3072537446u))));
+		return __mks_163;
+	})()))))))))));
+	DAS_VERIFY((_Funcfunctional_0x60_all_29a13565b52eb7db(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_172_1184 = (_Funcfunctional_0x60_map_6553bbb9d75fe927(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_171_1200 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_ascend<bool,struct _lambda_thismodule_172_30_17>::make(__context__,&__type_info__e09ef0a0,(([&]() -> struct _lambda_thismodule_172_30_17 {
+		struct _lambda_thismodule_172_30_17 __mks_172;
+		das_copy((__mks_172.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_172_30_17`function _lambda_thismodule_172_30_17 int#const*/ 1389251100u))));
+		das_copy((__mks_172.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_172_30_17`finazlier #ptr#_lambda_thismodule_172_30_17#explicit*/ 51605350u))));
+		return __mks_172;
+	})())))))))));
+	DAS_VERIFY((_Funcfunctional_0x60_not_62fd3e2cf8622aee(__context__,_Funcfunctional_0x60_all_29a13565b52eb7db(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_180_1232 = (_Funcfunctional_0x60_map_6553bbb9d75fe927(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_179_1248 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_ascend<bool,struct _lambda_thismodule_180_30_18>::make(__context__,&__type_info__d238d5a8,(([&]() -> struct _lambda_thismodule_180_30_18 {
+		struct _lambda_thismodule_180_30_18 __mks_180;
+		das_copy((__mks_180.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_180_30_18`function _lambda_thismodule_180_30_18 int#const*/ 775482608u))));
+		das_copy((__mks_180.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_180_30_18`finazlier #ptr#_lambda_thismodule_180_30_18#explicit*/ 1043643394u))));
+		return __mks_180;
+	})()))))))))));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,_Funcfunctional_0x60_sum_ea2762a9b6c828a6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_191_1280 = (_Funcfunctional_0x60_islice_f925e02743d56ac(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_190_1296 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),1,4))))),6)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,_Funcfunctional_0x60_sum_ea2762a9b6c828a6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_199_1312 = (_Funcfunctional_0x60_islice_f925e02743d56ac(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_198_1328 = (_Funcfunctional_0x60_count_f81ee374cce5540d(__context__,0,10)))),0,10))))),450)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,builtin_array_size(das_arg<TArray<int32_t>>::pass((_temp_make_local_208_1344 = (_Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_207_1376 = (_Funcfunctional_0x60_islice_f925e02743d56ac(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_206_1392 = (_Funcfunctional_0x60_repeat_66c37a2d9ef2191d(__context__,10,0)))),0,5))))))))),5)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_6b49314146682bc8(__context__,builtin_array_size(das_arg<TArray<int32_t>>::pass((_temp_make_local_216_1408 = (_Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_215_1440 = (_Funcfunctional_0x60_repeat_66c37a2d9ef2191d(__context__,10,6))))))))),6)));
+	DAS_VERIFY((_Func_0x60_is_same_9afffff6294c0446(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_226_1456 = (_Funcfunctional_0x60_islice_f925e02743d56ac(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_225_1472 = (_Funcfunctional_0x60_cycle_8be75c6ab4e4f342(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_224_1488 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(1,4))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_227_1504 = (_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,struct _lambda_thismodule_227_19_7>::make(__context__,&__type_info__76b9d575,(([&]() -> struct _lambda_thismodule_227_19_7 {
+		struct _lambda_thismodule_227_19_7 __mks_227;
+		das_zero(__mks_227);
+		das_copy((__mks_227.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_227_19_7`function _lambda_thismodule_227_19_7 int#ref*/ 4238758950u))));
+		das_copy((__mks_227.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_227_19_7`finazlier #ptr#_lambda_thismodule_227_19_7#explicit*/ 3930856822u))));
+		return __mks_227;
+	})())))))))));
+	DAS_VERIFY((_Func_0x60_is_same_97c40271e1b9fd95(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_234_1536 = (_Funcfunctional_0x60_islice_eef73b9790d080de(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_233_1552 = (_Funcfunctional_0x60_cycle_afb4461f9fcee246(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_232_1568 = (_Funcbuiltin_0x60_each_ba1451246e410d44(__context__,das_ascend<bool,struct _lambda_thismodule_232_10_8>::make(__context__,&__type_info__636e62a1,(([&]() -> struct _lambda_thismodule_232_10_8 {
+		struct _lambda_thismodule_232_10_8 __mks_232;
+		das_zero(__mks_232);
+		das_copy((__mks_232.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_232_10_8`function _lambda_thismodule_232_10_8 #tuple#int#float*/ 4111723821u))));
+		das_copy((__mks_232.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_232_10_8`finazlier #ptr#_lambda_thismodule_232_10_8#explicit*/ 2522080934u))));
+		return __mks_232;
+	})())))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_235_1600 = (_Funcbuiltin_0x60_each_ba1451246e410d44(__context__,das_ascend<bool,struct _lambda_thismodule_235_18_9>::make(__context__,&__type_info__d27d2f5d,(([&]() -> struct _lambda_thismodule_235_18_9 {
+		struct _lambda_thismodule_235_18_9 __mks_235;
+		das_zero(__mks_235);
+		das_copy((__mks_235.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_235_18_9`function _lambda_thismodule_235_18_9 #tuple#int#float*/ 1552704661u))));
+		das_copy((__mks_235.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_235_18_9`finazlier #ptr#_lambda_thismodule_235_18_9#explicit*/ 1336584606u))));
+		return __mks_235;
+	})())))))))));
+	DAS_VERIFY((_Func_0x60_is_same_590802a3ad1ce37b(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_242_1632 = (_Funcfunctional_0x60_islice_1b238c444ec51e4d(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_241_1648 = (_Funcfunctional_0x60_cycle_45ebe7337522428a(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_240_1664 = (_Funcbuiltin_0x60_each_69d7e7bb51ea3de6(__context__,das_ascend<bool,struct _lambda_thismodule_240_10_12>::make(__context__,&__type_info__82115e6d,(([&]() -> struct _lambda_thismodule_240_10_12 {
+		struct _lambda_thismodule_240_10_12 __mks_240;
+		das_zero(__mks_240);
+		das_copy((__mks_240.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_240_10_12`function _lambda_thismodule_240_10_12 #array#int*/ 2903395623u))));
+		das_copy((__mks_240.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_240_10_12`finazlier #ptr#_lambda_thismodule_240_10_12#explicit*/ 596148886u))));
+		return __mks_240;
+	})())))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_243_1696 = (_Funcbuiltin_0x60_each_69d7e7bb51ea3de6(__context__,das_ascend<bool,struct _lambda_thismodule_243_18_13>::make(__context__,&__type_info__cf91711b,(([&]() -> struct _lambda_thismodule_243_18_13 {
+		struct _lambda_thismodule_243_18_13 __mks_243;
+		das_zero(__mks_243);
+		das_copy((__mks_243.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_243_18_13`function _lambda_thismodule_243_18_13 #array#int*/ 765802979u))));
+		das_copy((__mks_243.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_243_18_13`finazlier #ptr#_lambda_thismodule_243_18_13#explicit*/ 2716464154u))));
+		return __mks_243;
+	})())))))))));
+	return true;
+}}
+
+inline int32_t twice_c214784f6f367f97 ( Context * __context__, int32_t __x_rename_at_12 )
+{
+	return __x_rename_at_12 + __x_rename_at_12;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _FuncExclEqu_f4f0b94c8df92c7b
+		aotLib[0x8828ef4b4f57ec55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_FuncExclEqu_f4f0b94c8df92c7b>>();
+	};
+		// _FuncExclEqu_e106a056c753c270
+		aotLib[0xa537d8deca2d7ae5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTuple<8,int32_t,float> const  & , TTuple<8,int32_t,float> const  &  ),&_FuncExclEqu_e106a056c753c270>>();
+	};
+		// _Func_lambda_thismodule_106_15_5_0x60_finazlier_8ac6e00dd2aa8186
+		aotLib[0x2a9d5cc70f582199] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_106_15_5 *  ),&_Func_lambda_thismodule_106_15_5_0x60_finazlier_8ac6e00dd2aa8186>>();
+	};
+		// _Func_lambda_thismodule_106_15_5_0x60_function_5476edfb74ad5dc9
+		aotLib[0xbf5b861748dc2c4c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_106_15_5 & , int32_t const  * &  ),&_Func_lambda_thismodule_106_15_5_0x60_function_5476edfb74ad5dc9>>();
+	};
+		// _Func_lambda_thismodule_113_12_19_0x60_finazlier_bfacc70fdb974f9c
+		aotLib[0x5708070bb906f38e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_113_12_19 *  ),&_Func_lambda_thismodule_113_12_19_0x60_finazlier_bfacc70fdb974f9c>>();
+	};
+		// _Func_lambda_thismodule_113_12_19_0x60_function_befbad5a0b228273
+		aotLib[0xe2b199e49b6ee426] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_113_12_19 & , int32_t &  ),&_Func_lambda_thismodule_113_12_19_0x60_function_befbad5a0b228273>>();
+	};
+		// _Func_lambda_thismodule_115_27_15_0x60_finazlier_71e19767abe73d8a
+		aotLib[0x4efca65d5f645d38] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_115_27_15 *  ),&_Func_lambda_thismodule_115_27_15_0x60_finazlier_71e19767abe73d8a>>();
+	};
+		// _Func_lambda_thismodule_115_27_15_0x60_function_e49611e17107a853
+		aotLib[0x680ae27f04553e75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_115_27_15 & , int32_t , int32_t  ),&_Func_lambda_thismodule_115_27_15_0x60_function_e49611e17107a853>>();
+	};
+		// _Func_lambda_thismodule_125_12_28_0x60_finazlier_f2a3e958418ef82
+		aotLib[0x538846433a4d8b62] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_125_12_28 *  ),&_Func_lambda_thismodule_125_12_28_0x60_finazlier_f2a3e958418ef82>>();
+	};
+		// _Func_lambda_thismodule_125_12_28_0x60_function_f05401f6c9d42882
+		aotLib[0xd3ed6a51d207ef9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_125_12_28 & , TTuple<8,int32_t,float> * &  ),&_Func_lambda_thismodule_125_12_28_0x60_function_f05401f6c9d42882>>();
+	};
+		// _Func_lambda_thismodule_125_12_29_0x60_finazlier_d62c8b1cf676ddc
+		aotLib[0x1756c7c0a0ad7f05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_125_12_29 *  ),&_Func_lambda_thismodule_125_12_29_0x60_finazlier_d62c8b1cf676ddc>>();
+	};
+		// _Func_lambda_thismodule_125_12_29_0x60_function_c37752c67cb16cbf
+		aotLib[0x40b52ca66cfcd77e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_125_12_29 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_125_12_29_0x60_function_c37752c67cb16cbf>>();
+	};
+		// _Func_lambda_thismodule_139_12_22_0x60_finazlier_3029a31f3ee593ac
+		aotLib[0x25a8fb230e253c9f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_139_12_22 *  ),&_Func_lambda_thismodule_139_12_22_0x60_finazlier_3029a31f3ee593ac>>();
+	};
+		// _Func_lambda_thismodule_139_12_22_0x60_function_191cac2061c16d6c
+		aotLib[0x16d56c5ece7571f8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_139_12_22 & , int32_t &  ),&_Func_lambda_thismodule_139_12_22_0x60_function_191cac2061c16d6c>>();
+	};
+		// _Func_lambda_thismodule_139_28_6_0x60_finazlier_c81b48322132787e
+		aotLib[0xec2421ab448305a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_139_28_6 *  ),&_Func_lambda_thismodule_139_28_6_0x60_finazlier_c81b48322132787e>>();
+	};
+		// _Func_lambda_thismodule_139_28_6_0x60_function_3ce4133ac81d2d65
+		aotLib[0xda8d8f022fbe105] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, struct _lambda_thismodule_139_28_6 & , int32_t  ),&_Func_lambda_thismodule_139_28_6_0x60_function_3ce4133ac81d2d65>>();
+	};
+		// _Func_lambda_thismodule_145_12_31_0x60_finazlier_70fcc77fb901aacc
+		aotLib[0xfeeea83b66741ac8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_145_12_31 *  ),&_Func_lambda_thismodule_145_12_31_0x60_finazlier_70fcc77fb901aacc>>();
+	};
+		// _Func_lambda_thismodule_145_12_31_0x60_function_5e6685e57ae94b32
+		aotLib[0x20ab62a3b2a719ac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_145_12_31 & , TTuple<8,int32_t,float> * &  ),&_Func_lambda_thismodule_145_12_31_0x60_function_5e6685e57ae94b32>>();
+	};
+		// _Func_lambda_thismodule_145_12_33_0x60_finazlier_f4fb1b13b928b854
+		aotLib[0x530d2ceb3669ff6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_145_12_33 *  ),&_Func_lambda_thismodule_145_12_33_0x60_finazlier_f4fb1b13b928b854>>();
+	};
+		// _Func_lambda_thismodule_145_12_33_0x60_function_232273f764b02ab2
+		aotLib[0x9d976758fdd63288] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_145_12_33 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_145_12_33_0x60_function_232273f764b02ab2>>();
+	};
+		// _Func_lambda_thismodule_154_8_2_0x60_finazlier_5de4362f29c6b7e
+		aotLib[0x5ce5b628fe809299] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_154_8_2 *  ),&_Func_lambda_thismodule_154_8_2_0x60_finazlier_5de4362f29c6b7e>>();
+	};
+		// _Func_lambda_thismodule_154_8_2_0x60_function_8cf8bf0eaa9bd84b
+		aotLib[0x83017abd0b2a90f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_154_8_2 & , int32_t &  ),&_Func_lambda_thismodule_154_8_2_0x60_function_8cf8bf0eaa9bd84b>>();
+	};
+		// _Func_lambda_thismodule_15_12_30_0x60_finazlier_c0f0fb43fd5c1b9a
+		aotLib[0x6e840e0ce6f33833] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_15_12_30 *  ),&_Func_lambda_thismodule_15_12_30_0x60_finazlier_c0f0fb43fd5c1b9a>>();
+	};
+		// _Func_lambda_thismodule_15_12_30_0x60_function_c264f016790ba619
+		aotLib[0xd3eaf9f873e44a75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_15_12_30 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_15_12_30_0x60_function_c264f016790ba619>>();
+	};
+		// _Func_lambda_thismodule_161_8_3_0x60_finazlier_f78d5769526fcfa4
+		aotLib[0xc94ef7a248ca3a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_161_8_3 *  ),&_Func_lambda_thismodule_161_8_3_0x60_finazlier_f78d5769526fcfa4>>();
+	};
+		// _Func_lambda_thismodule_161_8_3_0x60_function_16b36051331311e4
+		aotLib[0xc51de9dd5226ee14] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_161_8_3 & , int32_t &  ),&_Func_lambda_thismodule_161_8_3_0x60_function_16b36051331311e4>>();
+	};
+		// _Func_lambda_thismodule_163_30_16_0x60_finazlier_fb8ad946134f187a
+		aotLib[0x991f2afd7f5e8dd7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_163_30_16 *  ),&_Func_lambda_thismodule_163_30_16_0x60_finazlier_fb8ad946134f187a>>();
+	};
+		// _Func_lambda_thismodule_163_30_16_0x60_function_2358a7332551bf89
+		aotLib[0xe8a034ab6c607fe9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_163_30_16 & , int32_t  ),&_Func_lambda_thismodule_163_30_16_0x60_function_2358a7332551bf89>>();
+	};
+		// _Func_lambda_thismodule_172_30_17_0x60_finazlier_d62dda2187dc1cbe
+		aotLib[0x9be2ba16af5bd272] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_172_30_17 *  ),&_Func_lambda_thismodule_172_30_17_0x60_finazlier_d62dda2187dc1cbe>>();
+	};
+		// _Func_lambda_thismodule_172_30_17_0x60_function_85867d03383bf73a
+		aotLib[0x2b4894822db1d465] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_172_30_17 & , int32_t  ),&_Func_lambda_thismodule_172_30_17_0x60_function_85867d03383bf73a>>();
+	};
+		// _Func_lambda_thismodule_180_30_18_0x60_finazlier_f3f210e81a2b3aaa
+		aotLib[0xa93e6b0ef943193d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_180_30_18 *  ),&_Func_lambda_thismodule_180_30_18_0x60_finazlier_f3f210e81a2b3aaa>>();
+	};
+		// _Func_lambda_thismodule_180_30_18_0x60_function_de3622d5f5d858d8
+		aotLib[0x716d37a0ca0392ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_180_30_18 & , int32_t  ),&_Func_lambda_thismodule_180_30_18_0x60_function_de3622d5f5d858d8>>();
+	};
+		// _Func_lambda_thismodule_227_19_7_0x60_finazlier_77b5578290d2acca
+		aotLib[0x8f14596c7cc3ced] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_227_19_7 *  ),&_Func_lambda_thismodule_227_19_7_0x60_finazlier_77b5578290d2acca>>();
+	};
+		// _Func_lambda_thismodule_227_19_7_0x60_function_e0c84006ce79c4cf
+		aotLib[0x3a40e7c2469f20ac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_227_19_7 & , int32_t &  ),&_Func_lambda_thismodule_227_19_7_0x60_function_e0c84006ce79c4cf>>();
+	};
+		// _Func_lambda_thismodule_232_10_8_0x60_finazlier_4bce5c5c58c08386
+		aotLib[0x4b6ab460f99df9e4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_232_10_8 *  ),&_Func_lambda_thismodule_232_10_8_0x60_finazlier_4bce5c5c58c08386>>();
+	};
+		// _Func_lambda_thismodule_232_10_8_0x60_function_8170def38434b7a7
+		aotLib[0x43073f07babb87c4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_232_10_8 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_232_10_8_0x60_function_8170def38434b7a7>>();
+	};
+		// _Func_lambda_thismodule_235_18_9_0x60_finazlier_33e50c0cf9c9aace
+		aotLib[0x4e1523e82e53942a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_235_18_9 *  ),&_Func_lambda_thismodule_235_18_9_0x60_finazlier_33e50c0cf9c9aace>>();
+	};
+		// _Func_lambda_thismodule_235_18_9_0x60_function_bbe7072f5081faf
+		aotLib[0x8ec041b2c2b093dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_235_18_9 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_235_18_9_0x60_function_bbe7072f5081faf>>();
+	};
+		// _Func_lambda_thismodule_240_10_12_0x60_finazlier_c6049d6e3206fd98
+		aotLib[0x36438657728a2f44] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_240_10_12 *  ),&_Func_lambda_thismodule_240_10_12_0x60_finazlier_c6049d6e3206fd98>>();
+	};
+		// _Func_lambda_thismodule_240_10_12_0x60_function_a218733ca2cc1c84
+		aotLib[0xc57243b746eac1f4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_240_10_12 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_240_10_12_0x60_function_a218733ca2cc1c84>>();
+	};
+		// _Func_lambda_thismodule_243_18_13_0x60_finazlier_6c8df04d1787ed80
+		aotLib[0xb8d8db0eba72130e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_243_18_13 *  ),&_Func_lambda_thismodule_243_18_13_0x60_finazlier_6c8df04d1787ed80>>();
+	};
+		// _Func_lambda_thismodule_243_18_13_0x60_function_56d8ac83771ebaa0
+		aotLib[0x69de1455fb0bfd2c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_243_18_13 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_243_18_13_0x60_function_56d8ac83771ebaa0>>();
+	};
+		// _Func_lambda_thismodule_31_12_23_0x60_finazlier_dd3b67d87541f66e
+		aotLib[0xac17ddd8f4082467] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_23 *  ),&_Func_lambda_thismodule_31_12_23_0x60_finazlier_dd3b67d87541f66e>>();
+	};
+		// _Func_lambda_thismodule_31_12_23_0x60_function_2a84fb4ade010279
+		aotLib[0x7e55925e0d0ac7c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_31_12_23 & , int32_t &  ),&_Func_lambda_thismodule_31_12_23_0x60_function_2a84fb4ade010279>>();
+	};
+		// _Func_lambda_thismodule_31_12_24_0x60_finazlier_f9e30e37e67a684
+		aotLib[0x803989fe70d4dcd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_24 *  ),&_Func_lambda_thismodule_31_12_24_0x60_finazlier_f9e30e37e67a684>>();
+	};
+		// _Func_lambda_thismodule_31_12_24_0x60_function_1c9f896f20c45e59
+		aotLib[0xb9873f1306d6deb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_31_12_24 & , bool &  ),&_Func_lambda_thismodule_31_12_24_0x60_function_1c9f896f20c45e59>>();
+	};
+		// _Func_lambda_thismodule_31_12_25_0x60_finazlier_18b30f1c2454e192
+		aotLib[0x4ba04f5e6a6a409] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_25 *  ),&_Func_lambda_thismodule_31_12_25_0x60_finazlier_18b30f1c2454e192>>();
+	};
+		// _Func_lambda_thismodule_31_12_25_0x60_function_d46b695e95774a0f
+		aotLib[0x6b687fb5821b8c01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_31_12_25 & , int32_t &  ),&_Func_lambda_thismodule_31_12_25_0x60_function_d46b695e95774a0f>>();
+	};
+		// _Func_lambda_thismodule_31_12_26_0x60_finazlier_2bab9c9fda0e690c
+		aotLib[0x41a55c53a27697e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_26 *  ),&_Func_lambda_thismodule_31_12_26_0x60_finazlier_2bab9c9fda0e690c>>();
+	};
+		// _Func_lambda_thismodule_31_12_26_0x60_function_e9e6b4863dad899e
+		aotLib[0xc5239d78122caf25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_31_12_26 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_31_12_26_0x60_function_e9e6b4863dad899e>>();
+	};
+		// _Func_lambda_thismodule_31_12_36_0x60_finazlier_d0925bee24ffbcee
+		aotLib[0xe1222e4da75ed66c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_36 *  ),&_Func_lambda_thismodule_31_12_36_0x60_finazlier_d0925bee24ffbcee>>();
+	};
+		// _Func_lambda_thismodule_31_12_36_0x60_function_4ffe3318a27ea7b8
+		aotLib[0x74ddb97ba26f2745] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_31_12_36 & , int32_t &  ),&_Func_lambda_thismodule_31_12_36_0x60_function_4ffe3318a27ea7b8>>();
+	};
+		// _Func_lambda_thismodule_36_12_34_0x60_finazlier_c532515853e13ae0
+		aotLib[0xd688f6cdba44ddb2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_36_12_34 *  ),&_Func_lambda_thismodule_36_12_34_0x60_finazlier_c532515853e13ae0>>();
+	};
+		// _Func_lambda_thismodule_36_12_34_0x60_function_ffcc9c524f18b6e0
+		aotLib[0xd8e9ad6f52bb3ca5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_36_12_34 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_36_12_34_0x60_function_ffcc9c524f18b6e0>>();
+	};
+		// _Func_lambda_thismodule_50_23_4_0x60_finazlier_94bec26830d25378
+		aotLib[0x71092c39a20a9b18] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_50_23_4 *  ),&_Func_lambda_thismodule_50_23_4_0x60_finazlier_94bec26830d25378>>();
+	};
+		// _Func_lambda_thismodule_50_23_4_0x60_function_99aaeed6b450d1aa
+		aotLib[0x2a13b674d80868f4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_50_23_4 & , int32_t const  * &  ),&_Func_lambda_thismodule_50_23_4_0x60_function_99aaeed6b450d1aa>>();
+	};
+		// _Func_lambda_thismodule_56_21_10_0x60_finazlier_5af839a62194f574
+		aotLib[0x7fec33ccce4063b4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_56_21_10 *  ),&_Func_lambda_thismodule_56_21_10_0x60_finazlier_5af839a62194f574>>();
+	};
+		// _Func_lambda_thismodule_56_21_10_0x60_function_8fb561381ecc7a45
+		aotLib[0x54e3229893550eac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_56_21_10 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_56_21_10_0x60_function_8fb561381ecc7a45>>();
+	};
+		// _Func_lambda_thismodule_71_25_14_0x60_finazlier_71ea3165571200f0
+		aotLib[0x606ccdc810742fb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_71_25_14 *  ),&_Func_lambda_thismodule_71_25_14_0x60_finazlier_71ea3165571200f0>>();
+	};
+		// _Func_lambda_thismodule_71_25_14_0x60_function_7d139dafd160cd75
+		aotLib[0xafdc4f6386884065] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_71_25_14 & , int32_t  ),&_Func_lambda_thismodule_71_25_14_0x60_function_7d139dafd160cd75>>();
+	};
+		// _Func_lambda_thismodule_85_28_1_0x60_finazlier_9127d836addd785e
+		aotLib[0xdf07f82e82467a46] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_85_28_1 *  ),&_Func_lambda_thismodule_85_28_1_0x60_finazlier_9127d836addd785e>>();
+	};
+		// _Func_lambda_thismodule_85_28_1_0x60_function_fc32ad12852d63cb
+		aotLib[0x258ec0ca20500cf9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_85_28_1 & , int32_t  ),&_Func_lambda_thismodule_85_28_1_0x60_function_fc32ad12852d63cb>>();
+	};
+		// _Func_lambda_thismodule_90_14_11_0x60_finazlier_6211c33db3590752
+		aotLib[0x5f11ebaa6f21c154] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_90_14_11 *  ),&_Func_lambda_thismodule_90_14_11_0x60_finazlier_6211c33db3590752>>();
+	};
+		// _Func_lambda_thismodule_90_14_11_0x60_function_a90556289c67e109
+		aotLib[0x8fa59a8f198824b8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_90_14_11 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_90_14_11_0x60_function_a90556289c67e109>>();
+	};
+		// _Func_lambda_thismodule_91_25_27_0x60_finazlier_8b8a9141cef68454
+		aotLib[0x9d8b863838130fed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_91_25_27 *  ),&_Func_lambda_thismodule_91_25_27_0x60_finazlier_8b8a9141cef68454>>();
+	};
+		// _Func_lambda_thismodule_91_25_27_0x60_function_37bece982a84c392
+		aotLib[0xa1392628384aa99d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_91_25_27 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_91_25_27_0x60_function_37bece982a84c392>>();
+	};
+		// _Func_lambda_thismodule_92_36_32_0x60_finazlier_2bfc7672990c4ec6
+		aotLib[0x9021dbafc4090d77] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_92_36_32 *  ),&_Func_lambda_thismodule_92_36_32_0x60_finazlier_2bfc7672990c4ec6>>();
+	};
+		// _Func_lambda_thismodule_92_36_32_0x60_function_28f9b06ed4451972
+		aotLib[0x9c5bad09c38be4af] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, struct _lambda_thismodule_92_36_32 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_92_36_32_0x60_function_28f9b06ed4451972>>();
+	};
+		// _Func_lambda_thismodule_93_29_35_0x60_finazlier_9f733d78516145ce
+		aotLib[0x1e84eb38eb93e2f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_93_29_35 *  ),&_Func_lambda_thismodule_93_29_35_0x60_finazlier_9f733d78516145ce>>();
+	};
+		// _Func_lambda_thismodule_93_29_35_0x60_function_8d241ebd3f86fba5
+		aotLib[0xef94240a460157e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_93_29_35 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_93_29_35_0x60_function_8d241ebd3f86fba5>>();
+	};
+		// _Func_lambda_thismodule_9_12_20_0x60_finazlier_98f5961684e556b4
+		aotLib[0x9ff073549331f1c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_12_20 *  ),&_Func_lambda_thismodule_9_12_20_0x60_finazlier_98f5961684e556b4>>();
+	};
+		// _Func_lambda_thismodule_9_12_20_0x60_function_24611828323dd0f8
+		aotLib[0x93f7cd7dc32a3fe5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_9_12_20 & , int32_t &  ),&_Func_lambda_thismodule_9_12_20_0x60_function_24611828323dd0f8>>();
+	};
+		// _Func_lambda_thismodule_9_12_21_0x60_finazlier_dd2c46f6117be984
+		aotLib[0xccbc6b2d16430235] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_12_21 *  ),&_Func_lambda_thismodule_9_12_21_0x60_finazlier_dd2c46f6117be984>>();
+	};
+		// _Func_lambda_thismodule_9_12_21_0x60_function_82cc0fe87cfae825
+		aotLib[0x2430252bacadc1fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_9_12_21 & , int32_t &  ),&_Func_lambda_thismodule_9_12_21_0x60_function_82cc0fe87cfae825>>();
+	};
+		// _Func_0x60_first_fc2232d3c243ca99
+		aotLib[0x190620f39865b6c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTuple<8,int32_t,float> const  &  ),&_Func_0x60_first_fc2232d3c243ca99>>();
+	};
+		// _Func_0x60_is_same_590802a3ad1ce37b
+		aotLib[0xfcab3632ac37c54b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  & , Sequence DAS_COMMENT((TArray<int32_t>)) const  &  ),&_Func_0x60_is_same_590802a3ad1ce37b>>();
+	};
+		// _Func_0x60_is_same_97c40271e1b9fd95
+		aotLib[0x5305443eb9ef4e5a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  & , Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  ),&_Func_0x60_is_same_97c40271e1b9fd95>>();
+	};
+		// _Func_0x60_is_same_9afffff6294c0446
+		aotLib[0xce56efaf2fcadc15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Sequence DAS_COMMENT((int32_t)) const  &  ),&_Func_0x60_is_same_9afffff6294c0446>>();
+	};
+		// _Func_0x60_verify_14_35b8308b990b4b30
+		aotLib[0x237e36e9ba1cac4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> const  &  ),&_Func_0x60_verify_14_35b8308b990b4b30>>();
+	};
+		// _Func_0x60_verify_14_ccaf1183e323809f
+		aotLib[0x74f8bcefd1ab2cbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  ),&_Func_0x60_verify_14_ccaf1183e323809f>>();
+	};
+		// _Func_0x60_verify_even_8835d561dd20d47
+		aotLib[0x40c414c66810ada5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Func_0x60_verify_even_8835d561dd20d47>>();
+	};
+		// _Func_0x60_verify_even_6078037029e38486
+		aotLib[0x2de992b757161311] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Func_0x60_verify_even_6078037029e38486>>();
+	};
+		// _Func_0x60_verify_even_bb494c9a7d66151f
+		aotLib[0x41096ede2ce4c971] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  ),&_Func_0x60_verify_even_bb494c9a7d66151f>>();
+	};
+		// add_71ce43625bcdc5ea
+		aotLib[0x191cc443284ae7bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&add_71ce43625bcdc5ea>>();
+	};
+		// _Funcbuiltin_0x60_clone_9217fda5fb53190b
+		aotLib[0xb00d3e185e494e59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_9217fda5fb53190b>>();
+	};
+		// _Funcbuiltin_0x60_each_298c4ba2da976305
+		aotLib[0x40a426d4b892cbd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, TArray<TArray<int32_t>> const  &  ),&_Funcbuiltin_0x60_each_298c4ba2da976305>>();
+	};
+		// _Funcbuiltin_0x60_each_2d3d435a4c8a02ad
+		aotLib[0xc0065f42bd150eed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  &  ),&_Funcbuiltin_0x60_each_2d3d435a4c8a02ad>>();
+	};
+		// _Funcbuiltin_0x60_each_49ba41ea6e9b0c25
+		aotLib[0x6a4a051ab138a935] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_49ba41ea6e9b0c25>>();
+	};
+		// _Funcbuiltin_0x60_each_69d7e7bb51ea3de6
+		aotLib[0x8ac280d1c67150cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const   ),&_Funcbuiltin_0x60_each_69d7e7bb51ea3de6>>();
+	};
+		// _Funcbuiltin_0x60_each_ba1451246e410d44
+		aotLib[0x793867d4b0d3c9d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const   ),&_Funcbuiltin_0x60_each_ba1451246e410d44>>();
+	};
+		// _Funcbuiltin_0x60_each_73dbf68872e28f81
+		aotLib[0x7848857a719eb425] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((bool)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const   ),&_Funcbuiltin_0x60_each_73dbf68872e28f81>>();
+	};
+		// _Funcbuiltin_0x60_each_d7a87ffd28768e01
+		aotLib[0xbfcb47e1b26386a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_d7a87ffd28768e01>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_each_ref_dd8113899e5f9ac1
+		aotLib[0x5e4c378b86b813e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const   ),&_Funcbuiltin_0x60_each_ref_dd8113899e5f9ac1>>();
+	};
+		// _Funcbuiltin_0x60_each_ref_ddfd027208f57be5
+		aotLib[0x25932ef1ac278f85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const   ),&_Funcbuiltin_0x60_each_ref_ddfd027208f57be5>>();
+	};
+		// _Funcbuiltin_0x60_each_ref_576a75d40473b6b2
+		aotLib[0x1fd2e14af9c8783d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_576a75d40473b6b2>>();
+	};
+		// _Funcbuiltin_0x60_emplace_9b7538bf247950b8
+		aotLib[0x9ad60b5f89285689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_emplace_9b7538bf247950b8>>();
+	};
+		// _Funcbuiltin_0x60_finalize_242c8c79790d8651
+		aotLib[0x2ba500bcbe92adca] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> &  ),&_Funcbuiltin_0x60_finalize_242c8c79790d8651>>();
+	};
+		// _Funcbuiltin_0x60_finalize_e1c35de9ada57daf
+		aotLib[0x68b86cd6a042ae73] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  ),&_Funcbuiltin_0x60_finalize_e1c35de9ada57daf>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_9e42c2cbacc8edfd
+		aotLib[0xc6803c2403434188] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , TArray<int32_t> const  & , int32_t  ),&_Funcbuiltin_0x60_push_clone_9e42c2cbacc8edfd>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_2d25e6e543f5b2eb
+		aotLib[0xa62da511c4f34095] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> & , TTuple<8,int32_t,float> const  & , int32_t  ),&_Funcbuiltin_0x60_push_clone_2d25e6e543f5b2eb>>();
+	};
+		// _Funcbuiltin_0x60_reserve_96529fa671b59898
+		aotLib[0x3d941cc46a4286e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , int32_t  ),&_Funcbuiltin_0x60_reserve_96529fa671b59898>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_to_array_e7337cf490aef504
+		aotLib[0xb019749877860f09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcbuiltin_0x60_to_array_e7337cf490aef504>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05
+		aotLib[0x838d3aac7cba9ead] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_2214fb125fb27d05>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291
+		aotLib[0xc37e6f73e998be11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_228cbd1e470b6291>>();
+	};
+		// finalize_554c45dda146b8a6
+		aotLib[0x44f1f99164dafc69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<8,int32_t,float> &  ),&finalize_554c45dda146b8a6>>();
+	};
+		// finalize_a9d0ed6e96725931
+		aotLib[0xc87723a104fd0265] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_106_15_5 &  ),&finalize_a9d0ed6e96725931>>();
+	};
+		// finalize_87ca26a909d496c5
+		aotLib[0x1c5d14a32e9ac0fe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_113_12_19 &  ),&finalize_87ca26a909d496c5>>();
+	};
+		// finalize_4e0f4bc7b8ca2ddf
+		aotLib[0x4ad738011f7b03a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_115_27_15 &  ),&finalize_4e0f4bc7b8ca2ddf>>();
+	};
+		// finalize_3c4ff226a8e359f6
+		aotLib[0x2389de9867d1e723] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_125_12_28 &  ),&finalize_3c4ff226a8e359f6>>();
+	};
+		// finalize_63d741ed1ad0a885
+		aotLib[0x5468a472edd4ef9a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_125_12_29 &  ),&finalize_63d741ed1ad0a885>>();
+	};
+		// finalize_ac07579e55ec835c
+		aotLib[0xb44e88e132fef119] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_139_12_22 &  ),&finalize_ac07579e55ec835c>>();
+	};
+		// finalize_99b4eff0b688c844
+		aotLib[0x960373f5273e2045] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_139_28_6 &  ),&finalize_99b4eff0b688c844>>();
+	};
+		// finalize_84432671fa988803
+		aotLib[0x8bcd429ca2925f7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_145_12_31 &  ),&finalize_84432671fa988803>>();
+	};
+		// finalize_d09c68d01225d761
+		aotLib[0x22efe93d7589765d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_145_12_33 &  ),&finalize_d09c68d01225d761>>();
+	};
+		// finalize_fea47afcce8467af
+		aotLib[0xf9b13c654f5351c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_154_8_2 &  ),&finalize_fea47afcce8467af>>();
+	};
+		// finalize_35204d53807e6c74
+		aotLib[0x7b46ad9d072eb4ca] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_15_12_30 &  ),&finalize_35204d53807e6c74>>();
+	};
+		// finalize_8655051428abd0f4
+		aotLib[0x6cdbb0aa968286d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_161_8_3 &  ),&finalize_8655051428abd0f4>>();
+	};
+		// finalize_790215f236547953
+		aotLib[0x6f294b22a3c3b501] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_163_30_16 &  ),&finalize_790215f236547953>>();
+	};
+		// finalize_1bb28fe166db1ff8
+		aotLib[0x78f97bc96f5231f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_172_30_17 &  ),&finalize_1bb28fe166db1ff8>>();
+	};
+		// finalize_6a14a117832a47b4
+		aotLib[0x2468d43939cebe9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_180_30_18 &  ),&finalize_6a14a117832a47b4>>();
+	};
+		// finalize_49ff1a0658524f07
+		aotLib[0x3a8d8b45eec60745] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_227_19_7 &  ),&finalize_49ff1a0658524f07>>();
+	};
+		// finalize_da9a89580c66c5cf
+		aotLib[0xfdcc65f7999d5561] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_232_10_8 &  ),&finalize_da9a89580c66c5cf>>();
+	};
+		// finalize_cb84739dfec92af7
+		aotLib[0xfd285f414754a405] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_235_18_9 &  ),&finalize_cb84739dfec92af7>>();
+	};
+		// finalize_3110b281c7deafcb
+		aotLib[0x556fc49fa817b1f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_240_10_12 &  ),&finalize_3110b281c7deafcb>>();
+	};
+		// finalize_3d9c85063ca4a8bd
+		aotLib[0x4458332befc28735] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_243_18_13 &  ),&finalize_3d9c85063ca4a8bd>>();
+	};
+		// finalize_ea77efc811c36135
+		aotLib[0xbd72f9548b1ee549] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_23 &  ),&finalize_ea77efc811c36135>>();
+	};
+		// finalize_8902c5c3395ffb84
+		aotLib[0x75836f8f58221d75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_24 &  ),&finalize_8902c5c3395ffb84>>();
+	};
+		// finalize_fb1e929eb75c77d3
+		aotLib[0x2c645dc2d80d9c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_25 &  ),&finalize_fb1e929eb75c77d3>>();
+	};
+		// finalize_a742d882934bc67a
+		aotLib[0x324d9789b9281a11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_26 &  ),&finalize_a742d882934bc67a>>();
+	};
+		// finalize_2c6d673361e95598
+		aotLib[0x8170a6be2f9b666e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_31_12_36 &  ),&finalize_2c6d673361e95598>>();
+	};
+		// finalize_9a32ba1293d999ac
+		aotLib[0xa6c7d1b57548f559] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_36_12_34 &  ),&finalize_9a32ba1293d999ac>>();
+	};
+		// finalize_e4e346397db1da55
+		aotLib[0xc41c8adc4530f019] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_50_23_4 &  ),&finalize_e4e346397db1da55>>();
+	};
+		// finalize_7e62c95ba3669c0e
+		aotLib[0xcabc77bc2d5c5615] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_56_21_10 &  ),&finalize_7e62c95ba3669c0e>>();
+	};
+		// finalize_8d49d3be2563d419
+		aotLib[0xace8ffee4ca4c45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_71_25_14 &  ),&finalize_8d49d3be2563d419>>();
+	};
+		// finalize_8f217ed02c7d43f1
+		aotLib[0x66afded8f98bba41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_85_28_1 &  ),&finalize_8f217ed02c7d43f1>>();
+	};
+		// finalize_75919cb3423249cf
+		aotLib[0x3cee402d76070179] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_90_14_11 &  ),&finalize_75919cb3423249cf>>();
+	};
+		// finalize_cfd3426561e2e7e5
+		aotLib[0x74f81d0e63b2f125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_91_25_27 &  ),&finalize_cfd3426561e2e7e5>>();
+	};
+		// finalize_6eaa1c4f569102fc
+		aotLib[0x5172d55540fbde85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_92_36_32 &  ),&finalize_6eaa1c4f569102fc>>();
+	};
+		// finalize_cdc2fc53315b9882
+		aotLib[0xede4cf03b9d9019d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_93_29_35 &  ),&finalize_cdc2fc53315b9882>>();
+	};
+		// finalize_96301ec05baef2f5
+		aotLib[0xb4702da5762de93d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_12_20 &  ),&finalize_96301ec05baef2f5>>();
+	};
+		// finalize_4b0e4cd0a7164aae
+		aotLib[0xe2b8f6756ea6bb45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_12_21 &  ),&finalize_4b0e4cd0a7164aae>>();
+	};
+		// _Funcfunctional_0x60_all_29a13565b52eb7db
+		aotLib[0xaa4da1cf536da5d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  ),&_Funcfunctional_0x60_all_29a13565b52eb7db>>();
+	};
+		// _Funcfunctional_0x60_any_dd77430c4ce8eb4b
+		aotLib[0x2b92c7ee47012ddd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  ),&_Funcfunctional_0x60_any_dd77430c4ce8eb4b>>();
+	};
+		// _Funcfunctional_0x60_any_3b173b789b4d659
+		aotLib[0xa7e31d2d25d1ef1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<bool,2> const  &  ),&_Funcfunctional_0x60_any_3b173b789b4d659>>();
+	};
+		// _Funcfunctional_0x60_count_f81ee374cce5540d
+		aotLib[0x2570b6102fc99ccf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_count_f81ee374cce5540d>>();
+	};
+		// _Funcfunctional_0x60_cycle_45ebe7337522428a
+		aotLib[0xdab71dbd6a91af3f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  ),&_Funcfunctional_0x60_cycle_45ebe7337522428a>>();
+	};
+		// _Funcfunctional_0x60_cycle_afb4461f9fcee246
+		aotLib[0xd15465a727049b2e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  ),&_Funcfunctional_0x60_cycle_afb4461f9fcee246>>();
+	};
+		// _Funcfunctional_0x60_cycle_8be75c6ab4e4f342
+		aotLib[0x2385d7f945878e03] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  ),&_Funcfunctional_0x60_cycle_8be75c6ab4e4f342>>();
+	};
+		// _Funcfunctional_0x60_filter_9c5c2ea0768c39c0
+		aotLib[0xbb0cc1deaa6375c8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_filter_9c5c2ea0768c39c0>>();
+	};
+		// _Funcfunctional_0x60_filter_9ac4a2626818601d
+		aotLib[0x9abd8aa4e5a095c8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_9ac4a2626818601d>>();
+	};
+		// _Funcfunctional_0x60_filter_29a3b3a7512b71f5
+		aotLib[0x3d464afbafd882b4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_29a3b3a7512b71f5>>();
+	};
+		// _Funcfunctional_0x60_filter_any_121721b2e08eefc9
+		aotLib[0x6b7e21aa27ce176e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((bool,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_filter_any_121721b2e08eefc9>>();
+	};
+		// _Funcfunctional_0x60_filter_any_6eb8df991750122c
+		aotLib[0x66b3fcc8af0270d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_6eb8df991750122c>>();
+	};
+		// _Funcfunctional_0x60_filter_any_93484a24b323592f
+		aotLib[0xd3bc86bcc05d8689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_93484a24b323592f>>();
+	};
+		// _Funcfunctional_0x60_is_equal_6b49314146682bc8
+		aotLib[0x564b377cc4fbc09d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_is_equal_6b49314146682bc8>>();
+	};
+		// _Funcfunctional_0x60_islice_1b238c444ec51e4d
+		aotLib[0xc8a4b0d8573d6350] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_1b238c444ec51e4d>>();
+	};
+		// _Funcfunctional_0x60_islice_eef73b9790d080de
+		aotLib[0xdebbf20cbe427cf6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_eef73b9790d080de>>();
+	};
+		// _Funcfunctional_0x60_islice_f925e02743d56ac
+		aotLib[0x1d31c4e3054e901d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_f925e02743d56ac>>();
+	};
+		// _Funcfunctional_0x60_map_4b03d8b25a9f7c5c
+		aotLib[0x18dcca93b7f27d4e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_map_4b03d8b25a9f7c5c>>();
+	};
+		// _Funcfunctional_0x60_map_765ff0602dff4f41
+		aotLib[0x721ed79460d5fc11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_map_765ff0602dff4f41>>();
+	};
+		// _Funcfunctional_0x60_map_8c8dda3d30684686
+		aotLib[0xa3bbfad379d791e4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((int32_t,int32_t)) const   ),&_Funcfunctional_0x60_map_8c8dda3d30684686>>();
+	};
+		// _Funcfunctional_0x60_map_65695f489097f839
+		aotLib[0x746210f9871ee3b0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const   ),&_Funcfunctional_0x60_map_65695f489097f839>>();
+	};
+		// _Funcfunctional_0x60_map_6553bbb9d75fe927
+		aotLib[0x65b760eae44adf39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((bool)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_map_6553bbb9d75fe927>>();
+	};
+		// _Funcfunctional_0x60_map_478dab29ef056fb6
+		aotLib[0x56e34a80b9b10339] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((int32_t,int32_t)) const   ),&_Funcfunctional_0x60_map_478dab29ef056fb6>>();
+	};
+		// _Funcfunctional_0x60_map_any_a6b26395efebfa79
+		aotLib[0x43f7554f2887f3a3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((int32_t,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_map_any_a6b26395efebfa79>>();
+	};
+		// _Funcfunctional_0x60_map_any_fbc5e9f6cd4a2c3
+		aotLib[0x4afe12d6dc68aab4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_map_any_fbc5e9f6cd4a2c3>>();
+	};
+		// _Funcfunctional_0x60_map_any_42e49f214b3338ad
+		aotLib[0x5f98286beb772c1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((int32_t,int32_t))  ),&_Funcfunctional_0x60_map_any_42e49f214b3338ad>>();
+	};
+		// _Funcfunctional_0x60_map_any_78804bc5438b4457
+		aotLib[0xfad99d26f2b15c81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t))  ),&_Funcfunctional_0x60_map_any_78804bc5438b4457>>();
+	};
+		// _Funcfunctional_0x60_map_any_d6e273aa6b995622
+		aotLib[0x3ed2572e74be90e6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((bool)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_map_any_d6e273aa6b995622>>();
+	};
+		// _Funcfunctional_0x60_map_any_c90db4847f0a8879
+		aotLib[0xafa907930de1810d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((int32_t,int32_t))  ),&_Funcfunctional_0x60_map_any_c90db4847f0a8879>>();
+	};
+		// _Funcfunctional_0x60_not_62fd3e2cf8622aee
+		aotLib[0x55da8956845ff609] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, bool  ),&_Funcfunctional_0x60_not_62fd3e2cf8622aee>>();
+	};
+		// _Funcfunctional_0x60_reduce_8a228425c3a12cf0
+		aotLib[0xbddd881581b0fb5f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & , Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  ),&_Funcfunctional_0x60_reduce_8a228425c3a12cf0>>();
+	};
+		// _Funcfunctional_0x60_reduce_fe50d9841ab82207
+		aotLib[0xb2e482ebbf84aa2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_fe50d9841ab82207>>();
+	};
+		// _Funcfunctional_0x60_reduce_abe6e78b2b662e9
+		aotLib[0x15443c41d59155d4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Func DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_abe6e78b2b662e9>>();
+	};
+		// _Funcfunctional_0x60_reduce_cb178b30ab4da07
+		aotLib[0x7a1f362e14b04308] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_cb178b30ab4da07>>();
+	};
+		// _Funcfunctional_0x60_reduce_7a6bb0d6853a5308
+		aotLib[0x35ff2abc0d8eb43] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_7a6bb0d6853a5308>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_bd042ec2d83b8d49
+		aotLib[0xb24af9b765aa9e3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & , Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  ),&_Funcfunctional_0x60_reduce_any_bd042ec2d83b8d49>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_51d9e1545f1073ee
+		aotLib[0xf1f18d3039dc9e2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_any_51d9e1545f1073ee>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_c1597e64f62c4a9d
+		aotLib[0x6dc66390fa441cb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Func DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_any_c1597e64f62c4a9d>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_6c02eae7c8fa51a7
+		aotLib[0xb518e2774a5238d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_any_6c02eae7c8fa51a7>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_aedc21539e3b4419
+		aotLib[0x3b51bb0e032eab51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_any_aedc21539e3b4419>>();
+	};
+		// _Funcfunctional_0x60_repeat_66c37a2d9ef2191d
+		aotLib[0x512230cd44798eda] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_repeat_66c37a2d9ef2191d>>();
+	};
+		// _Funcfunctional_0x60_sum_ea2762a9b6c828a6
+		aotLib[0xede9cdbcaadb7c1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcfunctional_0x60_sum_ea2762a9b6c828a6>>();
+	};
+		// is_even_6d9eabfbf704f1dc
+		aotLib[0xa27540ab97fa1cf5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_even_6d9eabfbf704f1dc>>();
+	};
+		// test_eefa0ae5aee396ca
+		aotLib[0xb437f6878f45deb6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_eefa0ae5aee396ca>>();
+	};
+		// twice_c214784f6f367f97
+		aotLib[0x1db13940c8c5eedd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&twice_c214784f6f367f97>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
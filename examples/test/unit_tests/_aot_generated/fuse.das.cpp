@@ -0,0 +1,1810 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require functional
+ // require strings_boost
+ // require ast_boost
+ // require fuse
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__19740234;
+extern StructInfo __struct_info__61688d15;
+extern StructInfo __struct_info__59dfbb4f;
+extern StructInfo __struct_info__3d6041ba;
+extern StructInfo __struct_info__305f4bab;
+extern StructInfo __struct_info__2cd73c83;
+extern StructInfo __struct_info__b2c7134a;
+extern StructInfo __struct_info__c4206aa6;
+extern StructInfo __struct_info__1ac6a627;
+extern StructInfo __struct_info__c010eec6;
+extern StructInfo __struct_info__66f7475;
+extern StructInfo __struct_info__94f18c23;
+extern StructInfo __struct_info__a0d4cfd2;
+extern StructInfo __struct_info__420d6f5;
+extern TypeInfo __type_info__2e18ae36;
+extern TypeInfo __type_info__5135d324;
+extern TypeInfo __type_info__22f531ce;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__fedd0b56;
+extern TypeInfo __type_info__46225b25;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__f989d2eb;
+extern TypeInfo __type_info__9a0d0d5c;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__d227aeff;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__cf82abc5;
+extern TypeInfo __type_info__a3f4fbd3;
+extern TypeInfo __type_info__6b670f92;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__4d68d30e;
+extern TypeInfo __type_info__f1b9498d;
+extern TypeInfo __type_info__118f639d;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__260b3481;
+extern TypeInfo __type_info__9f8f8597;
+extern TypeInfo __type_info__621a8dfa;
+extern TypeInfo __type_info__413b3264;
+extern TypeInfo __type_info__5b8c1cf3;
+extern TypeInfo __type_info__9a22bb23;
+extern TypeInfo __type_info__acb4fa6a;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__2b9991b;
+extern TypeInfo __type_info__a39a690b;
+extern TypeInfo __type_info__e2c61a5a;
+extern TypeInfo __type_info__f12ff037;
+extern TypeInfo __type_info__ce703112;
+extern TypeInfo __type_info__d91151bc;
+extern TypeInfo __type_info__9cc01e42;
+extern TypeInfo __type_info__8724e88d;
+extern TypeInfo __type_info__a763ad25;
+extern TypeInfo __type_info__4ff7c47f;
+extern TypeInfo __type_info__31831b4d;
+extern VarInfo __var_info__e63a64bc;
+extern VarInfo __var_info__35141a0;
+extern VarInfo __var_info__22dd1e41;
+extern VarInfo __var_info__130252ac;
+extern VarInfo __var_info__f477d0fa;
+extern VarInfo __var_info__74deac77;
+extern VarInfo __var_info__9ed73d62;
+extern VarInfo __var_info__fb79cbc4;
+extern VarInfo __var_info__a28f478e;
+extern VarInfo __var_info__d6ab2453;
+extern VarInfo __var_info__df49049b;
+extern VarInfo __var_info__37649080;
+extern VarInfo __var_info__84f900a5;
+extern VarInfo __var_info__62ba8787;
+extern VarInfo __var_info__ee0ebf86;
+extern VarInfo __var_info__69f17e85;
+extern VarInfo __var_info__393cbc39;
+extern VarInfo __var_info__a1b1671;
+extern VarInfo __var_info__e8a65e39;
+extern VarInfo __var_info__624113ab;
+extern VarInfo __var_info__9b4494f8;
+extern VarInfo __var_info__87dd623e;
+extern VarInfo __var_info__32f32473;
+extern VarInfo __var_info__48186001;
+extern VarInfo __var_info__d662032b;
+extern VarInfo __var_info__11d5bdae;
+extern VarInfo __var_info__73248642;
+extern VarInfo __var_info__7c5bbf0f;
+extern VarInfo __var_info__de44fc15;
+extern VarInfo __var_info__b6e16cc3;
+extern VarInfo __var_info__b2546bcb;
+extern VarInfo __var_info__7254a519;
+extern VarInfo __var_info__80157a6d;
+extern VarInfo __var_info__90a5ec75;
+extern VarInfo __var_info__5d4c292d;
+extern VarInfo __var_info__7550526e;
+extern VarInfo __var_info__e2d72f4f;
+extern VarInfo __var_info__256c19bf;
+extern VarInfo __var_info__5ce111b7;
+extern VarInfo __var_info__16cfcb0e;
+extern VarInfo __var_info__ef88a886;
+extern VarInfo __var_info__ce6336d2;
+extern FuncInfo __func_info__2e807d1c;
+
+TypeInfo * __type_info__de44fc15_arg_types_var_427033140[2] = { &__type_info__5135d324, &__type_info__e6eb6b88 };
+VarInfo __struct_info__19740234_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__de44fc15_arg_types_var_427033140, nullptr, 2, 0, nullptr, 28, 0xde44fc15, "__lambda", 0 };
+TypeInfo * __type_info__130252ac_arg_types_var_427033140[1] = { &__type_info__9a0d0d5c };
+VarInfo __struct_info__19740234_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__130252ac_arg_types_var_427033140, nullptr, 1, 0, nullptr, 28, 0x130252ac, "__finalize", 4 };
+VarInfo __struct_info__19740234_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xb6e16cc3, "__yield", 8 };
+TypeInfo * __type_info__e2d72f4f_arg_types_var_427033140[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__19740234_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__e2d72f4f_arg_types_var_427033140, nullptr, 1, 0, nullptr, 0, 0xe2d72f4f, "blk", 16 };
+VarInfo __struct_info__19740234_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__d91151bc, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xef88a886, "src", 24 };
+VarInfo __struct_info__19740234_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x7254a519, "_loop_at_9", 32 };
+VarInfo __struct_info__19740234_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__d91151bc, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x80157a6d, "_source_0_at_9", 40 };
+VarInfo __struct_info__19740234_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__359c1b32, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x90a5ec75, "w", 48 };
+VarInfo __struct_info__19740234_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x48186001, "_pvar_0_at_9", 56 };
+VarInfo * __struct_info__19740234_fields[9] =  { &__struct_info__19740234_field_0, &__struct_info__19740234_field_1, &__struct_info__19740234_field_2, &__struct_info__19740234_field_3, &__struct_info__19740234_field_4, &__struct_info__19740234_field_5, &__struct_info__19740234_field_6, &__struct_info__19740234_field_7, &__struct_info__19740234_field_8 };
+StructInfo __struct_info__19740234 = {"_lambda_thismodule_9_12_18", __struct_info__19740234_fields, 9, 64, -1, nullptr, 0x19740234 };
+TypeInfo * __type_info__11d5bdae_arg_types_var_1634241813[2] = { &__type_info__cf82abc5, &__type_info__359c1b32 };
+VarInfo __struct_info__61688d15_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, (TypeInfo **)__type_info__11d5bdae_arg_types_var_1634241813, nullptr, 2, 0, nullptr, 28, 0x11d5bdae, "__lambda", 0 };
+TypeInfo * __type_info__b2546bcb_arg_types_var_1634241813[1] = { &__type_info__8724e88d };
+VarInfo __struct_info__61688d15_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b2546bcb_arg_types_var_1634241813, nullptr, 1, 0, nullptr, 28, 0xb2546bcb, "__finalize", 4 };
+VarInfo * __struct_info__61688d15_fields[2] =  { &__struct_info__61688d15_field_0, &__struct_info__61688d15_field_1 };
+StructInfo __struct_info__61688d15 = {"_lambda_thismodule_42_62_8", __struct_info__61688d15_fields, 2, 8, -1, nullptr, 0x61688d15 };
+TypeInfo * __type_info__e63a64bc_arg_types_var_1507834703[2] = { &__type_info__4ff7c47f, &__type_info__f1b9498d };
+VarInfo __struct_info__59dfbb4f_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__e63a64bc_arg_types_var_1507834703, nullptr, 2, 0, nullptr, 28, 0xe63a64bc, "__lambda", 0 };
+TypeInfo * __type_info__e8a65e39_arg_types_var_1507834703[1] = { &__type_info__f12ff037 };
+VarInfo __struct_info__59dfbb4f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e8a65e39_arg_types_var_1507834703, nullptr, 1, 0, nullptr, 28, 0xe8a65e39, "__finalize", 4 };
+VarInfo * __struct_info__59dfbb4f_fields[2] =  { &__struct_info__59dfbb4f_field_0, &__struct_info__59dfbb4f_field_1 };
+StructInfo __struct_info__59dfbb4f = {"_lambda_thismodule_42_111_9", __struct_info__59dfbb4f_fields, 2, 8, -1, nullptr, 0x59dfbb4f };
+TypeInfo * __type_info__62ba8787_arg_types_var_1029718458[2] = { &__type_info__acb4fa6a, &__type_info__359c1b32 };
+VarInfo __struct_info__3d6041ba_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__62ba8787_arg_types_var_1029718458, nullptr, 2, 0, nullptr, 28, 0x62ba8787, "__lambda", 0 };
+TypeInfo * __type_info__7550526e_arg_types_var_1029718458[1] = { &__type_info__ce703112 };
+VarInfo __struct_info__3d6041ba_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7550526e_arg_types_var_1029718458, nullptr, 1, 0, nullptr, 28, 0x7550526e, "__finalize", 4 };
+VarInfo * __struct_info__3d6041ba_fields[2] =  { &__struct_info__3d6041ba_field_0, &__struct_info__3d6041ba_field_1 };
+StructInfo __struct_info__3d6041ba = {"_lambda_thismodule_36_49_7", __struct_info__3d6041ba_fields, 2, 8, -1, nullptr, 0x3d6041ba };
+TypeInfo * __type_info__9b4494f8_arg_types_var_811551659[2] = { &__type_info__2b9991b, &__type_info__359c1b32 };
+VarInfo __struct_info__305f4bab_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__9b4494f8_arg_types_var_811551659, nullptr, 2, 0, nullptr, 28, 0x9b4494f8, "__lambda", 0 };
+TypeInfo * __type_info__5d4c292d_arg_types_var_811551659[1] = { &__type_info__9a22bb23 };
+VarInfo __struct_info__305f4bab_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5d4c292d_arg_types_var_811551659, nullptr, 1, 0, nullptr, 28, 0x5d4c292d, "__finalize", 4 };
+VarInfo * __struct_info__305f4bab_fields[2] =  { &__struct_info__305f4bab_field_0, &__struct_info__305f4bab_field_1 };
+StructInfo __struct_info__305f4bab = {"_lambda_thismodule_21_44_12", __struct_info__305f4bab_fields, 2, 8, -1, nullptr, 0x305f4bab };
+TypeInfo * __type_info__37649080_arg_types_var_752303235[2] = { &__type_info__5b8c1cf3, &__type_info__359c1b32 };
+VarInfo __struct_info__2cd73c83_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__37649080_arg_types_var_752303235, nullptr, 2, 0, nullptr, 28, 0x37649080, "__lambda", 0 };
+TypeInfo * __type_info__69f17e85_arg_types_var_752303235[1] = { &__type_info__a39a690b };
+VarInfo __struct_info__2cd73c83_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__69f17e85_arg_types_var_752303235, nullptr, 1, 0, nullptr, 28, 0x69f17e85, "__finalize", 4 };
+VarInfo * __struct_info__2cd73c83_fields[2] =  { &__struct_info__2cd73c83_field_0, &__struct_info__2cd73c83_field_1 };
+StructInfo __struct_info__2cd73c83 = {"_lambda_thismodule_21_75_1", __struct_info__2cd73c83_fields, 2, 8, -1, nullptr, 0x2cd73c83 };
+TypeInfo * __type_info__74deac77_arg_types_var_2999391050[2] = { &__type_info__621a8dfa, &__type_info__359c1b32 };
+VarInfo __struct_info__b2c7134a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__74deac77_arg_types_var_2999391050, nullptr, 2, 0, nullptr, 28, 0x74deac77, "__lambda", 0 };
+TypeInfo * __type_info__87dd623e_arg_types_var_2999391050[1] = { &__type_info__6b670f92 };
+VarInfo __struct_info__b2c7134a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__87dd623e_arg_types_var_2999391050, nullptr, 1, 0, nullptr, 28, 0x87dd623e, "__finalize", 4 };
+VarInfo * __struct_info__b2c7134a_fields[2] =  { &__struct_info__b2c7134a_field_0, &__struct_info__b2c7134a_field_1 };
+StructInfo __struct_info__b2c7134a = {"_lambda_thismodule_24_65_2", __struct_info__b2c7134a_fields, 2, 8, -1, nullptr, 0xb2c7134a };
+TypeInfo * __type_info__d6ab2453_arg_types_var_3290458790[2] = { &__type_info__fedd0b56, &__type_info__359c1b32 };
+VarInfo __struct_info__c4206aa6_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, (TypeInfo **)__type_info__d6ab2453_arg_types_var_3290458790, nullptr, 2, 0, nullptr, 28, 0xd6ab2453, "__lambda", 0 };
+TypeInfo * __type_info__73248642_arg_types_var_3290458790[1] = { &__type_info__4d68d30e };
+VarInfo __struct_info__c4206aa6_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__73248642_arg_types_var_3290458790, nullptr, 1, 0, nullptr, 28, 0x73248642, "__finalize", 4 };
+VarInfo * __struct_info__c4206aa6_fields[2] =  { &__struct_info__c4206aa6_field_0, &__struct_info__c4206aa6_field_1 };
+StructInfo __struct_info__c4206aa6 = {"_lambda_thismodule_30_46_6", __struct_info__c4206aa6_fields, 2, 8, -1, nullptr, 0xc4206aa6 };
+TypeInfo * __type_info__fb79cbc4_arg_types_var_449226279[2] = { &__type_info__9f8f8597, &__type_info__359c1b32 };
+VarInfo __struct_info__1ac6a627_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__fb79cbc4_arg_types_var_449226279, nullptr, 2, 0, nullptr, 28, 0xfb79cbc4, "__lambda", 0 };
+TypeInfo * __type_info__a1b1671_arg_types_var_449226279[1] = { &__type_info__d227aeff };
+VarInfo __struct_info__1ac6a627_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a1b1671_arg_types_var_449226279, nullptr, 1, 0, nullptr, 28, 0xa1b1671, "__finalize", 4 };
+VarInfo * __struct_info__1ac6a627_fields[2] =  { &__struct_info__1ac6a627_field_0, &__struct_info__1ac6a627_field_1 };
+StructInfo __struct_info__1ac6a627 = {"_lambda_thismodule_44_65_10", __struct_info__1ac6a627_fields, 2, 8, -1, nullptr, 0x1ac6a627 };
+TypeInfo * __type_info__32f32473_arg_types_var_3222335174[2] = { &__type_info__2e18ae36, &__type_info__359c1b32 };
+VarInfo __struct_info__c010eec6_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__32f32473_arg_types_var_3222335174, nullptr, 2, 0, nullptr, 28, 0x32f32473, "__lambda", 0 };
+TypeInfo * __type_info__9ed73d62_arg_types_var_3222335174[1] = { &__type_info__22f531ce };
+VarInfo __struct_info__c010eec6_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9ed73d62_arg_types_var_3222335174, nullptr, 1, 0, nullptr, 28, 0x9ed73d62, "__finalize", 4 };
+VarInfo * __struct_info__c010eec6_fields[2] =  { &__struct_info__c010eec6_field_0, &__struct_info__c010eec6_field_1 };
+StructInfo __struct_info__c010eec6 = {"_lambda_thismodule_27_44_4", __struct_info__c010eec6_fields, 2, 8, -1, nullptr, 0xc010eec6 };
+TypeInfo * __type_info__a28f478e_arg_types_var_107967605[2] = { &__type_info__46225b25, &__type_info__413b3264 };
+VarInfo __struct_info__66f7475_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__a28f478e_arg_types_var_107967605, nullptr, 2, 0, nullptr, 28, 0xa28f478e, "__lambda", 0 };
+TypeInfo * __type_info__624113ab_arg_types_var_107967605[1] = { &__type_info__118f639d };
+VarInfo __struct_info__66f7475_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__624113ab_arg_types_var_107967605, nullptr, 1, 0, nullptr, 28, 0x624113ab, "__finalize", 4 };
+VarInfo __struct_info__66f7475_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xf477d0fa, "__yield", 8 };
+VarInfo __struct_info__66f7475_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x256c19bf, "_loop_at_44", 12 };
+VarInfo __struct_info__66f7475_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x22dd1e41, "x", 16 };
+VarInfo __struct_info__66f7475_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x5ce111b7, "_pvar_0_at_44", 24 };
+VarInfo __struct_info__66f7475_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xdf49049b, "_source_0_at_44", 32 };
+VarInfo * __struct_info__66f7475_fields[7] =  { &__struct_info__66f7475_field_0, &__struct_info__66f7475_field_1, &__struct_info__66f7475_field_2, &__struct_info__66f7475_field_3, &__struct_info__66f7475_field_4, &__struct_info__66f7475_field_5, &__struct_info__66f7475_field_6 };
+StructInfo __struct_info__66f7475 = {"_lambda_thismodule_44_19_11", __struct_info__66f7475_fields, 7, 40, -1, nullptr, 0x66f7475 };
+TypeInfo * __type_info__35141a0_arg_types_var_2498858019[3] = { &__type_info__a3f4fbd3, &__type_info__359c1b32, &__type_info__359c1b32 };
+VarInfo __struct_info__94f18c23_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__359c1b32, nullptr, (TypeInfo **)__type_info__35141a0_arg_types_var_2498858019, nullptr, 3, 0, nullptr, 28, 0x35141a0, "__lambda", 0 };
+TypeInfo * __type_info__84f900a5_arg_types_var_2498858019[1] = { &__type_info__f989d2eb };
+VarInfo __struct_info__94f18c23_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__84f900a5_arg_types_var_2498858019, nullptr, 1, 0, nullptr, 28, 0x84f900a5, "__finalize", 4 };
+VarInfo * __struct_info__94f18c23_fields[2] =  { &__struct_info__94f18c23_field_0, &__struct_info__94f18c23_field_1 };
+StructInfo __struct_info__94f18c23 = {"_lambda_thismodule_21_102_20", __struct_info__94f18c23_fields, 2, 8, -1, nullptr, 0x94f18c23 };
+TypeInfo * __type_info__7c5bbf0f_arg_types_var_2698301394[2] = { &__type_info__9cc01e42, &__type_info__359c1b32 };
+VarInfo __struct_info__a0d4cfd2_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__7c5bbf0f_arg_types_var_2698301394, nullptr, 2, 0, nullptr, 28, 0x7c5bbf0f, "__lambda", 0 };
+TypeInfo * __type_info__ee0ebf86_arg_types_var_2698301394[1] = { &__type_info__e2c61a5a };
+VarInfo __struct_info__a0d4cfd2_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ee0ebf86_arg_types_var_2698301394, nullptr, 1, 0, nullptr, 28, 0xee0ebf86, "__finalize", 4 };
+VarInfo * __struct_info__a0d4cfd2_fields[2] =  { &__struct_info__a0d4cfd2_field_0, &__struct_info__a0d4cfd2_field_1 };
+StructInfo __struct_info__a0d4cfd2 = {"_lambda_thismodule_25_45_3", __struct_info__a0d4cfd2_fields, 2, 8, -1, nullptr, 0xa0d4cfd2 };
+TypeInfo * __type_info__16cfcb0e_arg_types_var_69261045[2] = { &__type_info__a763ad25, &__type_info__359c1b32 };
+VarInfo __struct_info__420d6f5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__16cfcb0e_arg_types_var_69261045, nullptr, 2, 0, nullptr, 28, 0x16cfcb0e, "__lambda", 0 };
+TypeInfo * __type_info__d662032b_arg_types_var_69261045[1] = { &__type_info__31831b4d };
+VarInfo __struct_info__420d6f5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d662032b_arg_types_var_69261045, nullptr, 1, 0, nullptr, 28, 0xd662032b, "__finalize", 4 };
+VarInfo * __struct_info__420d6f5_fields[2] =  { &__struct_info__420d6f5_field_0, &__struct_info__420d6f5_field_1 };
+StructInfo __struct_info__420d6f5 = {"_lambda_thismodule_28_45_5", __struct_info__420d6f5_fields, 2, 8, -1, nullptr, 0x420d6f5 };
+VarInfo __func_info__2e807d1c_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xce6336d2, "x", 0 };
+VarInfo __func_info__2e807d1c_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x393cbc39, "y", 0 };
+VarInfo * __func_info__2e807d1c_fields[2] =  { &__func_info__2e807d1c_field_0, &__func_info__2e807d1c_field_1 };
+FuncInfo __func_info__2e807d1c = {"invoke block<(x:int const;y:int const):int const> const", "", __func_info__2e807d1c_fields, 2, 32, &__type_info__359c1b32, nullptr,0,0x2e807d1c, 0x0 };
+TypeInfo __type_info__2e18ae36 = { Type::tStructure, &__struct_info__c010eec6, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x2e18ae36 };
+TypeInfo __type_info__5135d324 = { Type::tStructure, &__struct_info__19740234, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5135d324 };
+TypeInfo __type_info__22f531ce = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2e18ae36, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x22f531ce };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x13667ab1 };
+TypeInfo __type_info__fedd0b56 = { Type::tStructure, &__struct_info__c4206aa6, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xfedd0b56 };
+TypeInfo __type_info__46225b25 = { Type::tStructure, &__struct_info__66f7475, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x46225b25 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__f989d2eb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a3f4fbd3, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf989d2eb };
+TypeInfo __type_info__9a0d0d5c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5135d324, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x9a0d0d5c };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__d227aeff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9f8f8597, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd227aeff };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__cf82abc5 = { Type::tStructure, &__struct_info__61688d15, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xcf82abc5 };
+TypeInfo __type_info__a3f4fbd3 = { Type::tStructure, &__struct_info__94f18c23, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xa3f4fbd3 };
+TypeInfo __type_info__6b670f92 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__621a8dfa, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x6b670f92 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__4d68d30e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fedd0b56, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4d68d30e };
+TypeInfo __type_info__f1b9498d = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xf1b9498d };
+TypeInfo __type_info__118f639d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__46225b25, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x118f639d };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0xe6eb6b88 };
+TypeInfo __type_info__260b3481 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x260b3481 };
+TypeInfo __type_info__9f8f8597 = { Type::tStructure, &__struct_info__1ac6a627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x9f8f8597 };
+TypeInfo __type_info__621a8dfa = { Type::tStructure, &__struct_info__b2c7134a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x621a8dfa };
+TypeInfo __type_info__413b3264 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__359c1b32, nullptr, nullptr, nullptr, 0, 0, nullptr, 269, 0x413b3264 };
+TypeInfo __type_info__5b8c1cf3 = { Type::tStructure, &__struct_info__2cd73c83, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x5b8c1cf3 };
+TypeInfo __type_info__9a22bb23 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2b9991b, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x9a22bb23 };
+TypeInfo __type_info__acb4fa6a = { Type::tStructure, &__struct_info__3d6041ba, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xacb4fa6a };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__2b9991b = { Type::tStructure, &__struct_info__305f4bab, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x2b9991b };
+TypeInfo __type_info__a39a690b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5b8c1cf3, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa39a690b };
+TypeInfo __type_info__e2c61a5a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9cc01e42, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe2c61a5a };
+TypeInfo __type_info__f12ff037 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ff7c47f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf12ff037 };
+TypeInfo __type_info__ce703112 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__acb4fa6a, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xce703112 };
+TypeInfo __type_info__d91151bc = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2365, 0xd91151bc };
+TypeInfo __type_info__9cc01e42 = { Type::tStructure, &__struct_info__a0d4cfd2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x9cc01e42 };
+TypeInfo __type_info__8724e88d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cf82abc5, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8724e88d };
+TypeInfo __type_info__a763ad25 = { Type::tStructure, &__struct_info__420d6f5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xa763ad25 };
+TypeInfo __type_info__4ff7c47f = { Type::tStructure, &__struct_info__59dfbb4f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x4ff7c47f };
+TypeInfo __type_info__31831b4d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a763ad25, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x31831b4d };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__359c1b32 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure FuseMacro
+namespace  {
+
+struct _lambda_thismodule_21_75_1 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_21_75_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_21_75_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_21_75_1)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_75_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_75_1,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_24_65_2 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_24_65_2,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_24_65_2 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_24_65_2)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_24_65_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_24_65_2,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_25_45_3 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_25_45_3,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_25_45_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_25_45_3)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_45_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_45_3,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_27_44_4 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_27_44_4,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_27_44_4 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_27_44_4)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_27_44_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_27_44_4,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_28_45_5 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_28_45_5,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_28_45_5 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_28_45_5)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_45_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_45_5,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_30_46_6 {
+	Func DAS_COMMENT((char *,struct _lambda_thismodule_30_46_6,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_30_46_6 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_30_46_6)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_30_46_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_30_46_6,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_36_49_7 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_36_49_7,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_36_49_7 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_36_49_7)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_49_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_49_7,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_42_62_8 {
+	Func DAS_COMMENT((TArray<int32_t>,struct _lambda_thismodule_42_62_8,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_42_62_8 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_42_62_8)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_42_62_8,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_42_62_8,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_42_111_9 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_42_111_9,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_42_111_9 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_42_111_9)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_42_111_9,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_42_111_9,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_44_65_10 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_44_65_10,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_44_65_10 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_44_65_10)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_44_65_10,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_44_65_10,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_44_19_11 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_44_19_11,int32_t const  * &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_44_19_11 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_44;
+	int32_t x;
+	void * _pvar_0_at_44;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_44;
+};
+static_assert(sizeof(_lambda_thismodule_44_19_11)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_44_19_11,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_44_19_11,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_44_19_11,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_44_19_11,_loop_at_44)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_44_19_11,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_44_19_11,_pvar_0_at_44)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_44_19_11,_source_0_at_44)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_21_44_12 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_21_44_12,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_21_44_12 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_21_44_12)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_44_12,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_44_12,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_12_13 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_9_12_13,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_9_12_13 *)) __finalize;
+	int32_t __yield;
+	Func DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t &)) src;
+	bool _loop_at_9;
+	Sequence DAS_COMMENT((int32_t &)) _source_0_at_9;
+	int32_t * w;
+	void * _pvar_0_at_9;
+};
+static_assert(sizeof(_lambda_thismodule_9_12_13)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_13,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_13,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_13,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_13,blk)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_13,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_13,_loop_at_9)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_13,_source_0_at_9)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_13,w)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_13,_pvar_0_at_9)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_12_14 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_9_12_14,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_9_12_14 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t &)) src;
+	bool _loop_at_9;
+	Sequence DAS_COMMENT((int32_t &)) _source_0_at_9;
+	int32_t * w;
+	void * _pvar_0_at_9;
+};
+static_assert(sizeof(_lambda_thismodule_9_12_14)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_14,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_14,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_14,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_14,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_14,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_14,_loop_at_9)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_14,_source_0_at_9)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_14,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_14,_pvar_0_at_9)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_15 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_15,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_15 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_31;
+	int32_t w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_15)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_15,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_15,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_15,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_15,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_15,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_15,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_15,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_15,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_15,_pvar_0_at_31)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_16 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_16,bool &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_16 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t &)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((int32_t &)) _source_0_at_31;
+	int32_t * w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_16)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_16,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_16,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_16,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_16,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_16,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_16,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_16,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_16,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_16,_pvar_0_at_31)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_17 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_17,char * &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_17 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((char *,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t &)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((int32_t &)) _source_0_at_31;
+	int32_t * w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_17)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_17,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_17,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_17,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_17,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_17,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_17,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_17,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_17,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_17,_pvar_0_at_31)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_12_18 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_9_12_18,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_9_12_18 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t const  &)) src;
+	bool _loop_at_9;
+	Sequence DAS_COMMENT((int32_t const  &)) _source_0_at_9;
+	int32_t const  * w;
+	void * _pvar_0_at_9;
+};
+static_assert(sizeof(_lambda_thismodule_9_12_18)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_18,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_18,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_18,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_18,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_18,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_18,_loop_at_9)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_18,_source_0_at_9)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_18,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_12_18,_pvar_0_at_9)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_36_12_19 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_36_12_19,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_36_12_19 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((TArray<int32_t>,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_36;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_36;
+	int32_t w;
+	void * _pvar_0_at_36;
+};
+static_assert(sizeof(_lambda_thismodule_36_12_19)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_19,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_19,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_19,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_19,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_19,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_19,_loop_at_36)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_19,_source_0_at_36)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_19,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_19,_pvar_0_at_36)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_21_102_20 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_21_102_20,int32_t,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_21_102_20 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_21_102_20)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_102_20,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_102_20,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_21 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_21,bool &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_21 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_31;
+	int32_t w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_21)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_21,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_21,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_21,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_21,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_21,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_21,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_21,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_21,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_21,_pvar_0_at_31)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_31_12_22 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_31_12_22,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_31_12_22 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	bool _loop_at_31;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_31;
+	TArray<int32_t> w;
+	void * _pvar_0_at_31;
+};
+static_assert(sizeof(_lambda_thismodule_31_12_22)==80,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_22,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_22,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_22,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_22,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_22,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_22,_loop_at_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_22,_source_0_at_31)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_22,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_31_12_22,_pvar_0_at_31)==72,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_21_102_20_0x60_finazlier_daaa7d53f85c428e ( Context * __context__, struct _lambda_thismodule_21_102_20 * ____this_rename_at_21 );
+inline int32_t _Func_lambda_thismodule_21_102_20_0x60_function_1d7408febde2c655 ( Context * __context__, struct _lambda_thismodule_21_102_20 & ____this_rename_at_21, int32_t __l_rename_at_21, int32_t __r_rename_at_21 );
+inline void _Func_lambda_thismodule_21_44_12_0x60_finazlier_a55a66d70ce5dc80 ( Context * __context__, struct _lambda_thismodule_21_44_12 * ____this_rename_at_21 );
+inline bool _Func_lambda_thismodule_21_44_12_0x60_function_cf3d1869c4b0b67d ( Context * __context__, struct _lambda_thismodule_21_44_12 & ____this_rename_at_21, int32_t __x_rename_at_21 );
+inline void _Func_lambda_thismodule_21_75_1_0x60_finazlier_9944fce65ee32a06 ( Context * __context__, struct _lambda_thismodule_21_75_1 * ____this_rename_at_21 );
+inline int32_t _Func_lambda_thismodule_21_75_1_0x60_function_85bc034299515afc ( Context * __context__, struct _lambda_thismodule_21_75_1 & ____this_rename_at_21, int32_t __x_rename_at_21 );
+inline void _Func_lambda_thismodule_24_65_2_0x60_finazlier_9fbbc9007bbc2efe ( Context * __context__, struct _lambda_thismodule_24_65_2 * ____this_rename_at_24 );
+inline bool _Func_lambda_thismodule_24_65_2_0x60_function_31da283becfbee3c ( Context * __context__, struct _lambda_thismodule_24_65_2 & ____this_rename_at_24, int32_t __x_rename_at_24 );
+inline void _Func_lambda_thismodule_25_45_3_0x60_finazlier_97da0e5a7490a5be ( Context * __context__, struct _lambda_thismodule_25_45_3 * ____this_rename_at_25 );
+inline bool _Func_lambda_thismodule_25_45_3_0x60_function_18487410b689f0fb ( Context * __context__, struct _lambda_thismodule_25_45_3 & ____this_rename_at_25, int32_t __x_rename_at_25 );
+inline void _Func_lambda_thismodule_27_44_4_0x60_finazlier_943630c536e448b6 ( Context * __context__, struct _lambda_thismodule_27_44_4 * ____this_rename_at_27 );
+inline bool _Func_lambda_thismodule_27_44_4_0x60_function_3123312c3d86409a ( Context * __context__, struct _lambda_thismodule_27_44_4 & ____this_rename_at_27, int32_t __x_rename_at_27 );
+inline void _Func_lambda_thismodule_28_45_5_0x60_finazlier_7fcbf5efd09393c2 ( Context * __context__, struct _lambda_thismodule_28_45_5 * ____this_rename_at_28 );
+inline bool _Func_lambda_thismodule_28_45_5_0x60_function_6499c8c0ab11aa60 ( Context * __context__, struct _lambda_thismodule_28_45_5 & ____this_rename_at_28, int32_t __x_rename_at_28 );
+inline void _Func_lambda_thismodule_30_46_6_0x60_finazlier_4223ddbabe490f1e ( Context * __context__, struct _lambda_thismodule_30_46_6 * ____this_rename_at_30 );
+inline char * _Func_lambda_thismodule_30_46_6_0x60_function_40617bfe75411115 ( Context * __context__, struct _lambda_thismodule_30_46_6 & ____this_rename_at_30, int32_t __x_rename_at_30 );
+inline void _Func_lambda_thismodule_36_49_7_0x60_finazlier_523d33c53c9fe69e ( Context * __context__, struct _lambda_thismodule_36_49_7 * ____this_rename_at_36 );
+inline int32_t _Func_lambda_thismodule_36_49_7_0x60_function_da68bba897c6c415 ( Context * __context__, struct _lambda_thismodule_36_49_7 & ____this_rename_at_36, int32_t __x_rename_at_36 );
+inline void _Func_lambda_thismodule_42_111_9_0x60_finazlier_c7537350c13ead0c ( Context * __context__, struct _lambda_thismodule_42_111_9 * ____this_rename_at_42 );
+inline int32_t _Func_lambda_thismodule_42_111_9_0x60_function_2e743044afa3e13 ( Context * __context__, struct _lambda_thismodule_42_111_9 & ____this_rename_at_42, TArray<int32_t> const  & __x_rename_at_42 );
+inline void _Func_lambda_thismodule_42_62_8_0x60_finazlier_99c50d8d74c4cd62 ( Context * __context__, struct _lambda_thismodule_42_62_8 * ____this_rename_at_42 );
+inline TArray<int32_t> _Func_lambda_thismodule_42_62_8_0x60_function_d7968ed40fc2505f ( Context * __context__, struct _lambda_thismodule_42_62_8 & ____this_rename_at_42, int32_t __x_rename_at_42 );
+inline void _Func_lambda_thismodule_44_19_11_0x60_finazlier_83c72f243428b49a ( Context * __context__, struct _lambda_thismodule_44_19_11 * ____this_rename_at_44 );
+inline bool _Func_lambda_thismodule_44_19_11_0x60_function_a0d453816ffb8d7b ( Context * __context__, struct _lambda_thismodule_44_19_11 & ____this_rename_at_44, int32_t const  * & ___ryield44_rename_at_44 );
+inline void _Func_lambda_thismodule_44_65_10_0x60_finazlier_bff2cdc29f861f88 ( Context * __context__, struct _lambda_thismodule_44_65_10 * ____this_rename_at_44 );
+inline bool _Func_lambda_thismodule_44_65_10_0x60_function_8d8b3f8c92addd8d ( Context * __context__, struct _lambda_thismodule_44_65_10 & ____this_rename_at_44, int32_t __x_rename_at_44 );
+inline void _Func_lambda_thismodule_9_12_18_0x60_finazlier_834d749ba8665f2c ( Context * __context__, struct _lambda_thismodule_9_12_18 * ____this_rename_at_9 );
+inline bool _Func_lambda_thismodule_9_12_18_0x60_function_3268a3ea4603287a ( Context * __context__, struct _lambda_thismodule_9_12_18 & ____this_rename_at_9, int32_t & ___yield_9_rename_at_9 );
+inline int32_t _Func_0x60_fuse_0x60_0x15_0x60_0x10_0x60_8_403c69d153a95450 ( Context * __context__, TArray<int32_t> const  & ____src_rename_at_21, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_21, Lambda DAS_COMMENT((int32_t,int32_t)) const  ____fn1_rename_at_21, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  ____fnr_rename_at_21 );
+inline bool _Func_0x60_fuse_0x60_0x18_0x60_0xf_0x60_9_f03efcd58dd45964 ( Context * __context__, TArray<int32_t> const  & ____src_rename_at_24, Func DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_24, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn1_rename_at_24 );
+inline bool _Func_0x60_fuse_0x60_0x19_0x60_0x10_0x60_5_9a8b172999ba9f01 ( Context * __context__, TArray<int32_t> const  & ____src_rename_at_25, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_25 );
+inline bool _Func_0x60_fuse_0x60_0x1b_0x60_0xf_0x60_6_7ac4336544d7b9d9 ( Context * __context__, TArray<int32_t> const  & ____src_rename_at_27, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_27 );
+inline bool _Func_0x60_fuse_0x60_0x1c_0x60_0x10_0x60_7_7ac4336544d7b9d9 ( Context * __context__, TArray<int32_t> const  & ____src_rename_at_28, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_28 );
+inline TArray<char *> _Func_0x60_fuse_0x60_0x1e_0x60_0x11_0x60_3_4e879ffaa2729330 ( Context * __context__, TArray<int32_t> const  & ____src_rename_at_30, Lambda DAS_COMMENT((char *,int32_t)) const  ____fn0_rename_at_30 );
+inline int32_t _Func_0x60_fuse_0x60_0x22_0x60_0xb_0x60_2_be98a67d6dcd979e ( Context * __context__, range ____src_rename_at_34, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & ____fnr_rename_at_34 );
+inline int32_t _Func_0x60_fuse_0x60_0x24_0x60_0xb_0x60_4_3fd75b20f1ca4be3 ( Context * __context__, range ____src_rename_at_36, Lambda DAS_COMMENT((int32_t,int32_t)) const  ____fn0_rename_at_36 );
+inline int32_t _Func_0x60_fuse_0x60_0x28_0x60_0xf_0x60_0_b98037552cc52b12 ( Context * __context__, TDim<int32_t,4> const  & ____src_rename_at_40 );
+inline int32_t _Func_0x60_fuse_0x60_0x2a_0x60_0xb_0x60_10_eb138f9ebbd86045 ( Context * __context__, range ____src_rename_at_42, Lambda DAS_COMMENT((TArray<int32_t>,int32_t)) const  ____fn0_rename_at_42, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  ____fn1_rename_at_42 );
+inline int32_t _Func_0x60_fuse_0x60_0xc_0x60_0xb_0x60_1_d4d83d9f9ab6a727 ( Context * __context__, range ____src_rename_at_12, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  ____fnr_rename_at_12 );
+inline int32_t add_71ce43625bcdc5ea ( Context * __context__, int32_t __a_rename_at_7, int32_t __b_rename_at_7 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_53ccff887674360c ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_ref_633ef44731ea6497 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_364 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_clone_8f1b55668745e84b ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_398 );
+inline void finalize_75c78ab81820c121 ( Context * __context__, struct _lambda_thismodule_21_102_20 & ____this_rename_at_21 );
+inline void finalize_203ea923e126959 ( Context * __context__, struct _lambda_thismodule_21_44_12 & ____this_rename_at_21 );
+inline void finalize_5cf8c7d48b500845 ( Context * __context__, struct _lambda_thismodule_21_75_1 & ____this_rename_at_21 );
+inline void finalize_a0789d353c46a5be ( Context * __context__, struct _lambda_thismodule_24_65_2 & ____this_rename_at_24 );
+inline void finalize_fc208f90c9d578ca ( Context * __context__, struct _lambda_thismodule_25_45_3 & ____this_rename_at_25 );
+inline void finalize_f795195b1ae63086 ( Context * __context__, struct _lambda_thismodule_27_44_4 & ____this_rename_at_27 );
+inline void finalize_9a4abb41dc4938b ( Context * __context__, struct _lambda_thismodule_28_45_5 & ____this_rename_at_28 );
+inline void finalize_a86350df0e4a23da ( Context * __context__, struct _lambda_thismodule_30_46_6 & ____this_rename_at_30 );
+inline void finalize_b607403d58c33846 ( Context * __context__, struct _lambda_thismodule_36_49_7 & ____this_rename_at_36 );
+inline void finalize_4ced6efe5ad97651 ( Context * __context__, struct _lambda_thismodule_42_111_9 & ____this_rename_at_42 );
+inline void finalize_532789b2125b436b ( Context * __context__, struct _lambda_thismodule_42_62_8 & ____this_rename_at_42 );
+inline void finalize_6e1ba8ffdf83cbb7 ( Context * __context__, struct _lambda_thismodule_44_19_11 & ____this_rename_at_44 );
+inline void finalize_a8c047447a324af9 ( Context * __context__, struct _lambda_thismodule_44_65_10 & ____this_rename_at_44 );
+inline void finalize_75ec7552d4893c12 ( Context * __context__, struct _lambda_thismodule_9_12_18 & ____this_rename_at_9 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_92865bc2a7c29ca8 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) & __src_rename_at_20, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_20 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_35324f3a0bbae07 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) & __src_rename_at_6, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_6 );
+inline int32_t _Funcfunctional_0x60_sum_ea2762a9b6c828a6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_82 );
+inline int32_t fuse_reduce_empty_20ab859a8c383e64 ( Context * __context__ );
+inline bool is_even_6d9eabfbf704f1dc ( Context * __context__, int32_t __x_rename_at_4 );
+inline bool test_3d90d5265e899f5f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_21_102_20_0x60_finazlier_daaa7d53f85c428e ( Context * __context__, struct _lambda_thismodule_21_102_20 * ____this_rename_at_21 )
+{
+	finalize_75c78ab81820c121(__context__,das_arg<struct _lambda_thismodule_21_102_20>::pass(das_deref(__context__,____this_rename_at_21)));
+	das_delete_lambda_struct<struct _lambda_thismodule_21_102_20 *>::clear(__context__,____this_rename_at_21);
+}
+
+inline int32_t _Func_lambda_thismodule_21_102_20_0x60_function_1d7408febde2c655 ( Context * __context__, struct _lambda_thismodule_21_102_20 &  ____this_rename_at_21, int32_t __l_rename_at_21, int32_t __r_rename_at_21 )
+{
+	return __l_rename_at_21 + __r_rename_at_21;
+}
+
+inline void _Func_lambda_thismodule_21_44_12_0x60_finazlier_a55a66d70ce5dc80 ( Context * __context__, struct _lambda_thismodule_21_44_12 * ____this_rename_at_21 )
+{
+	finalize_203ea923e126959(__context__,das_arg<struct _lambda_thismodule_21_44_12>::pass(das_deref(__context__,____this_rename_at_21)));
+	das_delete_lambda_struct<struct _lambda_thismodule_21_44_12 *>::clear(__context__,____this_rename_at_21);
+}
+
+inline bool _Func_lambda_thismodule_21_44_12_0x60_function_cf3d1869c4b0b67d ( Context * __context__, struct _lambda_thismodule_21_44_12 &  ____this_rename_at_21, int32_t __x_rename_at_21 )
+{
+	return (SimPolicy<int32_t>::Mod(__x_rename_at_21,2,*__context__)) == 0;
+}
+
+inline void _Func_lambda_thismodule_21_75_1_0x60_finazlier_9944fce65ee32a06 ( Context * __context__, struct _lambda_thismodule_21_75_1 * ____this_rename_at_21 )
+{
+	finalize_5cf8c7d48b500845(__context__,das_arg<struct _lambda_thismodule_21_75_1>::pass(das_deref(__context__,____this_rename_at_21)));
+	das_delete_lambda_struct<struct _lambda_thismodule_21_75_1 *>::clear(__context__,____this_rename_at_21);
+}
+
+inline int32_t _Func_lambda_thismodule_21_75_1_0x60_function_85bc034299515afc ( Context * __context__, struct _lambda_thismodule_21_75_1 &  ____this_rename_at_21, int32_t __x_rename_at_21 )
+{
+	return __x_rename_at_21 * 3;
+}
+
+inline void _Func_lambda_thismodule_24_65_2_0x60_finazlier_9fbbc9007bbc2efe ( Context * __context__, struct _lambda_thismodule_24_65_2 * ____this_rename_at_24 )
+{
+	finalize_a0789d353c46a5be(__context__,das_arg<struct _lambda_thismodule_24_65_2>::pass(das_deref(__context__,____this_rename_at_24)));
+	das_delete_lambda_struct<struct _lambda_thismodule_24_65_2 *>::clear(__context__,____this_rename_at_24);
+}
+
+inline bool _Func_lambda_thismodule_24_65_2_0x60_function_31da283becfbee3c ( Context * __context__, struct _lambda_thismodule_24_65_2 &  ____this_rename_at_24, int32_t __x_rename_at_24 )
+{
+	return __x_rename_at_24 < 100;
+}
+
+inline void _Func_lambda_thismodule_25_45_3_0x60_finazlier_97da0e5a7490a5be ( Context * __context__, struct _lambda_thismodule_25_45_3 * ____this_rename_at_25 )
+{
+	finalize_fc208f90c9d578ca(__context__,das_arg<struct _lambda_thismodule_25_45_3>::pass(das_deref(__context__,____this_rename_at_25)));
+	das_delete_lambda_struct<struct _lambda_thismodule_25_45_3 *>::clear(__context__,____this_rename_at_25);
+}
+
+inline bool _Func_lambda_thismodule_25_45_3_0x60_function_18487410b689f0fb ( Context * __context__, struct _lambda_thismodule_25_45_3 &  ____this_rename_at_25, int32_t __x_rename_at_25 )
+{
+	return __x_rename_at_25 < 9;
+}
+
+inline void _Func_lambda_thismodule_27_44_4_0x60_finazlier_943630c536e448b6 ( Context * __context__, struct _lambda_thismodule_27_44_4 * ____this_rename_at_27 )
+{
+	finalize_f795195b1ae63086(__context__,das_arg<struct _lambda_thismodule_27_44_4>::pass(das_deref(__context__,____this_rename_at_27)));
+	das_delete_lambda_struct<struct _lambda_thismodule_27_44_4 *>::clear(__context__,____this_rename_at_27);
+}
+
+inline bool _Func_lambda_thismodule_27_44_4_0x60_function_3123312c3d86409a ( Context * __context__, struct _lambda_thismodule_27_44_4 &  ____this_rename_at_27, int32_t __x_rename_at_27 )
+{
+	return __x_rename_at_27 > 8;
+}
+
+inline void _Func_lambda_thismodule_28_45_5_0x60_finazlier_7fcbf5efd09393c2 ( Context * __context__, struct _lambda_thismodule_28_45_5 * ____this_rename_at_28 )
+{
+	finalize_9a4abb41dc4938b(__context__,das_arg<struct _lambda_thismodule_28_45_5>::pass(das_deref(__context__,____this_rename_at_28)));
+	das_delete_lambda_struct<struct _lambda_thismodule_28_45_5 *>::clear(__context__,____this_rename_at_28);
+}
+
+inline bool _Func_lambda_thismodule_28_45_5_0x60_function_6499c8c0ab11aa60 ( Context * __context__, struct _lambda_thismodule_28_45_5 &  ____this_rename_at_28, int32_t __x_rename_at_28 )
+{
+	return __x_rename_at_28 > 9;
+}
+
+inline void _Func_lambda_thismodule_30_46_6_0x60_finazlier_4223ddbabe490f1e ( Context * __context__, struct _lambda_thismodule_30_46_6 * ____this_rename_at_30 )
+{
+	finalize_a86350df0e4a23da(__context__,das_arg<struct _lambda_thismodule_30_46_6>::pass(das_deref(__context__,____this_rename_at_30)));
+	das_delete_lambda_struct<struct _lambda_thismodule_30_46_6 *>::clear(__context__,____this_rename_at_30);
+}
+
+inline char * _Func_lambda_thismodule_30_46_6_0x60_function_40617bfe75411115 ( Context * __context__, struct _lambda_thismodule_30_46_6 &  ____this_rename_at_30, int32_t __x_rename_at_30 )
+{
+	return das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(__x_rename_at_30)));
+}
+
+inline void _Func_lambda_thismodule_36_49_7_0x60_finazlier_523d33c53c9fe69e ( Context * __context__, struct _lambda_thismodule_36_49_7 * ____this_rename_at_36 )
+{
+	finalize_b607403d58c33846(__context__,das_arg<struct _lambda_thismodule_36_49_7>::pass(das_deref(__context__,____this_rename_at_36)));
+	das_delete_lambda_struct<struct _lambda_thismodule_36_49_7 *>::clear(__context__,____this_rename_at_36);
+}
+
+inline int32_t _Func_lambda_thismodule_36_49_7_0x60_function_da68bba897c6c415 ( Context * __context__, struct _lambda_thismodule_36_49_7 &  ____this_rename_at_36, int32_t __x_rename_at_36 )
+{
+	return __x_rename_at_36 * __x_rename_at_36;
+}
+
+inline void _Func_lambda_thismodule_42_111_9_0x60_finazlier_c7537350c13ead0c ( Context * __context__, struct _lambda_thismodule_42_111_9 * ____this_rename_at_42 )
+{
+	finalize_4ced6efe5ad97651(__context__,das_arg<struct _lambda_thismodule_42_111_9>::pass(das_deref(__context__,____this_rename_at_42)));
+	das_delete_lambda_struct<struct _lambda_thismodule_42_111_9 *>::clear(__context__,____this_rename_at_42);
+}
+
+inline int32_t _Func_lambda_thismodule_42_111_9_0x60_function_2e743044afa3e13 ( Context * __context__, struct _lambda_thismodule_42_111_9 &  ____this_rename_at_42, TArray<int32_t> const  &  __x_rename_at_42 )
+{
+	return __x_rename_at_42(0,__context__) + __x_rename_at_42(1,__context__);
+}
+
+inline void _Func_lambda_thismodule_42_62_8_0x60_finazlier_99c50d8d74c4cd62 ( Context * __context__, struct _lambda_thismodule_42_62_8 * ____this_rename_at_42 )
+{
+	finalize_532789b2125b436b(__context__,das_arg<struct _lambda_thismodule_42_62_8>::pass(das_deref(__context__,____this_rename_at_42)));
+	das_delete_lambda_struct<struct _lambda_thismodule_42_62_8 *>::clear(__context__,____this_rename_at_42);
+}
+
+inline TArray<int32_t> _Func_lambda_thismodule_42_62_8_0x60_function_d7968ed40fc2505f ( Context * __context__, struct _lambda_thismodule_42_62_8 &  ____this_rename_at_42, int32_t __x_rename_at_42 )
+{
+	TDim<int32_t,2> _temp_make_local_42_32;
+	return /* <- */ _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_42_32(0,__context__) = __x_rename_at_42;
+		_temp_make_local_42_32(1,__context__) = __x_rename_at_42;
+		return _temp_make_local_42_32;
+	})())));
+}
+
+inline void _Func_lambda_thismodule_44_19_11_0x60_finazlier_83c72f243428b49a ( Context * __context__, struct _lambda_thismodule_44_19_11 * ____this_rename_at_44 )
+{
+	finalize_6e1ba8ffdf83cbb7(__context__,das_arg<struct _lambda_thismodule_44_19_11>::pass(das_deref(__context__,____this_rename_at_44)));
+	das_delete_lambda_struct<struct _lambda_thismodule_44_19_11 *>::clear(__context__,____this_rename_at_44);
+}
+
+inline bool _Func_lambda_thismodule_44_19_11_0x60_function_a0d453816ffb8d7b ( Context * __context__, struct _lambda_thismodule_44_19_11 &  ____this_rename_at_44, int32_t const  * & ___ryield44_rename_at_44 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_44_32;
+	switch (____this_rename_at_44.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_44._loop_at_44,true);
+	das_move(____this_rename_at_44._source_0_at_44,(_temp_make_local_44_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))));
+	memset(&(____this_rename_at_44.x), 0, 4);
+	das_copy(____this_rename_at_44._pvar_0_at_44,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_44.x)));
+	DAS_SETBOOLAND((____this_rename_at_44._loop_at_44),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_44._source_0_at_44),____this_rename_at_44._pvar_0_at_44,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_44._loop_at_44 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield44_rename_at_44,das_ref(__context__,____this_rename_at_44.x));
+	das_copy(____this_rename_at_44.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_44._loop_at_44),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_44._source_0_at_44),____this_rename_at_44._pvar_0_at_44,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_44._source_0_at_44),____this_rename_at_44._pvar_0_at_44,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_44_65_10_0x60_finazlier_bff2cdc29f861f88 ( Context * __context__, struct _lambda_thismodule_44_65_10 * ____this_rename_at_44 )
+{
+	finalize_a8c047447a324af9(__context__,das_arg<struct _lambda_thismodule_44_65_10>::pass(das_deref(__context__,____this_rename_at_44)));
+	das_delete_lambda_struct<struct _lambda_thismodule_44_65_10 *>::clear(__context__,____this_rename_at_44);
+}
+
+inline bool _Func_lambda_thismodule_44_65_10_0x60_function_8d8b3f8c92addd8d ( Context * __context__, struct _lambda_thismodule_44_65_10 &  ____this_rename_at_44, int32_t __x_rename_at_44 )
+{
+	return __x_rename_at_44 > 4;
+}
+
+inline void _Func_lambda_thismodule_9_12_18_0x60_finazlier_834d749ba8665f2c ( Context * __context__, struct _lambda_thismodule_9_12_18 * ____this_rename_at_9 )
+{
+	finalize_75ec7552d4893c12(__context__,das_arg<struct _lambda_thismodule_9_12_18>::pass(das_deref(__context__,____this_rename_at_9)));
+	das_delete_lambda_struct<struct _lambda_thismodule_9_12_18 *>::clear(__context__,____this_rename_at_9);
+}
+
+inline bool _Func_lambda_thismodule_9_12_18_0x60_function_3268a3ea4603287a ( Context * __context__, struct _lambda_thismodule_9_12_18 &  ____this_rename_at_9, int32_t & ___yield_9_rename_at_9 )
+{
+	switch (____this_rename_at_9.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_9._loop_at_9,true);
+	das_move(____this_rename_at_9._source_0_at_9,____this_rename_at_9.src);
+	memset(&(____this_rename_at_9.w), 0, 8);
+	das_copy(____this_rename_at_9._pvar_0_at_9,das_ref(__context__,____this_rename_at_9.w));
+	DAS_SETBOOLAND((____this_rename_at_9._loop_at_9),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_9._loop_at_9 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,____this_rename_at_9.blk,das_deref(__context__,____this_rename_at_9.w)) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_9_rename_at_9,das_deref(__context__,____this_rename_at_9.w));
+	das_copy(____this_rename_at_9.__yield,1);
+	return true;
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_9._loop_at_9),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(____this_rename_at_9._source_0_at_9),____this_rename_at_9._pvar_0_at_9,__context__);
+	return false;
+}
+
+inline int32_t _Func_0x60_fuse_0x60_0x15_0x60_0x10_0x60_8_403c69d153a95450 ( Context * __context__, TArray<int32_t> const  &  ____src_rename_at_21, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_21, Lambda DAS_COMMENT((int32_t,int32_t)) const  ____fn1_rename_at_21, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  ____fnr_rename_at_21 )
+{
+	int32_t ____acc_rename_at_21 = 0;
+	bool ____started_rename_at_21 = 0;
+	{
+		bool __need_loop_21 = true;
+		// __x0 : int aka TT const&
+		das_iterator<TArray<int32_t> const > ____x0_iterator(____src_rename_at_21);
+		int32_t const  * ____x0_rename_at_21;
+		__need_loop_21 = ____x0_iterator.first(__context__,(____x0_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = ____x0_iterator.next(__context__,(____x0_rename_at_21)) )
+		{
+			if ( das_invoke_lambda<bool>::invoke<int32_t>(__context__,____fn0_rename_at_21,(*____x0_rename_at_21)) )
+			{
+				int32_t ____x2_rename_at_21; das_zero(____x2_rename_at_21); das_move(____x2_rename_at_21, das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,____fn1_rename_at_21,(*____x0_rename_at_21)));
+				if ( ____started_rename_at_21 )
+				{
+					das_copy(____acc_rename_at_21,das_invoke_lambda<int32_t>::invoke<int32_t,int32_t>(__context__,____fnr_rename_at_21,____acc_rename_at_21,____x2_rename_at_21));
+				} else {
+					das_copy(____started_rename_at_21,true);
+					das_copy(____acc_rename_at_21,____x2_rename_at_21);
+				};
+			};
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_21));
+	};
+	if ( !____started_rename_at_21 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return ____acc_rename_at_21;
+}
+
+inline bool _Func_0x60_fuse_0x60_0x18_0x60_0xf_0x60_9_f03efcd58dd45964 ( Context * __context__, TArray<int32_t> const  &  ____src_rename_at_24, Func DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_24, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn1_rename_at_24 )
+{
+	{
+		bool __need_loop_24 = true;
+		// __x0 : int aka TT const&
+		das_iterator<TArray<int32_t> const > ____x0_iterator(____src_rename_at_24);
+		int32_t const  * ____x0_rename_at_24;
+		__need_loop_24 = ____x0_iterator.first(__context__,(____x0_rename_at_24)) && __need_loop_24;
+		for ( ; __need_loop_24 ; __need_loop_24 = ____x0_iterator.next(__context__,(____x0_rename_at_24)) )
+		{
+			if ( das_invoke_function<bool>::invoke<int32_t>(__context__,____fn0_rename_at_24,(*____x0_rename_at_24)) )
+			{
+				bool ____x2_rename_at_24; das_zero(____x2_rename_at_24); das_move(____x2_rename_at_24, das_invoke_lambda<bool>::invoke<int32_t>(__context__,____fn1_rename_at_24,(*____x0_rename_at_24)));
+				if ( !____x2_rename_at_24 )
+				{
+					return false;
+				};
+			};
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_24));
+	};
+	return true;
+}
+
+inline bool _Func_0x60_fuse_0x60_0x19_0x60_0x10_0x60_5_9a8b172999ba9f01 ( Context * __context__, TArray<int32_t> const  &  ____src_rename_at_25, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_25 )
+{
+	{
+		bool __need_loop_25 = true;
+		// __x0 : int aka TT const&
+		das_iterator<TArray<int32_t> const > ____x0_iterator(____src_rename_at_25);
+		int32_t const  * ____x0_rename_at_25;
+		__need_loop_25 = ____x0_iterator.first(__context__,(____x0_rename_at_25)) && __need_loop_25;
+		for ( ; __need_loop_25 ; __need_loop_25 = ____x0_iterator.next(__context__,(____x0_rename_at_25)) )
+		{
+			bool ____x1_rename_at_25; das_zero(____x1_rename_at_25); das_move(____x1_rename_at_25, das_invoke_lambda<bool>::invoke<int32_t>(__context__,____fn0_rename_at_25,(*____x0_rename_at_25)));
+			if ( !____x1_rename_at_25 )
+			{
+				return false;
+			};
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_25));
+	};
+	return true;
+}
+
+inline bool _Func_0x60_fuse_0x60_0x1b_0x60_0xf_0x60_6_7ac4336544d7b9d9 ( Context * __context__, TArray<int32_t> const  &  ____src_rename_at_27, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_27 )
+{
+	{
+		bool __need_loop_27 = true;
+		// __x0 : int aka TT const&
+		das_iterator<TArray<int32_t> const > ____x0_iterator(____src_rename_at_27);
+		int32_t const  * ____x0_rename_at_27;
+		__need_loop_27 = ____x0_iterator.first(__context__,(____x0_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = ____x0_iterator.next(__context__,(____x0_rename_at_27)) )
+		{
+			bool ____x1_rename_at_27; das_zero(____x1_rename_at_27); das_move(____x1_rename_at_27, das_invoke_lambda<bool>::invoke<int32_t>(__context__,____fn0_rename_at_27,(*____x0_rename_at_27)));
+			if ( ____x1_rename_at_27 )
+			{
+				return true;
+			};
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_27));
+	};
+	return false;
+}
+
+inline bool _Func_0x60_fuse_0x60_0x1c_0x60_0x10_0x60_7_7ac4336544d7b9d9 ( Context * __context__, TArray<int32_t> const  &  ____src_rename_at_28, Lambda DAS_COMMENT((bool,int32_t)) const  ____fn0_rename_at_28 )
+{
+	{
+		bool __need_loop_28 = true;
+		// __x0 : int aka TT const&
+		das_iterator<TArray<int32_t> const > ____x0_iterator(____src_rename_at_28);
+		int32_t const  * ____x0_rename_at_28;
+		__need_loop_28 = ____x0_iterator.first(__context__,(____x0_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = ____x0_iterator.next(__context__,(____x0_rename_at_28)) )
+		{
+			bool ____x1_rename_at_28; das_zero(____x1_rename_at_28); das_move(____x1_rename_at_28, das_invoke_lambda<bool>::invoke<int32_t>(__context__,____fn0_rename_at_28,(*____x0_rename_at_28)));
+			if ( ____x1_rename_at_28 )
+			{
+				return true;
+			};
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_28));
+	};
+	return false;
+}
+
+inline TArray<char *> _Func_0x60_fuse_0x60_0x1e_0x60_0x11_0x60_3_4e879ffaa2729330 ( Context * __context__, TArray<int32_t> const  &  ____src_rename_at_30, Lambda DAS_COMMENT((char *,int32_t)) const  ____fn0_rename_at_30 )
+{
+	TArray<char *> ____acc_rename_at_30; das_zero(____acc_rename_at_30);
+	{
+		bool __need_loop_30 = true;
+		// __x0 : int aka TT const&
+		das_iterator<TArray<int32_t> const > ____x0_iterator(____src_rename_at_30);
+		int32_t const  * ____x0_rename_at_30;
+		__need_loop_30 = ____x0_iterator.first(__context__,(____x0_rename_at_30)) && __need_loop_30;
+		for ( ; __need_loop_30 ; __need_loop_30 = ____x0_iterator.next(__context__,(____x0_rename_at_30)) )
+		{
+			char * ____x1_rename_at_30; das_zero(____x1_rename_at_30); das_move(____x1_rename_at_30, (char *)(das_invoke_lambda<char *>::invoke<int32_t>(__context__,____fn0_rename_at_30,(*____x0_rename_at_30))));
+			_Funcbuiltin_0x60_push_clone_8f1b55668745e84b(__context__,das_arg<TArray<char *>>::pass(____acc_rename_at_30),____x1_rename_at_30,-1);
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_30));
+	};
+	return /* <- */ ____acc_rename_at_30;
+}
+
+inline int32_t _Func_0x60_fuse_0x60_0x22_0x60_0xb_0x60_2_be98a67d6dcd979e ( Context * __context__, range ____src_rename_at_34, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ____fnr_rename_at_34 )
+{
+	int32_t ____acc_rename_at_34 = 0;
+	bool ____started_rename_at_34 = 0;
+	{
+		bool __need_loop_34 = true;
+		// __x0 : int const
+		das_iterator<range> ____x0_iterator(____src_rename_at_34);
+		int32_t ____x0_rename_at_34;
+		__need_loop_34 = ____x0_iterator.first(__context__,(____x0_rename_at_34)) && __need_loop_34;
+		for ( ; __need_loop_34 ; __need_loop_34 = ____x0_iterator.next(__context__,(____x0_rename_at_34)) )
+		{
+			if ( ____started_rename_at_34 )
+			{
+				das_copy(____acc_rename_at_34,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,____fnr_rename_at_34,____acc_rename_at_34,____x0_rename_at_34));
+			} else {
+				das_copy(____started_rename_at_34,true);
+				das_copy(____acc_rename_at_34,____x0_rename_at_34);
+			};
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_34));
+	};
+	if ( !____started_rename_at_34 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return ____acc_rename_at_34;
+}
+
+inline int32_t _Func_0x60_fuse_0x60_0x24_0x60_0xb_0x60_4_3fd75b20f1ca4be3 ( Context * __context__, range ____src_rename_at_36, Lambda DAS_COMMENT((int32_t,int32_t)) const  ____fn0_rename_at_36 )
+{
+	int32_t ____acc_rename_at_36 = 0;
+	{
+		bool __need_loop_36 = true;
+		// __x0 : int const
+		das_iterator<range> ____x0_iterator(____src_rename_at_36);
+		int32_t ____x0_rename_at_36;
+		__need_loop_36 = ____x0_iterator.first(__context__,(____x0_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = ____x0_iterator.next(__context__,(____x0_rename_at_36)) )
+		{
+			int32_t ____x1_rename_at_36; das_zero(____x1_rename_at_36); das_move(____x1_rename_at_36, das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,____fn0_rename_at_36,____x0_rename_at_36));
+			____acc_rename_at_36 += ____x1_rename_at_36;
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_36));
+	};
+	return ____acc_rename_at_36;
+}
+
+inline int32_t _Func_0x60_fuse_0x60_0x28_0x60_0xf_0x60_0_b98037552cc52b12 ( Context * __context__, TDim<int32_t,4> const  &  ____src_rename_at_40 )
+{
+	int32_t ____acc_rename_at_40 = 0;
+	{
+		bool __need_loop_40 = true;
+		// __x0 : int aka TT const&
+		das_iterator<TDim<int32_t,4> const > ____x0_iterator(____src_rename_at_40);
+		int32_t const  * ____x0_rename_at_40;
+		__need_loop_40 = ____x0_iterator.first(__context__,(____x0_rename_at_40)) && __need_loop_40;
+		for ( ; __need_loop_40 ; __need_loop_40 = ____x0_iterator.next(__context__,(____x0_rename_at_40)) )
+		{
+			____acc_rename_at_40 += (*____x0_rename_at_40);
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_40));
+	};
+	return ____acc_rename_at_40;
+}
+
+inline int32_t _Func_0x60_fuse_0x60_0x2a_0x60_0xb_0x60_10_eb138f9ebbd86045 ( Context * __context__, range ____src_rename_at_42, Lambda DAS_COMMENT((TArray<int32_t>,int32_t)) const  ____fn0_rename_at_42, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  ____fn1_rename_at_42 )
+{
+	int32_t ____acc_rename_at_42 = 0;
+	{
+		bool __need_loop_42 = true;
+		// __x0 : int const
+		das_iterator<range> ____x0_iterator(____src_rename_at_42);
+		int32_t ____x0_rename_at_42;
+		__need_loop_42 = ____x0_iterator.first(__context__,(____x0_rename_at_42)) && __need_loop_42;
+		for ( ; __need_loop_42 ; __need_loop_42 = ____x0_iterator.next(__context__,(____x0_rename_at_42)) )
+		{
+			TArray<int32_t> ____x1_rename_at_42; das_zero(____x1_rename_at_42); das_move(____x1_rename_at_42, das_invoke_lambda<TArray<int32_t>>::invoke_cmres<int32_t>(__context__,____fn0_rename_at_42,____x0_rename_at_42));
+			int32_t ____x2_rename_at_42; das_zero(____x2_rename_at_42); das_move(____x2_rename_at_42, das_invoke_lambda<int32_t>::invoke<TArray<int32_t> &>(__context__,____fn1_rename_at_42,das_arg<TArray<int32_t>>::pass(____x1_rename_at_42)));
+			____acc_rename_at_42 += ____x2_rename_at_42;
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_42));
+	};
+	return ____acc_rename_at_42;
+}
+
+inline int32_t _Func_0x60_fuse_0x60_0xc_0x60_0xb_0x60_1_d4d83d9f9ab6a727 ( Context * __context__, range ____src_rename_at_12, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  ____fnr_rename_at_12 )
+{
+	int32_t ____acc_rename_at_12 = 0;
+	bool ____started_rename_at_12 = 0;
+	{
+		bool __need_loop_12 = true;
+		// __x0 : int const
+		das_iterator<range> ____x0_iterator(____src_rename_at_12);
+		int32_t ____x0_rename_at_12;
+		__need_loop_12 = ____x0_iterator.first(__context__,(____x0_rename_at_12)) && __need_loop_12;
+		for ( ; __need_loop_12 ; __need_loop_12 = ____x0_iterator.next(__context__,(____x0_rename_at_12)) )
+		{
+			if ( ____started_rename_at_12 )
+			{
+				das_copy(____acc_rename_at_12,das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,____fnr_rename_at_12,____acc_rename_at_12,____x0_rename_at_12));
+			} else {
+				das_copy(____started_rename_at_12,true);
+				das_copy(____acc_rename_at_12,____x0_rename_at_12);
+			};
+		}
+		____x0_iterator.close(__context__,(____x0_rename_at_12));
+	};
+	if ( !____started_rename_at_12 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return ____acc_rename_at_12;
+}
+
+inline int32_t add_71ce43625bcdc5ea ( Context * __context__, int32_t __a_rename_at_7, int32_t __b_rename_at_7 )
+{
+	return __a_rename_at_7 + __b_rename_at_7;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_53ccff887674360c ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_334; das_zero(__it_rename_at_334);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_334),__rng_rename_at_333,__context__);
+	return /* <- */ __it_rename_at_334;
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_ref_633ef44731ea6497 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_364 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_365; das_zero(__it_rename_at_365);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_365),__lam_rename_at_364,__context__);
+	return /* <- */ __it_rename_at_365;
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_8f1b55668745e84b ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),__at_rename_at_75,8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_398 )
+{
+	TArray<int32_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_399),2);
+	das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline void finalize_75c78ab81820c121 ( Context * __context__, struct _lambda_thismodule_21_102_20 &  ____this_rename_at_21 )
+{
+	memset(&(____this_rename_at_21), 0, 8);
+}
+
+inline void finalize_203ea923e126959 ( Context * __context__, struct _lambda_thismodule_21_44_12 &  ____this_rename_at_21 )
+{
+	memset(&(____this_rename_at_21), 0, 8);
+}
+
+inline void finalize_5cf8c7d48b500845 ( Context * __context__, struct _lambda_thismodule_21_75_1 &  ____this_rename_at_21 )
+{
+	memset(&(____this_rename_at_21), 0, 8);
+}
+
+inline void finalize_a0789d353c46a5be ( Context * __context__, struct _lambda_thismodule_24_65_2 &  ____this_rename_at_24 )
+{
+	memset(&(____this_rename_at_24), 0, 8);
+}
+
+inline void finalize_fc208f90c9d578ca ( Context * __context__, struct _lambda_thismodule_25_45_3 &  ____this_rename_at_25 )
+{
+	memset(&(____this_rename_at_25), 0, 8);
+}
+
+inline void finalize_f795195b1ae63086 ( Context * __context__, struct _lambda_thismodule_27_44_4 &  ____this_rename_at_27 )
+{
+	memset(&(____this_rename_at_27), 0, 8);
+}
+
+inline void finalize_9a4abb41dc4938b ( Context * __context__, struct _lambda_thismodule_28_45_5 &  ____this_rename_at_28 )
+{
+	memset(&(____this_rename_at_28), 0, 8);
+}
+
+inline void finalize_a86350df0e4a23da ( Context * __context__, struct _lambda_thismodule_30_46_6 &  ____this_rename_at_30 )
+{
+	memset(&(____this_rename_at_30), 0, 8);
+}
+
+inline void finalize_b607403d58c33846 ( Context * __context__, struct _lambda_thismodule_36_49_7 &  ____this_rename_at_36 )
+{
+	memset(&(____this_rename_at_36), 0, 8);
+}
+
+inline void finalize_4ced6efe5ad97651 ( Context * __context__, struct _lambda_thismodule_42_111_9 &  ____this_rename_at_42 )
+{
+	memset(&(____this_rename_at_42), 0, 8);
+}
+
+inline void finalize_532789b2125b436b ( Context * __context__, struct _lambda_thismodule_42_62_8 &  ____this_rename_at_42 )
+{
+	memset(&(____this_rename_at_42), 0, 8);
+}
+
+inline void finalize_6e1ba8ffdf83cbb7 ( Context * __context__, struct _lambda_thismodule_44_19_11 &  ____this_rename_at_44 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_44._source_0_at_44),__context__);
+	memset(&(____this_rename_at_44), 0, 40);
+}
+
+inline void finalize_a8c047447a324af9 ( Context * __context__, struct _lambda_thismodule_44_65_10 &  ____this_rename_at_44 )
+{
+	memset(&(____this_rename_at_44), 0, 8);
+}
+
+inline void finalize_75ec7552d4893c12 ( Context * __context__, struct _lambda_thismodule_9_12_18 &  ____this_rename_at_9 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(____this_rename_at_9._source_0_at_9),__context__);
+	memset(&(____this_rename_at_9), 0, 64);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_92865bc2a7c29ca8 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) &  __src_rename_at_20, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_20 )
+{
+	return /* <- */ _Funcfunctional_0x60_filter_any_35324f3a0bbae07(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__src_rename_at_20),__blk_rename_at_20);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_35324f3a0bbae07 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) &  __src_rename_at_6, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_6 )
+{
+	return /* <- */ _Funcbuiltin_0x60_each_53ccff887674360c(__context__,das_ascend<bool,struct _lambda_thismodule_9_12_18>::make(__context__,&__type_info__5135d324,(([&]() -> struct _lambda_thismodule_9_12_18 {
+		struct _lambda_thismodule_9_12_18 __mks_8;
+		das_zero(__mks_8);
+		das_copy((__mks_8.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_12_18`function _lambda_thismodule_9_12_18 int#ref*/ 567734650u))));
+		das_copy((__mks_8.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_12_18`finazlier #ptr#_lambda_thismodule_9_12_18#explicit*/ 2938380302u))));
+		das_move((__mks_8.blk),(__blk_rename_at_6));
+		das_move((__mks_8.src),(__src_rename_at_6));
+		return __mks_8;
+	})())));
+}
+
+inline int32_t _Funcfunctional_0x60_sum_ea2762a9b6c828a6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_82 )
+{
+	int32_t __temp_rename_at_83 = 0;
+	{
+		bool __need_loop_84 = true;
+		// x : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__it_rename_at_82);
+		int32_t __x_rename_at_84;
+		__need_loop_84 = __x_iterator.first(__context__,(__x_rename_at_84)) && __need_loop_84;
+		for ( ; __need_loop_84 ; __need_loop_84 = __x_iterator.next(__context__,(__x_rename_at_84)) )
+		{
+			__temp_rename_at_83 += __x_rename_at_84;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_84));
+	};
+	return __temp_rename_at_83;
+}
+
+inline int32_t fuse_reduce_empty_20ab859a8c383e64 ( Context * __context__ )
+{
+	return _Func_0x60_fuse_0x60_0xc_0x60_0xb_0x60_1_d4d83d9f9ab6a727(__context__,range(0,0),Func(__context__->fnIdxByMangledName(/*add int#const int#const*/ 3151545828u)));
+}
+
+inline bool is_even_6d9eabfbf704f1dc ( Context * __context__, int32_t __x_rename_at_4 )
+{
+	return (SimPolicy<int32_t>::Mod(__x_rename_at_4,2,*__context__)) == 0;
+}
+
+inline bool test_3d90d5265e899f5f ( Context * __context__ ) { das_stack_prologue __prologue(__context__,464,"test " DAS_FILE_LINE);
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_44_384;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_44_400;
+	TArray<int32_t> __a_rename_at_16; das_zero(__a_rename_at_16);
+	{
+		bool __need_loop_17 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_17;
+		__need_loop_17 = __i_iterator.first(__context__,(__i_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __i_iterator.next(__context__,(__i_rename_at_17)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16),__i_rename_at_17,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_17));
+	};
+	int32_t __r_rename_at_21 = (int32_t)_Func_0x60_fuse_0x60_0x15_0x60_0x10_0x60_8_403c69d153a95450(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16),das_ascend<bool,struct _lambda_thismodule_21_44_12>::make(__context__,&__type_info__2b9991b,(([&]() -> struct _lambda_thismodule_21_44_12 {
+		struct _lambda_thismodule_21_44_12 __mks_21;
+		das_copy((__mks_21.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_21_44_12`function _lambda_thismodule_21_44_12 int#const*/ 1585040324u))));
+		das_copy((__mks_21.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_21_44_12`finazlier #ptr#_lambda_thismodule_21_44_12#explicit*/ 676324466u))));
+		return __mks_21;
+	})())),das_ascend<int32_t,struct _lambda_thismodule_21_75_1>::make(__context__,&__type_info__5b8c1cf3,(([&]() -> struct _lambda_thismodule_21_75_1 {
+		struct _lambda_thismodule_21_75_1 __mks_21;
+		das_copy((__mks_21.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_21_75_1`function _lambda_thismodule_21_75_1 int#const*/ 703059224u))));
+		das_copy((__mks_21.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_21_75_1`finazlier #ptr#_lambda_thismodule_21_75_1#explicit*/ 1691737366u))));
+		return __mks_21;
+	})())),das_ascend<int32_t,struct _lambda_thismodule_21_102_20>::make(__context__,&__type_info__a3f4fbd3,(([&]() -> struct _lambda_thismodule_21_102_20 {
+		struct _lambda_thismodule_21_102_20 __mks_21;
+		das_copy((__mks_21.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_21_102_20`function _lambda_thismodule_21_102_20 int#const int#const*/ 2604041977u))));
+		das_copy((__mks_21.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_21_102_20`finazlier #ptr#_lambda_thismodule_21_102_20#explicit*/ 1443765098u))));
+		return __mks_21;
+	})())));
+	DAS_ASSERT((__r_rename_at_21 == 60));
+	DAS_VERIFY((_Func_0x60_fuse_0x60_0x18_0x60_0xf_0x60_9_f03efcd58dd45964(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16),Func(__context__->fnIdxByMangledName(/*is_even int#const*/ 3379734375u)),das_ascend<bool,struct _lambda_thismodule_24_65_2>::make(__context__,&__type_info__621a8dfa,(([&]() -> struct _lambda_thismodule_24_65_2 {
+		struct _lambda_thismodule_24_65_2 __mks_24;
+		das_copy((__mks_24.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_24_65_2`function _lambda_thismodule_24_65_2 int#const*/ 3810296396u))));
+		das_copy((__mks_24.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_24_65_2`finazlier #ptr#_lambda_thismodule_24_65_2#explicit*/ 3095393982u))));
+		return __mks_24;
+	})())))));
+	DAS_VERIFY((!_Func_0x60_fuse_0x60_0x19_0x60_0x10_0x60_5_9a8b172999ba9f01(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16),das_ascend<bool,struct _lambda_thismodule_25_45_3>::make(__context__,&__type_info__9cc01e42,(([&]() -> struct _lambda_thismodule_25_45_3 {
+		struct _lambda_thismodule_25_45_3 __mks_25;
+		das_copy((__mks_25.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_25_45_3`function _lambda_thismodule_25_45_3 int#const*/ 1646561132u))));
+		das_copy((__mks_25.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_25_45_3`finazlier #ptr#_lambda_thismodule_25_45_3#explicit*/ 1106459918u))));
+		return __mks_25;
+	})())))));
+	DAS_VERIFY((_Func_0x60_fuse_0x60_0x1b_0x60_0xf_0x60_6_7ac4336544d7b9d9(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16),das_ascend<bool,struct _lambda_thismodule_27_44_4>::make(__context__,&__type_info__2e18ae36,(([&]() -> struct _lambda_thismodule_27_44_4 {
+		struct _lambda_thismodule_27_44_4 __mks_27;
+		das_copy((__mks_27.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_27_44_4`function _lambda_thismodule_27_44_4 int#const*/ 3944317456u))));
+		das_copy((__mks_27.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_27_44_4`finazlier #ptr#_lambda_thismodule_27_44_4#explicit*/ 2255895138u))));
+		return __mks_27;
+	})())))));
+	DAS_VERIFY((!_Func_0x60_fuse_0x60_0x1c_0x60_0x10_0x60_7_7ac4336544d7b9d9(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16),das_ascend<bool,struct _lambda_thismodule_28_45_5>::make(__context__,&__type_info__a763ad25,(([&]() -> struct _lambda_thismodule_28_45_5 {
+		struct _lambda_thismodule_28_45_5 __mks_28;
+		das_copy((__mks_28.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_28_45_5`function _lambda_thismodule_28_45_5 int#const*/ 3424548352u))));
+		das_copy((__mks_28.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_28_45_5`finazlier #ptr#_lambda_thismodule_28_45_5#explicit*/ 2603152278u))));
+		return __mks_28;
+	})())))));
+	TArray<char *> __t_rename_at_30; das_zero(__t_rename_at_30); das_move(__t_rename_at_30, _Func_0x60_fuse_0x60_0x1e_0x60_0x11_0x60_3_4e879ffaa2729330(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16),das_ascend<char *,struct _lambda_thismodule_30_46_6>::make(__context__,&__type_info__fedd0b56,(([&]() -> struct _lambda_thismodule_30_46_6 {
+		struct _lambda_thismodule_30_46_6 __mks_30;
+		das_copy((__mks_30.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_30_46_6`function _lambda_thismodule_30_46_6 int#const*/ 3607599704u))));
+		das_copy((__mks_30.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_30_46_6`finazlier #ptr#_lambda_thismodule_30_46_6#explicit*/ 802861338u))));
+		return __mks_30;
+	})()))));
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<char *>>::pass(__t_rename_at_30)) == 10) && (SimPolicy<char *>::Equ(cast<char *>::from(__t_rename_at_30(3,__context__)),cast<char *>::from(((char *) "3")),*__context__))));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__t_rename_at_30));
+	DAS_VERIFY((_Func_0x60_fuse_0x60_0x22_0x60_0xb_0x60_2_be98a67d6dcd979e(__context__,range(0,10),das_make_block<int32_t,int32_t,int32_t>(__context__,304,0,&__func_info__2e807d1c,[&](int32_t const  __x_rename_at_34, int32_t const  __y_rename_at_34)->int32_t{
+		return __x_rename_at_34 + __y_rename_at_34;
+	})) == 45));
+	DAS_VERIFY((_Func_0x60_fuse_0x60_0x24_0x60_0xb_0x60_4_3fd75b20f1ca4be3(__context__,range(0,5),das_ascend<int32_t,struct _lambda_thismodule_36_49_7>::make(__context__,&__type_info__acb4fa6a,(([&]() -> struct _lambda_thismodule_36_49_7 {
+		struct _lambda_thismodule_36_49_7 __mks_36;
+		das_copy((__mks_36.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_36_49_7`function _lambda_thismodule_36_49_7 int#const*/ 2787401132u))));
+		das_copy((__mks_36.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_36_49_7`finazlier #ptr#_lambda_thismodule_36_49_7#explicit*/ 750015038u))));
+		return __mks_36;
+	})()))) == 30));
+	TDim<int32_t,4> __fa_rename_at_37; das_zero(__fa_rename_at_37);
+	das_copy(__fa_rename_at_37(2,__context__),5);
+	DAS_VERIFY((_Func_0x60_fuse_0x60_0x28_0x60_0xf_0x60_0_b98037552cc52b12(__context__,das_arg<TDim<int32_t,4>>::pass(__fa_rename_at_37)) == 5));
+	DAS_VERIFY((_Func_0x60_fuse_0x60_0x2a_0x60_0xb_0x60_10_eb138f9ebbd86045(__context__,range(0,4),das_ascend<TArray<int32_t>,struct _lambda_thismodule_42_62_8>::make(__context__,&__type_info__cf82abc5,(([&]() -> struct _lambda_thismodule_42_62_8 {
+		struct _lambda_thismodule_42_62_8 __mks_42;
+		das_copy((__mks_42.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_42_62_8`function _lambda_thismodule_42_62_8 int#const*/ 1799933600u))));
+		das_copy((__mks_42.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_42_62_8`finazlier #ptr#_lambda_thismodule_42_62_8#explicit*/ 3016385550u))));
+		return __mks_42;
+	})())),das_ascend<int32_t,struct _lambda_thismodule_42_111_9>::make(__context__,&__type_info__4ff7c47f,(([&]() -> struct _lambda_thismodule_42_111_9 {
+		struct _lambda_thismodule_42_111_9 __mks_42;
+		das_copy((__mks_42.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_42_111_9`function _lambda_thismodule_42_111_9 #array#int#const*/ 374820879u))));
+		das_copy((__mks_42.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_42_111_9`finazlier #ptr#_lambda_thismodule_42_111_9#explicit*/ 2564562710u))));
+		return __mks_42;
+	})()))) == 12));
+	DAS_VERIFY((_Funcfunctional_0x60_sum_ea2762a9b6c828a6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_44_384 = (_Funcfunctional_0x60_filter_92865bc2a7c29ca8(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_44_400 = (_Funcbuiltin_0x60_each_ref_633ef44731ea6497(__context__,das_ascend<bool,struct _lambda_thismodule_44_19_11>::make(__context__,&__type_info__46225b25,(([&]() -> struct _lambda_thismodule_44_19_11 {
+		struct _lambda_thismodule_44_19_11 __mks_44;
+		das_zero(__mks_44);
+		das_copy((__mks_44.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_44_19_11`function _lambda_thismodule_44_19_11 #ptr#int#const#ref*/ 2081769782u))));
+		das_copy((__mks_44.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_44_19_11`finazlier #ptr#_lambda_thismodule_44_19_11#explicit*/ 3169465958u))));
+		return __mks_44;
+	})())))))),das_ascend<bool,struct _lambda_thismodule_44_65_10>::make(__context__,&__type_info__9f8f8597,(([&]() -> struct _lambda_thismodule_44_65_10 {
+		struct _lambda_thismodule_44_65_10 __mks_44;
+		das_copy((__mks_44.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_44_65_10`function _lambda_thismodule_44_65_10 int#const*/ 482807992u))));
+		das_copy((__mks_44.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_44_65_10`finazlier #ptr#_lambda_thismodule_44_65_10#explicit*/ 4161916246u))));
+		return __mks_44;
+	})()))))))) == 35));
+	bool __failed_rename_at_46 = false;
+	das_try_recover(__context__, [&]()
+	{
+		fuse_reduce_empty_20ab859a8c383e64(__context__);
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_46,true);
+	});
+	DAS_ASSERT((__failed_rename_at_46));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_21_102_20_0x60_finazlier_daaa7d53f85c428e
+		aotLib[0x2c73dd8f6cf55bc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_21_102_20 *  ),&_Func_lambda_thismodule_21_102_20_0x60_finazlier_daaa7d53f85c428e>>();
+	};
+		// _Func_lambda_thismodule_21_102_20_0x60_function_1d7408febde2c655
+		aotLib[0x21ef4e7f96be3379] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_21_102_20 & , int32_t , int32_t  ),&_Func_lambda_thismodule_21_102_20_0x60_function_1d7408febde2c655>>();
+	};
+		// _Func_lambda_thismodule_21_44_12_0x60_finazlier_a55a66d70ce5dc80
+		aotLib[0xf9c07eafa73109fe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_21_44_12 *  ),&_Func_lambda_thismodule_21_44_12_0x60_finazlier_a55a66d70ce5dc80>>();
+	};
+		// _Func_lambda_thismodule_21_44_12_0x60_function_cf3d1869c4b0b67d
+		aotLib[0xb2b130525de62dc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_21_44_12 & , int32_t  ),&_Func_lambda_thismodule_21_44_12_0x60_function_cf3d1869c4b0b67d>>();
+	};
+		// _Func_lambda_thismodule_21_75_1_0x60_finazlier_9944fce65ee32a06
+		aotLib[0x2b593d12b72a008c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_21_75_1 *  ),&_Func_lambda_thismodule_21_75_1_0x60_finazlier_9944fce65ee32a06>>();
+	};
+		// _Func_lambda_thismodule_21_75_1_0x60_function_85bc034299515afc
+		aotLib[0xe017ff0b3c9ec1e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_21_75_1 & , int32_t  ),&_Func_lambda_thismodule_21_75_1_0x60_function_85bc034299515afc>>();
+	};
+		// _Func_lambda_thismodule_24_65_2_0x60_finazlier_9fbbc9007bbc2efe
+		aotLib[0xc4a93b4cfb34004] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_24_65_2 *  ),&_Func_lambda_thismodule_24_65_2_0x60_finazlier_9fbbc9007bbc2efe>>();
+	};
+		// _Func_lambda_thismodule_24_65_2_0x60_function_31da283becfbee3c
+		aotLib[0x7dfc63eb66236f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_24_65_2 & , int32_t  ),&_Func_lambda_thismodule_24_65_2_0x60_function_31da283becfbee3c>>();
+	};
+		// _Func_lambda_thismodule_25_45_3_0x60_finazlier_97da0e5a7490a5be
+		aotLib[0xca40f03dde652ad4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_25_45_3 *  ),&_Func_lambda_thismodule_25_45_3_0x60_finazlier_97da0e5a7490a5be>>();
+	};
+		// _Func_lambda_thismodule_25_45_3_0x60_function_18487410b689f0fb
+		aotLib[0x754e0510e4bf07e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_25_45_3 & , int32_t  ),&_Func_lambda_thismodule_25_45_3_0x60_function_18487410b689f0fb>>();
+	};
+		// _Func_lambda_thismodule_27_44_4_0x60_finazlier_943630c536e448b6
+		aotLib[0x8346ee6a6f0c0a5f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_27_44_4 *  ),&_Func_lambda_thismodule_27_44_4_0x60_finazlier_943630c536e448b6>>();
+	};
+		// _Func_lambda_thismodule_27_44_4_0x60_function_3123312c3d86409a
+		aotLib[0x1193d57e368c45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_27_44_4 & , int32_t  ),&_Func_lambda_thismodule_27_44_4_0x60_function_3123312c3d86409a>>();
+	};
+		// _Func_lambda_thismodule_28_45_5_0x60_finazlier_7fcbf5efd09393c2
+		aotLib[0x4f356b1d82063daa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_28_45_5 *  ),&_Func_lambda_thismodule_28_45_5_0x60_finazlier_7fcbf5efd09393c2>>();
+	};
+		// _Func_lambda_thismodule_28_45_5_0x60_function_6499c8c0ab11aa60
+		aotLib[0x9868a8d0795f6abd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_28_45_5 & , int32_t  ),&_Func_lambda_thismodule_28_45_5_0x60_function_6499c8c0ab11aa60>>();
+	};
+		// _Func_lambda_thismodule_30_46_6_0x60_finazlier_4223ddbabe490f1e
+		aotLib[0xe4c2a0a9c802ecce] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_30_46_6 *  ),&_Func_lambda_thismodule_30_46_6_0x60_finazlier_4223ddbabe490f1e>>();
+	};
+		// _Func_lambda_thismodule_30_46_6_0x60_function_40617bfe75411115
+		aotLib[0x32e9114b47067749] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, struct _lambda_thismodule_30_46_6 & , int32_t  ),&_Func_lambda_thismodule_30_46_6_0x60_function_40617bfe75411115>>();
+	};
+		// _Func_lambda_thismodule_36_49_7_0x60_finazlier_523d33c53c9fe69e
+		aotLib[0xa5ce5576b40df610] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_36_49_7 *  ),&_Func_lambda_thismodule_36_49_7_0x60_finazlier_523d33c53c9fe69e>>();
+	};
+		// _Func_lambda_thismodule_36_49_7_0x60_function_da68bba897c6c415
+		aotLib[0x62fbcea352919551] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_36_49_7 & , int32_t  ),&_Func_lambda_thismodule_36_49_7_0x60_function_da68bba897c6c415>>();
+	};
+		// _Func_lambda_thismodule_42_111_9_0x60_finazlier_c7537350c13ead0c
+		aotLib[0xefb90b726636423c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_42_111_9 *  ),&_Func_lambda_thismodule_42_111_9_0x60_finazlier_c7537350c13ead0c>>();
+	};
+		// _Func_lambda_thismodule_42_111_9_0x60_function_2e743044afa3e13
+		aotLib[0xa0c90e1dfdb44291] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_42_111_9 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_42_111_9_0x60_function_2e743044afa3e13>>();
+	};
+		// _Func_lambda_thismodule_42_62_8_0x60_finazlier_99c50d8d74c4cd62
+		aotLib[0x798c9627f7c5b215] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_42_62_8 *  ),&_Func_lambda_thismodule_42_62_8_0x60_finazlier_99c50d8d74c4cd62>>();
+	};
+		// _Func_lambda_thismodule_42_62_8_0x60_function_d7968ed40fc2505f
+		aotLib[0xd186c6269fa8afcd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, struct _lambda_thismodule_42_62_8 & , int32_t  ),&_Func_lambda_thismodule_42_62_8_0x60_function_d7968ed40fc2505f>>();
+	};
+		// _Func_lambda_thismodule_44_19_11_0x60_finazlier_83c72f243428b49a
+		aotLib[0xb33a7ed5ea2a2003] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_44_19_11 *  ),&_Func_lambda_thismodule_44_19_11_0x60_finazlier_83c72f243428b49a>>();
+	};
+		// _Func_lambda_thismodule_44_19_11_0x60_function_a0d453816ffb8d7b
+		aotLib[0xda67f84f33424b18] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_44_19_11 & , int32_t const  * &  ),&_Func_lambda_thismodule_44_19_11_0x60_function_a0d453816ffb8d7b>>();
+	};
+		// _Func_lambda_thismodule_44_65_10_0x60_finazlier_bff2cdc29f861f88
+		aotLib[0x1852e8326f5f72f3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_44_65_10 *  ),&_Func_lambda_thismodule_44_65_10_0x60_finazlier_bff2cdc29f861f88>>();
+	};
+		// _Func_lambda_thismodule_44_65_10_0x60_function_8d8b3f8c92addd8d
+		aotLib[0x623e184fa0ec36a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_44_65_10 & , int32_t  ),&_Func_lambda_thismodule_44_65_10_0x60_function_8d8b3f8c92addd8d>>();
+	};
+		// _Func_lambda_thismodule_9_12_18_0x60_finazlier_834d749ba8665f2c
+		aotLib[0x4050e80d868d78f0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_12_18 *  ),&_Func_lambda_thismodule_9_12_18_0x60_finazlier_834d749ba8665f2c>>();
+	};
+		// _Func_lambda_thismodule_9_12_18_0x60_function_3268a3ea4603287a
+		aotLib[0x932341f88bdff2e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_9_12_18 & , int32_t &  ),&_Func_lambda_thismodule_9_12_18_0x60_function_3268a3ea4603287a>>();
+	};
+		// _Func_0x60_fuse_0x60_0x15_0x60_0x10_0x60_8_403c69d153a95450
+		aotLib[0xe506006a3a55ff8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , Lambda DAS_COMMENT((bool,int32_t)) const  , Lambda DAS_COMMENT((int32_t,int32_t)) const  , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Func_0x60_fuse_0x60_0x15_0x60_0x10_0x60_8_403c69d153a95450>>();
+	};
+		// _Func_0x60_fuse_0x60_0x18_0x60_0xf_0x60_9_f03efcd58dd45964
+		aotLib[0x80173ad6a471da4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , Func DAS_COMMENT((bool,int32_t)) const  , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Func_0x60_fuse_0x60_0x18_0x60_0xf_0x60_9_f03efcd58dd45964>>();
+	};
+		// _Func_0x60_fuse_0x60_0x19_0x60_0x10_0x60_5_9a8b172999ba9f01
+		aotLib[0xfc43c4d0c44f1de5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Func_0x60_fuse_0x60_0x19_0x60_0x10_0x60_5_9a8b172999ba9f01>>();
+	};
+		// _Func_0x60_fuse_0x60_0x1b_0x60_0xf_0x60_6_7ac4336544d7b9d9
+		aotLib[0x73dd302292a206fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Func_0x60_fuse_0x60_0x1b_0x60_0xf_0x60_6_7ac4336544d7b9d9>>();
+	};
+		// _Func_0x60_fuse_0x60_0x1c_0x60_0x10_0x60_7_7ac4336544d7b9d9
+		aotLib[0x73dd302292a206fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Func_0x60_fuse_0x60_0x1c_0x60_0x10_0x60_7_7ac4336544d7b9d9>>();
+	};
+		// _Func_0x60_fuse_0x60_0x1e_0x60_0x11_0x60_3_4e879ffaa2729330
+		aotLib[0x1146d033ca8efadd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TArray<int32_t> const  & , Lambda DAS_COMMENT((char *,int32_t)) const   ),&_Func_0x60_fuse_0x60_0x1e_0x60_0x11_0x60_3_4e879ffaa2729330>>();
+	};
+		// _Func_0x60_fuse_0x60_0x22_0x60_0xb_0x60_2_be98a67d6dcd979e
+		aotLib[0x14dd56b7f4540595] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, range , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Func_0x60_fuse_0x60_0x22_0x60_0xb_0x60_2_be98a67d6dcd979e>>();
+	};
+		// _Func_0x60_fuse_0x60_0x24_0x60_0xb_0x60_4_3fd75b20f1ca4be3
+		aotLib[0x5f86f080b1e9c2bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, range , Lambda DAS_COMMENT((int32_t,int32_t)) const   ),&_Func_0x60_fuse_0x60_0x24_0x60_0xb_0x60_4_3fd75b20f1ca4be3>>();
+	};
+		// _Func_0x60_fuse_0x60_0x28_0x60_0xf_0x60_0_b98037552cc52b12
+		aotLib[0xc67c161e7b4c1789] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Func_0x60_fuse_0x60_0x28_0x60_0xf_0x60_0_b98037552cc52b12>>();
+	};
+		// _Func_0x60_fuse_0x60_0x2a_0x60_0xb_0x60_10_eb138f9ebbd86045
+		aotLib[0x85d13a7f6eb48ae5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, range , Lambda DAS_COMMENT((TArray<int32_t>,int32_t)) const  , Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const   ),&_Func_0x60_fuse_0x60_0x2a_0x60_0xb_0x60_10_eb138f9ebbd86045>>();
+	};
+		// _Func_0x60_fuse_0x60_0xc_0x60_0xb_0x60_1_d4d83d9f9ab6a727
+		aotLib[0x3883953d4bd2f425] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, range , Func DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Func_0x60_fuse_0x60_0xc_0x60_0xb_0x60_1_d4d83d9f9ab6a727>>();
+	};
+		// add_71ce43625bcdc5ea
+		aotLib[0x191cc443284ae7bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&add_71ce43625bcdc5ea>>();
+	};
+		// _Funcbuiltin_0x60_each_53ccff887674360c
+		aotLib[0x33b53dc307e70da5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_53ccff887674360c>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_each_ref_633ef44731ea6497
+		aotLib[0x80ea587de23c1cdd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_633ef44731ea6497>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_8f1b55668745e84b
+		aotLib[0x60f7feeaae35f805] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_clone_8f1b55668745e84b>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05
+		aotLib[0x838d3aac7cba9ead] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_2214fb125fb27d05>>();
+	};
+		// finalize_75c78ab81820c121
+		aotLib[0x8f2948dd40b2a4fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_21_102_20 &  ),&finalize_75c78ab81820c121>>();
+	};
+		// finalize_203ea923e126959
+		aotLib[0x162ad38a365e7939] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_21_44_12 &  ),&finalize_203ea923e126959>>();
+	};
+		// finalize_5cf8c7d48b500845
+		aotLib[0x50d248d9dd0f12d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_21_75_1 &  ),&finalize_5cf8c7d48b500845>>();
+	};
+		// finalize_a0789d353c46a5be
+		aotLib[0x5a138b33c7d6ae5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_24_65_2 &  ),&finalize_a0789d353c46a5be>>();
+	};
+		// finalize_fc208f90c9d578ca
+		aotLib[0xa4340c8846c333e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_25_45_3 &  ),&finalize_fc208f90c9d578ca>>();
+	};
+		// finalize_f795195b1ae63086
+		aotLib[0x3149029880dfe6e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_27_44_4 &  ),&finalize_f795195b1ae63086>>();
+	};
+		// finalize_9a4abb41dc4938b
+		aotLib[0x960556eb345b081d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_28_45_5 &  ),&finalize_9a4abb41dc4938b>>();
+	};
+		// finalize_a86350df0e4a23da
+		aotLib[0xfffc92f9e0f2c6f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_30_46_6 &  ),&finalize_a86350df0e4a23da>>();
+	};
+		// finalize_b607403d58c33846
+		aotLib[0xb0c5d0d09f513481] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_36_49_7 &  ),&finalize_b607403d58c33846>>();
+	};
+		// finalize_4ced6efe5ad97651
+		aotLib[0xe0d0f6d3ac58cd09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_42_111_9 &  ),&finalize_4ced6efe5ad97651>>();
+	};
+		// finalize_532789b2125b436b
+		aotLib[0x424e5b6c20640505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_42_62_8 &  ),&finalize_532789b2125b436b>>();
+	};
+		// finalize_6e1ba8ffdf83cbb7
+		aotLib[0x8bfd61e6de1107fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_44_19_11 &  ),&finalize_6e1ba8ffdf83cbb7>>();
+	};
+		// finalize_a8c047447a324af9
+		aotLib[0xa9913884015930a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_44_65_10 &  ),&finalize_a8c047447a324af9>>();
+	};
+		// finalize_75ec7552d4893c12
+		aotLib[0x709d180a5e036d7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_12_18 &  ),&finalize_75ec7552d4893c12>>();
+	};
+		// _Funcfunctional_0x60_filter_92865bc2a7c29ca8
+		aotLib[0xca79f1906cd89f0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_92865bc2a7c29ca8>>();
+	};
+		// _Funcfunctional_0x60_filter_any_35324f3a0bbae07
+		aotLib[0x2f7985d3e9189fe2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_35324f3a0bbae07>>();
+	};
+		// _Funcfunctional_0x60_sum_ea2762a9b6c828a6
+		aotLib[0xede9cdbcaadb7c1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcfunctional_0x60_sum_ea2762a9b6c828a6>>();
+	};
+		// fuse_reduce_empty_20ab859a8c383e64
+		aotLib[0xd396f86fca392b04] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&fuse_reduce_empty_20ab859a8c383e64>>();
+	};
+		// is_even_6d9eabfbf704f1dc
+		aotLib[0xa27540ab97fa1cf5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_even_6d9eabfbf704f1dc>>();
+	};
+		// test_3d90d5265e899f5f
+		aotLib[0xdb6a217d754151f4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3d90d5265e899f5f>>();
+	};
+		// [[ init script ]]
+		aotLib[0x655f8e78b84d7dc8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
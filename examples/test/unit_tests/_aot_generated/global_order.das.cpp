@@ -0,0 +1,164 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline TArray<char *> _Func_0x60_clone_111bd3eae69e9651 ( Context * __context__, TArray<char *> const  & __value_rename_at_1 );
+inline void _Funcbuiltin_0x60_clone_91e87523cb5ef731 ( Context * __context__, TArray<char *> & __a_rename_at_232, TArray<char *> const  & __b_rename_at_232 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_e9efb0f1d3a71eb7 ( Context * __context__, TDim<char *,1> & __a_rename_at_398 );
+inline bool test_b0087d371648db3f ( Context * __context__ );
+inline TArray<char *> test_0_80caa7d558db5e6d ( Context * __context__ );
+inline TArray<char *> test_a_8b95d2364d41624 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TDim<char *,1> _temp_make_local_7_32;
+	das_global<TArray<char *>,0>(__context__) = _Funcbuiltin_0x60_to_array_move_e9efb0f1d3a71eb7(__context__,das_arg<TDim<char *,1>>::pass((([&]() -> TDim<char *,1>& {
+		_temp_make_local_7_32(0,__context__) = ((char *) "test");
+		return _temp_make_local_7_32;
+	})())));/*some_a*/
+	das_global<TArray<char *>,32>(__context__) = test_a_8b95d2364d41624(__context__);/*some_0*/
+}
+
+inline TArray<char *> _Func_0x60_clone_111bd3eae69e9651 ( Context * __context__, TArray<char *> const  &  __value_rename_at_1 )
+{
+	TArray<char *> __res_rename_at_2; das_zero(__res_rename_at_2);
+	_Funcbuiltin_0x60_clone_91e87523cb5ef731(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_2),__value_rename_at_1);
+	return /* <- */ __res_rename_at_2;
+}
+
+inline void _Funcbuiltin_0x60_clone_91e87523cb5ef731 ( Context * __context__, TArray<char *> &  __a_rename_at_232, TArray<char *> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : string aka TT&
+		das_iterator<TArray<char *>> __aV_iterator(__a_rename_at_232);
+		char * * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : string const&
+		das_iterator<TArray<char *> const > __bV_iterator(__b_rename_at_232);
+		char * const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			das_copy((*__aV_rename_at_234),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_e9efb0f1d3a71eb7 ( Context * __context__, TDim<char *,1> &  __a_rename_at_398 )
+{
+	TArray<char *> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_399),1);
+	das_copy(das_cast<TDim<char *,1>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline bool test_b0087d371648db3f ( Context * __context__ )
+{
+	return true;
+}
+
+inline TArray<char *> test_0_80caa7d558db5e6d ( Context * __context__ )
+{
+	return /* <- */ _Func_0x60_clone_111bd3eae69e9651(__context__,das_global<TArray<char *>,32>(__context__) /*some_0*/);
+}
+
+inline TArray<char *> test_a_8b95d2364d41624 ( Context * __context__ )
+{
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0>(__context__) /*some_a*/)) == 1));
+	return /* <- */ _Func_0x60_clone_111bd3eae69e9651(__context__,das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0>(__context__) /*some_a*/));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_clone_111bd3eae69e9651
+		aotLib[0x64b4c93a1628765b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_clone_111bd3eae69e9651>>();
+	};
+		// _Funcbuiltin_0x60_clone_91e87523cb5ef731
+		aotLib[0xb63e2e650b9e4da3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TArray<char *> const  &  ),&_Funcbuiltin_0x60_clone_91e87523cb5ef731>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_e9efb0f1d3a71eb7
+		aotLib[0xeebd69c8455e9cdf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,1> &  ),&_Funcbuiltin_0x60_to_array_move_e9efb0f1d3a71eb7>>();
+	};
+		// test_b0087d371648db3f
+		aotLib[0x434f546c6487b225] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b0087d371648db3f>>();
+	};
+		// test_0_80caa7d558db5e6d
+		aotLib[0xc05e170ecdfb1a6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__ ),&test_0_80caa7d558db5e6d>>();
+	};
+		// test_a_8b95d2364d41624
+		aotLib[0x568a11353ef56565] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__ ),&test_a_8b95d2364d41624>>();
+	};
+		// [[ init script ]]
+		aotLib[0x62a0cb869d08290b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
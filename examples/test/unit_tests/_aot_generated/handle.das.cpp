@@ -0,0 +1,171 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+	int32_t a;
+	int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct TestObjectFooNative {
+	int32_t fooData;
+};
+static_assert(sizeof(TestObjectFooNative)==4,"structure size mismatch with DAS");
+static_assert(offsetof(TestObjectFooNative,fooData)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct TestObjectBarNative {
+	struct TestObjectFooNative * fooPtr;
+	float barData;
+};
+static_assert(sizeof(TestObjectBarNative)==16,"structure size mismatch with DAS");
+static_assert(offsetof(TestObjectBarNative,fooPtr)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestObjectBarNative,barData)==8,"structure field offset mismatch with DAS");
+}
+
+inline bool test_5ab1f02c94ee8537 ( Context * __context__ );
+inline void test_handled_fa2c91c8e09661e2 ( Context * __context__ );
+inline void test_native_6a9f2f8f90dede7a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_5ab1f02c94ee8537 ( Context * __context__ )
+{
+	test_native_6a9f2f8f90dede7a(__context__);
+	test_handled_fa2c91c8e09661e2(__context__);
+	return true;
+}
+
+inline void test_handled_fa2c91c8e09661e2 ( Context * __context__ )
+{
+	TestObjectFoo * __a_rename_at_41 = 0;
+	TestObjectBar * __b_rename_at_42 = 0;
+	int32_t __idummy_rename_at_43 = 0;
+	float __fdummy_rename_at_44 = 0;
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(__a_rename_at_41,([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_43),1);
+	DAS_ASSERT((__idummy_rename_at_43 == 1));
+	das_copy(__a_rename_at_41,das_new_handle<TestObjectFoo,false>::make(__context__));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(__a_rename_at_41,([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_43),2);
+	DAS_ASSERT(((__a_rename_at_41->fooData /*fooData*/ == 2) && (__idummy_rename_at_43 == 1)));
+	das_copy(das_null_coalescing<float &>::get(das_safe_navigation_handle<TestObjectBar,float>::get(__b_rename_at_42,([&](const TestObjectBar * __any) -> auto & {return __any->barData /*barData*/;})),__fdummy_rename_at_44),1.f);
+	DAS_ASSERT((__fdummy_rename_at_44 == 1.f));
+	das_copy(__b_rename_at_42,das_new_handle<TestObjectBar,false>::make(__context__));
+	das_copy(das_null_coalescing<float &>::get(das_safe_navigation_handle<TestObjectBar,float>::get(__b_rename_at_42,([&](const TestObjectBar * __any) -> auto & {return __any->barData /*barData*/;})),__fdummy_rename_at_44),2.f);
+	DAS_ASSERT(((__b_rename_at_42->barData /*barData*/ == 2.f) && (__fdummy_rename_at_44 == 1.f)));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(das_safe_navigation_handle_ptr<TestObjectBar,TestObjectFoo *>::get(__b_rename_at_42,([&](const TestObjectBar * __any) -> auto & {return __any->fooPtr /*fooPtr*/;})),([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_43),3);
+	DAS_ASSERT((__idummy_rename_at_43 == 3));
+	das_copy(__b_rename_at_42->fooPtr /*fooPtr*/,__a_rename_at_41);
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(das_safe_navigation_handle_ptr<TestObjectBar,TestObjectFoo *>::get(__b_rename_at_42,([&](const TestObjectBar * __any) -> auto & {return __any->fooPtr /*fooPtr*/;})),([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_43),4);
+	DAS_ASSERT(((__b_rename_at_42->fooPtr /*fooPtr*/->fooData /*fooData*/ == 4) && (__idummy_rename_at_43 == 3)));
+	das_copy(__a_rename_at_41->fooData /*fooData*/,7);
+	DAS_ASSERT((__a_rename_at_41->propAdd13() /*propAdd13*/ == 20));
+	DAS_ASSERT((__b_rename_at_42->getFoo() /*getFoo*/.fooData /*fooData*/ == 7));
+	DAS_ASSERT((das_deref(__context__,__b_rename_at_42->getFooPtr() /*getFooPtr*/).fooData /*fooData*/ == 7));
+	DAS_ASSERT((das_equ(das_arg<TestObjectFoo>::pass(das_deref(__context__,__a_rename_at_41)),das_arg<TestObjectFoo>::pass(das_deref(__context__,__b_rename_at_42->fooPtr /*fooPtr*/)))));
+	DAS_ASSERT((!(das_nequ(das_arg<TestObjectFoo>::pass(das_deref(__context__,__a_rename_at_41)),das_arg<TestObjectFoo>::pass(das_deref(__context__,__b_rename_at_42->fooPtr /*fooPtr*/))))));
+	das_delete_handle<TestObjectFoo *>::clear(__context__,__a_rename_at_41);
+	das_delete_handle<TestObjectBar *>::clear(__context__,__b_rename_at_42);
+}
+
+inline void test_native_6a9f2f8f90dede7a ( Context * __context__ )
+{
+	struct TestObjectFooNative * __a_rename_at_19 = 0;
+	struct TestObjectBarNative * __b_rename_at_20 = 0;
+	int32_t __idummy_rename_at_21 = 0;
+	float __fdummy_rename_at_22 = 0;
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<struct TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(__a_rename_at_19),__idummy_rename_at_21),1);
+	DAS_ASSERT((__idummy_rename_at_21 == 1));
+	das_copy(__a_rename_at_19,das_new<struct TestObjectFooNative>::make(__context__));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<struct TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(__a_rename_at_19),__idummy_rename_at_21),2);
+	DAS_ASSERT(((__a_rename_at_19->fooData == 2) && (__idummy_rename_at_21 == 1)));
+	das_copy(das_null_coalescing<float &>::get(das_safe_navigation<struct TestObjectBarNative,float,&TestObjectBarNative::barData>::get(__b_rename_at_20),__fdummy_rename_at_22),1.f);
+	DAS_ASSERT((__fdummy_rename_at_22 == 1.f));
+	das_copy(__b_rename_at_20,das_new<struct TestObjectBarNative>::make(__context__));
+	das_copy(das_null_coalescing<float &>::get(das_safe_navigation<struct TestObjectBarNative,float,&TestObjectBarNative::barData>::get(__b_rename_at_20),__fdummy_rename_at_22),2.f);
+	DAS_ASSERT(((__b_rename_at_20->barData == 2.f) && (__fdummy_rename_at_22 == 1.f)));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<struct TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(das_safe_navigation_ptr<struct TestObjectBarNative,struct TestObjectFooNative *,&TestObjectBarNative::fooPtr>::get(__b_rename_at_20)),__idummy_rename_at_21),3);
+	DAS_ASSERT((__idummy_rename_at_21 == 3));
+	das_copy(__b_rename_at_20->fooPtr,__a_rename_at_19);
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<struct TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(das_safe_navigation_ptr<struct TestObjectBarNative,struct TestObjectFooNative *,&TestObjectBarNative::fooPtr>::get(__b_rename_at_20)),__idummy_rename_at_21),4);
+	DAS_ASSERT(((__b_rename_at_20->fooPtr->fooData == 4) && (__idummy_rename_at_21 == 3)));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_5ab1f02c94ee8537
+		aotLib[0x15196faff51ef626] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5ab1f02c94ee8537>>();
+	};
+		// test_handled_fa2c91c8e09661e2
+		aotLib[0x6bb0e58a98760f5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_handled_fa2c91c8e09661e2>>();
+	};
+		// test_native_6a9f2f8f90dede7a
+		aotLib[0xf7eddc20fd316aed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_native_6a9f2f8f90dede7a>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,277 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__59a8048b;
+extern StructInfo __struct_info__e2251400;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__53cb1350;
+extern TypeInfo __type_info__d8c90dbd;
+extern TypeInfo __type_info__cc70dfe5;
+extern TypeInfo __type_info__43c45dfb;
+extern TypeInfo __type_info__a6c45d85;
+extern TypeInfo __type_info__21c015d6;
+extern VarInfo __var_info__74fa979f;
+extern VarInfo __var_info__efd0f999;
+extern VarInfo __var_info__ecd0f4e0;
+extern VarInfo __var_info__fed11136;
+extern VarInfo __var_info__76fa9ac5;
+extern VarInfo __var_info__75fa9932;
+
+VarInfo __struct_info__59a8048b_field_0 =  { Type::tInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xecd0f4e0, "a", 0 };
+VarInfo __struct_info__59a8048b_field_1 =  { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xefd0f999, "b", 8 };
+VarInfo __struct_info__59a8048b_field_2 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0xfed11136, "s", 16 };
+VarInfo * __struct_info__59a8048b_fields[3] =  { &__struct_info__59a8048b_field_0, &__struct_info__59a8048b_field_1, &__struct_info__59a8048b_field_2 };
+StructInfo __struct_info__59a8048b = {"Padded", __struct_info__59a8048b_fields, 3, 24, -1, nullptr, 0x59a8048b };
+VarInfo __struct_info__e2251400_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x74fa979f, "a", 0 };
+VarInfo __struct_info__e2251400_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x75fa9932, "b", 4 };
+VarInfo __struct_info__e2251400_field_2 =  { Type::tInt2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x76fa9ac5, "c", 8 };
+VarInfo * __struct_info__e2251400_fields[3] =  { &__struct_info__e2251400_field_0, &__struct_info__e2251400_field_1, &__struct_info__e2251400_field_2 };
+StructInfo __struct_info__e2251400 = {"Dense", __struct_info__e2251400_fields, 3, 16, -1, nullptr, 0xe2251400 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__53cb1350 = { Type::tStructure, &__struct_info__e2251400, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2078, 0x53cb1350 };
+TypeInfo __type_info__d8c90dbd = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__53cb1350, nullptr, nullptr, nullptr, 0, 0, nullptr, 258, 0xd8c90dbd };
+TypeInfo __type_info__cc70dfe5 = { Type::tStructure, &__struct_info__59a8048b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 294, 0xcc70dfe5 };
+TypeInfo * __type_info__43c45dfb_arg_types[3] = { &__type_info__95e97e5e, &__type_info__a6c45d85, &__type_info__17c16538 };
+TypeInfo __type_info__43c45dfb = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__43c45dfb_arg_types, nullptr, 3, 0, nullptr, 294, 0x43c45dfb };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+TypeInfo __type_info__21c015d6 = { Type::tStructure, &__struct_info__e2251400, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2366, 0x21c015d6 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__21c015d6 };
+TypeInfo * __tinfo_1[1] = { &__type_info__21c015d6 };
+TypeInfo * __tinfo_2[1] = { &__type_info__21c015d6 };
+TypeInfo * __tinfo_3[1] = { &__type_info__21c015d6 };
+TypeInfo * __tinfo_4[1] = { &__type_info__cc70dfe5 };
+TypeInfo * __tinfo_5[1] = { &__type_info__cc70dfe5 };
+TypeInfo * __tinfo_6[1] = { &__type_info__cc70dfe5 };
+TypeInfo * __tinfo_7[1] = { &__type_info__cc70dfe5 };
+TypeInfo * __tinfo_8[1] = { &__type_info__43c45dfb };
+TypeInfo * __tinfo_9[1] = { &__type_info__43c45dfb };
+TypeInfo * __tinfo_10[1] = { &__type_info__d8c90dbd };
+TypeInfo * __tinfo_11[1] = { &__type_info__d8c90dbd };
+TypeInfo * __tinfo_12[1] = { &__type_info__d8c90dbd };
+TypeInfo * __tinfo_13[1] = { &__type_info__d8c90dbd };
+namespace  {
+
+struct Dense {
+	int32_t a;
+	float b;
+	int2 c;
+};
+static_assert(sizeof(Dense)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Dense,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Dense,b)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Dense,c)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Padded {
+	int8_t a;
+	int64_t b;
+	char * s;
+};
+static_assert(sizeof(Padded)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Padded,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Padded,b)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Padded,s)==16,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_finalize_eb9518814985d3b9 ( Context * __context__, TArray<struct Dense> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_e1799d847705d534 ( Context * __context__, TArray<struct Dense> & __Arr_rename_at_40, struct Dense const  & __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void finalize_a1e3d132519c90a4 ( Context * __context__, struct Dense & ____this_rename_at_1 );
+inline bool test_2049cbf577a0e0b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_eb9518814985d3b9 ( Context * __context__, TArray<struct Dense> &  __a_rename_at_285 )
+{
+	{
+		bool __need_loop_287 = true;
+		// aV : Dense aka TT&
+		das_iterator<TArray<struct Dense>> __aV_iterator(__a_rename_at_285);
+		struct Dense * __aV_rename_at_287;
+		__need_loop_287 = __aV_iterator.first(__context__,(__aV_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __aV_iterator.next(__context__,(__aV_rename_at_287)) )
+		{
+			finalize_a1e3d132519c90a4(__context__,das_arg<struct Dense>::pass((*__aV_rename_at_287)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_287));
+	};
+	builtin_array_free(das_arg<TArray<struct Dense>>::pass(__a_rename_at_285),16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_e1799d847705d534 ( Context * __context__, TArray<struct Dense> &  __Arr_rename_at_40, struct Dense const  &  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<struct Dense>>::pass(__Arr_rename_at_40),__at_rename_at_40,16,__context__),__context__),__value_rename_at_40);
+}
+
+inline void finalize_a1e3d132519c90a4 ( Context * __context__, struct Dense &  ____this_rename_at_1 )
+{
+	memset(&(____this_rename_at_1), 0, 16);
+}
+
+inline bool test_2049cbf577a0e0b ( Context * __context__ )
+{
+	struct Dense __d1_rename_at_13 = (struct Dense)(([&]() -> struct Dense {
+		struct Dense __mks_13;
+		das_copy((__mks_13.a),(1));
+		das_copy((__mks_13.b),(2.f));
+		das_copy((__mks_13.c),(int2(3,4)));
+		return __mks_13;
+	})());
+	struct Dense __d2_rename_at_14 = (struct Dense)(([&]() -> struct Dense {
+		struct Dense __mks_14;
+		das_copy((__mks_14.a),(1));
+		das_copy((__mks_14.b),(2.f));
+		das_copy((__mks_14.c),(int2(3,4)));
+		return __mks_14;
+	})());
+	struct Dense __d3_rename_at_15 = (struct Dense)(([&]() -> struct Dense {
+		struct Dense __mks_15;
+		das_copy((__mks_15.a),(1));
+		das_copy((__mks_15.b),(2.f));
+		das_copy((__mks_15.c),(int2(3,5)));
+		return __mks_15;
+	})());
+	DAS_ASSERT((das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<struct Dense const  &>::from(__d1_rename_at_13))) == das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<struct Dense const  &>::from(__d2_rename_at_14)))));
+	DAS_ASSERT((das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<struct Dense const  &>::from(__d1_rename_at_13))) != das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_3,cast<struct Dense const  &>::from(__d3_rename_at_15)))));
+	struct Padded __p1_rename_at_18 = (struct Padded)(([&]() -> struct Padded {
+		struct Padded __mks_18;
+		das_copy((__mks_18.a),(int8_t(1)));
+		das_copy((__mks_18.b),(2ll));
+		das_copy((__mks_18.s),(((char *) "three")));
+		return __mks_18;
+	})());
+	struct Padded __p2_rename_at_19 = (struct Padded)(([&]() -> struct Padded {
+		struct Padded __mks_19;
+		das_copy((__mks_19.a),(int8_t(1)));
+		das_copy((__mks_19.b),(2ll));
+		das_copy((__mks_19.s),(((char *) "three")));
+		return __mks_19;
+	})());
+	struct Padded __p3_rename_at_20 = (struct Padded)(([&]() -> struct Padded {
+		struct Padded __mks_20;
+		das_copy((__mks_20.a),(int8_t(2)));
+		das_copy((__mks_20.b),(2ll));
+		das_copy((__mks_20.s),(((char *) "three")));
+		return __mks_20;
+	})());
+	DAS_ASSERT((das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_4,cast<struct Padded const  &>::from(__p1_rename_at_18))) == das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_5,cast<struct Padded const  &>::from(__p2_rename_at_19)))));
+	DAS_ASSERT((das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_6,cast<struct Padded const  &>::from(__p1_rename_at_18))) != das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_7,cast<struct Padded const  &>::from(__p3_rename_at_20)))));
+	TTuple<16,int32_t,float,char *> __t1_rename_at_23 = (TTuple<16,int32_t,float,char *>)(([&]() -> TTuple<16,int32_t,float,char *> {
+		TTuple<16,int32_t,float,char *> __mkt_23;
+		das_get_tuple_field<int32_t,0>::get(__mkt_23) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_23) = 2.f;
+		das_get_tuple_field<char *,8>::get(__mkt_23) = ((char *) "three");
+		return __mkt_23;
+	})());
+	TTuple<16,int32_t,float,char *> __t2_rename_at_24 = (TTuple<16,int32_t,float,char *>)(([&]() -> TTuple<16,int32_t,float,char *> {
+		TTuple<16,int32_t,float,char *> __mkt_24;
+		das_get_tuple_field<int32_t,0>::get(__mkt_24) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_24) = 2.f;
+		das_get_tuple_field<char *,8>::get(__mkt_24) = ((char *) "three");
+		return __mkt_24;
+	})());
+	DAS_ASSERT((das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_8,cast<TTuple<16,int32_t,float,char *> const  &>::from(__t1_rename_at_23))) == das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_9,cast<TTuple<16,int32_t,float,char *> const  &>::from(__t2_rename_at_24)))));
+	TArray<struct Dense> __a1_rename_at_26; das_zero(__a1_rename_at_26);
+	TArray<struct Dense> __a2_rename_at_27; das_zero(__a2_rename_at_27);
+	{
+		bool __need_loop_28 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_28;
+		__need_loop_28 = __i_iterator.first(__context__,(__i_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __i_iterator.next(__context__,(__i_rename_at_28)) )
+		{
+			struct Dense _temp_make_local_29_288;
+			struct Dense _temp_make_local_30_304;
+			_Funcbuiltin_0x60_push_e1799d847705d534(__context__,das_arg<TArray<struct Dense>>::pass(__a1_rename_at_26),das_arg<struct Dense>::pass((([&]() -> struct Dense& {
+				das_zero(_temp_make_local_29_288);
+				das_copy((_temp_make_local_29_288.a),(__i_rename_at_28));
+				return _temp_make_local_29_288;
+			})())),-1);
+			_Funcbuiltin_0x60_push_e1799d847705d534(__context__,das_arg<TArray<struct Dense>>::pass(__a2_rename_at_27),das_arg<struct Dense>::pass((([&]() -> struct Dense& {
+				das_zero(_temp_make_local_30_304);
+				das_copy((_temp_make_local_30_304.a),(__i_rename_at_28));
+				return _temp_make_local_30_304;
+			})())),-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_28));
+	};
+	DAS_ASSERT((das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_10,cast<TArray<struct Dense> &>::from(__a1_rename_at_26))) == das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_11,cast<TArray<struct Dense> &>::from(__a2_rename_at_27)))));
+	das_copy(__a2_rename_at_27(9,__context__).a,0);
+	DAS_ASSERT((das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_12,cast<TArray<struct Dense> &>::from(__a1_rename_at_26))) != das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_13,cast<TArray<struct Dense> &>::from(__a2_rename_at_27)))));
+	_Funcbuiltin_0x60_finalize_eb9518814985d3b9(__context__,das_arg<TArray<struct Dense>>::pass(__a1_rename_at_26));
+	_Funcbuiltin_0x60_finalize_eb9518814985d3b9(__context__,das_arg<TArray<struct Dense>>::pass(__a2_rename_at_27));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_eb9518814985d3b9
+		aotLib[0xf6021e68e23754c3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Dense> &  ),&_Funcbuiltin_0x60_finalize_eb9518814985d3b9>>();
+	};
+		// _Funcbuiltin_0x60_push_e1799d847705d534
+		aotLib[0x2a8a4d5ab054e20d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Dense> & , struct Dense const  & , int32_t  ),&_Funcbuiltin_0x60_push_e1799d847705d534>>();
+	};
+		// finalize_a1e3d132519c90a4
+		aotLib[0x75cdfec36d1e1049] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Dense &  ),&finalize_a1e3d132519c90a4>>();
+	};
+		// test_2049cbf577a0e0b
+		aotLib[0x5ea13a2691eab61e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_2049cbf577a0e0b>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
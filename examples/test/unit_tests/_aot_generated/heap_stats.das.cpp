@@ -0,0 +1,483 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__a2d5c29a;
+extern StructInfo __struct_info__e6884b9e;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__90dcb88a;
+extern TypeInfo __type_info__1a54b166;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__5435bd82;
+extern TypeInfo __type_info__4edce7ce;
+extern VarInfo __var_info__ed223c45;
+extern VarInfo __var_info__7ee9b99a;
+extern VarInfo __var_info__f940b6d3;
+extern VarInfo __var_info__b7063667;
+extern VarInfo __var_info__cbddc3db;
+extern VarInfo __var_info__c70e61a5;
+extern VarInfo __var_info__536cceb1;
+extern VarInfo __var_info__84b4585b;
+extern VarInfo __var_info__3faf109a;
+extern VarInfo __var_info__72d61e4e;
+extern VarInfo __var_info__39731bcf;
+extern FuncInfo __func_info__6c70f45f;
+
+TypeInfo * __type_info__b7063667_arg_types_var_2731917978[2] = { &__type_info__90dcb88a, &__type_info__359c1b32 };
+VarInfo __struct_info__a2d5c29a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__b7063667_arg_types_var_2731917978, nullptr, 2, 0, nullptr, 28, 0xb7063667, "__lambda", 0 };
+TypeInfo * __type_info__72d61e4e_arg_types_var_2731917978[1] = { &__type_info__5435bd82 };
+VarInfo __struct_info__a2d5c29a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__72d61e4e_arg_types_var_2731917978, nullptr, 1, 0, nullptr, 28, 0x72d61e4e, "__finalize", 4 };
+VarInfo __struct_info__a2d5c29a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc70e61a5, "i", 8 };
+VarInfo * __struct_info__a2d5c29a_fields[3] =  { &__struct_info__a2d5c29a_field_0, &__struct_info__a2d5c29a_field_1, &__struct_info__a2d5c29a_field_2 };
+StructInfo __struct_info__a2d5c29a = {"_lambda_thismodule_63_12_1", __struct_info__a2d5c29a_fields, 3, 12, -1, nullptr, 0xa2d5c29a };
+TypeInfo * __type_info__cbddc3db_arg_types_var_3867691934[2] = { &__type_info__4edce7ce, &__type_info__e6eb6b88 };
+VarInfo __struct_info__e6884b9e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__cbddc3db_arg_types_var_3867691934, nullptr, 2, 0, nullptr, 28, 0xcbddc3db, "__lambda", 0 };
+TypeInfo * __type_info__3faf109a_arg_types_var_3867691934[1] = { &__type_info__1a54b166 };
+VarInfo __struct_info__e6884b9e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3faf109a_arg_types_var_3867691934, nullptr, 1, 0, nullptr, 28, 0x3faf109a, "__finalize", 4 };
+VarInfo __struct_info__e6884b9e_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x536cceb1, "__yield", 8 };
+VarInfo __struct_info__e6884b9e_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xf940b6d3, "_loop_at_70", 12 };
+VarInfo __struct_info__e6884b9e_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x7ee9b99a, "t", 16 };
+VarInfo __struct_info__e6884b9e_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x39731bcf, "_pvar_0_at_70", 24 };
+VarInfo __struct_info__e6884b9e_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x84b4585b, "_source_0_at_70", 32 };
+VarInfo * __struct_info__e6884b9e_fields[7] =  { &__struct_info__e6884b9e_field_0, &__struct_info__e6884b9e_field_1, &__struct_info__e6884b9e_field_2, &__struct_info__e6884b9e_field_3, &__struct_info__e6884b9e_field_4, &__struct_info__e6884b9e_field_5, &__struct_info__e6884b9e_field_6 };
+StructInfo __struct_info__e6884b9e = {"_lambda_thismodule_70_8_2", __struct_info__e6884b9e_fields, 7, 40, -1, nullptr, 0xe6884b9e };
+VarInfo __func_info__6c70f45f_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::HeapSizeClassStats"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 38, 0xed223c45, "cls", 0 };
+VarInfo * __func_info__6c70f45f_fields[1] =  { &__func_info__6c70f45f_field_0 };
+FuncInfo __func_info__6c70f45f = {"invoke block<(cls:$::HeapSizeClassStats const):void> const", "", __func_info__6c70f45f_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x6c70f45f, 0x0 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x13667ab1 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__90dcb88a = { Type::tStructure, &__struct_info__a2d5c29a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x90dcb88a };
+TypeInfo __type_info__1a54b166 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4edce7ce, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1a54b166 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0xe6eb6b88 };
+TypeInfo __type_info__5435bd82 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__90dcb88a, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x5435bd82 };
+TypeInfo __type_info__4edce7ce = { Type::tStructure, &__struct_info__e6884b9e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x4edce7ce };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__359c1b32 };
+namespace  {
+
+struct _lambda_thismodule_63_12_1 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_63_12_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_63_12_1 *)) __finalize;
+	int32_t i;
+};
+static_assert(sizeof(_lambda_thismodule_63_12_1)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_12_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_12_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_12_1,i)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_70_8_2 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_70_8_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_70_8_2 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_70;
+	int32_t t;
+	void * _pvar_0_at_70;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_70;
+};
+static_assert(sizeof(_lambda_thismodule_70_8_2)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_70_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_70_8_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_70_8_2,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_70_8_2,_loop_at_70)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_70_8_2,t)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_70_8_2,_pvar_0_at_70)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_70_8_2,_source_0_at_70)==32,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_63_12_1_0x60_finazlier_91788f7720814872 ( Context * __context__, struct _lambda_thismodule_63_12_1 * ____this_rename_at_63 );
+inline int32_t _Func_lambda_thismodule_63_12_1_0x60_function_89b9fb65a28512a3 ( Context * __context__, struct _lambda_thismodule_63_12_1 & ____this_rename_at_63, int32_t __x_rename_at_62 );
+inline void _Func_lambda_thismodule_70_8_2_0x60_finazlier_d9c3a8e8330d62a0 ( Context * __context__, struct _lambda_thismodule_70_8_2 * ____this_rename_at_70 );
+inline bool _Func_lambda_thismodule_70_8_2_0x60_function_577d839e4e1fdea5 ( Context * __context__, struct _lambda_thismodule_70_8_2 & ____this_rename_at_70, int32_t & ___yield_70_rename_at_70 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_b78082ef2c560db0 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 );
+inline void _Funcbuiltin_0x60_finalize_cd1514d2d7718b99 ( Context * __context__, TArray<float4> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void check_closure_pool_stats_de52df8d50c13691 ( Context * __context__ );
+inline void check_heap_stats_795367918841d3d3 ( Context * __context__ );
+inline void check_string_heap_stats_d4c88a715dbb1301 ( Context * __context__ );
+inline void check_string_heap_trim_ae1a03056b65c13 ( Context * __context__ );
+inline void finalize_15ace809b6f6b87a ( Context * __context__, struct _lambda_thismodule_63_12_1 & ____this_rename_at_63 );
+inline void finalize_ba63f2f2765401ac ( Context * __context__, struct _lambda_thismodule_70_8_2 & ____this_rename_at_70 );
+inline bool test_28c706f395339266 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_63_12_1_0x60_finazlier_91788f7720814872 ( Context * __context__, struct _lambda_thismodule_63_12_1 * ____this_rename_at_63 )
+{
+	finalize_15ace809b6f6b87a(__context__,das_arg<struct _lambda_thismodule_63_12_1>::pass(das_deref(__context__,____this_rename_at_63)));
+	das_delete_lambda_struct<struct _lambda_thismodule_63_12_1 *>::clear(__context__,____this_rename_at_63);
+}
+
+inline int32_t _Func_lambda_thismodule_63_12_1_0x60_function_89b9fb65a28512a3 ( Context * __context__, struct _lambda_thismodule_63_12_1 &  ____this_rename_at_63, int32_t __x_rename_at_62 )
+{
+	return __x_rename_at_62 + ____this_rename_at_63.i;
+}
+
+inline void _Func_lambda_thismodule_70_8_2_0x60_finazlier_d9c3a8e8330d62a0 ( Context * __context__, struct _lambda_thismodule_70_8_2 * ____this_rename_at_70 )
+{
+	finalize_ba63f2f2765401ac(__context__,das_arg<struct _lambda_thismodule_70_8_2>::pass(das_deref(__context__,____this_rename_at_70)));
+	das_delete_lambda_struct<struct _lambda_thismodule_70_8_2 *>::clear(__context__,____this_rename_at_70);
+}
+
+inline bool _Func_lambda_thismodule_70_8_2_0x60_function_577d839e4e1fdea5 ( Context * __context__, struct _lambda_thismodule_70_8_2 &  ____this_rename_at_70, int32_t & ___yield_70_rename_at_70 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_70_32;
+	switch (____this_rename_at_70.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_70._loop_at_70,true);
+	das_move(____this_rename_at_70._source_0_at_70,(_temp_make_local_70_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,3)))));
+	memset(&(____this_rename_at_70.t), 0, 4);
+	das_copy(____this_rename_at_70._pvar_0_at_70,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_70.t)));
+	DAS_SETBOOLAND((____this_rename_at_70._loop_at_70),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_70._source_0_at_70),____this_rename_at_70._pvar_0_at_70,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_70._loop_at_70 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_70_rename_at_70,____this_rename_at_70.t);
+	das_copy(____this_rename_at_70.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_70._loop_at_70),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_70._source_0_at_70),____this_rename_at_70._pvar_0_at_70,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_70._source_0_at_70),____this_rename_at_70._pvar_0_at_70,__context__);
+	return false;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_b78082ef2c560db0 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_334; das_zero(__it_rename_at_334);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_334),__rng_rename_at_333,__context__);
+	return /* <- */ __it_rename_at_334;
+}
+
+inline void _Funcbuiltin_0x60_finalize_cd1514d2d7718b99 ( Context * __context__, TArray<float4> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<float4>>::pass(__a_rename_at_285),16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float4>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,16,__context__);
+}
+
+inline void check_closure_pool_stats_de52df8d50c13691 ( Context * __context__ )
+{
+	das::ClosurePoolStats __before_rename_at_57; das_zero(__before_rename_at_57);
+	closure_pool_stats(das_arg<das::ClosurePoolStats>::pass(__before_rename_at_57),__context__);
+	uint64_t __bytesBefore_rename_at_59 = (uint64_t)heap_bytes_allocated(__context__);
+	int32_t __total_rename_at_60 = 0;
+	{
+		bool __need_loop_61 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_61;
+		__need_loop_61 = __i_iterator.first(__context__,(__i_rename_at_61)) && __need_loop_61;
+		for ( ; __need_loop_61 ; __need_loop_61 = __i_iterator.next(__context__,(__i_rename_at_61)) )
+		{
+			Lambda DAS_COMMENT((int32_t,int32_t)) __lam_rename_at_62; das_zero(__lam_rename_at_62); das_move(__lam_rename_at_62, das_ascend<int32_t,struct _lambda_thismodule_63_12_1>::make(__context__,&__type_info__90dcb88a,(([&]() -> struct _lambda_thismodule_63_12_1 {
+				struct _lambda_thismodule_63_12_1 __mks_63;
+				das_copy((__mks_63.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_63_12_1`function _lambda_thismodule_63_12_1 int#const*/ 3475928196u))));
+				das_copy((__mks_63.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_63_12_1`finazlier #ptr#_lambda_thismodule_63_12_1#explicit*/ 4158397190u))));
+				das_copy((__mks_63.i),(__i_rename_at_61));
+				return __mks_63;
+			})())));
+			__total_rename_at_60 += das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,__lam_rename_at_62,1);
+			das_delete<Lambda DAS_COMMENT((int32_t,int32_t))>::clear(__context__,__lam_rename_at_62);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_61));
+	};
+	uint64_t __bytesAfter_rename_at_67 = (uint64_t)heap_bytes_allocated(__context__);
+	DAS_ASSERT((__bytesAfter_rename_at_67 == __bytesBefore_rename_at_59));
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_69; das_zero(__gen_rename_at_69); das_move(__gen_rename_at_69, _Funcbuiltin_0x60_each_b78082ef2c560db0(__context__,das_ascend<bool,struct _lambda_thismodule_70_8_2>::make(__context__,&__type_info__4edce7ce,(([&]() -> struct _lambda_thismodule_70_8_2 {
+		struct _lambda_thismodule_70_8_2 __mks_69;
+		das_zero(__mks_69);
+		das_copy((__mks_69.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_70_8_2`function _lambda_thismodule_70_8_2 int#ref*/ 4211724888u))));
+		das_copy((__mks_69.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_70_8_2`finazlier #ptr#_lambda_thismodule_70_8_2#explicit*/ 2798897832u))));
+		return __mks_69;
+	})()))));
+	{
+		bool __need_loop_73 = true;
+		// x : int
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator(__gen_rename_at_69);
+		int32_t __x_rename_at_73;
+		__need_loop_73 = __x_iterator.first(__context__,(__x_rename_at_73)) && __need_loop_73;
+		for ( ; __need_loop_73 ; __need_loop_73 = __x_iterator.next(__context__,(__x_rename_at_73)) )
+		{
+			__total_rename_at_60 += __x_rename_at_73;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_73));
+	};
+	DAS_ASSERT((__total_rename_at_60 == 58));
+	das::ClosurePoolStats __after_rename_at_76; das_zero(__after_rename_at_76);
+	closure_pool_stats(das_arg<das::ClosurePoolStats>::pass(__after_rename_at_76),__context__);
+	DAS_ASSERT(((__after_rename_at_76.allocations /*allocations*/ - __before_rename_at_57.allocations /*allocations*/) >= 0xcull));
+	DAS_ASSERT(((__after_rename_at_76.frees /*frees*/ - __before_rename_at_57.frees /*frees*/) >= 0xcull));
+	DAS_ASSERT(((__after_rename_at_76.reused /*reused*/ - __before_rename_at_57.reused /*reused*/) >= 0x9ull));
+	DAS_ASSERT((__after_rename_at_76.freeBlocks /*freeBlocks*/ >= 0x1u));
+	DAS_ASSERT((__after_rename_at_76.freeBytes /*freeBytes*/ >= (uint64_t(__after_rename_at_76.freeBlocks /*freeBlocks*/) * 0x10ull)));
+}
+
+inline void check_heap_stats_795367918841d3d3 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,320,"check_heap_stats " DAS_FILE_LINE);
+{
+	TArray<int32_t> __a_rename_at_4; das_zero(__a_rename_at_4);
+	TArray<float4> __b_rename_at_5; das_zero(__b_rename_at_5);
+	{
+		bool __need_loop_6 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_6;
+		__need_loop_6 = __i_iterator.first(__context__,(__i_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __i_iterator.next(__context__,(__i_rename_at_6)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_4),__i_rename_at_6,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_6));
+	};
+	_Funcbuiltin_0x60_resize_761fb73a377a5e66(__context__,das_arg<TArray<float4>>::pass(__b_rename_at_5),100);
+	das::HeapStats __stats_rename_at_9; das_zero(__stats_rename_at_9);
+	heap_stats(das_arg<das::HeapStats>::pass(__stats_rename_at_9),__context__);
+	uint64_t __allocated_rename_at_11 = (uint64_t)heap_bytes_allocated(__context__);
+	DAS_ASSERT((__stats_rename_at_9.bytesAllocated /*bytesAllocated*/ == __allocated_rename_at_11));
+	DAS_ASSERT((__stats_rename_at_9.maxBytesAllocated /*maxBytesAllocated*/ >= __stats_rename_at_9.bytesAllocated /*bytesAllocated*/));
+	DAS_ASSERT((__stats_rename_at_9.totalBytes /*totalBytes*/ >= __stats_rename_at_9.bytesAllocated /*bytesAllocated*/));
+	DAS_ASSERT((__stats_rename_at_9.bigBlocks /*bigBlocks*/ >= 0x2u));
+	DAS_ASSERT((__stats_rename_at_9.maxBigBlock /*maxBigBlock*/ >= uint64_t(builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_4)) * 4)));
+	DAS_ASSERT(((__stats_rename_at_9.fragmentation /*fragmentation*/ >= 0.f) && (__stats_rename_at_9.fragmentation /*fragmentation*/ <= 1.f)));
+	uint64_t __live_rename_at_18 = 0x0ull;
+	int32_t __classes_rename_at_19 = 0;
+	heap_size_class_stats(das_make_block<void,das::HeapSizeClassStats const  &>(__context__,304,0,&__func_info__6c70f45f,[&](das::HeapSizeClassStats const  & __cls_rename_at_20)->void{
+		__live_rename_at_18 += __cls_rename_at_20.liveBytes /*liveBytes*/;
+		__classes_rename_at_19++;
+		DAS_ASSERT(((__cls_rename_at_20.fragmentation /*fragmentation*/ >= 0.f) && (__cls_rename_at_20.fragmentation /*fragmentation*/ <= 1.f)));
+	}),__context__);
+	DAS_ASSERT((__classes_rename_at_19 > 0));
+	DAS_ASSERT((__live_rename_at_18 == (__stats_rename_at_9.smallLiveBytes /*smallLiveBytes*/ + __stats_rename_at_9.bigBytes /*bigBytes*/)));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_4));
+	_Funcbuiltin_0x60_finalize_cd1514d2d7718b99(__context__,das_arg<TArray<float4>>::pass(__b_rename_at_5));
+}}
+
+inline void check_string_heap_stats_d4c88a715dbb1301 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,256,"check_string_heap_stats " DAS_FILE_LINE);
+{
+	char * __s_rename_at_30 = (char *)(((char *) "hello"));
+	{
+		bool __need_loop_31 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_31;
+		__need_loop_31 = __i_iterator.first(__context__,(__i_rename_at_31)) && __need_loop_31;
+		for ( ; __need_loop_31 ; __need_loop_31 = __i_iterator.next(__context__,(__i_rename_at_31)) )
+		{
+			das_copy(__s_rename_at_30,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(__s_rename_at_30),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(__i_rename_at_31)))),*__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_31));
+	};
+	das::HeapStats __stats_rename_at_33; das_zero(__stats_rename_at_33);
+	string_heap_stats(das_arg<das::HeapStats>::pass(__stats_rename_at_33),__context__);
+	uint64_t __allocated_rename_at_35 = (uint64_t)string_heap_bytes_allocated(__context__);
+	DAS_ASSERT((__stats_rename_at_33.bytesAllocated /*bytesAllocated*/ == __allocated_rename_at_35));
+	DAS_ASSERT((__stats_rename_at_33.totalBytes /*totalBytes*/ >= __stats_rename_at_33.bytesAllocated /*bytesAllocated*/));
+	uint64_t __live_rename_at_38 = 0x0ull;
+	string_heap_size_class_stats(das_make_block<void,das::HeapSizeClassStats const  &>(__context__,240,0,&__func_info__6c70f45f,[&](das::HeapSizeClassStats const  & __cls_rename_at_39)->void{
+		__live_rename_at_38 += __cls_rename_at_39.liveBytes /*liveBytes*/;
+	}),__context__);
+	DAS_ASSERT((__live_rename_at_38 != 0x0ull));
+}}
+
+inline void check_string_heap_trim_ae1a03056b65c13 ( Context * __context__ )
+{
+	char * __s_rename_at_45 = (char *)(((char *) ""));
+	{
+		bool __need_loop_46 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_46;
+		__need_loop_46 = __i_iterator.first(__context__,(__i_rename_at_46)) && __need_loop_46;
+		for ( ; __need_loop_46 ; __need_loop_46 = __i_iterator.next(__context__,(__i_rename_at_46)) )
+		{
+			das_copy(__s_rename_at_45,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(__s_rename_at_45),cast<char *>::from(((char *) "0123456789")),*__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_46));
+	};
+	das_copy(__s_rename_at_45,((char *) ""));
+	string_heap_collect(__context__,nullptr);
+	das::HeapStats __stats_rename_at_51; das_zero(__stats_rename_at_51);
+	string_heap_stats(das_arg<das::HeapStats>::pass(__stats_rename_at_51),__context__);
+	DAS_ASSERT((__stats_rename_at_51.bigFreeBlocks /*bigFreeBlocks*/ == 0x0u));
+	DAS_ASSERT((__stats_rename_at_51.bigFreeBytes /*bigFreeBytes*/ == 0x0ull));
+}
+
+inline void finalize_15ace809b6f6b87a ( Context * __context__, struct _lambda_thismodule_63_12_1 &  ____this_rename_at_63 )
+{
+	memset(&(____this_rename_at_63), 0, 12);
+}
+
+inline void finalize_ba63f2f2765401ac ( Context * __context__, struct _lambda_thismodule_70_8_2 &  ____this_rename_at_70 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_70._source_0_at_70),__context__);
+	memset(&(____this_rename_at_70), 0, 40);
+}
+
+inline bool test_28c706f395339266 ( Context * __context__ )
+{
+	check_heap_stats_795367918841d3d3(__context__);
+	check_string_heap_stats_d4c88a715dbb1301(__context__);
+	check_string_heap_trim_ae1a03056b65c13(__context__);
+	check_closure_pool_stats_de52df8d50c13691(__context__);
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_63_12_1_0x60_finazlier_91788f7720814872
+		aotLib[0x565072905165d071] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_63_12_1 *  ),&_Func_lambda_thismodule_63_12_1_0x60_finazlier_91788f7720814872>>();
+	};
+		// _Func_lambda_thismodule_63_12_1_0x60_function_89b9fb65a28512a3
+		aotLib[0xd6631830910671ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_63_12_1 & , int32_t  ),&_Func_lambda_thismodule_63_12_1_0x60_function_89b9fb65a28512a3>>();
+	};
+		// _Func_lambda_thismodule_70_8_2_0x60_finazlier_d9c3a8e8330d62a0
+		aotLib[0x36b37e256032ea5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_70_8_2 *  ),&_Func_lambda_thismodule_70_8_2_0x60_finazlier_d9c3a8e8330d62a0>>();
+	};
+		// _Func_lambda_thismodule_70_8_2_0x60_function_577d839e4e1fdea5
+		aotLib[0x5b6c5659c35a5704] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_70_8_2 & , int32_t &  ),&_Func_lambda_thismodule_70_8_2_0x60_function_577d839e4e1fdea5>>();
+	};
+		// _Funcbuiltin_0x60_each_b78082ef2c560db0
+		aotLib[0xfc50b39fdf463a35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_b78082ef2c560db0>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_finalize_cd1514d2d7718b99
+		aotLib[0xcaeab429993cce4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> &  ),&_Funcbuiltin_0x60_finalize_cd1514d2d7718b99>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_resize_761fb73a377a5e66
+		aotLib[0xc267e309ce3735b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , int32_t  ),&_Funcbuiltin_0x60_resize_761fb73a377a5e66>>();
+	};
+		// check_closure_pool_stats_de52df8d50c13691
+		aotLib[0x96961eafc25eef3c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_closure_pool_stats_de52df8d50c13691>>();
+	};
+		// check_heap_stats_795367918841d3d3
+		aotLib[0xc30fc6571d8e1a4c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_heap_stats_795367918841d3d3>>();
+	};
+		// check_string_heap_stats_d4c88a715dbb1301
+		aotLib[0x23a7465035d025c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_string_heap_stats_d4c88a715dbb1301>>();
+	};
+		// check_string_heap_trim_ae1a03056b65c13
+		aotLib[0xd8f839124ed8b515] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_string_heap_trim_ae1a03056b65c13>>();
+	};
+		// finalize_15ace809b6f6b87a
+		aotLib[0xa9d6cd395cae58dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_63_12_1 &  ),&finalize_15ace809b6f6b87a>>();
+	};
+		// finalize_ba63f2f2765401ac
+		aotLib[0x786e50c121b6ddb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_70_8_2 &  ),&finalize_ba63f2f2765401ac>>();
+	};
+		// test_28c706f395339266
+		aotLib[0x21ddf0ce65270deb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_28c706f395339266>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,195 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+ // require _hint_macros
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure GetHintFnMacro
+namespace _hint_macros {
+
+struct HintLookup {
+	TTable<uint32_t,char *> tab;
+};
+static_assert(sizeof(HintLookup)==48,"structure size mismatch with DAS");
+static_assert(offsetof(HintLookup,tab)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_reserve_6ff13d4fd713919b ( Context * __context__, TTable<uint32_t,char *> & __Tab_rename_at_37, int32_t __newSize_rename_at_37 );
+inline TTable<uint32_t,char *> _Funcbuiltin_0x60_to_table_move_bb8b04f8df75a9b4 ( Context * __context__, TDim<TTuple<16,uint32_t,char *>,2> & __a_rename_at_419 );
+inline bool test_28d8b6ed59fef541 ( Context * __context__ );
+inline bool ttt_b0087d371648db3f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_reserve_6ff13d4fd713919b ( Context * __context__, TTable<uint32_t,char *> &  __Tab_rename_at_37, int32_t __newSize_rename_at_37 )
+{
+	builtin_table_reserve(das_arg<TTable<uint32_t,char *>>::pass(__Tab_rename_at_37),__newSize_rename_at_37,4,8,__context__);
+}
+
+inline TTable<uint32_t,char *> _Funcbuiltin_0x60_to_table_move_bb8b04f8df75a9b4 ( Context * __context__, TDim<TTuple<16,uint32_t,char *>,2> &  __a_rename_at_419 )
+{
+	TTable<uint32_t,char *> __tab_rename_at_420; das_zero(__tab_rename_at_420);
+	_Funcbuiltin_0x60_reserve_6ff13d4fd713919b(__context__,das_arg<TTable<uint32_t,char *>>::pass(__tab_rename_at_420),2);
+	{
+		bool __need_loop_423 = true;
+		// x : tuple<uint aka keyT;string aka valT>&
+		das_iterator<TDim<TTuple<16,uint32_t,char *>,2>> __x_iterator(__a_rename_at_419);
+		TTuple<16,uint32_t,char *> * __x_rename_at_423;
+		__need_loop_423 = __x_iterator.first(__context__,(__x_rename_at_423)) && __need_loop_423;
+		for ( ; __need_loop_423 ; __need_loop_423 = __x_iterator.next(__context__,(__x_rename_at_423)) )
+		{
+			das_copy(__tab_rename_at_420(das_get_tuple_field<uint32_t,0>::get((*__x_rename_at_423)),__context__),das_get_tuple_field<char *,8>::get((*__x_rename_at_423)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_423));
+	};
+	return /* <- */ __tab_rename_at_420;
+}
+
+inline bool test_28d8b6ed59fef541 ( Context * __context__ )
+{
+	TDim<TTuple<16,uint32_t,char *>,2> _temp_make_local_12_80;
+	struct _hint_macros::HintLookup __hints_rename_at_11; das_zero(__hints_rename_at_11); das_move(__hints_rename_at_11, (([&]() -> struct _hint_macros::HintLookup {
+		struct _hint_macros::HintLookup __mks_11;
+		das_move((__mks_11.tab),(_Funcbuiltin_0x60_to_table_move_bb8b04f8df75a9b4(__context__,das_arg<TDim<TTuple<16,uint32_t,char *>,2>>::pass((([&]() -> TDim<TTuple<16,uint32_t,char *>,2>& {
+			_temp_make_local_12_80(0,__context__) = (([&]() -> TTuple<16,uint32_t,char *> {
+				TTuple<16,uint32_t,char *> __mkt_13;
+				das_get_tuple_field<uint32_t,0>::get(__mkt_13) = 0x165709c9u;
+				das_get_tuple_field<char *,8>::get(__mkt_13) = ((char *) "one");
+				return __mkt_13;
+			})());
+			_temp_make_local_12_80(1,__context__) = (([&]() -> TTuple<16,uint32_t,char *> {
+				TTuple<16,uint32_t,char *> __mkt_14;
+				das_get_tuple_field<uint32_t,0>::get(__mkt_14) = 0x752f8514u;
+				das_get_tuple_field<char *,8>::get(__mkt_14) = ((char *) "two");
+				return __mkt_14;
+			})());
+			return _temp_make_local_12_80;
+		})())))));
+		return __mks_11;
+	})()));
+	char * __h1_rename_at_17 = (char *)(char *)(das_invoke_function<char * const >::invoke<struct _hint_macros::HintLookup &,char * const ,char * const ,uint32_t>(__context__,Func(__context__->fnIdxByMangledName(/*@_hint_macros::get_hint HintLookup#const string#const string#const uint#const*/ 3412939808u)),das_arg<struct _hint_macros::HintLookup>::pass(__hints_rename_at_11),((char *) "one"),((char *) "no hint"),0x165709c9u));
+	char * __h2_rename_at_18 = (char *)(char *)(das_invoke_function<char * const >::invoke<struct _hint_macros::HintLookup &,char * const ,char * const ,uint32_t>(__context__,Func(__context__->fnIdxByMangledName(/*@_hint_macros::get_hint HintLookup#const string#const string#const uint#const*/ 3412939808u)),das_arg<struct _hint_macros::HintLookup>::pass(__hints_rename_at_11),((char *) "three"),((char *) "no hint"),0xb8265203u));
+	char * __s3_rename_at_19 = (char *)(((char *) "tw"));
+	SimPolicy<char *>::SetAdd((char *)&(__s3_rename_at_19),cast<char *>::from(((char *) "o")),*__context__);
+	char * __h3_rename_at_21 = (char *)(char *)(das_invoke_function<char * const >::invoke<struct _hint_macros::HintLookup &,char *,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@_hint_macros::get_hint HintLookup#const string#const string#const*/ 2766599224u)),das_arg<struct _hint_macros::HintLookup>::pass(__hints_rename_at_11),__s3_rename_at_19,((char *) "no hint")));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__h1_rename_at_17),cast<char *>::from(((char *) "one")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__h2_rename_at_18),cast<char *>::from(((char *) "no hint")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__h3_rename_at_21),cast<char *>::from(((char *) "two")),*__context__)));
+	DAS_ASSERT((das_global<int32_t,0>(__context__) /*g_non_hints*/ == 1));
+	return true;
+}
+
+inline bool ttt_b0087d371648db3f ( Context * __context__ )
+{
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_reserve_6ff13d4fd713919b
+		aotLib[0x4f11fcb5559aa37d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<uint32_t,char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_6ff13d4fd713919b>>();
+	};
+		// _Funcbuiltin_0x60_to_table_move_bb8b04f8df75a9b4
+		aotLib[0x655871e1d1bc2453] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<uint32_t,char *> (*) ( Context * __context__, TDim<TTuple<16,uint32_t,char *>,2> &  ),&_Funcbuiltin_0x60_to_table_move_bb8b04f8df75a9b4>>();
+	};
+		// test_28d8b6ed59fef541
+		aotLib[0x87fde09f37093fe8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_28d8b6ed59fef541>>();
+	};
+		// ttt_b0087d371648db3f
+		aotLib[0x434f546c6487b225] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&ttt_b0087d371648db3f>>();
+	};
+		// [[ init script ]]
+		aotLib[0xe8d5b18ccb87aa95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
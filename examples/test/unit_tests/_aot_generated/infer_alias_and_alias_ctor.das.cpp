@@ -0,0 +1,198 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__167fb0bd;
+extern FuncInfo __func_info__1894e3cd;
+
+VarInfo __func_info__1894e3cd_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x167fb0bd, "obj", 0 };
+VarInfo * __func_info__1894e3cd_fields[1] =  { &__func_info__1894e3cd_field_0 };
+FuncInfo __func_info__1894e3cd = {"invoke block<(obj:int? const):void> const", "", __func_info__1894e3cd_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x1894e3cd, 0x0 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline int32_t * _Func_0x60_findObject_13d39a4d23e28e0 ( Context * __context__, TTable<char *,int32_t> const  & __objects_rename_at_9, char * const  __guid_rename_at_9 );
+inline float _Func_0x60_join_5b77f1a63470bdf6 ( Context * __context__, TArray<float> const  & __a_rename_at_3 );
+inline void _Funcbuiltin_0x60_find_6467b1430cb311f9 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_139, char * const  __at_rename_at_139, Block DAS_COMMENT((void,int32_t * const )) const  & __blk_rename_at_139 );
+inline void _Funcbuiltin_0x60_push_8a9191e5eb1aa83e ( Context * __context__, TArray<float> & __Arr_rename_at_40, float __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_reserve_7b63605b74776272 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_37, int32_t __newSize_rename_at_37 );
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_8ffea931442adc15 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> & __a_rename_at_419 );
+inline bool test_186af3a97b952ac7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t * _Func_0x60_findObject_13d39a4d23e28e0 ( Context * __context__, TTable<char *,int32_t> const  &  __objects_rename_at_9, char * const  __guid_rename_at_9 ) { das_stack_prologue __prologue(__context__,112,"`findObject " DAS_FILE_LINE);
+{
+	int32_t * __foundObj_rename_at_10 = 0;
+	_Funcbuiltin_0x60_find_6467b1430cb311f9(__context__,__objects_rename_at_9,__guid_rename_at_9,das_make_block<void,int32_t * const >(__context__,96,0,&__func_info__1894e3cd,[&](int32_t * const  __obj_rename_at_11)->void{
+		das_copy(__foundObj_rename_at_10,__obj_rename_at_11);
+	}));
+	return __foundObj_rename_at_10;
+}}
+
+inline float _Func_0x60_join_5b77f1a63470bdf6 ( Context * __context__, TArray<float> const  &  __a_rename_at_3 )
+{
+	float __t_rename_at_4 = 0.f;
+	{
+		bool __need_loop_5 = true;
+		// x : float aka numt const&
+		das_iterator<TArray<float> const > __x_iterator(__a_rename_at_3);
+		float const  * __x_rename_at_5;
+		__need_loop_5 = __x_iterator.first(__context__,(__x_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __x_iterator.next(__context__,(__x_rename_at_5)) )
+		{
+			__t_rename_at_4 += (*__x_rename_at_5);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_5));
+	};
+	return __t_rename_at_4;
+}
+
+inline void _Funcbuiltin_0x60_find_6467b1430cb311f9 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_139, char * const  __at_rename_at_139, Block DAS_COMMENT((void,int32_t * const )) const  &  __blk_rename_at_139 )
+{
+	builtin_table_lock(__Tab_rename_at_139,__context__);
+	int32_t * __val_rename_at_141 = __builtin_table_find(__context__,__Tab_rename_at_139,__at_rename_at_139);
+	das_invoke<void>::invoke<int32_t *>(__context__,__blk_rename_at_139,__val_rename_at_141);
+	builtin_table_unlock(__Tab_rename_at_139,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_8a9191e5eb1aa83e ( Context * __context__, TArray<float> &  __Arr_rename_at_40, float __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<float>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_reserve_7b63605b74776272 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_37, int32_t __newSize_rename_at_37 )
+{
+	builtin_table_reserve(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_37),__newSize_rename_at_37,8,4,__context__);
+}
+
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_8ffea931442adc15 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  __a_rename_at_419 )
+{
+	TTable<char *,int32_t> __tab_rename_at_420; das_zero(__tab_rename_at_420);
+	_Funcbuiltin_0x60_reserve_7b63605b74776272(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_420),2);
+	{
+		bool __need_loop_423 = true;
+		// x : tuple<string aka keyT;int aka valT>&
+		das_iterator<TDim<TTuple<16,char *,int32_t>,2>> __x_iterator(__a_rename_at_419);
+		TTuple<16,char *,int32_t> * __x_rename_at_423;
+		__need_loop_423 = __x_iterator.first(__context__,(__x_rename_at_423)) && __need_loop_423;
+		for ( ; __need_loop_423 ; __need_loop_423 = __x_iterator.next(__context__,(__x_rename_at_423)) )
+		{
+			das_copy(__tab_rename_at_420(das_get_tuple_field<char *,0>::get((*__x_rename_at_423)),__context__),das_get_tuple_field<int32_t,8>::get((*__x_rename_at_423)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_423));
+	};
+	return /* <- */ __tab_rename_at_420;
+}
+
+inline bool test_186af3a97b952ac7 ( Context * __context__ )
+{
+	TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_24_128;
+	TArray<float> __a_rename_at_18; das_zero(__a_rename_at_18);
+	_Funcbuiltin_0x60_push_8a9191e5eb1aa83e(__context__,das_arg<TArray<float>>::pass(__a_rename_at_18),1.f,-1);
+	_Funcbuiltin_0x60_push_8a9191e5eb1aa83e(__context__,das_arg<TArray<float>>::pass(__a_rename_at_18),2.f,-1);
+	_Funcbuiltin_0x60_push_8a9191e5eb1aa83e(__context__,das_arg<TArray<float>>::pass(__a_rename_at_18),3.f,-1);
+	float __t_rename_at_22 = (float)_Func_0x60_join_5b77f1a63470bdf6(__context__,das_arg<TArray<float>>::pass(__a_rename_at_18));
+	DAS_ASSERT((__t_rename_at_22 == 6.f));
+	TTable<char *,int32_t> __tab_rename_at_24; das_zero(__tab_rename_at_24); das_move(__tab_rename_at_24, (TTable<char *,int32_t>)_Funcbuiltin_0x60_to_table_move_8ffea931442adc15(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+		_temp_make_local_24_128(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_24;
+			das_get_tuple_field<char *,0>::get(__mkt_24) = ((char *) "one");
+			das_get_tuple_field<int32_t,8>::get(__mkt_24) = 1;
+			return __mkt_24;
+		})());
+		_temp_make_local_24_128(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_24;
+			das_get_tuple_field<char *,0>::get(__mkt_24) = ((char *) "two");
+			das_get_tuple_field<int32_t,8>::get(__mkt_24) = 2;
+			return __mkt_24;
+		})());
+		return _temp_make_local_24_128;
+	})()))));
+	DAS_VERIFY((das_null_coalescing<int32_t>::get(_Func_0x60_findObject_13d39a4d23e28e0(__context__,__tab_rename_at_24,((char *) "one")),0) == 1));
+	DAS_VERIFY((das_null_coalescing<int32_t>::get(_Func_0x60_findObject_13d39a4d23e28e0(__context__,__tab_rename_at_24,((char *) "two")),0) == 2));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_findObject_13d39a4d23e28e0
+		aotLib[0x95c659c8a73f012f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t * (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const   ),&_Func_0x60_findObject_13d39a4d23e28e0>>();
+	};
+		// _Func_0x60_join_5b77f1a63470bdf6
+		aotLib[0x349e1846a82ec31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TArray<float> const  &  ),&_Func_0x60_join_5b77f1a63470bdf6>>();
+	};
+		// _Funcbuiltin_0x60_find_6467b1430cb311f9
+		aotLib[0x42f363f2fbf4a835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const  , Block DAS_COMMENT((void,int32_t * const )) const  &  ),&_Funcbuiltin_0x60_find_6467b1430cb311f9>>();
+	};
+		// _Funcbuiltin_0x60_push_8a9191e5eb1aa83e
+		aotLib[0xc0f5dc1255d7c9dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float , int32_t  ),&_Funcbuiltin_0x60_push_8a9191e5eb1aa83e>>();
+	};
+		// _Funcbuiltin_0x60_reserve_7b63605b74776272
+		aotLib[0xf8e41cf7a57fff11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_7b63605b74776272>>();
+	};
+		// _Funcbuiltin_0x60_to_table_move_8ffea931442adc15
+		aotLib[0xb8552006656e012f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<char *,int32_t> (*) ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  ),&_Funcbuiltin_0x60_to_table_move_8ffea931442adc15>>();
+	};
+		// test_186af3a97b952ac7
+		aotLib[0x757c0ef78d6bd3e8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_186af3a97b952ac7>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
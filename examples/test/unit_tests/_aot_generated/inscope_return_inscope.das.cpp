@@ -0,0 +1,127 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Foo {
+	int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+
+inline void buggy_73020f0ac35c066 ( Context * __context__, bool __skip_rename_at_5 );
+inline void finalize_b366c5ca57c24d6a ( Context * __context__, struct Foo * & ____this_rename_at_12 );
+inline void finalize_aef1da7f017792ad ( Context * __context__, struct Foo & ____this_rename_at_1 );
+inline bool test_6ac500428cae641f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void buggy_73020f0ac35c066 ( Context * __context__, bool __skip_rename_at_5 )
+{
+	struct Foo * __a_rename_at_6; memset(&__a_rename_at_6,0,sizeof(__a_rename_at_6));
+	struct Foo * __b_rename_at_9; memset(&__b_rename_at_9,0,sizeof(__b_rename_at_9));
+/* finally */ auto __finally_6= das_finally([&](){
+	finalize_b366c5ca57c24d6a(__context__,__a_rename_at_6);
+	finalize_b366c5ca57c24d6a(__context__,__b_rename_at_9);
+/* end finally */ });
+	__a_rename_at_6 = das_new<struct Foo>::make(__context__);
+	if ( __skip_rename_at_5 )
+	{
+		return ;
+	} else {
+		__b_rename_at_9 = das_new<struct Foo>::make(__context__);
+	};
+}
+
+inline void finalize_b366c5ca57c24d6a ( Context * __context__, struct Foo * & ____this_rename_at_12 )
+{
+	if ( ____this_rename_at_12 != nullptr )
+	{
+		finalize_aef1da7f017792ad(__context__,das_arg<struct Foo>::pass(das_deref(__context__,____this_rename_at_12)));
+		das_delete<struct Foo *>::clear(__context__,____this_rename_at_12);
+		das_copy(____this_rename_at_12,nullptr);
+	};
+}
+
+inline void finalize_aef1da7f017792ad ( Context * __context__, struct Foo &  ____this_rename_at_1 )
+{
+	memset(&(____this_rename_at_1), 0, 4);
+}
+
+inline bool test_6ac500428cae641f ( Context * __context__ )
+{
+	buggy_73020f0ac35c066(__context__,true);
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// buggy_73020f0ac35c066
+		aotLib[0x4fa452174a503f84] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, bool  ),&buggy_73020f0ac35c066>>();
+	};
+		// finalize_b366c5ca57c24d6a
+		aotLib[0xb5694d806ca44040] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo * &  ),&finalize_b366c5ca57c24d6a>>();
+	};
+		// finalize_aef1da7f017792ad
+		aotLib[0x3d3bea36176f00e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&finalize_aef1da7f017792ad>>();
+	};
+		// test_6ac500428cae641f
+		aotLib[0xb0a38e62ceb783ce] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6ac500428cae641f>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,127 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__359c1b32;
+
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__359c1b32 };
+
+inline bool _Funcbuiltin_0x60_erase_ea0fa82112615e17 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_180, char * const  __at_rename_at_180 );
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_292 );
+inline bool _Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_183, char * const  __at_rename_at_183 );
+inline bool test_d11b55eb249b856 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Funcbuiltin_0x60_erase_ea0fa82112615e17 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_180, char * const  __at_rename_at_180 )
+{
+	return __builtin_table_erase(__context__,__Tab_rename_at_180,__at_rename_at_180);
+}
+
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_292),8,4,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_183, char * const  __at_rename_at_183 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_183,__at_rename_at_183);
+}
+
+inline bool test_d11b55eb249b856 ( Context * __context__ )
+{
+	TTable<char *,int32_t> __tab_rename_at_5; das_zero(__tab_rename_at_5);
+	{
+		bool __need_loop_6 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_6;
+		__need_loop_6 = __i_iterator.first(__context__,(__i_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __i_iterator.next(__context__,(__i_rename_at_6)) )
+		{
+			das_copy(__tab_rename_at_5((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "key")),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(__i_rename_at_6)))),*__context__))),__context__),__i_rename_at_6);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_6));
+	};
+	DAS_ASSERT((__tab_rename_at_5(((char *) "key7"),__context__) == 7));
+	DAS_ASSERT((__tab_rename_at_5(((char *) "key99"),__context__) == 99));
+	char * __s_rename_at_10 = (char *)(((char *) "ke"));
+	SimPolicy<char *>::SetAdd((char *)&(__s_rename_at_10),cast<char *>::from(((char *) "y42")),*__context__);
+	DAS_ASSERT((_Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_5),__s_rename_at_10)));
+	DAS_ASSERT((__tab_rename_at_5(__s_rename_at_10,__context__) == 42));
+	_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_5),__s_rename_at_10);
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_5),((char *) "key42"))));
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_5)) == 99));
+	_Funcbuiltin_0x60_finalize_bb3702af962b623e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_5));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_erase_ea0fa82112615e17
+		aotLib[0x76b7d93e69aa6db5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> & , char * const   ),&_Funcbuiltin_0x60_erase_ea0fa82112615e17>>();
+	};
+		// _Funcbuiltin_0x60_finalize_bb3702af962b623e
+		aotLib[0x47ccc641525eada1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Funcbuiltin_0x60_finalize_bb3702af962b623e>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d
+		aotLib[0xd387297f5cd4e119] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_1aca2c4b4e438a0d>>();
+	};
+		// test_d11b55eb249b856
+		aotLib[0xa69fe1f3baa900bc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d11b55eb249b856>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
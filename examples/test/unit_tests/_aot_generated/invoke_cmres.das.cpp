@@ -0,0 +1,671 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__7d52d31c;
+extern StructInfo __struct_info__55e20ba5;
+extern StructInfo __struct_info__b1589007;
+extern StructInfo __struct_info__8da2153f;
+extern StructInfo __struct_info__403441c3;
+extern TypeInfo __type_info__e9ef3b37;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__758b1d3f;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__d99ff914;
+extern TypeInfo __type_info__74e72cdd;
+extern TypeInfo __type_info__b25b6db3;
+extern TypeInfo __type_info__2011fb8c;
+extern TypeInfo __type_info__c7e1677;
+extern TypeInfo __type_info__b398f3db;
+extern TypeInfo __type_info__536d22af;
+extern TypeInfo __type_info__27b4d955;
+extern VarInfo __var_info__f7c882f4;
+extern VarInfo __var_info__d8dd0985;
+extern VarInfo __var_info__38b75adb;
+extern VarInfo __var_info__cb011ec0;
+extern VarInfo __var_info__d5dd04cc;
+extern VarInfo __var_info__cca12f29;
+extern VarInfo __var_info__702282de;
+extern VarInfo __var_info__56d8f0c5;
+extern VarInfo __var_info__7d57828d;
+extern VarInfo __var_info__904af58c;
+extern VarInfo __var_info__652d1be6;
+extern FuncInfo __func_info__4624f996;
+extern FuncInfo __func_info__96c0e1d1;
+extern FuncInfo __func_info__c0439b6f;
+extern FuncInfo __func_info__e796f308;
+
+TypeInfo * __type_info__7d57828d_arg_types_var_2102579996[2] = { &__type_info__2011fb8c, &__type_info__359c1b32 };
+VarInfo __struct_info__7d52d31c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c7e1677, nullptr, (TypeInfo **)__type_info__7d57828d_arg_types_var_2102579996, nullptr, 2, 0, nullptr, 28, 0x7d57828d, "__lambda", 0 };
+TypeInfo * __type_info__f7c882f4_arg_types_var_2102579996[1] = { &__type_info__d99ff914 };
+VarInfo __struct_info__7d52d31c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f7c882f4_arg_types_var_2102579996, nullptr, 1, 0, nullptr, 28, 0xf7c882f4, "__finalize", 4 };
+VarInfo * __struct_info__7d52d31c_fields[2] =  { &__struct_info__7d52d31c_field_0, &__struct_info__7d52d31c_field_1 };
+StructInfo __struct_info__7d52d31c = {"_lambda_thismodule_82_8_3", __struct_info__7d52d31c_fields, 2, 8, -1, nullptr, 0x7d52d31c };
+TypeInfo * __type_info__702282de_arg_types_var_1440877477[1] = { &__type_info__27b4d955 };
+VarInfo __struct_info__55e20ba5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__758b1d3f, nullptr, (TypeInfo **)__type_info__702282de_arg_types_var_1440877477, nullptr, 1, 0, nullptr, 28, 0x702282de, "__lambda", 0 };
+TypeInfo * __type_info__38b75adb_arg_types_var_1440877477[1] = { &__type_info__74e72cdd };
+VarInfo __struct_info__55e20ba5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__38b75adb_arg_types_var_1440877477, nullptr, 1, 0, nullptr, 28, 0x38b75adb, "__finalize", 4 };
+VarInfo * __struct_info__55e20ba5_fields[2] =  { &__struct_info__55e20ba5_field_0, &__struct_info__55e20ba5_field_1 };
+StructInfo __struct_info__55e20ba5 = {"_lambda_thismodule_80_8_2", __struct_info__55e20ba5_fields, 2, 8, -1, nullptr, 0x55e20ba5 };
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd5dd04cc, "a", 0 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xd8dd0985, "b", 4 };
+VarInfo * __struct_info__b1589007_fields[2] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 2, 8, -1, nullptr, 0xb1589007 };
+TypeInfo * __type_info__904af58c_arg_types_var_2376209727[2] = { &__type_info__536d22af, &__type_info__359c1b32 };
+VarInfo __struct_info__8da2153f_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__758b1d3f, nullptr, (TypeInfo **)__type_info__904af58c_arg_types_var_2376209727, nullptr, 2, 0, nullptr, 28, 0x904af58c, "__lambda", 0 };
+TypeInfo * __type_info__cca12f29_arg_types_var_2376209727[1] = { &__type_info__e9ef3b37 };
+VarInfo __struct_info__8da2153f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cca12f29_arg_types_var_2376209727, nullptr, 1, 0, nullptr, 28, 0xcca12f29, "__finalize", 4 };
+VarInfo * __struct_info__8da2153f_fields[2] =  { &__struct_info__8da2153f_field_0, &__struct_info__8da2153f_field_1 };
+StructInfo __struct_info__8da2153f = {"_lambda_thismodule_84_8_4", __struct_info__8da2153f_fields, 2, 8, -1, nullptr, 0x8da2153f };
+TypeInfo * __type_info__cb011ec0_arg_types_var_1077166531[1] = { &__type_info__b25b6db3 };
+VarInfo __struct_info__403441c3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c7e1677, nullptr, (TypeInfo **)__type_info__cb011ec0_arg_types_var_1077166531, nullptr, 1, 0, nullptr, 28, 0xcb011ec0, "__lambda", 0 };
+TypeInfo * __type_info__56d8f0c5_arg_types_var_1077166531[1] = { &__type_info__b398f3db };
+VarInfo __struct_info__403441c3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__56d8f0c5_arg_types_var_1077166531, nullptr, 1, 0, nullptr, 28, 0x56d8f0c5, "__finalize", 4 };
+VarInfo * __struct_info__403441c3_fields[2] =  { &__struct_info__403441c3_field_0, &__struct_info__403441c3_field_1 };
+StructInfo __struct_info__403441c3 = {"_lambda_thismodule_78_8_1", __struct_info__403441c3_fields, 2, 8, -1, nullptr, 0x403441c3 };
+VarInfo __func_info__4624f996_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x652d1be6, "t", 0 };
+VarInfo * __func_info__4624f996_fields[1] =  { &__func_info__4624f996_field_0 };
+FuncInfo __func_info__4624f996 = {"invoke block<(t:int const):Foo const> const", "", __func_info__4624f996_fields, 1, 32, &__type_info__758b1d3f, nullptr,0,0x4624f996, 0x0 };
+FuncInfo __func_info__96c0e1d1 = {"invoke block<Foo> const", "", nullptr, 0, 32, &__type_info__c7e1677, nullptr,0,0x96c0e1d1, 0x0 };
+VarInfo __func_info__c0439b6f_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x652d1be6, "t", 0 };
+VarInfo * __func_info__c0439b6f_fields[1] =  { &__func_info__c0439b6f_field_0 };
+FuncInfo __func_info__c0439b6f = {"invoke block<(t:int const):Foo> const", "", __func_info__c0439b6f_fields, 1, 32, &__type_info__c7e1677, nullptr,0,0xc0439b6f, 0x0 };
+FuncInfo __func_info__e796f308 = {"invoke block<Foo const> const", "", nullptr, 0, 32, &__type_info__758b1d3f, nullptr,0,0xe796f308, 0x0 };
+TypeInfo __type_info__e9ef3b37 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__536d22af, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe9ef3b37 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__758b1d3f = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x758b1d3f };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__d99ff914 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2011fb8c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd99ff914 };
+TypeInfo __type_info__74e72cdd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__27b4d955, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x74e72cdd };
+TypeInfo __type_info__b25b6db3 = { Type::tStructure, &__struct_info__403441c3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xb25b6db3 };
+TypeInfo __type_info__2011fb8c = { Type::tStructure, &__struct_info__7d52d31c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x2011fb8c };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2078, 0xc7e1677 };
+TypeInfo __type_info__b398f3db = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b25b6db3, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb398f3db };
+TypeInfo __type_info__536d22af = { Type::tStructure, &__struct_info__8da2153f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x536d22af };
+TypeInfo __type_info__27b4d955 = { Type::tStructure, &__struct_info__55e20ba5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x27b4d955 };
+
+namespace  {
+
+struct Foo {
+	int32_t a;
+	int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_78_8_1 {
+	Func DAS_COMMENT((struct Foo,struct _lambda_thismodule_78_8_1)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_78_8_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_78_8_1)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_78_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_78_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_80_8_2 {
+	Func DAS_COMMENT((struct Foo const ,struct _lambda_thismodule_80_8_2)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_80_8_2 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_80_8_2)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_8_2,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_82_8_3 {
+	Func DAS_COMMENT((struct Foo,struct _lambda_thismodule_82_8_3,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_82_8_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_82_8_3)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_82_8_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_82_8_3,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_84_8_4 {
+	Func DAS_COMMENT((struct Foo const ,struct _lambda_thismodule_84_8_4,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_84_8_4 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_84_8_4)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_84_8_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_84_8_4,__finalize)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_78_8_1_0x60_finazlier_3e4285f99025170 ( Context * __context__, struct _lambda_thismodule_78_8_1 * ____this_rename_at_78 );
+inline struct Foo _Func_lambda_thismodule_78_8_1_0x60_function_18f7a213ab2e8f06 ( Context * __context__, struct _lambda_thismodule_78_8_1 & ____this_rename_at_78 );
+inline void _Func_lambda_thismodule_80_8_2_0x60_finazlier_b82c8f6a354ab680 ( Context * __context__, struct _lambda_thismodule_80_8_2 * ____this_rename_at_80 );
+inline struct Foo const  _Func_lambda_thismodule_80_8_2_0x60_function_aef499b16217d645 ( Context * __context__, struct _lambda_thismodule_80_8_2 & ____this_rename_at_80 );
+inline void _Func_lambda_thismodule_82_8_3_0x60_finazlier_3b4986108558923a ( Context * __context__, struct _lambda_thismodule_82_8_3 * ____this_rename_at_82 );
+inline struct Foo _Func_lambda_thismodule_82_8_3_0x60_function_7e4a2312318840ba ( Context * __context__, struct _lambda_thismodule_82_8_3 & ____this_rename_at_82, int32_t __t_rename_at_81 );
+inline void _Func_lambda_thismodule_84_8_4_0x60_finazlier_ce4888caccf0e478 ( Context * __context__, struct _lambda_thismodule_84_8_4 * ____this_rename_at_84 );
+inline struct Foo const  _Func_lambda_thismodule_84_8_4_0x60_function_99726bca72b6268 ( Context * __context__, struct _lambda_thismodule_84_8_4 & ____this_rename_at_84, int32_t __t_rename_at_83 );
+inline void _Func_0x60_checkInvoke_f8f87b20dcfbc88e ( Context * __context__, Block DAS_COMMENT((struct Foo const )) const  & __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_f1f52e79f6fda497 ( Context * __context__, Block DAS_COMMENT((struct Foo)) const  & __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_fb3df37f95639867 ( Context * __context__, Func DAS_COMMENT((struct Foo const )) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_1cf882b4f615d12 ( Context * __context__, Func DAS_COMMENT((struct Foo)) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_7b64c7ddd359fdeb ( Context * __context__, Lambda DAS_COMMENT((struct Foo const )) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_e5ca76e7d7b4f06 ( Context * __context__, Lambda DAS_COMMENT((struct Foo)) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_b57edb873cd588b2 ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((struct Foo const ,int32_t)) const  & __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_8cfe6035c138c997 ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((struct Foo,int32_t)) const  & __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_18a5ba1608800097 ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((struct Foo const ,int32_t)) const  __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_897c932a46b24fe ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((struct Foo,int32_t)) const  __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_ba2db328cb670f67 ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((struct Foo const ,int32_t)) const  __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_62eeecb2502c8236 ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((struct Foo,int32_t)) const  __obj_rename_at_47 );
+inline void check_edd6263ffae06fa7 ( Context * __context__, struct Foo const  & __t_rename_at_39 );
+inline void finalize_d13e444a2661b86d ( Context * __context__, struct _lambda_thismodule_78_8_1 & ____this_rename_at_78 );
+inline void finalize_e16d52ca7b70d2df ( Context * __context__, struct _lambda_thismodule_80_8_2 & ____this_rename_at_80 );
+inline void finalize_eefdf1ac29dc53d0 ( Context * __context__, struct _lambda_thismodule_82_8_3 & ____this_rename_at_82 );
+inline void finalize_88be309234f2ea95 ( Context * __context__, struct _lambda_thismodule_84_8_4 & ____this_rename_at_84 );
+inline struct Foo func_e72ab230572f02a8 ( Context * __context__ );
+inline struct Foo funcA_f6f09ee4225b5b19 ( Context * __context__, int32_t __t_rename_at_16 );
+inline struct Foo const  funcAC_13d351185d7470ba ( Context * __context__, int32_t __t_rename_at_19 );
+inline struct Foo const  funcC_5607b615ea1656db ( Context * __context__ );
+inline struct Foo hfunc_e72ab230572f02a8 ( Context * __context__ );
+inline struct Foo hfuncA_f6f09ee4225b5b19 ( Context * __context__, int32_t __t_rename_at_31 );
+inline struct Foo const  hfuncAC_13d351185d7470ba ( Context * __context__, int32_t __t_rename_at_35 );
+inline struct Foo const  hfuncC_5607b615ea1656db ( Context * __context__ );
+inline bool test_897415b3d7ee32ab ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_78_8_1_0x60_finazlier_3e4285f99025170 ( Context * __context__, struct _lambda_thismodule_78_8_1 * ____this_rename_at_78 )
+{
+	finalize_d13e444a2661b86d(__context__,das_arg<struct _lambda_thismodule_78_8_1>::pass(das_deref(__context__,____this_rename_at_78)));
+	das_delete_lambda_struct<struct _lambda_thismodule_78_8_1 *>::clear(__context__,____this_rename_at_78);
+}
+
+inline struct Foo _Func_lambda_thismodule_78_8_1_0x60_function_18f7a213ab2e8f06 ( Context * __context__, struct _lambda_thismodule_78_8_1 &  ____this_rename_at_78 )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_78;
+		das_copy((__mks_78.a),(1));
+		das_copy((__mks_78.b),(2));
+		return __mks_78;
+	})());
+}
+
+inline void _Func_lambda_thismodule_80_8_2_0x60_finazlier_b82c8f6a354ab680 ( Context * __context__, struct _lambda_thismodule_80_8_2 * ____this_rename_at_80 )
+{
+	finalize_e16d52ca7b70d2df(__context__,das_arg<struct _lambda_thismodule_80_8_2>::pass(das_deref(__context__,____this_rename_at_80)));
+	das_delete_lambda_struct<struct _lambda_thismodule_80_8_2 *>::clear(__context__,____this_rename_at_80);
+}
+
+inline struct Foo const  _Func_lambda_thismodule_80_8_2_0x60_function_aef499b16217d645 ( Context * __context__, struct _lambda_thismodule_80_8_2 &  ____this_rename_at_80 )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_80;
+		das_copy((__mks_80.a),(1));
+		das_copy((__mks_80.b),(2));
+		return __mks_80;
+	})());
+}
+
+inline void _Func_lambda_thismodule_82_8_3_0x60_finazlier_3b4986108558923a ( Context * __context__, struct _lambda_thismodule_82_8_3 * ____this_rename_at_82 )
+{
+	finalize_eefdf1ac29dc53d0(__context__,das_arg<struct _lambda_thismodule_82_8_3>::pass(das_deref(__context__,____this_rename_at_82)));
+	das_delete_lambda_struct<struct _lambda_thismodule_82_8_3 *>::clear(__context__,____this_rename_at_82);
+}
+
+inline struct Foo _Func_lambda_thismodule_82_8_3_0x60_function_7e4a2312318840ba ( Context * __context__, struct _lambda_thismodule_82_8_3 &  ____this_rename_at_82, int32_t __t_rename_at_81 )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_82;
+		das_copy((__mks_82.a),(__t_rename_at_81));
+		das_copy((__mks_82.b),((__t_rename_at_81 + 1)));
+		return __mks_82;
+	})());
+}
+
+inline void _Func_lambda_thismodule_84_8_4_0x60_finazlier_ce4888caccf0e478 ( Context * __context__, struct _lambda_thismodule_84_8_4 * ____this_rename_at_84 )
+{
+	finalize_88be309234f2ea95(__context__,das_arg<struct _lambda_thismodule_84_8_4>::pass(das_deref(__context__,____this_rename_at_84)));
+	das_delete_lambda_struct<struct _lambda_thismodule_84_8_4 *>::clear(__context__,____this_rename_at_84);
+}
+
+inline struct Foo const  _Func_lambda_thismodule_84_8_4_0x60_function_99726bca72b6268 ( Context * __context__, struct _lambda_thismodule_84_8_4 &  ____this_rename_at_84, int32_t __t_rename_at_83 )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_84;
+		das_copy((__mks_84.a),(__t_rename_at_83));
+		das_copy((__mks_84.b),((__t_rename_at_83 + 1)));
+		return __mks_84;
+	})());
+}
+
+inline void _Func_0x60_checkInvoke_f8f87b20dcfbc88e ( Context * __context__, Block DAS_COMMENT((struct Foo const )) const  &  __obj_rename_at_43 )
+{
+	check_edd6263ffae06fa7(__context__,das_invoke<struct Foo const >::invoke_cmres(__context__,__obj_rename_at_43));
+}
+
+inline void _Func_0x60_checkInvoke_f1f52e79f6fda497 ( Context * __context__, Block DAS_COMMENT((struct Foo)) const  &  __obj_rename_at_43 )
+{
+	check_edd6263ffae06fa7(__context__,das_arg<struct Foo>::pass(das_invoke<struct Foo>::invoke_cmres(__context__,__obj_rename_at_43)));
+}
+
+inline void _Func_0x60_checkInvoke_fb3df37f95639867 ( Context * __context__, Func DAS_COMMENT((struct Foo const )) const  __obj_rename_at_43 )
+{
+	check_edd6263ffae06fa7(__context__,das_invoke_function<struct Foo const >::invoke_cmres(__context__,__obj_rename_at_43));
+}
+
+inline void _Func_0x60_checkInvoke_1cf882b4f615d12 ( Context * __context__, Func DAS_COMMENT((struct Foo)) const  __obj_rename_at_43 )
+{
+	check_edd6263ffae06fa7(__context__,das_arg<struct Foo>::pass(das_invoke_function<struct Foo>::invoke_cmres(__context__,__obj_rename_at_43)));
+}
+
+inline void _Func_0x60_checkInvoke_7b64c7ddd359fdeb ( Context * __context__, Lambda DAS_COMMENT((struct Foo const )) const  __obj_rename_at_43 )
+{
+	check_edd6263ffae06fa7(__context__,das_invoke_lambda<struct Foo const >::invoke_cmres(__context__,__obj_rename_at_43));
+}
+
+inline void _Func_0x60_checkInvoke_e5ca76e7d7b4f06 ( Context * __context__, Lambda DAS_COMMENT((struct Foo)) const  __obj_rename_at_43 )
+{
+	check_edd6263ffae06fa7(__context__,das_arg<struct Foo>::pass(das_invoke_lambda<struct Foo>::invoke_cmres(__context__,__obj_rename_at_43)));
+}
+
+inline void _Func_0x60_checkInvoke_b57edb873cd588b2 ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((struct Foo const ,int32_t)) const  &  __obj_rename_at_47 )
+{
+	check_edd6263ffae06fa7(__context__,das_invoke<struct Foo const >::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47));
+}
+
+inline void _Func_0x60_checkInvoke_8cfe6035c138c997 ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((struct Foo,int32_t)) const  &  __obj_rename_at_47 )
+{
+	check_edd6263ffae06fa7(__context__,das_arg<struct Foo>::pass(das_invoke<struct Foo>::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47)));
+}
+
+inline void _Func_0x60_checkInvoke_18a5ba1608800097 ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((struct Foo const ,int32_t)) const  __obj_rename_at_47 )
+{
+	check_edd6263ffae06fa7(__context__,das_invoke_function<struct Foo const >::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47));
+}
+
+inline void _Func_0x60_checkInvoke_897c932a46b24fe ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((struct Foo,int32_t)) const  __obj_rename_at_47 )
+{
+	check_edd6263ffae06fa7(__context__,das_arg<struct Foo>::pass(das_invoke_function<struct Foo>::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47)));
+}
+
+inline void _Func_0x60_checkInvoke_ba2db328cb670f67 ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((struct Foo const ,int32_t)) const  __obj_rename_at_47 )
+{
+	check_edd6263ffae06fa7(__context__,das_invoke_lambda<struct Foo const >::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47));
+}
+
+inline void _Func_0x60_checkInvoke_62eeecb2502c8236 ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((struct Foo,int32_t)) const  __obj_rename_at_47 )
+{
+	check_edd6263ffae06fa7(__context__,das_arg<struct Foo>::pass(das_invoke_lambda<struct Foo>::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47)));
+}
+
+inline void check_edd6263ffae06fa7 ( Context * __context__, struct Foo const  &  __t_rename_at_39 )
+{
+	DAS_ASSERT(((__t_rename_at_39.a == 1) && (__t_rename_at_39.b == 2)));
+}
+
+inline void finalize_d13e444a2661b86d ( Context * __context__, struct _lambda_thismodule_78_8_1 &  ____this_rename_at_78 )
+{
+	memset(&(____this_rename_at_78), 0, 8);
+}
+
+inline void finalize_e16d52ca7b70d2df ( Context * __context__, struct _lambda_thismodule_80_8_2 &  ____this_rename_at_80 )
+{
+	memset(&(____this_rename_at_80), 0, 8);
+}
+
+inline void finalize_eefdf1ac29dc53d0 ( Context * __context__, struct _lambda_thismodule_82_8_3 &  ____this_rename_at_82 )
+{
+	memset(&(____this_rename_at_82), 0, 8);
+}
+
+inline void finalize_88be309234f2ea95 ( Context * __context__, struct _lambda_thismodule_84_8_4 &  ____this_rename_at_84 )
+{
+	memset(&(____this_rename_at_84), 0, 8);
+}
+
+inline struct Foo func_e72ab230572f02a8 ( Context * __context__ )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_11;
+		das_copy((__mks_11.a),(1));
+		das_copy((__mks_11.b),(2));
+		return __mks_11;
+	})());
+}
+
+inline struct Foo funcA_f6f09ee4225b5b19 ( Context * __context__, int32_t __t_rename_at_16 )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_17;
+		das_copy((__mks_17.a),(__t_rename_at_16));
+		das_copy((__mks_17.b),((__t_rename_at_16 + 1)));
+		return __mks_17;
+	})());
+}
+
+inline struct Foo const  funcAC_13d351185d7470ba ( Context * __context__, int32_t __t_rename_at_19 )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_20;
+		das_copy((__mks_20.a),(__t_rename_at_19));
+		das_copy((__mks_20.b),((__t_rename_at_19 + 1)));
+		return __mks_20;
+	})());
+}
+
+inline struct Foo const  funcC_5607b615ea1656db ( Context * __context__ )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_14;
+		das_copy((__mks_14.a),(1));
+		das_copy((__mks_14.b),(2));
+		return __mks_14;
+	})());
+}
+
+inline struct Foo hfunc_e72ab230572f02a8 ( Context * __context__ )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_24;
+		das_copy((__mks_24.a),(1));
+		das_copy((__mks_24.b),(2));
+		return __mks_24;
+	})());
+}
+
+inline struct Foo hfuncA_f6f09ee4225b5b19 ( Context * __context__, int32_t __t_rename_at_31 )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_32;
+		das_copy((__mks_32.a),(__t_rename_at_31));
+		das_copy((__mks_32.b),((__t_rename_at_31 + 1)));
+		return __mks_32;
+	})());
+}
+
+inline struct Foo const  hfuncAC_13d351185d7470ba ( Context * __context__, int32_t __t_rename_at_35 )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_36;
+		das_copy((__mks_36.a),(__t_rename_at_35));
+		das_copy((__mks_36.b),((__t_rename_at_35 + 1)));
+		return __mks_36;
+	})());
+}
+
+inline struct Foo const  hfuncC_5607b615ea1656db ( Context * __context__ )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_28;
+		das_copy((__mks_28.a),(1));
+		das_copy((__mks_28.b),(2));
+		return __mks_28;
+	})());
+}
+
+inline bool test_897415b3d7ee32ab ( Context * __context__ ) { das_stack_prologue __prologue(__context__,544,"test " DAS_FILE_LINE);
+{
+	struct Foo _temp_make_local_53_32;
+	struct Foo _temp_make_local_54_48;
+	struct Foo _temp_make_local_55_64;
+	struct Foo _temp_make_local_56_80;
+	struct Foo _temp_make_local_58_96;
+	struct Foo _temp_make_local_59_112;
+	struct Foo _temp_make_local_60_128;
+	struct Foo _temp_make_local_61_144;
+	check_edd6263ffae06fa7(__context__,das_arg<struct Foo>::pass((_temp_make_local_53_32 = (func_e72ab230572f02a8(__context__)))));
+	check_edd6263ffae06fa7(__context__,das_arg<struct Foo>::pass((_temp_make_local_54_48 = (funcA_f6f09ee4225b5b19(__context__,1)))));
+	check_edd6263ffae06fa7(__context__,(_temp_make_local_55_64 = (funcC_5607b615ea1656db(__context__))));
+	check_edd6263ffae06fa7(__context__,(_temp_make_local_56_80 = (funcAC_13d351185d7470ba(__context__,1))));
+	check_edd6263ffae06fa7(__context__,das_arg<struct Foo>::pass((_temp_make_local_58_96 = (das_invoke_function<struct Foo>::invoke_cmres(__context__,Func(__context__->fnIdxByMangledName(/*hfunc*/ 4059086725u)))))));
+	check_edd6263ffae06fa7(__context__,das_arg<struct Foo>::pass((_temp_make_local_59_112 = (das_invoke_function<struct Foo>::invoke_cmres<int32_t>(__context__,Func(__context__->fnIdxByMangledName(/*hfuncA int#const*/ 1446350033u)),1)))));
+	check_edd6263ffae06fa7(__context__,(_temp_make_local_60_128 = (das_invoke_function<struct Foo const >::invoke_cmres(__context__,Func(__context__->fnIdxByMangledName(/*hfuncC*/ 2751325362u))))));
+	check_edd6263ffae06fa7(__context__,(_temp_make_local_61_144 = (das_invoke_function<struct Foo const >::invoke_cmres<int32_t>(__context__,Func(__context__->fnIdxByMangledName(/*hfuncAC int#const*/ 1568118112u)),1))));
+	_Func_0x60_checkInvoke_1cf882b4f615d12(__context__,Func(__context__->fnIdxByMangledName(/*func*/ 243156999u)));
+	_Func_0x60_checkInvoke_897c932a46b24fe(__context__,1,Func(__context__->fnIdxByMangledName(/*funcA int#const*/ 370502463u)));
+	_Func_0x60_checkInvoke_fb3df37f95639867(__context__,Func(__context__->fnIdxByMangledName(/*funcC*/ 348898060u)));
+	_Func_0x60_checkInvoke_18a5ba1608800097(__context__,1,Func(__context__->fnIdxByMangledName(/*funcAC int#const*/ 600890662u)));
+	_Func_0x60_checkInvoke_f1f52e79f6fda497(__context__,das_make_block_cmres<struct Foo>(__context__,208,0,&__func_info__96c0e1d1,[&]()->struct Foo{
+		return (([&]() -> struct Foo {
+			struct Foo __mks_69;
+			das_copy((__mks_69.a),(1));
+			das_copy((__mks_69.b),(2));
+			return __mks_69;
+		})());
+	}));
+	_Func_0x60_checkInvoke_f8f87b20dcfbc88e(__context__,das_make_block_cmres<struct Foo const >(__context__,288,0,&__func_info__e796f308,[&]()->struct Foo const {
+		return (([&]() -> struct Foo {
+			struct Foo __mks_71;
+			das_copy((__mks_71.a),(1));
+			das_copy((__mks_71.b),(2));
+			return __mks_71;
+		})());
+	}));
+	_Func_0x60_checkInvoke_8cfe6035c138c997(__context__,1,das_make_block_cmres<struct Foo,int32_t>(__context__,368,0,&__func_info__c0439b6f,[&](int32_t const  __t_rename_at_72)->struct Foo{
+		return (([&]() -> struct Foo {
+			struct Foo __mks_73;
+			das_copy((__mks_73.a),(__t_rename_at_72));
+			das_copy((__mks_73.b),((__t_rename_at_72 + 1)));
+			return __mks_73;
+		})());
+	}));
+	_Func_0x60_checkInvoke_b57edb873cd588b2(__context__,1,das_make_block_cmres<struct Foo const ,int32_t>(__context__,448,0,&__func_info__4624f996,[&](int32_t const  __t_rename_at_74)->struct Foo const {
+		return (([&]() -> struct Foo {
+			struct Foo __mks_75;
+			das_copy((__mks_75.a),(__t_rename_at_74));
+			das_copy((__mks_75.b),((__t_rename_at_74 + 1)));
+			return __mks_75;
+		})());
+	}));
+	_Func_0x60_checkInvoke_e5ca76e7d7b4f06(__context__,das_ascend<struct Foo,struct _lambda_thismodule_78_8_1>::make(__context__,&__type_info__b25b6db3,(([&]() -> struct _lambda_thismodule_78_8_1 {
+		struct _lambda_thismodule_78_8_1 __mks_78;
+		das_copy((__mks_78.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_78_8_1`function _lambda_thismodule_78_8_1*/ 3859681597u))));
+		das_copy((__mks_78.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_78_8_1`finazlier #ptr#_lambda_thismodule_78_8_1#explicit*/ 2372967790u))));
+		return __mks_78;
+	})())));
+	_Func_0x60_checkInvoke_7b64c7ddd359fdeb(__context__,das_ascend<struct Foo,struct _lambda_thismodule_80_8_2>::make(__context__,&__type_info__27b4d955,(([&]() -> struct _lambda_thismodule_80_8_2 {
+		struct _lambda_thismodule_80_8_2 __mks_80;
+		das_copy((__mks_80.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_80_8_2`function _lambda_thismodule_80_8_2*/ 190843613u))));
+		das_copy((__mks_80.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_80_8_2`finazlier #ptr#_lambda_thismodule_80_8_2#explicit*/ 3486689494u))));
+		return __mks_80;
+	})())));
+	_Func_0x60_checkInvoke_62eeecb2502c8236(__context__,1,das_ascend<struct Foo,struct _lambda_thismodule_82_8_3>::make(__context__,&__type_info__2011fb8c,(([&]() -> struct _lambda_thismodule_82_8_3 {
+		struct _lambda_thismodule_82_8_3 __mks_82;
+		das_copy((__mks_82.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_82_8_3`function _lambda_thismodule_82_8_3 int#const*/ 676091382u))));
+		das_copy((__mks_82.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_82_8_3`finazlier #ptr#_lambda_thismodule_82_8_3#explicit*/ 1742828748u))));
+		return __mks_82;
+	})())));
+	_Func_0x60_checkInvoke_ba2db328cb670f67(__context__,1,das_ascend<struct Foo,struct _lambda_thismodule_84_8_4>::make(__context__,&__type_info__536d22af,(([&]() -> struct _lambda_thismodule_84_8_4 {
+		struct _lambda_thismodule_84_8_4 __mks_84;
+		das_copy((__mks_84.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_84_8_4`function _lambda_thismodule_84_8_4 int#const*/ 1026409628u))));
+		das_copy((__mks_84.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_84_8_4`finazlier #ptr#_lambda_thismodule_84_8_4#explicit*/ 1961785458u))));
+		return __mks_84;
+	})())));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_78_8_1_0x60_finazlier_3e4285f99025170
+		aotLib[0xfb5d8384e8f5777c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_78_8_1 *  ),&_Func_lambda_thismodule_78_8_1_0x60_finazlier_3e4285f99025170>>();
+	};
+		// _Func_lambda_thismodule_78_8_1_0x60_function_18f7a213ab2e8f06
+		aotLib[0x5db3c5d4eaea26fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__, struct _lambda_thismodule_78_8_1 &  ),&_Func_lambda_thismodule_78_8_1_0x60_function_18f7a213ab2e8f06>>();
+	};
+		// _Func_lambda_thismodule_80_8_2_0x60_finazlier_b82c8f6a354ab680
+		aotLib[0x8ebe12b593ea485b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_80_8_2 *  ),&_Func_lambda_thismodule_80_8_2_0x60_finazlier_b82c8f6a354ab680>>();
+	};
+		// _Func_lambda_thismodule_80_8_2_0x60_function_aef499b16217d645
+		aotLib[0x4e16b5c1d9581e11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo const  (*) ( Context * __context__, struct _lambda_thismodule_80_8_2 &  ),&_Func_lambda_thismodule_80_8_2_0x60_function_aef499b16217d645>>();
+	};
+		// _Func_lambda_thismodule_82_8_3_0x60_finazlier_3b4986108558923a
+		aotLib[0x8309f9ad481b5783] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_82_8_3 *  ),&_Func_lambda_thismodule_82_8_3_0x60_finazlier_3b4986108558923a>>();
+	};
+		// _Func_lambda_thismodule_82_8_3_0x60_function_7e4a2312318840ba
+		aotLib[0xf65311a0eef2edbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__, struct _lambda_thismodule_82_8_3 & , int32_t  ),&_Func_lambda_thismodule_82_8_3_0x60_function_7e4a2312318840ba>>();
+	};
+		// _Func_lambda_thismodule_84_8_4_0x60_finazlier_ce4888caccf0e478
+		aotLib[0x10a6d77ade65d524] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_84_8_4 *  ),&_Func_lambda_thismodule_84_8_4_0x60_finazlier_ce4888caccf0e478>>();
+	};
+		// _Func_lambda_thismodule_84_8_4_0x60_function_99726bca72b6268
+		aotLib[0xf074362843912d7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo const  (*) ( Context * __context__, struct _lambda_thismodule_84_8_4 & , int32_t  ),&_Func_lambda_thismodule_84_8_4_0x60_function_99726bca72b6268>>();
+	};
+		// _Func_0x60_checkInvoke_f8f87b20dcfbc88e
+		aotLib[0x994215c353b835a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((struct Foo const )) const  &  ),&_Func_0x60_checkInvoke_f8f87b20dcfbc88e>>();
+	};
+		// _Func_0x60_checkInvoke_f1f52e79f6fda497
+		aotLib[0x9babc474fb40ab6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((struct Foo)) const  &  ),&_Func_0x60_checkInvoke_f1f52e79f6fda497>>();
+	};
+		// _Func_0x60_checkInvoke_fb3df37f95639867
+		aotLib[0x5a805bc11ac7f0ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Func DAS_COMMENT((struct Foo const )) const   ),&_Func_0x60_checkInvoke_fb3df37f95639867>>();
+	};
+		// _Func_0x60_checkInvoke_1cf882b4f615d12
+		aotLib[0xe95fb18509e76145] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Func DAS_COMMENT((struct Foo)) const   ),&_Func_0x60_checkInvoke_1cf882b4f615d12>>();
+	};
+		// _Func_0x60_checkInvoke_7b64c7ddd359fdeb
+		aotLib[0x30eca47574569b25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Lambda DAS_COMMENT((struct Foo const )) const   ),&_Func_0x60_checkInvoke_7b64c7ddd359fdeb>>();
+	};
+		// _Func_0x60_checkInvoke_e5ca76e7d7b4f06
+		aotLib[0x5a6b57c97ceb776d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Lambda DAS_COMMENT((struct Foo)) const   ),&_Func_0x60_checkInvoke_e5ca76e7d7b4f06>>();
+	};
+		// _Func_0x60_checkInvoke_b57edb873cd588b2
+		aotLib[0x951ec7d52b39e631] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Block DAS_COMMENT((struct Foo const ,int32_t)) const  &  ),&_Func_0x60_checkInvoke_b57edb873cd588b2>>();
+	};
+		// _Func_0x60_checkInvoke_8cfe6035c138c997
+		aotLib[0xdd10b5e466ae0421] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Block DAS_COMMENT((struct Foo,int32_t)) const  &  ),&_Func_0x60_checkInvoke_8cfe6035c138c997>>();
+	};
+		// _Func_0x60_checkInvoke_18a5ba1608800097
+		aotLib[0x9a8d7b4c03d15789] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Func DAS_COMMENT((struct Foo const ,int32_t)) const   ),&_Func_0x60_checkInvoke_18a5ba1608800097>>();
+	};
+		// _Func_0x60_checkInvoke_897c932a46b24fe
+		aotLib[0x5fcd208f53cbf421] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Func DAS_COMMENT((struct Foo,int32_t)) const   ),&_Func_0x60_checkInvoke_897c932a46b24fe>>();
+	};
+		// _Func_0x60_checkInvoke_ba2db328cb670f67
+		aotLib[0x4fea744e8d6ab3ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Lambda DAS_COMMENT((struct Foo const ,int32_t)) const   ),&_Func_0x60_checkInvoke_ba2db328cb670f67>>();
+	};
+		// _Func_0x60_checkInvoke_62eeecb2502c8236
+		aotLib[0xc71776081995d431] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Lambda DAS_COMMENT((struct Foo,int32_t)) const   ),&_Func_0x60_checkInvoke_62eeecb2502c8236>>();
+	};
+		// check_edd6263ffae06fa7
+		aotLib[0x659d37e5ae96a20d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo const  &  ),&check_edd6263ffae06fa7>>();
+	};
+		// finalize_d13e444a2661b86d
+		aotLib[0x32e866a2c42d4ec5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_78_8_1 &  ),&finalize_d13e444a2661b86d>>();
+	};
+		// finalize_e16d52ca7b70d2df
+		aotLib[0xee190cc3231a8385] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_80_8_2 &  ),&finalize_e16d52ca7b70d2df>>();
+	};
+		// finalize_eefdf1ac29dc53d0
+		aotLib[0x6a28d4b4799fa8e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_82_8_3 &  ),&finalize_eefdf1ac29dc53d0>>();
+	};
+		// finalize_88be309234f2ea95
+		aotLib[0x9e42c0228be6a059] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_84_8_4 &  ),&finalize_88be309234f2ea95>>();
+	};
+		// func_e72ab230572f02a8
+		aotLib[0x20e03585b1dba6fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__ ),&func_e72ab230572f02a8>>();
+	};
+		// funcA_f6f09ee4225b5b19
+		aotLib[0x272afec5142aff59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__, int32_t  ),&funcA_f6f09ee4225b5b19>>();
+	};
+		// funcAC_13d351185d7470ba
+		aotLib[0xbcc21ef0ae5368a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo const  (*) ( Context * __context__, int32_t  ),&funcAC_13d351185d7470ba>>();
+	};
+		// funcC_5607b615ea1656db
+		aotLib[0xf2c240797630cbc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo const  (*) ( Context * __context__ ),&funcC_5607b615ea1656db>>();
+	};
+		// hfunc_e72ab230572f02a8
+		aotLib[0x20e03585b1dba6fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__ ),&hfunc_e72ab230572f02a8>>();
+	};
+		// hfuncA_f6f09ee4225b5b19
+		aotLib[0x272afec5142aff59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__, int32_t  ),&hfuncA_f6f09ee4225b5b19>>();
+	};
+		// hfuncAC_13d351185d7470ba
+		aotLib[0xbcc21ef0ae5368a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo const  (*) ( Context * __context__, int32_t  ),&hfuncAC_13d351185d7470ba>>();
+	};
+		// hfuncC_5607b615ea1656db
+		aotLib[0xf2c240797630cbc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo const  (*) ( Context * __context__ ),&hfuncC_5607b615ea1656db>>();
+	};
+		// test_897415b3d7ee32ab
+		aotLib[0x544e9627c0965cb0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_897415b3d7ee32ab>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
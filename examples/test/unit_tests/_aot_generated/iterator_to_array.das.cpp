@@ -0,0 +1,1133 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__32bfd08c;
+extern StructInfo __struct_info__8ca3f71a;
+extern StructInfo __struct_info__87e9961d;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__6594b8a;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__d65ce012;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__b9a7f155;
+extern TypeInfo __type_info__dfd1cd0d;
+extern TypeInfo __type_info__b6e7187c;
+extern TypeInfo __type_info__f4431144;
+extern VarInfo __var_info__536503f3;
+extern VarInfo __var_info__a334facd;
+extern VarInfo __var_info__c9630806;
+extern VarInfo __var_info__2ef79f1d;
+extern VarInfo __var_info__15084284;
+extern VarInfo __var_info__cd9e9b20;
+extern VarInfo __var_info__4a2723ce;
+extern VarInfo __var_info__5cfebcd3;
+extern VarInfo __var_info__cf12e7ca;
+extern VarInfo __var_info__11c9bda4;
+extern VarInfo __var_info__2d0c7840;
+extern VarInfo __var_info__9a975fe7;
+extern VarInfo __var_info__61fec4b2;
+extern VarInfo __var_info__fa26267c;
+extern VarInfo __var_info__300aac0b;
+
+TypeInfo * __type_info__2ef79f1d_arg_types_var_851431564[2] = { &__type_info__b6e7187c, &__type_info__e6eb6b88 };
+VarInfo __struct_info__32bfd08c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__2ef79f1d_arg_types_var_851431564, nullptr, 2, 0, nullptr, 28, 0x2ef79f1d, "__lambda", 0 };
+TypeInfo * __type_info__11c9bda4_arg_types_var_851431564[1] = { &__type_info__f4431144 };
+VarInfo __struct_info__32bfd08c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__11c9bda4_arg_types_var_851431564, nullptr, 1, 0, nullptr, 28, 0x11c9bda4, "__finalize", 4 };
+VarInfo __struct_info__32bfd08c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x300aac0b, "__yield", 8 };
+VarInfo __struct_info__32bfd08c_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x61fec4b2, "n", 12 };
+VarInfo __struct_info__32bfd08c_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x15084284, "_loop_at_114", 16 };
+VarInfo __struct_info__32bfd08c_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x5cfebcd3, "i", 20 };
+VarInfo __struct_info__32bfd08c_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xfa26267c, "_pvar_0_at_114", 24 };
+VarInfo __struct_info__32bfd08c_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x2d0c7840, "_source_0_at_114", 32 };
+VarInfo * __struct_info__32bfd08c_fields[8] =  { &__struct_info__32bfd08c_field_0, &__struct_info__32bfd08c_field_1, &__struct_info__32bfd08c_field_2, &__struct_info__32bfd08c_field_3, &__struct_info__32bfd08c_field_4, &__struct_info__32bfd08c_field_5, &__struct_info__32bfd08c_field_6, &__struct_info__32bfd08c_field_7 };
+StructInfo __struct_info__32bfd08c = {"_lambda_thismodule_114_8_1", __struct_info__32bfd08c_fields, 8, 40, -1, nullptr, 0x32bfd08c };
+TypeInfo * __type_info__9a975fe7_arg_types_var_2359555866[2] = { &__type_info__6594b8a, &__type_info__e6eb6b88 };
+VarInfo __struct_info__8ca3f71a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__9a975fe7_arg_types_var_2359555866, nullptr, 2, 0, nullptr, 28, 0x9a975fe7, "__lambda", 0 };
+TypeInfo * __type_info__4a2723ce_arg_types_var_2359555866[1] = { &__type_info__d65ce012 };
+VarInfo __struct_info__8ca3f71a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4a2723ce_arg_types_var_2359555866, nullptr, 1, 0, nullptr, 28, 0x4a2723ce, "__finalize", 4 };
+VarInfo __struct_info__8ca3f71a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa334facd, "count", 8 };
+VarInfo __struct_info__8ca3f71a_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xcd9e9b20, "n", 12 };
+VarInfo * __struct_info__8ca3f71a_fields[4] =  { &__struct_info__8ca3f71a_field_0, &__struct_info__8ca3f71a_field_1, &__struct_info__8ca3f71a_field_2, &__struct_info__8ca3f71a_field_3 };
+StructInfo __struct_info__8ca3f71a = {"_lambda_thismodule_102_8_2", __struct_info__8ca3f71a_fields, 4, 16, -1, nullptr, 0x8ca3f71a };
+TypeInfo * __type_info__c9630806_arg_types_var_2280232477[2] = { &__type_info__dfd1cd0d, &__type_info__e6eb6b88 };
+VarInfo __struct_info__87e9961d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__c9630806_arg_types_var_2280232477, nullptr, 2, 0, nullptr, 28, 0xc9630806, "__lambda", 0 };
+TypeInfo * __type_info__536503f3_arg_types_var_2280232477[1] = { &__type_info__b9a7f155 };
+VarInfo __struct_info__87e9961d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__536503f3_arg_types_var_2280232477, nullptr, 1, 0, nullptr, 28, 0x536503f3, "__finalize", 4 };
+VarInfo __struct_info__87e9961d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xcf12e7ca, "count", 8 };
+VarInfo * __struct_info__87e9961d_fields[3] =  { &__struct_info__87e9961d_field_0, &__struct_info__87e9961d_field_1, &__struct_info__87e9961d_field_2 };
+StructInfo __struct_info__87e9961d = {"_lambda_thismodule_137_8_3", __struct_info__87e9961d_fields, 3, 12, -1, nullptr, 0x87e9961d };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x13667ab1 };
+TypeInfo __type_info__6594b8a = { Type::tStructure, &__struct_info__8ca3f71a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x6594b8a };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0xe6eb6b88 };
+TypeInfo __type_info__d65ce012 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6594b8a, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd65ce012 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__b9a7f155 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dfd1cd0d, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb9a7f155 };
+TypeInfo __type_info__dfd1cd0d = { Type::tStructure, &__struct_info__87e9961d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xdfd1cd0d };
+TypeInfo __type_info__b6e7187c = { Type::tStructure, &__struct_info__32bfd08c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xb6e7187c };
+TypeInfo __type_info__f4431144 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b6e7187c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf4431144 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__95e97e5e };
+namespace  {
+
+struct Foo {
+	int32_t a;
+	float b;
+	int32_t c;
+};
+static_assert(sizeof(Foo)==12,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,c)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_114_8_1 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_114_8_1,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_114_8_1 *)) __finalize;
+	int32_t __yield;
+	int32_t n;
+	bool _loop_at_114;
+	int32_t i;
+	void * _pvar_0_at_114;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_114;
+};
+static_assert(sizeof(_lambda_thismodule_114_8_1)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_8_1,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_8_1,n)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_8_1,_loop_at_114)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_8_1,i)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_8_1,_pvar_0_at_114)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_8_1,_source_0_at_114)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_102_8_2 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_102_8_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_102_8_2 *)) __finalize;
+	int32_t count;
+	int32_t n;
+};
+static_assert(sizeof(_lambda_thismodule_102_8_2)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_102_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_102_8_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_102_8_2,count)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_102_8_2,n)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_137_8_3 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_137_8_3,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_137_8_3 *)) __finalize;
+	int32_t count;
+};
+static_assert(sizeof(_lambda_thismodule_137_8_3)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_137_8_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_137_8_3,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_137_8_3,count)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_102_8_2_0x60_finazlier_97a96eabc1674a56 ( Context * __context__, struct _lambda_thismodule_102_8_2 * ____this_rename_at_102 );
+inline bool _Func_lambda_thismodule_102_8_2_0x60_function_38e006f78f44c4e6 ( Context * __context__, struct _lambda_thismodule_102_8_2 & ____this_rename_at_102, int32_t & __a_rename_at_101 );
+inline void _Func_lambda_thismodule_114_8_1_0x60_finazlier_631b15124cc86c04 ( Context * __context__, struct _lambda_thismodule_114_8_1 * ____this_rename_at_114 );
+inline bool _Func_lambda_thismodule_114_8_1_0x60_function_ad2178fd3c229228 ( Context * __context__, struct _lambda_thismodule_114_8_1 & ____this_rename_at_114, int32_t & ___yield_114_rename_at_114 );
+inline void _Func_lambda_thismodule_137_8_3_0x60_finazlier_7569f040f79012ce ( Context * __context__, struct _lambda_thismodule_137_8_3 * ____this_rename_at_137 );
+inline bool _Func_lambda_thismodule_137_8_3_0x60_function_fdccccdc0c561d15 ( Context * __context__, struct _lambda_thismodule_137_8_3 & ____this_rename_at_137, int32_t & __a_rename_at_136 );
+inline Sequence DAS_COMMENT((struct Foo &)) _Funcbuiltin_0x60_each_105eb0223961c24f ( Context * __context__, TArray<struct Foo> const  & __a_rename_at_353 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_353 );
+inline Sequence DAS_COMMENT((char * &)) _Funcbuiltin_0x60_each_9d5e3afe62c831b5 ( Context * __context__, TArray<char *> const  & __a_rename_at_353 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_afe48b6af6efe23 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_2df94bf6606ae657 ( Context * __context__, TDim<int32_t,33> const  & __a_rename_at_345 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_3bd22e87ecbdcf79 ( Context * __context__, char * const  __str_rename_at_339 );
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_180, int32_t __at_rename_at_180 );
+inline void _Funcbuiltin_0x60_finalize_57e927d6f642ab9b ( Context * __context__, TArray<struct Foo> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_292 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_6c2830dfa4ff0355 ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_262 );
+inline void _Funcbuiltin_0x60_push_2f7a176973832f04 ( Context * __context__, TArray<struct Foo> & __Arr_rename_at_40, struct Foo const  & __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_clone_8f1b55668745e84b ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<struct Foo> _Funcbuiltin_0x60_to_array_837e3e0f63cd17e9 ( Context * __context__, Sequence DAS_COMMENT((struct Foo &)) const  & __it_rename_at_379 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_e7337cf490aef504 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_379 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_379 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_d45ac51cb08b659f ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) const  & __it_rename_at_379 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_699eeb328f6c894e ( Context * __context__, Sequence DAS_COMMENT((char * &)) const  & __it_rename_at_379 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627 ( Context * __context__, TDim<char *,3> & __a_rename_at_398 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_values_14f59441efef84f4 ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_272 );
+inline void finalize_1b8dc2c709e83ad5 ( Context * __context__, struct Foo & ____this_rename_at_9 );
+inline void finalize_89a02f6d5554471a ( Context * __context__, struct _lambda_thismodule_102_8_2 & ____this_rename_at_102 );
+inline void finalize_57587301e29e266 ( Context * __context__, struct _lambda_thismodule_114_8_1 & ____this_rename_at_114 );
+inline void finalize_95a1f1361349c5ff ( Context * __context__, struct _lambda_thismodule_137_8_3 & ____this_rename_at_137 );
+inline bool test_8aae182bffceec6 ( Context * __context__ );
+inline void test_each_fa8d8205381df905 ( Context * __context__, int32_t __n_rename_at_14 );
+inline void test_fixed_d81c0d351ac88056 ( Context * __context__ );
+inline void test_generator_50b8f5281920e8a2 ( Context * __context__, int32_t __n_rename_at_112 );
+inline void test_lambda_eb8cc6e82537116c ( Context * __context__, int32_t __n_rename_at_98 );
+inline void test_range_586ba4083561532 ( Context * __context__, int32_t __n_rename_at_43 );
+inline void test_string_6a2699774a5b3814 ( Context * __context__, int32_t __n_rename_at_54 );
+inline void test_strings_7167c70ac618dc01 ( Context * __context__ );
+inline void test_struct_21503db62b8ca043 ( Context * __context__, int32_t __n_rename_at_85 );
+inline void test_table_80cb2771cc5930e ( Context * __context__, int32_t __n_rename_at_66 );
+inline void test_throw_1191917e44dd8b6c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<TDim<int32_t,8>,0>(__context__) = (([&]() -> TDim<int32_t,8> {
+		TDim<int32_t,8> __mka_4;
+		__mka_4(0,__context__) = 0;
+		__mka_4(1,__context__) = 1;
+		__mka_4(2,__context__) = 15;
+		__mka_4(3,__context__) = 16;
+		__mka_4(4,__context__) = 17;
+		__mka_4(5,__context__) = 32;
+		__mka_4(6,__context__) = 33;
+		__mka_4(7,__context__) = 100;
+		return __mka_4;
+	})());/*LENGTHS*/
+	das_global<int32_t,32>(__context__) = 0;/*lambdaClosed*/
+}
+
+inline void _Func_lambda_thismodule_102_8_2_0x60_finazlier_97a96eabc1674a56 ( Context * __context__, struct _lambda_thismodule_102_8_2 * ____this_rename_at_102 )
+{
+	finalize_89a02f6d5554471a(__context__,das_arg<struct _lambda_thismodule_102_8_2>::pass(das_deref(__context__,____this_rename_at_102)));
+	das_delete_lambda_struct<struct _lambda_thismodule_102_8_2 *>::clear(__context__,____this_rename_at_102);
+}
+
+inline bool _Func_lambda_thismodule_102_8_2_0x60_function_38e006f78f44c4e6 ( Context * __context__, struct _lambda_thismodule_102_8_2 &  ____this_rename_at_102, int32_t & __a_rename_at_101 )
+{
+	if ( ____this_rename_at_102.count < ____this_rename_at_102.n )
+	{
+		das_copy(__a_rename_at_101,____this_rename_at_102.count++);
+		return true;
+	} else {
+		return false;
+	};
+}
+
+inline void _Func_lambda_thismodule_114_8_1_0x60_finazlier_631b15124cc86c04 ( Context * __context__, struct _lambda_thismodule_114_8_1 * ____this_rename_at_114 )
+{
+	finalize_57587301e29e266(__context__,das_arg<struct _lambda_thismodule_114_8_1>::pass(das_deref(__context__,____this_rename_at_114)));
+	das_delete_lambda_struct<struct _lambda_thismodule_114_8_1 *>::clear(__context__,____this_rename_at_114);
+}
+
+inline bool _Func_lambda_thismodule_114_8_1_0x60_function_ad2178fd3c229228 ( Context * __context__, struct _lambda_thismodule_114_8_1 &  ____this_rename_at_114, int32_t & ___yield_114_rename_at_114 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_114_32;
+	switch (____this_rename_at_114.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_114._loop_at_114,true);
+	das_move(____this_rename_at_114._source_0_at_114,(_temp_make_local_114_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,____this_rename_at_114.n)))));
+	memset(&(____this_rename_at_114.i), 0, 4);
+	das_copy(____this_rename_at_114._pvar_0_at_114,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_114.i)));
+	DAS_SETBOOLAND((____this_rename_at_114._loop_at_114),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114._source_0_at_114),____this_rename_at_114._pvar_0_at_114,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_114._loop_at_114 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_114_rename_at_114,____this_rename_at_114.i * 2);
+	das_copy(____this_rename_at_114.__yield,1);
+	return true;
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_114._loop_at_114),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114._source_0_at_114),____this_rename_at_114._pvar_0_at_114,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114._source_0_at_114),____this_rename_at_114._pvar_0_at_114,__context__);
+	return false;
+}
+
+inline void _Func_lambda_thismodule_137_8_3_0x60_finazlier_7569f040f79012ce ( Context * __context__, struct _lambda_thismodule_137_8_3 * ____this_rename_at_137 )
+{
+	das_global<int32_t,32>(__context__) /*lambdaClosed*/++;
+	finalize_95a1f1361349c5ff(__context__,das_arg<struct _lambda_thismodule_137_8_3>::pass(das_deref(__context__,____this_rename_at_137)));
+	das_delete_lambda_struct<struct _lambda_thismodule_137_8_3 *>::clear(__context__,____this_rename_at_137);
+}
+
+inline bool _Func_lambda_thismodule_137_8_3_0x60_function_fdccccdc0c561d15 ( Context * __context__, struct _lambda_thismodule_137_8_3 &  ____this_rename_at_137, int32_t & __a_rename_at_136 )
+{
+	if ( ____this_rename_at_137.count < 20 )
+	{
+		das_copy(__a_rename_at_136,____this_rename_at_137.count++);
+		return true;
+	} else {
+		builtin_throw(((char *) "iterator failed"),__context__);
+		return false;
+	};
+}
+
+inline Sequence DAS_COMMENT((struct Foo &)) _Funcbuiltin_0x60_each_105eb0223961c24f ( Context * __context__, TArray<struct Foo> const  &  __a_rename_at_353 )
+{
+	Sequence DAS_COMMENT((struct Foo *)) __it_rename_at_354; das_zero(__it_rename_at_354);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((struct Foo))>::pass(__it_rename_at_354),__a_rename_at_353,12,__context__);
+	return /* <- */ __it_rename_at_354;
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_353 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_354; das_zero(__it_rename_at_354);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_354),__a_rename_at_353,4,__context__);
+	return /* <- */ __it_rename_at_354;
+}
+
+inline Sequence DAS_COMMENT((char * &)) _Funcbuiltin_0x60_each_9d5e3afe62c831b5 ( Context * __context__, TArray<char *> const  &  __a_rename_at_353 )
+{
+	Sequence DAS_COMMENT((char * *)) __it_rename_at_354; das_zero(__it_rename_at_354);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_354),__a_rename_at_353,8,__context__);
+	return /* <- */ __it_rename_at_354;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_afe48b6af6efe23 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_2df94bf6606ae657 ( Context * __context__, TDim<int32_t,33> const  &  __a_rename_at_345 )
+{
+	void * __parr_rename_at_347 = (void *)(das_cast<void *>::cast(das_ref(__context__,__a_rename_at_345(0,__context__))));
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_348; das_zero(__it_rename_at_348);
+	builtin_make_fixed_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_348),__parr_rename_at_347,33,4,__context__);
+	return /* <- */ __it_rename_at_348;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_334; das_zero(__it_rename_at_334);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_334),__rng_rename_at_333,__context__);
+	return /* <- */ __it_rename_at_334;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_3bd22e87ecbdcf79 ( Context * __context__, char * const  __str_rename_at_339 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_340; das_zero(__it_rename_at_340);
+	builtin_make_string_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_340),__str_rename_at_339,__context__);
+	return /* <- */ __it_rename_at_340;
+}
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_180, int32_t __at_rename_at_180 )
+{
+	return __builtin_table_erase(__context__,__Tab_rename_at_180,__at_rename_at_180);
+}
+
+inline void _Funcbuiltin_0x60_finalize_57e927d6f642ab9b ( Context * __context__, TArray<struct Foo> &  __a_rename_at_285 )
+{
+	{
+		bool __need_loop_287 = true;
+		// aV : Foo aka TT&
+		das_iterator<TArray<struct Foo>> __aV_iterator(__a_rename_at_285);
+		struct Foo * __aV_rename_at_287;
+		__need_loop_287 = __aV_iterator.first(__context__,(__aV_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __aV_iterator.next(__context__,(__aV_rename_at_287)) )
+		{
+			finalize_1b8dc2c709e83ad5(__context__,das_arg<struct Foo>::pass((*__aV_rename_at_287)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_287));
+	};
+	builtin_array_free(das_arg<TArray<struct Foo>>::pass(__a_rename_at_285),12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_292),4,4,__context__);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_6c2830dfa4ff0355 ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_262 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_263; das_zero(__it_rename_at_263);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_263),__a_rename_at_262,4,__context__);
+	return /* <- */ __it_rename_at_263;
+}
+
+inline void _Funcbuiltin_0x60_push_2f7a176973832f04 ( Context * __context__, TArray<struct Foo> &  __Arr_rename_at_40, struct Foo const  &  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<struct Foo>>::pass(__Arr_rename_at_40),__at_rename_at_40,12,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_8f1b55668745e84b ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),__at_rename_at_75,8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<char *>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline TArray<struct Foo> _Funcbuiltin_0x60_to_array_837e3e0f63cd17e9 ( Context * __context__, Sequence DAS_COMMENT((struct Foo &)) const  &  __it_rename_at_379 )
+{
+	TArray<struct Foo> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	builtin_iterator_to_array(das_arg<TArray<struct Foo>>::pass(__arr_rename_at_380),__it_rename_at_379,12,true,__context__);
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_e7337cf490aef504 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_379 )
+{
+	TArray<int32_t> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_380),__it_rename_at_379,4,false,__context__);
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_379 )
+{
+	TArray<int32_t> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_380),__it_rename_at_379,4,true,__context__);
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_d45ac51cb08b659f ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) const  &  __it_rename_at_379 )
+{
+	TArray<int32_t> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_380),__it_rename_at_379,4,true,__context__);
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_699eeb328f6c894e ( Context * __context__, Sequence DAS_COMMENT((char * &)) const  &  __it_rename_at_379 )
+{
+	TArray<char *> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	int32_t __hint_rename_at_384 = (int32_t)builtin_iterator_size_hint(__it_rename_at_379);
+	if ( __hint_rename_at_384 > 0 )
+	{
+		_Funcbuiltin_0x60_reserve_cecea833d1e66117(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_380),__hint_rename_at_384);
+	};
+	{
+		bool __need_loop_387 = true;
+		// x : string aka TT const&
+		das_iterator<Sequence DAS_COMMENT((char *)) const > __x_iterator(__it_rename_at_379);
+		char * const  * __x_rename_at_387;
+		__need_loop_387 = __x_iterator.first(__context__,(__x_rename_at_387)) && __need_loop_387;
+		for ( ; __need_loop_387 ; __need_loop_387 = __x_iterator.next(__context__,(__x_rename_at_387)) )
+		{
+			_Funcbuiltin_0x60_push_clone_8f1b55668745e84b(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_380),(*__x_rename_at_387),-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_387));
+	};
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627 ( Context * __context__, TDim<char *,3> &  __a_rename_at_398 )
+{
+	TArray<char *> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_399),3);
+	das_copy(das_cast<TDim<char *,3>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_values_14f59441efef84f4 ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_272 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_273; das_zero(__it_rename_at_273);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_273),das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_272),4,__context__);
+	return /* <- */ __it_rename_at_273;
+}
+
+inline void finalize_1b8dc2c709e83ad5 ( Context * __context__, struct Foo &  ____this_rename_at_9 )
+{
+	memset(&(____this_rename_at_9), 0, 12);
+}
+
+inline void finalize_89a02f6d5554471a ( Context * __context__, struct _lambda_thismodule_102_8_2 &  ____this_rename_at_102 )
+{
+	memset(&(____this_rename_at_102), 0, 16);
+}
+
+inline void finalize_57587301e29e266 ( Context * __context__, struct _lambda_thismodule_114_8_1 &  ____this_rename_at_114 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114._source_0_at_114),__context__);
+	memset(&(____this_rename_at_114), 0, 40);
+}
+
+inline void finalize_95a1f1361349c5ff ( Context * __context__, struct _lambda_thismodule_137_8_3 &  ____this_rename_at_137 )
+{
+	memset(&(____this_rename_at_137), 0, 12);
+}
+
+inline bool test_8aae182bffceec6 ( Context * __context__ )
+{
+	{
+		bool __need_loop_155 = true;
+		// n : int const&
+		das_iterator<TDim<int32_t,8> const > __n_iterator(das_global<TDim<int32_t,8>,0>(__context__) /*LENGTHS*/);
+		int32_t const  * __n_rename_at_155;
+		__need_loop_155 = __n_iterator.first(__context__,(__n_rename_at_155)) && __need_loop_155;
+		for ( ; __need_loop_155 ; __need_loop_155 = __n_iterator.next(__context__,(__n_rename_at_155)) )
+		{
+			test_each_fa8d8205381df905(__context__,(*__n_rename_at_155));
+			test_range_586ba4083561532(__context__,(*__n_rename_at_155));
+			test_string_6a2699774a5b3814(__context__,(*__n_rename_at_155));
+			test_table_80cb2771cc5930e(__context__,(*__n_rename_at_155));
+			test_struct_21503db62b8ca043(__context__,(*__n_rename_at_155));
+			test_lambda_eb8cc6e82537116c(__context__,(*__n_rename_at_155));
+			test_generator_50b8f5281920e8a2(__context__,(*__n_rename_at_155));
+		}
+		__n_iterator.close(__context__,(__n_rename_at_155));
+	};
+	test_fixed_d81c0d351ac88056(__context__);
+	test_strings_7167c70ac618dc01(__context__);
+	test_throw_1191917e44dd8b6c(__context__);
+	return true;
+}
+
+inline void test_each_fa8d8205381df905 ( Context * __context__, int32_t __n_rename_at_14 )
+{
+	TArray<int32_t> _temp_make_local_20_112;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_20_144;
+	TArray<int32_t> __a_rename_at_15; das_zero(__a_rename_at_15);
+	{
+		bool __need_loop_16 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_14));
+		int32_t __i_rename_at_16;
+		__need_loop_16 = __i_iterator.first(__context__,(__i_rename_at_16)) && __need_loop_16;
+		for ( ; __need_loop_16 ; __need_loop_16 = __i_iterator.next(__context__,(__i_rename_at_16)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_15),__i_rename_at_16 * 3,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_16));
+	};
+	TArray<int32_t> __b_rename_at_18; das_zero(__b_rename_at_18);
+	das_move(__b_rename_at_18,(_temp_make_local_20_112 = (_Funcbuiltin_0x60_to_array_d45ac51cb08b659f(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_20_144 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_15)))))))));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__b_rename_at_18)) == __n_rename_at_14));
+	{
+		bool __need_loop_22 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__b_rename_at_18);
+		int32_t * __x_rename_at_22;
+		__need_loop_22 = __x_iterator.first(__context__,(__x_rename_at_22)) && __need_loop_22;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_14));
+		int32_t __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __x_iterator.next(__context__,(__x_rename_at_22)) && __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_22) == (__i_rename_at_22 * 3)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_22));
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+	if ( __n_rename_at_14 > 0 )
+	{
+		das_copy(__b_rename_at_18(0,__context__),100);
+		DAS_ASSERT((__a_rename_at_15(0,__context__) == 0));
+	};
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_15));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_18));
+}
+
+inline void test_fixed_d81c0d351ac88056 ( Context * __context__ )
+{
+	TArray<int32_t> _temp_make_local_37_240;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_37_272;
+	TDim<int32_t,33> __f_rename_at_32; das_zero(__f_rename_at_32);
+	{
+		bool __need_loop_33 = true;
+		// x : int& -const
+		das_iterator<TDim<int32_t,33>> __x_iterator(__f_rename_at_32);
+		int32_t * __x_rename_at_33;
+		__need_loop_33 = __x_iterator.first(__context__,(__x_rename_at_33)) && __need_loop_33;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,33));
+		int32_t __i_rename_at_33;
+		__need_loop_33 = __i_iterator.first(__context__,(__i_rename_at_33)) && __need_loop_33;
+		for ( ; __need_loop_33 ; __need_loop_33 = __x_iterator.next(__context__,(__x_rename_at_33)) && __i_iterator.next(__context__,(__i_rename_at_33)) )
+		{
+			das_copy((*__x_rename_at_33),__i_rename_at_33 + 1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_33));
+		__i_iterator.close(__context__,(__i_rename_at_33));
+	};
+	TArray<int32_t> __b_rename_at_35; das_zero(__b_rename_at_35);
+	das_move(__b_rename_at_35,(_temp_make_local_37_240 = (_Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_37_272 = (_Funcbuiltin_0x60_each_2df94bf6606ae657(__context__,das_arg<TDim<int32_t,33>>::pass(__f_rename_at_32)))))))));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__b_rename_at_35)) == 33));
+	{
+		bool __need_loop_39 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__b_rename_at_35);
+		int32_t * __x_rename_at_39;
+		__need_loop_39 = __x_iterator.first(__context__,(__x_rename_at_39)) && __need_loop_39;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,33));
+		int32_t __i_rename_at_39;
+		__need_loop_39 = __i_iterator.first(__context__,(__i_rename_at_39)) && __need_loop_39;
+		for ( ; __need_loop_39 ; __need_loop_39 = __x_iterator.next(__context__,(__x_rename_at_39)) && __i_iterator.next(__context__,(__i_rename_at_39)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_39) == (__i_rename_at_39 + 1)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_39));
+		__i_iterator.close(__context__,(__i_rename_at_39));
+	};
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_35));
+}
+
+inline void test_generator_50b8f5281920e8a2 ( Context * __context__, int32_t __n_rename_at_112 )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_113; das_zero(__gen_rename_at_113); das_move(__gen_rename_at_113, _Funcbuiltin_0x60_each_afe48b6af6efe23(__context__,das_ascend<bool,struct _lambda_thismodule_114_8_1>::make(__context__,&__type_info__b6e7187c,(([&]() -> struct _lambda_thismodule_114_8_1 {
+		struct _lambda_thismodule_114_8_1 __mks_113;
+		das_zero(__mks_113);
+		das_copy((__mks_113.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_114_8_1`function _lambda_thismodule_114_8_1 int#ref*/ 1111327722u))));
+		das_copy((__mks_113.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_114_8_1`finazlier #ptr#_lambda_thismodule_114_8_1#explicit*/ 2177460814u))));
+		das_copy((__mks_113.n),(__n_rename_at_112));
+		return __mks_113;
+	})()))));
+	TArray<int32_t> __b_rename_at_117; das_zero(__b_rename_at_117); das_move(__b_rename_at_117, _Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_113)));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__b_rename_at_117)) == __n_rename_at_112));
+	{
+		bool __need_loop_119 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__b_rename_at_117);
+		int32_t * __x_rename_at_119;
+		__need_loop_119 = __x_iterator.first(__context__,(__x_rename_at_119)) && __need_loop_119;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_112));
+		int32_t __i_rename_at_119;
+		__need_loop_119 = __i_iterator.first(__context__,(__i_rename_at_119)) && __need_loop_119;
+		for ( ; __need_loop_119 ; __need_loop_119 = __x_iterator.next(__context__,(__x_rename_at_119)) && __i_iterator.next(__context__,(__i_rename_at_119)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_119) == (__i_rename_at_119 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_119));
+		__i_iterator.close(__context__,(__i_rename_at_119));
+	};
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_117));
+}
+
+inline void test_lambda_eb8cc6e82537116c ( Context * __context__, int32_t __n_rename_at_98 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_106_112;
+	int32_t __count_rename_at_100 = 0;
+	Lambda DAS_COMMENT((bool,int32_t &)) __lam_rename_at_101; das_zero(__lam_rename_at_101); das_move(__lam_rename_at_101, das_ascend<bool,struct _lambda_thismodule_102_8_2>::make(__context__,&__type_info__6594b8a,(([&]() -> struct _lambda_thismodule_102_8_2 {
+		struct _lambda_thismodule_102_8_2 __mks_102;
+		das_copy((__mks_102.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_102_8_2`function _lambda_thismodule_102_8_2 int#ref*/ 3096956974u))));
+		das_copy((__mks_102.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_102_8_2`finazlier #ptr#_lambda_thismodule_102_8_2#explicit*/ 4039354034u))));
+		das_copy((__mks_102.count),(__count_rename_at_100));
+		das_copy((__mks_102.n),(__n_rename_at_98));
+		return __mks_102;
+	})())));
+	TArray<int32_t> __b_rename_at_106; das_zero(__b_rename_at_106); das_move(__b_rename_at_106, _Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_106_112 = (_Funcbuiltin_0x60_each_afe48b6af6efe23(__context__,__lam_rename_at_101))))));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__b_rename_at_106)) == __n_rename_at_98));
+	{
+		bool __need_loop_108 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__b_rename_at_106);
+		int32_t * __x_rename_at_108;
+		__need_loop_108 = __x_iterator.first(__context__,(__x_rename_at_108)) && __need_loop_108;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_98));
+		int32_t __i_rename_at_108;
+		__need_loop_108 = __i_iterator.first(__context__,(__i_rename_at_108)) && __need_loop_108;
+		for ( ; __need_loop_108 ; __need_loop_108 = __x_iterator.next(__context__,(__x_rename_at_108)) && __i_iterator.next(__context__,(__i_rename_at_108)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_108) == __i_rename_at_108));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_108));
+		__i_iterator.close(__context__,(__i_rename_at_108));
+	};
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_106));
+}
+
+inline void test_range_586ba4083561532 ( Context * __context__, int32_t __n_rename_at_43 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_44_64;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_49_144;
+	TArray<int32_t> __b_rename_at_44; das_zero(__b_rename_at_44); das_move(__b_rename_at_44, _Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_44_64 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,__n_rename_at_43)))))));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__b_rename_at_44)) == __n_rename_at_43));
+	{
+		bool __need_loop_46 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__b_rename_at_44);
+		int32_t * __x_rename_at_46;
+		__need_loop_46 = __x_iterator.first(__context__,(__x_rename_at_46)) && __need_loop_46;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_43));
+		int32_t __i_rename_at_46;
+		__need_loop_46 = __i_iterator.first(__context__,(__i_rename_at_46)) && __need_loop_46;
+		for ( ; __need_loop_46 ; __need_loop_46 = __x_iterator.next(__context__,(__x_rename_at_46)) && __i_iterator.next(__context__,(__i_rename_at_46)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_46) == __i_rename_at_46));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_46));
+		__i_iterator.close(__context__,(__i_rename_at_46));
+	};
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_44));
+	TArray<int32_t> __c_rename_at_49; das_zero(__c_rename_at_49); das_move(__c_rename_at_49, _Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_49_144 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(5,5 + __n_rename_at_43)))))));
+	{
+		bool __need_loop_50 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__c_rename_at_49);
+		int32_t * __x_rename_at_50;
+		__need_loop_50 = __x_iterator.first(__context__,(__x_rename_at_50)) && __need_loop_50;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_43));
+		int32_t __i_rename_at_50;
+		__need_loop_50 = __i_iterator.first(__context__,(__i_rename_at_50)) && __need_loop_50;
+		for ( ; __need_loop_50 ; __need_loop_50 = __x_iterator.next(__context__,(__x_rename_at_50)) && __i_iterator.next(__context__,(__i_rename_at_50)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_50) == (__i_rename_at_50 + 5)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_50));
+		__i_iterator.close(__context__,(__i_rename_at_50));
+	};
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__c_rename_at_49));
+}
+
+inline void test_string_6a2699774a5b3814 ( Context * __context__, int32_t __n_rename_at_54 )
+{
+	TArray<int32_t> _temp_make_local_60_96;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_60_128;
+	char * __s_rename_at_55 = (char *)(((char *) ""));
+	{
+		bool __need_loop_56 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_54));
+		int32_t __i_rename_at_56;
+		__need_loop_56 = __i_iterator.first(__context__,(__i_rename_at_56)) && __need_loop_56;
+		for ( ; __need_loop_56 ; __need_loop_56 = __i_iterator.next(__context__,(__i_rename_at_56)) )
+		{
+			das_copy(__s_rename_at_55,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(__s_rename_at_55),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from((SimPolicy<int32_t>::Mod(__i_rename_at_56,10,*__context__)))))),*__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_56));
+	};
+	TArray<int32_t> __b_rename_at_58; das_zero(__b_rename_at_58);
+	das_move(__b_rename_at_58,(_temp_make_local_60_96 = (_Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_60_128 = (_Funcbuiltin_0x60_each_3bd22e87ecbdcf79(__context__,__s_rename_at_55))))))));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__b_rename_at_58)) == __n_rename_at_54));
+	{
+		bool __need_loop_62 = true;
+		// ch : int&
+		das_iterator<TArray<int32_t>> __ch_iterator(__b_rename_at_58);
+		int32_t * __ch_rename_at_62;
+		__need_loop_62 = __ch_iterator.first(__context__,(__ch_rename_at_62)) && __need_loop_62;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_54));
+		int32_t __i_rename_at_62;
+		__need_loop_62 = __i_iterator.first(__context__,(__i_rename_at_62)) && __need_loop_62;
+		for ( ; __need_loop_62 ; __need_loop_62 = __ch_iterator.next(__context__,(__ch_rename_at_62)) && __i_iterator.next(__context__,(__i_rename_at_62)) )
+		{
+			DAS_ASSERT(((*__ch_rename_at_62) == (48 + (SimPolicy<int32_t>::Mod(__i_rename_at_62,10,*__context__)))));
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_62));
+		__i_iterator.close(__context__,(__i_rename_at_62));
+	};
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_58));
+}
+
+inline void test_strings_7167c70ac618dc01 ( Context * __context__ )
+{
+	TDim<char *,3> _temp_make_local_125_64;
+	TArray<char *> _temp_make_local_128_128;
+	Sequence DAS_COMMENT((char * *)) _temp_make_local_128_160;
+	TArray<char *> __a_rename_at_125; das_zero(__a_rename_at_125); das_move(__a_rename_at_125, _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627(__context__,das_arg<TDim<char *,3>>::pass((([&]() -> TDim<char *,3>& {
+		_temp_make_local_125_64(0,__context__) = ((char *) "one");
+		_temp_make_local_125_64(1,__context__) = ((char *) "two");
+		_temp_make_local_125_64(2,__context__) = ((char *) "three");
+		return _temp_make_local_125_64;
+	})()))));
+	TArray<char *> __b_rename_at_126; das_zero(__b_rename_at_126);
+	das_move(__b_rename_at_126,(_temp_make_local_128_128 = (_Funcbuiltin_0x60_to_array_699eeb328f6c894e(__context__,das_arg<Sequence DAS_COMMENT((char *))>::pass((_temp_make_local_128_160 = (_Funcbuiltin_0x60_each_9d5e3afe62c831b5(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_125)))))))));
+	DAS_ASSERT((((builtin_array_size(das_arg<TArray<char *>>::pass(__b_rename_at_126)) == 3) && (SimPolicy<char *>::Equ(cast<char *>::from(__b_rename_at_126(0,__context__)),cast<char *>::from(((char *) "one")),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(__b_rename_at_126(2,__context__)),cast<char *>::from(((char *) "three")),*__context__))));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_125));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__b_rename_at_126));
+}
+
+inline void test_struct_21503db62b8ca043 ( Context * __context__, int32_t __n_rename_at_85 )
+{
+	TArray<struct Foo> _temp_make_local_91_128;
+	Sequence DAS_COMMENT((struct Foo *)) _temp_make_local_91_160;
+	TArray<struct Foo> __a_rename_at_86; das_zero(__a_rename_at_86);
+	{
+		bool __need_loop_87 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_85));
+		int32_t __i_rename_at_87;
+		__need_loop_87 = __i_iterator.first(__context__,(__i_rename_at_87)) && __need_loop_87;
+		for ( ; __need_loop_87 ; __need_loop_87 = __i_iterator.next(__context__,(__i_rename_at_87)) )
+		{
+			struct Foo _temp_make_local_88_80;
+			_Funcbuiltin_0x60_push_2f7a176973832f04(__context__,das_arg<TArray<struct Foo>>::pass(__a_rename_at_86),das_arg<struct Foo>::pass((([&]() -> struct Foo& {
+				das_copy((_temp_make_local_88_80.a),(__i_rename_at_87));
+				das_copy((_temp_make_local_88_80.b),(float(__i_rename_at_87)));
+				das_copy((_temp_make_local_88_80.c),(-__i_rename_at_87));
+				return _temp_make_local_88_80;
+			})())),-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_87));
+	};
+	TArray<struct Foo> __b_rename_at_89; das_zero(__b_rename_at_89);
+	das_move(__b_rename_at_89,(_temp_make_local_91_128 = (_Funcbuiltin_0x60_to_array_837e3e0f63cd17e9(__context__,das_arg<Sequence DAS_COMMENT((struct Foo))>::pass((_temp_make_local_91_160 = (_Funcbuiltin_0x60_each_105eb0223961c24f(__context__,das_arg<TArray<struct Foo>>::pass(__a_rename_at_86)))))))));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<struct Foo>>::pass(__b_rename_at_89)) == __n_rename_at_85));
+	{
+		bool __need_loop_93 = true;
+		// x : Foo&
+		das_iterator<TArray<struct Foo>> __x_iterator(__b_rename_at_89);
+		struct Foo * __x_rename_at_93;
+		__need_loop_93 = __x_iterator.first(__context__,(__x_rename_at_93)) && __need_loop_93;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_85));
+		int32_t __i_rename_at_93;
+		__need_loop_93 = __i_iterator.first(__context__,(__i_rename_at_93)) && __need_loop_93;
+		for ( ; __need_loop_93 ; __need_loop_93 = __x_iterator.next(__context__,(__x_rename_at_93)) && __i_iterator.next(__context__,(__i_rename_at_93)) )
+		{
+			DAS_ASSERT(((((*__x_rename_at_93).a == __i_rename_at_93) && ((*__x_rename_at_93).b == float(__i_rename_at_93))) && ((*__x_rename_at_93).c == -__i_rename_at_93)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_93));
+		__i_iterator.close(__context__,(__i_rename_at_93));
+	};
+	_Funcbuiltin_0x60_finalize_57e927d6f642ab9b(__context__,das_arg<TArray<struct Foo>>::pass(__a_rename_at_86));
+	_Funcbuiltin_0x60_finalize_57e927d6f642ab9b(__context__,das_arg<TArray<struct Foo>>::pass(__b_rename_at_89));
+}
+
+inline void test_table_80cb2771cc5930e ( Context * __context__, int32_t __n_rename_at_66 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_72_144;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_73_192;
+	TTable<int32_t,int32_t> __tab_rename_at_67; das_zero(__tab_rename_at_67);
+	{
+		bool __need_loop_68 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_66 * 2));
+		int32_t __i_rename_at_68;
+		__need_loop_68 = __i_iterator.first(__context__,(__i_rename_at_68)) && __need_loop_68;
+		for ( ; __need_loop_68 ; __need_loop_68 = __i_iterator.next(__context__,(__i_rename_at_68)) )
+		{
+			das_copy(__tab_rename_at_67(__i_rename_at_68,__context__),__i_rename_at_68 * 2);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_68));
+	};
+	{
+		bool __need_loop_70 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_66));
+		int32_t __i_rename_at_70;
+		__need_loop_70 = __i_iterator.first(__context__,(__i_rename_at_70)) && __need_loop_70;
+		for ( ; __need_loop_70 ; __need_loop_70 = __i_iterator.next(__context__,(__i_rename_at_70)) )
+		{
+			_Funcbuiltin_0x60_erase_3b06d4792ac86bb9(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_67),__i_rename_at_70 * 2);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_70));
+	};
+	TArray<int32_t> __k_rename_at_72; das_zero(__k_rename_at_72); das_move(__k_rename_at_72, _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_72_144 = (_Funcbuiltin_0x60_keys_6c2830dfa4ff0355(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_67)))))));
+	TArray<int32_t> __v_rename_at_73; das_zero(__v_rename_at_73); das_move(__v_rename_at_73, _Funcbuiltin_0x60_to_array_d45ac51cb08b659f(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_73_192 = (_Funcbuiltin_0x60_values_14f59441efef84f4(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_67)))))));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__k_rename_at_72)) == __n_rename_at_66));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__v_rename_at_73)) == __n_rename_at_66));
+	int32_t __total_rename_at_76 = 0;
+	{
+		bool __need_loop_77 = true;
+		// kk : int&
+		das_iterator<TArray<int32_t>> __kk_iterator(__k_rename_at_72);
+		int32_t * __kk_rename_at_77;
+		__need_loop_77 = __kk_iterator.first(__context__,(__kk_rename_at_77)) && __need_loop_77;
+		// vv : int&
+		das_iterator<TArray<int32_t>> __vv_iterator(__v_rename_at_73);
+		int32_t * __vv_rename_at_77;
+		__need_loop_77 = __vv_iterator.first(__context__,(__vv_rename_at_77)) && __need_loop_77;
+		for ( ; __need_loop_77 ; __need_loop_77 = __kk_iterator.next(__context__,(__kk_rename_at_77)) && __vv_iterator.next(__context__,(__vv_rename_at_77)) )
+		{
+			DAS_ASSERT(((*__vv_rename_at_77) == ((*__kk_rename_at_77) * 2)));
+			__total_rename_at_76 += (*__kk_rename_at_77);
+		}
+		__kk_iterator.close(__context__,(__kk_rename_at_77));
+		__vv_iterator.close(__context__,(__vv_rename_at_77));
+	};
+	DAS_ASSERT((__total_rename_at_76 == (__n_rename_at_66 * __n_rename_at_66)));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__k_rename_at_72));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__v_rename_at_73));
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_67));
+}
+
+inline void test_throw_1191917e44dd8b6c ( Context * __context__ )
+{
+	int32_t __count_rename_at_135 = 0;
+	Lambda DAS_COMMENT((bool,int32_t &)) __lam_rename_at_136; das_zero(__lam_rename_at_136); das_move(__lam_rename_at_136, das_ascend<bool,struct _lambda_thismodule_137_8_3>::make(__context__,&__type_info__dfd1cd0d,(([&]() -> struct _lambda_thismodule_137_8_3 {
+		struct _lambda_thismodule_137_8_3 __mks_137;
+		das_copy((__mks_137.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_137_8_3`function _lambda_thismodule_137_8_3 int#ref*/ 4158947446u))));
+		das_copy((__mks_137.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_137_8_3`finazlier #ptr#_lambda_thismodule_137_8_3#explicit*/ 3055239270u))));
+		das_copy((__mks_137.count),(__count_rename_at_135));
+		return __mks_137;
+	})())));
+	bool __recovered_rename_at_144 = false;
+	das_try_recover(__context__, [&]()
+	{
+		Sequence DAS_COMMENT((int32_t)) _temp_make_local_146_128;
+		TArray<int32_t> __b_rename_at_146; das_zero(__b_rename_at_146); das_move(__b_rename_at_146, _Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_146_128 = (_Funcbuiltin_0x60_each_afe48b6af6efe23(__context__,__lam_rename_at_136))))));
+		_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_146));
+	}, [&]()
+	{
+		das_copy(__recovered_rename_at_144,true);
+	});
+	DAS_ASSERT((__recovered_rename_at_144));
+	DAS_ASSERT((das_global<int32_t,32>(__context__) /*lambdaClosed*/ == 1));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_102_8_2_0x60_finazlier_97a96eabc1674a56
+		aotLib[0xabf85fb3d724f43a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_102_8_2 *  ),&_Func_lambda_thismodule_102_8_2_0x60_finazlier_97a96eabc1674a56>>();
+	};
+		// _Func_lambda_thismodule_102_8_2_0x60_function_38e006f78f44c4e6
+		aotLib[0xa19c101dcf46b7c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_102_8_2 & , int32_t &  ),&_Func_lambda_thismodule_102_8_2_0x60_function_38e006f78f44c4e6>>();
+	};
+		// _Func_lambda_thismodule_114_8_1_0x60_finazlier_631b15124cc86c04
+		aotLib[0x8b77f8d9813cef39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_114_8_1 *  ),&_Func_lambda_thismodule_114_8_1_0x60_finazlier_631b15124cc86c04>>();
+	};
+		// _Func_lambda_thismodule_114_8_1_0x60_function_ad2178fd3c229228
+		aotLib[0x6bb5630bb4d6ff78] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_114_8_1 & , int32_t &  ),&_Func_lambda_thismodule_114_8_1_0x60_function_ad2178fd3c229228>>();
+	};
+		// _Func_lambda_thismodule_137_8_3_0x60_finazlier_7569f040f79012ce
+		aotLib[0x5a8b56828219ed06] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_137_8_3 *  ),&_Func_lambda_thismodule_137_8_3_0x60_finazlier_7569f040f79012ce>>();
+	};
+		// _Func_lambda_thismodule_137_8_3_0x60_function_fdccccdc0c561d15
+		aotLib[0xdca908823778207d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_137_8_3 & , int32_t &  ),&_Func_lambda_thismodule_137_8_3_0x60_function_fdccccdc0c561d15>>();
+	};
+		// _Funcbuiltin_0x60_each_105eb0223961c24f
+		aotLib[0x96c30acb9b02bb81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((struct Foo &)) (*) ( Context * __context__, TArray<struct Foo> const  &  ),&_Funcbuiltin_0x60_each_105eb0223961c24f>>();
+	};
+		// _Funcbuiltin_0x60_each_49ba41ea6e9b0c25
+		aotLib[0x6a4a051ab138a935] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_49ba41ea6e9b0c25>>();
+	};
+		// _Funcbuiltin_0x60_each_9d5e3afe62c831b5
+		aotLib[0x19c03b79a5a861f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char * &)) (*) ( Context * __context__, TArray<char *> const  &  ),&_Funcbuiltin_0x60_each_9d5e3afe62c831b5>>();
+	};
+		// _Funcbuiltin_0x60_each_afe48b6af6efe23
+		aotLib[0xdf791b8766df76c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_afe48b6af6efe23>>();
+	};
+		// _Funcbuiltin_0x60_each_2df94bf6606ae657
+		aotLib[0xf7cb02f8d4f43815] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TDim<int32_t,33> const  &  ),&_Funcbuiltin_0x60_each_2df94bf6606ae657>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_each_3bd22e87ecbdcf79
+		aotLib[0x4c2de9cff1fb15e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, char * const   ),&_Funcbuiltin_0x60_each_3bd22e87ecbdcf79>>();
+	};
+		// _Funcbuiltin_0x60_erase_3b06d4792ac86bb9
+		aotLib[0x25338066fdc3cf05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_3b06d4792ac86bb9>>();
+	};
+		// _Funcbuiltin_0x60_finalize_57e927d6f642ab9b
+		aotLib[0xf317b75631a27a0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> &  ),&_Funcbuiltin_0x60_finalize_57e927d6f642ab9b>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+		aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+		// _Funcbuiltin_0x60_keys_6c2830dfa4ff0355
+		aotLib[0x40b58262c96d3a05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_keys_6c2830dfa4ff0355>>();
+	};
+		// _Funcbuiltin_0x60_push_2f7a176973832f04
+		aotLib[0xc54946f25a9a9725] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , struct Foo const  & , int32_t  ),&_Funcbuiltin_0x60_push_2f7a176973832f04>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_8f1b55668745e84b
+		aotLib[0x60f7feeaae35f805] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_clone_8f1b55668745e84b>>();
+	};
+		// _Funcbuiltin_0x60_reserve_cecea833d1e66117
+		aotLib[0x58482c2f23d3c0ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_cecea833d1e66117>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// _Funcbuiltin_0x60_to_array_837e3e0f63cd17e9
+		aotLib[0x60c7d4f1fc4f3a69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<struct Foo> (*) ( Context * __context__, Sequence DAS_COMMENT((struct Foo &)) const  &  ),&_Funcbuiltin_0x60_to_array_837e3e0f63cd17e9>>();
+	};
+		// _Funcbuiltin_0x60_to_array_e7337cf490aef504
+		aotLib[0xb019749877860f09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcbuiltin_0x60_to_array_e7337cf490aef504>>();
+	};
+		// _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa
+		aotLib[0xe82facb3d4281305] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  ),&_Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa>>();
+	};
+		// _Funcbuiltin_0x60_to_array_d45ac51cb08b659f
+		aotLib[0xdd2eb1e5815397d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) const  &  ),&_Funcbuiltin_0x60_to_array_d45ac51cb08b659f>>();
+	};
+		// _Funcbuiltin_0x60_to_array_699eeb328f6c894e
+		aotLib[0x8f03516a19a651f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, Sequence DAS_COMMENT((char * &)) const  &  ),&_Funcbuiltin_0x60_to_array_699eeb328f6c894e>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627
+		aotLib[0xd9c10fb92f4cd82f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,3> &  ),&_Funcbuiltin_0x60_to_array_move_bfd0e514057ae627>>();
+	};
+		// _Funcbuiltin_0x60_values_14f59441efef84f4
+		aotLib[0x19e847229ff8179] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_values_14f59441efef84f4>>();
+	};
+		// finalize_1b8dc2c709e83ad5
+		aotLib[0x55674ffd49447df9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&finalize_1b8dc2c709e83ad5>>();
+	};
+		// finalize_89a02f6d5554471a
+		aotLib[0x76cb5bfcdc1de5bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_102_8_2 &  ),&finalize_89a02f6d5554471a>>();
+	};
+		// finalize_57587301e29e266
+		aotLib[0xd73ff3ea18c81025] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_114_8_1 &  ),&finalize_57587301e29e266>>();
+	};
+		// finalize_95a1f1361349c5ff
+		aotLib[0x8b263fd9894424e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_137_8_3 &  ),&finalize_95a1f1361349c5ff>>();
+	};
+		// test_8aae182bffceec6
+		aotLib[0xb7cf40038338d5bc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_8aae182bffceec6>>();
+	};
+		// test_each_fa8d8205381df905
+		aotLib[0xf0def0fe09d81d53] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&test_each_fa8d8205381df905>>();
+	};
+		// test_fixed_d81c0d351ac88056
+		aotLib[0x2fe98ad064d940cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_fixed_d81c0d351ac88056>>();
+	};
+		// test_generator_50b8f5281920e8a2
+		aotLib[0x2413947e2220a278] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&test_generator_50b8f5281920e8a2>>();
+	};
+		// test_lambda_eb8cc6e82537116c
+		aotLib[0xbb7614c1e3f9fb5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&test_lambda_eb8cc6e82537116c>>();
+	};
+		// test_range_586ba4083561532
+		aotLib[0x89a59bdf850c8d9c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&test_range_586ba4083561532>>();
+	};
+		// test_string_6a2699774a5b3814
+		aotLib[0x2c5db6bafef0a52] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&test_string_6a2699774a5b3814>>();
+	};
+		// test_strings_7167c70ac618dc01
+		aotLib[0xd3c99f03f3e8f629] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_strings_7167c70ac618dc01>>();
+	};
+		// test_struct_21503db62b8ca043
+		aotLib[0x6c7abc75bb7e02a0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&test_struct_21503db62b8ca043>>();
+	};
+		// test_table_80cb2771cc5930e
+		aotLib[0x9e4a5a1bc897d835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&test_table_80cb2771cc5930e>>();
+	};
+		// test_throw_1191917e44dd8b6c
+		aotLib[0x8abe399186e9a556] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_throw_1191917e44dd8b6c>>();
+	};
+		// [[ init script ]]
+		aotLib[0x505b8278565874c8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,322 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+TypeInfo * __tinfo_4[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_5[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+TypeInfo * __tinfo_6[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_7[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+TypeInfo * __tinfo_8[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_9[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+TypeInfo * __tinfo_10[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline char * const  _Funcstrings_boost_0x60_join_83054cc3488abcba ( Context * __context__, TArray<int32_t> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_224adad28e747116 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_123d3b70f04cafb ( Context * __context__, TDim<int32_t,1> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_911d2e108f271486 ( Context * __context__, TDim<int32_t,4> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_4e83c397f6272b7a ( Context * __context__, range __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_46007c18683156b9 ( Context * __context__, char * const  __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline bool test_1b3e29860ce3b50e ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_334; das_zero(__it_rename_at_334);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_334),__rng_rename_at_333,__context__);
+	return /* <- */ __it_rename_at_334;
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_83054cc3488abcba ( Context * __context__, TArray<int32_t> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const&
+			das_iterator<TArray<int32_t> const > __elem_iterator(__it_rename_at_16);
+			int32_t const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__))));
+	return __st_rename_at_21;
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_224adad28e747116 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const
+			das_iterator<Sequence DAS_COMMENT((int32_t)) const > __elem_iterator(__it_rename_at_16);
+			int32_t __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from(__elem_rename_at_23)));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__))));
+	return __st_rename_at_21;
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_123d3b70f04cafb ( Context * __context__, TDim<int32_t,1> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const&
+			das_iterator<TDim<int32_t,1> const > __elem_iterator(__it_rename_at_16);
+			int32_t const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__))));
+	return __st_rename_at_21;
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_911d2e108f271486 ( Context * __context__, TDim<int32_t,4> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const&
+			das_iterator<TDim<int32_t,4> const > __elem_iterator(__it_rename_at_16);
+			int32_t const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_6,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_7,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__))));
+	return __st_rename_at_21;
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_4e83c397f6272b7a ( Context * __context__, range __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const
+			das_iterator<range> __elem_iterator(__it_rename_at_16);
+			int32_t __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_8,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_9,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from(__elem_rename_at_23)));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__))));
+	return __st_rename_at_21;
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_46007c18683156b9 ( Context * __context__, char * const  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const
+			das_iterator<char * const > __elem_iterator(__it_rename_at_16);
+			int32_t __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_10,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				write_string_char(das_arg<StringBuilderWriter>::pass(__writer_rename_at_21),__elem_rename_at_23);
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__))));
+	return __st_rename_at_21;
+}
+
+inline bool test_1b3e29860ce3b50e ( Context * __context__ )
+{
+	TDim<int32_t,1> _temp_make_local_6_32;
+	TDim<int32_t,4> _temp_make_local_7_48;
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_123d3b70f04cafb(__context__,das_arg<TDim<int32_t,1>>::pass((([&]() -> TDim<int32_t,1>& {
+		_temp_make_local_6_32(0,__context__) = 1;
+		return _temp_make_local_6_32;
+	})())),((char *) ","))),cast<char *>::from(((char *) "1")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_911d2e108f271486(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_7_48(0,__context__) = 1;
+		_temp_make_local_7_48(1,__context__) = 2;
+		_temp_make_local_7_48(2,__context__) = 3;
+		_temp_make_local_7_48(3,__context__) = 4;
+		return _temp_make_local_7_48;
+	})())),((char *) ","))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	TArray<int32_t> __a_rename_at_9; das_zero(__a_rename_at_9);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_83054cc3488abcba(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) " "))),cast<char *>::from(((char *) "")),*__context__)));
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),1,-1);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_83054cc3488abcba(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) "."))),cast<char *>::from(((char *) "1")),*__context__)));
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),2,-1);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_83054cc3488abcba(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) "."))),cast<char *>::from(((char *) "1.2")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_4e83c397f6272b7a(__context__,range(1,4),((char *) "-"))),cast<char *>::from(((char *) "1-2-3")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_46007c18683156b9(__context__,((char *) "hello"),((char *) " "))),cast<char *>::from(((char *) "h e l l o")),*__context__)));
+	Sequence DAS_COMMENT((int32_t)) __rit_rename_at_20; das_zero(__rit_rename_at_20); das_move(__rit_rename_at_20, (Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(1,4)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_224adad28e747116(__context__,__rit_rename_at_20,((char *) "*"))),cast<char *>::from(((char *) "1*2*3")),*__context__)));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcstrings_boost_0x60_join_83054cc3488abcba
+		aotLib[0xfdbaf2e902de5001] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<int32_t> const  & , char * const   ),&_Funcstrings_boost_0x60_join_83054cc3488abcba>>();
+	};
+		// _Funcstrings_boost_0x60_join_224adad28e747116
+		aotLib[0x43c37a3644dc1e11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , char * const   ),&_Funcstrings_boost_0x60_join_224adad28e747116>>();
+	};
+		// _Funcstrings_boost_0x60_join_123d3b70f04cafb
+		aotLib[0x9bcc14f5a874ea71] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TDim<int32_t,1> const  & , char * const   ),&_Funcstrings_boost_0x60_join_123d3b70f04cafb>>();
+	};
+		// _Funcstrings_boost_0x60_join_911d2e108f271486
+		aotLib[0xa4d34a0df5ca48d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TDim<int32_t,4> const  & , char * const   ),&_Funcstrings_boost_0x60_join_911d2e108f271486>>();
+	};
+		// _Funcstrings_boost_0x60_join_4e83c397f6272b7a
+		aotLib[0x390cae2114b97b3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, range , char * const   ),&_Funcstrings_boost_0x60_join_4e83c397f6272b7a>>();
+	};
+		// _Funcstrings_boost_0x60_join_46007c18683156b9
+		aotLib[0xcc4beb945e7ecf55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, char * const  , char * const   ),&_Funcstrings_boost_0x60_join_46007c18683156b9>>();
+	};
+		// test_1b3e29860ce3b50e
+		aotLib[0x44d5be7547781df8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_1b3e29860ce3b50e>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,303 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void N_goto_560dcbef5d9f8e02 ( Context * __context__ );
+inline void basic_goto_c53412c1d5c1da46 ( Context * __context__ );
+inline void finally_goto_a61824921d9db89f ( Context * __context__, bool __yes_rename_at_74 );
+inline void for_goto_4e898d372c4980d1 ( Context * __context__ );
+inline int32_t gotoN_5aaf428e921a02f0 ( Context * __context__, int32_t __n_rename_at_85 );
+inline void nested_goto_17a353e24f434d61 ( Context * __context__ );
+inline bool test_cfc5e34a946b176c ( Context * __context__ );
+inline void while_goto_2920c5a45d1b63f3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void N_goto_560dcbef5d9f8e02 ( Context * __context__ )
+{
+	DAS_VERIFY((gotoN_5aaf428e921a02f0(__context__,0) == 0));
+	DAS_VERIFY((gotoN_5aaf428e921a02f0(__context__,1) == 1));
+	DAS_VERIFY((gotoN_5aaf428e921a02f0(__context__,2) == 2));
+	DAS_VERIFY((gotoN_5aaf428e921a02f0(__context__,3) == -1));
+}
+
+inline void basic_goto_c53412c1d5c1da46 ( Context * __context__ )
+{
+	TDim<int32_t,10> __arr_rename_at_4; das_zero(__arr_rename_at_4);
+	int32_t __i_rename_at_5 = 0;
+	label_0:;;
+	das_copy(__arr_rename_at_4(__i_rename_at_5,__context__),__i_rename_at_5);
+	__i_rename_at_5++;
+	if ( __i_rename_at_5 < 10 )
+	{
+		goto label_0;
+	};
+	{
+		bool __need_loop_13 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_13;
+		__need_loop_13 = __t_iterator.first(__context__,(__t_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __t_iterator.next(__context__,(__t_rename_at_13)) )
+		{
+			DAS_ASSERT((__arr_rename_at_4(__t_rename_at_13,__context__) == __t_rename_at_13));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_13));
+	};
+}
+
+inline void finally_goto_a61824921d9db89f ( Context * __context__, bool __yes_rename_at_74 )
+{
+	bool __fail_rename_at_75 = true;
+	if ( __yes_rename_at_74 )
+	{
+	/* finally */ auto __finally_77= das_finally([&](){
+		das_copy(__fail_rename_at_75,false);
+	/* end finally */ });
+		das_copy(__fail_rename_at_75,true);
+		goto label_0;
+	};
+	label_0:;;
+	DAS_ASSERT((!__fail_rename_at_75));
+}
+
+inline void for_goto_4e898d372c4980d1 ( Context * __context__ )
+{
+	TDim<int32_t,10> __arr_rename_at_36; das_zero(__arr_rename_at_36);
+	{
+		bool __need_loop_37 = true;
+		// j : int const
+		das_iterator<range> __j_iterator(range(0,10));
+		int32_t __j_rename_at_37;
+		__need_loop_37 = __j_iterator.first(__context__,(__j_rename_at_37)) && __need_loop_37;
+		for ( ; __need_loop_37 ; __need_loop_37 = __j_iterator.next(__context__,(__j_rename_at_37)) )
+		{
+			int32_t __i_rename_at_38 = 0;
+			label_0:;;
+			das_copy(__arr_rename_at_36(__i_rename_at_38,__context__),__i_rename_at_38 + __j_rename_at_37);
+			__i_rename_at_38++;
+			if ( __i_rename_at_38 < 10 )
+			{
+				goto label_0;
+			};
+			{
+				bool __need_loop_45 = true;
+				// t : int const
+				das_iterator<range> __t_iterator(range(0,10));
+				int32_t __t_rename_at_45;
+				__need_loop_45 = __t_iterator.first(__context__,(__t_rename_at_45)) && __need_loop_45;
+				for ( ; __need_loop_45 ; __need_loop_45 = __t_iterator.next(__context__,(__t_rename_at_45)) )
+				{
+					DAS_ASSERT((__arr_rename_at_36(__t_rename_at_45,__context__) == (__t_rename_at_45 + __j_rename_at_37)));
+				}
+				__t_iterator.close(__context__,(__t_rename_at_45));
+			};
+		}
+		__j_iterator.close(__context__,(__j_rename_at_37));
+	};
+	{
+		bool __need_loop_48 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_48;
+		__need_loop_48 = __t_iterator.first(__context__,(__t_rename_at_48)) && __need_loop_48;
+		for ( ; __need_loop_48 ; __need_loop_48 = __t_iterator.next(__context__,(__t_rename_at_48)) )
+		{
+			DAS_ASSERT((__arr_rename_at_36(__t_rename_at_48,__context__) == (__t_rename_at_48 + 9)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_48));
+	};
+}
+
+inline int32_t gotoN_5aaf428e921a02f0 ( Context * __context__, int32_t __n_rename_at_85 )
+{
+	int32_t __res_rename_at_86 = -1;
+	switch (__n_rename_at_85) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(__res_rename_at_86,0);
+	goto label_3;
+	label_1:;;
+	das_copy(__res_rename_at_86,1);
+	goto label_3;
+	label_2:;;
+	das_copy(__res_rename_at_86,2);
+	goto label_3;
+	label_3:;;
+	return __res_rename_at_86;
+}
+
+inline void nested_goto_17a353e24f434d61 ( Context * __context__ )
+{
+	bool __fail_rename_at_19 = false;
+	TDim<int32_t,10> __arr_rename_at_20; das_zero(__arr_rename_at_20);
+	int32_t __i_rename_at_21 = 0;
+	label_0:;;
+	das_copy(__arr_rename_at_20(__i_rename_at_21,__context__),__i_rename_at_21);
+	__i_rename_at_21++;
+	if ( __i_rename_at_21 < 10 )
+	{
+		if ( __i_rename_at_21 < 10 )
+		{
+			goto label_0;
+		};
+		das_copy(__fail_rename_at_19,true);
+	};
+	{
+		bool __need_loop_30 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_30;
+		__need_loop_30 = __t_iterator.first(__context__,(__t_rename_at_30)) && __need_loop_30;
+		for ( ; __need_loop_30 ; __need_loop_30 = __t_iterator.next(__context__,(__t_rename_at_30)) )
+		{
+			DAS_ASSERT((__arr_rename_at_20(__t_rename_at_30,__context__) == __t_rename_at_30));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_30));
+	};
+}
+
+inline bool test_cfc5e34a946b176c ( Context * __context__ )
+{
+	basic_goto_c53412c1d5c1da46(__context__);
+	nested_goto_17a353e24f434d61(__context__);
+	for_goto_4e898d372c4980d1(__context__);
+	while_goto_2920c5a45d1b63f3(__context__);
+	finally_goto_a61824921d9db89f(__context__,true);
+	N_goto_560dcbef5d9f8e02(__context__);
+	return true;
+}
+
+inline void while_goto_2920c5a45d1b63f3 ( Context * __context__ )
+{
+	TDim<int32_t,10> __arr_rename_at_55; das_zero(__arr_rename_at_55);
+	int32_t __j_rename_at_56 = 0;
+	while ( __j_rename_at_56 < 10 )
+	{
+		int32_t __i_rename_at_58 = 0;
+		label_0:;;
+		das_copy(__arr_rename_at_55(__i_rename_at_58,__context__),__i_rename_at_58 + __j_rename_at_56);
+		__i_rename_at_58++;
+		if ( __i_rename_at_58 < 10 )
+		{
+			goto label_0;
+		};
+		{
+			bool __need_loop_65 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(range(0,10));
+			int32_t __t_rename_at_65;
+			__need_loop_65 = __t_iterator.first(__context__,(__t_rename_at_65)) && __need_loop_65;
+			for ( ; __need_loop_65 ; __need_loop_65 = __t_iterator.next(__context__,(__t_rename_at_65)) )
+			{
+				DAS_ASSERT((__arr_rename_at_55(__t_rename_at_65,__context__) == (__t_rename_at_65 + __j_rename_at_56)));
+			}
+			__t_iterator.close(__context__,(__t_rename_at_65));
+		};
+		__j_rename_at_56++;
+	};
+	{
+		bool __need_loop_69 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_69;
+		__need_loop_69 = __t_iterator.first(__context__,(__t_rename_at_69)) && __need_loop_69;
+		for ( ; __need_loop_69 ; __need_loop_69 = __t_iterator.next(__context__,(__t_rename_at_69)) )
+		{
+			DAS_ASSERT((__arr_rename_at_55(__t_rename_at_69,__context__) == (__t_rename_at_69 + 9)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_69));
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// N_goto_560dcbef5d9f8e02
+		aotLib[0x54a33965290ba99e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&N_goto_560dcbef5d9f8e02>>();
+	};
+		// basic_goto_c53412c1d5c1da46
+		aotLib[0x2d779299d6bf87dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&basic_goto_c53412c1d5c1da46>>();
+	};
+		// finally_goto_a61824921d9db89f
+		aotLib[0x645b540fb6db517d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, bool  ),&finally_goto_a61824921d9db89f>>();
+	};
+		// for_goto_4e898d372c4980d1
+		aotLib[0x2930a485078fc711] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&for_goto_4e898d372c4980d1>>();
+	};
+		// gotoN_5aaf428e921a02f0
+		aotLib[0x9af4f5267f8fd865] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&gotoN_5aaf428e921a02f0>>();
+	};
+		// nested_goto_17a353e24f434d61
+		aotLib[0x19493c9e6c8a9819] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&nested_goto_17a353e24f434d61>>();
+	};
+		// test_cfc5e34a946b176c
+		aotLib[0x3d352cd19297a8e0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_cfc5e34a946b176c>>();
+	};
+		// while_goto_2920c5a45d1b63f3
+		aotLib[0x50addcf857b0f5e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&while_goto_2920c5a45d1b63f3>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,368 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__a7060cfc;
+extern StructInfo __struct_info__ce1d9ad4;
+extern StructInfo __struct_info__65915410;
+extern TypeInfo __type_info__35ccc200;
+extern TypeInfo __type_info__94181030;
+extern TypeInfo __type_info__d445a339;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__ae0ed984;
+extern TypeInfo __type_info__199df2db;
+extern TypeInfo __type_info__91274818;
+extern TypeInfo __type_info__6df64f74;
+extern TypeInfo __type_info__6cd11a6c;
+extern TypeInfo __type_info__df885d84;
+extern VarInfo __var_info__51a62f80;
+extern VarInfo __var_info__717b6f3;
+extern VarInfo __var_info__fb0db7ed;
+extern VarInfo __var_info__5d5e9011;
+extern VarInfo __var_info__6d8880b;
+extern VarInfo __var_info__707bc254;
+extern VarInfo __var_info__fc8f3eef;
+extern VarInfo __var_info__35e912f2;
+extern FuncInfo __func_info__63f35a93;
+
+TypeInfo * __type_info__fb0db7ed_arg_types_var_2802191612[2] = { &__type_info__6cd11a6c, &__type_info__359c1b32 };
+VarInfo __struct_info__a7060cfc_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__fb0db7ed_arg_types_var_2802191612, nullptr, 2, 0, nullptr, 28, 0xfb0db7ed, "__lambda", 0 };
+TypeInfo * __type_info__707bc254_arg_types_var_2802191612[1] = { &__type_info__df885d84 };
+VarInfo __struct_info__a7060cfc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__707bc254_arg_types_var_2802191612, nullptr, 1, 0, nullptr, 28, 0x707bc254, "__finalize", 4 };
+VarInfo __struct_info__a7060cfc_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x6d8880b, "CNT", 8 };
+VarInfo * __struct_info__a7060cfc_fields[3] =  { &__struct_info__a7060cfc_field_0, &__struct_info__a7060cfc_field_1, &__struct_info__a7060cfc_field_2 };
+StructInfo __struct_info__a7060cfc = {"_lambda_thismodule_32_8_2", __struct_info__a7060cfc_fields, 3, 12, -1, nullptr, 0xa7060cfc };
+TypeInfo * __type_info__717b6f3_arg_types_var_3458046676[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__ce1d9ad4_field_0 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__717b6f3_arg_types_var_3458046676, nullptr, 1, 0, nullptr, 0, 0x717b6f3, "cnt", 0 };
+VarInfo * __struct_info__ce1d9ad4_fields[1] =  { &__struct_info__ce1d9ad4_field_0 };
+StructInfo __struct_info__ce1d9ad4 = {"Message", __struct_info__ce1d9ad4_fields, 1, 8, -1, nullptr, 0xce1d9ad4 };
+TypeInfo * __type_info__5d5e9011_arg_types_var_1704023056[2] = { &__type_info__35ccc200, &__type_info__359c1b32 };
+VarInfo __struct_info__65915410_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__5d5e9011_arg_types_var_1704023056, nullptr, 2, 0, nullptr, 28, 0x5d5e9011, "__lambda", 0 };
+TypeInfo * __type_info__51a62f80_arg_types_var_1704023056[1] = { &__type_info__91274818 };
+VarInfo __struct_info__65915410_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__51a62f80_arg_types_var_1704023056, nullptr, 1, 0, nullptr, 28, 0x51a62f80, "__finalize", 4 };
+VarInfo __struct_info__65915410_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xfc8f3eef, "a", 8 };
+VarInfo * __struct_info__65915410_fields[3] =  { &__struct_info__65915410_field_0, &__struct_info__65915410_field_1, &__struct_info__65915410_field_2 };
+StructInfo __struct_info__65915410 = {"_lambda_thismodule_26_8_1", __struct_info__65915410_fields, 3, 12, -1, nullptr, 0x65915410 };
+VarInfo __func_info__63f35a93_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x35e912f2, "data", 0 };
+VarInfo * __func_info__63f35a93_fields[1] =  { &__func_info__63f35a93_field_0 };
+FuncInfo __func_info__63f35a93 = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__63f35a93_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x63f35a93, 0x0 };
+TypeInfo __type_info__35ccc200 = { Type::tStructure, &__struct_info__65915410, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x35ccc200 };
+TypeInfo __type_info__94181030 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x94181030 };
+TypeInfo * __type_info__d445a339_arg_types[1] = { &__type_info__94181030 };
+TypeInfo __type_info__d445a339 = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d445a339_arg_types, nullptr, 1, 0, nullptr, 34, 0xd445a339 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__ae0ed984 = { Type::tStructure, &__struct_info__ce1d9ad4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xae0ed984 };
+TypeInfo __type_info__199df2db = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x199df2db };
+TypeInfo __type_info__91274818 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__35ccc200, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x91274818 };
+TypeInfo __type_info__6df64f74 = { Type::tStructure, &__struct_info__ce1d9ad4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x6df64f74 };
+TypeInfo __type_info__6cd11a6c = { Type::tStructure, &__struct_info__a7060cfc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x6cd11a6c };
+TypeInfo __type_info__df885d84 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6cd11a6c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xdf885d84 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__ae0ed984, &__type_info__94181030 };
+TypeInfo * __tinfo_1[2] = { &__type_info__6df64f74, &__type_info__d445a339 };
+namespace  {
+
+struct Message {
+	Lambda DAS_COMMENT((int32_t,int32_t)) cnt;
+};
+static_assert(sizeof(Message)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Message,cnt)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_26_8_1 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_26_8_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_26_8_1 *)) __finalize;
+	int32_t a;
+};
+static_assert(sizeof(_lambda_thismodule_26_8_1)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_26_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_26_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_26_8_1,a)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_8_2 {
+	Func DAS_COMMENT((int32_t,struct _lambda_thismodule_32_8_2,int32_t)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_32_8_2 *)) __finalize;
+	int32_t CNT;
+};
+static_assert(sizeof(_lambda_thismodule_32_8_2)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_8_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_8_2,CNT)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_26_8_1_0x60_finazlier_6f9c9fafc6c720e6 ( Context * __context__, struct _lambda_thismodule_26_8_1 * ____this_rename_at_26 );
+inline int32_t _Func_lambda_thismodule_26_8_1_0x60_function_4d135ca925388df9 ( Context * __context__, struct _lambda_thismodule_26_8_1 & ____this_rename_at_26, int32_t __b_rename_at_25 );
+inline void _Func_lambda_thismodule_32_8_2_0x60_finazlier_b0d5cce5932d7e8a ( Context * __context__, struct _lambda_thismodule_32_8_2 * ____this_rename_at_32 );
+inline int32_t _Func_lambda_thismodule_32_8_2_0x60_function_e689891c043f44e7 ( Context * __context__, struct _lambda_thismodule_32_8_2 & ____this_rename_at_32, int32_t __extra_rename_at_31 );
+inline Lambda DAS_COMMENT((int32_t,int32_t)) addX_b203e44426a926a4 ( Context * __context__, int32_t __a_rename_at_24 );
+inline void _Funcbuiltin_0x60_binary_load_518db28af2c7362a ( Context * __context__, struct Message & __obj_rename_at_216, TArray<uint8_t> const  & __data_rename_at_216 );
+inline void _Funcbuiltin_0x60_binary_save_a5df83e9dc7c73b3 ( Context * __context__, struct Message const  & __obj_rename_at_212, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_212 );
+inline void _Funcbuiltin_0x60_clone_d4db30f28ea65784 ( Context * __context__, TArray<uint8_t> & __a_rename_at_232, TArray<uint8_t> const  & __b_rename_at_232 );
+inline void _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void finalize_8008b475dfba310 ( Context * __context__, struct _lambda_thismodule_26_8_1 & ____this_rename_at_26 );
+inline void finalize_d5789d32d64500 ( Context * __context__, struct _lambda_thismodule_32_8_2 & ____this_rename_at_32 );
+inline void onlyNull_6bbacb7b54f5e4d0 ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) const  __bar_rename_at_20 );
+inline Lambda DAS_COMMENT((int32_t,int32_t)) recv_4d59cff4e9ed04bf ( Context * __context__ );
+inline void send_5e1ce517b6abc545 ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) __t_rename_at_9 );
+inline bool test_4c499c2d46df2eb2 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TArray<uint8_t>,0>(__context__);/*network*/
+}
+
+inline void _Func_lambda_thismodule_26_8_1_0x60_finazlier_6f9c9fafc6c720e6 ( Context * __context__, struct _lambda_thismodule_26_8_1 * ____this_rename_at_26 )
+{
+	finalize_8008b475dfba310(__context__,das_arg<struct _lambda_thismodule_26_8_1>::pass(das_deref(__context__,____this_rename_at_26)));
+	das_delete_lambda_struct<struct _lambda_thismodule_26_8_1 *>::clear(__context__,____this_rename_at_26);
+}
+
+inline int32_t _Func_lambda_thismodule_26_8_1_0x60_function_4d135ca925388df9 ( Context * __context__, struct _lambda_thismodule_26_8_1 &  ____this_rename_at_26, int32_t __b_rename_at_25 )
+{
+	return ____this_rename_at_26.a + __b_rename_at_25;
+}
+
+inline void _Func_lambda_thismodule_32_8_2_0x60_finazlier_b0d5cce5932d7e8a ( Context * __context__, struct _lambda_thismodule_32_8_2 * ____this_rename_at_32 )
+{
+	finalize_d5789d32d64500(__context__,das_arg<struct _lambda_thismodule_32_8_2>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<struct _lambda_thismodule_32_8_2 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline int32_t _Func_lambda_thismodule_32_8_2_0x60_function_e689891c043f44e7 ( Context * __context__, struct _lambda_thismodule_32_8_2 &  ____this_rename_at_32, int32_t __extra_rename_at_31 )
+{
+	return (____this_rename_at_32.CNT++) + __extra_rename_at_31;
+}
+
+inline Lambda DAS_COMMENT((int32_t,int32_t)) addX_b203e44426a926a4 ( Context * __context__, int32_t __a_rename_at_24 )
+{
+	return das_ascend<int32_t,struct _lambda_thismodule_26_8_1>::make(__context__,&__type_info__35ccc200,(([&]() -> struct _lambda_thismodule_26_8_1 {
+		struct _lambda_thismodule_26_8_1 __mks_26;
+		das_copy((__mks_26.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_26_8_1`function _lambda_thismodule_26_8_1 int#const*/ 387353458u))));
+		das_copy((__mks_26.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_26_8_1`finazlier #ptr#_lambda_thismodule_26_8_1#explicit*/ 27444088u))));
+		das_copy((__mks_26.a),(__a_rename_at_24));
+		return __mks_26;
+	})()));
+}
+
+inline void _Funcbuiltin_0x60_binary_load_518db28af2c7362a ( Context * __context__, struct Message &  __obj_rename_at_216, TArray<uint8_t> const  &  __data_rename_at_216 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<struct Message &>::from(__obj_rename_at_216),cast<TArray<uint8_t> const  &>::from(__data_rename_at_216)));
+}
+
+inline void _Funcbuiltin_0x60_binary_save_a5df83e9dc7c73b3 ( Context * __context__, struct Message const  &  __obj_rename_at_212, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_212 )
+{
+	das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<struct Message const  &>::from(__obj_rename_at_212),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_212)));
+}
+
+inline void _Funcbuiltin_0x60_clone_d4db30f28ea65784 ( Context * __context__, TArray<uint8_t> &  __a_rename_at_232, TArray<uint8_t> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d(__context__,das_arg<TArray<uint8_t>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : uint8 aka TT&
+		das_iterator<TArray<uint8_t>> __aV_iterator(__a_rename_at_232);
+		uint8_t * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : uint8 const&
+		das_iterator<TArray<uint8_t> const > __bV_iterator(__b_rename_at_232);
+		uint8_t const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			das_copy((*__aV_rename_at_234),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,1,__context__);
+}
+
+inline void finalize_8008b475dfba310 ( Context * __context__, struct _lambda_thismodule_26_8_1 &  ____this_rename_at_26 )
+{
+	memset(&(____this_rename_at_26), 0, 12);
+}
+
+inline void finalize_d5789d32d64500 ( Context * __context__, struct _lambda_thismodule_32_8_2 &  ____this_rename_at_32 )
+{
+	memset(&(____this_rename_at_32), 0, 12);
+}
+
+inline void onlyNull_6bbacb7b54f5e4d0 ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) const  __bar_rename_at_20 )
+{
+	if ( __bar_rename_at_20 != nullptr )
+	{
+		DAS_ASSERTF((false),(((char *) "has to be null")));
+	};
+}
+
+inline Lambda DAS_COMMENT((int32_t,int32_t)) recv_4d59cff4e9ed04bf ( Context * __context__ )
+{
+	struct Message __t_rename_at_15; das_zero(__t_rename_at_15);
+	_Funcbuiltin_0x60_binary_load_518db28af2c7362a(__context__,das_arg<struct Message>::pass(__t_rename_at_15),das_arg<TArray<uint8_t>>::pass(das_global<TArray<uint8_t>,0>(__context__) /*network*/));
+	return /* <- */ __t_rename_at_15.cnt;
+}
+
+inline void send_5e1ce517b6abc545 ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) __t_rename_at_9 ) { das_stack_prologue __prologue(__context__,112,"send " DAS_FILE_LINE);
+{
+	struct Message __msg_rename_at_10; das_zero(__msg_rename_at_10); das_move(__msg_rename_at_10, (([&]() -> struct Message {
+		struct Message __mks_10;
+		das_move((__mks_10.cnt),(__t_rename_at_9));
+		return __mks_10;
+	})()));
+	_Funcbuiltin_0x60_binary_save_a5df83e9dc7c73b3(__context__,das_arg<struct Message>::pass(__msg_rename_at_10),das_make_block<void,TArray<uint8_t> const  &>(__context__,96,0,&__func_info__63f35a93,[&](TArray<uint8_t> const  & __data_rename_at_11)->void{
+		_Funcbuiltin_0x60_clone_d4db30f28ea65784(__context__,das_arg<TArray<uint8_t>>::pass(das_global<TArray<uint8_t>,0>(__context__) /*network*/),__data_rename_at_11);
+	}));
+}}
+
+inline bool test_4c499c2d46df2eb2 ( Context * __context__ )
+{
+	int32_t __CNT_rename_at_30 = 0;
+	Lambda DAS_COMMENT((int32_t,int32_t)) __counter_rename_at_31; das_zero(__counter_rename_at_31); das_move(__counter_rename_at_31, (Lambda DAS_COMMENT((int32_t,int32_t)))das_ascend<int32_t,struct _lambda_thismodule_32_8_2>::make(__context__,&__type_info__6cd11a6c,(([&]() -> struct _lambda_thismodule_32_8_2 {
+		struct _lambda_thismodule_32_8_2 __mks_32;
+		das_copy((__mks_32.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_8_2`function _lambda_thismodule_32_8_2 int#const*/ 1641490950u))));
+		das_copy((__mks_32.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_8_2`finazlier #ptr#_lambda_thismodule_32_8_2#explicit*/ 2437416444u))));
+		das_copy((__mks_32.CNT),(__CNT_rename_at_30));
+		return __mks_32;
+	})())));
+	int32_t __x_rename_at_33 = das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,__counter_rename_at_31,13);
+	das_copy(__CNT_rename_at_30,100500);
+	int32_t __y_rename_at_35 = (int32_t)das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,__counter_rename_at_31,13);
+	DAS_ASSERT(((__x_rename_at_33 == 13) && (__y_rename_at_35 == 14)));
+	send_5e1ce517b6abc545(__context__,__counter_rename_at_31);
+	Lambda DAS_COMMENT((int32_t,int32_t)) __net_counter_rename_at_38; das_zero(__net_counter_rename_at_38); das_move(__net_counter_rename_at_38, (Lambda DAS_COMMENT((int32_t,int32_t)))recv_4d59cff4e9ed04bf(__context__));
+	int32_t __z_rename_at_39 = (int32_t)das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,__net_counter_rename_at_38,13);
+	DAS_ASSERT((__z_rename_at_39 == 15));
+	das_copy(__x_rename_at_33,das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,__counter_rename_at_31,13));
+	DAS_ASSERT((__x_rename_at_33 == 15));
+	Lambda DAS_COMMENT((int32_t,int32_t)) __l_rename_at_43; das_zero(__l_rename_at_43);
+	onlyNull_6bbacb7b54f5e4d0(__context__,__l_rename_at_43);
+	Lambda DAS_COMMENT((int32_t,int32_t)) __t_rename_at_45; das_zero(__t_rename_at_45); das_move(__t_rename_at_45, (Lambda DAS_COMMENT((int32_t,int32_t)))addX_b203e44426a926a4(__context__,1));
+	int32_t __q_rename_at_46 = (int32_t)das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,__t_rename_at_45,2);
+	DAS_ASSERT((__q_rename_at_46 == 3));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_26_8_1_0x60_finazlier_6f9c9fafc6c720e6
+		aotLib[0x91235eb69ae79d82] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_26_8_1 *  ),&_Func_lambda_thismodule_26_8_1_0x60_finazlier_6f9c9fafc6c720e6>>();
+	};
+		// _Func_lambda_thismodule_26_8_1_0x60_function_4d135ca925388df9
+		aotLib[0xed05385f677a860d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_26_8_1 & , int32_t  ),&_Func_lambda_thismodule_26_8_1_0x60_function_4d135ca925388df9>>();
+	};
+		// _Func_lambda_thismodule_32_8_2_0x60_finazlier_b0d5cce5932d7e8a
+		aotLib[0xe78887e809a1bd46] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_32_8_2 *  ),&_Func_lambda_thismodule_32_8_2_0x60_finazlier_b0d5cce5932d7e8a>>();
+	};
+		// _Func_lambda_thismodule_32_8_2_0x60_function_e689891c043f44e7
+		aotLib[0x83400a214691bf7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct _lambda_thismodule_32_8_2 & , int32_t  ),&_Func_lambda_thismodule_32_8_2_0x60_function_e689891c043f44e7>>();
+	};
+		// addX_b203e44426a926a4
+		aotLib[0xa08d1bb247d285ee] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Lambda DAS_COMMENT((int32_t,int32_t)) (*) ( Context * __context__, int32_t  ),&addX_b203e44426a926a4>>();
+	};
+		// _Funcbuiltin_0x60_binary_load_518db28af2c7362a
+		aotLib[0x547340a6b57f88f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Message & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_518db28af2c7362a>>();
+	};
+		// _Funcbuiltin_0x60_binary_save_a5df83e9dc7c73b3
+		aotLib[0xa0fa494992291579] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Message const  & , Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  ),&_Funcbuiltin_0x60_binary_save_a5df83e9dc7c73b3>>();
+	};
+		// _Funcbuiltin_0x60_clone_d4db30f28ea65784
+		aotLib[0x865fd5255de1e42f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_clone_d4db30f28ea65784>>();
+	};
+		// _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d
+		aotLib[0xd467d57646ae4a91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d>>();
+	};
+		// finalize_8008b475dfba310
+		aotLib[0x528d6cd34c896835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_26_8_1 &  ),&finalize_8008b475dfba310>>();
+	};
+		// finalize_d5789d32d64500
+		aotLib[0xaa3f8406ee64769] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_32_8_2 &  ),&finalize_d5789d32d64500>>();
+	};
+		// onlyNull_6bbacb7b54f5e4d0
+		aotLib[0x3652abad4d521d95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) const   ),&onlyNull_6bbacb7b54f5e4d0>>();
+	};
+		// recv_4d59cff4e9ed04bf
+		aotLib[0x4786ed940acee112] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Lambda DAS_COMMENT((int32_t,int32_t)) (*) ( Context * __context__ ),&recv_4d59cff4e9ed04bf>>();
+	};
+		// send_5e1ce517b6abc545
+		aotLib[0xa4bfdb635453155] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t))  ),&send_5e1ce517b6abc545>>();
+	};
+		// test_4c499c2d46df2eb2
+		aotLib[0xa7ed0e81aba004e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_4c499c2d46df2eb2>>();
+	};
+		// [[ init script ]]
+		aotLib[0x42ab87f80fae6a4f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,384 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern StructInfo __struct_info__3f00200e;
+extern StructInfo __struct_info__52c5e609;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__260b3481;
+extern TypeInfo __type_info__85c25ffe;
+extern TypeInfo __type_info__7db7c5c6;
+extern TypeInfo __type_info__c7e1677;
+extern TypeInfo __type_info__ba496f9;
+extern TypeInfo __type_info__3ac84c61;
+extern VarInfo __var_info__74c4ac69;
+extern VarInfo __var_info__ea8cde2b;
+extern VarInfo __var_info__677b177b;
+extern VarInfo __var_info__b1d8619d;
+extern VarInfo __var_info__80af3d87;
+extern VarInfo __var_info__319ce2c4;
+extern VarInfo __var_info__aed85ce4;
+extern VarInfo __var_info__73c4aad6;
+extern VarInfo __var_info__71c4a7b0;
+extern VarInfo __var_info__3275c20a;
+extern VarInfo __var_info__7f5e3102;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x677b177b, "dummy", 0 };
+VarInfo * __struct_info__b1589007_fields[1] =  { &__struct_info__b1589007_field_0 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 1, 4, -1, nullptr, 0xb1589007 };
+TypeInfo * __type_info__ea8cde2b_arg_types_var_1056972814[1] = { &__type_info__85c25ffe };
+VarInfo __struct_info__3f00200e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ea8cde2b_arg_types_var_1056972814, nullptr, 1, 0, nullptr, 28, 0xea8cde2b, "__lambda", 0 };
+TypeInfo * __type_info__3275c20a_arg_types_var_1056972814[1] = { &__type_info__7db7c5c6 };
+VarInfo __struct_info__3f00200e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3275c20a_arg_types_var_1056972814, nullptr, 1, 0, nullptr, 28, 0x3275c20a, "__finalize", 4 };
+VarInfo __struct_info__3f00200e_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x71c4a7b0, "a1", 8 };
+VarInfo __struct_info__3f00200e_field_3 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x74c4ac69, "a2", 16 };
+VarInfo __struct_info__3f00200e_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x73c4aad6, "a3", 40 };
+VarInfo * __struct_info__3f00200e_fields[5] =  { &__struct_info__3f00200e_field_0, &__struct_info__3f00200e_field_1, &__struct_info__3f00200e_field_2, &__struct_info__3f00200e_field_3, &__struct_info__3f00200e_field_4 };
+StructInfo __struct_info__3f00200e = {"_lambda_thismodule_33_3_2", __struct_info__3f00200e_fields, 5, 64, -1, nullptr, 0x3f00200e };
+TypeInfo * __type_info__7f5e3102_arg_types_var_1388701193[1] = { &__type_info__ba496f9 };
+VarInfo __struct_info__52c5e609_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7f5e3102_arg_types_var_1388701193, nullptr, 1, 0, nullptr, 28, 0x7f5e3102, "__lambda", 0 };
+TypeInfo * __type_info__80af3d87_arg_types_var_1388701193[1] = { &__type_info__3ac84c61 };
+VarInfo __struct_info__52c5e609_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__80af3d87_arg_types_var_1388701193, nullptr, 1, 0, nullptr, 28, 0x80af3d87, "__finalize", 4 };
+VarInfo __struct_info__52c5e609_field_2 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2078, 0x319ce2c4, "C", 8 };
+VarInfo __struct_info__52c5e609_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c7e1677, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xaed85ce4, "pA", 16 };
+VarInfo __struct_info__52c5e609_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c7e1677, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb1d8619d, "pB", 24 };
+VarInfo * __struct_info__52c5e609_fields[5] =  { &__struct_info__52c5e609_field_0, &__struct_info__52c5e609_field_1, &__struct_info__52c5e609_field_2, &__struct_info__52c5e609_field_3, &__struct_info__52c5e609_field_4 };
+StructInfo __struct_info__52c5e609 = {"_lambda_thismodule_16_2_1", __struct_info__52c5e609_fields, 5, 32, -1, nullptr, 0x52c5e609 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__260b3481 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x260b3481 };
+TypeInfo __type_info__85c25ffe = { Type::tStructure, &__struct_info__3f00200e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x85c25ffe };
+TypeInfo __type_info__7db7c5c6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__85c25ffe, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7db7c5c6 };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2078, 0xc7e1677 };
+TypeInfo __type_info__ba496f9 = { Type::tStructure, &__struct_info__52c5e609, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xba496f9 };
+TypeInfo __type_info__3ac84c61 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ba496f9, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3ac84c61 };
+
+namespace  {
+
+struct Foo {
+	int32_t dummy;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,dummy)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_16_2_1 {
+	Func DAS_COMMENT((void,struct _lambda_thismodule_16_2_1)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_16_2_1 *)) __finalize;
+	struct Foo C;
+	struct Foo * pA;
+	struct Foo * pB;
+};
+static_assert(sizeof(_lambda_thismodule_16_2_1)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,C)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,pA)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,pB)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_33_3_2 {
+	Func DAS_COMMENT((void,struct _lambda_thismodule_33_3_2)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_33_3_2 *)) __finalize;
+	TArray<int32_t> * a1;
+	TArray<int32_t> a2;
+	TArray<int32_t> a3;
+};
+static_assert(sizeof(_lambda_thismodule_33_3_2)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,a1)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,a2)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,a3)==40,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_16_2_1_0x60_finazlier_1afb07aa827403de ( Context * __context__, struct _lambda_thismodule_16_2_1 * ____this_rename_at_16 );
+inline void _Func_lambda_thismodule_16_2_1_0x60_function_2036bde8df4817e0 ( Context * __context__, struct _lambda_thismodule_16_2_1 & ____this_rename_at_16 );
+inline void _Func_lambda_thismodule_33_3_2_0x60_finazlier_ae97773dc216c626 ( Context * __context__, struct _lambda_thismodule_33_3_2 * ____this_rename_at_33 );
+inline void _Func_lambda_thismodule_33_3_2_0x60_function_c569a6917abe0e11 ( Context * __context__, struct _lambda_thismodule_33_3_2 & ____this_rename_at_33 );
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> & __a_rename_at_232, TArray<int32_t> const  & __b_rename_at_232 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_398 );
+inline void finalize_45e8d026d498d407 ( Context * __context__, struct Foo * & ____this_rename_at_12 );
+inline void finalize_6c0d77715dac2565 ( Context * __context__, struct Foo const  & __f_rename_at_7 );
+inline void finalize_a64413730822e2bd ( Context * __context__, struct _lambda_thismodule_16_2_1 & ____this_rename_at_16 );
+inline void finalize_e180b7d5465da232 ( Context * __context__, struct _lambda_thismodule_33_3_2 & ____this_rename_at_33 );
+inline bool test_a7a8b4e3c2708ce7 ( Context * __context__ );
+inline bool test_delete_3acbc8ce8c5ddab2 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0>(__context__) = 0;/*g_counter*/
+}
+
+inline void _Func_lambda_thismodule_16_2_1_0x60_finazlier_1afb07aa827403de ( Context * __context__, struct _lambda_thismodule_16_2_1 * ____this_rename_at_16 )
+{
+	finalize_a64413730822e2bd(__context__,das_arg<struct _lambda_thismodule_16_2_1>::pass(das_deref(__context__,____this_rename_at_16)));
+	das_delete_lambda_struct<struct _lambda_thismodule_16_2_1 *>::clear(__context__,____this_rename_at_16);
+}
+
+inline void _Func_lambda_thismodule_16_2_1_0x60_function_2036bde8df4817e0 ( Context * __context__, struct _lambda_thismodule_16_2_1 &  ____this_rename_at_16 )
+{
+	DAS_ASSERT((____this_rename_at_16.pA->dummy == 0));
+	DAS_ASSERT((____this_rename_at_16.pB->dummy == 0));
+	DAS_ASSERT((____this_rename_at_16.C.dummy == 0));
+}
+
+inline void _Func_lambda_thismodule_33_3_2_0x60_finazlier_ae97773dc216c626 ( Context * __context__, struct _lambda_thismodule_33_3_2 * ____this_rename_at_33 )
+{
+	finalize_e180b7d5465da232(__context__,das_arg<struct _lambda_thismodule_33_3_2>::pass(das_deref(__context__,____this_rename_at_33)));
+	das_delete_lambda_struct<struct _lambda_thismodule_33_3_2 *>::clear(__context__,____this_rename_at_33);
+}
+
+inline void _Func_lambda_thismodule_33_3_2_0x60_function_c569a6917abe0e11 ( Context * __context__, struct _lambda_thismodule_33_3_2 &  ____this_rename_at_33 )
+{
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_33.a1)),1,-1);
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_33.a2),1,-1);
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_33.a3),1,-1);
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> &  __a_rename_at_232, TArray<int32_t> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_232);
+		int32_t * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_232);
+		int32_t const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			das_copy((*__aV_rename_at_234),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_398 )
+{
+	TArray<int32_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_399),2);
+	das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline void finalize_45e8d026d498d407 ( Context * __context__, struct Foo * & ____this_rename_at_12 )
+{
+	if ( ____this_rename_at_12 != nullptr )
+	{
+		finalize_6c0d77715dac2565(__context__,das_arg<struct Foo>::pass(das_deref(__context__,____this_rename_at_12)));
+		das_delete<struct Foo *>::clear(__context__,____this_rename_at_12);
+		das_copy(____this_rename_at_12,nullptr);
+	};
+}
+
+inline void finalize_6c0d77715dac2565 ( Context * __context__, struct Foo const  &  __f_rename_at_7 )
+{
+	das_global<int32_t,0>(__context__) /*g_counter*/++;
+}
+
+inline void finalize_a64413730822e2bd ( Context * __context__, struct _lambda_thismodule_16_2_1 &  ____this_rename_at_16 )
+{
+	finalize_6c0d77715dac2565(__context__,das_arg<struct Foo>::pass(____this_rename_at_16.C));
+	finalize_45e8d026d498d407(__context__,____this_rename_at_16.pA);
+	memset(&(____this_rename_at_16), 0, 32);
+}
+
+inline void finalize_e180b7d5465da232 ( Context * __context__, struct _lambda_thismodule_33_3_2 &  ____this_rename_at_33 )
+{
+	memset(&(____this_rename_at_33), 0, 64);
+}
+
+inline bool test_a7a8b4e3c2708ce7 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,272,"test " DAS_FILE_LINE);
+{
+	TDim<int32_t,2> _temp_make_local_28_64;
+	TDim<int32_t,2> _temp_make_local_29_112;
+	TDim<int32_t,2> _temp_make_local_30_160;
+	TArray<int32_t> __a1_rename_at_28; das_zero(__a1_rename_at_28); das_move(__a1_rename_at_28, _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_28_64(0,__context__) = 1;
+		_temp_make_local_28_64(1,__context__) = 2;
+		return _temp_make_local_28_64;
+	})()))));
+	TArray<int32_t> __a2_rename_at_29; das_zero(__a2_rename_at_29); das_move(__a2_rename_at_29, _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_29_112(0,__context__) = 1;
+		_temp_make_local_29_112(1,__context__) = 2;
+		return _temp_make_local_29_112;
+	})()))));
+	TArray<int32_t> __a3_rename_at_30; das_zero(__a3_rename_at_30); das_move(__a3_rename_at_30, _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_30_160(0,__context__) = 1;
+		_temp_make_local_30_160(1,__context__) = 2;
+		return _temp_make_local_30_160;
+	})()))));
+	Lambda DAS_COMMENT((void)) __lam_rename_at_32; das_zero(__lam_rename_at_32); das_move(__lam_rename_at_32, das_ascend<void,struct _lambda_thismodule_33_3_2>::make(__context__,&__type_info__85c25ffe,(([&]() -> struct _lambda_thismodule_33_3_2 {
+		struct _lambda_thismodule_33_3_2 __mks_33;
+		das_zero(__mks_33);
+		das_copy((__mks_33.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_33_3_2`function _lambda_thismodule_33_3_2*/ 3389733095u))));
+		das_copy((__mks_33.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_33_3_2`finazlier #ptr#_lambda_thismodule_33_3_2#explicit*/ 3894301544u))));
+		das_copy((__mks_33.a1),(das_ref(__context__,__a1_rename_at_28)));
+		das_move((__mks_33.a2),(__a2_rename_at_29));
+		{
+			_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__mks_33.a3),das_arg<TArray<int32_t>>::pass(__a3_rename_at_30));
+		}		return __mks_33;
+	})())));
+	das_invoke_lambda<void>::invoke(__context__,__lam_rename_at_32);
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a1_rename_at_28)) == 3));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a2_rename_at_29)) == 0));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a3_rename_at_30)) == 2));
+	test_delete_3acbc8ce8c5ddab2(__context__);
+	return true;
+}}
+
+inline bool test_delete_3acbc8ce8c5ddab2 ( Context * __context__ )
+{
+	struct Foo * __pA_rename_at_12 = das_new<struct Foo>::make(__context__);
+	struct Foo * __pB_rename_at_13 = das_new<struct Foo>::make(__context__);
+	struct Foo __C_rename_at_14 = (([&]() -> struct Foo {
+		struct Foo __mks_14;
+		das_zero(__mks_14);
+		return __mks_14;
+	})());
+	Lambda DAS_COMMENT((void)) __lam_rename_at_15; das_zero(__lam_rename_at_15); das_move(__lam_rename_at_15, das_ascend<void,struct _lambda_thismodule_16_2_1>::make(__context__,&__type_info__ba496f9,(([&]() -> struct _lambda_thismodule_16_2_1 {
+		struct _lambda_thismodule_16_2_1 __mks_16;
+		das_copy((__mks_16.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_16_2_1`function _lambda_thismodule_16_2_1*/ 4251330029u))));
+		das_copy((__mks_16.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_16_2_1`finazlier #ptr#_lambda_thismodule_16_2_1#explicit*/ 1617685766u))));
+		das_copy((__mks_16.C),(__C_rename_at_14));
+		das_copy((__mks_16.pA),(__pA_rename_at_12));
+		das_move((__mks_16.pB),(__pB_rename_at_13));
+		return __mks_16;
+	})())));
+	DAS_ASSERT((__pB_rename_at_13 == nullptr));
+	das_invoke_lambda<void>::invoke(__context__,__lam_rename_at_15);
+	das_delete<Lambda DAS_COMMENT((void))>::clear(__context__,__lam_rename_at_15);
+	DAS_ASSERT((das_global<int32_t,0>(__context__) /*g_counter*/ == 2));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_16_2_1_0x60_finazlier_1afb07aa827403de
+		aotLib[0xb27b95b07859a8e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_16_2_1 *  ),&_Func_lambda_thismodule_16_2_1_0x60_finazlier_1afb07aa827403de>>();
+	};
+		// _Func_lambda_thismodule_16_2_1_0x60_function_2036bde8df4817e0
+		aotLib[0xd941d757c68f21d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_16_2_1 &  ),&_Func_lambda_thismodule_16_2_1_0x60_function_2036bde8df4817e0>>();
+	};
+		// _Func_lambda_thismodule_33_3_2_0x60_finazlier_ae97773dc216c626
+		aotLib[0xefac99460bab10cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_33_3_2 *  ),&_Func_lambda_thismodule_33_3_2_0x60_finazlier_ae97773dc216c626>>();
+	};
+		// _Func_lambda_thismodule_33_3_2_0x60_function_c569a6917abe0e11
+		aotLib[0x5d4ab54b30cd555a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_33_3_2 &  ),&_Func_lambda_thismodule_33_3_2_0x60_function_c569a6917abe0e11>>();
+	};
+		// _Funcbuiltin_0x60_clone_9217fda5fb53190b
+		aotLib[0xb00d3e185e494e59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_9217fda5fb53190b>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_2214fb125fb27d05
+		aotLib[0x838d3aac7cba9ead] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_2214fb125fb27d05>>();
+	};
+		// finalize_45e8d026d498d407
+		aotLib[0x6d042edaad4e9bc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo * &  ),&finalize_45e8d026d498d407>>();
+	};
+		// finalize_6c0d77715dac2565
+		aotLib[0x9d0437500f682445] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo const  &  ),&finalize_6c0d77715dac2565>>();
+	};
+		// finalize_a64413730822e2bd
+		aotLib[0xa4343078f5376f43] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_16_2_1 &  ),&finalize_a64413730822e2bd>>();
+	};
+		// finalize_e180b7d5465da232
+		aotLib[0xd400736e8c10585d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_33_3_2 &  ),&finalize_e180b7d5465da232>>();
+	};
+		// test_a7a8b4e3c2708ce7
+		aotLib[0x864c5184161ca723] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_a7a8b4e3c2708ce7>>();
+	};
+		// test_delete_3acbc8ce8c5ddab2
+		aotLib[0x299f452306064180] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_delete_3acbc8ce8c5ddab2>>();
+	};
+		// [[ init script ]]
+		aotLib[0xc2aa15b9183ab8b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,295 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern StructInfo __struct_info__2f4581a0;
+extern StructInfo __struct_info__16d5d505;
+extern TypeInfo __type_info__13712b35;
+extern TypeInfo __type_info__eb3dff50;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__2b229c6d;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__c7e1677;
+extern TypeInfo __type_info__56029b38;
+extern VarInfo __var_info__da9be76a;
+extern VarInfo __var_info__ee3caa90;
+extern VarInfo __var_info__fbfcc03b;
+extern VarInfo __var_info__cae287db;
+extern VarInfo __var_info__2607d43e;
+extern VarInfo __var_info__1657de01;
+extern VarInfo __var_info__3efae852;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xda9be76a, "value", 0 };
+VarInfo * __struct_info__b1589007_fields[1] =  { &__struct_info__b1589007_field_0 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 1, 4, -1, nullptr, 0xb1589007 };
+TypeInfo * __type_info__1657de01_arg_types_var_793084320[2] = { &__type_info__eb3dff50, &__type_info__c7e1677 };
+VarInfo __struct_info__2f4581a0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1657de01_arg_types_var_793084320, nullptr, 2, 0, nullptr, 28, 0x1657de01, "__lambda", 0 };
+TypeInfo * __type_info__ee3caa90_arg_types_var_793084320[1] = { &__type_info__56029b38 };
+VarInfo __struct_info__2f4581a0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ee3caa90_arg_types_var_793084320, nullptr, 1, 0, nullptr, 28, 0xee3caa90, "__finalize", 4 };
+VarInfo __struct_info__2f4581a0_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xcae287db, "count", 8 };
+VarInfo * __struct_info__2f4581a0_fields[3] =  { &__struct_info__2f4581a0_field_0, &__struct_info__2f4581a0_field_1, &__struct_info__2f4581a0_field_2 };
+StructInfo __struct_info__2f4581a0 = {"_lambda_thismodule_18_8_2", __struct_info__2f4581a0_fields, 3, 12, -1, nullptr, 0x2f4581a0 };
+TypeInfo * __type_info__2607d43e_arg_types_var_383112453[2] = { &__type_info__13712b35, &__type_info__e6eb6b88 };
+VarInfo __struct_info__16d5d505_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__2607d43e_arg_types_var_383112453, nullptr, 2, 0, nullptr, 28, 0x2607d43e, "__lambda", 0 };
+TypeInfo * __type_info__fbfcc03b_arg_types_var_383112453[1] = { &__type_info__2b229c6d };
+VarInfo __struct_info__16d5d505_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fbfcc03b_arg_types_var_383112453, nullptr, 1, 0, nullptr, 28, 0xfbfcc03b, "__finalize", 4 };
+VarInfo __struct_info__16d5d505_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x3efae852, "count", 8 };
+VarInfo * __struct_info__16d5d505_fields[3] =  { &__struct_info__16d5d505_field_0, &__struct_info__16d5d505_field_1, &__struct_info__16d5d505_field_2 };
+StructInfo __struct_info__16d5d505 = {"_lambda_thismodule_9_8_1", __struct_info__16d5d505_fields, 3, 12, -1, nullptr, 0x16d5d505 };
+TypeInfo __type_info__13712b35 = { Type::tStructure, &__struct_info__16d5d505, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x13712b35 };
+TypeInfo __type_info__eb3dff50 = { Type::tStructure, &__struct_info__2f4581a0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xeb3dff50 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0xe6eb6b88 };
+TypeInfo __type_info__2b229c6d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__13712b35, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2b229c6d };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2078, 0xc7e1677 };
+TypeInfo __type_info__56029b38 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__eb3dff50, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x56029b38 };
+
+namespace  {
+
+struct Foo {
+	int32_t value;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,value)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_8_1 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_9_8_1,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_9_8_1 *)) __finalize;
+	int32_t count;
+};
+static_assert(sizeof(_lambda_thismodule_9_8_1)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_8_1,count)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_18_8_2 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_18_8_2,struct Foo)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_18_8_2 *)) __finalize;
+	int32_t count;
+};
+static_assert(sizeof(_lambda_thismodule_18_8_2)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_8_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_8_2,count)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_18_8_2_0x60_finazlier_882fd9f8b2ca19f2 ( Context * __context__, struct _lambda_thismodule_18_8_2 * ____this_rename_at_18 );
+inline bool _Func_lambda_thismodule_18_8_2_0x60_function_b116b66e6e8787e9 ( Context * __context__, struct _lambda_thismodule_18_8_2 & ____this_rename_at_18, struct Foo & __a_rename_at_17 );
+inline void _Func_lambda_thismodule_9_8_1_0x60_finazlier_878613f94625c77e ( Context * __context__, struct _lambda_thismodule_9_8_1 * ____this_rename_at_9 );
+inline bool _Func_lambda_thismodule_9_8_1_0x60_function_307f45a04d16bc3 ( Context * __context__, struct _lambda_thismodule_9_8_1 & ____this_rename_at_9, int32_t & __a_rename_at_8 );
+inline Sequence DAS_COMMENT((struct Foo)) _Funcbuiltin_0x60_each_fa1c11aad54539b3 ( Context * __context__, Lambda DAS_COMMENT((bool,struct Foo)) const  __lam_rename_at_358 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_ec0a92925ebe3455 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 );
+inline void finalize_c813dc933f17c0ac ( Context * __context__, struct _lambda_thismodule_18_8_2 & ____this_rename_at_18 );
+inline void finalize_67f68cbc47a9525b ( Context * __context__, struct _lambda_thismodule_9_8_1 & ____this_rename_at_9 );
+inline bool test_62b3bf83d0377c1b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_18_8_2_0x60_finazlier_882fd9f8b2ca19f2 ( Context * __context__, struct _lambda_thismodule_18_8_2 * ____this_rename_at_18 )
+{
+	finalize_c813dc933f17c0ac(__context__,das_arg<struct _lambda_thismodule_18_8_2>::pass(das_deref(__context__,____this_rename_at_18)));
+	das_delete_lambda_struct<struct _lambda_thismodule_18_8_2 *>::clear(__context__,____this_rename_at_18);
+}
+
+inline bool _Func_lambda_thismodule_18_8_2_0x60_function_b116b66e6e8787e9 ( Context * __context__, struct _lambda_thismodule_18_8_2 &  ____this_rename_at_18, struct Foo &  __a_rename_at_17 )
+{
+	if ( ____this_rename_at_18.count < 10 )
+	{
+		das_copy(__a_rename_at_17.value,____this_rename_at_18.count++);
+		return true;
+	} else {
+		return false;
+	};
+}
+
+inline void _Func_lambda_thismodule_9_8_1_0x60_finazlier_878613f94625c77e ( Context * __context__, struct _lambda_thismodule_9_8_1 * ____this_rename_at_9 )
+{
+	finalize_67f68cbc47a9525b(__context__,das_arg<struct _lambda_thismodule_9_8_1>::pass(das_deref(__context__,____this_rename_at_9)));
+	das_delete_lambda_struct<struct _lambda_thismodule_9_8_1 *>::clear(__context__,____this_rename_at_9);
+}
+
+inline bool _Func_lambda_thismodule_9_8_1_0x60_function_307f45a04d16bc3 ( Context * __context__, struct _lambda_thismodule_9_8_1 &  ____this_rename_at_9, int32_t & __a_rename_at_8 )
+{
+	if ( ____this_rename_at_9.count < 10 )
+	{
+		das_copy(__a_rename_at_8,____this_rename_at_9.count++);
+		return true;
+	} else {
+		return false;
+	};
+}
+
+inline Sequence DAS_COMMENT((struct Foo)) _Funcbuiltin_0x60_each_fa1c11aad54539b3 ( Context * __context__, Lambda DAS_COMMENT((bool,struct Foo)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((struct Foo)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((struct Foo))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_ec0a92925ebe3455 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline void finalize_c813dc933f17c0ac ( Context * __context__, struct _lambda_thismodule_18_8_2 &  ____this_rename_at_18 )
+{
+	memset(&(____this_rename_at_18), 0, 12);
+}
+
+inline void finalize_67f68cbc47a9525b ( Context * __context__, struct _lambda_thismodule_9_8_1 &  ____this_rename_at_9 )
+{
+	memset(&(____this_rename_at_9), 0, 12);
+}
+
+inline bool test_62b3bf83d0377c1b ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_14_80;
+	Sequence DAS_COMMENT((struct Foo)) _temp_make_local_23_160;
+	int32_t __count_rename_at_7 = 0;
+	Lambda DAS_COMMENT((bool,int32_t &)) __lam_rename_at_8; das_zero(__lam_rename_at_8); das_move(__lam_rename_at_8, (Lambda DAS_COMMENT((bool,int32_t &)))das_ascend<bool,struct _lambda_thismodule_9_8_1>::make(__context__,&__type_info__13712b35,(([&]() -> struct _lambda_thismodule_9_8_1 {
+		struct _lambda_thismodule_9_8_1 __mks_9;
+		das_copy((__mks_9.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_8_1`function _lambda_thismodule_9_8_1 int#ref*/ 3134208454u))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_9_8_1`finazlier #ptr#_lambda_thismodule_9_8_1#explicit*/ 2284228334u))));
+		das_copy((__mks_9.count),(__count_rename_at_7));
+		return __mks_9;
+	})())));
+	{
+		bool __need_loop_14 = true;
+		// x : int
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator((_temp_make_local_14_80 = (_Funcbuiltin_0x60_each_ec0a92925ebe3455(__context__,__lam_rename_at_8))));
+		int32_t __x_rename_at_14;
+		__need_loop_14 = __x_iterator.first(__context__,(__x_rename_at_14)) && __need_loop_14;
+		// tx : int const
+		das_iterator<range> __tx_iterator(range(0,10));
+		int32_t __tx_rename_at_14;
+		__need_loop_14 = __tx_iterator.first(__context__,(__tx_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __x_iterator.next(__context__,(__x_rename_at_14)) && __tx_iterator.next(__context__,(__tx_rename_at_14)) )
+		{
+			DAS_ASSERT((__x_rename_at_14 == __tx_rename_at_14));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_14));
+		__tx_iterator.close(__context__,(__tx_rename_at_14));
+	};
+	Lambda DAS_COMMENT((bool,struct Foo)) __lamF_rename_at_17; das_zero(__lamF_rename_at_17); das_move(__lamF_rename_at_17, (Lambda DAS_COMMENT((bool,struct Foo)))das_ascend<bool,struct _lambda_thismodule_18_8_2>::make(__context__,&__type_info__eb3dff50,(([&]() -> struct _lambda_thismodule_18_8_2 {
+		struct _lambda_thismodule_18_8_2 __mks_18;
+		das_copy((__mks_18.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_18_8_2`function _lambda_thismodule_18_8_2 Foo*/ 3912965831u))));
+		das_copy((__mks_18.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_18_8_2`finazlier #ptr#_lambda_thismodule_18_8_2#explicit*/ 3118196632u))));
+		das_copy((__mks_18.count),(__count_rename_at_7));
+		return __mks_18;
+	})())));
+	{
+		bool __need_loop_23 = true;
+		// y : Foo
+		das_iterator<Sequence DAS_COMMENT((struct Foo))> __y_iterator((_temp_make_local_23_160 = (_Funcbuiltin_0x60_each_fa1c11aad54539b3(__context__,__lamF_rename_at_17))));
+		struct Foo __y_rename_at_23;
+		__need_loop_23 = __y_iterator.first(__context__,(__y_rename_at_23)) && __need_loop_23;
+		// ty : int const
+		das_iterator<range> __ty_iterator(range(0,10));
+		int32_t __ty_rename_at_23;
+		__need_loop_23 = __ty_iterator.first(__context__,(__ty_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __y_iterator.next(__context__,(__y_rename_at_23)) && __ty_iterator.next(__context__,(__ty_rename_at_23)) )
+		{
+			DAS_ASSERT((__y_rename_at_23.value == __ty_rename_at_23));
+		}
+		__y_iterator.close(__context__,(__y_rename_at_23));
+		__ty_iterator.close(__context__,(__ty_rename_at_23));
+	};
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_18_8_2_0x60_finazlier_882fd9f8b2ca19f2
+		aotLib[0x343c2f1b496cd0d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_18_8_2 *  ),&_Func_lambda_thismodule_18_8_2_0x60_finazlier_882fd9f8b2ca19f2>>();
+	};
+		// _Func_lambda_thismodule_18_8_2_0x60_function_b116b66e6e8787e9
+		aotLib[0x81d91eb4e1d5f6bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_18_8_2 & , struct Foo &  ),&_Func_lambda_thismodule_18_8_2_0x60_function_b116b66e6e8787e9>>();
+	};
+		// _Func_lambda_thismodule_9_8_1_0x60_finazlier_878613f94625c77e
+		aotLib[0xaf65fd482bd5a993] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_8_1 *  ),&_Func_lambda_thismodule_9_8_1_0x60_finazlier_878613f94625c77e>>();
+	};
+		// _Func_lambda_thismodule_9_8_1_0x60_function_307f45a04d16bc3
+		aotLib[0x71baab0d68ec2535] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_9_8_1 & , int32_t &  ),&_Func_lambda_thismodule_9_8_1_0x60_function_307f45a04d16bc3>>();
+	};
+		// _Funcbuiltin_0x60_each_fa1c11aad54539b3
+		aotLib[0x467d05e629fa7235] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((struct Foo)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,struct Foo)) const   ),&_Funcbuiltin_0x60_each_fa1c11aad54539b3>>();
+	};
+		// _Funcbuiltin_0x60_each_ec0a92925ebe3455
+		aotLib[0xcabef3115f435abd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_ec0a92925ebe3455>>();
+	};
+		// finalize_c813dc933f17c0ac
+		aotLib[0x683746930aadd531] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_18_8_2 &  ),&finalize_c813dc933f17c0ac>>();
+	};
+		// finalize_67f68cbc47a9525b
+		aotLib[0xd4cc5443dbf925a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_9_8_1 &  ),&finalize_67f68cbc47a9525b>>();
+	};
+		// test_62b3bf83d0377c1b
+		aotLib[0x127528c383193506] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_62b3bf83d0377c1b>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
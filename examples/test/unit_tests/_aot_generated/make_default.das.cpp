@@ -0,0 +1,115 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+enum class DefEnum : int32_t {
+	foo = int32_t(0),
+	bar = int32_t(1),
+};
+}
+}
+template <> struct cast< DefEnum > : cast_enum < DefEnum > {};
+namespace {
+namespace  {
+
+struct DefStruct {
+	int32_t x;
+	float y;
+};
+static_assert(sizeof(DefStruct)==8,"structure size mismatch with DAS");
+static_assert(offsetof(DefStruct,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(DefStruct,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline bool test_e45bc2f032dfae75 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_e45bc2f032dfae75 ( Context * __context__ )
+{
+	TTuple<8,int32_t,float> __t_tuple_rename_at_15 = (TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mks_15;
+		das_zero(__mks_15);
+		return __mks_15;
+	})());
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__t_tuple_rename_at_15) == 0) && (das_get_tuple_field<float,4>::get(__t_tuple_rename_at_15) == 0.f)));
+	TVariant<8,int32_t,float> __t_variant_rename_at_17 = (TVariant<8,int32_t,float>)(([&]() -> TVariant<8,int32_t,float> {
+		TVariant<8,int32_t,float> __mkv_17;
+		das_zero(__mkv_17);
+		return __mkv_17;
+	})());
+	DAS_ASSERT((das_get_variant_field<int32_t,4,0>::is(__t_variant_rename_at_17) && (das_get_variant_field<int32_t,4,0>::as(__t_variant_rename_at_17,__context__) == 0)));
+	struct DefStruct __t_struct_rename_at_19 = (struct DefStruct)(([&]() -> struct DefStruct {
+		struct DefStruct __mks_19;
+		das_zero(__mks_19);
+		return __mks_19;
+	})());
+	DAS_ASSERT(((__t_struct_rename_at_19.x == 0) && (__t_struct_rename_at_19.y == 0.f)));
+	TArray<int32_t> __t_array_rename_at_23; das_zero(__t_array_rename_at_23); das_move(__t_array_rename_at_23, (TArray<int32_t>)(([&]() -> TArray<int32_t> {
+		TArray<int32_t> __mks_23;
+		das_zero(__mks_23);
+		return __mks_23;
+	})()));
+	DAS_ASSERT((builtin_array_size(__t_array_rename_at_23) == 0));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_e45bc2f032dfae75
+		aotLib[0xabb5094a9c9ca5d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e45bc2f032dfae75>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
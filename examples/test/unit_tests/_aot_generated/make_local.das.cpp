@@ -0,0 +1,166 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Bar {
+	int32_t x;
+	int32_t y;
+	int32_t z;
+	int32_t w;
+};
+static_assert(sizeof(Bar)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,w)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+	int32_t i;
+	float f;
+	char * s;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,i)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,f)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,s)==8,"structure field offset mismatch with DAS");
+}
+
+inline struct Foo Foo_c550441728e4e403 ( Context * __context__ );
+inline bool test_868c8f725a53aef3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<struct Foo,0>(__context__) = Foo_c550441728e4e403(__context__);/*testFoo*/
+	das_global<struct Foo,16>(__context__) = (([&]() -> struct Foo {
+		struct Foo __mks_27;
+		das_copy((__mks_27.i),(3));
+		das_copy((__mks_27.f),(4.f));
+		das_copy((__mks_27.s),(((char *) "blah")));
+		return __mks_27;
+	})());/*jestFoo*/
+}
+
+inline struct Foo Foo_c550441728e4e403 ( Context * __context__ )
+{
+	return (([&]() -> struct Foo {
+		struct Foo __mks_18;
+		das_copy((__mks_18.i),(5));
+		das_copy((__mks_18.f),(6.f));
+		das_copy((__mks_18.s),(((char *) "hello")));
+		return __mks_18;
+	})());
+}
+
+inline bool test_868c8f725a53aef3 ( Context * __context__ )
+{
+	DAS_ASSERT((((das_global<struct Foo,0>(__context__) /*testFoo*/.i == 5) && (das_global<struct Foo,0>(__context__) /*testFoo*/.f == 6.f)) && (SimPolicy<char *>::Equ(cast<char *>::from(das_global<struct Foo,0>(__context__) /*testFoo*/.s),cast<char *>::from(((char *) "hello")),*__context__))));
+	DAS_ASSERT((((das_global<struct Foo,16>(__context__) /*jestFoo*/.i == 3) && (das_global<struct Foo,16>(__context__) /*jestFoo*/.f == 4.f)) && (SimPolicy<char *>::Equ(cast<char *>::from(das_global<struct Foo,16>(__context__) /*jestFoo*/.s),cast<char *>::from(((char *) "blah")),*__context__))));
+	struct Foo __t_rename_at_34 = (struct Foo)Foo_c550441728e4e403(__context__);
+	DAS_ASSERT((__t_rename_at_34.i == 5));
+	DAS_ASSERT((__t_rename_at_34.f == 6.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__t_rename_at_34.s),cast<char *>::from(((char *) "hello")),*__context__)));
+	struct Foo __q_rename_at_38 = (struct Foo)(([&]() -> struct Foo {
+		struct Foo __mks_38;
+		das_zero(__mks_38);
+		das_copy((__mks_38.i),(6));
+		das_copy((__mks_38.s),(((char *) "world")));
+		return __mks_38;
+	})());
+	DAS_ASSERT((__q_rename_at_38.i == 6));
+	DAS_ASSERT((__q_rename_at_38.f == 0.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__q_rename_at_38.s),cast<char *>::from(((char *) "world")),*__context__)));
+	TDim<struct Foo,3> __qq3_rename_at_42 = (TDim<struct Foo,3>)(([&]() -> TDim<struct Foo,3> {
+		TDim<struct Foo,3> __mks_42;
+		das_zero(__mks_42);
+		das_copy((__mks_42(0,__context__).i),(1));
+		das_copy((__mks_42(1,__context__).i),(2));
+		das_copy((__mks_42(2,__context__).i),(3));
+		return __mks_42;
+	})());
+	DAS_ASSERT((((__qq3_rename_at_42(0,__context__).i == 1) && (__qq3_rename_at_42(1,__context__).i == 2)) && (__qq3_rename_at_42(2,__context__).i == 3)));
+	TDim<int32_t,4> __ar_rename_at_44 = (TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+		TDim<int32_t,4> __mka_44;
+		__mka_44(0,__context__) = 1;
+		__mka_44(1,__context__) = 2;
+		__mka_44(2,__context__) = 3;
+		__mka_44(3,__context__) = 4;
+		return __mka_44;
+	})());
+	DAS_ASSERT(((((__ar_rename_at_44(0,__context__) == 1) && (__ar_rename_at_44(1,__context__) == 2)) && (__ar_rename_at_44(2,__context__) == 3)) && (__ar_rename_at_44(3,__context__) == 4)));
+	TDim<struct Foo,2> __arf_rename_at_46 = (TDim<struct Foo,2>)(([&]() -> TDim<struct Foo,2> {
+		TDim<struct Foo,2> __mka_46;
+		__mka_46(0,__context__) = Foo_c550441728e4e403(__context__);
+		__mka_46(1,__context__) = Foo_c550441728e4e403(__context__);
+		return __mka_46;
+	})());
+	DAS_ASSERT(((__arf_rename_at_46(0,__context__).i == 5) && (__arf_rename_at_46(1,__context__).i == 5)));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Foo_c550441728e4e403
+		aotLib[0xd3a3c84f14dc1725] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__ ),&Foo_c550441728e4e403>>();
+	};
+		// test_868c8f725a53aef3
+		aotLib[0xaf1d86d72d73da56] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_868c8f725a53aef3>>();
+	};
+		// [[ init script ]]
+		aotLib[0x882bc1345b08a8db] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,231 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+namespace  {
+
+struct Foo {
+	TArray<int32_t> a;
+	char * b;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> & __a_rename_at_232, TArray<int32_t> const  & __b_rename_at_232 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_398 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_bb512feadf9377fd ( Context * __context__, TDim<int32_t,4> & __a_rename_at_398 );
+inline char * const  _Funcstrings_boost_0x60_join_83054cc3488abcba ( Context * __context__, TArray<int32_t> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline bool test_e5bf846777a22d6c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> &  __a_rename_at_232, TArray<int32_t> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_232);
+		int32_t * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_232);
+		int32_t const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			das_copy((*__aV_rename_at_234),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_398 )
+{
+	TArray<int32_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_399),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_bb512feadf9377fd ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_398 )
+{
+	TArray<int32_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_399),4);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_83054cc3488abcba ( Context * __context__, TArray<int32_t> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const&
+			das_iterator<TArray<int32_t> const > __elem_iterator(__it_rename_at_16);
+			int32_t const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__))));
+	return __st_rename_at_21;
+}
+
+inline bool test_e5bf846777a22d6c ( Context * __context__ ) { das_stack_prologue __prologue(__context__,448,"test " DAS_FILE_LINE);
+{
+	TDim<int32_t,4> _temp_make_local_9_64;
+	TDim<int32_t,3> _temp_make_local_10_112;
+	TArray<int32_t> __sa_rename_at_9; das_zero(__sa_rename_at_9); das_move(__sa_rename_at_9, (TArray<int32_t>)_Funcbuiltin_0x60_to_array_move_bb512feadf9377fd(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_9_64(0,__context__) = 1;
+		_temp_make_local_9_64(1,__context__) = 2;
+		_temp_make_local_9_64(2,__context__) = 3;
+		_temp_make_local_9_64(3,__context__) = 4;
+		return _temp_make_local_9_64;
+	})()))));
+	TArray<int32_t> __sb_rename_at_10; das_zero(__sb_rename_at_10); das_move(__sb_rename_at_10, (TArray<int32_t>)_Funcbuiltin_0x60_to_array_move_228cbd1e470b6291(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_10_112(0,__context__) = 1;
+		_temp_make_local_10_112(1,__context__) = 2;
+		_temp_make_local_10_112(2,__context__) = 3;
+		return _temp_make_local_10_112;
+	})()))));
+	struct Foo __fa_rename_at_11; das_zero(__fa_rename_at_11); das_move(__fa_rename_at_11, (struct Foo)(([&]() -> struct Foo {
+		struct Foo __mks_11;
+		das_zero(__mks_11);
+		{
+			_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__mks_11.a),__sa_rename_at_9);
+		}		return __mks_11;
+	})()));
+	TDim<struct Foo,2> __fa2_rename_at_12; das_zero(__fa2_rename_at_12); das_move(__fa2_rename_at_12, (TDim<struct Foo,2>)(([&]() -> TDim<struct Foo,2> {
+		TDim<struct Foo,2> __mks_12;
+		das_zero(__mks_12);
+		{
+			_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__mks_12(1,__context__).a),__sb_rename_at_10);
+			_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__mks_12(0,__context__).a),__sa_rename_at_9);
+		}		return __mks_12;
+	})()));
+	DAS_ASSERT((builtin_array_size(__sa_rename_at_9) == 4));
+	DAS_ASSERT((builtin_array_size(__fa_rename_at_11.a) == 4));
+	DAS_ASSERT((builtin_array_size(__fa2_rename_at_12(0,__context__).a) == 4));
+	DAS_ASSERT((builtin_array_size(__fa2_rename_at_12(1,__context__).a) == 3));
+	struct Foo __faw_rename_at_17; das_zero(__faw_rename_at_17); das_move(__faw_rename_at_17, (struct Foo)(([&]() -> struct Foo {
+		struct Foo __mks_17;
+		das_zero(__mks_17);
+		das_copy((__mks_17.b),(((char *) "a is ")));
+		{
+			_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__mks_17.a),__sa_rename_at_9);
+			SimPolicy<char *>::SetAdd((char *)&(__mks_17.b),cast<char *>::from(_Funcstrings_boost_0x60_join_83054cc3488abcba(__context__,das_arg<TArray<int32_t>>::pass(__mks_17.a),((char *) "-"))),*__context__);
+		}		return __mks_17;
+	})()));
+	DAS_ASSERT((builtin_array_size(__faw_rename_at_17.a) == 4));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__faw_rename_at_17.b),cast<char *>::from(((char *) "a is 1-2-3-4")),*__context__)));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_9217fda5fb53190b
+		aotLib[0xb00d3e185e494e59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_9217fda5fb53190b>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291
+		aotLib[0xc37e6f73e998be11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_228cbd1e470b6291>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_bb512feadf9377fd
+		aotLib[0x17f0139356e80f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_bb512feadf9377fd>>();
+	};
+		// _Funcstrings_boost_0x60_join_83054cc3488abcba
+		aotLib[0xfdbaf2e902de5001] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<int32_t> const  & , char * const   ),&_Funcstrings_boost_0x60_join_83054cc3488abcba>>();
+	};
+		// test_e5bf846777a22d6c
+		aotLib[0x583a86a49c38922c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e5bf846777a22d6c>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
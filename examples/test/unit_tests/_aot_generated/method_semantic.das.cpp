@@ -0,0 +1,127 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Point {
+	float x;
+	float y;
+	Func DAS_COMMENT((float,struct Point const )) magnitude;
+	Func DAS_COMMENT((float,struct Point const ,struct Point const )) dot;
+};
+static_assert(sizeof(Point)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Point,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,magnitude)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,dot)==12,"structure field offset mismatch with DAS");
+}
+
+inline struct Point _Func_0x60_Point_48ffcc37235794f ( Context * __context__, float __X_rename_at_6, float __Y_rename_at_6 );
+inline float point_dot_f0b587821f1e53f9 ( Context * __context__, struct Point const  & __that_rename_at_12, struct Point const  & __p_rename_at_12 );
+inline float point_magnitude_66e8262eaebf8b0 ( Context * __context__, struct Point const  & __that_rename_at_9 );
+inline bool test_90e7eb3452991e1e ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline struct Point _Func_0x60_Point_48ffcc37235794f ( Context * __context__, float __X_rename_at_6, float __Y_rename_at_6 )
+{
+	return (([&]() -> struct Point {
+		struct Point __mks_7;
+		das_copy((__mks_7.x),(__X_rename_at_6));
+		das_copy((__mks_7.y),(__Y_rename_at_6));
+		das_copy((__mks_7.magnitude),(Func(__context__->fnIdxByMangledName(/*point_magnitude Point#const*/ 1845891886u))));
+		das_copy((__mks_7.dot),(Func(__context__->fnIdxByMangledName(/*point_dot Point#const Point#const*/ 3678962065u))));
+		return __mks_7;
+	})());
+}
+
+inline float point_dot_f0b587821f1e53f9 ( Context * __context__, struct Point const  &  __that_rename_at_12, struct Point const  &  __p_rename_at_12 )
+{
+	return (__that_rename_at_12.x * __p_rename_at_12.x) + (__that_rename_at_12.y * __p_rename_at_12.y);
+}
+
+inline float point_magnitude_66e8262eaebf8b0 ( Context * __context__, struct Point const  &  __that_rename_at_9 )
+{
+	return (__that_rename_at_9.x * __that_rename_at_9.x) + (__that_rename_at_9.y * __that_rename_at_9.y);
+}
+
+inline bool test_90e7eb3452991e1e ( Context * __context__ )
+{
+	struct Point _temp_make_local_19_80;
+	struct Point __p_rename_at_17 = (struct Point)_Func_0x60_Point_48ffcc37235794f(__context__,2.f,3.f);
+	float __t_rename_at_18 = (float)das_invoke_function<float>::invoke<struct Point const  &>(__context__,__p_rename_at_17.magnitude,das_cast<struct Point const >::cast(__p_rename_at_17));
+	float __d_rename_at_19 = (float)das_invoke_function<float>::invoke<struct Point const  &,struct Point &>(__context__,__p_rename_at_17.dot,das_cast<struct Point const >::cast(__p_rename_at_17),das_arg<struct Point>::pass((_temp_make_local_19_80 = (_Func_0x60_Point_48ffcc37235794f(__context__,1.f,1.f)))));
+	DAS_ASSERT(((__t_rename_at_18 == 13.f) && (__d_rename_at_19 == 5.f)));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_Point_48ffcc37235794f
+		aotLib[0xf5206ec98e5e1e65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Point (*) ( Context * __context__, float , float  ),&_Func_0x60_Point_48ffcc37235794f>>();
+	};
+		// point_dot_f0b587821f1e53f9
+		aotLib[0x3bb6df4b19bc688d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, struct Point const  & , struct Point const  &  ),&point_dot_f0b587821f1e53f9>>();
+	};
+		// point_magnitude_66e8262eaebf8b0
+		aotLib[0x91beb45da02b899] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, struct Point const  &  ),&point_magnitude_66e8262eaebf8b0>>();
+	};
+		// test_90e7eb3452991e1e
+		aotLib[0x93b640085da7266] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_90e7eb3452991e1e>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,104 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _module_a
+ // require _module_b
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline char * _Func_module_b_0x60_from_b_get_3_e247ebbe34ddd56d ( Context * __context__ );
+inline char * _Func_module_b_0x60_from_b_get_4_9b69a6810b5eddcd ( Context * __context__ );
+inline bool test_424ccc4215f0469f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<char *,0>(__context__) = ((char *) "local");/*global_1*/
+	das_global<char *,16>(__context__) = ((char *) "local");/*global_3*/
+}
+
+inline char * _Func_module_b_0x60_from_b_get_3_e247ebbe34ddd56d ( Context * __context__ )
+{
+	return das_global<char *,32>(__context__) /*global_3*/;
+}
+
+inline char * _Func_module_b_0x60_from_b_get_4_9b69a6810b5eddcd ( Context * __context__ )
+{
+	return das_global<char *,64>(__context__) /*global_4*/;
+}
+
+inline bool test_424ccc4215f0469f ( Context * __context__ )
+{
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0>(__context__) /*::global_1*/),cast<char *>::from(((char *) "local")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,48>(__context__) /*_module_b::global_1*/),cast<char *>::from(((char *) "from_b")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Func_module_b_0x60_from_b_get_3_e247ebbe34ddd56d(__context__)),cast<char *>::from(((char *) "from_a")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Func_module_b_0x60_from_b_get_4_9b69a6810b5eddcd(__context__)),cast<char *>::from(((char *) "from_b")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,16>(__context__) /*global_3*/),cast<char *>::from(((char *) "local")),*__context__)));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_module_b_0x60_from_b_get_3_e247ebbe34ddd56d
+		aotLib[0x3f3d02544952d13d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__ ),&_Func_module_b_0x60_from_b_get_3_e247ebbe34ddd56d>>();
+	};
+		// _Func_module_b_0x60_from_b_get_4_9b69a6810b5eddcd
+		aotLib[0x84c5ec5553d616e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__ ),&_Func_module_b_0x60_from_b_get_4_9b69a6810b5eddcd>>();
+	};
+		// test_424ccc4215f0469f
+		aotLib[0xdef923db38426346] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_424ccc4215f0469f>>();
+	};
+		// [[ init script ]]
+		aotLib[0x95b769108a8638eb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,184 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Ball {
+	float3 center;
+	float radius;
+};
+static_assert(sizeof(Ball)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Ball,center)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ball,radius)==12,"structure field offset mismatch with DAS");
+}
+
+inline struct Ball Ball_99bd3f824f35606a ( Context * __context__ );
+inline struct Ball Ball_6b3dbba03b3e6788 ( Context * __context__, float3 __center_rename_at_7, float __radius_rename_at_7 );
+inline void _Funcbuiltin_0x60_finalize_dim_1b70c1d46f9a784d ( Context * __context__, TDim<struct Ball *,3> & __a_rename_at_277 );
+inline void finalize_e51158d8cf254f33 ( Context * __context__, struct Ball * & ____this_rename_at_281 );
+inline void finalize_9bf481eba8828170 ( Context * __context__, struct Ball & ____this_rename_at_3 );
+inline bool test_f0bfae8c81fa8be7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline struct Ball Ball_99bd3f824f35606a ( Context * __context__ )
+{
+	return (([&]() -> struct Ball {
+		struct Ball __mks_3;
+		das_copy((__mks_3.center),(v_make_vec4f(7.f,8.f,9.f,0.f)));
+		das_copy((__mks_3.radius),(1.234f));
+		return __mks_3;
+	})());
+}
+
+inline struct Ball Ball_6b3dbba03b3e6788 ( Context * __context__, float3 __center_rename_at_7, float __radius_rename_at_7 )
+{
+	struct Ball __b_rename_at_8; das_zero(__b_rename_at_8);
+	das_copy(__b_rename_at_8.center,__center_rename_at_7);
+	das_copy(__b_rename_at_8.radius,__radius_rename_at_7);
+	return __b_rename_at_8;
+}
+
+inline void _Funcbuiltin_0x60_finalize_dim_1b70c1d46f9a784d ( Context * __context__, TDim<struct Ball *,3> &  __a_rename_at_277 )
+{
+	{
+		bool __need_loop_279 = true;
+		// aV : Ball? aka TT&
+		das_iterator<TDim<struct Ball *,3>> __aV_iterator(__a_rename_at_277);
+		struct Ball * * __aV_rename_at_279;
+		__need_loop_279 = __aV_iterator.first(__context__,(__aV_rename_at_279)) && __need_loop_279;
+		for ( ; __need_loop_279 ; __need_loop_279 = __aV_iterator.next(__context__,(__aV_rename_at_279)) )
+		{
+			finalize_e51158d8cf254f33(__context__,(*__aV_rename_at_279));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_279));
+	};
+}
+
+inline void finalize_e51158d8cf254f33 ( Context * __context__, struct Ball * & ____this_rename_at_281 )
+{
+	if ( ____this_rename_at_281 != nullptr )
+	{
+		finalize_9bf481eba8828170(__context__,das_arg<struct Ball>::pass(das_deref(__context__,____this_rename_at_281)));
+		das_delete<struct Ball *>::clear(__context__,____this_rename_at_281);
+		das_copy(____this_rename_at_281,nullptr);
+	};
+}
+
+inline void finalize_9bf481eba8828170 ( Context * __context__, struct Ball &  ____this_rename_at_3 )
+{
+	memset(&(____this_rename_at_3), 0, 16);
+}
+
+inline bool test_f0bfae8c81fa8be7 ( Context * __context__ )
+{
+	struct Ball * __b0_rename_at_15; memset(&__b0_rename_at_15,0,sizeof(__b0_rename_at_15));
+	struct Ball * __b1_rename_at_17; memset(&__b1_rename_at_17,0,sizeof(__b1_rename_at_17));
+	struct Ball * __b2_rename_at_19; memset(&__b2_rename_at_19,0,sizeof(__b2_rename_at_19));
+	TDim<struct Ball *,3> __b3_rename_at_21; memset(&__b3_rename_at_21,0,sizeof(__b3_rename_at_21));
+/* finally */ auto __finally_15= das_finally([&](){
+	finalize_e51158d8cf254f33(__context__,__b0_rename_at_15);
+	finalize_e51158d8cf254f33(__context__,__b1_rename_at_17);
+	finalize_e51158d8cf254f33(__context__,__b2_rename_at_19);
+	_Funcbuiltin_0x60_finalize_dim_1b70c1d46f9a784d(__context__,das_arg<TDim<struct Ball *,3>>::pass(__b3_rename_at_21));
+/* end finally */ });
+	__b0_rename_at_15 = das_new<struct Ball>::make(__context__);
+	DAS_ASSERT(((SimPolicy<float3>::Equ(__b0_rename_at_15->center,v_zero(),*__context__)) && (__b0_rename_at_15->radius == 0.f)));
+	__b1_rename_at_17 = das_new<struct Ball>::make_and_init(__context__,[&]() { return Ball_99bd3f824f35606a(__context__); });
+	DAS_ASSERT(((SimPolicy<float3>::Equ(__b1_rename_at_17->center,v_make_vec4f(7.f,8.f,9.f,0.f),*__context__)) && (__b1_rename_at_17->radius == 1.234f)));
+	__b2_rename_at_19 = das_new<struct Ball>::make_and_init(__context__,[&]() { return Ball_6b3dbba03b3e6788(__context__,v_make_vec4f(1.f,2.f,3.f,0.f),4.f); });
+	DAS_ASSERT(((SimPolicy<float3>::Equ(__b2_rename_at_19->center,v_make_vec4f(1.f,2.f,3.f,0.f),*__context__)) && (__b2_rename_at_19->radius == 4.f)));
+	__b3_rename_at_21 = das_new_dim<struct Ball,3>::make_and_init(__context__,[&]() { return Ball_6b3dbba03b3e6788(__context__,v_make_vec4f(3.f,2.f,1.f,0.f),0.5f); });
+	{
+		bool __need_loop_22 = true;
+		// b : Ball?&
+		das_iterator<TDim<struct Ball *,3>> __b_iterator(__b3_rename_at_21);
+		struct Ball * * __b_rename_at_22;
+		__need_loop_22 = __b_iterator.first(__context__,(__b_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __b_iterator.next(__context__,(__b_rename_at_22)) )
+		{
+			DAS_ASSERT(((SimPolicy<float3>::Equ((*__b_rename_at_22)->center,v_make_vec4f(3.f,2.f,1.f,0.f),*__context__)) && ((*__b_rename_at_22)->radius == 0.5f)));
+		}
+		__b_iterator.close(__context__,(__b_rename_at_22));
+	};
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Ball_99bd3f824f35606a
+		aotLib[0x31741a2bbae95a05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Ball (*) ( Context * __context__ ),&Ball_99bd3f824f35606a>>();
+	};
+		// Ball_6b3dbba03b3e6788
+		aotLib[0x44eb2b8198ce6f95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Ball (*) ( Context * __context__, float3 , float  ),&Ball_6b3dbba03b3e6788>>();
+	};
+		// _Funcbuiltin_0x60_finalize_dim_1b70c1d46f9a784d
+		aotLib[0x9871cd25d893feb1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<struct Ball *,3> &  ),&_Funcbuiltin_0x60_finalize_dim_1b70c1d46f9a784d>>();
+	};
+		// finalize_e51158d8cf254f33
+		aotLib[0xb5428404f357ef3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Ball * &  ),&finalize_e51158d8cf254f33>>();
+	};
+		// finalize_9bf481eba8828170
+		aotLib[0x7e8060f091117e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Ball &  ),&finalize_9bf481eba8828170>>();
+	};
+		// test_f0bfae8c81fa8be7
+		aotLib[0x14f7445a74b2b1a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f0bfae8c81fa8be7>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,580 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__86738248;
+extern StructInfo __struct_info__b1589007;
+extern StructInfo __struct_info__4520029c;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__9fa6254c;
+extern TypeInfo __type_info__b6dbe858;
+extern TypeInfo __type_info__c7e1677;
+extern VarInfo __var_info__eedd2c27;
+extern VarInfo __var_info__a3802949;
+extern VarInfo __var_info__43cdea36;
+extern VarInfo __var_info__82e7b5f2;
+extern VarInfo __var_info__cc67c2f8;
+extern VarInfo __var_info__3b4f7d4f;
+extern VarInfo __var_info__4b2267d1;
+extern VarInfo __var_info__2811f5c3;
+extern VarInfo __var_info__60a506fb;
+extern VarInfo __var_info__341c5ca3;
+extern VarInfo __var_info__7688e974;
+extern VarInfo __var_info__eddd2a94;
+extern VarInfo __var_info__80e7b2cc;
+extern VarInfo __var_info__81e7b45f;
+extern VarInfo __var_info__e2a04d94;
+extern VarInfo __var_info__d2aa970e;
+
+VarInfo __struct_info__86738248_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2811f5c3, "__rtti", 0 };
+TypeInfo * __type_info__cc67c2f8_arg_types_var_2255716936[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__86738248_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc67c2f8_arg_types_var_2255716936, nullptr, 1, 0, nullptr, 28, 0xcc67c2f8, "__finalize", 8 };
+VarInfo __struct_info__86738248_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x80e7b2cc, "x", 12 };
+VarInfo __struct_info__86738248_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x81e7b45f, "y", 16 };
+TypeInfo * __type_info__e2a04d94_arg_types_var_2255716936[3] = { &__type_info__c7e1677, &__type_info__359c1b32, &__type_info__359c1b32 };
+VarInfo __struct_info__86738248_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e2a04d94_arg_types_var_2255716936, nullptr, 3, 0, nullptr, 28, 0xe2a04d94, "set", 20 };
+TypeInfo * __type_info__43cdea36_arg_types_var_2255716936[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__86738248_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43cdea36_arg_types_var_2255716936, nullptr, 1, 0, nullptr, 28, 0x43cdea36, "ups", 24 };
+VarInfo __struct_info__86738248_field_6 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x82e7b5f2, "z", 28 };
+VarInfo * __struct_info__86738248_fields[7] =  { &__struct_info__86738248_field_0, &__struct_info__86738248_field_1, &__struct_info__86738248_field_2, &__struct_info__86738248_field_3, &__struct_info__86738248_field_4, &__struct_info__86738248_field_5, &__struct_info__86738248_field_6 };
+StructInfo __struct_info__86738248 = {"Foo3D", __struct_info__86738248_fields, 7, 32, 4, nullptr, 0x86738248 };
+VarInfo __struct_info__b1589007_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd2aa970e, "__rtti", 0 };
+TypeInfo * __type_info__4b2267d1_arg_types_var_2975371271[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4b2267d1_arg_types_var_2975371271, nullptr, 1, 0, nullptr, 28, 0x4b2267d1, "__finalize", 8 };
+VarInfo __struct_info__b1589007_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xeedd2c27, "x", 12 };
+VarInfo __struct_info__b1589007_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xeddd2a94, "y", 16 };
+TypeInfo * __type_info__341c5ca3_arg_types_var_2975371271[3] = { &__type_info__c7e1677, &__type_info__359c1b32, &__type_info__359c1b32 };
+VarInfo __struct_info__b1589007_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__341c5ca3_arg_types_var_2975371271, nullptr, 3, 0, nullptr, 28, 0x341c5ca3, "set", 20 };
+TypeInfo * __type_info__a3802949_arg_types_var_2975371271[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__b1589007_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a3802949_arg_types_var_2975371271, nullptr, 1, 0, nullptr, 28, 0xa3802949, "ups", 24 };
+VarInfo * __struct_info__b1589007_fields[6] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1, &__struct_info__b1589007_field_2, &__struct_info__b1589007_field_3, &__struct_info__b1589007_field_4, &__struct_info__b1589007_field_5 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 6, 32, 0, nullptr, 0xb1589007 };
+VarInfo __struct_info__4520029c_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3b4f7d4f, "__rtti", 0 };
+TypeInfo * __type_info__7688e974_arg_types_var_1159725724[1] = { &__type_info__9fa6254c };
+VarInfo __struct_info__4520029c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7688e974_arg_types_var_1159725724, nullptr, 1, 0, nullptr, 28, 0x7688e974, "__finalize", 8 };
+VarInfo __struct_info__4520029c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x60a506fb, "a", 12 };
+VarInfo * __struct_info__4520029c_fields[3] =  { &__struct_info__4520029c_field_0, &__struct_info__4520029c_field_1, &__struct_info__4520029c_field_2 };
+StructInfo __struct_info__4520029c = {"Goo", __struct_info__4520029c_fields, 3, 16, 14, nullptr, 0x4520029c };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__9fa6254c = { Type::tStructure, &__struct_info__4520029c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x9fa6254c };
+TypeInfo __type_info__b6dbe858 = { Type::tStructure, &__struct_info__86738248, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb6dbe858 };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xc7e1677 };
+
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+namespace  {
+
+struct Foo {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct Foo)) __finalize;
+	int32_t x;
+	int32_t y;
+	Func DAS_COMMENT((void,struct Foo,int32_t,int32_t)) set;
+	Func DAS_COMMENT((void,struct Foo)) ups;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,x)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,set)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,ups)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo3D {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct Foo)) __finalize;
+	int32_t x;
+	int32_t y;
+	Func DAS_COMMENT((void,struct Foo,int32_t,int32_t)) set;
+	Func DAS_COMMENT((void,struct Foo)) ups;
+	int32_t z;
+};
+static_assert(sizeof(Foo3D)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo3D,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,x)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,y)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,set)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,ups)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,z)==28,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Goo {
+	void * __rtti;
+	Func DAS_COMMENT((void,struct Goo)) __finalize;
+	int32_t a;
+};
+static_assert(sizeof(Goo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Goo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Goo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Goo,a)==12,"structure field offset mismatch with DAS");
+}
+
+inline struct Foo Foo_e8d072653711740b ( Context * __context__ );
+inline struct Foo Foo_fc93cbc8a4653bc2 ( Context * __context__, int32_t __T_rename_at_11 );
+inline struct Foo Foo_af02f2255ab41e1a ( Context * __context__, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 );
+inline void _FuncFoo_0x27___finalize_4cfc91126ecc41bb ( Context * __context__, struct Foo & __self_rename_at_7 );
+inline struct Foo3D Foo3D_6738dc50d8097d17 ( Context * __context__ );
+inline void _FuncFoo3D_0x27___finalize_9a49992a935060eb ( Context * __context__, struct Foo3D & __self_rename_at_24 );
+inline void _FuncFoo3D_0x60_Foo3D_eb94f27e1b16f8bf ( Context * __context__, struct Foo3D & __self_rename_at_26 );
+inline void _FuncFoo3D_0x60_set_2ee1c44e279a3dca ( Context * __context__, struct Foo3D & __self_rename_at_32, int32_t __X_rename_at_32, int32_t __Y_rename_at_32 );
+inline void _FuncFoo3D_0x60_ups_d1b83f1ce594f41 ( Context * __context__, struct Foo3D & __self_rename_at_35 );
+inline void _FuncFoo_0x60_Foo_4be422c05b13d87 ( Context * __context__, struct Foo & __self_rename_at_9 );
+inline void _FuncFoo_0x60_Foo_4762ae02a69efb92 ( Context * __context__, struct Foo & __self_rename_at_11, int32_t __T_rename_at_11 );
+inline void _FuncFoo_0x60_Foo_c50f5ba6b4548486 ( Context * __context__, struct Foo & __self_rename_at_13, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 );
+inline void _FuncFoo_0x60_set_8b8955cc4af67406 ( Context * __context__, struct Foo & __self_rename_at_15, int32_t __X_rename_at_15, int32_t __Y_rename_at_15 );
+inline void _FuncFoo_0x60_ups_66ee78088bcf21e1 ( Context * __context__, struct Foo & __self_rename_at_18 );
+inline struct Goo Goo_f37fe1e15f10b0e5 ( Context * __context__ );
+inline void _FuncGoo_0x27___finalize_756a7d0f5d6b03dd ( Context * __context__, struct Goo & __self_rename_at_85 );
+inline void finalize_2e7e2cdf44185f38 ( Context * __context__, struct Foo * & ____this_rename_at_74 );
+inline void finalize_bf8c71d9ec82e898 ( Context * __context__, struct Foo & __self_rename_at_21 );
+inline void finalize_f561be252460fe45 ( Context * __context__, struct Foo3D & __self_rename_at_39 );
+inline void finalize_60a6a4dd6ca8bfe4 ( Context * __context__, struct Goo & ____this_rename_at_85 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_f08791c5d34da4e4 ( Context * __context__, struct Foo const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_d06663e42b294af7 ( Context * __context__, struct Foo3D const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_3a6b5c778a051abf ( Context * __context__, struct Goo const  & __cl_rename_at_88 );
+inline bool test_359b249487062ce3 ( Context * __context__ );
+inline void test_foo_c5b296c22f5a8113 ( Context * __context__ );
+inline void test_foo_ptr_4bcd882bba99c5f6 ( Context * __context__ );
+inline void test_rtti_c9849baa59537243 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0>(__context__) = 0;/*delFoo*/
+	das_global<int32_t,16>(__context__) = 0;/*delFoo3D*/
+}
+
+inline struct Foo Foo_e8d072653711740b ( Context * __context__ )
+{
+	struct Foo __self_rename_at_9; das_zero(__self_rename_at_9); das_move(__self_rename_at_9, (([&]() -> struct Foo {
+		struct Foo __mks_9;
+		das_copy((__mks_9.__rtti),(((void *)(&__type_info__c7e1677))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnIdxByMangledName(/*Foo'__finalize Foo*/ 2693173404u))));
+		das_copy((__mks_9.x),(0));
+		das_copy((__mks_9.y),(0));
+		das_copy((__mks_9.set),(Func(__context__->fnIdxByMangledName(/*Foo`set Foo int#const int#const*/ 2842315987u))));
+		das_copy((__mks_9.ups),(Func(__context__->fnIdxByMangledName(/*Foo`ups Foo*/ 3528142325u))));
+		return __mks_9;
+	})()));
+	_FuncFoo_0x60_Foo_4be422c05b13d87(__context__,das_arg<struct Foo>::pass(__self_rename_at_9));
+	return /* <- */ __self_rename_at_9;
+}
+
+inline struct Foo Foo_fc93cbc8a4653bc2 ( Context * __context__, int32_t __T_rename_at_11 )
+{
+	struct Foo __self_rename_at_11; das_zero(__self_rename_at_11); das_move(__self_rename_at_11, (([&]() -> struct Foo {
+		struct Foo __mks_11;
+		das_copy((__mks_11.__rtti),(((void *)(&__type_info__c7e1677))));
+		das_copy((__mks_11.__finalize),(Func(__context__->fnIdxByMangledName(/*Foo'__finalize Foo*/ 2693173404u))));
+		das_copy((__mks_11.x),(0));
+		das_copy((__mks_11.y),(0));
+		das_copy((__mks_11.set),(Func(__context__->fnIdxByMangledName(/*Foo`set Foo int#const int#const*/ 2842315987u))));
+		das_copy((__mks_11.ups),(Func(__context__->fnIdxByMangledName(/*Foo`ups Foo*/ 3528142325u))));
+		return __mks_11;
+	})()));
+	_FuncFoo_0x60_Foo_4762ae02a69efb92(__context__,das_arg<struct Foo>::pass(__self_rename_at_11),__T_rename_at_11);
+	return /* <- */ __self_rename_at_11;
+}
+
+inline struct Foo Foo_af02f2255ab41e1a ( Context * __context__, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 )
+{
+	struct Foo __self_rename_at_13; das_zero(__self_rename_at_13); das_move(__self_rename_at_13, (([&]() -> struct Foo {
+		struct Foo __mks_13;
+		das_copy((__mks_13.__rtti),(((void *)(&__type_info__c7e1677))));
+		das_copy((__mks_13.__finalize),(Func(__context__->fnIdxByMangledName(/*Foo'__finalize Foo*/ 2693173404u))));
+		das_copy((__mks_13.x),(0));
+		das_copy((__mks_13.y),(0));
+		das_copy((__mks_13.set),(Func(__context__->fnIdxByMangledName(/*Foo`set Foo int#const int#const*/ 2842315987u))));
+		das_copy((__mks_13.ups),(Func(__context__->fnIdxByMangledName(/*Foo`ups Foo*/ 3528142325u))));
+		return __mks_13;
+	})()));
+	_FuncFoo_0x60_Foo_c50f5ba6b4548486(__context__,das_arg<struct Foo>::pass(__self_rename_at_13),__X_rename_at_13,__Y_rename_at_13);
+	return /* <- */ __self_rename_at_13;
+}
+
+inline void _FuncFoo_0x27___finalize_4cfc91126ecc41bb ( Context * __context__, struct Foo &  __self_rename_at_7 )
+{
+	finalize_bf8c71d9ec82e898(__context__,das_arg<struct Foo>::pass(__self_rename_at_7));
+}
+
+inline struct Foo3D Foo3D_6738dc50d8097d17 ( Context * __context__ )
+{
+	struct Foo3D __self_rename_at_26; das_zero(__self_rename_at_26); das_move(__self_rename_at_26, (([&]() -> struct Foo3D {
+		struct Foo3D __mks_26;
+		das_copy((__mks_26.__rtti),(((void *)(&__type_info__b6dbe858))));
+		das_copy((__mks_26.__finalize),(das_cast<Func DAS_COMMENT((void,struct Foo))>::cast(Func(__context__->fnIdxByMangledName(/*Foo3D'__finalize Foo3D*/ 4170405874u)))));
+		das_copy((__mks_26.x),(0));
+		das_copy((__mks_26.y),(0));
+		das_copy((__mks_26.set),(das_cast<Func DAS_COMMENT((void,struct Foo,int32_t,int32_t))>::cast(Func(__context__->fnIdxByMangledName(/*Foo3D`set Foo3D int#const int#const*/ 433034575u)))));
+		das_copy((__mks_26.ups),(das_cast<Func DAS_COMMENT((void,struct Foo))>::cast(Func(__context__->fnIdxByMangledName(/*Foo3D`ups Foo3D*/ 3952054257u)))));
+		das_copy((__mks_26.z),(13));
+		return __mks_26;
+	})()));
+	_FuncFoo3D_0x60_Foo3D_eb94f27e1b16f8bf(__context__,das_arg<struct Foo3D>::pass(__self_rename_at_26));
+	return /* <- */ __self_rename_at_26;
+}
+
+inline void _FuncFoo3D_0x27___finalize_9a49992a935060eb ( Context * __context__, struct Foo3D &  __self_rename_at_24 )
+{
+	finalize_f561be252460fe45(__context__,das_arg<struct Foo3D>::pass(__self_rename_at_24));
+}
+
+inline void _FuncFoo3D_0x60_Foo3D_eb94f27e1b16f8bf ( Context * __context__, struct Foo3D &  __self_rename_at_26 )
+{
+	DAS_ASSERT(((__self_rename_at_26.x == 0) && (__self_rename_at_26.y == 0)));
+	DAS_ASSERT((__self_rename_at_26.z == 13));
+	_FuncFoo_0x60_Foo_4be422c05b13d87(__context__,das_reinterpret<struct Foo>::pass(das_arg<struct Foo3D>::pass(__self_rename_at_26)));
+	DAS_ASSERT(((__self_rename_at_26.x == 1) && (__self_rename_at_26.y == 1)));
+	das_copy(__self_rename_at_26.z,3);
+}
+
+inline void _FuncFoo3D_0x60_set_2ee1c44e279a3dca ( Context * __context__, struct Foo3D &  __self_rename_at_32, int32_t __X_rename_at_32, int32_t __Y_rename_at_32 )
+{
+	_FuncFoo_0x60_set_8b8955cc4af67406(__context__,das_reinterpret<struct Foo>::pass(das_arg<struct Foo3D>::pass(__self_rename_at_32)),__X_rename_at_32,__Y_rename_at_32);
+	das_copy(__self_rename_at_32.z,0);
+}
+
+inline void _FuncFoo3D_0x60_ups_d1b83f1ce594f41 ( Context * __context__, struct Foo3D &  __self_rename_at_35 )
+{
+	das_copy(__self_rename_at_35.x,-2);
+	das_copy(__self_rename_at_35.y,-2);
+	das_copy(__self_rename_at_35.z,-2);
+}
+
+inline void _FuncFoo_0x60_Foo_4be422c05b13d87 ( Context * __context__, struct Foo &  __self_rename_at_9 )
+{
+	_FuncFoo_0x60_set_8b8955cc4af67406(__context__,das_arg<struct Foo>::pass(__self_rename_at_9),1,1);
+}
+
+inline void _FuncFoo_0x60_Foo_4762ae02a69efb92 ( Context * __context__, struct Foo &  __self_rename_at_11, int32_t __T_rename_at_11 )
+{
+	das_invoke_function<void>::invoke<struct Foo &,int32_t,int32_t>(__context__,__self_rename_at_11.set,das_arg<struct Foo>::pass(__self_rename_at_11),__T_rename_at_11,__T_rename_at_11);
+}
+
+inline void _FuncFoo_0x60_Foo_c50f5ba6b4548486 ( Context * __context__, struct Foo &  __self_rename_at_13, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 )
+{
+	_FuncFoo_0x60_set_8b8955cc4af67406(__context__,das_arg<struct Foo>::pass(__self_rename_at_13),__X_rename_at_13,__Y_rename_at_13);
+}
+
+inline void _FuncFoo_0x60_set_8b8955cc4af67406 ( Context * __context__, struct Foo &  __self_rename_at_15, int32_t __X_rename_at_15, int32_t __Y_rename_at_15 )
+{
+	das_copy(__self_rename_at_15.x,__X_rename_at_15);
+	das_copy(__self_rename_at_15.y,__Y_rename_at_15);
+}
+
+inline void _FuncFoo_0x60_ups_66ee78088bcf21e1 ( Context * __context__, struct Foo &  __self_rename_at_18 )
+{
+	das_copy(__self_rename_at_18.x,-1);
+	das_copy(__self_rename_at_18.y,-1);
+}
+
+inline struct Goo Goo_f37fe1e15f10b0e5 ( Context * __context__ )
+{
+	return (([&]() -> struct Goo {
+		struct Goo __mks_85;
+		das_zero(__mks_85);
+		das_copy((__mks_85.__rtti),(((void *)(&__type_info__9fa6254c))));
+		das_copy((__mks_85.__finalize),(Func(__context__->fnIdxByMangledName(/*Goo'__finalize Goo*/ 254725206u))));
+		return __mks_85;
+	})());
+}
+
+inline void _FuncGoo_0x27___finalize_756a7d0f5d6b03dd ( Context * __context__, struct Goo &  __self_rename_at_85 )
+{
+	finalize_60a6a4dd6ca8bfe4(__context__,das_arg<struct Goo>::pass(__self_rename_at_85));
+}
+
+inline void finalize_2e7e2cdf44185f38 ( Context * __context__, struct Foo * & ____this_rename_at_74 )
+{
+	if ( ____this_rename_at_74 != nullptr )
+	{
+		das_invoke_function<void>::invoke<struct Foo &>(__context__,____this_rename_at_74->__finalize,das_arg<struct Foo>::pass(das_cast<struct Foo>::cast(das_deref(__context__,____this_rename_at_74))));
+		das_delete<struct Foo *>::clear(__context__,____this_rename_at_74);
+		das_copy(____this_rename_at_74,nullptr);
+	};
+}
+
+inline void finalize_bf8c71d9ec82e898 ( Context * __context__, struct Foo &  __self_rename_at_21 )
+{
+	das_global<int32_t,0>(__context__) /*delFoo*/++;
+}
+
+inline void finalize_f561be252460fe45 ( Context * __context__, struct Foo3D &  __self_rename_at_39 )
+{
+	finalize_bf8c71d9ec82e898(__context__,das_arg<struct Foo>::pass(das_cast<struct Foo>::cast(__self_rename_at_39)));
+	das_global<int32_t,16>(__context__) /*delFoo3D*/++;
+}
+
+inline void finalize_60a6a4dd6ca8bfe4 ( Context * __context__, struct Goo &  ____this_rename_at_85 )
+{
+	memset(&(____this_rename_at_85), 0, 16);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_f08791c5d34da4e4 ( Context * __context__, struct Foo const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_d06663e42b294af7 ( Context * __context__, struct Foo3D const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_3a6b5c778a051abf ( Context * __context__, struct Goo const  &  __cl_rename_at_88 )
+{
+	return das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/);
+}
+
+inline bool test_359b249487062ce3 ( Context * __context__ )
+{
+	test_foo_c5b296c22f5a8113(__context__);
+	test_foo_ptr_4bcd882bba99c5f6(__context__);
+	test_rtti_c9849baa59537243(__context__);
+	return true;
+}
+
+inline void test_foo_c5b296c22f5a8113 ( Context * __context__ )
+{
+	struct Foo __f_rename_at_45 = Foo_e8d072653711740b(__context__);
+	DAS_ASSERT(((__f_rename_at_45.x == 1) && (__f_rename_at_45.y == 1)));
+	das_invoke_function<void>::invoke<struct Foo &,int32_t,int32_t>(__context__,__f_rename_at_45.set,das_arg<struct Foo>::pass(das_cast<struct Foo>::cast(__f_rename_at_45)),1,2);
+	DAS_ASSERT(((__f_rename_at_45.x == 1) && (__f_rename_at_45.y == 2)));
+	das_copy(__f_rename_at_45,Foo_af02f2255ab41e1a(__context__,11,12));
+	DAS_ASSERT(((__f_rename_at_45.x == 11) && (__f_rename_at_45.y == 12)));
+	das_copy(__f_rename_at_45,Foo_fc93cbc8a4653bc2(__context__,13));
+	DAS_ASSERT(((__f_rename_at_45.x == 13) && (__f_rename_at_45.y == 13)));
+	struct Foo3D __f3d_rename_at_53 = Foo3D_6738dc50d8097d17(__context__);
+	DAS_ASSERT((((__f3d_rename_at_53.x == 1) && (__f3d_rename_at_53.y == 1)) && (__f3d_rename_at_53.z == 3)));
+	das_invoke_function<void>::invoke<struct Foo &,int32_t,int32_t>(__context__,__f3d_rename_at_53.set,das_arg<struct Foo>::pass(das_cast<struct Foo>::cast(__f3d_rename_at_53)),1,2);
+	DAS_ASSERT((((__f3d_rename_at_53.x == 1) && (__f3d_rename_at_53.y == 2)) && (__f3d_rename_at_53.z == 0)));
+	das_copy(__f3d_rename_at_53.z,13);
+	das_invoke_function<void>::invoke<struct Foo &,int32_t,int32_t>(__context__,__f3d_rename_at_53.set,das_arg<struct Foo>::pass(das_cast<struct Foo>::cast(__f3d_rename_at_53)),3,4);
+	DAS_ASSERT((((__f3d_rename_at_53.x == 3) && (__f3d_rename_at_53.y == 4)) && (__f3d_rename_at_53.z == 0)));
+	DAS_ASSERT(((das_global<int32_t,0>(__context__) /*delFoo*/ == 0) && (das_global<int32_t,16>(__context__) /*delFoo3D*/ == 0)));
+	finalize_bf8c71d9ec82e898(__context__,das_arg<struct Foo>::pass(__f_rename_at_45));
+	DAS_ASSERT(((das_global<int32_t,0>(__context__) /*delFoo*/ == 1) && (das_global<int32_t,16>(__context__) /*delFoo3D*/ == 0)));
+	finalize_f561be252460fe45(__context__,das_arg<struct Foo3D>::pass(__f3d_rename_at_53));
+	DAS_ASSERT(((das_global<int32_t,0>(__context__) /*delFoo*/ == 2) && (das_global<int32_t,16>(__context__) /*delFoo3D*/ == 1)));
+	das_copy(das_global<int32_t,0>(__context__) /*delFoo*/,0);
+	das_copy(das_global<int32_t,16>(__context__) /*delFoo3D*/,0);
+}
+
+inline void test_foo_ptr_4bcd882bba99c5f6 ( Context * __context__ )
+{
+	struct Foo * __f_rename_at_69 = das_new<struct Foo>::make_and_init(__context__,[&]() { return Foo_e8d072653711740b(__context__); });
+	das_invoke_function<void>::invoke<struct Foo &>(__context__,__f_rename_at_69->ups,das_arg<struct Foo>::pass(das_cast<struct Foo>::cast(das_deref(__context__,__f_rename_at_69))));
+	DAS_ASSERT(((__f_rename_at_69->x == -1) && (__f_rename_at_69->y == -1)));
+	DAS_ASSERT(((das_global<int32_t,0>(__context__) /*delFoo*/ == 0) && (das_global<int32_t,16>(__context__) /*delFoo3D*/ == 0)));
+	finalize_2e7e2cdf44185f38(__context__,__f_rename_at_69);
+	DAS_ASSERT(((das_global<int32_t,0>(__context__) /*delFoo*/ == 1) && (das_global<int32_t,16>(__context__) /*delFoo3D*/ == 0)));
+	das_copy(__f_rename_at_69,das_cast<struct Foo *>::cast(das_new<struct Foo3D>::make_and_init(__context__,[&]() { return Foo3D_6738dc50d8097d17(__context__); })));
+	das_invoke_function<void>::invoke<struct Foo &>(__context__,__f_rename_at_69->ups,das_arg<struct Foo>::pass(das_cast<struct Foo>::cast(das_deref(__context__,__f_rename_at_69))));
+	DAS_ASSERT(((__f_rename_at_69->x == -2) && (__f_rename_at_69->y == -2)));
+	finalize_2e7e2cdf44185f38(__context__,__f_rename_at_69);
+	DAS_ASSERT(((das_global<int32_t,0>(__context__) /*delFoo*/ == 2) && (das_global<int32_t,16>(__context__) /*delFoo3D*/ == 1)));
+	das_copy(das_global<int32_t,0>(__context__) /*delFoo*/,0);
+	das_copy(das_global<int32_t,16>(__context__) /*delFoo3D*/,0);
+}
+
+inline void test_rtti_c9849baa59537243 ( Context * __context__ )
+{
+	struct Goo __g_rename_at_90 = Goo_f37fe1e15f10b0e5(__context__);
+	struct Foo __f_rename_at_91 = Foo_e8d072653711740b(__context__);
+	struct Foo __f2_rename_at_92 = Foo_e8d072653711740b(__context__);
+	struct Foo3D __f3d_rename_at_93 = Foo3D_6738dc50d8097d17(__context__);
+	struct Foo3D __f3d2_rename_at_94 = Foo3D_6738dc50d8097d17(__context__);
+	DAS_ASSERT((__f_rename_at_91.__rtti != __g_rename_at_90.__rtti));
+	DAS_ASSERT((__f3d_rename_at_93.__rtti != __g_rename_at_90.__rtti));
+	DAS_ASSERT((__f_rename_at_91.__rtti == __f2_rename_at_92.__rtti));
+	DAS_ASSERT((__f3d_rename_at_93.__rtti == __f3d2_rename_at_94.__rtti));
+	DAS_ASSERT((__f_rename_at_91.__rtti != __f3d_rename_at_93.__rtti));
+	DAS_ASSERT((_Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f_rename_at_91)) != _Funcrtti_0x60_class_info_3a6b5c778a051abf(__context__,das_arg<struct Goo>::pass(__g_rename_at_90))));
+	DAS_ASSERT((_Funcrtti_0x60_class_info_d06663e42b294af7(__context__,das_arg<struct Foo3D>::pass(__f3d_rename_at_93)) != _Funcrtti_0x60_class_info_3a6b5c778a051abf(__context__,das_arg<struct Goo>::pass(__g_rename_at_90))));
+	DAS_ASSERT((_Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f_rename_at_91)) == _Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f2_rename_at_92))));
+	DAS_ASSERT((_Funcrtti_0x60_class_info_d06663e42b294af7(__context__,das_arg<struct Foo3D>::pass(__f3d_rename_at_93)) == _Funcrtti_0x60_class_info_d06663e42b294af7(__context__,das_arg<struct Foo3D>::pass(__f3d2_rename_at_94))));
+	DAS_ASSERT((_Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f_rename_at_91)) != _Funcrtti_0x60_class_info_d06663e42b294af7(__context__,das_arg<struct Foo3D>::pass(__f3d_rename_at_93))));
+	DAS_VERIFY((isCompatibleCast(_Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f_rename_at_91)),_Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f_rename_at_91)))));
+	DAS_VERIFY((isCompatibleCast(_Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f_rename_at_91)),_Funcrtti_0x60_class_info_d06663e42b294af7(__context__,das_arg<struct Foo3D>::pass(__f3d_rename_at_93)))));
+	DAS_VERIFY((!isCompatibleCast(_Funcrtti_0x60_class_info_d06663e42b294af7(__context__,das_arg<struct Foo3D>::pass(__f3d_rename_at_93)),_Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f_rename_at_91)))));
+	DAS_VERIFY((!isCompatibleCast(_Funcrtti_0x60_class_info_3a6b5c778a051abf(__context__,das_arg<struct Goo>::pass(__g_rename_at_90)),_Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f_rename_at_91)))));
+	DAS_VERIFY((!isCompatibleCast(_Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f_rename_at_91)),_Funcrtti_0x60_class_info_3a6b5c778a051abf(__context__,das_arg<struct Goo>::pass(__g_rename_at_90)))));
+	DAS_VERIFY((!isCompatibleCast(_Funcrtti_0x60_class_info_3a6b5c778a051abf(__context__,das_arg<struct Goo>::pass(__g_rename_at_90)),_Funcrtti_0x60_class_info_d06663e42b294af7(__context__,das_arg<struct Foo3D>::pass(__f3d_rename_at_93)))));
+	DAS_VERIFY((!isCompatibleCast(_Funcrtti_0x60_class_info_d06663e42b294af7(__context__,das_arg<struct Foo3D>::pass(__f3d_rename_at_93)),_Funcrtti_0x60_class_info_3a6b5c778a051abf(__context__,das_arg<struct Goo>::pass(__g_rename_at_90)))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(_Funcrtti_0x60_class_info_f08791c5d34da4e4(__context__,das_arg<struct Foo>::pass(__f_rename_at_91))->name /*name*/),cast<char *>::from(((char *) "Foo")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(_Funcrtti_0x60_class_info_d06663e42b294af7(__context__,das_arg<struct Foo3D>::pass(__f3d_rename_at_93))->name /*name*/),cast<char *>::from(((char *) "Foo3D")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(_Funcrtti_0x60_class_info_3a6b5c778a051abf(__context__,das_arg<struct Goo>::pass(__g_rename_at_90))->name /*name*/),cast<char *>::from(((char *) "Goo")),*__context__)));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Foo_e8d072653711740b
+		aotLib[0x93ed8c390fe5f36c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__ ),&Foo_e8d072653711740b>>();
+	};
+		// Foo_fc93cbc8a4653bc2
+		aotLib[0xc3f08b0d72223fea] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__, int32_t  ),&Foo_fc93cbc8a4653bc2>>();
+	};
+		// Foo_af02f2255ab41e1a
+		aotLib[0x9a0bf65f6ac2351f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo (*) ( Context * __context__, int32_t , int32_t  ),&Foo_af02f2255ab41e1a>>();
+	};
+		// _FuncFoo_0x27___finalize_4cfc91126ecc41bb
+		aotLib[0x93b063a06a8e2410] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&_FuncFoo_0x27___finalize_4cfc91126ecc41bb>>();
+	};
+		// Foo3D_6738dc50d8097d17
+		aotLib[0x3ad66a7e251f4ffc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Foo3D (*) ( Context * __context__ ),&Foo3D_6738dc50d8097d17>>();
+	};
+		// _FuncFoo3D_0x27___finalize_9a49992a935060eb
+		aotLib[0xa885187952aefdae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo3D &  ),&_FuncFoo3D_0x27___finalize_9a49992a935060eb>>();
+	};
+		// _FuncFoo3D_0x60_Foo3D_eb94f27e1b16f8bf
+		aotLib[0x9178af75cc75bbba] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo3D &  ),&_FuncFoo3D_0x60_Foo3D_eb94f27e1b16f8bf>>();
+	};
+		// _FuncFoo3D_0x60_set_2ee1c44e279a3dca
+		aotLib[0x273c5e6c0a7f8448] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo3D & , int32_t , int32_t  ),&_FuncFoo3D_0x60_set_2ee1c44e279a3dca>>();
+	};
+		// _FuncFoo3D_0x60_ups_d1b83f1ce594f41
+		aotLib[0x8852d2928d1951b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo3D &  ),&_FuncFoo3D_0x60_ups_d1b83f1ce594f41>>();
+	};
+		// _FuncFoo_0x60_Foo_4be422c05b13d87
+		aotLib[0x34910bbfc74711c0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&_FuncFoo_0x60_Foo_4be422c05b13d87>>();
+	};
+		// _FuncFoo_0x60_Foo_4762ae02a69efb92
+		aotLib[0x6a99fca93ab8194d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo & , int32_t  ),&_FuncFoo_0x60_Foo_4762ae02a69efb92>>();
+	};
+		// _FuncFoo_0x60_Foo_c50f5ba6b4548486
+		aotLib[0xcd4dac13e0a77844] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo & , int32_t , int32_t  ),&_FuncFoo_0x60_Foo_c50f5ba6b4548486>>();
+	};
+		// _FuncFoo_0x60_set_8b8955cc4af67406
+		aotLib[0x59d63465931801f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo & , int32_t , int32_t  ),&_FuncFoo_0x60_set_8b8955cc4af67406>>();
+	};
+		// _FuncFoo_0x60_ups_66ee78088bcf21e1
+		aotLib[0xe0fe63e48a13dbd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&_FuncFoo_0x60_ups_66ee78088bcf21e1>>();
+	};
+		// Goo_f37fe1e15f10b0e5
+		aotLib[0x1d525bb98c3ead3a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Goo (*) ( Context * __context__ ),&Goo_f37fe1e15f10b0e5>>();
+	};
+		// _FuncGoo_0x27___finalize_756a7d0f5d6b03dd
+		aotLib[0xdd6a13fac07bc7f3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Goo &  ),&_FuncGoo_0x27___finalize_756a7d0f5d6b03dd>>();
+	};
+		// finalize_2e7e2cdf44185f38
+		aotLib[0x41e959ba7b6cdbe1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo * &  ),&finalize_2e7e2cdf44185f38>>();
+	};
+		// finalize_bf8c71d9ec82e898
+		aotLib[0x20104bdddcf28b19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo &  ),&finalize_bf8c71d9ec82e898>>();
+	};
+		// finalize_f561be252460fe45
+		aotLib[0xe1e8517179e48ec] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Foo3D &  ),&finalize_f561be252460fe45>>();
+	};
+		// finalize_60a6a4dd6ca8bfe4
+		aotLib[0xfe39d35a69e5d159] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Goo &  ),&finalize_60a6a4dd6ca8bfe4>>();
+	};
+		// _Funcrtti_0x60_class_info_f08791c5d34da4e4
+		aotLib[0x8b7462bcb7d76299] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct Foo const  &  ),&_Funcrtti_0x60_class_info_f08791c5d34da4e4>>();
+	};
+		// _Funcrtti_0x60_class_info_d06663e42b294af7
+		aotLib[0x32a08ebabf36f165] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct Foo3D const  &  ),&_Funcrtti_0x60_class_info_d06663e42b294af7>>();
+	};
+		// _Funcrtti_0x60_class_info_3a6b5c778a051abf
+		aotLib[0x16fa4403ad9f11ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, struct Goo const  &  ),&_Funcrtti_0x60_class_info_3a6b5c778a051abf>>();
+	};
+		// test_359b249487062ce3
+		aotLib[0xc9d22ce8e6f3f1bc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_359b249487062ce3>>();
+	};
+		// test_foo_c5b296c22f5a8113
+		aotLib[0xb2450091ec5eb88c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_foo_c5b296c22f5a8113>>();
+	};
+		// test_foo_ptr_4bcd882bba99c5f6
+		aotLib[0x7603850ee0a1ee61] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_foo_ptr_4bcd882bba99c5f6>>();
+	};
+		// test_rtti_c9849baa59537243
+		aotLib[0xff2711a769cf6603] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_rtti_c9849baa59537243>>();
+	};
+		// [[ init script ]]
+		aotLib[0xe55c096c6de0df9a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,142 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct iVec2 {
+	int32_t x;
+	int32_t y;
+};
+static_assert(sizeof(iVec2)==8,"structure size mismatch with DAS");
+static_assert(offsetof(iVec2,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(iVec2,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline struct iVec2 _FuncAdd_a751448c701bf1c4 ( Context * __context__, struct iVec2 const  & __a_rename_at_12, struct iVec2 const  & __b_rename_at_12 );
+inline struct iVec2 _FuncSub_db0044b9b9db12b0 ( Context * __context__, struct iVec2 const  & __a_rename_at_9 );
+inline bool _FuncEquEqu_7c2624703460d76f ( Context * __context__, struct iVec2 const  & __a_rename_at_15, struct iVec2 const  & __b_rename_at_15 );
+inline struct iVec2 iVec2_7585330c07b35e1b ( Context * __context__, int32_t __X_rename_at_6, int32_t __Y_rename_at_6 );
+inline bool test_21612b9d3b211023 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline struct iVec2 _FuncAdd_a751448c701bf1c4 ( Context * __context__, struct iVec2 const  &  __a_rename_at_12, struct iVec2 const  &  __b_rename_at_12 )
+{
+	return (([&]() -> struct iVec2 {
+		struct iVec2 __mks_13;
+		das_copy((__mks_13.x),((__a_rename_at_12.x + __b_rename_at_12.x)));
+		das_copy((__mks_13.y),((__a_rename_at_12.y + __b_rename_at_12.y)));
+		return __mks_13;
+	})());
+}
+
+inline struct iVec2 _FuncSub_db0044b9b9db12b0 ( Context * __context__, struct iVec2 const  &  __a_rename_at_9 )
+{
+	return (([&]() -> struct iVec2 {
+		struct iVec2 __mks_10;
+		das_copy((__mks_10.x),(-(__a_rename_at_9.x)));
+		das_copy((__mks_10.y),(-(__a_rename_at_9.y)));
+		return __mks_10;
+	})());
+}
+
+inline bool _FuncEquEqu_7c2624703460d76f ( Context * __context__, struct iVec2 const  &  __a_rename_at_15, struct iVec2 const  &  __b_rename_at_15 )
+{
+	return (__a_rename_at_15.x == __b_rename_at_15.x) && (__a_rename_at_15.y == __b_rename_at_15.y);
+}
+
+inline struct iVec2 iVec2_7585330c07b35e1b ( Context * __context__, int32_t __X_rename_at_6, int32_t __Y_rename_at_6 )
+{
+	return (([&]() -> struct iVec2 {
+		struct iVec2 __mks_7;
+		das_copy((__mks_7.x),(__X_rename_at_6));
+		das_copy((__mks_7.y),(__Y_rename_at_6));
+		return __mks_7;
+	})());
+}
+
+inline bool test_21612b9d3b211023 ( Context * __context__ )
+{
+	struct iVec2 _temp_make_local_22_80;
+	struct iVec2 _temp_make_local_23_112;
+	struct iVec2 __a_rename_at_20 = (struct iVec2)iVec2_7585330c07b35e1b(__context__,4,5);
+	struct iVec2 __b_rename_at_21 = (struct iVec2)iVec2_7585330c07b35e1b(__context__,6,7);
+	DAS_ASSERT((_FuncEquEqu_7c2624703460d76f(__context__,das_arg<struct iVec2>::pass(_FuncSub_db0044b9b9db12b0(__context__,__a_rename_at_20)),das_arg<struct iVec2>::pass((_temp_make_local_22_80 = (iVec2_7585330c07b35e1b(__context__,-4,-5)))))));
+	DAS_ASSERT((_FuncEquEqu_7c2624703460d76f(__context__,das_arg<struct iVec2>::pass((_FuncAdd_a751448c701bf1c4(__context__,__a_rename_at_20,__b_rename_at_21))),das_arg<struct iVec2>::pass((_temp_make_local_23_112 = (iVec2_7585330c07b35e1b(__context__,10,12)))))));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _FuncAdd_a751448c701bf1c4
+		aotLib[0x99f799586a5451dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct iVec2 (*) ( Context * __context__, struct iVec2 const  & , struct iVec2 const  &  ),&_FuncAdd_a751448c701bf1c4>>();
+	};
+		// _FuncSub_db0044b9b9db12b0
+		aotLib[0x96177e98f3607f45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct iVec2 (*) ( Context * __context__, struct iVec2 const  &  ),&_FuncSub_db0044b9b9db12b0>>();
+	};
+		// _FuncEquEqu_7c2624703460d76f
+		aotLib[0xf9e8b3fdcc8251ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct iVec2 const  & , struct iVec2 const  &  ),&_FuncEquEqu_7c2624703460d76f>>();
+	};
+		// iVec2_7585330c07b35e1b
+		aotLib[0x51b68b336afb445] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct iVec2 (*) ( Context * __context__, int32_t , int32_t  ),&iVec2_7585330c07b35e1b>>();
+	};
+		// test_21612b9d3b211023
+		aotLib[0x93fd8fdf7d2bc197] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_21612b9d3b211023>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
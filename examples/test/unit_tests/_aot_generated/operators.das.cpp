@@ -0,0 +1,108 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline int32_t charg_d7e95b6a4a194908 ( Context * __context__, int32_t __t_rename_at_1 );
+inline void chref_618d41771d76b63e ( Context * __context__, int32_t & __t_rename_at_5 );
+inline bool test_f9d3aad0901743cc ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t charg_d7e95b6a4a194908 ( Context * __context__, int32_t __t_rename_at_1 )
+{
+	__t_rename_at_1++;
+	return __t_rename_at_1;
+}
+
+inline void chref_618d41771d76b63e ( Context * __context__, int32_t & __t_rename_at_5 )
+{
+	__t_rename_at_5++;
+	++__t_rename_at_5;
+	__t_rename_at_5--;
+}
+
+inline bool test_f9d3aad0901743cc ( Context * __context__ )
+{
+	int32_t __y_rename_at_13 = 0;
+	das_copy(__y_rename_at_13,charg_d7e95b6a4a194908(__context__,1));
+	DAS_ASSERT((true && (__y_rename_at_13 == 2)));
+	chref_618d41771d76b63e(__context__,__y_rename_at_13);
+	DAS_ASSERT((__y_rename_at_13 == 3));
+	int32_t __a_rename_at_19 = 0; int32_t __b_rename_at_19 = 0; int32_t __c_rename_at_19 = 0;
+	das_copy(__a_rename_at_19,1);
+	DAS_ASSERT(((__a_rename_at_19 == 1) && (__b_rename_at_19 == 0)));
+	das_copy(__b_rename_at_19,2);
+	DAS_ASSERT(((__a_rename_at_19 == 1) && (__b_rename_at_19 == 2)));
+	__c_rename_at_19++;
+	DAS_ASSERT((__c_rename_at_19 == 1));
+	__c_rename_at_19++;
+	DAS_ASSERT((__c_rename_at_19 == 2));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// charg_d7e95b6a4a194908
+		aotLib[0xd6aeefcab3ae4411] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&charg_d7e95b6a4a194908>>();
+	};
+		// chref_618d41771d76b63e
+		aotLib[0x4f29a36424b221] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t &  ),&chref_618d41771d76b63e>>();
+	};
+		// test_f9d3aad0901743cc
+		aotLib[0x6dad4c588d7b296d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f9d3aad0901743cc>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,83 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline bool test_342e1c393518bc04 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_342e1c393518bc04 ( Context * __context__ )
+{
+	TDim<int32_t,5> __t_rename_at_3 = (TDim<int32_t,5>)(([&]() -> TDim<int32_t,5> {
+		TDim<int32_t,5> __mka_3;
+		__mka_3(0,__context__) = 1;
+		__mka_3(1,__context__) = 2;
+		__mka_3(2,__context__) = 3;
+		__mka_3(3,__context__) = 4;
+		__mka_3(4,__context__) = 5;
+		return __mka_3;
+	})());
+	int32_t const  * __pt_rename_at_5 = (int32_t const  *)das_ref(__context__,__t_rename_at_3(0,__context__));
+	DAS_ASSERT((das_deref(__context__,__pt_rename_at_5) == 1));
+	DAS_ASSERT((((((das_index<int32_t const  * const >::at(__pt_rename_at_5,0,__context__) == 1) && (das_index<int32_t const  * const >::at(__pt_rename_at_5,1,__context__) == 2)) && (das_index<int32_t const  * const >::at(__pt_rename_at_5,2,__context__) == 3)) && (das_index<int32_t const  * const >::at(__pt_rename_at_5,3,__context__) == 4)) && (das_index<int32_t const  * const >::at(__pt_rename_at_5,4,__context__) == 5)));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_342e1c393518bc04
+		aotLib[0x73022c1257897fbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_342e1c393518bc04>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
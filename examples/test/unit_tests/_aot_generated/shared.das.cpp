@@ -0,0 +1,163 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__fcd8c07c;
+extern FuncInfo __func_info__aec5b1d4;
+
+VarInfo __func_info__aec5b1d4_field_0 =  { Type::tTable, nullptr, nullptr, nullptr, &__type_info__17c16538, &__type_info__95e97e5e, nullptr, nullptr, 0, 0, nullptr, 98, 0xfcd8c07c, "foo", 0 };
+VarInfo * __func_info__aec5b1d4_fields[1] =  { &__func_info__aec5b1d4_field_0 };
+FuncInfo __func_info__aec5b1d4 = {"invoke block<(foo:table<string;int> const#):void> const", "", __func_info__aec5b1d4_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xaec5b1d4, 0x0 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline int32_t const  * _Funcbuiltin_0x60_find_1a54453ad53f361e ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_159, char * const  __at_rename_at_159 );
+inline void _Funcbuiltin_0x60_lock_6f9a904c7ea7ebe6 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_301, Block DAS_COMMENT((void,TTable<char *,int32_t> const )) const  & __blk_rename_at_301 );
+inline void _Funcbuiltin_0x60_reserve_7b63605b74776272 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_37, int32_t __newSize_rename_at_37 );
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_8ffea931442adc15 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> & __a_rename_at_419 );
+inline bool test_b6c20d49435b451 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_2_32;
+	if ( __init_shared ) das_shared<TTable<char *,int32_t>,0>(__context__) = _Funcbuiltin_0x60_to_table_move_8ffea931442adc15(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+		_temp_make_local_2_32(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_2;
+			das_get_tuple_field<char *,0>::get(__mkt_2) = ((char *) "one");
+			das_get_tuple_field<int32_t,8>::get(__mkt_2) = 1;
+			return __mkt_2;
+		})());
+		_temp_make_local_2_32(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_2;
+			das_get_tuple_field<char *,0>::get(__mkt_2) = ((char *) "two");
+			das_get_tuple_field<int32_t,8>::get(__mkt_2) = 2;
+			return __mkt_2;
+		})());
+		return _temp_make_local_2_32;
+	})())));/*g_foo*/
+}
+
+inline int32_t const  * _Funcbuiltin_0x60_find_1a54453ad53f361e ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_159, char * const  __at_rename_at_159 )
+{
+	return das_cast<int32_t const  *>::cast(__builtin_table_find(__context__,__Tab_rename_at_159,__at_rename_at_159));
+}
+
+inline void _Funcbuiltin_0x60_lock_6f9a904c7ea7ebe6 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_301, Block DAS_COMMENT((void,TTable<char *,int32_t> const )) const  &  __blk_rename_at_301 )
+{
+	builtin_table_lock(__Tab_rename_at_301,__context__);
+	das_invoke<void>::invoke<TTable<char *,int32_t> const  &>(__context__,__blk_rename_at_301,das_cast<TTable<char *,int32_t> const >::cast(__Tab_rename_at_301));
+	builtin_table_unlock(__Tab_rename_at_301,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_7b63605b74776272 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_37, int32_t __newSize_rename_at_37 )
+{
+	builtin_table_reserve(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_37),__newSize_rename_at_37,8,4,__context__);
+}
+
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_8ffea931442adc15 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  __a_rename_at_419 )
+{
+	TTable<char *,int32_t> __tab_rename_at_420; das_zero(__tab_rename_at_420);
+	_Funcbuiltin_0x60_reserve_7b63605b74776272(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_420),2);
+	{
+		bool __need_loop_423 = true;
+		// x : tuple<string aka keyT;int aka valT>&
+		das_iterator<TDim<TTuple<16,char *,int32_t>,2>> __x_iterator(__a_rename_at_419);
+		TTuple<16,char *,int32_t> * __x_rename_at_423;
+		__need_loop_423 = __x_iterator.first(__context__,(__x_rename_at_423)) && __need_loop_423;
+		for ( ; __need_loop_423 ; __need_loop_423 = __x_iterator.next(__context__,(__x_rename_at_423)) )
+		{
+			das_copy(__tab_rename_at_420(das_get_tuple_field<char *,0>::get((*__x_rename_at_423)),__context__),das_get_tuple_field<int32_t,8>::get((*__x_rename_at_423)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_423));
+	};
+	return /* <- */ __tab_rename_at_420;
+}
+
+inline bool test_b6c20d49435b451 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"test " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_lock_6f9a904c7ea7ebe6(__context__,das_shared<TTable<char *,int32_t>,0>(__context__) /*g_foo*/,das_make_block<void,TTable<char *,int32_t> const  &>(__context__,80,0,&__func_info__aec5b1d4,[&](TTable<char *,int32_t> const  & __foo_rename_at_6)->void{
+		DAS_ASSERT((das_null_coalescing<int32_t>::get(_Funcbuiltin_0x60_find_1a54453ad53f361e(__context__,__foo_rename_at_6,((char *) "one")),0) == 1));
+		DAS_ASSERT((das_null_coalescing<int32_t>::get(_Funcbuiltin_0x60_find_1a54453ad53f361e(__context__,__foo_rename_at_6,((char *) "two")),0) == 2));
+		DAS_ASSERT((das_null_coalescing<int32_t>::get(_Funcbuiltin_0x60_find_1a54453ad53f361e(__context__,__foo_rename_at_6,((char *) "three")),0) == 0));
+	}));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_find_1a54453ad53f361e
+		aotLib[0x5ea1ad863c07e7f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t const  * (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const   ),&_Funcbuiltin_0x60_find_1a54453ad53f361e>>();
+	};
+		// _Funcbuiltin_0x60_lock_6f9a904c7ea7ebe6
+		aotLib[0xd1419f3f2b8c5079] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> const  & , Block DAS_COMMENT((void,TTable<char *,int32_t> const )) const  &  ),&_Funcbuiltin_0x60_lock_6f9a904c7ea7ebe6>>();
+	};
+		// _Funcbuiltin_0x60_reserve_7b63605b74776272
+		aotLib[0xf8e41cf7a57fff11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_7b63605b74776272>>();
+	};
+		// _Funcbuiltin_0x60_to_table_move_8ffea931442adc15
+		aotLib[0xb8552006656e012f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<char *,int32_t> (*) ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  ),&_Funcbuiltin_0x60_to_table_move_8ffea931442adc15>>();
+	};
+		// test_b6c20d49435b451
+		aotLib[0xfbe58a89b9add62b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b6c20d49435b451>>();
+	};
+		// [[ init script ]]
+		aotLib[0x93a098d4fc9ecb46] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
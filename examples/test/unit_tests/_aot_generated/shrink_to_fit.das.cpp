@@ -0,0 +1,362 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_1[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_2[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_3[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_4[1] = { &__type_info__359c1b32 };
+
+inline bool _Funcbuiltin_0x60_erase_2fe748d6b7f7e64f ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_180, int32_t __at_rename_at_180 );
+inline bool _Funcbuiltin_0x60_erase_ea0fa82112615e17 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_180, char * const  __at_rename_at_180 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_744968e0d1038eaa ( Context * __context__, TTable<int32_t,char *> & __a_rename_at_292 );
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_292 );
+inline bool _Funcbuiltin_0x60_key_exists_15443fb42e29cfbb ( Context * __context__, TTable<int32_t,char *> const  & __Tab_rename_at_183, int32_t __at_rename_at_183 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_shrink_to_fit_44b84c76466d016b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_29 );
+inline void _Funcbuiltin_0x60_shrink_to_fit_28af569ab3aeefc2 ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_33 );
+inline void _Funcbuiltin_0x60_shrink_to_fit_33b6ea4f53a96326 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_33 );
+inline void check_array_shrink_808be9396170ce25 ( Context * __context__ );
+inline void check_string_keys_7072b637ccc17f5c ( Context * __context__ );
+inline void check_table_shrink_7f9ec43c098a2bff ( Context * __context__ );
+inline bool test_de35b10608480e8f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Funcbuiltin_0x60_erase_2fe748d6b7f7e64f ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_180, int32_t __at_rename_at_180 )
+{
+	return __builtin_table_erase(__context__,__Tab_rename_at_180,__at_rename_at_180);
+}
+
+inline bool _Funcbuiltin_0x60_erase_ea0fa82112615e17 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_180, char * const  __at_rename_at_180 )
+{
+	return __builtin_table_erase(__context__,__Tab_rename_at_180,__at_rename_at_180);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_744968e0d1038eaa ( Context * __context__, TTable<int32_t,char *> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,char *>>::pass(__a_rename_at_292),4,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_292),8,4,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_15443fb42e29cfbb ( Context * __context__, TTable<int32_t,char *> const  &  __Tab_rename_at_183, int32_t __at_rename_at_183 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_183,__at_rename_at_183);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_shrink_to_fit_44b84c76466d016b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_29 )
+{
+	builtin_array_shrink(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_29),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_shrink_to_fit_28af569ab3aeefc2 ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_33 )
+{
+	builtin_table_shrink(das_arg<TTable<int32_t,char *>>::pass(__Tab_rename_at_33),4,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_shrink_to_fit_33b6ea4f53a96326 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_33 )
+{
+	builtin_table_shrink(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_33),8,4,__context__);
+}
+
+inline void check_array_shrink_808be9396170ce25 ( Context * __context__ )
+{
+	TArray<int32_t> __a_rename_at_2; das_zero(__a_rename_at_2);
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_2),1000);
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_2),__i_rename_at_4,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	DAS_ASSERT((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__a_rename_at_2)) >= 1000));
+	_Funcbuiltin_0x60_shrink_to_fit_44b84c76466d016b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_2));
+	DAS_ASSERT((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__a_rename_at_2)) == 10));
+	{
+		bool __need_loop_9 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_9;
+		__need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9)) && __need_loop_9;
+		for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9)) )
+		{
+			DAS_ASSERT((__a_rename_at_2(__i_rename_at_9,__context__) == __i_rename_at_9));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_9));
+	};
+	builtin_array_clear(das_arg<TArray<int32_t>>::pass(__a_rename_at_2),__context__);
+	_Funcbuiltin_0x60_shrink_to_fit_44b84c76466d016b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_2));
+	DAS_ASSERT((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__a_rename_at_2)) == 0));
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_2),13,-1);
+	DAS_ASSERT((__a_rename_at_2(0,__context__) == 13));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_2));
+}
+
+inline void check_string_keys_7072b637ccc17f5c ( Context * __context__ )
+{
+	TTable<char *,int32_t> __t_rename_at_44; das_zero(__t_rename_at_44);
+	{
+		bool __need_loop_45 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_45;
+		__need_loop_45 = __i_iterator.first(__context__,(__i_rename_at_45)) && __need_loop_45;
+		for ( ; __need_loop_45 ; __need_loop_45 = __i_iterator.next(__context__,(__i_rename_at_45)) )
+		{
+			das_copy(__t_rename_at_44(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "key")), cast<int32_t>::from(__i_rename_at_45))),__context__),__i_rename_at_45);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_45));
+	};
+	{
+		bool __need_loop_47 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,990));
+		int32_t __i_rename_at_47;
+		__need_loop_47 = __i_iterator.first(__context__,(__i_rename_at_47)) && __need_loop_47;
+		for ( ; __need_loop_47 ; __need_loop_47 = __i_iterator.next(__context__,(__i_rename_at_47)) )
+		{
+			_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__t_rename_at_44),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "key")), cast<int32_t>::from(__i_rename_at_47))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_47));
+	};
+	_Funcbuiltin_0x60_shrink_to_fit_33b6ea4f53a96326(__context__,das_arg<TTable<char *,int32_t>>::pass(__t_rename_at_44));
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__t_rename_at_44)) == 10));
+	{
+		bool __need_loop_51 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(990,1000));
+		int32_t __i_rename_at_51;
+		__need_loop_51 = __i_iterator.first(__context__,(__i_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __i_iterator.next(__context__,(__i_rename_at_51)) )
+		{
+			DAS_ASSERT((__t_rename_at_44(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char *) "key")), cast<int32_t>::from(__i_rename_at_51))),__context__) == __i_rename_at_51));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_51));
+	};
+	_Funcbuiltin_0x60_finalize_bb3702af962b623e(__context__,das_arg<TTable<char *,int32_t>>::pass(__t_rename_at_44));
+}
+
+inline void check_table_shrink_7f9ec43c098a2bff ( Context * __context__ )
+{
+	TTable<int32_t,char *> __t_rename_at_19; das_zero(__t_rename_at_19);
+	{
+		bool __need_loop_20 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_20;
+		__need_loop_20 = __i_iterator.first(__context__,(__i_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __i_iterator.next(__context__,(__i_rename_at_20)) )
+		{
+			das_copy(__t_rename_at_19(__i_rename_at_20,__context__),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_3, cast<int32_t>::from(__i_rename_at_20))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_20));
+	};
+	int32_t __big_rename_at_22 = (int32_t)builtin_table_capacity(das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19));
+	{
+		bool __need_loop_23 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_23;
+		__need_loop_23 = __i_iterator.first(__context__,(__i_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __i_iterator.next(__context__,(__i_rename_at_23)) )
+		{
+			if ( (SimPolicy<int32_t>::Mod(__i_rename_at_23,100,*__context__)) != 0 )
+			{
+				_Funcbuiltin_0x60_erase_2fe748d6b7f7e64f(__context__,das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19),__i_rename_at_23);
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_23));
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19)) == 100));
+	_Funcbuiltin_0x60_shrink_to_fit_28af569ab3aeefc2(__context__,das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19));
+	DAS_ASSERT((builtin_table_capacity(das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19)) < __big_rename_at_22));
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19)) == 100));
+	{
+		bool __need_loop_30 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_30;
+		__need_loop_30 = __i_iterator.first(__context__,(__i_rename_at_30)) && __need_loop_30;
+		for ( ; __need_loop_30 ; __need_loop_30 = __i_iterator.next(__context__,(__i_rename_at_30)) )
+		{
+			if ( (SimPolicy<int32_t>::Mod(__i_rename_at_30,100,*__context__)) == 0 )
+			{
+				DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__t_rename_at_19(__i_rename_at_30,__context__)),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_4, cast<int32_t>::from(__i_rename_at_30)))),*__context__)));
+			} else {
+				DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_15443fb42e29cfbb(__context__,das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19),__i_rename_at_30)));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_30));
+	};
+	{
+		bool __need_loop_35 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_35;
+		__need_loop_35 = __i_iterator.first(__context__,(__i_rename_at_35)) && __need_loop_35;
+		for ( ; __need_loop_35 ; __need_loop_35 = __i_iterator.next(__context__,(__i_rename_at_35)) )
+		{
+			_Funcbuiltin_0x60_erase_2fe748d6b7f7e64f(__context__,das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19),__i_rename_at_35 * 100);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_35));
+	};
+	_Funcbuiltin_0x60_shrink_to_fit_28af569ab3aeefc2(__context__,das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19));
+	DAS_ASSERT((builtin_table_capacity(das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19)) == 0));
+	das_copy(__t_rename_at_19(1,__context__),((char *) "one"));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__t_rename_at_19(1,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+	_Funcbuiltin_0x60_finalize_744968e0d1038eaa(__context__,das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_19));
+}
+
+inline bool test_de35b10608480e8f ( Context * __context__ )
+{
+	check_array_shrink_808be9396170ce25(__context__);
+	check_table_shrink_7f9ec43c098a2bff(__context__);
+	check_string_keys_7072b637ccc17f5c(__context__);
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_erase_2fe748d6b7f7e64f
+		aotLib[0x7edbc9e745909b81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,char *> & , int32_t  ),&_Funcbuiltin_0x60_erase_2fe748d6b7f7e64f>>();
+	};
+		// _Funcbuiltin_0x60_erase_ea0fa82112615e17
+		aotLib[0x76b7d93e69aa6db5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> & , char * const   ),&_Funcbuiltin_0x60_erase_ea0fa82112615e17>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_744968e0d1038eaa
+		aotLib[0xf88941018b676dd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,char *> &  ),&_Funcbuiltin_0x60_finalize_744968e0d1038eaa>>();
+	};
+		// _Funcbuiltin_0x60_finalize_bb3702af962b623e
+		aotLib[0x47ccc641525eada1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Funcbuiltin_0x60_finalize_bb3702af962b623e>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_15443fb42e29cfbb
+		aotLib[0x9edf105fa7d9a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,char *> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_15443fb42e29cfbb>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_shrink_to_fit_44b84c76466d016b
+		aotLib[0x3d1b84436369355] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_shrink_to_fit_44b84c76466d016b>>();
+	};
+		// _Funcbuiltin_0x60_shrink_to_fit_28af569ab3aeefc2
+		aotLib[0xcf3728115785c6d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,char *> &  ),&_Funcbuiltin_0x60_shrink_to_fit_28af569ab3aeefc2>>();
+	};
+		// _Funcbuiltin_0x60_shrink_to_fit_33b6ea4f53a96326
+		aotLib[0x5634197f322a79a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Funcbuiltin_0x60_shrink_to_fit_33b6ea4f53a96326>>();
+	};
+		// check_array_shrink_808be9396170ce25
+		aotLib[0xc1539f23ab0ec9e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_array_shrink_808be9396170ce25>>();
+	};
+		// check_string_keys_7072b637ccc17f5c
+		aotLib[0xd1b87696ee8053fc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_string_keys_7072b637ccc17f5c>>();
+	};
+		// check_table_shrink_7f9ec43c098a2bff
+		aotLib[0xa2fd5b6c3a926663] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_table_shrink_7f9ec43c098a2bff>>();
+	};
+		// test_de35b10608480e8f
+		aotLib[0x681245528d8bfe94] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_de35b10608480e8f>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,730 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__1571c7f6;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__447a20fe;
+extern TypeInfo __type_info__5c3407e6;
+extern VarInfo __var_info__651ec3c3;
+extern VarInfo __var_info__bb6aa219;
+extern VarInfo __var_info__4289cd92;
+
+TypeInfo * __type_info__651ec3c3_arg_types_var_359778294[2] = { &__type_info__5c3407e6, &__type_info__e6eb6b88 };
+VarInfo __struct_info__1571c7f6_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__651ec3c3_arg_types_var_359778294, nullptr, 2, 0, nullptr, 28, 0x651ec3c3, "__lambda", 0 };
+TypeInfo * __type_info__4289cd92_arg_types_var_359778294[1] = { &__type_info__447a20fe };
+VarInfo __struct_info__1571c7f6_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4289cd92_arg_types_var_359778294, nullptr, 1, 0, nullptr, 28, 0x4289cd92, "__finalize", 4 };
+VarInfo __struct_info__1571c7f6_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xbb6aa219, "__yield", 8 };
+VarInfo * __struct_info__1571c7f6_fields[3] =  { &__struct_info__1571c7f6_field_0, &__struct_info__1571c7f6_field_1, &__struct_info__1571c7f6_field_2 };
+StructInfo __struct_info__1571c7f6 = {"_lambda_thismodule_24_8_1", __struct_info__1571c7f6_fields, 3, 12, -1, nullptr, 0x1571c7f6 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x13667ab1 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2333, 0xe6eb6b88 };
+TypeInfo __type_info__447a20fe = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5c3407e6, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x447a20fe };
+TypeInfo __type_info__5c3407e6 = { Type::tStructure, &__struct_info__1571c7f6, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x5c3407e6 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__359c1b32 };
+namespace  {
+
+struct _lambda_thismodule_24_8_1 {
+	Func DAS_COMMENT((bool,struct _lambda_thismodule_24_8_1,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,struct _lambda_thismodule_24_8_1 *)) __finalize;
+	int32_t __yield;
+};
+static_assert(sizeof(_lambda_thismodule_24_8_1)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_24_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_24_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_24_8_1,__yield)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_24_8_1_0x60_finazlier_43a45d1b17f9977a ( Context * __context__, struct _lambda_thismodule_24_8_1 * ____this_rename_at_24 );
+inline bool _Func_lambda_thismodule_24_8_1_0x60_function_2f953ef4fab838a ( Context * __context__, struct _lambda_thismodule_24_8_1 & ____this_rename_at_24, int32_t & ___yield_24_rename_at_24 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_353 );
+inline Sequence DAS_COMMENT((char * &)) _Funcbuiltin_0x60_each_9d5e3afe62c831b5 ( Context * __context__, TArray<char *> const  & __a_rename_at_353 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_33c0304c72a278e3 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_292 );
+inline void _Funcbuiltin_0x60_finalize_744968e0d1038eaa ( Context * __context__, TTable<int32_t,char *> & __a_rename_at_292 );
+inline int32_t _Funcbuiltin_0x60_min_size_hint_f9c982fa6ae37825 ( Context * __context__, int32_t __a_rename_at_134, int32_t __b_rename_at_134 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> & __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_clone_8f1b55668745e84b ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_reserve_1a8b399fcef6fa4c ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_37, int32_t __newSize_rename_at_37 );
+inline void _Funcbuiltin_0x60_reserve_224e7011ac915236 ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_37, int32_t __newSize_rename_at_37 );
+inline int32_t _Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_122 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_e7337cf490aef504 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_379 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_699eeb328f6c894e ( Context * __context__, Sequence DAS_COMMENT((char * &)) const  & __it_rename_at_379 );
+inline TTable<int32_t,char *> _Funcbuiltin_0x60_to_table_e184fe73d65c6744 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  & __a_rename_at_412 );
+inline void finalize_796a1dc62300a282 ( Context * __context__, struct _lambda_thismodule_24_8_1 & ____this_rename_at_24 );
+inline bool test_efa6f262a24b2858 ( Context * __context__ );
+inline void test_comprehension_d7aeeebfc97413ea ( Context * __context__ );
+inline void test_hints_f242c17a646e7217 ( Context * __context__ );
+inline void test_table_752b1c1a31e29b06 ( Context * __context__ );
+inline void test_to_array_6a3af09f45404f59 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_24_8_1_0x60_finazlier_43a45d1b17f9977a ( Context * __context__, struct _lambda_thismodule_24_8_1 * ____this_rename_at_24 )
+{
+	finalize_796a1dc62300a282(__context__,das_arg<struct _lambda_thismodule_24_8_1>::pass(das_deref(__context__,____this_rename_at_24)));
+	das_delete_lambda_struct<struct _lambda_thismodule_24_8_1 *>::clear(__context__,____this_rename_at_24);
+}
+
+inline bool _Func_lambda_thismodule_24_8_1_0x60_function_2f953ef4fab838a ( Context * __context__, struct _lambda_thismodule_24_8_1 &  ____this_rename_at_24, int32_t & ___yield_24_rename_at_24 )
+{
+	switch (____this_rename_at_24.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(___yield_24_rename_at_24,1);
+	das_copy(____this_rename_at_24.__yield,1);
+	return true;
+	label_1:;;
+	return false;
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_353 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_354; das_zero(__it_rename_at_354);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_354),__a_rename_at_353,4,__context__);
+	return /* <- */ __it_rename_at_354;
+}
+
+inline Sequence DAS_COMMENT((char * &)) _Funcbuiltin_0x60_each_9d5e3afe62c831b5 ( Context * __context__, TArray<char *> const  &  __a_rename_at_353 )
+{
+	Sequence DAS_COMMENT((char * *)) __it_rename_at_354; das_zero(__it_rename_at_354);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_354),__a_rename_at_353,8,__context__);
+	return /* <- */ __it_rename_at_354;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_33c0304c72a278e3 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_358 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_360; das_zero(__it_rename_at_360);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_360),__lam_rename_at_358,__context__);
+	return /* <- */ __it_rename_at_360;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_334; das_zero(__it_rename_at_334);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_334),__rng_rename_at_333,__context__);
+	return /* <- */ __it_rename_at_334;
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_292),4,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_744968e0d1038eaa ( Context * __context__, TTable<int32_t,char *> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,char *>>::pass(__a_rename_at_292),4,8,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_min_size_hint_f9c982fa6ae37825 ( Context * __context__, int32_t __a_rename_at_134, int32_t __b_rename_at_134 )
+{
+	return (__a_rename_at_134 < __b_rename_at_134) ? (__a_rename_at_134) : (__b_rename_at_134);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> &  __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<char *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_8f1b55668745e84b ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),__at_rename_at_75,8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<char *>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_1a8b399fcef6fa4c ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_37, int32_t __newSize_rename_at_37 )
+{
+	builtin_table_reserve(das_arg<TTable<int32_t,int32_t>>::pass(__Tab_rename_at_37),__newSize_rename_at_37,4,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_224e7011ac915236 ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_37, int32_t __newSize_rename_at_37 )
+{
+	builtin_table_reserve(das_arg<TTable<int32_t,char *>>::pass(__Tab_rename_at_37),__newSize_rename_at_37,4,8,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_122 )
+{
+	return builtin_array_size(__a_rename_at_122);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_e7337cf490aef504 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_379 )
+{
+	TArray<int32_t> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_380),__it_rename_at_379,4,false,__context__);
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_699eeb328f6c894e ( Context * __context__, Sequence DAS_COMMENT((char * &)) const  &  __it_rename_at_379 )
+{
+	TArray<char *> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	int32_t __hint_rename_at_384 = (int32_t)builtin_iterator_size_hint(__it_rename_at_379);
+	if ( __hint_rename_at_384 > 0 )
+	{
+		_Funcbuiltin_0x60_reserve_cecea833d1e66117(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_380),__hint_rename_at_384);
+	};
+	{
+		bool __need_loop_387 = true;
+		// x : string aka TT const&
+		das_iterator<Sequence DAS_COMMENT((char *)) const > __x_iterator(__it_rename_at_379);
+		char * const  * __x_rename_at_387;
+		__need_loop_387 = __x_iterator.first(__context__,(__x_rename_at_387)) && __need_loop_387;
+		for ( ; __need_loop_387 ; __need_loop_387 = __x_iterator.next(__context__,(__x_rename_at_387)) )
+		{
+			_Funcbuiltin_0x60_push_clone_8f1b55668745e84b(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_380),(*__x_rename_at_387),-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_387));
+	};
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TTable<int32_t,char *> _Funcbuiltin_0x60_to_table_e184fe73d65c6744 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  &  __a_rename_at_412 )
+{
+	TTable<int32_t,char *> __tab_rename_at_413; das_zero(__tab_rename_at_413);
+	_Funcbuiltin_0x60_reserve_224e7011ac915236(__context__,das_arg<TTable<int32_t,char *>>::pass(__tab_rename_at_413),3);
+	{
+		bool __need_loop_415 = true;
+		// x : tuple<int aka keyT;string aka valT> const&
+		das_iterator<TDim<TTuple<16,int32_t,char *>,3> const > __x_iterator(__a_rename_at_412);
+		TTuple<16,int32_t,char *> const  * __x_rename_at_415;
+		__need_loop_415 = __x_iterator.first(__context__,(__x_rename_at_415)) && __need_loop_415;
+		for ( ; __need_loop_415 ; __need_loop_415 = __x_iterator.next(__context__,(__x_rename_at_415)) )
+		{
+			das_copy(__tab_rename_at_413(das_get_tuple_field<int32_t,0>::get((*__x_rename_at_415)),__context__),das_get_tuple_field<char *,8>::get((*__x_rename_at_415)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_415));
+	};
+	return /* <- */ __tab_rename_at_413;
+}
+
+inline void finalize_796a1dc62300a282 ( Context * __context__, struct _lambda_thismodule_24_8_1 &  ____this_rename_at_24 )
+{
+	memset(&(____this_rename_at_24), 0, 12);
+}
+
+inline bool test_efa6f262a24b2858 ( Context * __context__ )
+{
+	test_hints_f242c17a646e7217(__context__);
+	test_comprehension_d7aeeebfc97413ea(__context__);
+	test_to_array_6a3af09f45404f59(__context__);
+	test_table_752b1c1a31e29b06(__context__);
+	return true;
+}
+
+inline void test_comprehension_d7aeeebfc97413ea ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_52_976;
+	TArray<int32_t> __a_rename_at_31; das_zero(__a_rename_at_31);
+	{
+		bool __need_loop_32 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_32;
+		__need_loop_32 = __i_iterator.first(__context__,(__i_rename_at_32)) && __need_loop_32;
+		for ( ; __need_loop_32 ; __need_loop_32 = __i_iterator.next(__context__,(__i_rename_at_32)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_31),__i_rename_at_32,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_32));
+	};
+	TArray<int32_t> __b_rename_at_34; das_zero(__b_rename_at_34); das_move(__b_rename_at_34, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_34_rename_at_34; das_zero(____acomp_34_rename_at_34);
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(____acomp_34_rename_at_34),_Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_31)));
+		{
+			bool __need_loop_34 = true;
+			// x : int&
+			das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_31);
+			int32_t * __x_rename_at_34;
+			__need_loop_34 = __x_iterator.first(__context__,(__x_rename_at_34)) && __need_loop_34;
+			for ( ; __need_loop_34 ; __need_loop_34 = __x_iterator.next(__context__,(__x_rename_at_34)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_34_rename_at_34),(*__x_rename_at_34) * 2,-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_34));
+		};
+		return /* <- */ ____acomp_34_rename_at_34;
+	}));
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__b_rename_at_34)) == 100) && (builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__b_rename_at_34)) == 100)));
+	{
+		bool __need_loop_36 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__b_rename_at_34);
+		int32_t * __x_rename_at_36;
+		__need_loop_36 = __x_iterator.first(__context__,(__x_rename_at_36)) && __need_loop_36;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_36;
+		__need_loop_36 = __i_iterator.first(__context__,(__i_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = __x_iterator.next(__context__,(__x_rename_at_36)) && __i_iterator.next(__context__,(__i_rename_at_36)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_36) == (__i_rename_at_36 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_36));
+		__i_iterator.close(__context__,(__i_rename_at_36));
+	};
+	TArray<int32_t> __c_rename_at_39; das_zero(__c_rename_at_39); das_move(__c_rename_at_39, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_39_rename_at_39; das_zero(____acomp_39_rename_at_39);
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(____acomp_39_rename_at_39),50);
+		{
+			bool __need_loop_39 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,50));
+			int32_t __x_rename_at_39;
+			__need_loop_39 = __x_iterator.first(__context__,(__x_rename_at_39)) && __need_loop_39;
+			for ( ; __need_loop_39 ; __need_loop_39 = __x_iterator.next(__context__,(__x_rename_at_39)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_39_rename_at_39),__x_rename_at_39,-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_39));
+		};
+		return /* <- */ ____acomp_39_rename_at_39;
+	}));
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__c_rename_at_39)) == 50) && (builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__c_rename_at_39)) == 50)));
+	TDim<int32_t,20> __f_rename_at_41; das_zero(__f_rename_at_41);
+	TArray<int32_t> __d_rename_at_42; das_zero(__d_rename_at_42); das_move(__d_rename_at_42, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_42_rename_at_42; das_zero(____acomp_42_rename_at_42);
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(____acomp_42_rename_at_42),_Funcbuiltin_0x60_min_size_hint_f9c982fa6ae37825(__context__,_Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_31)),20));
+		{
+			bool __need_loop_42 = true;
+			// x : int& -const
+			das_iterator<TDim<int32_t,20>> __x_iterator(__f_rename_at_41);
+			int32_t * __x_rename_at_42;
+			__need_loop_42 = __x_iterator.first(__context__,(__x_rename_at_42)) && __need_loop_42;
+			// y : int&
+			das_iterator<TArray<int32_t>> __y_iterator(__a_rename_at_31);
+			int32_t * __y_rename_at_42;
+			__need_loop_42 = __y_iterator.first(__context__,(__y_rename_at_42)) && __need_loop_42;
+			for ( ; __need_loop_42 ; __need_loop_42 = __x_iterator.next(__context__,(__x_rename_at_42)) && __y_iterator.next(__context__,(__y_rename_at_42)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_42_rename_at_42),(*__x_rename_at_42) + (*__y_rename_at_42),-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_42));
+			__y_iterator.close(__context__,(__y_rename_at_42));
+		};
+		return /* <- */ ____acomp_42_rename_at_42;
+	}));
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__d_rename_at_42)) == 20) && (builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__d_rename_at_42)) == 20)));
+	TArray<int32_t> __g_rename_at_45; das_zero(__g_rename_at_45); das_move(__g_rename_at_45, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_45_rename_at_45; das_zero(____acomp_45_rename_at_45);
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(____acomp_45_rename_at_45),_Funcbuiltin_0x60_min_size_hint_f9c982fa6ae37825(__context__,1000000,_Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_31))));
+		{
+			bool __need_loop_45 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,1000000));
+			int32_t __x_rename_at_45;
+			__need_loop_45 = __x_iterator.first(__context__,(__x_rename_at_45)) && __need_loop_45;
+			// y : int&
+			das_iterator<TArray<int32_t>> __y_iterator(__a_rename_at_31);
+			int32_t * __y_rename_at_45;
+			__need_loop_45 = __y_iterator.first(__context__,(__y_rename_at_45)) && __need_loop_45;
+			for ( ; __need_loop_45 ; __need_loop_45 = __x_iterator.next(__context__,(__x_rename_at_45)) && __y_iterator.next(__context__,(__y_rename_at_45)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_45_rename_at_45),__x_rename_at_45 + (*__y_rename_at_45),-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_45));
+			__y_iterator.close(__context__,(__y_rename_at_45));
+		};
+		return /* <- */ ____acomp_45_rename_at_45;
+	}));
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__g_rename_at_45)) == 100) && (builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__g_rename_at_45)) == 100)));
+	TArray<int32_t> __h_rename_at_47; das_zero(__h_rename_at_47); das_move(__h_rename_at_47, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_47_rename_at_47; das_zero(____acomp_47_rename_at_47);
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(____acomp_47_rename_at_47),_Funcbuiltin_0x60_min_size_hint_f9c982fa6ae37825(__context__,_Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_31)),20));
+		{
+			bool __need_loop_47 = true;
+			// x : int&
+			das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_31);
+			int32_t * __x_rename_at_47;
+			__need_loop_47 = __x_iterator.first(__context__,(__x_rename_at_47)) && __need_loop_47;
+			// y : int& -const
+			das_iterator<TDim<int32_t,20>> __y_iterator(__f_rename_at_41);
+			int32_t * __y_rename_at_47;
+			__need_loop_47 = __y_iterator.first(__context__,(__y_rename_at_47)) && __need_loop_47;
+			for ( ; __need_loop_47 ; __need_loop_47 = __x_iterator.next(__context__,(__x_rename_at_47)) && __y_iterator.next(__context__,(__y_rename_at_47)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_47_rename_at_47),(*__x_rename_at_47) + (*__y_rename_at_47),-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_47));
+			__y_iterator.close(__context__,(__y_rename_at_47));
+		};
+		return /* <- */ ____acomp_47_rename_at_47;
+	}));
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__h_rename_at_47)) == 20) && (builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__h_rename_at_47)) == 20)));
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_50; das_zero(__it_rename_at_50);
+	das_move(__it_rename_at_50,(_temp_make_local_52_976 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_31)))));
+	TArray<int32_t> __k_rename_at_53; das_zero(__k_rename_at_53); das_move(__k_rename_at_53, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_53_rename_at_53; das_zero(____acomp_53_rename_at_53);
+		{
+			bool __need_loop_53 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,1000000));
+			int32_t __x_rename_at_53;
+			__need_loop_53 = __x_iterator.first(__context__,(__x_rename_at_53)) && __need_loop_53;
+			// y : int&
+			das_iterator<Sequence DAS_COMMENT((int32_t))> __y_iterator(__it_rename_at_50);
+			int32_t * __y_rename_at_53;
+			__need_loop_53 = __y_iterator.first(__context__,(__y_rename_at_53)) && __need_loop_53;
+			for ( ; __need_loop_53 ; __need_loop_53 = __x_iterator.next(__context__,(__x_rename_at_53)) && __y_iterator.next(__context__,(__y_rename_at_53)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_53_rename_at_53),__x_rename_at_53 + (*__y_rename_at_53),-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_53));
+			__y_iterator.close(__context__,(__y_rename_at_53));
+		};
+		return /* <- */ ____acomp_53_rename_at_53;
+	}));
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__k_rename_at_53)) == 100) && (builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__k_rename_at_53)) < 1000000)));
+	TArray<int32_t> __e_rename_at_56; das_zero(__e_rename_at_56); das_move(__e_rename_at_56, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_56_rename_at_56; das_zero(____acomp_56_rename_at_56);
+		{
+			bool __need_loop_56 = true;
+			// x : int&
+			das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_31);
+			int32_t * __x_rename_at_56;
+			__need_loop_56 = __x_iterator.first(__context__,(__x_rename_at_56)) && __need_loop_56;
+			for ( ; __need_loop_56 ; __need_loop_56 = __x_iterator.next(__context__,(__x_rename_at_56)) )
+			{
+				if ( (*__x_rename_at_56) < 10 )
+				{
+					_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_56_rename_at_56),(*__x_rename_at_56),-1);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_56));
+		};
+		return /* <- */ ____acomp_56_rename_at_56;
+	}));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__e_rename_at_56)) == 10));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_31));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_34));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__c_rename_at_39));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__d_rename_at_42));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__e_rename_at_56));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__g_rename_at_45));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__h_rename_at_47));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__k_rename_at_53));
+}
+
+inline void test_hints_f242c17a646e7217 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_14_96;
+	TArray<int32_t> __a_rename_at_4; das_zero(__a_rename_at_4);
+	{
+		bool __need_loop_5 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_5;
+		__need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_4),__i_rename_at_5,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_5));
+	};
+	DAS_ASSERT((_Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_4)) == 10));
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_12; das_zero(__it_rename_at_12);
+	das_move(__it_rename_at_12,(_temp_make_local_14_96 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_4)))));
+	DAS_ASSERT((builtin_iterator_size_hint(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_12)) == 10));
+	int32_t __cnt_rename_at_16 = 0;
+	{
+		bool __need_loop_17 = true;
+		// x : int&
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator(__it_rename_at_12);
+		int32_t * __x_rename_at_17;
+		__need_loop_17 = __x_iterator.first(__context__,(__x_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __x_iterator.next(__context__,(__x_rename_at_17)) )
+		{
+			__cnt_rename_at_16++;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_17));
+	};
+	DAS_ASSERT((__cnt_rename_at_16 == 10));
+	Sequence DAS_COMMENT((int32_t)) __rit_rename_at_20; das_zero(__rit_rename_at_20); das_move(__rit_rename_at_20, _Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,5)));
+	DAS_ASSERT((builtin_iterator_size_hint(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__rit_rename_at_20)) == 5));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__rit_rename_at_20),__context__);
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_23; das_zero(__gen_rename_at_23); das_move(__gen_rename_at_23, _Funcbuiltin_0x60_each_33c0304c72a278e3(__context__,das_ascend<bool,struct _lambda_thismodule_24_8_1>::make(__context__,&__type_info__5c3407e6,(([&]() -> struct _lambda_thismodule_24_8_1 {
+		struct _lambda_thismodule_24_8_1 __mks_23;
+		das_zero(__mks_23);
+		das_copy((__mks_23.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_24_8_1`function _lambda_thismodule_24_8_1 int#ref*/ 3590752680u))));
+		das_copy((__mks_23.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_24_8_1`finazlier #ptr#_lambda_thismodule_24_8_1#explicit*/ 2393723656u))));
+		return __mks_23;
+	})()))));
+	DAS_ASSERT((builtin_iterator_size_hint(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_23)) == -1));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_23),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_4));
+}
+
+inline void test_table_752b1c1a31e29b06 ( Context * __context__ )
+{
+	TDim<TTuple<16,int32_t,char *>,3> _temp_make_local_89_160;
+	TTable<int32_t,int32_t> __tab_rename_at_82; das_zero(__tab_rename_at_82);
+	_Funcbuiltin_0x60_reserve_1a8b399fcef6fa4c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_82),100);
+	int32_t __cap_rename_at_84 = (int32_t)builtin_table_capacity(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_82));
+	DAS_ASSERT((__cap_rename_at_84 >= 100));
+	{
+		bool __need_loop_86 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_86;
+		__need_loop_86 = __i_iterator.first(__context__,(__i_rename_at_86)) && __need_loop_86;
+		for ( ; __need_loop_86 ; __need_loop_86 = __i_iterator.next(__context__,(__i_rename_at_86)) )
+		{
+			das_copy(__tab_rename_at_82(__i_rename_at_86,__context__),__i_rename_at_86);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_86));
+	};
+	DAS_ASSERT(((builtin_table_capacity(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_82)) == __cap_rename_at_84) && (builtin_table_size(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_82)) == 100)));
+	TTable<int32_t,char *> __t_rename_at_89; das_zero(__t_rename_at_89); das_move(__t_rename_at_89, _Funcbuiltin_0x60_to_table_e184fe73d65c6744(__context__,das_arg<TDim<TTuple<16,int32_t,char *>,3>>::pass((([&]() -> TDim<TTuple<16,int32_t,char *>,3>& {
+		_temp_make_local_89_160(0,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_89;
+			das_get_tuple_field<int32_t,0>::get(__mkt_89) = 1;
+			das_get_tuple_field<char *,8>::get(__mkt_89) = ((char *) "one");
+			return __mkt_89;
+		})());
+		_temp_make_local_89_160(1,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_89;
+			das_get_tuple_field<int32_t,0>::get(__mkt_89) = 2;
+			das_get_tuple_field<char *,8>::get(__mkt_89) = ((char *) "two");
+			return __mkt_89;
+		})());
+		_temp_make_local_89_160(2,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_89;
+			das_get_tuple_field<int32_t,0>::get(__mkt_89) = 3;
+			das_get_tuple_field<char *,8>::get(__mkt_89) = ((char *) "three");
+			return __mkt_89;
+		})());
+		return _temp_make_local_89_160;
+	})()))));
+	DAS_ASSERT(((builtin_table_size(das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_89)) == 3) && (SimPolicy<char *>::Equ(cast<char *>::from(__t_rename_at_89(2,__context__)),cast<char *>::from(((char *) "two")),*__context__))));
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_82));
+	_Funcbuiltin_0x60_finalize_744968e0d1038eaa(__context__,das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_89));
+}
+
+inline void test_to_array_6a3af09f45404f59 ( Context * __context__ )
+{
+	TArray<char *> _temp_make_local_73_112;
+	Sequence DAS_COMMENT((char * *)) _temp_make_local_73_144;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_75_192;
+	TArray<char *> __a_rename_at_68; das_zero(__a_rename_at_68);
+	{
+		bool __need_loop_69 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,40));
+		int32_t __i_rename_at_69;
+		__need_loop_69 = __i_iterator.first(__context__,(__i_rename_at_69)) && __need_loop_69;
+		for ( ; __need_loop_69 ; __need_loop_69 = __i_iterator.next(__context__,(__i_rename_at_69)) )
+		{
+			_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_68),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(__i_rename_at_69))),-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_69));
+	};
+	TArray<char *> __b_rename_at_71; das_zero(__b_rename_at_71);
+	das_move(__b_rename_at_71,(_temp_make_local_73_112 = (_Funcbuiltin_0x60_to_array_699eeb328f6c894e(__context__,das_arg<Sequence DAS_COMMENT((char *))>::pass((_temp_make_local_73_144 = (_Funcbuiltin_0x60_each_9d5e3afe62c831b5(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_68)))))))));
+	DAS_ASSERT((((builtin_array_size(das_arg<TArray<char *>>::pass(__b_rename_at_71)) == 40) && (builtin_array_capacity(das_arg<TArray<char *>>::pass(__b_rename_at_71)) == 40)) && (SimPolicy<char *>::Equ(cast<char *>::from(__b_rename_at_71(39,__context__)),cast<char *>::from(((char *) "39")),*__context__))));
+	TArray<int32_t> __c_rename_at_75; das_zero(__c_rename_at_75); das_move(__c_rename_at_75, _Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_75_192 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,40)))))));
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__c_rename_at_75)) == 40) && (__c_rename_at_75(39,__context__) == 39)));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_68));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__b_rename_at_71));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__c_rename_at_75));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_24_8_1_0x60_finazlier_43a45d1b17f9977a
+		aotLib[0x4489f55cd3e00bb0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_24_8_1 *  ),&_Func_lambda_thismodule_24_8_1_0x60_finazlier_43a45d1b17f9977a>>();
+	};
+		// _Func_lambda_thismodule_24_8_1_0x60_function_2f953ef4fab838a
+		aotLib[0xece4b447a7684be5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct _lambda_thismodule_24_8_1 & , int32_t &  ),&_Func_lambda_thismodule_24_8_1_0x60_function_2f953ef4fab838a>>();
+	};
+		// _Funcbuiltin_0x60_each_49ba41ea6e9b0c25
+		aotLib[0x6a4a051ab138a935] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_49ba41ea6e9b0c25>>();
+	};
+		// _Funcbuiltin_0x60_each_9d5e3afe62c831b5
+		aotLib[0x19c03b79a5a861f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char * &)) (*) ( Context * __context__, TArray<char *> const  &  ),&_Funcbuiltin_0x60_each_9d5e3afe62c831b5>>();
+	};
+		// _Funcbuiltin_0x60_each_33c0304c72a278e3
+		aotLib[0xeb0e50f6045a6f09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_33c0304c72a278e3>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+		aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+		// _Funcbuiltin_0x60_finalize_744968e0d1038eaa
+		aotLib[0xf88941018b676dd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,char *> &  ),&_Funcbuiltin_0x60_finalize_744968e0d1038eaa>>();
+	};
+		// _Funcbuiltin_0x60_min_size_hint_f9c982fa6ae37825
+		aotLib[0xf010a631aa517d89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&_Funcbuiltin_0x60_min_size_hint_f9c982fa6ae37825>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_push_dbe8c61ce24eace2
+		aotLib[0xe7e1aae867aed505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_dbe8c61ce24eace2>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_8f1b55668745e84b
+		aotLib[0x60f7feeaae35f805] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_clone_8f1b55668745e84b>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_reserve_cecea833d1e66117
+		aotLib[0x58482c2f23d3c0ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_cecea833d1e66117>>();
+	};
+		// _Funcbuiltin_0x60_reserve_1a8b399fcef6fa4c
+		aotLib[0x5d10ca6e8019ed11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_1a8b399fcef6fa4c>>();
+	};
+		// _Funcbuiltin_0x60_reserve_224e7011ac915236
+		aotLib[0x2a024ebf093d1985] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_224e7011ac915236>>();
+	};
+		// _Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7
+		aotLib[0xfcfe5da5af4c2ec5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_size_hint_66fb03b00e7f46b7>>();
+	};
+		// _Funcbuiltin_0x60_to_array_e7337cf490aef504
+		aotLib[0xb019749877860f09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcbuiltin_0x60_to_array_e7337cf490aef504>>();
+	};
+		// _Funcbuiltin_0x60_to_array_699eeb328f6c894e
+		aotLib[0x8f03516a19a651f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, Sequence DAS_COMMENT((char * &)) const  &  ),&_Funcbuiltin_0x60_to_array_699eeb328f6c894e>>();
+	};
+		// _Funcbuiltin_0x60_to_table_e184fe73d65c6744
+		aotLib[0xe11b733bf618be5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,char *> (*) ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  &  ),&_Funcbuiltin_0x60_to_table_e184fe73d65c6744>>();
+	};
+		// finalize_796a1dc62300a282
+		aotLib[0x8e2a6d42abbedce9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct _lambda_thismodule_24_8_1 &  ),&finalize_796a1dc62300a282>>();
+	};
+		// test_efa6f262a24b2858
+		aotLib[0x7a802eaa89da5f11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_efa6f262a24b2858>>();
+	};
+		// test_comprehension_d7aeeebfc97413ea
+		aotLib[0x9191f8080f3b1dda] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_comprehension_d7aeeebfc97413ea>>();
+	};
+		// test_hints_f242c17a646e7217
+		aotLib[0x3a976a79b2e3870d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_hints_f242c17a646e7217>>();
+	};
+		// test_table_752b1c1a31e29b06
+		aotLib[0x5caa84096ebfc990] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_table_752b1c1a31e29b06>>();
+	};
+		// test_to_array_6a3af09f45404f59
+		aotLib[0xe6c9f8e79200346d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_to_array_6a3af09f45404f59>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
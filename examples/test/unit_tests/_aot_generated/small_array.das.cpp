@@ -0,0 +1,741 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+ // require small_array
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__95e97e5e;
+
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+
+TypeInfo * __tinfo_0[4] = { &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_1[4] = { &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_2[4] = { &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_3[4] = { &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__95e97e5e };
+TypeInfo * __tinfo_4[4] = { &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__95e97e5e };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure SmallArrayMacro
+// unused structure SmallArrayRewriteMacro
+// unused structure SmallArrayVisitor
+namespace  {
+
+struct Tags {
+	TDim<int32_t,4> items;
+	int32_t _count;
+	TArray<int32_t> _heap;
+};
+static_assert(sizeof(Tags)==48,"structure size mismatch with DAS");
+static_assert(offsetof(Tags,items)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Tags,_count)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Tags,_heap)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Names {
+	TDim<char *,2> items;
+	int32_t _count;
+	TArray<char *> _heap;
+};
+static_assert(sizeof(Names)==48,"structure size mismatch with DAS");
+static_assert(offsetof(Names,items)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Names,_count)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Names,_heap)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> & __a_rename_at_232, TArray<int32_t> const  & __b_rename_at_232 );
+inline struct Tags _Funcbuiltin_0x60_clone_to_move_3490aad6b6204143 ( Context * __context__, struct Tags const  & __clone_src_rename_at_220 );
+inline void _Funcbuiltin_0x60_emplace_f3054aa6951dfab9 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_69, int32_t __value_rename_at_69, int32_t __at_rename_at_69 );
+inline void _Funcbuiltin_0x60_emplace_98721d99f1def395 ( Context * __context__, TArray<char *> & __Arr_rename_at_69, char * __value_rename_at_69, int32_t __at_rename_at_69 );
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_81, int32_t __at_rename_at_81 );
+inline void _Funcbuiltin_0x60_erase_ca2ed0e0c8a74bd5 ( Context * __context__, TArray<char *> & __Arr_rename_at_81, int32_t __at_rename_at_81 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_clone_76ab6a8882326f97 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_push_clone_8f1b55668745e84b ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void clear_19073dc6c4a047c4 ( Context * __context__, struct Tags & __a_rename_at_4 );
+inline void clone_750202d35cdbba45 ( Context * __context__, struct Tags & __a_rename_at_4, struct Tags const  & __b_rename_at_4 );
+inline void erase_db02710f6c5e17f4 ( Context * __context__, struct Names & __a_rename_at_8, int32_t __index_rename_at_8 );
+inline void erase_7699815aebbe2735 ( Context * __context__, struct Tags & __a_rename_at_4, int32_t __index_rename_at_4 );
+inline void finalize_5b06c829554b4657 ( Context * __context__, struct Names & ____this_rename_at_8 );
+inline int32_t length_2eeec3a31111c56a ( Context * __context__, struct Names const  & __a_rename_at_8 );
+inline int32_t length_aa895944cc494027 ( Context * __context__, struct Tags const  & __a_rename_at_4 );
+inline void push_4e1fb274b5b79ce4 ( Context * __context__, struct Names & __a_rename_at_8, char * const  __value_rename_at_8 );
+inline void push_59d6819997126171 ( Context * __context__, struct Tags & __a_rename_at_4, int32_t __value_rename_at_4 );
+inline char * & small_array_at_6ba873c4c4a02e5e ( Context * __context__, struct Names & __a_rename_at_8, int32_t __index_rename_at_8 );
+inline int32_t & small_array_at_6e72ca6de7ceb59f ( Context * __context__, struct Tags & __a_rename_at_4, int32_t __index_rename_at_4 );
+inline int32_t const  & small_array_at_const_925e4244249c9a81 ( Context * __context__, struct Tags const  & __a_rename_at_4, int32_t __index_rename_at_4 );
+inline int32_t & _Funcsmall_array_0x60_small_array_at_db65a39156580971 ( Context * __context__, TDim<int32_t,4> & __data_rename_at_46, int32_t __count_rename_at_46, TArray<int32_t> & __heap_rename_at_46, int32_t __index_rename_at_46 );
+inline char * & _Funcsmall_array_0x60_small_array_at_975be26c57493e45 ( Context * __context__, TDim<char *,2> & __data_rename_at_46, int32_t __count_rename_at_46, TArray<char *> & __heap_rename_at_46, int32_t __index_rename_at_46 );
+inline int32_t const  & _Funcsmall_array_0x60_small_array_at_const_1ebe1952c182c720 ( Context * __context__, TDim<int32_t,4> const  & __data_rename_at_56, int32_t __count_rename_at_56, TArray<int32_t> const  & __heap_rename_at_56, int32_t __index_rename_at_56 );
+inline void _Funcsmall_array_0x60_small_array_clear_766fcf15f6a7653d ( Context * __context__, TDim<int32_t,4> & __data_rename_at_89, int32_t & __count_rename_at_89, TArray<int32_t> & __heap_rename_at_89 );
+inline void _Funcsmall_array_0x60_small_array_erase_1b8ec82e6dff174b ( Context * __context__, TDim<int32_t,4> & __data_rename_at_77, int32_t & __count_rename_at_77, TArray<int32_t> & __heap_rename_at_77, int32_t __index_rename_at_77 );
+inline void _Funcsmall_array_0x60_small_array_erase_e44790821a5ac8dd ( Context * __context__, TDim<char *,2> & __data_rename_at_77, int32_t & __count_rename_at_77, TArray<char *> & __heap_rename_at_77, int32_t __index_rename_at_77 );
+inline void _Funcsmall_array_0x60_small_array_push_a3b9101e3bdcdcf4 ( Context * __context__, TDim<int32_t,4> & __data_rename_at_65, int32_t & __count_rename_at_65, TArray<int32_t> & __heap_rename_at_65, int32_t __value_rename_at_65 );
+inline void _Funcsmall_array_0x60_small_array_push_deada96346665a1a ( Context * __context__, TDim<char *,2> & __data_rename_at_65, int32_t & __count_rename_at_65, TArray<char *> & __heap_rename_at_65, char * const  __value_rename_at_65 );
+inline int32_t sum_bc1d13163cf95aa4 ( Context * __context__, struct Tags const  & __tags_rename_at_11 );
+inline bool test_b8aa5a143750684d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> &  __a_rename_at_232, TArray<int32_t> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_232);
+		int32_t * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_232);
+		int32_t const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			das_copy((*__aV_rename_at_234),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline struct Tags _Funcbuiltin_0x60_clone_to_move_3490aad6b6204143 ( Context * __context__, struct Tags const  &  __clone_src_rename_at_220 )
+{
+	struct Tags __clone_dest_rename_at_221; das_zero(__clone_dest_rename_at_221);
+	clone_750202d35cdbba45(__context__,das_arg<struct Tags>::pass(__clone_dest_rename_at_221),__clone_src_rename_at_220);
+	return /* <- */ __clone_dest_rename_at_221;
+}
+
+inline void _Funcbuiltin_0x60_emplace_f3054aa6951dfab9 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_69, int32_t __value_rename_at_69, int32_t __at_rename_at_69 )
+{
+	das_move(__Arr_rename_at_69(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_69),__at_rename_at_69,4,__context__),__context__),__value_rename_at_69);
+}
+
+inline void _Funcbuiltin_0x60_emplace_98721d99f1def395 ( Context * __context__, TArray<char *> &  __Arr_rename_at_69, char * __value_rename_at_69, int32_t __at_rename_at_69 )
+{
+	das_move(__Arr_rename_at_69(builtin_array_push(das_arg<TArray<char *>>::pass(__Arr_rename_at_69),__at_rename_at_69,8,__context__),__context__),__value_rename_at_69);
+}
+
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_81, int32_t __at_rename_at_81 )
+{
+	builtin_array_erase(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_81),__at_rename_at_81,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_erase_ca2ed0e0c8a74bd5 ( Context * __context__, TArray<char *> &  __Arr_rename_at_81, int32_t __at_rename_at_81 )
+{
+	builtin_array_erase(das_arg<TArray<char *>>::pass(__Arr_rename_at_81),__at_rename_at_81,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_76ab6a8882326f97 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),__at_rename_at_75,4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_8f1b55668745e84b ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),__at_rename_at_75,8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<char *>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void clear_19073dc6c4a047c4 ( Context * __context__, struct Tags &  __a_rename_at_4 )
+{
+	_Funcsmall_array_0x60_small_array_clear_766fcf15f6a7653d(__context__,das_arg<TDim<int32_t,4>>::pass(__a_rename_at_4.items),__a_rename_at_4._count,das_arg<TArray<int32_t>>::pass(__a_rename_at_4._heap));
+}
+
+inline void clone_750202d35cdbba45 ( Context * __context__, struct Tags &  __a_rename_at_4, struct Tags const  &  __b_rename_at_4 )
+{
+	das_copy(__a_rename_at_4.items,__b_rename_at_4.items);
+	das_copy(__a_rename_at_4._count,__b_rename_at_4._count);
+	_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_4._heap),__b_rename_at_4._heap);
+}
+
+inline void erase_db02710f6c5e17f4 ( Context * __context__, struct Names &  __a_rename_at_8, int32_t __index_rename_at_8 )
+{
+	_Funcsmall_array_0x60_small_array_erase_e44790821a5ac8dd(__context__,das_arg<TDim<char *,2>>::pass(__a_rename_at_8.items),__a_rename_at_8._count,das_arg<TArray<char *>>::pass(__a_rename_at_8._heap),__index_rename_at_8);
+}
+
+inline void erase_7699815aebbe2735 ( Context * __context__, struct Tags &  __a_rename_at_4, int32_t __index_rename_at_4 )
+{
+	_Funcsmall_array_0x60_small_array_erase_1b8ec82e6dff174b(__context__,das_arg<TDim<int32_t,4>>::pass(__a_rename_at_4.items),__a_rename_at_4._count,das_arg<TArray<int32_t>>::pass(__a_rename_at_4._heap),__index_rename_at_4);
+}
+
+inline void finalize_5b06c829554b4657 ( Context * __context__, struct Names &  ____this_rename_at_8 )
+{
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(____this_rename_at_8._heap));
+	memset(&(____this_rename_at_8), 0, 48);
+}
+
+inline int32_t length_2eeec3a31111c56a ( Context * __context__, struct Names const  &  __a_rename_at_8 )
+{
+	return __a_rename_at_8._count;
+}
+
+inline int32_t length_aa895944cc494027 ( Context * __context__, struct Tags const  &  __a_rename_at_4 )
+{
+	return __a_rename_at_4._count;
+}
+
+inline void push_4e1fb274b5b79ce4 ( Context * __context__, struct Names &  __a_rename_at_8, char * const  __value_rename_at_8 )
+{
+	_Funcsmall_array_0x60_small_array_push_deada96346665a1a(__context__,das_arg<TDim<char *,2>>::pass(__a_rename_at_8.items),__a_rename_at_8._count,das_arg<TArray<char *>>::pass(__a_rename_at_8._heap),__value_rename_at_8);
+}
+
+inline void push_59d6819997126171 ( Context * __context__, struct Tags &  __a_rename_at_4, int32_t __value_rename_at_4 )
+{
+	_Funcsmall_array_0x60_small_array_push_a3b9101e3bdcdcf4(__context__,das_arg<TDim<int32_t,4>>::pass(__a_rename_at_4.items),__a_rename_at_4._count,das_arg<TArray<int32_t>>::pass(__a_rename_at_4._heap),__value_rename_at_4);
+}
+
+inline char * & small_array_at_6ba873c4c4a02e5e ( Context * __context__, struct Names &  __a_rename_at_8, int32_t __index_rename_at_8 )
+{
+	return _Funcsmall_array_0x60_small_array_at_975be26c57493e45(__context__,das_arg<TDim<char *,2>>::pass(__a_rename_at_8.items),__a_rename_at_8._count,das_arg<TArray<char *>>::pass(__a_rename_at_8._heap),__index_rename_at_8);
+}
+
+inline int32_t & small_array_at_6e72ca6de7ceb59f ( Context * __context__, struct Tags &  __a_rename_at_4, int32_t __index_rename_at_4 )
+{
+	return _Funcsmall_array_0x60_small_array_at_db65a39156580971(__context__,das_arg<TDim<int32_t,4>>::pass(__a_rename_at_4.items),__a_rename_at_4._count,das_arg<TArray<int32_t>>::pass(__a_rename_at_4._heap),__index_rename_at_4);
+}
+
+inline int32_t const  & small_array_at_const_925e4244249c9a81 ( Context * __context__, struct Tags const  &  __a_rename_at_4, int32_t __index_rename_at_4 )
+{
+	return _Funcsmall_array_0x60_small_array_at_const_1ebe1952c182c720(__context__,__a_rename_at_4.items,__a_rename_at_4._count,__a_rename_at_4._heap,__index_rename_at_4);
+}
+
+inline int32_t & _Funcsmall_array_0x60_small_array_at_db65a39156580971 ( Context * __context__, TDim<int32_t,4> &  __data_rename_at_46, int32_t __count_rename_at_46, TArray<int32_t> &  __heap_rename_at_46, int32_t __index_rename_at_46 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__heap_rename_at_46)) != 0 )
+	{
+		return __heap_rename_at_46(__index_rename_at_46,__context__);
+	} else {
+		if ( (__index_rename_at_46 < 0) || (__index_rename_at_46 >= __count_rename_at_46) )
+		{
+			builtin_throw(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_0, cast<char * const >::from(((char *) "small_array index ")), cast<int32_t>::from(__index_rename_at_46), cast<char * const >::from(((char *) " out of range ")), cast<int32_t>::from(__count_rename_at_46))),__context__);
+		};
+		return __data_rename_at_46(__index_rename_at_46,__context__);
+	};
+}
+
+inline char * & _Funcsmall_array_0x60_small_array_at_975be26c57493e45 ( Context * __context__, TDim<char *,2> &  __data_rename_at_46, int32_t __count_rename_at_46, TArray<char *> &  __heap_rename_at_46, int32_t __index_rename_at_46 )
+{
+	if ( builtin_array_size(das_arg<TArray<char *>>::pass(__heap_rename_at_46)) != 0 )
+	{
+		return __heap_rename_at_46(__index_rename_at_46,__context__);
+	} else {
+		if ( (__index_rename_at_46 < 0) || (__index_rename_at_46 >= __count_rename_at_46) )
+		{
+			builtin_throw(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_1, cast<char * const >::from(((char *) "small_array index ")), cast<int32_t>::from(__index_rename_at_46), cast<char * const >::from(((char *) " out of range ")), cast<int32_t>::from(__count_rename_at_46))),__context__);
+		};
+		return __data_rename_at_46(__index_rename_at_46,__context__);
+	};
+}
+
+inline int32_t const  & _Funcsmall_array_0x60_small_array_at_const_1ebe1952c182c720 ( Context * __context__, TDim<int32_t,4> const  &  __data_rename_at_56, int32_t __count_rename_at_56, TArray<int32_t> const  &  __heap_rename_at_56, int32_t __index_rename_at_56 )
+{
+	if ( builtin_array_size(__heap_rename_at_56) != 0 )
+	{
+		return __heap_rename_at_56(__index_rename_at_56,__context__);
+	} else {
+		if ( (__index_rename_at_56 < 0) || (__index_rename_at_56 >= __count_rename_at_56) )
+		{
+			builtin_throw(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_2, cast<char * const >::from(((char *) "small_array index ")), cast<int32_t>::from(__index_rename_at_56), cast<char * const >::from(((char *) " out of range ")), cast<int32_t>::from(__count_rename_at_56))),__context__);
+		};
+		return __data_rename_at_56(__index_rename_at_56,__context__);
+	};
+}
+
+inline void _Funcsmall_array_0x60_small_array_clear_766fcf15f6a7653d ( Context * __context__, TDim<int32_t,4> &  __data_rename_at_89, int32_t & __count_rename_at_89, TArray<int32_t> &  __heap_rename_at_89 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__heap_rename_at_89)) != 0 )
+	{
+		builtin_array_clear(das_arg<TArray<int32_t>>::pass(__heap_rename_at_89),__context__);
+	};
+	das_copy(__count_rename_at_89,0);
+}
+
+inline void _Funcsmall_array_0x60_small_array_erase_1b8ec82e6dff174b ( Context * __context__, TDim<int32_t,4> &  __data_rename_at_77, int32_t & __count_rename_at_77, TArray<int32_t> &  __heap_rename_at_77, int32_t __index_rename_at_77 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__heap_rename_at_77)) != 0 )
+	{
+		_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__heap_rename_at_77),__index_rename_at_77);
+	} else {
+		if ( (__index_rename_at_77 < 0) || (__index_rename_at_77 >= __count_rename_at_77) )
+		{
+			builtin_throw(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_3, cast<char * const >::from(((char *) "small_array erase index ")), cast<int32_t>::from(__index_rename_at_77), cast<char * const >::from(((char *) " out of range ")), cast<int32_t>::from(__count_rename_at_77))),__context__);
+		};
+		{
+			bool __need_loop_83 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(__index_rename_at_77,__count_rename_at_77 - 1));
+			int32_t __i_rename_at_83;
+			__need_loop_83 = __i_iterator.first(__context__,(__i_rename_at_83)) && __need_loop_83;
+			for ( ; __need_loop_83 ; __need_loop_83 = __i_iterator.next(__context__,(__i_rename_at_83)) )
+			{
+				das_move(__data_rename_at_77(__i_rename_at_83,__context__),__data_rename_at_77((__i_rename_at_83 + 1),__context__));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_83));
+		};
+	};
+	__count_rename_at_77--;
+}
+
+inline void _Funcsmall_array_0x60_small_array_erase_e44790821a5ac8dd ( Context * __context__, TDim<char *,2> &  __data_rename_at_77, int32_t & __count_rename_at_77, TArray<char *> &  __heap_rename_at_77, int32_t __index_rename_at_77 )
+{
+	if ( builtin_array_size(das_arg<TArray<char *>>::pass(__heap_rename_at_77)) != 0 )
+	{
+		_Funcbuiltin_0x60_erase_ca2ed0e0c8a74bd5(__context__,das_arg<TArray<char *>>::pass(__heap_rename_at_77),__index_rename_at_77);
+	} else {
+		if ( (__index_rename_at_77 < 0) || (__index_rename_at_77 >= __count_rename_at_77) )
+		{
+			builtin_throw(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_4, cast<char * const >::from(((char *) "small_array erase index ")), cast<int32_t>::from(__index_rename_at_77), cast<char * const >::from(((char *) " out of range ")), cast<int32_t>::from(__count_rename_at_77))),__context__);
+		};
+		{
+			bool __need_loop_83 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(__index_rename_at_77,__count_rename_at_77 - 1));
+			int32_t __i_rename_at_83;
+			__need_loop_83 = __i_iterator.first(__context__,(__i_rename_at_83)) && __need_loop_83;
+			for ( ; __need_loop_83 ; __need_loop_83 = __i_iterator.next(__context__,(__i_rename_at_83)) )
+			{
+				das_move(__data_rename_at_77(__i_rename_at_83,__context__),__data_rename_at_77((__i_rename_at_83 + 1),__context__));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_83));
+		};
+	};
+	__count_rename_at_77--;
+}
+
+inline void _Funcsmall_array_0x60_small_array_push_a3b9101e3bdcdcf4 ( Context * __context__, TDim<int32_t,4> &  __data_rename_at_65, int32_t & __count_rename_at_65, TArray<int32_t> &  __heap_rename_at_65, int32_t __value_rename_at_65 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__heap_rename_at_65)) != 0 )
+	{
+		_Funcbuiltin_0x60_push_clone_76ab6a8882326f97(__context__,das_arg<TArray<int32_t>>::pass(__heap_rename_at_65),__value_rename_at_65,-1);
+	} else if ( __count_rename_at_65 < 4 )
+	{
+		das_copy(__data_rename_at_65(__count_rename_at_65,__context__),__value_rename_at_65);
+	} else {
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__heap_rename_at_65),__count_rename_at_65 * 2);
+		{
+			bool __need_loop_72 = true;
+			// x : int aka TT&
+			das_iterator<TDim<int32_t,4>> __x_iterator(__data_rename_at_65);
+			int32_t * __x_rename_at_72;
+			__need_loop_72 = __x_iterator.first(__context__,(__x_rename_at_72)) && __need_loop_72;
+			for ( ; __need_loop_72 ; __need_loop_72 = __x_iterator.next(__context__,(__x_rename_at_72)) )
+			{
+				_Funcbuiltin_0x60_emplace_f3054aa6951dfab9(__context__,das_arg<TArray<int32_t>>::pass(__heap_rename_at_65),(*__x_rename_at_72),-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_72));
+		};
+		_Funcbuiltin_0x60_push_clone_76ab6a8882326f97(__context__,das_arg<TArray<int32_t>>::pass(__heap_rename_at_65),__value_rename_at_65,-1);
+	};
+	__count_rename_at_65++;
+}
+
+inline void _Funcsmall_array_0x60_small_array_push_deada96346665a1a ( Context * __context__, TDim<char *,2> &  __data_rename_at_65, int32_t & __count_rename_at_65, TArray<char *> &  __heap_rename_at_65, char * const  __value_rename_at_65 )
+{
+	if ( builtin_array_size(das_arg<TArray<char *>>::pass(__heap_rename_at_65)) != 0 )
+	{
+		_Funcbuiltin_0x60_push_clone_8f1b55668745e84b(__context__,das_arg<TArray<char *>>::pass(__heap_rename_at_65),__value_rename_at_65,-1);
+	} else if ( __count_rename_at_65 < 2 )
+	{
+		das_copy(__data_rename_at_65(__count_rename_at_65,__context__),__value_rename_at_65);
+	} else {
+		_Funcbuiltin_0x60_reserve_cecea833d1e66117(__context__,das_arg<TArray<char *>>::pass(__heap_rename_at_65),__count_rename_at_65 * 2);
+		{
+			bool __need_loop_72 = true;
+			// x : string aka TT&
+			das_iterator<TDim<char *,2>> __x_iterator(__data_rename_at_65);
+			char * * __x_rename_at_72;
+			__need_loop_72 = __x_iterator.first(__context__,(__x_rename_at_72)) && __need_loop_72;
+			for ( ; __need_loop_72 ; __need_loop_72 = __x_iterator.next(__context__,(__x_rename_at_72)) )
+			{
+				_Funcbuiltin_0x60_emplace_98721d99f1def395(__context__,das_arg<TArray<char *>>::pass(__heap_rename_at_65),(*__x_rename_at_72),-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_72));
+		};
+		_Funcbuiltin_0x60_push_clone_8f1b55668745e84b(__context__,das_arg<TArray<char *>>::pass(__heap_rename_at_65),__value_rename_at_65,-1);
+	};
+	__count_rename_at_65++;
+}
+
+inline int32_t sum_bc1d13163cf95aa4 ( Context * __context__, struct Tags const  &  __tags_rename_at_11 )
+{
+	int32_t __total_rename_at_12 = 0;
+	{
+		bool __need_loop_13 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,length_aa895944cc494027(__context__,__tags_rename_at_11)));
+		int32_t __i_rename_at_13;
+		__need_loop_13 = __i_iterator.first(__context__,(__i_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __i_iterator.next(__context__,(__i_rename_at_13)) )
+		{
+			__total_rename_at_12 += small_array_at_const_925e4244249c9a81(__context__,__tags_rename_at_11,__i_rename_at_13);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_13));
+	};
+	return __total_rename_at_12;
+}
+
+inline bool test_b8aa5a143750684d ( Context * __context__ )
+{
+	struct Tags __tags_rename_at_19; das_zero(__tags_rename_at_19);
+	{
+		bool __need_loop_20 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,3));
+		int32_t __i_rename_at_20;
+		__need_loop_20 = __i_iterator.first(__context__,(__i_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __i_iterator.next(__context__,(__i_rename_at_20)) )
+		{
+			push_59d6819997126171(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),__i_rename_at_20);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_20));
+	};
+	DAS_ASSERT(((length_aa895944cc494027(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19)) == 3) && (builtin_array_size(das_arg<TArray<int32_t>>::pass(__tags_rename_at_19._heap)) == 0)));
+	das_copy(small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),1),10);
+	DAS_VERIFY((((small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),0) == 0) && (small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),1) == 10)) && (small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),2) == 2)));
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__tags_rename_at_19._heap)) != 0 )
+	{
+		{
+			bool __need_loop_25 = true;
+			// t : int&
+			das_iterator<TArray<int32_t>> __t_iterator(__tags_rename_at_19._heap);
+			int32_t * __t_rename_at_25;
+			__need_loop_25 = __t_iterator.first(__context__,(__t_rename_at_25)) && __need_loop_25;
+			for ( ; __need_loop_25 ; __need_loop_25 = __t_iterator.next(__context__,(__t_rename_at_25)) )
+			{
+				(*__t_rename_at_25)++;
+			}
+			__t_iterator.close(__context__,(__t_rename_at_25));
+		};
+	} else {
+		{
+			bool __need_loop_25 = true;
+			// __sa_index0 : int const
+			das_iterator<range> ____sa_index0_iterator(range(0,__tags_rename_at_19._count));
+			int32_t ____sa_index0_rename_at_25;
+			__need_loop_25 = ____sa_index0_iterator.first(__context__,(____sa_index0_rename_at_25)) && __need_loop_25;
+			for ( ; __need_loop_25 ; __need_loop_25 = ____sa_index0_iterator.next(__context__,(____sa_index0_rename_at_25)) )
+			{
+				int32_t * __t_rename_at_25 = &(__tags_rename_at_19.items(____sa_index0_rename_at_25,__context__));
+				(*__t_rename_at_25)++;
+			}
+			____sa_index0_iterator.close(__context__,(____sa_index0_rename_at_25));
+		};
+	};
+	DAS_VERIFY((sum_bc1d13163cf95aa4(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19)) == 15));
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,5));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			push_59d6819997126171(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),__i_rename_at_29 * 100);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	DAS_ASSERT(((length_aa895944cc494027(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19)) == 8) && (builtin_array_size(das_arg<TArray<int32_t>>::pass(__tags_rename_at_19._heap)) == 8)));
+	DAS_VERIFY((((small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),2) == 3) && (small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),3) == 0)) && (small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),7) == 400)));
+	int32_t __count_rename_at_33 = 0;
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__tags_rename_at_19._heap)) != 0 )
+	{
+		{
+			bool __need_loop_34 = true;
+			// t : int&
+			das_iterator<TArray<int32_t>> __t_iterator(__tags_rename_at_19._heap);
+			int32_t * __t_rename_at_34;
+			__need_loop_34 = __t_iterator.first(__context__,(__t_rename_at_34)) && __need_loop_34;
+			for ( ; __need_loop_34 ; __need_loop_34 = __t_iterator.next(__context__,(__t_rename_at_34)) )
+			{
+				__count_rename_at_33++;
+			}
+			__t_iterator.close(__context__,(__t_rename_at_34));
+		};
+	} else {
+		{
+			bool __need_loop_34 = true;
+			// __sa_index1 : int const
+			das_iterator<range> ____sa_index1_iterator(range(0,__tags_rename_at_19._count));
+			int32_t ____sa_index1_rename_at_34;
+			__need_loop_34 = ____sa_index1_iterator.first(__context__,(____sa_index1_rename_at_34)) && __need_loop_34;
+			for ( ; __need_loop_34 ; __need_loop_34 = ____sa_index1_iterator.next(__context__,(____sa_index1_rename_at_34)) )
+			{
+				__count_rename_at_33++;
+			}
+			____sa_index1_iterator.close(__context__,(____sa_index1_rename_at_34));
+		};
+	};
+	DAS_ASSERT((__count_rename_at_33 == 8));
+	struct Tags __copy_rename_at_38; das_zero(__copy_rename_at_38); das_move(__copy_rename_at_38, _Funcbuiltin_0x60_clone_to_move_3490aad6b6204143(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19)));
+	DAS_VERIFY(((length_aa895944cc494027(__context__,das_arg<struct Tags>::pass(__copy_rename_at_38)) == 8) && (small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__copy_rename_at_38),7) == 400)));
+	das_copy(small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__copy_rename_at_38),7),1);
+	DAS_VERIFY((small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),7) == 400));
+	erase_7699815aebbe2735(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),0);
+	DAS_VERIFY(((length_aa895944cc494027(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19)) == 7) && (small_array_at_6e72ca6de7ceb59f(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19),0) == 11)));
+	clear_19073dc6c4a047c4(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19));
+	DAS_ASSERT((length_aa895944cc494027(__context__,das_arg<struct Tags>::pass(__tags_rename_at_19)) == 0));
+	struct Names __names_rename_at_47; das_zero(__names_rename_at_47);
+	push_4e1fb274b5b79ce4(__context__,das_arg<struct Names>::pass(__names_rename_at_47),((char *) "a"));
+	push_4e1fb274b5b79ce4(__context__,das_arg<struct Names>::pass(__names_rename_at_47),((char *) "b"));
+	erase_db02710f6c5e17f4(__context__,das_arg<struct Names>::pass(__names_rename_at_47),0);
+	DAS_VERIFY(((length_2eeec3a31111c56a(__context__,das_arg<struct Names>::pass(__names_rename_at_47)) == 1) && (SimPolicy<char *>::Equ(cast<char *>::from(small_array_at_6ba873c4c4a02e5e(__context__,das_arg<struct Names>::pass(__names_rename_at_47),0)),cast<char *>::from(((char *) "b")),*__context__))));
+	push_4e1fb274b5b79ce4(__context__,das_arg<struct Names>::pass(__names_rename_at_47),((char *) "c"));
+	push_4e1fb274b5b79ce4(__context__,das_arg<struct Names>::pass(__names_rename_at_47),((char *) "d"));
+	DAS_VERIFY((((length_2eeec3a31111c56a(__context__,das_arg<struct Names>::pass(__names_rename_at_47)) == 3) && (SimPolicy<char *>::Equ(cast<char *>::from(small_array_at_6ba873c4c4a02e5e(__context__,das_arg<struct Names>::pass(__names_rename_at_47),0)),cast<char *>::from(((char *) "b")),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(small_array_at_6ba873c4c4a02e5e(__context__,das_arg<struct Names>::pass(__names_rename_at_47),2)),cast<char *>::from(((char *) "d")),*__context__))));
+	finalize_5b06c829554b4657(__context__,das_arg<struct Names>::pass(__names_rename_at_47));
+	DAS_ASSERT((length_2eeec3a31111c56a(__context__,das_arg<struct Names>::pass(__names_rename_at_47)) == 0));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_9217fda5fb53190b
+		aotLib[0xb00d3e185e494e59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_9217fda5fb53190b>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_3490aad6b6204143
+		aotLib[0x60eab01069e6d90c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Tags (*) ( Context * __context__, struct Tags const  &  ),&_Funcbuiltin_0x60_clone_to_move_3490aad6b6204143>>();
+	};
+		// _Funcbuiltin_0x60_emplace_f3054aa6951dfab9
+		aotLib[0x1820c8c418295ac9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_emplace_f3054aa6951dfab9>>();
+	};
+		// _Funcbuiltin_0x60_emplace_98721d99f1def395
+		aotLib[0x81f67d39105974d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * , int32_t  ),&_Funcbuiltin_0x60_emplace_98721d99f1def395>>();
+	};
+		// _Funcbuiltin_0x60_erase_a0d3d30dc9807389
+		aotLib[0xc4522b3c0e92475] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_a0d3d30dc9807389>>();
+	};
+		// _Funcbuiltin_0x60_erase_ca2ed0e0c8a74bd5
+		aotLib[0x81f65577f6bea1a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_erase_ca2ed0e0c8a74bd5>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_76ab6a8882326f97
+		aotLib[0x20e0f7bfb5006d89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_clone_76ab6a8882326f97>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_8f1b55668745e84b
+		aotLib[0x60f7feeaae35f805] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_clone_8f1b55668745e84b>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_reserve_cecea833d1e66117
+		aotLib[0x58482c2f23d3c0ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_cecea833d1e66117>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// clear_19073dc6c4a047c4
+		aotLib[0x2a7c3a2eb85ce3ef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Tags &  ),&clear_19073dc6c4a047c4>>();
+	};
+		// clone_750202d35cdbba45
+		aotLib[0x2f2bf098d223fd90] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Tags & , struct Tags const  &  ),&clone_750202d35cdbba45>>();
+	};
+		// erase_db02710f6c5e17f4
+		aotLib[0x1990a7b039cc732a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Names & , int32_t  ),&erase_db02710f6c5e17f4>>();
+	};
+		// erase_7699815aebbe2735
+		aotLib[0x42acd3d807554cd2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Tags & , int32_t  ),&erase_7699815aebbe2735>>();
+	};
+		// finalize_5b06c829554b4657
+		aotLib[0xfa69961a71ab918c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Names &  ),&finalize_5b06c829554b4657>>();
+	};
+		// length_2eeec3a31111c56a
+		aotLib[0x1b6e0155dc659fd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct Names const  &  ),&length_2eeec3a31111c56a>>();
+	};
+		// length_aa895944cc494027
+		aotLib[0xb36231947d45b2f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct Tags const  &  ),&length_aa895944cc494027>>();
+	};
+		// push_4e1fb274b5b79ce4
+		aotLib[0xf271b555aca86e35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Names & , char * const   ),&push_4e1fb274b5b79ce4>>();
+	};
+		// push_59d6819997126171
+		aotLib[0x1acd09e1eb4ffd3b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Tags & , int32_t  ),&push_59d6819997126171>>();
+	};
+		// small_array_at_6ba873c4c4a02e5e
+		aotLib[0x83fdd638d0abeb02] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * & (*) ( Context * __context__, struct Names & , int32_t  ),&small_array_at_6ba873c4c4a02e5e>>();
+	};
+		// small_array_at_6e72ca6de7ceb59f
+		aotLib[0xce1d262ccb87e3f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t & (*) ( Context * __context__, struct Tags & , int32_t  ),&small_array_at_6e72ca6de7ceb59f>>();
+	};
+		// small_array_at_const_925e4244249c9a81
+		aotLib[0xfa53eed47966f824] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t const  & (*) ( Context * __context__, struct Tags const  & , int32_t  ),&small_array_at_const_925e4244249c9a81>>();
+	};
+		// _Funcsmall_array_0x60_small_array_at_db65a39156580971
+		aotLib[0xd264c88131a90f25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t & (*) ( Context * __context__, TDim<int32_t,4> & , int32_t , TArray<int32_t> & , int32_t  ),&_Funcsmall_array_0x60_small_array_at_db65a39156580971>>();
+	};
+		// _Funcsmall_array_0x60_small_array_at_975be26c57493e45
+		aotLib[0xab08566b49b392dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * & (*) ( Context * __context__, TDim<char *,2> & , int32_t , TArray<char *> & , int32_t  ),&_Funcsmall_array_0x60_small_array_at_975be26c57493e45>>();
+	};
+		// _Funcsmall_array_0x60_small_array_at_const_1ebe1952c182c720
+		aotLib[0xc810e656d718419] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t const  & (*) ( Context * __context__, TDim<int32_t,4> const  & , int32_t , TArray<int32_t> const  & , int32_t  ),&_Funcsmall_array_0x60_small_array_at_const_1ebe1952c182c720>>();
+	};
+		// _Funcsmall_array_0x60_small_array_clear_766fcf15f6a7653d
+		aotLib[0xcd55e1d82427fc75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> & , int32_t & , TArray<int32_t> &  ),&_Funcsmall_array_0x60_small_array_clear_766fcf15f6a7653d>>();
+	};
+		// _Funcsmall_array_0x60_small_array_erase_1b8ec82e6dff174b
+		aotLib[0x36870033a6d57dc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> & , int32_t & , TArray<int32_t> & , int32_t  ),&_Funcsmall_array_0x60_small_array_erase_1b8ec82e6dff174b>>();
+	};
+		// _Funcsmall_array_0x60_small_array_erase_e44790821a5ac8dd
+		aotLib[0x686bf1d5b0242512] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,2> & , int32_t & , TArray<char *> & , int32_t  ),&_Funcsmall_array_0x60_small_array_erase_e44790821a5ac8dd>>();
+	};
+		// _Funcsmall_array_0x60_small_array_push_a3b9101e3bdcdcf4
+		aotLib[0xe1bede542d5e9904] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> & , int32_t & , TArray<int32_t> & , int32_t  ),&_Funcsmall_array_0x60_small_array_push_a3b9101e3bdcdcf4>>();
+	};
+		// _Funcsmall_array_0x60_small_array_push_deada96346665a1a
+		aotLib[0xdd461a8c4c93ecfa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,2> & , int32_t & , TArray<char *> & , char * const   ),&_Funcsmall_array_0x60_small_array_push_deada96346665a1a>>();
+	};
+		// sum_bc1d13163cf95aa4
+		aotLib[0x60257f9cd5f4f313] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct Tags const  &  ),&sum_bc1d13163cf95aa4>>();
+	};
+		// test_b8aa5a143750684d
+		aotLib[0x75052fc93a276835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b8aa5a143750684d>>();
+	};
+		// [[ init script ]]
+		aotLib[0x2842b25bbd1182e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,265 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline void access_test_33f8871ce5e98a12 ( Context * __context__ );
+inline smart_ptr_raw<TestObjectSmart> _Funcbuiltin_0x60_clone_to_move_7c2103a0650bcb7f ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __clone_src_rename_at_220 );
+inline TestObjectSmart * _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_701 );
+inline void clone_1a2a81f499b73008 ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_45, TestObjectSmart * const  __src_rename_at_45 );
+inline void clone_46835e22c3230b84 ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_222, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_222 );
+inline void fn_test_25ee612bb0b041c6 ( Context * __context__ );
+inline smart_ptr_raw<TestObjectSmart> inside_move_test_b31cac113fb1b57e ( Context * __context__ );
+inline TestObjectSmart * inside_scope_test_92cd657905137447 ( Context * __context__ );
+inline void move_test_605c3b1894e32bcd ( Context * __context__ );
+inline void ref_count_test_cf590d484dba2703 ( Context * __context__ );
+inline void scope_test_f3ac16fed5eb479e ( Context * __context__ );
+inline bool test_d3cfe8e86aa1bf05 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void access_test_33f8871ce5e98a12 ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	smart_ptr_raw<TestObjectSmart> __ptr_rename_at_75; das_zero(__ptr_rename_at_75); das_move(__ptr_rename_at_75, das_new_handle<TestObjectSmart,true>::make(__context__));
+	DAS_ASSERT((__ptr_rename_at_75->fooData /*fooData*/ == 1234));
+	int32_t __t_rename_at_77 = das_null_coalescing<int32_t>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(__ptr_rename_at_75,([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),1);
+	DAS_ASSERT((__t_rename_at_77 == 1234));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(__ptr_rename_at_75,([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),__t_rename_at_77),13);
+	DAS_ASSERT((__ptr_rename_at_75->fooData /*fooData*/ == 13));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ptr_rename_at_75);
+	das_copy(__t_rename_at_77,das_null_coalescing<int32_t>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(__ptr_rename_at_75,([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),2));
+	DAS_ASSERT((__t_rename_at_77 == 2));
+	das_move(__ptr_rename_at_75,das_new_handle<TestObjectSmart,true>::make(__context__));
+	das_move(__ptr_rename_at_75->first /*first*/,das_new_handle<TestObjectSmart,true>::make(__context__));
+	DAS_ASSERT((__ptr_rename_at_75->first /*first*/->fooData /*fooData*/ == 1234));
+	DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(das_safe_navigation_handle_ptr<TestObjectSmart,smart_ptr<TestObjectSmart>>::get(__ptr_rename_at_75,([&](const TestObjectSmart * __any) -> auto & {return __any->first /*first*/;})),([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),13) == 1234));
+	das_delete_handle<smart_ptr<TestObjectSmart>>::clear(__context__,__ptr_rename_at_75->first /*first*/);
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ptr_rename_at_75);
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline smart_ptr_raw<TestObjectSmart> _Funcbuiltin_0x60_clone_to_move_7c2103a0650bcb7f ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __clone_src_rename_at_220 )
+{
+	smart_ptr_raw<TestObjectSmart> __clone_dest_rename_at_221; das_zero(__clone_dest_rename_at_221);
+	clone_46835e22c3230b84(__context__,__clone_dest_rename_at_221,__clone_src_rename_at_220);
+	return /* <- */ __clone_dest_rename_at_221;
+}
+
+inline TestObjectSmart * _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_701 )
+{
+	return das_cast<TestObjectSmart *>::cast(__src_rename_at_701);
+}
+
+inline void clone_1a2a81f499b73008 ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_45, TestObjectSmart * const  __src_rename_at_45 )
+{
+	builtin_smart_ptr_clone_ptr(__dest_rename_at_45,__src_rename_at_45);
+}
+
+inline void clone_46835e22c3230b84 ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_222, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_222 )
+{
+	builtin_smart_ptr_clone(__dest_rename_at_222,__src_rename_at_222);
+}
+
+inline void fn_test_25ee612bb0b041c6 ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	smart_ptr<TestObjectSmart> __ptr_rename_at_97; das_zero(__ptr_rename_at_97); das_move(__ptr_rename_at_97, makeTestObjectSmart());
+	DAS_ASSERT((countTestObjectSmart(__ptr_rename_at_97) == 0x1u));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	das_delete_handle<smart_ptr<TestObjectSmart>>::clear(__context__,__ptr_rename_at_97);
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline smart_ptr_raw<TestObjectSmart> inside_move_test_b31cac113fb1b57e ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	smart_ptr_raw<TestObjectSmart> __t1_rename_at_19; das_zero(__t1_rename_at_19); das_move(__t1_rename_at_19, das_new_handle<TestObjectSmart,true>::make(__context__));
+	smart_ptr_raw<TestObjectSmart> __t2_rename_at_20; das_zero(__t2_rename_at_20); das_move(__t2_rename_at_20, __t1_rename_at_19);
+	DAS_ASSERT((builtin_smart_ptr_use_count(__t1_rename_at_19) == 0x0u));
+	DAS_ASSERT((builtin_smart_ptr_use_count(__t2_rename_at_20) == 0x1u));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	return /* <- */ __t2_rename_at_20;
+}
+
+inline TestObjectSmart * inside_scope_test_92cd657905137447 ( Context * __context__ )
+{
+	smart_ptr_raw<TestObjectSmart> __sptr_rename_at_4; das_zero(__sptr_rename_at_4); das_move(__sptr_rename_at_4, das_new_handle<TestObjectSmart,true>::make(__context__));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	return _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__sptr_rename_at_4);
+}
+
+inline void move_test_605c3b1894e32bcd ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	smart_ptr_raw<TestObjectSmart> __t_rename_at_28; das_zero(__t_rename_at_28); das_move(__t_rename_at_28, inside_move_test_b31cac113fb1b57e(__context__));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__t_rename_at_28);
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline void ref_count_test_cf590d484dba2703 ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	smart_ptr_raw<TestObjectSmart> __sptr_rename_at_36; das_zero(__sptr_rename_at_36); das_move(__sptr_rename_at_36, das_new_handle<TestObjectSmart,true>::make(__context__));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	DAS_ASSERT((builtin_smart_ptr_use_count(__sptr_rename_at_36) == 0x1u));
+	TestObjectSmart * __ptr_rename_at_39 = _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__sptr_rename_at_36);
+	TestObjectSmart * __pptr_rename_at_40 = 0;
+	das_copy(__pptr_rename_at_40,_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__sptr_rename_at_36));
+	DAS_ASSERT((equ_sptr_ptr(__sptr_rename_at_36,__ptr_rename_at_39)));
+	DAS_ASSERT((_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__sptr_rename_at_36) == __ptr_rename_at_39));
+	smart_ptr_raw<TestObjectSmart> __qptr_rename_at_44; das_zero(__qptr_rename_at_44);
+	clone_1a2a81f499b73008(__context__,__qptr_rename_at_44,_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__sptr_rename_at_36));
+	DAS_ASSERT((builtin_smart_ptr_use_count(__sptr_rename_at_36) == 0x2u));
+	DAS_ASSERT((equ_sptr_ptr(__qptr_rename_at_44,__ptr_rename_at_39)));
+	DAS_ASSERT((_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__qptr_rename_at_44) == __ptr_rename_at_39));
+	DAS_ASSERT((equ_sptr_sptr(__qptr_rename_at_44,__sptr_rename_at_36)));
+	smart_ptr_raw<TestObjectSmart> __fptr_rename_at_50; das_zero(__fptr_rename_at_50); das_move(__fptr_rename_at_50, _Funcbuiltin_0x60_clone_to_move_7c2103a0650bcb7f(__context__,__qptr_rename_at_44));
+	DAS_ASSERT((builtin_smart_ptr_use_count(__sptr_rename_at_36) == 0x3u));
+	DAS_ASSERT((nequ_sptr_ptr(__fptr_rename_at_50,nullptr)));
+	DAS_ASSERT((equ_ptr_sptr(_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__fptr_rename_at_50),__sptr_rename_at_36)));
+	DAS_ASSERT((equ_sptr_sptr(__fptr_rename_at_50,__qptr_rename_at_44)));
+	DAS_ASSERT((equ_sptr_sptr(__fptr_rename_at_50,__sptr_rename_at_36)));
+	DAS_ASSERT((builtin_smart_ptr_use_count(__sptr_rename_at_36) == 0x3u));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__sptr_rename_at_36);
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	DAS_ASSERT((builtin_smart_ptr_use_count(__sptr_rename_at_36) == 0x0u));
+	DAS_ASSERT((builtin_smart_ptr_use_count(__qptr_rename_at_44) == 0x2u));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__qptr_rename_at_44);
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	DAS_ASSERT((builtin_smart_ptr_use_count(__qptr_rename_at_44) == 0x0u));
+	DAS_ASSERT((builtin_smart_ptr_use_count(__fptr_rename_at_50) == 0x1u));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__fptr_rename_at_50);
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	DAS_ASSERT((builtin_smart_ptr_use_count(__fptr_rename_at_50) == 0x0u));
+}
+
+inline void scope_test_f3ac16fed5eb479e ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	TestObjectSmart * __lostPtr_rename_at_10 = (TestObjectSmart *)inside_scope_test_92cd657905137447(__context__);
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	smart_ptr_raw<TestObjectSmart> __sptr_rename_at_13; das_zero(__sptr_rename_at_13); das_move(__sptr_rename_at_13, das_cast<smart_ptr_raw<TestObjectSmart>>::cast(__lostPtr_rename_at_10));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__sptr_rename_at_13);
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline bool test_d3cfe8e86aa1bf05 ( Context * __context__ )
+{
+	ref_count_test_cf590d484dba2703(__context__);
+	move_test_605c3b1894e32bcd(__context__);
+	scope_test_f3ac16fed5eb479e(__context__);
+	access_test_33f8871ce5e98a12(__context__);
+	fn_test_25ee612bb0b041c6(__context__);
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// access_test_33f8871ce5e98a12
+		aotLib[0x7ccf437ee9b9cad1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&access_test_33f8871ce5e98a12>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_7c2103a0650bcb7f
+		aotLib[0xc261b512dc62280f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TestObjectSmart> (*) ( Context * __context__, smart_ptr_raw<TestObjectSmart> const   ),&_Funcbuiltin_0x60_clone_to_move_7c2103a0650bcb7f>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d
+		aotLib[0x76f9b1b1446f8ac5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TestObjectSmart * (*) ( Context * __context__, smart_ptr_raw<TestObjectSmart> const   ),&_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d>>();
+	};
+		// clone_1a2a81f499b73008
+		aotLib[0x6206cb632dbda991] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<TestObjectSmart> & , TestObjectSmart * const   ),&clone_1a2a81f499b73008>>();
+	};
+		// clone_46835e22c3230b84
+		aotLib[0x5faa129d73862495] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<TestObjectSmart> & , smart_ptr_raw<TestObjectSmart> const   ),&clone_46835e22c3230b84>>();
+	};
+		// fn_test_25ee612bb0b041c6
+		aotLib[0x9894704f83e99485] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&fn_test_25ee612bb0b041c6>>();
+	};
+		// inside_move_test_b31cac113fb1b57e
+		aotLib[0x2a6a13808be72c69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TestObjectSmart> (*) ( Context * __context__ ),&inside_move_test_b31cac113fb1b57e>>();
+	};
+		// inside_scope_test_92cd657905137447
+		aotLib[0xc4ecdc581abdb6d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TestObjectSmart * (*) ( Context * __context__ ),&inside_scope_test_92cd657905137447>>();
+	};
+		// move_test_605c3b1894e32bcd
+		aotLib[0xdd3eb102c452e4ec] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&move_test_605c3b1894e32bcd>>();
+	};
+		// ref_count_test_cf590d484dba2703
+		aotLib[0x5acd3e642e14e000] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&ref_count_test_cf590d484dba2703>>();
+	};
+		// scope_test_f3ac16fed5eb479e
+		aotLib[0x46fec5d664a453b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&scope_test_f3ac16fed5eb479e>>();
+	};
+		// test_d3cfe8e86aa1bf05
+		aotLib[0xfa629d34c6962701] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d3cfe8e86aa1bf05>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,443 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+ // require soa
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_1[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure SoaIndexMacro
+// unused structure SoaIndexVisitor
+// unused structure SoaLoopIterator
+// unused structure SoaStructMacro
+namespace  {
+
+struct Particle {
+	float3 position;
+	float3 velocity;
+	char * name;
+};
+static_assert(sizeof(Particle)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Particle,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,velocity)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,name)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Particle_SOA {
+	TArray<float3> position;
+	TArray<float3> velocity;
+	TArray<char *> name;
+};
+static_assert(sizeof(Particle_SOA)==72,"structure size mismatch with DAS");
+static_assert(offsetof(Particle_SOA,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle_SOA,velocity)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle_SOA,name)==48,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_erase_55046d2d98452dc7 ( Context * __context__, TArray<float3> & __Arr_rename_at_81, int32_t __at_rename_at_81 );
+inline void _Funcbuiltin_0x60_erase_ca2ed0e0c8a74bd5 ( Context * __context__, TArray<char *> & __Arr_rename_at_81, int32_t __at_rename_at_81 );
+inline void _Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43 ( Context * __context__, TArray<float3> & __Arr_rename_at_75, float3 __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_push_clone_8f1b55668745e84b ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75, int32_t __at_rename_at_75 );
+inline void _Funcbuiltin_0x60_reserve_5e4ae50957d101f9 ( Context * __context__, TArray<float3> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void clear_50eee2d370cd0474 ( Context * __context__, struct Particle_SOA & __soa_rename_at_4 );
+inline void erase_2a29d67685471b2f ( Context * __context__, struct Particle_SOA & __soa_rename_at_4, int32_t __index_rename_at_4 );
+inline int32_t length_87485c6ac5f3380a ( Context * __context__, struct Particle_SOA const  & __soa_rename_at_4 );
+inline struct Particle_SOA make_particles_cd3d5d1fb35d7f06 ( Context * __context__, int32_t __count_rename_at_9 );
+inline void push_b5ece1bc686adee2 ( Context * __context__, struct Particle_SOA & __soa_rename_at_4, struct Particle const  & __value_rename_at_4 );
+inline void reserve_5c9e0aacf247c3d7 ( Context * __context__, struct Particle_SOA & __soa_rename_at_4, int32_t __newSize_rename_at_4 );
+inline void resize_8286ccc62d2601f9 ( Context * __context__, struct Particle_SOA & __soa_rename_at_4, int32_t __newSize_rename_at_4 );
+inline bool test_36d0dd52268736ab ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_erase_55046d2d98452dc7 ( Context * __context__, TArray<float3> &  __Arr_rename_at_81, int32_t __at_rename_at_81 )
+{
+	builtin_array_erase(das_arg<TArray<float3>>::pass(__Arr_rename_at_81),__at_rename_at_81,12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_erase_ca2ed0e0c8a74bd5 ( Context * __context__, TArray<char *> &  __Arr_rename_at_81, int32_t __at_rename_at_81 )
+{
+	builtin_array_erase(das_arg<TArray<char *>>::pass(__Arr_rename_at_81),__at_rename_at_81,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43 ( Context * __context__, TArray<float3> &  __Arr_rename_at_75, float3 __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<float3>>::pass(__Arr_rename_at_75),__at_rename_at_75,12,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_8f1b55668745e84b ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75, int32_t __at_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_zero(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),__at_rename_at_75,8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_reserve_5e4ae50957d101f9 ( Context * __context__, TArray<float3> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<float3>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<char *>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float3>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void clear_50eee2d370cd0474 ( Context * __context__, struct Particle_SOA &  __soa_rename_at_4 )
+{
+	builtin_array_clear(das_arg<TArray<float3>>::pass(__soa_rename_at_4.position),__context__);
+	builtin_array_clear(das_arg<TArray<float3>>::pass(__soa_rename_at_4.velocity),__context__);
+	builtin_array_clear(das_arg<TArray<char *>>::pass(__soa_rename_at_4.name),__context__);
+}
+
+inline void erase_2a29d67685471b2f ( Context * __context__, struct Particle_SOA &  __soa_rename_at_4, int32_t __index_rename_at_4 )
+{
+	_Funcbuiltin_0x60_erase_55046d2d98452dc7(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_4.position),__index_rename_at_4);
+	_Funcbuiltin_0x60_erase_55046d2d98452dc7(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_4.velocity),__index_rename_at_4);
+	_Funcbuiltin_0x60_erase_ca2ed0e0c8a74bd5(__context__,das_arg<TArray<char *>>::pass(__soa_rename_at_4.name),__index_rename_at_4);
+}
+
+inline int32_t length_87485c6ac5f3380a ( Context * __context__, struct Particle_SOA const  &  __soa_rename_at_4 )
+{
+	return builtin_array_size(__soa_rename_at_4.position);
+}
+
+inline struct Particle_SOA make_particles_cd3d5d1fb35d7f06 ( Context * __context__, int32_t __count_rename_at_9 )
+{
+	struct Particle_SOA __soa_rename_at_10; das_zero(__soa_rename_at_10);
+	reserve_5c9e0aacf247c3d7(__context__,das_arg<struct Particle_SOA>::pass(__soa_rename_at_10),__count_rename_at_9);
+	{
+		bool __need_loop_12 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__count_rename_at_9));
+		int32_t __i_rename_at_12;
+		__need_loop_12 = __i_iterator.first(__context__,(__i_rename_at_12)) && __need_loop_12;
+		for ( ; __need_loop_12 ; __need_loop_12 = __i_iterator.next(__context__,(__i_rename_at_12)) )
+		{
+			struct Particle _temp_make_local_13_48;
+			push_b5ece1bc686adee2(__context__,das_arg<struct Particle_SOA>::pass(__soa_rename_at_10),das_arg<struct Particle>::pass((([&]() -> struct Particle& {
+				das_copy((_temp_make_local_13_48.position),(v_splats(__i_rename_at_12)));
+				das_copy((_temp_make_local_13_48.velocity),(v_make_vec4f(1.f,2.f,3.f,0.f)));
+				das_copy((_temp_make_local_13_48.name),(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "p")), cast<int32_t>::from(__i_rename_at_12)))));
+				return _temp_make_local_13_48;
+			})())));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_12));
+	};
+	return /* <- */ __soa_rename_at_10;
+}
+
+inline void push_b5ece1bc686adee2 ( Context * __context__, struct Particle_SOA &  __soa_rename_at_4, struct Particle const  &  __value_rename_at_4 )
+{
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_4.position),__value_rename_at_4.position,-1);
+	_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_4.velocity),__value_rename_at_4.velocity,-1);
+	_Funcbuiltin_0x60_push_clone_8f1b55668745e84b(__context__,das_arg<TArray<char *>>::pass(__soa_rename_at_4.name),__value_rename_at_4.name,-1);
+}
+
+inline void reserve_5c9e0aacf247c3d7 ( Context * __context__, struct Particle_SOA &  __soa_rename_at_4, int32_t __newSize_rename_at_4 )
+{
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_4.position),__newSize_rename_at_4);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_4.velocity),__newSize_rename_at_4);
+	_Funcbuiltin_0x60_reserve_cecea833d1e66117(__context__,das_arg<TArray<char *>>::pass(__soa_rename_at_4.name),__newSize_rename_at_4);
+}
+
+inline void resize_8286ccc62d2601f9 ( Context * __context__, struct Particle_SOA &  __soa_rename_at_4, int32_t __newSize_rename_at_4 )
+{
+	_Funcbuiltin_0x60_resize_d3b08ad0141c2c31(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_4.position),__newSize_rename_at_4);
+	_Funcbuiltin_0x60_resize_d3b08ad0141c2c31(__context__,das_arg<TArray<float3>>::pass(__soa_rename_at_4.velocity),__newSize_rename_at_4);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__soa_rename_at_4.name),__newSize_rename_at_4);
+}
+
+inline bool test_36d0dd52268736ab ( Context * __context__ )
+{
+	struct Particle_SOA __soa_rename_at_18; das_zero(__soa_rename_at_18); das_move(__soa_rename_at_18, make_particles_cd3d5d1fb35d7f06(__context__,10));
+	DAS_ASSERT((length_87485c6ac5f3380a(__context__,das_arg<struct Particle_SOA>::pass(__soa_rename_at_18)) == 10));
+	DAS_ASSERT((((builtin_array_size(das_arg<TArray<float3>>::pass(__soa_rename_at_18.position)) == 10) && (builtin_array_size(das_arg<TArray<float3>>::pass(__soa_rename_at_18.velocity)) == 10)) && (builtin_array_size(das_arg<TArray<char *>>::pass(__soa_rename_at_18.name)) == 10)));
+	{
+		bool __need_loop_22 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,length_87485c6ac5f3380a(__context__,das_arg<struct Particle_SOA>::pass(__soa_rename_at_18))));
+		int32_t __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&(__soa_rename_at_18.position(__i_rename_at_22,__context__)),__soa_rename_at_18.velocity(__i_rename_at_22,__context__),*__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+	DAS_ASSERT((SimPolicy<float3>::Equ(__soa_rename_at_18.position(3,__context__),v_make_vec4f(4.f,5.f,6.f,0.f),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__soa_rename_at_18.name(3,__context__)),cast<char *>::from(((char *) "p3")),*__context__)));
+	{
+		bool __need_loop_27 = true;
+		// pos : float3&
+		das_iterator<TArray<float3>> __pos_iterator(__soa_rename_at_18.position);
+		float3 * __pos_rename_at_27;
+		__need_loop_27 = __pos_iterator.first(__context__,(__pos_rename_at_27)) && __need_loop_27;
+		// vel : float3&
+		das_iterator<TArray<float3>> __vel_iterator(__soa_rename_at_18.velocity);
+		float3 * __vel_rename_at_27;
+		__need_loop_27 = __vel_iterator.first(__context__,(__vel_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __pos_iterator.next(__context__,(__pos_rename_at_27)) && __vel_iterator.next(__context__,(__vel_rename_at_27)) )
+		{
+			SimPolicy<float3>::SetSub((char *)&((*__pos_rename_at_27)),(*__vel_rename_at_27),*__context__);
+		}
+		__pos_iterator.close(__context__,(__pos_rename_at_27));
+		__vel_iterator.close(__context__,(__vel_rename_at_27));
+	};
+	{
+		bool __need_loop_29 = true;
+		// pos : float3&
+		das_iterator<TArray<float3>> __pos_iterator(__soa_rename_at_18.position);
+		float3 * __pos_rename_at_29;
+		__need_loop_29 = __pos_iterator.first(__context__,(__pos_rename_at_29)) && __need_loop_29;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __pos_iterator.next(__context__,(__pos_rename_at_29)) && __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			DAS_ASSERT((SimPolicy<float3>::Equ((*__pos_rename_at_29),v_splats(__i_rename_at_29),*__context__)));
+		}
+		__pos_iterator.close(__context__,(__pos_rename_at_29));
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	{
+		bool __need_loop_32 = true;
+		// __soa_p_position : float3&
+		das_iterator<TArray<float3>> ____soa_p_position_iterator(__soa_rename_at_18.position);
+		float3 * ____soa_p_position_rename_at_32;
+		__need_loop_32 = ____soa_p_position_iterator.first(__context__,(____soa_p_position_rename_at_32)) && __need_loop_32;
+		// __soa_p_velocity : float3&
+		das_iterator<TArray<float3>> ____soa_p_velocity_iterator(__soa_rename_at_18.velocity);
+		float3 * ____soa_p_velocity_rename_at_32;
+		__need_loop_32 = ____soa_p_velocity_iterator.first(__context__,(____soa_p_velocity_rename_at_32)) && __need_loop_32;
+		for ( ; __need_loop_32 ; __need_loop_32 = ____soa_p_position_iterator.next(__context__,(____soa_p_position_rename_at_32)) && ____soa_p_velocity_iterator.next(__context__,(____soa_p_velocity_rename_at_32)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*____soa_p_position_rename_at_32)),(*____soa_p_velocity_rename_at_32),*__context__);
+		}
+		____soa_p_position_iterator.close(__context__,(____soa_p_position_rename_at_32));
+		____soa_p_velocity_iterator.close(__context__,(____soa_p_velocity_rename_at_32));
+	};
+	int32_t __count_rename_at_34 = 0;
+	{
+		bool __need_loop_35 = true;
+		// __soa_p_position : float3&
+		das_iterator<TArray<float3>> ____soa_p_position_iterator(__soa_rename_at_18.position);
+		float3 * ____soa_p_position_rename_at_35;
+		__need_loop_35 = ____soa_p_position_iterator.first(__context__,(____soa_p_position_rename_at_35)) && __need_loop_35;
+		// __soa_p_name : string&
+		das_iterator<TArray<char *>> ____soa_p_name_iterator(__soa_rename_at_18.name);
+		char * * ____soa_p_name_rename_at_35;
+		__need_loop_35 = ____soa_p_name_iterator.first(__context__,(____soa_p_name_rename_at_35)) && __need_loop_35;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_35;
+		__need_loop_35 = __i_iterator.first(__context__,(__i_rename_at_35)) && __need_loop_35;
+		for ( ; __need_loop_35 ; __need_loop_35 = ____soa_p_position_iterator.next(__context__,(____soa_p_position_rename_at_35)) && ____soa_p_name_iterator.next(__context__,(____soa_p_name_rename_at_35)) && __i_iterator.next(__context__,(__i_rename_at_35)) )
+		{
+			DAS_ASSERT(((SimPolicy<float3>::Equ((*____soa_p_position_rename_at_35),(SimPolicy<float3>::Add(v_splats(__i_rename_at_35),v_make_vec4f(1.f,2.f,3.f,0.f),*__context__)),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from((*____soa_p_name_rename_at_35)),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "p")), cast<int32_t>::from(__i_rename_at_35)))),*__context__))));
+			__count_rename_at_34++;
+		}
+		____soa_p_position_iterator.close(__context__,(____soa_p_position_rename_at_35));
+		____soa_p_name_iterator.close(__context__,(____soa_p_name_rename_at_35));
+		__i_iterator.close(__context__,(__i_rename_at_35));
+	};
+	DAS_ASSERT((__count_rename_at_34 == 10));
+	{
+		bool __need_loop_39 = true;
+		// __soa_p_position : float3&
+		das_iterator<TArray<float3>> ____soa_p_position_iterator(__soa_rename_at_18.position);
+		float3 * ____soa_p_position_rename_at_39;
+		__need_loop_39 = ____soa_p_position_iterator.first(__context__,(____soa_p_position_rename_at_39)) && __need_loop_39;
+		// __soa_p_velocity : float3&
+		das_iterator<TArray<float3>> ____soa_p_velocity_iterator(__soa_rename_at_18.velocity);
+		float3 * ____soa_p_velocity_rename_at_39;
+		__need_loop_39 = ____soa_p_velocity_iterator.first(__context__,(____soa_p_velocity_rename_at_39)) && __need_loop_39;
+		for ( ; __need_loop_39 ; __need_loop_39 = ____soa_p_position_iterator.next(__context__,(____soa_p_position_rename_at_39)) && ____soa_p_velocity_iterator.next(__context__,(____soa_p_velocity_rename_at_39)) )
+		{
+			SimPolicy<float3>::SetSub((char *)&((*____soa_p_position_rename_at_39)),(*____soa_p_velocity_rename_at_39),*__context__);
+		}
+		____soa_p_position_iterator.close(__context__,(____soa_p_position_rename_at_39));
+		____soa_p_velocity_iterator.close(__context__,(____soa_p_velocity_rename_at_39));
+	};
+	erase_2a29d67685471b2f(__context__,das_arg<struct Particle_SOA>::pass(__soa_rename_at_18),0);
+	DAS_ASSERT(((length_87485c6ac5f3380a(__context__,das_arg<struct Particle_SOA>::pass(__soa_rename_at_18)) == 9) && (SimPolicy<char *>::Equ(cast<char *>::from(__soa_rename_at_18.name(0,__context__)),cast<char *>::from(((char *) "p1")),*__context__))));
+	resize_8286ccc62d2601f9(__context__,das_arg<struct Particle_SOA>::pass(__soa_rename_at_18),20);
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<char *>>::pass(__soa_rename_at_18.name)) == 20) && (SimPolicy<char *>::Equ(cast<char *>::from(__soa_rename_at_18.name(19,__context__)),cast<char *>::from(((char *) "")),*__context__))));
+	clear_50eee2d370cd0474(__context__,das_arg<struct Particle_SOA>::pass(__soa_rename_at_18));
+	DAS_ASSERT(((length_87485c6ac5f3380a(__context__,das_arg<struct Particle_SOA>::pass(__soa_rename_at_18)) == 0) && (builtin_array_size(das_arg<TArray<float3>>::pass(__soa_rename_at_18.velocity)) == 0)));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_erase_55046d2d98452dc7
+		aotLib[0x266839218f8c4cd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_erase_55046d2d98452dc7>>();
+	};
+		// _Funcbuiltin_0x60_erase_ca2ed0e0c8a74bd5
+		aotLib[0x81f65577f6bea1a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_erase_ca2ed0e0c8a74bd5>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43
+		aotLib[0xb6bb7bced1d80885] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , float3 , int32_t  ),&_Funcbuiltin_0x60_push_clone_c5aa4c4cc732cf43>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_8f1b55668745e84b
+		aotLib[0x60f7feeaae35f805] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_clone_8f1b55668745e84b>>();
+	};
+		// _Funcbuiltin_0x60_reserve_5e4ae50957d101f9
+		aotLib[0xdc4ac0a7c38b2c45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_reserve_5e4ae50957d101f9>>();
+	};
+		// _Funcbuiltin_0x60_reserve_cecea833d1e66117
+		aotLib[0x58482c2f23d3c0ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_cecea833d1e66117>>();
+	};
+		// _Funcbuiltin_0x60_resize_d3b08ad0141c2c31
+		aotLib[0x6cbb6db64f4979] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_resize_d3b08ad0141c2c31>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// clear_50eee2d370cd0474
+		aotLib[0x5155a76ddc06d485] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Particle_SOA &  ),&clear_50eee2d370cd0474>>();
+	};
+		// erase_2a29d67685471b2f
+		aotLib[0xe2a32320839a4fe6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Particle_SOA & , int32_t  ),&erase_2a29d67685471b2f>>();
+	};
+		// length_87485c6ac5f3380a
+		aotLib[0x6793c0b1c5e73161] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, struct Particle_SOA const  &  ),&length_87485c6ac5f3380a>>();
+	};
+		// make_particles_cd3d5d1fb35d7f06
+		aotLib[0x1b1639848770e10a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<struct Particle_SOA (*) ( Context * __context__, int32_t  ),&make_particles_cd3d5d1fb35d7f06>>();
+	};
+		// push_b5ece1bc686adee2
+		aotLib[0xcfbf773d378c6df9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Particle_SOA & , struct Particle const  &  ),&push_b5ece1bc686adee2>>();
+	};
+		// reserve_5c9e0aacf247c3d7
+		aotLib[0x7a6f5640da540423] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Particle_SOA & , int32_t  ),&reserve_5c9e0aacf247c3d7>>();
+	};
+		// resize_8286ccc62d2601f9
+		aotLib[0x14980a1287ee4981] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct Particle_SOA & , int32_t  ),&resize_8286ccc62d2601f9>>();
+	};
+		// test_36d0dd52268736ab
+		aotLib[0xc96269afbe7958a7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_36d0dd52268736ab>>();
+	};
+		// [[ init script ]]
+		aotLib[0x39726858ecaf3689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,3008 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__223f839;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__a6c45d85;
+extern VarInfo __var_info__de163b27;
+extern VarInfo __var_info__5ed2e652;
+extern VarInfo __var_info__eedd2c27;
+extern VarInfo __var_info__9a0fd5bc;
+extern VarInfo __var_info__e7e9c971;
+extern VarInfo __var_info__2e604ad1;
+extern VarInfo __var_info__b8a999d5;
+extern VarInfo __var_info__cf0d811d;
+extern VarInfo __var_info__f7f1ba84;
+extern VarInfo __var_info__e0e7699c;
+extern VarInfo __var_info__89a10290;
+extern VarInfo __var_info__ce36f087;
+extern VarInfo __var_info__b879968e;
+extern VarInfo __var_info__6109dfcb;
+extern VarInfo __var_info__640a81ee;
+extern VarInfo __var_info__903f1508;
+extern VarInfo __var_info__45bc46a5;
+extern VarInfo __var_info__644a27a8;
+extern VarInfo __var_info__3254669;
+extern VarInfo __var_info__d35b9577;
+extern VarInfo __var_info__8547d822;
+extern VarInfo __var_info__81bdf0e;
+extern VarInfo __var_info__dc8f835a;
+extern VarInfo __var_info__112ffd27;
+extern VarInfo __var_info__b52a3c86;
+extern VarInfo __var_info__ece2fd01;
+extern VarInfo __var_info__c817f159;
+extern VarInfo __var_info__e5ff793b;
+extern VarInfo __var_info__b245319f;
+extern VarInfo __var_info__f248abbc;
+extern VarInfo __var_info__cfa1b2ec;
+extern VarInfo __var_info__14e83451;
+extern VarInfo __var_info__50b9dd40;
+extern VarInfo __var_info__eb0b1fe6;
+extern VarInfo __var_info__4b263253;
+extern VarInfo __var_info__3447a682;
+extern VarInfo __var_info__e1594cdb;
+extern VarInfo __var_info__31c7d607;
+extern VarInfo __var_info__eddd2a94;
+extern VarInfo __var_info__e665120f;
+extern VarInfo __var_info__b2e84084;
+extern VarInfo __var_info__bcd36cd1;
+extern VarInfo __var_info__57260f29;
+extern VarInfo __var_info__dcb6c22e;
+extern VarInfo __var_info__34f53d6a;
+extern FuncInfo __func_info__b10fd4e2;
+extern FuncInfo __func_info__c3a35c52;
+extern FuncInfo __func_info__9a19c2be;
+extern FuncInfo __func_info__27ac9802;
+extern FuncInfo __func_info__f0811382;
+extern FuncInfo __func_info__508d84b6;
+extern FuncInfo __func_info__aaa238d2;
+extern FuncInfo __func_info__b03abe67;
+extern FuncInfo __func_info__6d74e354;
+extern FuncInfo __func_info__420e48e4;
+extern FuncInfo __func_info__2de8a522;
+extern FuncInfo __func_info__bf2374c8;
+extern FuncInfo __func_info__5396827e;
+extern FuncInfo __func_info__e3b4ac8c;
+extern FuncInfo __func_info__35457e1c;
+extern FuncInfo __func_info__25b18b38;
+extern FuncInfo __func_info__c68b4bc8;
+extern FuncInfo __func_info__4b197c1a;
+extern FuncInfo __func_info__c973faee;
+extern FuncInfo __func_info__194109f8;
+extern FuncInfo __func_info__63627cbe;
+extern FuncInfo __func_info__b98c23a2;
+extern FuncInfo __func_info__7e21c71e;
+extern FuncInfo __func_info__4b991553;
+extern FuncInfo __func_info__bcd8c1a6;
+extern FuncInfo __func_info__a475d94a;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xeedd2c27, "x", 0 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xeddd2a94, "y", 4 };
+VarInfo * __struct_info__b1589007_fields[2] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 2, 8, -1, nullptr, 0xb1589007 };
+VarInfo __func_info__b10fd4e2_field_0 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x45bc46a5, "a", 0 };
+VarInfo __func_info__b10fd4e2_field_1 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x81bdf0e, "b", 0 };
+VarInfo * __func_info__b10fd4e2_fields[2] =  { &__func_info__b10fd4e2_field_0, &__func_info__b10fd4e2_field_1 };
+FuncInfo __func_info__b10fd4e2 = {"invoke block<(a:double const;b:double const):bool> const", "", __func_info__b10fd4e2_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xb10fd4e2, 0x0 };
+VarInfo __func_info__c3a35c52_field_0 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xe5ff793b, "a", 0 };
+VarInfo __func_info__c3a35c52_field_1 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xb879968e, "b", 0 };
+VarInfo * __func_info__c3a35c52_fields[2] =  { &__func_info__c3a35c52_field_0, &__func_info__c3a35c52_field_1 };
+FuncInfo __func_info__c3a35c52 = {"invoke block<(a:uint64 const explicit;b:uint64 const explicit):bool> const", "", __func_info__c3a35c52_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xc3a35c52, 0x0 };
+VarInfo __func_info__9a19c2be_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x57260f29, "f", 0 };
+VarInfo * __func_info__9a19c2be_fields[1] =  { &__func_info__9a19c2be_field_0 };
+FuncInfo __func_info__9a19c2be = {"invoke block<(f:Foo const):float const> const", "", __func_info__9a19c2be_fields, 1, 32, &__type_info__223f839, nullptr,0,0x9a19c2be, 0x0 };
+VarInfo __func_info__27ac9802_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0xc817f159, "a", 0 };
+VarInfo __func_info__27ac9802_field_1 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0xeb0b1fe6, "b", 0 };
+VarInfo * __func_info__27ac9802_fields[2] =  { &__func_info__27ac9802_field_0, &__func_info__27ac9802_field_1 };
+FuncInfo __func_info__27ac9802 = {"invoke block<(a:string const;b:string const):bool> const", "", __func_info__27ac9802_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x27ac9802, 0x0 };
+VarInfo __func_info__f0811382_field_0 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x3447a682, "a", 0 };
+VarInfo __func_info__f0811382_field_1 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x14e83451, "b", 0 };
+VarInfo * __func_info__f0811382_fields[2] =  { &__func_info__f0811382_field_0, &__func_info__f0811382_field_1 };
+FuncInfo __func_info__f0811382 = {"invoke block<(a:uint64 const;b:uint64 const):bool> const", "", __func_info__f0811382_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xf0811382, 0x0 };
+VarInfo __func_info__508d84b6_field_0 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x8547d822, "a", 0 };
+VarInfo __func_info__508d84b6_field_1 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x112ffd27, "b", 0 };
+VarInfo * __func_info__508d84b6_fields[2] =  { &__func_info__508d84b6_field_0, &__func_info__508d84b6_field_1 };
+FuncInfo __func_info__508d84b6 = {"invoke block<(a:double const explicit;b:double const explicit):bool> const", "", __func_info__508d84b6_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x508d84b6, 0x0 };
+VarInfo __func_info__aaa238d2_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x57260f29, "f", 0 };
+VarInfo * __func_info__aaa238d2_fields[1] =  { &__func_info__aaa238d2_field_0 };
+FuncInfo __func_info__aaa238d2 = {"invoke block<(f:Foo const):int> const", "", __func_info__aaa238d2_fields, 1, 32, &__type_info__95e97e5e, nullptr,0,0xaaa238d2, 0x0 };
+VarInfo __func_info__b03abe67_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x57260f29, "f", 0 };
+VarInfo * __func_info__b03abe67_fields[1] =  { &__func_info__b03abe67_field_0 };
+FuncInfo __func_info__b03abe67 = {"invoke block<(f:Foo const):float> const", "", __func_info__b03abe67_fields, 1, 32, &__type_info__a6c45d85, nullptr,0,0xb03abe67, 0x0 };
+VarInfo __func_info__6d74e354_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xdc8f835a, "p", 0 };
+VarInfo __func_info__6d74e354_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xece2fd01, "q", 0 };
+VarInfo * __func_info__6d74e354_fields[2] =  { &__func_info__6d74e354_field_0, &__func_info__6d74e354_field_1 };
+FuncInfo __func_info__6d74e354 = {"invoke block<(p:int const;q:int const):bool> const", "", __func_info__6d74e354_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x6d74e354, 0x0 };
+VarInfo __func_info__420e48e4_field_0 =  { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x50b9dd40, "a", 0 };
+VarInfo __func_info__420e48e4_field_1 =  { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x31c7d607, "b", 0 };
+VarInfo * __func_info__420e48e4_fields[2] =  { &__func_info__420e48e4_field_0, &__func_info__420e48e4_field_1 };
+FuncInfo __func_info__420e48e4 = {"invoke block<(a:int64 const explicit;b:int64 const explicit):bool> const", "", __func_info__420e48e4_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x420e48e4, 0x0 };
+VarInfo __func_info__2de8a522_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0xb52a3c86, "a", 0 };
+VarInfo __func_info__2de8a522_field_1 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0xe665120f, "b", 0 };
+VarInfo * __func_info__2de8a522_fields[2] =  { &__func_info__2de8a522_field_0, &__func_info__2de8a522_field_1 };
+FuncInfo __func_info__2de8a522 = {"invoke block<(a:string const explicit;b:string const explicit):bool> const", "", __func_info__2de8a522_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x2de8a522, 0x0 };
+VarInfo __func_info__bf2374c8_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0xce36f087, "p", 0 };
+VarInfo __func_info__bf2374c8_field_1 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0xcfa1b2ec, "q", 0 };
+VarInfo * __func_info__bf2374c8_fields[2] =  { &__func_info__bf2374c8_field_0, &__func_info__bf2374c8_field_1 };
+FuncInfo __func_info__bf2374c8 = {"invoke block<(p:Foo const;q:Foo const):bool> const", "", __func_info__bf2374c8_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xbf2374c8, 0x0 };
+VarInfo __func_info__5396827e_field_0 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xbcd36cd1, "a", 0 };
+VarInfo __func_info__5396827e_field_1 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x89a10290, "b", 0 };
+VarInfo * __func_info__5396827e_fields[2] =  { &__func_info__5396827e_field_0, &__func_info__5396827e_field_1 };
+FuncInfo __func_info__5396827e = {"invoke block<(a:uint const explicit;b:uint const explicit):bool> const", "", __func_info__5396827e_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x5396827e, 0x0 };
+VarInfo __func_info__e3b4ac8c_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x903f1508, "x", 0 };
+VarInfo __func_info__e3b4ac8c_field_1 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x3254669, "y", 0 };
+VarInfo * __func_info__e3b4ac8c_fields[2] =  { &__func_info__e3b4ac8c_field_0, &__func_info__e3b4ac8c_field_1 };
+FuncInfo __func_info__e3b4ac8c = {"invoke block<(x:Foo const explicit;y:Foo const explicit):bool> const", "", __func_info__e3b4ac8c_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xe3b4ac8c, 0x0 };
+VarInfo __func_info__35457e1c_field_0 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x4b263253, "a", 0 };
+VarInfo __func_info__35457e1c_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xb2e84084, "b", 0 };
+VarInfo * __func_info__35457e1c_fields[2] =  { &__func_info__35457e1c_field_0, &__func_info__35457e1c_field_1 };
+FuncInfo __func_info__35457e1c = {"invoke block<(a:float const explicit;b:float const explicit):bool> const", "", __func_info__35457e1c_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x35457e1c, 0x0 };
+VarInfo __func_info__25b18b38_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x2e604ad1, "a", 0 };
+VarInfo __func_info__25b18b38_field_1 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x5ed2e652, "b", 0 };
+VarInfo * __func_info__25b18b38_fields[2] =  { &__func_info__25b18b38_field_0, &__func_info__25b18b38_field_1 };
+FuncInfo __func_info__25b18b38 = {"invoke block<(a:Foo const explicit;b:Foo const explicit):bool> const", "", __func_info__25b18b38_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x25b18b38, 0x0 };
+VarInfo __func_info__c68b4bc8_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0xb245319f, "x", 0 };
+VarInfo __func_info__c68b4bc8_field_1 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0xf7f1ba84, "y", 0 };
+VarInfo * __func_info__c68b4bc8_fields[2] =  { &__func_info__c68b4bc8_field_0, &__func_info__c68b4bc8_field_1 };
+FuncInfo __func_info__c68b4bc8 = {"invoke block<(x:Foo const;y:Foo const):bool> const", "", __func_info__c68b4bc8_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xc68b4bc8, 0x0 };
+VarInfo __func_info__4b197c1a_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x57260f29, "f", 0 };
+VarInfo * __func_info__4b197c1a_fields[1] =  { &__func_info__4b197c1a_field_0 };
+FuncInfo __func_info__4b197c1a = {"invoke block<(f:Foo const):string> const", "", __func_info__4b197c1a_fields, 1, 32, &__type_info__17c16538, nullptr,0,0x4b197c1a, 0x0 };
+VarInfo __func_info__c973faee_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x9a0fd5bc, "a", 0 };
+VarInfo __func_info__c973faee_field_1 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0xb8a999d5, "b", 0 };
+VarInfo * __func_info__c973faee_fields[2] =  { &__func_info__c973faee_field_0, &__func_info__c973faee_field_1 };
+FuncInfo __func_info__c973faee = {"invoke block<(a:Foo const;b:Foo const):bool> const", "", __func_info__c973faee_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xc973faee, 0x0 };
+VarInfo __func_info__194109f8_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xdcb6c22e, "a", 0 };
+VarInfo __func_info__194109f8_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xcf0d811d, "b", 0 };
+VarInfo * __func_info__194109f8_fields[2] =  { &__func_info__194109f8_field_0, &__func_info__194109f8_field_1 };
+FuncInfo __func_info__194109f8 = {"invoke block<(a:int const explicit;b:int const explicit):bool> const", "", __func_info__194109f8_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x194109f8, 0x0 };
+VarInfo __func_info__63627cbe_field_0 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x34f53d6a, "a", 0 };
+VarInfo __func_info__63627cbe_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xe1594cdb, "b", 0 };
+VarInfo * __func_info__63627cbe_fields[2] =  { &__func_info__63627cbe_field_0, &__func_info__63627cbe_field_1 };
+FuncInfo __func_info__63627cbe = {"invoke block<(a:float const;b:float const):bool> const", "", __func_info__63627cbe_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x63627cbe, 0x0 };
+VarInfo __func_info__b98c23a2_field_0 =  { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xde163b27, "a", 0 };
+VarInfo __func_info__b98c23a2_field_1 =  { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x640a81ee, "b", 0 };
+VarInfo * __func_info__b98c23a2_fields[2] =  { &__func_info__b98c23a2_field_0, &__func_info__b98c23a2_field_1 };
+FuncInfo __func_info__b98c23a2 = {"invoke block<(a:int64 const;b:int64 const):bool> const", "", __func_info__b98c23a2_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xb98c23a2, 0x0 };
+VarInfo __func_info__7e21c71e_field_0 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xf248abbc, "a", 0 };
+VarInfo __func_info__7e21c71e_field_1 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xd35b9577, "b", 0 };
+VarInfo * __func_info__7e21c71e_fields[2] =  { &__func_info__7e21c71e_field_0, &__func_info__7e21c71e_field_1 };
+FuncInfo __func_info__7e21c71e = {"invoke block<(a:uint const;b:uint const):bool> const", "", __func_info__7e21c71e_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x7e21c71e, 0x0 };
+VarInfo __func_info__4b991553_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2110, 0x57260f29, "f", 0 };
+VarInfo * __func_info__4b991553_fields[1] =  { &__func_info__4b991553_field_0 };
+FuncInfo __func_info__4b991553 = {"invoke block<(f:Foo const):int const> const", "", __func_info__4b991553_fields, 1, 32, &__type_info__359c1b32, nullptr,0,0x4b991553, 0x0 };
+VarInfo __func_info__bcd8c1a6_field_0 =  { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xe0e7699c, "a", 0 };
+VarInfo __func_info__bcd8c1a6_field_1 =  { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x6109dfcb, "b", 0 };
+VarInfo * __func_info__bcd8c1a6_fields[2] =  { &__func_info__bcd8c1a6_field_0, &__func_info__bcd8c1a6_field_1 };
+FuncInfo __func_info__bcd8c1a6 = {"invoke block<(a:float2 const;b:float2 const):bool> const", "", __func_info__bcd8c1a6_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xbcd8c1a6, 0x0 };
+VarInfo __func_info__a475d94a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xe7e9c971, "a", 0 };
+VarInfo __func_info__a475d94a_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x644a27a8, "b", 0 };
+VarInfo * __func_info__a475d94a_fields[2] =  { &__func_info__a475d94a_field_0, &__func_info__a475d94a_field_1 };
+FuncInfo __func_info__a475d94a = {"invoke block<(a:int const;b:int const):bool> const", "", __func_info__a475d94a_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xa475d94a, 0x0 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__223f839 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x223f839 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__95e97e5e };
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline bool _FuncLess_360d37aacae64ca7 ( Context * __context__, struct Foo const  & __a_rename_at_20, struct Foo const  & __b_rename_at_20 );
+inline void _Func_0x60_test_sort_d2f303885c572432 ( Context * __context__, TArray<struct Foo> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_75abc0782fb70548 ( Context * __context__, TArray<double> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_42ea9debe4e5192a ( Context * __context__, TArray<float> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_304fa7d3698611c4 ( Context * __context__, TArray<int32_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_f9629930f1a02904 ( Context * __context__, TArray<int64_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_82142c694b774a9e ( Context * __context__, TArray<char *> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_82ff6056e854ab4a ( Context * __context__, TArray<uint32_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_350efca99f70722e ( Context * __context__, TArray<uint64_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_d9e7b4399e747d82 ( Context * __context__, TDim<struct Foo,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_e2c2c8ed1fae32fa ( Context * __context__, TDim<double,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_74cc3eda9233ce6 ( Context * __context__, TDim<float,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_22d6dffef5f8e70e ( Context * __context__, TDim<int32_t,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_9ce9963f3b5f69b6 ( Context * __context__, TDim<int64_t,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_6f87a791ceed90be ( Context * __context__, TDim<char *,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_ff217a0d934c4d76 ( Context * __context__, TDim<uint32_t,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_d2547c3b2df964b2 ( Context * __context__, TDim<uint64_t,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_comp_8ce798277f9e1500 ( Context * __context__, TArray<float2> & __arr_rename_at_10 );
+inline void _Func_0x60_test_sort_large_1fa64015b8b1dfe0 ( Context * __context__, TArray<double> & __arr_rename_at_23 );
+inline void _Func_0x60_test_sort_large_e70381c15924e4af ( Context * __context__, TArray<float> & __arr_rename_at_23 );
+inline void _Func_0x60_test_sort_large_1518a840afedf0e0 ( Context * __context__, TArray<int32_t> & __arr_rename_at_23 );
+inline void _Func_0x60_test_sort_large_efa7d161d517afc2 ( Context * __context__, TArray<int64_t> & __arr_rename_at_23 );
+inline void _Func_0x60_test_sort_large_d917d3afc5c4eca1 ( Context * __context__, TArray<char *> & __arr_rename_at_23 );
+inline void _Func_0x60_test_sort_large_a5d8c212d150acb9 ( Context * __context__, TArray<uint32_t> & __arr_rename_at_23 );
+inline void _Func_0x60_test_sort_large_8a8f580b35ff4d7f ( Context * __context__, TArray<uint64_t> & __arr_rename_at_23 );
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_6366ae72f8b3a6bc ( Context * __context__, TArray<struct Foo> & __Arr_rename_at_40, struct Foo const  & __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_67396f51c9762faa ( Context * __context__, TArray<double> & __Arr_rename_at_40, double __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_8a9191e5eb1aa83e ( Context * __context__, TArray<float> & __Arr_rename_at_40, float __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_31f685a4ade6a664 ( Context * __context__, TArray<float2> & __Arr_rename_at_40, float2 __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_e22ac40adebb56c6 ( Context * __context__, TArray<int64_t> & __Arr_rename_at_40, int64_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> & __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_bcce321c8cba23ec ( Context * __context__, TArray<uint32_t> & __Arr_rename_at_40, uint32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_3720b69e5114725c ( Context * __context__, TArray<uint64_t> & __Arr_rename_at_40, uint64_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_resize_df901583a0cdec70 ( Context * __context__, TArray<struct Foo> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_6640dbff129f8443 ( Context * __context__, TArray<double> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_20419c2df14c9d85 ( Context * __context__, TArray<int64_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_29914d27690eb1e4 ( Context * __context__, TArray<uint32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_48979e8311fe5126 ( Context * __context__, TArray<uint64_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_sort_22b27cbc39b13444 ( Context * __context__, TArray<struct Foo> & __a_rename_at_446 );
+inline void _Funcbuiltin_0x60_sort_a2a2e8ad5e51a3bd ( Context * __context__, TArray<struct Foo> & __a_rename_at_478, Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  & __cmp_rename_at_478 );
+inline void _Funcbuiltin_0x60_sort_3d3eba65e92056d6 ( Context * __context__, TArray<double> & __a_rename_at_446 );
+inline void _Funcbuiltin_0x60_sort_a68492889616b64f ( Context * __context__, TArray<double> & __a_rename_at_478, Block DAS_COMMENT((bool,double,double)) const  & __cmp_rename_at_478 );
+inline void _Funcbuiltin_0x60_sort_375e0ed4c09ca997 ( Context * __context__, TArray<float> & __a_rename_at_446 );
+inline void _Funcbuiltin_0x60_sort_70cb8bf4762fdd30 ( Context * __context__, TArray<float> & __a_rename_at_478, Block DAS_COMMENT((bool,float,float)) const  & __cmp_rename_at_478 );
+inline void _Funcbuiltin_0x60_sort_8b431b1b892aeb9c ( Context * __context__, TArray<float2> & __a_rename_at_478, Block DAS_COMMENT((bool,float2,float2)) const  & __cmp_rename_at_478 );
+inline void _Funcbuiltin_0x60_sort_f52f40276c6eddae ( Context * __context__, TArray<int32_t> & __a_rename_at_446 );
+inline void _Funcbuiltin_0x60_sort_780509c039a2989f ( Context * __context__, TArray<int32_t> & __a_rename_at_478, Block DAS_COMMENT((bool,int32_t,int32_t)) const  & __cmp_rename_at_478 );
+inline void _Funcbuiltin_0x60_sort_a87ab0a859e3c2fc ( Context * __context__, TArray<int64_t> & __a_rename_at_446 );
+inline void _Funcbuiltin_0x60_sort_b6d865c33e8e2919 ( Context * __context__, TArray<int64_t> & __a_rename_at_478, Block DAS_COMMENT((bool,int64_t,int64_t)) const  & __cmp_rename_at_478 );
+inline void _Funcbuiltin_0x60_sort_d46e57cd1dcd0dda ( Context * __context__, TArray<char *> & __a_rename_at_446 );
+inline void _Funcbuiltin_0x60_sort_d1096e9642e456b ( Context * __context__, TArray<char *> & __a_rename_at_478, Block DAS_COMMENT((bool,char * const ,char * const )) const  & __cmp_rename_at_478 );
+inline void _Funcbuiltin_0x60_sort_8e357af1649f47bd ( Context * __context__, TArray<uint32_t> & __a_rename_at_446 );
+inline void _Funcbuiltin_0x60_sort_458df5c8781bd9a4 ( Context * __context__, TArray<uint32_t> & __a_rename_at_478, Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  & __cmp_rename_at_478 );
+inline void _Funcbuiltin_0x60_sort_ee4f65940235b53 ( Context * __context__, TArray<uint64_t> & __a_rename_at_446 );
+inline void _Funcbuiltin_0x60_sort_3b5033243a054d2e ( Context * __context__, TArray<uint64_t> & __a_rename_at_478, Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  & __cmp_rename_at_478 );
+inline void _Funcbuiltin_0x60_sort_fd5bd442b983e6ca ( Context * __context__, TDim<struct Foo,4> & __a_rename_at_432 );
+inline void _Funcbuiltin_0x60_sort_d4104aa8126e0cbb ( Context * __context__, TDim<struct Foo,4> & __a_rename_at_464, Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  & __cmp_rename_at_464 );
+inline void _Funcbuiltin_0x60_sort_4c2da5f6adcd396 ( Context * __context__, TDim<double,4> & __a_rename_at_432 );
+inline void _Funcbuiltin_0x60_sort_2c407051e634f1f9 ( Context * __context__, TDim<double,4> & __a_rename_at_464, Block DAS_COMMENT((bool,double,double)) const  & __cmp_rename_at_464 );
+inline void _Funcbuiltin_0x60_sort_dce586ecd3989349 ( Context * __context__, TDim<float,4> & __a_rename_at_432 );
+inline void _Funcbuiltin_0x60_sort_e7be6ee946e6ef22 ( Context * __context__, TDim<float,4> & __a_rename_at_464, Block DAS_COMMENT((bool,float,float)) const  & __cmp_rename_at_464 );
+inline void _Funcbuiltin_0x60_sort_1c259c4c5d3f70a4 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_432 );
+inline void _Funcbuiltin_0x60_sort_872e98e3e55640f7 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_464, Block DAS_COMMENT((bool,int32_t,int32_t)) const  & __cmp_rename_at_464 );
+inline void _Funcbuiltin_0x60_sort_b189ed1e8e0386b6 ( Context * __context__, TDim<int64_t,4> & __a_rename_at_432 );
+inline void _Funcbuiltin_0x60_sort_a980c8ede31c7665 ( Context * __context__, TDim<int64_t,4> & __a_rename_at_464, Block DAS_COMMENT((bool,int64_t,int64_t)) const  & __cmp_rename_at_464 );
+inline void _Funcbuiltin_0x60_sort_6ca8bf1bba8ebf60 ( Context * __context__, TDim<char *,4> & __a_rename_at_432 );
+inline void _Funcbuiltin_0x60_sort_991506d6b028c811 ( Context * __context__, TDim<char *,4> & __a_rename_at_464, Block DAS_COMMENT((bool,char * const ,char * const )) const  & __cmp_rename_at_464 );
+inline void _Funcbuiltin_0x60_sort_a5cabb2f0c020b8d ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_432 );
+inline void _Funcbuiltin_0x60_sort_ebb06941cd0c9e4 ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_464, Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  & __cmp_rename_at_464 );
+inline void _Funcbuiltin_0x60_sort_a4b3120f7dbe1103 ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_432 );
+inline void _Funcbuiltin_0x60_sort_68d792918abece7a ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_464, Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  & __cmp_rename_at_464 );
+inline void _Funcbuiltin_0x60_sort_by_key_417d822841a2c0e4 ( Context * __context__, TArray<struct Foo> & __a_rename_at_612, Block DAS_COMMENT((float,struct Foo const )) const  & __key_rename_at_612 );
+inline void _Funcbuiltin_0x60_sort_by_key_839c285c1f684980 ( Context * __context__, TArray<struct Foo> & __a_rename_at_612, Block DAS_COMMENT((int32_t,struct Foo const )) const  & __key_rename_at_612 );
+inline void _Funcbuiltin_0x60_sort_by_key_cdfd71ed067b8228 ( Context * __context__, TDim<struct Foo,5> & __a_rename_at_595, Block DAS_COMMENT((char *,struct Foo const )) const  & __key_rename_at_595 );
+inline void _Funcbuiltin_0x60_sort_parallel_8ba3b15fac683d85 ( Context * __context__, TArray<struct Foo> & __a_rename_at_578, Block DAS_COMMENT((int32_t,struct Foo const )) const  & __key_rename_at_578 );
+inline void _Funcbuiltin_0x60_sort_parallel_47c5a0dd24e699c3 ( Context * __context__, TArray<float> & __a_rename_at_567 );
+inline void _Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c ( Context * __context__, TArray<int32_t> & __a_rename_at_567 );
+inline void _Funcbuiltin_0x60_stable_sort_56a6f4f4a2be66e9 ( Context * __context__, TArray<struct Foo> & __a_rename_at_542, Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  & __cmp_rename_at_542 );
+inline void _Funcbuiltin_0x60_stable_sort_fec300b0e65033ec ( Context * __context__, TArray<float> & __a_rename_at_542, Block DAS_COMMENT((bool,float,float)) const  & __cmp_rename_at_542 );
+inline void _Funcbuiltin_0x60_stable_sort_b5da33b81ceb130a ( Context * __context__, TArray<int32_t> & __a_rename_at_510 );
+inline void _Funcbuiltin_0x60_stable_sort_5360c5d29b98e3f1 ( Context * __context__, TArray<int32_t> & __a_rename_at_542, Block DAS_COMMENT((bool,int32_t,int32_t)) const  & __cmp_rename_at_542 );
+inline void _Funcbuiltin_0x60_stable_sort_2346a4fc9d234696 ( Context * __context__, TArray<char *> & __a_rename_at_510 );
+inline void _Funcbuiltin_0x60_stable_sort_5d5252a838ad02cd ( Context * __context__, TDim<struct Foo,6> & __a_rename_at_528, Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  & __cmp_rename_at_528 );
+inline TArray<struct Foo> _Funcbuiltin_0x60_to_array_move_2003aa4937a0a5de ( Context * __context__, TDim<struct Foo,4> & __a_rename_at_398 );
+inline TArray<double> _Funcbuiltin_0x60_to_array_move_be98d5ec8498afcd ( Context * __context__, TDim<double,4> & __a_rename_at_398 );
+inline TArray<float> _Funcbuiltin_0x60_to_array_move_9fec2914481bd4c4 ( Context * __context__, TDim<float,3> & __a_rename_at_398 );
+inline TArray<float> _Funcbuiltin_0x60_to_array_move_439aeef6544bba80 ( Context * __context__, TDim<float,4> & __a_rename_at_398 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_398 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_bb512feadf9377fd ( Context * __context__, TDim<int32_t,4> & __a_rename_at_398 );
+inline TArray<int64_t> _Funcbuiltin_0x60_to_array_move_d6808c965184e8ff ( Context * __context__, TDim<int64_t,4> & __a_rename_at_398 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_f77c6221a73cea41 ( Context * __context__, TDim<char *,4> & __a_rename_at_398 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_bc1ac001df26d32f ( Context * __context__, TDim<char *,5> & __a_rename_at_398 );
+inline TArray<uint32_t> _Funcbuiltin_0x60_to_array_move_3ea39969ebcb8c3c ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_398 );
+inline TArray<uint64_t> _Funcbuiltin_0x60_to_array_move_bf436f76763a926e ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_398 );
+inline TArray<int32_t> random_ints_3decc040b0920eba ( Context * __context__, int32_t __n_rename_at_36 );
+inline bool test_2073c93b96ef3243 ( Context * __context__ );
+inline void test_large_sort_a3c130b8693e5b86 ( Context * __context__ );
+inline void test_non_strict_sort_47ea7ef0c60c946 ( Context * __context__ );
+inline void test_sort_by_key_dc88811d1879d0fd ( Context * __context__ );
+inline void test_sort_parallel_5176334f852b4f43 ( Context * __context__, int32_t __threads_rename_at_103 );
+inline void test_stable_sort_e228516c59b09340 ( Context * __context__ );
+inline void test_vector_sort_4e9f6f380b1d0080 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _FuncLess_360d37aacae64ca7 ( Context * __context__, struct Foo const  &  __a_rename_at_20, struct Foo const  &  __b_rename_at_20 )
+{
+	return (__a_rename_at_20.x + __a_rename_at_20.y) < (__b_rename_at_20.x + __b_rename_at_20.y);
+}
+
+inline void _Func_0x60_test_sort_d2f303885c572432 ( Context * __context__, TArray<struct Foo> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_22b27cbc39b13444(__context__,das_arg<TArray<struct Foo>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = (int32_t)builtin_array_size(das_arg<TArray<struct Foo>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((_FuncLess_360d37aacae64ca7(__context__,das_arg<struct Foo>::pass(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),das_arg<struct Foo>::pass(__arr_rename_at_1(__i_rename_at_4,__context__)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_a2a2e8ad5e51a3bd(__context__,das_arg<TArray<struct Foo>>::pass(__arr_rename_at_1),das_make_block<bool,struct Foo const  &,struct Foo const  &>(__context__,112,0,&__func_info__c973faee,[&](struct Foo const  & __a_rename_at_6, struct Foo const  & __b_rename_at_6)->bool{
+		return !(_FuncLess_360d37aacae64ca7(__context__,__a_rename_at_6,__b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(_FuncLess_360d37aacae64ca7(__context__,das_arg<struct Foo>::pass(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),das_arg<struct Foo>::pass(__arr_rename_at_1(__i_rename_at_7,__context__))))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_75abc0782fb70548 ( Context * __context__, TArray<double> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_3d3eba65e92056d6(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = (int32_t)builtin_array_size(das_arg<TArray<double>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_a68492889616b64f(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_1),das_make_block<bool,double,double>(__context__,112,0,&__func_info__b10fd4e2,[&](double const  __a_rename_at_6, double const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_42ea9debe4e5192a ( Context * __context__, TArray<float> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_375e0ed4c09ca997(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = (int32_t)builtin_array_size(das_arg<TArray<float>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_70cb8bf4762fdd30(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_1),das_make_block<bool,float,float>(__context__,112,0,&__func_info__63627cbe,[&](float const  __a_rename_at_6, float const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_304fa7d3698611c4 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_f52f40276c6eddae(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = (int32_t)builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_780509c039a2989f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1),das_make_block<bool,int32_t,int32_t>(__context__,112,0,&__func_info__a475d94a,[&](int32_t const  __a_rename_at_6, int32_t const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_f9629930f1a02904 ( Context * __context__, TArray<int64_t> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_a87ab0a859e3c2fc(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = (int32_t)builtin_array_size(das_arg<TArray<int64_t>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_b6d865c33e8e2919(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_1),das_make_block<bool,int64_t,int64_t>(__context__,112,0,&__func_info__b98c23a2,[&](int64_t const  __a_rename_at_6, int64_t const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_82142c694b774a9e ( Context * __context__, TArray<char *> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_d46e57cd1dcd0dda(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = (int32_t)builtin_array_size(das_arg<TArray<char *>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_4,__context__)),*__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_d1096e9642e456b(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_1),das_make_block<bool,char * const ,char * const >(__context__,112,0,&__func_info__27ac9802,[&](char * const  __a_rename_at_6, char * const  __b_rename_at_6)->bool{
+		return !(SimPolicy<char *>::Less(cast<char *>::from(__a_rename_at_6),cast<char *>::from(__b_rename_at_6),*__context__));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_7,__context__)),*__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_82ff6056e854ab4a ( Context * __context__, TArray<uint32_t> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_8e357af1649f47bd(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = (int32_t)builtin_array_size(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_458df5c8781bd9a4(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1),das_make_block<bool,uint32_t,uint32_t>(__context__,112,0,&__func_info__7e21c71e,[&](uint32_t const  __a_rename_at_6, uint32_t const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_350efca99f70722e ( Context * __context__, TArray<uint64_t> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_ee4f65940235b53(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = (int32_t)builtin_array_size(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_3b5033243a054d2e(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1),das_make_block<bool,uint64_t,uint64_t>(__context__,112,0,&__func_info__f0811382,[&](uint64_t const  __a_rename_at_6, uint64_t const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_d9e7b4399e747d82 ( Context * __context__, TDim<struct Foo,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_fd5bd442b983e6ca(__context__,das_arg<TDim<struct Foo,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((_FuncLess_360d37aacae64ca7(__context__,das_arg<struct Foo>::pass(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),das_arg<struct Foo>::pass(__arr_rename_at_1(__i_rename_at_4,__context__)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_d4104aa8126e0cbb(__context__,das_arg<TDim<struct Foo,4>>::pass(__arr_rename_at_1),das_make_block<bool,struct Foo const  &,struct Foo const  &>(__context__,96,0,&__func_info__25b18b38,[&](struct Foo const  & __a_rename_at_6, struct Foo const  & __b_rename_at_6)->bool{
+		return !(_FuncLess_360d37aacae64ca7(__context__,__a_rename_at_6,__b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(_FuncLess_360d37aacae64ca7(__context__,das_arg<struct Foo>::pass(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),das_arg<struct Foo>::pass(__arr_rename_at_1(__i_rename_at_7,__context__))))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_e2c2c8ed1fae32fa ( Context * __context__, TDim<double,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_4c2da5f6adcd396(__context__,das_arg<TDim<double,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_2c407051e634f1f9(__context__,das_arg<TDim<double,4>>::pass(__arr_rename_at_1),das_make_block<bool,double,double>(__context__,96,0,&__func_info__508d84b6,[&](double const  __a_rename_at_6, double const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_74cc3eda9233ce6 ( Context * __context__, TDim<float,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_dce586ecd3989349(__context__,das_arg<TDim<float,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_e7be6ee946e6ef22(__context__,das_arg<TDim<float,4>>::pass(__arr_rename_at_1),das_make_block<bool,float,float>(__context__,96,0,&__func_info__35457e1c,[&](float const  __a_rename_at_6, float const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_22d6dffef5f8e70e ( Context * __context__, TDim<int32_t,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_1c259c4c5d3f70a4(__context__,das_arg<TDim<int32_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_872e98e3e55640f7(__context__,das_arg<TDim<int32_t,4>>::pass(__arr_rename_at_1),das_make_block<bool,int32_t,int32_t>(__context__,96,0,&__func_info__194109f8,[&](int32_t const  __a_rename_at_6, int32_t const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_9ce9963f3b5f69b6 ( Context * __context__, TDim<int64_t,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_b189ed1e8e0386b6(__context__,das_arg<TDim<int64_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_a980c8ede31c7665(__context__,das_arg<TDim<int64_t,4>>::pass(__arr_rename_at_1),das_make_block<bool,int64_t,int64_t>(__context__,96,0,&__func_info__420e48e4,[&](int64_t const  __a_rename_at_6, int64_t const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_6f87a791ceed90be ( Context * __context__, TDim<char *,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_6ca8bf1bba8ebf60(__context__,das_arg<TDim<char *,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_4,__context__)),*__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_991506d6b028c811(__context__,das_arg<TDim<char *,4>>::pass(__arr_rename_at_1),das_make_block<bool,char * const ,char * const >(__context__,96,0,&__func_info__2de8a522,[&](char * const  __a_rename_at_6, char * const  __b_rename_at_6)->bool{
+		return !(SimPolicy<char *>::Less(cast<char *>::from(__a_rename_at_6),cast<char *>::from(__b_rename_at_6),*__context__));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_7,__context__)),*__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_ff217a0d934c4d76 ( Context * __context__, TDim<uint32_t,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_a5cabb2f0c020b8d(__context__,das_arg<TDim<uint32_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_ebb06941cd0c9e4(__context__,das_arg<TDim<uint32_t,4>>::pass(__arr_rename_at_1),das_make_block<bool,uint32_t,uint32_t>(__context__,96,0,&__func_info__5396827e,[&](uint32_t const  __a_rename_at_6, uint32_t const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_d2547c3b2df964b2 ( Context * __context__, TDim<uint64_t,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_a4b3120f7dbe1103(__context__,das_arg<TDim<uint64_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_68d792918abece7a(__context__,das_arg<TDim<uint64_t,4>>::pass(__arr_rename_at_1),das_make_block<bool,uint64_t,uint64_t>(__context__,96,0,&__func_info__c3a35c52,[&](uint64_t const  __a_rename_at_6, uint64_t const  __b_rename_at_6)->bool{
+		return !(__a_rename_at_6 < __b_rename_at_6);
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_comp_8ce798277f9e1500 ( Context * __context__, TArray<float2> &  __arr_rename_at_10 ) { das_stack_prologue __prologue(__context__,128,"`test_sort_comp " DAS_FILE_LINE);
+{
+	int32_t __len_rename_at_11 = (int32_t)builtin_array_size(das_arg<TArray<float2>>::pass(__arr_rename_at_10));
+	_Funcbuiltin_0x60_sort_8b431b1b892aeb9c(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_10),das_make_block<bool,float2,float2>(__context__,96,0,&__func_info__bcd8c1a6,[&](float2 __a_rename_at_12, float2 __b_rename_at_12)->bool{
+		return v_extract_x(__a_rename_at_12) /*x*/ < v_extract_x(__b_rename_at_12) /*x*/;
+	}));
+	{
+		bool __need_loop_14 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_11));
+		int32_t __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			DAS_ASSERT((v_extract_x(__arr_rename_at_10((__i_rename_at_14 - 1),__context__)) /*x*/ < v_extract_x(__arr_rename_at_10(__i_rename_at_14,__context__)) /*x*/));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+}}
+
+inline void _Func_0x60_test_sort_large_1fa64015b8b1dfe0 ( Context * __context__, TArray<double> &  __arr_rename_at_23 ) { das_stack_prologue __prologue(__context__,144,"`test_sort_large " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_3d3eba65e92056d6(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_26 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<double>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_26;
+		__need_loop_26 = __i_iterator.first(__context__,(__i_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __i_iterator.next(__context__,(__i_rename_at_26)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_26,__context__) < __arr_rename_at_23((__i_rename_at_26 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_26));
+	};
+	_Funcbuiltin_0x60_sort_3d3eba65e92056d6(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<double>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_29,__context__) < __arr_rename_at_23((__i_rename_at_29 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	_Funcbuiltin_0x60_sort_a68492889616b64f(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_23),das_make_block<bool,double,double>(__context__,112,0,&__func_info__b10fd4e2,[&](double const  __a_rename_at_31, double const  __b_rename_at_31)->bool{
+		return __b_rename_at_31 < __a_rename_at_31;
+	}));
+	_Funcbuiltin_0x60_sort_3d3eba65e92056d6(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_33 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<double>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_33;
+		__need_loop_33 = __i_iterator.first(__context__,(__i_rename_at_33)) && __need_loop_33;
+		for ( ; __need_loop_33 ; __need_loop_33 = __i_iterator.next(__context__,(__i_rename_at_33)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_33,__context__) < __arr_rename_at_23((__i_rename_at_33 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_33));
+	};
+}}
+
+inline void _Func_0x60_test_sort_large_e70381c15924e4af ( Context * __context__, TArray<float> &  __arr_rename_at_23 ) { das_stack_prologue __prologue(__context__,144,"`test_sort_large " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_375e0ed4c09ca997(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_26 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<float>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_26;
+		__need_loop_26 = __i_iterator.first(__context__,(__i_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __i_iterator.next(__context__,(__i_rename_at_26)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_26,__context__) < __arr_rename_at_23((__i_rename_at_26 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_26));
+	};
+	_Funcbuiltin_0x60_sort_375e0ed4c09ca997(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<float>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_29,__context__) < __arr_rename_at_23((__i_rename_at_29 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	_Funcbuiltin_0x60_sort_70cb8bf4762fdd30(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_23),das_make_block<bool,float,float>(__context__,112,0,&__func_info__63627cbe,[&](float const  __a_rename_at_31, float const  __b_rename_at_31)->bool{
+		return __b_rename_at_31 < __a_rename_at_31;
+	}));
+	_Funcbuiltin_0x60_sort_375e0ed4c09ca997(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_33 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<float>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_33;
+		__need_loop_33 = __i_iterator.first(__context__,(__i_rename_at_33)) && __need_loop_33;
+		for ( ; __need_loop_33 ; __need_loop_33 = __i_iterator.next(__context__,(__i_rename_at_33)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_33,__context__) < __arr_rename_at_23((__i_rename_at_33 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_33));
+	};
+}}
+
+inline void _Func_0x60_test_sort_large_1518a840afedf0e0 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_23 ) { das_stack_prologue __prologue(__context__,144,"`test_sort_large " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_f52f40276c6eddae(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_26 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_26;
+		__need_loop_26 = __i_iterator.first(__context__,(__i_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __i_iterator.next(__context__,(__i_rename_at_26)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_26,__context__) < __arr_rename_at_23((__i_rename_at_26 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_26));
+	};
+	_Funcbuiltin_0x60_sort_f52f40276c6eddae(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_29,__context__) < __arr_rename_at_23((__i_rename_at_29 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	_Funcbuiltin_0x60_sort_780509c039a2989f(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_23),das_make_block<bool,int32_t,int32_t>(__context__,112,0,&__func_info__a475d94a,[&](int32_t const  __a_rename_at_31, int32_t const  __b_rename_at_31)->bool{
+		return __b_rename_at_31 < __a_rename_at_31;
+	}));
+	_Funcbuiltin_0x60_sort_f52f40276c6eddae(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_33 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_33;
+		__need_loop_33 = __i_iterator.first(__context__,(__i_rename_at_33)) && __need_loop_33;
+		for ( ; __need_loop_33 ; __need_loop_33 = __i_iterator.next(__context__,(__i_rename_at_33)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_33,__context__) < __arr_rename_at_23((__i_rename_at_33 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_33));
+	};
+}}
+
+inline void _Func_0x60_test_sort_large_efa7d161d517afc2 ( Context * __context__, TArray<int64_t> &  __arr_rename_at_23 ) { das_stack_prologue __prologue(__context__,144,"`test_sort_large " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_a87ab0a859e3c2fc(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_26 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<int64_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_26;
+		__need_loop_26 = __i_iterator.first(__context__,(__i_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __i_iterator.next(__context__,(__i_rename_at_26)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_26,__context__) < __arr_rename_at_23((__i_rename_at_26 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_26));
+	};
+	_Funcbuiltin_0x60_sort_a87ab0a859e3c2fc(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<int64_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_29,__context__) < __arr_rename_at_23((__i_rename_at_29 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	_Funcbuiltin_0x60_sort_b6d865c33e8e2919(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_23),das_make_block<bool,int64_t,int64_t>(__context__,112,0,&__func_info__b98c23a2,[&](int64_t const  __a_rename_at_31, int64_t const  __b_rename_at_31)->bool{
+		return __b_rename_at_31 < __a_rename_at_31;
+	}));
+	_Funcbuiltin_0x60_sort_a87ab0a859e3c2fc(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_33 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<int64_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_33;
+		__need_loop_33 = __i_iterator.first(__context__,(__i_rename_at_33)) && __need_loop_33;
+		for ( ; __need_loop_33 ; __need_loop_33 = __i_iterator.next(__context__,(__i_rename_at_33)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_33,__context__) < __arr_rename_at_23((__i_rename_at_33 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_33));
+	};
+}}
+
+inline void _Func_0x60_test_sort_large_d917d3afc5c4eca1 ( Context * __context__, TArray<char *> &  __arr_rename_at_23 ) { das_stack_prologue __prologue(__context__,144,"`test_sort_large " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_d46e57cd1dcd0dda(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_26 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<char *>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_26;
+		__need_loop_26 = __i_iterator.first(__context__,(__i_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __i_iterator.next(__context__,(__i_rename_at_26)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_23(__i_rename_at_26,__context__)),cast<char *>::from(__arr_rename_at_23((__i_rename_at_26 - 1),__context__)),*__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_26));
+	};
+	_Funcbuiltin_0x60_sort_d46e57cd1dcd0dda(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<char *>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_23(__i_rename_at_29,__context__)),cast<char *>::from(__arr_rename_at_23((__i_rename_at_29 - 1),__context__)),*__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	_Funcbuiltin_0x60_sort_d1096e9642e456b(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_23),das_make_block<bool,char * const ,char * const >(__context__,112,0,&__func_info__27ac9802,[&](char * const  __a_rename_at_31, char * const  __b_rename_at_31)->bool{
+		return SimPolicy<char *>::Less(cast<char *>::from(__b_rename_at_31),cast<char *>::from(__a_rename_at_31),*__context__);
+	}));
+	_Funcbuiltin_0x60_sort_d46e57cd1dcd0dda(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_33 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<char *>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_33;
+		__need_loop_33 = __i_iterator.first(__context__,(__i_rename_at_33)) && __need_loop_33;
+		for ( ; __need_loop_33 ; __need_loop_33 = __i_iterator.next(__context__,(__i_rename_at_33)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_23(__i_rename_at_33,__context__)),cast<char *>::from(__arr_rename_at_23((__i_rename_at_33 - 1),__context__)),*__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_33));
+	};
+}}
+
+inline void _Func_0x60_test_sort_large_a5d8c212d150acb9 ( Context * __context__, TArray<uint32_t> &  __arr_rename_at_23 ) { das_stack_prologue __prologue(__context__,144,"`test_sort_large " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_8e357af1649f47bd(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_26 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_26;
+		__need_loop_26 = __i_iterator.first(__context__,(__i_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __i_iterator.next(__context__,(__i_rename_at_26)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_26,__context__) < __arr_rename_at_23((__i_rename_at_26 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_26));
+	};
+	_Funcbuiltin_0x60_sort_8e357af1649f47bd(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_29,__context__) < __arr_rename_at_23((__i_rename_at_29 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	_Funcbuiltin_0x60_sort_458df5c8781bd9a4(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_23),das_make_block<bool,uint32_t,uint32_t>(__context__,112,0,&__func_info__7e21c71e,[&](uint32_t const  __a_rename_at_31, uint32_t const  __b_rename_at_31)->bool{
+		return __b_rename_at_31 < __a_rename_at_31;
+	}));
+	_Funcbuiltin_0x60_sort_8e357af1649f47bd(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_33 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_33;
+		__need_loop_33 = __i_iterator.first(__context__,(__i_rename_at_33)) && __need_loop_33;
+		for ( ; __need_loop_33 ; __need_loop_33 = __i_iterator.next(__context__,(__i_rename_at_33)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_33,__context__) < __arr_rename_at_23((__i_rename_at_33 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_33));
+	};
+}}
+
+inline void _Func_0x60_test_sort_large_8a8f580b35ff4d7f ( Context * __context__, TArray<uint64_t> &  __arr_rename_at_23 ) { das_stack_prologue __prologue(__context__,144,"`test_sort_large " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_ee4f65940235b53(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_26 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_26;
+		__need_loop_26 = __i_iterator.first(__context__,(__i_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __i_iterator.next(__context__,(__i_rename_at_26)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_26,__context__) < __arr_rename_at_23((__i_rename_at_26 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_26));
+	};
+	_Funcbuiltin_0x60_sort_ee4f65940235b53(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_29,__context__) < __arr_rename_at_23((__i_rename_at_29 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	_Funcbuiltin_0x60_sort_3b5033243a054d2e(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_23),das_make_block<bool,uint64_t,uint64_t>(__context__,112,0,&__func_info__f0811382,[&](uint64_t const  __a_rename_at_31, uint64_t const  __b_rename_at_31)->bool{
+		return __b_rename_at_31 < __a_rename_at_31;
+	}));
+	_Funcbuiltin_0x60_sort_ee4f65940235b53(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_23));
+	{
+		bool __need_loop_33 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_23))));
+		int32_t __i_rename_at_33;
+		__need_loop_33 = __i_iterator.first(__context__,(__i_rename_at_33)) && __need_loop_33;
+		for ( ; __need_loop_33 ; __need_loop_33 = __i_iterator.next(__context__,(__i_rename_at_33)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_23(__i_rename_at_33,__context__) < __arr_rename_at_23((__i_rename_at_33 - 1),__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_33));
+	};
+}}
+
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<float>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_6366ae72f8b3a6bc ( Context * __context__, TArray<struct Foo> &  __Arr_rename_at_40, struct Foo const  &  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<struct Foo>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_67396f51c9762faa ( Context * __context__, TArray<double> &  __Arr_rename_at_40, double __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<double>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_8a9191e5eb1aa83e ( Context * __context__, TArray<float> &  __Arr_rename_at_40, float __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<float>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_31f685a4ade6a664 ( Context * __context__, TArray<float2> &  __Arr_rename_at_40, float2 __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<float2>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_e22ac40adebb56c6 ( Context * __context__, TArray<int64_t> &  __Arr_rename_at_40, int64_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int64_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> &  __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<char *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_bcce321c8cba23ec ( Context * __context__, TArray<uint32_t> &  __Arr_rename_at_40, uint32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<uint32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_3720b69e5114725c ( Context * __context__, TArray<uint64_t> &  __Arr_rename_at_40, uint64_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<uint64_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_resize_df901583a0cdec70 ( Context * __context__, TArray<struct Foo> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<struct Foo>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_6640dbff129f8443 ( Context * __context__, TArray<double> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<double>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_20419c2df14c9d85 ( Context * __context__, TArray<int64_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int64_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_29914d27690eb1e4 ( Context * __context__, TArray<uint32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<uint32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_48979e8311fe5126 ( Context * __context__, TArray<uint64_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<uint64_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_22b27cbc39b13444 ( Context * __context__, TArray<struct Foo> &  __a_rename_at_446 ) { das_stack_prologue __prologue(__context__,96,"builtin`sort " DAS_FILE_LINE);
+{
+	if ( builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_446)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_446),__context__);
+		builtin_sort_any_cblock(das_ref(__context__,__a_rename_at_446(0,__context__)),8,builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_446)),das_make_block<bool,struct Foo const  &,struct Foo const  &>(__context__,80,0,&__func_info__c68b4bc8,[&](struct Foo const  & __x_rename_at_460, struct Foo const  & __y_rename_at_460)->bool{
+			return _FuncLess_360d37aacae64ca7(__context__,__x_rename_at_460,__y_rename_at_460);
+		}),__context__);
+		builtin_array_unlock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_446),__context__);
+	};
+}}
+
+inline void _Funcbuiltin_0x60_sort_a2a2e8ad5e51a3bd ( Context * __context__, TArray<struct Foo> &  __a_rename_at_478, Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  &  __cmp_rename_at_478 )
+{
+	if ( builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_478)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_478),__context__);
+		builtin_sort_any_cblock(das_ref(__context__,__a_rename_at_478(0,__context__)),8,builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_478)),__cmp_rename_at_478,__context__);
+		builtin_array_unlock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_478),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_3d3eba65e92056d6 ( Context * __context__, TArray<double> &  __a_rename_at_446 )
+{
+	if ( builtin_array_size(das_arg<TArray<double>>::pass(__a_rename_at_446)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<double>>::pass(__a_rename_at_446),__context__);
+		builtin_sort<double>(das_ref(__context__,__a_rename_at_446(0,__context__)),builtin_array_size(das_arg<TArray<double>>::pass(__a_rename_at_446)));
+		builtin_array_unlock(das_arg<TArray<double>>::pass(__a_rename_at_446),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_a68492889616b64f ( Context * __context__, TArray<double> &  __a_rename_at_478, Block DAS_COMMENT((bool,double,double)) const  &  __cmp_rename_at_478 )
+{
+	if ( builtin_array_size(das_arg<TArray<double>>::pass(__a_rename_at_478)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<double>>::pass(__a_rename_at_478),__context__);
+		builtin_sort_cblock<double>(das_ref(__context__,__a_rename_at_478(0,__context__)),builtin_array_size(das_arg<TArray<double>>::pass(__a_rename_at_478)),__cmp_rename_at_478,__context__);
+		builtin_array_unlock(das_arg<TArray<double>>::pass(__a_rename_at_478),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_375e0ed4c09ca997 ( Context * __context__, TArray<float> &  __a_rename_at_446 )
+{
+	if ( builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_446)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<float>>::pass(__a_rename_at_446),__context__);
+		builtin_sort<float>(das_ref(__context__,__a_rename_at_446(0,__context__)),builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_446)));
+		builtin_array_unlock(das_arg<TArray<float>>::pass(__a_rename_at_446),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_70cb8bf4762fdd30 ( Context * __context__, TArray<float> &  __a_rename_at_478, Block DAS_COMMENT((bool,float,float)) const  &  __cmp_rename_at_478 )
+{
+	if ( builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_478)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<float>>::pass(__a_rename_at_478),__context__);
+		builtin_sort_cblock<float>(das_ref(__context__,__a_rename_at_478(0,__context__)),builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_478)),__cmp_rename_at_478,__context__);
+		builtin_array_unlock(das_arg<TArray<float>>::pass(__a_rename_at_478),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_8b431b1b892aeb9c ( Context * __context__, TArray<float2> &  __a_rename_at_478, Block DAS_COMMENT((bool,float2,float2)) const  &  __cmp_rename_at_478 )
+{
+	if ( builtin_array_size(das_arg<TArray<float2>>::pass(__a_rename_at_478)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<float2>>::pass(__a_rename_at_478),__context__);
+		builtin_sort_cblock<float2>(das_ref(__context__,__a_rename_at_478(0,__context__)),builtin_array_size(das_arg<TArray<float2>>::pass(__a_rename_at_478)),__cmp_rename_at_478,__context__);
+		builtin_array_unlock(das_arg<TArray<float2>>::pass(__a_rename_at_478),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_f52f40276c6eddae ( Context * __context__, TArray<int32_t> &  __a_rename_at_446 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_446)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_446),__context__);
+		builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_446(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_446)));
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_446),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_780509c039a2989f ( Context * __context__, TArray<int32_t> &  __a_rename_at_478, Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  __cmp_rename_at_478 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_478)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_478),__context__);
+		builtin_sort_cblock<int32_t>(das_ref(__context__,__a_rename_at_478(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_478)),__cmp_rename_at_478,__context__);
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_478),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_a87ab0a859e3c2fc ( Context * __context__, TArray<int64_t> &  __a_rename_at_446 )
+{
+	if ( builtin_array_size(das_arg<TArray<int64_t>>::pass(__a_rename_at_446)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int64_t>>::pass(__a_rename_at_446),__context__);
+		builtin_sort<int64_t>(das_ref(__context__,__a_rename_at_446(0,__context__)),builtin_array_size(das_arg<TArray<int64_t>>::pass(__a_rename_at_446)));
+		builtin_array_unlock(das_arg<TArray<int64_t>>::pass(__a_rename_at_446),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_b6d865c33e8e2919 ( Context * __context__, TArray<int64_t> &  __a_rename_at_478, Block DAS_COMMENT((bool,int64_t,int64_t)) const  &  __cmp_rename_at_478 )
+{
+	if ( builtin_array_size(das_arg<TArray<int64_t>>::pass(__a_rename_at_478)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int64_t>>::pass(__a_rename_at_478),__context__);
+		builtin_sort_cblock<int64_t>(das_ref(__context__,__a_rename_at_478(0,__context__)),builtin_array_size(das_arg<TArray<int64_t>>::pass(__a_rename_at_478)),__cmp_rename_at_478,__context__);
+		builtin_array_unlock(das_arg<TArray<int64_t>>::pass(__a_rename_at_478),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_d46e57cd1dcd0dda ( Context * __context__, TArray<char *> &  __a_rename_at_446 )
+{
+	if ( builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_446)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<char *>>::pass(__a_rename_at_446),__context__);
+		builtin_sort_string(das_ref(__context__,__a_rename_at_446(0,__context__)),builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_446)));
+		builtin_array_unlock(das_arg<TArray<char *>>::pass(__a_rename_at_446),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_d1096e9642e456b ( Context * __context__, TArray<char *> &  __a_rename_at_478, Block DAS_COMMENT((bool,char * const ,char * const )) const  &  __cmp_rename_at_478 )
+{
+	if ( builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_478)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<char *>>::pass(__a_rename_at_478),__context__);
+		builtin_sort_cblock<char *>(das_ref(__context__,__a_rename_at_478(0,__context__)),builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_478)),__cmp_rename_at_478,__context__);
+		builtin_array_unlock(das_arg<TArray<char *>>::pass(__a_rename_at_478),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_8e357af1649f47bd ( Context * __context__, TArray<uint32_t> &  __a_rename_at_446 )
+{
+	if ( builtin_array_size(das_arg<TArray<uint32_t>>::pass(__a_rename_at_446)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_446),__context__);
+		builtin_sort<uint32_t>(das_ref(__context__,__a_rename_at_446(0,__context__)),builtin_array_size(das_arg<TArray<uint32_t>>::pass(__a_rename_at_446)));
+		builtin_array_unlock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_446),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_458df5c8781bd9a4 ( Context * __context__, TArray<uint32_t> &  __a_rename_at_478, Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  &  __cmp_rename_at_478 )
+{
+	if ( builtin_array_size(das_arg<TArray<uint32_t>>::pass(__a_rename_at_478)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_478),__context__);
+		builtin_sort_cblock<uint32_t>(das_ref(__context__,__a_rename_at_478(0,__context__)),builtin_array_size(das_arg<TArray<uint32_t>>::pass(__a_rename_at_478)),__cmp_rename_at_478,__context__);
+		builtin_array_unlock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_478),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_ee4f65940235b53 ( Context * __context__, TArray<uint64_t> &  __a_rename_at_446 )
+{
+	if ( builtin_array_size(das_arg<TArray<uint64_t>>::pass(__a_rename_at_446)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_446),__context__);
+		builtin_sort<uint64_t>(das_ref(__context__,__a_rename_at_446(0,__context__)),builtin_array_size(das_arg<TArray<uint64_t>>::pass(__a_rename_at_446)));
+		builtin_array_unlock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_446),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_3b5033243a054d2e ( Context * __context__, TArray<uint64_t> &  __a_rename_at_478, Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  &  __cmp_rename_at_478 )
+{
+	if ( builtin_array_size(das_arg<TArray<uint64_t>>::pass(__a_rename_at_478)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_478),__context__);
+		builtin_sort_cblock<uint64_t>(das_ref(__context__,__a_rename_at_478(0,__context__)),builtin_array_size(das_arg<TArray<uint64_t>>::pass(__a_rename_at_478)),__cmp_rename_at_478,__context__);
+		builtin_array_unlock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_478),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_fd5bd442b983e6ca ( Context * __context__, TDim<struct Foo,4> &  __a_rename_at_432 ) { das_stack_prologue __prologue(__context__,96,"builtin`sort " DAS_FILE_LINE);
+{
+	builtin_sort_any_cblock(das_ref(__context__,__a_rename_at_432(0,__context__)),8,4,das_make_block<bool,struct Foo const  &,struct Foo const  &>(__context__,80,0,&__func_info__e3b4ac8c,[&](struct Foo const  & __x_rename_at_443, struct Foo const  & __y_rename_at_443)->bool{
+		return _FuncLess_360d37aacae64ca7(__context__,__x_rename_at_443,__y_rename_at_443);
+	}),__context__);
+}}
+
+inline void _Funcbuiltin_0x60_sort_d4104aa8126e0cbb ( Context * __context__, TDim<struct Foo,4> &  __a_rename_at_464, Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  &  __cmp_rename_at_464 )
+{
+	builtin_sort_any_cblock(das_ref(__context__,__a_rename_at_464(0,__context__)),8,4,__cmp_rename_at_464,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_4c2da5f6adcd396 ( Context * __context__, TDim<double,4> &  __a_rename_at_432 )
+{
+	builtin_sort<double>(das_ref(__context__,__a_rename_at_432(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_2c407051e634f1f9 ( Context * __context__, TDim<double,4> &  __a_rename_at_464, Block DAS_COMMENT((bool,double,double)) const  &  __cmp_rename_at_464 )
+{
+	builtin_sort_cblock<double>(das_ref(__context__,__a_rename_at_464(0,__context__)),4,__cmp_rename_at_464,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_dce586ecd3989349 ( Context * __context__, TDim<float,4> &  __a_rename_at_432 )
+{
+	builtin_sort<float>(das_ref(__context__,__a_rename_at_432(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_e7be6ee946e6ef22 ( Context * __context__, TDim<float,4> &  __a_rename_at_464, Block DAS_COMMENT((bool,float,float)) const  &  __cmp_rename_at_464 )
+{
+	builtin_sort_cblock<float>(das_ref(__context__,__a_rename_at_464(0,__context__)),4,__cmp_rename_at_464,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_1c259c4c5d3f70a4 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_432 )
+{
+	builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_432(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_872e98e3e55640f7 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_464, Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  __cmp_rename_at_464 )
+{
+	builtin_sort_cblock<int32_t>(das_ref(__context__,__a_rename_at_464(0,__context__)),4,__cmp_rename_at_464,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_b189ed1e8e0386b6 ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_432 )
+{
+	builtin_sort<int64_t>(das_ref(__context__,__a_rename_at_432(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_a980c8ede31c7665 ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_464, Block DAS_COMMENT((bool,int64_t,int64_t)) const  &  __cmp_rename_at_464 )
+{
+	builtin_sort_cblock<int64_t>(das_ref(__context__,__a_rename_at_464(0,__context__)),4,__cmp_rename_at_464,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_6ca8bf1bba8ebf60 ( Context * __context__, TDim<char *,4> &  __a_rename_at_432 )
+{
+	builtin_sort_string(das_ref(__context__,__a_rename_at_432(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_991506d6b028c811 ( Context * __context__, TDim<char *,4> &  __a_rename_at_464, Block DAS_COMMENT((bool,char * const ,char * const )) const  &  __cmp_rename_at_464 )
+{
+	builtin_sort_cblock<char *>(das_ref(__context__,__a_rename_at_464(0,__context__)),4,__cmp_rename_at_464,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_a5cabb2f0c020b8d ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_432 )
+{
+	builtin_sort<uint32_t>(das_ref(__context__,__a_rename_at_432(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_ebb06941cd0c9e4 ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_464, Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  &  __cmp_rename_at_464 )
+{
+	builtin_sort_cblock<uint32_t>(das_ref(__context__,__a_rename_at_464(0,__context__)),4,__cmp_rename_at_464,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_a4b3120f7dbe1103 ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_432 )
+{
+	builtin_sort<uint64_t>(das_ref(__context__,__a_rename_at_432(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_68d792918abece7a ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_464, Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  &  __cmp_rename_at_464 )
+{
+	builtin_sort_cblock<uint64_t>(das_ref(__context__,__a_rename_at_464(0,__context__)),4,__cmp_rename_at_464,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_by_key_417d822841a2c0e4 ( Context * __context__, TArray<struct Foo> &  __a_rename_at_612, Block DAS_COMMENT((float,struct Foo const )) const  &  __key_rename_at_612 )
+{
+	if ( builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_612)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_612),__context__);
+		TArray<float> __keys_rename_at_617; das_zero(__keys_rename_at_617);
+		_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__keys_rename_at_617),builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_612)));
+		{
+			bool __need_loop_619 = true;
+			// x : Foo aka TT&
+			das_iterator<TArray<struct Foo>> __x_iterator(__a_rename_at_612);
+			struct Foo * __x_rename_at_619;
+			__need_loop_619 = __x_iterator.first(__context__,(__x_rename_at_619)) && __need_loop_619;
+			// k : float&
+			das_iterator<TArray<float>> __k_iterator(__keys_rename_at_617);
+			float * __k_rename_at_619;
+			__need_loop_619 = __k_iterator.first(__context__,(__k_rename_at_619)) && __need_loop_619;
+			for ( ; __need_loop_619 ; __need_loop_619 = __x_iterator.next(__context__,(__x_rename_at_619)) && __k_iterator.next(__context__,(__k_rename_at_619)) )
+			{
+				das_copy((*__k_rename_at_619),das_invoke<float>::invoke<struct Foo &>(__context__,__key_rename_at_612,das_arg<struct Foo>::pass((*__x_rename_at_619))));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_619));
+			__k_iterator.close(__context__,(__k_rename_at_619));
+		};
+		builtin_sort_by_key<float>(das_ref(__context__,__a_rename_at_612(0,__context__)),8,builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_612)),das_ref(__context__,__keys_rename_at_617(0,__context__)));
+		_Funcbuiltin_0x60_finalize_4da34799ba0520c5(__context__,das_arg<TArray<float>>::pass(__keys_rename_at_617));
+		builtin_array_unlock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_612),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_by_key_839c285c1f684980 ( Context * __context__, TArray<struct Foo> &  __a_rename_at_612, Block DAS_COMMENT((int32_t,struct Foo const )) const  &  __key_rename_at_612 )
+{
+	if ( builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_612)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_612),__context__);
+		TArray<int32_t> __keys_rename_at_617; das_zero(__keys_rename_at_617);
+		_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_617),builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_612)));
+		{
+			bool __need_loop_619 = true;
+			// x : Foo aka TT&
+			das_iterator<TArray<struct Foo>> __x_iterator(__a_rename_at_612);
+			struct Foo * __x_rename_at_619;
+			__need_loop_619 = __x_iterator.first(__context__,(__x_rename_at_619)) && __need_loop_619;
+			// k : int&
+			das_iterator<TArray<int32_t>> __k_iterator(__keys_rename_at_617);
+			int32_t * __k_rename_at_619;
+			__need_loop_619 = __k_iterator.first(__context__,(__k_rename_at_619)) && __need_loop_619;
+			for ( ; __need_loop_619 ; __need_loop_619 = __x_iterator.next(__context__,(__x_rename_at_619)) && __k_iterator.next(__context__,(__k_rename_at_619)) )
+			{
+				das_copy((*__k_rename_at_619),das_invoke<int32_t>::invoke<struct Foo &>(__context__,__key_rename_at_612,das_arg<struct Foo>::pass((*__x_rename_at_619))));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_619));
+			__k_iterator.close(__context__,(__k_rename_at_619));
+		};
+		builtin_sort_by_key<int32_t>(das_ref(__context__,__a_rename_at_612(0,__context__)),8,builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_612)),das_ref(__context__,__keys_rename_at_617(0,__context__)));
+		_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_617));
+		builtin_array_unlock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_612),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_by_key_cdfd71ed067b8228 ( Context * __context__, TDim<struct Foo,5> &  __a_rename_at_595, Block DAS_COMMENT((char *,struct Foo const )) const  &  __key_rename_at_595 )
+{
+	TArray<char *> __keys_rename_at_598; das_zero(__keys_rename_at_598);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__keys_rename_at_598),5);
+	{
+		bool __need_loop_600 = true;
+		// x : Foo aka TT&
+		das_iterator<TDim<struct Foo,5>> __x_iterator(__a_rename_at_595);
+		struct Foo * __x_rename_at_600;
+		__need_loop_600 = __x_iterator.first(__context__,(__x_rename_at_600)) && __need_loop_600;
+		// k : string&
+		das_iterator<TArray<char *>> __k_iterator(__keys_rename_at_598);
+		char * * __k_rename_at_600;
+		__need_loop_600 = __k_iterator.first(__context__,(__k_rename_at_600)) && __need_loop_600;
+		for ( ; __need_loop_600 ; __need_loop_600 = __x_iterator.next(__context__,(__x_rename_at_600)) && __k_iterator.next(__context__,(__k_rename_at_600)) )
+		{
+			das_copy((*__k_rename_at_600),das_invoke<char *>::invoke<struct Foo &>(__context__,__key_rename_at_595,das_arg<struct Foo>::pass((*__x_rename_at_600))));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_600));
+		__k_iterator.close(__context__,(__k_rename_at_600));
+	};
+	builtin_sort_by_key_string(das_ref(__context__,__a_rename_at_595(0,__context__)),8,5,das_ref(__context__,__keys_rename_at_598(0,__context__)));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__keys_rename_at_598));
+}
+
+inline void _Funcbuiltin_0x60_sort_parallel_8ba3b15fac683d85 ( Context * __context__, TArray<struct Foo> &  __a_rename_at_578, Block DAS_COMMENT((int32_t,struct Foo const )) const  &  __key_rename_at_578 )
+{
+	if ( builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_578)) == 0 )
+	{
+		return ;
+	} else {
+		TArray<int32_t> __keys_rename_at_583; das_zero(__keys_rename_at_583);
+		_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_583),builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_578)));
+		{
+			bool __need_loop_585 = true;
+			// x : Foo aka TT&
+			das_iterator<TArray<struct Foo>> __x_iterator(__a_rename_at_578);
+			struct Foo * __x_rename_at_585;
+			__need_loop_585 = __x_iterator.first(__context__,(__x_rename_at_585)) && __need_loop_585;
+			// k : int&
+			das_iterator<TArray<int32_t>> __k_iterator(__keys_rename_at_583);
+			int32_t * __k_rename_at_585;
+			__need_loop_585 = __k_iterator.first(__context__,(__k_rename_at_585)) && __need_loop_585;
+			for ( ; __need_loop_585 ; __need_loop_585 = __x_iterator.next(__context__,(__x_rename_at_585)) && __k_iterator.next(__context__,(__k_rename_at_585)) )
+			{
+				das_copy((*__k_rename_at_585),das_invoke<int32_t>::invoke<struct Foo &>(__context__,__key_rename_at_578,das_arg<struct Foo>::pass((*__x_rename_at_585))));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_585));
+			__k_iterator.close(__context__,(__k_rename_at_585));
+		};
+		builtin_array_lock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_578),__context__);
+		builtin_sort_parallel_by_key<int32_t>(das_ref(__context__,__a_rename_at_578(0,__context__)),8,builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_578)),das_ref(__context__,__keys_rename_at_583(0,__context__)));
+		builtin_array_unlock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_578),__context__);
+		_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_583));
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_parallel_47c5a0dd24e699c3 ( Context * __context__, TArray<float> &  __a_rename_at_567 )
+{
+	if ( builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_567)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<float>>::pass(__a_rename_at_567),__context__);
+		builtin_sort_parallel<float>(das_ref(__context__,__a_rename_at_567(0,__context__)),builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_567)));
+		builtin_array_unlock(das_arg<TArray<float>>::pass(__a_rename_at_567),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c ( Context * __context__, TArray<int32_t> &  __a_rename_at_567 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_567)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_567),__context__);
+		builtin_sort_parallel<int32_t>(das_ref(__context__,__a_rename_at_567(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_567)));
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_567),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_stable_sort_56a6f4f4a2be66e9 ( Context * __context__, TArray<struct Foo> &  __a_rename_at_542, Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  &  __cmp_rename_at_542 )
+{
+	if ( builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_542)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_542),__context__);
+		builtin_stable_sort_any_cblock(das_ref(__context__,__a_rename_at_542(0,__context__)),8,builtin_array_size(das_arg<TArray<struct Foo>>::pass(__a_rename_at_542)),__cmp_rename_at_542,__context__);
+		builtin_array_unlock(das_arg<TArray<struct Foo>>::pass(__a_rename_at_542),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_stable_sort_fec300b0e65033ec ( Context * __context__, TArray<float> &  __a_rename_at_542, Block DAS_COMMENT((bool,float,float)) const  &  __cmp_rename_at_542 )
+{
+	if ( builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_542)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<float>>::pass(__a_rename_at_542),__context__);
+		builtin_stable_sort_cblock<float>(das_ref(__context__,__a_rename_at_542(0,__context__)),builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_542)),__cmp_rename_at_542,__context__);
+		builtin_array_unlock(das_arg<TArray<float>>::pass(__a_rename_at_542),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_stable_sort_b5da33b81ceb130a ( Context * __context__, TArray<int32_t> &  __a_rename_at_510 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_510)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_510),__context__);
+		builtin_stable_sort<int32_t>(das_ref(__context__,__a_rename_at_510(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_510)));
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_510),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_stable_sort_5360c5d29b98e3f1 ( Context * __context__, TArray<int32_t> &  __a_rename_at_542, Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  __cmp_rename_at_542 )
+{
+	if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_542)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_542),__context__);
+		builtin_stable_sort_cblock<int32_t>(das_ref(__context__,__a_rename_at_542(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_542)),__cmp_rename_at_542,__context__);
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_542),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_stable_sort_2346a4fc9d234696 ( Context * __context__, TArray<char *> &  __a_rename_at_510 )
+{
+	if ( builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_510)) == 0 )
+	{
+		return ;
+	} else {
+		builtin_array_lock(das_arg<TArray<char *>>::pass(__a_rename_at_510),__context__);
+		builtin_stable_sort_string(das_ref(__context__,__a_rename_at_510(0,__context__)),builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_510)));
+		builtin_array_unlock(das_arg<TArray<char *>>::pass(__a_rename_at_510),__context__);
+	};
+}
+
+inline void _Funcbuiltin_0x60_stable_sort_5d5252a838ad02cd ( Context * __context__, TDim<struct Foo,6> &  __a_rename_at_528, Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  &  __cmp_rename_at_528 )
+{
+	builtin_stable_sort_any_cblock(das_ref(__context__,__a_rename_at_528(0,__context__)),8,6,__cmp_rename_at_528,__context__);
+}
+
+inline TArray<struct Foo> _Funcbuiltin_0x60_to_array_move_2003aa4937a0a5de ( Context * __context__, TDim<struct Foo,4> &  __a_rename_at_398 )
+{
+	TArray<struct Foo> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_df901583a0cdec70(__context__,das_arg<TArray<struct Foo>>::pass(__arr_rename_at_399),4);
+	das_copy(das_cast<TDim<struct Foo,4>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<double> _Funcbuiltin_0x60_to_array_move_be98d5ec8498afcd ( Context * __context__, TDim<double,4> &  __a_rename_at_398 )
+{
+	TArray<double> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_6640dbff129f8443(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_399),4);
+	das_copy(das_cast<TDim<double,4>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<float> _Funcbuiltin_0x60_to_array_move_9fec2914481bd4c4 ( Context * __context__, TDim<float,3> &  __a_rename_at_398 )
+{
+	TArray<float> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_399),3);
+	das_copy(das_cast<TDim<float,3>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<float> _Funcbuiltin_0x60_to_array_move_439aeef6544bba80 ( Context * __context__, TDim<float,4> &  __a_rename_at_398 )
+{
+	TArray<float> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_399),4);
+	das_copy(das_cast<TDim<float,4>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_398 )
+{
+	TArray<int32_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_399),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_bb512feadf9377fd ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_398 )
+{
+	TArray<int32_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_399),4);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<int64_t> _Funcbuiltin_0x60_to_array_move_d6808c965184e8ff ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_398 )
+{
+	TArray<int64_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_20419c2df14c9d85(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_399),4);
+	das_copy(das_cast<TDim<int64_t,4>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_f77c6221a73cea41 ( Context * __context__, TDim<char *,4> &  __a_rename_at_398 )
+{
+	TArray<char *> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_399),4);
+	das_copy(das_cast<TDim<char *,4>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_bc1ac001df26d32f ( Context * __context__, TDim<char *,5> &  __a_rename_at_398 )
+{
+	TArray<char *> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_399),5);
+	das_copy(das_cast<TDim<char *,5>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<uint32_t> _Funcbuiltin_0x60_to_array_move_3ea39969ebcb8c3c ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_398 )
+{
+	TArray<uint32_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_29914d27690eb1e4(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_399),4);
+	das_copy(das_cast<TDim<uint32_t,4>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<uint64_t> _Funcbuiltin_0x60_to_array_move_bf436f76763a926e ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_398 )
+{
+	TArray<uint64_t> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_48979e8311fe5126(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_399),4);
+	das_copy(das_cast<TDim<uint64_t,4>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline TArray<int32_t> random_ints_3decc040b0920eba ( Context * __context__, int32_t __n_rename_at_36 )
+{
+	int32_t __seed_rename_at_37 = 13;
+	TArray<int32_t> __res_rename_at_38; das_zero(__res_rename_at_38);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__res_rename_at_38),__n_rename_at_36);
+	{
+		bool __need_loop_40 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__n_rename_at_36));
+		int32_t __i_rename_at_40;
+		__need_loop_40 = __i_iterator.first(__context__,(__i_rename_at_40)) && __need_loop_40;
+		for ( ; __need_loop_40 ; __need_loop_40 = __i_iterator.next(__context__,(__i_rename_at_40)) )
+		{
+			das_copy(__seed_rename_at_37,(__seed_rename_at_37 * 1103515245) + 12345);
+			das_copy(__res_rename_at_38(__i_rename_at_40,__context__),__seed_rename_at_37);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_40));
+	};
+	return /* <- */ __res_rename_at_38;
+}
+
+inline bool test_2073c93b96ef3243 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,800,"test " DAS_FILE_LINE);
+{
+	TDim<int32_t,4> _temp_make_local_204_32;
+	TArray<int32_t> _temp_make_local_205_48;
+	TDim<int32_t,4> _temp_make_local_205_80;
+	TDim<uint32_t,4> _temp_make_local_206_96;
+	TArray<uint32_t> _temp_make_local_207_112;
+	TDim<uint32_t,4> _temp_make_local_207_144;
+	TDim<int64_t,4> _temp_make_local_208_160;
+	TArray<int64_t> _temp_make_local_209_192;
+	TDim<int64_t,4> _temp_make_local_209_224;
+	TDim<uint64_t,4> _temp_make_local_210_256;
+	TArray<uint64_t> _temp_make_local_211_288;
+	TDim<uint64_t,4> _temp_make_local_211_320;
+	TDim<float,4> _temp_make_local_212_352;
+	TArray<float> _temp_make_local_213_368;
+	TDim<float,4> _temp_make_local_213_400;
+	TDim<double,4> _temp_make_local_214_416;
+	TArray<double> _temp_make_local_215_448;
+	TDim<double,4> _temp_make_local_215_480;
+	TDim<char *,4> _temp_make_local_217_512;
+	TArray<char *> _temp_make_local_218_544;
+	TDim<char *,4> _temp_make_local_218_576;
+	TDim<struct Foo,4> _temp_make_local_220_608;
+	TArray<struct Foo> _temp_make_local_221_640;
+	TDim<struct Foo,4> _temp_make_local_221_672;
+	_Func_0x60_test_sort_22d6dffef5f8e70e(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_204_32(0,__context__) = 3;
+		_temp_make_local_204_32(1,__context__) = 2;
+		_temp_make_local_204_32(2,__context__) = 4;
+		_temp_make_local_204_32(3,__context__) = 1;
+		return _temp_make_local_204_32;
+	})())));
+	_Func_0x60_test_sort_304fa7d3698611c4(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_205_48 = (_Funcbuiltin_0x60_to_array_move_bb512feadf9377fd(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_205_80(0,__context__) = 3;
+		_temp_make_local_205_80(1,__context__) = 2;
+		_temp_make_local_205_80(2,__context__) = 4;
+		_temp_make_local_205_80(3,__context__) = 1;
+		return _temp_make_local_205_80;
+	})())))))));
+	_Func_0x60_test_sort_ff217a0d934c4d76(__context__,das_arg<TDim<uint32_t,4>>::pass((([&]() -> TDim<uint32_t,4>& {
+		_temp_make_local_206_96(0,__context__) = 0x3u;
+		_temp_make_local_206_96(1,__context__) = 0x2u;
+		_temp_make_local_206_96(2,__context__) = 0x4u;
+		_temp_make_local_206_96(3,__context__) = 0x1u;
+		return _temp_make_local_206_96;
+	})())));
+	_Func_0x60_test_sort_82ff6056e854ab4a(__context__,das_arg<TArray<uint32_t>>::pass((_temp_make_local_207_112 = (_Funcbuiltin_0x60_to_array_move_3ea39969ebcb8c3c(__context__,das_arg<TDim<uint32_t,4>>::pass((([&]() -> TDim<uint32_t,4>& {
+		_temp_make_local_207_144(0,__context__) = 0x3u;
+		_temp_make_local_207_144(1,__context__) = 0x2u;
+		_temp_make_local_207_144(2,__context__) = 0x4u;
+		_temp_make_local_207_144(3,__context__) = 0x1u;
+		return _temp_make_local_207_144;
+	})())))))));
+	_Func_0x60_test_sort_9ce9963f3b5f69b6(__context__,das_arg<TDim<int64_t,4>>::pass((([&]() -> TDim<int64_t,4>& {
+		_temp_make_local_208_160(0,__context__) = 3ll;
+		_temp_make_local_208_160(1,__context__) = 2ll;
+		_temp_make_local_208_160(2,__context__) = 4ll;
+		_temp_make_local_208_160(3,__context__) = 1ll;
+		return _temp_make_local_208_160;
+	})())));
+	_Func_0x60_test_sort_f9629930f1a02904(__context__,das_arg<TArray<int64_t>>::pass((_temp_make_local_209_192 = (_Funcbuiltin_0x60_to_array_move_d6808c965184e8ff(__context__,das_arg<TDim<int64_t,4>>::pass((([&]() -> TDim<int64_t,4>& {
+		_temp_make_local_209_224(0,__context__) = 3ll;
+		_temp_make_local_209_224(1,__context__) = 2ll;
+		_temp_make_local_209_224(2,__context__) = 4ll;
+		_temp_make_local_209_224(3,__context__) = 1ll;
+		return _temp_make_local_209_224;
+	})())))))));
+	_Func_0x60_test_sort_d2547c3b2df964b2(__context__,das_arg<TDim<uint64_t,4>>::pass((([&]() -> TDim<uint64_t,4>& {
+		_temp_make_local_210_256(0,__context__) = 0x3ull;
+		_temp_make_local_210_256(1,__context__) = 0x2ull;
+		_temp_make_local_210_256(2,__context__) = 0x4ull;
+		_temp_make_local_210_256(3,__context__) = 0x1ull;
+		return _temp_make_local_210_256;
+	})())));
+	_Func_0x60_test_sort_350efca99f70722e(__context__,das_arg<TArray<uint64_t>>::pass((_temp_make_local_211_288 = (_Funcbuiltin_0x60_to_array_move_bf436f76763a926e(__context__,das_arg<TDim<uint64_t,4>>::pass((([&]() -> TDim<uint64_t,4>& {
+		_temp_make_local_211_320(0,__context__) = 0x3ull;
+		_temp_make_local_211_320(1,__context__) = 0x2ull;
+		_temp_make_local_211_320(2,__context__) = 0x4ull;
+		_temp_make_local_211_320(3,__context__) = 0x1ull;
+		return _temp_make_local_211_320;
+	})())))))));
+	_Func_0x60_test_sort_74cc3eda9233ce6(__context__,das_arg<TDim<float,4>>::pass((([&]() -> TDim<float,4>& {
+		_temp_make_local_212_352(0,__context__) = 3.f;
+		_temp_make_local_212_352(1,__context__) = 2.f;
+		_temp_make_local_212_352(2,__context__) = 4.f;
+		_temp_make_local_212_352(3,__context__) = 1.f;
+		return _temp_make_local_212_352;
+	})())));
+	_Func_0x60_test_sort_42ea9debe4e5192a(__context__,das_arg<TArray<float>>::pass((_temp_make_local_213_368 = (_Funcbuiltin_0x60_to_array_move_439aeef6544bba80(__context__,das_arg<TDim<float,4>>::pass((([&]() -> TDim<float,4>& {
+		_temp_make_local_213_400(0,__context__) = 3.f;
+		_temp_make_local_213_400(1,__context__) = 2.f;
+		_temp_make_local_213_400(2,__context__) = 4.f;
+		_temp_make_local_213_400(3,__context__) = 1.f;
+		return _temp_make_local_213_400;
+	})())))))));
+	_Func_0x60_test_sort_e2c2c8ed1fae32fa(__context__,das_arg<TDim<double,4>>::pass((([&]() -> TDim<double,4>& {
+		_temp_make_local_214_416(0,__context__) = 3;
+		_temp_make_local_214_416(1,__context__) = 2;
+		_temp_make_local_214_416(2,__context__) = 4;
+		_temp_make_local_214_416(3,__context__) = 1;
+		return _temp_make_local_214_416;
+	})())));
+	_Func_0x60_test_sort_75abc0782fb70548(__context__,das_arg<TArray<double>>::pass((_temp_make_local_215_448 = (_Funcbuiltin_0x60_to_array_move_be98d5ec8498afcd(__context__,das_arg<TDim<double,4>>::pass((([&]() -> TDim<double,4>& {
+		_temp_make_local_215_480(0,__context__) = 3;
+		_temp_make_local_215_480(1,__context__) = 2;
+		_temp_make_local_215_480(2,__context__) = 4;
+		_temp_make_local_215_480(3,__context__) = 1;
+		return _temp_make_local_215_480;
+	})())))))));
+	_Func_0x60_test_sort_6f87a791ceed90be(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_217_512(0,__context__) = ((char *) "3.0lf");
+		_temp_make_local_217_512(1,__context__) = ((char *) "2.0lf");
+		_temp_make_local_217_512(2,__context__) = ((char *) "4.0lf");
+		_temp_make_local_217_512(3,__context__) = ((char *) "1.0lf");
+		return _temp_make_local_217_512;
+	})())));
+	_Func_0x60_test_sort_82142c694b774a9e(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_218_544 = (_Funcbuiltin_0x60_to_array_move_f77c6221a73cea41(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_218_576(0,__context__) = ((char *) "3.0lf");
+		_temp_make_local_218_576(1,__context__) = ((char *) "2.0lf");
+		_temp_make_local_218_576(2,__context__) = ((char *) "4.0lf");
+		_temp_make_local_218_576(3,__context__) = ((char *) "1.0lf");
+		return _temp_make_local_218_576;
+	})())))))));
+	_Func_0x60_test_sort_d9e7b4399e747d82(__context__,das_arg<TDim<struct Foo,4>>::pass((([&]() -> TDim<struct Foo,4>& {
+		das_copy((_temp_make_local_220_608(0,__context__).x),(1));
+		das_copy((_temp_make_local_220_608(0,__context__).y),(2));
+		das_copy((_temp_make_local_220_608(1,__context__).x),(1));
+		das_copy((_temp_make_local_220_608(1,__context__).y),(1));
+		das_copy((_temp_make_local_220_608(2,__context__).x),(2));
+		das_copy((_temp_make_local_220_608(2,__context__).y),(2));
+		das_copy((_temp_make_local_220_608(3,__context__).x),(0));
+		das_copy((_temp_make_local_220_608(3,__context__).y),(1));
+		return _temp_make_local_220_608;
+	})())));
+	_Func_0x60_test_sort_d2f303885c572432(__context__,das_arg<TArray<struct Foo>>::pass((_temp_make_local_221_640 = (_Funcbuiltin_0x60_to_array_move_2003aa4937a0a5de(__context__,das_arg<TDim<struct Foo,4>>::pass((([&]() -> TDim<struct Foo,4>& {
+		das_copy((_temp_make_local_221_672(0,__context__).x),(1));
+		das_copy((_temp_make_local_221_672(0,__context__).y),(2));
+		das_copy((_temp_make_local_221_672(1,__context__).x),(1));
+		das_copy((_temp_make_local_221_672(1,__context__).y),(1));
+		das_copy((_temp_make_local_221_672(2,__context__).x),(2));
+		das_copy((_temp_make_local_221_672(2,__context__).y),(2));
+		das_copy((_temp_make_local_221_672(3,__context__).x),(0));
+		das_copy((_temp_make_local_221_672(3,__context__).y),(1));
+		return _temp_make_local_221_672;
+	})())))))));
+	test_vector_sort_4e9f6f380b1d0080(__context__);
+	TArray<int32_t> __empty_rename_at_225; das_zero(__empty_rename_at_225);
+	_Funcbuiltin_0x60_sort_f52f40276c6eddae(__context__,das_arg<TArray<int32_t>>::pass(__empty_rename_at_225));
+	_Funcbuiltin_0x60_stable_sort_5360c5d29b98e3f1(__context__,das_arg<TArray<int32_t>>::pass(__empty_rename_at_225),das_make_block<bool,int32_t,int32_t>(__context__,784,0,&__func_info__a475d94a,[&](int32_t const  __a_rename_at_227, int32_t const  __b_rename_at_227)->bool{
+		return __a_rename_at_227 < __b_rename_at_227;
+	}));
+	test_large_sort_a3c130b8693e5b86(__context__);
+	test_stable_sort_e228516c59b09340(__context__);
+	test_sort_parallel_5176334f852b4f43(__context__,1);
+	test_sort_parallel_5176334f852b4f43(__context__,4);
+	test_sort_by_key_dc88811d1879d0fd(__context__);
+	test_non_strict_sort_47ea7ef0c60c946(__context__);
+	return true;
+}}
+
+inline void test_large_sort_a3c130b8693e5b86 ( Context * __context__ )
+{
+	TArray<int32_t> __ints_rename_at_47; das_zero(__ints_rename_at_47); das_move(__ints_rename_at_47, random_ints_3decc040b0920eba(__context__,10000));
+	TArray<int64_t> __i64_rename_at_48; das_zero(__i64_rename_at_48);
+	TArray<uint32_t> __u32_rename_at_49; das_zero(__u32_rename_at_49);
+	TArray<uint64_t> __u64_rename_at_50; das_zero(__u64_rename_at_50);
+	TArray<float> __fl_rename_at_51; das_zero(__fl_rename_at_51);
+	TArray<double> __dl_rename_at_52; das_zero(__dl_rename_at_52);
+	TArray<char *> __st_rename_at_53; das_zero(__st_rename_at_53);
+	{
+		bool __need_loop_54 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__ints_rename_at_47);
+		int32_t * __x_rename_at_54;
+		__need_loop_54 = __x_iterator.first(__context__,(__x_rename_at_54)) && __need_loop_54;
+		for ( ; __need_loop_54 ; __need_loop_54 = __x_iterator.next(__context__,(__x_rename_at_54)) )
+		{
+			_Funcbuiltin_0x60_push_e22ac40adebb56c6(__context__,das_arg<TArray<int64_t>>::pass(__i64_rename_at_48),int64_t((*__x_rename_at_54)) * 1000003ll,-1);
+			_Funcbuiltin_0x60_push_bcce321c8cba23ec(__context__,das_arg<TArray<uint32_t>>::pass(__u32_rename_at_49),uint32_t((*__x_rename_at_54)),-1);
+			_Funcbuiltin_0x60_push_3720b69e5114725c(__context__,das_arg<TArray<uint64_t>>::pass(__u64_rename_at_50),uint64_t((*__x_rename_at_54)) * 0xf4243ull,-1);
+			_Funcbuiltin_0x60_push_8a9191e5eb1aa83e(__context__,das_arg<TArray<float>>::pass(__fl_rename_at_51),SimPolicy<float>::Div(float((*__x_rename_at_54)),1000.f,*__context__),-1);
+			_Funcbuiltin_0x60_push_67396f51c9762faa(__context__,das_arg<TArray<double>>::pass(__dl_rename_at_52),SimPolicy<double>::Div(double((*__x_rename_at_54)),1000,*__context__),-1);
+			_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass(__st_rename_at_53),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from((*__x_rename_at_54)))),-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_54));
+	};
+	_Func_0x60_test_sort_large_1518a840afedf0e0(__context__,das_arg<TArray<int32_t>>::pass(__ints_rename_at_47));
+	_Func_0x60_test_sort_large_efa7d161d517afc2(__context__,das_arg<TArray<int64_t>>::pass(__i64_rename_at_48));
+	_Func_0x60_test_sort_large_a5d8c212d150acb9(__context__,das_arg<TArray<uint32_t>>::pass(__u32_rename_at_49));
+	_Func_0x60_test_sort_large_8a8f580b35ff4d7f(__context__,das_arg<TArray<uint64_t>>::pass(__u64_rename_at_50));
+	_Func_0x60_test_sort_large_e70381c15924e4af(__context__,das_arg<TArray<float>>::pass(__fl_rename_at_51));
+	_Func_0x60_test_sort_large_1fa64015b8b1dfe0(__context__,das_arg<TArray<double>>::pass(__dl_rename_at_52));
+	_Func_0x60_test_sort_large_d917d3afc5c4eca1(__context__,das_arg<TArray<char *>>::pass(__st_rename_at_53));
+	TArray<int32_t> __dup_rename_at_69; das_zero(__dup_rename_at_69); das_move(__dup_rename_at_69, random_ints_3decc040b0920eba(__context__,10000));
+	{
+		bool __need_loop_70 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__dup_rename_at_69);
+		int32_t * __x_rename_at_70;
+		__need_loop_70 = __x_iterator.first(__context__,(__x_rename_at_70)) && __need_loop_70;
+		for ( ; __need_loop_70 ; __need_loop_70 = __x_iterator.next(__context__,(__x_rename_at_70)) )
+		{
+			(*__x_rename_at_70) &= 7;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_70));
+	};
+	_Funcbuiltin_0x60_sort_f52f40276c6eddae(__context__,das_arg<TArray<int32_t>>::pass(__dup_rename_at_69));
+	{
+		bool __need_loop_73 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,10000));
+		int32_t __i_rename_at_73;
+		__need_loop_73 = __i_iterator.first(__context__,(__i_rename_at_73)) && __need_loop_73;
+		for ( ; __need_loop_73 ; __need_loop_73 = __i_iterator.next(__context__,(__i_rename_at_73)) )
+		{
+			DAS_ASSERT((__dup_rename_at_69((__i_rename_at_73 - 1),__context__) <= __dup_rename_at_69(__i_rename_at_73,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_73));
+	};
+	DAS_ASSERT(((__dup_rename_at_69(0,__context__) == 0) && (__dup_rename_at_69(9999,__context__) == 7)));
+}
+
+inline void test_non_strict_sort_47ea7ef0c60c946 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,480,"test_non_strict_sort " DAS_FILE_LINE);
+{
+	TArray<struct Foo> __foo_rename_at_176; das_zero(__foo_rename_at_176);
+	TArray<int32_t> __ints_rename_at_177; das_zero(__ints_rename_at_177);
+	_Funcbuiltin_0x60_resize_df901583a0cdec70(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_176),1000);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__ints_rename_at_177),1000);
+	_Funcbuiltin_0x60_sort_a2a2e8ad5e51a3bd(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_176),das_make_block<bool,struct Foo const  &,struct Foo const  &>(__context__,144,0,&__func_info__bf2374c8,[&](struct Foo const  & __p_rename_at_180, struct Foo const  & __q_rename_at_180)->bool{
+		return __p_rename_at_180.x <= __q_rename_at_180.x;
+	}));
+	_Funcbuiltin_0x60_sort_780509c039a2989f(__context__,das_arg<TArray<int32_t>>::pass(__ints_rename_at_177),das_make_block<bool,int32_t,int32_t>(__context__,208,0,&__func_info__6d74e354,[&](int32_t const  __p_rename_at_181, int32_t const  __q_rename_at_181)->bool{
+		return __p_rename_at_181 <= __q_rename_at_181;
+	}));
+	TArray<int32_t> __rnd_rename_at_182; das_zero(__rnd_rename_at_182); das_move(__rnd_rename_at_182, random_ints_3decc040b0920eba(__context__,1000));
+	{
+		bool __need_loop_183 = true;
+		// f : Foo&
+		das_iterator<TArray<struct Foo>> __f_iterator(__foo_rename_at_176);
+		struct Foo * __f_rename_at_183;
+		__need_loop_183 = __f_iterator.first(__context__,(__f_rename_at_183)) && __need_loop_183;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__rnd_rename_at_182);
+		int32_t * __x_rename_at_183;
+		__need_loop_183 = __x_iterator.first(__context__,(__x_rename_at_183)) && __need_loop_183;
+		for ( ; __need_loop_183 ; __need_loop_183 = __f_iterator.next(__context__,(__f_rename_at_183)) && __x_iterator.next(__context__,(__x_rename_at_183)) )
+		{
+			das_copy((*__f_rename_at_183).x,(*__x_rename_at_183) & 15);
+		}
+		__f_iterator.close(__context__,(__f_rename_at_183));
+		__x_iterator.close(__context__,(__x_rename_at_183));
+	};
+	_Funcbuiltin_0x60_sort_a2a2e8ad5e51a3bd(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_176),das_make_block<bool,struct Foo const  &,struct Foo const  &>(__context__,336,0,&__func_info__bf2374c8,[&](struct Foo const  & __p_rename_at_185, struct Foo const  & __q_rename_at_185)->bool{
+		return __p_rename_at_185.x <= __q_rename_at_185.x;
+	}));
+	{
+		bool __need_loop_186 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000));
+		int32_t __i_rename_at_186;
+		__need_loop_186 = __i_iterator.first(__context__,(__i_rename_at_186)) && __need_loop_186;
+		for ( ; __need_loop_186 ; __need_loop_186 = __i_iterator.next(__context__,(__i_rename_at_186)) )
+		{
+			DAS_ASSERT((__foo_rename_at_176((__i_rename_at_186 - 1),__context__).x <= __foo_rename_at_176(__i_rename_at_186,__context__).x));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_186));
+	};
+	{
+		bool __need_loop_188 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__rnd_rename_at_182);
+		int32_t * __x_rename_at_188;
+		__need_loop_188 = __x_iterator.first(__context__,(__x_rename_at_188)) && __need_loop_188;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_188;
+		__need_loop_188 = __i_iterator.first(__context__,(__i_rename_at_188)) && __need_loop_188;
+		for ( ; __need_loop_188 ; __need_loop_188 = __x_iterator.next(__context__,(__x_rename_at_188)) && __i_iterator.next(__context__,(__i_rename_at_188)) )
+		{
+			das_copy(__ints_rename_at_177(__i_rename_at_188,__context__),(*__x_rename_at_188) & 15);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_188));
+		__i_iterator.close(__context__,(__i_rename_at_188));
+	};
+	_Funcbuiltin_0x60_sort_780509c039a2989f(__context__,das_arg<TArray<int32_t>>::pass(__ints_rename_at_177),das_make_block<bool,int32_t,int32_t>(__context__,448,0,&__func_info__6d74e354,[&](int32_t const  __p_rename_at_190, int32_t const  __q_rename_at_190)->bool{
+		return __p_rename_at_190 >= __q_rename_at_190;
+	}));
+	{
+		bool __need_loop_191 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000));
+		int32_t __i_rename_at_191;
+		__need_loop_191 = __i_iterator.first(__context__,(__i_rename_at_191)) && __need_loop_191;
+		for ( ; __need_loop_191 ; __need_loop_191 = __i_iterator.next(__context__,(__i_rename_at_191)) )
+		{
+			DAS_ASSERT((__ints_rename_at_177((__i_rename_at_191 - 1),__context__) >= __ints_rename_at_177(__i_rename_at_191,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_191));
+	};
+}}
+
+inline void test_sort_by_key_dc88811d1879d0fd ( Context * __context__ ) { das_stack_prologue __prologue(__context__,800,"test_sort_by_key " DAS_FILE_LINE);
+{
+	TDim<char *,5> _temp_make_local_149_272;
+	TArray<int32_t> __ints_rename_at_136; das_zero(__ints_rename_at_136); das_move(__ints_rename_at_136, random_ints_3decc040b0920eba(__context__,1000));
+	TArray<struct Foo> __foo_rename_at_137; das_zero(__foo_rename_at_137);
+	{
+		bool __need_loop_138 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__ints_rename_at_136);
+		int32_t * __x_rename_at_138;
+		__need_loop_138 = __x_iterator.first(__context__,(__x_rename_at_138)) && __need_loop_138;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_138;
+		__need_loop_138 = __i_iterator.first(__context__,(__i_rename_at_138)) && __need_loop_138;
+		for ( ; __need_loop_138 ; __need_loop_138 = __x_iterator.next(__context__,(__x_rename_at_138)) && __i_iterator.next(__context__,(__i_rename_at_138)) )
+		{
+			struct Foo _temp_make_local_139_128;
+			_Funcbuiltin_0x60_push_6366ae72f8b3a6bc(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_137),das_arg<struct Foo>::pass((([&]() -> struct Foo& {
+				das_copy((_temp_make_local_139_128.x),(((*__x_rename_at_138) & 31)));
+				das_copy((_temp_make_local_139_128.y),(__i_rename_at_138));
+				return _temp_make_local_139_128;
+			})())),-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_138));
+		__i_iterator.close(__context__,(__i_rename_at_138));
+	};
+	int32_t __calls_rename_at_141 = 0;
+	_Funcbuiltin_0x60_sort_by_key_839c285c1f684980(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_137),das_make_block<int32_t,struct Foo const  &>(__context__,208,0,&__func_info__aaa238d2,[&](struct Foo const  & __f_rename_at_142)->int32_t{
+		__calls_rename_at_141++;
+		return -__f_rename_at_142.x;
+	}));
+	DAS_ASSERT((__calls_rename_at_141 == 1000));
+	{
+		bool __need_loop_146 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000));
+		int32_t __i_rename_at_146;
+		__need_loop_146 = __i_iterator.first(__context__,(__i_rename_at_146)) && __need_loop_146;
+		for ( ; __need_loop_146 ; __need_loop_146 = __i_iterator.next(__context__,(__i_rename_at_146)) )
+		{
+			DAS_ASSERT(((__foo_rename_at_137((__i_rename_at_146 - 1),__context__).x > __foo_rename_at_137(__i_rename_at_146,__context__).x) || ((__foo_rename_at_137((__i_rename_at_146 - 1),__context__).x == __foo_rename_at_137(__i_rename_at_146,__context__).x) && (__foo_rename_at_137((__i_rename_at_146 - 1),__context__).y < __foo_rename_at_137(__i_rename_at_146,__context__).y))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_146));
+	};
+	TArray<char *> __names_rename_at_149; das_zero(__names_rename_at_149); das_move(__names_rename_at_149, _Funcbuiltin_0x60_to_array_move_bc1ac001df26d32f(__context__,das_arg<TDim<char *,5>>::pass((([&]() -> TDim<char *,5>& {
+		_temp_make_local_149_272(0,__context__) = ((char *) "delta");
+		_temp_make_local_149_272(1,__context__) = ((char *) "alpha");
+		_temp_make_local_149_272(2,__context__) = ((char *) "charlie");
+		_temp_make_local_149_272(3,__context__) = ((char *) "bravo");
+		_temp_make_local_149_272(4,__context__) = ((char *) "alpha");
+		return _temp_make_local_149_272;
+	})()))));
+	TDim<struct Foo,5> __nfoo_rename_at_150; das_zero(__nfoo_rename_at_150);
+	{
+		bool __need_loop_151 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,5));
+		int32_t __i_rename_at_151;
+		__need_loop_151 = __i_iterator.first(__context__,(__i_rename_at_151)) && __need_loop_151;
+		for ( ; __need_loop_151 ; __need_loop_151 = __i_iterator.next(__context__,(__i_rename_at_151)) )
+		{
+			das_copy(__nfoo_rename_at_150(__i_rename_at_151,__context__).y,__i_rename_at_151);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_151));
+	};
+	_Funcbuiltin_0x60_sort_by_key_cdfd71ed067b8228(__context__,das_arg<TDim<struct Foo,5>>::pass(__nfoo_rename_at_150),das_make_block<char *,struct Foo const  &>(__context__,432,0,&__func_info__4b197c1a,[&](struct Foo const  & __f_rename_at_153)->char *{
+		return __names_rename_at_149(__f_rename_at_153.y,__context__);
+	}));
+	DAS_VERIFY((((((__nfoo_rename_at_150(0,__context__).y == 1) && (__nfoo_rename_at_150(1,__context__).y == 4)) && (__nfoo_rename_at_150(2,__context__).y == 3)) && (__nfoo_rename_at_150(3,__context__).y == 2)) && (__nfoo_rename_at_150(4,__context__).y == 0)));
+	{
+		bool __need_loop_156 = true;
+		// f : Foo&
+		das_iterator<TArray<struct Foo>> __f_iterator(__foo_rename_at_137);
+		struct Foo * __f_rename_at_156;
+		__need_loop_156 = __f_iterator.first(__context__,(__f_rename_at_156)) && __need_loop_156;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_156;
+		__need_loop_156 = __i_iterator.first(__context__,(__i_rename_at_156)) && __need_loop_156;
+		for ( ; __need_loop_156 ; __need_loop_156 = __f_iterator.next(__context__,(__f_rename_at_156)) && __i_iterator.next(__context__,(__i_rename_at_156)) )
+		{
+			das_copy((*__f_rename_at_156).x,__ints_rename_at_136(__i_rename_at_156,__context__));
+		}
+		__f_iterator.close(__context__,(__f_rename_at_156));
+		__i_iterator.close(__context__,(__i_rename_at_156));
+	};
+	_Funcbuiltin_0x60_sort_by_key_417d822841a2c0e4(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_137),das_make_block<float,struct Foo const  &>(__context__,528,0,&__func_info__b03abe67,[&](struct Foo const  & __f_rename_at_158)->float{
+		return float(__f_rename_at_158.x) * 0.5f;
+	}));
+	{
+		bool __need_loop_159 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000));
+		int32_t __i_rename_at_159;
+		__need_loop_159 = __i_iterator.first(__context__,(__i_rename_at_159)) && __need_loop_159;
+		for ( ; __need_loop_159 ; __need_loop_159 = __i_iterator.next(__context__,(__i_rename_at_159)) )
+		{
+			DAS_ASSERT((__foo_rename_at_137((__i_rename_at_159 - 1),__context__).x <= __foo_rename_at_137(__i_rename_at_159,__context__).x));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_159));
+	};
+	{
+		bool __need_loop_162 = true;
+		// f : Foo&
+		das_iterator<TArray<struct Foo>> __f_iterator(__foo_rename_at_137);
+		struct Foo * __f_rename_at_162;
+		__need_loop_162 = __f_iterator.first(__context__,(__f_rename_at_162)) && __need_loop_162;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_162;
+		__need_loop_162 = __i_iterator.first(__context__,(__i_rename_at_162)) && __need_loop_162;
+		for ( ; __need_loop_162 ; __need_loop_162 = __f_iterator.next(__context__,(__f_rename_at_162)) && __i_iterator.next(__context__,(__i_rename_at_162)) )
+		{
+			das_copy((*__f_rename_at_162).x,SimPolicy<int32_t>::Mod(__i_rename_at_162,3,*__context__));
+			das_copy((*__f_rename_at_162).y,__i_rename_at_162);
+		}
+		__f_iterator.close(__context__,(__f_rename_at_162));
+		__i_iterator.close(__context__,(__i_rename_at_162));
+	};
+	_Funcbuiltin_0x60_sort_by_key_417d822841a2c0e4(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_137),das_make_block<float,struct Foo const  &>(__context__,640,0,&__func_info__9a19c2be,[&](struct Foo const  & __f_rename_at_165)->float{
+		return (__f_rename_at_165.x == 0) ? (-0.f) : (((__f_rename_at_165.x == 1) ? (0.f) : (-1.f)));
+	}));
+	{
+		bool __need_loop_166 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000));
+		int32_t __i_rename_at_166;
+		__need_loop_166 = __i_iterator.first(__context__,(__i_rename_at_166)) && __need_loop_166;
+		for ( ; __need_loop_166 ; __need_loop_166 = __i_iterator.next(__context__,(__i_rename_at_166)) )
+		{
+			int32_t __prev_rename_at_167 = (int32_t)((__foo_rename_at_137((__i_rename_at_166 - 1),__context__).x == 2) ? (0) : (1));
+			int32_t __cur_rename_at_168 = (int32_t)((__foo_rename_at_137(__i_rename_at_166,__context__).x == 2) ? (0) : (1));
+			DAS_ASSERT(((__prev_rename_at_167 < __cur_rename_at_168) || ((__prev_rename_at_167 == __cur_rename_at_168) && (__foo_rename_at_137((__i_rename_at_166 - 1),__context__).y < __foo_rename_at_137(__i_rename_at_166,__context__).y))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_166));
+	};
+	TArray<struct Foo> __empty_rename_at_170; das_zero(__empty_rename_at_170);
+	_Funcbuiltin_0x60_sort_by_key_839c285c1f684980(__context__,das_arg<TArray<struct Foo>>::pass(__empty_rename_at_170),das_make_block<int32_t,struct Foo const  &>(__context__,784,0,&__func_info__4b991553,[&](struct Foo const  & __f_rename_at_171)->int32_t{
+		return __f_rename_at_171.y;
+	}));
+}}
+
+inline void test_sort_parallel_5176334f852b4f43 ( Context * __context__, int32_t __threads_rename_at_103 ) { das_stack_prologue __prologue(__context__,480,"test_sort_parallel " DAS_FILE_LINE);
+{
+	TDim<int32_t,3> _temp_make_local_125_352;
+	int32_t __oldThreads_rename_at_104 = (int32_t)builtin_parallel_thread_count();
+	builtin_set_parallel_thread_count(__threads_rename_at_103);
+	int32_t __count_rename_at_106 = (int32_t)builtin_parallel_thread_count();
+	DAS_ASSERT((__count_rename_at_106 == __threads_rename_at_103));
+	TArray<int32_t> __ints_rename_at_110; das_zero(__ints_rename_at_110); das_move(__ints_rename_at_110, random_ints_3decc040b0920eba(__context__,100000));
+	TArray<float> __fl_rename_at_111; das_zero(__fl_rename_at_111);
+	TArray<struct Foo> __foo_rename_at_112; das_zero(__foo_rename_at_112);
+	{
+		bool __need_loop_113 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__ints_rename_at_110);
+		int32_t * __x_rename_at_113;
+		__need_loop_113 = __x_iterator.first(__context__,(__x_rename_at_113)) && __need_loop_113;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100000));
+		int32_t __i_rename_at_113;
+		__need_loop_113 = __i_iterator.first(__context__,(__i_rename_at_113)) && __need_loop_113;
+		for ( ; __need_loop_113 ; __need_loop_113 = __x_iterator.next(__context__,(__x_rename_at_113)) && __i_iterator.next(__context__,(__i_rename_at_113)) )
+		{
+			struct Foo _temp_make_local_115_192;
+			_Funcbuiltin_0x60_push_8a9191e5eb1aa83e(__context__,das_arg<TArray<float>>::pass(__fl_rename_at_111),float((*__x_rename_at_113) & 65535),-1);
+			_Funcbuiltin_0x60_push_6366ae72f8b3a6bc(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_112),das_arg<struct Foo>::pass((([&]() -> struct Foo& {
+				das_copy((_temp_make_local_115_192.x),(((*__x_rename_at_113) & 255)));
+				das_copy((_temp_make_local_115_192.y),(__i_rename_at_113));
+				return _temp_make_local_115_192;
+			})())),-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_113));
+		__i_iterator.close(__context__,(__i_rename_at_113));
+	};
+	_Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c(__context__,das_arg<TArray<int32_t>>::pass(__ints_rename_at_110));
+	{
+		bool __need_loop_117 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,100000));
+		int32_t __i_rename_at_117;
+		__need_loop_117 = __i_iterator.first(__context__,(__i_rename_at_117)) && __need_loop_117;
+		for ( ; __need_loop_117 ; __need_loop_117 = __i_iterator.next(__context__,(__i_rename_at_117)) )
+		{
+			DAS_ASSERT((__ints_rename_at_110((__i_rename_at_117 - 1),__context__) <= __ints_rename_at_110(__i_rename_at_117,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_117));
+	};
+	_Funcbuiltin_0x60_sort_parallel_47c5a0dd24e699c3(__context__,das_arg<TArray<float>>::pass(__fl_rename_at_111));
+	{
+		bool __need_loop_120 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,100000));
+		int32_t __i_rename_at_120;
+		__need_loop_120 = __i_iterator.first(__context__,(__i_rename_at_120)) && __need_loop_120;
+		for ( ; __need_loop_120 ; __need_loop_120 = __i_iterator.next(__context__,(__i_rename_at_120)) )
+		{
+			DAS_ASSERT((__fl_rename_at_111((__i_rename_at_120 - 1),__context__) <= __fl_rename_at_111(__i_rename_at_120,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_120));
+	};
+	_Funcbuiltin_0x60_sort_parallel_8ba3b15fac683d85(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_112),das_make_block<int32_t,struct Foo const  &>(__context__,288,0,&__func_info__4b991553,[&](struct Foo const  & __f_rename_at_122)->int32_t{
+		return __f_rename_at_122.x;
+	}));
+	{
+		bool __need_loop_123 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,100000));
+		int32_t __i_rename_at_123;
+		__need_loop_123 = __i_iterator.first(__context__,(__i_rename_at_123)) && __need_loop_123;
+		for ( ; __need_loop_123 ; __need_loop_123 = __i_iterator.next(__context__,(__i_rename_at_123)) )
+		{
+			DAS_ASSERT(((__foo_rename_at_112((__i_rename_at_123 - 1),__context__).x < __foo_rename_at_112(__i_rename_at_123,__context__).x) || ((__foo_rename_at_112((__i_rename_at_123 - 1),__context__).x == __foo_rename_at_112(__i_rename_at_123,__context__).x) && (__foo_rename_at_112((__i_rename_at_123 - 1),__context__).y < __foo_rename_at_112(__i_rename_at_123,__context__).y))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_123));
+	};
+	TArray<int32_t> __small_rename_at_125; das_zero(__small_rename_at_125); das_move(__small_rename_at_125, _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_125_352(0,__context__) = 3;
+		_temp_make_local_125_352(1,__context__) = 1;
+		_temp_make_local_125_352(2,__context__) = 2;
+		return _temp_make_local_125_352;
+	})()))));
+	_Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c(__context__,das_arg<TArray<int32_t>>::pass(__small_rename_at_125));
+	DAS_ASSERT((((__small_rename_at_125(0,__context__) == 1) && (__small_rename_at_125(1,__context__) == 2)) && (__small_rename_at_125(2,__context__) == 3)));
+	TArray<struct Foo> __empty_rename_at_128; das_zero(__empty_rename_at_128);
+	_Funcbuiltin_0x60_sort_parallel_8ba3b15fac683d85(__context__,das_arg<TArray<struct Foo>>::pass(__empty_rename_at_128),das_make_block<int32_t,struct Foo const  &>(__context__,448,0,&__func_info__4b991553,[&](struct Foo const  & __f_rename_at_129)->int32_t{
+		return __f_rename_at_129.y;
+	}));
+	builtin_set_parallel_thread_count(0);
+	int32_t __restored_rename_at_131 = (int32_t)builtin_parallel_thread_count();
+	DAS_ASSERT((__restored_rename_at_131 == __oldThreads_rename_at_104));
+}}
+
+inline void test_stable_sort_e228516c59b09340 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,544,"test_stable_sort " DAS_FILE_LINE);
+{
+	TDim<char *,4> _temp_make_local_96_400;
+	TDim<float,3> _temp_make_local_99_464;
+	TArray<struct Foo> __foo_rename_at_79; das_zero(__foo_rename_at_79);
+	TArray<int32_t> __ints_rename_at_80; das_zero(__ints_rename_at_80); das_move(__ints_rename_at_80, random_ints_3decc040b0920eba(__context__,1000));
+	{
+		bool __need_loop_81 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__ints_rename_at_80);
+		int32_t * __x_rename_at_81;
+		__need_loop_81 = __x_iterator.first(__context__,(__x_rename_at_81)) && __need_loop_81;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_81;
+		__need_loop_81 = __i_iterator.first(__context__,(__i_rename_at_81)) && __need_loop_81;
+		for ( ; __need_loop_81 ; __need_loop_81 = __x_iterator.next(__context__,(__x_rename_at_81)) && __i_iterator.next(__context__,(__i_rename_at_81)) )
+		{
+			struct Foo _temp_make_local_82_128;
+			_Funcbuiltin_0x60_push_6366ae72f8b3a6bc(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_79),das_arg<struct Foo>::pass((([&]() -> struct Foo& {
+				das_copy((_temp_make_local_82_128.x),(((*__x_rename_at_81) & 15)));
+				das_copy((_temp_make_local_82_128.y),(__i_rename_at_81));
+				return _temp_make_local_82_128;
+			})())),-1);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_81));
+		__i_iterator.close(__context__,(__i_rename_at_81));
+	};
+	_Funcbuiltin_0x60_stable_sort_56a6f4f4a2be66e9(__context__,das_arg<TArray<struct Foo>>::pass(__foo_rename_at_79),das_make_block<bool,struct Foo const  &,struct Foo const  &>(__context__,192,0,&__func_info__c973faee,[&](struct Foo const  & __a_rename_at_83, struct Foo const  & __b_rename_at_83)->bool{
+		return __a_rename_at_83.x < __b_rename_at_83.x;
+	}));
+	{
+		bool __need_loop_84 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<struct Foo>>::pass(__foo_rename_at_79))));
+		int32_t __i_rename_at_84;
+		__need_loop_84 = __i_iterator.first(__context__,(__i_rename_at_84)) && __need_loop_84;
+		for ( ; __need_loop_84 ; __need_loop_84 = __i_iterator.next(__context__,(__i_rename_at_84)) )
+		{
+			DAS_ASSERT(((__foo_rename_at_79((__i_rename_at_84 - 1),__context__).x < __foo_rename_at_79(__i_rename_at_84,__context__).x) || ((__foo_rename_at_79((__i_rename_at_84 - 1),__context__).x == __foo_rename_at_79(__i_rename_at_84,__context__).x) && (__foo_rename_at_79((__i_rename_at_84 - 1),__context__).y < __foo_rename_at_79(__i_rename_at_84,__context__).y))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_84));
+	};
+	TDim<struct Foo,6> __sfoo_rename_at_86; das_zero(__sfoo_rename_at_86);
+	{
+		bool __need_loop_87 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,6));
+		int32_t __i_rename_at_87;
+		__need_loop_87 = __i_iterator.first(__context__,(__i_rename_at_87)) && __need_loop_87;
+		for ( ; __need_loop_87 ; __need_loop_87 = __i_iterator.next(__context__,(__i_rename_at_87)) )
+		{
+			das_copy(__sfoo_rename_at_86(__i_rename_at_87,__context__).x,__i_rename_at_87 & 1);
+			das_copy(__sfoo_rename_at_86(__i_rename_at_87,__context__).y,__i_rename_at_87);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_87));
+	};
+	_Funcbuiltin_0x60_stable_sort_5d5252a838ad02cd(__context__,das_arg<TDim<struct Foo,6>>::pass(__sfoo_rename_at_86),das_make_block<bool,struct Foo const  &,struct Foo const  &>(__context__,336,0,&__func_info__25b18b38,[&](struct Foo const  & __a_rename_at_90, struct Foo const  & __b_rename_at_90)->bool{
+		return __a_rename_at_90.x < __b_rename_at_90.x;
+	}));
+	DAS_VERIFY(((((((__sfoo_rename_at_86(0,__context__).y == 0) && (__sfoo_rename_at_86(1,__context__).y == 2)) && (__sfoo_rename_at_86(2,__context__).y == 4)) && (__sfoo_rename_at_86(3,__context__).y == 1)) && (__sfoo_rename_at_86(4,__context__).y == 3)) && (__sfoo_rename_at_86(5,__context__).y == 5)));
+	_Funcbuiltin_0x60_stable_sort_b5da33b81ceb130a(__context__,das_arg<TArray<int32_t>>::pass(__ints_rename_at_80));
+	{
+		bool __need_loop_94 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<int32_t>>::pass(__ints_rename_at_80))));
+		int32_t __i_rename_at_94;
+		__need_loop_94 = __i_iterator.first(__context__,(__i_rename_at_94)) && __need_loop_94;
+		for ( ; __need_loop_94 ; __need_loop_94 = __i_iterator.next(__context__,(__i_rename_at_94)) )
+		{
+			DAS_ASSERT((__ints_rename_at_80((__i_rename_at_94 - 1),__context__) <= __ints_rename_at_80(__i_rename_at_94,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_94));
+	};
+	TArray<char *> __strs_rename_at_96; das_zero(__strs_rename_at_96); das_move(__strs_rename_at_96, _Funcbuiltin_0x60_to_array_move_f77c6221a73cea41(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_96_400(0,__context__) = ((char *) "b");
+		_temp_make_local_96_400(1,__context__) = ((char *) "a");
+		_temp_make_local_96_400(2,__context__) = ((char *) "c");
+		_temp_make_local_96_400(3,__context__) = ((char *) "a");
+		return _temp_make_local_96_400;
+	})()))));
+	_Funcbuiltin_0x60_stable_sort_2346a4fc9d234696(__context__,das_arg<TArray<char *>>::pass(__strs_rename_at_96));
+	DAS_ASSERT(((((SimPolicy<char *>::Equ(cast<char *>::from(__strs_rename_at_96(0,__context__)),cast<char *>::from(((char *) "a")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__strs_rename_at_96(1,__context__)),cast<char *>::from(((char *) "a")),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(__strs_rename_at_96(2,__context__)),cast<char *>::from(((char *) "b")),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(__strs_rename_at_96(3,__context__)),cast<char *>::from(((char *) "c")),*__context__))));
+	TArray<float> __fs_rename_at_99; das_zero(__fs_rename_at_99); das_move(__fs_rename_at_99, _Funcbuiltin_0x60_to_array_move_9fec2914481bd4c4(__context__,das_arg<TDim<float,3>>::pass((([&]() -> TDim<float,3>& {
+		_temp_make_local_99_464(0,__context__) = 3.f;
+		_temp_make_local_99_464(1,__context__) = 1.f;
+		_temp_make_local_99_464(2,__context__) = 2.f;
+		return _temp_make_local_99_464;
+	})()))));
+	_Funcbuiltin_0x60_stable_sort_fec300b0e65033ec(__context__,das_arg<TArray<float>>::pass(__fs_rename_at_99),das_make_block<bool,float,float>(__context__,528,0,&__func_info__63627cbe,[&](float const  __a_rename_at_100, float const  __b_rename_at_100)->bool{
+		return __a_rename_at_100 > __b_rename_at_100;
+	}));
+	DAS_ASSERT((((__fs_rename_at_99(0,__context__) == 3.f) && (__fs_rename_at_99(1,__context__) == 2.f)) && (__fs_rename_at_99(2,__context__) == 1.f)));
+}}
+
+inline void test_vector_sort_4e9f6f380b1d0080 ( Context * __context__ )
+{
+	TArray<float2> __arr_rename_at_195; das_zero(__arr_rename_at_195);
+	_Funcbuiltin_0x60_push_31f685a4ade6a664(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_195),v_make_vec4f(4.f,0.f,0.f,0.f),-1);
+	_Funcbuiltin_0x60_push_31f685a4ade6a664(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_195),v_make_vec4f(3.f,1.f,0.f,0.f),-1);
+	_Funcbuiltin_0x60_push_31f685a4ade6a664(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_195),v_make_vec4f(5.f,2.f,0.f,0.f),-1);
+	_Func_0x60_test_sort_comp_8ce798277f9e1500(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_195));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _FuncLess_360d37aacae64ca7
+		aotLib[0x261bd9273dd35849] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, struct Foo const  & , struct Foo const  &  ),&_FuncLess_360d37aacae64ca7>>();
+	};
+		// _Func_0x60_test_sort_d2f303885c572432
+		aotLib[0xeb9b54fdbcf59826] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> &  ),&_Func_0x60_test_sort_d2f303885c572432>>();
+	};
+		// _Func_0x60_test_sort_75abc0782fb70548
+		aotLib[0xed1c4e713133c39d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> &  ),&_Func_0x60_test_sort_75abc0782fb70548>>();
+	};
+		// _Func_0x60_test_sort_42ea9debe4e5192a
+		aotLib[0x6deda2f8ff39b9c0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Func_0x60_test_sort_42ea9debe4e5192a>>();
+	};
+		// _Func_0x60_test_sort_304fa7d3698611c4
+		aotLib[0x1c9bd5d464e0e79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Func_0x60_test_sort_304fa7d3698611c4>>();
+	};
+		// _Func_0x60_test_sort_f9629930f1a02904
+		aotLib[0x6fa17f13c49b7701] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> &  ),&_Func_0x60_test_sort_f9629930f1a02904>>();
+	};
+		// _Func_0x60_test_sort_82142c694b774a9e
+		aotLib[0x5a64a3ac40eebd4a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Func_0x60_test_sort_82142c694b774a9e>>();
+	};
+		// _Func_0x60_test_sort_82ff6056e854ab4a
+		aotLib[0x56c7799da22aa153] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> &  ),&_Func_0x60_test_sort_82ff6056e854ab4a>>();
+	};
+		// _Func_0x60_test_sort_350efca99f70722e
+		aotLib[0xe99cf637ee56517] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> &  ),&_Func_0x60_test_sort_350efca99f70722e>>();
+	};
+		// _Func_0x60_test_sort_d9e7b4399e747d82
+		aotLib[0xfca8856558e05e35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<struct Foo,4> &  ),&_Func_0x60_test_sort_d9e7b4399e747d82>>();
+	};
+		// _Func_0x60_test_sort_e2c2c8ed1fae32fa
+		aotLib[0x2314d632962bbf6a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<double,4> &  ),&_Func_0x60_test_sort_e2c2c8ed1fae32fa>>();
+	};
+		// _Func_0x60_test_sort_74cc3eda9233ce6
+		aotLib[0xcf9a74c57f588c44] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,4> &  ),&_Func_0x60_test_sort_74cc3eda9233ce6>>();
+	};
+		// _Func_0x60_test_sort_22d6dffef5f8e70e
+		aotLib[0x5a7b244436f6bbae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Func_0x60_test_sort_22d6dffef5f8e70e>>();
+	};
+		// _Func_0x60_test_sort_9ce9963f3b5f69b6
+		aotLib[0x854d9e6f39a16ef7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Func_0x60_test_sort_9ce9963f3b5f69b6>>();
+	};
+		// _Func_0x60_test_sort_6f87a791ceed90be
+		aotLib[0x675b837604094901] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,4> &  ),&_Func_0x60_test_sort_6f87a791ceed90be>>();
+	};
+		// _Func_0x60_test_sort_ff217a0d934c4d76
+		aotLib[0x4e775a8d8035c018] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Func_0x60_test_sort_ff217a0d934c4d76>>();
+	};
+		// _Func_0x60_test_sort_d2547c3b2df964b2
+		aotLib[0x14ae8efe540b0276] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Func_0x60_test_sort_d2547c3b2df964b2>>();
+	};
+		// _Func_0x60_test_sort_comp_8ce798277f9e1500
+		aotLib[0xbbcd974d36c2b4b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float2> &  ),&_Func_0x60_test_sort_comp_8ce798277f9e1500>>();
+	};
+		// _Func_0x60_test_sort_large_1fa64015b8b1dfe0
+		aotLib[0x4cced99ef3b7066d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> &  ),&_Func_0x60_test_sort_large_1fa64015b8b1dfe0>>();
+	};
+		// _Func_0x60_test_sort_large_e70381c15924e4af
+		aotLib[0xa83133e191ed0738] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Func_0x60_test_sort_large_e70381c15924e4af>>();
+	};
+		// _Func_0x60_test_sort_large_1518a840afedf0e0
+		aotLib[0x14840d63e48b3fb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Func_0x60_test_sort_large_1518a840afedf0e0>>();
+	};
+		// _Func_0x60_test_sort_large_efa7d161d517afc2
+		aotLib[0x40d25a72e7120891] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> &  ),&_Func_0x60_test_sort_large_efa7d161d517afc2>>();
+	};
+		// _Func_0x60_test_sort_large_d917d3afc5c4eca1
+		aotLib[0x789abc86f2952a42] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Func_0x60_test_sort_large_d917d3afc5c4eca1>>();
+	};
+		// _Func_0x60_test_sort_large_a5d8c212d150acb9
+		aotLib[0xcca15f2f038df837] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> &  ),&_Func_0x60_test_sort_large_a5d8c212d150acb9>>();
+	};
+		// _Func_0x60_test_sort_large_8a8f580b35ff4d7f
+		aotLib[0x49cd0523b5b2590f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> &  ),&_Func_0x60_test_sort_large_8a8f580b35ff4d7f>>();
+	};
+		// _Funcbuiltin_0x60_finalize_4da34799ba0520c5
+		aotLib[0xbd5f701fe616ff75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_finalize_4da34799ba0520c5>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_push_6366ae72f8b3a6bc
+		aotLib[0x71083541d4ddff91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , struct Foo const  & , int32_t  ),&_Funcbuiltin_0x60_push_6366ae72f8b3a6bc>>();
+	};
+		// _Funcbuiltin_0x60_push_67396f51c9762faa
+		aotLib[0x142a2a6fc74893fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> & , double , int32_t  ),&_Funcbuiltin_0x60_push_67396f51c9762faa>>();
+	};
+		// _Funcbuiltin_0x60_push_8a9191e5eb1aa83e
+		aotLib[0xc0f5dc1255d7c9dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float , int32_t  ),&_Funcbuiltin_0x60_push_8a9191e5eb1aa83e>>();
+	};
+		// _Funcbuiltin_0x60_push_31f685a4ade6a664
+		aotLib[0x81f141e8b5ed3405] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float2> & , float2 , int32_t  ),&_Funcbuiltin_0x60_push_31f685a4ade6a664>>();
+	};
+		// _Funcbuiltin_0x60_push_e22ac40adebb56c6
+		aotLib[0x562e251a2c9ef879] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> & , int64_t , int32_t  ),&_Funcbuiltin_0x60_push_e22ac40adebb56c6>>();
+	};
+		// _Funcbuiltin_0x60_push_dbe8c61ce24eace2
+		aotLib[0xe7e1aae867aed505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_dbe8c61ce24eace2>>();
+	};
+		// _Funcbuiltin_0x60_push_bcce321c8cba23ec
+		aotLib[0x12c80d5d532d4065] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> & , uint32_t , int32_t  ),&_Funcbuiltin_0x60_push_bcce321c8cba23ec>>();
+	};
+		// _Funcbuiltin_0x60_push_3720b69e5114725c
+		aotLib[0xe609aa0052ffaff5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> & , uint64_t , int32_t  ),&_Funcbuiltin_0x60_push_3720b69e5114725c>>();
+	};
+		// _Funcbuiltin_0x60_resize_df901583a0cdec70
+		aotLib[0xd1cfb1c711f572e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , int32_t  ),&_Funcbuiltin_0x60_resize_df901583a0cdec70>>();
+	};
+		// _Funcbuiltin_0x60_resize_6640dbff129f8443
+		aotLib[0x5f5728a8af39c939] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> & , int32_t  ),&_Funcbuiltin_0x60_resize_6640dbff129f8443>>();
+	};
+		// _Funcbuiltin_0x60_resize_d240579333227022
+		aotLib[0x40d6b5552dd22f51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , int32_t  ),&_Funcbuiltin_0x60_resize_d240579333227022>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_resize_20419c2df14c9d85
+		aotLib[0xd8c6bad9bc39fd9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_20419c2df14c9d85>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// _Funcbuiltin_0x60_resize_29914d27690eb1e4
+		aotLib[0xa8bc2d4cd78e1eb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_29914d27690eb1e4>>();
+	};
+		// _Funcbuiltin_0x60_resize_48979e8311fe5126
+		aotLib[0x9c33afc0a77b395] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_48979e8311fe5126>>();
+	};
+		// _Funcbuiltin_0x60_sort_22b27cbc39b13444
+		aotLib[0x3f8a7e7f1dde53aa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> &  ),&_Funcbuiltin_0x60_sort_22b27cbc39b13444>>();
+	};
+		// _Funcbuiltin_0x60_sort_a2a2e8ad5e51a3bd
+		aotLib[0x3a350a4f6d8305d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  &  ),&_Funcbuiltin_0x60_sort_a2a2e8ad5e51a3bd>>();
+	};
+		// _Funcbuiltin_0x60_sort_3d3eba65e92056d6
+		aotLib[0x1696881eedcf5875] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> &  ),&_Funcbuiltin_0x60_sort_3d3eba65e92056d6>>();
+	};
+		// _Funcbuiltin_0x60_sort_a68492889616b64f
+		aotLib[0x16b8a0acb3056c45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> & , Block DAS_COMMENT((bool,double,double)) const  &  ),&_Funcbuiltin_0x60_sort_a68492889616b64f>>();
+	};
+		// _Funcbuiltin_0x60_sort_375e0ed4c09ca997
+		aotLib[0xf72a6538b9b603fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_sort_375e0ed4c09ca997>>();
+	};
+		// _Funcbuiltin_0x60_sort_70cb8bf4762fdd30
+		aotLib[0x1480fb843d0a365] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , Block DAS_COMMENT((bool,float,float)) const  &  ),&_Funcbuiltin_0x60_sort_70cb8bf4762fdd30>>();
+	};
+		// _Funcbuiltin_0x60_sort_8b431b1b892aeb9c
+		aotLib[0x654802b2fe513e85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float2> & , Block DAS_COMMENT((bool,float2,float2)) const  &  ),&_Funcbuiltin_0x60_sort_8b431b1b892aeb9c>>();
+	};
+		// _Funcbuiltin_0x60_sort_f52f40276c6eddae
+		aotLib[0x2ab87c647a368105] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_sort_f52f40276c6eddae>>();
+	};
+		// _Funcbuiltin_0x60_sort_780509c039a2989f
+		aotLib[0xacd22c7eb41611a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  ),&_Funcbuiltin_0x60_sort_780509c039a2989f>>();
+	};
+		// _Funcbuiltin_0x60_sort_a87ab0a859e3c2fc
+		aotLib[0x909914218713f45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> &  ),&_Funcbuiltin_0x60_sort_a87ab0a859e3c2fc>>();
+	};
+		// _Funcbuiltin_0x60_sort_b6d865c33e8e2919
+		aotLib[0x724ada919c62d165] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> & , Block DAS_COMMENT((bool,int64_t,int64_t)) const  &  ),&_Funcbuiltin_0x60_sort_b6d865c33e8e2919>>();
+	};
+		// _Funcbuiltin_0x60_sort_d46e57cd1dcd0dda
+		aotLib[0x5c571e3acbc9b955] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_sort_d46e57cd1dcd0dda>>();
+	};
+		// _Funcbuiltin_0x60_sort_d1096e9642e456b
+		aotLib[0x8bcb8193e1507b05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , Block DAS_COMMENT((bool,char * const ,char * const )) const  &  ),&_Funcbuiltin_0x60_sort_d1096e9642e456b>>();
+	};
+		// _Funcbuiltin_0x60_sort_8e357af1649f47bd
+		aotLib[0x79d2087eb29de0a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> &  ),&_Funcbuiltin_0x60_sort_8e357af1649f47bd>>();
+	};
+		// _Funcbuiltin_0x60_sort_458df5c8781bd9a4
+		aotLib[0xdcfa911b4d83b241] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> & , Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  &  ),&_Funcbuiltin_0x60_sort_458df5c8781bd9a4>>();
+	};
+		// _Funcbuiltin_0x60_sort_ee4f65940235b53
+		aotLib[0x81316060e55c5d05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> &  ),&_Funcbuiltin_0x60_sort_ee4f65940235b53>>();
+	};
+		// _Funcbuiltin_0x60_sort_3b5033243a054d2e
+		aotLib[0x65c6006b4e576c91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> & , Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  &  ),&_Funcbuiltin_0x60_sort_3b5033243a054d2e>>();
+	};
+		// _Funcbuiltin_0x60_sort_fd5bd442b983e6ca
+		aotLib[0x4f802e97972d439e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<struct Foo,4> &  ),&_Funcbuiltin_0x60_sort_fd5bd442b983e6ca>>();
+	};
+		// _Funcbuiltin_0x60_sort_d4104aa8126e0cbb
+		aotLib[0xafa40a3699b7438d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<struct Foo,4> & , Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  &  ),&_Funcbuiltin_0x60_sort_d4104aa8126e0cbb>>();
+	};
+		// _Funcbuiltin_0x60_sort_4c2da5f6adcd396
+		aotLib[0x449e9217d2003b19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<double,4> &  ),&_Funcbuiltin_0x60_sort_4c2da5f6adcd396>>();
+	};
+		// _Funcbuiltin_0x60_sort_2c407051e634f1f9
+		aotLib[0xd3ea7100ff9e540d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<double,4> & , Block DAS_COMMENT((bool,double,double)) const  &  ),&_Funcbuiltin_0x60_sort_2c407051e634f1f9>>();
+	};
+		// _Funcbuiltin_0x60_sort_dce586ecd3989349
+		aotLib[0x3819943fb55588ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,4> &  ),&_Funcbuiltin_0x60_sort_dce586ecd3989349>>();
+	};
+		// _Funcbuiltin_0x60_sort_e7be6ee946e6ef22
+		aotLib[0x6549bf139953dd25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,4> & , Block DAS_COMMENT((bool,float,float)) const  &  ),&_Funcbuiltin_0x60_sort_e7be6ee946e6ef22>>();
+	};
+		// _Funcbuiltin_0x60_sort_1c259c4c5d3f70a4
+		aotLib[0xc032c9e931ae4169] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_sort_1c259c4c5d3f70a4>>();
+	};
+		// _Funcbuiltin_0x60_sort_872e98e3e55640f7
+		aotLib[0x521d438434830945] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> & , Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  ),&_Funcbuiltin_0x60_sort_872e98e3e55640f7>>();
+	};
+		// _Funcbuiltin_0x60_sort_b189ed1e8e0386b6
+		aotLib[0xe37778553ae69e1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Funcbuiltin_0x60_sort_b189ed1e8e0386b6>>();
+	};
+		// _Funcbuiltin_0x60_sort_a980c8ede31c7665
+		aotLib[0x75bf37580a7669bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int64_t,4> & , Block DAS_COMMENT((bool,int64_t,int64_t)) const  &  ),&_Funcbuiltin_0x60_sort_a980c8ede31c7665>>();
+	};
+		// _Funcbuiltin_0x60_sort_6ca8bf1bba8ebf60
+		aotLib[0x4b7c46dcbbd6c189] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,4> &  ),&_Funcbuiltin_0x60_sort_6ca8bf1bba8ebf60>>();
+	};
+		// _Funcbuiltin_0x60_sort_991506d6b028c811
+		aotLib[0xe42426ade99d42e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,4> & , Block DAS_COMMENT((bool,char * const ,char * const )) const  &  ),&_Funcbuiltin_0x60_sort_991506d6b028c811>>();
+	};
+		// _Funcbuiltin_0x60_sort_a5cabb2f0c020b8d
+		aotLib[0xdff65e21b09371f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Funcbuiltin_0x60_sort_a5cabb2f0c020b8d>>();
+	};
+		// _Funcbuiltin_0x60_sort_ebb06941cd0c9e4
+		aotLib[0x8eff2d02dd8ea3d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,4> & , Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  &  ),&_Funcbuiltin_0x60_sort_ebb06941cd0c9e4>>();
+	};
+		// _Funcbuiltin_0x60_sort_a4b3120f7dbe1103
+		aotLib[0x66dd08442a97bda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Funcbuiltin_0x60_sort_a4b3120f7dbe1103>>();
+	};
+		// _Funcbuiltin_0x60_sort_68d792918abece7a
+		aotLib[0xe844973a1844cc25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint64_t,4> & , Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  &  ),&_Funcbuiltin_0x60_sort_68d792918abece7a>>();
+	};
+		// _Funcbuiltin_0x60_sort_by_key_417d822841a2c0e4
+		aotLib[0x72852443ebb58542] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , Block DAS_COMMENT((float,struct Foo const )) const  &  ),&_Funcbuiltin_0x60_sort_by_key_417d822841a2c0e4>>();
+	};
+		// _Funcbuiltin_0x60_sort_by_key_839c285c1f684980
+		aotLib[0xc2339f85241f6bd6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , Block DAS_COMMENT((int32_t,struct Foo const )) const  &  ),&_Funcbuiltin_0x60_sort_by_key_839c285c1f684980>>();
+	};
+		// _Funcbuiltin_0x60_sort_by_key_cdfd71ed067b8228
+		aotLib[0xc4cef976899aba4e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<struct Foo,5> & , Block DAS_COMMENT((char *,struct Foo const )) const  &  ),&_Funcbuiltin_0x60_sort_by_key_cdfd71ed067b8228>>();
+	};
+		// _Funcbuiltin_0x60_sort_parallel_8ba3b15fac683d85
+		aotLib[0xb2ba37e7ba79f8a6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , Block DAS_COMMENT((int32_t,struct Foo const )) const  &  ),&_Funcbuiltin_0x60_sort_parallel_8ba3b15fac683d85>>();
+	};
+		// _Funcbuiltin_0x60_sort_parallel_47c5a0dd24e699c3
+		aotLib[0x4fc17a2b1e709711] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_sort_parallel_47c5a0dd24e699c3>>();
+	};
+		// _Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c
+		aotLib[0x99575c698a51b3c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_sort_parallel_70e03c566a487b9c>>();
+	};
+		// _Funcbuiltin_0x60_stable_sort_56a6f4f4a2be66e9
+		aotLib[0x76cacadc4417989] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<struct Foo> & , Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  &  ),&_Funcbuiltin_0x60_stable_sort_56a6f4f4a2be66e9>>();
+	};
+		// _Funcbuiltin_0x60_stable_sort_fec300b0e65033ec
+		aotLib[0x44a456cd12bea9b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , Block DAS_COMMENT((bool,float,float)) const  &  ),&_Funcbuiltin_0x60_stable_sort_fec300b0e65033ec>>();
+	};
+		// _Funcbuiltin_0x60_stable_sort_b5da33b81ceb130a
+		aotLib[0xb3a009edd841f1c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_stable_sort_b5da33b81ceb130a>>();
+	};
+		// _Funcbuiltin_0x60_stable_sort_5360c5d29b98e3f1
+		aotLib[0x611524b1b727dae9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  ),&_Funcbuiltin_0x60_stable_sort_5360c5d29b98e3f1>>();
+	};
+		// _Funcbuiltin_0x60_stable_sort_2346a4fc9d234696
+		aotLib[0xba455db9c1d8653d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_stable_sort_2346a4fc9d234696>>();
+	};
+		// _Funcbuiltin_0x60_stable_sort_5d5252a838ad02cd
+		aotLib[0xfe26924ee3444671] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<struct Foo,6> & , Block DAS_COMMENT((bool,struct Foo const ,struct Foo const )) const  &  ),&_Funcbuiltin_0x60_stable_sort_5d5252a838ad02cd>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_2003aa4937a0a5de
+		aotLib[0xdd062c162774fd6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<struct Foo> (*) ( Context * __context__, TDim<struct Foo,4> &  ),&_Funcbuiltin_0x60_to_array_move_2003aa4937a0a5de>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_be98d5ec8498afcd
+		aotLib[0xa428927639cb1637] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<double> (*) ( Context * __context__, TDim<double,4> &  ),&_Funcbuiltin_0x60_to_array_move_be98d5ec8498afcd>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_9fec2914481bd4c4
+		aotLib[0x58d9c8955b001204] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__, TDim<float,3> &  ),&_Funcbuiltin_0x60_to_array_move_9fec2914481bd4c4>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_439aeef6544bba80
+		aotLib[0xb2188ab8c86e53d4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__, TDim<float,4> &  ),&_Funcbuiltin_0x60_to_array_move_439aeef6544bba80>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_228cbd1e470b6291
+		aotLib[0xc37e6f73e998be11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_228cbd1e470b6291>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_bb512feadf9377fd
+		aotLib[0x17f0139356e80f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_bb512feadf9377fd>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_d6808c965184e8ff
+		aotLib[0xebbb8365124a2fb0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int64_t> (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_d6808c965184e8ff>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_f77c6221a73cea41
+		aotLib[0x7d3d0fa319b704cb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,4> &  ),&_Funcbuiltin_0x60_to_array_move_f77c6221a73cea41>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_bc1ac001df26d32f
+		aotLib[0x78abaa731749fce7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,5> &  ),&_Funcbuiltin_0x60_to_array_move_bc1ac001df26d32f>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_3ea39969ebcb8c3c
+		aotLib[0x77dce7ce6206d4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint32_t> (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_3ea39969ebcb8c3c>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_bf436f76763a926e
+		aotLib[0x5a6f12394b72c21b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint64_t> (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_bf436f76763a926e>>();
+	};
+		// random_ints_3decc040b0920eba
+		aotLib[0xeddbd362517de2c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, int32_t  ),&random_ints_3decc040b0920eba>>();
+	};
+		// test_2073c93b96ef3243
+		aotLib[0x9179e88ef06bcaea] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_2073c93b96ef3243>>();
+	};
+		// test_large_sort_a3c130b8693e5b86
+		aotLib[0x82e0555a3b8e42ac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_large_sort_a3c130b8693e5b86>>();
+	};
+		// test_non_strict_sort_47ea7ef0c60c946
+		aotLib[0x3126217c2088476] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_non_strict_sort_47ea7ef0c60c946>>();
+	};
+		// test_sort_by_key_dc88811d1879d0fd
+		aotLib[0xaa7b0e2765c9bc3e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_sort_by_key_dc88811d1879d0fd>>();
+	};
+		// test_sort_parallel_5176334f852b4f43
+		aotLib[0xaffd5afd640b5cd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&test_sort_parallel_5176334f852b4f43>>();
+	};
+		// test_stable_sort_e228516c59b09340
+		aotLib[0xeda47237c30eb76b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_stable_sort_e228516c59b09340>>();
+	};
+		// test_vector_sort_4e9f6f380b1d0080
+		aotLib[0x5dd090495baabe50] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_vector_sort_4e9f6f380b1d0080>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,256 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__f8263cbe;
+extern FuncInfo __func_info__f9941fe5;
+
+VarInfo __func_info__f9941fe5_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0xf8263cbe, "a", 0 };
+VarInfo * __func_info__f9941fe5_fields[1] =  { &__func_info__f9941fe5_field_0 };
+FuncInfo __func_info__f9941fe5 = {"invoke block<(a:array<string> const#):void> const", "", __func_info__f9941fe5_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xf9941fe5, 0x0 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline void _Func_0x60_expect0_721f005f7b5d0662 ( Context * __context__, TArray<char *> const  & __a_rename_at_4 );
+inline void _Func_0x60_expect0_d4100a53e9dde0fb ( Context * __context__, TArray<char *> const  & __a_rename_at_4 );
+inline void _Func_0x60_expect1_44671fd458709c2a ( Context * __context__, TArray<char *> const  & __a_rename_at_9 );
+inline void _Func_0x60_expect1_6ab69a85763c361d ( Context * __context__, TArray<char *> const  & __a_rename_at_9 );
+inline void _Func_0x60_expect2_bebabf62a6511023 ( Context * __context__, TArray<char *> const  & __a_rename_at_14 );
+inline void _Func_0x60_expect2_8b7b2d7cfb4ca050 ( Context * __context__, TArray<char *> const  & __a_rename_at_14 );
+inline void _Func_0x60_expect3_9e48ed90eb0baf23 ( Context * __context__, TArray<char *> const  & __a_rename_at_20 );
+inline void _Func_0x60_expect3_ec2ef7fbbbdc7014 ( Context * __context__, TArray<char *> const  & __a_rename_at_20 );
+inline void _Func_0x60_expect3o_15de4bf114dbda11 ( Context * __context__, TArray<char *> const  & __a_rename_at_27 );
+inline void _Func_0x60_expect3o_a6d82bf77154dde2 ( Context * __context__, TArray<char *> const  & __a_rename_at_27 );
+inline void _Funcstrings_boost_0x60_split_4d8b09e500e500f4 ( Context * __context__, char * const  __text_rename_at_35, char * const  __delim_rename_at_35, Block DAS_COMMENT((void,TArray<char *> const )) const  & __blk_rename_at_35 );
+inline bool test_671e063c61f81fd6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_expect0_721f005f7b5d0662 ( Context * __context__, TArray<char *> const  &  __a_rename_at_4 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_4) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_4(0,__context__)),cast<char *>::from(((char *) "")),*__context__)));
+}
+
+inline void _Func_0x60_expect0_d4100a53e9dde0fb ( Context * __context__, TArray<char *> const  &  __a_rename_at_4 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_4) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_4(0,__context__)),cast<char *>::from(((char *) "")),*__context__)));
+}
+
+inline void _Func_0x60_expect1_44671fd458709c2a ( Context * __context__, TArray<char *> const  &  __a_rename_at_9 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_9) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_9(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+}
+
+inline void _Func_0x60_expect1_6ab69a85763c361d ( Context * __context__, TArray<char *> const  &  __a_rename_at_9 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_9) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_9(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+}
+
+inline void _Func_0x60_expect2_bebabf62a6511023 ( Context * __context__, TArray<char *> const  &  __a_rename_at_14 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_14) == 2));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(1,__context__)),cast<char *>::from(((char *) "two")),*__context__)));
+}
+
+inline void _Func_0x60_expect2_8b7b2d7cfb4ca050 ( Context * __context__, TArray<char *> const  &  __a_rename_at_14 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_14) == 2));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(1,__context__)),cast<char *>::from(((char *) "two")),*__context__)));
+}
+
+inline void _Func_0x60_expect3_9e48ed90eb0baf23 ( Context * __context__, TArray<char *> const  &  __a_rename_at_20 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_20) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(1,__context__)),cast<char *>::from(((char *) "two")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(2,__context__)),cast<char *>::from(((char *) "three")),*__context__)));
+}
+
+inline void _Func_0x60_expect3_ec2ef7fbbbdc7014 ( Context * __context__, TArray<char *> const  &  __a_rename_at_20 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_20) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(1,__context__)),cast<char *>::from(((char *) "two")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(2,__context__)),cast<char *>::from(((char *) "three")),*__context__)));
+}
+
+inline void _Func_0x60_expect3o_15de4bf114dbda11 ( Context * __context__, TArray<char *> const  &  __a_rename_at_27 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_27) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(0,__context__)),cast<char *>::from(((char *) "o")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(1,__context__)),cast<char *>::from(((char *) "n")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(2,__context__)),cast<char *>::from(((char *) "e")),*__context__)));
+}
+
+inline void _Func_0x60_expect3o_a6d82bf77154dde2 ( Context * __context__, TArray<char *> const  &  __a_rename_at_27 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_27) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(0,__context__)),cast<char *>::from(((char *) "o")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(1,__context__)),cast<char *>::from(((char *) "n")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(2,__context__)),cast<char *>::from(((char *) "e")),*__context__)));
+}
+
+inline void _Funcstrings_boost_0x60_split_4d8b09e500e500f4 ( Context * __context__, char * const  __text_rename_at_35, char * const  __delim_rename_at_35, Block DAS_COMMENT((void,TArray<char *> const )) const  &  __blk_rename_at_35 )
+{
+	builtin_string_split(__text_rename_at_35,__delim_rename_at_35,__blk_rename_at_35,__context__);
+}
+
+inline bool test_671e063c61f81fd6 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,736,"test " DAS_FILE_LINE);
+{
+	TArray<char *> _temp_make_local_45_352;
+	TArray<char *> _temp_make_local_46_384;
+	TArray<char *> _temp_make_local_47_416;
+	TArray<char *> _temp_make_local_48_448;
+	TArray<char *> _temp_make_local_49_480;
+	TArray<char *> _temp_make_local_50_512;
+	_Funcstrings_boost_0x60_split_4d8b09e500e500f4(__context__,((char *) ""),((char *) ""),das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__f9941fe5,[&](TArray<char *> const  & __a_rename_at_35)->void{
+		_Func_0x60_expect0_d4100a53e9dde0fb(__context__,__a_rename_at_35);
+	}));
+	_Funcstrings_boost_0x60_split_4d8b09e500e500f4(__context__,((char *) "one"),((char *) ","),das_make_block<void,TArray<char *> const  &>(__context__,144,0,&__func_info__f9941fe5,[&](TArray<char *> const  & __a_rename_at_37)->void{
+		_Func_0x60_expect1_6ab69a85763c361d(__context__,__a_rename_at_37);
+	}));
+	_Funcstrings_boost_0x60_split_4d8b09e500e500f4(__context__,((char *) "one,two"),((char *) ","),das_make_block<void,TArray<char *> const  &>(__context__,208,0,&__func_info__f9941fe5,[&](TArray<char *> const  & __a_rename_at_39)->void{
+		_Func_0x60_expect2_8b7b2d7cfb4ca050(__context__,__a_rename_at_39);
+	}));
+	_Funcstrings_boost_0x60_split_4d8b09e500e500f4(__context__,((char *) "one, two, three"),((char *) ", "),das_make_block<void,TArray<char *> const  &>(__context__,272,0,&__func_info__f9941fe5,[&](TArray<char *> const  & __a_rename_at_41)->void{
+		_Func_0x60_expect3_ec2ef7fbbbdc7014(__context__,__a_rename_at_41);
+	}));
+	_Funcstrings_boost_0x60_split_4d8b09e500e500f4(__context__,((char *) "one"),((char *) ""),das_make_block<void,TArray<char *> const  &>(__context__,336,0,&__func_info__f9941fe5,[&](TArray<char *> const  & __a_rename_at_43)->void{
+		_Func_0x60_expect3o_a6d82bf77154dde2(__context__,__a_rename_at_43);
+	}));
+	_Func_0x60_expect0_721f005f7b5d0662(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_45_352 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) ""),((char *) ""))))));
+	_Func_0x60_expect0_721f005f7b5d0662(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_46_384 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) ""),((char *) "."))))));
+	_Func_0x60_expect1_44671fd458709c2a(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_47_416 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) "one"),((char *) ","))))));
+	_Func_0x60_expect2_bebabf62a6511023(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_48_448 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) "one,two"),((char *) ","))))));
+	_Func_0x60_expect3_9e48ed90eb0baf23(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_49_480 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) "one-->two-->three"),((char *) "-->"))))));
+	_Func_0x60_expect3o_15de4bf114dbda11(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_50_512 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) "one"),((char *) ""))))));
+	TArray<char *> __es_rename_at_53; das_zero(__es_rename_at_53); das_move(__es_rename_at_53, (TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) ""),((char *) "/")));
+	DAS_ASSERT((builtin_array_size(__es_rename_at_53) == 1));
+	TArray<char *> __ese_rename_at_55; das_zero(__ese_rename_at_55); das_move(__ese_rename_at_55, (TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) ""),((char *) "")));
+	DAS_ASSERT((builtin_array_size(__ese_rename_at_55) == 1));
+	TArray<char *> __e0_rename_at_58; das_zero(__e0_rename_at_58); das_move(__e0_rename_at_58, (TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) "/"),((char *) "/")));
+	DAS_ASSERT((builtin_array_size(__e0_rename_at_58) == 2));
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e0_rename_at_58(0,__context__)),cast<char *>::from(((char *) "")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e0_rename_at_58(1,__context__)),cast<char *>::from(((char *) "")),*__context__))));
+	TArray<char *> __e1_rename_at_62; das_zero(__e1_rename_at_62); das_move(__e1_rename_at_62, (TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) "/1"),((char *) "/")));
+	DAS_ASSERT((builtin_array_size(__e1_rename_at_62) == 2));
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e1_rename_at_62(0,__context__)),cast<char *>::from(((char *) "")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e1_rename_at_62(1,__context__)),cast<char *>::from(((char *) "1")),*__context__))));
+	TArray<char *> __e2_rename_at_66; das_zero(__e2_rename_at_66); das_move(__e2_rename_at_66, (TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) "1/"),((char *) "/")));
+	DAS_ASSERT((builtin_array_size(__e2_rename_at_66) == 2));
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e2_rename_at_66(0,__context__)),cast<char *>::from(((char *) "1")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e2_rename_at_66(1,__context__)),cast<char *>::from(((char *) "")),*__context__))));
+	TArray<char *> __e3_rename_at_70; das_zero(__e3_rename_at_70); das_move(__e3_rename_at_70, (TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) "1/2/3"),((char *) "/")));
+	DAS_ASSERT((builtin_array_size(__e3_rename_at_70) == 3));
+	DAS_ASSERT((((SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_70(0,__context__)),cast<char *>::from(((char *) "1")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_70(1,__context__)),cast<char *>::from(((char *) "2")),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_70(2,__context__)),cast<char *>::from(((char *) "3")),*__context__))));
+	return true;
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_expect0_721f005f7b5d0662
+		aotLib[0xa87d76ff6b1cbcc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect0_721f005f7b5d0662>>();
+	};
+		// _Func_0x60_expect0_d4100a53e9dde0fb
+		aotLib[0x25feafd480ea0855] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect0_d4100a53e9dde0fb>>();
+	};
+		// _Func_0x60_expect1_44671fd458709c2a
+		aotLib[0xbd169e32dfbc44d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect1_44671fd458709c2a>>();
+	};
+		// _Func_0x60_expect1_6ab69a85763c361d
+		aotLib[0xc1ca4dacd8046ae5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect1_6ab69a85763c361d>>();
+	};
+		// _Func_0x60_expect2_bebabf62a6511023
+		aotLib[0x4160834132985091] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect2_bebabf62a6511023>>();
+	};
+		// _Func_0x60_expect2_8b7b2d7cfb4ca050
+		aotLib[0x8bf02c7fbf5dae75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect2_8b7b2d7cfb4ca050>>();
+	};
+		// _Func_0x60_expect3_9e48ed90eb0baf23
+		aotLib[0xf6e1c8f61c5a6c35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3_9e48ed90eb0baf23>>();
+	};
+		// _Func_0x60_expect3_ec2ef7fbbbdc7014
+		aotLib[0xd3a553cb6a8e69f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3_ec2ef7fbbbdc7014>>();
+	};
+		// _Func_0x60_expect3o_15de4bf114dbda11
+		aotLib[0x5613920ea6912f0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3o_15de4bf114dbda11>>();
+	};
+		// _Func_0x60_expect3o_a6d82bf77154dde2
+		aotLib[0x78d9d2e00537aeb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3o_a6d82bf77154dde2>>();
+	};
+		// _Funcstrings_boost_0x60_split_4d8b09e500e500f4
+		aotLib[0xbf7dbf9f4050d26d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,TArray<char *> const )) const  &  ),&_Funcstrings_boost_0x60_split_4d8b09e500e500f4>>();
+	};
+		// test_671e063c61f81fd6
+		aotLib[0x361a53eebf0a6a66] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_671e063c61f81fd6>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
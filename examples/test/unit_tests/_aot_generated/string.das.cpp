@@ -0,0 +1,178 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__a0eb0f08;
+extern TypeInfo __type_info__a6c45d85;
+
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__a0eb0f08 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa0eb0f08 };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__a6c45d85 };
+TypeInfo * __tinfo_1[1] = { &__type_info__a0eb0f08 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+
+inline bool test_89432e36d53a99bd ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_89432e36d53a99bd ( Context * __context__ )
+{
+	TDim<float,6> _temp_make_local_80_32;
+	TDim<double,5> _temp_make_local_82_80;
+	das_try_recover(__context__, [&]()
+	{
+		das_debug(__context__,&__type_info__95e97e5e,__FILE__,__LINE__,cast<int32_t>::from(string_to_int(((char *) "11abc"),__context__)),(((char *) "=")));
+		DAS_ASSERTF((false),(((char *) "can't convert non int string without exception")));
+	}, [&]()
+	{
+	});
+	{
+		bool __need_loop_80 = true;
+		// x : float&
+		das_iterator<TDim<float,6>> __x_iterator((([&]() -> TDim<float,6>& {
+			_temp_make_local_80_32(0,__context__) = 0.1f;
+			_temp_make_local_80_32(1,__context__) = 0.33333334f;
+			_temp_make_local_80_32(2,__context__) = 3.4028235e+38f;
+			_temp_make_local_80_32(3,__context__) = 1.1754944e-38f;
+			_temp_make_local_80_32(4,__context__) = 123456.79f;
+			_temp_make_local_80_32(5,__context__) = -7e-10f;
+			return _temp_make_local_80_32;
+		})()));
+		float * __x_rename_at_80;
+		__need_loop_80 = __x_iterator.first(__context__,(__x_rename_at_80)) && __need_loop_80;
+		for ( ; __need_loop_80 ; __need_loop_80 = __x_iterator.next(__context__,(__x_rename_at_80)) )
+		{
+			DAS_ASSERT((string_to_float(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float>::from((*__x_rename_at_80)))),__context__) == (*__x_rename_at_80)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_80));
+	};
+	{
+		bool __need_loop_82 = true;
+		// x : double&
+		das_iterator<TDim<double,5>> __x_iterator((([&]() -> TDim<double,5>& {
+			_temp_make_local_82_80(0,__context__) = 0.1;
+			_temp_make_local_82_80(1,__context__) = 0.3333333333333333;
+			_temp_make_local_82_80(2,__context__) = 1.7976931348623157e+308;
+			_temp_make_local_82_80(3,__context__) = 5e-324;
+			_temp_make_local_82_80(4,__context__) = -2.5e+100;
+			return _temp_make_local_82_80;
+		})()));
+		double * __x_rename_at_82;
+		__need_loop_82 = __x_iterator.first(__context__,(__x_rename_at_82)) && __need_loop_82;
+		for ( ; __need_loop_82 ; __need_loop_82 = __x_iterator.next(__context__,(__x_rename_at_82)) )
+		{
+			DAS_ASSERT((string_to_double(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<double>::from((*__x_rename_at_82)))),__context__) == (*__x_rename_at_82)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_82));
+	};
+	char * __st_rename_at_90 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_90)->void{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_90),cast<char * const >::from(((char *) "255 hex is "))));
+		format_and_write<int32_t>(das_arg<StringBuilderWriter>::pass(__writer_rename_at_90),((char *) "%2x"),255);
+	},__context__))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__st_rename_at_90),cast<char *>::from(((char *) "255 hex is ff")),*__context__)));
+	int32_t __count_rename_at_95 = 0;
+	int32_t __index_rename_at_96 = 0;
+	{
+		bool __need_loop_97 = true;
+		// ch : int const
+		das_iterator<char * const > __ch_iterator(__st_rename_at_90);
+		int32_t __ch_rename_at_97;
+		__need_loop_97 = __ch_iterator.first(__context__,(__ch_rename_at_97)) && __need_loop_97;
+		for ( ; __need_loop_97 ; __need_loop_97 = __ch_iterator.next(__context__,(__ch_rename_at_97)) )
+		{
+			if ( __ch_rename_at_97 == 53 )
+			{
+				__count_rename_at_95++;
+			};
+			int32_t __chAt_rename_at_100 = (int32_t)get_character_at(__st_rename_at_90,__index_rename_at_96,__context__);
+			DAS_ASSERT((__ch_rename_at_97 == __chAt_rename_at_100));
+			__index_rename_at_96++;
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_97));
+	};
+	DAS_ASSERT((__count_rename_at_95 == 2));
+	char * __zzs_rename_at_105 = (char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_105)->void{
+		{
+			bool __need_loop_106 = true;
+			// zzx : int const
+			das_iterator<range> __zzx_iterator(range(0,100500));
+			int32_t __zzx_rename_at_106;
+			__need_loop_106 = __zzx_iterator.first(__context__,(__zzx_rename_at_106)) && __need_loop_106;
+			for ( ; __need_loop_106 ; __need_loop_106 = __zzx_iterator.next(__context__,(__zzx_rename_at_106)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_105),cast<int32_t>::from(__zzx_rename_at_106)));
+			}
+			__zzx_iterator.close(__context__,(__zzx_rename_at_106));
+		};
+	},__context__))));
+	delete_string(__zzs_rename_at_105,__context__);
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_89432e36d53a99bd
+		aotLib[0x96245150293c5c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_89432e36d53a99bd>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
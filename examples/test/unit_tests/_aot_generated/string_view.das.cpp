@@ -0,0 +1,381 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__c3001b36;
+extern TypeInfo __type_info__94181030;
+extern TypeInfo __type_info__ddd4849a;
+extern TypeInfo __type_info__349d3c80;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__d445a339;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__199df2db;
+extern TypeInfo __type_info__c755e698;
+extern TypeInfo __type_info__dc4d1926;
+extern VarInfo __var_info__186a885b;
+extern VarInfo __var_info__534310c1;
+extern VarInfo __var_info__35e912f2;
+extern FuncInfo __func_info__63f35a93;
+extern FuncInfo __func_info__296441b4;
+
+VarInfo __struct_info__c3001b36_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::string_view"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x186a885b, "view", 0 };
+VarInfo * __struct_info__c3001b36_fields[1] =  { &__struct_info__c3001b36_field_0 };
+StructInfo __struct_info__c3001b36 = {"ViewHolder", __struct_info__c3001b36_fields, 1, 16, -1, nullptr, 0xc3001b36 };
+VarInfo __func_info__63f35a93_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x35e912f2, "data", 0 };
+VarInfo * __func_info__63f35a93_fields[1] =  { &__func_info__63f35a93_field_0 };
+FuncInfo __func_info__63f35a93 = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__63f35a93_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x63f35a93, 0x0 };
+VarInfo __func_info__296441b4_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__349d3c80, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0x534310c1, "parts", 0 };
+VarInfo * __func_info__296441b4_fields[1] =  { &__func_info__296441b4_field_0 };
+FuncInfo __func_info__296441b4 = {"invoke block<(parts:array<strings::string_view> const#):void> const", "", __func_info__296441b4_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x296441b4, 0x0 };
+TypeInfo __type_info__94181030 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x94181030 };
+TypeInfo __type_info__ddd4849a = { Type::tStructure, &__struct_info__c3001b36, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0xddd4849a };
+TypeInfo __type_info__349d3c80 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::string_view"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x349d3c80 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo * __type_info__d445a339_arg_types[1] = { &__type_info__94181030 };
+TypeInfo __type_info__d445a339 = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d445a339_arg_types, nullptr, 1, 0, nullptr, 34, 0xd445a339 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__199df2db = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x199df2db };
+TypeInfo __type_info__c755e698 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::string_view"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xc755e698 };
+TypeInfo __type_info__dc4d1926 = { Type::tStructure, &__struct_info__c3001b36, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xdc4d1926 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__dc4d1926, &__type_info__94181030 };
+TypeInfo * __tinfo_1[2] = { &__type_info__ddd4849a, &__type_info__d445a339 };
+TypeInfo * __tinfo_2[1] = { &__type_info__c755e698 };
+TypeInfo * __tinfo_3[4] = { &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730 };
+namespace  {
+
+struct ViewHolder {
+	das::StringView view;
+};
+static_assert(sizeof(ViewHolder)==16,"structure size mismatch with DAS");
+static_assert(offsetof(ViewHolder,view)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_binary_load_cd5a46a0318b380 ( Context * __context__, struct ViewHolder & __obj_rename_at_216, TArray<uint8_t> const  & __data_rename_at_216 );
+inline void _Funcbuiltin_0x60_binary_save_3bfda15fef199ad5 ( Context * __context__, struct ViewHolder const  & __obj_rename_at_212, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_212 );
+inline void _Funcbuiltin_0x60_clone_a3fafa474e5144e8 ( Context * __context__, TArray<das::StringView> & __a_rename_at_232, TArray<das::StringView> const  & __b_rename_at_232 );
+inline void _Funcbuiltin_0x60_finalize_f14aa95488199302 ( Context * __context__, TArray<das::StringView> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_resize_a75acdf52d35d0c3 ( Context * __context__, TArray<das::StringView> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void check_basics_51c682d3625769f6 ( Context * __context__ );
+inline void check_numbers_b6b1d6345a7e42aa ( Context * __context__ );
+inline void check_save_f7c47c14e1955824 ( Context * __context__ );
+inline void check_split_b31f521e5606f733 ( Context * __context__ );
+inline void _Funcstrings_boost_0x60_split_by_chars_view_f4b3ee030d3e7cd4 ( Context * __context__, char * const  __text_rename_at_69, char * const  __delim_rename_at_69, Block DAS_COMMENT((void,TArray<das::StringView> const )) const  & __blk_rename_at_69 );
+inline void _Funcstrings_boost_0x60_split_view_b02e5bf9510e1463 ( Context * __context__, char * const  __text_rename_at_58, char * const  __delim_rename_at_58, Block DAS_COMMENT((void,TArray<das::StringView> const )) const  & __blk_rename_at_58 );
+inline bool test_dc368e2981a67fee ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_binary_load_cd5a46a0318b380 ( Context * __context__, struct ViewHolder &  __obj_rename_at_216, TArray<uint8_t> const  &  __data_rename_at_216 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<struct ViewHolder &>::from(__obj_rename_at_216),cast<TArray<uint8_t> const  &>::from(__data_rename_at_216)));
+}
+
+inline void _Funcbuiltin_0x60_binary_save_3bfda15fef199ad5 ( Context * __context__, struct ViewHolder const  &  __obj_rename_at_212, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_212 )
+{
+	das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<struct ViewHolder const  &>::from(__obj_rename_at_212),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_212)));
+}
+
+inline void _Funcbuiltin_0x60_clone_a3fafa474e5144e8 ( Context * __context__, TArray<das::StringView> &  __a_rename_at_232, TArray<das::StringView> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_a75acdf52d35d0c3(__context__,das_arg<TArray<das::StringView>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : strings::string_view aka TT&
+		das_iterator<TArray<das::StringView>> __aV_iterator(__a_rename_at_232);
+		das::StringView * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : strings::string_view const&
+		das_iterator<TArray<das::StringView> const > __bV_iterator(__b_rename_at_232);
+		das::StringView const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			das_clone((*__aV_rename_at_234),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline void _Funcbuiltin_0x60_finalize_f14aa95488199302 ( Context * __context__, TArray<das::StringView> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<das::StringView>>::pass(__a_rename_at_285),16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_a75acdf52d35d0c3 ( Context * __context__, TArray<das::StringView> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<das::StringView>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,16,__context__);
+}
+
+inline void check_basics_51c682d3625769f6 ( Context * __context__ )
+{
+	das::StringView __v_rename_at_6; das_zero(__v_rename_at_6);
+	das_copy(__v_rename_at_6,builtin_string_view(((char *) "  hello, world!  "),__context__));
+	DAS_ASSERT(((builtin_string_view_length(__v_rename_at_6) == 17) && !(builtin_string_view_empty(__v_rename_at_6))));
+	das::StringView __t_rename_at_10 = (das::StringView)builtin_string_view_strip(__v_rename_at_6);
+	DAS_ASSERT((builtin_string_view_equ_str(__t_rename_at_10,((char *) "hello, world!"))));
+	DAS_ASSERT((builtin_string_view_equ_str(builtin_string_view_strip_left(__v_rename_at_6),((char *) "hello, world!  "))));
+	DAS_ASSERT((builtin_string_view_equ_str(builtin_string_view_strip_right(__v_rename_at_6),((char *) "  hello, world!"))));
+	DAS_ASSERT((builtin_string_view_equ_str(builtin_string_view_slice2(__t_rename_at_10,7),((char *) "world!"))));
+	DAS_ASSERT((builtin_string_view_equ_str(builtin_string_view_slice1(__t_rename_at_10,0,5),((char *) "hello"))));
+	DAS_ASSERT((builtin_string_view_equ_str(builtin_string_view_slice1(__t_rename_at_10,-6,-1),((char *) "world"))));
+	DAS_ASSERT((builtin_string_view_empty(builtin_string_view_slice1(__t_rename_at_10,5,5))));
+	DAS_ASSERT((builtin_string_view_find2(__t_rename_at_10,((char *) "world"),__context__) == 7));
+	DAS_ASSERT((builtin_string_view_find1(__t_rename_at_10,((char *) "o"),5,__context__) == 8));
+	DAS_ASSERT((builtin_string_view_find2(__t_rename_at_10,((char *) "??"),__context__) == -1));
+	DAS_ASSERT((builtin_string_view_starts_with(__t_rename_at_10,((char *) "hello"),__context__) && builtin_string_view_ends_with(__t_rename_at_10,((char *) "world!"),__context__)));
+	DAS_ASSERT((builtin_string_view_character_at(__t_rename_at_10,1,__context__) == 101));
+	DAS_ASSERT((builtin_string_view_equ(builtin_string_view_slice1(__t_rename_at_10,0,5),builtin_string_view(((char *) "hello"),__context__))));
+	DAS_ASSERT((builtin_string_view_nequ(builtin_string_view_slice1(__t_rename_at_10,0,5),builtin_string_view_slice1(__t_rename_at_10,7,12))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(((char *)(builtin_string_view_to_string(builtin_string_view_slice2(__t_rename_at_10,7),__context__)))),cast<char *>::from(((char *) "world!")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<das::StringView const >::from(__t_rename_at_10)))),cast<char *>::from(((char *) "hello, world!")),*__context__)));
+	char * __built_rename_at_28 = (char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_28)->void{
+		builtin_write_string_view(das_arg<StringBuilderWriter>::pass(__writer_rename_at_28),builtin_string_view_slice1(__t_rename_at_10,0,5));
+	},__context__))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__built_rename_at_28),cast<char *>::from(((char *) "hello")),*__context__)));
+}
+
+inline void check_numbers_b6b1d6345a7e42aa ( Context * __context__ ) { das_stack_prologue __prologue(__context__,304,"check_numbers " DAS_FILE_LINE);
+{
+	_Funcstrings_boost_0x60_split_view_b02e5bf9510e1463(__context__,((char *) "12,-7,3.5"),((char *) ","),das_make_block<void,TArray<das::StringView> const  &>(__context__,80,0,&__func_info__296441b4,[&](TArray<das::StringView> const  & __parts_rename_at_34)->void{
+		DAS_ASSERT((builtin_array_size(__parts_rename_at_34) == 3));
+		DAS_ASSERT((builtin_string_view_to_int(__parts_rename_at_34(0,__context__),__context__) == 12));
+		DAS_ASSERT((builtin_string_view_to_int(__parts_rename_at_34(1,__context__),__context__) == -7));
+		DAS_ASSERT((builtin_string_view_to_float(__parts_rename_at_34(2,__context__),__context__) == 3.5f));
+	}));
+	_Funcstrings_boost_0x60_split_view_b02e5bf9510e1463(__context__,((char *) "12a,,7"),((char *) ","),das_make_block<void,TArray<das::StringView> const  &>(__context__,144,0,&__func_info__296441b4,[&](TArray<das::StringView> const  & __parts_rename_at_40)->void{
+		int32_t __parsed_rename_at_41 = 0;
+		{
+			bool __need_loop_42 = true;
+			// p : strings::string_view const&#
+			das_iterator<TArray<das::StringView> const > __p_iterator(__parts_rename_at_40);
+			das::StringView const  * __p_rename_at_42;
+			__need_loop_42 = __p_iterator.first(__context__,(__p_rename_at_42)) && __need_loop_42;
+			for ( ; __need_loop_42 ; __need_loop_42 = __p_iterator.next(__context__,(__p_rename_at_42)) )
+			{
+				bool __failed_rename_at_43 = false;
+				das_try_recover(__context__, [&]()
+				{
+					__parsed_rename_at_41 += builtin_string_view_to_int((*__p_rename_at_42),__context__);
+				}, [&]()
+				{
+					das_copy(__failed_rename_at_43,true);
+				});
+				DAS_ASSERT((__failed_rename_at_43 == (builtin_string_view_nequ_str((*__p_rename_at_42),((char *) "7")))));
+			}
+			__p_iterator.close(__context__,(__p_rename_at_42));
+		};
+		DAS_ASSERT((__parsed_rename_at_41 == 7));
+	}));
+	char * __zeros_rename_at_51 = (char *)(((char *) ""));
+	{
+		bool __need_loop_52 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,80));
+		int32_t __i_rename_at_52;
+		__need_loop_52 = __i_iterator.first(__context__,(__i_rename_at_52)) && __need_loop_52;
+		for ( ; __need_loop_52 ; __need_loop_52 = __i_iterator.next(__context__,(__i_rename_at_52)) )
+		{
+			SimPolicy<char *>::SetAdd((char *)&(__zeros_rename_at_51),cast<char *>::from(((char *) "0")),*__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_52));
+	};
+	_Funcstrings_boost_0x60_split_view_b02e5bf9510e1463(__context__,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_3, cast<char *>::from(__zeros_rename_at_51), cast<char * const >::from(((char *) "7,1")), cast<char *>::from(__zeros_rename_at_51), cast<char * const >::from(((char *) ".5")))),((char *) ","),das_make_block<void,TArray<das::StringView> const  &>(__context__,288,0,&__func_info__296441b4,[&](TArray<das::StringView> const  & __parts_rename_at_54)->void{
+		DAS_ASSERT((builtin_string_view_to_int(__parts_rename_at_54(0,__context__),__context__) == 7));
+		DAS_ASSERT((builtin_string_view_to_float(__parts_rename_at_54(1,__context__),__context__) > 1e+30f));
+	}));
+}}
+
+inline void check_save_f7c47c14e1955824 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,144,"check_save " DAS_FILE_LINE);
+{
+	struct ViewHolder __a_rename_at_95; das_zero(__a_rename_at_95);
+	das_copy(__a_rename_at_95.view,builtin_string_view(((char *) "text"),__context__));
+	bool __failed_rename_at_98 = false;
+	das_try_recover(__context__, [&]()
+	{
+		_Funcbuiltin_0x60_binary_save_3bfda15fef199ad5(__context__,das_arg<struct ViewHolder>::pass(__a_rename_at_95),das_make_block<void,TArray<uint8_t> const  &>(__context__,112,0,&__func_info__63f35a93,[&](TArray<uint8_t> const  & __data_rename_at_100)->void{
+			struct ViewHolder __b_rename_at_101; das_zero(__b_rename_at_101);
+			_Funcbuiltin_0x60_binary_load_cd5a46a0318b380(__context__,das_arg<struct ViewHolder>::pass(__b_rename_at_101),__data_rename_at_100);
+		}));
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_98,true);
+	});
+	DAS_ASSERT((__failed_rename_at_98));
+}}
+
+inline void check_split_b31f521e5606f733 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,272,"check_split " DAS_FILE_LINE);
+{
+	TArray<das::StringView> _temp_make_local_62_64;
+	TArray<das::StringView> __views_rename_at_60; das_zero(__views_rename_at_60);
+	das_move(__views_rename_at_60,(_temp_make_local_62_64 = (das_invoke_function<TArray<das::StringView>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_view string#const string#const*/ 2854661357u)),((char *) "a,b,,c,"),((char *) ",")))));
+	TArray<char *> __copies_rename_at_63; das_zero(__copies_rename_at_63); das_move(__copies_rename_at_63, das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) "a,b,,c,"),((char *) ",")));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<das::StringView>>::pass(__views_rename_at_60)) == builtin_array_size(das_arg<TArray<char *>>::pass(__copies_rename_at_63))));
+	{
+		bool __need_loop_65 = true;
+		// v : strings::string_view&
+		das_iterator<TArray<das::StringView>> __v_iterator(__views_rename_at_60);
+		das::StringView * __v_rename_at_65;
+		__need_loop_65 = __v_iterator.first(__context__,(__v_rename_at_65)) && __need_loop_65;
+		// c : string&
+		das_iterator<TArray<char *>> __c_iterator(__copies_rename_at_63);
+		char * * __c_rename_at_65;
+		__need_loop_65 = __c_iterator.first(__context__,(__c_rename_at_65)) && __need_loop_65;
+		for ( ; __need_loop_65 ; __need_loop_65 = __v_iterator.next(__context__,(__v_rename_at_65)) && __c_iterator.next(__context__,(__c_rename_at_65)) )
+		{
+			DAS_ASSERT((builtin_string_view_equ_str((*__v_rename_at_65),(*__c_rename_at_65))));
+		}
+		__v_iterator.close(__context__,(__v_rename_at_65));
+		__c_iterator.close(__context__,(__c_rename_at_65));
+	};
+	TArray<das::StringView> __cloned_rename_at_68; das_zero(__cloned_rename_at_68);
+	_Funcbuiltin_0x60_clone_a3fafa474e5144e8(__context__,das_arg<TArray<das::StringView>>::pass(__cloned_rename_at_68),das_arg<TArray<das::StringView>>::pass(__views_rename_at_60));
+	DAS_ASSERT((((builtin_array_size(das_arg<TArray<das::StringView>>::pass(__cloned_rename_at_68)) == builtin_array_size(das_arg<TArray<das::StringView>>::pass(__views_rename_at_60))) && (builtin_string_view_equ_str(__cloned_rename_at_68(0,__context__),((char *) "a")))) && (builtin_string_view_equ_str(__cloned_rename_at_68(2,__context__),((char *) "c")))));
+	das::StringView __one_rename_at_71; das_zero(__one_rename_at_71);
+	das_clone(__one_rename_at_71,__views_rename_at_60(0,__context__));
+	DAS_ASSERT((builtin_string_view_equ_str(__one_rename_at_71,((char *) "a"))));
+	das_clone(__one_rename_at_71,builtin_string_view_slice2(__views_rename_at_60(2,__context__),0));
+	DAS_ASSERT((builtin_string_view_equ_str(__one_rename_at_71,((char *) "c"))));
+	_Funcbuiltin_0x60_finalize_f14aa95488199302(__context__,das_arg<TArray<das::StringView>>::pass(__cloned_rename_at_68));
+	_Funcstrings_boost_0x60_split_by_chars_view_f4b3ee030d3e7cd4(__context__,((char *) "a b;c"),((char *) " ;"),das_make_block<void,TArray<das::StringView> const  &>(__context__,256,0,&__func_info__296441b4,[&](TArray<das::StringView> const  & __parts_rename_at_78)->void{
+		DAS_ASSERT((builtin_array_size(__parts_rename_at_78) == 3));
+		DAS_ASSERT((((builtin_string_view_equ_str(__parts_rename_at_78(0,__context__),((char *) "a"))) && (builtin_string_view_equ_str(__parts_rename_at_78(1,__context__),((char *) "b")))) && (builtin_string_view_equ_str(__parts_rename_at_78(2,__context__),((char *) "c")))));
+	}));
+	_Funcbuiltin_0x60_finalize_f14aa95488199302(__context__,das_arg<TArray<das::StringView>>::pass(__views_rename_at_60));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__copies_rename_at_63));
+}}
+
+inline void _Funcstrings_boost_0x60_split_by_chars_view_f4b3ee030d3e7cd4 ( Context * __context__, char * const  __text_rename_at_69, char * const  __delim_rename_at_69, Block DAS_COMMENT((void,TArray<das::StringView> const )) const  &  __blk_rename_at_69 )
+{
+	builtin_string_split_by_char_view(__text_rename_at_69,__delim_rename_at_69,__blk_rename_at_69,__context__);
+}
+
+inline void _Funcstrings_boost_0x60_split_view_b02e5bf9510e1463 ( Context * __context__, char * const  __text_rename_at_58, char * const  __delim_rename_at_58, Block DAS_COMMENT((void,TArray<das::StringView> const )) const  &  __blk_rename_at_58 )
+{
+	builtin_string_split_view(__text_rename_at_58,__delim_rename_at_58,__blk_rename_at_58,__context__);
+}
+
+inline bool test_dc368e2981a67fee ( Context * __context__ )
+{
+	check_basics_51c682d3625769f6(__context__);
+	check_numbers_b6b1d6345a7e42aa(__context__);
+	check_split_b31f521e5606f733(__context__);
+	check_save_f7c47c14e1955824(__context__);
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_binary_load_cd5a46a0318b380
+		aotLib[0xc1eb0c6584290aed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ViewHolder & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_cd5a46a0318b380>>();
+	};
+		// _Funcbuiltin_0x60_binary_save_3bfda15fef199ad5
+		aotLib[0x830593c2ea19d691] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct ViewHolder const  & , Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  ),&_Funcbuiltin_0x60_binary_save_3bfda15fef199ad5>>();
+	};
+		// _Funcbuiltin_0x60_clone_a3fafa474e5144e8
+		aotLib[0x6977b1ffcb251a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<das::StringView> & , TArray<das::StringView> const  &  ),&_Funcbuiltin_0x60_clone_a3fafa474e5144e8>>();
+	};
+		// _Funcbuiltin_0x60_finalize_f14aa95488199302
+		aotLib[0x1a2f622498ea3425] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<das::StringView> &  ),&_Funcbuiltin_0x60_finalize_f14aa95488199302>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_resize_a75acdf52d35d0c3
+		aotLib[0x89f7133f69cf6e45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<das::StringView> & , int32_t  ),&_Funcbuiltin_0x60_resize_a75acdf52d35d0c3>>();
+	};
+		// check_basics_51c682d3625769f6
+		aotLib[0xdeaef864af2a1985] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_basics_51c682d3625769f6>>();
+	};
+		// check_numbers_b6b1d6345a7e42aa
+		aotLib[0x48704a53d08ef9fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_numbers_b6b1d6345a7e42aa>>();
+	};
+		// check_save_f7c47c14e1955824
+		aotLib[0x6a3b4208fa56afc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_save_f7c47c14e1955824>>();
+	};
+		// check_split_b31f521e5606f733
+		aotLib[0xb9d70f05ebbcc626] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_split_b31f521e5606f733>>();
+	};
+		// _Funcstrings_boost_0x60_split_by_chars_view_f4b3ee030d3e7cd4
+		aotLib[0xa1b742adc7299c19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,TArray<das::StringView> const )) const  &  ),&_Funcstrings_boost_0x60_split_by_chars_view_f4b3ee030d3e7cd4>>();
+	};
+		// _Funcstrings_boost_0x60_split_view_b02e5bf9510e1463
+		aotLib[0x8a4d42a0ecb22655] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,TArray<das::StringView> const )) const  &  ),&_Funcstrings_boost_0x60_split_view_b02e5bf9510e1463>>();
+	};
+		// test_dc368e2981a67fee
+		aotLib[0xb01f839d61a76e58] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_dc368e2981a67fee>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,450 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__be47f981;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__6f442294;
+extern TypeInfo __type_info__f74f409d;
+extern TypeInfo __type_info__ad360a11;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__f1b9498d;
+extern TypeInfo __type_info__ac987970;
+extern TypeInfo __type_info__223f839;
+extern TypeInfo __type_info__d6b95de0;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__a6c45d85;
+extern TypeInfo __type_info__a42fd5a4;
+extern TypeInfo __type_info__f4df93a6;
+extern TypeInfo __type_info__767d194e;
+extern TypeInfo __type_info__90f90a65;
+extern VarInfo __var_info__c3d90be;
+extern FuncInfo __func_info__744db4a4;
+
+VarInfo __func_info__744db4a4_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__be47f981, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0xc3d90be, "res", 0 };
+VarInfo * __func_info__744db4a4_fields[1] =  { &__func_info__744db4a4_field_0 };
+FuncInfo __func_info__744db4a4 = {"invoke block<(res:array<float const?> const#):void> const", "", __func_info__744db4a4_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x744db4a4, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__be47f981 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__223f839, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xbe47f981 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__6f442294 = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__17c16538, &__type_info__95e97e5e, nullptr, nullptr, 0, 0, nullptr, 34, 0x6f442294 };
+TypeInfo __type_info__f74f409d = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__95e97e5e, &__type_info__a6c45d85, nullptr, nullptr, 0, 0, nullptr, 34, 0xf74f409d };
+TypeInfo __type_info__ad360a11 = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__95e97e5e, &__type_info__a6c45d85, nullptr, nullptr, 0, 0, nullptr, 2, 0xad360a11 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__f1b9498d = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xf1b9498d };
+TypeInfo __type_info__ac987970 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xac987970 };
+TypeInfo __type_info__223f839 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x223f839 };
+TypeInfo __type_info__d6b95de0 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__be47f981, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd6b95de0 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xc894953d };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0xa6c45d85 };
+TypeInfo __type_info__a42fd5a4 = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__17c16538, &__type_info__95e97e5e, nullptr, nullptr, 0, 0, nullptr, 2, 0xa42fd5a4 };
+TypeInfo __type_info__f4df93a6 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__a6c45d85, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xf4df93a6 };
+TypeInfo __type_info__767d194e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__be47f981, nullptr, nullptr, nullptr, 0, 0, nullptr, 258, 0x767d194e };
+TypeInfo __type_info__90f90a65 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x90f90a65 };
+
+TypeInfo * __tinfo_0[3] = { &__type_info__f74f409d, &__type_info__f1b9498d, &__type_info__d6b95de0 };
+TypeInfo * __tinfo_1[3] = { &__type_info__f74f409d, &__type_info__f1b9498d, &__type_info__767d194e };
+TypeInfo * __tinfo_2[3] = { &__type_info__ad360a11, &__type_info__f1b9498d, &__type_info__f4df93a6 };
+TypeInfo * __tinfo_3[3] = { &__type_info__a42fd5a4, &__type_info__90f90a65, &__type_info__f1b9498d };
+TypeInfo * __tinfo_4[3] = { &__type_info__f74f409d, &__type_info__f1b9498d, &__type_info__ac987970 };
+TypeInfo * __tinfo_5[3] = { &__type_info__6f442294, &__type_info__90f90a65, &__type_info__ac987970 };
+TypeInfo * __tinfo_6[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+
+inline void _Funcbuiltin_0x60_finalize_ac5573b4999f85e5 ( Context * __context__, TArray<float const  *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_332d1b0381aed2e2 ( Context * __context__, TArray<bool> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_984fb7364985bb19 ( Context * __context__, TTable<int32_t,float> & __a_rename_at_292 );
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_292 );
+inline void _Funcbuiltin_0x60_find_batch_e06ae1b51987e8b6 ( Context * __context__, TTable<int32_t,float> const  & __Tab_rename_at_201, TArray<int32_t> const  & __Keys_rename_at_201, TArray<float const  *> & __Result_rename_at_201 );
+inline void _Funcbuiltin_0x60_find_batch_8cd0da1e1a90a5d1 ( Context * __context__, TTable<int32_t,float> const  & __Tab_rename_at_191, TArray<int32_t> const  & __Keys_rename_at_191, Block DAS_COMMENT((void,TArray<float const  *> const )) const  & __blk_rename_at_191 );
+inline void _Funcbuiltin_0x60_insert_batch_4bcd9a9fa2a323a0 ( Context * __context__, TTable<int32_t,float> & __Tab_rename_at_204, TArray<int32_t> const  & __Keys_rename_at_204, TArray<float> const  & __Values_rename_at_204 );
+inline void _Funcbuiltin_0x60_insert_batch_1705800617ded15c ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_204, TArray<char *> const  & __Keys_rename_at_204, TArray<int32_t> const  & __Values_rename_at_204 );
+inline void _Funcbuiltin_0x60_key_exists_batch_c3ec66331184522d ( Context * __context__, TTable<int32_t,float> const  & __Tab_rename_at_187, TArray<int32_t> const  & __Keys_rename_at_187, TArray<bool> & __Result_rename_at_187 );
+inline void _Funcbuiltin_0x60_key_exists_batch_95e9771174a47f7c ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_187, TArray<char *> const  & __Keys_rename_at_187, TArray<bool> & __Result_rename_at_187 );
+inline void _Funcbuiltin_0x60_push_8a9191e5eb1aa83e ( Context * __context__, TArray<float> & __Arr_rename_at_40, float __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> & __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627 ( Context * __context__, TDim<char *,3> & __a_rename_at_398 );
+inline void check_int_keys_3f5d349e1e7bc2e1 ( Context * __context__ );
+inline void check_string_keys_476f8a3e83b66abb ( Context * __context__ );
+inline bool test_9e6eba85ecaeca8e ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_ac5573b4999f85e5 ( Context * __context__, TArray<float const  *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<float const  *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_332d1b0381aed2e2 ( Context * __context__, TArray<bool> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<bool>>::pass(__a_rename_at_285),1,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<float>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_285),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_984fb7364985bb19 ( Context * __context__, TTable<int32_t,float> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,float>>::pass(__a_rename_at_292),4,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_292),8,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_find_batch_e06ae1b51987e8b6 ( Context * __context__, TTable<int32_t,float> const  &  __Tab_rename_at_201, TArray<int32_t> const  &  __Keys_rename_at_201, TArray<float const  *> &  __Result_rename_at_201 )
+{
+	das_call_interop<void>::call(&_builtin_table_find_batch,__context__,SimNode_AotInterop<3>(__tinfo_0,cast<TTable<int32_t,float> const  &>::from(__Tab_rename_at_201),cast<TArray<int32_t> const  &>::from(__Keys_rename_at_201),cast<TArray<float const  *> &>::from(__Result_rename_at_201)));
+}
+
+inline void _Funcbuiltin_0x60_find_batch_8cd0da1e1a90a5d1 ( Context * __context__, TTable<int32_t,float> const  &  __Tab_rename_at_191, TArray<int32_t> const  &  __Keys_rename_at_191, Block DAS_COMMENT((void,TArray<float const  *> const )) const  &  __blk_rename_at_191 )
+{
+	TArray<float const  *> __res_rename_at_192; das_zero(__res_rename_at_192);
+	das_call_interop<void>::call(&_builtin_table_find_batch,__context__,SimNode_AotInterop<3>(__tinfo_1,cast<TTable<int32_t,float> const  &>::from(__Tab_rename_at_191),cast<TArray<int32_t> const  &>::from(__Keys_rename_at_191),cast<TArray<float const  *> &>::from(__res_rename_at_192)));
+	builtin_table_lock(__Tab_rename_at_191,__context__);
+	das_invoke<void>::invoke<TArray<float const  *> &>(__context__,__blk_rename_at_191,das_arg<TArray<float const  *>>::pass(das_cast<TArray<float const  *>>::cast(__res_rename_at_192)));
+	builtin_table_unlock(__Tab_rename_at_191,__context__);
+	_Funcbuiltin_0x60_finalize_ac5573b4999f85e5(__context__,das_arg<TArray<float const  *>>::pass(__res_rename_at_192));
+}
+
+inline void _Funcbuiltin_0x60_insert_batch_4bcd9a9fa2a323a0 ( Context * __context__, TTable<int32_t,float> &  __Tab_rename_at_204, TArray<int32_t> const  &  __Keys_rename_at_204, TArray<float> const  &  __Values_rename_at_204 )
+{
+	das_call_interop<void>::call(&_builtin_table_insert_batch,__context__,SimNode_AotInterop<3>(__tinfo_2,cast<TTable<int32_t,float> &>::from(__Tab_rename_at_204),cast<TArray<int32_t> const  &>::from(__Keys_rename_at_204),cast<TArray<float> const  &>::from(__Values_rename_at_204)));
+}
+
+inline void _Funcbuiltin_0x60_insert_batch_1705800617ded15c ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_204, TArray<char *> const  &  __Keys_rename_at_204, TArray<int32_t> const  &  __Values_rename_at_204 )
+{
+	das_call_interop<void>::call(&_builtin_table_insert_batch,__context__,SimNode_AotInterop<3>(__tinfo_3,cast<TTable<char *,int32_t> &>::from(__Tab_rename_at_204),cast<TArray<char *> const  &>::from(__Keys_rename_at_204),cast<TArray<int32_t> const  &>::from(__Values_rename_at_204)));
+}
+
+inline void _Funcbuiltin_0x60_key_exists_batch_c3ec66331184522d ( Context * __context__, TTable<int32_t,float> const  &  __Tab_rename_at_187, TArray<int32_t> const  &  __Keys_rename_at_187, TArray<bool> &  __Result_rename_at_187 )
+{
+	das_call_interop<void>::call(&_builtin_table_key_exists_batch,__context__,SimNode_AotInterop<3>(__tinfo_4,cast<TTable<int32_t,float> const  &>::from(__Tab_rename_at_187),cast<TArray<int32_t> const  &>::from(__Keys_rename_at_187),cast<TArray<bool> &>::from(__Result_rename_at_187)));
+}
+
+inline void _Funcbuiltin_0x60_key_exists_batch_95e9771174a47f7c ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_187, TArray<char *> const  &  __Keys_rename_at_187, TArray<bool> &  __Result_rename_at_187 )
+{
+	das_call_interop<void>::call(&_builtin_table_key_exists_batch,__context__,SimNode_AotInterop<3>(__tinfo_5,cast<TTable<char *,int32_t> const  &>::from(__Tab_rename_at_187),cast<TArray<char *> const  &>::from(__Keys_rename_at_187),cast<TArray<bool> &>::from(__Result_rename_at_187)));
+}
+
+inline void _Funcbuiltin_0x60_push_8a9191e5eb1aa83e ( Context * __context__, TArray<float> &  __Arr_rename_at_40, float __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<float>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_push_dbe8c61ce24eace2 ( Context * __context__, TArray<char *> &  __Arr_rename_at_40, char * const  __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<char *>>::pass(__Arr_rename_at_40),__at_rename_at_40,8,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627 ( Context * __context__, TDim<char *,3> &  __a_rename_at_398 )
+{
+	TArray<char *> __arr_rename_at_399; das_zero(__arr_rename_at_399);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_399),3);
+	das_copy(das_cast<TDim<char *,3>>::cast(das_ref(__context__,__arr_rename_at_399(0,__context__))),__a_rename_at_398);
+	return /* <- */ __arr_rename_at_399;
+}
+
+inline void check_int_keys_3f5d349e1e7bc2e1 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,384,"check_int_keys " DAS_FILE_LINE);
+{
+	TTable<int32_t,float> __tab_rename_at_2; das_zero(__tab_rename_at_2);
+	TArray<int32_t> __keys_rename_at_3; das_zero(__keys_rename_at_3);
+	TArray<float> __values_rename_at_4; das_zero(__values_rename_at_4);
+	{
+		bool __need_loop_5 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_5;
+		__need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_3),__i_rename_at_5 * 3,-1);
+			_Funcbuiltin_0x60_push_8a9191e5eb1aa83e(__context__,das_arg<TArray<float>>::pass(__values_rename_at_4),float(__i_rename_at_5),-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_5));
+	};
+	_Funcbuiltin_0x60_insert_batch_4bcd9a9fa2a323a0(__context__,das_arg<TTable<int32_t,float>>::pass(__tab_rename_at_2),das_arg<TArray<int32_t>>::pass(__keys_rename_at_3),das_arg<TArray<float>>::pass(__values_rename_at_4));
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,float>>::pass(__tab_rename_at_2)) == 1000));
+	{
+		bool __need_loop_10 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_10;
+		__need_loop_10 = __i_iterator.first(__context__,(__i_rename_at_10)) && __need_loop_10;
+		for ( ; __need_loop_10 ; __need_loop_10 = __i_iterator.next(__context__,(__i_rename_at_10)) )
+		{
+			DAS_ASSERT((__tab_rename_at_2((__i_rename_at_10 * 3),__context__) == float(__i_rename_at_10)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_10));
+	};
+	TArray<int32_t> __probe_rename_at_12; das_zero(__probe_rename_at_12);
+	{
+		bool __need_loop_13 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,3000));
+		int32_t __i_rename_at_13;
+		__need_loop_13 = __i_iterator.first(__context__,(__i_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __i_iterator.next(__context__,(__i_rename_at_13)) )
+		{
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__probe_rename_at_12),__i_rename_at_13,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_13));
+	};
+	TArray<bool> __exists_rename_at_15; das_zero(__exists_rename_at_15);
+	_Funcbuiltin_0x60_key_exists_batch_c3ec66331184522d(__context__,das_arg<TTable<int32_t,float>>::pass(__tab_rename_at_2),das_arg<TArray<int32_t>>::pass(__probe_rename_at_12),das_arg<TArray<bool>>::pass(__exists_rename_at_15));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<bool>>::pass(__exists_rename_at_15)) == 3000));
+	{
+		bool __need_loop_18 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,3000));
+		int32_t __i_rename_at_18;
+		__need_loop_18 = __i_iterator.first(__context__,(__i_rename_at_18)) && __need_loop_18;
+		for ( ; __need_loop_18 ; __need_loop_18 = __i_iterator.next(__context__,(__i_rename_at_18)) )
+		{
+			DAS_ASSERT((__exists_rename_at_15(__i_rename_at_18,__context__) == ((SimPolicy<int32_t>::Mod(__i_rename_at_18,3,*__context__)) == 0)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_18));
+	};
+	_Funcbuiltin_0x60_find_batch_8cd0da1e1a90a5d1(__context__,das_arg<TTable<int32_t,float>>::pass(__tab_rename_at_2),das_arg<TArray<int32_t>>::pass(__probe_rename_at_12),das_make_block<void,TArray<float const  *> const  &>(__context__,320,0,&__func_info__744db4a4,[&](TArray<float const  *> const  & __res_rename_at_20)->void{
+		DAS_ASSERT((builtin_array_size(__res_rename_at_20) == 3000));
+		{
+			bool __need_loop_22 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,3000));
+			int32_t __i_rename_at_22;
+			__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+			for ( ; __need_loop_22 ; __need_loop_22 = __i_iterator.next(__context__,(__i_rename_at_22)) )
+			{
+				if ( (SimPolicy<int32_t>::Mod(__i_rename_at_22,3,*__context__)) == 0 )
+				{
+					DAS_ASSERT(((__res_rename_at_20(__i_rename_at_22,__context__) != nullptr) && (das_deref(__context__,__res_rename_at_20(__i_rename_at_22,__context__)) == float(SimPolicy<int32_t>::Div(__i_rename_at_22,3,*__context__)))));
+				} else {
+					DAS_ASSERT((__res_rename_at_20(__i_rename_at_22,__context__) == nullptr));
+				};
+			}
+			__i_iterator.close(__context__,(__i_rename_at_22));
+		};
+	}));
+	TArray<float const  *> __found_rename_at_27; das_zero(__found_rename_at_27);
+	_Funcbuiltin_0x60_find_batch_e06ae1b51987e8b6(__context__,das_arg<TTable<int32_t,float>>::pass(__tab_rename_at_2),das_arg<TArray<int32_t>>::pass(__probe_rename_at_12),das_arg<TArray<float const  *>>::pass(__found_rename_at_27));
+	DAS_ASSERT(((das_deref(__context__,__found_rename_at_27(3,__context__)) == 1.f) && (__found_rename_at_27(4,__context__) == nullptr)));
+	_Funcbuiltin_0x60_finalize_984fb7364985bb19(__context__,das_arg<TTable<int32_t,float>>::pass(__tab_rename_at_2));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__keys_rename_at_3));
+	_Funcbuiltin_0x60_finalize_4da34799ba0520c5(__context__,das_arg<TArray<float>>::pass(__values_rename_at_4));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__probe_rename_at_12));
+	_Funcbuiltin_0x60_finalize_332d1b0381aed2e2(__context__,das_arg<TArray<bool>>::pass(__exists_rename_at_15));
+	_Funcbuiltin_0x60_finalize_ac5573b4999f85e5(__context__,das_arg<TArray<float const  *>>::pass(__found_rename_at_27));
+}}
+
+inline void check_string_keys_476f8a3e83b66abb ( Context * __context__ )
+{
+	TDim<char *,3> _temp_make_local_49_224;
+	TTable<char *,int32_t> __tab_rename_at_39; das_zero(__tab_rename_at_39);
+	TArray<char *> __keys_rename_at_40; das_zero(__keys_rename_at_40);
+	TArray<int32_t> __values_rename_at_41; das_zero(__values_rename_at_41);
+	{
+		bool __need_loop_42 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_42;
+		__need_loop_42 = __i_iterator.first(__context__,(__i_rename_at_42)) && __need_loop_42;
+		for ( ; __need_loop_42 ; __need_loop_42 = __i_iterator.next(__context__,(__i_rename_at_42)) )
+		{
+			_Funcbuiltin_0x60_push_dbe8c61ce24eace2(__context__,das_arg<TArray<char *>>::pass(__keys_rename_at_40),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_6, cast<char * const >::from(((char *) "key")), cast<int32_t>::from(__i_rename_at_42))),-1);
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__values_rename_at_41),__i_rename_at_42,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_42));
+	};
+	_Funcbuiltin_0x60_insert_batch_1705800617ded15c(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_39),das_arg<TArray<char *>>::pass(__keys_rename_at_40),das_arg<TArray<int32_t>>::pass(__values_rename_at_41));
+	_Funcbuiltin_0x60_insert_batch_1705800617ded15c(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_39),das_arg<TArray<char *>>::pass(__keys_rename_at_40),das_arg<TArray<int32_t>>::pass(__values_rename_at_41));
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_39)) == 100));
+	TArray<bool> __exists_rename_at_48; das_zero(__exists_rename_at_48);
+	TArray<char *> __probe_rename_at_49; das_zero(__probe_rename_at_49); das_move(__probe_rename_at_49, _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627(__context__,das_arg<TDim<char *,3>>::pass((([&]() -> TDim<char *,3>& {
+		_temp_make_local_49_224(0,__context__) = ((char *) "key1");
+		_temp_make_local_49_224(1,__context__) = ((char *) "key99");
+		_temp_make_local_49_224(2,__context__) = ((char *) "key100");
+		return _temp_make_local_49_224;
+	})()))));
+	_Funcbuiltin_0x60_key_exists_batch_95e9771174a47f7c(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_39),das_arg<TArray<char *>>::pass(__probe_rename_at_49),das_arg<TArray<bool>>::pass(__exists_rename_at_48));
+	DAS_ASSERT(((__exists_rename_at_48(0,__context__) && __exists_rename_at_48(1,__context__)) && !(__exists_rename_at_48(2,__context__))));
+	_Funcbuiltin_0x60_finalize_bb3702af962b623e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_39));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__keys_rename_at_40));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__values_rename_at_41));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__probe_rename_at_49));
+	_Funcbuiltin_0x60_finalize_332d1b0381aed2e2(__context__,das_arg<TArray<bool>>::pass(__exists_rename_at_48));
+}
+
+inline bool test_9e6eba85ecaeca8e ( Context * __context__ )
+{
+	check_int_keys_3f5d349e1e7bc2e1(__context__);
+	check_string_keys_476f8a3e83b66abb(__context__);
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_ac5573b4999f85e5
+		aotLib[0x236249b3075dfcb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float const  *> &  ),&_Funcbuiltin_0x60_finalize_ac5573b4999f85e5>>();
+	};
+		// _Funcbuiltin_0x60_finalize_332d1b0381aed2e2
+		aotLib[0x97e55bfa28d80b21] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<bool> &  ),&_Funcbuiltin_0x60_finalize_332d1b0381aed2e2>>();
+	};
+		// _Funcbuiltin_0x60_finalize_4da34799ba0520c5
+		aotLib[0xbd5f701fe616ff75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_finalize_4da34799ba0520c5>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_finalize_984fb7364985bb19
+		aotLib[0xde5b07edf3a97449] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,float> &  ),&_Funcbuiltin_0x60_finalize_984fb7364985bb19>>();
+	};
+		// _Funcbuiltin_0x60_finalize_bb3702af962b623e
+		aotLib[0x47ccc641525eada1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Funcbuiltin_0x60_finalize_bb3702af962b623e>>();
+	};
+		// _Funcbuiltin_0x60_find_batch_e06ae1b51987e8b6
+		aotLib[0x66ef7dc93430ec7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,float> const  & , TArray<int32_t> const  & , TArray<float const  *> &  ),&_Funcbuiltin_0x60_find_batch_e06ae1b51987e8b6>>();
+	};
+		// _Funcbuiltin_0x60_find_batch_8cd0da1e1a90a5d1
+		aotLib[0x7bf9fc6d56b087] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,float> const  & , TArray<int32_t> const  & , Block DAS_COMMENT((void,TArray<float const  *> const )) const  &  ),&_Funcbuiltin_0x60_find_batch_8cd0da1e1a90a5d1>>();
+	};
+		// _Funcbuiltin_0x60_insert_batch_4bcd9a9fa2a323a0
+		aotLib[0x71a8ea689ac85425] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,float> & , TArray<int32_t> const  & , TArray<float> const  &  ),&_Funcbuiltin_0x60_insert_batch_4bcd9a9fa2a323a0>>();
+	};
+		// _Funcbuiltin_0x60_insert_batch_1705800617ded15c
+		aotLib[0x66e09830c5cffe9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> & , TArray<char *> const  & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_insert_batch_1705800617ded15c>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_batch_c3ec66331184522d
+		aotLib[0x81fcf8a9e67169ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,float> const  & , TArray<int32_t> const  & , TArray<bool> &  ),&_Funcbuiltin_0x60_key_exists_batch_c3ec66331184522d>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_batch_95e9771174a47f7c
+		aotLib[0x692fe4dc646cc20d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> const  & , TArray<char *> const  & , TArray<bool> &  ),&_Funcbuiltin_0x60_key_exists_batch_95e9771174a47f7c>>();
+	};
+		// _Funcbuiltin_0x60_push_8a9191e5eb1aa83e
+		aotLib[0xc0f5dc1255d7c9dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float , int32_t  ),&_Funcbuiltin_0x60_push_8a9191e5eb1aa83e>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_push_dbe8c61ce24eace2
+		aotLib[0xe7e1aae867aed505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const  , int32_t  ),&_Funcbuiltin_0x60_push_dbe8c61ce24eace2>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_bfd0e514057ae627
+		aotLib[0xd9c10fb92f4cd82f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,3> &  ),&_Funcbuiltin_0x60_to_array_move_bfd0e514057ae627>>();
+	};
+		// check_int_keys_3f5d349e1e7bc2e1
+		aotLib[0xd78a45c255b53037] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_int_keys_3f5d349e1e7bc2e1>>();
+	};
+		// check_string_keys_476f8a3e83b66abb
+		aotLib[0xae632571a69399b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_string_keys_476f8a3e83b66abb>>();
+	};
+		// test_9e6eba85ecaeca8e
+		aotLib[0x3697cca56156f300] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9e6eba85ecaeca8e>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,274 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_180, int32_t __at_rename_at_180 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_292 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_6c2830dfa4ff0355 ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_262 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_values_5da212112bb8d090 ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_267 );
+inline void check_keys_da0c1598f22921d9 ( Context * __context__, TTable<int32_t,int32_t> const  & __tab_rename_at_1, TArray<int32_t> const  & __expected_rename_at_1 );
+inline void check_set_2e6b5a10bc49f53f ( Context * __context__, TTable<int32_t,int32_t> const  & __tab_rename_at_9, TArray<int32_t> const  & __expected_rename_at_9 );
+inline bool test_47cf78c87c3f3e26 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_180, int32_t __at_rename_at_180 )
+{
+	return __builtin_table_erase(__context__,__Tab_rename_at_180,__at_rename_at_180);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_292),4,4,__context__);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_6c2830dfa4ff0355 ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_262 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_263; das_zero(__it_rename_at_263);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_263),__a_rename_at_262,4,__context__);
+	return /* <- */ __it_rename_at_263;
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_values_5da212112bb8d090 ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_267 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_268; das_zero(__it_rename_at_268);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_268),__a_rename_at_267,4,__context__);
+	return /* <- */ __it_rename_at_268;
+}
+
+inline void check_keys_da0c1598f22921d9 ( Context * __context__, TTable<int32_t,int32_t> const  &  __tab_rename_at_1, TArray<int32_t> const  &  __expected_rename_at_1 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_3_48;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_3_64;
+	int32_t __i_rename_at_2 = 0;
+	{
+		bool __need_loop_3 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_3_48 = (_Funcbuiltin_0x60_keys_6c2830dfa4ff0355(__context__,__tab_rename_at_1))));
+		int32_t const  * __k_rename_at_3;
+		__need_loop_3 = __k_iterator.first(__context__,(__k_rename_at_3)) && __need_loop_3;
+		// v : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __v_iterator((_temp_make_local_3_64 = (_Funcbuiltin_0x60_values_5da212112bb8d090(__context__,__tab_rename_at_1))));
+		int32_t const  * __v_rename_at_3;
+		__need_loop_3 = __v_iterator.first(__context__,(__v_rename_at_3)) && __need_loop_3;
+		for ( ; __need_loop_3 ; __need_loop_3 = __k_iterator.next(__context__,(__k_rename_at_3)) && __v_iterator.next(__context__,(__v_rename_at_3)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_3) == __expected_rename_at_1(__i_rename_at_2,__context__)));
+			DAS_ASSERT(((*__v_rename_at_3) == ((*__k_rename_at_3) * 2)));
+			__i_rename_at_2++;
+		}
+		__k_iterator.close(__context__,(__k_rename_at_3));
+		__v_iterator.close(__context__,(__v_rename_at_3));
+	};
+	DAS_ASSERT((__i_rename_at_2 == builtin_array_size(__expected_rename_at_1)));
+}
+
+inline void check_set_2e6b5a10bc49f53f ( Context * __context__, TTable<int32_t,int32_t> const  &  __tab_rename_at_9, TArray<int32_t> const  &  __expected_rename_at_9 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_13_48;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_13_64;
+	DAS_ASSERT((builtin_table_size(__tab_rename_at_9) == builtin_array_size(__expected_rename_at_9)));
+	{
+		bool __need_loop_11 = true;
+		// k : int const&
+		das_iterator<TArray<int32_t> const > __k_iterator(__expected_rename_at_9);
+		int32_t const  * __k_rename_at_11;
+		__need_loop_11 = __k_iterator.first(__context__,(__k_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __k_iterator.next(__context__,(__k_rename_at_11)) )
+		{
+			DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<int32_t,int32_t>::safe_index(&(__tab_rename_at_9),(*__k_rename_at_11),__context__),-1) == ((*__k_rename_at_11) * 2)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_11));
+	};
+	{
+		bool __need_loop_13 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_13_48 = (_Funcbuiltin_0x60_keys_6c2830dfa4ff0355(__context__,__tab_rename_at_9))));
+		int32_t const  * __k_rename_at_13;
+		__need_loop_13 = __k_iterator.first(__context__,(__k_rename_at_13)) && __need_loop_13;
+		// v : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __v_iterator((_temp_make_local_13_64 = (_Funcbuiltin_0x60_values_5da212112bb8d090(__context__,__tab_rename_at_9))));
+		int32_t const  * __v_rename_at_13;
+		__need_loop_13 = __v_iterator.first(__context__,(__v_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __k_iterator.next(__context__,(__k_rename_at_13)) && __v_iterator.next(__context__,(__v_rename_at_13)) )
+		{
+			DAS_ASSERT(((*__v_rename_at_13) == ((*__k_rename_at_13) * 2)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_13));
+		__v_iterator.close(__context__,(__v_rename_at_13));
+	};
+}
+
+inline bool test_47cf78c87c3f3e26 ( Context * __context__ )
+{
+	TTable<int32_t,int32_t> __tab_rename_at_18; das_zero(__tab_rename_at_18);
+	TArray<int32_t> __expected_rename_at_19; das_zero(__expected_rename_at_19);
+	bool __dense_rename_at_20 = (bool)builtin_table_is_dense();
+	{
+		bool __need_loop_21 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_21;
+		__need_loop_21 = __i_iterator.first(__context__,(__i_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __i_iterator.next(__context__,(__i_rename_at_21)) )
+		{
+			int32_t __k_rename_at_22 = (int32_t)(SimPolicy<int32_t>::Mod((__i_rename_at_21 * 7919),1000,*__context__));
+			das_copy(__tab_rename_at_18(__k_rename_at_22,__context__),__k_rename_at_22 * 2);
+			_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__expected_rename_at_19),__k_rename_at_22,-1);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_21));
+	};
+	if ( __dense_rename_at_20 )
+	{
+		check_keys_da0c1598f22921d9(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_18),das_arg<TArray<int32_t>>::pass(__expected_rename_at_19));
+	} else {
+		check_set_2e6b5a10bc49f53f(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_18),das_arg<TArray<int32_t>>::pass(__expected_rename_at_19));
+	};
+	TArray<int32_t> __left_rename_at_31; das_zero(__left_rename_at_31);
+	{
+		bool __need_loop_32 = true;
+		// k : int&
+		das_iterator<TArray<int32_t>> __k_iterator(__expected_rename_at_19);
+		int32_t * __k_rename_at_32;
+		__need_loop_32 = __k_iterator.first(__context__,(__k_rename_at_32)) && __need_loop_32;
+		for ( ; __need_loop_32 ; __need_loop_32 = __k_iterator.next(__context__,(__k_rename_at_32)) )
+		{
+			if ( (SimPolicy<int32_t>::Mod((*__k_rename_at_32),3,*__context__)) == 0 )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__left_rename_at_31),(*__k_rename_at_32),-1);
+			} else {
+				_Funcbuiltin_0x60_erase_3b06d4792ac86bb9(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_18),(*__k_rename_at_32));
+			};
+		}
+		__k_iterator.close(__context__,(__k_rename_at_32));
+	};
+	check_set_2e6b5a10bc49f53f(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_18),das_arg<TArray<int32_t>>::pass(__left_rename_at_31));
+	das_copy(__tab_rename_at_18(1,__context__),2);
+	_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(__left_rename_at_31),1,-1);
+	check_set_2e6b5a10bc49f53f(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_18),das_arg<TArray<int32_t>>::pass(__left_rename_at_31));
+	if ( __dense_rename_at_20 )
+	{
+		Sequence DAS_COMMENT((int32_t *)) _temp_make_local_44_224;
+		int32_t __last_rename_at_43 = -1;
+		{
+			bool __need_loop_44 = true;
+			// k : int const&
+			das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_44_224 = (_Funcbuiltin_0x60_keys_6c2830dfa4ff0355(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_18)))));
+			int32_t const  * __k_rename_at_44;
+			__need_loop_44 = __k_iterator.first(__context__,(__k_rename_at_44)) && __need_loop_44;
+			for ( ; __need_loop_44 ; __need_loop_44 = __k_iterator.next(__context__,(__k_rename_at_44)) )
+			{
+				das_copy(__last_rename_at_43,(*__k_rename_at_44));
+			}
+			__k_iterator.close(__context__,(__k_rename_at_44));
+		};
+		DAS_ASSERT((__last_rename_at_43 == 1));
+	};
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_18));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__expected_rename_at_19));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__left_rename_at_31));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_erase_3b06d4792ac86bb9
+		aotLib[0x25338066fdc3cf05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_3b06d4792ac86bb9>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+		aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+		// _Funcbuiltin_0x60_keys_6c2830dfa4ff0355
+		aotLib[0x40b58262c96d3a05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_keys_6c2830dfa4ff0355>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_values_5da212112bb8d090
+		aotLib[0x8acc2252ecd807ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_values_5da212112bb8d090>>();
+	};
+		// check_keys_da0c1598f22921d9
+		aotLib[0xfbddf1ff462d5722] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> const  & , TArray<int32_t> const  &  ),&check_keys_da0c1598f22921d9>>();
+	};
+		// check_set_2e6b5a10bc49f53f
+		aotLib[0xba2063532604a50a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> const  & , TArray<int32_t> const  &  ),&check_set_2e6b5a10bc49f53f>>();
+	};
+		// test_47cf78c87c3f3e26
+		aotLib[0x20d178cd5b63dbde] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_47cf78c87c3f3e26>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
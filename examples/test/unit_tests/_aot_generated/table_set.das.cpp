@@ -0,0 +1,491 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__243aba75;
+extern TypeInfo __type_info__94181030;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__d445a339;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__199df2db;
+extern TypeInfo __type_info__ddf01b45;
+extern TypeInfo __type_info__731e4625;
+extern TypeInfo __type_info__2bec7979;
+extern TypeInfo __type_info__9783f3db;
+extern TypeInfo __type_info__91270d7b;
+extern VarInfo __var_info__d2200681;
+extern VarInfo __var_info__f210a027;
+extern VarInfo __var_info__35e912f2;
+extern FuncInfo __func_info__63f35a93;
+
+VarInfo __struct_info__243aba75_field_0 =  { Type::tTable, nullptr, nullptr, nullptr, &__type_info__95e97e5e, &__type_info__48b5725f, nullptr, nullptr, 0, 0, nullptr, 2, 0xf210a027, "ids", 0 };
+VarInfo __struct_info__243aba75_field_1 =  { Type::tTable, nullptr, nullptr, nullptr, &__type_info__17c16538, &__type_info__48b5725f, nullptr, nullptr, 0, 0, nullptr, 2, 0xd2200681, "names", 48 };
+VarInfo * __struct_info__243aba75_fields[2] =  { &__struct_info__243aba75_field_0, &__struct_info__243aba75_field_1 };
+StructInfo __struct_info__243aba75 = {"SetHolder", __struct_info__243aba75_fields, 2, 96, -1, nullptr, 0x243aba75 };
+VarInfo __func_info__63f35a93_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x35e912f2, "data", 0 };
+VarInfo * __func_info__63f35a93_fields[1] =  { &__func_info__63f35a93_field_0 };
+FuncInfo __func_info__63f35a93 = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__63f35a93_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x63f35a93, 0x0 };
+TypeInfo __type_info__94181030 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x94181030 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo * __type_info__d445a339_arg_types[1] = { &__type_info__94181030 };
+TypeInfo __type_info__d445a339 = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d445a339_arg_types, nullptr, 1, 0, nullptr, 34, 0xd445a339 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x359c1b32 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__199df2db = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2076, 0x199df2db };
+TypeInfo __type_info__ddf01b45 = { Type::tStructure, &__struct_info__243aba75, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xddf01b45 };
+TypeInfo __type_info__731e4625 = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__17c16538, &__type_info__48b5725f, nullptr, nullptr, 0, 0, nullptr, 2, 0x731e4625 };
+TypeInfo __type_info__2bec7979 = { Type::tStructure, &__struct_info__243aba75, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x2bec7979 };
+TypeInfo __type_info__9783f3db = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__17c16538, &__type_info__48b5725f, nullptr, nullptr, 0, 0, nullptr, 258, 0x9783f3db };
+TypeInfo __type_info__91270d7b = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__95e97e5e, &__type_info__48b5725f, nullptr, nullptr, 0, 0, nullptr, 2, 0x91270d7b };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__ddf01b45, &__type_info__94181030 };
+TypeInfo * __tinfo_1[2] = { &__type_info__2bec7979, &__type_info__d445a339 };
+TypeInfo * __tinfo_2[2] = { &__type_info__91270d7b, &__type_info__359c1b32 };
+TypeInfo * __tinfo_3[2] = { &__type_info__731e4625, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_4[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_5[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_6[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_7[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_8[1] = { &__type_info__9783f3db };
+namespace  {
+
+struct SetHolder {
+	TTable<int32_t,void> ids;
+	TTable<char *,void> names;
+};
+static_assert(sizeof(SetHolder)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetHolder,ids)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetHolder,names)==48,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_binary_load_da8f391d32868687 ( Context * __context__, struct SetHolder & __obj_rename_at_216, TArray<uint8_t> const  & __data_rename_at_216 );
+inline void _Funcbuiltin_0x60_binary_save_4574a30e88704950 ( Context * __context__, struct SetHolder const  & __obj_rename_at_212, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_212 );
+inline void _Funcbuiltin_0x60_clone_13872ed491ff0662 ( Context * __context__, TTable<int32_t,void> & __a_rename_at_252, TTable<int32_t,void> const  & __b_rename_at_252 );
+inline void _Funcbuiltin_0x60_clone_7147aa6cc9bf08b8 ( Context * __context__, TTable<char *,void> & __a_rename_at_252, TTable<char *,void> const  & __b_rename_at_252 );
+inline bool _Funcbuiltin_0x60_erase_c788ae7d49849ae2 ( Context * __context__, TTable<int32_t,void> & __Tab_rename_at_180, int32_t __at_rename_at_180 );
+inline void _Funcbuiltin_0x60_finalize_dd0710b85d81813f ( Context * __context__, TTable<int32_t,void> & __a_rename_at_292 );
+inline void _Funcbuiltin_0x60_finalize_e4da197152382649 ( Context * __context__, TTable<char *,void> & __a_rename_at_292 );
+inline bool _Funcbuiltin_0x60_insert_db76063e7079d629 ( Context * __context__, TTable<int32_t,void> & __Tab_rename_at_209, int32_t __at_rename_at_209 );
+inline bool _Funcbuiltin_0x60_insert_a0aa96db559217b9 ( Context * __context__, TTable<char *,void> & __Tab_rename_at_209, char * const  __at_rename_at_209 );
+inline bool _Funcbuiltin_0x60_key_exists_62fcc4e31829d134 ( Context * __context__, TTable<int32_t,void> const  & __Tab_rename_at_183, int32_t __at_rename_at_183 );
+inline bool _Funcbuiltin_0x60_key_exists_df62b3053693b61e ( Context * __context__, TTable<char *,void> const  & __Tab_rename_at_183, char * const  __at_rename_at_183 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_870d22c4f09fc044 ( Context * __context__, TTable<int32_t,void> const  & __a_rename_at_262 );
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_b4879233b2ff4d70 ( Context * __context__, TTable<char *,void> const  & __a_rename_at_262 );
+inline void check_clone_c38b857f075b252b ( Context * __context__ );
+inline void check_int_set_702e5d56cdc8e583 ( Context * __context__ );
+inline void check_serialize_eff30d98df3b79c5 ( Context * __context__ );
+inline void check_string_set_262e6b2987c94984 ( Context * __context__ );
+inline void clone_e7da10ae799872dc ( Context * __context__, struct SetHolder & __a_rename_at_32, struct SetHolder const  & __b_rename_at_32 );
+inline void finalize_295db5d8919adfcc ( Context * __context__, struct SetHolder & ____this_rename_at_32 );
+inline bool test_9be16857477542d4 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_binary_load_da8f391d32868687 ( Context * __context__, struct SetHolder &  __obj_rename_at_216, TArray<uint8_t> const  &  __data_rename_at_216 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<struct SetHolder &>::from(__obj_rename_at_216),cast<TArray<uint8_t> const  &>::from(__data_rename_at_216)));
+}
+
+inline void _Funcbuiltin_0x60_binary_save_4574a30e88704950 ( Context * __context__, struct SetHolder const  &  __obj_rename_at_212, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_212 )
+{
+	das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<struct SetHolder const  &>::from(__obj_rename_at_212),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_212)));
+}
+
+inline void _Funcbuiltin_0x60_clone_13872ed491ff0662 ( Context * __context__, TTable<int32_t,void> &  __a_rename_at_252, TTable<int32_t,void> const  &  __b_rename_at_252 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_254_32;
+	builtin_table_clear(das_arg<TTable<int32_t,void>>::pass(__a_rename_at_252),__context__);
+	{
+		bool __need_loop_254 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_254_32 = (_Funcbuiltin_0x60_keys_870d22c4f09fc044(__context__,__b_rename_at_252))));
+		int32_t const  * __k_rename_at_254;
+		__need_loop_254 = __k_iterator.first(__context__,(__k_rename_at_254)) && __need_loop_254;
+		for ( ; __need_loop_254 ; __need_loop_254 = __k_iterator.next(__context__,(__k_rename_at_254)) )
+		{
+			_Funcbuiltin_0x60_insert_db76063e7079d629(__context__,das_arg<TTable<int32_t,void>>::pass(__a_rename_at_252),(*__k_rename_at_254));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_254));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_7147aa6cc9bf08b8 ( Context * __context__, TTable<char *,void> &  __a_rename_at_252, TTable<char *,void> const  &  __b_rename_at_252 )
+{
+	Sequence DAS_COMMENT((char * *)) _temp_make_local_254_32;
+	builtin_table_clear(das_arg<TTable<char *,void>>::pass(__a_rename_at_252),__context__);
+	{
+		bool __need_loop_254 = true;
+		// k : string const&
+		das_iterator<Sequence DAS_COMMENT((char * const ))> __k_iterator((_temp_make_local_254_32 = (_Funcbuiltin_0x60_keys_b4879233b2ff4d70(__context__,__b_rename_at_252))));
+		char * const  * __k_rename_at_254;
+		__need_loop_254 = __k_iterator.first(__context__,(__k_rename_at_254)) && __need_loop_254;
+		for ( ; __need_loop_254 ; __need_loop_254 = __k_iterator.next(__context__,(__k_rename_at_254)) )
+		{
+			_Funcbuiltin_0x60_insert_a0aa96db559217b9(__context__,das_arg<TTable<char *,void>>::pass(__a_rename_at_252),(*__k_rename_at_254));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_254));
+	};
+}
+
+inline bool _Funcbuiltin_0x60_erase_c788ae7d49849ae2 ( Context * __context__, TTable<int32_t,void> &  __Tab_rename_at_180, int32_t __at_rename_at_180 )
+{
+	return __builtin_table_erase(__context__,__Tab_rename_at_180,__at_rename_at_180);
+}
+
+inline void _Funcbuiltin_0x60_finalize_dd0710b85d81813f ( Context * __context__, TTable<int32_t,void> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,void>>::pass(__a_rename_at_292),4,0,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_e4da197152382649 ( Context * __context__, TTable<char *,void> &  __a_rename_at_292 )
+{
+	builtin_table_free(das_arg<TTable<char *,void>>::pass(__a_rename_at_292),8,0,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_insert_db76063e7079d629 ( Context * __context__, TTable<int32_t,void> &  __Tab_rename_at_209, int32_t __at_rename_at_209 )
+{
+	return das_call_interop<bool>::call(&_builtin_table_set_insert,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<TTable<int32_t,void> &>::from(__Tab_rename_at_209),cast<int32_t>::from(__at_rename_at_209)));
+}
+
+inline bool _Funcbuiltin_0x60_insert_a0aa96db559217b9 ( Context * __context__, TTable<char *,void> &  __Tab_rename_at_209, char * const  __at_rename_at_209 )
+{
+	return das_call_interop<bool>::call(&_builtin_table_set_insert,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<TTable<char *,void> &>::from(__Tab_rename_at_209),cast<char * const >::from(__at_rename_at_209)));
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_62fcc4e31829d134 ( Context * __context__, TTable<int32_t,void> const  &  __Tab_rename_at_183, int32_t __at_rename_at_183 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_183,__at_rename_at_183);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_df62b3053693b61e ( Context * __context__, TTable<char *,void> const  &  __Tab_rename_at_183, char * const  __at_rename_at_183 )
+{
+	return __builtin_table_key_exists(__context__,__Tab_rename_at_183,__at_rename_at_183);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_870d22c4f09fc044 ( Context * __context__, TTable<int32_t,void> const  &  __a_rename_at_262 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_263; das_zero(__it_rename_at_263);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_263),__a_rename_at_262,4,__context__);
+	return /* <- */ __it_rename_at_263;
+}
+
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_b4879233b2ff4d70 ( Context * __context__, TTable<char *,void> const  &  __a_rename_at_262 )
+{
+	Sequence DAS_COMMENT((char * *)) __it_rename_at_263; das_zero(__it_rename_at_263);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((char * const ))>::pass(__it_rename_at_263),__a_rename_at_262,8,__context__);
+	return /* <- */ __it_rename_at_263;
+}
+
+inline void check_clone_c38b857f075b252b ( Context * __context__ )
+{
+	struct SetHolder __a_rename_at_52; das_zero(__a_rename_at_52);
+	{
+		bool __need_loop_53 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_53;
+		__need_loop_53 = __i_iterator.first(__context__,(__i_rename_at_53)) && __need_loop_53;
+		for ( ; __need_loop_53 ; __need_loop_53 = __i_iterator.next(__context__,(__i_rename_at_53)) )
+		{
+			_Funcbuiltin_0x60_insert_db76063e7079d629(__context__,das_arg<TTable<int32_t,void>>::pass(__a_rename_at_52.ids),__i_rename_at_53);
+			_Funcbuiltin_0x60_insert_a0aa96db559217b9(__context__,das_arg<TTable<char *,void>>::pass(__a_rename_at_52.names),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_4, cast<char * const >::from(((char *) "name")), cast<int32_t>::from(__i_rename_at_53))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_53));
+	};
+	struct SetHolder __b_rename_at_56; das_zero(__b_rename_at_56);
+	_Funcbuiltin_0x60_insert_db76063e7079d629(__context__,das_arg<TTable<int32_t,void>>::pass(__b_rename_at_56.ids),100);
+	clone_e7da10ae799872dc(__context__,das_arg<struct SetHolder>::pass(__b_rename_at_56),das_arg<struct SetHolder>::pass(__a_rename_at_52));
+	DAS_ASSERT((((builtin_table_size(das_arg<TTable<int32_t,void>>::pass(__b_rename_at_56.ids)) == 10) && (builtin_table_size(das_arg<TTable<char *,void>>::pass(__b_rename_at_56.names)) == 10)) && !(_Funcbuiltin_0x60_key_exists_62fcc4e31829d134(__context__,das_arg<TTable<int32_t,void>>::pass(__b_rename_at_56.ids),100))));
+	{
+		bool __need_loop_60 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_60;
+		__need_loop_60 = __i_iterator.first(__context__,(__i_rename_at_60)) && __need_loop_60;
+		for ( ; __need_loop_60 ; __need_loop_60 = __i_iterator.next(__context__,(__i_rename_at_60)) )
+		{
+			DAS_ASSERT((_Funcbuiltin_0x60_key_exists_62fcc4e31829d134(__context__,das_arg<TTable<int32_t,void>>::pass(__b_rename_at_56.ids),__i_rename_at_60) && _Funcbuiltin_0x60_key_exists_df62b3053693b61e(__context__,das_arg<TTable<char *,void>>::pass(__b_rename_at_56.names),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_5, cast<char * const >::from(((char *) "name")), cast<int32_t>::from(__i_rename_at_60))))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_60));
+	};
+	TTable<int32_t,void> __c_rename_at_62; das_zero(__c_rename_at_62);
+	_Funcbuiltin_0x60_clone_13872ed491ff0662(__context__,das_arg<TTable<int32_t,void>>::pass(__c_rename_at_62),das_arg<TTable<int32_t,void>>::pass(__a_rename_at_52.ids));
+	_Funcbuiltin_0x60_insert_db76063e7079d629(__context__,das_arg<TTable<int32_t,void>>::pass(__a_rename_at_52.ids),11);
+	DAS_ASSERT(((builtin_table_size(das_arg<TTable<int32_t,void>>::pass(__c_rename_at_62)) == 10) && !(_Funcbuiltin_0x60_key_exists_62fcc4e31829d134(__context__,das_arg<TTable<int32_t,void>>::pass(__c_rename_at_62),11))));
+	finalize_295db5d8919adfcc(__context__,das_arg<struct SetHolder>::pass(__a_rename_at_52));
+	finalize_295db5d8919adfcc(__context__,das_arg<struct SetHolder>::pass(__b_rename_at_56));
+	_Funcbuiltin_0x60_finalize_dd0710b85d81813f(__context__,das_arg<TTable<int32_t,void>>::pass(__c_rename_at_62));
+}
+
+inline void check_int_set_702e5d56cdc8e583 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_15_144;
+	TTable<int32_t,void> __s_rename_at_4; das_zero(__s_rename_at_4);
+	{
+		bool __need_loop_5 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_5;
+		__need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5)) )
+		{
+			DAS_VERIFY((_Funcbuiltin_0x60_insert_db76063e7079d629(__context__,das_arg<TTable<int32_t,void>>::pass(__s_rename_at_4),__i_rename_at_5 * 2)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_5));
+	};
+	DAS_VERIFY((!_Funcbuiltin_0x60_insert_db76063e7079d629(__context__,das_arg<TTable<int32_t,void>>::pass(__s_rename_at_4),0)));
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,void>>::pass(__s_rename_at_4)) == 100));
+	{
+		bool __need_loop_9 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,200));
+		int32_t __i_rename_at_9;
+		__need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9)) && __need_loop_9;
+		for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9)) )
+		{
+			DAS_ASSERT((_Funcbuiltin_0x60_key_exists_62fcc4e31829d134(__context__,das_arg<TTable<int32_t,void>>::pass(__s_rename_at_4),__i_rename_at_9) == ((SimPolicy<int32_t>::Mod(__i_rename_at_9,2,*__context__)) == 0)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_9));
+	};
+	{
+		bool __need_loop_11 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,50));
+		int32_t __i_rename_at_11;
+		__need_loop_11 = __i_iterator.first(__context__,(__i_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __i_iterator.next(__context__,(__i_rename_at_11)) )
+		{
+			DAS_VERIFY((_Funcbuiltin_0x60_erase_c788ae7d49849ae2(__context__,das_arg<TTable<int32_t,void>>::pass(__s_rename_at_4),__i_rename_at_11 * 4)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_11));
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,void>>::pass(__s_rename_at_4)) == 50));
+	int32_t __total_rename_at_14 = 0;
+	{
+		bool __need_loop_15 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_15_144 = (_Funcbuiltin_0x60_keys_870d22c4f09fc044(__context__,das_arg<TTable<int32_t,void>>::pass(__s_rename_at_4)))));
+		int32_t const  * __k_rename_at_15;
+		__need_loop_15 = __k_iterator.first(__context__,(__k_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __k_iterator.next(__context__,(__k_rename_at_15)) )
+		{
+			DAS_ASSERT(((SimPolicy<int32_t>::Mod((*__k_rename_at_15),4,*__context__)) == 2));
+			__total_rename_at_14++;
+		}
+		__k_iterator.close(__context__,(__k_rename_at_15));
+	};
+	DAS_ASSERT((__total_rename_at_14 == 50));
+	_Funcbuiltin_0x60_finalize_dd0710b85d81813f(__context__,das_arg<TTable<int32_t,void>>::pass(__s_rename_at_4));
+}
+
+inline void check_serialize_eff30d98df3b79c5 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,320,"check_serialize " DAS_FILE_LINE);
+{
+	struct SetHolder __a_rename_at_37; das_zero(__a_rename_at_37);
+	{
+		bool __need_loop_38 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_38;
+		__need_loop_38 = __i_iterator.first(__context__,(__i_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __i_iterator.next(__context__,(__i_rename_at_38)) )
+		{
+			_Funcbuiltin_0x60_insert_db76063e7079d629(__context__,das_arg<TTable<int32_t,void>>::pass(__a_rename_at_37.ids),__i_rename_at_38 * 10);
+			_Funcbuiltin_0x60_insert_a0aa96db559217b9(__context__,das_arg<TTable<char *,void>>::pass(__a_rename_at_37.names),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_6, cast<char * const >::from(((char *) "name")), cast<int32_t>::from(__i_rename_at_38))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_38));
+	};
+	struct SetHolder __b_rename_at_41; das_zero(__b_rename_at_41);
+	_Funcbuiltin_0x60_binary_save_4574a30e88704950(__context__,das_arg<struct SetHolder>::pass(__a_rename_at_37),das_make_block<void,TArray<uint8_t> const  &>(__context__,288,0,&__func_info__63f35a93,[&](TArray<uint8_t> const  & __data_rename_at_42)->void{
+		_Funcbuiltin_0x60_binary_load_da8f391d32868687(__context__,das_arg<struct SetHolder>::pass(__b_rename_at_41),__data_rename_at_42);
+	}));
+	DAS_ASSERT(((builtin_table_size(das_arg<TTable<int32_t,void>>::pass(__b_rename_at_41.ids)) == 10) && (builtin_table_size(das_arg<TTable<char *,void>>::pass(__b_rename_at_41.names)) == 10)));
+	{
+		bool __need_loop_45 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_45;
+		__need_loop_45 = __i_iterator.first(__context__,(__i_rename_at_45)) && __need_loop_45;
+		for ( ; __need_loop_45 ; __need_loop_45 = __i_iterator.next(__context__,(__i_rename_at_45)) )
+		{
+			DAS_ASSERT((_Funcbuiltin_0x60_key_exists_62fcc4e31829d134(__context__,das_arg<TTable<int32_t,void>>::pass(__b_rename_at_41.ids),__i_rename_at_45 * 10)));
+			DAS_ASSERT((_Funcbuiltin_0x60_key_exists_df62b3053693b61e(__context__,das_arg<TTable<char *,void>>::pass(__b_rename_at_41.names),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<char * const >::from(((char *) "name")), cast<int32_t>::from(__i_rename_at_45))))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_45));
+	};
+	finalize_295db5d8919adfcc(__context__,das_arg<struct SetHolder>::pass(__a_rename_at_37));
+	finalize_295db5d8919adfcc(__context__,das_arg<struct SetHolder>::pass(__b_rename_at_41));
+}}
+
+inline void check_string_set_262e6b2987c94984 ( Context * __context__ )
+{
+	TTable<char *,void> __s_rename_at_22; das_zero(__s_rename_at_22);
+	_Funcbuiltin_0x60_insert_a0aa96db559217b9(__context__,das_arg<TTable<char *,void>>::pass(__s_rename_at_22),((char *) "one"));
+	_Funcbuiltin_0x60_insert_a0aa96db559217b9(__context__,das_arg<TTable<char *,void>>::pass(__s_rename_at_22),((char *) "two"));
+	DAS_VERIFY((!_Funcbuiltin_0x60_insert_a0aa96db559217b9(__context__,das_arg<TTable<char *,void>>::pass(__s_rename_at_22),((char *) "one"))));
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,void>>::pass(__s_rename_at_22)) == 2));
+	DAS_ASSERT((_Funcbuiltin_0x60_key_exists_df62b3053693b61e(__context__,das_arg<TTable<char *,void>>::pass(__s_rename_at_22),((char *) "two")) && !(_Funcbuiltin_0x60_key_exists_df62b3053693b61e(__context__,das_arg<TTable<char *,void>>::pass(__s_rename_at_22),((char *) "three")))));
+	char * __text_rename_at_28 = (char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<TTable<char *,void> &>::from(__s_rename_at_22))));
+	DAS_ASSERT((builtin_string_find2(__text_rename_at_28,((char *) "one")) != -1));
+	_Funcbuiltin_0x60_finalize_e4da197152382649(__context__,das_arg<TTable<char *,void>>::pass(__s_rename_at_22));
+}
+
+inline void clone_e7da10ae799872dc ( Context * __context__, struct SetHolder &  __a_rename_at_32, struct SetHolder const  &  __b_rename_at_32 )
+{
+	_Funcbuiltin_0x60_clone_13872ed491ff0662(__context__,das_arg<TTable<int32_t,void>>::pass(__a_rename_at_32.ids),__b_rename_at_32.ids);
+	_Funcbuiltin_0x60_clone_7147aa6cc9bf08b8(__context__,das_arg<TTable<char *,void>>::pass(__a_rename_at_32.names),__b_rename_at_32.names);
+}
+
+inline void finalize_295db5d8919adfcc ( Context * __context__, struct SetHolder &  ____this_rename_at_32 )
+{
+	_Funcbuiltin_0x60_finalize_dd0710b85d81813f(__context__,das_arg<TTable<int32_t,void>>::pass(____this_rename_at_32.ids));
+	_Funcbuiltin_0x60_finalize_e4da197152382649(__context__,das_arg<TTable<char *,void>>::pass(____this_rename_at_32.names));
+	memset(&(____this_rename_at_32), 0, 96);
+}
+
+inline bool test_9be16857477542d4 ( Context * __context__ )
+{
+	check_int_set_702e5d56cdc8e583(__context__);
+	check_string_set_262e6b2987c94984(__context__);
+	check_serialize_eff30d98df3b79c5(__context__);
+	check_clone_c38b857f075b252b(__context__);
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_binary_load_da8f391d32868687
+		aotLib[0xc958d79c7a89dfb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SetHolder & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_da8f391d32868687>>();
+	};
+		// _Funcbuiltin_0x60_binary_save_4574a30e88704950
+		aotLib[0x64bdbb55239a1af9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SetHolder const  & , Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  ),&_Funcbuiltin_0x60_binary_save_4574a30e88704950>>();
+	};
+		// _Funcbuiltin_0x60_clone_13872ed491ff0662
+		aotLib[0xf3e2f2af4cd4c5a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,void> & , TTable<int32_t,void> const  &  ),&_Funcbuiltin_0x60_clone_13872ed491ff0662>>();
+	};
+		// _Funcbuiltin_0x60_clone_7147aa6cc9bf08b8
+		aotLib[0x7a0eb67c5f0d7f57] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,void> & , TTable<char *,void> const  &  ),&_Funcbuiltin_0x60_clone_7147aa6cc9bf08b8>>();
+	};
+		// _Funcbuiltin_0x60_erase_c788ae7d49849ae2
+		aotLib[0xdcc8e45f6fd440b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,void> & , int32_t  ),&_Funcbuiltin_0x60_erase_c788ae7d49849ae2>>();
+	};
+		// _Funcbuiltin_0x60_finalize_dd0710b85d81813f
+		aotLib[0xcb94f763b2f9ae09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,void> &  ),&_Funcbuiltin_0x60_finalize_dd0710b85d81813f>>();
+	};
+		// _Funcbuiltin_0x60_finalize_e4da197152382649
+		aotLib[0x544976aa568c3bd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,void> &  ),&_Funcbuiltin_0x60_finalize_e4da197152382649>>();
+	};
+		// _Funcbuiltin_0x60_insert_db76063e7079d629
+		aotLib[0xff6260c58597498d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,void> & , int32_t  ),&_Funcbuiltin_0x60_insert_db76063e7079d629>>();
+	};
+		// _Funcbuiltin_0x60_insert_a0aa96db559217b9
+		aotLib[0xe90ac7676619f2b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,void> & , char * const   ),&_Funcbuiltin_0x60_insert_a0aa96db559217b9>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_62fcc4e31829d134
+		aotLib[0x5d8372d9a5886791] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,void> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_62fcc4e31829d134>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_df62b3053693b61e
+		aotLib[0x223999bc34f1308d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,void> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_df62b3053693b61e>>();
+	};
+		// _Funcbuiltin_0x60_keys_870d22c4f09fc044
+		aotLib[0xca8e4ad1a63b1661] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,void> const  &  ),&_Funcbuiltin_0x60_keys_870d22c4f09fc044>>();
+	};
+		// _Funcbuiltin_0x60_keys_b4879233b2ff4d70
+		aotLib[0x6c176d9ac0aa9c15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char * const  &)) (*) ( Context * __context__, TTable<char *,void> const  &  ),&_Funcbuiltin_0x60_keys_b4879233b2ff4d70>>();
+	};
+		// check_clone_c38b857f075b252b
+		aotLib[0x4359a7da0c60f9a6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_clone_c38b857f075b252b>>();
+	};
+		// check_int_set_702e5d56cdc8e583
+		aotLib[0x8fd2396dbe4490a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_int_set_702e5d56cdc8e583>>();
+	};
+		// check_serialize_eff30d98df3b79c5
+		aotLib[0x416b2000f211c964] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_serialize_eff30d98df3b79c5>>();
+	};
+		// check_string_set_262e6b2987c94984
+		aotLib[0x78f1d7d2b94ee2e4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&check_string_set_262e6b2987c94984>>();
+	};
+		// clone_e7da10ae799872dc
+		aotLib[0xd550dd8151347ead] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SetHolder & , struct SetHolder const  &  ),&clone_e7da10ae799872dc>>();
+	};
+		// finalize_295db5d8919adfcc
+		aotLib[0x69cab988beb6dbba] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, struct SetHolder &  ),&finalize_295db5d8919adfcc>>();
+	};
+		// test_9be16857477542d4
+		aotLib[0xbe9299ea29a947b0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9be16857477542d4>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,122 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline float _Func_0x60_square_9285dc4e190ab7b6 ( Context * __context__, float __x_rename_at_4 );
+inline float3 find_best_squad_pos_ce782e038d9a8c1e ( Context * __context__, float3 __wish_pos_rename_at_8, float3x4 const  & __leader_tm_rename_at_8, float3 __agent_pos_rename_at_8, float3 __offset_rename_at_9, int32_t __num_iter_rename_at_9, float __leader_min_dist_rename_at_9 );
+inline bool test_a0db3af04dd4d348 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline float _Func_0x60_square_9285dc4e190ab7b6 ( Context * __context__, float __x_rename_at_4 )
+{
+	return __x_rename_at_4 * __x_rename_at_4;
+}
+
+inline float3 find_best_squad_pos_ce782e038d9a8c1e ( Context * __context__, float3 __wish_pos_rename_at_8, float3x4 const  &  __leader_tm_rename_at_8, float3 __agent_pos_rename_at_8, float3 __offset_rename_at_9, int32_t __num_iter_rename_at_9, float __leader_min_dist_rename_at_9 )
+{
+	float3 __wishPosition_rename_at_10 = __wish_pos_rename_at_8;
+	{
+		bool __need_loop_11 = true;
+		// iter : int const
+		das_iterator<range> __iter_iterator(range(0,__num_iter_rename_at_9));
+		int32_t __iter_rename_at_11;
+		__need_loop_11 = __iter_iterator.first(__context__,(__iter_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __iter_iterator.next(__context__,(__iter_rename_at_11)) )
+		{
+			project_to_nearest_navmesh_point(das_alias<Point3>::to(__wishPosition_rename_at_10),0.5f);
+			if ( lengthSq3(SimPolicy<float3>::Sub(__wishPosition_rename_at_10,das_index<float3x4 const >::at(__leader_tm_rename_at_8,3,__context__),*__context__)) < _Func_0x60_square_9285dc4e190ab7b6(__context__,__leader_min_dist_rename_at_9) )
+			{
+				das_copy(__wishPosition_rename_at_10,float3x4_mul_vec3p(__leader_tm_rename_at_8,(SimPolicy<float3>::Mul(v_splats(1 << (__iter_rename_at_11 + 1)),__offset_rename_at_9,*__context__))));
+			} else {
+				break;
+			};
+		}
+		__iter_iterator.close(__context__,(__iter_rename_at_11));
+	};
+	project_to_nearest_navmesh_point(das_alias<Point3>::to(__wishPosition_rename_at_10),0.5f);
+	return __wishPosition_rename_at_10;
+}
+
+inline bool test_a0db3af04dd4d348 ( Context * __context__ )
+{
+	float3 __pos_rename_at_22 = v_make_vec4f(1.f,2.f,3.f,0.f);
+	project_to_nearest_navmesh_point(das_alias<Point3>::to(__pos_rename_at_22),1.f);
+	DAS_ASSERT((SimPolicy<float3>::Equ(__pos_rename_at_22,v_make_vec4f(2.f,3.f,4.f,0.f),*__context__)));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_square_9285dc4e190ab7b6
+		aotLib[0xcfc8bca4c9bbaad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float  ),&_Func_0x60_square_9285dc4e190ab7b6>>();
+	};
+		// find_best_squad_pos_ce782e038d9a8c1e
+		aotLib[0xe743db640f08bd8a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, float3 , float3x4 const  & , float3 , float3 , int32_t , float  ),&find_best_squad_pos_ce782e038d9a8c1e>>();
+	};
+		// test_a0db3af04dd4d348
+		aotLib[0x3567a75a80000f65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_a0db3af04dd4d348>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,329 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_353 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_502cf4052c9233a ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_345 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_e7337cf490aef504 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_379 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_379 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_d45ac51cb08b659f ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) const  & __it_rename_at_379 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_aeabe5f727e6c5be ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_391 );
+inline bool test_508792c8076c3b70 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_353 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_354; das_zero(__it_rename_at_354);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_354),__a_rename_at_353,4,__context__);
+	return /* <- */ __it_rename_at_354;
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_502cf4052c9233a ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_345 )
+{
+	void * __parr_rename_at_347 = (void *)(das_cast<void *>::cast(das_ref(__context__,__a_rename_at_345(0,__context__))));
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_348; das_zero(__it_rename_at_348);
+	builtin_make_fixed_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_348),__parr_rename_at_347,4,4,__context__);
+	return /* <- */ __it_rename_at_348;
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_333 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_334; das_zero(__it_rename_at_334);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_334),__rng_rename_at_333,__context__);
+	return /* <- */ __it_rename_at_334;
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_e7337cf490aef504 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_379 )
+{
+	TArray<int32_t> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_380),__it_rename_at_379,4,false,__context__);
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_379 )
+{
+	TArray<int32_t> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_380),__it_rename_at_379,4,true,__context__);
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_d45ac51cb08b659f ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) const  &  __it_rename_at_379 )
+{
+	TArray<int32_t> __arr_rename_at_380; das_zero(__arr_rename_at_380);
+	builtin_iterator_to_array(das_arg<TArray<int32_t>>::pass(__arr_rename_at_380),__it_rename_at_379,4,true,__context__);
+	return /* <- */ __arr_rename_at_380;
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_aeabe5f727e6c5be ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_391 )
+{
+	TArray<int32_t> __arr_rename_at_392; das_zero(__arr_rename_at_392);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_392),4);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_392(0,__context__))),__a_rename_at_391);
+	return /* <- */ __arr_rename_at_392;
+}
+
+inline bool test_508792c8076c3b70 ( Context * __context__ )
+{
+	TDim<int32_t,4> _temp_make_local_5_80;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_9_128;
+	TArray<int32_t> _temp_make_local_11_176;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_11_208;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_15_256;
+	TArray<int32_t> _temp_make_local_17_304;
+	TArray<int32_t> _temp_make_local_20_368;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_20_400;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_24_448;
+	TArray<int32_t> _temp_make_local_27_496;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_27_528;
+	TDim<int32_t,4> __d_rename_at_4 = (TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+		TDim<int32_t,4> __mka_4;
+		__mka_4(0,__context__) = 1;
+		__mka_4(1,__context__) = 2;
+		__mka_4(2,__context__) = 3;
+		__mka_4(3,__context__) = 4;
+		return __mka_4;
+	})());
+	TArray<int32_t> __a_rename_at_5; das_zero(__a_rename_at_5); das_move(__a_rename_at_5, (TArray<int32_t>)_Funcbuiltin_0x60_to_array_aeabe5f727e6c5be(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_5_80(0,__context__) = 1;
+		_temp_make_local_5_80(1,__context__) = 2;
+		_temp_make_local_5_80(2,__context__) = 3;
+		_temp_make_local_5_80(3,__context__) = 4;
+		return _temp_make_local_5_80;
+	})()))));
+	{
+		bool __need_loop_6 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_6;
+		__need_loop_6 = __x_iterator.first(__context__,(__x_rename_at_6)) && __need_loop_6;
+		// y : int const&
+		das_iterator<TArray<int32_t> const > __y_iterator(__a_rename_at_5);
+		int32_t const  * __y_rename_at_6;
+		__need_loop_6 = __y_iterator.first(__context__,(__y_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __x_iterator.next(__context__,(__x_rename_at_6)) && __y_iterator.next(__context__,(__y_rename_at_6)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_6) == (*__y_rename_at_6)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_6));
+		__y_iterator.close(__context__,(__y_rename_at_6));
+	};
+	{
+		bool __need_loop_9 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,5));
+		int32_t __x_rename_at_9;
+		__need_loop_9 = __x_iterator.first(__context__,(__x_rename_at_9)) && __need_loop_9;
+		// y : int
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __y_iterator((_temp_make_local_9_128 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,5)))));
+		int32_t __y_rename_at_9;
+		__need_loop_9 = __y_iterator.first(__context__,(__y_rename_at_9)) && __need_loop_9;
+		for ( ; __need_loop_9 ; __need_loop_9 = __x_iterator.next(__context__,(__x_rename_at_9)) && __y_iterator.next(__context__,(__y_rename_at_9)) )
+		{
+			DAS_ASSERT((__x_rename_at_9 == __y_rename_at_9));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_9));
+		__y_iterator.close(__context__,(__y_rename_at_9));
+	};
+	{
+		bool __need_loop_11 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,5));
+		int32_t __x_rename_at_11;
+		__need_loop_11 = __x_iterator.first(__context__,(__x_rename_at_11)) && __need_loop_11;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_11_176 = (_Funcbuiltin_0x60_to_array_e7337cf490aef504(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_11_208 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,5)))))))));
+		int32_t * __y_rename_at_11;
+		__need_loop_11 = __y_iterator.first(__context__,(__y_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __x_iterator.next(__context__,(__x_rename_at_11)) && __y_iterator.next(__context__,(__y_rename_at_11)) )
+		{
+			DAS_ASSERT((__x_rename_at_11 == (*__y_rename_at_11)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_11));
+		__y_iterator.close(__context__,(__y_rename_at_11));
+	};
+	{
+		bool __need_loop_15 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_15;
+		__need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15)) && __need_loop_15;
+		// y : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __y_iterator((_temp_make_local_15_256 = (_Funcbuiltin_0x60_each_502cf4052c9233a(__context__,__d_rename_at_4))));
+		int32_t const  * __y_rename_at_15;
+		__need_loop_15 = __y_iterator.first(__context__,(__y_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15)) && __y_iterator.next(__context__,(__y_rename_at_15)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_15) == (*__y_rename_at_15)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_15));
+		__y_iterator.close(__context__,(__y_rename_at_15));
+	};
+	{
+		bool __need_loop_17 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_17;
+		__need_loop_17 = __x_iterator.first(__context__,(__x_rename_at_17)) && __need_loop_17;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_17_304 = (_Funcbuiltin_0x60_to_array_aeabe5f727e6c5be(__context__,__d_rename_at_4))));
+		int32_t * __y_rename_at_17;
+		__need_loop_17 = __y_iterator.first(__context__,(__y_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __x_iterator.next(__context__,(__x_rename_at_17)) && __y_iterator.next(__context__,(__y_rename_at_17)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_17) == (*__y_rename_at_17)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_17));
+		__y_iterator.close(__context__,(__y_rename_at_17));
+	};
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_20_368 = (_Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_20_400 = (_Funcbuiltin_0x60_each_502cf4052c9233a(__context__,__d_rename_at_4))))))));
+		int32_t * __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (*__y_rename_at_20)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+	{
+		bool __need_loop_24 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_5);
+		int32_t const  * __x_rename_at_24;
+		__need_loop_24 = __x_iterator.first(__context__,(__x_rename_at_24)) && __need_loop_24;
+		// y : int&
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __y_iterator((_temp_make_local_24_448 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,__a_rename_at_5))));
+		int32_t * __y_rename_at_24;
+		__need_loop_24 = __y_iterator.first(__context__,(__y_rename_at_24)) && __need_loop_24;
+		for ( ; __need_loop_24 ; __need_loop_24 = __x_iterator.next(__context__,(__x_rename_at_24)) && __y_iterator.next(__context__,(__y_rename_at_24)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_24) == (*__y_rename_at_24)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_24));
+		__y_iterator.close(__context__,(__y_rename_at_24));
+	};
+	{
+		bool __need_loop_27 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_5);
+		int32_t const  * __x_rename_at_27;
+		__need_loop_27 = __x_iterator.first(__context__,(__x_rename_at_27)) && __need_loop_27;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_27_496 = (_Funcbuiltin_0x60_to_array_d45ac51cb08b659f(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_27_528 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,__a_rename_at_5))))))));
+		int32_t * __y_rename_at_27;
+		__need_loop_27 = __y_iterator.first(__context__,(__y_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __x_iterator.next(__context__,(__x_rename_at_27)) && __y_iterator.next(__context__,(__y_rename_at_27)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_27) == (*__y_rename_at_27)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_27));
+		__y_iterator.close(__context__,(__y_rename_at_27));
+	};
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_each_49ba41ea6e9b0c25
+		aotLib[0x6a4a051ab138a935] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_49ba41ea6e9b0c25>>();
+	};
+		// _Funcbuiltin_0x60_each_502cf4052c9233a
+		aotLib[0x2961eb8143b902c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Funcbuiltin_0x60_each_502cf4052c9233a>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_to_array_e7337cf490aef504
+		aotLib[0xb019749877860f09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcbuiltin_0x60_to_array_e7337cf490aef504>>();
+	};
+		// _Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa
+		aotLib[0xe82facb3d4281305] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  ),&_Funcbuiltin_0x60_to_array_b31bd2606ff1e1aa>>();
+	};
+		// _Funcbuiltin_0x60_to_array_d45ac51cb08b659f
+		aotLib[0xdd2eb1e5815397d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t &)) const  &  ),&_Funcbuiltin_0x60_to_array_d45ac51cb08b659f>>();
+	};
+		// _Funcbuiltin_0x60_to_array_aeabe5f727e6c5be
+		aotLib[0x8b20e20e4f121c65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Funcbuiltin_0x60_to_array_aeabe5f727e6c5be>>();
+	};
+		// test_508792c8076c3b70
+		aotLib[0x1afc723bf556111b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_508792c8076c3b70>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,161 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Funcbuiltin_0x60_reserve_224e7011ac915236 ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_37, int32_t __newSize_rename_at_37 );
+inline TTable<int32_t,char *> _Funcbuiltin_0x60_to_table_e184fe73d65c6744 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  & __a_rename_at_412 );
+inline bool test_f1b9138999063009 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_reserve_224e7011ac915236 ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_37, int32_t __newSize_rename_at_37 )
+{
+	builtin_table_reserve(das_arg<TTable<int32_t,char *>>::pass(__Tab_rename_at_37),__newSize_rename_at_37,4,8,__context__);
+}
+
+inline TTable<int32_t,char *> _Funcbuiltin_0x60_to_table_e184fe73d65c6744 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  &  __a_rename_at_412 )
+{
+	TTable<int32_t,char *> __tab_rename_at_413; das_zero(__tab_rename_at_413);
+	_Funcbuiltin_0x60_reserve_224e7011ac915236(__context__,das_arg<TTable<int32_t,char *>>::pass(__tab_rename_at_413),3);
+	{
+		bool __need_loop_415 = true;
+		// x : tuple<int aka keyT;string aka valT> const&
+		das_iterator<TDim<TTuple<16,int32_t,char *>,3> const > __x_iterator(__a_rename_at_412);
+		TTuple<16,int32_t,char *> const  * __x_rename_at_415;
+		__need_loop_415 = __x_iterator.first(__context__,(__x_rename_at_415)) && __need_loop_415;
+		for ( ; __need_loop_415 ; __need_loop_415 = __x_iterator.next(__context__,(__x_rename_at_415)) )
+		{
+			das_copy(__tab_rename_at_413(das_get_tuple_field<int32_t,0>::get((*__x_rename_at_415)),__context__),das_get_tuple_field<char *,8>::get((*__x_rename_at_415)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_415));
+	};
+	return /* <- */ __tab_rename_at_413;
+}
+
+inline bool test_f1b9138999063009 ( Context * __context__ )
+{
+	TDim<TTuple<16,int32_t,char *>,3> _temp_make_local_4_128;
+	TDim<TTuple<16,int32_t,char *>,3> __a_rename_at_3 = (TDim<TTuple<16,int32_t,char *>,3>)(([&]() -> TDim<TTuple<16,int32_t,char *>,3> {
+		TDim<TTuple<16,int32_t,char *>,3> __mka_3;
+		__mka_3(0,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_3;
+			das_get_tuple_field<int32_t,0>::get(__mkt_3) = 1;
+			das_get_tuple_field<char *,8>::get(__mkt_3) = ((char *) "one");
+			return __mkt_3;
+		})());
+		__mka_3(1,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_3;
+			das_get_tuple_field<int32_t,0>::get(__mkt_3) = 2;
+			das_get_tuple_field<char *,8>::get(__mkt_3) = ((char *) "two");
+			return __mkt_3;
+		})());
+		__mka_3(2,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_3;
+			das_get_tuple_field<int32_t,0>::get(__mkt_3) = 3;
+			das_get_tuple_field<char *,8>::get(__mkt_3) = ((char *) "three");
+			return __mkt_3;
+		})());
+		return __mka_3;
+	})());
+	TTable<int32_t,char *> __b_rename_at_4; das_zero(__b_rename_at_4); das_move(__b_rename_at_4, _Funcbuiltin_0x60_to_table_e184fe73d65c6744(__context__,das_arg<TDim<TTuple<16,int32_t,char *>,3>>::pass((([&]() -> TDim<TTuple<16,int32_t,char *>,3>& {
+		_temp_make_local_4_128(0,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_4;
+			das_get_tuple_field<int32_t,0>::get(__mkt_4) = 1;
+			das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "one");
+			return __mkt_4;
+		})());
+		_temp_make_local_4_128(1,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_4;
+			das_get_tuple_field<int32_t,0>::get(__mkt_4) = 2;
+			das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "two");
+			return __mkt_4;
+		})());
+		_temp_make_local_4_128(2,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_4;
+			das_get_tuple_field<int32_t,0>::get(__mkt_4) = 3;
+			das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "three");
+			return __mkt_4;
+		})());
+		return _temp_make_local_4_128;
+	})()))));
+	{
+		bool __need_loop_5 = true;
+		// t : tuple<int;string> const&
+		das_iterator<TDim<TTuple<16,int32_t,char *>,3> const > __t_iterator(__a_rename_at_3);
+		TTuple<16,int32_t,char *> const  * __t_rename_at_5;
+		__need_loop_5 = __t_iterator.first(__context__,(__t_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __t_iterator.next(__context__,(__t_rename_at_5)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__b_rename_at_4(das_get_tuple_field<int32_t,0>::get((*__t_rename_at_5)),__context__)),cast<char *>::from(das_get_tuple_field<char *,8>::get((*__t_rename_at_5))),*__context__)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_5));
+	};
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_reserve_224e7011ac915236
+		aotLib[0x2a024ebf093d1985] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_224e7011ac915236>>();
+	};
+		// _Funcbuiltin_0x60_to_table_e184fe73d65c6744
+		aotLib[0xe11b733bf618be5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,char *> (*) ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  &  ),&_Funcbuiltin_0x60_to_table_e184fe73d65c6744>>();
+	};
+		// test_f1b9138999063009
+		aotLib[0xe8cd8ea2de3f3d08] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f1b9138999063009>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,367 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> & __a_rename_at_232, TArray<int32_t> const  & __b_rename_at_232 );
+inline TTuple<32,int32_t,float,TArray<int32_t>> _Funcbuiltin_0x60_clone_to_move_2b53a2b756aa26c ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> const  & __clone_src_rename_at_220 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_285 );
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void clone_4a074da664d9a3a3 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & __dest_rename_at_222, TTuple<32,int32_t,float,TArray<int32_t>> const  & __src_rename_at_222 );
+inline void finalize_35e559421a66a284 ( Context * __context__, TTuple<8,int32_t,float> * & ____this_rename_at_55 );
+inline void finalize_b32790cd9509405e ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & ____this_rename_at_18 );
+inline void finalize_815698fa6c068f23 ( Context * __context__, TTuple<8,int32_t,float> & ____this_rename_at_55 );
+inline bool test_f95f3a64d2ba0a6e ( Context * __context__ );
+inline bool testF_362771211eba0de9 ( Context * __context__, TTuple<8,int32_t,float> const  & __arg_rename_at_6 );
+inline bool testFinalizeAndClone_f1cf9dec675dd490 ( Context * __context__ );
+inline bool testI_7fab2869c28a13ee ( Context * __context__, TTuple<8,int32_t,float> const  & __arg_rename_at_3 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_9217fda5fb53190b ( Context * __context__, TArray<int32_t> &  __a_rename_at_232, TArray<int32_t> const  &  __b_rename_at_232 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_232),builtin_array_size(__b_rename_at_232));
+	{
+		bool __need_loop_234 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_232);
+		int32_t * __aV_rename_at_234;
+		__need_loop_234 = __aV_iterator.first(__context__,(__aV_rename_at_234)) && __need_loop_234;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_232);
+		int32_t const  * __bV_rename_at_234;
+		__need_loop_234 = __bV_iterator.first(__context__,(__bV_rename_at_234)) && __need_loop_234;
+		for ( ; __need_loop_234 ; __need_loop_234 = __aV_iterator.next(__context__,(__aV_rename_at_234)) && __bV_iterator.next(__context__,(__bV_rename_at_234)) )
+		{
+			das_copy((*__aV_rename_at_234),(*__bV_rename_at_234));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_234));
+		__bV_iterator.close(__context__,(__bV_rename_at_234));
+	};
+}
+
+inline TTuple<32,int32_t,float,TArray<int32_t>> _Funcbuiltin_0x60_clone_to_move_2b53a2b756aa26c ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> const  &  __clone_src_rename_at_220 )
+{
+	TTuple<32,int32_t,float,TArray<int32_t>> __clone_dest_rename_at_221; das_zero(__clone_dest_rename_at_221);
+	clone_4a074da664d9a3a3(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__clone_dest_rename_at_221),__clone_src_rename_at_220);
+	return /* <- */ __clone_dest_rename_at_221;
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_285 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_285),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d7f619259dc926c6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_40, int32_t __value_rename_at_40, int32_t __at_rename_at_40 )
+{
+	das_copy(__Arr_rename_at_40(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_40),__at_rename_at_40,4,__context__),__context__),__value_rename_at_40);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void clone_4a074da664d9a3a3 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  __dest_rename_at_222, TTuple<32,int32_t,float,TArray<int32_t>> const  &  __src_rename_at_222 )
+{
+	das_copy(das_get_tuple_field<int32_t,0>::get(__dest_rename_at_222),das_get_tuple_field<int32_t,0>::get(__src_rename_at_222));
+	das_copy(das_get_tuple_field<float,4>::get(__dest_rename_at_222),das_get_tuple_field<float,4>::get(__src_rename_at_222));
+	_Funcbuiltin_0x60_clone_9217fda5fb53190b(__context__,das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(__dest_rename_at_222)),das_get_tuple_field<TArray<int32_t>,8>::get(__src_rename_at_222));
+}
+
+inline void finalize_35e559421a66a284 ( Context * __context__, TTuple<8,int32_t,float> * & ____this_rename_at_55 )
+{
+	if ( ____this_rename_at_55 != nullptr )
+	{
+		finalize_815698fa6c068f23(__context__,das_arg<TTuple<8,int32_t,float>>::pass(das_deref(__context__,____this_rename_at_55)));
+		das_delete<TTuple<8,int32_t,float> *>::clear(__context__,____this_rename_at_55);
+		das_copy(____this_rename_at_55,nullptr);
+	};
+}
+
+inline void finalize_b32790cd9509405e ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  ____this_rename_at_18 )
+{
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(____this_rename_at_18)));
+	memset(&(____this_rename_at_18), 0, 32);
+}
+
+inline void finalize_815698fa6c068f23 ( Context * __context__, TTuple<8,int32_t,float> &  ____this_rename_at_55 )
+{
+	memset(&(____this_rename_at_55), 0, 8);
+}
+
+inline bool test_f95f3a64d2ba0a6e ( Context * __context__ )
+{
+	TTuple<8,int32_t,float> __ttt_rename_at_27 = (TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_27;
+		das_get_tuple_field<int32_t,0>::get(__mkt_27) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_27) = 3.14f;
+		return __mkt_27;
+	})());
+	DAS_ASSERT((testI_7fab2869c28a13ee(__context__,__ttt_rename_at_27)));
+	DAS_ASSERT((testF_362771211eba0de9(__context__,__ttt_rename_at_27)));
+	DAS_ASSERT((das_get_tuple_field<int32_t,0>::get(__ttt_rename_at_27) == 1));
+	DAS_ASSERT((das_get_tuple_field<float,4>::get(__ttt_rename_at_27) == 3.14f));
+	TTuple<16,int32_t,float,char *> __t_rename_at_32; das_zero(__t_rename_at_32);
+	das_copy(das_get_tuple_field<int32_t,0>::get(__t_rename_at_32),1);
+	das_copy(das_get_tuple_field<float,4>::get(__t_rename_at_32),2.f);
+	das_copy(das_get_tuple_field<char *,8>::get(__t_rename_at_32),((char *) "3"));
+	TTuple<16,int32_t,float,char *> __q_rename_at_37 = __t_rename_at_32;
+	DAS_ASSERT((das_get_tuple_field<int32_t,0>::get(__q_rename_at_37) == 1));
+	DAS_ASSERT((das_get_tuple_field<float,4>::get(__q_rename_at_37) == 2.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_tuple_field<char *,8>::get(__q_rename_at_37)),cast<char *>::from(((char *) "3")),*__context__)));
+	TTuple<16,int32_t,float,char *> * __pq_rename_at_42 = das_ref(__context__,__q_rename_at_37);
+	DAS_ASSERT((das_get_tuple_field_ptr<int32_t,0>::get(__pq_rename_at_42) == 1));
+	DAS_ASSERT((das_get_tuple_field_ptr<float,4>::get(__pq_rename_at_42) == 2.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_tuple_field_ptr<char *,8>::get(__pq_rename_at_42)),cast<char *>::from(((char *) "3")),*__context__)));
+	DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_tuple<int32_t, 0>::get(__pq_rename_at_42),0) == 1));
+	DAS_ASSERT((das_null_coalescing<float>::get(das_safe_navigation_tuple<float, 4>::get(__pq_rename_at_42),0.f) == 2.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_null_coalescing<char * const >::get(das_safe_navigation_tuple<char *, 8>::get(__pq_rename_at_42),((char *) "nothing"))),cast<char *>::from(((char *) "3")),*__context__)));
+	TTuple<8,int32_t,float> * __qq_rename_at_49 = das_new<TTuple<8,int32_t,float>>::make(__context__);
+	das_copy(das_get_tuple_field_ptr<int32_t,0>::get(__qq_rename_at_49),1);
+	das_copy(das_get_tuple_field_ptr<float,4>::get(__qq_rename_at_49),2.f);
+	DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_tuple<int32_t, 0>::get(__qq_rename_at_49),0) == 1));
+	DAS_ASSERT((das_null_coalescing<float>::get(das_safe_navigation_tuple<float, 4>::get(__qq_rename_at_49),0.f) == 2.f));
+	finalize_35e559421a66a284(__context__,__qq_rename_at_49);
+	TTuple<8,int32_t,float> __mkt_rename_at_57 = (TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_57;
+		das_get_tuple_field<int32_t,0>::get(__mkt_57) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_57) = 2.f;
+		return __mkt_57;
+	})());
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkt_rename_at_57) == 1) && (das_get_tuple_field<float,4>::get(__mkt_rename_at_57) == 2.f)));
+	TDim<TTuple<8,int32_t,float>,2> __mkta_rename_at_59 = (TDim<TTuple<8,int32_t,float>,2>)(([&]() -> TDim<TTuple<8,int32_t,float>,2> {
+		TDim<TTuple<8,int32_t,float>,2> __mka_59;
+		__mka_59(0,__context__) = (([&]() -> TTuple<8,int32_t,float> {
+			TTuple<8,int32_t,float> __mkt_59;
+			das_get_tuple_field<int32_t,0>::get(__mkt_59) = 1;
+			das_get_tuple_field<float,4>::get(__mkt_59) = 2.f;
+			return __mkt_59;
+		})());
+		__mka_59(1,__context__) = (([&]() -> TTuple<8,int32_t,float> {
+			TTuple<8,int32_t,float> __mkt_59;
+			das_get_tuple_field<int32_t,0>::get(__mkt_59) = 3;
+			das_get_tuple_field<float,4>::get(__mkt_59) = 4.f;
+			return __mkt_59;
+		})());
+		return __mka_59;
+	})());
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkta_rename_at_59(0,__context__)) == 1) && (das_get_tuple_field<float,4>::get(__mkta_rename_at_59(0,__context__)) == 2.f)));
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkta_rename_at_59(1,__context__)) == 3) && (das_get_tuple_field<float,4>::get(__mkta_rename_at_59(1,__context__)) == 4.f)));
+	TDim<int32_t,4> __ti_rename_at_63 = (TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+		TDim<int32_t,4> __mka_63;
+		__mka_63(0,__context__) = 1;
+		__mka_63(1,__context__) = 2;
+		__mka_63(2,__context__) = 3;
+		__mka_63(3,__context__) = 4;
+		return __mka_63;
+	})());
+	DAS_ASSERT(((((__ti_rename_at_63(0,__context__) == 1) && (__ti_rename_at_63(1,__context__) == 2)) && (__ti_rename_at_63(2,__context__) == 3)) && (__ti_rename_at_63(3,__context__) == 4)));
+	TDim<TTuple<8,int32_t,int32_t>,2> __tt_rename_at_66 = (TDim<TTuple<8,int32_t,int32_t>,2>)(([&]() -> TDim<TTuple<8,int32_t,int32_t>,2> {
+		TDim<TTuple<8,int32_t,int32_t>,2> __mka_66;
+		__mka_66(0,__context__) = (([&]() -> TTuple<8,int32_t,int32_t> {
+			TTuple<8,int32_t,int32_t> __mkt_66;
+			das_get_tuple_field<int32_t,0>::get(__mkt_66) = 1;
+			das_get_tuple_field<int32_t,4>::get(__mkt_66) = 2;
+			return __mkt_66;
+		})());
+		__mka_66(1,__context__) = (([&]() -> TTuple<8,int32_t,int32_t> {
+			TTuple<8,int32_t,int32_t> __mkt_66;
+			das_get_tuple_field<int32_t,0>::get(__mkt_66) = 3;
+			das_get_tuple_field<int32_t,4>::get(__mkt_66) = 4;
+			return __mkt_66;
+		})());
+		return __mka_66;
+	})());
+	DAS_ASSERT(((((das_get_tuple_field<int32_t,0>::get(__tt_rename_at_66(0,__context__)) == 1) && (das_get_tuple_field<int32_t,4>::get(__tt_rename_at_66(0,__context__)) == 2)) && (das_get_tuple_field<int32_t,0>::get(__tt_rename_at_66(1,__context__)) == 3)) && (das_get_tuple_field<int32_t,4>::get(__tt_rename_at_66(1,__context__)) == 4)));
+	TTuple<8,int32_t,float> __tq_rename_at_69 = (TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_69;
+		das_get_tuple_field<int32_t,0>::get(__mkt_69) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_69) = 2.f;
+		return __mkt_69;
+	})());
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__tq_rename_at_69) == 1) && (das_get_tuple_field<float,4>::get(__tq_rename_at_69) == 2.f)));
+	testFinalizeAndClone_f1cf9dec675dd490(__context__);
+	return true;
+}
+
+inline bool testF_362771211eba0de9 ( Context * __context__, TTuple<8,int32_t,float> const  &  __arg_rename_at_6 )
+{
+	return das_get_tuple_field<float,4>::get(__arg_rename_at_6) == 3.14f;
+}
+
+inline bool testFinalizeAndClone_f1cf9dec675dd490 ( Context * __context__ )
+{
+	TTuple<32,int32_t,float,TArray<int32_t>> __x_rename_at_10; das_zero(__x_rename_at_10);
+	das_copy(das_get_tuple_field<int32_t,0>::get(__x_rename_at_10),1);
+	das_copy(das_get_tuple_field<float,4>::get(__x_rename_at_10),2.f);
+	das_move(das_get_tuple_field<TArray<int32_t>,8>::get(__x_rename_at_10),das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_13_rename_at_13; das_zero(____acomp_13_rename_at_13);
+		_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(____acomp_13_rename_at_13),10);
+		{
+			bool __need_loop_13 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_13;
+			__need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13)) && __need_loop_13;
+			for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13)) )
+			{
+				_Funcbuiltin_0x60_push_d7f619259dc926c6(__context__,das_arg<TArray<int32_t>>::pass(____acomp_13_rename_at_13),__x_rename_at_13,-1);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_13));
+		};
+		return /* <- */ ____acomp_13_rename_at_13;
+	}));
+	TTuple<32,int32_t,float,TArray<int32_t>> __y_rename_at_14; das_zero(__y_rename_at_14); das_move(__y_rename_at_14, _Funcbuiltin_0x60_clone_to_move_2b53a2b756aa26c(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__x_rename_at_10)));
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__y_rename_at_14) == 1) && (das_get_tuple_field<float,4>::get(__y_rename_at_14) == 2.f)));
+	{
+		bool __need_loop_16 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_16;
+		__need_loop_16 = __t_iterator.first(__context__,(__t_rename_at_16)) && __need_loop_16;
+		for ( ; __need_loop_16 ; __need_loop_16 = __t_iterator.next(__context__,(__t_rename_at_16)) )
+		{
+			DAS_ASSERT((das_get_tuple_field<TArray<int32_t>,8>::get(__y_rename_at_14)(__t_rename_at_16,__context__) == __t_rename_at_16));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_16));
+	};
+	finalize_b32790cd9509405e(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__x_rename_at_10));
+	DAS_ASSERT((((das_get_tuple_field<int32_t,0>::get(__x_rename_at_10) == 0) && (das_get_tuple_field<float,4>::get(__x_rename_at_10) == 0.f)) && (builtin_array_size(das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(__x_rename_at_10))) == 0)));
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__y_rename_at_14) == 1) && (das_get_tuple_field<float,4>::get(__y_rename_at_14) == 2.f)));
+	{
+		bool __need_loop_21 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_21;
+		__need_loop_21 = __t_iterator.first(__context__,(__t_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __t_iterator.next(__context__,(__t_rename_at_21)) )
+		{
+			DAS_ASSERT((das_get_tuple_field<TArray<int32_t>,8>::get(__y_rename_at_14)(__t_rename_at_21,__context__) == __t_rename_at_21));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_21));
+	};
+	return true;
+}
+
+inline bool testI_7fab2869c28a13ee ( Context * __context__, TTuple<8,int32_t,float> const  &  __arg_rename_at_3 )
+{
+	return das_get_tuple_field<int32_t,0>::get(__arg_rename_at_3) == 1;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_9217fda5fb53190b
+		aotLib[0xb00d3e185e494e59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_9217fda5fb53190b>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_2b53a2b756aa26c
+		aotLib[0xf695f0f416764423] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<32,int32_t,float,TArray<int32_t>> (*) ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> const  &  ),&_Funcbuiltin_0x60_clone_to_move_2b53a2b756aa26c>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_d7f619259dc926c6
+		aotLib[0x7c1d8142a521fc3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_d7f619259dc926c6>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// clone_4a074da664d9a3a3
+		aotLib[0xed78640d96dcd46c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & , TTuple<32,int32_t,float,TArray<int32_t>> const  &  ),&clone_4a074da664d9a3a3>>();
+	};
+		// finalize_35e559421a66a284
+		aotLib[0xad1f2046c639e1be] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<8,int32_t,float> * &  ),&finalize_35e559421a66a284>>();
+	};
+		// finalize_b32790cd9509405e
+		aotLib[0xd576356d12a8899e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  ),&finalize_b32790cd9509405e>>();
+	};
+		// finalize_815698fa6c068f23
+		aotLib[0x748c10b2aaee4581] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<8,int32_t,float> &  ),&finalize_815698fa6c068f23>>();
+	};
+		// test_f95f3a64d2ba0a6e
+		aotLib[0x5a5148f1b95e130] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f95f3a64d2ba0a6e>>();
+	};
+		// testF_362771211eba0de9
+		aotLib[0x3ee6dfbbadbb6615] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTuple<8,int32_t,float> const  &  ),&testF_362771211eba0de9>>();
+	};
+		// testFinalizeAndClone_f1cf9dec675dd490
+		aotLib[0x4b2ceacc3dd22218] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&testFinalizeAndClone_f1cf9dec675dd490>>();
+	};
+		// testI_7fab2869c28a13ee
+		aotLib[0x42f7aa41f3b8875] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTuple<8,int32_t,float> const  &  ),&testI_7fab2869c28a13ee>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
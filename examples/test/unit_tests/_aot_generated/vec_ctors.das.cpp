@@ -0,0 +1,500 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__740c25f4;
+extern TypeInfo __type_info__3ecb204a;
+extern TypeInfo __type_info__1b8e3737;
+extern TypeInfo __type_info__e85a7bd9;
+extern TypeInfo __type_info__fa1173df;
+extern TypeInfo __type_info__eb7e9af3;
+extern TypeInfo __type_info__2355d12e;
+extern TypeInfo __type_info__23010b35;
+extern TypeInfo __type_info__90875dde;
+extern TypeInfo __type_info__769fac09;
+extern TypeInfo __type_info__5ec89b2;
+
+TypeInfo __type_info__740c25f4 = { Type::tInt2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x740c25f4 };
+TypeInfo __type_info__3ecb204a = { Type::tUInt3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x3ecb204a };
+TypeInfo __type_info__1b8e3737 = { Type::tUInt4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x1b8e3737 };
+TypeInfo __type_info__e85a7bd9 = { Type::tURange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xe85a7bd9 };
+TypeInfo __type_info__fa1173df = { Type::tInt3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xfa1173df };
+TypeInfo __type_info__eb7e9af3 = { Type::tFloat4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0xeb7e9af3 };
+TypeInfo __type_info__2355d12e = { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x2355d12e };
+TypeInfo __type_info__23010b35 = { Type::tUInt2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x23010b35 };
+TypeInfo __type_info__90875dde = { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x90875dde };
+TypeInfo __type_info__769fac09 = { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x769fac09 };
+TypeInfo __type_info__5ec89b2 = { Type::tInt4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2108, 0x5ec89b2 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__769fac09 };
+TypeInfo * __tinfo_1[1] = { &__type_info__769fac09 };
+TypeInfo * __tinfo_2[1] = { &__type_info__769fac09 };
+TypeInfo * __tinfo_3[1] = { &__type_info__769fac09 };
+TypeInfo * __tinfo_4[1] = { &__type_info__769fac09 };
+TypeInfo * __tinfo_5[1] = { &__type_info__769fac09 };
+TypeInfo * __tinfo_6[1] = { &__type_info__769fac09 };
+TypeInfo * __tinfo_7[1] = { &__type_info__769fac09 };
+TypeInfo * __tinfo_8[1] = { &__type_info__769fac09 };
+TypeInfo * __tinfo_9[1] = { &__type_info__740c25f4 };
+TypeInfo * __tinfo_10[1] = { &__type_info__740c25f4 };
+TypeInfo * __tinfo_11[1] = { &__type_info__740c25f4 };
+TypeInfo * __tinfo_12[1] = { &__type_info__740c25f4 };
+TypeInfo * __tinfo_13[1] = { &__type_info__740c25f4 };
+TypeInfo * __tinfo_14[1] = { &__type_info__740c25f4 };
+TypeInfo * __tinfo_15[1] = { &__type_info__740c25f4 };
+TypeInfo * __tinfo_16[1] = { &__type_info__740c25f4 };
+TypeInfo * __tinfo_17[1] = { &__type_info__740c25f4 };
+TypeInfo * __tinfo_18[1] = { &__type_info__2355d12e };
+TypeInfo * __tinfo_19[1] = { &__type_info__2355d12e };
+TypeInfo * __tinfo_20[1] = { &__type_info__2355d12e };
+TypeInfo * __tinfo_21[1] = { &__type_info__2355d12e };
+TypeInfo * __tinfo_22[1] = { &__type_info__2355d12e };
+TypeInfo * __tinfo_23[1] = { &__type_info__2355d12e };
+TypeInfo * __tinfo_24[1] = { &__type_info__2355d12e };
+TypeInfo * __tinfo_25[1] = { &__type_info__2355d12e };
+TypeInfo * __tinfo_26[1] = { &__type_info__2355d12e };
+TypeInfo * __tinfo_27[1] = { &__type_info__23010b35 };
+TypeInfo * __tinfo_28[1] = { &__type_info__23010b35 };
+TypeInfo * __tinfo_29[1] = { &__type_info__23010b35 };
+TypeInfo * __tinfo_30[1] = { &__type_info__23010b35 };
+TypeInfo * __tinfo_31[1] = { &__type_info__23010b35 };
+TypeInfo * __tinfo_32[1] = { &__type_info__23010b35 };
+TypeInfo * __tinfo_33[1] = { &__type_info__23010b35 };
+TypeInfo * __tinfo_34[1] = { &__type_info__23010b35 };
+TypeInfo * __tinfo_35[1] = { &__type_info__23010b35 };
+TypeInfo * __tinfo_36[1] = { &__type_info__e85a7bd9 };
+TypeInfo * __tinfo_37[1] = { &__type_info__e85a7bd9 };
+TypeInfo * __tinfo_38[1] = { &__type_info__e85a7bd9 };
+TypeInfo * __tinfo_39[1] = { &__type_info__e85a7bd9 };
+TypeInfo * __tinfo_40[1] = { &__type_info__e85a7bd9 };
+TypeInfo * __tinfo_41[1] = { &__type_info__e85a7bd9 };
+TypeInfo * __tinfo_42[1] = { &__type_info__e85a7bd9 };
+TypeInfo * __tinfo_43[1] = { &__type_info__e85a7bd9 };
+TypeInfo * __tinfo_44[1] = { &__type_info__e85a7bd9 };
+TypeInfo * __tinfo_45[1] = { &__type_info__90875dde };
+TypeInfo * __tinfo_46[1] = { &__type_info__90875dde };
+TypeInfo * __tinfo_47[1] = { &__type_info__90875dde };
+TypeInfo * __tinfo_48[1] = { &__type_info__90875dde };
+TypeInfo * __tinfo_49[1] = { &__type_info__90875dde };
+TypeInfo * __tinfo_50[1] = { &__type_info__90875dde };
+TypeInfo * __tinfo_51[1] = { &__type_info__90875dde };
+TypeInfo * __tinfo_52[1] = { &__type_info__90875dde };
+TypeInfo * __tinfo_53[1] = { &__type_info__90875dde };
+TypeInfo * __tinfo_54[1] = { &__type_info__fa1173df };
+TypeInfo * __tinfo_55[1] = { &__type_info__fa1173df };
+TypeInfo * __tinfo_56[1] = { &__type_info__fa1173df };
+TypeInfo * __tinfo_57[1] = { &__type_info__fa1173df };
+TypeInfo * __tinfo_58[1] = { &__type_info__fa1173df };
+TypeInfo * __tinfo_59[1] = { &__type_info__fa1173df };
+TypeInfo * __tinfo_60[1] = { &__type_info__fa1173df };
+TypeInfo * __tinfo_61[1] = { &__type_info__fa1173df };
+TypeInfo * __tinfo_62[1] = { &__type_info__fa1173df };
+TypeInfo * __tinfo_63[1] = { &__type_info__3ecb204a };
+TypeInfo * __tinfo_64[1] = { &__type_info__3ecb204a };
+TypeInfo * __tinfo_65[1] = { &__type_info__3ecb204a };
+TypeInfo * __tinfo_66[1] = { &__type_info__3ecb204a };
+TypeInfo * __tinfo_67[1] = { &__type_info__3ecb204a };
+TypeInfo * __tinfo_68[1] = { &__type_info__3ecb204a };
+TypeInfo * __tinfo_69[1] = { &__type_info__3ecb204a };
+TypeInfo * __tinfo_70[1] = { &__type_info__3ecb204a };
+TypeInfo * __tinfo_71[1] = { &__type_info__3ecb204a };
+TypeInfo * __tinfo_72[1] = { &__type_info__eb7e9af3 };
+TypeInfo * __tinfo_73[1] = { &__type_info__eb7e9af3 };
+TypeInfo * __tinfo_74[1] = { &__type_info__eb7e9af3 };
+TypeInfo * __tinfo_75[1] = { &__type_info__eb7e9af3 };
+TypeInfo * __tinfo_76[1] = { &__type_info__eb7e9af3 };
+TypeInfo * __tinfo_77[1] = { &__type_info__eb7e9af3 };
+TypeInfo * __tinfo_78[1] = { &__type_info__eb7e9af3 };
+TypeInfo * __tinfo_79[1] = { &__type_info__eb7e9af3 };
+TypeInfo * __tinfo_80[1] = { &__type_info__eb7e9af3 };
+TypeInfo * __tinfo_81[1] = { &__type_info__5ec89b2 };
+TypeInfo * __tinfo_82[1] = { &__type_info__5ec89b2 };
+TypeInfo * __tinfo_83[1] = { &__type_info__5ec89b2 };
+TypeInfo * __tinfo_84[1] = { &__type_info__5ec89b2 };
+TypeInfo * __tinfo_85[1] = { &__type_info__5ec89b2 };
+TypeInfo * __tinfo_86[1] = { &__type_info__5ec89b2 };
+TypeInfo * __tinfo_87[1] = { &__type_info__5ec89b2 };
+TypeInfo * __tinfo_88[1] = { &__type_info__5ec89b2 };
+TypeInfo * __tinfo_89[1] = { &__type_info__5ec89b2 };
+TypeInfo * __tinfo_90[1] = { &__type_info__1b8e3737 };
+TypeInfo * __tinfo_91[1] = { &__type_info__1b8e3737 };
+TypeInfo * __tinfo_92[1] = { &__type_info__1b8e3737 };
+TypeInfo * __tinfo_93[1] = { &__type_info__1b8e3737 };
+TypeInfo * __tinfo_94[1] = { &__type_info__1b8e3737 };
+TypeInfo * __tinfo_95[1] = { &__type_info__1b8e3737 };
+TypeInfo * __tinfo_96[1] = { &__type_info__1b8e3737 };
+TypeInfo * __tinfo_97[1] = { &__type_info__1b8e3737 };
+TypeInfo * __tinfo_98[1] = { &__type_info__1b8e3737 };
+
+inline void _Func_0x60_test_vec2_640028a2f8ced53a ( Context * __context__, float2 __a_rename_at_6 );
+inline void _Func_0x60_test_vec2_f73b466ed8213e8f ( Context * __context__, int2 __a_rename_at_6 );
+inline void _Func_0x60_test_vec2_a1548e4028fd4e0d ( Context * __context__, range __a_rename_at_6 );
+inline void _Func_0x60_test_vec2_9a1425be9debe5f0 ( Context * __context__, uint2 __a_rename_at_6 );
+inline void _Func_0x60_test_vec2_fb5ac7dfa19c29f4 ( Context * __context__, urange __a_rename_at_6 );
+inline void _Func_0x60_test_vec3_8493f65ad895fafc ( Context * __context__, float3 __a_rename_at_26 );
+inline void _Func_0x60_test_vec3_e68ba8b6726733b9 ( Context * __context__, int3 __a_rename_at_26 );
+inline void _Func_0x60_test_vec3_6fe64e42949dd5b4 ( Context * __context__, uint3 __a_rename_at_26 );
+inline void _Func_0x60_test_vec4_ca2e25f71889db96 ( Context * __context__, float4 __a_rename_at_46 );
+inline void _Func_0x60_test_vec4_2feb7fa24a455e33 ( Context * __context__, int4 __a_rename_at_46 );
+inline void _Func_0x60_test_vec4_a90fabbe426a98e4 ( Context * __context__, uint4 __a_rename_at_46 );
+inline bool test_c5af2246a043667e ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_test_vec2_640028a2f8ced53a ( Context * __context__, float2 __a_rename_at_6 )
+{
+	float2 __f2_0_rename_at_7 = (float2)v_zero();
+	float2 __f2_x_rename_at_8 = (float2)v_make_vec4f(1.f,2.f,0.f,0.f);
+	float2 __f2_y_rename_at_9 = (float2)v_make_vec4f(1.f,2.f,0.f,0.f);
+	float2 __f2_z_rename_at_10 = (float2)v_make_vec4f(1.f,2.f,0.f,0.f);
+	float2 __f2_w_rename_at_11 = (float2)v_make_vec4f(1.f,2.f,0.f,0.f);
+	float2 __f2_xx_rename_at_12 = (float2)v_splats(1.f);
+	float2 __f2_yy_rename_at_13 = (float2)v_splats(1.f);
+	float2 __f2_zz_rename_at_14 = (float2)v_splats(1.f);
+	float2 __f2_ww_rename_at_15 = (float2)v_splats(1.f);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_0_rename_at_7)))),cast<char *>::from(((char *) "0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<float2>::from(__f2_x_rename_at_8)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<float2>::from(__f2_y_rename_at_9)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_3, cast<float2>::from(__f2_z_rename_at_10)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_4, cast<float2>::from(__f2_w_rename_at_11)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_5, cast<float2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_6, cast<float2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_7, cast<float2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<float2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+}
+
+inline void _Func_0x60_test_vec2_f73b466ed8213e8f ( Context * __context__, int2 __a_rename_at_6 )
+{
+	int2 __f2_0_rename_at_7 = (int2)int2(0,0);
+	int2 __f2_x_rename_at_8 = (int2)int2(1,2);
+	int2 __f2_y_rename_at_9 = (int2)int2(1,2);
+	int2 __f2_z_rename_at_10 = (int2)int2(1,2);
+	int2 __f2_w_rename_at_11 = (int2)int2(1,2);
+	int2 __f2_xx_rename_at_12 = (int2)int2(1,1);
+	int2 __f2_yy_rename_at_13 = (int2)int2(1,1);
+	int2 __f2_zz_rename_at_14 = (int2)int2(1,1);
+	int2 __f2_ww_rename_at_15 = (int2)int2(1,1);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_9, cast<int2>::from(__f2_0_rename_at_7)))),cast<char *>::from(((char *) "0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_10, cast<int2>::from(__f2_x_rename_at_8)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_11, cast<int2>::from(__f2_y_rename_at_9)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_12, cast<int2>::from(__f2_z_rename_at_10)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_13, cast<int2>::from(__f2_w_rename_at_11)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_14, cast<int2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_15, cast<int2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_16, cast<int2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_17, cast<int2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+}
+
+inline void _Func_0x60_test_vec2_a1548e4028fd4e0d ( Context * __context__, range __a_rename_at_6 )
+{
+	range __f2_0_rename_at_7 = (range)range(0,0);
+	range __f2_x_rename_at_8 = (range)range(1,2);
+	range __f2_y_rename_at_9 = (range)range(1,2);
+	range __f2_z_rename_at_10 = (range)range(1,2);
+	range __f2_w_rename_at_11 = (range)range(1,2);
+	range __f2_xx_rename_at_12 = (range)range(1,1);
+	range __f2_yy_rename_at_13 = (range)range(1,1);
+	range __f2_zz_rename_at_14 = (range)range(1,1);
+	range __f2_ww_rename_at_15 = (range)range(1,1);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_18, cast<range>::from(__f2_0_rename_at_7)))),cast<char *>::from(((char *) "0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_19, cast<range>::from(__f2_x_rename_at_8)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_20, cast<range>::from(__f2_y_rename_at_9)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_21, cast<range>::from(__f2_z_rename_at_10)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_22, cast<range>::from(__f2_w_rename_at_11)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_23, cast<range>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_24, cast<range>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_25, cast<range>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<range>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+}
+
+inline void _Func_0x60_test_vec2_9a1425be9debe5f0 ( Context * __context__, uint2 __a_rename_at_6 )
+{
+	uint2 __f2_0_rename_at_7 = (uint2)uint2(0,0);
+	uint2 __f2_x_rename_at_8 = (uint2)uint2(1,2);
+	uint2 __f2_y_rename_at_9 = (uint2)uint2(1,2);
+	uint2 __f2_z_rename_at_10 = (uint2)uint2(1,2);
+	uint2 __f2_w_rename_at_11 = (uint2)uint2(1,2);
+	uint2 __f2_xx_rename_at_12 = (uint2)uint2(1,1);
+	uint2 __f2_yy_rename_at_13 = (uint2)uint2(1,1);
+	uint2 __f2_zz_rename_at_14 = (uint2)uint2(1,1);
+	uint2 __f2_ww_rename_at_15 = (uint2)uint2(1,1);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_27, cast<uint2>::from(__f2_0_rename_at_7)))),cast<char *>::from(((char *) "0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_28, cast<uint2>::from(__f2_x_rename_at_8)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_29, cast<uint2>::from(__f2_y_rename_at_9)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_30, cast<uint2>::from(__f2_z_rename_at_10)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_31, cast<uint2>::from(__f2_w_rename_at_11)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_32, cast<uint2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_33, cast<uint2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_34, cast<uint2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_35, cast<uint2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+}
+
+inline void _Func_0x60_test_vec2_fb5ac7dfa19c29f4 ( Context * __context__, urange __a_rename_at_6 )
+{
+	urange __f2_0_rename_at_7 = (urange)urange(0,0);
+	urange __f2_x_rename_at_8 = (urange)urange(1,2);
+	urange __f2_y_rename_at_9 = (urange)urange(1,2);
+	urange __f2_z_rename_at_10 = (urange)urange(1,2);
+	urange __f2_w_rename_at_11 = (urange)urange(1,2);
+	urange __f2_xx_rename_at_12 = (urange)urange(1,1);
+	urange __f2_yy_rename_at_13 = (urange)urange(1,1);
+	urange __f2_zz_rename_at_14 = (urange)urange(1,1);
+	urange __f2_ww_rename_at_15 = (urange)urange(1,1);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_36, cast<urange>::from(__f2_0_rename_at_7)))),cast<char *>::from(((char *) "0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_37, cast<urange>::from(__f2_x_rename_at_8)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_38, cast<urange>::from(__f2_y_rename_at_9)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_39, cast<urange>::from(__f2_z_rename_at_10)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_40, cast<urange>::from(__f2_w_rename_at_11)))),cast<char *>::from(((char *) "1,2")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_41, cast<urange>::from(__f2_xx_rename_at_12)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_42, cast<urange>::from(__f2_yy_rename_at_13)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_43, cast<urange>::from(__f2_zz_rename_at_14)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<urange>::from(__f2_ww_rename_at_15)))),cast<char *>::from(((char *) "1,1")),*__context__)));
+}
+
+inline void _Func_0x60_test_vec3_8493f65ad895fafc ( Context * __context__, float3 __a_rename_at_26 )
+{
+	float3 __f3_0_rename_at_27 = (float3)v_zero();
+	float3 __f3_x_rename_at_28 = (float3)v_make_vec4f(1.f,2.f,3.f,0.f);
+	float3 __f3_y_rename_at_29 = (float3)v_make_vec4f(1.f,2.f,3.f,0.f);
+	float3 __f3_z_rename_at_30 = (float3)v_make_vec4f(1.f,2.f,3.f,0.f);
+	float3 __f3_w_rename_at_31 = (float3)v_make_vec4f(1.f,2.f,3.f,0.f);
+	float3 __f3_xx_rename_at_32 = (float3)v_splats(1.f);
+	float3 __f3_yy_rename_at_33 = (float3)v_splats(1.f);
+	float3 __f3_zz_rename_at_34 = (float3)v_splats(1.f);
+	float3 __f3_ww_rename_at_35 = (float3)v_splats(1.f);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_45, cast<float3>::from(__f3_0_rename_at_27)))),cast<char *>::from(((char *) "0,0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_46, cast<float3>::from(__f3_x_rename_at_28)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_47, cast<float3>::from(__f3_y_rename_at_29)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_48, cast<float3>::from(__f3_z_rename_at_30)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_49, cast<float3>::from(__f3_w_rename_at_31)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_50, cast<float3>::from(__f3_xx_rename_at_32)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_51, cast<float3>::from(__f3_yy_rename_at_33)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_52, cast<float3>::from(__f3_zz_rename_at_34)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_53, cast<float3>::from(__f3_ww_rename_at_35)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+}
+
+inline void _Func_0x60_test_vec3_e68ba8b6726733b9 ( Context * __context__, int3 __a_rename_at_26 )
+{
+	int3 __f3_0_rename_at_27 = (int3)int3(0,0,0);
+	int3 __f3_x_rename_at_28 = (int3)int3(1,2,3);
+	int3 __f3_y_rename_at_29 = (int3)int3(1,2,3);
+	int3 __f3_z_rename_at_30 = (int3)int3(1,2,3);
+	int3 __f3_w_rename_at_31 = (int3)int3(1,2,3);
+	int3 __f3_xx_rename_at_32 = (int3)int3(1,1,1);
+	int3 __f3_yy_rename_at_33 = (int3)int3(1,1,1);
+	int3 __f3_zz_rename_at_34 = (int3)int3(1,1,1);
+	int3 __f3_ww_rename_at_35 = (int3)int3(1,1,1);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_54, cast<int3>::from(__f3_0_rename_at_27)))),cast<char *>::from(((char *) "0,0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_55, cast<int3>::from(__f3_x_rename_at_28)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_56, cast<int3>::from(__f3_y_rename_at_29)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_57, cast<int3>::from(__f3_z_rename_at_30)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_58, cast<int3>::from(__f3_w_rename_at_31)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_59, cast<int3>::from(__f3_xx_rename_at_32)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_60, cast<int3>::from(__f3_yy_rename_at_33)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_61, cast<int3>::from(__f3_zz_rename_at_34)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int3>::from(__f3_ww_rename_at_35)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+}
+
+inline void _Func_0x60_test_vec3_6fe64e42949dd5b4 ( Context * __context__, uint3 __a_rename_at_26 )
+{
+	uint3 __f3_0_rename_at_27 = (uint3)uint3(0,0,0);
+	uint3 __f3_x_rename_at_28 = (uint3)uint3(1,2,3);
+	uint3 __f3_y_rename_at_29 = (uint3)uint3(1,2,3);
+	uint3 __f3_z_rename_at_30 = (uint3)uint3(1,2,3);
+	uint3 __f3_w_rename_at_31 = (uint3)uint3(1,2,3);
+	uint3 __f3_xx_rename_at_32 = (uint3)uint3(1,1,1);
+	uint3 __f3_yy_rename_at_33 = (uint3)uint3(1,1,1);
+	uint3 __f3_zz_rename_at_34 = (uint3)uint3(1,1,1);
+	uint3 __f3_ww_rename_at_35 = (uint3)uint3(1,1,1);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_63, cast<uint3>::from(__f3_0_rename_at_27)))),cast<char *>::from(((char *) "0,0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_64, cast<uint3>::from(__f3_x_rename_at_28)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_65, cast<uint3>::from(__f3_y_rename_at_29)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_66, cast<uint3>::from(__f3_z_rename_at_30)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_67, cast<uint3>::from(__f3_w_rename_at_31)))),cast<char *>::from(((char *) "1,2,3")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_68, cast<uint3>::from(__f3_xx_rename_at_32)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_69, cast<uint3>::from(__f3_yy_rename_at_33)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_70, cast<uint3>::from(__f3_zz_rename_at_34)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_71, cast<uint3>::from(__f3_ww_rename_at_35)))),cast<char *>::from(((char *) "1,1,1")),*__context__)));
+}
+
+inline void _Func_0x60_test_vec4_ca2e25f71889db96 ( Context * __context__, float4 __a_rename_at_46 )
+{
+	float4 __f4_0_rename_at_47 = (float4)v_zero();
+	float4 __f4_x_rename_at_48 = (float4)v_make_vec4f(1.f,2.f,3.f,4.f);
+	float4 __f4_y_rename_at_49 = (float4)v_make_vec4f(1.f,2.f,3.f,4.f);
+	float4 __f4_z_rename_at_50 = (float4)v_make_vec4f(1.f,2.f,3.f,4.f);
+	float4 __f4_w_rename_at_51 = (float4)v_make_vec4f(1.f,2.f,3.f,4.f);
+	float4 __f4_xx_rename_at_52 = (float4)v_splats(1.f);
+	float4 __f4_yy_rename_at_53 = (float4)v_splats(1.f);
+	float4 __f4_zz_rename_at_54 = (float4)v_splats(1.f);
+	float4 __f4_ww_rename_at_55 = (float4)v_splats(1.f);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_72, cast<float4>::from(__f4_0_rename_at_47)))),cast<char *>::from(((char *) "0,0,0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_73, cast<float4>::from(__f4_x_rename_at_48)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_74, cast<float4>::from(__f4_y_rename_at_49)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_75, cast<float4>::from(__f4_z_rename_at_50)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_76, cast<float4>::from(__f4_w_rename_at_51)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_77, cast<float4>::from(__f4_xx_rename_at_52)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_78, cast<float4>::from(__f4_yy_rename_at_53)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_79, cast<float4>::from(__f4_zz_rename_at_54)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_80, cast<float4>::from(__f4_ww_rename_at_55)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+}
+
+inline void _Func_0x60_test_vec4_2feb7fa24a455e33 ( Context * __context__, int4 __a_rename_at_46 )
+{
+	int4 __f4_0_rename_at_47 = (int4)int4(0,0,0,0);
+	int4 __f4_x_rename_at_48 = (int4)int4(1,2,3,4);
+	int4 __f4_y_rename_at_49 = (int4)int4(1,2,3,4);
+	int4 __f4_z_rename_at_50 = (int4)int4(1,2,3,4);
+	int4 __f4_w_rename_at_51 = (int4)int4(1,2,3,4);
+	int4 __f4_xx_rename_at_52 = (int4)int4(1,1,1,1);
+	int4 __f4_yy_rename_at_53 = (int4)int4(1,1,1,1);
+	int4 __f4_zz_rename_at_54 = (int4)int4(1,1,1,1);
+	int4 __f4_ww_rename_at_55 = (int4)int4(1,1,1,1);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_81, cast<int4>::from(__f4_0_rename_at_47)))),cast<char *>::from(((char *) "0,0,0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_82, cast<int4>::from(__f4_x_rename_at_48)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_83, cast<int4>::from(__f4_y_rename_at_49)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_84, cast<int4>::from(__f4_z_rename_at_50)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_85, cast<int4>::from(__f4_w_rename_at_51)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_86, cast<int4>::from(__f4_xx_rename_at_52)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_87, cast<int4>::from(__f4_yy_rename_at_53)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int4>::from(__f4_zz_rename_at_54)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_89, cast<int4>::from(__f4_ww_rename_at_55)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+}
+
+inline void _Func_0x60_test_vec4_a90fabbe426a98e4 ( Context * __context__, uint4 __a_rename_at_46 )
+{
+	uint4 __f4_0_rename_at_47 = (uint4)uint4(0,0,0,0);
+	uint4 __f4_x_rename_at_48 = (uint4)uint4(1,2,3,4);
+	uint4 __f4_y_rename_at_49 = (uint4)uint4(1,2,3,4);
+	uint4 __f4_z_rename_at_50 = (uint4)uint4(1,2,3,4);
+	uint4 __f4_w_rename_at_51 = (uint4)uint4(1,2,3,4);
+	uint4 __f4_xx_rename_at_52 = (uint4)uint4(1,1,1,1);
+	uint4 __f4_yy_rename_at_53 = (uint4)uint4(1,1,1,1);
+	uint4 __f4_zz_rename_at_54 = (uint4)uint4(1,1,1,1);
+	uint4 __f4_ww_rename_at_55 = (uint4)uint4(1,1,1,1);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_90, cast<uint4>::from(__f4_0_rename_at_47)))),cast<char *>::from(((char *) "0,0,0,0")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_91, cast<uint4>::from(__f4_x_rename_at_48)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_92, cast<uint4>::from(__f4_y_rename_at_49)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_93, cast<uint4>::from(__f4_z_rename_at_50)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_94, cast<uint4>::from(__f4_w_rename_at_51)))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_95, cast<uint4>::from(__f4_xx_rename_at_52)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_96, cast<uint4>::from(__f4_yy_rename_at_53)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_97, cast<uint4>::from(__f4_zz_rename_at_54)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_98, cast<uint4>::from(__f4_ww_rename_at_55)))),cast<char *>::from(((char *) "1,1,1,1")),*__context__)));
+}
+
+inline bool test_c5af2246a043667e ( Context * __context__ )
+{
+	_Func_0x60_test_vec2_640028a2f8ced53a(__context__,v_zero());
+	_Func_0x60_test_vec3_8493f65ad895fafc(__context__,v_zero());
+	_Func_0x60_test_vec4_ca2e25f71889db96(__context__,v_zero());
+	_Func_0x60_test_vec2_f73b466ed8213e8f(__context__,int2(0,0));
+	_Func_0x60_test_vec3_e68ba8b6726733b9(__context__,int3(0,0,0));
+	_Func_0x60_test_vec4_2feb7fa24a455e33(__context__,int4(0,0,0,0));
+	_Func_0x60_test_vec2_9a1425be9debe5f0(__context__,uint2(0,0));
+	_Func_0x60_test_vec3_6fe64e42949dd5b4(__context__,uint3(0,0,0));
+	_Func_0x60_test_vec4_a90fabbe426a98e4(__context__,uint4(0,0,0,0));
+	_Func_0x60_test_vec2_a1548e4028fd4e0d(__context__,range(0,0));
+	_Func_0x60_test_vec2_fb5ac7dfa19c29f4(__context__,urange(0,0));
+	return true;
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_test_vec2_640028a2f8ced53a
+		aotLib[0xee9940752ea96921] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float2  ),&_Func_0x60_test_vec2_640028a2f8ced53a>>();
+	};
+		// _Func_0x60_test_vec2_f73b466ed8213e8f
+		aotLib[0x5bb3defa0b7b3bd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int2  ),&_Func_0x60_test_vec2_f73b466ed8213e8f>>();
+	};
+		// _Func_0x60_test_vec2_a1548e4028fd4e0d
+		aotLib[0x8309cb082a3be35d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, range  ),&_Func_0x60_test_vec2_a1548e4028fd4e0d>>();
+	};
+		// _Func_0x60_test_vec2_9a1425be9debe5f0
+		aotLib[0x430b0377c643e1b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, uint2  ),&_Func_0x60_test_vec2_9a1425be9debe5f0>>();
+	};
+		// _Func_0x60_test_vec2_fb5ac7dfa19c29f4
+		aotLib[0x51f858ef2bd0b895] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, urange  ),&_Func_0x60_test_vec2_fb5ac7dfa19c29f4>>();
+	};
+		// _Func_0x60_test_vec3_8493f65ad895fafc
+		aotLib[0x79e184af32a363cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float3  ),&_Func_0x60_test_vec3_8493f65ad895fafc>>();
+	};
+		// _Func_0x60_test_vec3_e68ba8b6726733b9
+		aotLib[0xdc6f4af301731179] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int3  ),&_Func_0x60_test_vec3_e68ba8b6726733b9>>();
+	};
+		// _Func_0x60_test_vec3_6fe64e42949dd5b4
+		aotLib[0xd3f140c6b7863645] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, uint3  ),&_Func_0x60_test_vec3_6fe64e42949dd5b4>>();
+	};
+		// _Func_0x60_test_vec4_ca2e25f71889db96
+		aotLib[0xe9ada5214dee264d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float4  ),&_Func_0x60_test_vec4_ca2e25f71889db96>>();
+	};
+		// _Func_0x60_test_vec4_2feb7fa24a455e33
+		aotLib[0xe2612c64fde1bdfd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int4  ),&_Func_0x60_test_vec4_2feb7fa24a455e33>>();
+	};
+		// _Func_0x60_test_vec4_a90fabbe426a98e4
+		aotLib[0xe1a1893baef15db5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, uint4  ),&_Func_0x60_test_vec4_a90fabbe426a98e4>>();
+	};
+		// test_c5af2246a043667e
+		aotLib[0xe8414fa6d7cf7d09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c5af2246a043667e>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
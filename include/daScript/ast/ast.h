@@ -944,6 +944,8 @@ namespace das
         bool        persistent_heap = false;
         uint32_t    heap_size_hint = 65536;
         uint32_t    string_heap_size_hint = 65536;
+        uint64_t    heap_size_limit = 0;                // 0 for no limit
+        uint64_t    string_heap_size_limit = 0;         // 0 for no limit
     // rtti
         bool rtti = false;                              // create extended RTTI
     // language
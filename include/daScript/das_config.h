@@ -60,3 +60,15 @@ using das_safe_set = std::set<K,C>;
 #ifndef DAS_FUSION
   #define DAS_FUSION  1
 #endif
+
+// stack size for contexts which run at compile time (macro modules, init scripts during compilation)
+// when the program does not request one, i.e. policies.stack is 0 and the context expects a shared stack
+#ifndef DAS_COMPILE_TIME_STACK_SIZE
+  #define DAS_COMPILE_TIME_STACK_SIZE  16384
+#endif
+
+// tables keep dense entries in insertion order, with a separate slot index, for sequential iteration
+// erase moves the last entry into the hole. costs an extra 4 byte index per slot
+#ifndef DAS_TABLE_DENSE
+  #define DAS_TABLE_DENSE  0
+#endif
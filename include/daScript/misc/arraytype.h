@@ -100,16 +100,51 @@ namespace das
     void array_unlock ( Context & context, Array & arr );
     void array_reserve ( Context & context, Array & arr, uint32_t newCapacity, uint32_t stride );
     void array_resize ( Context & context, Array & arr, uint32_t newSize, uint32_t stride, bool zero );
+    void array_shrink ( Context & context, Array & arr, uint32_t stride );
     void array_clear ( Context & context, Array & arr );
 
     struct Table : Array {
         char *      keys;
         uint32_t *  hashes;
-        uint32_t    maxLookups;
+        uint32_t    tombstones;
         uint32_t    shift;
     };
 
+#if DAS_TABLE_DENSE
+    // table memory is values, then keys, then hashes, then one control byte per slot, then entry index per slot
+    // values, keys and hashes are dense entries. erase moves the last entry into the hole
+    __forceinline uint64_t table_memory_size ( uint32_t capacity, uint64_t keyAndValueSize ) {
+        return uint64_t(capacity) * (keyAndValueSize + sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t));
+    }
+#else
+    // table memory is values, then keys, then hashes, then one control byte per slot
+    __forceinline uint64_t table_memory_size ( uint32_t capacity, uint64_t keyAndValueSize ) {
+        return uint64_t(capacity) * (keyAndValueSize + sizeof(uint32_t) + sizeof(uint8_t));
+    }
+#endif
+
+    __forceinline uint8_t * table_ctrl ( const Table & tab ) {
+        return (uint8_t *)(tab.hashes + tab.capacity);
+    }
+
+#if DAS_TABLE_DENSE
+    __forceinline uint32_t * table_index ( const Table & tab ) {
+        return (uint32_t *)(table_ctrl(tab) + tab.capacity);
+    }
+#endif
+
+    // number of entries iteration goes through. entries with hashes not above HASH_KILLED32 are not in use
+    __forceinline uint32_t table_entries ( const Table & tab ) {
+#if DAS_TABLE_DENSE
+        return tab.size;
+#else
+        return tab.capacity;
+#endif
+    }
+
     void table_clear ( Context & context, Table & arr );
+    void table_shrink ( Context & context, Table & arr, uint32_t keySize, uint32_t valueSize );
+    void table_reserve ( Context & context, Table & arr, uint32_t newSize, uint32_t keySize, uint32_t valueSize );
     void table_lock ( Context & context, Table & arr );
     void table_unlock ( Context & context, Table & arr );
 
@@ -0,0 +1,28 @@
+#pragma once
+
+namespace das {
+
+    // number to text and back, without going through the C library in the common cases
+    // all fmt_ functions write into buf, which has to hold at least DAS_FMT_NUMBER_SIZE characters,
+    // do not terminate it, and return the number of characters written
+
+    #define DAS_FMT_NUMBER_SIZE 32
+
+    int fmt_int32 ( char * buf, int32_t value );
+    int fmt_uint32 ( char * buf, uint32_t value );
+    int fmt_int64 ( char * buf, int64_t value );
+    int fmt_uint64 ( char * buf, uint64_t value );
+    int fmt_hex ( char * buf, uint64_t value );
+
+    // shortest text, which reads back to the same value (grisu2)
+    // the layout is that of printf("%g"), except that there are as many digits as needed
+    int fmt_float ( char * buf, float value );
+    int fmt_double ( char * buf, double value );
+
+    // same results and end pointers as strtol, strtoul, strtod and strtof in the "C" locale
+    // short decimal numbers are converted exactly on a fast path, everything else falls back to the C library
+    int64_t parse_int64 ( const char * str, char ** endptr );
+    uint64_t parse_uint64 ( const char * str, char ** endptr );
+    double parse_double ( const char * str, char ** endptr );
+    float parse_float ( const char * str, char ** endptr );
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace das {
+
+    // minimal pool of worker threads for data parallel builtins, i.e. sort_parallel
+    // jobs run native code only - Context is not thread safe, and jobs must not touch it
+    // calling thread participates in the work, nested parallel_for runs serially
+
+    // number of threads parallel_for spreads the work over, including the calling one
+    uint32_t parallel_thread_count();
+    // limits number of threads, 0 means one per hardware thread. not to be called while parallel_for is running
+    void set_parallel_thread_count ( uint32_t count );
+    // calls job(0)...job(count-1), and waits for all of them to finish
+    void parallel_for ( uint32_t count, const function<void(uint32_t)> & job );
+}
+
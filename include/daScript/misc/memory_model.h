@@ -8,7 +8,7 @@ namespace das {
     void das_track_breakpoint ( uint64_t id );
 #endif
 
-    #define DAS_PAGE_GC_MASK    0x80000000
+    #define DAS_PAGE_GC_MASK    0x8000000000000000ull
 
     struct LineInfo;
 
@@ -16,7 +16,7 @@ namespace das {
         Deck( uint32_t ne, uint32_t es, Deck * n ) {
             total = (ne+31) & ~31;
             size = es;
-            totalBytes = total * size;
+            totalBytes = uint64_t(total) * size;
             data = (char*) das_aligned_alloc16(totalBytes);
             bits = (uint32_t*) das_aligned_alloc16(total / 32 * 4);
             reset();    // this reset before next
@@ -84,7 +84,7 @@ namespace das {
         uint32_t *  bits = nullptr;
         uint32_t    total = 0;
         uint32_t    size = 0;
-        uint32_t    totalBytes = 0;
+        uint64_t    totalBytes = 0;
         uint32_t    look = 0;
         uint32_t    allocated = 0;
         Deck *      next = nullptr;
@@ -176,8 +176,8 @@ namespace das {
                 for ( auto ch = chunks[si]; ch; ch=ch->next ) {
                     d ++;
                     pages ++;
-                    bytes += ch->allocated * ch->size;
-                    totalBytes += ch->total * ch->size + (ch->total/32*4);
+                    bytes += uint64_t(ch->allocated) * ch->size;
+                    totalBytes += uint64_t(ch->total) * ch->size + (ch->total/32*4);
                 }
                 depth = das::max(depth, d);
             }
@@ -200,12 +200,126 @@ namespace das {
         uint64_t totalBytesAllocated ( ) const {
             uint32_t d, p; uint64_t b, t;
             getStats(d, p, b, t);
-            return d;
+            return t;
         }
         Deck *  chunks[DAS_MAX_SHOE_CUNKS];
     };
 
+#define DAS_MAX_BUCKET_ALLOCATION   65536
+#define DAS_MAX_BUCKETS             36
+
+#ifndef DAS_HUGE_MMAP
+    #if defined(__linux__)
+        #define DAS_HUGE_MMAP       1
+    #else
+        #define DAS_HUGE_MMAP       0
+    #endif
+#endif
+
+#define DAS_MIN_HUGE_ALLOCATION     (1024*1024)
+
+    // size-segregated free lists of the medium sized big allocations
+    // sizes are split into 4 classes per power of two, from DAS_MAX_SHOE_ALLOCATION to DAS_MAX_BUCKET_ALLOCATION
+    struct Buckets {
+        struct FreeBlock {
+            FreeBlock * next;
+        };
+        Buckets () {
+            memset ( blocks, 0, sizeof(blocks) );
+            memset ( counts, 0, sizeof(counts) );
+        }
+        ~Buckets () {
+            clear();
+        }
+        static __forceinline bool isBucketSize ( uint64_t size ) {
+            return size>=DAS_MAX_SHOE_ALLOCATION && size<=DAS_MAX_BUCKET_ALLOCATION;
+        }
+        static __forceinline uint32_t bucketIndex ( uint64_t size ) {
+            uint32_t n = uint32_t(size - 1);
+            uint32_t octave = 31 - __builtin_clz(n);
+            uint32_t sub = (n >> (octave-2)) & 3;
+            return (octave-7)*4 + sub;
+        }
+        static __forceinline uint64_t bucketSize ( uint64_t size ) {
+            uint32_t n = uint32_t(size - 1);
+            uint32_t octave = 31 - __builtin_clz(n);
+            uint32_t sub = (n >> (octave-2)) & 3;
+            return uint64_t(4 + sub + 1) << (octave-2);
+        }
+        __forceinline char * allocate ( uint64_t size ) {
+            uint32_t bi = bucketIndex(size);
+            if ( FreeBlock * blk = blocks[bi] ) {
+                blocks[bi] = blk->next;
+                counts[bi] --;
+                return (char *) blk;
+            }
+            return nullptr;
+        }
+        __forceinline void free ( char * ptr, uint64_t size ) {
+            uint32_t bi = bucketIndex(size);
+            FreeBlock * blk = (FreeBlock *) ptr;
+            blk->next = blocks[bi];
+            blocks[bi] = blk;
+            counts[bi] ++;
+        }
+        void clear () {
+            for ( uint32_t bi=0; bi!=DAS_MAX_BUCKETS; ++bi ) {
+                while ( FreeBlock * blk = blocks[bi] ) {
+                    blocks[bi] = blk->next;
+                    das_aligned_free16(blk);
+                }
+                counts[bi] = 0;
+            }
+        }
+        static __forceinline uint64_t bucketSizeByIndex ( uint32_t bi ) {
+            return uint64_t(4 + (bi & 3) + 1) << ((bi>>2) + 5);
+        }
+        void getStats ( uint32_t & freeBlocks, uint64_t & freeBytes ) const {
+            freeBlocks = 0;
+            freeBytes = 0;
+            for ( uint32_t bi=0; bi!=DAS_MAX_BUCKETS; ++bi ) {
+                freeBlocks += counts[bi];
+                freeBytes += counts[bi] * bucketSizeByIndex(bi);
+            }
+        }
+        FreeBlock * blocks[DAS_MAX_BUCKETS];
+        uint32_t    counts[DAS_MAX_BUCKETS];
+    };
+
+    // statistics of a single size class of the heap
+    struct HeapSizeClassStats {
+        uint64_t    size = 0;               // allocation size of the class, 0 for linear chunks and huge blocks
+        uint32_t    chunks = 0;             // decks, chunks, or cached free blocks
+        uint32_t    liveBlocks = 0;
+        uint64_t    liveBytes = 0;
+        uint64_t    freeBytes = 0;          // reserved, but not used
+        float       fragmentation = 0.0f;   // freeBytes / (liveBytes + freeBytes)
+    };
+
+    // heap totals and high-water marks
+    struct HeapStats {
+        uint64_t    bytesAllocated = 0;
+        uint64_t    maxBytesAllocated = 0;
+        uint64_t    totalBytes = 0;         // memory reserved by the heap
+        uint32_t    depth = 0;
+        uint32_t    smallChunks = 0;
+        uint64_t    smallLiveBytes = 0;
+        uint64_t    smallFreeBytes = 0;
+        uint32_t    bigBlocks = 0;
+        uint64_t    bigBytes = 0;
+        uint64_t    maxBigBlock = 0;
+        uint32_t    bigFreeBlocks = 0;
+        uint64_t    bigFreeBytes = 0;
+        float       fragmentation = 0.0f;   // (totalBytes - bytesAllocated) / totalBytes
+    };
+
+    __forceinline float heapFragmentation ( uint64_t liveBytes, uint64_t freeBytes ) {
+        uint64_t total = liveBytes + freeBytes;
+        return total ? float(double(freeBytes) / double(total)) : 0.0f;
+    }
+
     typedef function<int(int)> CustomGrowFunction;
+    typedef function<void(uint64_t)> CustomReserveFunction;    // called before heap grows or big allocation is made, can throw
 
     struct MemoryModel : ptr_ref_count {
         enum { default_initial_size = 65536 };
@@ -217,25 +331,33 @@ namespace das {
         void setInitialSize ( uint32_t size );
         uint32_t grow ( uint32_t si );
         virtual void sweep();
-        char * allocate ( uint32_t size );
-        bool free ( char * ptr, uint32_t size );
-        char * reallocate ( char * ptr, uint32_t size, uint32_t nsize );
+        void trim();
+        char * allocate ( uint64_t size );
+        bool free ( char * ptr, uint64_t size );
+        char * reallocate ( char * ptr, uint64_t size, uint64_t nsize );
         __forceinline int depth() const { return shoe.depth(); }
-        __forceinline bool isOwnPtr( char * ptr, uint32_t size ) const {
-            return shoe.isOwnPtr(ptr,size) || (bigStuff.find(ptr)!=bigStuff.end());
+        __forceinline bool isOwnPtr( char * ptr, uint64_t size ) const {
+            return (size<=DAS_MAX_SHOE_ALLOCATION && shoe.isOwnPtr(ptr,uint32_t(size))) || (bigStuff.find(ptr)!=bigStuff.end());
         }
-        uint32_t bytesAllocated() const { return totalAllocated; }
-        uint32_t maxBytesAllocated() const { return maxAllocated; }
+        uint64_t bytesAllocated() const { return totalAllocated; }
+        uint64_t maxBytesAllocated() const { return maxAllocated; }
         uint64_t totalAlignedMemoryAllocated() const;
+        void getHeapStats ( HeapStats & stats ) const;
+        void getSizeClassStats ( vector<HeapSizeClassStats> & classes ) const;
+        char * allocateBig ( uint64_t size );
+        void freeBig ( char * ptr, uint64_t size );
+        char * reallocateBig ( char * ptr, uint64_t size, uint64_t nsize );
         CustomGrowFunction      customGrow;
+        CustomReserveFunction   customReserve;
         uint32_t                alignMask;
-        uint32_t                totalAllocated;
-        uint32_t                maxAllocated;
+        uint64_t                totalAllocated;
+        uint64_t                maxAllocated;
         uint32_t                initialSize = 0;
         Shoe                    shoe;
-        das_hash_map<void *,uint32_t> bigStuff;  // note: can't use char *, some stl implementations try hashing it as string
+        Buckets                 buckets;
+        das_hash_map<void *,uint64_t> bigStuff;  // note: can't use char *, some stl implementations try hashing it as string
 #if DAS_SANITIZER
-        das_hash_map<void *,uint32_t> deletedBigStuff;
+        das_hash_map<void *,uint64_t> deletedBigStuff;
 #endif
 #if DAS_TRACK_ALLOCATIONS
         das_hash_map<void *,uint64_t> bigStuffId;
@@ -250,7 +372,7 @@ namespace das {
     };
 
     struct HeapChunk {
-        __forceinline HeapChunk ( uint32_t s, HeapChunk * n ) {
+        __forceinline HeapChunk ( uint64_t s, HeapChunk * n ) {
             s = (s + 15) & ~15;
             data = (char *) das_aligned_alloc16(s);
             size = s;
@@ -266,13 +388,13 @@ namespace das {
                 delete toDelete;
             }
         }
-        __forceinline char * allocate ( uint32_t s ) {
+        __forceinline char * allocate ( uint64_t s ) {
             if ( offset + s > size ) return nullptr;
             char * res = data + offset;
             offset += s;
             return res;
         }
-        __forceinline void free ( char * ptr, uint32_t s ) {
+        __forceinline void free ( char * ptr, uint64_t s ) {
             if ( ptr + s == data + offset ) {
                 offset -= s;
             }
@@ -281,8 +403,8 @@ namespace das {
             return (ptr>=data) && (ptr<data+size);
         }
         char *      data;
-        uint32_t    size;
-        uint32_t    offset;
+        uint64_t    size;
+        uint64_t    offset;
         HeapChunk * next;
     };
 
@@ -291,9 +413,9 @@ namespace das {
     public:
         LinearChunkAllocator() { }
         virtual ~LinearChunkAllocator () { if ( chunk ) delete chunk; }
-        char * allocate ( uint32_t s );
-        void free ( char * ptr, uint32_t s );
-        char * reallocate ( char * ptr, uint32_t size, uint32_t nsize );
+        char * allocate ( uint64_t s );
+        void free ( char * ptr, uint64_t s );
+        char * reallocate ( char * ptr, uint64_t size, uint64_t nsize );
         virtual void reset ();
         char * allocateName ( const string & name );
         __forceinline bool isOwnPtrQnD ( const char * ptr ) const {
@@ -308,16 +430,20 @@ namespace das {
         uint32_t depth() const;
         uint64_t bytesAllocated() const;
         uint64_t totalAlignedMemoryAllocated() const;
+        void getHeapStats ( HeapStats & stats ) const;
+        void getSizeClassStats ( vector<HeapSizeClassStats> & classes ) const;
         __forceinline void setInitialSize ( uint32_t size ) {
             initialSize = size;
         }
-        virtual uint32_t grow ( uint32_t si );
+        virtual uint64_t grow ( uint64_t si );
     protected:
         void getStats ( uint32_t & depth, uint64_t & bytes, uint64_t & total ) const;
     public:
         CustomGrowFunction  customGrow;
+        CustomReserveFunction customReserve;
         uint32_t    initialSize = 0;
         uint32_t    alignMask = 15;
+        uint64_t    maxAllocated = 0;   // high-water mark, updated on reset
         HeapChunk * chunk = nullptr;
     };
 
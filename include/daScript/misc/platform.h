@@ -100,6 +100,26 @@ __forceinline uint32_t __builtin_clz(uint32_t x) {
     _BitScanReverse(&r, x);
     return uint32_t(31 - r);
 }
+__forceinline uint32_t __builtin_ctz(uint32_t x) {
+    unsigned long r = 0;
+    _BitScanForward(&r, x);
+    return uint32_t(r);
+}
+__forceinline uint32_t __builtin_clzll(uint64_t x) {
+    uint32_t hi = uint32_t(x >> 32);
+    return hi ? __builtin_clz(hi) : 32 + __builtin_clz(uint32_t(x));
+}
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #if defined(_M_IX86) || defined(_M_X64)
+        #include <xmmintrin.h>
+        #define DAS_PREFETCH(ptr)   _mm_prefetch((const char *)(ptr), _MM_HINT_T0)
+    #else
+        #define DAS_PREFETCH(ptr)
+    #endif
+#else
+    #define DAS_PREFETCH(ptr)   __builtin_prefetch(ptr)
 #endif
 
 #ifdef _MSC_VER
@@ -152,7 +172,7 @@ __forceinline uint32_t rotr_c(uint32_t a, uint32_t b) {
 
 #ifndef DAS_ALIGNED_ALLOC
 #define DAS_ALIGNED_ALLOC 1
-inline void *das_aligned_alloc16(uint32_t size) {
+inline void *das_aligned_alloc16(size_t size) {
 #if defined(_MSC_VER)
     return _aligned_malloc(size, 16);
 #else
@@ -0,0 +1,567 @@
+#pragma once
+
+#include "daScript/misc/job_que.h"
+
+namespace das {
+
+    // sorting primitives behind the sort builtins
+    //  radix_sort  - LSD radix sort, 8 bits per pass, for 32 and 64 bit integers and floating point
+    //  pdq_sort    - pattern-defeating quicksort, after https://github.com/orlp/pdqsort (Orson Peters, zlib license)
+    //  pdq_sort_guarded - pdq_sort with bounded scans, for comparators which may not be strict
+    //  das_sort    - picks one of the two by type and size
+    //  parallel_merge_sort - sorts chunks on the job que, and merges them
+
+    #ifndef DAS_RADIX_SORT_MIN
+    #define DAS_RADIX_SORT_MIN  256
+    #endif
+
+    // unsigned key, which sorts in the same order as the value
+    template <typename TT>
+    struct RadixKey {
+        enum { enabled = false };
+    };
+
+    template <> struct RadixKey<int32_t> {
+        enum { enabled = true };
+        typedef uint32_t type;
+        static __forceinline uint32_t key ( int32_t v ) { return uint32_t(v) ^ 0x80000000u; }
+    };
+
+    template <> struct RadixKey<uint32_t> {
+        enum { enabled = true };
+        typedef uint32_t type;
+        static __forceinline uint32_t key ( uint32_t v ) { return v; }
+    };
+
+    template <> struct RadixKey<int64_t> {
+        enum { enabled = true };
+        typedef uint64_t type;
+        static __forceinline uint64_t key ( int64_t v ) { return uint64_t(v) ^ 0x8000000000000000ull; }
+    };
+
+    template <> struct RadixKey<uint64_t> {
+        enum { enabled = true };
+        typedef uint64_t type;
+        static __forceinline uint64_t key ( uint64_t v ) { return v; }
+    };
+
+    // negative numbers have all bits flipped, positive ones only the sign
+    template <> struct RadixKey<float> {
+        enum { enabled = true };
+        typedef uint32_t type;
+        static __forceinline uint32_t key ( float v ) {
+            uint32_t bits;
+            memcpy(&bits, &v, sizeof(bits));
+            return bits ^ (uint32_t(int32_t(bits) >> 31) | 0x80000000u);
+        }
+    };
+
+    template <> struct RadixKey<double> {
+        enum { enabled = true };
+        typedef uint64_t type;
+        static __forceinline uint64_t key ( double v ) {
+            uint64_t bits;
+            memcpy(&bits, &v, sizeof(bits));
+            return bits ^ (uint64_t(int64_t(bits) >> 63) | 0x8000000000000000ull);
+        }
+    };
+
+    // sorts data, using tmp (of the same length) as the second buffer. the sort is stable
+    template <typename TT>
+    void radix_sort ( TT * data, uint32_t length, TT * tmp ) {
+        typedef RadixKey<TT> RK;
+        typedef typename RK::type KT;
+        enum { passes = sizeof(KT) };
+        uint32_t count[passes][256];
+        memset(count, 0, sizeof(count));
+        for ( uint32_t i=0; i!=length; ++i ) {
+            KT k = RK::key(data[i]);
+            for ( int p=0; p!=passes; ++p ) {
+                count[p][(k >> (p*8)) & 0xff] ++;
+            }
+        }
+        TT * src = data;
+        TT * dst = tmp;
+        for ( int p=0; p!=passes; ++p ) {
+            uint32_t * cnt = count[p];
+            const int shift = p * 8;
+            // all values share this digit, nothing to do
+            if ( cnt[(RK::key(src[0]) >> shift) & 0xff]==length ) continue;
+            uint32_t sum = 0;
+            for ( int d=0; d!=256; ++d ) {
+                uint32_t n = cnt[d];
+                cnt[d] = sum;
+                sum += n;
+            }
+            for ( uint32_t i=0; i!=length; ++i ) {
+                dst[cnt[(RK::key(src[i]) >> shift) & 0xff]++] = src[i];
+            }
+            swap(src, dst);
+        }
+        if ( src!=data ) memcpy(data, src, length*sizeof(TT));
+    }
+
+    template <typename Iter, typename Less>
+    __forceinline void pdq_insertion_sort ( Iter begin, Iter end, Less & less ) {
+        if ( begin==end ) return;
+        for ( Iter cur=begin+1; cur!=end; ++cur ) {
+            Iter sift = cur;
+            Iter sift1 = cur - 1;
+            if ( less(*sift, *sift1) ) {
+                auto tmp = move(*sift);
+                do {
+                    *sift-- = move(*sift1);
+                } while ( sift!=begin && less(tmp, *--sift1) );
+                *sift = move(tmp);
+            }
+        }
+    }
+
+    // *(begin-1) is not greater than any element, so there is no need to check for begin
+    template <typename Iter, typename Less>
+    __forceinline void pdq_unguarded_insertion_sort ( Iter begin, Iter end, Less & less ) {
+        if ( begin==end ) return;
+        for ( Iter cur=begin+1; cur!=end; ++cur ) {
+            Iter sift = cur;
+            Iter sift1 = cur - 1;
+            if ( less(*sift, *sift1) ) {
+                auto tmp = move(*sift);
+                do {
+                    *sift-- = move(*sift1);
+                } while ( less(tmp, *--sift1) );
+                *sift = move(tmp);
+            }
+        }
+    }
+
+    // insertion sort, which gives up after moving too many elements
+    template <typename Iter, typename Less>
+    __forceinline bool pdq_partial_insertion_sort ( Iter begin, Iter end, Less & less ) {
+        if ( begin==end ) return true;
+        size_t moved = 0;
+        for ( Iter cur=begin+1; cur!=end; ++cur ) {
+            Iter sift = cur;
+            Iter sift1 = cur - 1;
+            if ( less(*sift, *sift1) ) {
+                auto tmp = move(*sift);
+                do {
+                    *sift-- = move(*sift1);
+                } while ( sift!=begin && less(tmp, *--sift1) );
+                *sift = move(tmp);
+                moved += cur - sift;
+            }
+            if ( moved>8 ) return false;
+        }
+        return true;
+    }
+
+    template <typename Iter, typename Less>
+    __forceinline void pdq_sort2 ( Iter a, Iter b, Less & less ) {
+        if ( less(*b, *a) ) iter_swap(a, b);
+    }
+
+    template <typename Iter, typename Less>
+    __forceinline void pdq_sort3 ( Iter a, Iter b, Iter c, Less & less ) {
+        pdq_sort2(a, b, less);
+        pdq_sort2(b, c, less);
+        pdq_sort2(a, b, less);
+    }
+
+    // pivot is *begin. elements equal to the pivot go to the right
+    // returns the pivot position, and whether the range was already partitioned
+    template <typename Iter, typename Less>
+    __forceinline pair<Iter,bool> pdq_partition_right ( Iter begin, Iter end, Less & less ) {
+        auto pivot = move(*begin);
+        Iter first = begin;
+        Iter last = end;
+        while ( less(*++first, pivot) );
+        if ( first-1==begin ) {
+            while ( first<last && !less(*--last, pivot) );
+        } else {
+            while ( !less(*--last, pivot) );
+        }
+        bool alreadyPartitioned = first>=last;
+        while ( first<last ) {
+            iter_swap(first, last);
+            while ( less(*++first, pivot) );
+            while ( !less(*--last, pivot) );
+        }
+        Iter pivotPos = first - 1;
+        *begin = move(*pivotPos);
+        *pivotPos = move(pivot);
+        return make_pair(pivotPos, alreadyPartitioned);
+    }
+
+    // elements equal to the pivot go to the left. used, when the pivot equals the element before the range,
+    // so that runs of equal elements are done in one step
+    template <typename Iter, typename Less>
+    __forceinline Iter pdq_partition_left ( Iter begin, Iter end, Less & less ) {
+        auto pivot = move(*begin);
+        Iter first = begin;
+        Iter last = end;
+        while ( less(pivot, *--last) );
+        if ( last+1==end ) {
+            while ( first<last && !less(pivot, *++first) );
+        } else {
+            while ( !less(pivot, *++first) );
+        }
+        while ( first<last ) {
+            iter_swap(first, last);
+            while ( less(pivot, *--last) );
+            while ( !less(pivot, *++first) );
+        }
+        Iter pivotPos = last;
+        *begin = move(*pivotPos);
+        *pivotPos = move(pivot);
+        return pivotPos;
+    }
+
+    // same as pdq_partition_right, but every scan is bounded. script comparators are not guaranteed to be strict,
+    // and with a comparator like <= the unguarded scans run off the range
+    template <typename Iter, typename Less>
+    __forceinline pair<Iter,bool> pdq_partition_right_guarded ( Iter begin, Iter end, Less & less ) {
+        auto pivot = move(*begin);
+        Iter first = begin + 1;
+        Iter last = end - 1;
+        bool alreadyPartitioned = true;
+        for ( ;; ) {
+            while ( first<=last && less(*first, pivot) ) ++first;
+            while ( first<=last && !less(*last, pivot) ) --last;
+            if ( first>last ) break;
+            iter_swap(first++, last--);
+            alreadyPartitioned = false;
+        }
+        Iter pivotPos = first - 1;
+        *begin = move(*pivotPos);
+        *pivotPos = move(pivot);
+        return make_pair(pivotPos, alreadyPartitioned);
+    }
+
+    template <typename Iter, typename Less>
+    __forceinline Iter pdq_partition_left_guarded ( Iter begin, Iter end, Less & less ) {
+        auto pivot = move(*begin);
+        Iter first = begin + 1;
+        Iter last = end - 1;
+        for ( ;; ) {
+            while ( first<=last && !less(pivot, *first) ) ++first;
+            while ( first<=last && less(pivot, *last) ) --last;
+            if ( first>last ) break;
+            iter_swap(first++, last--);
+        }
+        Iter pivotPos = last;
+        *begin = move(*pivotPos);
+        *pivotPos = move(pivot);
+        return pivotPos;
+    }
+
+    template <bool Guarded>
+    struct PdqPartition {
+        template <typename Iter, typename Less>
+        static __forceinline pair<Iter,bool> right ( Iter begin, Iter end, Less & less ) { return pdq_partition_right(begin, end, less); }
+        template <typename Iter, typename Less>
+        static __forceinline Iter left ( Iter begin, Iter end, Less & less ) { return pdq_partition_left(begin, end, less); }
+        template <typename Iter, typename Less>
+        static __forceinline void insertion_sort ( Iter begin, Iter end, Less & less, bool leftmost ) {
+            if ( leftmost ) pdq_insertion_sort(begin, end, less);
+            else pdq_unguarded_insertion_sort(begin, end, less);
+        }
+    };
+
+    template <>
+    struct PdqPartition<true> {
+        template <typename Iter, typename Less>
+        static __forceinline pair<Iter,bool> right ( Iter begin, Iter end, Less & less ) { return pdq_partition_right_guarded(begin, end, less); }
+        template <typename Iter, typename Less>
+        static __forceinline Iter left ( Iter begin, Iter end, Less & less ) { return pdq_partition_left_guarded(begin, end, less); }
+        template <typename Iter, typename Less>
+        static __forceinline void insertion_sort ( Iter begin, Iter end, Less & less, bool ) { pdq_insertion_sort(begin, end, less); }
+    };
+
+    template <bool Guarded, typename Iter, typename Less>
+    void pdq_loop ( Iter begin, Iter end, Less & less, int badAllowed, bool leftmost ) {
+        enum {
+            insertionSortThreshold = 24,
+            nintherThreshold = 128,
+        };
+        for ( ;; ) {
+            auto size = end - begin;
+            if ( size<insertionSortThreshold ) {
+                PdqPartition<Guarded>::insertion_sort(begin, end, less, leftmost);
+                return;
+            }
+            // pivot is median of 3, or pseudo-median of 9 for larger ranges, placed at begin
+            auto s2 = size / 2;
+            if ( size>nintherThreshold ) {
+                pdq_sort3(begin, begin + s2, end - 1, less);
+                pdq_sort3(begin + 1, begin + (s2 - 1), end - 2, less);
+                pdq_sort3(begin + 2, begin + (s2 + 1), end - 3, less);
+                pdq_sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), less);
+                iter_swap(begin, begin + s2);
+            } else {
+                pdq_sort3(begin + s2, begin, end - 1, less);
+            }
+            if ( !leftmost && !less(*(begin - 1), *begin) ) {
+                begin = PdqPartition<Guarded>::left(begin, end, less) + 1;
+                continue;
+            }
+            auto part = PdqPartition<Guarded>::right(begin, end, less);
+            Iter pivotPos = part.first;
+            auto lsize = pivotPos - begin;
+            auto rsize = end - (pivotPos + 1);
+            if ( lsize<size/8 || rsize<size/8 ) {
+                // too many bad partitions, switch to heap sort for guaranteed n log n
+                if ( --badAllowed==0 ) {
+                    make_heap(begin, end, less);
+                    sort_heap(begin, end, less);
+                    return;
+                }
+                // shuffle a few elements around, to break the pattern
+                if ( lsize>=insertionSortThreshold ) {
+                    iter_swap(begin, begin + lsize/4);
+                    iter_swap(pivotPos - 1, pivotPos - lsize/4);
+                    if ( lsize>nintherThreshold ) {
+                        iter_swap(begin + 1, begin + (lsize/4 + 1));
+                        iter_swap(begin + 2, begin + (lsize/4 + 2));
+                        iter_swap(pivotPos - 2, pivotPos - (lsize/4 + 1));
+                        iter_swap(pivotPos - 3, pivotPos - (lsize/4 + 2));
+                    }
+                }
+                if ( rsize>=insertionSortThreshold ) {
+                    iter_swap(pivotPos + 1, pivotPos + (1 + rsize/4));
+                    iter_swap(end - 1, end - rsize/4);
+                    if ( rsize>nintherThreshold ) {
+                        iter_swap(pivotPos + 2, pivotPos + (2 + rsize/4));
+                        iter_swap(pivotPos + 3, pivotPos + (3 + rsize/4));
+                        iter_swap(end - 2, end - (1 + rsize/4));
+                        iter_swap(end - 3, end - (2 + rsize/4));
+                    }
+                }
+            } else if ( part.second
+                    && pdq_partial_insertion_sort(begin, pivotPos, less)
+                    && pdq_partial_insertion_sort(pivotPos + 1, end, less) ) {
+                // already partitioned range was close to sorted
+                return;
+            }
+            // recurse into the left part, loop on the right one
+            pdq_loop<Guarded>(begin, pivotPos, less, badAllowed, leftmost);
+            begin = pivotPos + 1;
+            leftmost = false;
+        }
+    }
+
+    template <typename Iter, typename Less>
+    void pdq_sort ( Iter begin, Iter end, Less less ) {
+        if ( begin==end ) return;
+        int log2 = 0;
+        for ( auto size = end - begin; size>1; size >>= 1 ) log2 ++;
+        pdq_loop<false>(begin, end, less, log2, true);
+    }
+
+    // for comparators, which may not be strict weak ordering, i.e. the ones written in script
+    template <typename Iter, typename Less>
+    void pdq_sort_guarded ( Iter begin, Iter end, Less less ) {
+        if ( begin==end ) return;
+        int log2 = 0;
+        for ( auto size = end - begin; size>1; size >>= 1 ) log2 ++;
+        pdq_loop<true>(begin, end, less, log2, true);
+    }
+
+    // radix sort with temporary storage, sorted and reverse sorted input is detected first
+    template <typename TT>
+    void das_radix_sort ( TT * data, uint32_t length ) {
+        uint32_t i = 1;
+        while ( i<length && !(data[i] < data[i-1]) ) i++;
+        if ( i>=length ) return;
+        if ( i==1 ) {
+            while ( i!=length && data[i] < data[i-1] ) i++;
+            if ( i==length ) {
+                reverse(data, data + length);
+                return;
+            }
+        }
+        TT * tmp = (TT *) das_aligned_alloc16(length * sizeof(TT));
+        radix_sort(data, length, tmp);
+        das_aligned_free16(tmp);
+    }
+
+    template <typename TT>
+    __forceinline void das_sort_numeric ( TT * data, uint32_t length, false_type ) {
+        pdq_sort(data, data + length, [](TT a, TT b) { return a < b; });
+    }
+
+    template <typename TT>
+    __forceinline void das_sort_numeric ( TT * data, uint32_t length, true_type ) {
+        if ( length<DAS_RADIX_SORT_MIN ) {
+            pdq_sort(data, data + length, [](TT a, TT b) { return a < b; });
+        } else {
+            das_radix_sort(data, length);
+        }
+    }
+
+    // radix sort for large arrays of 32 and 64 bit numbers, pdq_sort otherwise
+    template <typename TT>
+    __forceinline void das_sort ( TT * data, uint32_t length ) {
+        das_sort_numeric(data, length, integral_constant<bool, RadixKey<TT>::enabled>());
+    }
+
+    template <typename TT>
+    __forceinline void das_stable_sort_numeric ( TT * data, uint32_t length, false_type ) {
+        stable_sort(data, data + length);
+    }
+
+    template <typename TT>
+    __forceinline void das_stable_sort_numeric ( TT * data, uint32_t length, true_type ) {
+        if ( length<DAS_RADIX_SORT_MIN ) {
+            stable_sort(data, data + length);
+        } else {
+            das_radix_sort(data, length);
+        }
+    }
+
+    // radix sort is stable, but it tells -0.0 from 0.0, so floating point goes to stable_sort
+    template <typename TT>
+    __forceinline void das_stable_sort ( TT * data, uint32_t length ) {
+        das_stable_sort_numeric(data, length, integral_constant<bool, RadixKey<TT>::enabled && is_integral<TT>::value>());
+    }
+
+    #ifndef DAS_PARALLEL_SORT_MIN
+    #define DAS_PARALLEL_SORT_MIN   65536
+    #endif
+
+    // number of elements of a, which go before first 'diag' elements of stable merge of a and b
+    template <typename TT, typename Less>
+    __forceinline uint32_t merge_path_split ( const TT * a, uint32_t na, const TT * b, uint32_t nb, uint32_t diag, Less & less ) {
+        uint32_t lo = diag>nb ? diag - nb : 0;
+        uint32_t hi = min(diag, na);
+        while ( lo<hi ) {
+            uint32_t i = lo + (hi - lo) / 2;
+            if ( less(b[diag-i-1], a[i]) ) {
+                hi = i;
+            } else {
+                lo = i + 1;
+            }
+        }
+        return lo;
+    }
+
+    // sorts one chunk per thread, then merges chunks pairwise. every merge is split along the merge path,
+    // so that all threads are busy until the last round. stable if sortChunk is stable
+    template <typename TT, typename SortChunk, typename Less>
+    void parallel_merge_sort ( TT * data, uint32_t length, SortChunk && sortChunk, Less less ) {
+        uint32_t threads = parallel_thread_count();
+        if ( length<DAS_PARALLEL_SORT_MIN || threads<2 ) {
+            sortChunk(data, length);
+            return;
+        }
+        uint32_t chunks = min(threads, length / (DAS_PARALLEL_SORT_MIN / 4));
+        vector<uint32_t> bounds(chunks + 1);
+        for ( uint32_t i=0; i<=chunks; ++i ) bounds[i] = uint32_t(uint64_t(length) * i / chunks);
+        parallel_for(chunks, [&](uint32_t i){
+            sortChunk(data + bounds[i], bounds[i+1] - bounds[i]);
+        });
+        TT * tmp = (TT *) das_aligned_alloc16(size_t(length) * sizeof(TT));
+        TT * src = data;
+        TT * dst = tmp;
+        for ( uint32_t width=1; width<chunks; width*=2 ) {
+            uint32_t pairs = (chunks + 2*width - 1) / (2*width);
+            uint32_t parts = max(threads / pairs, 1u);
+            parallel_for(pairs * parts, [&](uint32_t job){
+                uint32_t pair = job / parts, part = job % parts;
+                uint32_t lo = bounds[pair*2*width];
+                uint32_t mid = bounds[min(pair*2*width + width, chunks)];
+                uint32_t hi = bounds[min(pair*2*width + 2*width, chunks)];
+                const TT * a = src + lo; uint32_t na = mid - lo;
+                const TT * b = src + mid; uint32_t nb = hi - mid;
+                uint32_t total = na + nb;
+                uint32_t from = uint32_t(uint64_t(total) * part / parts);
+                uint32_t to = uint32_t(uint64_t(total) * (part + 1) / parts);
+                uint32_t ai = merge_path_split(a, na, b, nb, from, less);
+                uint32_t aj = merge_path_split(a, na, b, nb, to, less);
+                merge(a + ai, a + aj, b + (from - ai), b + (to - aj), dst + lo + from, less);
+            });
+            swap(src, dst);
+        }
+        if ( src!=data ) {
+            memcpy(data, src, size_t(length) * sizeof(TT));
+        }
+        das_aligned_free16(tmp);
+    }
+
+    // das_sort on every chunk
+    template <typename TT>
+    __forceinline void das_sort_parallel ( TT * data, uint32_t length ) {
+        parallel_merge_sort(data, length, [](TT * chunk, uint32_t len) {
+            das_sort(chunk, len);
+        }, [](TT a, TT b) { return a < b; });
+    }
+
+    // key of the element, and its original index. ties are broken by index, which makes any sort of these stable
+    template <typename TK>
+    struct SortKeyIndex {
+        TK          key;
+        uint32_t    index;
+        __forceinline bool operator < ( const SortKeyIndex & b ) const {
+            return key < b.key || (!(b.key < key) && index < b.index);
+        }
+    };
+
+    // radix sort of (key,index) pairs only looks at the key. it is stable, so equal keys stay in index order
+    template <typename TK>
+    struct RadixKey<SortKeyIndex<TK>> {
+        enum { enabled = RadixKey<TK>::enabled };
+        typedef typename RadixKey<TK>::type type;
+        static __forceinline type key ( const SortKeyIndex<TK> & v ) { return RadixKey<TK>::key(v.key); }
+    };
+
+    // sorts (key,index) pairs with sortFn, then moves elements into place in one pass
+    template <typename TK, typename SortFn>
+    void sort_by_key_index ( char * data, uint32_t elementSize, uint32_t length, const TK * keys, SortFn && sortFn ) {
+        if ( length<2 ) return;
+        vector<SortKeyIndex<TK>> order(length);
+        for ( uint32_t i=0; i!=length; ++i ) {
+            order[i].key = keys[i];
+            order[i].index = i;
+        }
+        sortFn(order.data(), length);
+        char * tmp = (char *) das_aligned_alloc16(size_t(length) * elementSize);
+        for ( uint32_t i=0; i!=length; ++i ) {
+            memcpy(tmp + size_t(i) * elementSize, data + size_t(order[i].index) * elementSize, elementSize);
+        }
+        memcpy(data, tmp, size_t(length) * elementSize);
+        das_aligned_free16(tmp);
+    }
+
+    template <typename TK>
+    __forceinline void das_sort_key_index ( SortKeyIndex<TK> * order, uint32_t length, false_type ) {
+        pdq_sort(order, order + length, [](const SortKeyIndex<TK> & a, const SortKeyIndex<TK> & b) { return a < b; });
+    }
+
+    template <typename TK>
+    __forceinline void das_sort_key_index ( SortKeyIndex<TK> * order, uint32_t length, true_type ) {
+        if ( length<DAS_RADIX_SORT_MIN ) {
+            das_sort_key_index(order, length, false_type());
+        } else {
+            das_radix_sort(order, length);
+        }
+    }
+
+    // elements are sorted by precomputed keys, keys[i] being the key of i-th element. the sort is stable
+    // radix sort tells -0.0 from 0.0, so floating point keys are compared, same as in das_stable_sort
+    template <typename TK>
+    void das_sort_by_key ( char * data, uint32_t elementSize, uint32_t length, const TK * keys ) {
+        sort_by_key_index(data, elementSize, length, keys, [](SortKeyIndex<TK> * order, uint32_t len) {
+            das_sort_key_index(order, len, integral_constant<bool, RadixKey<TK>::enabled && is_integral<TK>::value>());
+        });
+    }
+
+    // same as das_sort_by_key, only on multiple threads
+    template <typename TK>
+    void das_sort_parallel_by_key ( char * data, uint32_t elementSize, uint32_t length, const TK * keys ) {
+        sort_by_key_index(data, elementSize, length, keys, [](SortKeyIndex<TK> * order, uint32_t len) {
+            auto less = [](const SortKeyIndex<TK> & a, const SortKeyIndex<TK> & b) { return a < b; };
+            parallel_merge_sort(order, len, [&](SortKeyIndex<TK> * chunk, uint32_t clen) {
+                pdq_sort(chunk, chunk + clen, less);
+            }, less);
+        });
+    }
+}
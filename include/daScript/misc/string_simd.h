@@ -0,0 +1,162 @@
+#pragma once
+
+#include "daScript/misc/platform.h"
+
+namespace das {
+
+    // string primitives, which look at 16 bytes at a time with SSE2 or NEON
+    // chunks never read past len, the tail is done one byte at a time
+
+#if _TARGET_SIMD_SSE
+    #define DAS_STRING_SIMD 1
+    typedef __m128i str_chunk;
+    __forceinline str_chunk str_load ( const char * p ) { return _mm_loadu_si128((const __m128i *)p); }
+    __forceinline void str_store ( char * p, str_chunk v ) { _mm_storeu_si128((__m128i *)p, v); }
+    __forceinline str_chunk str_splat ( char ch ) { return _mm_set1_epi8(ch); }
+    __forceinline str_chunk str_eq ( str_chunk a, str_chunk b ) { return _mm_cmpeq_epi8(a, b); }
+    __forceinline str_chunk str_and ( str_chunk a, str_chunk b ) { return _mm_and_si128(a, b); }
+    __forceinline str_chunk str_or ( str_chunk a, str_chunk b ) { return _mm_or_si128(a, b); }
+    __forceinline str_chunk str_xor ( str_chunk a, str_chunk b ) { return _mm_xor_si128(a, b); }
+    // unsigned a-lo <= hi-lo
+    __forceinline str_chunk str_in_range ( str_chunk a, char lo, char hi ) {
+        __m128i ofs = _mm_sub_epi8(a, _mm_set1_epi8(lo));
+        return _mm_cmpeq_epi8(_mm_subs_epu8(ofs, _mm_set1_epi8(char(hi-lo))), _mm_setzero_si128());
+    }
+    __forceinline uint32_t str_mask ( str_chunk m ) { return uint32_t(_mm_movemask_epi8(m)); }
+#elif _TARGET_SIMD_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+    #define DAS_STRING_SIMD 1
+    typedef uint8x16_t str_chunk;
+    __forceinline str_chunk str_load ( const char * p ) { return vld1q_u8((const uint8_t *)p); }
+    __forceinline void str_store ( char * p, str_chunk v ) { vst1q_u8((uint8_t *)p, v); }
+    __forceinline str_chunk str_splat ( char ch ) { return vdupq_n_u8(uint8_t(ch)); }
+    __forceinline str_chunk str_eq ( str_chunk a, str_chunk b ) { return vceqq_u8(a, b); }
+    __forceinline str_chunk str_and ( str_chunk a, str_chunk b ) { return vandq_u8(a, b); }
+    __forceinline str_chunk str_or ( str_chunk a, str_chunk b ) { return vorrq_u8(a, b); }
+    __forceinline str_chunk str_xor ( str_chunk a, str_chunk b ) { return veorq_u8(a, b); }
+    __forceinline str_chunk str_in_range ( str_chunk a, char lo, char hi ) {
+        return vcleq_u8(vsubq_u8(a, vdupq_n_u8(uint8_t(lo))), vdupq_n_u8(uint8_t(hi-lo)));
+    }
+    __forceinline uint32_t str_mask ( str_chunk m ) {
+        static const uint8_t bits[16] = { 1,2,4,8,16,32,64,128, 1,2,4,8,16,32,64,128 };
+        uint8x16_t b = vandq_u8(m, vld1q_u8(bits));
+        return uint32_t(vaddv_u8(vget_low_u8(b))) | (uint32_t(vaddv_u8(vget_high_u8(b))) << 8);
+    }
+#else
+    #define DAS_STRING_SIMD 0
+#endif
+
+    __forceinline bool str_is_space ( char ch ) {
+        return ch==' ' || uint8_t(ch-'\t')<=uint8_t('\r'-'\t');
+    }
+
+#if DAS_STRING_SIMD
+    __forceinline str_chunk str_space ( str_chunk v ) {
+        return str_or(str_eq(v, str_splat(' ')), str_in_range(v, '\t', '\r'));
+    }
+#endif
+
+    // offset of the first occurrence of substr, -1 if there is none
+    // candidates are positions, where both the first and the last character match
+    __forceinline int32_t str_find ( const char * str, uint32_t len, const char * substr, uint32_t subLen ) {
+        if ( !subLen ) return 0;
+        if ( subLen > len ) return -1;
+        if ( subLen==1 ) {
+            auto at = (const char *) memchr(str, substr[0], len);
+            return at ? int32_t(at - str) : -1;
+        }
+        uint32_t last = len - subLen;     // last valid start
+        uint32_t i = 0;
+#if DAS_STRING_SIMD
+        str_chunk first = str_splat(substr[0]);
+        str_chunk tail = str_splat(substr[subLen-1]);
+        for ( ; i + 16 <= last + 1; i += 16 ) {
+            str_chunk a = str_eq(str_load(str + i), first);
+            str_chunk b = str_eq(str_load(str + i + subLen - 1), tail);
+            for ( uint32_t bits = str_mask(str_and(a, b)); bits; bits &= bits - 1 ) {
+                uint32_t at = i + __builtin_ctz(bits);
+                if ( memcmp(str + at + 1, substr + 1, subLen - 2)==0 ) return int32_t(at);
+            }
+        }
+#endif
+        for ( ; i <= last; ++i ) {
+            if ( str[i]==substr[0] && memcmp(str + i + 1, substr + 1, subLen - 1)==0 ) return int32_t(i);
+        }
+        return -1;
+    }
+
+    // offset of the first character, which is in the set, or len if there is none
+    __forceinline uint32_t str_find_first_of ( const char * str, uint32_t len, const char * set, uint32_t setLen ) {
+        uint32_t i = 0;
+        if ( !setLen ) return len;
+#if DAS_STRING_SIMD
+        if ( setLen <= 16 ) {
+            for ( ; i + 16 <= len; i += 16 ) {
+                str_chunk v = str_load(str + i);
+                str_chunk m = str_eq(v, str_splat(set[0]));
+                for ( uint32_t s=1; s!=setLen; ++s ) {
+                    m = str_or(m, str_eq(v, str_splat(set[s])));
+                }
+                if ( uint32_t bits = str_mask(m) ) return i + __builtin_ctz(bits);
+            }
+        }
+#endif
+        uint32_t bitset[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+        for ( uint32_t s=0; s!=setLen; ++s ) {
+            uint8_t ch = uint8_t(set[s]);
+            bitset[ch>>5] |= 1u << (ch & 31);
+        }
+        for ( ; i < len; ++i ) {
+            uint8_t ch = uint8_t(str[i]);
+            if ( bitset[ch>>5] & (1u << (ch & 31)) ) return i;
+        }
+        return len;
+    }
+
+    // offset of the first character, which is not white space, or len if there is none
+    __forceinline uint32_t str_skip_space ( const char * str, uint32_t len ) {
+        uint32_t i = 0;
+#if DAS_STRING_SIMD
+        for ( ; i + 16 <= len; i += 16 ) {
+            if ( uint32_t bits = ~str_mask(str_space(str_load(str + i))) & 0xffff ) return i + __builtin_ctz(bits);
+        }
+#endif
+        while ( i < len && str_is_space(str[i]) ) i++;
+        return i;
+    }
+
+    // length without white space at the end
+    __forceinline uint32_t str_trim_space ( const char * str, uint32_t len ) {
+#if DAS_STRING_SIMD
+        for ( ; len >= 16; len -= 16 ) {
+            if ( uint32_t bits = ~str_mask(str_space(str_load(str + len - 16))) & 0xffff ) return len - 16 + 32 - __builtin_clz(bits);
+        }
+#endif
+        while ( len && str_is_space(str[len-1]) ) len--;
+        return len;
+    }
+
+    // flips case of characters in [lo,hi] range, i.e. A-Z or a-z
+    template <char lo, char hi>
+    __forceinline void str_flip_case ( char * dst, const char * src, uint32_t len ) {
+        uint32_t i = 0;
+#if DAS_STRING_SIMD
+        str_chunk bit = str_splat(0x20);
+        for ( ; i + 16 <= len; i += 16 ) {
+            str_chunk v = str_load(src + i);
+            str_store(dst + i, str_xor(v, str_and(str_in_range(v, lo, hi), bit)));
+        }
+#endif
+        for ( ; i < len; ++i ) {
+            char ch = src[i];
+            dst[i] = (ch >= lo && ch <= hi) ? char(ch ^ 0x20) : ch;
+        }
+    }
+
+    __forceinline void str_to_lower ( char * dst, const char * src, uint32_t len ) {
+        str_flip_case<'A','Z'>(dst, src, len);
+    }
+
+    __forceinline void str_to_upper ( char * dst, const char * src, uint32_t len ) {
+        str_flip_case<'a','z'>(dst, src, len);
+    }
+}
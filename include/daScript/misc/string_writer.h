@@ -1,5 +1,7 @@
 #pragma once
 
+#include "daScript/misc/format_number.h"
+
 namespace das {
 
     class VectorAllocationPolicy {
@@ -12,8 +14,7 @@ namespace das {
         }
     protected:
         __forceinline void append(const char * s, int l) {
-            data.reserve(data.size() + l);
-            data.insert(data.end(), s, s + l);
+            data.insert(data.end(), s, s + l);  // no exact reserve here, it defeats geometric growth
         }
         __forceinline char * allocate (int l) {
             data.resize(data.size() + l);
@@ -43,6 +44,16 @@ namespace das {
             }
             return *this;
         }
+        template <typename TT, typename FF>
+        StringWriter & writeNumber(FF && fmt, TT value) {
+            char buf[DAS_FMT_NUMBER_SIZE];
+            int realL = fmt(buf, value);
+            if ( auto at = this->allocate(realL) ) {
+                memcpy(at, buf, realL);
+                this->output();
+            }
+            return *this;
+        }
         StringWriter & writeStr(const char * st, size_t len) {
             this->append(st, int(len));
             this->output();
@@ -69,17 +80,17 @@ namespace das {
             else if (&v == &SCIENTIFIC) fixed = false;
             return *this;
         }
-        StringWriter & operator << (char v)                 { return write("%c", v); }
-        StringWriter & operator << (unsigned char v)        { return write("%c", v); }
+        StringWriter & operator << (char v)                 { return writeChars(v, 1); }
+        StringWriter & operator << (unsigned char v)        { return writeChars(char(v), 1); }
         StringWriter & operator << (bool v)                 { return write(v ? "true" : "false"); }
-        StringWriter & operator << (int v)                  { return write(hex ? "%x" : "%d", v); }
-        StringWriter & operator << (long v)                 { return write(hex ? "%lx" : "%ld", v); }
-        StringWriter & operator << (long long v)            { return write(hex ? "%llx" : "%lld", v); }
-        StringWriter & operator << (unsigned v)             { return write(hex ? "%x" : "%u", v); }
-        StringWriter & operator << (unsigned long v)        { return write(hex ? "%lx" : "%lu", v); }
-        StringWriter & operator << (unsigned long long v)   { return write(hex ? "%llx" : "%llu", v); }
-        StringWriter & operator << (float v)                { return write(fixed ? "%.9f" : "%g", v); }
-        StringWriter & operator << (double v)               { return write(fixed ? "%.17f" : "%g", v); }
+        StringWriter & operator << (int v)                  { return hex ? writeNumber(fmt_hex, uint32_t(v)) : writeNumber(fmt_int32, int32_t(v)); }
+        StringWriter & operator << (long v)                 { return hex ? writeNumber(fmt_hex, uint64_t((unsigned long)v)) : writeNumber(fmt_int64, int64_t(v)); }
+        StringWriter & operator << (long long v)            { return hex ? writeNumber(fmt_hex, uint64_t(v)) : writeNumber(fmt_int64, int64_t(v)); }
+        StringWriter & operator << (unsigned v)             { return hex ? writeNumber(fmt_hex, uint64_t(v)) : writeNumber(fmt_uint32, uint32_t(v)); }
+        StringWriter & operator << (unsigned long v)        { return hex ? writeNumber(fmt_hex, uint64_t(v)) : writeNumber(fmt_uint64, uint64_t(v)); }
+        StringWriter & operator << (unsigned long long v)   { return hex ? writeNumber(fmt_hex, uint64_t(v)) : writeNumber(fmt_uint64, uint64_t(v)); }
+        StringWriter & operator << (float v)                { return fixed ? write("%.9f", v) : writeNumber(fmt_float, v); }
+        StringWriter & operator << (double v)               { return fixed ? write("%.17f", v) : writeNumber(fmt_double, v); }
         StringWriter & operator << (char * v)               { return write(v ? (const char*)v : ""); }
         StringWriter & operator << (const char * v)         { return write(v ? v : ""); }
         StringWriter & operator << (const string & v)       { return v.length() ? writeStr(v.c_str(), v.length()) : *this; }
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "daScript/misc/fnv.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace das
+{
+    // ideas from https://github.com/wangyi-fudan/wyhash (final version 4, public domain)
+    // 8 bytes at a time, short keys are read with overlapping loads
+
+    static constexpr uint64_t wyhash_secret[4] = {
+        0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+    };
+
+    __forceinline void wyhash_mum ( uint64_t & A, uint64_t & B ) {
+#if defined(__SIZEOF_INT128__)
+        __uint128_t r = A;
+        r *= B;
+        A = uint64_t(r);
+        B = uint64_t(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        A = _umul128(A, B, &B);
+#else
+        uint64_t ha = A >> 32, hb = B >> 32, la = uint32_t(A), lb = uint32_t(B);
+        uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+        uint64_t c = t < rl;
+        uint64_t lo = t + (rm1 << 32);
+        c += lo < t;
+        uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+        A = lo;
+        B = hi;
+#endif
+    }
+
+    __forceinline uint64_t wyhash_mix ( uint64_t A, uint64_t B ) {
+        wyhash_mum(A, B);
+        return A ^ B;
+    }
+
+    __forceinline uint64_t wyhash_r8 ( const uint8_t * p ) {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        return v;
+    }
+
+    __forceinline uint64_t wyhash_r4 ( const uint8_t * p ) {
+        uint32_t v;
+        memcpy(&v, p, 4);
+        return v;
+    }
+
+    __forceinline uint64_t wyhash_r3 ( const uint8_t * p, uint64_t k ) {
+        return (uint64_t(p[0]) << 16) | (uint64_t(p[k >> 1]) << 8) | p[k - 1];
+    }
+
+    __forceinline uint64_t wyhash64 ( const uint8_t * p, uint64_t len, uint64_t seed = 0 ) {
+        seed ^= wyhash_mix(seed ^ wyhash_secret[0], wyhash_secret[1]);
+        uint64_t a, b;
+        if ( len <= 16 ) {
+            if ( len >= 4 ) {
+                a = (wyhash_r4(p) << 32) | wyhash_r4(p + ((len >> 3) << 2));
+                b = (wyhash_r4(p + len - 4) << 32) | wyhash_r4(p + len - 4 - ((len >> 3) << 2));
+            } else if ( len > 0 ) {
+                a = wyhash_r3(p, len);
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            uint64_t i = len;
+            if ( i > 48 ) {
+                uint64_t see1 = seed, see2 = seed;
+                do {
+                    seed = wyhash_mix(wyhash_r8(p) ^ wyhash_secret[1], wyhash_r8(p + 8) ^ seed);
+                    see1 = wyhash_mix(wyhash_r8(p + 16) ^ wyhash_secret[2], wyhash_r8(p + 24) ^ see1);
+                    see2 = wyhash_mix(wyhash_r8(p + 32) ^ wyhash_secret[3], wyhash_r8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while ( i > 48 );
+                seed ^= see1 ^ see2;
+            }
+            while ( i > 16 ) {
+                seed = wyhash_mix(wyhash_r8(p) ^ wyhash_secret[1], wyhash_r8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = wyhash_r8(p + i - 16);
+            b = wyhash_r8(p + i - 8);
+        }
+        a ^= wyhash_secret[1];
+        b ^= seed;
+        wyhash_mum(a, b);
+        return wyhash_mix(a ^ wyhash_secret[0] ^ len, b ^ wyhash_secret[1]);
+    }
+
+    // 32-bit hashes never collide with HASH_EMPTY32 and HASH_KILLED32
+    __forceinline uint32_t wyhash_fold32 ( uint64_t h ) {
+        uint32_t res = uint32_t(h ^ (h >> 32));
+        return res <= HASH_KILLED32 ? 16777619 : res;
+    }
+
+    __forceinline uint32_t wyhash32 ( const uint8_t * block, uint32_t size ) {
+        return wyhash_fold32(wyhash64(block, size));
+    }
+
+    __forceinline uint32_t wyhashz32 ( const uint8_t * block ) {
+        return wyhash_fold32(wyhash64(block, strlen((const char *)block)));
+    }
+}
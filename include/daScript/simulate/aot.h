@@ -709,7 +709,7 @@ namespace das {
             flags = arr.flags; arr.flags = 0;
             keys = arr.keys; arr.keys = 0;
             hashes = arr.hashes; arr.hashes = 0;
-            maxLookups = arr.maxLookups; arr.maxLookups = 0;
+            tombstones = arr.tombstones; arr.tombstones = 0;
             shift = arr.shift; arr.shift = 0;
         }
         __forceinline TV & operator () ( const TK & key, Context * __context__ ) {
@@ -734,6 +734,26 @@ namespace das {
         }
     };
 
+    // table<K;void> is a set, its values take no space
+    template <typename TV>
+    struct das_table_value_size { enum { value = sizeof(TV) }; };
+
+    template <>
+    struct das_table_value_size<void> { enum { value = 0 }; };
+
+    template <typename TK>
+    struct TTable<TK,void> : Table {
+        TTable()  {}
+        TTable(TTable & arr) { moveT(arr); }
+        TTable(TTable && arr ) { moveT(arr); }
+        TTable & operator = ( TTable & arr ) { moveT(arr); return *this; }
+        TTable & operator = ( TTable && arr ) { moveT(arr); return *this; }
+        __forceinline void moveT ( Table & arr ) {
+            memcpy ( (Table *)this, &arr, sizeof(Table) );
+            memset ( &arr, 0, sizeof(Table) );
+        }
+    };
+
     template <int tupleSize, typename ...TA>
     struct TTuple : Tuple {
         TTuple() {}
@@ -1137,7 +1157,7 @@ namespace das {
     template <typename TT>
     struct das_delete_lambda_struct<TT *> {
         static __forceinline void clear ( Context * __context__, TT * ptr ) {
-            __context__->heap->free(((char *)ptr)-16, sizeof(TT)+16);
+            __context__->heap->freeClosure(((char *)ptr)-16, sizeof(TT)+16);
         }
     };
 
@@ -1217,7 +1237,7 @@ namespace das {
         static __forceinline void clear ( Context * __context__, TArray<TT> & dim ) {
             if ( dim.data ) {
                 if ( !dim.lock ) {
-                    uint32_t oldSize = dim.capacity*sizeof(TT);
+                    uint64_t oldSize = uint64_t(dim.capacity)*sizeof(TT);
                     __context__->heap->free(dim.data, oldSize);
                 } else {
                     __context__->throw_error("can't delete locked array");
@@ -1232,7 +1252,7 @@ namespace das {
         static __forceinline void clear ( Context * __context__, TTable<TKey,TVal> & tab ) {
             if ( tab.data ) {
                 if ( !tab.lock ) {
-                    uint32_t oldSize = tab.capacity*(sizeof(TKey)+sizeof(TVal)+sizeof(uint32_t));
+                    uint64_t oldSize = table_memory_size(tab.capacity, sizeof(TKey)+das_table_value_size<TVal>::value);
                     __context__->heap->free(tab.data, oldSize);
                 } else {
                     __context__->throw_error("can't delete locked table");
@@ -1301,7 +1321,7 @@ namespace das {
     template <typename TT, typename AT, bool moveIt = false>
     struct das_ascend {
         static __forceinline TT * make(Context * __context__,TypeInfo * typeInfo,const AT & init) {
-            if ( char * ptr = (char *)__context__->heap->allocate(sizeof(AT)+ (typeInfo ? 16 : 0)) ) {
+            if ( char * ptr = typeInfo ? __context__->heap->allocateClosure(sizeof(AT)+16) : __context__->heap->allocate(sizeof(AT)) ) {
                 if ( typeInfo ) {
                     *((TypeInfo **)ptr) = typeInfo;
                     ptr += 16;
@@ -1353,7 +1373,7 @@ namespace das {
     template <typename AT>
     struct das_ascend<Lambda,AT,false> {
         static __forceinline Lambda make(Context * __context__,TypeInfo * typeInfo,const AT & init) {
-            if ( char * ptr = (char *)__context__->heap->allocate(sizeof(AT)+ (typeInfo ? 16 : 0)) ) {
+            if ( char * ptr = typeInfo ? __context__->heap->allocateClosure(sizeof(AT)+16) : __context__->heap->allocate(sizeof(AT)) ) {
                 if ( typeInfo ) {
                     *((TypeInfo **)ptr) = typeInfo;
                     ptr += 16;
@@ -2002,6 +2022,53 @@ namespace das {
 #endif
     }
 
+    // finally_block runs after try_block, even if it throws. the original exception is then thrown again
+    // its message is kept as is, including the location throw_error_at put in front of it
+    template <typename TA, typename TB>
+    inline void das_try_finally ( Context * __context__, TA && try_block, TB && finally_block ) {
+        auto aa = __context__->abiArg; auto acm = __context__->abiCMRES;
+        char * EP, * SP;
+        __context__->stack.watermark(EP,SP);
+        bool failed = false;
+#if DAS_ENABLE_EXCEPTIONS
+        std::exception_ptr original;
+        try {
+            try_block();
+        } catch ( const dasException & ) {
+            failed = true;
+            original = std::current_exception();
+        }
+#else
+        jmp_buf ev;
+        jmp_buf * JB = __context__->throwBuf;
+        __context__->throwBuf = &ev;
+        if ( !setjmp(ev) ) {
+            try_block();
+        } else {
+            failed = true;
+        }
+        __context__->throwBuf = JB;
+#endif
+        if ( failed ) {
+            string exception = __context__->exception ? __context__->exception : "";
+            __context__->abiArg = aa;
+            __context__->abiCMRES = acm;
+            __context__->stack.pop(EP,SP);
+            __context__->stopFlags = 0;
+            __context__->exception = nullptr;
+            finally_block();
+            __context__->lastError = exception;
+#if DAS_ENABLE_EXCEPTIONS
+            __context__->exception = __context__->lastError.c_str();
+            std::rethrow_exception(original);
+#else
+            __context__->throw_error(__context__->lastError.c_str());
+#endif
+        } else {
+            finally_block();
+        }
+    }
+
 #if defined(_MSC_VER)
 #pragma warning(pop)
 #endif
@@ -2068,14 +2135,14 @@ namespace das {
         auto hfn = hash_function(*context, key);
         TableHash<TK> thh(context,sizeof(TV));
         int index = thh.find(tab, key, hfn);
-        return (TV *) ( index!=-1 ? tab.data + index * sizeof(TV) : nullptr );
+        return (TV *) ( index!=-1 ? tab.data + size_t(index) * sizeof(TV) : nullptr );
     }
 
     template <typename TK, typename TV, typename TKey>
     __forceinline bool __builtin_table_key_exists ( Context * context, const TTable<TK, TV> & tab, TKey _key ) {
         TK key = (TK) _key;
         auto hfn = hash_function(*context, key);
-        TableHash<TK> thh(context, sizeof(TV));
+        TableHash<TK> thh(context, das_table_value_size<TV>::value);
         return thh.find(tab, key, hfn) != -1;
     }
 
@@ -2084,7 +2151,7 @@ namespace das {
         if ( tab.lock ) context->throw_error("can't erase from locked table");
         TK key = (TK) _key;
         auto hfn = hash_function(*context, key);
-        TableHash<TK> thh(context,sizeof(TV));
+        TableHash<TK> thh(context,das_table_value_size<TV>::value);
         return thh.erase(tab, key, hfn) != -1;
     }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "daScript/misc/sort_algorithms.h"
+
 namespace das {
     void setCommandLineArguments ( int argc, char * argv[] );
     void getCommandLineArguments( Array & arr );
@@ -15,17 +17,36 @@ namespace das {
     int builtin_table_capacity ( const Table & arr );
     void builtin_table_clear ( Table & arr, Context * context );
     vec4f _builtin_hash ( Context & context, SimNode_CallBase * call, vec4f * args );
+    vec4f _builtin_table_key_exists_batch ( Context & context, SimNode_CallBase * call, vec4f * args );
+    vec4f _builtin_table_find_batch ( Context & context, SimNode_CallBase * call, vec4f * args );
+    vec4f _builtin_table_insert_batch ( Context & context, SimNode_CallBase * call, vec4f * args );
+    vec4f _builtin_table_set_insert ( Context & context, SimNode_CallBase * call, vec4f * args );
     uint64_t heap_bytes_allocated ( Context * context );
     int32_t heap_depth ( Context * context );
     uint64_t string_heap_bytes_allocated ( Context * context );
     int32_t string_heap_depth ( Context * context );
+    void string_heap_collect ( Context * context, LineInfoArg * info );
+    void heap_report ( Context * context );
+    void string_heap_report ( Context * context );
+    void heap_stats ( HeapStats & stats, Context * context );
+    void string_heap_stats ( HeapStats & stats, Context * context );
+    void closure_pool_stats ( ClosurePoolStats & stats, Context * context );
+    void heap_size_class_stats ( const TBlock<void,const HeapSizeClassStats> & block, Context * context );
+    void string_heap_size_class_stats ( const TBlock<void,const HeapSizeClassStats> & block, Context * context );
+    void set_allocation_sampling ( uint64_t interval, Context * context );
+    void reset_allocation_sampling ( Context * context );
+    void allocation_sampling_report ( int32_t top, Context * context );
+    void allocation_sites ( int32_t top, const TBlock<void,const AllocationSite> & block, Context * context );
     void builtin_table_lock ( const Table & arr, Context * context );
+    // not a constant, so that the scripts which check it produce the same AOT code in both layouts
+    __forceinline bool builtin_table_is_dense () { return DAS_TABLE_DENSE!=0; }
     void builtin_table_unlock ( const Table & arr, Context * context );
     void builtin_table_clear_lock ( const Table & arr, Context * context );
     int builtin_array_size ( const Array & arr );
     int builtin_array_capacity ( const Array & arr );
     void builtin_array_resize ( Array & pArray, int newSize, int stride, Context * context );
     void builtin_array_reserve ( Array & pArray, int newSize, int stride, Context * context );
+    void builtin_array_shrink ( Array & pArray, int stride, Context * context );
     int builtin_array_push ( Array & pArray, int index, int stride, Context * context );
     int builtin_array_push_zero ( Array & pArray, int index, int stride, Context * context );
     void builtin_array_erase ( Array & pArray, int index, int stride, Context * context ) ;
@@ -33,15 +54,22 @@ namespace das {
     void builtin_array_lock ( const Array & arr, Context * context );
     void builtin_array_unlock ( const Array & arr, Context * context );
     void builtin_array_clear_lock ( const Array & arr, Context * );
+    void builtin_array_append ( Array & pArray, const Array & from, int stride, Context * context );
+    void builtin_array_copy_slice ( Array & dst, int dstIndex, const Array & src, int srcIndex, int count, int stride, Context * context );
+    void builtin_array_fill ( Array & pArray, int from, int count, const void * value, int stride, Context * context );
     void builtin_array_free ( Array & dim, int szt, Context * __context__ );
     void builtin_table_free ( Table & tab, int szk, int szv, Context * __context__ );
+    void builtin_table_shrink ( Table & tab, int szk, int szv, Context * context );
+    void builtin_table_reserve ( Table & tab, int newSize, int szk, int szv, Context * context );
 
     bool builtin_iterator_first ( const Sequence & it, void * data, Context * context );
     bool builtin_iterator_next  ( const Sequence & it, void * data, Context * context );
     void builtin_iterator_close ( const Sequence & it, void * data, Context * context );
     bool builtin_iterator_iterate ( const Sequence & it, void * data, Context * context );
     void builtin_iterator_delete ( const Sequence & it, Context * context );
+    void builtin_iterator_to_array ( Array & arr, const Sequence & it, int32_t elementSize, bool byRef, Context * context );
     __forceinline bool builtin_iterator_empty ( const Sequence & seq ) { return seq.iter==nullptr; }
+    __forceinline int32_t builtin_iterator_size_hint ( const Sequence & seq ) { return seq.iter && !seq.iter->isOpen ? seq.iter->size_hint() : -1; }
 
     void builtin_make_good_array_iterator ( Sequence & result, const Array & arr, int stride, Context * context );
     void builtin_make_fixed_array_iterator ( Sequence & result, void * data, int size, int stride, Context * context );
@@ -57,17 +85,60 @@ namespace das {
 
     template <typename TT>
     __forceinline void builtin_sort ( TT * data, int32_t length ) {
-        sort ( data, data + length );
+        das_sort ( data, uint32_t(length) );
+    }
+
+    template <typename TT>
+    __forceinline void builtin_stable_sort ( TT * data, int32_t length ) {
+        das_stable_sort ( data, uint32_t(length) );
+    }
+
+    template <typename TT>
+    __forceinline void builtin_sort_parallel ( TT * data, int32_t length ) {
+        das_sort_parallel ( data, uint32_t(length) );
+    }
+
+    template <typename TK>
+    __forceinline void builtin_sort_parallel_by_key ( void * data, int32_t elementSize, int32_t length, TK * keys ) {
+        das_sort_parallel_by_key ( (char *) data, uint32_t(elementSize), uint32_t(length), keys );
     }
 
+    __forceinline int32_t builtin_parallel_thread_count () {
+        return int32_t(parallel_thread_count());
+    }
+
+    __forceinline void builtin_set_parallel_thread_count ( int32_t count ) {
+        set_parallel_thread_count(uint32_t(das::max(count,0)));
+    }
+
+    template <typename TK>
+    __forceinline void builtin_sort_by_key ( void * data, int32_t elementSize, int32_t length, TK * keys ) {
+        das_sort_by_key ( (char *) data, uint32_t(elementSize), uint32_t(length), keys );
+    }
+
+    void builtin_sort_by_key_string ( void * data, int32_t elementSize, int32_t length, void * keys );
     void builtin_sort_string ( void * data, int32_t length );
+    void builtin_stable_sort_string ( void * data, int32_t length );
     void builtin_sort_any_cblock ( void * anyData, int32_t elementSize, int32_t length, const Block & cmp, Context * context );
+    void builtin_stable_sort_any_cblock ( void * anyData, int32_t elementSize, int32_t length, const Block & cmp, Context * context );
 
     template <typename TT>
     void builtin_sort_cblock ( TT * data, int32_t length, const TBlock<bool,TT,TT> & cmp, Context * context ) {
         vec4f bargs[2];
         context->invokeEx(cmp, bargs, nullptr, [&](SimNode * code) {
-            sort ( data, data+length, [&](TT x, TT y) -> bool {
+            pdq_sort_guarded ( data, data+length, [&](TT x, TT y) -> bool {
+                bargs[0] = cast<TT>::from(x);
+                bargs[1] = cast<TT>::from(y);
+                return code->evalBool(*context);
+            });
+        });
+    }
+
+    template <typename TT>
+    void builtin_stable_sort_cblock ( TT * data, int32_t length, const TBlock<bool,TT,TT> & cmp, Context * context ) {
+        vec4f bargs[2];
+        context->invokeEx(cmp, bargs, nullptr, [&](SimNode * code) {
+            stable_sort ( data, data+length, [&](TT x, TT y) -> bool {
                 bargs[0] = cast<TT>::from(x);
                 bargs[1] = cast<TT>::from(y);
                 return code->evalBool(*context);
@@ -75,6 +146,55 @@ namespace das {
         });
     }
 
+    // element-wise operations over numeric and vector elements
+    // comparisons are done in branchless blocks, which compilers vectorize, and only the block with the match is scanned
+    #define DAS_ARRAY_BULK_BLOCK    16
+
+    template <typename TT> struct TArray;
+
+    template <typename TT>
+    __forceinline int32_t builtin_array_find_index ( const TArray<TT> & arr, TT key ) {
+        const TT * data = (const TT *) arr.data;
+        int32_t length = int32_t(arr.size);
+        int32_t i = 0;
+        for ( ; i + DAS_ARRAY_BULK_BLOCK <= length; i += DAS_ARRAY_BULK_BLOCK ) {
+            bool any = false;
+            for ( int32_t j=0; j!=DAS_ARRAY_BULK_BLOCK; ++j ) any |= data[i+j]==key;
+            if ( any ) break;
+        }
+        for ( ; i < length; ++i ) {
+            if ( data[i]==key ) return i;
+        }
+        return -1;
+    }
+
+    template <typename TT>
+    __forceinline int32_t builtin_array_count ( const TArray<TT> & arr, TT key ) {
+        const TT * data = (const TT *) arr.data;
+        int32_t length = int32_t(arr.size);
+        int32_t total = 0;
+        for ( int32_t i=0; i < length; ++i ) total += data[i]==key ? 1 : 0;
+        return total;
+    }
+
+    template <typename TT>
+    __forceinline bool builtin_array_equal ( const TArray<TT> & arrA, const TArray<TT> & arrB ) {
+        if ( arrA.size != arrB.size ) return false;
+        const TT * a = (const TT *) arrA.data;
+        const TT * b = (const TT *) arrB.data;
+        int32_t length = int32_t(arrA.size);
+        int32_t i = 0;
+        for ( ; i + DAS_ARRAY_BULK_BLOCK <= length; i += DAS_ARRAY_BULK_BLOCK ) {
+            bool same = true;
+            for ( int32_t j=0; j!=DAS_ARRAY_BULK_BLOCK; ++j ) same &= a[i+j]==b[i+j];
+            if ( !same ) return false;
+        }
+        for ( ; i < length; ++i ) {
+            if ( !(a[i]==b[i]) ) return false;
+        }
+        return true;
+    }
+
 #if defined(_MSC_VER) && !defined(__clang__)
     __forceinline int32_t variant_index(const Variant & v) { return *(int32_t *)&v; }
     __forceinline void set_variant_index(Variant & v, int32_t index) { *(int32_t *)&v = index; }
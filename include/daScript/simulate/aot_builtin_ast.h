@@ -414,6 +414,7 @@ namespace das {
     void forEachFunction ( Module * module, const char * name, const TBlock<void,FunctionPtr> & block, Context * context, LineInfoArg * lineInfo );
     void forEachGenericFunction ( Module * module, const char * name, const TBlock<void,FunctionPtr> & block, Context * context, LineInfoArg * lineInfo );
     bool addModuleFunction ( Module * module, FunctionPtr func, Context * context );
+    bool addModuleStructure ( Module * module, StructurePtr st, Context * context );
     void ast_error ( ProgramPtr prog, const LineInfo & at, const char * message );
     void addModuleReaderMacro ( Module * module, ReaderMacroPtr newM, Context * context );
     ReaderMacroPtr makeReaderMacro ( const char * name, const void * pClass, const StructInfo * info, Context * context );
@@ -422,6 +423,7 @@ namespace das {
     void addFunctionFunctionAnnotation(smart_ptr_raw<Function> func, FunctionAnnotationPtr ann, Context* context);
     __forceinline ExpressionPtr clone_expression ( ExpressionPtr value ) { return value->clone(); }
     __forceinline FunctionPtr clone_function ( FunctionPtr value ) { return value->clone(); }
+    __forceinline StructurePtr clone_structure ( StructurePtr value ) { return value->clone(); }
     __forceinline TypeDeclPtr clone_type ( TypeDeclPtr value ) { return make_smart<TypeDecl>(*value); }
 
     template <>
@@ -3,6 +3,20 @@
 #include "daScript/ast/ast_typefactory.h"
 
 namespace das {
+    // non-owning view into a string. it is only valid while the string it points into is alive
+    struct StringView {
+        const char *    data;
+        uint32_t        length;
+    };
+
+    template <>
+    struct cast <StringView> {
+        static __forceinline StringView to ( vec4f x )          { union { StringView t; vec4f vec; } T; T.vec = x; return T.t; }
+        static __forceinline vec4f from ( StringView x )        { union { StringView t; vec4f vec; } T; T.t = x; return T.vec; }
+    };
+
+    __forceinline void das_clone ( StringView & dst, const StringView & src ) { dst = src; }
+
     void delete_string ( char * & str, Context * context );
 
     char * builtin_das_root ( Context * context );
@@ -55,21 +69,77 @@ namespace das {
     char * builtin_string_from_array ( const TArray<uint8_t> & bytes, Context * context );
     char * builtin_string_replace ( const char * str, const char * toSearch, const char * replaceStr, Context * context );
 
+    StringView builtin_string_view ( const char * str, Context * context );
+    char * builtin_string_view_to_string ( StringView view, Context * context );
+    int32_t builtin_string_view_length ( StringView view );
+    bool builtin_string_view_empty ( StringView view );
+    int32_t builtin_string_view_character_at ( StringView view, int32_t index, Context * context );
+    StringView builtin_string_view_slice1 ( StringView view, int32_t start, int32_t end );
+    StringView builtin_string_view_slice2 ( StringView view, int32_t start );
+    StringView builtin_string_view_strip ( StringView view );
+    StringView builtin_string_view_strip_left ( StringView view );
+    StringView builtin_string_view_strip_right ( StringView view );
+    int32_t builtin_string_view_find1 ( StringView view, const char * substr, int32_t start, Context * context );
+    int32_t builtin_string_view_find2 ( StringView view, const char * substr, Context * context );
+    bool builtin_string_view_starts_with ( StringView view, const char * cmp, Context * context );
+    bool builtin_string_view_ends_with ( StringView view, const char * cmp, Context * context );
+    bool builtin_string_view_equ ( StringView a, StringView b );
+    bool builtin_string_view_nequ ( StringView a, StringView b );
+    bool builtin_string_view_equ_str ( StringView a, const char * b );
+    bool builtin_string_view_nequ_str ( StringView a, const char * b );
+    int32_t builtin_string_view_to_int ( StringView view, Context * context );
+    float builtin_string_view_to_float ( StringView view, Context * context );
+    void builtin_write_string_view ( StringBuilderWriter & writer, StringView view );
+    void builtin_string_split_view ( const char * str, const char * delim, const Block & sblk, Context * context );
+    void builtin_string_split_by_char_view ( const char * str, const char * delim, const Block & sblk, Context * context );
+
     __forceinline bool builtin_empty(const char* str) { return !str || str[0] == 0; }
     __forceinline bool builtin_empty_das_string(const string & str) { return str.empty(); }
 
+    // plain integer formats skip snprintf. returns -1 for everything else
+    __forceinline int format_fast ( char * buf, const char * fmt, int32_t value ) {
+        if ( fmt[0]!='%' || !fmt[1] || fmt[2] ) return -1;
+        if ( fmt[1]=='d' || fmt[1]=='i' ) return fmt_int32(buf, value);
+        if ( fmt[1]=='u' ) return fmt_uint32(buf, uint32_t(value));
+        if ( fmt[1]=='x' ) return fmt_hex(buf, uint32_t(value));
+        return -1;
+    }
+    __forceinline int format_fast ( char * buf, const char * fmt, uint32_t value ) {
+        return format_fast(buf, fmt, int32_t(value));
+    }
+    __forceinline int format_fast ( char * buf, const char * fmt, int64_t value ) {
+        if ( fmt[0]!='%' || fmt[1]!='l' || fmt[2]!='l' || !fmt[3] || fmt[4] ) return -1;
+        if ( fmt[3]=='d' || fmt[3]=='i' ) return fmt_int64(buf, value);
+        if ( fmt[3]=='u' ) return fmt_uint64(buf, uint64_t(value));
+        if ( fmt[3]=='x' ) return fmt_hex(buf, uint64_t(value));
+        return -1;
+    }
+    __forceinline int format_fast ( char * buf, const char * fmt, uint64_t value ) {
+        return format_fast(buf, fmt, int64_t(value));
+    }
+    __forceinline int format_fast ( char *, const char *, float ) { return -1; }
+    __forceinline int format_fast ( char *, const char *, double ) { return -1; }
+
     template <typename TT>
     __forceinline char * format ( const char * fmt, TT value, Context * context ) {
         char buf[256];
-        snprintf(buf, 256, fmt, value);
-        return context->stringHeap->allocateString(buf, uint32_t(strlen(buf)));
+        int len = fmt ? format_fast(buf, fmt, value) : -1;
+        if ( len<0 ) {
+            snprintf(buf, 256, fmt, value);
+            len = int(strlen(buf));
+        }
+        return context->stringHeap->allocateString(buf, uint32_t(len));
     }
 
     template <typename TT>
     void format_and_write ( StringBuilderWriter & writer, const char * fmt, TT value  ) {
         char buf[256];
-        snprintf(buf, 256, fmt, value);
-        writer.writeStr(buf, strlen(buf));
+        int len = fmt ? format_fast(buf, fmt, value) : -1;
+        if ( len<0 ) {
+            snprintf(buf, 256, fmt, value);
+            len = int(strlen(buf));
+        }
+        writer.writeStr(buf, len);
     }
 
     template <typename TT>
@@ -171,6 +171,7 @@ namespace das
             flag_refValue = 1<<8,
             flag_hasInitValue = 1<<9,
             flag_isSmartPtr = 1<<10,
+            flag_isDensePod = 1<<11,    // raw pod without padding, can be hashed as a single block of bytes
         };
         Type                type;
         StructInfo *        structType;
@@ -195,6 +196,7 @@ namespace das
         __forceinline bool isTemp() const { return flags & flag_isTemp; }
         __forceinline bool isImplicit() const { return flags & flag_isImplicit; }
         __forceinline bool isSmartPtr() const { return flags & flag_isSmartPtr; }
+        __forceinline bool isDensePod() const { return flags & flag_isDensePod; }
         TypeAnnotation * getAnnotation() const;
     };
 
@@ -144,6 +144,14 @@ namespace das {
         virtual void beforeTableKey ( Table *, TypeInfo *, char *, TypeInfo *, uint32_t, bool ) override {
             ss << " ";
         }
+        virtual void afterTableKey ( Table *, TypeInfo * ti, char *, TypeInfo *, uint32_t, bool last ) override {
+            if ( ti->secondType->type==Type::tVoid ) {
+                if ( !last ) {
+                    ss << ";";
+                }
+                br();
+            }
+        }
         virtual void beforeTableValue ( Table *, TypeInfo *, char *, TypeInfo *, uint32_t, bool ) override {
             ss << " : ";
         }
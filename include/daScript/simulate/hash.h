@@ -1,11 +1,11 @@
 #pragma once
 
 #include "daScript/simulate/simulate.h"
-#include "daScript/misc/fnv.h"
+#include "daScript/misc/wyhash.h"
 
 namespace das {
     __forceinline uint32_t hash_function ( Context &, const void * x, size_t size ) {
-        return hash_block32((uint8_t *)x, uint32_t(size));
+        return wyhash32((const uint8_t *)x, uint32_t(size));
     }
 
     __forceinline uint32_t stringLength ( Context &, const char * str ) { // str!=nullptr
@@ -18,12 +18,17 @@ namespace das {
 
     template <typename TT>
     __forceinline uint32_t hash_function ( Context &, const TT x ) {
-        return hash_block32((const uint8_t *)&x, sizeof(x));
+        return wyhash32((const uint8_t *)&x, sizeof(x));
     }
 
+    // interned strings know their hash, so it is not computed again
     template <>
-    __forceinline uint32_t hash_function ( Context &, char * str ) {
-        return str ? hash_blockz32((uint8_t *)str) : 16777619;
+    __forceinline uint32_t hash_function ( Context & context, char * str ) {
+        if ( !str ) return 16777619;
+        uint32_t hash;
+        auto strHeap = context.stringHeap.get();
+        if ( strHeap && strHeap->cachedHash(str, hash) ) return hash;
+        return wyhashz32((const uint8_t *)str);
     }
 
     uint32_t hash_value ( Context & ctx, void * pX, TypeInfo * info );
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "daScript/misc/memory_model.h"
-#include "daScript/misc/fnv.h"
+#include "daScript/misc/wyhash.h"
 
 namespace das {
 
@@ -116,58 +116,206 @@ namespace das {
         uint32_t    stackSize = 0;
     };
 
+    // sampled allocation site tracking, see Context::setAllocationSampling
+    class HeapSampler {
+    public:
+        virtual ~HeapSampler() {}
+        __forceinline void allocated ( char * ptr, uint64_t size ) {
+            countdown -= int64_t(size);
+            if ( countdown<=0 ) {
+                sample(ptr, size);
+            } else {
+                lastSample = nullptr;
+            }
+        }
+        __forceinline void mark_location ( void * ptr, LineInfo * at ) {
+            if ( ptr && ptr==lastSample ) sampleLocation(at);
+        }
+        __forceinline void mark_comment ( void * ptr, const char * what ) {
+            if ( ptr && ptr==lastSample ) sampleComment(what);
+        }
+    protected:
+        virtual void sample ( char * ptr, uint64_t size ) = 0;
+        virtual void sampleLocation ( LineInfo * at ) = 0;
+        virtual void sampleComment ( const char * what ) = 0;
+    protected:
+        int64_t     countdown = 0;
+        void *      lastSample = nullptr;
+    };
+
+    #define DAS_CLOSURE_POOL_CLASSES    32      // 16 byte size classes, blocks up to 512 bytes are pooled
+    #define DAS_CLOSURE_POOL_DEPTH      64      // free blocks kept per size class
+
+    // statistics of the lambda capture and generator frame pool
+    struct ClosurePoolStats {
+        uint64_t    allocations = 0;
+        uint64_t    reused = 0;             // allocations served from the pool
+        uint64_t    frees = 0;
+        uint64_t    pooled = 0;             // frees kept in the pool, instead of going back to the heap
+        uint32_t    liveBlocks = 0;
+        uint32_t    freeBlocks = 0;         // blocks currently in the pool
+        uint64_t    freeBytes = 0;
+    };
+
+    // lambda captures, generator frames and their iterators come in few sizes, and are often short lived
+    // freed blocks are kept in per size class lists, and are reused before going to the heap
+    // pooled blocks are free memory, so the heap does not count them in bytesAllocated, and memory limits ignore them
+    struct ClosurePool {
+        struct FreeBlock {
+            FreeBlock * next;
+        };
+        ClosurePool () {
+            reset();
+        }
+        static __forceinline uint64_t sizeClass ( uint64_t size ) {
+            return (size >> 4) - 1;
+        }
+        __forceinline char * allocate ( uint64_t size ) {
+            allocations ++;
+            live ++;
+            uint64_t sc = sizeClass(size);
+            if ( sc < DAS_CLOSURE_POOL_CLASSES ) {
+                if ( FreeBlock * blk = blocks[sc] ) {
+                    blocks[sc] = blk->next;
+                    counts[sc] --;
+                    reused ++;
+                    pooledBytes -= size;
+                    return (char *) blk;
+                }
+            }
+            return nullptr;
+        }
+        __forceinline bool free ( char * ptr, uint64_t size ) {
+            frees ++;
+            live --;
+            uint64_t sc = sizeClass(size);
+            if ( sc < DAS_CLOSURE_POOL_CLASSES && counts[sc] < DAS_CLOSURE_POOL_DEPTH ) {
+                FreeBlock * blk = (FreeBlock *) ptr;
+                blk->next = blocks[sc];
+                blocks[sc] = blk;
+                counts[sc] ++;
+                pooled ++;
+                pooledBytes += size;
+                return true;
+            }
+            return false;
+        }
+        // pooled blocks belong to the heap, and are gone once it resets
+        void reset () {
+            memset ( blocks, 0, sizeof(blocks) );
+            memset ( counts, 0, sizeof(counts) );
+            live = 0;
+            pooledBytes = 0;
+        }
+        void getStats ( ClosurePoolStats & stats ) const;
+        FreeBlock * blocks[DAS_CLOSURE_POOL_CLASSES];
+        uint32_t    counts[DAS_CLOSURE_POOL_CLASSES];
+        uint64_t    allocations = 0;
+        uint64_t    reused = 0;
+        uint64_t    frees = 0;
+        uint64_t    pooled = 0;
+        uint32_t    live = 0;
+        uint64_t    pooledBytes = 0;        // bytes in the free lists
+    };
+
     class AnyHeapAllocator : public ptr_ref_count {
     public:
-        virtual char * allocate ( uint32_t ) = 0;
-        virtual void free ( char *, uint32_t ) = 0;
-        virtual char * reallocate ( char *, uint32_t, uint32_t ) = 0;
+        virtual char * allocate ( uint64_t ) = 0;
+        virtual void free ( char *, uint64_t ) = 0;
+        virtual char * reallocate ( char *, uint64_t, uint64_t ) = 0;
         virtual int depth() const = 0;
         virtual uint64_t bytesAllocated() const = 0;
         virtual uint64_t totalAlignedMemoryAllocated() const = 0;
+        virtual void getHeapStats ( HeapStats & stats ) const = 0;
+        virtual void getSizeClassStats ( vector<HeapSizeClassStats> & classes ) const = 0;
         virtual void reset() = 0;
         virtual void report() = 0;
         virtual bool mark() = 0;
-        virtual void mark ( char * ptr, uint32_t size ) = 0;
+        virtual void mark ( char * ptr, uint64_t size ) = 0;
         virtual void sweep() = 0;
-        virtual bool isOwnPtr (  char * ptr, uint32_t size ) = 0;
+        virtual bool isOwnPtr (  char * ptr, uint64_t size ) = 0;
         virtual void setInitialSize ( uint32_t size ) = 0;
         virtual int32_t getInitialSize() const = 0;
         virtual void setGrowFunction ( CustomGrowFunction && fun ) = 0;
+        virtual void setReserveFunction ( CustomReserveFunction && fun ) = 0;
     public:
+        __forceinline void mark_location ( void * ptr, LineInfo * at ) {
+            if ( sampler ) sampler->mark_location(ptr, at);
+#if DAS_TRACK_ALLOCATIONS
+            track_location(ptr, at);
+#endif
+        }
+        __forceinline void mark_comment ( void * ptr, const char * what ) {
+            if ( sampler ) sampler->mark_comment(ptr, what);
 #if DAS_TRACK_ALLOCATIONS
-        virtual void mark_location ( void *, LineInfo * )  {}
-        virtual  void mark_comment ( void *, const char * ) {}
-#else
-        __forceinline void mark_location ( void *, LineInfo * ) {}
-        __forceinline void mark_comment ( void *, const char * ) {}
+            track_comment(ptr, what);
+#endif
+        }
+#if DAS_TRACK_ALLOCATIONS
+        virtual void track_location ( void *, LineInfo * )  {}
+        virtual void track_comment ( void *, const char * ) {}
 #endif
     public:
         char * allocateName ( const string & name );
+        // lambda captures and generator frames go through the closure pool. blocks reused from the pool are sampled too
+        __forceinline char * allocateClosure ( uint64_t size ) {
+            size = (size + 15) & ~uint64_t(15);
+            if ( char * ptr = closures.allocate(size) ) return sampled(ptr, size);
+            return allocate(size);
+        }
+        __forceinline void freeClosure ( char * ptr, uint64_t size ) {
+            size = (size + 15) & ~uint64_t(15);
+            if ( !closures.free(ptr, size) ) free(ptr, size);
+        }
+    public:
+        HeapSampler * sampler = nullptr;
+        ClosurePool   closures;
+    protected:
+        __forceinline char * sampled ( char * ptr, uint64_t size ) {
+            if ( sampler && ptr ) sampler->allocated(ptr, size);
+            return ptr;
+        }
     };
 
+    // interned strings keep their hash, so the intern map never rehashes the text
     struct StrHashEntry {
         const char * ptr;
         uint32_t     length;
-        StrHashEntry() : ptr(nullptr), length(0) {}
-        StrHashEntry( const char * p, uint32_t l ) : ptr(p), length(l) {}
+        uint32_t     hash;
+        StrHashEntry() : ptr(nullptr), length(0), hash(0) {}
+        StrHashEntry( const char * p, uint32_t l ) : ptr(p), length(l), hash(wyhash32((const uint8_t *)p, l)) {}
+        StrHashEntry( const char * p, uint32_t l, uint32_t h ) : ptr(p), length(l), hash(h) {}
+    };
+
+    // direct mapped cache of interned string pointers and their hashes
+    // table lookups with interned keys take the hash from here, without reading the string
+    #ifndef DAS_INTERN_HASH_CACHE_SIZE
+    #define DAS_INTERN_HASH_CACHE_SIZE  4096
+    #endif
+
+    struct InternHashSlot {
+        const char * ptr = nullptr;
+        uint32_t     hash = 0;
     };
 
     struct StrEqPred {
         __forceinline bool operator()( const StrHashEntry & a, const StrHashEntry & b ) const {
             if ( a.ptr==b.ptr ) return true;
-            else if ( a.length!=b.length ) return false;
+            else if ( a.length!=b.length || a.hash!=b.hash ) return false;
             else return strncmp(a.ptr, b.ptr, a.length)==0;
         }
     };
 
     struct StrHashPred {
         __forceinline size_t operator() ( const StrHashEntry & a ) const {
-            return hash_block32((const uint8_t *)a.ptr, a.length);
+            return a.hash;
         }
     };
 
     typedef das_hash_set<StrHashEntry,StrHashPred,StrEqPred> das_string_set;
 
+    class ConstStringAllocator;
+
     class StringHeapAllocator : public AnyHeapAllocator {
     public:
         virtual void forEachString ( const function<void (const char *)> & fn ) = 0;
@@ -176,36 +324,68 @@ namespace das {
         char * allocateString ( const char * text, uint32_t length );
         char * allocateString ( const string & str );
         void freeString ( char * text, uint32_t length );
-        void setIntern ( bool on );
+        // when interning, equal strings share one pointer with the constant strings too
+        void setIntern ( bool on, ConstStringAllocator * constStrings = nullptr );
         bool isIntern() const { return needIntern; }
         char * intern ( const char * str, uint32_t length ) const;
-        void recognize ( char * str );
+        char * recognize ( char * str );
+        __forceinline bool cachedHash ( const char * str, uint32_t & hash ) const {
+            if ( hashCache.empty() ) return false;
+            const auto & slot = hashCache[hashSlot(str)];
+            if ( slot.ptr!=str ) return false;
+            hash = slot.hash;
+            return true;
+        }
+    protected:
+        char * intern ( const StrHashEntry & key ) const;
+        static __forceinline uint32_t hashSlot ( const char * str ) {
+            return uint32_t(uintptr_t(str) >> 2) & (DAS_INTERN_HASH_CACHE_SIZE - 1);
+        }
+        __forceinline void cacheHash ( const char * str, uint32_t hash ) {
+            if ( !hashCache.empty() ) {
+                auto & slot = hashCache[hashSlot(str)];
+                slot.ptr = str;
+                slot.hash = hash;
+            }
+        }
+        __forceinline void uncacheHash ( const char * str ) {
+            if ( !hashCache.empty() ) {
+                auto & slot = hashCache[hashSlot(str)];
+                if ( slot.ptr==str ) slot.ptr = nullptr;
+            }
+        }
+        void clearHashCache();
     protected:
         das_string_set internMap;
+        vector<InternHashSlot> hashCache;
+        ConstStringAllocator * constStringHeap = nullptr;
         bool needIntern = false;
     };
 
     class PersistentHeapAllocator : public AnyHeapAllocator {
     public:
         PersistentHeapAllocator() {}
-        virtual char * allocate ( uint32_t size ) override { return model.allocate(size); }
-        virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
-        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
+        virtual char * allocate ( uint64_t size ) override { return sampled(model.allocate(size),size); }
+        virtual void free ( char * ptr, uint64_t size ) override { model.free(ptr,size); }
+        virtual char * reallocate ( char * ptr, uint64_t oldSize, uint64_t newSize ) override { return sampled(model.reallocate(ptr,oldSize,newSize),newSize); }
         virtual int depth() const override { return model.depth(); }
-        virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
+        virtual uint64_t bytesAllocated() const override { return model.bytesAllocated() - closures.pooledBytes; }
         virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
-        virtual void reset() override { model.reset(); }
+        virtual void getHeapStats ( HeapStats & stats ) const override { model.getHeapStats(stats); }
+        virtual void getSizeClassStats ( vector<HeapSizeClassStats> & classes ) const override { model.getSizeClassStats(classes); }
+        virtual void reset() override { closures.reset(); model.reset(); }
         virtual void report() override;
         virtual bool mark() override { return false; }
-        virtual void mark ( char *, uint32_t ) override { DAS_ASSERT(0 && "not supported"); }
+        virtual void mark ( char *, uint64_t ) override { DAS_ASSERT(0 && "not supported"); }
         virtual void sweep() override { model.sweep(); }
-        virtual bool isOwnPtr ( char * ptr, uint32_t size ) override { return model.isOwnPtr(ptr,size); }
+        virtual bool isOwnPtr ( char * ptr, uint64_t size ) override { return model.isOwnPtr(ptr,size); }
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
         virtual int32_t getInitialSize() const override { return model.initialSize; }
         virtual void setGrowFunction ( CustomGrowFunction && fun ) override { model.customGrow = fun; };
+        virtual void setReserveFunction ( CustomReserveFunction && fun ) override { model.customReserve = fun; };
 #if DAS_TRACK_ALLOCATIONS
-        virtual void mark_location ( void * ptr, LineInfo * at ) override  { model.mark_location(ptr,at); };
-        virtual  void mark_comment ( void * ptr, const char * what ) override { model.mark_comment(ptr,what); };
+        virtual void track_location ( void * ptr, LineInfo * at ) override { model.mark_location(ptr,at); };
+        virtual void track_comment ( void * ptr, const char * what ) override { model.mark_comment(ptr,what); };
 #endif
     protected:
         MemoryModel model;
@@ -214,21 +394,24 @@ namespace das {
     class LinearHeapAllocator : public AnyHeapAllocator {
     public:
         LinearHeapAllocator() {}
-        virtual char * allocate ( uint32_t size ) override { return model.allocate(size); }
-        virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
-        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
+        virtual char * allocate ( uint64_t size ) override { return sampled(model.allocate(size),size); }
+        virtual void free ( char * ptr, uint64_t size ) override { model.free(ptr,size); }
+        virtual char * reallocate ( char * ptr, uint64_t oldSize, uint64_t newSize ) override { return sampled(model.reallocate(ptr,oldSize,newSize),newSize); }
         virtual int depth() const override { return model.depth(); }
-        virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
+        virtual uint64_t bytesAllocated() const override { return model.bytesAllocated() - closures.pooledBytes; }
         virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
-        virtual void reset() override { model.reset(); }
+        virtual void getHeapStats ( HeapStats & stats ) const override { model.getHeapStats(stats); }
+        virtual void getSizeClassStats ( vector<HeapSizeClassStats> & classes ) const override { model.getSizeClassStats(classes); }
+        virtual void reset() override { closures.reset(); model.reset(); }
         virtual void report() override;
         virtual bool mark() override { return false; }
-        virtual void mark ( char *, uint32_t ) override { DAS_ASSERT(0 && "not supported"); }
+        virtual void mark ( char *, uint64_t ) override { DAS_ASSERT(0 && "not supported"); }
         virtual void sweep() override { DAS_ASSERT(0 && "not supported"); }
-        virtual bool isOwnPtr ( char * ptr, uint32_t ) override { return model.isOwnPtr(ptr); }
+        virtual bool isOwnPtr ( char * ptr, uint64_t ) override { return model.isOwnPtr(ptr); }
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
         virtual int32_t getInitialSize() const override { return model.initialSize; }
         virtual void setGrowFunction ( CustomGrowFunction && fun ) override { model.customGrow = fun; };
+        virtual void setReserveFunction ( CustomReserveFunction && fun ) override { model.customReserve = fun; };
     protected:
         LinearChunkAllocator model;
     };
@@ -248,6 +431,7 @@ namespace das {
         }
         virtual void reset () override;
         char * intern ( const char * str, uint32_t length ) const;
+        char * intern ( const StrHashEntry & key ) const;
     protected:
         das_string_set internMap;
     };
@@ -255,25 +439,28 @@ namespace das {
     class PersistentStringAllocator : public StringHeapAllocator {
     public:
         PersistentStringAllocator() { model.alignMask = 3; }
-        virtual char * allocate ( uint32_t size ) override { return model.allocate(size); }
-        virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
-        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
+        virtual char * allocate ( uint64_t size ) override { return sampled(model.allocate(size),size); }
+        virtual void free ( char * ptr, uint64_t size ) override { model.free(ptr,size); }
+        virtual char * reallocate ( char * ptr, uint64_t oldSize, uint64_t newSize ) override { return sampled(model.reallocate(ptr,oldSize,newSize),newSize); }
         virtual int depth() const override { return model.depth(); }
         virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
         virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
+        virtual void getHeapStats ( HeapStats & stats ) const override { model.getHeapStats(stats); }
+        virtual void getSizeClassStats ( vector<HeapSizeClassStats> & classes ) const override { model.getSizeClassStats(classes); }
         virtual void reset() override { model.reset(); }
         virtual void forEachString ( const function<void (const char *)> & fn ) override ;
         virtual void report() override ;
         virtual bool mark() override;
-        virtual void mark ( char * ptr, uint32_t size ) override;
+        virtual void mark ( char * ptr, uint64_t size ) override;
         virtual void sweep() override;
-        virtual bool isOwnPtr ( char * ptr, uint32_t size ) override { return model.isOwnPtr(ptr,size); }
+        virtual bool isOwnPtr ( char * ptr, uint64_t size ) override { return model.isOwnPtr(ptr,size); }
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
         virtual int32_t getInitialSize() const override { return model.initialSize; }
         virtual void setGrowFunction ( CustomGrowFunction && fun ) override { model.customGrow = fun; };
+        virtual void setReserveFunction ( CustomReserveFunction && fun ) override { model.customReserve = fun; };
 #if DAS_TRACK_ALLOCATIONS
-        virtual void mark_location ( void * ptr, LineInfo * at ) override { model.mark_location(ptr,at); };
-        virtual  void mark_comment ( void * ptr, const char * what ) override { model.mark_comment(ptr,what); };
+        virtual void track_location ( void * ptr, LineInfo * at ) override { model.mark_location(ptr,at); };
+        virtual void track_comment ( void * ptr, const char * what ) override { model.mark_comment(ptr,what); };
 #endif
     protected:
         MemoryModel model;
@@ -282,22 +469,25 @@ namespace das {
     class LinearStringAllocator : public StringHeapAllocator {
     public:
         LinearStringAllocator() { model.alignMask = 3; }
-        virtual char * allocate ( uint32_t size ) override { return model.allocate(size); }
-        virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
-        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
+        virtual char * allocate ( uint64_t size ) override { return sampled(model.allocate(size),size); }
+        virtual void free ( char * ptr, uint64_t size ) override { model.free(ptr,size); }
+        virtual char * reallocate ( char * ptr, uint64_t oldSize, uint64_t newSize ) override { return sampled(model.reallocate(ptr,oldSize,newSize),newSize); }
         virtual int depth() const override { return model.depth(); }
         virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
         virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
+        virtual void getHeapStats ( HeapStats & stats ) const override { model.getHeapStats(stats); }
+        virtual void getSizeClassStats ( vector<HeapSizeClassStats> & classes ) const override { model.getSizeClassStats(classes); }
         virtual void reset() override { model.reset(); }
         virtual void forEachString ( const function<void (const char *)> & fn ) override;
         virtual void report() override;
         virtual bool mark() override { return false; }
-        virtual void mark ( char *, uint32_t ) override { DAS_ASSERT(0 && "not supported"); }
+        virtual void mark ( char *, uint64_t ) override { DAS_ASSERT(0 && "not supported"); }
         virtual void sweep() override { DAS_ASSERT(0 && "not supported"); }
-        virtual bool isOwnPtr ( char * ptr, uint32_t ) override { return model.isOwnPtr(ptr); }
+        virtual bool isOwnPtr ( char * ptr, uint64_t ) override { return model.isOwnPtr(ptr); }
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
         virtual int32_t getInitialSize() const override { return model.initialSize; }
         virtual void setGrowFunction ( CustomGrowFunction && fun ) override { model.customGrow = fun; };
+        virtual void setReserveFunction ( CustomReserveFunction && fun ) override { model.customReserve = fun; };
     protected:
         LinearChunkAllocator model;
     };
@@ -483,7 +673,7 @@ namespace das {
             prefixWithHeader = false;
             initialSize = 1024;
         }
-        virtual uint32_t grow ( uint32_t size ) override {
+        virtual uint64_t grow ( uint64_t size ) override {
             return size;
         }
         das_hash_map<uint32_t,TypeInfo *>    lookup;
@@ -19,7 +19,7 @@ namespace das
             Array * pA = (Array *) l->evalPtr(context);
             auto idx = uint32_t(r->evalInt(context));
             if ( idx >= pA->size ) context.throw_error_at(debugInfo,"array index out of range, %u of %u", idx, pA->size);
-            return pA->data + idx*stride + offset;
+            return pA->data + uint64_t(idx)*stride + offset;
         }
         SimNode * l, * r;
         uint32_t stride, offset;
@@ -64,7 +64,7 @@ namespace das
             if ( !pA ) return nullptr;
             auto idx = uint32_t(r->evalInt(context));
             if (idx >= pA->size) return nullptr;
-            return pA->data + idx*stride + offset;
+            return pA->data + uint64_t(idx)*stride + offset;
         }
     };
 
@@ -73,6 +73,8 @@ namespace das
         virtual bool first ( Context & context, char * value ) override;
         virtual bool next  ( Context & context, char * value ) override;
         virtual void close ( Context & context, char * value ) override;
+        virtual uint32_t next_batch ( Context & context, char * value, char * values, uint32_t stride, uint32_t count ) override;
+        virtual int32_t size_hint () const override { return int32_t(array->size); }
         Array *     array;
         uint32_t    stride;
         char *      data = nullptr;
@@ -93,6 +95,8 @@ namespace das
         virtual bool first ( Context & context, char * value ) override;
         virtual bool next  ( Context & context, char * value ) override;
         virtual void close ( Context & context, char * value ) override;
+        virtual uint32_t next_batch ( Context & context, char * value, char * values, uint32_t stride, uint32_t count ) override;
+        virtual int32_t size_hint () const override { return int32_t(size); }
         char *      data;
         uint32_t    size;
         uint32_t    stride;
@@ -9,6 +9,8 @@ namespace das
         virtual bool first ( Context & context, char * value ) override;
         virtual bool next  ( Context & context, char * value ) override;
         virtual void close ( Context & context, char * value ) override;
+        virtual uint32_t next_batch ( Context & context, char * value, char * values, uint32_t stride, uint32_t count ) override;
+        virtual int32_t size_hint () const override { return rng.to > rng.from ? rng.to - rng.from : 0; }
         range   rng;
         int32_t range_to;
     };
@@ -11,6 +11,7 @@ namespace das
         virtual bool first ( Context & context, char * value ) override;
         virtual bool next  ( Context & context, char * value ) override;
         virtual void close ( Context & context, char * value ) override;
+        virtual uint32_t next_batch ( Context & context, char * value, char * values, uint32_t stride, uint32_t count ) override;
         char * str;
     };
 
@@ -8,7 +8,6 @@ namespace das
 
     // TODO:
     //  -   return correct insert index of original value? is this at all possible?
-    //  -   throw runtime error in the context, when grow inside locked table (recover well)
 
     extern const char * rts_null;
 
@@ -37,13 +36,81 @@ namespace das
         }
     };
 
+    // string keys compare full hashes first, since key comparison is expensive
+    template <typename KeyType>
+    struct KeyCompareHashFirst { enum { value = false }; };
+    template <> struct KeyCompareHashFirst<char *> { enum { value = true }; };
+    template <> struct KeyCompareHashFirst<const char *> { enum { value = true }; };
+
+    // control bytes of the table slots. full slots store 7 bits of the hash
+    #define DAS_TABLE_CTRL_EMPTY    uint8_t(0x80)
+    #define DAS_TABLE_CTRL_DELETED  uint8_t(0xfe)
+    #define DAS_TABLE_GROUP_SIZE    16
+    #define DAS_TABLE_BATCH_SIZE    16
+
+    // group of 16 control bytes, matched at once
+    struct TableGroup {
+#if _TARGET_SIMD_SSE
+        __m128i ctrl;
+        __forceinline TableGroup ( const uint8_t * pos ) {
+            ctrl = _mm_loadu_si128((const __m128i *)pos);
+        }
+        __forceinline uint32_t match ( uint8_t tag ) const {
+            return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(char(tag)))));
+        }
+        __forceinline uint32_t matchEmptyOrDeleted () const {
+            return uint32_t(_mm_movemask_epi8(ctrl));
+        }
+#elif _TARGET_SIMD_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+        uint8x16_t ctrl;
+        __forceinline TableGroup ( const uint8_t * pos ) {
+            ctrl = vld1q_u8(pos);
+        }
+        static __forceinline uint32_t bitmask ( uint8x16_t m ) {
+            static const uint8_t bits[16] = { 1,2,4,8,16,32,64,128, 1,2,4,8,16,32,64,128 };
+            uint8x16_t b = vandq_u8(m, vld1q_u8(bits));
+            return uint32_t(vaddv_u8(vget_low_u8(b))) | (uint32_t(vaddv_u8(vget_high_u8(b))) << 8);
+        }
+        __forceinline uint32_t match ( uint8_t tag ) const {
+            return bitmask(vceqq_u8(ctrl, vdupq_n_u8(tag)));
+        }
+        __forceinline uint32_t matchEmptyOrDeleted () const {
+            return bitmask(vcltq_s8(vreinterpretq_s8_u8(ctrl), vdupq_n_s8(0)));
+        }
+#else
+        const uint8_t * ctrl;
+        __forceinline TableGroup ( const uint8_t * pos ) : ctrl(pos) {}
+        __forceinline uint32_t match ( uint8_t tag ) const {
+            uint32_t res = 0;
+            for ( uint32_t i=0; i!=DAS_TABLE_GROUP_SIZE; ++i ) {
+                if ( ctrl[i]==tag ) res |= 1u << i;
+            }
+            return res;
+        }
+        __forceinline uint32_t matchEmptyOrDeleted () const {
+            uint32_t res = 0;
+            for ( uint32_t i=0; i!=DAS_TABLE_GROUP_SIZE; ++i ) {
+                if ( ctrl[i] & 0x80 ) res |= 1u << i;
+            }
+            return res;
+        }
+#endif
+        __forceinline uint32_t matchEmpty () const {
+            return match(DAS_TABLE_CTRL_EMPTY);
+        }
+    };
+
+    // open addressing over groups of 16 control bytes, probed with SIMD (swiss table)
+    // hashes are kept next to the keys, so that iteration, rehashing and walking do not need the hash function
+    // with DAS_TABLE_DENSE each slot points to a dense entry, so iteration is sequential and follows insertion order until erase.
+    // returned indices are entry indices, i.e. index of the value in data and of the key in keys
     template <typename KeyType>
     class TableHash {
         Context *   context = nullptr;
         uint32_t    valueTypeSize = 0;
         enum {
-            minCapacity = 8,
-            minLookups = 4
+            minCapacity = DAS_TABLE_GROUP_SIZE,
+            maxTombstonesRatio = 4
         };
     public:
         TableHash () = delete;
@@ -51,75 +118,120 @@ namespace das
         TableHash ( Context * ctx, uint32_t vs ) : context(ctx), valueTypeSize(vs) {}
 
         __forceinline uint32_t indexFromHash(uint32_t hash, uint32_t shift ) const {
-            return hash >> shift; // i don't know why this is faster, but it is
+            return (hash >> shift) & ~uint32_t(DAS_TABLE_GROUP_SIZE-1);
         }
 
         __forceinline uint32_t computeShift(uint32_t capacity) {
             return __builtin_clz(capacity-1);
         }
 
-        __forceinline uint32_t computeMaxLookups(uint32_t capacity) {
-            uint32_t desired = 32 - __builtin_clz(capacity-1);
-            return das::max(uint32_t(minLookups), desired * 6);
+        static __forceinline uint8_t hashTag ( uint32_t hash ) {
+            return uint8_t(hash & 0x7f);
         }
 
-        __forceinline int find ( const Table & tab, KeyType key, uint32_t hash ) const {
+        static __forceinline uint32_t maxSize ( uint32_t capacity ) {
+            return capacity - capacity / 8;
+        }
+
+        static __forceinline bool isMatch ( const Table & tab, uint32_t entry, const KeyType * pKeys, const KeyType & key, uint32_t hash ) {
+            if ( KeyCompareHashFirst<KeyType>::value && tab.hashes[entry]!=hash ) return false;
+            return KeyCompare<KeyType>()(pKeys[entry],key);
+        }
+
+        // entry, which the slot points to
+        static __forceinline uint32_t slotEntry ( const Table & tab, uint32_t slot ) {
+#if DAS_TABLE_DENSE
+            return table_index(tab)[slot];
+#else
+            return slot;
+#endif
+        }
+
+        // there is always an empty slot, so every probe terminates
+        // groups are visited in triangular order, which covers all of them
+        __forceinline int findSlot ( const Table & tab, KeyType key, uint32_t hash ) const {
+            if ( !tab.capacity ) return -1;
             uint32_t mask = tab.capacity - 1;
-            uint32_t index = indexFromHash(hash, tab.shift);
-            uint32_t lastI = (index+tab.maxLookups) & mask;
+            uint32_t pos = indexFromHash(hash, tab.shift);
+            uint8_t tag = hashTag(hash);
+            auto pCtrl = table_ctrl(tab);
             auto pKeys = (const KeyType *) tab.keys;
-            auto pHashes = tab.hashes;
-            while ( index != lastI ) {
-                auto kh = pHashes[index];
-                if ( kh==HASH_EMPTY32 ) {
+            for ( uint32_t step=DAS_TABLE_GROUP_SIZE; ; step+=DAS_TABLE_GROUP_SIZE ) {
+                TableGroup group(pCtrl + pos);
+                for ( uint32_t bits=group.match(tag); bits; bits&=bits-1 ) {
+                    uint32_t index = pos + __builtin_ctz(bits);
+                    if ( isMatch(tab, slotEntry(tab, index), pKeys, key, hash) ) {
+                        return (int) index;
+                    }
+                }
+                if ( group.matchEmpty() ) {
                     return -1;
-                } else if ( kh==hash && KeyCompare<KeyType>()(pKeys[index],key) ) {
-                    return (int) index;
                 }
-                index = (index + 1) & mask;
+                pos = (pos + step) & mask;
             }
-            return -1;
+        }
+
+        __forceinline int find ( const Table & tab, KeyType key, uint32_t hash ) const {
+            int slot = findSlot(tab, key, hash);
+            return slot!=-1 ? (int) slotEntry(tab, slot) : -1;
         }
 
         __forceinline int insertNew ( Table & tab, uint32_t hash ) const {
-            // TODO: take key under account and be less agressive?
             uint32_t mask = tab.capacity - 1;
-            uint32_t index = indexFromHash(hash, tab.shift);
-            uint32_t lastI = (index+tab.maxLookups) & mask;
-            auto pHashes = tab.hashes;
-            while ( index != lastI ) {
-                auto kh = pHashes[index];
-                if ( kh==HASH_EMPTY32 ) {
-                    return (int) index;
+            uint32_t pos = indexFromHash(hash, tab.shift);
+            auto pCtrl = table_ctrl(tab);
+            for ( uint32_t step=DAS_TABLE_GROUP_SIZE; ; step+=DAS_TABLE_GROUP_SIZE ) {
+                TableGroup group(pCtrl + pos);
+                if ( uint32_t bits = group.matchEmptyOrDeleted() ) {
+                    return (int) (pos + __builtin_ctz(bits));
                 }
-                index = (index + 1) & mask;
+                pos = (pos + step) & mask;
             }
-            return -1;
         }
 
         __forceinline int reserve ( Table & tab, KeyType key, uint32_t hash ) {
+            uint8_t tag = hashTag(hash);
             for ( ;; ) {
-                uint32_t mask = tab.capacity - 1;
-                uint32_t index = indexFromHash(hash, tab.shift);
-                uint32_t lastI = (index+tab.maxLookups) & mask;
-                uint32_t insertI = -1u;
-                auto pKeys = (KeyType *) tab.keys;
-                auto pHashes = tab.hashes;
-                while ( index != lastI ) {
-                    auto kh = pHashes[index];
-                    if (kh == HASH_EMPTY32 ) {
-                        if ( tab.isLocked() ) context->throw_error("can't insert into locked table");
-                        if ( insertI != -1u ) index = insertI;
-                        pHashes[index] = hash;
-                        pKeys[index] = key;
+                if ( tab.capacity ) {
+                    uint32_t mask = tab.capacity - 1;
+                    uint32_t pos = indexFromHash(hash, tab.shift);
+                    uint32_t insertI = -1u;
+                    auto pCtrl = table_ctrl(tab);
+                    auto pKeys = (KeyType *) tab.keys;
+                    auto pHashes = tab.hashes;
+                    for ( uint32_t step=DAS_TABLE_GROUP_SIZE; ; step+=DAS_TABLE_GROUP_SIZE ) {
+                        TableGroup group(pCtrl + pos);
+                        for ( uint32_t bits=group.match(tag); bits; bits&=bits-1 ) {
+                            uint32_t index = slotEntry(tab, pos + __builtin_ctz(bits));
+                            if ( isMatch(tab, index, pKeys, key, hash) ) {
+                                return (int) index;
+                            }
+                        }
+                        if ( uint32_t bits = group.matchEmptyOrDeleted() ) {
+                            if ( insertI==-1u ) insertI = pos + __builtin_ctz(bits);
+                            if ( group.matchEmpty() ) break;
+                        }
+                        pos = (pos + step) & mask;
+                    }
+                    if ( tab.isLocked() ) context->throw_error("can't insert into locked table");
+                    bool reuse = pCtrl[insertI]==DAS_TABLE_CTRL_DELETED;
+                    if ( reuse || tab.size + tab.tombstones < maxSize(tab.capacity) ) {
+                        if ( reuse ) tab.tombstones--;
+#if DAS_TABLE_DENSE
+                        // new entries are appended
+                        uint32_t entry = tab.size;
+                        table_index(tab)[insertI] = entry;
+#else
+                        uint32_t entry = insertI;
+#endif
+                        pCtrl[insertI] = tag;
+                        pHashes[entry] = hash;
+                        pKeys[entry] = key;
                         tab.size++;
-                        return (int)index;
-                    } else if (kh == HASH_KILLED32) {
-                        if ( insertI == -1u ) insertI = index;
-                    } else if (kh == hash && KeyCompare<KeyType>()(pKeys[index], key)) {
-                        return (int)index;
+                        return (int) entry;
                     }
-                    index = (index + 1) & mask;
+                } else if ( tab.isLocked() ) {
+                    context->throw_error("can't insert into locked table");
                 }
                 if ( !grow(tab) ) {
                     return -1;
@@ -127,79 +239,218 @@ namespace das
             }
         }
 
-        __forceinline int erase ( Table & tab, KeyType key, uint32_t hash ) {
+#if DAS_TABLE_DENSE
+        // slot, which points to the entry. the entry is in the table
+        __forceinline uint32_t findEntrySlot ( const Table & tab, uint32_t entry ) const {
+            uint32_t hash = tab.hashes[entry];
             uint32_t mask = tab.capacity - 1;
-            uint32_t index = indexFromHash(hash, tab.shift);
-            uint32_t lastI = (index+tab.maxLookups) & mask;
-            auto pKeys = (const KeyType *) tab.keys;
-            auto pHashes = tab.hashes;
-            while ( index != lastI ) {
-                auto kh = pHashes[index];
-                if ( kh==HASH_EMPTY32 ) {
-                    return -1;
-                } else if ( kh==hash && KeyCompare<KeyType>()(pKeys[index],key) ) {
-                    tab.size--;
-                    pHashes[index] = HASH_KILLED32;
-                    memset(tab.data + index*valueTypeSize, 0, valueTypeSize);
-                    return (int) index;
+            uint32_t pos = indexFromHash(hash, tab.shift);
+            uint8_t tag = hashTag(hash);
+            auto pCtrl = table_ctrl(tab);
+            auto pIndex = table_index(tab);
+            for ( uint32_t step=DAS_TABLE_GROUP_SIZE; ; step+=DAS_TABLE_GROUP_SIZE ) {
+                TableGroup group(pCtrl + pos);
+                for ( uint32_t bits=group.match(tag); bits; bits&=bits-1 ) {
+                    uint32_t index = pos + __builtin_ctz(bits);
+                    if ( pIndex[index]==entry ) return index;
+                }
+                pos = (pos + step) & mask;
+            }
+        }
+#endif
+
+        __forceinline int erase ( Table & tab, KeyType key, uint32_t hash ) {
+            int slot = findSlot(tab, key, hash);
+            if ( slot==-1 ) return -1;
+            uint32_t index = slotEntry(tab, slot);
+            auto pCtrl = table_ctrl(tab);
+            // if the group still has an empty slot, no probe ever went past it, and the slot can be reused as empty
+            TableGroup group(pCtrl + (uint32_t(slot) & ~uint32_t(DAS_TABLE_GROUP_SIZE-1)));
+            if ( group.matchEmpty() ) {
+                pCtrl[slot] = DAS_TABLE_CTRL_EMPTY;
+            } else {
+                pCtrl[slot] = DAS_TABLE_CTRL_DELETED;
+                tab.tombstones++;
+            }
+            tab.size--;
+#if DAS_TABLE_DENSE
+            // erase is O(1). the last entry is moved into the hole, so entries stay dense
+            uint32_t last = tab.size;
+            if ( index!=last ) {
+                table_index(tab)[findEntrySlot(tab, last)] = index;
+                tab.hashes[index] = tab.hashes[last];
+                ((KeyType *)tab.keys)[index] = ((KeyType *)tab.keys)[last];
+                memcpy(tab.data + uint64_t(index)*valueTypeSize, tab.data + uint64_t(last)*valueTypeSize, valueTypeSize);
+            }
+            tab.hashes[last] = HASH_EMPTY32;
+            memset(tab.data + uint64_t(last)*valueTypeSize, 0, valueTypeSize);
+#else
+            tab.hashes[index] = pCtrl[slot]==DAS_TABLE_CTRL_EMPTY ? HASH_EMPTY32 : HASH_KILLED32;
+            memset(tab.data + uint64_t(index)*valueTypeSize, 0, valueTypeSize);
+#endif
+            // too many tombstones make probes long. compact in place, index is no longer valid after that
+            if ( tab.tombstones > tab.capacity / maxTombstonesRatio ) {
+                rehash(tab, tab.capacity);
+            }
+            return (int) index;
+        }
+
+        __forceinline void prefetch ( const Table & tab, uint32_t hash ) const {
+            uint32_t pos = indexFromHash(hash, tab.shift);
+            DAS_PREFETCH(table_ctrl(tab) + pos);
+#if DAS_TABLE_DENSE
+            DAS_PREFETCH(table_index(tab) + pos);
+#else
+            DAS_PREFETCH(tab.hashes + pos);
+#endif
+        }
+
+        // batches hash a slice of keys and prefetch the first probed group of each one
+        // before probing any of them, so cache misses within the slice overlap
+        void findBatch ( const Table & tab, const KeyType * keys, uint32_t count, int32_t * result ) const {
+            if ( !tab.capacity ) {
+                for ( uint32_t i=0; i!=count; ++i ) result[i] = -1;
+                return;
+            }
+            uint32_t hashes[DAS_TABLE_BATCH_SIZE];
+            for ( uint32_t base=0; base<count; base+=DAS_TABLE_BATCH_SIZE ) {
+                uint32_t n = das::min(count-base, uint32_t(DAS_TABLE_BATCH_SIZE));
+                for ( uint32_t i=0; i!=n; ++i ) {
+                    hashes[i] = hash_function(*context, keys[base+i]);
+                    prefetch(tab, hashes[i]);
+                }
+                for ( uint32_t i=0; i!=n; ++i ) {
+                    result[base+i] = find(tab, keys[base+i], hashes[i]);
                 }
-                index = (index + 1) & mask;
             }
-            return -1;
         }
 
+        void reserveBatch ( Table & tab, const KeyType * keys, uint32_t count, int32_t * result ) {
+            if ( !count ) return;
+            if ( tab.isLocked() ) context->throw_error("can't insert into locked table");
+            uint64_t total = uint64_t(tab.size) + count;
+            if ( total + tab.tombstones >= maxSize(tab.capacity) && total < (1ull<<31) ) {
+                rehash(tab, capacityFor(uint32_t(total)));
+            }
+            uint32_t hashes[DAS_TABLE_BATCH_SIZE];
+            for ( uint32_t base=0; base<count; base+=DAS_TABLE_BATCH_SIZE ) {
+                uint32_t n = das::min(count-base, uint32_t(DAS_TABLE_BATCH_SIZE));
+                for ( uint32_t i=0; i!=n; ++i ) {
+                    hashes[i] = hash_function(*context, keys[base+i]);
+                    prefetch(tab, hashes[i]);
+                }
+                for ( uint32_t i=0; i!=n; ++i ) {
+                    result[base+i] = reserve(tab, keys[base+i], hashes[i]);
+                }
+            }
+        }
+
+        // tables, which are mostly tombstones, are rebuilt at the same capacity
         bool grow ( Table & tab ) {
-            uint32_t newCapacity = das::max(uint32_t(minCapacity), tab.capacity*2);
-        repeatIt:;
+            uint32_t newCapacity = tab.size <= tab.capacity/2 ? tab.capacity : tab.capacity*2;
+            return rehash(tab, das::max(uint32_t(minCapacity), newCapacity));
+        }
+
+        // smallest capacity, which fits the table without growing
+        static uint32_t capacityFor ( uint32_t size ) {
+            uint32_t capacity = minCapacity;
+            while ( maxSize(capacity) <= size ) {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        // grows the table, so that size entries fit without rehashing
+        bool reserveCapacity ( Table & tab, uint32_t size ) {
+            if ( tab.isLocked() ) context->throw_error("can't reserve locked table");
+            if ( size <= tab.size || uint64_t(size) + tab.tombstones <= maxSize(tab.capacity) ) return true;
+            return rehash(tab, das::max(tab.capacity, capacityFor(size)));
+        }
+
+        bool shrink ( Table & tab ) {
+            if ( tab.isLocked() ) context->throw_error("can't shrink locked table");
+            if ( !tab.size ) {
+                if ( tab.capacity ) {
+                    context->heap->free(tab.data, table_memory_size(tab.capacity, valueTypeSize + sizeof(KeyType)));
+                }
+                tab.data = nullptr;
+                tab.keys = nullptr;
+                tab.hashes = nullptr;
+                tab.capacity = 0;
+                tab.tombstones = 0;
+                tab.shift = 0;
+                return true;
+            }
+            uint32_t newCapacity = capacityFor(tab.size);
+            if ( newCapacity < tab.capacity || tab.tombstones ) {
+                return rehash(tab, das::min(newCapacity, tab.capacity));
+            }
+            return true;
+        }
+
+        bool rehash ( Table & tab, uint32_t newCapacity ) {
             Table newTab;
-            uint32_t memSize = newCapacity * (valueTypeSize + sizeof(KeyType) + sizeof(uint32_t));
+            uint64_t memSize = table_memory_size(newCapacity, valueTypeSize + sizeof(KeyType));
             newTab.data = (char *) context->heap->allocate(memSize);
-            context->heap->mark_comment(newTab.data, "table");
             if ( !newTab.data ) {
                 context->throw_error("can't grow table, out of heap");
                 return false;
             }
-            newTab.keys = newTab.data + newCapacity * valueTypeSize;
-            newTab.hashes = (uint32_t *)(newTab.keys + newCapacity * sizeof(KeyType));
+            context->heap->mark_comment(newTab.data, "table");
+            newTab.keys = newTab.data + uint64_t(newCapacity) * valueTypeSize;
+            newTab.hashes = (uint32_t *)(newTab.keys + uint64_t(newCapacity) * sizeof(KeyType));
             newTab.size = tab.size;
             newTab.capacity = newCapacity;
             newTab.lock = tab.lock;
             newTab.flags = tab.flags;
-            newTab.maxLookups = computeMaxLookups(newCapacity);
+            newTab.tombstones = 0;
             newTab.shift = computeShift(newCapacity);
-            memset(newTab.data, 0, newCapacity*valueTypeSize);
+            memset(newTab.data, 0, uint64_t(newCapacity)*valueTypeSize);
             auto pHashes = newTab.hashes;
-            memset(pHashes, 0, newCapacity * sizeof(uint32_t));
+            memset(pHashes, 0, uint64_t(newCapacity) * sizeof(uint32_t));
+            auto pCtrl = table_ctrl(newTab);
+            memset(pCtrl, DAS_TABLE_CTRL_EMPTY, newCapacity);
             if ( tab.size ) {
                 auto pKeys = (KeyType *) newTab.keys;
-                auto pOldValues = tab.data;
                 auto pValues = newTab.data;
+#if DAS_TABLE_DENSE
+                // entries are already dense, only the index is rebuilt
+                memcpy(pValues, tab.data, uint64_t(tab.size)*valueTypeSize);
+                memcpy(pKeys, tab.keys, uint64_t(tab.size)*sizeof(KeyType));
+                memcpy(pHashes, tab.hashes, uint64_t(tab.size)*sizeof(uint32_t));
+                auto pIndex = table_index(newTab);
+                for ( uint32_t entry=0; entry!=tab.size; ++entry ) {
+                    auto hash = pHashes[entry];
+                    int slot = insertNew(newTab, hash);
+                    pCtrl[slot] = hashTag(hash);
+                    pIndex[slot] = entry;
+                }
+#else
+                auto pOldValues = tab.data;
                 auto pOldKeys = (const KeyType *) tab.keys;
                 auto pOldHashes = tab.hashes;
                 for ( uint32_t i=0; i!=tab.capacity; ++i ) {
                     auto hash = pOldHashes[i];
                     if ( hash>HASH_KILLED32 ) {
                         int index = insertNew(newTab, hash);
-                        if ( index==-1 ) {
-                             newCapacity *= 2;
-                            goto repeatIt;
-                        } else {
-                            pHashes[index] = hash;
-                            pKeys[index] = pOldKeys[i];
-                            memcpy ( pValues + index*valueTypeSize, pOldValues + i*valueTypeSize, valueTypeSize );
-                        }
+                        pCtrl[index] = hashTag(hash);
+                        pHashes[index] = hash;
+                        pKeys[index] = pOldKeys[i];
+                        memcpy ( pValues + uint64_t(index)*valueTypeSize, pOldValues + uint64_t(i)*valueTypeSize, valueTypeSize );
                     }
                 }
+#endif
             }
             if (tab.capacity) {
-                uint32_t oldSize = tab.capacity * (valueTypeSize + sizeof(KeyType) + sizeof(uint32_t));
+                uint64_t oldSize = table_memory_size(tab.capacity, valueTypeSize + sizeof(KeyType));
                 context->heap->free(tab.data, oldSize);
             }
             swap ( newTab, tab );
             return true;
         }
     };
-}
-
-
 
+    // type-erased batches, dispatched on the key type. result receives slot indices, -1 if not found
+    void table_find_batch ( Context & context, const Table & tab, Type keyType, const char * keys, uint32_t count, uint32_t valueTypeSize, int32_t * result );
+    void table_reserve_batch ( Context & context, Table & tab, Type keyType, const char * keys, uint32_t count, uint32_t valueTypeSize, int32_t * result );
+}
@@ -46,7 +46,7 @@ namespace das
             TableHash<KeyType> thh(&context,valueTypeSize);
             auto hfn = hash_function(context, key);
             int index = thh.reserve(*tab, key, hfn);    // if index==-1, it was a through, so safe to do
-            return tab->data + index * valueTypeSize + offset;
+            return tab->data + uint64_t(index) * valueTypeSize + offset;
         }
         uint32_t offset;
     };
@@ -75,7 +75,7 @@ namespace das
             TableHash<KeyType> thh(&context,PT::valueTypeSize);
             auto hfn = hash_function(context, key);
             int index = thh.find(*tab, key, hfn);
-            return index!=-1 ? tab->data + index * PT::valueTypeSize : nullptr;
+            return index!=-1 ? tab->data + uint64_t(index) * PT::valueTypeSize : nullptr;
         }
     };
 
@@ -113,7 +113,7 @@ namespace das
             auto hfn = hash_function(context, key);
             TableHash<KeyType> thh(&context,valueTypeSize);
             int index = thh.find(*tab, key, hfn);
-            return index!=-1 ? tab->data + index * valueTypeSize : nullptr;
+            return index!=-1 ? tab->data + uint64_t(index) * valueTypeSize : nullptr;
         }
     };
 
@@ -141,6 +141,8 @@ namespace das
         virtual bool first ( Context & context, char * value ) override;
         virtual bool next  ( Context & context, char * value ) override;
         virtual void close ( Context & context, char * value ) override;
+        virtual uint32_t next_batch ( Context & context, char * value, char * values, uint32_t stride, uint32_t count ) override;
+        virtual int32_t size_hint () const override { return int32_t(table->size); }
         virtual char * getData () const = 0;
         const Table *   table;
         uint32_t        stride = 0;
@@ -30,6 +30,9 @@ namespace das
 
     #define MAX_FOR_ITERATORS   32
 
+    // native consumers of iterators, i.e. to_array, fetch this many values at a time
+    #define DAS_ITERATOR_BATCH_SIZE     16
+
     #if DAS_ENABLE_PROFILER
         #define DAS_PROFILE_NODE    profileNode(this);
     #else
@@ -172,6 +175,57 @@ namespace das
         virtual SimNode * visit ( SimNode * node ) { return node; }
     };
 
+    struct ContextMemoryLimits {
+        uint64_t    heapLimit = 0;              // hard limits, 0 means no limit
+        uint64_t    stringHeapLimit = 0;
+        uint64_t    totalLimit = 0;
+        uint64_t    heapSoftLimit = 0;          // soft limits, 0 means no notification
+        uint64_t    stringHeapSoftLimit = 0;
+        uint64_t    totalSoftLimit = 0;
+        __forceinline bool any() const {
+            return heapLimit || stringHeapLimit || totalLimit || heapSoftLimit || stringHeapSoftLimit || totalSoftLimit;
+        }
+    };
+
+    // called when soft limit is crossed, from inside of the allocation
+    // it is not safe to collect heap from the callback. host is expected to schedule collection instead
+    typedef function<void(Context * context, uint64_t heapBytes, uint64_t stringHeapBytes)> SoftMemoryLimitCallback;
+
+    struct AllocationFrame {
+        FuncInfo *  info = nullptr;         // nullptr for AOT frames
+        LineInfo *  line = nullptr;         // where this function was called from
+    };
+
+    struct AllocationSite {
+        LineInfo *      at = nullptr;       // exact allocation location, when known
+        const char *    comment = nullptr;  // what was allocated, when known
+        bool            stringHeap = false;
+        vector<AllocationFrame> stack;      // innermost first
+        uint64_t        samples = 0;
+        uint64_t        sampledBytes = 0;
+        uint64_t        estimatedBytes = 0; // each sample accounts for at least one sampling interval
+    };
+
+    // samples one allocation per 'interval' bytes on average, and attributes it to the call stack
+    class AllocationSampler : public HeapSampler {
+    public:
+        AllocationSampler ( Context * ctx, uint64_t inter, bool isStringHeap );
+        void getSites ( vector<AllocationSite> & result ) const;
+        void clear();
+    protected:
+        virtual void sample ( char * ptr, uint64_t size ) override;
+        virtual void sampleLocation ( LineInfo * at ) override;
+        virtual void sampleComment ( const char * what ) override;
+        void record ( int64_t dir );
+        uint64_t nextInterval();
+    protected:
+        Context *       context = nullptr;
+        uint64_t        interval = 0;
+        uint64_t        seed = 0x2545F4914F6CDD1Dull;
+        AllocationSite  pending;
+        das_hash_map<uint64_t,AllocationSite> sites;
+    };
+
     void printSimNode ( TextWriter & ss, Context * context, SimNode * node, bool debugHash=false );
     class Function;
     void printSimFunction ( TextWriter & ss, Context * context, Function * fun, SimNode * node, bool debugHash=false );
@@ -513,6 +567,20 @@ namespace das
         void relocateCode();
         void collectStringHeap(LineInfo * at);
 
+        void setMemoryLimits ( const ContextMemoryLimits & limits );
+        __forceinline const ContextMemoryLimits & getMemoryLimits() const { return memoryLimits; }
+        void setSoftMemoryLimitCallback ( SoftMemoryLimitCallback && callback );
+        void installMemoryLimits();
+        __forceinline bool isSoftMemoryLimitReached() const { return softMemoryLimitReached; }
+        __forceinline void clearSoftMemoryLimitReached() { softMemoryLimitReached = false; }
+        uint64_t getTotalHeapBytesAllocated() const;
+
+        void setAllocationSampling ( uint64_t interval );
+        __forceinline uint64_t getAllocationSamplingInterval() const { return allocationSamplingInterval; }
+        void resetAllocationSampling();
+        void getTopAllocationSites ( vector<AllocationSite> & sites, uint32_t count ) const;
+        string reportAllocationSites ( uint32_t count ) const;
+
         uint64_t getSharedMemorySize() const;
         uint64_t getUniqueMemorySize() const;
 
@@ -556,6 +624,14 @@ namespace das
         int totalVariables = 0;
         int totalFunctions = 0;
         SimNode * aotInitScript = nullptr;
+        ContextMemoryLimits memoryLimits;
+        SoftMemoryLimitCallback softMemoryLimitCallback;
+        bool softMemoryLimitReached = false;
+        bool insideSoftMemoryLimitCallback = false;
+        void reserveHeapMemory ( bool isStringHeap, uint64_t bytes );
+        uint64_t            allocationSamplingInterval = 0;
+        AllocationSampler * heapSampler = nullptr;
+        AllocationSampler * stringHeapSampler = nullptr;
     public:
         uint32_t *  tabMnLookup = nullptr;
         uint32_t    tabMnMask = 0;
@@ -605,6 +681,11 @@ namespace das
         virtual bool next  ( Context & context, char * value ) = 0;
         virtual void close ( Context & context, char * value ) = 0;    // can't throw
         virtual void walk ( DataWalker & ) { }
+        // writes up to count values, which follow the current one, stride bytes apart
+        // returns less than count only once sequence is over. default one steps via next
+        virtual uint32_t next_batch ( Context & context, char * value, char * values, uint32_t stride, uint32_t count );
+        // number of values the iterator produces, if it is known before the iteration starts. -1 otherwise
+        virtual int32_t size_hint () const { return -1; }
        bool isOpen = false;
     };
 
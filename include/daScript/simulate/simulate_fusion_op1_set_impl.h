@@ -3,10 +3,11 @@
         Op1FusionPoint_##OPNAME##_##CTYPE ( ) {} \
         IMPLEMENT_ANY_OP1_SET_NODE(INLINE,OPNAME,TYPE,CTYPE,RCTYPE,Local); \
         IMPLEMENT_ANY_OP1_SET_NODE(INLINE,OPNAME,TYPE,CTYPE,RCTYPE,Argument); \
+        IMPLEMENT_ANY_OP1_SET_NODE(INLINE,OPNAME,TYPE,CTYPE,RCTYPE,ArgumentRef); \
         virtual SimNode * match(const SimNodeInfoLookup & info, SimNode *, SimNode * node_x, Context * context) override { \
             if ( !node_x ) { return nullptr; } \
             MATCH_ANY_OP1_NODE(CTYPE,"GetLocal",Local) \
-            MATCH_ANY_OP1_NODE(CTYPE,"GetArgument",Argument) \
+            MATCH_ANY_OP1_NODE(CTYPE,"GetArgument",ArgumentRef) \
             MATCH_ANY_OP1_NODE(CTYPE,"GetArgumentRef",Argument) \
             return nullptr; \
         } \
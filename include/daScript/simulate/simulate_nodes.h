@@ -1668,7 +1668,8 @@ SIM_NODE_AT_VECTOR(Float, float)
             DAS_PROFILE_NODE
             char * ptr;
             if ( !persistent ) {
-                ptr = context.heap->allocate(bytes + (typeInfo ? 16 : 0));
+                // only lambda captures come with type info
+                ptr = typeInfo ? context.heap->allocateClosure(bytes + 16) : context.heap->allocate(bytes);
                 context.heap->mark_comment(ptr, "new [[ ]]");
                 context.heap->mark_location(ptr, &debugInfo);
             } else {
@@ -1705,7 +1706,8 @@ SIM_NODE_AT_VECTOR(Float, float)
             DAS_PROFILE_NODE
             char * ptr;
             if ( !persistent ) {
-                ptr = context.heap->allocate(bytes + (typeInfo ? 16 : 0));
+                // only lambda captures come with type info
+                ptr = typeInfo ? context.heap->allocateClosure(bytes + 16) : context.heap->allocate(bytes);
                 context.heap->mark_comment(ptr, "new [[ ]]");
                 context.heap->mark_location(ptr, &debugInfo);
             } else {
@@ -136,6 +136,39 @@ namespace das {
         return sti;
     }
 
+    // raw pod, where every byte belongs to some field
+    static bool isDensePod ( const TypeDeclPtr & type ) {
+        switch ( type->baseType ) {
+        case Type::tBool:   case Type::tInt8:   case Type::tUInt8:  case Type::tInt16:  case Type::tUInt16:
+        case Type::tInt64:  case Type::tUInt64: case Type::tInt:    case Type::tInt2:   case Type::tInt3:
+        case Type::tInt4:   case Type::tUInt:   case Type::tUInt2:  case Type::tUInt3:  case Type::tUInt4:
+        case Type::tFloat:  case Type::tFloat2: case Type::tFloat3: case Type::tFloat4: case Type::tDouble:
+        case Type::tRange:  case Type::tURange: case Type::tEnumeration:    case Type::tEnumeration8:
+        case Type::tEnumeration16:  case Type::tBitfield:
+            return true;
+        case Type::tStructure: {
+                if ( !type->structType ) return false;
+                int offset = 0;
+                for ( const auto & fd : type->structType->fields ) {
+                    if ( fd.offset!=offset || !isDensePod(fd.type) ) return false;
+                    offset += fd.type->getSizeOf();
+                }
+                return offset==type->structType->getSizeOf();
+            }
+        case Type::tTuple: {
+                int offset = 0;
+                for ( size_t i=0; i!=type->argTypes.size(); ++i ) {
+                    const auto & argT = type->argTypes[i];
+                    if ( type->getTupleFieldOffset(int(i))!=offset || !isDensePod(argT) ) return false;
+                    offset += argT->getSizeOf();
+                }
+                return offset==type->getTupleSize();
+            }
+        default:
+            return false;
+        }
+    }
+
     TypeInfo * DebugInfoHelper::makeTypeInfo ( TypeInfo * info, const TypeDeclPtr & type ) {
         if ( info==nullptr ) {
             string mangledName = type->getMangledName();
@@ -186,6 +219,8 @@ namespace das {
             info->flags |= TypeInfo::flag_isRawPod;
         if (type->smartPtr)
             info->flags |= TypeInfo::flag_isSmartPtr;
+        if (isDensePod(type))
+            info->flags |= TypeInfo::flag_isDensePod;
         if ( type->firstType ) {
             info->firstType = makeTypeInfo(nullptr, type->firstType);
         } else {
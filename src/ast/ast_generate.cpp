@@ -95,9 +95,71 @@ namespace das {
         return call;
     }
 
+    // variables, constants, their fields, and calls to builtin functions without side effects
+    static bool isExpressionRepeatable ( Expression * expr ) {
+        if ( expr->rtti_isVar() || expr->rtti_isConstant() ) {
+            return true;
+        } else if ( expr->rtti_isR2V() ) {
+            return isExpressionRepeatable(static_cast<ExprRef2Value *>(expr)->subexpr.get());
+        } else if ( expr->rtti_isField() ) {
+            return isExpressionRepeatable(static_cast<ExprField *>(expr)->value.get());
+        } else if ( expr->rtti_isCall() ) {
+            auto call = static_cast<ExprCall *>(expr);
+            if ( !call->func || !call->func->builtIn || call->func->sideEffectFlags ) return false;
+            for ( auto & arg : call->arguments ) {
+                if ( !isExpressionRepeatable(arg.get()) ) return false;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // number of elements the comprehension produces, if it is cheap to know upfront
+    //  the loop stops at the shortest source, so every source has to be of known size
+    //  fixed arrays limit the loop statically, arrays and ranges are checked via size_hint(source)
+    //  the result is the smallest of them, via min_size_hint(a,b)
+    static ExpressionPtr generateComprehensionSize ( ExprArrayComprehension * expr ) {
+        if ( expr->exprWhere ) return nullptr;
+        auto pFor = static_pointer_cast<ExprFor>(expr->exprFor);
+        ExpressionPtr pSize;
+        uint32_t fixedSize = UINT32_MAX;
+        for ( auto & src : pFor->sources ) {
+            if ( !src->type ) return nullptr;
+            if ( src->type->dim.size() ) {
+                fixedSize = das::min(fixedSize, uint32_t(src->type->dim.back()));
+            } else if ( (src->type->isGoodArrayType() || (src->type->baseType==Type::tRange)) && isExpressionRepeatable(src.get()) ) {
+                auto pHint = make_smart<ExprCall>(expr->at, "size_hint");
+                pHint->generated = true;
+                pHint->arguments.push_back(src->clone());
+                if ( pSize ) {
+                    auto pMin = make_smart<ExprCall>(expr->at, "min_size_hint");
+                    pMin->generated = true;
+                    pMin->arguments.push_back(pSize);
+                    pMin->arguments.push_back(pHint);
+                    pSize = pMin;
+                } else {
+                    pSize = pHint;
+                }
+            } else {
+                return nullptr;     // iterators, strings, etc. - size is not known upfront
+            }
+        }
+        if ( fixedSize != UINT32_MAX ) {
+            auto pFixed = make_smart<ExprConstInt>(expr->at, int32_t(fixedSize));
+            if ( !pSize ) return pFixed;
+            auto pMin = make_smart<ExprCall>(expr->at, "min_size_hint");
+            pMin->generated = true;
+            pMin->arguments.push_back(pSize);
+            pMin->arguments.push_back(pFixed);
+            return pMin;
+        }
+        return pSize;
+    }
+
     // array comprehension
     //  invoke( $()
     //      let temp : Array<expr->subexpr->type>
+    //      reserve(temp, size)     // if size is known
     //      for .....
     //          if where ....
     //              push(temp, subexpr)
@@ -125,6 +187,19 @@ namespace das {
         pLet->visibility = static_pointer_cast<ExprFor>(expr->exprFor)->visibility;
         pLet->variables.push_back(pVar);
         pClosure->list.push_back(pLet);
+        // reserve(temp, size)
+        if ( auto pSize = generateComprehensionSize(expr) ) {
+            auto pReserveVal = make_smart<ExprVar>();
+            pReserveVal->at = expr->at;
+            pReserveVal->name = compName;
+            auto pReserve = make_smart<ExprCall>();
+            pReserve->generated = true;
+            pReserve->at = expr->at;
+            pReserve->name = "reserve";
+            pReserve->arguments.push_back(pReserveVal);
+            pReserve->arguments.push_back(pSize);
+            pClosure->list.push_back(pReserve);
+        }
         // push(temp, subexpr)
         auto pPushVal = make_smart<ExprVar>();
         pPushVal->at = expr->at;
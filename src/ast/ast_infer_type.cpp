@@ -3252,6 +3252,11 @@ namespace das {
                         expr->index->at, CompilationError::invalid_table_type);
                     return Visitor::visit(expr);
                 }
+                if ( seT->secondType->isVoid() ) {
+                    error("can't index in the set, use insert or key_exists instead", "", "",
+                        expr->index->at, CompilationError::invalid_table_type);
+                    return Visitor::visit(expr);
+                }
                 expr->type = make_smart<TypeDecl>(*seT->secondType);
                 expr->type->ref = true;
                 expr->type->constant |= seT->constant;
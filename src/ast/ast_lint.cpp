@@ -339,6 +339,8 @@ namespace das {
         "persistent_string_heap",       Type::tBool,
         "heap_size_hint",               Type::tInt,
         "string_heap_size_hint",        Type::tInt,
+        "heap_size_limit",              Type::tInt,
+        "string_heap_size_limit",       Type::tInt,
     // aot
         "no_aot",                       Type::tBool,
         "aot_prologue",                 Type::tBool,
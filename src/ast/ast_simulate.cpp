@@ -1941,6 +1941,11 @@ namespace das
         if ( left->type->isHandle() ) {
             auto lN = left->simulate(context);
             auto rN = right->simulate(context);
+            const auto & rightType = *right->type;
+            if ( !rightType.isRefType() && rightType.ref ) {
+                // handled value types are cloned from the value, same as copy
+                rN = rightType.annotation->simulateRef2Value(context, at, rN);
+            }
             retN = left->type->annotation->simulateClone(context, at, lN, rN);
         } else if ( left->type->canCopy() ) {
             retN = makeCopy(at, context, left, right );
@@ -2441,7 +2446,10 @@ namespace das
 
     void Program::makeMacroModule ( TextWriter & logs ) {
         isCompilingMacros = true;
-        thisModule->macroContext = make_unique<Context>(getContextStackSize());
+        // macros are invoked directly at compile time, outside of any SharedStackGuard,
+        // so the macro context needs a stack of its own even when the program asks for none
+        auto ssz = getContextStackSize();
+        thisModule->macroContext = make_unique<Context>(ssz ? ssz : DAS_COMPILE_TIME_STACK_SIZE);
         simulate(*thisModule->macroContext, logs);
         isCompilingMacros = false;
     }
@@ -2459,6 +2467,19 @@ namespace das
         }
         context.heap->setInitialSize ( options.getIntOption("heap_size_hint", policies.heap_size_hint) );
         context.stringHeap->setInitialSize ( options.getIntOption("string_heap_size_hint", policies.string_heap_size_hint) );
+        // options are 32 bit, limits of 4GB and above can only come from the policies
+        uint64_t heapLimit = policies.heap_size_limit;
+        if ( auto opt = options.find("heap_size_limit", Type::tInt) ) heapLimit = uint32_t(opt->iValue);
+        uint64_t stringHeapLimit = policies.string_heap_size_limit;
+        if ( auto opt = options.find("string_heap_size_limit", Type::tInt) ) stringHeapLimit = uint32_t(opt->iValue);
+        if ( heapLimit || stringHeapLimit ) {
+            auto limits = context.getMemoryLimits();
+            if ( heapLimit ) limits.heapLimit = heapLimit;
+            if ( stringHeapLimit ) limits.stringHeapLimit = stringHeapLimit;
+            context.setMemoryLimits(limits);
+        } else {
+            context.installMemoryLimits();
+        }
         context.constStringHeap = make_smart<ConstStringAllocator>();
         if ( globalStringHeapSize ) {
             context.constStringHeap->setInitialSize(globalStringHeapSize);
@@ -2582,7 +2603,7 @@ namespace das
         // verify code and string heaps
         DAS_ASSERTF(context.code->depth()<=1, "code must come in one page");
         DAS_ASSERTF(context.constStringHeap->depth()<=1, "strings must come in one page");
-        context.stringHeap->setIntern(options.getBoolOption("intern_strings", policies.intern_strings));
+        context.stringHeap->setIntern(options.getBoolOption("intern_strings", policies.intern_strings), context.constStringHeap.get());
         // log all functions
         if ( options.getBoolOption("log_nodes",false) ) {
             bool displayHash = options.getBoolOption("log_nodes_aot_hash",false);
@@ -2611,7 +2632,7 @@ namespace das
                 context.runInitScript();
             } else {
                 auto ssz = getContextStackSize();
-                StackAllocator stack(ssz ? ssz : 16384);    // at least some stack
+                StackAllocator stack(ssz ? ssz : DAS_COMPILE_TIME_STACK_SIZE);    // at least some stack
                 SharedStackGuard guard(context, stack);
                 context.runInitScript();
             }
@@ -7,6 +7,7 @@
 #include "daScript/ast/ast_policy_types.h"
 
 #include "daScript/simulate/aot_builtin.h"
+#include "daScript/simulate/aot.h"
 
 namespace das {
 
@@ -28,6 +29,10 @@ namespace das {
         array_reserve( *context, pArray, newSize, stride );
     }
 
+    void builtin_array_shrink ( Array & pArray, int stride, Context * context ) {
+        array_shrink ( *context, pArray, stride );
+    }
+
     int builtin_array_push ( Array & pArray, int index, int stride, Context * context ) {
         uint32_t idx = pArray.size;
         array_resize(*context, pArray, idx + 1, stride, false);
@@ -36,7 +41,7 @@ namespace das {
                 context->throw_error_ex("insert index out of range, %u of %u", uint32_t(index), pArray.size);
                 return 0;
             }
-            memmove ( pArray.data+(index+1)*stride, pArray.data+index*stride, (idx-index)*stride );
+            memmove ( pArray.data+uint64_t(index+1)*stride, pArray.data+uint64_t(index)*stride, uint64_t(idx-index)*stride );
             idx = index;
         }
         return idx;
@@ -50,10 +55,10 @@ namespace das {
                 context->throw_error_ex("insert index out of range, %u of %u", uint32_t(index), pArray.size);
                 return 0;
             }
-            memmove ( pArray.data+(index+1)*stride, pArray.data+index*stride, (idx-index)*stride );
+            memmove ( pArray.data+uint64_t(index+1)*stride, pArray.data+uint64_t(index)*stride, uint64_t(idx-index)*stride );
             idx = index;
         }
-        memset(pArray.data + idx*stride, 0, stride);
+        memset(pArray.data + uint64_t(idx)*stride, 0, stride);
         return idx;
     }
 
@@ -62,7 +67,7 @@ namespace das {
             context->throw_error_ex("erase index out of range, %u of %u", uint32_t(index), pArray.size);
             return;
         }
-        memmove ( pArray.data+index*stride, pArray.data+(index+1)*stride, (pArray.size-index-1)*stride );
+        memmove ( pArray.data+uint64_t(index)*stride, pArray.data+uint64_t(index+1)*stride, uint64_t(pArray.size-index-1)*stride );
         array_resize(*context, pArray, pArray.size-1, stride, false);
     }
 
@@ -82,6 +87,52 @@ namespace das {
         const_cast<Array&>(arr).hopeless = true;
     }
 
+    // bulk operations over pod elements. bounds are checked once per call, elements are copied with memcpy
+
+    void builtin_array_append ( Array & pArray, const Array & from, int stride, Context * context ) {
+        uint32_t count = from.size;
+        if ( !count ) return;
+        uint32_t idx = pArray.size;
+        array_resize(*context, pArray, idx + count, stride, false);
+        // from is read after resize, in case it is the same array
+        memcpy ( pArray.data+uint64_t(idx)*stride, from.data, uint64_t(count)*stride );
+    }
+
+    // copy_slice and fill only write elements in place, so like a[i] = x they are allowed on locked arrays
+    void builtin_array_copy_slice ( Array & dst, int dstIndex, const Array & src, int srcIndex, int count, int stride, Context * context ) {
+        if ( count<0 || dstIndex<0 || srcIndex<0 || uint64_t(dstIndex)+count>dst.size || uint64_t(srcIndex)+count>src.size ) {
+            context->throw_error_ex("copy_slice out of range, %i elements from %i of %u to %i of %u", count, srcIndex, src.size, dstIndex, dst.size);
+            return;
+        }
+        memmove ( dst.data+uint64_t(dstIndex)*stride, src.data+uint64_t(srcIndex)*stride, uint64_t(count)*stride );
+    }
+
+    // first element is copied, then the filled part is doubled
+    void builtin_array_fill ( Array & pArray, int from, int count, const void * value, int stride, Context * context ) {
+        if ( count<0 || from<0 || uint64_t(from)+count>pArray.size ) {
+            context->throw_error_ex("fill out of range, %i elements from %i of %u", count, from, pArray.size);
+            return;
+        }
+        if ( !count ) return;
+        char * data = pArray.data + uint64_t(from)*stride;
+        uint64_t total = uint64_t(count)*stride;
+        memcpy ( data, value, stride );
+        for ( uint64_t filled = stride; filled < total; filled *= 2 ) {
+            memcpy ( data + filled, data, das::min(filled, total - filled) );
+        }
+    }
+
+#define xstr(a) str(a)
+#define str(a) #a
+
+#define ADD_ARRAY_BULK(CTYPE) \
+    addExtern<DAS_BIND_FUN(builtin_array_find_index<CTYPE>)>(*this, lib, "__builtin_array_find_index", \
+        SideEffects::none, "builtin_array_find_index<" xstr(CTYPE) ">"); \
+    addExtern<DAS_BIND_FUN(builtin_array_count<CTYPE>)>(*this, lib, "__builtin_array_count", \
+        SideEffects::none, "builtin_array_count<" xstr(CTYPE) ">"); \
+    addExtern<DAS_BIND_FUN(builtin_array_equal<CTYPE>)>(*this, lib, "__builtin_array_equal", \
+        SideEffects::none, "builtin_array_equal<" xstr(CTYPE) ">");
+
     void Module_BuiltIn::addArrayTypes(ModuleLibrary & lib) {
         // array functions
         addExtern<DAS_BIND_FUN(builtin_array_clear)>(*this, lib, "clear", SideEffects::modifyArgument, "builtin_array_clear");
@@ -90,11 +141,33 @@ namespace das {
         // array built-in functions
         addExtern<DAS_BIND_FUN(builtin_array_resize)>(*this, lib, "__builtin_array_resize", SideEffects::modifyArgument, "builtin_array_resize");
         addExtern<DAS_BIND_FUN(builtin_array_reserve)>(*this, lib, "__builtin_array_reserve", SideEffects::modifyArgument, "builtin_array_reserve");
+        addExtern<DAS_BIND_FUN(builtin_array_shrink)>(*this, lib, "__builtin_array_shrink", SideEffects::modifyArgument, "builtin_array_shrink");
         addExtern<DAS_BIND_FUN(builtin_array_push)>(*this, lib, "__builtin_array_push", SideEffects::modifyArgument, "builtin_array_push");
         addExtern<DAS_BIND_FUN(builtin_array_push_zero)>(*this, lib, "__builtin_array_push_zero", SideEffects::modifyArgument, "builtin_array_push_zero");
         addExtern<DAS_BIND_FUN(builtin_array_erase)>(*this, lib, "__builtin_array_erase", SideEffects::modifyArgument, "builtin_array_erase");
         addExtern<DAS_BIND_FUN(builtin_array_lock)>(*this, lib, "__builtin_array_lock", SideEffects::modifyArgumentAndExternal, "builtin_array_lock");
         addExtern<DAS_BIND_FUN(builtin_array_unlock)>(*this, lib, "__builtin_array_unlock", SideEffects::modifyArgumentAndExternal, "builtin_array_unlock");
         addExtern<DAS_BIND_FUN(builtin_array_clear_lock)>(*this, lib, "__builtin_array_clear_lock", SideEffects::modifyArgumentAndExternal, "builtin_array_clear_lock");
+        // bulk
+        addExtern<DAS_BIND_FUN(builtin_array_append)>(*this, lib, "__builtin_array_append", SideEffects::modifyArgument, "builtin_array_append");
+        addExtern<DAS_BIND_FUN(builtin_array_copy_slice)>(*this, lib, "__builtin_array_copy_slice", SideEffects::modifyArgument, "builtin_array_copy_slice");
+        addExtern<DAS_BIND_FUN(builtin_array_fill)>(*this, lib, "__builtin_array_fill", SideEffects::modifyArgument, "builtin_array_fill");
+        ADD_ARRAY_BULK(int32_t);
+        ADD_ARRAY_BULK(uint32_t);
+        ADD_ARRAY_BULK(int64_t);
+        ADD_ARRAY_BULK(uint64_t);
+        ADD_ARRAY_BULK(float);
+        ADD_ARRAY_BULK(double);
+        ADD_ARRAY_BULK(range);
+        ADD_ARRAY_BULK(urange);
+        ADD_ARRAY_BULK(int2);
+        ADD_ARRAY_BULK(int3);
+        ADD_ARRAY_BULK(int4);
+        ADD_ARRAY_BULK(uint2);
+        ADD_ARRAY_BULK(uint3);
+        ADD_ARRAY_BULK(uint4);
+        ADD_ARRAY_BULK(float2);
+        ADD_ARRAY_BULK(float3);
+        ADD_ARRAY_BULK(float4);
     }
 }
@@ -237,6 +237,8 @@ namespace das {
         AstExprLetAnnotation(ModuleLibrary & ml)
             :  AstExpressionAnnotation<ExprLet> ("ExprLet", ml) {
             addField<DAS_BIND_MANAGED_FIELD(variables)>("variables");
+            addField<DAS_BIND_MANAGED_FIELD(visibility)>("visibility");
+            addField<DAS_BIND_MANAGED_FIELD(atInit)>("atInit");
         }
     };
 
@@ -447,6 +449,7 @@ namespace das {
             addField<DAS_BIND_MANAGED_FIELD(iteratorVariables)>("iteratorVariables");
             addField<DAS_BIND_MANAGED_FIELD(sources)>("sources");
             addField<DAS_BIND_MANAGED_FIELD(body)>("body");
+            addField<DAS_BIND_MANAGED_FIELD(visibility)>("visibility");
         }
     };
 
@@ -1009,7 +1012,7 @@ namespace das {
 
     struct AstFieldDeclarationAnnotation : ManagedStructureAnnotation<Structure::FieldDeclaration> {
         AstFieldDeclarationAnnotation(ModuleLibrary & ml)
-            : ManagedStructureAnnotation ("FieldDeclaration", ml) {
+            : ManagedStructureAnnotation ("FieldDeclaration", ml, "Structure::FieldDeclaration") {
         }
         void init () {
             addField<DAS_BIND_MANAGED_FIELD(name)>("name");
@@ -2211,6 +2214,10 @@ namespace das {
         return module->addFunction(func, true);
     }
 
+    bool addModuleStructure ( Module * module, StructurePtr st, Context * ) {
+        return module->addStructure(st, true);
+    }
+
     void addModuleFunctionAnnotation ( Module * module, FunctionAnnotationPtr ann, Context * context ) {
         if ( !module->addAnnotation(ann, true) ) {
             context->throw_error_ex("can't add function annotation %s to module %s",
@@ -2305,7 +2312,7 @@ namespace das {
         if ( !tab->data ) return;
         char * values = tab->data;
         char * keys = tab->keys;
-        for ( uint32_t index=0; index!=tab->capacity; index++, keys+=keyStride, values+=valueStride ) {
+        for ( uint32_t index=0, is=table_entries(*tab); index!=is; index++, keys+=keyStride, values+=valueStride ) {
             if ( tab->hashes[index] > HASH_KILLED32 ) {
                 das_invoke<void>::invoke<void *,void *>(context,blk,(void*)keys,(void*)values);
             }
@@ -2615,6 +2622,8 @@ namespace das {
                 SideEffects::modifyExternal, "addModuleStructureAnnotation");
             addExtern<DAS_BIND_FUN(addStructureStructureAnnotation)>(*this, lib,  "add_structure_annotation",
                 SideEffects::modifyExternal, "addStructureStructureAnnotation");
+            addExtern<DAS_BIND_FUN(addModuleStructure)>(*this, lib,  "add_structure",
+                SideEffects::modifyExternal, "addModuleStructure");
             // pass macro
             addAnnotation(make_smart<AstPassMacroAnnotation>(lib));
             addExtern<DAS_BIND_FUN(makePassMacro)>(*this, lib,  "make_pass_macro",
@@ -2630,7 +2639,7 @@ namespace das {
             addExtern<DAS_BIND_FUN(makeCallMacro)>(*this, lib,  "make_call_macro",
                 SideEffects::modifyExternal, "makeCallMacro");
             addExtern<DAS_BIND_FUN(addModuleCallMacro)>(*this, lib,  "add_call_macro",
-                SideEffects::modifyExternal, "addModulemakeCallMacro");
+                SideEffects::modifyExternal, "addModuleCallMacro");
             // variant macro
             addAnnotation(make_smart<AstVariantMacroAnnotation>(lib));
             addExtern<DAS_BIND_FUN(makeVariantMacro)>(*this, lib,  "make_variant_macro",
@@ -2656,6 +2665,8 @@ namespace das {
                 SideEffects::none, "clone_expression");
             addExtern<DAS_BIND_FUN(clone_function)>(*this, lib,  "clone_function",
                 SideEffects::none, "clone_function");
+            addExtern<DAS_BIND_FUN(clone_structure)>(*this, lib,  "clone_structure",
+                SideEffects::none, "clone_structure");
             // type
             addExtern<DAS_BIND_FUN(isSameAstType)>(*this, lib,  "is_same_type",
                 SideEffects::none, "isSameAstType");
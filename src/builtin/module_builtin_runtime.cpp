@@ -15,6 +15,11 @@
 #include "daScript/simulate/aot.h"
 #include "daScript/misc/sysos.h"
 
+MAKE_TYPE_FACTORY(HeapStats, das::HeapStats)
+MAKE_TYPE_FACTORY(HeapSizeClassStats, das::HeapSizeClassStats)
+MAKE_TYPE_FACTORY(ClosurePoolStats, das::ClosurePoolStats)
+MAKE_TYPE_FACTORY(AllocationSite, das::AllocationSite)
+
 namespace das
 {
 #if defined(__clang__)
@@ -317,6 +322,63 @@ namespace das
         return cast<uint32_t>::from(uhash);
     }
 
+    // batch lookups. Keys is array<keyT>, Result is resized to the length of Keys
+
+    vec4f _builtin_table_key_exists_batch ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+        auto tab = cast<Table *>::to(args[0]);
+        auto keys = cast<Array *>::to(args[1]);
+        auto res = cast<Array *>::to(args[2]);
+        vector<int32_t> index(keys->size);
+        table_find_batch(context, *tab, call->types[0]->firstType->type, keys->data, keys->size,
+            getTypeSize(call->types[0]->secondType), index.data());
+        array_resize(context, *res, keys->size, sizeof(bool), false);
+        auto pRes = (bool *) res->data;
+        for ( uint32_t i=0; i!=keys->size; ++i ) {
+            pRes[i] = index[i]!=-1;
+        }
+        return v_zero();
+    }
+
+    vec4f _builtin_table_find_batch ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+        auto tab = cast<Table *>::to(args[0]);
+        auto keys = cast<Array *>::to(args[1]);
+        auto res = cast<Array *>::to(args[2]);
+        uint32_t valueTypeSize = getTypeSize(call->types[0]->secondType);
+        vector<int32_t> index(keys->size);
+        table_find_batch(context, *tab, call->types[0]->firstType->type, keys->data, keys->size, valueTypeSize, index.data());
+        array_resize(context, *res, keys->size, sizeof(char *), false);
+        auto pRes = (char **) res->data;
+        for ( uint32_t i=0; i!=keys->size; ++i ) {
+            pRes[i] = index[i]!=-1 ? tab->data + uint64_t(index[i])*valueTypeSize : nullptr;
+        }
+        return v_zero();
+    }
+
+    vec4f _builtin_table_insert_batch ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+        auto tab = cast<Table *>::to(args[0]);
+        auto keys = cast<Array *>::to(args[1]);
+        auto values = cast<Array *>::to(args[2]);
+        if ( keys->size!=values->size ) {
+            context.throw_error_at(call->debugInfo, "insert_batch expects as many values as keys, %u vs %u", values->size, keys->size);
+        }
+        uint32_t valueTypeSize = getTypeSize(call->types[0]->secondType);
+        vector<int32_t> index(keys->size);
+        table_reserve_batch(context, *tab, call->types[0]->firstType->type, keys->data, keys->size, valueTypeSize, index.data());
+        for ( uint32_t i=0; i!=keys->size; ++i ) {
+            memcpy(tab->data + uint64_t(index[i])*valueTypeSize, values->data + uint64_t(i)*valueTypeSize, valueTypeSize);
+        }
+        return v_zero();
+    }
+
+    // sets are tables with void values. key is passed by value, so it can be read straight from the argument
+    vec4f _builtin_table_set_insert ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+        auto tab = cast<Table *>::to(args[0]);
+        uint32_t size = tab->size;
+        int32_t index = -1;
+        table_reserve_batch(context, *tab, call->types[0]->firstType->type, (const char *)(args + 1), 1, 0, &index);
+        return cast<bool>::from(tab->size!=size);
+    }
+
     uint64_t heap_bytes_allocated ( Context * context ) {
         return context->heap->bytesAllocated();
     }
@@ -345,6 +407,117 @@ namespace das
         context->heap->report();
     }
 
+    void heap_stats ( HeapStats & stats, Context * context ) {
+        context->heap->getHeapStats(stats);
+    }
+
+    void string_heap_stats ( HeapStats & stats, Context * context ) {
+        context->stringHeap->getHeapStats(stats);
+    }
+
+    void closure_pool_stats ( ClosurePoolStats & stats, Context * context ) {
+        context->heap->closures.getStats(stats);
+    }
+
+    void set_allocation_sampling ( uint64_t interval, Context * context ) {
+        context->setAllocationSampling(interval);
+    }
+
+    void reset_allocation_sampling ( Context * context ) {
+        context->resetAllocationSampling();
+    }
+
+    void allocation_sampling_report ( int32_t top, Context * context ) {
+        auto str = context->reportAllocationSites(uint32_t(das::max(top,0)));
+        context->to_out(str.c_str());
+    }
+
+    void allocation_sites ( int32_t top, const TBlock<void,const AllocationSite> & block, Context * context ) {
+        vector<AllocationSite> sites;
+        context->getTopAllocationSites(sites, uint32_t(das::max(top,0)));
+        for ( auto & site : sites ) {
+            vec4f args[1] = { cast<AllocationSite *>::from(&site) };
+            context->invoke(block, args, nullptr);
+        }
+    }
+
+    static void invoke_size_class_stats ( AnyHeapAllocator * heap, const TBlock<void,const HeapSizeClassStats> & block, Context * context ) {
+        vector<HeapSizeClassStats> classes;
+        heap->getSizeClassStats(classes);
+        for ( auto & cls : classes ) {
+            vec4f args[1] = { cast<HeapSizeClassStats *>::from(&cls) };
+            context->invoke(block, args, nullptr);
+        }
+    }
+
+    void heap_size_class_stats ( const TBlock<void,const HeapSizeClassStats> & block, Context * context ) {
+        invoke_size_class_stats(context->heap.get(), block, context);
+    }
+
+    void string_heap_size_class_stats ( const TBlock<void,const HeapSizeClassStats> & block, Context * context ) {
+        invoke_size_class_stats(context->stringHeap.get(), block, context);
+    }
+
+    struct HeapStatsAnnotation : ManagedStructureAnnotation <HeapStats,false> {
+        HeapStatsAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("HeapStats", ml, "das::HeapStats") {
+            addField<DAS_BIND_MANAGED_FIELD(bytesAllocated)>("bytesAllocated");
+            addField<DAS_BIND_MANAGED_FIELD(maxBytesAllocated)>("maxBytesAllocated");
+            addField<DAS_BIND_MANAGED_FIELD(totalBytes)>("totalBytes");
+            addField<DAS_BIND_MANAGED_FIELD(depth)>("depth");
+            addField<DAS_BIND_MANAGED_FIELD(smallChunks)>("smallChunks");
+            addField<DAS_BIND_MANAGED_FIELD(smallLiveBytes)>("smallLiveBytes");
+            addField<DAS_BIND_MANAGED_FIELD(smallFreeBytes)>("smallFreeBytes");
+            addField<DAS_BIND_MANAGED_FIELD(bigBlocks)>("bigBlocks");
+            addField<DAS_BIND_MANAGED_FIELD(bigBytes)>("bigBytes");
+            addField<DAS_BIND_MANAGED_FIELD(maxBigBlock)>("maxBigBlock");
+            addField<DAS_BIND_MANAGED_FIELD(bigFreeBlocks)>("bigFreeBlocks");
+            addField<DAS_BIND_MANAGED_FIELD(bigFreeBytes)>("bigFreeBytes");
+            addField<DAS_BIND_MANAGED_FIELD(fragmentation)>("fragmentation");
+        }
+        virtual bool canMove() const override { return true; }
+        virtual bool canCopy() const override { return true; }
+        virtual bool isLocal() const override { return true; }
+    };
+
+    struct HeapSizeClassStatsAnnotation : ManagedStructureAnnotation <HeapSizeClassStats,false> {
+        HeapSizeClassStatsAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("HeapSizeClassStats", ml, "das::HeapSizeClassStats") {
+            addField<DAS_BIND_MANAGED_FIELD(size)>("size");
+            addField<DAS_BIND_MANAGED_FIELD(chunks)>("chunks");
+            addField<DAS_BIND_MANAGED_FIELD(liveBlocks)>("liveBlocks");
+            addField<DAS_BIND_MANAGED_FIELD(liveBytes)>("liveBytes");
+            addField<DAS_BIND_MANAGED_FIELD(freeBytes)>("freeBytes");
+            addField<DAS_BIND_MANAGED_FIELD(fragmentation)>("fragmentation");
+        }
+        virtual bool canMove() const override { return true; }
+        virtual bool canCopy() const override { return true; }
+        virtual bool isLocal() const override { return true; }
+    };
+
+    struct AllocationSiteAnnotation : ManagedStructureAnnotation <AllocationSite,false> {
+        AllocationSiteAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("AllocationSite", ml, "das::AllocationSite") {
+            addField<DAS_BIND_MANAGED_FIELD(comment)>("comment");
+            addField<DAS_BIND_MANAGED_FIELD(stringHeap)>("stringHeap");
+            addField<DAS_BIND_MANAGED_FIELD(samples)>("samples");
+            addField<DAS_BIND_MANAGED_FIELD(sampledBytes)>("sampledBytes");
+            addField<DAS_BIND_MANAGED_FIELD(estimatedBytes)>("estimatedBytes");
+        }
+    };
+
+    struct ClosurePoolStatsAnnotation : ManagedStructureAnnotation <ClosurePoolStats,false> {
+        ClosurePoolStatsAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("ClosurePoolStats", ml, "das::ClosurePoolStats") {
+            addField<DAS_BIND_MANAGED_FIELD(allocations)>("allocations");
+            addField<DAS_BIND_MANAGED_FIELD(reused)>("reused");
+            addField<DAS_BIND_MANAGED_FIELD(frees)>("frees");
+            addField<DAS_BIND_MANAGED_FIELD(pooled)>("pooled");
+            addField<DAS_BIND_MANAGED_FIELD(liveBlocks)>("liveBlocks");
+            addField<DAS_BIND_MANAGED_FIELD(freeBlocks)>("freeBlocks");
+            addField<DAS_BIND_MANAGED_FIELD(freeBytes)>("freeBytes");
+        }
+        virtual bool canMove() const override { return true; }
+        virtual bool canCopy() const override { return true; }
+        virtual bool isLocal() const override { return true; }
+    };
+
     void builtin_table_lock ( const Table & arr, Context * context ) {
         table_lock(*context, const_cast<Table&>(arr));
     }
@@ -405,6 +578,57 @@ namespace das
         }
     }
 
+    // values are fetched in batches straight into the array. iterators of references fetch pointers, then copy
+    // iterators, which know their size, get the whole array reserved upfront
+    // if the iterator throws, the array keeps values fetched so far, and the iterator is still closed
+    void builtin_iterator_to_array ( Array & arr, const Sequence & it, int32_t elementSize, bool byRef, Context * context ) {
+        if ( !it.iter ) context->throw_error("to_array of empty iterator");
+        else if ( it.iter->isOpen ) context->throw_error("to_array of already open iterator");
+        Iterator * iter = it.iter;
+        ((Sequence&)it).iter = nullptr;
+        uint32_t stride = uint32_t(elementSize);
+        uint32_t size = arr.size;
+        das_try_finally(context, [&]() {
+            int32_t hint = iter->size_hint();
+            if ( hint>0 ) array_reserve(*context, arr, size + uint32_t(hint) + (byRef ? 0 : DAS_ITERATOR_BATCH_SIZE), stride);
+            iter->isOpen = true;
+            if ( !byRef ) {
+                array_resize(*context, arr, size + 1, stride, false);
+                if ( iter->first(*context, arr.data + size*stride) ) {
+                    size ++;
+                    for ( ;; ) {
+                        array_resize(*context, arr, size + DAS_ITERATOR_BATCH_SIZE, stride, false);
+                        char * value = arr.data + (size-1)*stride;
+                        uint32_t got = iter->next_batch(*context, value, value + stride, stride, DAS_ITERATOR_BATCH_SIZE);
+                        size += got;
+                        if ( got!=DAS_ITERATOR_BATCH_SIZE ) break;
+                    }
+                }
+            } else {
+                char * value = nullptr;
+                char * values[DAS_ITERATOR_BATCH_SIZE];
+                if ( iter->first(*context, (char *)&value) ) {
+                    array_resize(*context, arr, size + 1, stride, false);
+                    memcpy(arr.data + size*stride, value, stride);
+                    size ++;
+                    for ( ;; ) {
+                        uint32_t got = iter->next_batch(*context, (char *)&value, (char *)values, sizeof(char *), DAS_ITERATOR_BATCH_SIZE);
+                        array_resize(*context, arr, size + got, stride, false);
+                        for ( uint32_t i=0; i!=got; ++i ) {
+                            memcpy(arr.data + (size+i)*stride, values[i], stride);
+                        }
+                        size += got;
+                        if ( got!=DAS_ITERATOR_BATCH_SIZE ) break;
+                        value = values[got-1];
+                    }
+                }
+            }
+        }, [&]() {
+            if ( arr.size!=size ) array_resize(*context, arr, size, stride, false);
+            iter->close(*context, nullptr);
+        });
+    }
+
     void builtin_make_good_array_iterator ( Sequence & result, const Array & arr, int stride, Context * context ) {
         char * iter = context->heap->allocate(sizeof(GoodArrayIterator));
         context->heap->mark_comment(iter, "array<> iterator");
@@ -521,7 +745,7 @@ namespace das
             };
             auto flags = context.stopFlags; // need to save stop flags, we can be in the middle of some return or something
             context.call(finFunc, argValues, 0);
-            context.heap->free((char *)this, sizeof(LambdaIterator));
+            context.heap->freeClosure((char *)this, sizeof(LambdaIterator));
             context.stopFlags = flags;
         }
         virtual void walk ( DataWalker & walker ) override {
@@ -535,7 +759,7 @@ namespace das
     };
 
     void builtin_make_lambda_iterator ( Sequence & result, const Lambda lambda, Context * context ) {
-        char * iter = context->heap->allocate(sizeof(LambdaIterator));
+        char * iter = context->heap->allocateClosure(sizeof(LambdaIterator));
         context->heap->mark_comment(iter, "lambda iterator");
         new (iter) LambdaIterator(*context, lambda);
         result = { (Iterator *) iter };
@@ -559,7 +783,7 @@ namespace das
     void builtin_array_free ( Array & dim, int szt, Context * __context__ ) {
         if ( dim.data ) {
             if ( !dim.lock || dim.hopeless ) {
-                uint32_t oldSize = dim.capacity*szt;
+                uint64_t oldSize = uint64_t(dim.capacity)*szt;
                 __context__->heap->free(dim.data, oldSize);
             } else {
                 __context__->throw_error("can't delete locked array");
@@ -573,10 +797,19 @@ namespace das
         }
     }
 
+    void builtin_table_shrink ( Table & tab, int szk, int szv, Context * context ) {
+        table_shrink(*context, tab, szk, szv);
+    }
+
+    void builtin_table_reserve ( Table & tab, int newSize, int szk, int szv, Context * context ) {
+        if ( newSize<0 ) context->throw_error_ex("reserving table to negative size %i", newSize);
+        table_reserve(*context, tab, uint32_t(newSize), szk, szv);
+    }
+
     void builtin_table_free ( Table & tab, int szk, int szv, Context * __context__ ) {
         if ( tab.data ) {
             if ( !tab.lock || tab.hopeless ) {
-                uint32_t oldSize = tab.capacity*(szk+szv+sizeof(uint32_t));
+                uint64_t oldSize = table_memory_size(tab.capacity, szk+szv);
                 __context__->heap->free(tab.data, oldSize);
             } else {
                 __context__->throw_error("can't delete locked table");
@@ -841,10 +1074,14 @@ namespace das
                                                         SideEffects::modifyArgumentAndExternal, "builtin_iterator_close");
         addExtern<DAS_BIND_FUN(builtin_iterator_delete)>(*this, lib, "_builtin_iterator_delete",
                                                         SideEffects::modifyArgumentAndExternal, "builtin_iterator_delete");
+        addExtern<DAS_BIND_FUN(builtin_iterator_to_array)>(*this, lib, "_builtin_iterator_to_array",
+                                                        SideEffects::modifyArgumentAndExternal, "builtin_iterator_to_array");
         addExtern<DAS_BIND_FUN(builtin_iterator_iterate)>(*this, lib, "_builtin_iterator_iterate",
                                                         SideEffects::modifyArgumentAndExternal, "builtin_iterator_iterate");
         addExtern<DAS_BIND_FUN(builtin_iterator_empty)>(*this, lib, "empty",
                                                         SideEffects::modifyArgumentAndExternal, "builtin_iterator_empty");
+        addExtern<DAS_BIND_FUN(builtin_iterator_size_hint)>(*this, lib, "size_hint",
+                                                        SideEffects::none, "builtin_iterator_size_hint");
         // make-iterator functions
         addExtern<DAS_BIND_FUN(builtin_make_good_array_iterator)>(*this, lib,  "_builtin_make_good_array_iterator",
             SideEffects::modifyArgumentAndExternal, "builtin_make_good_array_iterator");
@@ -892,6 +1129,28 @@ namespace das
                 SideEffects::modifyExternal, "string_heap_report");
        addExtern<DAS_BIND_FUN(heap_report)>(*this, lib, "heap_report",
                 SideEffects::modifyExternal, "heap_report");
+        addAnnotation(make_smart<HeapStatsAnnotation>(lib));
+        addAnnotation(make_smart<HeapSizeClassStatsAnnotation>(lib));
+        addAnnotation(make_smart<ClosurePoolStatsAnnotation>(lib));
+        addAnnotation(make_smart<AllocationSiteAnnotation>(lib));
+        addExtern<DAS_BIND_FUN(heap_stats)>(*this, lib, "heap_stats",
+                SideEffects::modifyArgumentAndExternal, "heap_stats");
+        addExtern<DAS_BIND_FUN(string_heap_stats)>(*this, lib, "string_heap_stats",
+                SideEffects::modifyArgumentAndExternal, "string_heap_stats");
+        addExtern<DAS_BIND_FUN(closure_pool_stats)>(*this, lib, "closure_pool_stats",
+                SideEffects::modifyArgumentAndExternal, "closure_pool_stats");
+        addExtern<DAS_BIND_FUN(heap_size_class_stats)>(*this, lib, "heap_size_class_stats",
+                SideEffects::modifyExternal, "heap_size_class_stats");
+        addExtern<DAS_BIND_FUN(string_heap_size_class_stats)>(*this, lib, "string_heap_size_class_stats",
+                SideEffects::modifyExternal, "string_heap_size_class_stats");
+        addExtern<DAS_BIND_FUN(set_allocation_sampling)>(*this, lib, "set_allocation_sampling",
+                SideEffects::modifyExternal, "set_allocation_sampling");
+        addExtern<DAS_BIND_FUN(reset_allocation_sampling)>(*this, lib, "reset_allocation_sampling",
+                SideEffects::modifyExternal, "reset_allocation_sampling");
+        addExtern<DAS_BIND_FUN(allocation_sampling_report)>(*this, lib, "allocation_sampling_report",
+                SideEffects::modifyExternal, "allocation_sampling_report");
+        addExtern<DAS_BIND_FUN(allocation_sites)>(*this, lib, "allocation_sites",
+                SideEffects::modifyExternal, "allocation_sites");
         // binary serializer
         addInterop<_builtin_binary_load,void,vec4f,const Array &>(*this,lib,"_builtin_binary_load",
             SideEffects::modifyArgumentAndExternal, "_builtin_binary_load");
@@ -907,9 +1166,21 @@ namespace das
         // hash
         addInterop<_builtin_hash,uint32_t,vec4f>(*this, lib, "hash", SideEffects::none, "_builtin_hash");
         // table functions
+        addExtern<DAS_BIND_FUN(builtin_table_is_dense)>(*this, lib, "table_is_dense",
+                SideEffects::accessExternal, "builtin_table_is_dense");
         addExtern<DAS_BIND_FUN(builtin_table_clear)>(*this, lib, "clear", SideEffects::modifyArgument, "builtin_table_clear");
         addExtern<DAS_BIND_FUN(builtin_table_size)>(*this, lib, "length", SideEffects::none, "builtin_table_size");
         addExtern<DAS_BIND_FUN(builtin_table_capacity)>(*this, lib, "capacity", SideEffects::none, "builtin_table_capacity");
+        addExtern<DAS_BIND_FUN(builtin_table_shrink)>(*this, lib, "__builtin_table_shrink", SideEffects::modifyArgument, "builtin_table_shrink");
+        addExtern<DAS_BIND_FUN(builtin_table_reserve)>(*this, lib, "__builtin_table_reserve", SideEffects::modifyArgument, "builtin_table_reserve");
+        addInterop<_builtin_table_key_exists_batch,void,vec4f,vec4f,vec4f>(*this, lib, "__builtin_table_key_exists_batch",
+            SideEffects::modifyArgumentAndExternal, "_builtin_table_key_exists_batch");
+        addInterop<_builtin_table_find_batch,void,vec4f,vec4f,vec4f>(*this, lib, "__builtin_table_find_batch",
+            SideEffects::modifyArgumentAndExternal, "_builtin_table_find_batch");
+        addInterop<_builtin_table_insert_batch,void,vec4f,vec4f,vec4f>(*this, lib, "__builtin_table_insert_batch",
+            SideEffects::modifyArgumentAndExternal, "_builtin_table_insert_batch");
+        addInterop<_builtin_table_set_insert,bool,vec4f,vec4f>(*this, lib, "__builtin_table_set_insert",
+            SideEffects::modifyArgumentAndExternal, "_builtin_table_set_insert");
         addExtern<DAS_BIND_FUN(builtin_table_lock)>(*this, lib, "__builtin_table_lock",
                                                     SideEffects::modifyArgumentAndExternal, "builtin_table_lock");
         addExtern<DAS_BIND_FUN(builtin_table_unlock)>(*this, lib, "__builtin_table_unlock",
@@ -5,34 +5,73 @@
 #include "daScript/ast/ast_interop.h"
 #include "daScript/simulate/aot_builtin.h"
 #include "daScript/simulate/sim_policy.h"
-#include "das_qsort_r.h"
 
 namespace das
 {
-    struct AnySortContext {
-        vec4f *     bargs;
-        SimNode *   node;
-        Context *   context;
-    };
+    // sort pointers to the elements, then move elements into place in one pass
+    template <typename SortFn>
+    __forceinline void sort_any_by_pointer ( void * anyData, int32_t elementSize, int32_t length, SortFn && sortFn ) {
+        if ( length<2 ) return;
+        char * data = (char *) anyData;
+        vector<char *> pdata(length);
+        for ( int32_t i=0; i!=length; ++i ) pdata[i] = data + size_t(i)*elementSize;
+        sortFn(pdata.data(), pdata.data() + length);
+        char * tmp = (char *) das_aligned_alloc16(size_t(length)*elementSize);
+        for ( int32_t i=0; i!=length; ++i ) memcpy(tmp + size_t(i)*elementSize, pdata[i], elementSize);
+        memcpy(data, tmp, size_t(length)*elementSize);
+        das_aligned_free16(tmp);
+    }
 
     void builtin_sort_any_cblock ( void * anyData, int32_t elementSize, int32_t length, const Block & cmp, Context * context ) {
         vec4f bargs[2];
         context->invokeEx(cmp, bargs, nullptr, [&](SimNode * code) {
-            das_qsort_r(anyData, length, elementSize, [&](const void * x, const void * y){
-              bargs[0] = cast<void *>::from(x);
-              bargs[1] = cast<void *>::from(y);
-              return code->evalBool(*context);
+            sort_any_by_pointer(anyData, elementSize, length, [&](char ** begin, char ** end){
+                pdq_sort_guarded(begin, end, [&](const char * x, const char * y){
+                    bargs[0] = cast<void *>::from(x);
+                    bargs[1] = cast<void *>::from(y);
+                    return code->evalBool(*context);
+                });
+            });
+        });
+    }
+
+    void builtin_stable_sort_any_cblock ( void * anyData, int32_t elementSize, int32_t length, const Block & cmp, Context * context ) {
+        vec4f bargs[2];
+        context->invokeEx(cmp, bargs, nullptr, [&](SimNode * code) {
+            sort_any_by_pointer(anyData, elementSize, length, [&](char ** begin, char ** end){
+                stable_sort(begin, end, [&](const char * x, const char * y){
+                    bargs[0] = cast<void *>::from(x);
+                    bargs[1] = cast<void *>::from(y);
+                    return code->evalBool(*context);
+                });
             });
         });
     }
 
     void builtin_sort_string ( void * data, int32_t length ) {
         const char ** pdata = (const char **) data;
-        sort ( pdata, pdata + length, [&](const char * a, const char * b){
+        pdq_sort ( pdata, pdata + length, [&](const char * a, const char * b){
             return strcmp(to_rts(a), to_rts(b))<0;
         });
     }
 
+    void builtin_stable_sort_string ( void * data, int32_t length ) {
+        const char ** pdata = (const char **) data;
+        stable_sort ( pdata, pdata + length, [&](const char * a, const char * b){
+            return strcmp(to_rts(a), to_rts(b))<0;
+        });
+    }
+
+    void builtin_sort_by_key_string ( void * data, int32_t elementSize, int32_t length, void * keys ) {
+        sort_by_key_index((char *)data, uint32_t(elementSize), uint32_t(length), (const char **) keys,
+            [](SortKeyIndex<const char *> * order, uint32_t len) {
+                pdq_sort(order, order + len, [](const SortKeyIndex<const char *> & a, const SortKeyIndex<const char *> & b) {
+                    int cmp = strcmp(to_rts(a.key), to_rts(b.key));
+                    return cmp<0 || (cmp==0 && a.index<b.index);
+                });
+            });
+    }
+
 #define xstr(a) str(a)
 #define str(a) #a
 
@@ -40,11 +79,23 @@ namespace das
     addExtern<DAS_BIND_FUN(builtin_sort<CTYPE>)>(*this, lib, "__builtin_sort", \
         SideEffects::modifyArgumentAndExternal, "builtin_sort<" xstr(CTYPE) ">"); \
     addExtern<DAS_BIND_FUN(builtin_sort_cblock<CTYPE>)>(*this, lib, "__builtin_sort_cblock", \
-        SideEffects::modifyArgumentAndExternal, "builtin_sort_cblock<" xstr(CTYPE) ">");
+        SideEffects::modifyArgumentAndExternal, "builtin_sort_cblock<" xstr(CTYPE) ">"); \
+    addExtern<DAS_BIND_FUN(builtin_stable_sort<CTYPE>)>(*this, lib, "__builtin_stable_sort", \
+        SideEffects::modifyArgumentAndExternal, "builtin_stable_sort<" xstr(CTYPE) ">"); \
+    addExtern<DAS_BIND_FUN(builtin_stable_sort_cblock<CTYPE>)>(*this, lib, "__builtin_stable_sort_cblock", \
+        SideEffects::modifyArgumentAndExternal, "builtin_stable_sort_cblock<" xstr(CTYPE) ">"); \
+    addExtern<DAS_BIND_FUN(builtin_sort_parallel<CTYPE>)>(*this, lib, "__builtin_sort_parallel", \
+        SideEffects::modifyArgumentAndExternal, "builtin_sort_parallel<" xstr(CTYPE) ">"); \
+    addExtern<DAS_BIND_FUN(builtin_sort_parallel_by_key<CTYPE>)>(*this, lib, "__builtin_sort_parallel_by_key", \
+        SideEffects::modifyArgumentAndExternal, "builtin_sort_parallel_by_key<" xstr(CTYPE) ">"); \
+    addExtern<DAS_BIND_FUN(builtin_sort_by_key<CTYPE>)>(*this, lib, "__builtin_sort_by_key", \
+        SideEffects::modifyArgumentAndExternal, "builtin_sort_by_key<" xstr(CTYPE) ">");
 
 #define ADD_VECTOR_SORT(CTYPE) \
     addExtern<DAS_BIND_FUN(builtin_sort_cblock<CTYPE>)>(*this, lib, "__builtin_sort_cblock", \
-        SideEffects::modifyArgumentAndExternal, "builtin_sort_cblock<" xstr(CTYPE) ">");
+        SideEffects::modifyArgumentAndExternal, "builtin_sort_cblock<" xstr(CTYPE) ">"); \
+    addExtern<DAS_BIND_FUN(builtin_stable_sort_cblock<CTYPE>)>(*this, lib, "__builtin_stable_sort_cblock", \
+        SideEffects::modifyArgumentAndExternal, "builtin_stable_sort_cblock<" xstr(CTYPE) ">");
 
     void Module_BuiltIn::addRuntimeSort(ModuleLibrary & lib) {
         // numeric
@@ -71,9 +122,22 @@ namespace das
             SideEffects::modifyArgumentAndExternal, "builtin_sort_string");
         addExtern<DAS_BIND_FUN(builtin_sort_cblock<char *>)>(*this, lib, "__builtin_sort_cblock",
             SideEffects::modifyArgumentAndExternal, "builtin_sort_cblock<char *>");
+        addExtern<DAS_BIND_FUN(builtin_sort_by_key_string)>(*this, lib, "__builtin_sort_by_key_string",
+            SideEffects::modifyArgumentAndExternal, "builtin_sort_by_key_string");
+        addExtern<DAS_BIND_FUN(builtin_stable_sort_string)>(*this, lib, "__builtin_stable_sort_string",
+            SideEffects::modifyArgumentAndExternal, "builtin_stable_sort_string");
+        addExtern<DAS_BIND_FUN(builtin_stable_sort_cblock<char *>)>(*this, lib, "__builtin_stable_sort_cblock",
+            SideEffects::modifyArgumentAndExternal, "builtin_stable_sort_cblock<char *>");
         // generic sort
         addExtern<DAS_BIND_FUN(builtin_sort_any_cblock)>(*this, lib, "__builtin_sort_any_cblock",
             SideEffects::modifyArgumentAndExternal, "builtin_sort_any_cblock");
+        addExtern<DAS_BIND_FUN(builtin_stable_sort_any_cblock)>(*this, lib, "__builtin_stable_sort_any_cblock",
+            SideEffects::modifyArgumentAndExternal, "builtin_stable_sort_any_cblock");
+        // threads of sort_parallel
+        addExtern<DAS_BIND_FUN(builtin_parallel_thread_count)>(*this, lib, "parallel_thread_count",
+            SideEffects::accessExternal, "builtin_parallel_thread_count");
+        addExtern<DAS_BIND_FUN(builtin_set_parallel_thread_count)>(*this, lib, "set_parallel_thread_count",
+            SideEffects::modifyExternal, "builtin_set_parallel_thread_count");
     }
 }
 
@@ -8,8 +8,10 @@
 #include "daScript/simulate/aot_builtin_string.h"
 #include "daScript/misc/string_writer.h"
 #include "daScript/misc/debug_break.h"
+#include "daScript/misc/string_simd.h"
 
 MAKE_TYPE_FACTORY(StringBuilderWriter, StringBuilderWriter)
+MAKE_TYPE_FACTORY(string_view, das::StringView)
 
 namespace das
 {
@@ -19,6 +21,26 @@ namespace das
         }
     };
 
+    struct StringViewAnnotation : ManagedValueAnnotation<StringView> {
+        StringViewAnnotation() : ManagedValueAnnotation<StringView>("string_view","das::StringView") {}
+        virtual bool canClone() const override { return true; }
+        // the view does not own the string, so clone is a copy of the view
+        virtual SimNode * simulateClone ( Context & context, const LineInfo & at, SimNode * l, SimNode * r ) const override {
+            return context.code->makeNode<SimNode_Set<StringView>>(at, l, r);
+        }
+        virtual void walk ( DataWalker & walker, void * data ) override {
+            if ( walker.reading ) {
+                // there is no string to point the view into
+                walker.error("can't read string_view, it does not own the string");
+            } else {
+                auto view = (StringView *) data;
+                string text(view->data, view->length);
+                char * str = (char *) text.c_str();
+                walker.String(str);
+            }
+        }
+    };
+
     int32_t get_character_at ( const char * str, int32_t index, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if ( uint32_t(index)>=strLen ) {
@@ -39,45 +61,29 @@ namespace das
         return (cmpLen > strLen) ? false : memcmp(str, cmp, cmpLen) == 0;
     }
 
-    static inline const char* strip_l(const char *str) {
-        const char *t = str;
-        while (((*t) != '\0') && isspace(*t))
-            t++;
-        return t;
-    }
-
-    static inline const char* strip_r(const char *str, uint32_t len) {
-        if (len == 0)
-            return str;
-        const char *t = &str[len-1];
-        while (t >= str && isspace(*t))
-            t--;
-        return t + 1;
-    }
-
     char* builtin_string_strip ( const char *str, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (!strLen)
             return nullptr;
-        const char *start = strip_l(str);
-        const char *end = strip_r(str, strLen);
-        return end > start ? context->stringHeap->allocateString(start, uint32_t(end-start)) : nullptr;
+        const uint32_t start = str_skip_space(str, strLen);
+        const uint32_t end = start + str_trim_space(str + start, strLen - start);
+        return end > start ? context->stringHeap->allocateString(str + start, end - start) : nullptr;
     }
 
     char* builtin_string_strip_left ( const char *str, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (!strLen)
             return nullptr;
-        const char *start = strip_l(str);
-        return uint32_t(start-str) < strLen ? context->stringHeap->allocateString(start, strLen-uint32_t(start-str)) : nullptr;
+        const uint32_t start = str_skip_space(str, strLen);
+        return start < strLen ? context->stringHeap->allocateString(str + start, strLen - start) : nullptr;
     }
 
     char* builtin_string_strip_right ( const char *str, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (!strLen)
             return nullptr;
-        const char *end = strip_r(str, strLen);
-        return end != str ? context->stringHeap->allocateString(str, uint32_t(end-str)) : nullptr;
+        const uint32_t end = str_trim_space(str, strLen);
+        return end ? context->stringHeap->allocateString(str, end) : nullptr;
     }
 
     static inline int clamp_int(int v, int minv, int maxv) {
@@ -88,15 +94,15 @@ namespace das
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (!strLen)
             return -1;
-        const char *ret = strstr(&str[clamp_int(start, 0, strLen)], substr);
-        return ret ? int(ret-str) : -1;
+        start = clamp_int(start, 0, strLen);
+        int ret = str_find(str + start, strLen - start, substr, stringLengthSafe(*context, substr));
+        return ret!=-1 ? ret + start : -1;
     }
 
     int builtin_string_find2 (const char *str, const char *substr) {
         if (!str)
             return -1;
-        const char *ret = strstr(str, substr);
-        return ret ? int(ret-str) : -1;
+        return str_find(str, uint32_t(strlen(str)), substr, substr ? uint32_t(strlen(substr)) : 0);
     }
 
     int builtin_string_length ( const char *str, Context * context ) {
@@ -136,86 +142,64 @@ namespace das
         return ret;
     }
 
-    __forceinline char to_lower(char ch) {
-        return (ch >= 'A' && ch <= 'Z') ? (ch - 'A' + 'a') : ch;
-    }
-
     char* builtin_string_tolower ( const char *str, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (!strLen)
             return nullptr;
-        char * ret = context->stringHeap->allocateString(str, strLen);
-        for (char *d = ret, *end = ret + strLen; d != end; ++str, ++d)
-          *d = (char)to_lower(*str);
+        char * ret = context->stringHeap->allocateString(nullptr, strLen);
+        str_to_lower(ret, str, strLen);
         return ret;
     }
 
     char* builtin_string_tolower_in_place(char* str) {
         if (!str) return nullptr;
-        char* pch = str;
-        for (;;) {
-            char ch = *pch;
-            if (ch == 0) break;
-            else if (ch >= 'A' && ch <= 'Z') *pch = ch - 'A' + 'a';
-            pch++;
-        }
+        str_to_lower(str, str, uint32_t(strlen(str)));
         return str;
     }
 
-    __forceinline char to_upper(char ch) {
-        return (ch >= 'a' && ch <= 'z') ? (ch - 'a' + 'A') : ch;
-    }
-
     char* builtin_string_toupper ( const char *str, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (!strLen)
             return nullptr;
-        char * ret = context->stringHeap->allocateString(str, strLen);
-        for (char *d = ret, *end = ret + strLen; d != end; ++str, ++d)
-          *d = (char)to_upper(*str);
+        char * ret = context->stringHeap->allocateString(nullptr, strLen);
+        str_to_upper(ret, str, strLen);
         return ret;
     }
 
     char* builtin_string_toupper_in_place ( char* str ) {
         if (!str) return nullptr;
-        char* pch = str;
-        for (;;) {
-            char ch = *pch;
-            if (ch == 0) break;
-            else if (ch >= 'a' && ch <= 'z') *pch = ch - 'a' + 'A';
-            pch++;
-        }
+        str_to_upper(str, str, uint32_t(strlen(str)));
         return str;
     }
 
 
     unsigned string_to_uint ( const char *str, Context * context ) {
         char *endptr;
-        unsigned long int ret = strtoul(str, &endptr, 10);
+        uint64_t ret = parse_uint64(str, &endptr);
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (endptr != str + strLen || strLen == 0)
         {
             context->throw_error("string-to-uint conversion failed. String is not an uint number");
             return 0;
         }
-        return ret;
+        return unsigned(ret);
     }
 
     int string_to_int ( const char *str, Context * context ) {
         char *endptr;
-        long int ret = strtol(str, &endptr, 10);
+        int64_t ret = parse_int64(str, &endptr);
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (endptr != str + strLen || strLen == 0)
         {
             context->throw_error("string-to-int conversion failed. String is not an integer number");
             return 0;
         }
-        return ret;
+        return int(ret);
     }
 
     float string_to_float ( const char *str, Context * context ) {
         char *endptr;
-        float ret = strtof(str, &endptr);
+        float ret = parse_float(str, &endptr);
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (endptr != str + strLen || strLen == 0)
         {
@@ -227,7 +211,7 @@ namespace das
 
     double string_to_double ( const char *str, Context * context ) {
         char *endptr;
-        double ret = strtod(str, &endptr);
+        double ret = parse_double(str, &endptr);
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if (endptr != str + strLen || strLen == 0)
         {
@@ -238,11 +222,11 @@ namespace das
     }
 
     float fast_to_float ( const char *str ) {
-        return str ? (float)atof(str) : 0.f;
+        return str ? parse_float(str, nullptr) : 0.f;
     }
 
     int fast_to_int ( const char *str ) {
-        return str ? atoi(str) : 0;
+        return str ? int32_t(parse_int64(str, nullptr)) : 0;
     }
 
     char * builtin_build_string ( const TBlock<void,StringBuilderWriter> & block, Context * context ) {
@@ -304,11 +288,12 @@ namespace das
         vector<const char *> tokens;
         vector<string> words;
         const char * ch = str;
+        const char * end = str + stringLengthSafe(*context,str);
         auto delimLen = stringLengthSafe(*context,delim);
         if ( delimLen ) {
             while ( *ch ) {
                 const char * tok = ch;
-                while ( *ch && !strchr(delim,*ch) ) ch++;
+                ch += str_find_first_of(ch, uint32_t(end-ch), delim, delimLen);
                 words.push_back(string(tok,ch-tok));
                 if ( !*ch ) break;
                 while ( *ch && strchr(delim,*ch) ) ch++;
@@ -342,11 +327,13 @@ namespace das
         vector<const char *> tokens;
         vector<string> words;
         const char * ch = str;
+        const char * end = str + stringLengthSafe(*context,str);
         auto delimLen = stringLengthSafe(*context,delim);
         if ( delimLen ) {
             while ( *ch ) {
                 const char * tok = ch;
-                while ( *ch && strncmp(delim,ch,delimLen)!=0 ) ch++;
+                int at = str_find(ch, uint32_t(end-ch), delim, delimLen);
+                ch = at!=-1 ? ch + at : end;
                 words.push_back(string(tok,ch-tok));
                 if ( !*ch ) break;
                 while ( *ch && strncmp(delim,ch,delimLen)==0 ) ch+=delimLen;
@@ -374,19 +361,214 @@ namespace das
         context->invoke(block, args, nullptr);
     }
 
+    // string views
+
+    StringView builtin_string_view ( const char * str, Context * context ) {
+        return StringView{ str ? str : "", stringLengthSafe(*context, str) };
+    }
+
+    char * builtin_string_view_to_string ( StringView view, Context * context ) {
+        return view.length ? context->stringHeap->allocateString(view.data, view.length) : nullptr;
+    }
+
+    int32_t builtin_string_view_length ( StringView view ) {
+        return int32_t(view.length);
+    }
+
+    bool builtin_string_view_empty ( StringView view ) {
+        return view.length==0;
+    }
+
+    int32_t builtin_string_view_character_at ( StringView view, int32_t index, Context * context ) {
+        if ( uint32_t(index)>=view.length ) {
+            context->throw_error_ex("string character index out of range, %u of %u", uint32_t(index), view.length);
+        }
+        return ((const uint8_t *)view.data)[index];
+    }
+
+    StringView builtin_string_view_slice1 ( StringView view, int32_t start, int32_t end ) {
+        int32_t len = int32_t(view.length);
+        start = clamp_int((start < 0) ? (len + start) : start, 0, len);
+        end = clamp_int((end < 0) ? (len + end) : end, 0, len);
+        return end > start ? StringView{ view.data + start, uint32_t(end-start) } : StringView{ view.data, 0 };
+    }
+
+    StringView builtin_string_view_slice2 ( StringView view, int32_t start ) {
+        return builtin_string_view_slice1(view, start, int32_t(view.length));
+    }
+
+    StringView builtin_string_view_strip_left ( StringView view ) {
+        uint32_t skip = str_skip_space(view.data, view.length);
+        return StringView{ view.data + skip, view.length - skip };
+    }
+
+    StringView builtin_string_view_strip_right ( StringView view ) {
+        return StringView{ view.data, str_trim_space(view.data, view.length) };
+    }
+
+    StringView builtin_string_view_strip ( StringView view ) {
+        return builtin_string_view_strip_right(builtin_string_view_strip_left(view));
+    }
+
+    int32_t builtin_string_view_find1 ( StringView view, const char * substr, int32_t start, Context * context ) {
+        start = clamp_int(start, 0, int32_t(view.length));
+        int32_t res = str_find(view.data + start, view.length - start, substr, stringLengthSafe(*context, substr));
+        return res!=-1 ? res + start : -1;
+    }
+
+    int32_t builtin_string_view_find2 ( StringView view, const char * substr, Context * context ) {
+        return builtin_string_view_find1(view, substr, 0, context);
+    }
+
+    bool builtin_string_view_starts_with ( StringView view, const char * cmp, Context * context ) {
+        const uint32_t cmpLen = stringLengthSafe ( *context, cmp );
+        return (cmpLen > view.length) ? false : memcmp(view.data, cmp, cmpLen) == 0;
+    }
+
+    bool builtin_string_view_ends_with ( StringView view, const char * cmp, Context * context ) {
+        const uint32_t cmpLen = stringLengthSafe ( *context, cmp );
+        return (cmpLen > view.length) ? false : memcmp(view.data + view.length - cmpLen, cmp, cmpLen) == 0;
+    }
+
+    bool builtin_string_view_equ ( StringView a, StringView b ) {
+        return a.length==b.length && memcmp(a.data, b.data, a.length)==0;
+    }
+
+    bool builtin_string_view_nequ ( StringView a, StringView b ) {
+        return !builtin_string_view_equ(a, b);
+    }
+
+    // operators get no context in AOT, so the string is compared up to its terminator
+    bool builtin_string_view_equ_str ( StringView a, const char * b ) {
+        if ( !b ) return a.length==0;
+        return strncmp(b, a.data, a.length)==0 && b[a.length]==0;
+    }
+
+    bool builtin_string_view_nequ_str ( StringView a, const char * b ) {
+        return !builtin_string_view_equ_str(a, b);
+    }
+
+    // numbers are short, so they are parsed from a terminated copy on the stack
+    // views are not zero terminated, so the number is copied out. short ones fit on the stack
+    // whole view has to be the number, same as string_to_int and string_to_float
+    template <typename TT, typename ParseFn>
+    bool string_view_parse ( StringView view, TT & result, ParseFn && parse ) {
+        if ( !view.length ) return false;
+        char buf[64];
+        string longText;
+        const char * str = buf;
+        if ( view.length < sizeof(buf) ) {
+            memcpy(buf, view.data, view.length);
+            buf[view.length] = 0;
+        } else {
+            longText.assign(view.data, view.length);
+            str = longText.c_str();
+        }
+        char * endptr = nullptr;
+        result = parse(str, &endptr);
+        return endptr == str + view.length;
+    }
+
+    int32_t builtin_string_view_to_int ( StringView view, Context * context ) {
+        int64_t result = 0;
+        if ( !string_view_parse(view, result, parse_int64) ) {
+            context->throw_error("string-to-int conversion failed. String is not an integer number");
+        }
+        return int32_t(result);
+    }
+
+    float builtin_string_view_to_float ( StringView view, Context * context ) {
+        float result = 0.f;
+        if ( !string_view_parse(view, result, parse_float) ) {
+            context->throw_error("string-to-float conversion failed. String is not an float number");
+        }
+        return result;
+    }
+
+    void builtin_write_string_view ( StringBuilderWriter & writer, StringView view ) {
+        if ( view.length ) writer.writeStr(view.data, view.length);
+    }
+
+    // same tokens as builtin_string_split and builtin_string_split_by_char, but nothing is copied
+    template <bool byChar>
+    void string_split_view ( const char * str, const char * delim, const Block & block, Context * context ) {
+        if ( !str ) str = "";
+        if ( !delim ) delim = "";
+        vector<StringView> tokens;
+        const char * ch = str;
+        const char * end = str + stringLengthSafe(*context,str);
+        auto delimLen = stringLengthSafe(*context,delim);
+        if ( delimLen ) {
+            auto isDelim = [&]( const char * at ) {
+                return byChar ? strchr(delim,*at)!=nullptr : strncmp(delim,at,delimLen)==0;
+            };
+            while ( *ch ) {
+                const char * tok = ch;
+                if ( byChar ) {
+                    ch += str_find_first_of(ch, uint32_t(end-ch), delim, delimLen);
+                } else {
+                    int32_t at = str_find(ch, uint32_t(end-ch), delim, delimLen);
+                    ch = at!=-1 ? ch + at : end;
+                }
+                tokens.push_back(StringView{ tok, uint32_t(ch-tok) });
+                if ( !*ch ) break;
+                while ( *ch && isDelim(ch) ) ch += byChar ? 1 : delimLen;
+                if ( !*ch ) tokens.push_back(StringView{ ch, 0 });
+            }
+        } else {
+            tokens.reserve(uint32_t(end-str));
+            for ( ; *ch; ch++ ) {
+                tokens.push_back(StringView{ ch, 1 });
+            }
+        }
+        if ( tokens.empty() ) tokens.push_back(StringView{ str, 0 });
+        Array arr;
+        arr.data = (char *) tokens.data();
+        arr.capacity = arr.size = uint32_t(tokens.size());
+        arr.lock = 1;
+        vec4f args[1];
+        args[0] = cast<Array *>::from(&arr);
+        context->invoke(block, args, nullptr);
+    }
+
+    void builtin_string_split_view ( const char * str, const char * delim, const Block & block, Context * context ) {
+        string_split_view<false>(str, delim, block, context);
+    }
+
+    void builtin_string_split_by_char_view ( const char * str, const char * delim, const Block & block, Context * context ) {
+        string_split_view<true>(str, delim, block, context);
+    }
+
     char * builtin_string_replace ( const char * str, const char * toSearch, const char * replaceStr, Context * context ) {
         auto toSearchSize = stringLengthSafe(*context, toSearch);
         if ( !toSearchSize ) return (char *) str;
-        string data = str ? str : "";
+        auto strLen = stringLengthSafe(*context, str);
         auto replaceStrSize = stringLengthSafe(*context,replaceStr);
-        const char * repl = replaceStr ? replaceStr : "";
-        const char * toss = toSearch ? toSearch : "";
-        size_t pos = data.find(toss);
-        while ( pos != string::npos ) {
-            data.replace(pos, toSearchSize, repl);
-            pos = data.find(toss, pos + replaceStrSize);
+        // count first, so that the result is allocated once
+        uint32_t count = 0;
+        const char * src = str;
+        uint32_t left = strLen;
+        for ( int32_t at; (at = str_find(src, left, toSearch, toSearchSize))!=-1; ) {
+            src += at + toSearchSize;
+            left -= at + toSearchSize;
+            count ++;
+        }
+        if ( !count ) return (char *) str;
+        uint32_t resLen = strLen + count * replaceStrSize - count * toSearchSize;
+        if ( !resLen ) return nullptr;
+        char * res = context->stringHeap->allocateString(nullptr, resLen);
+        char * out = res;
+        src = str;
+        left = strLen;
+        for ( int32_t at; (at = str_find(src, left, toSearch, toSearchSize))!=-1; ) {
+            memcpy(out, src, at);
+            if ( replaceStrSize ) memcpy(out + at, replaceStr, replaceStrSize);
+            out += at + replaceStrSize;
+            src += at + toSearchSize;
+            left -= at + toSearchSize;
         }
-        return context->stringHeap->allocateString(data);
+        memcpy(out, src, left);
+        return res;
     }
 
     class StrdupDataWalker : public DataWalker {
@@ -415,13 +597,15 @@ namespace das
     }
 
     int builtin_find_first_char_of ( const char * str, int Ch, Context * context ) {
-        uint32_t strlen = stringLengthSafe ( *context, str );
-        for ( uint32_t o=0; o!=strlen; ++o ) {
-            if ( str[o]==Ch ) {
-                return o;
-            }
-        }
-        return -1;
+        uint32_t strLen = stringLengthSafe ( *context, str );
+        auto at = strLen ? (const char *) memchr(str, Ch, strLen) : nullptr;
+        return at ? int(at - str) : -1;
+    }
+
+    int builtin_find_first_of ( const char * str, const char * substr, Context * context ) {
+        uint32_t strLen = stringLengthSafe ( *context, str );
+        uint32_t at = str_find_first_of(str, strLen, substr, stringLengthSafe(*context, substr));
+        return at!=strLen ? int(at) : -1;
     }
 
     char * builtin_string_from_array ( const TArray<uint8_t> & bytes, Context * context ) {
@@ -455,6 +639,65 @@ namespace das
         str.resize(newLength);
     }
 
+    // views do not own the string they point into, so they should not outlive the scope they are made in
+    // script functions can't return them, unless they are [unsafe_operation], and globals, lambdas and generators can't hold them
+    struct StringViewLifetimeLint : PassMacro {
+        StringViewLifetimeLint ( TypeAnnotation * ann ) : PassMacro("string_view_lifetime"), viewAnnotation(ann) {}
+        bool hasView ( const TypeDeclPtr & td, das_set<Structure *> & dep ) const {
+            if ( !td ) return false;
+            switch ( td->baseType ) {
+            case Type::tHandle:     return td->annotation==viewAnnotation;
+            case Type::tBlock:
+            case Type::tFunction:
+            case Type::tLambda:     return false;   // views as arguments of callbacks are fine
+            case Type::tStructure:
+                if ( !td->structType || dep.find(td->structType)!=dep.end() ) return false;
+                dep.insert(td->structType);
+                for ( const auto & fld : td->structType->fields ) {
+                    if ( hasView(fld.type, dep) ) return true;
+                }
+                return false;
+            default:
+                if ( hasView(td->firstType, dep) || hasView(td->secondType, dep) ) return true;
+                for ( const auto & argT : td->argTypes ) {
+                    if ( hasView(argT, dep) ) return true;
+                }
+                return false;
+            }
+        }
+        bool hasView ( const TypeDeclPtr & td ) const {
+            das_set<Structure *> dep;
+            return hasView(td, dep);
+        }
+        virtual bool apply ( Program * prog, Module * mod ) override {
+            for ( const auto & gv : mod->globals ) {
+                if ( hasView(gv.second->type) ) {
+                    prog->error("global variable " + gv.first + " can't hold string_view", "view can outlive the string it points into", "",
+                        gv.second->at, CompilationError::invalid_variable_type);
+                }
+            }
+            for ( const auto & fn : mod->functions ) {
+                auto func = fn.second;
+                if ( func->fromGeneric || func->generated || func->unsafeOperation ) continue;
+                if ( hasView(func->result) ) {
+                    prog->error("function " + func->name + " can't return string_view", "view can outlive the string it points into",
+                        "mark function as [unsafe_operation]", func->at, CompilationError::invalid_return_type);
+                }
+            }
+            for ( const auto & st : mod->structures ) {
+                if ( !st.second->isLambda ) continue;
+                for ( const auto & fld : st.second->fields ) {
+                    if ( hasView(fld.type) ) {
+                        prog->error("lambda or generator can't capture string_view " + fld.name, "view can outlive the string it points into", "",
+                            fld.at, CompilationError::invalid_capture);
+                    }
+                }
+            }
+            return false;
+        }
+        TypeAnnotation * viewAnnotation;
+    };
+
     class Module_Strings : public Module {
     public:
         Module_Strings() : Module("strings") {
@@ -527,6 +770,8 @@ namespace das
                 SideEffects::none, "builtin_string_find2")->args({"str","substr"});
             addExtern<DAS_BIND_FUN(builtin_find_first_char_of)>(*this, lib, "find",
                 SideEffects::none, "builtin_find_first_char_of")->args({"str","substr","context"});
+            addExtern<DAS_BIND_FUN(builtin_find_first_of)>(*this, lib, "find_first_of",
+                SideEffects::none, "builtin_find_first_of")->args({"str","chars","context"});
             addExtern<DAS_BIND_FUN(builtin_string_length)>(*this, lib, "length",
                 SideEffects::none, "builtin_string_length")->args({"str","context"});
             addExtern<DAS_BIND_FUN(builtin_string_reverse)>(*this, lib, "reverse",
@@ -572,6 +817,57 @@ namespace das
             addExtern<DAS_BIND_FUN(is_new_line)> (*this, lib, "is_new_line", SideEffects::none, "is_new_line");
             addExtern<DAS_BIND_FUN(is_white_space)> (*this, lib, "is_white_space", SideEffects::none, "is_white_space");
             addExtern<DAS_BIND_FUN(is_number)> (*this, lib, "is_number", SideEffects::none, "is_number");
+            // string views
+            auto viewAnnotation = make_smart<StringViewAnnotation>();
+            addAnnotation(viewAnnotation);
+            lintMacros.push_back(make_smart<StringViewLifetimeLint>(viewAnnotation.get()));
+            // views do not own the string, so making one from an arbitrary string is unsafe
+            addExtern<DAS_BIND_FUN(builtin_string_view)>(*this, lib, "string_view",
+                SideEffects::none, "builtin_string_view")->args({"str","context"})->unsafeOperation = true;
+            addExtern<DAS_BIND_FUN(builtin_string_view_to_string)>(*this, lib, "string",
+                SideEffects::none, "builtin_string_view_to_string")->args({"view","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_length)>(*this, lib, "length",
+                SideEffects::none, "builtin_string_view_length")->args({"view"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_empty)>(*this, lib, "empty",
+                SideEffects::none, "builtin_string_view_empty")->args({"view"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_character_at)>(*this, lib, "character_at",
+                SideEffects::none, "builtin_string_view_character_at")->args({"view","idx","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_slice1)>(*this, lib, "slice",
+                SideEffects::none, "builtin_string_view_slice1")->args({"view","start","end"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_slice2)>(*this, lib, "slice",
+                SideEffects::none, "builtin_string_view_slice2")->args({"view","start"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_strip)>(*this, lib, "strip",
+                SideEffects::none, "builtin_string_view_strip")->args({"view"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_strip_left)>(*this, lib, "strip_left",
+                SideEffects::none, "builtin_string_view_strip_left")->args({"view"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_strip_right)>(*this, lib, "strip_right",
+                SideEffects::none, "builtin_string_view_strip_right")->args({"view"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_find1)>(*this, lib, "find",
+                SideEffects::none, "builtin_string_view_find1")->args({"view","substr","start","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_find2)>(*this, lib, "find",
+                SideEffects::none, "builtin_string_view_find2")->args({"view","substr","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_starts_with)>(*this, lib, "starts_with",
+                SideEffects::none, "builtin_string_view_starts_with")->args({"view","cmp","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_ends_with)>(*this, lib, "ends_with",
+                SideEffects::none, "builtin_string_view_ends_with")->args({"view","cmp","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_equ)>(*this, lib, "==",
+                SideEffects::none, "builtin_string_view_equ")->args({"a","b"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_nequ)>(*this, lib, "!=",
+                SideEffects::none, "builtin_string_view_nequ")->args({"a","b"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_equ_str)>(*this, lib, "==",
+                SideEffects::none, "builtin_string_view_equ_str")->args({"a","b"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_nequ_str)>(*this, lib, "!=",
+                SideEffects::none, "builtin_string_view_nequ_str")->args({"a","b"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_to_int)>(*this, lib, "to_int",
+                SideEffects::none, "builtin_string_view_to_int")->args({"view","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_to_float)>(*this, lib, "to_float",
+                SideEffects::none, "builtin_string_view_to_float")->args({"view","context"});
+            addExtern<DAS_BIND_FUN(builtin_write_string_view)>(*this, lib, "write",
+                SideEffects::modifyArgument, "builtin_write_string_view")->args({"writer","view"});
+            addExtern<DAS_BIND_FUN(builtin_string_split_view)>(*this, lib, "builtin_string_split_view",
+                SideEffects::modifyExternal, "builtin_string_split_view")->args({"str","delim","block","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_split_by_char_view)>(*this, lib, "builtin_string_split_by_char_view",
+                SideEffects::modifyExternal, "builtin_string_split_by_char_view")->args({"str","delim","block","context"});
             // bitset helpers
             addExtern<DAS_BIND_FUN(is_char_in_set)>(*this, lib, "is_char_in_set",
                 SideEffects::none,"is_char_in_set");
@@ -0,0 +1,538 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/misc/format_number.h"
+
+namespace das {
+
+    // integers
+
+    static const char fmt_digits2[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    // writes digits backwards from the end of the buffer, 2 at a time
+    template <typename TT>
+    static __forceinline char * fmt_digits_back ( char * end, TT value ) {
+        while ( value >= 100 ) {
+            uint32_t r = uint32_t(value % 100);
+            value /= 100;
+            end -= 2;
+            memcpy(end, fmt_digits2 + r*2, 2);
+        }
+        if ( value < 10 ) {
+            *--end = char('0' + value);
+        } else {
+            end -= 2;
+            memcpy(end, fmt_digits2 + uint32_t(value)*2, 2);
+        }
+        return end;
+    }
+
+    template <typename TT>
+    static __forceinline int fmt_unsigned ( char * buf, TT value, bool negative ) {
+        char tmp[24];
+        char * end = tmp + sizeof(tmp);
+        char * at = fmt_digits_back(end, value);
+        if ( negative ) *--at = '-';
+        int len = int(end - at);
+        memcpy(buf, at, len);
+        return len;
+    }
+
+    int fmt_uint32 ( char * buf, uint32_t value ) {
+        return fmt_unsigned(buf, value, false);
+    }
+
+    int fmt_int32 ( char * buf, int32_t value ) {
+        return value<0 ? fmt_unsigned(buf, 0u - uint32_t(value), true) : fmt_unsigned(buf, uint32_t(value), false);
+    }
+
+    int fmt_uint64 ( char * buf, uint64_t value ) {
+        return value<=UINT32_MAX ? fmt_unsigned(buf, uint32_t(value), false) : fmt_unsigned(buf, value, false);
+    }
+
+    int fmt_int64 ( char * buf, int64_t value ) {
+        if ( value>=INT32_MIN && value<=INT32_MAX ) return fmt_int32(buf, int32_t(value));
+        return value<0 ? fmt_unsigned(buf, 0ull - uint64_t(value), true) : fmt_unsigned(buf, uint64_t(value), false);
+    }
+
+    int fmt_hex ( char * buf, uint64_t value ) {
+        char tmp[16];
+        char * end = tmp + sizeof(tmp);
+        char * at = end;
+        do {
+            *--at = "0123456789abcdef"[value & 15];
+            value >>= 4;
+        } while ( value );
+        int len = int(end - at);
+        memcpy(buf, at, len);
+        return len;
+    }
+
+    // grisu2, after "Printing Floating-Point Numbers Quickly and Accurately with Integers" by Florian Loitsch
+    // boundaries are computed in the precision of the type, so floats get their own shortest text
+
+    struct FmtDiyFp {
+        uint64_t    f;
+        int         e;
+    };
+
+    static __forceinline FmtDiyFp fmt_diy_sub ( FmtDiyFp x, FmtDiyFp y ) {
+        return { x.f - y.f, x.e };
+    }
+
+    // upper 64 bits of the 128 bit product, rounded
+    static __forceinline FmtDiyFp fmt_diy_mul ( FmtDiyFp x, FmtDiyFp y ) {
+        uint64_t a = x.f, b = y.f;
+#if defined(__SIZEOF_INT128__)
+        __uint128_t p = __uint128_t(a) * b;
+        uint64_t h = uint64_t(p >> 64);
+        uint64_t l = uint64_t(p);
+        h += l >> 63;
+#else
+        uint64_t u0 = a & 0xffffffff, u1 = a >> 32, v0 = b & 0xffffffff, v1 = b >> 32;
+        uint64_t p00 = u0*v0, p01 = u0*v1, p10 = u1*v0, p11 = u1*v1;
+        uint64_t q = (p00 >> 32) + (p10 & 0xffffffff) + (p01 & 0xffffffff);
+        q += uint64_t(1) << 31;     // round
+        uint64_t h = p11 + (p01 >> 32) + (p10 >> 32) + (q >> 32);
+#endif
+        return { h, x.e + y.e + 64 };
+    }
+
+    static __forceinline FmtDiyFp fmt_diy_normalize ( FmtDiyFp x ) {
+        int shift = __builtin_clzll(x.f);
+        return { x.f << shift, x.e - shift };
+    }
+
+    static __forceinline FmtDiyFp fmt_diy_normalize_to ( FmtDiyFp x, int e ) {
+        return { x.f << (x.e - e), e };
+    }
+
+    struct FmtBoundaries {
+        FmtDiyFp    w;
+        FmtDiyFp    minus;
+        FmtDiyFp    plus;
+    };
+
+    template <typename FloatType, typename BitsType, int precision, int maxExponent>
+    static FmtBoundaries fmt_boundaries ( FloatType value ) {
+        const int bias = maxExponent - 1 + (precision - 1);
+        const int minExp = 1 - bias;
+        const uint64_t hiddenBit = uint64_t(1) << (precision - 1);
+        BitsType bits;
+        memcpy(&bits, &value, sizeof(bits));
+        const uint64_t E = uint64_t(bits) >> (precision - 1);
+        const uint64_t F = uint64_t(bits) & (hiddenBit - 1);
+        const FmtDiyFp v = E==0 ? FmtDiyFp{ F, minExp } : FmtDiyFp{ F + hiddenBit, int(E) - bias };
+        // the lower neighbor is closer, when the significand is a power of two
+        const bool lowerIsCloser = F==0 && E>1;
+        const FmtDiyFp mPlus = { 2*v.f + 1, v.e - 1 };
+        const FmtDiyFp mMinus = lowerIsCloser ? FmtDiyFp{ 4*v.f - 1, v.e - 2 } : FmtDiyFp{ 2*v.f - 1, v.e - 1 };
+        const FmtDiyFp wPlus = fmt_diy_normalize(mPlus);
+        const FmtDiyFp wMinus = fmt_diy_normalize_to(mMinus, wPlus.e);
+        return { fmt_diy_normalize(v), wMinus, wPlus };
+    }
+
+    struct FmtCachedPower {
+        uint64_t    f;
+        int         e;
+        int         k;
+    };
+
+    // normalized 10^k for k = -300, -292, ..., 324
+    static const FmtCachedPower fmt_cached_powers[] = {
+        { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+        { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+        { 0xBE5691EF416BD60CULL, -1007, -284 },
+        { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+        { 0xD3515C2831559A83ULL,  -954, -268 },
+        { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+        { 0xEA9C227723EE8BCBULL,  -901, -252 },
+        { 0xAECC49914078536DULL,  -874, -244 },
+        { 0x823C12795DB6CE57ULL,  -847, -236 },
+        { 0xC21094364DFB5637ULL,  -821, -228 },
+        { 0x9096EA6F3848984FULL,  -794, -220 },
+        { 0xD77485CB25823AC7ULL,  -768, -212 },
+        { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+        { 0xEF340A98172AACE5ULL,  -715, -196 },
+        { 0xB23867FB2A35B28EULL,  -688, -188 },
+        { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+        { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+        { 0x936B9FCEBB25C996ULL,  -608, -164 },
+        { 0xDBAC6C247D62A584ULL,  -582, -156 },
+        { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+        { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+        { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+        { 0x87625F056C7C4A8BULL,  -475, -124 },
+        { 0xC9BCFF6034C13053ULL,  -449, -116 },
+        { 0x964E858C91BA2655ULL,  -422, -108 },
+        { 0xDFF9772470297EBDULL,  -396, -100 },
+        { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+        { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+        { 0xB94470938FA89BCFULL,  -316,  -76 },
+        { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+        { 0xCDB02555653131B6ULL,  -263,  -60 },
+        { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+        { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+        { 0xAA242499697392D3ULL,  -183,  -36 },
+        { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+        { 0xBCE5086492111AEBULL,  -130,  -20 },
+        { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+        { 0xD1B71758E219652CULL,   -77,   -4 },
+        { 0x9C40000000000000ULL,   -50,    4 },
+        { 0xE8D4A51000000000ULL,   -24,   12 },
+        { 0xAD78EBC5AC620000ULL,     3,   20 },
+        { 0x813F3978F8940984ULL,    30,   28 },
+        { 0xC097CE7BC90715B3ULL,    56,   36 },
+        { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+        { 0xD5D238A4ABE98068ULL,   109,   52 },
+        { 0x9F4F2726179A2245ULL,   136,   60 },
+        { 0xED63A231D4C4FB27ULL,   162,   68 },
+        { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+        { 0x83C7088E1AAB65DBULL,   216,   84 },
+        { 0xC45D1DF942711D9AULL,   242,   92 },
+        { 0x924D692CA61BE758ULL,   269,  100 },
+        { 0xDA01EE641A708DEAULL,   295,  108 },
+        { 0xA26DA3999AEF774AULL,   322,  116 },
+        { 0xF209787BB47D6B85ULL,   348,  124 },
+        { 0xB454E4A179DD1877ULL,   375,  132 },
+        { 0x865B86925B9BC5C2ULL,   402,  140 },
+        { 0xC83553C5C8965D3DULL,   428,  148 },
+        { 0x952AB45CFA97A0B3ULL,   455,  156 },
+        { 0xDE469FBD99A05FE3ULL,   481,  164 },
+        { 0xA59BC234DB398C25ULL,   508,  172 },
+        { 0xF6C69A72A3989F5CULL,   534,  180 },
+        { 0xB7DCBF5354E9BECEULL,   561,  188 },
+        { 0x88FCF317F22241E2ULL,   588,  196 },
+        { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+        { 0x98165AF37B2153DFULL,   641,  212 },
+        { 0xE2A0B5DC971F303AULL,   667,  220 },
+        { 0xA8D9D1535CE3B396ULL,   694,  228 },
+        { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+        { 0xBB764C4CA7A44410ULL,   747,  244 },
+        { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+        { 0xD01FEF10A657842CULL,   800,  260 },
+        { 0x9B10A4E5E9913129ULL,   827,  268 },
+        { 0xE7109BFBA19C0C9DULL,   853,  276 },
+        { 0xAC2820D9623BF429ULL,   880,  284 },
+        { 0x80444B5E7AA7CF85ULL,   907,  292 },
+        { 0xBF21E44003ACDD2DULL,   933,  300 },
+        { 0x8E679C2F5E44FF8FULL,   960,  308 },
+        { 0xD433179D9C8CB841ULL,   986,  316 },
+        { 0x9E19DB92B4E31BA9ULL,  1013,  324 },
+    };
+
+    enum { fmt_alpha = -60, fmt_gamma = -32 };
+
+    // cached power c, so that alpha <= c.e + e + 64 <= gamma
+    static __forceinline FmtCachedPower fmt_cached_power ( int e ) {
+        const int f = fmt_alpha - e - 1;
+        const int k = (f * 78913) / (1 << 18) + int(f > 0);    // ceil(f * log10(2))
+        const int index = (300 + k + 7) / 8;
+        return fmt_cached_powers[index];
+    }
+
+    static __forceinline int fmt_largest_pow10 ( uint32_t n, uint32_t & pow10 ) {
+        static const uint32_t powers[10] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+        int k = 9;
+        while ( k && n < powers[k] ) k--;
+        pow10 = powers[k];
+        return k + 1;
+    }
+
+    static __forceinline void fmt_grisu2_round ( char * buf, int len, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t tenK ) {
+        // move the last digit down, while it gets closer to w and stays within the boundaries
+        while ( rest < dist && delta - rest >= tenK && (rest + tenK < dist || dist - rest > rest + tenK - dist) ) {
+            buf[len - 1]--;
+            rest += tenK;
+        }
+    }
+
+    static void fmt_grisu2_digits ( char * buf, int & len, int & exponent, FmtDiyFp mMinus, FmtDiyFp w, FmtDiyFp mPlus ) {
+        uint64_t delta = fmt_diy_sub(mPlus, mMinus).f;
+        uint64_t dist = fmt_diy_sub(mPlus, w).f;
+        const int shift = -mPlus.e;
+        const uint64_t one = uint64_t(1) << shift;
+        uint32_t p1 = uint32_t(mPlus.f >> shift);
+        uint64_t p2 = mPlus.f & (one - 1);
+        uint32_t pow10 = 0;
+        int n = fmt_largest_pow10(p1, pow10);
+        // integral part
+        while ( n > 0 ) {
+            buf[len++] = char('0' + p1 / pow10);
+            p1 %= pow10;
+            n--;
+            const uint64_t rest = (uint64_t(p1) << shift) + p2;
+            if ( rest <= delta ) {
+                exponent += n;
+                fmt_grisu2_round(buf, len, dist, delta, rest, uint64_t(pow10) << shift);
+                return;
+            }
+            pow10 /= 10;
+        }
+        // fractional part
+        int m = 0;
+        for ( ;; ) {
+            p2 *= 10;
+            buf[len++] = char('0' + (p2 >> shift));
+            p2 &= one - 1;
+            m++;
+            delta *= 10;
+            dist *= 10;
+            if ( p2 <= delta ) break;
+        }
+        exponent -= m;
+        fmt_grisu2_round(buf, len, dist, delta, p2, one);
+    }
+
+    // digits and exponent, so that value = digits * 10^exponent
+    static void fmt_grisu2 ( char * buf, int & len, int & exponent, const FmtBoundaries & b ) {
+        const FmtCachedPower cached = fmt_cached_power(b.plus.e);
+        const FmtDiyFp c = { cached.f, cached.e };
+        const FmtDiyFp w = fmt_diy_mul(b.w, c);
+        const FmtDiyFp wMinus = fmt_diy_mul(b.minus, c);
+        const FmtDiyFp wPlus = fmt_diy_mul(b.plus, c);
+        // boundaries are not exact after the multiplication, so they are narrowed by one unit to stay safe
+        const FmtDiyFp mMinus = { wMinus.f + 1, wMinus.e };
+        const FmtDiyFp mPlus = { wPlus.f - 1, wPlus.e };
+        len = 0;
+        exponent = -cached.k;
+        fmt_grisu2_digits(buf, len, exponent, mMinus, w, mPlus);
+    }
+
+    // printf("%g") layout. scientific when the exponent is below -4, or not less than max(digits,6)
+    static int fmt_layout ( char * buf, const char * digits, int len, int exponent ) {
+        char * out = buf;
+        const int x = exponent + len - 1;
+        if ( x < -4 || x >= das::max(len, 6) ) {
+            *out++ = digits[0];
+            if ( len > 1 ) {
+                *out++ = '.';
+                memcpy(out, digits + 1, len - 1);
+                out += len - 1;
+            }
+            *out++ = 'e';
+            *out++ = x < 0 ? '-' : '+';
+            int ax = x < 0 ? -x : x;
+            if ( ax < 10 ) *out++ = '0';
+            out += fmt_int32(out, ax);
+        } else if ( x >= 0 ) {
+            if ( len <= x + 1 ) {
+                memcpy(out, digits, len);
+                memset(out + len, '0', x + 1 - len);
+                out += x + 1;
+            } else {
+                memcpy(out, digits, x + 1);
+                out += x + 1;
+                *out++ = '.';
+                memcpy(out, digits + x + 1, len - x - 1);
+                out += len - x - 1;
+            }
+        } else {
+            *out++ = '0';
+            *out++ = '.';
+            memset(out, '0', -x - 1);
+            out += -x - 1;
+            memcpy(out, digits, len);
+            out += len;
+        }
+        return int(out - buf);
+    }
+
+    template <typename FloatType>
+    static __forceinline int fmt_special ( char * buf, FloatType value ) {
+        char * out = buf;
+        if ( signbit(value) ) *out++ = '-';
+        if ( isnan(value) ) {
+            memcpy(out, "nan", 3);
+        } else if ( isinf(value) ) {
+            memcpy(out, "inf", 3);
+        } else {
+            *out++ = '0';
+            return int(out - buf);
+        }
+        return int(out - buf) + 3;
+    }
+
+    int fmt_float ( char * buf, float value ) {
+        if ( !isfinite(value) || value==0.0f ) return fmt_special(buf, value);
+        char * out = buf;
+        if ( value < 0 ) {
+            *out++ = '-';
+            value = -value;
+        }
+        char digits[DAS_FMT_NUMBER_SIZE];
+        int len = 0, exponent = 0;
+        fmt_grisu2(digits, len, exponent, fmt_boundaries<float,uint32_t,24,128>(value));
+        return int(out - buf) + fmt_layout(out, digits, len, exponent);
+    }
+
+    int fmt_double ( char * buf, double value ) {
+        if ( !isfinite(value) || value==0.0 ) return fmt_special(buf, value);
+        char * out = buf;
+        if ( value < 0 ) {
+            *out++ = '-';
+            value = -value;
+        }
+        char digits[DAS_FMT_NUMBER_SIZE];
+        int len = 0, exponent = 0;
+        fmt_grisu2(digits, len, exponent, fmt_boundaries<double,uint64_t,53,1024>(value));
+        return int(out - buf) + fmt_layout(out, digits, len, exponent);
+    }
+
+    // parsing
+
+    static __forceinline bool parse_is_space ( char ch ) {
+        return ch==' ' || uint8_t(ch-'\t')<=uint8_t('\r'-'\t');
+    }
+
+    static __forceinline bool parse_is_digit ( char ch ) {
+        return uint8_t(ch-'0')<=9;
+    }
+
+    // strtol and strtoul saturate on overflow
+    static __forceinline const char * parse_unsigned ( const char * str, bool & negative, uint64_t & value, bool & overflow ) {
+        const char * p = str;
+        while ( parse_is_space(*p) ) p++;
+        negative = false;
+        if ( *p=='-' ) { negative = true; p++; }
+        else if ( *p=='+' ) p++;
+        if ( !parse_is_digit(*p) ) {
+            value = 0;
+            overflow = false;
+            return str;
+        }
+        value = 0;
+        overflow = false;
+        for ( ; parse_is_digit(*p); p++ ) {
+            uint64_t d = uint64_t(*p - '0');
+            if ( value > (UINT64_MAX - d) / 10 ) overflow = true;
+            else value = value * 10 + d;
+        }
+        return p;
+    }
+
+    int64_t parse_int64 ( const char * str, char ** endptr ) {
+        bool negative, overflow;
+        uint64_t value;
+        const char * end = parse_unsigned(str, negative, value, overflow);
+        if ( endptr ) *endptr = (char *) end;
+        if ( negative ) {
+            return (overflow || value > uint64_t(INT64_MAX) + 1) ? INT64_MIN : int64_t(0 - value);
+        } else {
+            return (overflow || value > uint64_t(INT64_MAX)) ? INT64_MAX : int64_t(value);
+        }
+    }
+
+    uint64_t parse_uint64 ( const char * str, char ** endptr ) {
+        bool negative, overflow;
+        uint64_t value;
+        const char * end = parse_unsigned(str, negative, value, overflow);
+        if ( endptr ) *endptr = (char *) end;
+        if ( overflow ) return UINT64_MAX;
+        return negative ? 0 - value : value;
+    }
+
+    // decimal text with up to 19 significant digits. anything else (hex, inf, nan) is left to the C library
+    static __forceinline bool parse_decimal ( const char * str, const char * & end, bool & negative, uint64_t & mantissa, int & exponent ) {
+        const char * p = str;
+        while ( parse_is_space(*p) ) p++;
+        negative = false;
+        if ( *p=='-' ) { negative = true; p++; }
+        else if ( *p=='+' ) p++;
+        if ( p[0]=='0' && (p[1]=='x' || p[1]=='X') ) return false;
+        mantissa = 0;
+        exponent = 0;
+        int digits = 0;
+        bool any = false;
+        for ( ; parse_is_digit(*p); p++ ) {
+            any = true;
+            if ( !mantissa && *p=='0' ) continue;
+            if ( digits==19 ) return false;
+            mantissa = mantissa * 10 + uint64_t(*p - '0');
+            digits++;
+        }
+        if ( *p=='.' ) {
+            for ( p++; parse_is_digit(*p); p++ ) {
+                any = true;
+                exponent--;
+                if ( !mantissa && *p=='0' ) continue;
+                if ( digits==19 ) return false;
+                mantissa = mantissa * 10 + uint64_t(*p - '0');
+                digits++;
+            }
+        }
+        if ( !any ) return false;
+        if ( *p=='e' || *p=='E' ) {
+            const char * q = p + 1;
+            bool negativeExp = false;
+            if ( *q=='-' ) { negativeExp = true; q++; }
+            else if ( *q=='+' ) q++;
+            if ( parse_is_digit(*q) ) {
+                int exp = 0;
+                for ( ; parse_is_digit(*q); q++ ) {
+                    if ( exp > 10000 ) return false;
+                    exp = exp * 10 + (*q - '0');
+                }
+                exponent += negativeExp ? -exp : exp;
+                p = q;
+            }
+        }
+        end = p;
+        return true;
+    }
+
+    // both the mantissa and the power of 10 are exact, so one multiplication or division rounds correctly
+    double parse_double ( const char * str, char ** endptr ) {
+        static const double pow10[23] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        const char * end;
+        bool negative;
+        uint64_t mantissa;
+        int exponent;
+        if ( parse_decimal(str, end, negative, mantissa, exponent) ) {
+            if ( !mantissa ) {
+                if ( endptr ) *endptr = (char *) end;
+                return negative ? -0.0 : 0.0;
+            }
+            if ( (mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) ) {
+                double value = double(mantissa);
+                value = exponent < 0 ? value / pow10[-exponent] : value * pow10[exponent];
+                if ( endptr ) *endptr = (char *) end;
+                return negative ? -value : value;
+            }
+        }
+        return strtod(str, endptr);
+    }
+
+    float parse_float ( const char * str, char ** endptr ) {
+        static const float pow10[11] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+        const char * end;
+        bool negative;
+        uint64_t mantissa;
+        int exponent;
+        if ( parse_decimal(str, end, negative, mantissa, exponent) ) {
+            if ( !mantissa ) {
+                if ( endptr ) *endptr = (char *) end;
+                return negative ? -0.0f : 0.0f;
+            }
+            if ( (mantissa <= (uint64_t(1) << 24) && exponent >= -10 && exponent <= 10) ) {
+                float value = float(mantissa);
+                value = exponent < 0 ? value / pow10[-exponent] : value * pow10[exponent];
+                if ( endptr ) *endptr = (char *) end;
+                return negative ? -value : value;
+            }
+        }
+        return strtof(str, endptr);
+    }
+}
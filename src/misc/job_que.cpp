@@ -0,0 +1,132 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/misc/job_que.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace das {
+
+    class JobQue {
+    public:
+        JobQue ( uint32_t count ) {
+            for ( uint32_t t=1; t<count; ++t ) {
+                workers.emplace_back([this](){ work(); });
+            }
+        }
+        ~JobQue() {
+            {
+                lock_guard<mutex> guard(lock);
+                shutdown = true;
+            }
+            wake.notify_all();
+            for ( auto & th : workers ) {
+                th.join();
+            }
+        }
+        void run ( uint32_t count, const function<void(uint32_t)> & fn ) {
+            lock_guard<mutex> single(runLock);
+            {
+                lock_guard<mutex> guard(lock);
+                job = &fn;
+                total = count;
+                next = 0;
+                finished = 0;
+                generation ++;
+            }
+            wake.notify_all();
+            execute(fn, count);
+            unique_lock<mutex> guard(lock);
+            // workers which picked this job up must let go of it, before next one can reset the counters
+            done.wait(guard, [&](){ return finished==total && active==0; });
+            job = nullptr;
+        }
+    protected:
+        void execute ( const function<void(uint32_t)> & fn, uint32_t count ) {
+            uint32_t completed = 0;
+            for ( ;; ) {
+                uint32_t index = next.fetch_add(1);
+                if ( index>=count ) break;
+                fn(index);
+                completed ++;
+            }
+            if ( completed && finished.fetch_add(completed)+completed==count ) {
+                lock_guard<mutex> guard(lock);
+                done.notify_all();
+            }
+        }
+        void work() {
+            insideJob = true;
+            uint64_t seen = 0;
+            unique_lock<mutex> guard(lock);
+            for ( ;; ) {
+                wake.wait(guard, [&](){ return shutdown || (job && generation!=seen); });
+                if ( shutdown ) break;
+                seen = generation;
+                auto fn = job;
+                auto count = total;
+                active ++;
+                guard.unlock();
+                execute(*fn, count);
+                guard.lock();
+                if ( --active==0 ) done.notify_all();
+            }
+        }
+    protected:
+        vector<thread>                      workers;
+        mutex                               runLock;
+        mutex                               lock;
+        condition_variable                  wake;
+        condition_variable                  done;
+        const function<void(uint32_t)> *    job = nullptr;
+        uint32_t                            total = 0;
+        uint32_t                            active = 0;
+        uint64_t                            generation = 0;
+        atomic<uint32_t>                    next {0};
+        atomic<uint32_t>                    finished {0};
+        bool                                shutdown = false;
+    public:
+        static thread_local bool            insideJob;
+    };
+
+    thread_local bool JobQue::insideJob = false;
+
+    static mutex                g_jobQueLock;
+    static unique_ptr<JobQue>   g_jobQue;
+    static uint32_t             g_jobQueThreads = 0;
+
+    static uint32_t hardware_thread_count() {
+        return max(thread::hardware_concurrency(), 1u);
+    }
+
+    uint32_t parallel_thread_count() {
+        return g_jobQueThreads ? g_jobQueThreads : hardware_thread_count();
+    }
+
+    void set_parallel_thread_count ( uint32_t count ) {
+        lock_guard<mutex> guard(g_jobQueLock);
+        if ( g_jobQueThreads!=count ) {
+            g_jobQueThreads = count;
+            g_jobQue.reset();
+        }
+    }
+
+    void parallel_for ( uint32_t count, const function<void(uint32_t)> & job ) {
+        if ( count==0 ) return;
+        if ( count==1 || JobQue::insideJob || parallel_thread_count()==1 ) {
+            for ( uint32_t i=0; i!=count; ++i ) job(i);
+            return;
+        }
+        JobQue * que;
+        {
+            lock_guard<mutex> guard(g_jobQueLock);
+            if ( !g_jobQue ) g_jobQue = make_unique<JobQue>(parallel_thread_count());
+            que = g_jobQue.get();
+        }
+        JobQue::insideJob = true;
+        que->run(count, job);
+        JobQue::insideJob = false;
+    }
+}
@@ -3,6 +3,11 @@
 #include "daScript/misc/memory_model.h"
 #include "daScript/misc/debug_break.h"
 
+#if DAS_HUGE_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace das {
 
 #if DAS_TRACK_ALLOCATIONS
@@ -23,9 +28,10 @@ namespace das {
     MemoryModel::~MemoryModel() {
         shoe.clear();
         for ( auto & itb : bigStuff ) {
-            das_aligned_free16(itb.first);
+            freeBig((char *)itb.first, itb.second & ~DAS_PAGE_GC_MASK);
         }
         bigStuff.clear();
+        buckets.clear();
 #if DAS_SANITIZER
         for ( auto & itb : deletedBigStuff ) {
             das_aligned_free16(itb.first);
@@ -55,15 +61,96 @@ namespace das {
         }
     }
 
-    char * MemoryModel::allocate ( uint32_t size ) {
-        if ( !size ) return nullptr;
-        size = (size + alignMask) & ~alignMask;
-        totalAllocated += size;
+#if DAS_HUGE_MMAP
+    static __forceinline uint64_t hugePageSize ( uint64_t size ) {
+        static uint64_t pageSize = uint64_t(sysconf(_SC_PAGESIZE));
+        return (size + pageSize - 1) & ~(pageSize - 1);
+    }
+#endif
+
+    char * MemoryModel::allocateBig ( uint64_t size ) {
+        if ( customReserve ) customReserve(size);
+#if !DAS_SANITIZER
+        if ( Buckets::isBucketSize(size) ) {
+            if ( char * ptr = buckets.allocate(size) ) {
+                return ptr;
+            }
+            return (char *) das_aligned_alloc16(Buckets::bucketSize(size));
+        }
+#if DAS_HUGE_MMAP
+        if ( size>=DAS_MIN_HUGE_ALLOCATION ) {
+            void * ptr = mmap(nullptr, hugePageSize(size), PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+            return ptr!=MAP_FAILED ? (char *) ptr : nullptr;
+        }
+#endif
+#endif
+        return (char *) das_aligned_alloc16(size);
+    }
+
+    void MemoryModel::freeBig ( char * ptr, uint64_t size ) {
+#if !DAS_SANITIZER
+        if ( Buckets::isBucketSize(size) ) {
+            buckets.free(ptr, size);
+            return;
+        }
+#if DAS_HUGE_MMAP
+        if ( size>=DAS_MIN_HUGE_ALLOCATION ) {
+            munmap(ptr, hugePageSize(size));
+            return;
+        }
+#endif
+#endif
+        das_aligned_free16(ptr);
+    }
+
+    // grows or shrinks big allocation without copying, when possible. returns nullptr otherwise
+    char * MemoryModel::reallocateBig ( char * ptr, uint64_t size, uint64_t nsize ) {
+#if !DAS_SANITIZER && !DAS_TRACK_ALLOCATIONS
+        bool sameBucket = Buckets::isBucketSize(size) && Buckets::isBucketSize(nsize)
+            && Buckets::bucketSize(size)==Buckets::bucketSize(nsize);
+#if DAS_HUGE_MMAP
+        bool bothHuge = size>=DAS_MIN_HUGE_ALLOCATION && nsize>=DAS_MIN_HUGE_ALLOCATION;
+#else
+        bool bothHuge = false;
+#endif
+        if ( !sameBucket && !bothHuge ) return nullptr;
+        auto itb = bigStuff.find(ptr);
+        if ( itb==bigStuff.end() ) return nullptr;
+        DAS_ASSERTF(itb->second==size, "reallocate size mismatch, %llu allocated vs %llu reallocated",
+            (unsigned long long) itb->second, (unsigned long long) size );
+        if ( nsize>size && customReserve ) customReserve(nsize - size);
+        char * nptr = ptr;
+#if DAS_HUGE_MMAP
+        if ( bothHuge ) {
+            void * mptr = mremap(ptr, hugePageSize(size), hugePageSize(nsize), MREMAP_MAYMOVE);
+            if ( mptr==MAP_FAILED ) return nullptr;
+            nptr = (char *) mptr;
+        }
+#endif
+        if ( nptr!=ptr ) {
+            bigStuff.erase(itb);
+            bigStuff[nptr] = nsize;
+        } else {
+            itb->second = nsize;
+        }
+        totalAllocated = totalAllocated - size + nsize;
         maxAllocated = das::max(maxAllocated, totalAllocated);
+        return nptr;
+#else
+        return nullptr;
+#endif
+    }
+
+    char * MemoryModel::allocate ( uint64_t size ) {
+        if ( !size ) return nullptr;
+        size = (size + alignMask) & ~uint64_t(alignMask);
 #if !DAS_TRACK_ALLOCATIONS
         if ( size >= DAS_MAX_SHOE_ALLOCATION ) {
 #endif
-            char * ptr = (char *) das_aligned_alloc16(size);
+            char * ptr = allocateBig(size);
+            if ( !ptr ) return nullptr;                 // out of memory, callers report it
+            totalAllocated += size;
+            maxAllocated = das::max(maxAllocated, totalAllocated);
             bigStuff[ptr] = size;
 #if DAS_TRACK_ALLOCATIONS
             if ( g_tracker==g_breakpoint ) os_debug_break();
@@ -72,29 +159,33 @@ namespace das {
             return ptr;
 #if !DAS_TRACK_ALLOCATIONS
         } else {
-            if ( char * res = shoe.allocate(size) ) {
-                return res;
+            char * res = shoe.allocate(uint32_t(size));
+            if ( !res ) {
+                uint32_t csize = (uint32_t(size) + 15) & ~15;
+                DAS_ASSERT(csize && csize<=DAS_MAX_SHOE_ALLOCATION);
+                uint32_t si = (csize >> 4) - 1;
+                uint32_t total = grow(si);
+                if ( customReserve ) customReserve(uint64_t(total)*csize);
+                shoe.chunks[si] = new Deck(total, csize, shoe.chunks[si]);
+                res = shoe.chunks[si]->allocate();
             }
-            size = (size + 15) & ~15;
-            DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
-            uint32_t si = (size >> 4) - 1;
-            uint32_t total = grow(si);
-            shoe.chunks[si] = new Deck(total, size, shoe.chunks[si]);
-            return shoe.chunks[si]->allocate();
+            totalAllocated += size;
+            maxAllocated = das::max(maxAllocated, totalAllocated);
+            return res;
         }
 #endif
     }
 
-    bool MemoryModel::free ( char * ptr, uint32_t size ) {
+    bool MemoryModel::free ( char * ptr, uint64_t size ) {
         if ( !size ) return true;
-        size = (size + alignMask) & ~alignMask;
+        size = (size + alignMask) & ~uint64_t(alignMask);
 
 #if DAS_SANITIZER
         memset(ptr, 0xcd, size);
 #endif
 #if !DAS_TRACK_ALLOCATIONS
         if ( size < DAS_MAX_SHOE_ALLOCATION ) {
-            shoe.free(ptr, size);
+            shoe.free(ptr, uint32_t(size));
             totalAllocated -= size;
             return true;
         }
@@ -107,11 +198,12 @@ namespace das {
 #endif
         auto itb = bigStuff.find(ptr);
         if ( itb!=bigStuff.end() ) {
-            DAS_ASSERTF(itb->second==size, "free size mismatch, %u allocated vs %u freed", itb->second, size );
+            DAS_ASSERTF(itb->second==size, "free size mismatch, %llu allocated vs %llu freed",
+                (unsigned long long) itb->second, (unsigned long long) size );
 #if DAS_SANITIZER
             deletedBigStuff[itb->first] = itb->second;
 #else
-            das_aligned_free16(itb->first);
+            freeBig((char *)itb->first, size);
 #endif
             bigStuff.erase(itb);
             totalAllocated -= size;
@@ -126,12 +218,17 @@ namespace das {
         return false;
     }
 
-    char * MemoryModel::reallocate ( char * ptr, uint32_t size, uint32_t nsize ) {
+    char * MemoryModel::reallocate ( char * ptr, uint64_t size, uint64_t nsize ) {
         if ( !ptr ) return allocate(nsize);
-        size = (size + alignMask) & ~alignMask;
-        nsize = (nsize + alignMask) & ~alignMask;
+        size = (size + alignMask) & ~uint64_t(alignMask);
+        nsize = (nsize + alignMask) & ~uint64_t(alignMask);
+        if ( size>=DAS_MAX_SHOE_ALLOCATION && nsize>=DAS_MAX_SHOE_ALLOCATION ) {
+            if ( char * nptr = reallocateBig(ptr, size, nsize) ) {
+                return nptr;
+            }
+        }
         char * nptr = allocate(nsize);
-        DAS_ASSERT(nptr && "out of memory?");
+        if ( !nptr ) return nullptr;                    // out of memory, old allocation stays
         memcpy ( nptr, ptr, das::min(size,nsize) );
 #if DAS_TRACK_ALLOCATIONS
         auto pAt = bigStuffAt.find(ptr);
@@ -152,7 +249,7 @@ namespace das {
 #if DAS_SANITIZER
             deletedBigStuff[itb.first] = itb.second;
 #else
-            das_aligned_free16(itb.first);
+            freeBig((char *)itb.first, itb.second & ~DAS_PAGE_GC_MASK);
 #endif
         }
         bigStuff.clear();
@@ -167,9 +264,74 @@ namespace das {
     uint64_t MemoryModel::totalAlignedMemoryAllocated() const {
         uint64_t mem = shoe.totalBytesAllocated();
         for (const auto & it : bigStuff) {
-            mem += it.second;
+            mem += it.second & ~DAS_PAGE_GC_MASK;
+        }
+        uint32_t freeBlocks; uint64_t freeBytes;
+        buckets.getStats(freeBlocks, freeBytes);
+        return mem + freeBytes;
+    }
+
+    void MemoryModel::getHeapStats ( HeapStats & stats ) const {
+        stats = HeapStats();
+        stats.bytesAllocated = totalAllocated;
+        stats.maxBytesAllocated = maxAllocated;
+        uint64_t smallTotal = 0;
+        shoe.getStats(stats.depth, stats.smallChunks, stats.smallLiveBytes, smallTotal);
+        stats.smallFreeBytes = smallTotal - stats.smallLiveBytes;
+        for ( const auto & it : bigStuff ) {
+            uint64_t size = it.second & ~DAS_PAGE_GC_MASK;
+            stats.bigBlocks ++;
+            stats.bigBytes += size;
+            stats.maxBigBlock = das::max(stats.maxBigBlock, size);
+        }
+        buckets.getStats(stats.bigFreeBlocks, stats.bigFreeBytes);
+        stats.totalBytes = smallTotal + stats.bigBytes + stats.bigFreeBytes;
+        stats.fragmentation = heapFragmentation(stats.bytesAllocated, stats.totalBytes - das::min(stats.totalBytes,stats.bytesAllocated));
+    }
+
+    void MemoryModel::getSizeClassStats ( vector<HeapSizeClassStats> & classes ) const {
+        classes.clear();
+        for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {
+            if ( !shoe.chunks[si] ) continue;
+            HeapSizeClassStats cls;
+            cls.size = (si+1)<<4;
+            for ( auto ch=shoe.chunks[si]; ch; ch=ch->next ) {
+                cls.chunks ++;
+                cls.liveBlocks += ch->allocated;
+                cls.liveBytes += uint64_t(ch->allocated) * ch->size;
+                cls.freeBytes += uint64_t(ch->total - ch->allocated) * ch->size;
+            }
+            cls.fragmentation = heapFragmentation(cls.liveBytes, cls.freeBytes);
+            classes.push_back(cls);
+        }
+        // big allocations, which fit the buckets, are reported per bucket. rounding up to the bucket size counts as free
+        HeapSizeClassStats bcls[DAS_MAX_BUCKETS];
+        HeapSizeClassStats huge;
+        for ( const auto & it : bigStuff ) {
+            uint64_t size = it.second & ~DAS_PAGE_GC_MASK;
+            if ( Buckets::isBucketSize(size) ) {
+                auto & cls = bcls[Buckets::bucketIndex(size)];
+                cls.liveBlocks ++;
+                cls.liveBytes += size;
+                cls.freeBytes += Buckets::bucketSize(size) - size;
+            } else {
+                huge.liveBlocks ++;
+                huge.liveBytes += size;
+            }
+        }
+        for ( uint32_t bi=0; bi!=DAS_MAX_BUCKETS; ++bi ) {
+            auto & cls = bcls[bi];
+            cls.chunks = buckets.counts[bi];
+            cls.freeBytes += cls.chunks * Buckets::bucketSizeByIndex(bi);
+            if ( cls.liveBlocks || cls.chunks ) {
+                cls.size = Buckets::bucketSizeByIndex(bi);
+                cls.fragmentation = heapFragmentation(cls.liveBytes, cls.freeBytes);
+                classes.push_back(cls);
+            }
+        }
+        if ( huge.liveBlocks ) {
+            classes.push_back(huge);
         }
-        return mem;
     }
 
     void MemoryModel::sweep() {
@@ -195,16 +357,23 @@ namespace das {
                 totalAllocated += it->second;
                 ++ it;
             } else {
-                das_aligned_free16(it->first);
+                freeBig((char *)it->first, it->second);
                 it = bigStuff.erase(it);
             }
         }
+        trim();
+    }
+
+    // free lists of big blocks are only reused by allocations of the same size class
+    // collection is where memory is expected to go down, so they are given back to the system
+    void MemoryModel::trim() {
+        buckets.clear();
     }
 
-    char * LinearChunkAllocator::reallocate ( char * ptr, uint32_t size, uint32_t nsize ) {
+    char * LinearChunkAllocator::reallocate ( char * ptr, uint64_t size, uint64_t nsize ) {
         if ( !ptr ) return allocate(nsize);
-        size = (size + alignMask) & ~alignMask;
-        nsize = (nsize + alignMask) & ~alignMask;
+        size = (size + alignMask) & ~uint64_t(alignMask);
+        nsize = (nsize + alignMask) & ~uint64_t(alignMask);
         // TODO: we can 'expand' in certain cases
         char * nptr = allocate(nsize);
         memcpy ( nptr, ptr, das::min(size,nsize) );
@@ -212,8 +381,8 @@ namespace das {
         return nptr;
     }
 
-    void LinearChunkAllocator::free ( char * ptr, uint32_t s ) {
-        s = (s + alignMask) & ~alignMask;
+    void LinearChunkAllocator::free ( char * ptr, uint64_t s ) {
+        s = (s + alignMask) & ~uint64_t(alignMask);
         for ( auto ch=chunk; ch; ch=ch->next ) {
             if ( ch->isOwnPtr(ptr) ) {
                 ch->free(ptr,s);
@@ -222,31 +391,39 @@ namespace das {
         }
     }
 
-    uint32_t LinearChunkAllocator::grow ( uint32_t size ) {
-        return customGrow ? customGrow(size) : size * 2;
+    uint64_t LinearChunkAllocator::grow ( uint64_t size ) {
+        if ( customGrow && size<=uint64_t(INT32_MAX) ) {
+            return uint64_t(customGrow(int(size)));
+        }
+        return size * 2;
     }
 
-    char * LinearChunkAllocator::allocate ( uint32_t s ) {
+    char * LinearChunkAllocator::allocate ( uint64_t s ) {
         if ( !s ) return nullptr;
-        s = (s + alignMask) & ~alignMask;
+        s = (s + alignMask) & ~uint64_t(alignMask);
         if ( !chunk ) {
             if ( !initialSize ) {
                 initialSize = default_initial_size;
             }
-            chunk = new HeapChunk ( das::max(initialSize, s), nullptr );
+            uint64_t csize = das::max(uint64_t(initialSize), s);
+            if ( customReserve ) customReserve(csize);
+            chunk = new HeapChunk ( csize, nullptr );
         }
         for ( ;; ) {
             if ( char * res = chunk->allocate(s) ) {
                 return res;
             }
-            chunk = new HeapChunk ( das::max(grow(chunk->size), s), chunk);
+            uint64_t csize = das::max(grow(chunk->size), s);
+            if ( customReserve ) customReserve(csize);
+            chunk = new HeapChunk ( csize, chunk);
         }
     }
 
     void LinearChunkAllocator::reset() {
+        maxAllocated = das::max(maxAllocated, bytesAllocated());
         if ( chunk && chunk->next ) {
-            auto maxAllocated = (uint32_t(bytesAllocated())+1023) & ~1023;
-            initialSize = das::max(initialSize, maxAllocated);
+            auto newSize = uint32_t(das::min<uint64_t>((bytesAllocated()+1023) & ~1023ull, 0x80000000ull));
+            initialSize = das::max(initialSize, newSize);
             delete chunk;
             chunk = nullptr;
         } else if ( chunk ) {
@@ -289,6 +466,29 @@ namespace das {
         return b;
     }
 
+    void LinearChunkAllocator::getHeapStats ( HeapStats & stats ) const {
+        stats = HeapStats();
+        getStats(stats.depth, stats.bytesAllocated, stats.totalBytes);
+        stats.maxBytesAllocated = das::max(maxAllocated, stats.bytesAllocated);
+        stats.smallChunks = stats.depth;
+        stats.smallLiveBytes = stats.bytesAllocated;
+        stats.smallFreeBytes = stats.totalBytes - stats.bytesAllocated;
+        stats.fragmentation = heapFragmentation(stats.smallLiveBytes, stats.smallFreeBytes);
+    }
+
+    void LinearChunkAllocator::getSizeClassStats ( vector<HeapSizeClassStats> & classes ) const {
+        classes.clear();
+        if ( !chunk ) return;
+        HeapSizeClassStats cls;
+        for ( auto ch=chunk; ch; ch=ch->next ) {
+            cls.chunks ++;
+            cls.liveBytes += ch->offset;
+            cls.freeBytes += ch->size - ch->offset;
+        }
+        cls.fragmentation = heapFragmentation(cls.liveBytes, cls.freeBytes);
+        classes.push_back(cls);
+    }
+
     uint64_t LinearChunkAllocator::totalAlignedMemoryAllocated() const {
         uint32_t d; uint64_t b, t;
         getStats(d, b, t);
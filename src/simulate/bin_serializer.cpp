@@ -3,6 +3,7 @@
 #include "daScript/simulate/bin_serializer.h"
 #include "daScript/simulate/simulate.h"
 #include "daScript/simulate/hash.h"
+#include "daScript/simulate/runtime_table.h"
 
 namespace das {
 
@@ -102,8 +103,29 @@ namespace das {
                 save(pa->size);
             }
         }
-        virtual void beforeTable ( Table *, TypeInfo * ) override {
-            error("binary serialization of tables is not supported");
+        virtual void beforeTable ( Table *, TypeInfo * ti ) override {
+            if ( ti->secondType->type!=Type::tVoid ) {
+                error("binary serialization of tables is not supported");
+            }
+        }
+        // sets are written as a list of keys, and rebuilt on load
+        virtual void walk_table ( Table * tab, TypeInfo * ti ) override {
+            verify(ti->hash);
+            if ( reading ) {
+                uint32_t count = 0;
+                load(count);
+                table_clear(*context, *tab);
+                vector<char> key(getTypeSize(ti->firstType));
+                for ( uint32_t i=0; i!=count && !cancel; ++i ) {
+                    memset(key.data(), 0, key.size());
+                    walk(key.data(), ti->firstType);
+                    int32_t index = -1;
+                    table_reserve_batch(*context, *tab, ti->firstType->type, key.data(), 1, 0, &index);
+                }
+            } else {
+                save(tab->size);
+                DataWalker::walk_table(tab, ti);
+            }
         }
         virtual void beforePtr ( char *, TypeInfo * ) override {
             error("binary serialization of pointers is not supported");
@@ -123,19 +123,24 @@ namespace das {
         int keySize = getTypeSize(info->firstType);
         int valueSize = getTypeSize(info->secondType);
         uint32_t count = 0;
-        for ( uint32_t i=0; i!=tab->capacity; ++i ) {
+        for ( uint32_t i=0, is=table_entries(*tab); i!=is; ++i ) {
             if ( tab->hashes[i] > HASH_KILLED32 ) {
                 bool last = (count == (tab->size-1));
                 // key
-                char * key = tab->keys + i*keySize;
+                char * key = tab->keys + uint64_t(i)*keySize;
                 beforeTableKey(tab, info, key, info->firstType, count, last);
                 if ( cancel ) return;
                 walk ( key, info->firstType );
                 if ( cancel ) return;
                 afterTableKey(tab, info, key, info->firstType, count, last);
                 if ( cancel ) return;
+                // sets have no values
+                if ( info->secondType->type==Type::tVoid ) {
+                    count ++;
+                    continue;
+                }
                 // value
-                char * value = tab->data + i*valueSize;
+                char * value = tab->data + uint64_t(i)*valueSize;
                 beforeTableValue(tab, info, value, info->secondType, count, last);
                 if ( cancel ) return;
                 walk ( value, info->secondType );
@@ -9,39 +9,57 @@
 namespace das
 {
     struct HashDataWalker : DataWalker {
-        const uint32_t fnv_prime = 16777619;
-        uint32_t fnv_bias = 2166136261;
+        uint64_t seed = 0;
+        __forceinline void update ( const void * data, uint64_t size ) {
+            seed = wyhash64((const uint8_t *)data, size, seed);
+        }
         template <typename TT>
         __forceinline void update ( TT & data ) {
-            uint32_t size = sizeof(TT);
-            uint8_t * block = (uint8_t *) & data;
-            while ( size-- ) {
-                fnv_bias = ( fnv_bias ^ *block++ ) * fnv_prime;
-            }
+            update(&data, sizeof(TT));
         }
         __forceinline void updateString ( char * & str ) {
-            uint8_t * block = (uint8_t *) str;
-            while ( *block ) {
-                fnv_bias = ( fnv_bias ^ *block++ ) * fnv_prime;
+            if ( str ) {
+                update(str, strlen(str));
+            } else {
+                update(str, 0);
             }
         }
         __forceinline uint32_t getHash ( void ) const {
-            if (fnv_bias <= HASH_KILLED32) {
-                return fnv_prime;
-            }
-            return fnv_bias;
+            return wyhash_fold32(seed);
         }
     // walker
         HashDataWalker ( Context & ctx ) {
             context = &ctx;
         }
+    // dense pod types are hashed as one block, instead of field by field
+        using DataWalker::walk;
+        virtual void walk ( char * pa, TypeInfo * info ) override {
+            if ( pa && info->isDensePod() && !info->isRef() ) {
+                update(pa, getTypeSize(info));
+            } else {
+                DataWalker::walk(pa, info);
+            }
+        }
+        virtual void walk_array ( char * pa, uint32_t stride, uint32_t count, TypeInfo * ti ) override {
+            if ( ti->isDensePod() && !ti->isRef() && uint32_t(getTypeSize(ti))==stride ) {
+                update(pa, uint64_t(stride)*count);
+            } else {
+                DataWalker::walk_array(pa, stride, count, ti);
+            }
+        }
     // data types
         virtual void Bool ( bool & t )          { update(t); }
+        virtual void Int8 ( int8_t & t )        { update(t); }
+        virtual void UInt8 ( uint8_t & t )      { update(t); }
+        virtual void Int16 ( int16_t & t )      { update(t); }
+        virtual void UInt16 ( uint16_t & t )    { update(t); }
         virtual void Int64 ( int64_t & t )      { update(t); }
         virtual void UInt64 ( uint64_t & t )    { update(t); }
+        virtual void Double ( double & t )      { update(t); }
         virtual void Float ( float & t )        { update(t); }
         virtual void Int ( int32_t & t )        { update(t); }
         virtual void UInt ( uint32_t & t )      { update(t); }
+        virtual void Bitfield ( uint32_t & t, TypeInfo * ) { update(t); }
         virtual void Int2 ( int2 & t )          { update(t); }
         virtual void Int3 ( int3 & t )          { update(t); }
         virtual void Int4 ( int4 & t )          { update(t); }
@@ -54,6 +72,9 @@ namespace das
         virtual void Range ( range & t )        { update(t); }
         virtual void URange ( urange & t )      { update(t); }
         virtual void String ( char * & t )      { updateString(t); }
+        virtual void WalkEnumeration ( int32_t & t, EnumInfo * )    { update(t); }
+        virtual void WalkEnumeration8  ( int8_t & t, EnumInfo * )   { update(t); }
+        virtual void WalkEnumeration16 ( int16_t & t, EnumInfo * )  { update(t); }
     // unsupported
         virtual void beforeIterator ( Sequence *, TypeInfo * ) { error("HASH, not expecting iterator"); }
         virtual void WalkBlock ( Block * )              { error("HASH, not expecting block"); }
@@ -71,4 +92,3 @@ namespace das
         return walker.getHash();
     }
 }
-
@@ -27,6 +27,19 @@ namespace das {
         return nullptr;
     }
 
+    void ClosurePool::getStats ( ClosurePoolStats & stats ) const {
+        stats.allocations = allocations;
+        stats.reused = reused;
+        stats.frees = frees;
+        stats.pooled = pooled;
+        stats.liveBlocks = live;
+        stats.freeBlocks = 0;
+        stats.freeBytes = pooledBytes;
+        for ( uint32_t sc=0; sc!=DAS_CLOSURE_POOL_CLASSES; ++sc ) {
+            stats.freeBlocks += counts[sc];
+        }
+    }
+
     char * StringHeapAllocator::allocateString ( const string & str ) {
         return allocateString ( str.c_str(), uint32_t(str.length()) );
     }
@@ -39,6 +52,16 @@ namespace das {
                 tout << "\t" << ch->allocated << " of " << ch->total << ", " << (ch->allocated*ch->size) << " of " << ch->totalBytes << " bytes\n";
             }
         }
+        uint32_t freeBlocks; uint64_t freeBytes;
+        model.buckets.getStats(freeBlocks, freeBytes);
+        if ( freeBlocks ) {
+            tout << "free big stuff, " << freeBlocks << " blocks, " << freeBytes << " bytes:\n";
+            for ( uint32_t bi=0; bi!=DAS_MAX_BUCKETS; ++bi ) {
+                if ( model.buckets.counts[bi] ) {
+                    tout << "\t" << model.buckets.counts[bi] << " of size " << Buckets::bucketSizeByIndex(bi) << "\n";
+                }
+            }
+        }
         if ( !model.bigStuff.empty() ) {
             tout << "big stuff:\n";
 #if DAS_TRACK_ALLOCATIONS
@@ -120,38 +143,65 @@ namespace das {
         }
     }
 
-    void StringHeapAllocator::setIntern(bool on) {
+    void StringHeapAllocator::setIntern(bool on, ConstStringAllocator * constStrings) {
         needIntern = on;
+        constStringHeap = on ? constStrings : nullptr;
         if ( !needIntern ) {
             das_string_set empty;
             swap ( internMap, empty );
+            vector<InternHashSlot> noCache;
+            swap ( hashCache, noCache );
+        } else if ( hashCache.empty() ) {
+            hashCache.resize(DAS_INTERN_HASH_CACHE_SIZE);
         }
     }
 
+    void StringHeapAllocator::clearHashCache() {
+        for ( auto & slot : hashCache ) slot.ptr = nullptr;
+    }
+
     void StringHeapAllocator::reset() {
         das_string_set empty;
         swap ( internMap, empty );
+        clearHashCache();
     }
 
     char * StringHeapAllocator::intern(const char * str, uint32_t length) const {
-        if ( needIntern ) {
-            auto it = internMap.find(StrHashEntry(str,length));
-            return it != internMap.end() ? (char *)it->ptr : nullptr;
-        } else {
-            return nullptr;
+        return needIntern ? intern(StrHashEntry(str,length)) : nullptr;
+    }
+
+    char * StringHeapAllocator::intern(const StrHashEntry & key) const {
+        if ( constStringHeap ) {
+            if ( auto ist = constStringHeap->intern(key) ) return ist;
         }
+        auto it = internMap.find(key);
+        return it != internMap.end() ? (char *)it->ptr : nullptr;
     }
 
-    void StringHeapAllocator::recognize ( char * str ) {
-        if ( !str ) return;
+    char * StringHeapAllocator::recognize ( char * str ) {
+        if ( !str || !needIntern ) return str;
         uint32_t length = uint32_t(strlen(str));
-        if ( needIntern && isOwnPtr(str, length+1) ) {
-            internMap.insert(StrHashEntry(str,length));
+        if ( !isOwnPtr(str, length+1) ) return str;
+        StrHashEntry key(str,length);
+        if ( auto ist = intern(key) ) {
+            cacheHash(ist, key.hash);
+            if ( ist != str ) {
+                free(str, length+1);
+                return ist;
+            }
+            return str;
         }
+        internMap.insert(key);
+        cacheHash(str, key.hash);
+        return str;
     }
 
     char * ConstStringAllocator::intern(const char * str, uint32_t length) const {
-        auto it = internMap.find(StrHashEntry(str,length));
+        return intern(StrHashEntry(str,length));
+    }
+
+    char * ConstStringAllocator::intern(const StrHashEntry & key) const {
+        auto it = internMap.find(key);
         return it != internMap.end() ? (char*)it->ptr : nullptr;
     }
 
@@ -182,10 +232,22 @@ namespace das {
     char * StringHeapAllocator::allocateString ( const char * text, uint32_t length ) {
         if ( length ) {
             if ( needIntern && text ) {
-                auto it = internMap.find(StrHashEntry(text,length));
-                if ( it != internMap.end() ) {
-                    return (char *) it->ptr;
+                StrHashEntry key(text,length);
+                if ( auto ist = intern(key) ) {
+                    cacheHash(ist, key.hash);
+                    return ist;
                 }
+                if ( auto str = (char *)allocate(length + 1) ) {
+#if DAS_TRACK_ALLOCATIONS
+                    if ( g_tracker_string==g_breakpoint_string ) os_debug_break();
+#endif
+                    memcpy(str, text, length);
+                    str[length] = 0;
+                    internMap.insert(StrHashEntry(str,length,key.hash));
+                    cacheHash(str, key.hash);
+                    return str;
+                }
+                return nullptr;
             }
             if ( auto str = (char *)allocate(length + 1) ) {
 #if DAS_TRACK_ALLOCATIONS
@@ -193,7 +255,6 @@ namespace das {
 #endif
                 if ( text ) memcpy(str, text, length);
                 str[length] = 0;
-                if ( needIntern && text ) internMap.insert(StrHashEntry(str,length));
                 return str;
             }
         }
@@ -201,7 +262,11 @@ namespace das {
     }
 
     void StringHeapAllocator::freeString ( char * text, uint32_t length ) {
-        if ( needIntern ) internMap.erase(StrHashEntry(text,length));
+        if ( needIntern ) {
+            if ( constStringHeap && constStringHeap->isOwnPtr(text) ) return;
+            internMap.erase(StrHashEntry(text,length));
+            uncacheHash(text);
+        }
         free ( text, length + 1 );
     }
 
@@ -215,14 +280,14 @@ namespace das {
         return buf;
     }
 
-    void PersistentStringAllocator::mark ( char * ptr, uint32_t len ) {
+    void PersistentStringAllocator::mark ( char * ptr, uint64_t len ) {
         auto it = model.bigStuff.find(ptr);                  // not a big allocation
         if ( it != model.bigStuff.end() ) {
             it->second |= DAS_PAGE_GC_MASK;
             return;
         }
         if ( len < DAS_MAX_SHOE_ALLOCATION ) {              // not a small allocation
-            if ( model.shoe.mark(ptr,len) ) {
+            if ( model.shoe.mark(ptr,uint32_t(len)) ) {
                 return;
             }
         }
@@ -238,6 +303,7 @@ namespace das {
         if ( needIntern ) {
             das_string_set empty;
             swap ( internMap, empty );
+            clearHashCache();
             forEachString([&](const char * str){
                 uint32_t length = uint32_t(strlen(str));
                 internMap.insert(StrHashEntry(str,length));
@@ -24,7 +24,7 @@ namespace das
     void array_reserve(Context & context, Array & arr, uint32_t newCapacity, uint32_t stride) {
         if ( arr.isLocked() ) context.throw_error("can't change capacity of a locked array");
         if ( arr.capacity >= newCapacity ) return;
-        auto newData = (char *)context.heap->reallocate(arr.data, arr.capacity*stride, newCapacity*stride);
+        auto newData = (char *)context.heap->reallocate(arr.data, uint64_t(arr.capacity)*stride, uint64_t(newCapacity)*stride);
         if ( !newData ) context.throw_error("out of linear allocator memory");
         context.heap->mark_comment(newData, "array");
         if ( newData != arr.data ) {
@@ -34,15 +34,30 @@ namespace das
         arr.capacity = newCapacity;
     }
 
+    void array_shrink ( Context & context, Array & arr, uint32_t stride ) {
+        if ( arr.isLocked() ) context.throw_error("can't shrink locked array");
+        if ( arr.capacity == arr.size ) return;
+        if ( !arr.size ) {
+            context.heap->free(arr.data, uint64_t(arr.capacity)*stride);
+            arr.data = nullptr;
+        } else {
+            auto newData = (char *)context.heap->reallocate(arr.data, uint64_t(arr.capacity)*stride, uint64_t(arr.size)*stride);
+            if ( !newData ) context.throw_error("out of linear allocator memory");
+            context.heap->mark_comment(newData, "array");
+            arr.data = newData;
+        }
+        arr.capacity = arr.size;
+    }
+
     void array_resize ( Context & context, Array & arr, uint32_t newSize, uint32_t stride, bool zero ) {
         if ( arr.isLocked() ) context.throw_error("can't resize locked array");
         if ( newSize > arr.capacity ) {
-            uint32_t newCapacity = 1 << (32 - __builtin_clz (das::max(newSize,2u) - 1));
+            uint32_t newCapacity = newSize <= 0x80000000u ? 1u << (32 - __builtin_clz (das::max(newSize,2u) - 1)) : 0xffffffffu;
             newCapacity = das::max(newCapacity, 16u);
             array_reserve(context, arr, newCapacity, stride);
         }
         if ( zero && newSize>arr.size ) {
-            memset ( arr.data + arr.size*stride, 0, (newSize-arr.size)*stride );
+            memset ( arr.data + uint64_t(arr.size)*stride, 0, uint64_t(newSize-arr.size)*stride );
         }
         arr.size = newSize;
     }
@@ -54,7 +69,7 @@ namespace das
         array_lock(context, *array);
         data = array->data;
         *value = data;
-        array_end  = data + array->size * stride;
+        array_end  = data + uint64_t(array->size) * stride;
         return (bool) array->size;
     }
 
@@ -65,6 +80,16 @@ namespace das
         return data != array_end;
     }
 
+    uint32_t GoodArrayIterator::next_batch ( Context &, char *, char * values, uint32_t vstride, uint32_t count )  {
+        uint32_t left = uint32_t((array_end - data) / stride) - 1;
+        if ( count > left ) count = left;
+        for ( uint32_t i=0; i!=count; ++i ) {
+            data += stride;
+            *(char **)(values + i*vstride) = data;
+        }
+        return count;
+    }
+
     void GoodArrayIterator::close ( Context & context, char * _value )  {
         if ( _value ) {
             char ** value = (char **) _value;
@@ -90,7 +115,7 @@ namespace das
     bool FixedArrayIterator::first ( Context &, char * _value )  {
         char ** value = (char **) _value;
         *value = data;
-        fixed_array_end = data + size*stride;
+        fixed_array_end = data + uint64_t(size)*stride;
         return (bool) size;
     }
 
@@ -101,6 +126,16 @@ namespace das
         return data != fixed_array_end;
     }
 
+    uint32_t FixedArrayIterator::next_batch ( Context &, char *, char * values, uint32_t vstride, uint32_t count )  {
+        uint32_t left = uint32_t((fixed_array_end - data) / stride) - 1;
+        if ( count > left ) count = left;
+        for ( uint32_t i=0; i!=count; ++i ) {
+            data += stride;
+            *(char **)(values + i*vstride) = data;
+        }
+        return count;
+    }
+
     void FixedArrayIterator::close ( Context & context, char * _value )  {
         if ( _value ) {
             char ** value = (char **) _value;
@@ -129,7 +164,7 @@ namespace das
         for ( uint32_t i=0; i!=total; ++i, pArray-- ) {
             if ( pArray->data ) {
                 if ( !pArray->isLocked() ) {
-                    uint32_t oldSize = pArray->capacity*stride;
+                    uint64_t oldSize = uint64_t(pArray->capacity)*stride;
                     context.heap->free(pArray->data, oldSize);
                 } else {
                     context.throw_error("deleting locked array");
@@ -18,6 +18,16 @@ namespace das
         return (nextValue != range_to);
     }
 
+    uint32_t RangeIterator::next_batch ( Context &, char * value, char * values, uint32_t stride, uint32_t count ) {
+        int32_t at = *(int32_t *) value;
+        uint32_t left = uint32_t(range_to - at) - 1;
+        if ( count > left ) count = left;
+        for ( uint32_t i=0; i!=count; ++i ) {
+            *(int32_t *)(values + i*stride) = ++at;
+        }
+        return count;
+    }
+
     void RangeIterator::close ( Context & context, char * ) {
         context.heap->free((char *)this, sizeof(RangeIterator));
     }
@@ -23,7 +23,7 @@ namespace das
         } else if ( char * sAB = (char * ) context.stringHeap->allocateString(nullptr, commonLength) ) {
             memcpy ( sAB, sA, la );
             memcpy ( sAB+la, sB, lb+1 );
-            return cast<char *>::from(sAB);
+            return cast<char *>::from(context.stringHeap->recognize(sAB));
         } else {
             context.throw_error("can't add two strings, out of heap");
             return v_zero();
@@ -43,8 +43,7 @@ namespace das
         } else if ( char * sAB = (char * ) context.stringHeap->allocateString(nullptr, commonLength) ) {
             memcpy ( sAB, sA, la );
             memcpy ( sAB+la, sB, lb+1 );
-            *pA = sAB;
-            context.stringHeap->recognize(sAB);
+            *pA = context.stringHeap->recognize(sAB);
         } else {
             context.throw_error("can't add two strings, out of heap");
         }
@@ -168,20 +167,16 @@ namespace das
     }
 
     string to_string_ex ( double dnum ) {
-        char buffer[32];
-        memset(buffer, 0, sizeof(buffer));
-        snprintf(buffer, sizeof(buffer), "%.17g", dnum);
-        string stst(buffer);
+        char buffer[DAS_FMT_NUMBER_SIZE];
+        string stst(buffer, fmt_double(buffer, dnum));
         if ( stst.find_first_of(".e")==string::npos )
             stst += ".";
         return stst;
     }
 
     string to_string_ex ( float dnum ) {
-        char buffer[32];
-        memset(buffer, 0, sizeof(buffer));
-        snprintf(buffer, sizeof(buffer), "%.9g", dnum);
-        string stst(buffer);
+        char buffer[DAS_FMT_NUMBER_SIZE];
+        string stst(buffer, fmt_float(buffer, dnum));
         if ( stst.find_first_of(".e")==string::npos )
             stst += ".";
         return stst;
@@ -305,6 +300,16 @@ namespace das
         return *value != 0;
     }
 
+    uint32_t StringIterator::next_batch ( Context &, char *, char * values, uint32_t stride, uint32_t count )  {
+        for ( uint32_t i=0; i!=count; ++i ) {
+            int32_t ch = uint8_t(*str);
+            if ( !ch ) return i;
+            *(int32_t *)(values + i*stride) = ch;
+            str ++;
+        }
+        return count;
+    }
+
     void StringIterator::close ( Context & context, char * _value )  {
         if ( _value ) {
             int32_t * value = (int32_t *) _value;
@@ -6,10 +6,113 @@ namespace das
 {
     void table_clear ( Context & context, Table & arr ) {
         if ( arr.isLocked() ) context.throw_error("can't clear locked table");
-        memset(arr.hashes, 0, arr.capacity * sizeof(uint32_t));
+        memset(arr.hashes, 0, uint64_t(table_entries(arr)) * sizeof(uint32_t));
+        memset(table_ctrl(arr), DAS_TABLE_CTRL_EMPTY, arr.capacity);
         arr.size = 0;
+        arr.tombstones = 0;
     }
 
+    // rehashing only copies keys, so any key type of the same size will do
+    template <int keySize>
+    struct TableKeyBytes {
+        uint8_t bytes[keySize];
+    };
+
+    template <int keySize>
+    void table_shrink_t ( Context & context, Table & arr, uint32_t valueSize ) {
+        TableHash<TableKeyBytes<keySize>> thh(&context, valueSize);
+        thh.shrink(arr);
+    }
+
+    void table_shrink ( Context & context, Table & arr, uint32_t keySize, uint32_t valueSize ) {
+        switch ( keySize ) {
+            case 1:     table_shrink_t<1>(context, arr, valueSize); break;
+            case 2:     table_shrink_t<2>(context, arr, valueSize); break;
+            case 4:     table_shrink_t<4>(context, arr, valueSize); break;
+            case 8:     table_shrink_t<8>(context, arr, valueSize); break;
+            case 12:    table_shrink_t<12>(context, arr, valueSize); break;
+            case 16:    table_shrink_t<16>(context, arr, valueSize); break;
+            default:    context.throw_error_ex("can't shrink table with %u byte keys", keySize);
+        }
+    }
+
+    template <int keySize>
+    void table_reserve_t ( Context & context, Table & arr, uint32_t newSize, uint32_t valueSize ) {
+        TableHash<TableKeyBytes<keySize>> thh(&context, valueSize);
+        thh.reserveCapacity(arr, newSize);
+    }
+
+    void table_reserve ( Context & context, Table & arr, uint32_t newSize, uint32_t keySize, uint32_t valueSize ) {
+        switch ( keySize ) {
+            case 1:     table_reserve_t<1>(context, arr, newSize, valueSize); break;
+            case 2:     table_reserve_t<2>(context, arr, newSize, valueSize); break;
+            case 4:     table_reserve_t<4>(context, arr, newSize, valueSize); break;
+            case 8:     table_reserve_t<8>(context, arr, newSize, valueSize); break;
+            case 12:    table_reserve_t<12>(context, arr, newSize, valueSize); break;
+            case 16:    table_reserve_t<16>(context, arr, newSize, valueSize); break;
+            default:    context.throw_error_ex("can't reserve table with %u byte keys", keySize);
+        }
+    }
+
+    #define DAS_TABLE_KEY_DISPATCH(KEYTYPE,FN) \
+        switch ( KEYTYPE ) { \
+        case Type::tBool:           FN(bool); break; \
+        case Type::tInt8:           FN(int8_t); break; \
+        case Type::tUInt8:          FN(uint8_t); break; \
+        case Type::tInt16:          FN(int16_t); break; \
+        case Type::tUInt16:         FN(uint16_t); break; \
+        case Type::tInt64:          FN(int64_t); break; \
+        case Type::tUInt64:         FN(uint64_t); break; \
+        case Type::tEnumeration:    FN(int32_t); break; \
+        case Type::tEnumeration8:   FN(int8_t); break; \
+        case Type::tEnumeration16:  FN(int16_t); break; \
+        case Type::tBitfield:       FN(uint32_t); break; \
+        case Type::tInt:            FN(int32_t); break; \
+        case Type::tInt2:           FN(int2); break; \
+        case Type::tInt3:           FN(int3); break; \
+        case Type::tInt4:           FN(int4); break; \
+        case Type::tUInt:           FN(uint32_t); break; \
+        case Type::tUInt2:          FN(uint2); break; \
+        case Type::tUInt3:          FN(uint3); break; \
+        case Type::tUInt4:          FN(uint4); break; \
+        case Type::tFloat:          FN(float); break; \
+        case Type::tFloat2:         FN(float2); break; \
+        case Type::tFloat3:         FN(float3); break; \
+        case Type::tFloat4:         FN(float4); break; \
+        case Type::tRange:          FN(range); break; \
+        case Type::tURange:         FN(urange); break; \
+        case Type::tString:         FN(char *); break; \
+        case Type::tPointer:        FN(void *); break; \
+        case Type::tDouble:         FN(double); break; \
+        default:                    context.throw_error_ex("unsupported table key type %s", das_to_string(KEYTYPE).c_str()); \
+        }
+
+    template <typename KeyType>
+    void table_find_batch_t ( Context & context, const Table & tab, const char * keys, uint32_t count, uint32_t valueTypeSize, int32_t * result ) {
+        TableHash<KeyType> thh(&context, valueTypeSize);
+        thh.findBatch(tab, (const KeyType *) keys, count, result);
+    }
+
+    template <typename KeyType>
+    void table_reserve_batch_t ( Context & context, Table & tab, const char * keys, uint32_t count, uint32_t valueTypeSize, int32_t * result ) {
+        TableHash<KeyType> thh(&context, valueTypeSize);
+        thh.reserveBatch(tab, (const KeyType *) keys, count, result);
+    }
+
+    void table_find_batch ( Context & context, const Table & tab, Type keyType, const char * keys, uint32_t count, uint32_t valueTypeSize, int32_t * result ) {
+        #define DAS_FIND_BATCH(KT) table_find_batch_t<KT>(context, tab, keys, count, valueTypeSize, result)
+        DAS_TABLE_KEY_DISPATCH(keyType, DAS_FIND_BATCH);
+        #undef DAS_FIND_BATCH
+    }
+
+    void table_reserve_batch ( Context & context, Table & tab, Type keyType, const char * keys, uint32_t count, uint32_t valueTypeSize, int32_t * result ) {
+        #define DAS_RESERVE_BATCH(KT) table_reserve_batch_t<KT>(context, tab, keys, count, valueTypeSize, result)
+        DAS_TABLE_KEY_DISPATCH(keyType, DAS_RESERVE_BATCH);
+        #undef DAS_RESERVE_BATCH
+    }
+
+    #undef DAS_TABLE_KEY_DISPATCH
+
     void table_lock ( Context & context, Table & arr ) {
         if ( arr.shared || arr.hopeless ) return;
         arr.lock ++;
@@ -24,8 +127,9 @@ namespace das
 
     // TableIterator
 
+    // entries, which are not in use, are skipped
     size_t TableIterator::nextValid ( size_t index ) const {
-        for (; index < table->capacity; index++) {
+        for (size_t is = table_entries(*table); index < is; index++) {
             if (table->hashes[index] > HASH_KILLED32) {
                 break;
             }
@@ -37,7 +141,7 @@ namespace das
         char ** value = (char **)_value;
         table_lock(context, *(Table *)table);
         data  = getData();
-        table_end = data + table->capacity * stride;
+        table_end = data + uint64_t(table_entries(*table)) * stride;
         size_t index = nextValid(0);
         data += index * stride;
         *value = data;
@@ -54,6 +158,19 @@ namespace das
         return data != table_end;
     }
 
+    uint32_t TableIterator::next_batch ( Context &, char *, char * values, uint32_t vstride, uint32_t count ) {
+        char * tableData = getData();
+        size_t index = (data-tableData)/stride;
+        size_t entries = table_entries(*table);
+        for ( uint32_t i=0; i!=count; ++i ) {
+            index = nextValid(index + 1);
+            if ( index >= entries ) return i;
+            data = tableData + index * stride;
+            *(char **)(values + i*vstride) = data;
+        }
+        return count;
+    }
+
     void TableIterator::close ( Context & context, char * _value ) {
         if ( _value ) {
             char ** value = (char **) _value;
@@ -105,7 +222,7 @@ namespace das
         for ( uint32_t i=0; i!=total; ++i, pTable-- ) {
             if ( pTable->data ) {
                 if ( !pTable->isLocked() ) {
-                    uint32_t oldSize = pTable->capacity*(vts_add_kts + sizeof(uint32_t));
+                    uint64_t oldSize = table_memory_size(pTable->capacity, vts_add_kts);
                     context.heap->free(pTable->data, oldSize);
                 } else {
                     context.throw_error("deleting locked table");
@@ -42,6 +42,16 @@ namespace das
         context.heap->free((char *)this, size);
     }
 
+    // stride is the size of the value, so each value starts as a copy of the previous one
+    uint32_t Iterator::next_batch ( Context & context, char * value, char * values, uint32_t stride, uint32_t count ) {
+        for ( uint32_t i=0; i!=count; ++i ) {
+            char * slot = values + i*stride;
+            memcpy(slot, i ? slot - stride : value, stride);
+            if ( !next(context, slot) ) return i;
+        }
+        return count;
+    }
+
     // this is here to occasionally investigate untyped evaluation paths
     #define WARN_SLOW_CAST(TYPE)
     // #define WARN_SLOW_CAST(TYPE)    DAS_ASSERTF(0, "internal perofrmance issue, casting eval to eval##TYPE" );
@@ -105,7 +115,7 @@ namespace das
                 if ( persistent ) {
                     das_aligned_free16(*pStruct);
                 } else if ( isLambda ) {
-                    context.heap->free(*pStruct - 16, structSize + 16);
+                    context.heap->freeClosure(*pStruct - 16, structSize + 16);
                 } else {
                     context.heap->free(*pStruct, structSize);
                 }
@@ -584,7 +594,10 @@ namespace das
         // heap
         heap->setInitialSize(ctx.heap->getInitialSize());
         stringHeap->setInitialSize(ctx.stringHeap->getInitialSize());
-        stringHeap->setIntern(ctx.stringHeap->isIntern());
+        stringHeap->setIntern(ctx.stringHeap->isIntern(), constStringHeap.get());
+        memoryLimits = ctx.memoryLimits;
+        softMemoryLimitCallback = ctx.softMemoryLimitCallback;
+        installMemoryLimits();
         // globals
         annotationData = ctx.annotationData;
         globalsSize = ctx.globalsSize;
@@ -616,6 +629,7 @@ namespace das
     }
 
     Context::~Context() {
+        setAllocationSampling(0);
         if ( globals ) {
             das_aligned_free16(globals);
         }
@@ -624,6 +638,238 @@ namespace das
         }
     }
 
+    void Context::setMemoryLimits ( const ContextMemoryLimits & limits ) {
+        memoryLimits = limits;
+        installMemoryLimits();
+    }
+
+    void Context::setSoftMemoryLimitCallback ( SoftMemoryLimitCallback && callback ) {
+        softMemoryLimitCallback = callback;
+    }
+
+    void Context::installMemoryLimits() {
+        // no limits - no reserve function, so that there is no extra cost on growth
+        if ( heap ) {
+            if ( memoryLimits.any() ) {
+                heap->setReserveFunction([this](uint64_t bytes){ reserveHeapMemory(false, bytes); });
+            } else {
+                heap->setReserveFunction(nullptr);
+            }
+        }
+        if ( stringHeap ) {
+            if ( memoryLimits.any() ) {
+                stringHeap->setReserveFunction([this](uint64_t bytes){ reserveHeapMemory(true, bytes); });
+            } else {
+                stringHeap->setReserveFunction(nullptr);
+            }
+        }
+        softMemoryLimitReached = false;
+    }
+
+    uint64_t Context::getTotalHeapBytesAllocated() const {
+        uint64_t bytes = 0;
+        if ( heap ) bytes += heap->bytesAllocated();
+        if ( stringHeap ) bytes += stringHeap->bytesAllocated();
+        return bytes;
+    }
+
+    void Context::reserveHeapMemory ( bool isStringHeap, uint64_t bytes ) {
+        uint64_t heapBytes = heap ? heap->bytesAllocated() : 0;
+        uint64_t stringHeapBytes = stringHeap ? stringHeap->bytesAllocated() : 0;
+        if ( isStringHeap ) {
+            stringHeapBytes += bytes;
+        } else {
+            heapBytes += bytes;
+        }
+        uint64_t totalBytes = heapBytes + stringHeapBytes;
+        const auto & lim = memoryLimits;
+        if ( !isStringHeap && lim.heapLimit && heapBytes>lim.heapLimit ) {
+            throw_error_ex("out of memory, heap limit of %llu bytes exceeded while allocating %llu bytes",
+                (unsigned long long) lim.heapLimit, (unsigned long long) bytes);
+        }
+        if ( isStringHeap && lim.stringHeapLimit && stringHeapBytes>lim.stringHeapLimit ) {
+            throw_error_ex("out of memory, string heap limit of %llu bytes exceeded while allocating %llu bytes",
+                (unsigned long long) lim.stringHeapLimit, (unsigned long long) bytes);
+        }
+        if ( lim.totalLimit && totalBytes>lim.totalLimit ) {
+            throw_error_ex("out of memory, total heap limit of %llu bytes exceeded while allocating %llu bytes",
+                (unsigned long long) lim.totalLimit, (unsigned long long) bytes);
+        }
+        if ( !insideSoftMemoryLimitCallback ) {
+            bool soft = (lim.heapSoftLimit && heapBytes>lim.heapSoftLimit)
+                || (lim.stringHeapSoftLimit && stringHeapBytes>lim.stringHeapSoftLimit)
+                || (lim.totalSoftLimit && totalBytes>lim.totalSoftLimit);
+            if ( soft ) {
+                softMemoryLimitReached = true;
+                if ( softMemoryLimitCallback ) {
+                    // the callback may throw. with longjmp nothing unwinds, so errors are caught and re-thrown
+                    // after the flag is reset. the guard covers native exceptions, which are not dasException
+                    struct ResetSoftLimitFlag {
+                        bool & flag;
+                        ~ResetSoftLimitFlag() { flag = false; }
+                    } resetFlag { insideSoftMemoryLimitCallback };
+                    insideSoftMemoryLimitCallback = true;
+                    bool ok = runWithCatch([&](){
+                        softMemoryLimitCallback(this, heapBytes, stringHeapBytes);
+                    });
+                    insideSoftMemoryLimitCallback = false;
+                    if ( !ok ) throw_error(exception);
+                }
+            }
+        }
+    }
+
+    #define DAS_MAX_ALLOCATION_FRAMES  8
+
+    AllocationSampler::AllocationSampler ( Context * ctx, uint64_t inter, bool isStringHeap )
+        : context(ctx), interval(inter) {
+        pending.stringHeap = isStringHeap;
+        countdown = int64_t(nextInterval());
+    }
+
+    uint64_t AllocationSampler::nextInterval() {
+        // xorshift jitter in [interval/2, interval*3/2), so that periodic allocation patterns don't alias with sampling
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        return interval/2 + (interval ? seed % interval : 0) + 1;
+    }
+
+    void AllocationSampler::sample ( char * ptr, uint64_t size ) {
+        countdown = int64_t(nextInterval());
+        lastSample = ptr;
+        pending.at = nullptr;
+        pending.comment = nullptr;
+        pending.sampledBytes = size;
+        pending.estimatedBytes = das::max(size, interval);
+        pending.stack.clear();
+#if DAS_ENABLE_STACK_WALK
+        auto & stack = context->stack;
+        char * sp = stack.ap();
+        while ( sp < stack.top() && pending.stack.size() < DAS_MAX_ALLOCATION_FRAMES ) {
+            Prologue * pp = (Prologue *) sp;
+            FuncInfo * info = nullptr;
+            if ( pp->info ) {
+                intptr_t iblock = intptr_t(pp->block);
+                info = (iblock & 1) ? ((Block *)(iblock & ~1))->info : pp->info;
+            }
+            AllocationFrame frame;
+            frame.info = info;
+            frame.line = info ? pp->line : nullptr;
+            pending.stack.push_back(frame);
+            sp += info ? info->stackSize : pp->stackSize;
+        }
+#endif
+        record(1);
+    }
+
+    void AllocationSampler::sampleLocation ( LineInfo * at ) {
+        record(-1);
+        pending.at = at;
+        record(1);
+    }
+
+    void AllocationSampler::sampleComment ( const char * what ) {
+        record(-1);
+        pending.comment = what;
+        record(1);
+    }
+
+    void AllocationSampler::record ( int64_t dir ) {
+        uint64_t key = 14695981039346656037ull;
+        auto mix = [&]( const void * p ) { key = (key ^ uint64_t(intptr_t(p))) * 1099511628211ull; };
+        mix(pending.at);
+        mix(pending.comment);
+        for ( const auto & frame : pending.stack ) {
+            mix(frame.info);
+            mix(frame.line);
+        }
+        auto & site = sites[key];
+        if ( !site.samples ) {
+            site.at = pending.at;
+            site.comment = pending.comment;
+            site.stringHeap = pending.stringHeap;
+            site.stack = pending.stack;
+        }
+        site.samples += dir;
+        site.sampledBytes += dir * int64_t(pending.sampledBytes);
+        site.estimatedBytes += dir * int64_t(pending.estimatedBytes);
+        if ( !site.samples ) {
+            sites.erase(key);
+        }
+    }
+
+    void AllocationSampler::getSites ( vector<AllocationSite> & result ) const {
+        for ( const auto & it : sites ) {
+            result.push_back(it.second);
+        }
+    }
+
+    void AllocationSampler::clear() {
+        sites.clear();
+        lastSample = nullptr;
+    }
+
+    void Context::setAllocationSampling ( uint64_t interval ) {
+        if ( heap ) heap->sampler = nullptr;
+        if ( stringHeap ) stringHeap->sampler = nullptr;
+        if ( heapSampler ) { delete heapSampler; heapSampler = nullptr; }
+        if ( stringHeapSampler ) { delete stringHeapSampler; stringHeapSampler = nullptr; }
+        allocationSamplingInterval = interval;
+        if ( interval ) {
+            heapSampler = new AllocationSampler(this, interval, false);
+            stringHeapSampler = new AllocationSampler(this, interval, true);
+            if ( heap ) heap->sampler = heapSampler;
+            if ( stringHeap ) stringHeap->sampler = stringHeapSampler;
+        }
+    }
+
+    void Context::resetAllocationSampling() {
+        if ( heapSampler ) heapSampler->clear();
+        if ( stringHeapSampler ) stringHeapSampler->clear();
+    }
+
+    void Context::getTopAllocationSites ( vector<AllocationSite> & sites, uint32_t count ) const {
+        sites.clear();
+        if ( heapSampler ) heapSampler->getSites(sites);
+        if ( stringHeapSampler ) stringHeapSampler->getSites(sites);
+        sort(sites.begin(), sites.end(), [](const AllocationSite & a, const AllocationSite & b) {
+            return a.estimatedBytes > b.estimatedBytes;
+        });
+        if ( sites.size() > count ) {
+            sites.resize(count);
+        }
+    }
+
+    string Context::reportAllocationSites ( uint32_t count ) const {
+        TextWriter ssw;
+        if ( !allocationSamplingInterval ) {
+            ssw << "allocation sampling is off\n";
+            return ssw.str();
+        }
+        vector<AllocationSite> sites;
+        getTopAllocationSites(sites, count);
+        ssw << "top " << uint32_t(sites.size()) << " allocation sites, sampled every "
+            << allocationSamplingInterval << " bytes:\n";
+        for ( const auto & site : sites ) {
+            ssw << site.estimatedBytes << " bytes, " << site.samples << " samples";
+            if ( site.stringHeap ) ssw << ", string heap";
+            if ( site.comment ) ssw << ", " << site.comment;
+            if ( site.at ) ssw << " at " << site.at->describe();
+            ssw << "\n";
+            for ( const auto & frame : site.stack ) {
+                if ( !frame.info ) {
+                    ssw << "\tAOT\n";
+                } else if ( frame.line ) {
+                    ssw << "\t" << frame.info->name << " from " << frame.line->describe() << "\n";
+                } else {
+                    ssw << "\t" << frame.info->name << "\n";
+                }
+            }
+        }
+        return ssw.str();
+    }
+
     uint64_t Context::getSharedMemorySize() const {
         uint64_t mem = 0;
         mem += code->totalAlignedMemoryAllocated();
@@ -44,7 +44,7 @@ namespace das {
             auto pl = (Array *) l.compute##COMPUTEL(context); \
             auto rr = uint32_t(r.subexpr->evalInt(context)); \
             if ( rr >= pl->size ) context.throw_error_at(debugInfo,"array index out of range, %u of %u", rr, pl->size); \
-            return *((CTYPE *)(pl->data + rr*stride + offset)); \
+            return *((CTYPE *)(pl->data + uint64_t(rr)*stride + offset)); \
         } \
         DAS_NODE(TYPE,CTYPE); \
     };
@@ -56,7 +56,7 @@ namespace das {
             auto pl = (Array *) l.compute##COMPUTEL(context); \
             auto rr = *((uint32_t *)r.compute##COMPUTER(context)); \
             if ( rr >= pl->size ) context.throw_error_at(debugInfo,"array index out of range, %u of %u", rr, pl->size); \
-            return *((CTYPE *)(pl->data + rr*stride + offset)); \
+            return *((CTYPE *)(pl->data + uint64_t(rr)*stride + offset)); \
         } \
         DAS_NODE(TYPE,CTYPE); \
     };
@@ -85,7 +85,7 @@ namespace das {
             auto pl = (Array *) l.compute##COMPUTEL(context); \
             auto rr = uint32_t(r.subexpr->evalInt(context)); \
             if ( rr >= pl->size ) context.throw_error_at(debugInfo,"array index out of range, %u of %u", rr, pl->size); \
-            return v_ldu((const float *)(pl + rr*stride + offset)); \
+            return v_ldu((const float *)(pl->data + uint64_t(rr)*stride + offset)); \
         } \
     };
 
@@ -97,7 +97,7 @@ namespace das {
             auto pl = (Array *) l.compute##COMPUTEL(context); \
             auto rr = *((uint32_t *)r.compute##COMPUTER(context)); \
             if ( rr >= pl->size ) context.throw_error_at(debugInfo,"array index out of range, %u of %u", rr, pl->size); \
-            return v_ldu((const float *)(pl->data + rr*stride + offset)); \
+            return v_ldu((const float *)(pl->data + uint64_t(rr)*stride + offset)); \
         } \
     };
 
@@ -116,7 +116,7 @@ namespace das {
             auto pl = (Array *) l.compute##COMPUTEL(context); \
             auto rr = uint32_t(r.subexpr->evalInt(context)); \
             if ( rr >= pl->size ) context.throw_error_at(debugInfo,"array index out of range, %u of %u", rr, pl->size); \
-            return pl->data + rr*stride + offset; \
+            return pl->data + uint64_t(rr)*stride + offset; \
         } \
         DAS_PTR_NODE; \
     };
@@ -129,7 +129,7 @@ namespace das {
             auto pl = (Array *) l.compute##COMPUTEL(context); \
             auto rr = *((uint32_t *)r.compute##COMPUTER(context)); \
             if ( rr >= pl->size ) context.throw_error_at(debugInfo,"array index out of range, %u of %u", rr, pl->size); \
-            return pl->data + rr*stride + offset; \
+            return pl->data + uint64_t(rr)*stride + offset; \
         } \
         DAS_PTR_NODE; \
     };
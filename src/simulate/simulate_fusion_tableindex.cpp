@@ -45,7 +45,7 @@ namespace das {
             TableHash<CTYPE> thh(&context,valueTypeSize); \
             auto hfn = hash_function(context, key); \
             int index = thh.reserve(*tab, key, hfn); \
-            return tab->data + index * valueTypeSize + offset; \
+            return tab->data + uint64_t(index) * valueTypeSize + offset; \
         } \
         DAS_PTR_NODE; \
     };
@@ -59,7 +59,7 @@ namespace das {
             TableHash<CTYPE> thh(&context,valueTypeSize); \
             auto hfn = hash_function(context, key); \
             int index = thh.reserve(*tab, key, hfn); \
-            return tab->data + index * valueTypeSize + offset; \
+            return tab->data + uint64_t(index) * valueTypeSize + offset; \
         } \
         DAS_PTR_NODE; \
     };